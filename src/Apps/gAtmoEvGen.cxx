@@ -29,6 +29,8 @@
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
                        [--cache-file root_file]
+                       [--importance-sampling]
+                       [--aim-at-geometry]
 
          *** Options :
 
@@ -166,6 +168,16 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --importance-sampling
+              Draws the flux neutrino energies from the flux weighted by the
+              total cross section of the geometry (see GMCJDriver), so that
+              fewer flux neutrinos are thrown and rejected per generated event.
+              The generated events are weighted to keep the nominal spectrum.
+           --aim-at-geometry
+              Aims the flux neutrinos at the bounding box of the (ROOT) geometry
+              top volume instead of throwing them through a disk of radius 1 m,
+              so that fewer flux neutrinos miss the detector. The generation
+              area is printed at the end of the job, for the normalization.
 
          *** Examples:
 
@@ -223,6 +235,10 @@
 #include <map>
 
 #include <TRotation.h>
+#include <TVector3.h>
+#include <TGeoManager.h>
+#include <TGeoVolume.h>
+#include <TGeoBBox.h>
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/EventRecord.h"
@@ -231,6 +247,7 @@
 #include "Framework/EventGen/GMCJMonitor.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -268,6 +285,7 @@ void            GetCommandLineArgs (int argc, char ** argv);
 void            PrintSyntax        (void);
 GFluxI *        GetFlux            (void);
 GeomAnalyzerI * GetGeometry        (void);
+void            AimFluxAtGeometry  (GFluxI * flux, GeomAnalyzerI * geom);
 
 // User-specified options:
 //
@@ -289,6 +307,8 @@ string          gOptEvFilePrefix;              // event file prefix
 TRotation       gOptRot;                       // coordinate rotation matrix: topocentric horizontal -> user-defined topocentric system
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
+bool            gOptImportanceSampling = false;// xsec weighted flux neutrino energies?
+bool            gOptAimAtGeom = false;         // aim the flux neutrinos at the geometry bounding box?
 
 // Defaults:
 //
@@ -323,14 +343,22 @@ int main(int argc, char** argv)
   // get geometry driver
   GeomAnalyzerI * geom_driver = GetGeometry();
 
+  // aim the flux neutrinos at the detector
+  if(gOptAimAtGeom) {
+    AimFluxAtGeometry(flux_driver, geom_driver);
+  }
+
   // create the GENIE monte carlo job driver
   GMCJDriver* mcj_driver = new GMCJDriver;
   mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
   mcj_driver->UseFluxDriver(flux_driver);
   mcj_driver->UseGeomAnalyzer(geom_driver);
+  mcj_driver->UseImportanceSampling(gOptImportanceSampling);
   mcj_driver->Configure();
   mcj_driver->UseSplines();
-  mcj_driver->ForceSingleProbScale();
+  if(!gOptImportanceSampling) {
+    mcj_driver->ForceSingleProbScale();
+  }
 
   // initialize an ntuple writer
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
@@ -360,10 +388,28 @@ int main(int argc, char** argv)
     ntpw.AddEventRecord(iev, event);
     mcjmonitor.Update(iev,event);
 
-    // clean-up
-    delete event;
+    // clean-up (the event record is re-used by the driver)
+    mcj_driver->RecycleEvent(event);
   }
 
+  // store the sample normalization in the tree header (combined by gmerge
+  // when the outputs of a production split in jobs are merged)
+  NtpMCTreeHeader * tree_header = ntpw.TreeHeader();
+  if(tree_header) {
+    tree_header->nfluxnu         = mcj_driver->NFluxNeutrinos();
+    tree_header->globprobscale   = mcj_driver->GlobProbScale();
+    tree_header->sumfluxintprobs = mcj_driver->SumFluxIntProbs();
+  }
+
+#ifdef __GENIE_FLUX_DRIVERS_ENABLED__
+  GAtmoFlux * atmo_flux_driver = dynamic_cast<GAtmoFlux *>(flux_driver);
+  if(atmo_flux_driver) {
+    LOG("gevgen_atmo", pNOTICE)
+       << "Threw " << mcj_driver->NFluxNeutrinos() << " flux neutrinos through "
+       << atmo_flux_driver->GenerationArea() << " m^2";
+  }
+#endif
+
   // save the event file
   ntpw.Save();
 
@@ -438,6 +484,61 @@ GeomAnalyzerI* GetGeometry(void)
   return geom_driver;
 }
 //________________________________________________________________________________________
+void AimFluxAtGeometry(GFluxI * flux, GeomAnalyzerI * geom)
+{
+// Aims the flux neutrinos at the axis-aligned box (in the user-defined
+// coordinate system, m) bounding the top volume of the ROOT geometry
+
+#if defined(__GENIE_FLUX_DRIVERS_ENABLED__) && defined(__GENIE_GEOM_DRIVERS_ENABLED__)
+
+  GAtmoFlux * atmo_flux = dynamic_cast<GAtmoFlux *>(flux);
+  geometry::ROOTGeomAnalyzer * rgeom =
+        dynamic_cast<geometry::ROOTGeomAnalyzer *>(geom);
+  if(!atmo_flux || !rgeom) {
+    LOG("gevgen_atmo", pWARN)
+      << "Can only aim the flux neutrinos at a ROOT geometry - Ignoring --aim-at-geometry";
+    return;
+  }
+
+  TGeoVolume * topvol = rgeom->GetGeometry()->GetTopVolume();
+  TGeoBBox * bbox = dynamic_cast<TGeoBBox *>(topvol->GetShape());
+  if(!bbox) {
+    LOG("gevgen_atmo", pWARN)
+      << "The top volume has no bounding box - Ignoring --aim-at-geometry";
+    return;
+  }
+
+  // transform the corners of the top volume bounding box to the master
+  // coordinate system and bound them with an axis-aligned box
+  const double * origin = bbox->GetOrigin();
+  double d[3] = { bbox->GetDX(), bbox->GetDY(), bbox->GetDZ() };
+  double lunits = rgeom->LengthUnits();
+
+  TVector3 vmin, vmax;
+  for(int ic = 0; ic < 8; ic++) {
+    TVector3 corner(origin[0] + ((ic & 1) ? d[0] : -d[0]),
+                    origin[1] + ((ic & 2) ? d[1] : -d[1]),
+                    origin[2] + ((ic & 4) ? d[2] : -d[2]));
+    rgeom->Top2Master(corner);
+    corner *= lunits;
+    for(int k = 0; k < 3; k++) {
+      if(ic == 0 || corner[k] < vmin[k]) vmin[k] = corner[k];
+      if(ic == 0 || corner[k] > vmax[k]) vmax[k] = corner[k];
+    }
+  }
+
+  TVector3 centre   = 0.5 * (vmin + vmax);
+  TVector3 halfsize = 0.5 * (vmax - vmin);
+  atmo_flux->SetDetectorBox(centre, halfsize);
+
+  LOG("gevgen_atmo", pNOTICE)
+    << "Aiming the flux neutrinos at the geometry bounding box: centre = "
+    << utils::print::Vec3AsString(&centre) << " m, half-size = "
+    << utils::print::Vec3AsString(&halfsize) << " m";
+
+#endif
+}
+//________________________________________________________________________________________
 GFluxI* GetFlux(void)
 {
   GFluxI * flux_driver = 0;
@@ -859,6 +960,12 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  //
+  // *** event generation speed-ups
+  //
+  gOptImportanceSampling = parser.OptionExists("importance-sampling");
+  gOptAimAtGeom          = parser.OptionExists("aim-at-geometry");
+
   //
   // print-out summary
   //
@@ -927,6 +1034,9 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n\t" << expinfo.str()
      << "\n @@ Cuts"
      << "\n\t Using energy range = (" << gOptEvMin << " GeV, " << gOptEvMax << " GeV)"
+     << "\n @@ Speed-ups"
+     << "\n\t Importance sampling: " << (gOptImportanceSampling ? "on" : "off")
+     << "\n\t Aiming at geometry : " << (gOptAimAtGeom ? "on" : "off")
      << "\n @@ Coordinate transformation (Rotation THZ -> User-defined coordinate system)"
      << "\n" << rotation.str()
      << "\n\n";
@@ -969,6 +1079,8 @@ void PrintSyntax(void)
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
    << "\n           [--cache-file root_file]"
+   << "\n           [--importance-sampling]"
+   << "\n           [--aim-at-geometry]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << "\n";
@@ -251,6 +251,7 @@
 #include "Framework/EventGen/GMCJMonitor.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -411,8 +412,17 @@ int main(int argc, char** argv)
     ntpw.AddEventRecord(iev, event);
     mcjmonitor.Update(iev,event);
 
-    // clean-up
-    delete event;
+    // clean-up (the event record is re-used by the driver)
+    mcj_driver->RecycleEvent(event);
+  }
+
+  // store the sample normalization in the tree header (combined by gmerge
+  // when the outputs of a production split in jobs are merged)
+  NtpMCTreeHeader * tree_header = ntpw.TreeHeader();
+  if(tree_header) {
+    tree_header->nfluxnu         = mcj_driver->NFluxNeutrinos();
+    tree_header->globprobscale   = mcj_driver->GlobProbScale();
+    tree_header->sumfluxintprobs = mcj_driver->SumFluxIntProbs();
   }
 
   // save the event file
@@ -9,13 +9,16 @@
          sample is specified)
 
          Syntax :
-           gevcomp -f sample [-r reference_sample]
+           gevcomp -f sample [-r reference_sample] [-j nthreads]
 
          Options:
            [] Denotes an optional argument
            -f Specifies the GENIE/ROOT file with the generated event sample
 	   -r Specifies another GENIE/ROOT event sample file for comparison 
            -n Specifies how many events to analyze [default: all]
+           -j Specifies the number of threads used for reading the samples
+              (the summary ntuples are then read in memory once, decompressing
+              the baskets in parallel, and all plots are filled from memory)
 
          Notes:
            The input ROOT files are the gst summary ntuples generated by 
@@ -55,6 +58,8 @@
 #include <TText.h>
 #include <TStyle.h>
 #include <TLegend.h>
+#include <TROOT.h>
+#include <RVersion.h>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -73,10 +78,12 @@ void   PrintSyntax          (void);
 bool   CheckRootFilename    (string filename);
 string OutputFileName       (string input_file_name);
 void   CreatePlots          (string filename, string filename_ref);
+void   CacheTree            (TTree * tree);
 
 // command-line arguments
 string   gOptInpFile     = ""; // (-f) input GENIE event sample file
 string   gOptInpFileRef  = ""; // (-r) input GENIE event sample file (reference)
+int      gOptNThreads    = 1;  // (-j) number of threads for reading the samples
 
 //_________________________________________________________________________________
 int main(int argc, char ** argv)
@@ -110,6 +117,17 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      assert(gst_1);
   }
   
+  // Each of the plots below is a separate pass over the summary ntuples.
+  // Read them in memory once (decompressing in parallel) so that the passes
+  // do not re-read and re-decompress the file
+  if(gOptNThreads > 1) {
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0) && defined(R__USE_IMT)
+     ROOT::EnableImplicitMT(gOptNThreads);
+#endif
+               CacheTree(gst_0);
+     if(gst_1) CacheTree(gst_1);
+  }
+
   gst_0->SetLineColor(kBlack);
   gst_0->SetLineWidth(3);
   if(gst_1) {
@@ -1979,6 +1997,18 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   }
 }
 //_________________________________________________________________________________
+void CacheTree(TTree * tree)
+{
+  Long64_t nbytes = tree->LoadBaskets();
+  if(nbytes < 0) {
+    LOG("gevcomp", pWARN)
+      << "Tree " << tree->GetName() << " could not be fully cached in memory";
+    return;
+  }
+  LOG("gevcomp", pNOTICE)
+    << "Cached " << nbytes << " bytes of tree " << tree->GetName();
+}
+//_________________________________________________________________________________
 string OutputFileName(string inpname)
 {
 // Builds the output filename based on the name of the input filename
@@ -2021,13 +2051,18 @@ void GetCommandLineArgs(int argc, char ** argv)
   } else {
     LOG("gevcomp", pNOTICE) << "Unspecified 'reference' event sample";
   }
+
+  // get number of threads
+  if( parser.OptionExists('j') ) {
+    gOptNThreads = TMath::Max(1, parser.ArgAsInt('j'));
+  }
 }
 //_________________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevcomp", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << " gevcomp -f sample.root [-n nev] [-r reference_sample.root]\n";
+    << " gevcomp -f sample.root [-n nev] [-r reference_sample.root] [-j nthreads]\n";
 }
 //_________________________________________________________________________________
 bool CheckRootFilename(string filename)
@@ -9,6 +9,7 @@
 
          gevdump -f filename 
                 [-n n1[,n2]] 
+                [-e ev1[,ev2,...]]
                 [--event-record-print-level]
 
          [] denotes an optional argument
@@ -17,6 +18,12 @@
             Specifies a GENIE GHEP/ROOT event file.
          -n 
             Specifies range of events to print-out (default: all)
+         -e 
+            Specifies a list of event numbers (as stored in the event record
+            headers, eg the event numbers of a merged or cherry-picked file)
+            of the events to print-out. The events are looked up in the event
+            index (see NtpEventIndex) if the file has one, otherwise all the
+            event records are read to find them.
          --event-record-print-level
             Allows users to set the level of information shown when the event
             record is printed in the screen. See GHepRecord::Print().
@@ -32,6 +39,9 @@
          3. Print out the event 178 from /data/sample.ghep.root 
             shell$ gevdump -f /data/sample.ghep.root -n 178
 
+         4. Print out the events numbered 1020 and 5377 in /data/sample.ghep.root 
+            shell$ gevdump -f /data/sample.ghep.root -e 1020,5377
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -44,6 +54,8 @@
 //____________________________________________________________________________
 
 #include <string>
+#include <vector>
+#include <map>
 
 #include <TFile.h>
 #include <TTree.h>
@@ -51,9 +63,11 @@
 
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/Ntuple/NtpEventIndex.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCCompactRecord.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/CmdLnArgParser.h"
@@ -65,15 +79,22 @@
 #endif 
 
 using std::string;
+using std::vector;
+using std::map;
 using namespace genie;
 
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
 void GetEventRange      (Long64_t nev, Long64_t & n1, Long64_t & n2);
+void GetEventEntries    (TFile & file, TTree * ghep_tree, NtpMCEventRecord * & mcrec,
+                         NtpMCCompactRecord * & cmrec, vector<Long64_t> & entries);
+void ReadEntry          (TTree * ghep_tree, Long64_t i,
+                         NtpMCEventRecord * & mcrec, NtpMCCompactRecord * & cmrec);
 
-Long64_t gOptNEvtL;
-Long64_t gOptNEvtH;
-string   gOptInpFilename;
+Long64_t         gOptNEvtL;
+Long64_t         gOptNEvtH;
+vector<Long64_t> gOptEvtNums;
+string           gOptInpFilename;
 
 //___________________________________________________________________
 int main(int argc, char ** argv)
@@ -116,7 +137,16 @@ int main(int argc, char ** argv)
 
   // main event record branch, always present
   NtpMCEventRecord * mcrec = 0;
-  ghep_tree->SetBranchAddress("gmcrec", &mcrec);
+  // compact event records (see NtpMCCompactRecord) are unpacked into a
+  // full record
+  NtpMCCompactRecord * cmrec = 0;
+  if(ghep_tree->GetBranch("gcmrec")) {
+    mcrec = new NtpMCEventRecord;
+    cmrec = new NtpMCCompactRecord;
+    ghep_tree->SetBranchAddress("gcmrec", &cmrec);
+  } else {
+    ghep_tree->SetBranchAddress("gmcrec", &mcrec);
+  }
 
   // if the event file was created by GENIE's gevpick `cherry-picking' app 
   // (see $GENIE/src/stdapp/gEvPick.cxx) then there will be additional branches
@@ -166,10 +196,10 @@ int main(int argc, char ** argv)
   // event loop
   //
 
-  Long64_t n1,n2;
-  GetEventRange(nev,n1,n2);
-  for(Long64_t i = n1; i <= n2; i++) {
-    ghep_tree->GetEntry(i);
+  vector<Long64_t> entries;
+  GetEventEntries(file, ghep_tree, mcrec, cmrec, entries);
+  for(unsigned int ientry = 0; ientry < entries.size(); ientry++) {
+    ReadEntry(ghep_tree, entries[ientry], mcrec, cmrec);
 
     // retrieve GHEP event record abd print it out.
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -203,7 +233,7 @@ int main(int argc, char ** argv)
     }
 #endif
 
-    mcrec->Clear();
+    if(!cmrec) mcrec->Clear();
   }
 
   // clean-up
@@ -234,6 +264,65 @@ void GetEventRange(Long64_t nev, Long64_t & n1, Long64_t & n2)
   }
 }
 //___________________________________________________________________
+void ReadEntry(TTree * ghep_tree, Long64_t i,
+               NtpMCEventRecord * & mcrec, NtpMCCompactRecord * & cmrec)
+{
+  ghep_tree->GetEntry(i);
+  if(cmrec) {
+    cmrec->Unpack(*mcrec->event);
+    mcrec->hdr.Copy(cmrec->hdr);
+  }
+}
+//___________________________________________________________________
+void GetEventEntries(TFile & file, TTree * ghep_tree, NtpMCEventRecord * & mcrec,
+                     NtpMCCompactRecord * & cmrec, vector<Long64_t> & entries)
+{
+  entries.clear();
+  Long64_t nev = ghep_tree->GetEntries();
+
+  if(gOptEvtNums.size() == 0) {
+    Long64_t n1,n2;
+    GetEventRange(nev,n1,n2);
+    for(Long64_t i = n1; i <= n2; i++) entries.push_back(i);
+    return;
+  }
+
+  // map the event numbers to tree entries, from the event index if the
+  // file has one, otherwise by reading all the event records
+  map<Long64_t, Long64_t> entry_of;
+  TTree * index_tree = NtpEventIndex::IndexTree(&file, ghep_tree);
+  if(index_tree) {
+    LOG("gevdump", pNOTICE) << "Looking up the events in the event index";
+    Long64_t iev = 0;
+    index_tree->SetBranchStatus("*",   0);
+    index_tree->SetBranchStatus("iev", 1);
+    index_tree->SetBranchAddress("iev", &iev);
+    for(Long64_t i = 0; i < nev; i++) {
+      index_tree->GetEntry(i);
+      if(entry_of.count(iev) == 0) entry_of[iev] = i;
+    }
+  } else {
+    LOG("gevdump", pNOTICE)
+      << "No event index found - Reading all events to find the requested ones";
+    for(Long64_t i = 0; i < nev; i++) {
+      ghep_tree->GetEntry(i);
+      Long64_t iev = (cmrec) ? cmrec->hdr.ievent : mcrec->hdr.ievent;
+      if(entry_of.count(iev) == 0) entry_of[iev] = i;
+      if(!cmrec) mcrec->Clear();
+    }
+  }
+
+  for(unsigned int k = 0; k < gOptEvtNums.size(); k++) {
+    map<Long64_t, Long64_t>::const_iterator it = entry_of.find(gOptEvtNums[k]);
+    if(it == entry_of.end()) {
+      LOG("gevdump", pWARN)
+        << "No event " << gOptEvtNums[k] << " in " << gOptInpFilename;
+      continue;
+    }
+    entries.push_back(it->second);
+  }
+}
+//___________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
 {
   LOG("gevdump", pINFO) << "*** Parsing command line arguments";
@@ -284,13 +373,21 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptNEvtH = -1;
   }
 
-  
+  // event numbers:
+  if ( parser.OptionExists('e') ) {
+    LOG("gevdump", pINFO) << "Reading the event numbers of events to print-out";
+    vector<long> vece = parser.ArgAsLongTokens('e',",");
+    for(unsigned int k = 0; k < vece.size(); k++) {
+      gOptEvtNums.push_back(vece[k]);
+    }
+  }
 }
 //_________________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevdump", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << "   gevdump -f sample.root [-n n1[,n2]] [--event-record-print-level]\n";
+    << "   gevdump -f sample.root [-n n1[,n2]] [-e ev1[,ev2,...]]"
+    << " [--event-record-print-level]\n";
 }
 //_________________________________________________________________________________
@@ -19,13 +19,14 @@
            gevgen [-h]
                   [-r run#]
                    -n nev
-                   -e energy (or energy range)
+                   -e energy (or energy range, or energy scan)
                    -p neutrino_pdg
                    -t target_pdg
                   [-f flux_description]
                   [-o outfile_name]
                   [-w]
                   [--seed random_number_seed]
+                  [--shard i/N]
                   [--cross-sections xml_file]
                   [--event-generator-list list_name]
                   [--tune genie_tune]
@@ -35,6 +36,20 @@
                   [--mc-job-status-refresh-rate  rate]
                   [--cache-file root_file]
                   [--xml-path config_xml_dir]
+                  [--replay file:event]
+                  [--output-format format]
+                  [--async-output]
+                  [--threads nthreads]
+                  [--output-compression algorithm:level]
+                  [--output-basket-size nbytes]
+                  [--output-auto-flush n]
+                  [--output-split-level split]
+                  [--output-stream target]
+                  [--output-stream-format format]
+                  [--output-stream-only]
+                  [--memory-report]
+                  [--stop-after stage]
+                  [--fast-ibd]
 
          Options :
            [] Denotes an optional argument.
@@ -49,6 +64,14 @@
               If what follows the -e option is a comma separated pair of values
               it will be interpreted as an energy range for the flux specified
               via the -f option (see below).
+              For a fixed initial state, an energy scan may be given instead,
+              either as Emin:Emax:step (eg `-e 0.5:10:0.5') or as the name of
+              a text file listing the energies (one per line, `#' comments).
+              The job is initialized once and -n events are generated at each
+              energy in turn, in the same output tree: the events of scan
+              point i are the events i*n to (i+1)*n-1 and their energy is also
+              in the `gindex' event index tree (Ev). With --threads, the
+              threads share the events of all the points.
            -p
               Specifies the neutrino PDG code.
            -t
@@ -80,6 +103,12 @@
               ** Only use that option if you understand what it means **
            --seed
               Random number seed.
+           --shard
+              Runs job i of a production split in N jobs (given as i/N, with
+              0 <= i < N). Each job uses a random number seed derived from
+              --seed (or the default seed) and i, so that the jobs are
+              independent and reproducible. The job outputs can be merged with
+              gmerge.
            --cross-sections
               Name (incl. full path) of an XML file with pre-computed
               cross-section values used for constructing splines.
@@ -107,6 +136,82 @@
               re-used in subsequent MC jobs.
            --xml-path
               A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+           --replay
+              Re-generates a single event of a previous gevgen job, typed as
+              `--replay /full/path/file.ghep.root:event_number'.
+              The event must have been generated with counter-based random
+              number streams (set the GRNDMCOUNTER env. var., see RandomGen,
+              and GRNDMCRN if the original job used common random numbers):
+              The random number seed and run number are then read from the
+              event header, and so the -r and --seed options are ignored.
+              All other options must be the same as in the original job.
+              The re-generated event is printed and compared with the stored
+              one. No output file is written.
+           --output-format
+              The output event tree format: `ghep' (the full GHEP event records),
+              `compact' (compact GHEP event records, with single precision
+              particle kinematics, see NtpMCCompactRecord; convert them back to
+              full records with gntpc -f ghep), `flat' (the flat `gst' summary
+              tree, as written by gntpc -f gst), `ghep+flat' (both trees in
+              the same file) or `kine' (the `gkine' tree of the event
+              kinematics only, see NtpKineRecord) [default: ghep]
+           --async-output
+              Writes the output events from a separate writer thread, so that
+              event generation and I/O (serialization, compression) overlap.
+           --threads
+              Generates the events of a fixed initial state (no flux / target
+              mix) using the input number of threads, each one running its
+              own, identically configured, event generation driver (with
+              its own copies of the event generation modules) and random
+              number sequence. Thread i generates the events i,
+              i+nthreads, ... which are written in order, so that the output
+              is reproducible for a given number of threads (and, with
+              counter-based random number streams, for any number).
+           --output-compression
+              The output file compression algorithm (zlib, lzma, lz4 or zstd)
+              and level (0-9), eg `zstd:5' or `lz4:4' [default: ROOT default]
+           --output-basket-size
+              The event branch basket size in bytes [default: 32000]
+           --output-auto-flush
+              The output tree cluster size, as in TTree::SetAutoFlush():
+              events if > 0, bytes if < 0 [default: ROOT default, -30000000]
+           --output-split-level
+              The event branch split level [default: 0 (ROOT 6)]
+           (Use gntpbench to compare the write throughput and file size
+            achieved by different output settings)
+           --output-stream
+              Also sends the events, as they are generated, to an event stream
+              read by another application (eg a detector simulation):
+              `-' (stdout, where the log output must then be silenced),
+              `fifo://path' (named pipe, created if needed),
+              `tcp://host:port' (connects), `tcp://:port' (listens for the
+              consumer), `unix://path' (Unix domain socket) or a file.
+              Generation waits while the consumer is not reading.
+           --output-stream-format
+              The event stream format: `binary' (compact GHEP records, read
+              back with NtpStreamReader) or `hepmc3' (HepMC3 Asciiv3)
+              [default: binary]
+           --output-stream-only
+              Writes the events to the event stream only (no output file).
+           --memory-report
+              Prints the memory held by the GENIE singletons and physics
+              tables, per category, after the initialization and at the end
+              of the job.
+           --stop-after
+              Truncates the event generation chains after the input stage:
+              `kinematics' (the primary lepton & event kinematics only: no
+              hadronization, intranuclear transport or decays) or
+              `hadronization' (no intranuclear transport or decays).
+              Use with `--output-format kine' for fast kinematics samples.
+           --fast-ibd
+              Generates inverse beta decay events (anti-nu_e + p or nu_e + n,
+              target 1000010010 or 1000000010) for supernova or reactor
+              samples with IBDEventSampler: The neutrino energy & lepton angle
+              are sampled from inverse CDF tables built once for the -e
+              energy or the -f flux (from StrumiaVissaniIBDPXSec), and the
+              event records are filled directly, without the event
+              generation drivers. The output holds the probe, the target
+              nucleon, the primary lepton & the recoil nucleon.
 
         ***  See the User Manual for more details and examples. ***
 
@@ -124,6 +229,7 @@
 #include <cstdlib>
 #include <cassert>
 #include <sstream>
+#include <fstream>
 #include <string>
 #include <vector>
 #include <map>
@@ -142,14 +248,23 @@
 #include "Framework/Conventions/XmlParserStatus.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/EventGeneratorList.h"
+#include "Framework/EventGen/EventGeneratorListAssembler.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/EventGen/GMCJDriver.h"
 #include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/EventGen/ThreadedEventLoopI.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
@@ -162,6 +277,7 @@
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/InverseBetaDecay/EventGen/IBDEventSampler.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
 #ifdef __GENIE_GEOM_DRIVERS_ENABLED__
@@ -183,6 +299,8 @@ using namespace genie::controls;
 void GetCommandLineArgs (int argc, char ** argv);
 void Initialize         (void);
 void PrintSyntax        (void);
+void ReadReplayCheckpoint (void);
+void ReplayReport         (const EventRecord * event);
 
 #ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
 void            GenerateEventsUsingFluxOrTgtMix();
@@ -192,7 +310,12 @@ GFluxI *        MonoEnergeticFluxDriver (void);
 GFluxI *        TH1FluxDriver           (void);
 #endif
 
+void   GenerateFastIBDEvents (void);
+TH1D * FluxSpectrum          (void);
+
 void GenerateEventsAtFixedInitState (void);
+void GenerateEventsAtFixedInitState (GEVGDriver & evg_driver,
+        const InitialState & init_state, NtpWriter & ntpw, GMCJMonitor & mcjmonitor);
 
 //Default options (override them using the command line arguments):
 int           kDefOptNevents   = 0;       // n-events to generate
@@ -203,6 +326,7 @@ Long_t        kDefOptRunNu     = 0;       // default run number
 int             gOptNevents;      // n-events to generate
 double          gOptNuEnergy;     // neutrino E, or min neutrino energy in spectrum
 double          gOptNuEnergyRange;// energy range in input spectrum
+vector<double>  gOptNuEnergies;   // neutrino energies of a scan (fixed init state)
 int             gOptNuPdgCode;    // neutrino PDG code
 map<int,double> gOptTgtMix;       // target mix (each with its relative weight)
 Long_t          gOptRunNu;        // run number
@@ -213,11 +337,23 @@ long int        gOptRanSeed;      // random number seed
 string          gOptInpXSecFile;  // cross-section splines
 string          gOptOutFileName;  // Optional outfile name
 string          gOptStatFileName; // Status file name, set if gOptOutFileName was set.
+bool            gOptReplay = false; // re-generate a single event?
+string          gOptReplayFile;   // file holding the event to re-generate
+Long64_t        gOptReplayEvent;  // number of the event to re-generate
+NtpMCFormat_t   gOptNtpFormat = kDefOptNtpFormat; // ntuple format
+bool            gOptFlatTree  = false; // write the flat summary tree alongside GHEP?
+bool            gOptAsyncOutput = false; // write the events from a writer thread?
+int             gOptNThreads    = 1;     // event generation threads (fixed init state)
+bool            gOptFastIBD     = false; // fast IBD mode (see IBDEventSampler)?
+
+Long64_t        gReplayEventIndex = -1; // event index of the streams of the replayed event
+EventRecord *   gReplayStored     = 0;  // stored copy of the replayed event
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
   GetCommandLineArgs(argc,argv);
+  if(gOptReplay) ReadReplayCheckpoint();
   Initialize();
 
   // throw on NaNs and Infs...
@@ -228,7 +364,9 @@ int main(int argc, char ** argv)
   // Generate neutrino events
   //
 
-  if(gOptUsingFluxOrTgtMix) {
+  if(gOptFastIBD) {
+     GenerateFastIBDEvents();
+  } else if(gOptUsingFluxOrTgtMix) {
 #ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
         GenerateEventsUsingFluxOrTgtMix();
 #else
@@ -257,6 +395,8 @@ void Initialize()
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
   utils::app_init::RandGen(gOptRanSeed);
+  if(gOptReplay) RandomGen::Instance()->SetCounterBased(true);
+  RandomGen::Instance()->SetRunNumber(gOptRunNu);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
 
   // Set GHEP print level
@@ -270,6 +410,11 @@ void GenerateEventsAtFixedInitState(void)
   double Ev    = gOptNuEnergy;
   TLorentzVector nu_p4(0.,0.,Ev,Ev); // px,py,pz,E (GeV)
 
+  // energy scan: gOptNevents events at each energy, one energy after the
+  // other, with the same driver (and so the same max xsec caches)
+  int npoints = TMath::Max(1, (int) gOptNuEnergies.size());
+  int ntot    = npoints * gOptNevents;
+
   // Create init state
   InitialState init_state(target, neutrino);
 
@@ -278,9 +423,29 @@ void GenerateEventsAtFixedInitState(void)
   evg_driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
   evg_driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
   evg_driver.Configure(init_state);
+  utils::app_init::MemoryReport("after initialization");
+
+  // Generated events are given back to a pool & their records are re-used
+  EventRecordPool record_pool;
+  evg_driver.UseRecordPool(&record_pool);
+
+  // Re-generate a single event?
+  if(gOptReplay) {
+     if(npoints > 1 && gReplayStored && gReplayStored->Probe()) {
+       // the energy of the scan point the event was generated at
+       nu_p4 = *gReplayStored->Probe()->P4();
+     }
+     RandomGen::Instance()->SetEventIndex(gReplayEventIndex);
+     EventRecord * event = evg_driver.GenerateEvent(nu_p4);
+     ReplayReport(event);
+     if(event) delete event;
+     return;
+  }
 
   // Initialize an Ntuple Writer
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  NtpWriter ntpw(gOptNtpFormat, gOptRunNu);
+  ntpw.EnableFlatTree(gOptFlatTree);
+  ntpw.SetAsynchronous(gOptAsyncOutput);
 
   // If an output file name has been specified... use it
   if (!gOptOutFileName.empty()){
@@ -299,16 +464,45 @@ void GenerateEventsAtFixedInitState(void)
   }
 
 
-  LOG("gevgen", pNOTICE)
-    << "\n ** Will generate " << gOptNevents << " events for \n"
-    << init_state << " at Ev = " << Ev << " GeV";
+  if(npoints > 1) {
+    LOG("gevgen", pNOTICE)
+      << "\n ** Will generate " << gOptNevents << " events for \n"
+      << init_state << " at each of " << npoints << " energies in ["
+      << gOptNuEnergies.front() << ", " << gOptNuEnergies.back() << "] GeV";
+  } else {
+    LOG("gevgen", pNOTICE)
+      << "\n ** Will generate " << gOptNevents << " events for \n"
+      << init_state << " at Ev = " << Ev << " GeV";
+  }
+
+  // Generate events in several threads?
+  if(gOptNThreads > 1) {
+    GenerateEventsAtFixedInitState(evg_driver, init_state, ntpw, mcjmonitor);
+    ntpw.Save();
+    utils::app_init::MemoryReport("at the end of the job");
+    return;
+  }
 
   // Generate events / print the GHEP record / add it to the ntuple
+  RandomGen * rnd = RandomGen::Instance();
+  Long64_t iattempt = 0;
   int ievent = 0;
-  while (ievent < gOptNevents) {
+  while (ievent < ntot) {
+     if(npoints > 1 && ievent % gOptNevents == 0) {
+        double E = gOptNuEnergies[ievent / gOptNevents];
+        nu_p4.SetPxPyPzE(0., 0., E, E);
+        LOG("gevgen", pNOTICE)
+           << " *** Energy scan point " << ievent / gOptNevents
+           << ": Ev = " << E << " GeV";
+     }
      LOG("gevgen", pNOTICE)
         << " *** Generating event............ " << ievent;
 
+     // with counter-based random number streams, every attempt (including
+     // the failed ones) draws from its own streams
+     if(rnd->CounterBased()) rnd->SetEventIndex(iattempt);
+     iattempt++;
+
      // generate a single event
      EventRecord * event = evg_driver.GenerateEvent(nu_p4);
 
@@ -325,37 +519,151 @@ void GenerateEventsAtFixedInitState(void)
      ntpw.AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
      ievent++;
-     delete event;
+     record_pool.Recycle(event);
   }
 
   // Save the generated MC events
   ntpw.Save();
+
+  utils::app_init::MemoryReport("at the end of the job");
 }
 //____________________________________________________________________________
+namespace {
+  // The multi-threaded fixed initial state mode: thread i generates the
+  // events i, i+nthreads, ... with its own driver & record pool (of an energy
+  // scan, the events of each energy follow each other)
+  class FixedInitStateLoop : public ThreadedEventLoopI {
+  public:
+    FixedInitStateLoop(NtpWriter & ntpw, GMCJMonitor & mcjmonitor) :
+      fNtpWriter(ntpw), fMonitor(mcjmonitor), fNEvPoint(1), fNEv(0) { }
+
+    vector<GEVGDriver *>         fDrivers;    ///< driver of each thread
+    vector<EventGeneratorList *> fGenerators; ///< private copies of the event generators of each thread (null: the AlgFactory ones)
+    vector<EventRecordPool *>    fPools;      ///< record pool of each thread
+    vector<double>               fEnergies;   ///< energy of each scan point
+    NtpWriter &                  fNtpWriter;
+    GMCJMonitor &                fMonitor;
+    int                          fNEvPoint;   ///< events per scan point
+    long int                     fNEv;        ///< total number of events
+
+  protected:
+    EventRecord * GenerateEvent(int ithread, long int ievent)
+    {
+      // with counter-based streams, attempt iretry of event ievent draws
+      // from the streams of index iretry*nev + ievent, so that the event
+      // does not depend on which thread generates it
+      RandomGen * rnd = RandomGen::Instance();
+      double E = fEnergies[ievent / fNEvPoint];
+      TLorentzVector nu_p4(0., 0., E, E);
+      EventRecord * event = 0;
+      for(Long64_t iretry = 0; event == 0; iretry++) {
+        if(rnd->CounterBased()) rnd->SetEventIndex(iretry * fNEv + ievent);
+        event = fDrivers[ithread]->GenerateEvent(nu_p4);
+      }
+      return event;
+    }
+    void WriteEvent(long int ievent, EventRecord * event)
+    {
+      LOG("gevgen", pNOTICE)
+         << "Generated Event GHEP Record: " << *event;
 
-#ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
-//............................................................................
-void GenerateEventsUsingFluxOrTgtMix(void)
+      fNtpWriter.AddEventRecord(ievent, event);
+      fMonitor.Update(ievent,event);
+    }
+    void ReleaseEvent(int ithread, EventRecord * event)
+    {
+      fPools[ithread]->Recycle(event);
+    }
+  };
+}
+//____________________________________________________________________________
+void GenerateEventsAtFixedInitState(
+  GEVGDriver & evg_driver, const InitialState & init_state,
+  NtpWriter & ntpw, GMCJMonitor & mcjmonitor)
 {
-  // Get flux and geom drivers
-  GFluxI *        flux_driver = FluxDriver();
-  GeomAnalyzerI * geom_driver = GeomDriver();
+// Multi-threaded event generation for a fixed initial state. The input
+// (configured) driver is used by the first thread and identical drivers are
+// configured, serially, for the others (the algorithm factory and the
+// configuration pool are not protected against concurrent writes). The
+// event generators keep per-event state: the drivers of the other threads
+// use private copies of them (and of all their modules). The events are
+// written in order by the calling thread (see ThreadedEventLoopI).
+
+  int nthreads = gOptNThreads;
+
+  FixedInitStateLoop mt(ntpw, mcjmonitor);
+  mt.fEnergies = gOptNuEnergies;
+  if(mt.fEnergies.empty()) mt.fEnergies.push_back(gOptNuEnergy);
+  mt.fNEvPoint = gOptNevents;
+  mt.fNEv      = (long int) gOptNevents * mt.fEnergies.size();
+  for(int ithread = 0; ithread < nthreads; ithread++) {
+    GEVGDriver *         driver     = &evg_driver;
+    EventGeneratorList * generators = 0;
+    if(ithread > 0) {
+      LOG("gevgen", pNOTICE) << "Configuring driver of thread: " << ithread;
+      string evglist = RunOpt::Instance()->EventGeneratorList();
+      EventGeneratorListAssembler evglist_assembler(evglist.c_str());
+      generators = evglist_assembler.AssembleGeneratorList();
+      generators->AdoptGenerators();
+      driver = new GEVGDriver;
+      driver->SetEventGeneratorList(evglist);
+      driver->UseGeneratorList(generators);
+      driver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+      driver->Configure(init_state);
+    }
+    EventRecordPool * pool = new EventRecordPool;
+    driver->UseRecordPool(pool);
+    mt.fDrivers.push_back(driver);
+    mt.fGenerators.push_back(generators);
+    mt.fPools.push_back(pool);
+  }
 
-  // Create the monte carlo job driver
-  GMCJDriver * mcj_driver = new GMCJDriver;
-  mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
-  mcj_driver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
-  mcj_driver->UseFluxDriver(flux_driver);
-  mcj_driver->UseGeomAnalyzer(geom_driver);
-  mcj_driver->Configure();
-  mcj_driver->UseSplines();
-  if(!gOptWeighted)
-        mcj_driver->ForceSingleProbScale();
+  mt.Run(mt.fNEv, nthreads);
 
-  // Initialize an Ntuple Writer to save GHEP records into a TTree
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  // Clean-up
+  evg_driver.UseRecordPool(0);
+  for(int ithread = 0; ithread < nthreads; ithread++) {
+    if(ithread > 0) delete mt.fDrivers[ithread];
+    if(mt.fGenerators[ithread]) delete mt.fGenerators[ithread];
+    delete mt.fPools[ithread];
+  }
+}
+//____________________________________________________________________________
+void GenerateFastIBDEvents(void)
+{
+// IBD events on a free nucleon, from the inverse CDF tables of IBDEventSampler
+// instead of the event generation drivers
 
-  // If an output file name has been specified... use it
+  int neutrino = gOptNuPdgCode;
+  int target   = gOptTgtMix.begin()->first;
+
+  AlgFactory * algf = AlgFactory::Instance();
+  const XSecAlgorithmI * xsec_model = dynamic_cast<const XSecAlgorithmI *> (
+       algf->GetAlgorithm("genie::StrumiaVissaniIBDPXSec","Default"));
+  if(!xsec_model) {
+    LOG("gevgen", pFATAL) << "Could not get the IBD cross section model - Exiting";
+    exit(1);
+  }
+
+  IBDEventSampler sampler(xsec_model, neutrino, target);
+  bool built = false;
+  if(gOptNuEnergyRange < 0) {
+    built = sampler.BuildTables(gOptNuEnergy);
+  } else {
+    TH1D * spectrum = FluxSpectrum();
+    built = sampler.BuildTables(spectrum);
+    delete spectrum;
+  }
+  if(!built) {
+    LOG("gevgen", pFATAL) << "Could not build the fast IBD tables - Exiting";
+    exit(1);
+  }
+  utils::app_init::MemoryReport("after initialization");
+
+  // Initialize an Ntuple Writer to save GHEP records into a TTree
+  NtpWriter ntpw(gOptNtpFormat, gOptRunNu);
+  ntpw.EnableFlatTree(gOptFlatTree);
+  ntpw.SetAsynchronous(gOptAsyncOutput);
   if (!gOptOutFileName.empty()){
     ntpw.CustomizeFilename(gOptOutFileName);
   }
@@ -364,74 +672,38 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   // Create an MC Job Monitor
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
-
-  // If a status file name has been given... use it
   if (!gOptStatFileName.empty()){
     mcjmonitor.CustomizeFilename(gOptStatFileName);
   }
 
+  for(int ievent = 0; ievent < gOptNevents; ievent++) {
+     EventRecord * event = sampler.GenerateEvent();
 
-  // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
-  while ( ievent < gOptNevents) {
-
-     LOG("gevgen", pNOTICE) << " *** Generating event............ " << ievent;
+     LOG("gevgen", pINFO) << "Generated Event GHEP Record: " << *event;
 
-     // generate a single event for neutrinos coming from the specified flux
-     EventRecord * event = mcj_driver->GenerateEvent();
-
-     LOG("gevgen", pNOTICE) << "Generated Event GHEP Record: " << *event;
-
-     // add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
+     if(mcjmonitor.MetricsEnabled()) {
+       mcjmonitor.SetGauge("writer_queue_depth", ntpw.QueueDepth());
+     }
      mcjmonitor.Update(ievent,event);
-     ievent++;
-     delete event;
+     sampler.RecycleEvent(event);
   }
 
+  LOG("gevgen", pNOTICE)
+    << "Flux-averaged IBD cross section: "
+    << sampler.FluxAveragedXSec() / (1E-38*units::cm2) << " x 1E-38 cm2";
+
   // Save the generated MC events
   ntpw.Save();
 
-  delete flux_driver;
-  delete geom_driver;
-  delete mcj_driver;;
+  utils::app_init::MemoryReport("at the end of the job");
 }
 //____________________________________________________________________________
-GeomAnalyzerI * GeomDriver(void)
+TH1D * FluxSpectrum(void)
 {
-// create a trivial point geometry with the specified target or target mix
+// build the flux spectrum histogram from the -f flux description (used by the
+// TH1 flux driver & by the fast IBD mode)
 
-  GeomAnalyzerI * geom_driver = new geometry::PointGeomAnalyzer(gOptTgtMix);
-  return geom_driver;
-}
-//____________________________________________________________________________
-GFluxI * FluxDriver(void)
-{
-// create & configure one of the generic flux drivers
-//
-  GFluxI * flux_driver = 0;
-
-  if(gOptNuEnergyRange<0) flux_driver = MonoEnergeticFluxDriver();
-  else flux_driver = TH1FluxDriver();
-
-  return flux_driver;
-}
-//____________________________________________________________________________
-GFluxI * MonoEnergeticFluxDriver(void)
-{
-//
-//
-  flux::GMonoEnergeticFlux * flux =
-              new flux::GMonoEnergeticFlux(gOptNuEnergy, gOptNuPdgCode);
-  GFluxI * flux_driver = dynamic_cast<GFluxI *>(flux);
-  return flux_driver;
-}
-//____________________________________________________________________________
-GFluxI * TH1FluxDriver(void)
-{
-//
-//
-  flux::GCylindTH1Flux * flux = new flux::GCylindTH1Flux;
   TH1D * spectrum = 0;
 
   int flux_entries = 100000;
@@ -532,6 +804,140 @@ GFluxI * TH1FluxDriver(void)
   spectrum->Write();
   f.Close();
 
+  return spectrum;
+}
+//____________________________________________________________________________
+
+#ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
+//............................................................................
+void GenerateEventsUsingFluxOrTgtMix(void)
+{
+  // Get flux and geom drivers
+  GFluxI *        flux_driver = FluxDriver();
+  GeomAnalyzerI * geom_driver = GeomDriver();
+
+  // Create the monte carlo job driver
+  GMCJDriver * mcj_driver = new GMCJDriver;
+  mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  mcj_driver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+  mcj_driver->UseFluxDriver(flux_driver);
+  mcj_driver->UseGeomAnalyzer(geom_driver);
+  mcj_driver->Configure();
+  mcj_driver->UseSplines();
+  if(!gOptWeighted)
+        mcj_driver->ForceSingleProbScale();
+
+  // Re-generate a single event?
+  if(gOptReplay) {
+     mcj_driver->SetEventIndex(gReplayEventIndex);
+     EventRecord * event = mcj_driver->GenerateEvent();
+     ReplayReport(event);
+     if(event) delete event;
+     delete flux_driver;
+     delete geom_driver;
+     delete mcj_driver;
+     return;
+  }
+
+  // Initialize an Ntuple Writer to save GHEP records into a TTree
+  NtpWriter ntpw(gOptNtpFormat, gOptRunNu);
+  ntpw.EnableFlatTree(gOptFlatTree);
+  ntpw.SetAsynchronous(gOptAsyncOutput);
+
+  // If an output file name has been specified... use it
+  if (!gOptOutFileName.empty()){
+    ntpw.CustomizeFilename(gOptOutFileName);
+  }
+  ntpw.Initialize();
+
+  // Create an MC Job Monitor
+  GMCJMonitor mcjmonitor(gOptRunNu);
+  mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+  mcjmonitor.SetMCJDriver(mcj_driver);
+
+  // If a status file name has been given... use it
+  if (!gOptStatFileName.empty()){
+    mcjmonitor.CustomizeFilename(gOptStatFileName);
+  }
+
+
+  // Generate events / print the GHEP record / add it to the ntuple
+  int ievent = 0;
+  while ( ievent < gOptNevents) {
+
+     LOG("gevgen", pNOTICE) << " *** Generating event............ " << ievent;
+
+     // generate a single event for neutrinos coming from the specified flux
+     EventRecord * event = mcj_driver->GenerateEvent();
+
+     LOG("gevgen", pNOTICE) << "Generated Event GHEP Record: " << *event;
+
+     // add event at the output ntuple, refresh the mc job monitor & clean-up
+     ntpw.AddEventRecord(ievent, event);
+     if(mcjmonitor.MetricsEnabled()) {
+       mcjmonitor.SetGauge("writer_queue_depth", ntpw.QueueDepth());
+     }
+     mcjmonitor.Update(ievent,event);
+     ievent++;
+     mcj_driver->RecycleEvent(event);
+  }
+
+  // store the sample normalization in the tree header (combined by gmerge
+  // when the outputs of a production split in jobs are merged)
+  NtpMCTreeHeader * tree_header = ntpw.TreeHeader();
+  if(tree_header) {
+    tree_header->nfluxnu         = mcj_driver->NFluxNeutrinos();
+    tree_header->globprobscale   = mcj_driver->GlobProbScale();
+    tree_header->sumfluxintprobs = mcj_driver->SumFluxIntProbs();
+  }
+
+  // Save the generated MC events
+  ntpw.Save();
+
+  utils::app_init::MemoryReport("at the end of the job");
+
+  delete flux_driver;
+  delete geom_driver;
+  delete mcj_driver;;
+}
+//____________________________________________________________________________
+GeomAnalyzerI * GeomDriver(void)
+{
+// create a trivial point geometry with the specified target or target mix
+
+  GeomAnalyzerI * geom_driver = new geometry::PointGeomAnalyzer(gOptTgtMix);
+  return geom_driver;
+}
+//____________________________________________________________________________
+GFluxI * FluxDriver(void)
+{
+// create & configure one of the generic flux drivers
+//
+  GFluxI * flux_driver = 0;
+
+  if(gOptNuEnergyRange<0) flux_driver = MonoEnergeticFluxDriver();
+  else flux_driver = TH1FluxDriver();
+
+  return flux_driver;
+}
+//____________________________________________________________________________
+GFluxI * MonoEnergeticFluxDriver(void)
+{
+//
+//
+  flux::GMonoEnergeticFlux * flux =
+              new flux::GMonoEnergeticFlux(gOptNuEnergy, gOptNuPdgCode);
+  GFluxI * flux_driver = dynamic_cast<GFluxI *>(flux);
+  return flux_driver;
+}
+//____________________________________________________________________________
+GFluxI * TH1FluxDriver(void)
+{
+//
+//
+  flux::GCylindTH1Flux * flux = new flux::GCylindTH1Flux;
+  TH1D * spectrum = FluxSpectrum();
+
   TVector3 bdir (0,0,1);
   TVector3 bspot(0,0,0);
 
@@ -622,8 +1028,55 @@ void GetCommandLineArgs(int argc, char ** argv)
     LOG("gevgen", pINFO) << "Reading neutrino energy";
     string nue = parser.ArgAsString('e');
 
-    // is it just a value or a range (comma separated set of values)
-    if(nue.find(",") != string::npos) {
+    // is it just a value, a scan (Emin:Emax:step or a file listing the
+    // energies) or a range (comma separated set of values)
+    char * end = 0;
+    strtod(nue.c_str(), &end);
+    bool is_value = (end != nue.c_str() && *end == 0);
+    if(nue.find(":") != string::npos) {
+       vector<string> scan = utils::str::Split(nue, ":");
+       double emin = (scan.size() == 3) ? atof(scan[0].c_str()) : 0;
+       double emax = (scan.size() == 3) ? atof(scan[1].c_str()) : 0;
+       double de   = (scan.size() == 3) ? atof(scan[2].c_str()) : 0;
+       if(emin <= 0 || emax < emin || de <= 0) {
+          LOG("gevgen", pFATAL)
+             << "Invalid energy scan: " << nue << " (expected Emin:Emax:step)";
+          PrintSyntax();
+          exit(1);
+       }
+       for(int i = 0; emin + i*de <= emax + 1E-6*de; i++) {
+          gOptNuEnergies.push_back(emin + i*de);
+       }
+    } else if(!is_value && nue.find(",") == string::npos &&
+              !gSystem->AccessPathName(nue.c_str())) {
+       std::ifstream energies(nue.c_str());
+       string line;
+       while(std::getline(energies, line)) {
+          line = utils::str::TrimSpaces(line);
+          if(line.empty() || line[0] == '#') continue;
+          double E = atof(line.c_str());
+          if(E <= 0) {
+             LOG("gevgen", pFATAL)
+                << "Invalid energy in " << nue << ": " << line;
+             exit(1);
+          }
+          gOptNuEnergies.push_back(E);
+       }
+       if(gOptNuEnergies.empty()) {
+          LOG("gevgen", pFATAL) << "No energies found in: " << nue;
+          exit(1);
+       }
+    }
+    if(!gOptNuEnergies.empty()) {
+       gOptNuEnergy      = gOptNuEnergies[0];
+       gOptNuEnergyRange = -1;
+       if(using_flux) {
+          LOG("gevgen", pFATAL)
+             << "An energy scan can not be used with a flux - Exiting";
+          PrintSyntax();
+          exit(1);
+       }
+    } else if(nue.find(",") != string::npos) {
        // split the comma separated list
        vector<string> nurange = utils::str::Split(nue, ",");
        assert(nurange.size() == 2);
@@ -697,6 +1150,13 @@ void GetCommandLineArgs(int argc, char ** argv)
 
   gOptUsingFluxOrTgtMix = using_flux || using_tgtmix;
 
+  if(gOptNuEnergies.size() > 1 && gOptUsingFluxOrTgtMix) {
+    LOG("gevgen", pFATAL)
+      << "An energy scan is used for a fixed initial state only - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
   // random number seed
   if( parser.OptionExists("seed") ) {
     LOG("gevgen", pINFO) << "Reading random number seed";
@@ -715,6 +1175,75 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // re-generate a single event of a previous job
+  if( parser.OptionExists("replay") ) {
+    LOG("gevgen", pINFO) << "Reading event to replay";
+    string replay = parser.ArgAsString("replay");
+    string::size_type sep = replay.find_last_of(":");
+    if(sep == string::npos || sep == 0 || sep+1 == replay.size()) {
+      LOG("gevgen", pFATAL)
+        << "The event to replay must be typed as file:event_number - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptReplay      = true;
+    gOptReplayFile  = replay.substr(0, sep);
+    gOptReplayEvent = atoll(replay.substr(sep+1).c_str());
+  }
+
+  // output event tree format
+  if( parser.OptionExists("output-format") ) {
+    LOG("gevgen", pINFO) << "Reading output format";
+    string format = parser.ArgAsString("output-format");
+    if      (format == "ghep")      { gOptNtpFormat = kNFGHEP;                      }
+    else if (format == "compact")   { gOptNtpFormat = kNFCompact;                   }
+    else if (format == "flat")      { gOptNtpFormat = kNFFlat;                      }
+    else if (format == "ghep+flat") { gOptNtpFormat = kNFGHEP; gOptFlatTree = true; }
+    else if (format == "kine")      { gOptNtpFormat = kNFKine;                      }
+    else {
+      LOG("gevgen", pFATAL)
+        << "Unknown output format: " << format << " - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+  }
+
+  // write the output from a writer thread?
+  gOptAsyncOutput = parser.OptionExists("async-output");
+
+  // number of event generation threads
+  if( parser.OptionExists("threads") ) {
+    gOptNThreads = TMath::Max(1, parser.ArgAsInt("threads"));
+    if(gOptNThreads > 1 && gOptUsingFluxOrTgtMix) {
+      LOG("gevgen", pWARN)
+        << "The --threads option is used for a fixed initial state only "
+        << "- Generating events in a single thread";
+      gOptNThreads = 1;
+    }
+  }
+
+  // fast IBD mode?
+  if( parser.OptionExists("fast-ibd") ) {
+    int tgt = gOptTgtMix.begin()->first;
+    bool valid = (gOptTgtMix.size() == 1) &&
+      ((pdg::IsAntiNuE(gOptNuPdgCode) && tgt == kPdgTgtFreeP) ||
+       (pdg::IsNuE    (gOptNuPdgCode) && tgt == kPdgTgtFreeN));
+    valid = valid && ((gOptNuEnergyRange > 0) == !gOptFlux.empty());
+    if(!valid || gOptNuEnergies.size() > 1 || gOptReplay) {
+      LOG("gevgen", pFATAL)
+        << "The --fast-ibd option is used for anti-nu_e + p (1000010010) or"
+        << " nu_e + n (1000000010), at a fixed energy or for a flux - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    if(gOptNThreads > 1) {
+      LOG("gevgen", pWARN)
+        << "The --threads option is not used with --fast-ibd";
+      gOptNThreads = 1;
+    }
+    gOptFastIBD = true;
+  }
+
   //
   // print-out the command line options
   //
@@ -747,6 +1276,14 @@ void GetCommandLineArgs(int argc, char ** argv)
      LOG("gevgen", pNOTICE)
         << "Neutrino energy: ["
         << gOptNuEnergy << ", " << gOptNuEnergy+gOptNuEnergyRange << "]";
+  } else if(gOptNuEnergies.size() > 1) {
+     ostringstream scan;
+     for(unsigned int i = 0; i < gOptNuEnergies.size(); i++) {
+        scan << ((i > 0) ? ", " : "") << gOptNuEnergies[i];
+     }
+     LOG("gevgen", pNOTICE)
+        << "Neutrino energy scan (" << gOptNuEnergies.size()
+        << " points): " << scan.str();
   } else {
      LOG("gevgen", pNOTICE)
         << "Neutrino energy: " << gOptNuEnergy;
@@ -762,6 +1299,10 @@ void GetCommandLineArgs(int argc, char ** argv)
       LOG("gevgen", pNOTICE)
           << " >> " <<  tgtpdgc << " (weight fraction = " << wgt << ")";
   }
+  if(gOptNThreads > 1) {
+    LOG("gevgen", pNOTICE)
+        << "Event generation threads: " << gOptNThreads;
+  }
   LOG("gevgen", pNOTICE) << "\n";
 
   LOG("gevgen", pNOTICE) << *RunOpt::Instance();
@@ -775,13 +1316,14 @@ void PrintSyntax(void)
     << "\n      gevgen [-h]"
     << "\n              [-r run#]"
     << "\n               -n nev"
-    << "\n               -e energy (or energy range) "
+    << "\n               -e energy (or energy range, or energy scan) "
     << "\n               -p neutrino_pdg"
     << "\n               -t target_pdg "
     << "\n              [-f flux_description]"
     << "\n              [-o outfile_name]"
     << "\n              [-w]"
     << "\n              [--seed random_number_seed]"
+    << "\n              [--shard i/N]"
     << "\n              [--cross-sections xml_file]"
     << "\n              [--event-generator-list list_name]"
     << "\n              [--message-thresholds xml_file]"
@@ -790,6 +1332,102 @@ void PrintSyntax(void)
     << "\n              [--mc-job-status-refresh-rate  rate]"
     << "\n              [--cache-file root_file]"
     << "\n              [--xml-path config_xml_dir]"
+    << "\n              [--replay file:event]"
+    << "\n              [--output-format format]"
+    << "\n              [--async-output]"
+    << "\n              [--threads nthreads]"
+    << "\n              [--output-compression algorithm:level]"
+    << "\n              [--output-basket-size nbytes]"
+    << "\n              [--output-auto-flush n]"
+    << "\n              [--output-split-level split]"
+    << "\n              [--output-stream target]"
+    << "\n              [--output-stream-format format]"
+    << "\n              [--output-stream-only]"
+    << "\n              [--memory-report]"
+    << "\n              [--stop-after stage]"
+    << "\n              [--fast-ibd]"
     << "\n";
 }
 //____________________________________________________________________________
+void ReadReplayCheckpoint(void)
+{
+// Find the event to replay and read its random number checkpoint.
+// The seed & run number override the ones set at the command-line.
+
+  TFile file(gOptReplayFile.c_str(), "READ");
+  TTree * ghep_tree = dynamic_cast <TTree *> (file.Get("gtree"));
+  if(!ghep_tree) {
+    LOG("gevgen", pFATAL)
+      << "No GHEP event tree in input file: " << gOptReplayFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  NtpMCEventRecord * mcrec = 0;
+  ghep_tree->SetBranchAddress("gmcrec", &mcrec);
+
+  bool found = false;
+  Long64_t nev = ghep_tree->GetEntries();
+  for(Long64_t i = 0; i < nev && !found; i++) {
+    ghep_tree->GetEntry(i);
+    if((Long64_t) mcrec->hdr.ievent == gOptReplayEvent) {
+      found = true;
+      gOptRanSeed       = mcrec->hdr.rndmseed;
+      gOptRunNu         = mcrec->hdr.rndmrun;
+      gReplayEventIndex = mcrec->hdr.rndmevent;
+      gReplayStored     = new EventRecord(*mcrec->event);
+    }
+    mcrec->Clear();
+  }
+  ghep_tree->ResetBranchAddresses();
+  delete mcrec;
+  file.Close();
+
+  if(!found) {
+    LOG("gevgen", pFATAL)
+      << "No event " << gOptReplayEvent << " in input file: " << gOptReplayFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  if(gReplayEventIndex < 0) {
+    LOG("gevgen", pFATAL)
+      << "Event " << gOptReplayEvent << " has no random number checkpoint: "
+      << "It can only be replayed if generated with counter-based random "
+      << "number streams (set the GRNDMCOUNTER env. var.)";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  LOG("gevgen", pNOTICE)
+    << "Replaying event " << gOptReplayEvent << " of " << gOptReplayFile
+    << " (seed = " << gOptRanSeed << ", run = " << gOptRunNu
+    << ", event index = " << gReplayEventIndex << ")";
+}
+//____________________________________________________________________________
+void ReplayReport(const EventRecord * event)
+{
+  if(!event) {
+    LOG("gevgen", pERROR)
+      << "No event was generated - Were all the options the same as in the "
+      << "original job?";
+    return;
+  }
+
+  LOG("gevgen", pNOTICE)
+     << "Re-generated Event GHEP Record: " << *event;
+
+  bool same = (event->GetEntries() == gReplayStored->GetEntries());
+  for(int i = 0; same && i < event->GetEntries(); i++) {
+    same = event->Particle(i)->Compare(gReplayStored->Particle(i));
+  }
+  if(same) {
+    LOG("gevgen", pNOTICE)
+      << "The re-generated event is identical to the stored one";
+  } else {
+    LOG("gevgen", pWARN)
+      << "The re-generated event differs from the stored one: "
+      << *gReplayStored;
+  }
+  delete gReplayStored;
+  gReplayStored = 0;
+}
+//____________________________________________________________________________
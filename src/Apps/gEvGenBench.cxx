@@ -0,0 +1,483 @@
+//____________________________________________________________________________
+/*!
+
+\program gevgen_bench
+
+\brief   A GENIE event generation throughput benchmark (gevgen_bench).
+
+         Runs a fixed set of reference event generation jobs (a neutrino
+         at fixed energy on a set of nuclear targets, for a set of tunes)
+         using a fixed random number seed and a fixed cross-section spline
+         file, and reports for each job:
+           - the initialization cost (time to first event),
+           - the event generation throughput (events/sec, first event excluded),
+           - the peak resident set size of the job and
+           - the time spent in each event generation module
+             (see genie::ModuleTimingStats).
+         No events are written out.
+         Each reference job runs in a forked child process, so that tunes
+         do not interfere with each other and so that the initialization
+         cost and peak RSS of each job are measured independently.
+         The reference jobs are also the training job of the profile-guided
+         optimization build ('make pgo').
+
+         Syntax :
+           gevgen_bench [-h]
+                        [-n nev]
+                        [-e energies]
+                        [-p neutrino_pdg]
+                        [-t target_pdgs]
+                        [-o summary_file]
+                        [--tunes tune_list]
+                        [--seed random_number_seed]
+                         --cross-sections xml_file
+                        [--event-generator-list list_name]
+                        [--message-thresholds xml_file]
+                        [--xml-path config_xml_dir]
+
+         Options :
+           [] Denotes an optional argument.
+           -h
+              Prints-out help on using gevgen_bench and exits.
+           -n
+              Specifies the number of events to generate per reference job.
+              [default: 1000]
+           -e
+              A comma separated list of neutrino energies (in GeV).
+              [default: 1,3,10]
+           -p
+              Specifies the neutrino PDG code.
+              [default: 14]
+           -t
+              A comma separated list of target PDG codes.
+              [default: 1000060120,1000180400,1000260560 (C12, Ar40, Fe56)]
+           -o
+              Specifies a text file where the summary table is also written.
+           --tunes
+              A comma separated list of GENIE tunes.
+              [default: G18_02a_00_000,G18_10a_02_11a]
+           --seed
+              Random number seed.
+              [default: 12345]
+           --cross-sections
+              Name (incl. full path) of an XML file with pre-computed
+              cross-section values used for constructing splines.
+              It must include splines for all requested tunes and targets.
+           --event-generator-list
+              List of event generators to load in event generation drivers.
+              [default: "Default"].
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              [default: Messenger_whisper.xml, so that printouts do not
+               dominate the measured time]
+           --xml-path
+              A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <chrono>
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/ModuleTimingStats.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+using std::ostream;
+using std::ostringstream;
+using std::ofstream;
+using std::endl;
+using std::setw;
+using std::setprecision;
+using std::fixed;
+
+using namespace genie;
+
+#ifdef __GENIE_PGO_GENERATE__
+// profile writers of the instrumented build (see 'make pgo'): the reference
+// jobs leave with _exit(), which skips the profile written at exit
+#ifdef __clang__
+extern "C" int  __llvm_profile_write_file (void);
+#else
+extern "C" void __gcov_dump (void);
+#endif
+#endif
+
+// results of a single reference job, passed from the child process
+struct BenchResult_t {
+  int    ok;         // 1 if the job completed
+  int    nev;        // number of generated events
+  double tinit;      // time to first event (sec)
+  double tgen;       // time to generate the remaining events (sec)
+  double peak_rss;   // peak resident set size (MB)
+};
+
+void          GetCommandLineArgs (int argc, char ** argv);
+void          PrintSyntax        (void);
+BenchResult_t RunForked          (string tune, int target, double Ev);
+BenchResult_t RunJob             (string tune, int target, double Ev);
+double        PeakRSS            (void);
+void          WriteProfile       (void);
+void          PrintSummary       (ostream & stream,
+                                  const vector<string> & jobs,
+                                  const vector<BenchResult_t> & results);
+
+// Default options (override them using the command line arguments):
+int    kDefOptNevents    = 1000;
+int    kDefOptNuPdgCode  = kPdgNuMu;
+long   kDefOptRanSeed    = 12345;
+string kDefOptEnergies   = "1,3,10";
+string kDefOptTargets    = "1000060120,1000180400,1000260560";
+string kDefOptTunes      = "G18_02a_00_000,G18_10a_02_11a";
+string kDefOptMesgThres  = "Messenger_whisper.xml";
+
+// User-specified options:
+int            gOptNevents;      // n-events per reference job
+int            gOptNuPdgCode;    // neutrino PDG code
+long int       gOptRanSeed;      // random number seed
+vector<double> gOptEnergies;     // neutrino energies
+vector<int>    gOptTargets;      // target PDG codes
+vector<string> gOptTunes;        // tunes
+string         gOptInpXSecFile;  // cross-section splines
+string         gOptMesgThres;    // message thresholds
+string         gOptSummaryFile;  // optional summary file
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  vector<string>        jobs;
+  vector<BenchResult_t> results;
+
+  vector<string>::const_iterator tune_iter = gOptTunes.begin();
+  for( ; tune_iter != gOptTunes.end(); ++tune_iter) {
+    vector<int>::const_iterator tgt_iter = gOptTargets.begin();
+    for( ; tgt_iter != gOptTargets.end(); ++tgt_iter) {
+      vector<double>::const_iterator e_iter = gOptEnergies.begin();
+      for( ; e_iter != gOptEnergies.end(); ++e_iter) {
+
+         ostringstream job;
+         job << *tune_iter << " | nu:" << gOptNuPdgCode
+             << " tgt:" << *tgt_iter << " E:" << *e_iter << " GeV";
+
+         LOG("gevgen_bench", pNOTICE) << "Running reference job: " << job.str();
+
+         jobs.push_back(job.str());
+         results.push_back(RunForked(*tune_iter, *tgt_iter, *e_iter));
+      }
+    }
+  }
+
+  PrintSummary(std::cout, jobs, results);
+
+  if(gOptSummaryFile.size() > 0) {
+    ofstream summary(gOptSummaryFile.c_str());
+    PrintSummary(summary, jobs, results);
+    summary.close();
+  }
+
+  vector<BenchResult_t>::const_iterator res_iter = results.begin();
+  for( ; res_iter != results.end(); ++res_iter) {
+    if(!res_iter->ok) return 1;
+  }
+  return 0;
+}
+//____________________________________________________________________________
+BenchResult_t RunForked(string tune, int target, double Ev)
+{
+  BenchResult_t result;
+  memset(&result, 0, sizeof(result));
+
+  int fd[2];
+  if(pipe(fd) != 0) {
+    LOG("gevgen_bench", pFATAL) << "Could not create pipe";
+    exit(1);
+  }
+
+  // flush before forking so that buffered output is not written twice
+  std::cout.flush();
+  std::cerr.flush();
+
+  pid_t pid = fork();
+  if(pid < 0) {
+    LOG("gevgen_bench", pFATAL) << "Could not fork reference job";
+    exit(1);
+  }
+
+  if(pid == 0) {
+    // child: run the job and send the results back to the parent
+    close(fd[0]);
+    result = RunJob(tune, target, Ev);
+    ssize_t nw = write(fd[1], &result, sizeof(result));
+    close(fd[1]);
+    std::cout.flush();
+    WriteProfile();
+    _exit( (nw == (ssize_t) sizeof(result)) ? 0 : 1 );
+  }
+
+  // parent: collect the results
+  close(fd[1]);
+  ssize_t nr = read(fd[0], &result, sizeof(result));
+  close(fd[0]);
+
+  int status = 0;
+  waitpid(pid, &status, 0);
+
+  if(nr != (ssize_t) sizeof(result) ||
+     !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    LOG("gevgen_bench", pERROR) << "Reference job did not complete";
+    memset(&result, 0, sizeof(result));
+  }
+  return result;
+}
+//____________________________________________________________________________
+BenchResult_t RunJob(string tune, int target, double Ev)
+{
+  BenchResult_t result;
+  memset(&result, 0, sizeof(result));
+
+  std::chrono::steady_clock::time_point tstart =
+                                      std::chrono::steady_clock::now();
+
+  // Initialization: tune, message thresholds, random number seed, splines
+  RunOpt::Instance()->SetTuneName(tune);
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(gOptMesgThres);
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::XSecTable(gOptInpXSecFile, true);
+
+  ModuleTimingStats::SetEnabled(true);
+  ModuleTimingStats::Instance()->Reset();
+
+  TLorentzVector nu_p4(0.,0.,Ev,Ev); // px,py,pz,E (GeV)
+  InitialState init_state(target, gOptNuPdgCode);
+
+  GEVGDriver evg_driver;
+  evg_driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  evg_driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+  evg_driver.Configure(init_state);
+  evg_driver.UseSplines();
+
+  std::chrono::steady_clock::time_point tfirst = tstart;
+
+  RandomGen * rnd = RandomGen::Instance();
+  Long64_t iattempt = 0;
+  int ievent = 0;
+  while (ievent < gOptNevents) {
+     if(rnd->CounterBased()) rnd->SetEventIndex(iattempt);
+     iattempt++;
+     EventRecord * event = evg_driver.GenerateEvent(nu_p4);
+     if(!event) {
+        LOG("gevgen_bench", pNOTICE) << "Last attempt failed. Re-trying....";
+        continue;
+     }
+     delete event;
+
+     // the first event includes all lazy initialization
+     if(ievent == 0) {
+       tfirst = std::chrono::steady_clock::now();
+       result.tinit =
+          std::chrono::duration<double>(tfirst - tstart).count();
+     }
+     ievent++;
+  }
+
+  std::chrono::steady_clock::time_point tend =
+                                      std::chrono::steady_clock::now();
+
+  result.ok       = 1;
+  result.nev      = ievent;
+  result.tgen     = std::chrono::duration<double>(tend - tfirst).count();
+  result.peak_rss = PeakRSS();
+
+  std::cout << endl << "** " << tune << " | nu:" << gOptNuPdgCode
+            << " tgt:" << target << " E:" << Ev << " GeV" << endl
+            << *ModuleTimingStats::Instance() << endl;
+
+  return result;
+}
+//____________________________________________________________________________
+double PeakRSS(void)
+{
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+  return usage.ru_maxrss / (1024. * 1024.); // bytes
+#else
+  return usage.ru_maxrss / 1024.;           // kbytes
+#endif
+}
+//____________________________________________________________________________
+void WriteProfile(void)
+{
+#ifdef __GENIE_PGO_GENERATE__
+#ifdef __clang__
+  __llvm_profile_write_file();
+#else
+  __gcov_dump();
+#endif
+#endif
+}
+//____________________________________________________________________________
+void PrintSummary(ostream & stream,
+      const vector<string> & jobs, const vector<BenchResult_t> & results)
+{
+  stream << endl << "** gevgen_bench summary: " << gOptNevents
+         << " events/job, seed: " << gOptRanSeed
+         << ", splines: " << gOptInpXSecFile << endl;
+  stream << setw(60) << "reference job"
+         << " | " << setw(10) << "init (s)"
+         << " | " << setw(10) << "events/s"
+         << " | " << setw(12) << "peak RSS (MB)" << endl;
+
+  for(unsigned int i = 0; i < jobs.size(); i++) {
+    const BenchResult_t & res = results[i];
+    stream << setw(60) << jobs[i] << " | ";
+    if(!res.ok) {
+      stream << "FAILED" << endl;
+      continue;
+    }
+    double rate = (res.tgen > 0 && res.nev > 1) ? (res.nev - 1) / res.tgen : 0.;
+    stream << fixed << setprecision(3)
+           << setw(10) << res.tinit << " | "
+           << setw(10) << rate      << " | "
+           << setw(12) << res.peak_rss << endl;
+    stream.unsetf(std::ios_base::floatfield);
+  }
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gevgen_bench", pINFO) << "Parsing command line arguments";
+
+  // Common run options (event generator list, xml path, ...)
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  // help?
+  if( parser.OptionExists('h') ) {
+      PrintSyntax();
+      exit(0);
+  }
+
+  // number of events per job
+  gOptNevents = (parser.OptionExists('n')) ?
+                 parser.ArgAsInt('n') : kDefOptNevents;
+  if(gOptNevents <= 0) {
+    LOG("gevgen_bench", pFATAL) << "Invalid number of events: " << gOptNevents;
+    PrintSyntax();
+    exit(1);
+  }
+
+  // neutrino energies
+  if( parser.OptionExists('e') ) {
+    gOptEnergies = parser.ArgAsDoubleTokens('e', ",");
+  } else {
+    vector<string> tokens = utils::str::Split(kDefOptEnergies, ",");
+    for(unsigned int i = 0; i < tokens.size(); i++) {
+      gOptEnergies.push_back(atof(tokens[i].c_str()));
+    }
+  }
+
+  // neutrino PDG code
+  gOptNuPdgCode = (parser.OptionExists('p')) ?
+                   parser.ArgAsInt('p') : kDefOptNuPdgCode;
+
+  // targets
+  if( parser.OptionExists('t') ) {
+    gOptTargets = parser.ArgAsIntTokens('t', ",");
+  } else {
+    vector<string> tokens = utils::str::Split(kDefOptTargets, ",");
+    for(unsigned int i = 0; i < tokens.size(); i++) {
+      gOptTargets.push_back(atoi(tokens[i].c_str()));
+    }
+  }
+
+  // summary file
+  gOptSummaryFile = (parser.OptionExists('o')) ? parser.ArgAsString('o') : "";
+
+  // tunes
+  string tunes = (parser.OptionExists("tunes")) ?
+                  parser.ArgAsString("tunes") : kDefOptTunes;
+  gOptTunes = utils::str::Split(tunes, ",");
+
+  // random number seed
+  gOptRanSeed = (parser.OptionExists("seed")) ?
+                 parser.ArgAsLong("seed") : kDefOptRanSeed;
+
+  // cross-section splines: required, so that all jobs are comparable
+  if( parser.OptionExists("cross-sections") ) {
+    gOptInpXSecFile = parser.ArgAsString("cross-sections");
+  } else {
+    LOG("gevgen_bench", pFATAL)
+       << "A cross-section spline file must be specified";
+    PrintSyntax();
+    exit(1);
+  }
+
+  // message thresholds
+  gOptMesgThres = RunOpt::Instance()->MesgThresholdFiles();
+  if(gOptMesgThres.size() == 0) gOptMesgThres = kDefOptMesgThres;
+
+  if(gOptEnergies.size() == 0 || gOptTargets.size() == 0 ||
+     gOptTunes.size() == 0) {
+    LOG("gevgen_bench", pFATAL) << "No reference jobs to run";
+    PrintSyntax();
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gevgen_bench", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "\n      gevgen_bench [-h]"
+    << "\n                   [-n nev]"
+    << "\n                   [-e energies]"
+    << "\n                   [-p neutrino_pdg]"
+    << "\n                   [-t target_pdgs]"
+    << "\n                   [-o summary_file]"
+    << "\n                   [--tunes tune_list]"
+    << "\n                   [--seed random_number_seed]"
+    << "\n                    --cross-sections xml_file"
+    << "\n                   [--event-generator-list list_name]"
+    << "\n                   [--message-thresholds xml_file]"
+    << "\n                   [--xml-path config_xml_dir]"
+    << "\n";
+}
+//____________________________________________________________________________
@@ -11,6 +11,11 @@
             functional form, tabular text file or a ROOT histogram) and for
             simple 'geometries' (a target mix with its corresponding weights)
 
+         For a fixed init state, the job can also scan a list of dark matter
+         masses, mediator mass ratios and couplings (see the -m, -z and -g
+         options): it is initialized once, and then it generates the requested
+         events at each point of the scan in turn, each in its own output.
+
          See the GENIE manual for other apps handling experiment-specific
          event generation cases using the outputs of detailed dark matter flux
          simulations and realistic detector geometry descriptions.
@@ -20,10 +25,10 @@
                      [-r run#]
                      -n nev
                      -e energy (or energy range)
-                     -m mass
+                     -m mass (or comma-separated list of masses)
                      -t target_pdg
-                     [-g zp_coupling]
-                     [-z med_ratio]
+                     [-g zp_coupling (or comma-separated list)]
+                     [-z med_ratio (or comma-separated list)]
                      [-f flux_description]
                      [-o outfile_name]
                      [-w]
@@ -52,6 +57,9 @@
               via the -f option (see below).
            -m
               Specifies the dark matter mass.
+              If what follows the -m option is a comma separated list of
+              values, eg `-m 0.01,0.02,0.05,0.1', the job scans these masses
+              (only for a fixed init state, see below).
            -t
               Specifies the target PDG code (pdg format: 10LZZZAAAI) _or_ a target
               mix (pdg codes with corresponding weights) typed as a comma-separated
@@ -60,11 +68,28 @@
               For example, to use a target mix of 95% O16 and 5% H type:
               `-t 1000080160[0.95],1000010010[0.05]'.
            -z
-              Specifies the ratio of the mediator mass to dark matter mass.
+              Specifies the ratio of the mediator mass to dark matter mass,
+              or a comma separated list of ratios to scan.
               Default: 0.5
            -g
-              Specifies the Z' coupling constant
+              Specifies the Z' coupling constant, or a comma separated list
+              of couplings to scan.
               Default: Value in UserPhysicsOptions.xml
+
+              When more than one value is given to the -m, -z or -g options,
+              the job generates the -n events at each (mass, ratio, coupling)
+              point of the scan, looping over the couplings, then the ratios,
+              then the masses. The tune, messenger, random number generators
+              and event generator list are set up once for all the points.
+              At each point the dark matter and mediator masses are updated
+              in the PDG library, the algorithms are reconfigured and the
+              cached max cross sections & cross section integrals are cleared,
+              as they were all computed for the previous point.
+              The events of point i are written with run number run#+i
+              (see -r), so in gntp.<run#+i>.ghep.root, or with a `_i' suffix
+              added to the -o file name.
+              The cross sections are computed at each point: a scan can not
+              use input splines (--cross-sections), nor a flux or target mix.
            -f
               Specifies the dark matter flux spectrum.
               It can be any of:
@@ -148,6 +173,7 @@
 
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/XmlParserStatus.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Controls.h"
@@ -168,6 +194,7 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/StringUtils.h"
@@ -198,6 +225,9 @@ void GetCommandLineArgs (int argc, char ** argv);
 void Initialize         (void);
 void PrintSyntax        (void);
 bool CheckUnitarityLimit(InitialState init_state);
+void   SetScanPoint     (unsigned int ipoint);
+string ScanPointFilename(string filename, unsigned int ipoint);
+vector<double> ReadValueList (string values);
 
 #ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
 void            GenerateEventsUsingFluxOrTgtMix();
@@ -207,7 +237,7 @@ GFluxI *        MonoEnergeticFluxDriver (void);
 GFluxI *        TH1FluxDriver           (void);
 #endif
 
-void GenerateEventsAtFixedInitState (void);
+void GenerateEventsAtFixedInitState (unsigned int ipoint);
 
 //Default options (override them using the command line arguments):
 int           kDefOptNevents   = 0;       // n-events to generate
@@ -231,17 +261,19 @@ string          gOptInpXSecFile;  // cross-section splines
 string          gOptOutFileName;  // Optional outfile name
 string          gOptStatFileName; // Status file name, set if gOptOutFileName was set.
 
+// a point of a dark matter mass / mediator scan
+struct DMScanPoint {
+  double mass;      // dark matter mass
+  double med_ratio; // ratio of mediator to DM mass
+  double coupling;  // mediator coupling (<= 0: value from config)
+};
+vector<DMScanPoint> gScanPoints;  // the points to generate events at
+
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
   GetCommandLineArgs(argc,argv);
-  PDGLibrary::Instance()->AddDarkMatter(gOptDMMass,gOptMedRatio);
-  if (gOptZpCoupling > 0.) {
-      Registry * r = AlgConfigPool::Instance()->CommonParameterList("BoostedDarkMatter");
-      r->UnLock();
-      r->Set("ZpCoupling", gOptZpCoupling);
-      r->Lock();
-  }
+  SetScanPoint(0);
   Initialize();
 
 
@@ -263,11 +295,65 @@ int main(int argc, char ** argv)
     << "\n   --enable-flux-drivers  --enable-geom-drivers \n" ;
 #endif
   } else {
-     GenerateEventsAtFixedInitState();
+     for(unsigned int ipoint = 0; ipoint < gScanPoints.size(); ipoint++) {
+        if(ipoint > 0) SetScanPoint(ipoint);
+        GenerateEventsAtFixedInitState(ipoint);
+     }
   }
   return 0;
 }
 //____________________________________________________________________________
+void SetScanPoint(unsigned int ipoint)
+{
+// Sets the dark matter mass, mediator mass ratio and coupling of a point of
+// the scan. After the first point, the algorithms are reconfigured, as they
+// read the masses & coupling at configuration, and the cached max xsecs and
+// xsec integrals, computed for the previous point, are removed.
+
+  const DMScanPoint & point = gScanPoints[ipoint];
+  gOptDMMass     = point.mass;
+  gOptMedRatio   = point.med_ratio;
+  gOptZpCoupling = point.coupling;
+
+  if(ipoint > 0) {
+    LOG("gevgen_dm", pNOTICE)
+      << "\n ** Scan point " << ipoint << ": dark matter mass = " << gOptDMMass
+      << " GeV, mediator mass ratio = " << gOptMedRatio
+      << ", coupling = " << gOptZpCoupling;
+    PDGLibrary::Instance()->ReloadDBase();
+  }
+  PDGLibrary::Instance()->AddDarkMatter(gOptDMMass,gOptMedRatio);
+  if (gOptZpCoupling > 0.) {
+      Registry * r = AlgConfigPool::Instance()->CommonParameterList("BoostedDarkMatter");
+      r->UnLock();
+      r->Set("ZpCoupling", gOptZpCoupling);
+      r->Lock();
+  }
+
+  if(ipoint > 0) {
+    AlgFactory::Instance()->ForceReconfiguration();
+    Cache::Instance()->RmAllCacheBranches();
+  }
+}
+//____________________________________________________________________________
+string ScanPointFilename(string filename, unsigned int ipoint)
+{
+// The output of the i-th point of a scan gets an _i suffix (before the file
+// extension, if any)
+
+  if(gScanPoints.size() < 2) return filename;
+
+  ostringstream suffix;
+  suffix << "_" << ipoint;
+
+  string::size_type idot   = filename.find_last_of(".");
+  string::size_type islash = filename.find_last_of("/");
+  if(idot == string::npos || (islash != string::npos && idot < islash)) {
+    return filename + suffix.str();
+  }
+  return filename.insert(idot, suffix.str());
+}
+//____________________________________________________________________________
 void Initialize()
 {
 
@@ -288,7 +374,7 @@ void Initialize()
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 }
 //____________________________________________________________________________
-void GenerateEventsAtFixedInitState(void)
+void GenerateEventsAtFixedInitState(unsigned int ipoint)
 {
   int dark_matter = kPdgDarkMatter;
   int target   = gOptTgtMix.begin()->first;
@@ -315,29 +401,32 @@ void GenerateEventsAtFixedInitState(void)
   evg_driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
   evg_driver.Configure(init_state);
 
-  // Initialize an Ntuple Writer
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  // Initialize an Ntuple Writer (each point of a scan has its own run
+  // number & output)
+  Long_t runnu = gOptRunNu + ipoint;
+  NtpWriter ntpw(kDefOptNtpFormat, runnu);
 
   // If an output file name has been specified... use it
   if (!gOptOutFileName.empty()){
-    ntpw.CustomizeFilename(gOptOutFileName);
+    ntpw.CustomizeFilename(ScanPointFilename(gOptOutFileName, ipoint));
   }
   ntpw.Initialize();
 
 
   // Create an MC Job Monitor
-  GMCJMonitor mcjmonitor(gOptRunNu);
+  GMCJMonitor mcjmonitor(runnu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
 
   // If a status file name has been given... use it
   if (!gOptStatFileName.empty()){
-    mcjmonitor.CustomizeFilename(gOptStatFileName);
+    mcjmonitor.CustomizeFilename(ScanPointFilename(gOptStatFileName, ipoint));
   }
 
 
   LOG("gevgen_dm", pNOTICE)
     << "\n ** Will generate " << gOptNevents << " events for \n"
-    << init_state << " at Ev = " << Ed << " GeV";
+    << init_state << " at Ev = " << Ed << " GeV"
+    << " (dark matter mass = " << Md << " GeV, run " << runnu << ")";
 
   // Generate events / print the GHEP record / add it to the ntuple
   int ievent = 0;
@@ -691,23 +780,25 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(1);
   }
 
-  // dark matter mass
+  // dark matter mass(es)
+  vector<double> masses;
   if( parser.OptionExists('m') ) {
     LOG("gevgen_dm", pINFO) << "Reading dark matter mass";
-    gOptDMMass = parser.ArgAsDouble('m');
+    masses = ReadValueList(parser.ArgAsString('m'));
   } else {
     LOG("gevgen_dm", pFATAL) << "Unspecified dark matter mass - Exiting";
     PrintSyntax();
     exit(1);
   }
 
-  // mediator coupling
+  // mediator coupling(s)
+  vector<double> couplings;
   if( parser.OptionExists('g') ) {
     LOG("gevgen_dm", pINFO) << "Reading mediator coupling";
-    gOptZpCoupling = parser.ArgAsDouble('g');
+    couplings = ReadValueList(parser.ArgAsString('g'));
   } else {
     LOG("gevgen_dm", pINFO) << "Unspecified mediator coupling - Using value from config file";
-    gOptZpCoupling = -1.;
+    couplings.push_back(-1.);
   }
 
   // target mix (their PDG codes with their corresponding weights)
@@ -746,17 +837,36 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(1);
   }
 
-  // mediator mass ratio
+  // mediator mass ratio(s)
+  vector<double> ratios;
   if( parser.OptionExists('z') ) {
     LOG("gevgen_dm", pINFO) << "Reading mediator mass ratio";
-    gOptMedRatio = parser.ArgAsDouble('z');
+    ratios = ReadValueList(parser.ArgAsString('z'));
   } else {
     LOG("gevgen_dm", pINFO) << "Unspecified mediator mass ratio - Using default";
-    gOptMedRatio = 0.5;
+    ratios.push_back(0.5);
   }
 
   gOptUsingFluxOrTgtMix = using_flux || using_tgtmix;
 
+  // the points of the mass / mediator scan (a single one unless lists of
+  // values were input)
+  gScanPoints.clear();
+  for(unsigned int im = 0; im < masses.size(); im++) {
+    for(unsigned int ir = 0; ir < ratios.size(); ir++) {
+      for(unsigned int ig = 0; ig < couplings.size(); ig++) {
+        DMScanPoint point;
+        point.mass      = masses[im];
+        point.med_ratio = ratios[ir];
+        point.coupling  = couplings[ig];
+        gScanPoints.push_back(point);
+      }
+    }
+  }
+  gOptDMMass     = gScanPoints[0].mass;
+  gOptMedRatio   = gScanPoints[0].med_ratio;
+  gOptZpCoupling = gScanPoints[0].coupling;
+
   // random number seed
   if( parser.OptionExists("seed") ) {
     LOG("gevgen_dm", pINFO) << "Reading random number seed";
@@ -775,6 +885,24 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // a scan computes the cross sections at each of its points: the splines
+  // (which are not keyed by the dark matter mass) and the flux drivers
+  // (which use them) can not be used
+  if(gScanPoints.size() > 1) {
+    if(gOptUsingFluxOrTgtMix) {
+      LOG("gevgen_dm", pFATAL)
+        << "A dark matter mass / mediator scan can not be used with a flux"
+        << " or a target mix - Exiting";
+      exit(1);
+    }
+    if(gOptInpXSecFile.size() > 0) {
+      LOG("gevgen_dm", pFATAL)
+        << "A dark matter mass / mediator scan can not use input"
+        << " cross-section splines - Exiting";
+      exit(1);
+    }
+  }
+
   //
   // print-out the command line options
   //
@@ -811,12 +939,24 @@ void GetCommandLineArgs(int argc, char ** argv)
      LOG("gevgen_dm", pNOTICE)
         << "Dark matter energy: " << gOptDMEnergy;
   }
-  LOG("gevgen_dm", pNOTICE)
-      << "Dark matter mass: " << gOptDMMass;
+  if(gScanPoints.size() > 1) {
+     LOG("gevgen_dm", pNOTICE)
+        << "Dark matter mass / mediator scan: " << gScanPoints.size() << " points";
+     for(unsigned int ipoint = 0; ipoint < gScanPoints.size(); ipoint++) {
+        LOG("gevgen_dm", pNOTICE)
+           << " >> point " << ipoint << " (run " << gOptRunNu + ipoint
+           << "): mass = " << gScanPoints[ipoint].mass
+           << ", mediator mass ratio = " << gScanPoints[ipoint].med_ratio
+           << ", coupling = " << gScanPoints[ipoint].coupling;
+     }
+  } else {
+     LOG("gevgen_dm", pNOTICE)
+         << "Dark matter mass: " << gOptDMMass;
+     LOG("gevgen_dm", pNOTICE)
+         << "Mediator mass ratio: " << gOptMedRatio;
+  }
   LOG("gevgen_dm", pNOTICE)
       << "Target code (PDG) & weight fraction (in case of multiple targets): ";
-  LOG("gevgen_dm", pNOTICE)
-      << "Mediator mass ratio: " << gOptMedRatio;
   map<int,double>::const_iterator iter;
   for(iter = gOptTgtMix.begin(); iter != gOptTgtMix.end(); ++iter) {
       int    tgtpdgc = iter->first;
@@ -830,6 +970,25 @@ void GetCommandLineArgs(int argc, char ** argv)
 
 }
 //____________________________________________________________________________
+vector<double> ReadValueList(string values)
+{
+// Reads a value or a comma separated list of values
+
+  vector<double> vlist;
+  vector<string> vs = utils::str::Split(values, ",");
+  for(unsigned int i = 0; i < vs.size(); i++) {
+    string v = utils::str::TrimSpaces(vs[i]);
+    if(v.size() == 0) continue;
+    vlist.push_back(atof(v.c_str()));
+  }
+  if(vlist.size() == 0) {
+    LOG("gevgen_dm", pFATAL) << "Invalid list of values: " << values;
+    PrintSyntax();
+    exit(1);
+  }
+  return vlist;
+}
+//____________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevgen_dm", pNOTICE)
@@ -838,10 +997,10 @@ void PrintSyntax(void)
     << "\n                [-r run#]"
     << "\n                -n nev"
     << "\n                -e energy (or energy range) "
-    << "\n                -m mass"
+    << "\n                -m mass (or comma-separated list of masses)"
     << "\n                -t target_pdg "
-    << "\n                [-g zp_coupling]"
-    << "\n                [-z med_ratio]"
+    << "\n                [-g zp_coupling (or comma-separated list)]"
+    << "\n                [-z med_ratio (or comma-separated list)]"
     << "\n                [-f flux_description]"
     << "\n                [-o outfile_name]"
     << "\n                [-w]"
@@ -9,6 +9,8 @@
          Syntax :
            gevgen_hadron [-n nev] -p probe -t tgt [-r run#] -k KE
                          [-f flux] [-o prefix] [-m mode]
+                         [--scan scan_file] [-j nworkers]
+                         [--batch-size nev]
                          [--seed random_number_seed]
                          [--message-thresholds xml_file]
                          [--event-record-print-level level]
@@ -41,6 +43,27 @@
               Output filename prefix
            -m
               INTRANUKE mode <hA, hN> (default: hA)
+           --scan
+              Batch (scan) mode: a text file listing the points to simulate,
+              one per line, as `probe_pdg target_pdg KE [nev]' (KE in GeV;
+              nev defaults to the -n value; lines starting with # are
+              skipped). INTRANUKE is initialized once, and a summary table of
+              the fate fractions of each point (the fates identified as in
+              the gntpc `ginuke' format) with the throughput of each point is
+              written to prefix.scan.txt. No events are saved.
+              Options -p, -t, -k and -f are not used.
+           -j
+              Number of worker processes simulating the points of a scan
+              (default: 1). Workers are forked after INTRANUKE is initialized.
+              With a fixed seed, the results do not depend on the number of
+              workers: each point uses the seed + the point index.
+           --batch-size
+              Experimental: the events are generated in blocks of nev events
+              and INTRANUKE steps the hadrons of all the events of a block in
+              lockstep (see Intranuke2018::ProcessEventRecords()). The
+              results agree statistically, not event by event, with the
+              default mode. Only for the hA2018 and hN2018 modes (default: 1,
+              one event at a time).
            --seed
               Random number seed.
            --message-thresholds
@@ -67,6 +90,11 @@
              distributed as f(KE) = 1/KE in the [165 MeV, 1200 MeV] range:
              % ghAevgen -n gevgen_hadron -p 211 -t 1000260560 -k 0.165,1.200 -f '1/x'
 
+         (4) Simulate 10k events at each point listed in points.txt, using 8
+             worker processes, and save the fate fractions in
+             fsi.scan.txt:
+             % gevgen_hadron -n 10000 -m hA2018 --scan points.txt -j 8 -o fsi
+
 \authors  Steve Dytman, Minsuk Kim and Aaron Meyer
           University of Pittsburgh
 
@@ -85,12 +113,19 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
 
+#include <TMath.h>
 #include <TSystem.h>
 #include <TFile.h>
 #include <TTree.h>
 #include <TH1D.h>
 #include <TF1.h>
+#include <TRandom.h>
+#include <TStopwatch.h>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/Controls.h"
@@ -108,21 +143,44 @@
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/SystemUtils.h"
 
 #include "Physics/HadronTransport/INukeHadroFates.h"
 #include "Physics/HadronTransport/INukeUtils.h"
+#include "Physics/HadronTransport/Intranuke2018.h"
+
+using std::ostringstream;
+using std::ifstream;
+using std::ofstream;
+using std::setw;
+using std::vector;
 
 using namespace genie;
 using namespace genie::controls;
 
 using namespace genie::utils::intranuke;
 
+// A point of a scan
+typedef struct {
+  int    probe;  // probe PDG code
+  int    target; // target PDG code
+  double ke;     // probe kinetic energy (GeV)
+  int    nev;    // n-events to generate
+} ScanPoint_t;
+
+// Fates of a scan summary (see ProbeFate())
+const int     kNScanFates = 9;
+const char *  kScanFateName[kNScanFates] = {
+  "undef", "noint", "cex", "elas", "inel", "abs", "ko", "piprod", "dcex"
+};
+
 // Function prototypes
 void                        GetCommandLineArgs    (int argc, char ** argv);
 const EventRecordVisitorI * GetIntranuke          (void);
@@ -130,6 +188,14 @@ double                      GenProbeKineticEnergy (void);
 EventRecord *               InitializeEvent       (void);
 void                        BuildSpectrum         (void);
 void                        PrintSyntax           (void);
+void                        ReadScanPoints        (void);
+void                        RunScan               (const EventRecordVisitorI * intranuke);
+void                        ScanChunk             (int ichunk, int nchunks, Long64_t first,
+                                                   Long64_t last, void * args);
+string                      ScanChunkFilename     (int ichunk);
+void                        ProcessEvents         (const EventRecordVisitorI * intranuke,
+                                                   const vector<EventRecord *> & events);
+int                         ProbeFate             (EventRecord * evrec);
 
 // Default options
 int     kDefOptNevents      = 10000;   // n-events to generate
@@ -150,14 +216,22 @@ string   gOptFlux;             // input flux (function or flux file)
 string   gOptEvFilePrefix;     // event file prefix
 bool     gOptUsingFlux=false;  // using kinetic energy distribution?
 long int gOptRanSeed ;         // random number seed
+string   gOptScanFile;         // scan points file (batch mode, if set)
+int      gOptNWorkers = 1;     // number of worker processes for a scan
+int      gOptBatchSize = 1;    // events transported in lockstep by INTRANUKE
 
 TH1D * gSpectrum  = 0;
 
+vector<ScanPoint_t> gScanPoints;   // the points of a scan
+long int            gScanSeed = 0; // base seed of a scan
+string              gScanChunkBase; // base name of the scan chunk files
+
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
   // Parse command line arguments
   GetCommandLineArgs(argc,argv);
+  if(gOptScanFile.size() > 0) ReadScanPoints();
 
   if ( ! RunOpt::Instance()->Tune() ) {
     LOG("gmkspl", pFATAL) << " No TuneId in RunOption";
@@ -178,6 +252,18 @@ int main(int argc, char ** argv)
 
   // Get the specified INTRANUKE model
   const EventRecordVisitorI * intranuke = GetIntranuke();
+  if(gOptBatchSize > 1 && !dynamic_cast<const Intranuke2018 *>(intranuke)) {
+    LOG("gevgen_hadron", pWARN)
+      << "No batch mode for the " << gOptMode << " INTRANUKE mode - "
+      << "Transporting one event at a time";
+    gOptBatchSize = 1;
+  }
+
+  // Batch mode: one INTRANUKE instance for all the points of a scan
+  if(gOptScanFile.size() > 0) {
+    RunScan(intranuke);
+    return 0;
+  }
 
   // Initialize an Ntuple Writer to save GHEP records into a ROOT tree
   NtpWriter ntpw(kNFGHEP, gOptRunNu);
@@ -194,27 +280,36 @@ int main(int argc, char ** argv)
   //
 
   int ievent = 0;
+  vector<EventRecord *> block;
   while (ievent < gOptNevents) {
       LOG("gevgen_hadron", pNOTICE)
          << " *** Generating event............ " << ievent;
 
-      // initialize
-      EventRecord * evrec = InitializeEvent();
+      // initialize (a block of events in the batch mode)
+      int nblock = TMath::Min(gOptBatchSize, gOptNevents - ievent);
+      block.clear();
+      for(int iblock = 0; iblock < nblock; iblock++) {
+        block.push_back(InitializeEvent());
+      }
+
+      // generate full h+A event(s)
+      ProcessEvents(intranuke, block);
 
-      // generate full h+A event
-      intranuke->ProcessEventRecord(evrec);
+      for(int iblock = 0; iblock < nblock; iblock++) {
+        EventRecord * evrec = block[iblock];
 
-      // print generated events
-      LOG("gevgen_hadron", pNOTICE ) << *evrec;
+        // print generated events
+        LOG("gevgen_hadron", pNOTICE ) << *evrec;
 
-      // add event at the output ntuple
-      ntpw.AddEventRecord(ievent, evrec);
+        // add event at the output ntuple
+        ntpw.AddEventRecord(ievent, evrec);
 
-      // refresh the mc job monitor
-      mcjmonitor.Update(ievent,evrec);
+        // refresh the mc job monitor
+        mcjmonitor.Update(ievent,evrec);
 
-      ievent++;
-      delete evrec;
+        ievent++;
+        delete evrec;
+      }
 
   } // end loop events
 
@@ -393,6 +488,269 @@ void BuildSpectrum(void)
   f.Close();
 }
 //____________________________________________________________________________
+void ReadScanPoints(void)
+{
+// Read the scan points: `probe_pdg target_pdg KE [nev]' per line
+
+  ifstream scan_file(gOptScanFile.c_str());
+  if(!scan_file.is_open()) {
+    LOG("gevgen_hadron", pFATAL)
+      << "Couldn't open the scan points file: " << gOptScanFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  string line;
+  int iline = 0;
+  while(std::getline(scan_file, line)) {
+    iline++;
+    line = utils::str::TrimSpaces(line);
+    if(line.size() == 0 || line[0] == '#') continue;
+
+    std::istringstream fields(line);
+    ScanPoint_t point;
+    point.nev = gOptNevents;
+    if(!(fields >> point.probe >> point.target >> point.ke) || point.ke <= 0) {
+      LOG("gevgen_hadron", pFATAL)
+        << "Invalid scan point at line " << iline << " of " << gOptScanFile
+        << ": " << line;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    fields >> point.nev;
+    gScanPoints.push_back(point);
+  }
+
+  if(gScanPoints.size() == 0) {
+    LOG("gevgen_hadron", pFATAL) << "No scan points in " << gOptScanFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+void RunScan(const EventRecordVisitorI * intranuke)
+{
+// Simulate all the points of a scan, in forked worker processes if more
+// than one worker was requested (INTRANUKE is initialized, once, before
+// forking), and write the fate fractions of each point in a summary table
+
+  int npoints = gScanPoints.size();
+
+  LOG("gevgen_hadron", pNOTICE)
+    << "*** Scanning " << npoints << " points using "
+    << gOptNWorkers << " worker(s)";
+
+  gScanSeed = RandomGen::Instance()->GetSeed();
+
+  // chunk files are named after the parent process
+  ostringstream base;
+  base << gSystem->TempDirectory() << "/gevgen_hadron_" << gSystem->GetPid();
+  gScanChunkBase = base.str();
+
+  TStopwatch stopwatch;
+  stopwatch.Start();
+
+  int nchunks = 1;
+  if(gOptNWorkers > 1) {
+    nchunks = utils::system::RunInWorkerProcesses(
+       gOptNWorkers, 0, npoints, ScanChunk, (void *) intranuke);
+    if(nchunks < 0) {
+      LOG("gevgen_hadron", pFATAL) << "A scan worker did not complete";
+      gAbortingInErr = true;
+      exit(1);
+    }
+  } else {
+    ScanChunk(0, 1, 0, npoints, (void *) intranuke);
+  }
+
+  stopwatch.Stop();
+
+  // collect the results of the workers
+  vector<int>    nev (npoints, 0);
+  vector<double> time(npoints, 0.);
+  vector< vector<int> > nfate(npoints, vector<int>(kNScanFates, 0));
+  for(int ichunk = 0; ichunk < nchunks; ichunk++) {
+    ifstream chunk(ScanChunkFilename(ichunk).c_str());
+    int ipoint = 0;
+    while(chunk >> ipoint) {
+      assert(ipoint >= 0 && ipoint < npoints);
+      chunk >> nev[ipoint] >> time[ipoint];
+      for(int ifate = 0; ifate < kNScanFates; ifate++) {
+        chunk >> nfate[ipoint][ifate];
+      }
+    }
+    chunk.close();
+    gSystem->Unlink(ScanChunkFilename(ichunk).c_str());
+  }
+
+  // write the summary table
+  string summary_filename = gOptEvFilePrefix + ".scan.txt";
+  ofstream summary(summary_filename.c_str());
+  summary << "# gevgen_hadron scan, mode: " << gOptMode
+          << ", seed: " << gScanSeed << "\n";
+  summary << "# fates as in gntpc -f ginuke; rates in events/sec (real time)\n";
+  summary << "#" << setw(11) << "probe" << setw(12) << "target"
+          << setw(12) << "KE" << setw(9) << "nev";
+  for(int ifate = 0; ifate < kNScanFates; ifate++) {
+    summary << setw(10) << kScanFateName[ifate];
+  }
+  summary << setw(12) << "rate" << "\n";
+
+  long int nev_total = 0;
+  for(int ipoint = 0; ipoint < npoints; ipoint++) {
+    const ScanPoint_t & point = gScanPoints[ipoint];
+    summary << setw(12) << point.probe << setw(12) << point.target
+            << setw(12) << point.ke << setw(9) << nev[ipoint];
+    for(int ifate = 0; ifate < kNScanFates; ifate++) {
+      double frac = (nev[ipoint] > 0) ? nfate[ipoint][ifate] / (double) nev[ipoint] : 0.;
+      summary << setw(10) << std::setprecision(5) << frac;
+    }
+    double rate = (time[ipoint] > 0) ? nev[ipoint] / time[ipoint] : 0.;
+    summary << setw(12) << std::setprecision(6) << rate << "\n";
+    nev_total += nev[ipoint];
+  }
+  summary.close();
+
+  double rate = (stopwatch.RealTime() > 0) ? nev_total / stopwatch.RealTime() : 0.;
+  LOG("gevgen_hadron", pNOTICE)
+    << "Simulated " << nev_total << " events at " << npoints << " points in "
+    << stopwatch.RealTime() << " sec (real time) - " << rate << " events/sec";
+  LOG("gevgen_hadron", pNOTICE)
+    << "Saved the scan summary to " << summary_filename;
+}
+//____________________________________________________________________________
+void ScanChunk(
+  int ichunk, int nchunks, Long64_t /*first*/, Long64_t last, void * args)
+{
+// Simulate every nchunks-th scan point, starting from the ichunk-th one (so
+// that points listed in energy order are shared evenly between the workers)
+// and save the fate counts of each point to the chunk file
+
+  const EventRecordVisitorI * intranuke =
+       static_cast<const EventRecordVisitorI *> (args);
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  ofstream chunk(ScanChunkFilename(ichunk).c_str());
+
+  for(Long64_t ipoint = ichunk; ipoint < last; ipoint += nchunks) {
+    const ScanPoint_t & point = gScanPoints[ipoint];
+
+    LOG("gevgen_hadron", pNOTICE)
+      << "*** Scan point " << ipoint << ": probe = " << point.probe
+      << ", target = " << point.target << ", KE = " << point.ke
+      << " GeV, " << point.nev << " events";
+
+    gOptProbePdgCode = point.probe;
+    gOptTgtPdgCode   = point.target;
+    gOptProbeKE      = point.ke;
+    gOptUsingFlux    = false;
+
+    // the seed of each point depends only on the point index
+    rnd->SetSeed(gScanSeed + ipoint);
+    gRandom->SetSeed(gScanSeed + ipoint);
+
+    int nfate[kNScanFates] = { 0 };
+
+    TStopwatch stopwatch;
+    stopwatch.Start();
+    vector<EventRecord *> block;
+    for(int ievent = 0; ievent < point.nev; ievent += gOptBatchSize) {
+      int nblock = TMath::Min(gOptBatchSize, point.nev - ievent);
+      block.clear();
+      for(int iblock = 0; iblock < nblock; iblock++) {
+        block.push_back(InitializeEvent());
+      }
+      ProcessEvents(intranuke, block);
+      for(int iblock = 0; iblock < nblock; iblock++) {
+        nfate[ProbeFate(block[iblock])]++;
+        delete block[iblock];
+      }
+    }
+    stopwatch.Stop();
+
+    chunk << ipoint << " " << point.nev << " " << stopwatch.RealTime();
+    for(int ifate = 0; ifate < kNScanFates; ifate++) {
+      chunk << " " << nfate[ifate];
+    }
+    chunk << "\n";
+  }
+
+  chunk.close();
+}
+//____________________________________________________________________________
+void ProcessEvents(
+  const EventRecordVisitorI * intranuke, const vector<EventRecord *> & events)
+{
+// Run INTRANUKE on a block of events: in lockstep in the batch mode, or one
+// event at a time
+
+  const Intranuke2018 * intranuke2018 = (gOptBatchSize > 1) ?
+      dynamic_cast<const Intranuke2018 *> (intranuke) : 0;
+
+  if(intranuke2018 && events.size() > 1) {
+    vector<GHepRecord *> records(events.begin(), events.end());
+    intranuke2018->ProcessEventRecords(&records[0], records.size());
+    return;
+  }
+  for(unsigned int ievent = 0; ievent < events.size(); ievent++) {
+    intranuke->ProcessEventRecord(events[ievent]);
+  }
+}
+//____________________________________________________________________________
+string ScanChunkFilename(int ichunk)
+{
+  ostringstream name;
+  name << gScanChunkBase << "_" << ichunk << ".txt";
+  return name.str();
+}
+//____________________________________________________________________________
+int ProbeFate(EventRecord * evrec)
+{
+// The fate of the probe, identified from the final state hadrons as in the
+// gntpc `ginuke' format (see HAProbeFSI() in gNtpConv.cxx): 0 undefined,
+// 1 no interaction, 2 charge exchange, 3 elastic, 4 inelastic, 5 absorption,
+// 6 knock-out, 7 pion production, 8 double charge exchange
+
+  GHepParticle * probe = evrec->Particle(0);
+  assert(probe);
+  int probe_pdg = probe->Pdg();
+
+  int    nh     = 0;
+  int    npi    = 0;
+  double energy = 0;
+  double Eh0    = 0;
+  bool   same   = false; // a final state hadron of the probe pdg code?
+  bool   dcex   = false; // a final state pion of the opposite charge?
+
+  GHepParticle * p = 0;
+  TIter event_iter(evrec);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    if(pdg::IsPseudoParticle(p->Pdg())) continue;
+    if(p->Status() != kIStStableFinalState) continue;
+    if(nh == 0) Eh0 = p->E();
+    energy += p->E();
+    if(pdg::IsPion(p->Pdg())) npi++;
+    if(p->Pdg() == probe_pdg) same = true;
+    if(p->Pdg() == -probe_pdg &&
+       (probe_pdg == kPdgPiP || probe_pdg == kPdgPiM)) dcex = true;
+    nh++;
+  }
+
+  bool is_pion    = pdg::IsPion(probe_pdg);
+  bool is_nucleon = pdg::IsNucleon(probe_pdg);
+
+  if (probe->RescatterCode() == 3 && nh == 1)                       return 3;
+  if (nh == 1 && energy == Eh0)                                     return 1;
+  if (is_pion && npi == 0)                                          return 5;
+  if ((is_nucleon && npi == 0 && nh > 2) ||
+      (probe_pdg == kPdgGamma && energy != Eh0 && npi == 0))        return 6;
+  if (npi > (is_pion ? 1 : 0))                                      return 7;
+  if (nh >= 2) return (is_nucleon || (is_pion && same)) ? 4 : 2;
+  if (dcex)                                                         return 8;
+  return 0;
+}
+//____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
 {
   LOG("gevgen_hadron", pINFO) << "Parsing command line arguments";
@@ -404,6 +762,33 @@ void GetCommandLineArgs(int argc, char ** argv)
 
   CmdLnArgParser parser(argc,argv);
 
+  // scan points file (batch mode)
+  if( parser.OptionExists("scan") ) {
+    LOG("gevgen_hadron", pINFO) << "Reading the scan points file";
+    gOptScanFile = parser.ArgAsString("scan");
+  } else {
+    gOptScanFile = "";
+  }
+  bool scan = (gOptScanFile.size() > 0);
+
+  // number of worker processes
+  if( parser.OptionExists('j') ) {
+    LOG("gevgen_hadron", pINFO) << "Reading the number of worker processes";
+    gOptNWorkers = parser.ArgAsInt('j');
+    if(gOptNWorkers < 1) gOptNWorkers = 1;
+  } else {
+    gOptNWorkers = 1;
+  }
+
+  // number of events transported in lockstep (experimental batch mode)
+  if( parser.OptionExists("batch-size") ) {
+    LOG("gevgen_hadron", pINFO) << "Reading the INTRANUKE batch size";
+    gOptBatchSize = parser.ArgAsInt("batch-size");
+    if(gOptBatchSize < 1) gOptBatchSize = 1;
+  } else {
+    gOptBatchSize = 1;
+  }
+
   // number of events
   if( parser.OptionExists('n') ) {
     LOG("gevgen_hadron", pINFO) << "Reading number of events to generate";
@@ -427,7 +812,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   if( parser.OptionExists('p') ) {
     LOG("gevgen_hadron", pINFO) << "Reading rescattering particle PDG code";
     gOptProbePdgCode = parser.ArgAsInt('p');
-  } else {
+  } else if(!scan) {
     LOG("gevgen_hadron", pFATAL) << "Unspecified PDG code - Exiting";
     PrintSyntax();
     gAbortingInErr = true;
@@ -438,7 +823,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   if( parser.OptionExists('t') ) {
     LOG("gevgen_hadron", pINFO) << "Reading target PDG code";
     gOptTgtPdgCode = parser.ArgAsInt('t');
-  } else {
+  } else if(!scan) {
     LOG("gevgen_hadron", pFATAL) << "Unspecified target PDG code - Exiting";
     PrintSyntax();
     gAbortingInErr = true;
@@ -493,6 +878,10 @@ void GetCommandLineArgs(int argc, char ** argv)
           exit(1);
        }
     }
+  } else if(scan) {
+    gOptProbeKE    = -1;
+    gOptProbeKEmin = -1;
+    gOptProbeKEmax = -1;
   } else {
     LOG("gevgen_hadron", pFATAL) << "Unspecified kinetic energy - Exiting";
     PrintSyntax();
@@ -538,20 +927,27 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gevgen_hadron", pNOTICE) << "Random number seed = " << gOptRanSeed;
   LOG("gevgen_hadron", pNOTICE) << "Mode               = " << gOptMode;
   LOG("gevgen_hadron", pNOTICE) << "Number of events   = " << gOptNevents;
-  LOG("gevgen_hadron", pNOTICE) << "Probe PDG code     = " << gOptProbePdgCode;
-  LOG("gevgen_hadron", pNOTICE) << "Target PDG code    = " << gOptTgtPdgCode;
-  if(gOptProbeKEmin<0 && gOptProbeKEmax<0) {
-    LOG("gevgen_hadron", pNOTICE)
-        << "Hadron input KE    = " << gOptProbeKE;
-  } else {
-    LOG("gevgen_hadron", pNOTICE)
-        << "Hadron input KE range = ["
-        << gOptProbeKEmin << ", " << gOptProbeKEmax << "]";
+  LOG("gevgen_hadron", pNOTICE) << "INTRANUKE batch    = " << gOptBatchSize;
+  if(scan) {
+    LOG("gevgen_hadron", pNOTICE) << "Scan points file   = " << gOptScanFile;
+    LOG("gevgen_hadron", pNOTICE) << "Worker processes   = " << gOptNWorkers;
   }
-  if(gOptUsingFlux) {
-    LOG("gevgen_hadron", pNOTICE)
-        << "Input flux            = "
-        << gOptFlux;
+  else {
+    LOG("gevgen_hadron", pNOTICE) << "Probe PDG code     = " << gOptProbePdgCode;
+    LOG("gevgen_hadron", pNOTICE) << "Target PDG code    = " << gOptTgtPdgCode;
+    if(gOptProbeKEmin<0 && gOptProbeKEmax<0) {
+      LOG("gevgen_hadron", pNOTICE)
+          << "Hadron input KE    = " << gOptProbeKE;
+    } else {
+      LOG("gevgen_hadron", pNOTICE)
+          << "Hadron input KE range = ["
+          << gOptProbeKEmin << ", " << gOptProbeKEmax << "]";
+    }
+    if(gOptUsingFlux) {
+      LOG("gevgen_hadron", pNOTICE)
+          << "Input flux            = "
+          << gOptFlux;
+    }
   }
 
   LOG("gevgen_hadron", pNOTICE) << "\n";
@@ -565,6 +961,8 @@ void PrintSyntax(void)
     << "Syntax:" << "\n"
     << "   gevgen_hadron [-r run] [-n nev] -p hadron_pdg -t tgt_pdg -k KE [-m mode] "
     << "                 [-f flux] "
+    << "                 [--scan scan_file] [-j nworkers]"
+    << "                 [--batch-size nev]"
     << "                 [--seed random_number_seed]"
     << "                 [--message-thresholds xml_file]"
     << "                 [--event-record-print-level level]"
@@ -32,6 +32,10 @@
            e) NC coherent scattering. 
            Each such NC1pi0 source contributes differently to the pion momentum distribution.
 
+         If an input file contains the event index written alongside the GHEP event tree
+         (the `gindex' tree, see NtpEventIndex), the events are selected from the index and
+         only the selected event records are read.
+
          Synopsis:
            gevpick -i list_of_input_files -t topology  
                    [-o output_file]
@@ -117,6 +121,8 @@
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepUtils.h"
+#include "Framework/Interaction/InteractionType.h"
+#include "Framework/Ntuple/NtpEventIndex.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
@@ -139,6 +145,7 @@ using namespace genie;
 void   GetCommandLineArgs (int argc, char ** argv);
 void   RunCherryPicker    (void);
 bool   AcceptEvent        (const EventRecord & event);
+bool   AcceptEvent        (const NtpEventIndex & summary);
 void   PrintSyntax        (void);
 string DefaultOutputFile  (void);
 
@@ -241,17 +248,30 @@ void RunCherryPicker(void)
      LOG("gevpick", pNOTICE) 
           << "Input tree header: " << *thdr;
 
+     // If the file has an event index, select the events using the index
+     // and read only the selected GHEP records
+     TTree * index_tree = NtpEventIndex::IndexTree(&fin, ghep_tree);
+     NtpEventIndex index;
+     if(index_tree) {
+       index.SetBranchAddresses(index_tree);
+       LOG("gevpick", pNOTICE) << "Selecting events using the event index";
+     }
+
      //
      // Loop over events in current file
      //
 
      for(Long64_t iev = 0; iev < nmax; iev++) {
+       if(index_tree) {
+         index_tree->GetEntry(iev);
+         if(!AcceptEvent(index)) continue;
+       }
        ghep_tree->GetEntry(iev);
        NtpMCRecHeader rec_header = mcrec->hdr;
        EventRecord &  event      = *(mcrec->event);
        LOG("gevpick", pDEBUG) << rec_header;
        LOG("gevpick", pDEBUG) << event;
-       if(AcceptEvent(event)) {
+       if(index_tree || AcceptEvent(event)) {
           brOrigFilename->SetString(chEl->GetTitle());
           brOrigEvtNum = iev;
           EventRecord * event_copy = new EventRecord(event);
@@ -274,73 +294,32 @@ bool AcceptEvent(const EventRecord & event)
   if ( gPickedTopology == kPtAll       ) return true;
   if ( gPickedTopology == kPtUndefined ) return false;
 
-  const Interaction * interaction = event.Summary();
+  NtpEventIndex summary;
+  summary.Fill(0, event);
+
+  return AcceptEvent(summary);
+}
+//____________________________________________________________________________________
+bool AcceptEvent(const NtpEventIndex & summary)
+{
+  if ( gPickedTopology == kPtAll       ) return true;
+  if ( gPickedTopology == kPtUndefined ) return false;
 
-  int  nupdg     = event.Probe()->Pdg();
+  int  nupdg     = summary.probe;
   bool isnumu    = (nupdg == kPdgNuMu);
   bool isnumubar = (nupdg == kPdgAntiNuMu);
-  bool iscc      = interaction->ProcInfo().IsWeakCC();
-  bool isnc      = interaction->ProcInfo().IsWeakNC();
-
-  int NfP        = 0; // number of protons         in final state
-  int NfPbar     = 0; // number of anti-protons    in final state
-  int NfN        = 0; // number of neutrons        in final state
-  int NfNbar     = 0; // number of anti-neutrons   in final state
-  int NfPip      = 0; // number of \pi^+'s         in final state
-  int NfPim      = 0; // number of \pi^-'s         in final state
-  int NfPi0      = 0; // number of \pi^0's         in final state
-  int NfKp       = 0; // number of \K^+'s          in final state
-  int NfKm       = 0; // number of \K^-'s          in final state
-  int NfK0       = 0; // number of \K^0's          in final state
-  int NfK0bar    = 0; // number of \bar{\K^0}'s    in final state
-  int NfSigmap   = 0; // number of \Sigma^+'s      in final state
-  int NfSigma0   = 0; // number of \Sigma^0's      in final state
-  int NfSigmam   = 0; // number of \Sigma^-'s      in final state
-  int NfLambda0  = 0; // number of \Lambda^0's     in final state
-  int NfXi0      = 0; // number of \Xi^0's         in final state
-  int NfXim      = 0; // number of \Xi^-'s         in final state
-  int NfOmegam   = 0; // number of \Omega^-'s      in final state
-  int NfOther    = 0; // number of other particles in final state
-
-  TObjArrayIter piter(&event);
-  GHepParticle * p = 0;
-  int ip=-1;
-  while( (p = (GHepParticle *) piter.Next())) {
-    ip++;
-    int pdgc = p->Pdg();
-    int ist  = p->Status();
-    // only final state particles
-    if(ist!=kIStStableFinalState) continue;
-    // don't count final state lepton as part of the hadronic system
-    if(event.Particle(ip)->FirstMother()==0) continue;
-    // skip pseudo-particles
-    if(pdg::IsPseudoParticle(pdgc)) continue;
-    // count ...
-    if      (pdgc == kPdgProton     ) NfP++;
-    else if (pdgc == kPdgAntiProton ) NfPbar++;
-    else if (pdgc == kPdgNeutron    ) NfN++;
-    else if (pdgc == kPdgAntiNeutron) NfNbar++;
-    else if (pdgc == kPdgPiP        ) NfPip++;
-    else if (pdgc == kPdgPiM        ) NfPim++;
-    else if (pdgc == kPdgPi0        ) NfPi0++;
-    else if (pdgc == kPdgKP         ) NfKp++;
-    else if (pdgc == kPdgKM         ) NfKm++;
-    else if (pdgc == kPdgK0         ) NfK0++;
-    else if (pdgc == kPdgAntiK0     ) NfK0bar++;
-    else if (pdgc == kPdgSigmaP     ) NfSigmap++;
-    else if (pdgc == kPdgSigma0     ) NfSigma0++;
-    else if (pdgc == kPdgSigmaM     ) NfSigmam++;
-    else if (pdgc == kPdgLambda     ) NfLambda0++;
-    else if (pdgc == kPdgXi0        ) NfXi0++;
-    else if (pdgc == kPdgXiM        ) NfXim++;
-    else if (pdgc == kPdgOmegaM     ) NfOmegam++;
-    else                              NfOther++;
-  }
+  bool iscc      = (summary.proc == kIntWeakCC);
+  bool isnc      = (summary.proc == kIntWeakNC);
+
+  // final state multiplicities, excluding the primary lepton
+  int NfPip      = summary.nfpip;
+  int NfPim      = summary.nfpim;
+  int NfPi0      = summary.nfpi0;
 
   bool is1pipX  = (NfPip==1 && NfPi0==0 && NfPim==0);
   bool is1pi0X  = (NfPip==0 && NfPi0==1 && NfPim==0);
   bool is1pimX  = (NfPip==0 && NfPi0==0 && NfPim==1);
-  bool has_hype = (NfSigmap+NfSigma0+NfSigmam+NfLambda0+NfXi0+NfXim+NfOmegam > 0);
+  bool has_hype = (summary.nfhyp > 0);
 
   if ( gPickedTopology == kPtNumuCC1pip ) {
     if(isnumu && iscc && is1pipX) return true;
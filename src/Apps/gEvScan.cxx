@@ -13,6 +13,7 @@
             [--add-event-printout-in-error-log]
             [--max-num-of-errors-shown n]
             [--event-record-print-level level]
+            [-j nworkers]
             [--check-energy-momentum-conservation]
             [--check-charge-conservation]
             [--check-for-pseudoparticles-in-final-state]
@@ -22,6 +23,12 @@
             [--check-decayer-consistency]
             [--all]
 
+         With -j, the selected events are split in nworkers contiguous entry
+         ranges, scanned in parallel by worker processes. The per-worker error
+         logs, vertex distributions and particle lists are merged at the end,
+         so the error log is the same as in a serial scan (except that the
+         --max-num-of-errors-shown limit applies to each worker).
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -35,6 +42,7 @@
 
 //#define __debug__
 
+#include <cassert>
 #include <string>
 #include <vector>
 #include <iomanip>
@@ -45,6 +53,7 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TH1D.h>
+#include <TVectorD.h>
 #include <TLorentzVector.h>
 
 #include "Framework/Conventions/Constants.h"
@@ -61,6 +70,7 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/SystemUtils.h"
 
 using std::ostringstream;
 using std::ofstream;
@@ -87,6 +97,44 @@ void CheckForOffMassShellParticlesInFinState (void);
 void CheckForNumFinStateNucleonsInconsistentWithTarget (void);
 void CheckVertexDistribution (void);
 void CheckDecayerConsistency (void);
+void EvaluateVertexDistribution (void);
+void EvaluateDecayerConsistency (void);
+
+// serial / parallel scanning
+void   OpenErrLog     (void);
+void   RunChecks      (void);
+bool   CheckEnabled   (int icheck);
+void   BeginCheck     (int icheck);
+void   EndCheck       (int icheck, int nerr);
+void   ScanChunk      (int ichunk, int nchunks, Long64_t first, Long64_t last, void *);
+void   ScanInParallel (void);
+void   MergeChunks    (int nchunks);
+string ChunkFilename  (int ichunk, int icheck = -1);
+
+// checks listing failing events in the error log
+typedef enum EGEvScanCheck {
+  kChkEnergyMomentum = 0,
+  kChkCharge,
+  kChkPseudoParticles,
+  kChkOffMassShell,
+  kChkNumFinStateNucleons,
+  kNEventListChecks
+} GEvScanCheck_t;
+
+const char * kCheckTitle[kNEventListChecks] = {
+  "# Events failing the energy-momentum conservation test:",
+  "# Events failing the charge conservation test:",
+  "# Events with pseudo-particles in final state:",
+  "# Events with off-mass-shell particles in final state:",
+  "# Events with number of final state nucleons inconsistent with target:"
+};
+const char * kCheckSummary[kNEventListChecks] = {
+  "events failing the energy/momentum conservation test",
+  "events failing the charge conservation test",
+  "events with pseudo-particles in final state",
+  "events with off-mass-shell particles in final state",
+  "events with a number of final state nucleons inconsistent with target"
+};
 
 // options
 string   gOptInpFilename = "";
@@ -102,6 +150,7 @@ bool     gOptCheckForOffMassShellParticlesInFinState = false;
 bool     gOptCheckForNumFinStateNucleonsInconsistentWithTarget = false;
 bool     gOptCheckVertexDistribution = false;
 bool     gOptCheckDecayerConsistency = false;
+int      gOptNWorkers = 1;
 
 Long64_t gFirstEventNum = -1;
 Long64_t gLastEventNum  = -1;
@@ -110,6 +159,16 @@ TTree *            gEventTree = 0;
 NtpMCEventRecord * gMCRec = 0;
 ofstream           gErrLog;
 
+// check results (per worker in parallel mode)
+int          gChunk = -1;         ///< worker chunk number, -1 if not a worker
+string       gChunkBase = "";     ///< base name of per-chunk scratch files
+int          gNErr[kNEventListChecks] = {0};
+TH1D *       gVtxDistrMC = 0;
+int          gVtxZ = -1;
+int          gVtxA = -1;
+PDGCodeList  gFinStateParticles(false);
+PDGCodeList  gDecayedParticles(false);
+
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -152,20 +211,41 @@ int main(int argc, char ** argv)
     }
   }
 
-  
+
   if(gOptOutFilename.size() == 0) {
      ostringstream logfile;
      logfile << gOptInpFilename << ".errlog";
      gOptOutFilename = logfile.str();
   }
+
+  Long64_t nentries = gLastEventNum - gFirstEventNum + 1;
+  if(gOptNWorkers > 1 && nentries > 1) {
+    ScanInParallel();
+  } else {
+    OpenErrLog();
+    RunChecks();
+  }
+
   if(gOptOutFilename != "none") {
-     gErrLog.open(gOptOutFilename.c_str());
-     gErrLog << "# ..................................................................................." << endl;
-     gErrLog << "# Error log for event file " << gOptInpFilename << endl;
-     gErrLog << "# ..................................................................................." << endl;
-     gErrLog << "# " << endl;
+     gErrLog.close();
   }
 
+  return 0;
+}
+//____________________________________________________________________________
+void OpenErrLog(void)
+{
+  if(gOptOutFilename == "none") return;
+
+  gErrLog.open(gOptOutFilename.c_str());
+  gErrLog << "# ..................................................................................." << endl;
+  gErrLog << "# Error log for event file " << gOptInpFilename << endl;
+  gErrLog << "# ..................................................................................." << endl;
+  gErrLog << "# " << endl;
+}
+//____________________________________________________________________________
+void RunChecks(void)
+{
   if (gOptCheckEnergyMomentumConservation) {
 	  CheckEnergyMomentumConservation();
   }
@@ -187,23 +267,258 @@ int main(int argc, char ** argv)
   if (gOptCheckDecayerConsistency) {
           CheckDecayerConsistency();
   }
+}
+//____________________________________________________________________________
+bool CheckEnabled(int icheck)
+{
+  switch(icheck) {
+    case (kChkEnergyMomentum)      : return gOptCheckEnergyMomentumConservation;
+    case (kChkCharge)              : return gOptCheckChargeConservation;
+    case (kChkPseudoParticles)     : return gOptCheckForPseudoParticlesInFinState;
+    case (kChkOffMassShell)        : return gOptCheckForOffMassShellParticlesInFinState;
+    case (kChkNumFinStateNucleons) : return gOptCheckForNumFinStateNucleonsInconsistentWithTarget;
+    default : break;
+  }
+  return false;
+}
+//____________________________________________________________________________
+void BeginCheck(int icheck)
+{
+// Starts the error log section of the input check. Workers write the events
+// failing the check in a per-chunk file, merged in MergeChunks()
 
+  if(gOptOutFilename == "none") return;
 
-  if(gOptOutFilename != "none") {
-     gErrLog.close();
+  if(gChunk < 0) {
+    gErrLog << kCheckTitle[icheck] << endl;
+    gErrLog << "# " << endl;
+  } else {
+    gErrLog.open(ChunkFilename(gChunk, icheck).c_str());
   }
+}
+//____________________________________________________________________________
+void EndCheck(int icheck, int nerr)
+{
+  gNErr[icheck] = nerr;
 
-  return 0;
+  if(gOptOutFilename == "none") return;
+
+  if(gChunk < 0) {
+    if(nerr == 0) {
+       gErrLog << "none" << endl;
+    }
+  } else {
+    gErrLog.close();
+  }
+}
+//____________________________________________________________________________
+void ScanChunk(int ichunk, int /*nchunks*/, Long64_t first, Long64_t last, void *)
+{
+// Runs all requested checks over the entries [first, last) in a worker
+// process, and saves the per-chunk results (error counts, vertex
+// distribution, particle lists) for MergeChunks()
+
+  gChunk         = ichunk;
+  gFirstEventNum = first;
+  gLastEventNum  = last - 1;
+
+  // the input file is re-opened so that workers do not share a file offset
+  TFile file(gOptInpFilename.c_str(),"READ");
+  gEventTree = dynamic_cast <TTree *> (file.Get("gtree"));
+  gMCRec     = 0;
+  gEventTree->SetBranchAddress("gmcrec", &gMCRec);
+
+  RunChecks();
+
+  TFile results(ChunkFilename(ichunk).c_str(),"RECREATE");
+
+  TVectorD nerr(kNEventListChecks);
+  for(int icheck = 0; icheck < kNEventListChecks; icheck++) {
+    nerr[icheck] = gNErr[icheck];
+  }
+  nerr.Write("nerr");
+
+  if(gVtxDistrMC) {
+    TVectorD target(2);
+    target[0] = gVtxZ;
+    target[1] = gVtxA;
+    target.Write("vtx_target");
+    gVtxDistrMC->Write("r_distr_mc");
+  }
+
+  TVectorD fs (gFinStateParticles.size());
+  TVectorD dec(gDecayedParticles.size());
+  for(unsigned int i = 0; i < gFinStateParticles.size(); i++) {
+    fs[i] = gFinStateParticles[i];
+  }
+  for(unsigned int i = 0; i < gDecayedParticles.size(); i++) {
+    dec[i] = gDecayedParticles[i];
+  }
+  fs.Write("fs_particles");
+  dec.Write("decayed_particles");
+
+  results.Close();
+  file.Close();
+}
+//____________________________________________________________________________
+void ScanInParallel(void)
+{
+// Splits the selected entries in contiguous ranges, scanned by forked worker
+// processes (the GENIE singletons and the ROOT objects used are not
+// thread-safe). The per-chunk results are merged when all workers are done
+
+  Long64_t nev = gLastEventNum - gFirstEventNum + 1;
+
+  LOG("gevscan", pNOTICE)
+    << "*** Scanning " << nev << " events using " << gOptNWorkers << " workers";
+
+  ostringstream base;
+  base << gSystem->TempDirectory() << "/gevscan_" << gSystem->GetPid();
+  gChunkBase = base.str();
+
+  int nchunks = utils::system::RunInWorkerProcesses(
+                   gOptNWorkers, gFirstEventNum, gLastEventNum+1, ScanChunk);
+  if(nchunks < 0) {
+    LOG("gevscan", pFATAL) << "A scanning worker did not complete";
+    gAbortingInErr = true;
+    exit(5);
+  }
+
+  // the error log is opened after forking, so that the workers do not
+  // inherit (and flush) its buffer
+  OpenErrLog();
+  MergeChunks(nchunks);
+
+  for(int ichunk = 0; ichunk < nchunks; ichunk++) {
+    gSystem->Unlink(ChunkFilename(ichunk).c_str());
+    for(int icheck = 0; icheck < kNEventListChecks; icheck++) {
+      gSystem->Unlink(ChunkFilename(ichunk, icheck).c_str());
+    }
+  }
+}
+//____________________________________________________________________________
+void MergeChunks(int nchunks)
+{
+// Merges the per-chunk results, in entry order, and writes the error log
+// as in a serial scan
+
+  vector< vector<int> > nerr_chunk(kNEventListChecks, vector<int>(nchunks, 0));
+  for(int icheck = 0; icheck < kNEventListChecks; icheck++) {
+    gNErr[icheck] = 0;
+  }
+
+  for(int ichunk = 0; ichunk < nchunks; ichunk++) {
+    TFile results(ChunkFilename(ichunk).c_str(),"READ");
+
+    TVectorD * nerr = dynamic_cast<TVectorD *> (results.Get("nerr"));
+    assert(nerr);
+    for(int icheck = 0; icheck < kNEventListChecks; icheck++) {
+      nerr_chunk[icheck][ichunk] = (int) (*nerr)[icheck];
+      gNErr[icheck] += nerr_chunk[icheck][ichunk];
+    }
+
+    // vertex distributions are merged for workers which saw the same
+    // target nucleus first
+    TVectorD * target = dynamic_cast<TVectorD *> (results.Get("vtx_target"));
+    TH1D *     r_mc   = dynamic_cast<TH1D *>     (results.Get("r_distr_mc"));
+    if(target && r_mc) {
+      int Z = (int) (*target)[0];
+      int A = (int) (*target)[1];
+      if(!gVtxDistrMC) {
+        gVtxDistrMC = (TH1D *) r_mc->Clone();
+        gVtxDistrMC->SetDirectory(0);
+        gVtxDistrMC->Reset();
+      }
+      if(gVtxZ == -1 && gVtxA == -1) {
+        gVtxZ = Z;
+        gVtxA = A;
+      }
+      if(Z == gVtxZ && A == gVtxA) {
+        gVtxDistrMC->Add(r_mc);
+      }
+    }
+
+    TVectorD * fs  = dynamic_cast<TVectorD *> (results.Get("fs_particles"));
+    TVectorD * dec = dynamic_cast<TVectorD *> (results.Get("decayed_particles"));
+    if(fs) {
+      for(int i = 0; i < fs->GetNrows(); i++) {
+        gFinStateParticles.push_back( (int) (*fs)[i] );
+      }
+    }
+    if(dec) {
+      for(int i = 0; i < dec->GetNrows(); i++) {
+        gDecayedParticles.push_back( (int) (*dec)[i] );
+      }
+    }
+    results.Close();
+  }
+
+  // event list checks: per-chunk error logs are concatenated in order
+  for(int icheck = 0; icheck < kNEventListChecks; icheck++) {
+    if(!CheckEnabled(icheck)) continue;
+
+    if(gErrLog.is_open()) {
+      gErrLog << kCheckTitle[icheck] << endl;
+      gErrLog << "# " << endl;
+      int nshown = 0;
+      for(int ichunk = 0; ichunk < nchunks; ichunk++) {
+        if(gOptMaxNumErrs != -1 && nshown >= gOptMaxNumErrs) break;
+        if(nerr_chunk[icheck][ichunk] == 0) continue;
+        std::ifstream chunk(ChunkFilename(ichunk, icheck).c_str(), ios::in | ios::binary);
+        gErrLog << chunk.rdbuf();
+        nshown += nerr_chunk[icheck][ichunk];
+      }
+      if(gNErr[icheck] == 0) {
+        gErrLog << "none" << endl;
+      }
+    }
+
+    LOG("gevscan", pNOTICE)
+       << "Found " << gNErr[icheck] << " "
+       << kCheckSummary[icheck] << " (all workers)";
+  }
+
+  if(gOptCheckVertexDistribution) {
+    LOG("gevscan", pNOTICE)
+       << "Checking merged intra-nuclear vertex distribution...";
+    if(gErrLog.is_open()) {
+      gErrLog << "# Intranuclear vertex distribution check:" << endl;
+      gErrLog << "# " << endl;
+    }
+    EvaluateVertexDistribution();
+  }
+
+  if(gOptCheckDecayerConsistency) {
+    LOG("gevscan", pNOTICE)
+       << "Checking merged decayer consistency...";
+    if(gErrLog.is_open()) {
+      gErrLog << "# Decayer consistency check:" << endl;
+      gErrLog << "# " << endl;
+    }
+    EvaluateDecayerConsistency();
+  }
+}
+//____________________________________________________________________________
+string ChunkFilename(int ichunk, int icheck)
+{
+// Per-chunk scratch files: the worker results (icheck < 0) or the error log
+// section of an event list check
+
+  ostringstream name;
+  name << gChunkBase << ".chunk" << ichunk;
+  if(icheck < 0) {
+    name << ".root";
+  } else {
+    name << ".check" << icheck << ".errlog";
+  }
+  return name.str();
 }
 //____________________________________________________________________________
 void CheckEnergyMomentumConservation (void)
 {
   LOG("gevscan", pNOTICE) << "Checking energy/momentum conservation...";
 
-  if(gErrLog.is_open()) {
-    gErrLog << "# Events failing the energy-momentum conservation test:" << endl;
-    gErrLog << "# " << endl;
-  }
+  BeginCheck(kChkEnergyMomentum);
 
   int nerr = 0;
 
@@ -264,7 +579,7 @@ void CheckEnergyMomentumConservation (void)
          << "\n"
          << event;
        if(gErrLog.is_open()) {
-           gErrLog << i;
+           gErrLog << i << endl;
            if(gOptAddEventPrintoutInErrLog) {
                gErrLog << event;
            }
@@ -276,11 +591,7 @@ void CheckEnergyMomentumConservation (void)
 
   }//i
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-         gErrLog << "none" << endl;    
-     }
-  }
+  EndCheck(kChkEnergyMomentum, nerr);
 
   LOG("gevscan", pNOTICE) 
      << "Found " << nerr 
@@ -291,10 +602,7 @@ void CheckChargeConservation(void)
 {
   LOG("gevscan", pNOTICE) << "Checking charge conservation...";
 
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events failing the charge conservation test:" << endl;
-     gErrLog << "# " << endl;
-  }
+  BeginCheck(kChkCharge);
 
   int nerr = 0;
 
@@ -359,11 +667,7 @@ void CheckChargeConservation(void)
     gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
   }//i
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
-  }
+  EndCheck(kChkCharge, nerr);
 
   LOG("gevscan", pNOTICE) 
      << "Found " << nerr 
@@ -375,10 +679,7 @@ void CheckForPseudoParticlesInFinState(void)
   LOG("gevscan", pNOTICE) 
       << "Checking for pseudo-particles appearing in final state...";
 
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events with pseudo-particles in final state:" << endl;
-     gErrLog << "# " << endl;
-  }
+  BeginCheck(kChkPseudoParticles);
 
   int nerr = 0;
 
@@ -426,11 +727,7 @@ void CheckForPseudoParticlesInFinState(void)
 
   }//i
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
-  }
+  EndCheck(kChkPseudoParticles, nerr);
 
   LOG("gevscan", pNOTICE) 
      << "Found " << nerr 
@@ -442,10 +739,7 @@ void CheckForOffMassShellParticlesInFinState(void)
   LOG("gevscan", pNOTICE) 
       << "Checking for off-mass-shell particles appearing in the final state...";
 
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events with off-mass-shell particles in final state:" << endl;
-     gErrLog << "# " << endl;
-  }
+  BeginCheck(kChkOffMassShell);
 
   int nerr = 0;
 
@@ -492,11 +786,7 @@ void CheckForOffMassShellParticlesInFinState(void)
 
   }//i
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
-  }
+  EndCheck(kChkOffMassShell, nerr);
 
   LOG("gevscan", pNOTICE) 
      << "Found " << nerr 
@@ -508,10 +798,7 @@ void CheckForNumFinStateNucleonsInconsistentWithTarget(void)
   LOG("gevscan", pNOTICE) 
      << "Checking for number of final state nucleons inconsistent with target...";
 
-  if(gErrLog.is_open()) {
-    gErrLog << "# Events with number of final state nucleons inconsistent with target:" << endl;
-    gErrLog << "# " << endl;
-  }
+  BeginCheck(kChkNumFinStateNucleons);
 
   int nerr = 0;
 
@@ -598,11 +885,7 @@ void CheckForNumFinStateNucleonsInconsistentWithTarget(void)
   }//i
 
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-         gErrLog << "none" << endl;    
-     }
-  }
+  EndCheck(kChkNumFinStateNucleons, nerr);
 
   LOG("gevscan", pNOTICE) 
      << "Found " << nerr 
@@ -619,11 +902,8 @@ void CheckVertexDistribution(void)
     gErrLog << "# " << endl;
   }
 
-  TH1D * r_distr_mc       = new TH1D("r_distr_mc","",      150,0,30); //fm
-  TH1D * r_distr_expected = new TH1D("r_distr_expected","",150,0,30); //fm
-
-  int Z = -1;
-  int A = -1;
+  gVtxDistrMC = new TH1D("r_distr_mc","",150,0,30); //fm
+  gVtxDistrMC->SetDirectory(0);
 
   // get vertex position distribution
   for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
@@ -642,13 +922,13 @@ void CheckVertexDistribution(void)
            << "Event not in nuclear target - Skipping...";
     }
     else {
-      if(Z == -1 && A == -1) {
-         Z = nucltgt->Z();
-         A = nucltgt->A();
+      if(gVtxZ == -1 && gVtxA == -1) {
+         gVtxZ = nucltgt->Z();
+         gVtxA = nucltgt->A();
       }
 
       // this test is run on a MC sample for a given target
-      if(Z != nucltgt->Z() || A != nucltgt->A()) {
+      if(gVtxZ != nucltgt->Z() || gVtxA != nucltgt->A()) {
         LOG("gevscan", pINFO)
              << "Event not in nuclear target seen first - Skipping...";
       }
@@ -656,7 +936,7 @@ void CheckVertexDistribution(void)
         GHepParticle * probe = event.Particle(0);
         double r = probe->X4()->Vect().Mag();
 
-        r_distr_mc->Fill(r);
+        gVtxDistrMC->Fill(r);
       }
     } //nucltgt
 
@@ -664,8 +944,22 @@ void CheckVertexDistribution(void)
 
   }//i
 
+  // in parallel mode, the distributions filled by the workers are merged
+  // and compared with the expected one at the end (see MergeChunks())
+  if(gChunk < 0) {
+    EvaluateVertexDistribution();
+  }
+}
+//____________________________________________________________________________
+void EvaluateVertexDistribution(void)
+{
+  int A = gVtxA;
+  TH1D * r_distr_mc = gVtxDistrMC;
+
   if(A > 1) {
     // get expected vertex position distribution
+    TH1D * r_distr_expected = new TH1D("r_distr_expected","",150,0,30); //fm
+    r_distr_expected->SetDirectory(0);
     for(int ir = 1; ir <= r_distr_expected->GetNbinsX(); ir++) {
       double r = r_distr_expected->GetBinCenter(ir);
       double rho  = utils::nuclear::Density(r,A);
@@ -696,6 +990,7 @@ void CheckVertexDistribution(void)
     f.Close();
 #endif
 
+    delete r_distr_expected;
   }//A
   else {
 
@@ -724,9 +1019,8 @@ void CheckDecayerConsistency(void)
     gErrLog << "# " << endl;
   }
 
-  bool allowdup = false;
-  PDGCodeList final_state_particles(allowdup);
-  PDGCodeList decayed_particles(allowdup);
+  PDGCodeList & final_state_particles = gFinStateParticles;
+  PDGCodeList & decayed_particles     = gDecayedParticles;
 
   for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
   {
@@ -748,6 +1042,19 @@ void CheckDecayerConsistency(void)
     gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
   }//i
 
+  // in parallel mode, the particle lists compiled by the workers are merged
+  // and checked at the end (see MergeChunks())
+  if(gChunk < 0) {
+    EvaluateDecayerConsistency();
+  }
+}
+//____________________________________________________________________________
+void EvaluateDecayerConsistency(void)
+{
+  bool allowdup = false;
+  const PDGCodeList & final_state_particles = gFinStateParticles;
+  const PDGCodeList & decayed_particles     = gDecayedParticles;
+
   // find particles which appear in both lists
   PDGCodeList particles_in_both_lists(allowdup);
 
@@ -897,6 +1204,11 @@ void GetCommandLineArgs(int argc, char ** argv)
      gOptMaxNumErrs = TMath::Max(1,gOptMaxNumErrs);
   }
   
+  // number of worker processes
+  if( parser.OptionExists('j') ) {
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt('j'));
+  }
+
   bool all = parser.OptionExists("all");
 
   // checks
@@ -920,7 +1232,7 @@ void PrintSyntax(void)
 {
   LOG("gevscan", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << " gevscan -f sample.root [-n n1[,n2]] [-o errlog] [check names]\n";
+    << " gevscan -f sample.root [-n n1[,n2]] [-o errlog] [-j nworkers] [check names]\n";
 }
 //_________________________________________________________________________________
 bool CheckRootFilename(string filename)
@@ -38,6 +38,15 @@
                        [-z zmin]
                        [-d debug flags]
                        [--seed random_number_seed]
+                       [--shard i/N]
+                       [--checkpoint-interval nev]
+                       [--restart]
+                       [--async-output]
+                       [--flux-read-ahead cache_MB[,n_entries]]
+                       [--path-length-cache max_rays]
+                       [--channel-bias channel:factor,...]
+                       [--event-filter name/config]
+                       [--memory-report]
                         --cross-sections xml_file
                        [--event-generator-list list_name]
                        [--tune genie_tune]
@@ -191,6 +200,9 @@
               Only used with ROOTGeomAnalyzer & { GNuMIFlux, GSimpleNtpFlux, GDk2NuFlux }
               +N  Use flux to scan geometry for max path length
               -N  Use N rays x N points on each face of a box
+              The max path lengths are cached per user (see ROOTGeomAnalyzer)
+              and reused by later jobs with the same geometry, fiducial cut,
+              flux & location and scanning options
            -z
               Z from which to start flux ray in user world coordinates
               Only use with ROOTGeomAnalyzer & { GNuMIFlux, GSimpleNtpFlux, GDk2NuFlux }
@@ -206,6 +218,56 @@
               This cmd line arguments lets you override 'gntp'
            --seed
               Random number seed.
+           --shard
+              Runs job i of a production split in N jobs (given as i/N, with
+              0 <= i < N). Each job uses a random number seed derived from
+              --seed (or the default seed) and i, and the i-th of N contiguous
+              ranges of the flux ntuple entries, so that the jobs are
+              independent and reproducible. The -n / -e statistics apply to
+              each job. The job outputs can be merged with gmerge, which
+              combines the normalization stored in the tree headers.
+           --checkpoint-interval
+              Writes a checkpoint every `nev' events: the events generated so
+              far are saved in the output file, along with the state of the
+              random number generators, the position in the flux ntuple(s)
+              and the normalization counters. Also written when the job is
+              ended with SIGTERM.
+           --restart
+              Restarts an interrupted job (run with the same options) from
+              its last checkpoint, in its output file. The restarted job
+              generates the same events as an uninterrupted one.
+           --async-output
+              Writes the events from a writer thread, overlapping the output
+              with the event generation. Falls back to synchronous writing
+              when flux pass-through branches are added to the event tree.
+           --flux-read-ahead
+              Size (in MB) of the read cache of the flux ntuples, optionally
+              followed by the number of flux entries decoded ahead on a
+              reader thread (eg 100,1000). Useful for flux files on network
+              storage. Only used by the flux drivers supporting it.
+           --path-length-cache
+              Caches the path lengths of (at most) `max_rays' flux rays, so
+              that the geometry is navigated only once for each ray when the
+              flux ntuple is cycled or its entries are re-used. Only used
+              with GSimpleNtpFlux (whose entries are fixed rays).
+           --channel-bias
+              Oversamples the listed channels (scattering types such as COH,
+              DFR, NuEEL, IMD, GLR, or charm) by the given factors, eg
+              COH:10,DFR:10,charm:50. The events are weighted (see
+              GHepRecord::Weight()) so that the sample normalization is
+              unchanged, and the effective POT of each channel is printed at
+              the end of the job.
+           --event-filter
+              Keeps only the events accepted by the given EventFilterI
+              algorithm & configuration, eg
+              genie::PrimaryLeptonFilter/MuonAbove1GeV. The filter is run
+              before the hadron transport, so the rejected events cost little.
+              The POT is unchanged and the accept fraction is stored in the
+              output tree header.
+           --memory-report
+              Prints the memory held by the GENIE singletons and physics
+              tables, per category, after the initialization and at the end
+              of the job.
            --cross-sections
               Name (incl. full path) of an XML file with pre-computed
               cross-section values used for constructing splines.
@@ -273,7 +335,6 @@
 
 #include <cassert>
 #include <cstdlib>
-#include <csignal>
 
 #include <string>
 #include <sstream>
@@ -281,6 +342,7 @@
 #include <map>
 #include <algorithm>  // for transform()
 #include <fstream>
+#include <iomanip>
 
 #include <TSystem.h>
 #include <TError.h>  // for gErrorIgnoreLevel
@@ -295,10 +357,11 @@
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
-#include "Framework/EventGen/GMCJMonitor.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpMCJob.h"
+#include "Framework/Ntuple/NtpMCCheckpoint.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGCodeList.h"
@@ -355,6 +418,24 @@ void DetermineFluxDriver(string fopt);
 void ParseFluxHst       (string fopt);
 void ParseFluxFileConfig(string fopt);
 
+// The gevgen_fnal specifics of the event generation loop: pass-through flux
+// branches, POT normalization & position in the flux ntuples (see NtpMCJob)
+class FNALMCJob : public NtpMCJob {
+public:
+  FNALMCJob(GFluxI * flux_driver);
+
+protected:
+  void   AddBranches      (NtpWriter & ntpw);
+  double Exposure         (void) const;
+  bool   SaveFluxState    (NtpMCCheckpoint & checkpoint) const;
+  bool   RestoreFluxState (const NtpMCCheckpoint & checkpoint);
+  void   Finalize         (NtpWriter & ntpw, long int nev);
+
+private:
+  genie::flux::GFluxExposureI *   fFluxExposureI;
+  genie::flux::GFluxFileConfigI * fFluxFileConfigI;
+};
+
 // Default options (override them using the command line arguments):
 //
 string          kDefOptGeomLUnits   = "mm";    // default geometry length units
@@ -392,14 +473,6 @@ int             gOptDebug = 0;                 // debug flags
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
 
-bool            gSigTERM = false;              // was TERM signal sent?
-
-static void gsSIGTERMhandler(int /* s */)
-{
-  gSigTERM = true;
-  std::cerr << "Caught SIGTERM" << std::endl;
-}
-
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -521,6 +594,12 @@ int main(int argc, char ** argv)
     //
     // *** Using the detailed ntuple neutrino flux description
     //
+    // use the flux entry range of this job, if the production is split
+    flux_file_config->SetEntryShard(RunOpt::Instance()->Shard(),
+                                    RunOpt::Instance()->NShards());
+    // read the flux entries ahead, if requested (--flux-read-ahead)
+    flux_file_config->SetReadAhead(RunOpt::Instance()->FluxReadAheadCache(),
+                                   RunOpt::Instance()->FluxPrefetch());
     flux_file_config->LoadBeamSimData(gOptFluxFile, gOptDetectorLocation);
     flux_file_config->SetUpstreamZ(gOptZmin);  // was "zmin" from bounding_box
     flux_file_config->SetNumOfCycles(0);
@@ -568,13 +647,6 @@ int main(int argc, char ** argv)
     }
   }
 
-  // these might come in handy ... avoid repeated dynamic_cast<> calls
-  genie::flux::GFluxExposureI* fluxExposureI =
-    dynamic_cast<genie::flux::GFluxExposureI*>(flux_driver);
-  genie::flux::GFluxFileConfigI* fluxFileConfigI =
-    dynamic_cast<genie::flux::GFluxFileConfigI*>(flux_driver);
-
-
   // *************************************************************************
   // * Handle chicken/egg problem: geom analyzer vs. flux.
   // * Need both at this point change geom scan defaults.
@@ -593,6 +665,12 @@ int main(int argc, char ** argv)
         << "Using ROOTGeomAnalyzer: geom scan using flux: nparticles=" << gOptNScan;
       rgeom->SetScannerFlux(flux_driver);
       if ( gOptNScan > 0 ) rgeom->SetScannerNParticles(gOptNScan);
+      // identifies the scanning flux (& window) for the max path length cache
+      std::ostringstream fluxkey;
+      fluxkey << std::setprecision(17)
+              << gOptFluxFile << " location: " << gOptDetectorLocation
+              << " zmin: " << gOptZmin;
+      rgeom->SetScannerFluxKey(fluxkey.str());
     } else {
       int nabs = TMath::Abs(gOptNScan);
       LOG("gevgen_fnal", pNOTICE)
@@ -609,6 +687,9 @@ int main(int argc, char ** argv)
   mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
   mcj_driver->UseFluxDriver(flux_driver);
   mcj_driver->UseGeomAnalyzer(geom_driver);
+  if ( RunOpt::Instance()->PathLengthCache() > 0 ) {
+    mcj_driver->CachePathLengths(RunOpt::Instance()->PathLengthCache());
+  }
   if ( ( gOptExtMaxPlXml != "" ) && ! gOptWriteMaxPlXml ) {
     mcj_driver->UseMaxPathLengths(gOptExtMaxPlXml);
   }
@@ -648,121 +729,113 @@ int main(int argc, char ** argv)
   }
 
   // *************************************************************************
-  // * Prepare for writing the output event tree & status file
+  // * Event generation loop & output (see NtpMCJob)
   // *************************************************************************
 
-  // Initialize an Ntuple Writer to save GHEP records into a TTree
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
-  ntpw.Initialize();
-
-
-  std::vector<TBranch*>    extraBranches;
-  std::vector<std::string> branchNames;
-  std::vector<std::string> branchClassNames;
-  std::vector<void**>      branchObjPointers;
-
-  // Add custom branch(s) to the standard GENIE event tree so that
-  // info on the flux neutrino parent particle can be passed-through
-  if ( fluxFileConfigI ) {
-    fluxFileConfigI->GetBranchInfo(branchNames,branchClassNames,
-                                    branchObjPointers);
-    size_t nn = branchNames.size();
-    size_t nc = branchClassNames.size();
-    size_t np = branchObjPointers.size();
-    if ( nn != nc || nc != np ) {
-     LOG("gevgen_fnal", pERROR)
-       << "Inconsistent info back from \"" << gOptFluxDriver << "\" "
-       << "for branch info:  " << nn << " " << nc << " " << np;
-    } else {
-      for (size_t ii = 0; ii < nn; ++ii) {
-        const char* bname = branchNames[ii].c_str();
-        const char* cname = branchClassNames[ii].c_str();
-        void**&     optr  = branchObjPointers[ii];  // note critical '&' !
-        if ( ! optr || ! *optr ) continue;  // no pointer supplied, skip it
-        int split = 99;  // 1
-        LOG("gevgen_fnal", pNOTICE)
-          << "Adding extra branch \"" << bname << "\" of type \""
-          << cname << "\" (" << optr << ") to output tree";
-        TBranch* bptr = ntpw.EventTree()->Branch(bname,cname,optr,32000,split);
-        extraBranches.push_back(bptr);
-
-        if ( bptr ) {
-          // don't delete this !!! we're sharing
-          bptr->SetAutoDelete(false);
-        } else {
-          LOG("gevgen_fnal", pERROR)
-          << "FAILED to add extra branch \"" << bname << "\" of type \""
-          << cname << "\" to output tree";
-        }
-      } // loop over additions
-    } // same # of entries
-  } // of genie::flux::GFluxFileConfigI type
-
-  // Create a MC job monitor for a periodically updated status file
-  GMCJMonitor mcjmonitor(gOptRunNu);
-  mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+  FNALMCJob job(flux_driver);
+  job.SetFilenamePrefix(gOptEvFilePrefix);
+  job.SetNumOfEvents(gOptNev);
+  job.SetExposure(gOptPOT);
+  job.Run(mcj_driver);
 
   // *************************************************************************
-  // * Event generation loop
+  // * Clean-up
   // *************************************************************************
 
-  // define handler to allow signal to end job gracefully
-  signal(SIGTERM,gsSIGTERMhandler);
-
-  int ievent = 0;
-  while ( ! gSigTERM )
-  {
-     LOG("gevgen_fnal", pINFO)
-          << " *** Generating event............ " << ievent;
-
-     // In case the required statistics was expressed as 'number of events'
-     // then quit if that number has been generated
-     if ( ievent == gOptNev ) break;
-
-     // In case the required statistics was expressed as 'number of POT'
-     // then exit the event loop if the requested POT has been generated.
-     if ( gOptPOT > 0 && fluxExposureI ) {
-        double fpot = fluxExposureI->GetTotalExposure(); // current POTs used
-        double psc  = mcj_driver->GlobProbScale();  // interaction prob. scale
-        double pot  = fpot / psc;                   // POTs for generated sample
-        if ( pot >= gOptPOT ) break;
-     }
+  delete geom_driver;
+  delete flux_driver;
+  delete mcj_driver;
+  // this list should only be histograms that have (for some reason)
+  // not been handed over to the GCylindTH1Flux driver.
+  map<int,TH1D*>::iterator it = gOptFluxHst.begin();
+  for( ; it != gOptFluxHst.end(); ++it) {
+    TH1D * spectrum = it->second;
+    if(spectrum) delete spectrum;
+  }
+  gOptFluxHst.clear();
 
-     // Generate a single event using neutrinos coming from the specified flux
-     // and hitting the specified geometry or target mix
-     EventRecord * event = mcj_driver->GenerateEvent();
+  LOG("gevgen_fnal", pNOTICE) << "Done!";
 
-     // Check whether a null event was returned due to the flux driver reaching
-     // the end of the input flux ntuple - exit the event generation loop
-     if ( ! event && flux_driver->End() ) {
-        LOG("gevgen_fnal", pWARN)
-          << "** The flux driver read all the input flux entries: End()==true";
-        break;
-     }
-     if ( ! event ) {
-         LOG("gevgen_fnal", pERROR)
-             << "Got a null generated neutino event! Retrying ...";
-         continue;
-     }
-     LOG("gevgen_fnal", pINFO)
-         << "Generated event: " << *event;
+  return 0;
+}
 
-     // A valid event was generated: flux info (parent decay/prod
-     // position/kinematics) for that simulated event should already
-     // be connected to the right output tree branch
+//____________________________________________________________________________
+FNALMCJob::FNALMCJob(GFluxI * flux_driver) :
+NtpMCJob("gevgen_fnal", kDefOptNtpFormat, gOptRunNu)
+{
+  fFluxExposureI   = dynamic_cast<genie::flux::GFluxExposureI*>(flux_driver);
+  fFluxFileConfigI = dynamic_cast<genie::flux::GFluxFileConfigI*>(flux_driver);
+}
+//____________________________________________________________________________
+void FNALMCJob::AddBranches(NtpWriter & ntpw)
+{
+  if ( ! fFluxFileConfigI ) return;
 
-     // Add event at the output ntuple, refresh the mc job monitor & clean-up
-     ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
-     delete event;
-     ievent++;
+  std::vector<std::string> branchNames;
+  std::vector<std::string> branchClassNames;
+  std::vector<void**>      branchObjPointers;
 
-  } //1
+  // Add custom branch(s) to the standard GENIE event tree so that
+  // info on the flux neutrino parent particle can be passed-through
+  fFluxFileConfigI->GetBranchInfo(branchNames,branchClassNames,
+                                  branchObjPointers);
+  size_t nn = branchNames.size();
+  size_t nc = branchClassNames.size();
+  size_t np = branchObjPointers.size();
+  if ( nn != nc || nc != np ) {
+    LOG("gevgen_fnal", pERROR)
+      << "Inconsistent info back from \"" << gOptFluxDriver << "\" "
+      << "for branch info:  " << nn << " " << nc << " " << np;
+    return;
+  }
+  for (size_t ii = 0; ii < nn; ++ii) {
+    const char* bname = branchNames[ii].c_str();
+    const char* cname = branchClassNames[ii].c_str();
+    void**&     optr  = branchObjPointers[ii];  // note critical '&' !
+    if ( ! optr || ! *optr ) continue;  // no pointer supplied, skip it
+    int split = 99;  // 1
+    LOG("gevgen_fnal", pNOTICE)
+      << "Adding extra branch \"" << bname << "\" of type \""
+      << cname << "\" (" << optr << ") to output tree";
+    TBranch* bptr = ntpw.EventTree()->Branch(bname,cname,optr,32000,split);
 
+    if ( bptr ) {
+      // don't delete this !!! we're sharing
+      bptr->SetAutoDelete(false);
+    } else {
+      LOG("gevgen_fnal", pERROR)
+        << "FAILED to add extra branch \"" << bname << "\" of type \""
+        << cname << "\" to output tree";
+    }
+  } // loop over additions
+}
+//____________________________________________________________________________
+double FNALMCJob::Exposure(void) const
+{
+  // current POTs used
+  return ( fFluxExposureI ) ? fFluxExposureI->GetTotalExposure() : -1;
+}
+//____________________________________________________________________________
+bool FNALMCJob::SaveFluxState(NtpMCCheckpoint & checkpoint) const
+{
+  if ( ! fFluxFileConfigI ) return false;
+  return fFluxFileConfigI->GetFluxCursor(checkpoint.fluxcounters,
+                                         checkpoint.fluxsums);
+}
+//____________________________________________________________________________
+bool FNALMCJob::RestoreFluxState(const NtpMCCheckpoint & checkpoint)
+{
+  if ( ! fFluxFileConfigI ) return true;
+  return checkpoint.hasfluxcursor &&
+    fFluxFileConfigI->SetFluxCursor(checkpoint.fluxcounters,
+                                    checkpoint.fluxsums);
+}
+//____________________________________________________________________________
+void FNALMCJob::Finalize(NtpWriter & ntpw, long int nev)
+{
   // Copy metadata tree, if available
-  if ( fluxFileConfigI ) {
-    TTree* t1 = fluxFileConfigI->GetMetaDataTree();
+  if ( fFluxFileConfigI ) {
+    TTree* t1 = fFluxFileConfigI->GetMetaDataTree();
     if ( t1 ) {
       size_t nmeta = t1->GetEntries();
       TTree* t2 = (TTree*)t1->Clone(0);
@@ -774,79 +847,43 @@ int main(int argc, char ** argv)
     }
   }
 
-  LOG("gevgen_fnal", pINFO)
-    << "The GENIE MC job is done generating events - Cleaning up & exiting...";
-
-  // *************************************************************************
-  // * Print job statistics &
-  // * calculate normalization factor for the generated sample
-  // *************************************************************************
-  if ( ! gOptUsingHistFlux && gOptUsingRootGeom ) {
-    // POT normalization will only be calculated if event generation was based
-    // on beam simulation ntuples (not just histograms) & a detailed detector
-    // geometry description.
-    // Get nunber of flux neutrinos read-in by flux driver, number of flux
-    // neutrinos actually thrown to the event generation driver and number
-    // of neutrino interactions actually generated
-    long int nflx     = 0;
-    long int nflx_evg = mcj_driver-> NFluxNeutrinos();
-    double   fpot     = 0;
-    const char* exposureUnits = "(unknown units)";
-    if ( fluxExposureI ) {
-      fpot = fluxExposureI->GetTotalExposure(); // POTs used so far
-      nflx = fluxExposureI->NFluxNeutrinos();
-      //genie::flux::Exposure_t etype = fluxExposureI->GetExposureType();
-      //exposureUnits = genie::flux::GFluxExposureI::AsString(etype);
-      exposureUnits = fluxExposureI->GetExposureUnits();
-    }
-    if ( fluxFileConfigI ) {
-      fluxFileConfigI->PrintConfig();
-    }
-    double psc   = mcj_driver->GlobProbScale();      // interaction prob. scale
-    if ( psc <= 0.0 ) {
-       LOG("gevgen_fnal", pFATAL) << "MCJobDriver GlobalProbScale was " << psc;
-    }
-    double pot   = fpot / psc;                       // POT for generated sample
-    long int nev = ievent;
-
-    LOG("gevgen_fnal", pNOTICE)
-        << "\n >> Interaction probability scaling factor:  " << psc
-        << "\n >> using: " << gOptFluxDriver
-        << "\n >> N of flux v read-in by flux driver:      " << nflx
-        << "\n >> N of flux v thrown to event gen driver:  " << nflx_evg
-        << "\n >> N of generated v interactions:           " << nev
-        << "\n ** Normalization for generated sample:      " << pot
-        << " " << exposureUnits << " * detector";
-
-    ntpw.EventTree()->SetWeight(pot); // store POT
-
+  if ( gOptUsingHistFlux || ! gOptUsingRootGeom ) return;
+
+  // POT normalization will only be calculated if event generation was based
+  // on beam simulation ntuples (not just histograms) & a detailed detector
+  // geometry description.
+  // Get nunber of flux neutrinos read-in by flux driver, number of flux
+  // neutrinos actually thrown to the event generation driver and number
+  // of neutrino interactions actually generated
+  long int nflx     = 0;
+  long int nflx_evg = fMCJDriver-> NFluxNeutrinos();
+  double   fpot     = 0;
+  const char* exposureUnits = "(unknown units)";
+  if ( fFluxExposureI ) {
+    fpot = fFluxExposureI->GetTotalExposure(); // POTs used so far
+    nflx = fFluxExposureI->NFluxNeutrinos();
+    exposureUnits = fFluxExposureI->GetExposureUnits();
   }
-
-  // *************************************************************************
-  // * Save & clean-up
-  // *************************************************************************
-
-  // Save the generated event tree & close the output file
-  ntpw.Save();
-
-  // Clean-up
-  delete geom_driver;
-  delete flux_driver;
-  delete mcj_driver;
-  // this list should only be histograms that have (for some reason)
-  // not been handed over to the GCylindTH1Flux driver.
-  map<int,TH1D*>::iterator it = gOptFluxHst.begin();
-  for( ; it != gOptFluxHst.end(); ++it) {
-    TH1D * spectrum = it->second;
-    if(spectrum) delete spectrum;
+  if ( fFluxFileConfigI ) {
+    fFluxFileConfigI->PrintConfig();
   }
-  gOptFluxHst.clear();
-
-  LOG("gevgen_fnal", pNOTICE) << "Done!";
+  double psc   = fMCJDriver->GlobProbScale();      // interaction prob. scale
+  if ( psc <= 0.0 ) {
+     LOG("gevgen_fnal", pFATAL) << "MCJobDriver GlobalProbScale was " << psc;
+  }
+  double pot   = fpot / psc;                       // POT for generated sample
 
-  return 0;
+  LOG("gevgen_fnal", pNOTICE)
+      << "\n >> Interaction probability scaling factor:  " << psc
+      << "\n >> using: " << gOptFluxDriver
+      << "\n >> N of flux v read-in by flux driver:      " << nflx
+      << "\n >> N of flux v thrown to event gen driver:  " << nflx_evg
+      << "\n >> N of generated v interactions:           " << nev
+      << "\n ** Normalization for generated sample:      " << pot
+      << " " << exposureUnits << " * detector";
+
+  this->StoreSampleExposure(ntpw, pot); // store POT
 }
-
 //____________________________________________________________________________
 void LoadExtraOptions(void)
 {
@@ -1282,6 +1319,13 @@ void PrintSyntax(void)
    << "\n            [-F fid_cut_string] [-S nrays_scan]"
    << "\n            [-z zmin_start]"
    << "\n            [--seed random_number_seed]"
+   << "\n            [--shard i/N]"
+   << "\n            [--checkpoint-interval nev] [--restart]"
+   << "\n            [--async-output] [--flux-read-ahead cache_MB[,n_entries]]"
+   << "\n            [--path-length-cache max_rays]"
+   << "\n            [--channel-bias channel:factor,...]"
+   << "\n            [--event-filter name/config]"
+   << "\n            [--memory-report]"
    << "\n             --cross-sections xml_file"
    << "\n            [--event-generator-list list_name]"
    << "\n            [--message-thresholds xml_file]"
@@ -0,0 +1,324 @@
+//____________________________________________________________________________
+/*!
+
+\program gmkskxsectable
+
+\brief   GENIE utility program tabulating the free nucleon differential cross
+         section of the AlamSimoAtharVacasSKPXSec2014 single kaon production
+         model (see SKXSecTable).
+
+         When $GSKXSECTABLE names the table, AlamSimoAtharVacasSKXSec
+         interpolates the cross section from the table, for the channels and
+         energy range it covers, instead of integrating it: SK splines then
+         take no time to regenerate (e.g. with more knots). The table must
+         be made with the tune the splines are made with.
+
+         The table is validated against the direct evaluation of the model,
+         at random points of its kinematical grid at each energy node. The
+         relative deviations of the interpolated integrand, over the points
+         where the integrand is above 1% of its maximum at that energy, are
+         reported per channel.
+
+         Syntax :
+           gmkskxsectable -o output_file -p neutrino_codes
+                          [-n number_of_energies] [-e emin,emax]
+                          [--grid nl,nk,nv] [--validate npoints]
+                          [--seed random_number_seed]
+                          [--message-thresholds xml_file]
+                           --tune genie_tune
+
+         Options :
+           -o
+              The output table file.
+           -p
+              A comma separated list of neutrino PDG codes
+              (default: 14,-14).
+           -n
+              The number of log-spaced energy nodes (default: 50).
+           -e
+              The energy range in GeV (default: 0.7,100). The cross section
+              below the first node with a non-zero cross section and above
+              the last node is integrated as usual.
+           --grid
+              The number of cells in Tl/Tmax, Tk/(Tmax-Tl) and ln(1-cos(theta_l))
+              (default: 20,20,40).
+           --validate
+              The number of validation points per channel and energy
+              (default: 20; 0 for no validation).
+           --seed
+              Random number seed.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+           --tune
+              Specifies a GENIE comprehensive neutrino interaction model tune.
+              [default: "Default"].
+
+         Example:
+
+           gmkskxsectable -o sk_table.bin -p 14,-14,12,-12 --tune G18_02a_00_000
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Physics/Strange/XSection/SKXSecTable.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+void Validate           (const SKXSecTable & table, int ich,
+                         const XSecAlgorithmI * model, const Interaction * in);
+
+// User-specified options:
+string   gOptOutFile    = "";         // output table file
+string   gOptNuPdgCodes = "14,-14";   // neutrino codes
+int      gOptNE         = 50;         // number of energy nodes
+double   gOptEMin       = 0.7;        // energy range (GeV)
+double   gOptEMax       = 100.;
+int      gOptNL         = 20;         // kinematical grid
+int      gOptNK         = 20;
+int      gOptNV         = 40;
+int      gOptNValidate  = 20;         // validation points per channel & energy
+long int gOptRanSeed    = -1;         // random number seed
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gmkskxsectable", pFATAL) << " No TuneId in RunOption";
+    exit(1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+
+  AlgFactory * algf = AlgFactory::Instance();
+  const XSecAlgorithmI * model = dynamic_cast<const XSecAlgorithmI *> (
+      algf->GetAlgorithm("genie::AlamSimoAtharVacasSKPXSec2014", "Default"));
+  const InteractionListGeneratorI * intlistgen =
+      dynamic_cast<const InteractionListGeneratorI *> (
+      algf->GetAlgorithm("genie::SKInteractionListGenerator", "Default"));
+  assert(model);
+  assert(intlistgen);
+
+  SKXSecTable table;
+  table.SetGrid(gOptNE, gOptEMin, gOptEMax, gOptNL, gOptNK, gOptNV);
+  table.SetModel(model);
+
+  // the channels off free nucleons
+  InteractionList channels;
+  vector<string> nuv = utils::str::Split(gOptNuPdgCodes, ",");
+  for (unsigned int inu = 0; inu < nuv.size(); inu++) {
+    int nu = atoi(nuv[inu].c_str());
+    for (int itgt = 0; itgt < 2; itgt++) {
+      int tgt = (itgt == 0) ? kPdgTgtFreeP : kPdgTgtFreeN;
+      InitialState init_state(tgt, nu);
+      InteractionList * intlist = intlistgen->CreateInteractionList(init_state);
+      if ( ! intlist ) continue;
+      for (unsigned int i = 0; i < intlist->size(); i++) {
+        channels.push_back(new Interaction(*(*intlist)[i]));
+      }
+      delete intlist;
+    }
+  }
+  if ( channels.empty() ) {
+    LOG("gmkskxsectable", pFATAL)
+      << "No single kaon channel for neutrinos " << gOptNuPdgCodes;
+    exit(1);
+  }
+
+  for (unsigned int i = 0; i < channels.size(); i++) {
+    const Interaction * in = channels[i];
+    int ich = table.AddChannel(in);
+    LOG("gmkskxsectable", pNOTICE)
+      << "Tabulating the cross section for " << in->AsString();
+    for (int ie = 0; ie < table.NE(); ie++) {
+      table.Fill(ich, ie, model, in);
+      LOG("gmkskxsectable", pINFO)
+        << "XSec(E = " << table.E(ie) << " GeV) = "
+        << table.NodeXSec(ich, ie) << " x 1E-38 cm^2";
+    }
+    Validate(table, ich, model, in);
+  }
+
+  if ( ! table.Write(gOptOutFile) ) exit(1);
+
+  return 0;
+}
+//____________________________________________________________________________
+void Validate(const SKXSecTable & table, int ich,
+              const XSecAlgorithmI * model, const Interaction * in)
+{
+  if ( gOptNValidate <= 0 ) return;
+
+  TRandom3 & rnd = RandomGen::Instance()->RndGen();
+  Interaction interaction(*in);
+
+  int    ncell = table.NL() * table.NK() * table.NV();
+  int    npts  = 0;
+  double sum2  = 0;
+  double dmax  = 0;
+  double edmax = 0;
+
+  for (int ie = 0; ie < table.NE(); ie++) {
+    double xsec = table.NodeXSec(ich, ie);
+    if ( xsec <= 0 ) continue;
+    // the mean integrand, used for the threshold of meaningful points
+    double gmean = xsec / (SKXSecTable::kVMax - SKXSecTable::kVMin);
+    double E = table.E(ie);
+    for (int i = 0; i < gOptNValidate; i++) {
+      double ul = rnd.Rndm();
+      double uk = rnd.Rndm();
+      double v  = SKXSecTable::kVMin +
+                  rnd.Rndm() * (SKXSecTable::kVMax - SKXSecTable::kVMin);
+      double g  = SKXSecTable::DirectIntegrand(model, &interaction, E, ul, uk, v);
+      if ( g < 0.01 * gmean ) continue;
+      double d = table.Integrand(ich, ie, ul, uk, v) / g - 1;
+      sum2 += d*d;
+      npts++;
+      if ( TMath::Abs(d) > dmax ) { dmax = TMath::Abs(d); edmax = E; }
+    }
+  }
+
+  LOG("gmkskxsectable", pNOTICE)
+    << "Validation of " << in->AsString() << " (" << ncell
+    << " cells per energy): " << npts << " points, rms deviation = "
+    << ((npts > 0) ? TMath::Sqrt(sum2/npts) : 0.)
+    << ", max deviation = " << dmax << " (E = " << edmax << " GeV)";
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gmkskxsectable", pINFO) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // output table file
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gmkskxsectable", pFATAL)
+       << "No output file was specified - Exiting";
+    PrintSyntax();
+    exit(1);
+  } //-o
+
+  // neutrino codes
+  if( parser.OptionExists('p') ) {
+    gOptNuPdgCodes = parser.ArgAsString('p');
+  } //-p
+
+  // number of energy nodes
+  if( parser.OptionExists('n') ) {
+    gOptNE = parser.ArgAsInt('n');
+  } //-n
+
+  // energy range
+  if( parser.OptionExists('e') ) {
+    vector<string> ev = utils::str::Split(parser.ArgAsString('e'), ",");
+    if( ev.size() != 2 ) {
+      LOG("gmkskxsectable", pFATAL)
+         << "The energy range must be given as emin,emax - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptEMin = atof(ev[0].c_str());
+    gOptEMax = atof(ev[1].c_str());
+  } //-e
+
+  // kinematical grid
+  if( parser.OptionExists("grid") ) {
+    vector<string> nv = utils::str::Split(parser.ArgAsString("grid"), ",");
+    if( nv.size() != 3 ) {
+      LOG("gmkskxsectable", pFATAL)
+         << "The grid must be given as nl,nk,nv - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptNL = atoi(nv[0].c_str());
+    gOptNK = atoi(nv[1].c_str());
+    gOptNV = atoi(nv[2].c_str());
+  } //--grid
+
+  // validation points
+  if( parser.OptionExists("validate") ) {
+    gOptNValidate = parser.ArgAsInt("validate");
+  } //--validate
+
+  // random number seed
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } //--seed
+
+  LOG("gmkskxsectable", pNOTICE)
+     << "\n"
+     << utils::print::PrintFramedMesg("gmkskxsectable job inputs");
+  LOG("gmkskxsectable", pNOTICE) << "Output table file  : " << gOptOutFile;
+  LOG("gmkskxsectable", pNOTICE) << "Neutrino codes     : " << gOptNuPdgCodes;
+  LOG("gmkskxsectable", pNOTICE) << "Energy nodes       : " << gOptNE
+     << " in [" << gOptEMin << ", " << gOptEMax << "] GeV";
+  LOG("gmkskxsectable", pNOTICE) << "Kinematical grid   : "
+     << gOptNL << " x " << gOptNK << " x " << gOptNV;
+  LOG("gmkskxsectable", pNOTICE) << "Validation points  : " << gOptNValidate;
+  LOG("gmkskxsectable", pNOTICE) << "\n";
+  LOG("gmkskxsectable", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gmkskxsectable", pNOTICE)
+      << "\n\n" << "Syntax:" << "\n"
+      << "   gmkskxsectable"
+      << " -o output_file"
+      << " [-p neutrino_codes]"
+      << " [-n number_of_energies]"
+      << " [-e emin,emax]"
+      << " [--grid nl,nk,nv]"
+      << " [--validate npoints]"
+      << " [--seed random_number_seed]"
+      << " [--message-thresholds xml_file]"
+      << " --tune genie_tune\n";
+}
+//____________________________________________________________________________
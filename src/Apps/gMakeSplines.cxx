@@ -16,7 +16,11 @@
                   <-o | --output-cross-sections> output_xml_xsec_file
                   [-n nknots]
                   [-e max_energy]
+                  [--adaptive-knots tolerance]
                   [--no-copy]
+                  [--jobs number_of_worker_processes]
+                  [--checkpoint-interval seconds]
+                  [--resume]
                   [--seed random_number_seed]
                   [--input-cross-sections xml_file]
                   [--event-generator-list list_name]
@@ -48,8 +52,33 @@
                Maximum energy in spline.
                Default: The max energy in the validity range of the spline
                generating thread.
+           --adaptive-knots
+               Place the knots adaptively: Starting from a coarse grid, the
+               intervals where the interpolated cross section differs from
+               the one computed at the midpoint by more than the given
+               relative tolerance (eg 1E-3) are bisected recursively.
+               The number of knots per spline (see -n) is used as the knot
+               budget of each spline.
            --no-copy
                Does not write out the input cross-sections in the output file
+           --jobs
+               Number of worker processes computing the cross section at the
+               spline knots. The (interaction, knot) integrations are handed
+               out one at a time to the workers, forked once all drivers are
+               configured.
+               Default: 1 (all integrations in the gmkspl process). The
+               knots of each spline are then integrated as one batch, by
+               batch-nthreads threads for the QELXSec and RESXSec integrators
+               (see XSecIntegratorI::IntegrateBatch).
+           --checkpoint-interval
+               The splines completed so far are saved in a checkpoint file
+               (the output file name + `.ckpt') at most this often.
+               The checkpoint file is removed once the output file is written.
+               Default: 600 seconds.
+           --resume
+               Reload the splines saved in the checkpoint file of an earlier,
+               interrupted job (with the same output file name) and only
+               compute the splines that are still missing.
            --seed
               Random number seed.
            --input-cross-sections
@@ -85,8 +114,19 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstdio>
 #include <string>
 #include <vector>
+#include <deque>
+#include <algorithm>
+#include <iostream>
+#include <chrono>
+
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 
 #if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
 #include <fenv.h> // for `feenableexcept`
@@ -103,7 +143,7 @@
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/StringUtils.h"
-//#include "Framework/Utils/SystemUtils.h"
+#include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/CmdLnArgParser.h"
@@ -126,6 +166,10 @@ void          GetCommandLineArgs (int argc, char ** argv);
 void          PrintSyntax        (void);
 PDGCodeList * GetNeutrinoCodes   (void);
 PDGCodeList * GetTargetCodes     (void);
+void          ComputeQueuedSplines (const string & ckpt_file);
+void          ComputeSerial      (const string & ckpt_file);
+void          ComputeForked      (const string & ckpt_file);
+void          Checkpoint         (const string & ckpt_file, bool force);
 
 // User-specified options:
 string   gOptNuPdgCodeList  = "";
@@ -137,6 +181,12 @@ bool     gOptNoCopy         = false;
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
+int      gOptNJobs          = 1;    // number of worker processes
+double   gOptCkptInterval   = 600.; // checkpointing interval (sec)
+bool     gOptResume         = false;// resume from checkpoint file
+double   gOptAdaptiveTol    = -1.;  // adaptive knots tolerance (<0: off)
+
+std::chrono::steady_clock::time_point gLastCheckpoint;
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -179,10 +229,37 @@ int main(int argc, char ** argv)
   LOG("gmkspl", pINFO) << "Neutrinos: " << *neutrinos;
   LOG("gmkspl", pINFO) << "Targets: "   << *targets;
 
+  XSecSplineList * xspl = XSecSplineList::Instance();
+
+  // Reload the splines completed by an earlier, interrupted job
+  string ckpt_file = gOptOutXSecFile + ".ckpt";
+  if(gOptResume) {
+    if(utils::system::FileExists(ckpt_file)) {
+      LOG("gmkspl", pNOTICE) << "Resuming from checkpoint: " << ckpt_file;
+      XmlParserStatus_t status = xspl->LoadFromXml(ckpt_file, true, false);
+      if(status != kXmlOK) {
+        LOG("gmkspl", pFATAL)
+          << "Problem reading checkpoint file: " << ckpt_file;
+        exit(1);
+      }
+    } else {
+      LOG("gmkspl", pWARN)
+        << "No checkpoint file " << ckpt_file << " - Starting from scratch";
+    }
+  }
+
   // Loop over all possible input init states and ask the GEVGDriver
   // to build splines for all the interactions that its loaded list
   // of event generators can generate.
+  // The splines are only queued here (with their knots placed): The cross
+  // sections at all knots of all splines are computed afterwards.
+  // The drivers are kept alive, as the queued splines refer to the cross
+  // section algorithms of their event generators.
 
+  xspl->SetQueueSplines(true);
+  if(gOptAdaptiveTol > 0) xspl->SetAdaptiveKnots(true, gOptAdaptiveTol);
+
+  vector<GEVGDriver *> drivers;
   PDGCodeList::const_iterator nuiter;
   PDGCodeList::const_iterator tgtiter;
   for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
@@ -190,18 +267,29 @@ int main(int argc, char ** argv)
       int nupdgc  = *nuiter;
       int tgtpdgc = *tgtiter;
       InitialState init_state(tgtpdgc, nupdgc);
-      GEVGDriver driver;
-      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
-      driver.Configure(init_state);
-      driver.CreateSplines(gOptNKnots, gOptMaxE);
+      GEVGDriver * driver = new GEVGDriver;
+      driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      driver->Configure(init_state);
+      driver->CreateSplines(gOptNKnots, gOptMaxE);
+      drivers.push_back(driver);
     }
   }
 
+  xspl->SetQueueSplines(false);
+
+  ComputeQueuedSplines(ckpt_file);
+
   // Save the splines at the requested XML file
-  XSecSplineList * xspl = XSecSplineList::Instance();
   bool save_init = !gOptNoCopy;
   xspl->SaveAsXml(gOptOutXSecFile, save_init);
 
+  // The output is complete: the checkpoint is no longer needed
+  std::remove(ckpt_file.c_str());
+
+  xspl->ClearQueuedSplines();
+  vector<GEVGDriver *>::iterator diter = drivers.begin();
+  for( ; diter != drivers.end(); ++diter) delete *diter;
+
   delete neutrinos;
   delete targets;
 
@@ -262,6 +350,40 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptNoCopy = true;
   }
 
+  // adaptive knot placement
+  if( parser.OptionExists("adaptive-knots") ) {
+    LOG("gmkspl", pINFO) << "Reading adaptive knots tolerance";
+    gOptAdaptiveTol = parser.ArgAsDouble("adaptive-knots");
+  } else {
+    LOG("gmkspl", pINFO) << "Using a fixed knot grid";
+    gOptAdaptiveTol = -1.;
+  }
+
+  // number of worker processes
+  if( parser.OptionExists("jobs") ) {
+    LOG("gmkspl", pINFO) << "Reading number of worker processes";
+    gOptNJobs = parser.ArgAsInt("jobs");
+    if(gOptNJobs < 1) gOptNJobs = 1;
+  } else {
+    LOG("gmkspl", pINFO) << "Unspecified number of worker processes - Using default";
+    gOptNJobs = 1;
+  }
+
+  // checkpointing interval
+  if( parser.OptionExists("checkpoint-interval") ) {
+    LOG("gmkspl", pINFO) << "Reading checkpointing interval";
+    gOptCkptInterval = parser.ArgAsDouble("checkpoint-interval");
+  } else {
+    LOG("gmkspl", pINFO) << "Unspecified checkpointing interval - Using default";
+    gOptCkptInterval = 600.;
+  }
+
+  // resume from an earlier checkpoint?
+  if( parser.OptionExists("resume") ) {
+    LOG("gmkspl", pINFO) << "Resuming from checkpoint";
+    gOptResume = true;
+  }
+
   // comma-separated neutrino PDG code list
   if( parser.OptionExists('p') ) {
     LOG("gmkspl", pINFO) << "Reading neutrino PDG codes";
@@ -338,6 +460,10 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n Output cross-section file : " << gOptOutXSecFile
      << "\n Input cross-section file : " << gOptInpXSecFile
      << "\n Random number seed : " << gOptRanSeed
+     << "\n Adaptive knots tolerance : " << gOptAdaptiveTol
+     << "\n Worker processes : " << gOptNJobs
+     << "\n Checkpoint interval : " << gOptCkptInterval << " s"
+     << "\n Resume from checkpoint : " << utils::print::BoolAsYNString(gOptResume)
      << "\n";
 
   LOG("gmkspl", pNOTICE) << *RunOpt::Instance();
@@ -349,7 +475,8 @@ void PrintSyntax(void)
     << "\n\n" << "Syntax:" << "\n"
     << "   gmkspl -p nupdg <-t tgtpdg, -f geomfile> "
     << " <-o | --output-cross-section> xsec_xml_file_name"
-    << " [-n nknots] [-e max_energy] "
+    << " [-n nknots] [-e max_energy] [--adaptive-knots tolerance]"
+    << " [--no-copy] [--jobs njobs] [--checkpoint-interval seconds] [--resume]"
     << " [--seed seed_number]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
@@ -411,3 +538,247 @@ PDGCodeList * GetTargetCodes(void)
   return 0;
 }
 //____________________________________________________________________________
+void ComputeQueuedSplines(const string & ckpt_file)
+{
+// Compute the cross section at the knots of all queued splines and add the
+// splines to the XSecSplineList.
+
+  const vector<XSecSplineList::QueuedSpline> & queued =
+                           XSecSplineList::Instance()->QueuedSplines();
+
+  unsigned int nknots = 0;
+  vector<XSecSplineList::QueuedSpline>::const_iterator q_iter = queued.begin();
+  for( ; q_iter != queued.end(); ++q_iter) nknots += q_iter->E.size();
+
+  LOG("gmkspl", pNOTICE)
+    << "Computing " << queued.size() << " splines (" << nknots
+    << " initial knots) using " << gOptNJobs << " worker process(es)";
+
+  gLastCheckpoint = std::chrono::steady_clock::now();
+
+  if(queued.size() == 0) return;
+
+  if(gOptNJobs <= 1) ComputeSerial(ckpt_file);
+  else               ComputeForked(ckpt_file);
+}
+//____________________________________________________________________________
+void ComputeSerial(const string & ckpt_file)
+{
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  const vector<XSecSplineList::QueuedSpline> & queued = xspl->QueuedSplines();
+
+  for(unsigned int ispl = 0; ispl < queued.size(); ispl++) {
+    vector<double> E, xsec;
+    xspl->ComputeKnots(queued[ispl], E, xsec);
+    xspl->CreateSpline(queued[ispl], E, xsec);
+    Checkpoint(ckpt_file, false);
+  }
+}
+//____________________________________________________________________________
+void ComputeForked(const string & ckpt_file)
+{
+// Fork the worker processes (which inherit the fully configured job) and
+// hand out the (spline, knot) integrations to them, one at a time, so that
+// the load is balanced whatever the cost of each integration.
+// Each worker gets tasks from the parent on its own pipe and sends back the
+// results on a second one.
+// The knots of each spline are computed in passes: the initial grid, then
+// (with adaptive knots) the midpoints of the intervals to be bisected, as
+// returned by XSecSplineList::RefineKnots() at the end of each pass.
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  const vector<XSecSplineList::QueuedSpline> & queued = xspl->QueuedSplines();
+
+  struct Task_t   { int spline; int point; double E;    };
+  struct Result_t { int spline; int point; double xsec; };
+
+  // per spline: the knots computed so far and the points of the current pass
+  unsigned int nsplines = queued.size();
+  vector< vector<double> > E     (nsplines), xsec     (nsplines);
+  vector< vector<double> > Etest (nsplines), xsec_test(nsplines);
+  vector<int>              nleft (nsplines);
+  vector<bool>             first (nsplines, true);
+
+  std::deque<Task_t> tasks;
+  for(unsigned int ispl = 0; ispl < nsplines; ispl++) {
+    Etest    [ispl] = queued[ispl].E;
+    xsec_test[ispl].resize(Etest[ispl].size());
+    nleft    [ispl] = Etest[ispl].size();
+    for(unsigned int ip = 0; ip < Etest[ispl].size(); ip++) {
+      Task_t task = { (int) ispl, (int) ip, Etest[ispl][ip] };
+      tasks.push_back(task);
+    }
+  }
+
+  int nworkers = std::min(gOptNJobs, (int) tasks.size());
+  vector<pid_t> pids  (nworkers);
+  vector<int>   to_wrk(nworkers);   // task pipes (write end)
+  vector<int>   fr_wrk(nworkers);   // result pipes (read end)
+  vector<bool>  busy  (nworkers, false);
+
+  // flush before forking so that buffered output is not written twice
+  std::cout.flush();
+  std::cerr.flush();
+
+  for(int iw = 0; iw < nworkers; iw++) {
+    int fd_task[2], fd_res[2];
+    if(pipe(fd_task) != 0 || pipe(fd_res) != 0) {
+      LOG("gmkspl", pFATAL) << "Could not create pipe";
+      exit(1);
+    }
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("gmkspl", pFATAL) << "Could not fork worker process";
+      exit(1);
+    }
+    if(pid == 0) {
+      // worker: compute the cross section for each task received
+      close(fd_task[1]);
+      close(fd_res[0]);
+      for(int jw = 0; jw < iw; jw++) { close(to_wrk[jw]); close(fr_wrk[jw]); }
+      Task_t task;
+      while(read(fd_task[0], &task, sizeof(task)) == (ssize_t) sizeof(task)) {
+        if(task.spline < 0) break;
+        const XSecSplineList::QueuedSpline & spl = queued[task.spline];
+        Result_t result;
+        result.spline = task.spline;
+        result.point  = task.point;
+        result.xsec   = xspl->KnotXSec(spl.alg, spl.interaction, task.E);
+        if(write(fd_res[1], &result, sizeof(result)) != (ssize_t) sizeof(result)) break;
+      }
+      std::cout.flush();
+      _exit(0);
+    }
+    close(fd_task[0]);
+    close(fd_res[1]);
+    pids  [iw] = pid;
+    to_wrk[iw] = fd_task[1];
+    fr_wrk[iw] = fd_res[0];
+  }
+
+  // parent: hand out the tasks and collect the results
+  // (a worker dying must not kill the parent before it saves a checkpoint)
+  signal(SIGPIPE, SIG_IGN);
+
+  unsigned int ndone    = 0;
+  unsigned int nremain  = nsplines;
+  bool         failed   = false;
+  vector<struct pollfd> pfds(nworkers);
+  for(int iw = 0; iw < nworkers; iw++) {
+    pfds[iw].fd     = fr_wrk[iw];
+    pfds[iw].events = POLLIN;
+  }
+
+  while(nremain > 0 && !failed) {
+    // keep all idle workers busy
+    for(int iw = 0; iw < nworkers && !failed && tasks.size() > 0; iw++) {
+      if(busy[iw]) continue;
+      Task_t task = tasks.front();
+      tasks.pop_front();
+      ssize_t nw = write(to_wrk[iw], &task, sizeof(task));
+      if(nw != (ssize_t) sizeof(task)) {
+        LOG("gmkspl", pFATAL) << "Could not send task to worker " << pids[iw];
+        failed = true;
+      }
+      busy[iw] = true;
+    }
+    if(failed) break;
+
+    if(poll(&pfds[0], nworkers, -1) < 0) continue;
+    for(int iw = 0; iw < nworkers && !failed; iw++) {
+      if(pfds[iw].revents == 0) continue;
+      Result_t result;
+      ssize_t nr = read(fr_wrk[iw], &result, sizeof(result));
+      if(nr != (ssize_t) sizeof(result)) {
+        LOG("gmkspl", pFATAL)
+          << "Worker process " << pids[iw] << " died unexpectedly";
+        failed = true;
+        break;
+      }
+      busy[iw] = false;
+      ndone++;
+
+      int ispl = result.spline;
+      xsec_test[ispl][result.point] = result.xsec;
+      if(--nleft[ispl] > 0) continue;
+
+      // end of pass for the current spline
+      vector<double> Enext;
+      if(first[ispl]) {
+        E   [ispl] = Etest    [ispl];
+        xsec[ispl] = xsec_test[ispl];
+        Etest    [ispl].clear();
+        xsec_test[ispl].clear();
+        first[ispl] = false;
+      }
+      if(xspl->AdaptiveKnots()) {
+        xspl->RefineKnots(E[ispl], xsec[ispl], Etest[ispl], xsec_test[ispl],
+                          queued[ispl].nknots, Enext);
+      }
+      if(Enext.size() > 0) {
+        Etest    [ispl] = Enext;
+        xsec_test[ispl].assign(Enext.size(), 0.);
+        nleft    [ispl] = Enext.size();
+        for(unsigned int ip = 0; ip < Enext.size(); ip++) {
+          Task_t task = { ispl, (int) ip, Enext[ip] };
+          tasks.push_back(task);
+        }
+        continue;
+      }
+      xspl->CreateSpline(queued[ispl], E[ispl], xsec[ispl]);
+      nremain--;
+      LOG("gmkspl", pNOTICE)
+        << "Completed spline " << queued[ispl].key << " with "
+        << E[ispl].size() << " knots [" << nsplines - nremain << "/"
+        << nsplines << " splines done]";
+      Checkpoint(ckpt_file, false);
+    }
+  }
+
+  for(int iw = 0; iw < nworkers; iw++) {
+    if(failed) {
+      kill(pids[iw], SIGTERM);
+    } else {
+      Task_t quit = { -1, -1, 0. };
+      ssize_t nw = write(to_wrk[iw], &quit, sizeof(quit));
+      if(nw != (ssize_t) sizeof(quit)) kill(pids[iw], SIGTERM);
+    }
+    close(to_wrk[iw]);
+    close(fr_wrk[iw]);
+    int status = 0;
+    waitpid(pids[iw], &status, 0);
+  }
+
+  if(failed) {
+    // keep what was completed so far: the job can be resumed
+    Checkpoint(ckpt_file, true);
+    LOG("gmkspl", pFATAL)
+      << "Spline computation failed - Rerun with --resume to continue";
+    exit(1);
+  }
+
+  LOG("gmkspl", pNOTICE)
+    << "Computed " << ndone << " knots for " << nsplines << " splines";
+}
+//____________________________________________________________________________
+void Checkpoint(const string & ckpt_file, bool force)
+{
+// Save the splines computed so far (and the ones reloaded from an earlier
+// checkpoint) if the checkpointing interval has elapsed. The file is written
+// under a temporary name and then renamed, so that a crash while writing it
+// does not destroy the previous checkpoint.
+
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  double elapsed = std::chrono::duration<double>(now - gLastCheckpoint).count();
+  if(!force && elapsed < gOptCkptInterval) return;
+
+  string tmp_file = ckpt_file + ".tmp";
+  XSecSplineList::Instance()->SaveAsXml(tmp_file, false);
+  if(std::rename(tmp_file.c_str(), ckpt_file.c_str()) != 0) {
+    LOG("gmkspl", pERROR) << "Could not write checkpoint file: " << ckpt_file;
+  } else {
+    LOG("gmkspl", pNOTICE) << "Checkpoint written: " << ckpt_file;
+  }
+  gLastCheckpoint = now;
+}
+//____________________________________________________________________________
@@ -20,6 +20,7 @@
          Syntax :
            gmxpl -f geom_file [-L length_units] [-D density_units] 
                  [-t top_vol_name] [-o output_xml_file] [-n np] [-r nr]
+                 [-j nthreads] [--converge nbatches]
                  [-seed random_number_seed]
                  [--message-thresholds xml_file]
 
@@ -36,6 +37,13 @@
                Number of  scanning points / surface [ default: see geom driver's defaults ]
            -r  
                Number of scanning rays / point [ default: see geom driver's defaults ]
+           -j
+               Number of threads swimming the scanning rays through the
+               geometry [ default: 1 ]
+           --converge
+               Stop scanning a box surface once the maximum path length of
+               no material has grown over that many consecutive batches of
+               rays [ default: 0, scan all points and rays ]
            -o  
                Name of output XML file [ default: maxpl.xml ]
            --seed 
@@ -106,6 +114,8 @@ double    gOptGeomLUnits      = 0;           // input geometry length units
 double    gOptGeomDUnits      = 0;           // input geometry density units
 int       gOptNPoints         = -1;          // input number of points / surf
 int       gOptNRays           = -1;          // input number of rays / point
+int       gOptNThreads        = 1;           // input number of scanning threads
+int       gOptNConverge       = 0;           // input number of batches w/o change before stopping
 long int  gOptRanSeed         = -1;          // random number seed
 
 //____________________________________________________________________________
@@ -131,6 +141,8 @@ int main(int argc, char ** argv)
 
   if(gOptNPoints > 0) geom->SetScannerNPoints(gOptNPoints);
   if(gOptNRays   > 0) geom->SetScannerNRays  (gOptNRays);
+  geom->SetScannerNThreads    (gOptNThreads);
+  geom->SetScannerConvergence (gOptNConverge);
 
   // Compute the maximum path lengths
   LOG("gmxpl", pINFO)
@@ -218,6 +230,23 @@ void GetCommandLineArgs(int argc, char ** argv)
       << "Unspecified number of rays - Using driver's default";
   } //-r
 
+  // number of scanning threads
+  if( parser.OptionExists('j') ) {
+    LOG("gmxpl", pDEBUG) 
+       << "Reading input number of scanning threads";
+    gOptNThreads = parser.ArgAsInt('j');
+  } else {
+    LOG("gmxpl", pDEBUG)
+      << "Unspecified number of threads - Using 1";
+  } //-j
+
+  // convergence-based stopping
+  if( parser.OptionExists("converge") ) {
+    LOG("gmxpl", pDEBUG) 
+       << "Reading number of batches without change before stopping";
+    gOptNConverge = parser.ArgAsInt("converge");
+  } //--converge
+
   // input geometry file
   if( parser.OptionExists('f') ) {
     LOG("gmxpl", pDEBUG) 
@@ -250,6 +279,8 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gmxpl", pNOTICE) << "Geometry density units  : " << gOptGeomDUnits;
   LOG("gmxpl", pNOTICE) << "Scanner points/surface  : " << gOptNPoints;
   LOG("gmxpl", pNOTICE) << "Scanner rays/point      : " << gOptNRays;
+  LOG("gmxpl", pNOTICE) << "Scanner threads         : " << gOptNThreads;
+  LOG("gmxpl", pNOTICE) << "Scanner convergence     : " << gOptNConverge;
   LOG("gmxpl", pNOTICE) << "Random number seed      : " << gOptRanSeed;
 
   LOG("gmxpl", pNOTICE) << "\n";
@@ -266,6 +297,9 @@ void PrintSyntax(void)
       << " [-D density_units]" 
       << " [-t top_volume_name]"
       << " [-o output_xml_file]"
+      << " [-n np] [-r nr]"
+      << " [-j nthreads]"
+      << " [--converge nbatches]"
       << " [-seed random_number_seed]"
       << " [--message-thresholds xml_file]\n";
 
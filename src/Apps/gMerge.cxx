@@ -0,0 +1,429 @@
+//____________________________________________________________________________
+/*!
+
+\program gmerge
+
+\brief   Merges the output event files of a GENIE production split in jobs
+         (see the --shard i/N option of the event generation apps).
+
+         The input files are merged in shard order (independently of the
+         order in which they are given), so that the merged file does not
+         depend on how the input files were listed:
+           - all trees (GHEP event tree, event index, summary and flux
+             metadata trees, ...) are chained and fast-cloned, without
+             decompressing the baskets,
+           - the tree headers (see NtpMCTreeHeader) are combined:
+             the exposure (POT), the number of flux neutrinos and the sums
+             of flux interaction probabilities (per flux neutrino species)
+             are added, and the interaction probability scale is replaced by
+             the effective scale of the merged sample (the exposure-weighted
+             average of the job scales, or the average weighted by the number
+             of flux neutrinos if no exposure was stored),
+           - the event tree weight (the POT, for the apps which store it) is
+             set to the exposure of the merged sample,
+           - other objects (MC job configuration and environment) are copied
+             from the first shard.
+         The event numbers stored in the event records are not modified
+         (they start from 0 in each shard).
+
+         Syntax :
+           gmerge [-h]
+                   -i input_files
+                  [-o output_file]
+                  [--allow-incomplete]
+                  [--message-thresholds xml_file]
+
+         Options :
+           [] Denotes an optional argument.
+           -h
+              Prints-out help on using gmerge and exits.
+           -i
+              Specifies the input event files, as a comma separated list.
+              Wildcards are accepted, eg `-i "/data/prod/gntp.1000.shard*.ghep.root"'
+           -o
+              Specifies the output file name.
+              [default: gntp.[run_number].[event_tree_format].root, as for an
+               unsplit job]
+           --allow-incomplete
+              Merges the input files even if some of the shards of the
+              production are missing (the merged normalization is then the
+              normalization of the shards found).
+              [default: missing shards are a fatal error]
+
+         Examples :
+           gmerge -i "gntp.1000.shard*.ghep.root" -o gntp.1000.ghep.root
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <sstream>
+#include <algorithm>
+
+#include <TSystem.h>
+#include <TFile.h>
+#include <TTree.h>
+#include <TChain.h>
+#include <TChainElement.h>
+#include <TKey.h>
+#include <TClass.h>
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpMCTreeHeader.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/StringUtils.h"
+
+using std::string;
+using std::vector;
+using std::map;
+using std::set;
+using std::ostringstream;
+
+using namespace genie;
+
+// an input file and its tree header
+struct GMergeInput_t {
+  string          filename;
+  NtpMCTreeHeader header;
+};
+
+// function prototypes
+void GetCommandLineArgs  (int argc, char ** argv);
+void PrintSyntax         (void);
+void ReadInputs          (vector<GMergeInput_t> & inputs);
+void CheckShards         (const vector<GMergeInput_t> & inputs);
+void MergeHeaders        (const vector<GMergeInput_t> & inputs, NtpMCTreeHeader & merged);
+void MergeFiles          (const vector<GMergeInput_t> & inputs, const NtpMCTreeHeader & merged);
+bool ShardOrder          (const GMergeInput_t & i1, const GMergeInput_t & i2);
+
+// command-line options
+string gOptInpFiles       = "";    ///< (-i) input files
+string gOptOutFile        = "";    ///< (-o) output file
+bool   gOptAllowIncomplete = false; ///< merge incomplete productions?
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc, argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  vector<GMergeInput_t> inputs;
+  ReadInputs(inputs);
+
+  // merge in shard order (files of the same shard, if any, by name)
+  std::stable_sort(inputs.begin(), inputs.end(), ShardOrder);
+
+  CheckShards(inputs);
+
+  NtpMCTreeHeader merged;
+  MergeHeaders(inputs, merged);
+
+  if(gOptOutFile.size() == 0) {
+    ostringstream name;
+    name << "gntp." << merged.runnu << "."
+         << NtpMCFormat::FilenameTag(merged.format) << ".root";
+    gOptOutFile = name.str();
+  }
+
+  MergeFiles(inputs, merged);
+
+  LOG("gmerge", pNOTICE) << "Merged tree header: " << merged;
+  LOG("gmerge", pNOTICE) << "Done!";
+
+  return 0;
+}
+//____________________________________________________________________________
+void ReadInputs(vector<GMergeInput_t> & inputs)
+{
+  vector<string> patterns = utils::str::Split(gOptInpFiles, ",");
+
+  // expand wildcards
+  TChain chain("gtree");
+  for(unsigned int i = 0; i < patterns.size(); i++) {
+    string pattern = utils::str::TrimSpaces(patterns[i]);
+    if(pattern.size() == 0) continue;
+    chain.Add(pattern.c_str());
+  }
+
+  set<string> seen;
+  TObjArray * file_array = chain.GetListOfFiles();
+  TIter next_file(file_array);
+  TChainElement * element = 0;
+  while (( element = dynamic_cast<TChainElement *>(next_file()) )) {
+    string filename = element->GetTitle();
+    if(seen.count(filename) > 0) continue;
+    seen.insert(filename);
+
+    TFile file(filename.c_str(), "READ");
+    if(file.IsZombie()) {
+      LOG("gmerge", pFATAL) << "Can not open input file: " << filename;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    NtpMCTreeHeader * hdr =
+        dynamic_cast<NtpMCTreeHeader *> (file.Get("header"));
+    if(!hdr) {
+      LOG("gmerge", pFATAL) << "No tree header in input file: " << filename;
+      gAbortingInErr = true;
+      exit(1);
+    }
+
+    GMergeInput_t input;
+    input.filename = filename;
+    input.header.Copy(*hdr);
+    inputs.push_back(input);
+
+    LOG("gmerge", pINFO)
+      << "Input file: " << filename << " (shard "
+      << hdr->ishard << "/" << hdr->nshards << ")";
+    file.Close();
+  }
+
+  if(inputs.size() == 0) {
+    LOG("gmerge", pFATAL) << "No input files matching: " << gOptInpFiles;
+    gAbortingInErr = true;
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+bool ShardOrder(const GMergeInput_t & i1, const GMergeInput_t & i2)
+{
+  if(i1.header.ishard != i2.header.ishard) {
+    return (i1.header.ishard < i2.header.ishard);
+  }
+  return (i1.filename < i2.filename);
+}
+//____________________________________________________________________________
+void CheckShards(const vector<GMergeInput_t> & inputs)
+{
+// Checks that the input files are the outputs of the jobs of one production:
+// same format, same number of shards, each shard appearing once
+
+  const NtpMCTreeHeader & first = inputs[0].header;
+
+  bool ok = true;
+  for(unsigned int i = 1; i < inputs.size(); i++) {
+    const NtpMCTreeHeader & hdr = inputs[i].header;
+    if(hdr.format != first.format) {
+      LOG("gmerge", pFATAL)
+        << "Input file " << inputs[i].filename << " has a different format ("
+        << NtpMCFormat::AsString(hdr.format) << ") than "
+        << inputs[0].filename << " (" << NtpMCFormat::AsString(first.format) << ")";
+      ok = false;
+    }
+    if(hdr.runnu != first.runnu) {
+      LOG("gmerge", pWARN)
+        << "Input file " << inputs[i].filename << " has a different run number ("
+        << hdr.runnu << ") than " << inputs[0].filename << " (" << first.runnu << ")";
+    }
+    if(hdr.cvstag.GetString() != first.cvstag.GetString()) {
+      LOG("gmerge", pWARN)
+        << "Input file " << inputs[i].filename
+        << " was generated with a different GENIE version ("
+        << hdr.cvstag.GetString().Data() << ")";
+    }
+  }
+
+  // outputs of a split production
+  bool sharded = (first.nshards > 1);
+  for(unsigned int i = 0; i < inputs.size(); i++) {
+    const NtpMCTreeHeader & hdr = inputs[i].header;
+    if((hdr.nshards > 1) != sharded || (sharded && hdr.nshards != first.nshards)) {
+      LOG("gmerge", pFATAL)
+        << "Input file " << inputs[i].filename << " is shard " << hdr.ishard
+        << " of " << hdr.nshards << " jobs, while " << inputs[0].filename
+        << " is shard " << first.ishard << " of " << first.nshards << " jobs";
+      ok = false;
+    }
+    if(hdr.ishard < 0) {
+      LOG("gmerge", pWARN)
+        << "Input file " << inputs[i].filename << " is an already merged file";
+    }
+  }
+
+  if(sharded && ok) {
+    map<int, int> nfiles;
+    for(unsigned int i = 0; i < inputs.size(); i++) {
+      if(inputs[i].header.ishard >= 0) nfiles[inputs[i].header.ishard]++;
+    }
+    for(int ishard = 0; ishard < first.nshards; ishard++) {
+      if(nfiles[ishard] > 1) {
+        LOG("gmerge", pFATAL)
+          << "Shard " << ishard << " appears in " << nfiles[ishard] << " input files";
+        ok = false;
+      }
+      if(nfiles[ishard] == 0) {
+        LOG("gmerge", (gOptAllowIncomplete) ? pWARN : pFATAL)
+          << "Shard " << ishard << " of " << first.nshards << " is missing";
+        if(!gOptAllowIncomplete) ok = false;
+      }
+    }
+  }
+
+  if(!ok) {
+    LOG("gmerge", pFATAL) << "Can not merge the input files - Exiting";
+    gAbortingInErr = true;
+    exit(2);
+  }
+}
+//____________________________________________________________________________
+void MergeHeaders(
+   const vector<GMergeInput_t> & inputs, NtpMCTreeHeader & merged)
+{
+  merged.Copy(inputs[0].header);
+
+  merged.ishard  = (merged.nshards > 1) ? -1 : merged.ishard;
+  merged.seed    = (inputs.size() > 1) ? 0 : merged.seed;
+  merged.pot     = 0;
+  merged.nfluxnu = 0;
+  merged.sumfluxintprobs.clear();
+  merged.nfilttried    = 0;
+  merged.nfiltaccepted = 0;
+
+  // the effective probability scale of the merged sample is such that the
+  // merged exposure is the flux exposure of all jobs / scale, ie the average
+  // of the job scales weighted by their exposure (or, if the jobs did not
+  // store their exposure, by their number of flux neutrinos)
+  double sum_pot = 0, sum_pot_psc = 0;
+  double sum_nfl = 0, sum_nfl_psc = 0;
+
+  for(unsigned int i = 0; i < inputs.size(); i++) {
+    const NtpMCTreeHeader & hdr = inputs[i].header;
+
+    merged.pot     += hdr.pot;
+    merged.nfluxnu += hdr.nfluxnu;
+    merged.nfilttried    += hdr.nfilttried;
+    merged.nfiltaccepted += hdr.nfiltaccepted;
+
+    map<int, double>::const_iterator it = hdr.sumfluxintprobs.begin();
+    for( ; it != hdr.sumfluxintprobs.end(); ++it) {
+      merged.sumfluxintprobs[it->first] += it->second;
+    }
+
+    sum_pot     += hdr.pot;
+    sum_pot_psc += hdr.pot * hdr.globprobscale;
+    sum_nfl     += hdr.nfluxnu;
+    sum_nfl_psc += hdr.nfluxnu * hdr.globprobscale;
+  }
+
+  if      (sum_pot > 0) merged.globprobscale = sum_pot_psc / sum_pot;
+  else if (sum_nfl > 0) merged.globprobscale = sum_nfl_psc / sum_nfl;
+}
+//____________________________________________________________________________
+void MergeFiles(
+   const vector<GMergeInput_t> & inputs, const NtpMCTreeHeader & merged)
+{
+  LOG("gmerge", pNOTICE)
+    << "*** Merging " << inputs.size() << " files into: " << gOptOutFile;
+
+  TFile fout(gOptOutFile.c_str(), "RECREATE");
+  if(fout.IsZombie()) {
+    LOG("gmerge", pFATAL) << "Can not open output file: " << gOptOutFile;
+    gAbortingInErr = true;
+    exit(3);
+  }
+
+  TFile first(inputs[0].filename.c_str(), "READ");
+
+  set<string> done;
+  TIter next_key(first.GetListOfKeys());
+  TKey * key = 0;
+  while( (key = dynamic_cast<TKey *>(next_key())) ) {
+    string name = key->GetName();
+    if(done.count(name) > 0) continue; // older key cycles
+    done.insert(name);
+
+    if(name == "header") continue; // merged header written below
+
+    TClass * cl = TClass::GetClass(key->GetClassName());
+    if(cl && cl->InheritsFrom(TTree::Class())) {
+      TChain chain(name.c_str());
+      for(unsigned int i = 0; i < inputs.size(); i++) {
+        chain.Add(inputs[i].filename.c_str());
+      }
+      TTree * tree0 = dynamic_cast<TTree *> (key->ReadObj());
+      fout.cd();
+      TTree * tree = chain.CloneTree(-1, "fast");
+      if(!tree) {
+        LOG("gmerge", pFATAL) << "Could not merge tree: " << name;
+        gAbortingInErr = true;
+        exit(3);
+      }
+      if(tree0) tree->SetWeight(tree0->GetWeight());
+      if(name == "gtree" && merged.pot > 0) {
+        tree->SetWeight(merged.pot); // POT of the merged sample
+      }
+      LOG("gmerge", pNOTICE)
+        << "Merged tree " << name << ": " << tree->GetEntries() << " entries";
+      tree->Write();
+    } else {
+      TObject * obj = key->ReadObj();
+      fout.cd();
+      obj->Write(name.c_str());
+    }
+  }
+
+  fout.cd();
+  merged.Write("header");
+
+  first.Close();
+  fout.Close();
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gmerge", pINFO) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  // help?
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+
+  // input files
+  if( parser.OptionExists('i') ) {
+    gOptInpFiles = parser.ArgAsString('i');
+  } else {
+    LOG("gmerge", pFATAL) << "Unspecified input files - Exiting";
+    PrintSyntax();
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // output file
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  }
+
+  gOptAllowIncomplete = parser.OptionExists("allow-incomplete");
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gmerge", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gmerge [-h] -i input_files [-o output_file]"
+    << " [--allow-incomplete] [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
@@ -10,12 +10,13 @@
          gevgen_nosc [-h] 
                      [-r run#] 
                       -n n_of_events
-                     [-m decay_mode]
+                     [-m decay_mode[,decay_mode,...] | all]
 	              -g geometry
                      [-L geometry_length_units] 
                      [-D geometry_density_units]
                      [-t geometry_top_volume_name]
                      [-o output_event_file_prefix]
+                     [-j n_of_threads]
                      [--seed random_number_seed]
                      [--message-thresholds xml_file]
                      [--event-record-print-level level]
@@ -30,9 +31,14 @@
            -r 
               Specifies the MC run number [default: 1000].
            -n  
-              Specifies how many events to generate.
+              Specifies how many events to generate (per annihilation mode).
            -m 
-              Nucleon decay mode ID:
+              Annihilation mode ID, a comma separated list of IDs or `all'
+              (modes 1-16). The events of each mode are written in an
+              output file of their own when more than one mode is generated,
+              with the mode ID appended to the file prefix, eg
+              `gntp.mode1.1000.ghep.root'.
+              Annihilation mode ID:
              ---------------------------------------------------------
               ID |   Decay Mode                     
                  |                                  
@@ -104,6 +110,10 @@
               The default output filename is: 
               gntp.[run_number].ghep.root
               This cmd line arguments lets you override 'gntp'
+           -j
+              Number of event generation threads [default: 1].
+              Each thread generates every n-th event with its own copy of
+              the n-nbar oscillation generator; the events are written in order.
            --seed
               Random number seed.
 
@@ -125,12 +135,16 @@
 #include <vector>
 #include <sstream>
 
+#include <RVersion.h>
+#include <TROOT.h>
+#include <TMath.h>
 #include <TSystem.h> 
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/EventGen/ThreadedEventLoopI.h"
 #include "Framework/EventGen/GMCJMonitor.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
@@ -156,9 +170,18 @@ using namespace genie;
 // function prototypes
 void  GetCommandLineArgs (int argc, char ** argv);
 void  PrintSyntax        (void);
-int   SelectAnnihilationMode (int pdg_code);
+int   SelectAnnihilationMode (int pdg_code, NNBarOscMode_t mode);
 int   SelectInitState    (void);
-const EventRecordVisitorI * NeutronOscGenerator(void);
+string ModeFilePrefix    (NNBarOscMode_t mode);
+void  GenerateEvents     (NNBarOscMode_t mode, int imode,
+                          const EventRecordVisitorI * mcgen,
+                          NtpWriter & ntpw, GMCJMonitor & mcjmonitor);
+void  GenerateEvents     (NNBarOscMode_t mode, int imode,
+                          const vector<const EventRecordVisitorI *> & mcgens,
+                          NtpWriter & ntpw, GMCJMonitor & mcjmonitor);
+EventRecord * GenerateEvent (NNBarOscMode_t mode, Long64_t ikey,
+                             const EventRecordVisitorI * mcgen);
+const EventRecordVisitorI * NeutronOscGenerator(bool adopt = false);
 
 //
 string          kDefOptGeomLUnits   = "mm";    // default geometry length units
@@ -168,8 +191,8 @@ string          kDefOptEvFilePrefix = "gntp";
 
 //
 Long_t             gOptRunNu        = 1000;                // run number
-int                gOptNev          = 10;                  // number of events to generate
-NNBarOscMode_t     gOptDecayMode    = kNONull;             // neutron oscillation mode
+int                gOptNev          = 10;                  // number of events to generate (per annihilation mode)
+vector<NNBarOscMode_t> gOptDecayModes;                     // neutron oscillation modes
 string             gOptEvFilePrefix = kDefOptEvFilePrefix; // event file prefix
 bool               gOptUsingRootGeom = false;              // using root geom or target mix?
 map<int,double>    gOptTgtMix;                             // target mix  (tgt pdg -> wght frac) / if not using detailed root geom
@@ -178,6 +201,7 @@ string             gOptRootGeomTopVol = "";                // input geometry top
 double             gOptGeomLUnits = 0;                     // input geometry length units 
 double             gOptGeomDUnits = 0;                     // input geometry density units 
 long int           gOptRanSeed = -1;                       // random number seed
+int                gOptNThreads = 1;                       // number of event generation threads
 
 //_________________________________________________________________________________________
 int main(int argc, char ** argv)
@@ -189,11 +213,6 @@ int main(int argc, char ** argv)
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::RandGen(gOptRanSeed);
 
-  // Initialize an Ntuple Writer to save GHEP records into a TTree
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
-  ntpw.Initialize();
-
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
@@ -201,9 +220,88 @@ int main(int argc, char ** argv)
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
-  // Get the nucleon decay generator
-  const EventRecordVisitorI * mcgen = NeutronOscGenerator();
+  // Get the n-nbar oscillation generators: the one of the algorithm factory
+  // and, for each additional thread, a private copy (with its own
+  // sub-algorithms and caches). They are all configured here, serially, as
+  // the algorithm factory and the configuration pool are not thread-safe.
+  vector<const EventRecordVisitorI *> mcgens;
+  for(int ithread = 0; ithread < gOptNThreads; ithread++) {
+     mcgens.push_back(NeutronOscGenerator(ithread > 0));
+  }
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  if(gOptNThreads > 1) ROOT::EnableThreadSafety();
+#endif
+
+  // Generate the events of each annihilation mode in an output file of its own
+  for(unsigned int imode = 0; imode < gOptDecayModes.size(); imode++) {
+     NNBarOscMode_t mode = gOptDecayModes[imode];
+
+     LOG("gevgen_nnbar_osc", pNOTICE)
+        << " *** Generating " << gOptNev << " events for annihilation mode "
+        << utils::nnbar_osc::AsString(mode);
+
+     // Initialize an Ntuple Writer to save GHEP records into a TTree
+     NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+     ntpw.CustomizeFilenamePrefix(ModeFilePrefix(mode));
+     ntpw.Initialize();
+
+     if(gOptNThreads > 1) {
+       GenerateEvents(mode, imode, mcgens, ntpw, mcjmonitor);
+     } else {
+       GenerateEvents(mode, imode, mcgens[0], ntpw, mcjmonitor);
+     }
+
+     // Save the generated event tree & close the output file
+     ntpw.Save();
+  }
+
+  // Clean-up the generators owned by the job
+  for(unsigned int i = 1; i < mcgens.size(); i++) {
+     delete mcgens[i];
+  }
+
+  LOG("gevgen_nnbar_osc", pNOTICE) << "Done!";
+
+  return 0;
+}
+//_________________________________________________________________________________________
+string ModeFilePrefix(NNBarOscMode_t mode)
+{
+// The output file prefix of an annihilation mode: the input prefix if there
+// is a single mode, otherwise the input prefix followed by the mode ID,
+// eg `gntp.mode1'
+
+  if(gOptDecayModes.size() == 1) return gOptEvFilePrefix;
+
+  ostringstream prefix;
+  prefix << gOptEvFilePrefix << ".mode" << (int) mode;
+  return prefix.str();
+}
+//_________________________________________________________________________________________
+EventRecord * GenerateEvent(
+   NNBarOscMode_t mode, Long64_t ikey, const EventRecordVisitorI * mcgen)
+{
+  // with counter-based random number streams, the event is keyed by
+  // its index in the job, whichever thread generates it
+  RandomGen * rnd = RandomGen::Instance();
+  if(rnd->CounterBased()) rnd->SetEventIndex(ikey);
+
+  EventRecord * event = new EventRecord;
+  int target = SelectInitState();
+  int decay = SelectAnnihilationMode(target, mode);
+  Interaction * interaction = Interaction::NOsc(target,decay);
+  event->AttachSummary(interaction);
 
+  // Simulate decay     
+  mcgen->ProcessEventRecord(event);
+
+  return event;
+}
+//_________________________________________________________________________________________
+void GenerateEvents(
+   NNBarOscMode_t mode, int imode, const EventRecordVisitorI * mcgen,
+   NtpWriter & ntpw, GMCJMonitor & mcjmonitor)
+{
   // Event loop
   int ievent = 0;
   while (1)
@@ -213,38 +311,77 @@ int main(int argc, char ** argv)
      LOG("gevgen_nnbar_osc", pNOTICE)
           << " *** Generating event............ " << ievent;
 
-     EventRecord * event = new EventRecord;
-     int target = SelectInitState();
-     int decay = SelectAnnihilationMode(target);
-     Interaction * interaction = Interaction::NOsc(target,decay);
-     event->AttachSummary(interaction);
-
-     // Simulate decay     
-     mcgen->ProcessEventRecord(event);
+     Long64_t ikey = (Long64_t) imode * gOptNev + ievent;
+     EventRecord * event = GenerateEvent(mode, ikey, mcgen);
 
      LOG("gevgen_nnbar_osc", pINFO)
          << "Generated event: " << *event;
 
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
+     mcjmonitor.Update(ikey,event);
      delete event;
 
      ievent++;
   } // event loop
+}
+//_________________________________________________________________________________________
+namespace {
+  // The multi-threaded event loop of an annihilation mode: thread i
+  // generates the events i, i+nthreads, ... with its own generator
+  class OscLoop : public ThreadedEventLoopI {
+  public:
+    OscLoop(NNBarOscMode_t mode, int imode,
+            const vector<const EventRecordVisitorI *> & mcgens,
+            NtpWriter & ntpw, GMCJMonitor & mcjmonitor) :
+      fMode(mode), fIMode(imode), fGenerators(mcgens),
+      fNtpWriter(ntpw), fMonitor(mcjmonitor) { }
+
+  protected:
+    EventRecord * GenerateEvent(int ithread, long int ievent)
+    {
+      Long64_t ikey = (Long64_t) fIMode * gOptNev + ievent;
+      return ::GenerateEvent(fMode, ikey, fGenerators[ithread]);
+    }
+    void WriteEvent(long int ievent, EventRecord * event)
+    {
+      LOG("gevgen_nnbar_osc", pINFO)
+          << "Generated event: " << *event;
+
+      Long64_t ikey = (Long64_t) fIMode * gOptNev + ievent;
+      fNtpWriter.AddEventRecord(ievent, event);
+      fMonitor.Update(ikey,event);
+    }
 
-  // Save the generated event tree & close the output file
-  ntpw.Save();
+  private:
+    NNBarOscMode_t                              fMode;
+    int                                         fIMode;
+    const vector<const EventRecordVisitorI *> & fGenerators;
+    NtpWriter &                                 fNtpWriter;
+    GMCJMonitor &                               fMonitor;
+  };
+}
+//_________________________________________________________________________________________
+void GenerateEvents(
+   NNBarOscMode_t mode, int imode,
+   const vector<const EventRecordVisitorI *> & mcgens,
+   NtpWriter & ntpw, GMCJMonitor & mcjmonitor)
+{
+// Multi-threaded event loop: thread i generates events i, i+nthreads, ...
+// with its own generator and random number generator, and the calling
+// thread writes them in order (see ThreadedEventLoopI). Without
+// counter-based streams, the thread seeds differ for each mode.
 
-  LOG("gevgen_nnbar_osc", pNOTICE) << "Done!";
+  int nthreads = mcgens.size();
 
-  return 0;
+  OscLoop loop(mode, imode, mcgens, ntpw, mcjmonitor);
+  loop.Run(gOptNev, nthreads, imode * nthreads);
 }
 //_________________________________________________________________________________________
-int SelectAnnihilationMode(int pdg_code)
+int SelectAnnihilationMode(int pdg_code, NNBarOscMode_t mode_opt)
 {
   // if the mode is set to 'random' (the default), pick one at random!
-  if (gOptDecayMode == kNORandom) {
+  if (mode_opt == kNORandom) {
     int mode;
 
     std::string pdg_string = std::to_string(static_cast<long long>(pdg_code));
@@ -279,7 +416,6 @@ int SelectAnnihilationMode(int pdg_code)
 
     // randomly generate a number between 1 and 0
     RandomGen * rnd = RandomGen::Instance();
-    rnd->SetSeed(0);
     double p = rnd->RndNum().Rndm();
 
     // loop through all modes, figure out which one our random number corresponds to
@@ -301,7 +437,7 @@ int SelectAnnihilationMode(int pdg_code)
 
   // if specific annihilation mode specified, just use that
   else {
-    int mode = (int) gOptDecayMode;
+    int mode = (int) mode_opt;
     return mode;
   }
 }
@@ -320,13 +456,22 @@ int SelectInitState(void)
   return pdg_code;
 }
 //_________________________________________________________________________________________
-const EventRecordVisitorI * NeutronOscGenerator(void)
+const EventRecordVisitorI * NeutronOscGenerator(bool adopt)
 {
+// Returns the neutron oscillation generator of the algorithm factory or, if
+// adopt is set, a copy owned by the caller, along with its sub-algorithms
+
   string sname   = "genie::EventGenerator";
   string sconfig = "NNBarOsc";
   AlgFactory * algf = AlgFactory::Instance();
-  const EventRecordVisitorI * mcgen =
-     dynamic_cast<const EventRecordVisitorI *> (algf->GetAlgorithm(sname,sconfig));
+  const EventRecordVisitorI * mcgen = 0;
+  if(adopt) {
+     Algorithm * alg = algf->AdoptAlgorithm(sname,sconfig);
+     if(alg) alg->AdoptSubstructure();
+     mcgen = dynamic_cast<const EventRecordVisitorI *> (alg);
+  } else {
+     mcgen = dynamic_cast<const EventRecordVisitorI *> (algf->GetAlgorithm(sname,sconfig));
+  }
   if(!mcgen) {
      LOG("gevgen_nnbar_osc", pFATAL)
        << "Couldn't instantiate the neutron oscillation generator";
@@ -376,20 +521,32 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(0);
   } //-n
 
-  // decay mode
-  int mode = 0;
+  // decay mode(s): a single mode (random by default), a comma separated
+  // list of modes or all of them
+  string modes = "0";
   if( parser.OptionExists('m') ) {
     LOG("gevgen_nnbar_osc", pDEBUG) 
         << "Reading annihilation mode";
-    mode = parser.ArgAsInt('m');
+    modes = parser.ArgAsString('m');
   }
-  gOptDecayMode = (NNBarOscMode_t) mode;
-  bool valid_mode = utils::nnbar_osc::IsValidMode(gOptDecayMode);
-  if(!valid_mode) {
-    LOG("gevgen_nnbar_osc", pFATAL) 
-        << "You need to specify a valid annihilation mode";
-    PrintSyntax();
-    exit(0);
+  gOptDecayModes.clear();
+  if(modes == "all") {
+    for(int mode = (int) kNOpto1pip1pi0; mode <= (int) kNOnto2pip2pim2pi0; mode++) {
+      gOptDecayModes.push_back((NNBarOscMode_t) mode);
+    }
+  } else {
+    vector<string> modev = utils::str::Split(modes, ",");
+    for(unsigned int i = 0; i < modev.size(); i++) {
+      NNBarOscMode_t mode = (NNBarOscMode_t) atoi(modev[i].c_str());
+      bool valid_mode = utils::nnbar_osc::IsValidMode(mode);
+      if(!valid_mode) {
+        LOG("gevgen_nnbar_osc", pFATAL) 
+            << "You need to specify a valid annihilation mode";
+        PrintSyntax();
+        exit(0);
+      }
+      gOptDecayModes.push_back(mode);
+    }
   } //-m
 
   //
@@ -511,6 +668,15 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // number of event generation threads
+  if( parser.OptionExists('j') ) {
+    LOG("gevgen_nnbar_osc", pINFO) << "Reading number of threads";
+    gOptNThreads = TMath::Max(1, parser.ArgAsInt('j'));
+  } else {
+    LOG("gevgen_nnbar_osc", pINFO) << "Unspecified number of threads - Using 1";
+    gOptNThreads = 1;
+  }
+
   //
   // >>> print the command line options
   //
@@ -538,6 +704,16 @@ void GetCommandLineArgs(int argc, char ** argv)
     }
   }
 
+  ostringstream modeinfo;
+  for(unsigned int imode = 0; imode < gOptDecayModes.size(); imode++) {
+    NNBarOscMode_t mode = gOptDecayModes[imode];
+    if(imode > 0) modeinfo << "\n                   ";
+    modeinfo << utils::nnbar_osc::AsString(mode);
+    if(gOptDecayModes.size() > 1) {
+      modeinfo << " -> " << ModeFilePrefix(mode);
+    }
+  }
+
   LOG("gevgen_nnbar_osc", pNOTICE)
      << "\n\n"
      << utils::print::PrintFramedMesg("gevgen_nosc job configuration");
@@ -545,9 +721,11 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gevgen_nnbar_osc", pNOTICE) 
      << "\n @@ Run number: " << gOptRunNu
      << "\n @@ Random number seed: " << gOptRanSeed
-     << "\n @@ Decay channel $ " << utils::nnbar_osc::AsString(gOptDecayMode)
+     << "\n @@ Decay channel $ " << modeinfo.str()
      << "\n @@ Geometry      $ " << gminfo.str()
-     << "\n @@ Statistics    $ " << gOptNev << " events";
+     << "\n @@ Statistics    $ " << gOptNev << " events"
+     << ((gOptDecayModes.size() > 1) ? " per annihilation mode" : "")
+     << "\n @@ Threads       $ " << gOptNThreads;
 
   //
   // Temporary warnings...
@@ -568,13 +746,14 @@ void PrintSyntax(void)
    << "\n **Syntax**"
    << "\n gevgen_nnbarosc [-h] "
    << "\n             [-r run#]"
-   << "\n              -m decay_mode"
+   << "\n             [-m decay_mode[,decay_mode,...] | all]"
    << "\n              -g geometry"
    << "\n             [-t top_volume_name_at_geom]"
    << "\n             [-L length_units_at_geom]"
    << "\n             [-D density_units_at_geom]"
    << "\n              -n n_of_events "
    << "\n             [-o output_event_file_prefix]"
+   << "\n             [-j n_of_threads]"
    << "\n             [--seed random_number_seed]"
    << "\n             [--message-thresholds xml_file]"
    << "\n             [--event-record-print-level level]"
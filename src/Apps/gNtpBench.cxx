@@ -0,0 +1,441 @@
+//____________________________________________________________________________
+/*!
+
+\program gntpbench
+
+\brief   A GENIE GHEP output settings benchmark (gntpbench).
+
+         Reads events from an existing GHEP event file and re-writes them,
+         using genie::NtpWriter, once for each requested combination of
+         output compression, basket size and auto-flush (cluster size).
+         For each setting it reports:
+           - the write throughput (events/sec and uncompressed MB/sec,
+             as measured by NtpWriter, see NtpWriter::WriteTime()),
+           - the output file size and the compression factor,
+           - the sequential read throughput (events/sec) and
+           - the random read throughput (events/sec), reading a fixed
+             sequence of randomly chosen events.
+         The input events are held in memory, so that reading the input
+         file is not included in the measured write time.
+
+         Syntax :
+           gntpbench [-h]
+                      -i input_ghep_file
+                     [-n nev]
+                     [-c compression_list]
+                     [-b basket_size_list]
+                     [-a auto_flush_list]
+                     [-r nrandom_reads]
+                     [-o summary_file]
+                     [--keep-files]
+                     [--output-split-level split]
+                     [--message-thresholds xml_file]
+
+         Options :
+           [] Denotes an optional argument.
+           -h
+              Prints-out help on using gntpbench and exits.
+           -i
+              Specifies the input GHEP event file.
+           -n
+              Specifies the number of input events to re-write.
+              [default: all events in the input file, up to 10000]
+           -c
+              A comma separated list of output compression settings, each
+              as algorithm:level (zlib, lzma, lz4 or zstd, and 0-9).
+              [default: zlib:1,lzma:5,lz4:4,zstd:5]
+           -b
+              A comma separated list of event branch basket sizes (bytes).
+              [default: --output-basket-size, if set, otherwise 32000]
+           -a
+              A comma separated list of auto-flush settings, as in
+              TTree::SetAutoFlush(): events if > 0, bytes if < 0.
+              [default: --output-auto-flush, if set, otherwise -30000000]
+           -r
+              Specifies the number of random event reads.
+              [default: 1000]
+           -o
+              Specifies a text file where the summary table is also written.
+           --keep-files
+              Keep the written files (gntpbench.<setting number>.ghep.root).
+              [default: the files are removed after each setting is measured]
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <chrono>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TMath.h>
+#include <TRandom3.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+using std::ostream;
+using std::ostringstream;
+using std::ofstream;
+using std::endl;
+using std::setw;
+using std::setprecision;
+using std::fixed;
+
+using namespace genie;
+
+// results for a single output setting
+struct NtpBenchResult_t {
+  bool     ok;         // true if the setting was supported and measured
+  string   setting;    // compression / basket size / auto-flush
+  int      nev;        // number of written events
+  double   twrite;     // time spent writing (sec)
+  Long64_t totbytes;   // uncompressed tree size (bytes)
+  Long64_t zipbytes;   // compressed tree size (bytes)
+  Long64_t filesize;   // output file size (bytes)
+  double   tread;      // time to read all events sequentially (sec)
+  double   trandom;    // time to read the random event sequence (sec)
+};
+
+void             GetCommandLineArgs (int argc, char ** argv);
+void             PrintSyntax        (void);
+void             ReadEvents         (vector<EventRecord *> & events);
+NtpBenchResult_t Run                (int iset, string compression,
+                                     int basket_size, Long64_t auto_flush,
+                                     const vector<EventRecord *> & events);
+void             MeasureReads       (string filename, NtpBenchResult_t & res);
+void             PrintSummary       (ostream & stream,
+                                     const vector<NtpBenchResult_t> & results);
+
+// Default options (override them using the command line arguments):
+Long64_t kDefOptNevents     = 10000;
+int      kDefOptNRandom     = 1000;
+string   kDefOptCompression = "zlib:1,lzma:5,lz4:4,zstd:5";
+int      kDefOptBasketSize  = 32000;
+Long64_t kDefOptAutoFlush   = -30000000;
+long     kDefOptRanSeed     = 12345;
+
+// User-specified options:
+string           gOptInpFileName;  // input GHEP file
+Long64_t         gOptNevents;      // number of events to re-write
+int              gOptNRandom;      // number of random reads
+vector<string>   gOptCompression;  // compression settings
+vector<long>     gOptBasketSizes;  // basket sizes
+vector<long>     gOptAutoFlush;    // auto-flush settings
+string           gOptSummaryFile;  // optional summary file
+bool             gOptKeepFiles;    // keep the written files?
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  vector<EventRecord *> events;
+  ReadEvents(events);
+
+  vector<NtpBenchResult_t> results;
+
+  int iset = 0;
+  vector<string>::const_iterator comp_iter = gOptCompression.begin();
+  for( ; comp_iter != gOptCompression.end(); ++comp_iter) {
+    vector<long>::const_iterator basket_iter = gOptBasketSizes.begin();
+    for( ; basket_iter != gOptBasketSizes.end(); ++basket_iter) {
+      vector<long>::const_iterator flush_iter = gOptAutoFlush.begin();
+      for( ; flush_iter != gOptAutoFlush.end(); ++flush_iter) {
+        results.push_back(
+           Run(iset++, *comp_iter, *basket_iter, *flush_iter, events));
+      }
+    }
+  }
+
+  PrintSummary(std::cout, results);
+
+  if(gOptSummaryFile.size() > 0) {
+    ofstream summary(gOptSummaryFile.c_str());
+    PrintSummary(summary, results);
+    summary.close();
+  }
+
+  vector<EventRecord *>::iterator ev_iter = events.begin();
+  for( ; ev_iter != events.end(); ++ev_iter) delete *ev_iter;
+
+  vector<NtpBenchResult_t>::const_iterator res_iter = results.begin();
+  for( ; res_iter != results.end(); ++res_iter) {
+    if(!res_iter->ok) return 1;
+  }
+  return 0;
+}
+//____________________________________________________________________________
+void ReadEvents(vector<EventRecord *> & events)
+{
+  TFile fin(gOptInpFileName.c_str(),"READ");
+  TTree * tree = dynamic_cast <TTree *> ( fin.Get("gtree") );
+  if (!tree) {
+    LOG("gntpbench", pFATAL) << "Null input GHEP event tree";
+    exit(1);
+  }
+
+  NtpMCEventRecord * mcrec = 0;
+  tree->SetBranchAddress("gmcrec", &mcrec);
+
+  Long64_t nev = TMath::Min(tree->GetEntries(), gOptNevents);
+  if (nev <= 0) {
+    LOG("gntpbench", pFATAL) << "No input events";
+    exit(1);
+  }
+
+  LOG("gntpbench", pNOTICE) << "*** Reading " << nev << " input events";
+
+  for(Long64_t iev = 0; iev < nev; iev++) {
+    tree->GetEntry(iev);
+    events.push_back(new EventRecord(*mcrec->event));
+    mcrec->Clear();
+  }
+}
+//____________________________________________________________________________
+NtpBenchResult_t Run(int iset, string compression,
+      int basket_size, Long64_t auto_flush, const vector<EventRecord *> & events)
+{
+  NtpBenchResult_t res;
+  res.ok       = false;
+  res.nev      = 0;
+  res.twrite   = 0;
+  res.totbytes = 0;
+  res.zipbytes = 0;
+  res.filesize = 0;
+  res.tread    = 0;
+  res.trandom  = 0;
+
+  ostringstream setting;
+  setting << compression << " | basket:" << basket_size
+          << " flush:" << auto_flush;
+  res.setting = setting.str();
+
+  LOG("gntpbench", pNOTICE) << "*** Output setting: " << res.setting;
+
+  // skip settings not supported by this ROOT version
+  vector<string> tokens = utils::str::Split(compression, ":");
+  int level = (tokens.size() > 1) ? atoi(tokens[1].c_str()) : 0;
+  if(tokens.size() == 0 ||
+     NtpWriter::CompressionSettings(tokens[0], level) < 0) {
+    LOG("gntpbench", pERROR) << "Unsupported compression: " << compression;
+    return res;
+  }
+
+  ostringstream filename;
+  filename << "gntpbench." << iset << ".ghep.root";
+
+  NtpWriter ntpw(kNFGHEP, iset);
+  ntpw.CustomizeFilename(filename.str());
+  ntpw.SetCompression(compression);
+  ntpw.SetBasketSize(basket_size);
+  ntpw.SetAutoFlush(auto_flush);
+  ntpw.Initialize();
+
+  for(unsigned int iev = 0; iev < events.size(); iev++) {
+    ntpw.AddEventRecord(iev, events[iev]);
+  }
+  ntpw.Save();
+
+  res.ok       = true;
+  res.nev      = events.size();
+  res.twrite   = ntpw.WriteTime();
+  res.totbytes = ntpw.TotBytes();
+  res.zipbytes = ntpw.ZipBytes();
+  res.filesize = ntpw.FileSize();
+
+  MeasureReads(filename.str(), res);
+
+  if(!gOptKeepFiles) remove(filename.str().c_str());
+
+  return res;
+}
+//____________________________________________________________________________
+void MeasureReads(string filename, NtpBenchResult_t & res)
+{
+  TFile fin(filename.c_str(),"READ");
+  TTree * tree = dynamic_cast <TTree *> ( fin.Get("gtree") );
+  if (!tree) {
+    LOG("gntpbench", pERROR) << "Could not read back: " << filename;
+    res.ok = false;
+    return;
+  }
+
+  NtpMCEventRecord * mcrec = 0;
+  tree->SetBranchAddress("gmcrec", &mcrec);
+  Long64_t nev = tree->GetEntries();
+
+  // sequential read
+  std::chrono::steady_clock::time_point tstart =
+                                      std::chrono::steady_clock::now();
+  for(Long64_t iev = 0; iev < nev; iev++) {
+    tree->GetEntry(iev);
+    mcrec->Clear();
+  }
+  res.tread = std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - tstart).count();
+
+  // random reads: the same sequence of events for all settings
+  TRandom3 rnd(kDefOptRanSeed);
+  tstart = std::chrono::steady_clock::now();
+  for(int i = 0; i < gOptNRandom; i++) {
+    tree->GetEntry( (Long64_t) rnd.Integer(nev) );
+    mcrec->Clear();
+  }
+  res.trandom = std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - tstart).count();
+
+  tree->ResetBranchAddresses();
+  delete mcrec;
+}
+//____________________________________________________________________________
+void PrintSummary(ostream & stream, const vector<NtpBenchResult_t> & results)
+{
+  double mb = 1024. * 1024.;
+
+  stream << endl << "** gntpbench summary: input: " << gOptInpFileName
+         << ", random reads: " << gOptNRandom << endl;
+  stream << setw(45) << "output setting"
+         << " | " << setw(10) << "write ev/s"
+         << " | " << setw(10) << "write MB/s"
+         << " | " << setw(10) << "size (MB)"
+         << " | " << setw(8)  << "factor"
+         << " | " << setw(10) << "read ev/s"
+         << " | " << setw(10) << "rndm ev/s" << endl;
+
+  vector<NtpBenchResult_t>::const_iterator iter = results.begin();
+  for( ; iter != results.end(); ++iter) {
+    const NtpBenchResult_t & res = *iter;
+    stream << setw(45) << res.setting << " | ";
+    if(!res.ok) {
+      stream << "FAILED / UNSUPPORTED" << endl;
+      continue;
+    }
+    double wrate  = (res.twrite  > 0) ? res.nev / res.twrite : 0.;
+    double wmb    = (res.twrite  > 0) ? res.totbytes / mb / res.twrite : 0.;
+    double factor = (res.zipbytes > 0) ? double(res.totbytes) / res.zipbytes : 0.;
+    double rrate  = (res.tread   > 0) ? res.nev / res.tread : 0.;
+    double rndm   = (res.trandom > 0) ? gOptNRandom / res.trandom : 0.;
+    stream << fixed << setprecision(2)
+           << setw(10) << wrate              << " | "
+           << setw(10) << wmb                << " | "
+           << setw(10) << res.filesize / mb  << " | "
+           << setw(8)  << factor             << " | "
+           << setw(10) << rrate              << " | "
+           << setw(10) << rndm               << endl;
+    stream.unsetf(std::ios_base::floatfield);
+  }
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gntpbench", pINFO) << "Parsing command line arguments";
+
+  // Common run options (message thresholds, output defaults, ...)
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  // help?
+  if( parser.OptionExists('h') ) {
+      PrintSyntax();
+      exit(0);
+  }
+
+  // input file
+  if( parser.OptionExists('i') ) {
+    gOptInpFileName = parser.ArgAsString('i');
+  } else {
+    LOG("gntpbench", pFATAL) << "Unspecified input filename - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  // number of events
+  gOptNevents = (parser.OptionExists('n')) ?
+                 parser.ArgAsLong('n') : kDefOptNevents;
+
+  // compression settings
+  string compression = (parser.OptionExists('c')) ?
+                        parser.ArgAsString('c') : kDefOptCompression;
+  gOptCompression = utils::str::Split(compression, ",");
+
+  // basket sizes
+  if( parser.OptionExists('b') ) {
+    gOptBasketSizes = parser.ArgAsLongTokens('b', ",");
+  } else {
+    int basket_size = RunOpt::Instance()->OutputBasketSize();
+    gOptBasketSizes.push_back( (basket_size > 0) ?
+                               basket_size : kDefOptBasketSize );
+  }
+
+  // auto-flush settings
+  if( parser.OptionExists('a') ) {
+    gOptAutoFlush = parser.ArgAsLongTokens('a', ",");
+  } else {
+    long auto_flush = RunOpt::Instance()->OutputAutoFlush();
+    gOptAutoFlush.push_back( (auto_flush != 0) ?
+                             auto_flush : kDefOptAutoFlush );
+  }
+
+  // number of random reads
+  gOptNRandom = (parser.OptionExists('r')) ?
+                 parser.ArgAsInt('r') : kDefOptNRandom;
+
+  // summary file
+  gOptSummaryFile = (parser.OptionExists('o')) ? parser.ArgAsString('o') : "";
+
+  // keep the written files?
+  gOptKeepFiles = parser.OptionExists("keep-files");
+
+  if(gOptCompression.size() == 0 || gOptBasketSizes.size() == 0 ||
+     gOptAutoFlush.size() == 0) {
+    LOG("gntpbench", pFATAL) << "No output settings to measure";
+    PrintSyntax();
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gntpbench", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "\n      gntpbench [-h]"
+    << "\n                 -i input_ghep_file"
+    << "\n                [-n nev]"
+    << "\n                [-c compression_list]"
+    << "\n                [-b basket_size_list]"
+    << "\n                [-a auto_flush_list]"
+    << "\n                [-r nrandom_reads]"
+    << "\n                [-o summary_file]"
+    << "\n                [--keep-files]"
+    << "\n                [--output-split-level split]"
+    << "\n                [--message-thresholds xml_file]"
+    << "\n";
+}
+//____________________________________________________________________________
@@ -7,7 +7,8 @@
          plain text, XML or bare-ROOT formats.
 
          Syntax:
-           gntpc -i input_file [-o output_file] -f format [-n nev] [-v vrs] [-c] 
+           gntpc -i input_file [-o output_file] -f format(s) [-n nev] [-v vrs] [-c] 
+                 [-j nworkers]
                  [--seed random_number_seed]
                  [--message-thresholds xml_file]
                  [--event-record-print-level level]
@@ -25,8 +26,18 @@
               (optional, default: use latest version of each format)
            -c 
               Copy MC job metadata (gconfig and genv TFolders) from the input GHEP file.
+           -j
+              Number of worker processes. The input events are split in as many
+              contiguous entry ranges, converted in parallel to per-chunk files
+              which are then merged in order (ROOT trees are fast-cloned, text
+              files are concatenated). Counter-based random number streams are
+              used, so that the output does not depend on the number of workers.
+              (optional, default: 1)
            -f 
               A string that specifies the output file format. 
+              A comma separated list of formats may be given, eg `gst,gxml':
+              the input events are then read once and converted to all of them,
+              each to the default output file of its format.
               >>
 	      >> Generic formats:
               >>
@@ -34,6 +45,12 @@
                     The 'definite' GENIE summary tree format (gst).
    	       * `gxml': 
                      GENIE XML event format 
+   	       * `ghep': 
+                     GHEP event tree with the full event records (eg to convert
+                     back a compact GHEP file for tools reading full records)
+   	       * `compact_ghep': 
+                     GHEP event tree with the compact event record encoding
+                     (single precision particle kinematics, see NtpMCCompactRecord)
    	       * `ghep_mock_data': 
                      Output file has the same format as the input file (GHEP) but
                      all information other than final state particles is hidden
@@ -80,6 +97,8 @@
               input base name and an extension depending on the file format: 
                `gst'                  -> *.gst.root
                `gxml'                 -> *.gxml 
+               `ghep'                 -> *.ghep.root
+               `compact_ghep'         -> *.cghep.root
                `ghep_mock_data'       -> *.mockd.ghep.root
                `rootracker'           -> *.gtrac.root
                `rootracker_mock_data' -> *.mockd.gtrac.root
@@ -106,6 +125,13 @@
                 t2k_rootracker format. 
                 The output file is named myfile.gtrac.root
 
+           (2)  shell% gntpc -i myfile.ghep.root -f gst,rootracker -j 8
+
+                Converts all events in the GHEP file myfile.ghep.root into both
+                the gst and the rootracker formats, reading the input file once,
+                using 8 worker processes. 
+                The output files are named myfile.gst.root and myfile.gtrac.root
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -123,18 +149,30 @@
 #include <fstream>
 #include <iomanip>
 #include <vector>
+#include <map>
+#include <set>
+#include <utility>
+#include <functional>
 #include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
 
 #include <TSystem.h>
+#include <TROOT.h>
 #include <TFile.h>
 #include <TTree.h>
+#include <TChain.h>
+#include <TKey.h>
+#include <TClass.h>
 #include <TFolder.h>
 #include <TBits.h>
 #include <TObjString.h>
 #include <TMath.h>
+#include <RVersion.h>
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Framework/Conventions/GBuild.h"
@@ -147,6 +185,8 @@
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCCompactRecord.h"
+#include "Framework/Ntuple/NtpGSTRecord.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Messenger/Messenger.h"
@@ -176,29 +216,19 @@ using std::setfill;
 using std::ios;
 using std::setiosflags;
 using std::vector;
+using std::map;
+using std::pair;
 
 using namespace genie;
 using namespace genie::constants;
 
-//func prototypes
-void   ConvertToGST              (void);
-void   ConvertToGXML             (void);
-void   ConvertToGHepMock         (void);
-void   ConvertToGTracker         (void);
-void   ConvertToGRooTracker      (void);
-void   ConvertToGHad             (void);
-void   ConvertToGINuke           (void);
-void   GetCommandLineArgs        (int argc, char ** argv);
-void   PrintSyntax               (void);
-string DefaultOutputFile         (void);
-int    LatestFormatVersionNumber (void);
-bool   CheckRootFilename         (string filename);
-int    HAProbeFSI                (int, int, int, double [], int [], int, int, int); //Test code
 //format enum
 typedef enum EGNtpcFmt {
   kConvFmt_undef = 0,
   kConvFmt_gst,
   kConvFmt_gxml,
+  kConvFmt_ghep,
+  kConvFmt_compact_ghep,
   kConvFmt_ghep_mock_data,
   kConvFmt_rootracker,
   kConvFmt_rootracker_mock_data,
@@ -210,14 +240,104 @@ typedef enum EGNtpcFmt {
   kConvFmt_ginuke
 } GNtpcFmt_t;
 
+//____________________________________________________________________________________
+// The input GHEP events (of an entry range of the input event tree), read once
+// and handed over, in turn, to each requested conversion.
+// If more than one conversion is requested, each one runs on its own thread,
+// but only one of them runs at any time, so that the conversion code does not
+// need to be thread-safe: A conversion asking for the next event hands over
+// to the next conversion in the list, and the last one reads the next event.
+//
+class GNtpcInput {
+public:
+  GNtpcInput(string filename, Long64_t first, Long64_t last, int nconv);
+ ~GNtpcInput();
+
+  TFile *           File   (void) const { return fFile;   }
+  TTree *           Tree   (void) const { return fTree;   }
+  NtpMCTreeHeader * Header (void) const { return fHeader; }
+
+  // bind an additional input tree branch (all conversions binding the same
+  // branch share the same object)
+  template<class T> void SetBranchAddress (string name, T ** addr);
+
+  void Start     (int iconv);
+  bool NextEvent (int iconv, Long64_t & iev, NtpMCEventRecord * & mcrec);
+  void Finish    (int iconv);
+
+private:
+  void HandOver (int iconv);
+  void ReadNext (void);
+
+  TFile *                          fFile;     ///< input file
+  TTree *                          fTree;     ///< input GHEP event tree
+  NtpMCTreeHeader *                fHeader;   ///< input tree header
+  NtpMCEventRecord *               fMCRec;    ///< current event
+  NtpMCCompactRecord *             fCompact;  ///< current event, if the input records are compact
+  Long64_t                         fEntry;    ///< current entry
+  Long64_t                         fNext;     ///< next entry to read
+  Long64_t                         fLast;     ///< last entry to read + 1
+  bool                             fEnd;      ///< all entries read?
+  map<string, void **>             fBranches; ///< additional branches & the bound address
+  vector< pair<void **, void **> > fShared;   ///< other addresses for the same branches
+  vector<bool>                     fActive;   ///< conversions still running
+  int                              fTurn;     ///< conversion currently running
+  std::mutex                       fMutex;
+  std::condition_variable          fTurnCV;
+};
+
+//____________________________________________________________________________________
+// A requested conversion (of an entry range of the input file, to one format)
+//
+struct GNtpcJob_t {
+  GNtpcFmt_t   format;     ///< output file format id
+  string       outfile;    ///< output file name
+  int          version;    ///< output file format version
+  bool         copy_meta;  ///< copy MC job metadata (gconfig, genv TFolders)?
+  bool         header;     ///< write the file header (text formats)?
+  bool         footer;     ///< write the file footer (text formats)?
+  int          iconv;      ///< position in the list of conversions
+  GNtpcInput * input;      ///< the input events
+
+  bool NextEvent(Long64_t & iev, NtpMCEventRecord * & mcrec) {
+    return input->NextEvent(iconv, iev, mcrec);
+  }
+};
+
+//func prototypes
+void     ConvertToGST              (GNtpcJob_t & job);
+void     ConvertToGXML             (GNtpcJob_t & job);
+void     ConvertToGHep             (GNtpcJob_t & job);
+void     ConvertToGHepMock         (GNtpcJob_t & job);
+void     ConvertToGTracker         (GNtpcJob_t & job);
+void     ConvertToGRooTracker      (GNtpcJob_t & job);
+void     ConvertToGHad             (GNtpcJob_t & job);
+void     ConvertToGINuke           (GNtpcJob_t & job);
+void     Convert                   (GNtpcJob_t & job);
+void     RunConversion             (GNtpcJob_t & job);
+void     ConvertRange              (Long64_t first, Long64_t last, int ichunk, int nchunks);
+void     ConvertChunk              (int ichunk, int nchunks, Long64_t first, Long64_t last, void *);
+void     ConvertInParallel         (Long64_t nev);
+void     MergeChunks               (GNtpcFmt_t fmt, string outfile, const vector<string> & chunks);
+string   ChunkFilename             (string outfile, int ichunk);
+Long64_t NEventsToConvert          (void);
+bool     IsRootFormat              (GNtpcFmt_t fmt);
+void     GetCommandLineArgs        (int argc, char ** argv);
+void     PrintSyntax               (void);
+string   DefaultOutputFile         (GNtpcFmt_t fmt);
+int      LatestFormatVersionNumber (GNtpcFmt_t fmt);
+bool     CheckRootFilename         (string filename);
+int      HAProbeFSI                (int, int, int, double [], int [], int, int, int); //Test code
+
 //input options (from command line arguments):
-string     gOptInpFileName;         ///< input file name
-string     gOptOutFileName;         ///< output file name
-GNtpcFmt_t gOptOutFileFormat;       ///< output file format id
-int        gOptVersion;             ///< output file format version
-Long64_t   gOptN;                   ///< number of events to process
-bool       gOptCopyJobMeta = false; ///< copy MC job metadata (gconfig, genv TFolders)
-long int   gOptRanSeed;             ///< random number seed
+string             gOptInpFileName;         ///< input file name
+vector<GNtpcFmt_t> gOptOutFileFormats;      ///< output file format ids
+vector<string>     gOptOutFileNames;        ///< output file names (one per format)
+int                gOptVersion;             ///< output file format version (-1: latest)
+Long64_t           gOptN;                   ///< number of events to process
+bool               gOptCopyJobMeta = false; ///< copy MC job metadata (gconfig, genv TFolders)
+long int           gOptRanSeed;             ///< random number seed
+int                gOptNWorkers;            ///< number of parallel worker processes
 
 //genie version used to generate the input event file 
 int gFileMajorVrs = -1;
@@ -237,23 +357,42 @@ int main(int argc, char ** argv)
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
   PDGLibrary::Instance()->AddDarkMatter( 1.0, 0.5 ) ;
-  
+
+  Long64_t nev = NEventsToConvert();
+
+  if(gOptNWorkers > 1 && nev > 1) {
+    ConvertInParallel(nev);
+  } else {
+    ConvertRange(0, nev, 0, 1);
+  }
+
+  return 0;
+}
+//____________________________________________________________________________________
+void Convert(GNtpcJob_t & job)
+{
   // Call the appropriate conversion function
-  switch(gOptOutFileFormat) {
+  switch(job.format) {
 
    case (kConvFmt_gst)  :
 
-	ConvertToGST();        
+	ConvertToGST(job);        
 	break;  
 
    case (kConvFmt_gxml) :  
 
-	ConvertToGXML();         
+	ConvertToGXML(job);         
+	break;
+
+   case (kConvFmt_ghep         ) :  
+   case (kConvFmt_compact_ghep ) :  
+
+	ConvertToGHep(job);         
 	break;
 
    case (kConvFmt_ghep_mock_data) :  
 
-	ConvertToGHepMock();         
+	ConvertToGHepMock(job);         
 	break;
 
    case (kConvFmt_rootracker          ) :  
@@ -261,850 +400,424 @@ int main(int argc, char ** argv)
    case (kConvFmt_t2k_rootracker      ) :  
    case (kConvFmt_numi_rootracker     ) :  
 
-	ConvertToGRooTracker(); 
+	ConvertToGRooTracker(job); 
 	break;
 
    case (kConvFmt_t2k_tracker   )  :  
    case (kConvFmt_nuance_tracker)  :  
 
-	ConvertToGTracker();        
+	ConvertToGTracker(job);        
 	break;
 
    case (kConvFmt_ghad) :  
 
-	ConvertToGHad();         
+	ConvertToGHad(job);         
 	break;
 
    case (kConvFmt_ginuke) :  
 
-	ConvertToGINuke();         
+	ConvertToGINuke(job);         
 	break;
 
    default:
      LOG("gntpc", pFATAL)
-          << "Invalid output format [" << gOptOutFileFormat << "]";
+          << "Invalid output format [" << job.format << "]";
      PrintSyntax();
      gAbortingInErr = true;
      exit(3);
   }
-  return 0;
 }
 //____________________________________________________________________________________
-// GENIE GHEP EVENT TREE FORMAT -> GENIE SUMMARY NTUPLE 
+void RunConversion(GNtpcJob_t & job)
+{
+  job.input->Start(job.iconv);
+  Convert(job);
+  job.input->Finish(job.iconv);
+}
 //____________________________________________________________________________________
-void ConvertToGST(void)
+void ConvertRange(Long64_t first, Long64_t last, int ichunk, int nchunks)
 {
-  // Some constants
-  const double e_h = 1.3; // typical e/h ratio used for computing mean `calorimetric response'
-
-  // Define branch variables
-  //
-  int    brIev         = 0;      // Event number 
-  int    brNeutrino    = 0;      // Neutrino pdg code
-  int    brFSPrimLept  = 0;      // Final state primary lepton pdg code
-  int    brTarget      = 0;      // Nuclear target pdg code (10LZZZAAAI)
-  int    brTargetZ     = 0;      // Nuclear target Z (extracted from pdg code above)
-  int    brTargetA     = 0;      // Nuclear target A (extracted from pdg code above)
-  int    brHitNuc      = 0;      // Hit nucleon pdg code      (not set for COH,IMD and NuEL events)
-  int    brHitQrk      = 0;      // Hit quark pdg code        (set for DIS events only)
-  bool   brFromSea     = false;  // Hit quark is from sea     (set for DIS events only)
-  int    brResId       = 0;      // Produced baryon resonance (set for resonance events only)
-  bool   brIsQel       = false;  // Is QEL?
-  bool   brIsRes       = false;  // Is RES?
-  bool   brIsDis       = false;  // Is DIS?
-  bool   brIsCoh       = false;  // Is Coherent?
-  bool   brIsMec       = false;  // Is MEC?
-  bool   brIsDfr       = false;  // Is Diffractive?
-  bool   brIsImd       = false;  // Is IMD?
-  bool   brIsSingleK   = false;  // Is single kaon?  
-  bool   brIsImdAnh    = false;  // Is IMD annihilation?
-  bool   brIsNuEL      = false;  // Is ve elastic?
-  bool   brIsEM        = false;  // Is EM process?
-  bool   brIsCC        = false;  // Is Weak CC process?
-  bool   brIsNC        = false;  // Is Weak NC process?
-  bool   brIsCharmPro  = false;  // Produces charm?
-  bool   brIsAMNuGamma = false;  // is anomaly mediated nu gamma
-  int    brCodeNeut    = 0;      // The equivalent NEUT reaction code (if any)
-  int    brCodeNuance  = 0;      // The equivalent NUANCE reaction code (if any)
-  double brWeight      = 0;      // Event weight
-  double brKineXs      = 0;      // Bjorken x as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineYs      = 0;      // Inelasticity y as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineTs      = 0;      // Energy transfer to nucleus at COH events as was generated during kinematical selection
-  double brKineQ2s     = 0;      // Momentum transfer Q^2 as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineWs      = 0;      // Hadronic invariant mass W as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineX       = 0;      // Experimental-like Bjorken x; neglects fermi momentum / off-shellness 
-  double brKineY       = 0;      // Experimental-like inelasticity y; neglects fermi momentum / off-shellness 
-  double brKineT       = 0;      // Experimental-like energy transfer to nucleus at COH events 
-  double brKineQ2      = 0;      // Experimental-like momentum transfer Q^2; neglects fermi momentum / off-shellness
-  double brKineW       = 0;      // Experimental-like hadronic invariant mass W; neglects fermi momentum / off-shellness 
-  double brEvRF        = 0;      // Neutrino energy @ the rest-frame of the hit-object (eg nucleon for CCQE, e- for ve- elastic,...)
-  double brEv          = 0;      // Neutrino energy @ LAB
-  double brPxv         = 0;      // Neutrino px @ LAB
-  double brPyv         = 0;      // Neutrino py @ LAB
-  double brPzv         = 0;      // Neutrino pz @ LAB
-  double brEn          = 0;      // Initial state hit nucleon energy @ LAB
-  double brPxn         = 0;      // Initial state hit nucleon px @ LAB
-  double brPyn         = 0;      // Initial state hit nucleon py @ LAB
-  double brPzn         = 0;      // Initial state hit nucleon pz @ LAB
-  double brEl          = 0;      // Final state primary lepton energy @ LAB
-  double brPxl         = 0;      // Final state primary lepton px @ LAB
-  double brPyl         = 0;      // Final state primary lepton py @ LAB
-  double brPzl         = 0;      // Final state primary lepton pz @ LAB
-  double brPl          = 0;      // Final state primary lepton p  @ LAB
-  double brCosthl      = 0;      // Final state primary lepton cos(theta) wrt to neutrino direction
-  int    brNfP         = 0;      // Nu. of final state p's + \bar{p}'s (after intranuclear rescattering)
-  int    brNfN         = 0;      // Nu. of final state n's + \bar{n}'s
-  int    brNfPip       = 0;      // Nu. of final state pi+'s
-  int    brNfPim       = 0;      // Nu. of final state pi-'s
-  int    brNfPi0       = 0;      // Nu. of final state pi0's (
-  int    brNfKp        = 0;      // Nu. of final state K+'s
-  int    brNfKm        = 0;      // Nu. of final state K-'s
-  int    brNfK0        = 0;      // Nu. of final state K0's + \bar{K0}'s
-  int    brNfEM        = 0;      // Nu. of final state gammas and e-/e+ 
-  int    brNfOther     = 0;      // Nu. of heavier final state hadrons (D+/-,D0,Ds+/-,Lamda,Sigma,Lamda_c,Sigma_c,...)
-  int    brNiP         = 0;      // Nu. of `primary' (: before intranuclear rescattering) p's + \bar{p}'s  
-  int    brNiN         = 0;      // Nu. of `primary' n's + \bar{n}'s  
-  int    brNiPip       = 0;      // Nu. of `primary' pi+'s 
-  int    brNiPim       = 0;      // Nu. of `primary' pi-'s 
-  int    brNiPi0       = 0;      // Nu. of `primary' pi0's 
-  int    brNiKp        = 0;      // Nu. of `primary' K+'s  
-  int    brNiKm        = 0;      // Nu. of `primary' K-'s  
-  int    brNiK0        = 0;      // Nu. of `primary' K0's + \bar{K0}'s 
-  int    brNiEM        = 0;      // Nu. of `primary' gammas and e-/e+ 
-  int    brNiOther     = 0;      // Nu. of other `primary' hadron shower particles
-  int    brNf          = 0;      // Nu. of final state particles in hadronic system
-  int    brPdgf  [kNPmax];       // Pdg code of k^th final state particle in hadronic system
-  double brEf    [kNPmax];       // Energy     of k^th final state particle in hadronic system @ LAB
-  double brPxf   [kNPmax];       // Px         of k^th final state particle in hadronic system @ LAB
-  double brPyf   [kNPmax];       // Py         of k^th final state particle in hadronic system @ LAB
-  double brPzf   [kNPmax];       // Pz         of k^th final state particle in hadronic system @ LAB
-  double brPf    [kNPmax];       // P          of k^th final state particle in hadronic system @ LAB
-  double brCosthf[kNPmax];       // cos(theta) of k^th final state particle in hadronic system @ LAB wrt to neutrino direction
-  int    brNi          = 0;      // Nu. of particles in 'primary' hadronic system (before intranuclear rescattering)
-  int    brPdgi[kNPmax];         // Pdg code of k^th particle in 'primary' hadronic system 
-  int    brResc[kNPmax];         // FSI code of k^th particle in 'primary' hadronic system 
-  double brEi  [kNPmax];         // Energy   of k^th particle in 'primary' hadronic system @ LAB
-  double brPxi [kNPmax];         // Px       of k^th particle in 'primary' hadronic system @ LAB
-  double brPyi [kNPmax];         // Py       of k^th particle in 'primary' hadronic system @ LAB
-  double brPzi [kNPmax];         // Pz       of k^th particle in 'primary' hadronic system @ LAB
-  double brVtxX;                 // Vertex x in detector coord system (SI)
-  double brVtxY;                 // Vertex y in detector coord system (SI)
-  double brVtxZ;                 // Vertex z in detector coord system (SI)
-  double brVtxT;                 // Vertex t in detector coord system (SI)
-  double brSumKEf;               // Sum of kinetic energies of all final state particles
-  double brCalResp0;             // Approximate calorimetric response to the hadronic system computed as sum of
-				 //  - (kinetic energy) for pi+, pi-, p, n 
-                                 //  - (energy + 2*mass) for antiproton, antineutron
-                                 //  - ((e/h) * energy)   for pi0, gamma, e-, e+, where e/h is set to 1.3
-                                 //  - (kinetic energy) for other particles
-
-  // Open output file & create output summary tree & create the tree branches
-  //
-  LOG("gntpc", pNOTICE) 
-       << "*** Saving summary tree to: " << gOptOutFileName;
-  TFile fout(gOptOutFileName.c_str(),"recreate");
-
-  TTree * s_tree = new TTree("gst","GENIE Summary Event Tree");
-
-  // Create tree branches
-  //
-  s_tree->Branch("iev",           &brIev,           "iev/I"         );
-  s_tree->Branch("neu",	          &brNeutrino,      "neu/I"	    );
-  s_tree->Branch("fspl",	      &brFSPrimLept,    "fspl/I"	    );
-  s_tree->Branch("tgt",           &brTarget,        "tgt/I"	    );
-  s_tree->Branch("Z",             &brTargetZ,       "Z/I"	    );
-  s_tree->Branch("A",             &brTargetA,       "A/I"	    );
-  s_tree->Branch("hitnuc",        &brHitNuc,        "hitnuc/I"      );
-  s_tree->Branch("hitqrk",        &brHitQrk,        "hitqrk/I"      );
-  s_tree->Branch("resid",         &brResId,	    "resid/I"	    );
-  s_tree->Branch("sea",	          &brFromSea,       "sea/O"	    );
-  s_tree->Branch("qel",	          &brIsQel,	    "qel/O"	    );
-  s_tree->Branch("mec",	          &brIsMec,	    "mec/O"	    );
-  s_tree->Branch("res",	          &brIsRes,	    "res/O"	    );
-  s_tree->Branch("dis",	          &brIsDis,	    "dis/O"	    );
-  s_tree->Branch("coh",           &brIsCoh,         "coh/O"	    );
-  s_tree->Branch("dfr",           &brIsDfr,         "dfr/O"	    );
-  s_tree->Branch("imd",	          &brIsImd,	    "imd/O"	    );
-  s_tree->Branch("imdanh",        &brIsImdAnh,	    "imdanh/O"	    );
-  s_tree->Branch("singlek",       &brIsSingleK,     "singlek/O"     );  
-  s_tree->Branch("nuel",          &brIsNuEL,        "nuel/O"	    );
-  s_tree->Branch("em",	          &brIsEM,	    "em/O"	    );
-  s_tree->Branch("cc",	          &brIsCC,	    "cc/O"	    );
-  s_tree->Branch("nc",	          &brIsNC,	    "nc/O"	    );
-  s_tree->Branch("charm",         &brIsCharmPro,    "charm/O"	    );
-  s_tree->Branch("amnugamma",     &brIsAMNuGamma,    "amnugamma/O"	    );
-  s_tree->Branch("neut_code",     &brCodeNeut,      "neut_code/I"   );
-  s_tree->Branch("nuance_code",   &brCodeNuance,    "nuance_code/I" );
-  s_tree->Branch("wght",          &brWeight,        "wght/D"	    );
-  s_tree->Branch("xs",	          &brKineXs,        "xs/D"	    );
-  s_tree->Branch("ys",	          &brKineYs,        "ys/D"	    );
-  s_tree->Branch("ts",	          &brKineTs,        "ts/D"	    );
-  s_tree->Branch("Q2s",	          &brKineQ2s,       "Q2s/D"	    );
-  s_tree->Branch("Ws",	          &brKineWs,        "Ws/D"	    );
-  s_tree->Branch("x",	          &brKineX,	    "x/D"	    );
-  s_tree->Branch("y",	          &brKineY,	    "y/D"	    );
-  s_tree->Branch("t",	          &brKineT,	    "t/D"	    );
-  s_tree->Branch("Q2",	          &brKineQ2,        "Q2/D"	    );
-  s_tree->Branch("W",	          &brKineW,	    "W/D"	    );
-  s_tree->Branch("EvRF",	      &brEvRF,	    "EvRF/D"	    );
-  s_tree->Branch("Ev",	          &brEv,	    "Ev/D"	    );
-  s_tree->Branch("pxv",	          &brPxv,	    "pxv/D"	    );
-  s_tree->Branch("pyv",	          &brPyv,	    "pyv/D"	    );
-  s_tree->Branch("pzv",	          &brPzv,	    "pzv/D"	    );
-  s_tree->Branch("En",	          &brEn,	    "En/D"	    );
-  s_tree->Branch("pxn",	          &brPxn,	    "pxn/D"	    );
-  s_tree->Branch("pyn",	          &brPyn,	    "pyn/D"	    );
-  s_tree->Branch("pzn",	          &brPzn,	    "pzn/D"	    );
-  s_tree->Branch("El",	          &brEl,	    "El/D"	    );
-  s_tree->Branch("pxl",	          &brPxl,	    "pxl/D"	    );
-  s_tree->Branch("pyl",	          &brPyl,	    "pyl/D"	    );
-  s_tree->Branch("pzl",	          &brPzl,	    "pzl/D"	    );
-  s_tree->Branch("pl",            &brPl,            "pl/D"          );
-  s_tree->Branch("cthl",          &brCosthl,        "cthl/D"        );
-  s_tree->Branch("nfp",	          &brNfP,	    "nfp/I"	    );
-  s_tree->Branch("nfn",	          &brNfN,	    "nfn/I"	    );
-  s_tree->Branch("nfpip",         &brNfPip,	    "nfpip/I"	    );
-  s_tree->Branch("nfpim",         &brNfPim,	    "nfpim/I"	    );
-  s_tree->Branch("nfpi0",         &brNfPi0,	    "nfpi0/I"	    );
-  s_tree->Branch("nfkp",          &brNfKp,	    "nfkp/I"	    );
-  s_tree->Branch("nfkm",          &brNfKm,	    "nfkm/I"	    );
-  s_tree->Branch("nfk0",          &brNfK0,	    "nfk0/I"	    );
-  s_tree->Branch("nfem",          &brNfEM,	    "nfem/I"	    );
-  s_tree->Branch("nfother",       &brNfOther,       "nfother/I"     );
-  s_tree->Branch("nip",	          &brNiP,	    "nip/I"	    );
-  s_tree->Branch("nin",	          &brNiN,	    "nin/I"	    );
-  s_tree->Branch("nipip",         &brNiPip,	    "nipip/I"	    );
-  s_tree->Branch("nipim",         &brNiPim,	    "nipim/I"	    );
-  s_tree->Branch("nipi0",         &brNiPi0,	    "nipi0/I"	    );
-  s_tree->Branch("nikp",          &brNiKp,	    "nikp/I"	    );
-  s_tree->Branch("nikm",          &brNiKm,	    "nikm/I"	    );
-  s_tree->Branch("nik0",          &brNiK0,	    "nik0/I"	    );
-  s_tree->Branch("niem",          &brNiEM,	    "niem/I"	    );
-  s_tree->Branch("niother",       &brNiOther,       "niother/I"     );
-  s_tree->Branch("ni",	         &brNi,	            "ni/I"	    );
-  s_tree->Branch("pdgi",          brPdgi,	    "pdgi[ni]/I "   );
-  s_tree->Branch("resc",          brResc,	    "resc[ni]/I "   );
-  s_tree->Branch("Ei",	          brEi,	            "Ei[ni]/D"      );
-  s_tree->Branch("pxi",	          brPxi,	    "pxi[ni]/D"     );
-  s_tree->Branch("pyi",	          brPyi,	    "pyi[ni]/D"     );
-  s_tree->Branch("pzi",	          brPzi,	    "pzi[ni]/D"     );
-  s_tree->Branch("nf",	         &brNf,	            "nf/I"	    );
-  s_tree->Branch("pdgf",          brPdgf,	    "pdgf[nf]/I "   );
-  s_tree->Branch("Ef",	          brEf,	            "Ef[nf]/D"      );
-  s_tree->Branch("pxf",	          brPxf,	    "pxf[nf]/D"     );
-  s_tree->Branch("pyf",	          brPyf,	    "pyf[nf]/D"     );
-  s_tree->Branch("pzf",	          brPzf,	    "pzf[nf]/D"     );
-  s_tree->Branch("pf",            brPf,             "pf[nf]/D"      );
-  s_tree->Branch("cthf",          brCosthf,         "cthf[nf]/D"    );
-  s_tree->Branch("vtxx",         &brVtxX,	    "vtxx/D"        );
-  s_tree->Branch("vtxy",         &brVtxY,	    "vtxy/D"        );
-  s_tree->Branch("vtxz",         &brVtxZ,	    "vtxz/D"        );
-  s_tree->Branch("vtxt",         &brVtxT,	    "vtxt/D"        );
-  s_tree->Branch("sumKEf",       &brSumKEf,	    "sumKEf/D"      );
-  s_tree->Branch("calresp0",     &brCalResp0,	    "calresp0/D"    );
-
-  // Open the ROOT file and get the TTree & its header
-  TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           er_tree = 0;
-  NtpMCTreeHeader * thdr    = 0;
-  er_tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr    = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-  if (!er_tree) {
-    LOG("gntpc", pERROR) << "Null input GHEP event tree";
-    return;
+// Converts the input entries [first, last) to all requested formats, reading
+// the input events once. When the input is split in chunks, the conversion
+// is written in per-chunk files (see MergeChunks())
+
+  unsigned int nconv = gOptOutFileFormats.size();
+
+  GNtpcInput input(gOptInpFileName, first, last, nconv);
+
+  vector<GNtpcJob_t> jobs(nconv);
+  for(unsigned int i = 0; i < nconv; i++) {
+    GNtpcJob_t & job = jobs[i];
+    job.format    = gOptOutFileFormats[i];
+    job.outfile   = (nchunks > 1) ?
+                      ChunkFilename(gOptOutFileNames[i], ichunk) : gOptOutFileNames[i];
+    job.version   = (gOptVersion < 0) ?
+                      LatestFormatVersionNumber(job.format) : gOptVersion;
+    job.copy_meta = gOptCopyJobMeta && (ichunk == 0);
+    job.header    = (ichunk == 0);
+    job.footer    = (ichunk == nchunks-1);
+    job.iconv     = i;
+    job.input     = &input;
   }
-  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
-  // Get the mc record
-  NtpMCEventRecord * mcrec = 0;
-  er_tree->SetBranchAddress("gmcrec", &mcrec);
-  if (!mcrec) {
-    LOG("gntpc", pERROR) << "Null MC record";
-    return;
-  }
-  
-  // Figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       er_tree->GetEntries() : TMath::Min( er_tree->GetEntries(), gOptN );
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
+  if(nconv == 1) {
+    RunConversion(jobs[0]);
     return;
   }
 
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+#endif
 
-  TLorentzVector pdummy(0,0,0,0);
+  vector<std::thread> threads;
+  for(unsigned int i = 0; i < nconv; i++) {
+    threads.push_back( std::thread(RunConversion, std::ref(jobs[i])) );
+  }
+  for(unsigned int i = 0; i < nconv; i++) {
+    threads[i].join();
+  }
+}
+//____________________________________________________________________________________
+void ConvertChunk(int ichunk, int nchunks, Long64_t first, Long64_t last, void *)
+{
+  ConvertRange(first, last, ichunk, nchunks);
+}
+//____________________________________________________________________________________
+void ConvertInParallel(Long64_t nev)
+{
+// Splits the input entries in contiguous ranges, converted by forked worker
+// processes (the conversion code and the GENIE singletons are not thread-safe)
+// in per-chunk files, which are then merged in order
 
-  // Event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    er_tree->GetEntry(iev);
+  LOG("gntpc", pNOTICE)
+    << "*** Converting " << nev << " events using " << gOptNWorkers << " workers";
 
-    NtpMCRecHeader rec_header = mcrec->hdr;
-    EventRecord &  event      = *(mcrec->event);
+  // per-event random number streams, so that the output does not depend on
+  // how the input is split
+  RandomGen::Instance()->SetCounterBased(true);
 
-    LOG("gntpc", pINFO) << rec_header;
-    LOG("gntpc", pINFO) << event;
+  int nworkers = utils::system::RunInWorkerProcesses(
+                                  gOptNWorkers, 0, nev, ConvertChunk);
+  if(nworkers < 0) {
+    LOG("gntpc", pFATAL) << "A conversion worker did not complete";
+    gAbortingInErr = true;
+    exit(5);
+  }
 
-    // Go further only if the event is physical
-    bool is_unphysical = event.IsUnphysical();
-    if(is_unphysical) {
-      LOG("gntpc", pINFO) << "Skipping unphysical event";
-      mcrec->Clear();
-      continue;
+  for(unsigned int i = 0; i < gOptOutFileFormats.size(); i++) {
+    vector<string> chunks;
+    for(int ichunk = 0; ichunk < nworkers; ichunk++) {
+      chunks.push_back(ChunkFilename(gOptOutFileNames[i], ichunk));
     }
-
-    // Clean-up arrays
-    //
-    for(int j=0; j<kNPmax; j++) {
-       brPdgi   [j] =  0;     
-       brResc   [j] = -1;     
-       brEi     [j] =  0;     
-       brPxi    [j] =  0;     
-       brPyi    [j] =  0;     
-       brPzi    [j] =  0;     
-       brPdgf   [j] =  0;     
-       brEf     [j] =  0;     
-       brPxf    [j] =  0;     
-       brPyf    [j] =  0;     
-       brPzf    [j] =  0;     
-       brPf     [j] =  0;     
-       brCosthf [j] =  0;     
+    MergeChunks(gOptOutFileFormats[i], gOptOutFileNames[i], chunks);
+    for(unsigned int ichunk = 0; ichunk < chunks.size(); ichunk++) {
+      gSystem->Unlink(chunks[ichunk].c_str());
     }
-
-    // Computing event characteristics
-    //
-
-    //input particles
-    GHepParticle * neutrino = event.Probe();
-    GHepParticle * target = event.Particle(1);
-    assert(target);
-    GHepParticle * fsl = event.FinalStatePrimaryLepton();
-    GHepParticle * hitnucl = event.HitNucleon();
-
-    int tgtZ = 0;
-    int tgtA = 0;
-    if(pdg::IsIon(target->Pdg())) {
-       tgtZ = pdg::IonPdgCodeToZ(target->Pdg());
-       tgtA = pdg::IonPdgCodeToA(target->Pdg());
-    } 
-    if(target->Pdg() == kPdgProton   ) { tgtZ = 1; tgtA = 1; }    
-    if(target->Pdg() == kPdgNeutron  ) { tgtZ = 0; tgtA = 1; }    
-  
-    // Summary info
-    const Interaction * interaction = event.Summary();
-    const InitialState & init_state = interaction->InitState();
-    const ProcessInfo &  proc_info  = interaction->ProcInfo();
-    const Kinematics &   kine       = interaction->Kine();
-    const XclsTag &      xcls       = interaction->ExclTag();
-    const Target &       tgt        = init_state.Tgt();
-
-    // Vertex in detector coord system
-    TLorentzVector * vtx = event.Vertex();
-
-    // Process id
-    bool is_qel    = proc_info.IsQuasiElastic();
-    bool is_res    = proc_info.IsResonant();
-    bool is_dis    = proc_info.IsDeepInelastic();
-    bool is_coh    = proc_info.IsCoherent();
-    bool is_dfr    = proc_info.IsDiffractive();
-    bool is_imd    = proc_info.IsInverseMuDecay();
-    bool is_imdanh = proc_info.IsIMDAnnihilation();
-    bool is_singlek = proc_info.IsSingleKaon();    
-    bool is_nuel      = proc_info.IsNuElectronElastic();
-    bool is_em        = proc_info.IsEM();
-    bool is_weakcc    = proc_info.IsWeakCC();
-    bool is_weaknc    = proc_info.IsWeakNC();
-    bool is_mec       = proc_info.IsMEC();
-    bool is_amnugamma = proc_info.IsAMNuGamma();
-
-    if (!hitnucl && neutrino) {
-        assert(is_coh || is_imd || is_imdanh || is_nuel | is_amnugamma);
+  }
+}
+//____________________________________________________________________________________
+void MergeChunks(GNtpcFmt_t fmt, string outfile, const vector<string> & chunks)
+{
+  LOG("gntpc", pNOTICE)
+    << "*** Merging " << chunks.size() << " chunks into: " << outfile;
+
+  // text formats: chunks are written with the file header (1st chunk) or
+  // footer (last chunk) only, so they are simply concatenated
+  if(!IsRootFormat(fmt)) {
+    ofstream output(outfile.c_str(), ios::out | ios::binary);
+    for(unsigned int i = 0; i < chunks.size(); i++) {
+      std::ifstream chunk(chunks[i].c_str(), ios::in | ios::binary);
+      if(chunk.peek() != std::ifstream::traits_type::eof()) {
+        output << chunk.rdbuf();
+      }
     }
-  
-    // Hit quark - set only for DIS events
-    int  qrk  = (is_dis) ? tgt.HitQrkPdg() : 0;     
-    bool seaq = (is_dis) ? tgt.HitSeaQrk() : false; 
-
-    // Resonance id ($GENIE/src/BaryonResonance/BaryonResonance.h) -
-    // set only for resonance neutrinoproduction
-    int resid = (is_res) ? EResonance(xcls.Resonance()) : -99;
-
-    // (qel or dis) charm production?
-    bool charm = xcls.IsCharmEvent();
-
-    // Get NEUT and NUANCE equivalent reaction codes (if any)
-    brCodeNeut    = utils::ghep::NeutReactionCode(&event);
-    brCodeNuance  = utils::ghep::NuanceReactionCode(&event);
-
-    // Get event weight
-    double weight = event.Weight();
+    output.close();
+    return;
+  }
 
-    // Access kinematical params _exactly_ as they were selected internally
-    // (at the hit nucleon rest frame; 
-    // for bound nucleons: taking into account fermi momentum and off-shell kinematics)
-    //
-    bool get_selected = true;
-    double xs  = kine.x (get_selected);
-    double ys  = kine.y (get_selected);
-    double ts  = (is_coh || is_dfr) ? kine.t (get_selected) : -1;
-    double Q2s = kine.Q2(get_selected);
-    double Ws  = kine.W (get_selected);
-
-    LOG("gntpc", pDEBUG) 
-       << "[Select] Q2 = " << Q2s << ", W = " << Ws 
-       << ", x = " << xs << ", y = " << ys << ", t = " << ts;
-
-    // Calculate the same kinematical params but now as an experimentalist would 
-    // measure them by neglecting the fermi momentum and off-shellness of bound nucleons
-    //
+  // ROOT formats: trees are chained and fast-cloned (without decompressing
+  // the baskets), other objects (tree header, MC job metadata) are copied
+  // from the 1st chunk
+  TFile fout(outfile.c_str(), "RECREATE");
+  TFile first(chunks[0].c_str(), "READ");
+
+  std::set<string> done;
+  TIter next_key(first.GetListOfKeys());
+  TKey * key = 0;
+  while( (key = dynamic_cast<TKey *>(next_key())) ) {
+    string name = key->GetName();
+    if(done.count(name) > 0) continue; // older key cycles
+    done.insert(name);
+
+    TClass * cl = TClass::GetClass(key->GetClassName());
+    if(cl && cl->InheritsFrom(TTree::Class())) {
+      TChain chain(name.c_str());
+      for(unsigned int i = 0; i < chunks.size(); i++) {
+        chain.Add(chunks[i].c_str());
+      }
+      TTree * tree0 = dynamic_cast<TTree *> (key->ReadObj());
+      fout.cd();
+      TTree * merged = chain.CloneTree(-1, "fast");
+      if(tree0) merged->SetWeight(tree0->GetWeight());
+      merged->Write();
+    } else {
+      TObject * obj = key->ReadObj();
+      fout.cd();
+      obj->Write(name.c_str());
+    }
+  }
 
-    const TLorentzVector & k1 = (neutrino) ? *(neutrino->P4()) : pdummy;  // v 4-p (k1)
-    const TLorentzVector & k2 = (fsl)      ? *(fsl->P4())      : pdummy;  // l 4-p (k2)
-    const TLorentzVector & p1 = (hitnucl)  ? *(hitnucl->P4())  : pdummy;  // N 4-p (p1)      
+  first.Close();
+  fout.Close();
+}
+//____________________________________________________________________________________
+string ChunkFilename(string outfile, int ichunk)
+{
+  ostringstream name;
+  name << outfile << ".chunk" << ichunk;
+  return name.str();
+}
+//____________________________________________________________________________________
+Long64_t NEventsToConvert(void)
+{
+  TFile fin(gOptInpFileName.c_str(),"READ");
+  TTree * tree = dynamic_cast <TTree *> ( fin.Get("gtree") );
+  if (!tree) {
+    LOG("gntpc", pFATAL) << "Null input GHEP event tree";
+    gAbortingInErr = true;
+    exit(2);
+  }
+  Long64_t nev = (gOptN<0) ?
+       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  fin.Close();
 
-    double M  = kNucleonMass; 
-    TLorentzVector q  = k1-k2;                     // q=k1-k2, 4-p transfer
-    double Q2 = -1 * q.M2();                       // momemtum transfer
-    
-    double v  = (hitnucl) ? q.Energy()       : -1; // v (E transfer to the nucleus)
-    double x, y, W2, W;
-    if(!is_coh){ 
-    
-       x  = (hitnucl) ? 0.5*Q2/(M*v)     : -1; // Bjorken x
-       y  = (hitnucl) ? v/k1.Energy()    : -1; // Inelasticity, y = q*P1/k1*P1
+  return nev;
+}
+//____________________________________________________________________________________
+bool IsRootFormat(GNtpcFmt_t fmt)
+{
+  return (fmt == kConvFmt_gst                  ||
+          fmt == kConvFmt_ghep                 ||
+          fmt == kConvFmt_compact_ghep         ||
+          fmt == kConvFmt_ghep_mock_data       ||
+          fmt == kConvFmt_rootracker           ||
+          fmt == kConvFmt_rootracker_mock_data ||
+          fmt == kConvFmt_t2k_rootracker       ||
+          fmt == kConvFmt_numi_rootracker      ||
+          fmt == kConvFmt_ginuke);
+}
+//____________________________________________________________________________________
+// INPUT EVENTS, SHARED BY ALL CONVERSIONS
+//____________________________________________________________________________________
+GNtpcInput::GNtpcInput(string filename, Long64_t first, Long64_t last, int nconv) :
+fFile(0),
+fTree(0),
+fHeader(0),
+fMCRec(0),
+fCompact(0),
+fEntry(-1),
+fNext(first),
+fLast(last),
+fEnd(false),
+fActive(nconv, true),
+fTurn(0)
+{
+  fFile   = new TFile(filename.c_str(),"READ");
+  fTree   = dynamic_cast <TTree *>           ( fFile->Get("gtree")  );
+  fHeader = dynamic_cast <NtpMCTreeHeader *> ( fFile->Get("header") );
+  if (!fTree || !fHeader) {
+    LOG("gntpc", pFATAL) << "Null input GHEP event tree or tree header";
+    gAbortingInErr = true;
+    exit(2);
+  }
 
-       W2 = (hitnucl) ? M*M + 2*M*v - Q2 : -1; // Hadronic Invariant mass ^ 2
-       W  = (hitnucl) ? TMath::Sqrt(W2)  : -1; 
-    } else{
+  // compact event records are unpacked into a full record for the conversions
+  if(fTree->GetBranch("gcmrec")) {
+    LOG("gntpc", pNOTICE) << "Reading compact GHEP event records";
+    fMCRec   = new NtpMCEventRecord;
+    fCompact = new NtpMCCompactRecord;
+    fTree->SetBranchAddress("gcmrec", &fCompact);
+  } else {
+    fTree->SetBranchAddress("gmcrec", &fMCRec);
+  }
 
-       v = q.Energy();
-       x  =  0.5*Q2/(M*v);      // Bjorken x
-       y  = v/k1.Energy();    // Inelasticity, y = q*P1/k1*P1
+  LOG("gntpc", pNOTICE)
+    << "*** Analyzing: " << last-first << " events (entries "
+    << first << " to " << last-1 << ")";
+}
+//____________________________________________________________________________________
+GNtpcInput::~GNtpcInput()
+{
+  fFile->Close();
+  if(fCompact) {
+    delete fMCRec;
+    delete fCompact;
+  } else {
+    if(fMCRec) fMCRec->Clear();
+  }
+  delete fFile;
+}
+//____________________________________________________________________________________
+template<class T> void GNtpcInput::SetBranchAddress(string name, T ** addr)
+{
+  map<string, void **>::iterator it = fBranches.find(name);
+  if(it == fBranches.end()) {
+    fTree->SetBranchAddress(name.c_str(), addr);
+    fBranches[name] = (void **) addr;
+  } else {
+    fShared.push_back( std::make_pair((void **) addr, it->second) );
+  }
+}
+//____________________________________________________________________________________
+void GNtpcInput::Start(int iconv)
+{
+// Waits for the conversion's first turn (conversions start in order)
 
-       W2 = M*M + 2*M*v - Q2;  // Hadronic Invariant mass ^ 2
-       W  = TMath::Sqrt(W2); 
+  std::unique_lock<std::mutex> lock(fMutex);
+  fTurnCV.wait(lock, [this, iconv] { return fTurn == iconv; });
+}
+//____________________________________________________________________________________
+bool GNtpcInput::NextEvent(int iconv, Long64_t & iev, NtpMCEventRecord * & mcrec)
+{
+// Called by a conversion which is done with its current event (or setup).
+// Returns false when there are no more events to convert.
 
-    }
-  
-    double t  = (is_coh || is_dfr) ? kine.t (get_selected) : -1;
+  std::unique_lock<std::mutex> lock(fMutex);
+  this->HandOver(iconv);
+  fTurnCV.wait(lock, [this, iconv] { return fTurn == iconv; });
 
-    // Get v 4-p at hit nucleon rest-frame
-    TLorentzVector k1_rf = k1;         
-    if(hitnucl) {
-       k1_rf.Boost(-1.*p1.BoostVector());
-    }
+  if(fEnd) return false;
 
-//    if(is_mec){
-//      v = q.Energy();
-//      x = 0.5*Q2/(M*v);
-//      y = v/k1.Energy();
-//      W2 = M*M + 2*M*v - Q2;
-//      W = TMath::Sqrt(W2);
-//    }
+  iev   = fEntry;
+  mcrec = fMCRec;
+  return true;
+}
+//____________________________________________________________________________________
+void GNtpcInput::Finish(int iconv)
+{
+  std::unique_lock<std::mutex> lock(fMutex);
+  fActive[iconv] = false;
+  this->HandOver(iconv);
+}
+//____________________________________________________________________________________
+void GNtpcInput::HandOver(int iconv)
+{
+// Hands over to the next running conversion, reading the next event first if
+// all conversions are done with the current one. Called with the lock held.
+
+  int n = fActive.size();
+  for(int k = 1; k <= n; k++) {
+    int next = (iconv + k) % n;
+    if(!fActive[next]) continue;
+    if(next <= iconv) this->ReadNext();
+    fTurn = next;
+    fTurnCV.notify_all();
+    return;
+  }
+  fTurn = -1; // all conversions finished
+}
+//____________________________________________________________________________________
+void GNtpcInput::ReadNext(void)
+{
+  if(fEnd) return;
 
-    LOG("gntpc", pDEBUG) 
-       << "[Calc] Q2 = " << Q2 << ", W = " << W 
-       << ", x = " << x << ", y = " << y << ", t = " << t;
+  if(fEntry >= 0 && !fCompact) fMCRec->Clear();
 
-    // Extract more info on the hadronic system
-    // Only for QEL/RES/DIS/COH/MEC events
-    //
-    bool study_hadsyst = (is_qel || is_res || is_dis || is_coh || is_dfr || is_mec || is_singlek);
-    
-    //
-    TObjArrayIter piter(&event);
-    GHepParticle * p = 0;
-    int ip=-1;
-
-    //
-    // Extract the final state system originating from the hadronic vertex 
-    // (after the intranuclear rescattering step)
-    //
+  if(fNext >= fLast) {
+    fEnd = true;
+    return;
+  }
 
-    LOG("gntpc", pDEBUG) << "Extracting final state hadronic system";
+  fTree->GetEntry(fNext);
+  fEntry = fNext++;
 
-    vector<int> final_had_syst;
-    while( (p = (GHepParticle *) piter.Next()) && study_hadsyst)
-    {
-      ip++;
-      // don't count final state lepton as part hadronic system 
-      //if(!is_coh && event.Particle(ip)->FirstMother()==0) continue;
-      if(event.Particle(ip)->FirstMother()==0) continue;
-      if(pdg::IsPseudoParticle(p->Pdg())) continue;
-      int pdgc = p->Pdg();
-      int ist  = p->Status();
-      if(ist==kIStStableFinalState) {
-         if (pdgc == kPdgGamma || pdgc == kPdgElectron || pdgc == kPdgPositron)  {
-            int igmom = p->FirstMother();
-            if(igmom!=-1) {
-	      // only count e+'s e-'s or gammas not from decay of pi0
-	      if(event.Particle(igmom)->Pdg() != kPdgPi0) { final_had_syst.push_back(ip); }
-            }
-         } else {
-            final_had_syst.push_back(ip);
-         }
-      }
-      // now add pi0's that were decayed as short lived particles
-      else if(pdgc == kPdgPi0){
-	int ifd = p->FirstDaughter();
-	int fd_pdgc = event.Particle(ifd)->Pdg();
-	// just require that first daughter is one of gamma, e+ or e-  
-	if(fd_pdgc == kPdgGamma || fd_pdgc == kPdgElectron || fd_pdgc == kPdgPositron){
-	  final_had_syst.push_back(ip);
-	}
-      }
-    }//particle-loop
+  if(fCompact) {
+    fCompact->Unpack(*fMCRec->event);
+    fMCRec->hdr.Copy(fCompact->hdr);
+  }
 
-    if( count(final_had_syst.begin(), final_had_syst.end(), -1) > 0) {
-        mcrec->Clear();
- 	continue;
-    }
+  // conversions binding the same branch share the object read
+  vector< pair<void **, void **> >::iterator it = fShared.begin();
+  for( ; it != fShared.end(); ++it) *(it->first) = *(it->second);
 
-    //
-    // Extract info on the primary hadronic system (before any intranuclear rescattering)
-    // looking for particles with status_code == kIStHadronInTheNucleus 
-    // An exception is the coherent production and scattering off free nucleon targets 
-    // (no intranuclear rescattering) in which case primary hadronic system is set to be 
-    // 'identical' with the final  state hadronic system
-    //
+  // per-event random number streams
+  RandomGen * rnd = RandomGen::Instance();
+  if(rnd->CounterBased()) rnd->SetEventIndex(fEntry);
+}
+//____________________________________________________________________________________
+// GENIE GHEP EVENT TREE FORMAT -> GENIE SUMMARY NTUPLE 
+//____________________________________________________________________________________
+void ConvertToGST(GNtpcJob_t & job)
+{
+  // Open output file & create output summary tree & create the tree branches
+  // (see NtpGSTRecord)
+  //
+  LOG("gntpc", pNOTICE) 
+       << "*** Saving summary tree to: " << job.outfile;
+  TFile fout(job.outfile.c_str(),"recreate");
 
-    LOG("gntpc", pDEBUG) << "Extracting primary hadronic system";
-    
-    ip = -1;
-    TObjArrayIter piter_prim(&event);
-
-    vector<int> prim_had_syst;
-    if(study_hadsyst) {
-      // if coherent or free nucleon target set primary states equal to final states
-      if(!pdg::IsIon(target->Pdg()) || (is_coh)) {
-         vector<int>::const_iterator hiter = final_had_syst.begin();
-         for( ; hiter != final_had_syst.end(); ++hiter) {
-           prim_had_syst.push_back(*hiter);
-         }
-      } 
-      //to find the true particles emitted from the principal vertex,
-      // looping over all Ist=14 particles ok for hA, but doesn't
-      // work for hN.  We must now look specifically for these particles.
-      int ist_store = -10;
-      if(is_res){
-	while( (p = (GHepParticle *) piter_prim.Next()) ){
-	  ip++;      
-	  int ist_comp  = p->Status();
-	  if(ist_comp==kIStDecayedState) {
-	    ist_store = ip;    //store this mother
-	    continue;
-	  }
-	  //	  LOG("gntpc",pNOTICE) << p->FirstMother()<< "  "<<ist_store;
-	  if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	}
-      }
-      if(is_dis){
-	while( (p = (GHepParticle *) piter_prim.Next()) ){
-	  ip++;      
-	  int ist_comp  = p->Status();
-	  if(ist_comp==kIStDISPreFragmHadronicState) {
-	    ist_store = ip;    //store this mother
-	    continue;
-	  }
-	  if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	}
-      }
-      if(is_qel){
-	while( (p = (GHepParticle *) piter_prim.Next()) ){
-	  ip++;      
-	  int ist_comp  = p->Status();
-	  if(ist_comp==kIStNucleonTarget) {
-	    ist_store = ip;    //store this mother
-	    continue;
-	  }
-	  //	  LOG("gntpc",pNOTICE) << p->FirstMother()<< "  "<<ist_store;
-	  if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	}
-      }      
-      if(is_mec){
-	while( (p = (GHepParticle *) piter_prim.Next()) ){
-	  ip++;      
-	  int ist_comp  = p->Status();
-	  if(ist_comp==kIStDecayedState) {
-	    ist_store = ip;    //store this mother
-	    continue;
-	  }
-	  //	  LOG("gntpc",pNOTICE) << "MEC: " << p->FirstMother()<< "  "<<ist_store;
-	  if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	}
-      }
-      // otherwise loop over all particles and store indices of those which are hadrons
-      // created within the nucleus
-      /*      else {
-	while( (p = (GHepParticle *) piter_prim.Next()) ){
-	  ip++;      
-	  int ist_comp  = p->Status();
-	  if(ist_comp==kIStHadronInTheNucleus) {
-	    prim_had_syst.push_back(ip); 
-	  }
-	  }//particle-loop   */
-	//
-	// also include gammas from nuclear de-excitations (appearing in the daughter list of the 
-	// hit nucleus, earlier than the primary hadronic system extracted above)
-	for(int i = target->FirstDaughter(); i <= target->LastDaughter(); i++) {
-	  if(i<0) continue;
-	  if(event.Particle(i)->Status()==kIStStableFinalState) { prim_had_syst.push_back(i); }
-	}      
-	//      }//freenuc?
-    }//study_hadsystem?
-    
-    if( count(prim_had_syst.begin(), prim_had_syst.end(), -1) > 0) {
-        mcrec->Clear();
- 	continue;
-    }
+  TTree * s_tree = new TTree("gst","GENIE Summary Event Tree");
 
-    //
-    // Al information has been assembled -- Start filling up the tree branches
-    //
-    brIev        = (int) iev;      
-    brNeutrino   = (neutrino) ? neutrino->Pdg() : 0;      
-    brFSPrimLept = (fsl) ? fsl->Pdg() : 0;
-    brTarget     = target->Pdg(); 
-    brTargetZ    = tgtZ;
-    brTargetA    = tgtA;   
-    brHitNuc     = (hitnucl) ? hitnucl->Pdg() : 0;      
-    brHitQrk     = qrk;     
-    brFromSea    = seaq;  
-    brResId      = resid;
-    brIsQel      = is_qel;
-    brIsRes      = is_res;
-    brIsDis      = is_dis;  
-    brIsCoh      = is_coh;  
-    brIsDfr      = is_dfr;  
-    brIsImd      = is_imd;
-    brIsSingleK  = is_singlek;    
-    brIsNuEL     = is_nuel;  
-    brIsEM       = is_em;  
-    brIsMec      = is_mec;
-    brIsCC       = is_weakcc;  
-    brIsNC       = is_weaknc;  
-    brIsCharmPro = charm;
-    brIsAMNuGamma= is_amnugamma;
-    brWeight     = weight;      
-    brKineXs     = xs;      
-    brKineYs     = ys;      
-    brKineTs     = ts;      
-    brKineQ2s    = Q2s;            
-    brKineWs     = Ws;      
-    brKineX      = x;      
-    brKineY      = y;      
-    brKineT      = t;      
-    brKineQ2     = Q2;      
-    brKineW      = W;      
-    brEvRF       = k1_rf.Energy();      
-    brEv         = k1.Energy();      
-    brPxv        = k1.Px();  
-    brPyv        = k1.Py();  
-    brPzv        = k1.Pz();  
-    brEn         = (hitnucl) ? p1.Energy() : 0;      
-    brPxn        = (hitnucl) ? p1.Px()     : 0;      
-    brPyn        = (hitnucl) ? p1.Py()     : 0;      
-    brPzn        = (hitnucl) ? p1.Pz()     : 0;            
-    brEl         = k2.Energy();      
-    brPxl        = k2.Px();      
-    brPyl        = k2.Py();      
-    brPzl        = k2.Pz();      
-    brPl         = k2.P();
-    brCosthl     = TMath::Cos( k2.Vect().Angle(k1.Vect()) );
-
-    // Primary hadronic system (from primary neutrino interaction, before FSI)
-    brNiP        = 0;
-    brNiN        = 0;    
-    brNiPip      = 0;    
-    brNiPim      = 0;    
-    brNiPi0      = 0;    
-    brNiKp       = 0;  
-    brNiKm       = 0;  
-    brNiK0       = 0;  
-    brNiEM       = 0;  
-    brNiOther    = 0;  
-    brNi = prim_had_syst.size();
-    for(int j=0; j<brNi; j++) {
-      p = event.Particle(prim_had_syst[j]);
-      assert(p);
-      brPdgi[j] = p->Pdg();     
-      brResc[j] = p->RescatterCode();     
-      brEi  [j] = p->Energy();     
-      brPxi [j] = p->Px();     
-      brPyi [j] = p->Py();     
-      brPzi [j] = p->Pz();     
-
-      if      (p->Pdg() == kPdgProton  || p->Pdg() == kPdgAntiProton)   brNiP++;
-      else if (p->Pdg() == kPdgNeutron || p->Pdg() == kPdgAntiNeutron)  brNiN++;
-      else if (p->Pdg() == kPdgPiP) brNiPip++; 
-      else if (p->Pdg() == kPdgPiM) brNiPim++; 
-      else if (p->Pdg() == kPdgPi0) brNiPi0++; 
-      else if (p->Pdg() == kPdgKP)  brNiKp++;  
-      else if (p->Pdg() == kPdgKM)  brNiKm++;  
-      else if (p->Pdg() == kPdgK0    || p->Pdg() == kPdgAntiK0)  brNiK0++; 
-      else if (p->Pdg() == kPdgGamma || p->Pdg() == kPdgElectron || p->Pdg() == kPdgPositron) brNiEM++;
-      else brNiOther++;
-
-      LOG("gntpc", pINFO) 
-        << "Counting in primary hadronic system: idx = " << prim_had_syst[j]
-        << " -> " << p->Name();
-    }
+  NtpGSTRecord gst;
+  gst.CreateBranches(s_tree);
 
-    LOG("gntpc", pINFO) 
-     << "N(p):"             << brNiP
-     << ", N(n):"           << brNiN
-     << ", N(pi+):"         << brNiPip
-     << ", N(pi-):"         << brNiPim
-     << ", N(pi0):"         << brNiPi0
-     << ", N(K+,K-,K0):"    << brNiKp+brNiKm+brNiK0
-     << ", N(gamma,e-,e+):" << brNiEM
-     << ", N(etc):"         << brNiOther << "\n";
-
-    // Final state (visible) hadronic system
-    brNfP        = 0;
-    brNfN        = 0;    
-    brNfPip      = 0;    
-    brNfPim      = 0;    
-    brNfPi0      = 0;    
-    brNfKp       = 0;  
-    brNfKm       = 0;  
-    brNfK0       = 0;  
-    brNfEM       = 0;  
-    brNfOther    = 0;  
-
-    brSumKEf     = (fsl) ? fsl->KinE() : 0;
-    brCalResp0   = 0;
-
-    brNf = final_had_syst.size();
-    for(int j=0; j<brNf; j++) {
-      p = event.Particle(final_had_syst[j]);
-      assert(p);
-
-      int    hpdg = p->Pdg();     
-      double hE   = p->Energy();     
-      double hKE  = p->KinE();     
-      double hpx  = p->Px();     
-      double hpy  = p->Py();     
-      double hpz  = p->Pz();     
-      double hp   = TMath::Sqrt(hpx*hpx + hpy*hpy + hpz*hpz);
-      double hm   = p->Mass();     
-      double hcth = TMath::Cos( p->P4()->Vect().Angle(k1.Vect()) );
-
-      brPdgf  [j] = hpdg;
-      brEf    [j] = hE;
-      brPxf   [j] = hpx;
-      brPyf   [j] = hpy;
-      brPzf   [j] = hpz;
-      brPf    [j] = hp;
-      brCosthf[j] = hcth;
-
-      brSumKEf += hKE;
-
-      if      ( hpdg == kPdgProton      )  { brNfP++;     brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgAntiProton  )  { brNfP++;     brCalResp0 += (hE + 2*hm);}
-      else if ( hpdg == kPdgNeutron     )  { brNfN++;     brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgAntiNeutron )  { brNfN++;     brCalResp0 += (hE + 2*hm);}
-      else if ( hpdg == kPdgPiP         )  { brNfPip++;   brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgPiM         )  { brNfPim++;   brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgPi0         )  { brNfPi0++;   brCalResp0 += (e_h * hE); }
-      else if ( hpdg == kPdgKP          )  { brNfKp++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgKM          )  { brNfKm++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgK0          )  { brNfK0++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgAntiK0      )  { brNfK0++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgGamma       )  { brNfEM++;    brCalResp0 += (e_h * hE); }
-      else if ( hpdg == kPdgElectron    )  { brNfEM++;    brCalResp0 += (e_h * hE); }
-      else if ( hpdg == kPdgPositron    )  { brNfEM++;    brCalResp0 += (e_h * hE); }
-      else                                 { brNfOther++; brCalResp0 += hKE;        }
-
-      LOG("gntpc", pINFO) 
-        << "Counting in f/s system from hadronic vtx: idx = " << final_had_syst[j]
-        << " -> " << p->Name();
-    }
+  // The input GHEP events & their header
+  GNtpcInput & input = *job.input;
+  LOG("gntpc", pINFO) << "Input tree header: " << *input.Header();
 
-    LOG("gntpc", pINFO) 
-     << "N(p):"             << brNfP
-     << ", N(n):"           << brNfN
-     << ", N(pi+):"         << brNfPip
-     << ", N(pi-):"         << brNfPim
-     << ", N(pi0):"         << brNfPi0
-     << ", N(K+,K-,K0):"    << brNfKp+brNfKm+brNfK0
-     << ", N(gamma,e-,e+):" << brNfEM
-     << ", N(etc):"         << brNfOther << "\n";
+  // Event loop
+  NtpMCEventRecord * mcrec = 0;
+  Long64_t iev = 0;
+  while( job.NextEvent(iev, mcrec) ) {
 
-    brVtxX = vtx->X();   
-    brVtxY = vtx->Y();   
-    brVtxZ = vtx->Z();   
-    brVtxT = vtx->T();
+    NtpMCRecHeader rec_header = mcrec->hdr;
+    EventRecord &  event      = *(mcrec->event);
 
-    s_tree->Fill();
+    LOG("gntpc", pINFO) << rec_header;
+    LOG("gntpc", pINFO) << event;
 
-    mcrec->Clear();
+    if(gst.Fill((int) iev, event)) s_tree->Fill();
 
   } // event loop
 
 
   // Copy MC job metadata (gconfig and genv TFolders)
-  if(gOptCopyJobMeta) {
-    TFolder * genv    = (TFolder*) fin.Get("genv");
-    TFolder * gconfig = (TFolder*) fin.Get("gconfig");
+  if(job.copy_meta) {
+    TFolder * genv    = (TFolder*) input.File()->Get("genv");
+    TFolder * gconfig = (TFolder*) input.File()->Get("gconfig");
     fout.cd();       
     genv    -> Write("genv");
     gconfig -> Write("gconfig");
   }
 
-  fin.Close();
-
   fout.Write();
   fout.Close();
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> GENIE XML EVENT FILE FORMAT 
 //____________________________________________________________________________________
-void ConvertToGXML(void)
+void ConvertToGXML(GNtpcJob_t & job)
 {
-  //-- open the ROOT file and get the TTree & its header
-  TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           tree = 0;
-  NtpMCTreeHeader * thdr = 0;
-  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-
-  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
-
-  //-- get mc record
-  NtpMCEventRecord * mcrec = 0;
-  tree->SetBranchAddress("gmcrec", &mcrec);
+  //-- the input GHEP events & their header
+  GNtpcInput & input = *job.input;
+  LOG("gntpc", pINFO) << "Input tree header: " << *input.Header();
 
   //-- open the output stream
-  ofstream output(gOptOutFileName.c_str(), ios::out);
+  ofstream output(job.outfile.c_str(), ios::out);
 
   //-- add required header
-  output << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
-  output << endl << endl;
-  output << "<!-- generated by GENIE gntpc utility -->";   
-  output << endl << endl;
-  output << "<genie_event_list version=\"1.00\">" << endl;
-
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
+  if(job.header) {
+    output << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
+    output << endl << endl;
+    output << "<!-- generated by GENIE gntpc utility -->";   
+    output << endl << endl;
+    output << "<genie_event_list version=\"1.00\">" << endl;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    tree->GetEntry(iev);
+  NtpMCEventRecord * mcrec = 0;
+  Long64_t iev = 0;
+  while( job.NextEvent(iev, mcrec) ) {
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
 
@@ -1199,53 +912,71 @@ void ConvertToGXML(void)
     }
     output << "  </ghep>" << endl;
 
-    mcrec->Clear();
   } // event loop
 
   //-- add required footer
-  output << endl << endl;
-  output << "<genie_event_list version=\"1.00\">";
+  if(job.footer) {
+    output << endl << endl;
+    output << "<genie_event_list version=\"1.00\">";
+  }
 
   output.close();
-  fin.Close();
+
+  LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+}
+//____________________________________________________________________________________
+// GENIE GHEP FORMAT (FULL OR COMPACT RECORDS) -> GHEP FORMAT (FULL OR COMPACT RECORDS)
+//____________________________________________________________________________________
+void ConvertToGHep(GNtpcJob_t & job)
+{
+  //-- the input GHEP events & their header
+  GNtpcInput & input = *job.input;
+  NtpMCTreeHeader * thdr = input.Header();
+
+  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
+
+  //-- initialize an Ntuple Writer
+  NtpMCFormat_t ntpfmt =
+     (job.format == kConvFmt_compact_ghep) ? kNFCompact : kNFGHEP;
+  NtpWriter ntpw(ntpfmt, thdr->runnu);
+  ntpw.CustomizeFilename(job.outfile);
+  ntpw.Initialize();
+
+  //-- event loop
+  NtpMCEventRecord * mcrec = 0;
+  Long64_t iev = 0;
+  while( job.NextEvent(iev, mcrec) ) {
+    LOG("gntpc", pINFO) << mcrec->hdr;
+    LOG("gntpc", pINFO) << *(mcrec->event);
+
+    ntpw.AddEventRecord(mcrec->hdr.ievent, mcrec->event);
+  } // event loop
+
+  //-- save the converted MC events
+  ntpw.Save();
 
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
 }
 //____________________________________________________________________________________
 // GENIE GHEP FORMAT -> GHEP MOCK DATA FORMAT
 //____________________________________________________________________________________
-void ConvertToGHepMock(void)
+void ConvertToGHepMock(GNtpcJob_t & job)
 {
-  //-- open the ROOT file and get the TTree & its header
-  TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           tree = 0;
-  NtpMCTreeHeader * thdr = 0;
-  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+  //-- the input GHEP events & their header
+  GNtpcInput & input = *job.input;
+  NtpMCTreeHeader * thdr = input.Header();
         
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
    
-  //-- get mc record
-  NtpMCEventRecord * mcrec = 0;
-  tree->SetBranchAddress("gmcrec", &mcrec);
-        
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ?
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
-
   //-- initialize an Ntuple Writer
   NtpWriter ntpw(kNFGHEP, thdr->runnu);
-  ntpw.CustomizeFilename(gOptOutFileName);
+  ntpw.CustomizeFilename(job.outfile);
   ntpw.Initialize();
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    tree->GetEntry(iev);
+  NtpMCEventRecord * mcrec = 0;
+  Long64_t iev = 0;
+  while( job.NextEvent(iev, mcrec) ) {
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
 
@@ -1271,29 +1002,21 @@ void ConvertToGHepMock(void)
 
     ntpw.AddEventRecord(iev,stripped_event);
 
-    mcrec->Clear();
   } // event loop
 
   //-- save the generated MC events
   ntpw.Save();
 
-  //-- rename the output file
-      
-  fin.Close();
-      
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> TRACKER FORMATS
 //____________________________________________________________________________________
-void ConvertToGTracker(void)
+void ConvertToGTracker(GNtpcJob_t & job)
 {
-  //-- open the ROOT file and get the TTree & its header
-  TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           tree = 0;
-  NtpMCTreeHeader * thdr = 0;
-  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+  //-- the input GHEP events & their header
+  GNtpcInput & input = *job.input;
+  NtpMCTreeHeader * thdr = input.Header();
 
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
@@ -1301,13 +1024,9 @@ void ConvertToGTracker(void)
   gFileMinorVrs = utils::system::GenieMinorVrsNum(thdr->cvstag.GetString().Data());
   gFileRevisVrs = utils::system::GenieRevisVrsNum(thdr->cvstag.GetString().Data());
 
-  //-- get mc record
-  NtpMCEventRecord * mcrec = 0;
-  tree->SetBranchAddress("gmcrec", &mcrec);
-
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
   flux::GJPARCNuFluxPassThroughInfo * flux_info = 0;
-  tree->SetBranchAddress("flux", &flux_info);
+  input.SetBranchAddress("flux", &flux_info);
 #else
   LOG("gntpc", pWARN) 
     << "\n Flux drivers are not enabled." 
@@ -1317,20 +1036,12 @@ void ConvertToGTracker(void)
 #endif
 
   //-- open the output stream
-  ofstream output(gOptOutFileName.c_str(), ios::out);
-
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  ofstream output(job.outfile.c_str(), ios::out);
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    tree->GetEntry(iev);
+  NtpMCEventRecord * mcrec = 0;
+  Long64_t iev = 0;
+  while( job.NextEvent(iev, mcrec) ) {
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
     Interaction * interaction = event.Summary();
@@ -1354,14 +1065,14 @@ void ConvertToGTracker(void)
     //
 
     // add 'NEUT'-like event type
-    if(gOptOutFileFormat == kConvFmt_t2k_tracker) {
+    if(job.format == kConvFmt_t2k_tracker) {
     	int evtype = utils::ghep::NeutReactionCode(&event);
         LOG("gntpc", pNOTICE) << "NEUT-like event type = " << evtype;
     	output << "$ genie " << evtype << endl;
     } //neut code
 
     // add 'NUANCE'-like event type
-    else if(gOptOutFileFormat == kConvFmt_nuance_tracker) {
+    else if(job.format == kConvFmt_nuance_tracker) {
     	int evtype = utils::ghep::NuanceReactionCode(&event);
         LOG("gntpc", pNOTICE) << "NUANCE-like event type = " << evtype;
     	output << "$ nuance " << evtype << endl;
@@ -1439,7 +1150,7 @@ void ConvertToGTracker(void)
 
        // Apparently SKDETSIM chokes with O16 - Neglect the nuclear target in this case
        //
-       if (gOptOutFileFormat == kConvFmt_t2k_tracker && pdg::IsIon(p->Pdg())) continue;
+       if (job.format == kConvFmt_t2k_tracker && pdg::IsIon(p->Pdg())) continue;
 
        tracks.push_back(iparticle);
     }
@@ -1492,7 +1203,7 @@ void ConvertToGTracker(void)
 
          // The SK detector MC expects K0_Long, K0_Short - not K0, \bar{K0}
          // Do the conversion here:
-         if(gOptOutFileFormat == kConvFmt_t2k_tracker) {
+         if(job.format == kConvFmt_t2k_tracker) {
            if(pdgc==kPdgK0 || pdgc==kPdgAntiK0) {
               RandomGen * rnd = RandomGen::Instance();
               double R =  rnd->RndGen().Rndm();
@@ -1540,7 +1251,7 @@ void ConvertToGTracker(void)
     // -- Add $info lines as necessary
     //
 
-    if(gOptOutFileFormat == kConvFmt_t2k_tracker) {
+    if(job.format == kConvFmt_t2k_tracker) {
       //
       // Writing $info lines with information identical to the one saved at the rootracker-format 
       // files for the nd280MC. SKDETSIM can propagate all that complete MC truth information into 
@@ -1613,7 +1324,7 @@ void ConvertToGTracker(void)
                           << endl;
 
       // insert etc info line for format versions >= 2
-      if(gOptVersion >= 2) {
+      if(job.version >= 2) {
          int quark_id = -1;
          if( interaction->ProcInfo().IsDeepInelastic() && interaction->InitState().Tgt().HitQrkIsSet() ) {
             int quark_pdg = interaction->InitState().Tgt().HitQrkPdg();
@@ -1648,7 +1359,7 @@ void ConvertToGTracker(void)
         }
 
         // append rescattering code for format versions >= 2 
-        if(gOptVersion >= 2) {
+        if(job.version >= 2) {
            int rescat_code = -1;
            bool have_rescat_code = false;
            if(gFileMajorVrs >= 2) {
@@ -1690,7 +1401,7 @@ be agreed with the SKDETSIM maintainers.
                              << flux_info->ppi * flux_info->npi[1] << " " 
                              << flux_info->ppi * flux_info->npi[2] << " " 
                              << TMath::Sqrt(
-                                   TMath::Power(pdglib->Find(pdg::GeantToPdg(flux_info->ppid))->Mass(), 2.)
+                                   TMath::Power(pdglib->Mass(pdg::GeantToPdg(flux_info->ppid)), 2.)
                                  + TMath::Power(flux_info->ppi, 2.)
                                 )  << endl;
          // parent hadron x,y,z,t at decay
@@ -1704,7 +1415,7 @@ be agreed with the SKDETSIM maintainers.
                              << flux_info->ppi0 * flux_info->npi0[1] << " "
                              << flux_info->ppi0 * flux_info->npi0[2] << " "
                              << TMath::Sqrt(
-                                   TMath::Power(pdglib->Find(pdg::GeantToPdg(flux_info->ppid))->Mass(), 2.)
+                                   TMath::Power(pdglib->Mass(pdg::GeantToPdg(flux_info->ppid)), 2.)
                                  + TMath::Power(flux_info->ppi0, 2.)
                                 ) << endl;
          // parent hadron x,y,z,t at production
@@ -1725,21 +1436,19 @@ be agreed with the SKDETSIM maintainers.
     //
     output << "$ end" << endl;
 
-    mcrec->Clear();
   } // event loop
 
   // add tracker end-of-file tag
-  output << "$ stop" << endl;
+  if(job.footer) output << "$ stop" << endl;
 
   output.close();
-  fin.Close();
 
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> ROOTRACKER FORMATS 
 //____________________________________________________________________________________
-void ConvertToGRooTracker(void)
+void ConvertToGRooTracker(GNtpcJob_t & job)
 {
   //-- define the output rootracker tree branches
 
@@ -1913,13 +1622,13 @@ void ConvertToGRooTracker(void)
   double     brNumiFluxBeampz;            // Primary proton momentum, Z - component
 
   //-- open the output ROOT file
-  TFile fout(gOptOutFileName.c_str(), "RECREATE");
+  TFile fout(job.outfile.c_str(), "RECREATE");
 
   //-- create the output ROOT tree
   TTree * rootracker_tree = new TTree("gRooTracker","GENIE event tree rootracker format");
 
   //-- is it a `mock data' variance?
-  bool hide_truth = (gOptOutFileFormat == kConvFmt_rootracker_mock_data);
+  bool hide_truth = (job.format == kConvFmt_rootracker_mock_data);
 
   //-- create the output ROOT tree branches
 
@@ -1957,7 +1666,7 @@ void ConvertToGRooTracker(void)
   }
 
   // extra branches of the t2k rootracker variance
-  if(gOptOutFileFormat == kConvFmt_t2k_rootracker) 
+  if(job.format == kConvFmt_t2k_rootracker) 
   {
     // NEUT-like reaction code
     rootracker_tree->Branch("G2NeutEvtCode",   &brNeutCode,        "G2NeutEvtCode/I");   
@@ -2012,7 +1721,7 @@ void ConvertToGRooTracker(void)
   }
 
   // extra branches of the numi rootracker variance
-  if(gOptOutFileFormat == kConvFmt_numi_rootracker) 
+  if(job.format == kConvFmt_numi_rootracker) 
   {
    // GNuMI pass-through info
    rootracker_tree->Branch("NumiFluxRun",      &brNumiFluxRun,       "NumiFluxRun/I");
@@ -2079,23 +1788,17 @@ void ConvertToGRooTracker(void)
    rootracker_tree->Branch("NumiFluxBeampz",   &brNumiFluxBeampz,    "NumiFluxBeampz/D");
   }
 
-  //-- open the input GENIE ROOT file and get the TTree & its header
-  TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           gtree = 0;
-  NtpMCTreeHeader * thdr  = 0;
-  gtree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr  = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+  //-- the input GENIE GHEP events, their TTree & its header
+  GNtpcInput & input = *job.input;
+  TTree *           gtree = input.Tree();
+  NtpMCTreeHeader * thdr  = input.Header();
 
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
-  //-- get mc record
-  NtpMCEventRecord * mcrec = 0;
-  gtree->SetBranchAddress("gmcrec", &mcrec);
-
   //-- print-out metadata associated with the input event file in case the
   //   event file was generated using the gT2Kevgen driver
   //   (assuming this is the case if the requested output format is the t2k_rootracker format)
-  if(gOptOutFileFormat == kConvFmt_t2k_rootracker) 
+  if(job.format == kConvFmt_t2k_rootracker) 
   {
     // Check can find the MetaData
     genie::utils::T2KEvGenMetaData * metadata = NULL;
@@ -2112,12 +1815,12 @@ void ConvertToGRooTracker(void)
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
   flux::GJPARCNuFluxPassThroughInfo * jnubeam_flux_info = 0;
-  if(gOptOutFileFormat == kConvFmt_t2k_rootracker) {
-     gtree->SetBranchAddress("flux", &jnubeam_flux_info);
+  if(job.format == kConvFmt_t2k_rootracker) {
+     input.SetBranchAddress("flux", &jnubeam_flux_info);
   }
   flux::GNuMIFluxPassThroughInfo * gnumi_flux_info = 0;
-  if(gOptOutFileFormat == kConvFmt_numi_rootracker) {
-     gtree->SetBranchAddress("flux", &gnumi_flux_info);
+  if(job.format == kConvFmt_numi_rootracker) {
+     input.SetBranchAddress("flux", &gnumi_flux_info);
   }
 #else
   LOG("gntpc", pWARN) 
@@ -2127,18 +1830,10 @@ void ConvertToGRooTracker(void)
     << "--with-flux-drivers in the configuration step.";
 #endif
 
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-      gtree->GetEntries() : TMath::Min(gtree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
-
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    gtree->GetEntry(iev);
+  NtpMCEventRecord * mcrec = 0;
+  Long64_t iev = 0;
+  while( job.NextEvent(iev, mcrec) ) {
 
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -2148,7 +1843,7 @@ void ConvertToGRooTracker(void)
     LOG("gntpc", pINFO) << event;
     LOG("gntpc", pINFO) << *interaction;
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
-    if(gOptOutFileFormat == kConvFmt_t2k_rootracker) {
+    if(job.format == kConvFmt_t2k_rootracker) {
        if(jnubeam_flux_info) {
           LOG("gntpc", pINFO) << *jnubeam_flux_info;
        } else {
@@ -2294,7 +1989,7 @@ void ConvertToGRooTracker(void)
     //
     // fill in additional info for the t2k_rootracker format
     //
-    if(gOptOutFileFormat == kConvFmt_t2k_rootracker) {
+    if(job.format == kConvFmt_t2k_rootracker) {
 
       // map GENIE event to NEUT reaction codes
       brNeutCode = utils::ghep::NeutReactionCode(&event);
@@ -2312,7 +2007,7 @@ void ConvertToGRooTracker(void)
         brNuParentDecP4 [1] = jnubeam_flux_info->ppi * jnubeam_flux_info->npi[1]; // py
         brNuParentDecP4 [2] = jnubeam_flux_info->ppi * jnubeam_flux_info->npi[2]; // px
         brNuParentDecP4 [3] = TMath::Sqrt(
-                                 TMath::Power(pdglib->Find(brNuParentPdg)->Mass(), 2.)
+                                 TMath::Power(pdglib->Mass(brNuParentPdg), 2.)
                                + TMath::Power(jnubeam_flux_info->ppi, 2.)
                               ); // E
         brNuParentDecX4 [0] = jnubeam_flux_info->xpi[0]; // x
@@ -2324,7 +2019,7 @@ void ConvertToGRooTracker(void)
         brNuParentProP4 [1] = jnubeam_flux_info->ppi0 * jnubeam_flux_info->npi0[1]; // py
         brNuParentProP4 [2] = jnubeam_flux_info->ppi0 * jnubeam_flux_info->npi0[2]; // px
         brNuParentProP4 [3] = TMath::Sqrt(
-                                TMath::Power(pdglib->Find(brNuParentPdg)->Mass(), 2.)
+                                TMath::Power(pdglib->Mass(brNuParentPdg), 2.)
                               + TMath::Power(jnubeam_flux_info->ppi0, 2.)
                               ); // E
         brNuParentProX4 [0] = jnubeam_flux_info->xpi0[0]; // x
@@ -2391,7 +2086,7 @@ void ConvertToGRooTracker(void)
     //
     // fill in additional info for the numi_rootracker format
     //
-    if(gOptOutFileFormat == kConvFmt_numi_rootracker) {
+    if(job.format == kConvFmt_numi_rootracker) {
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
      // Copy flux info if this is the numi rootracker variance.
      if(gnumi_flux_info) {
@@ -2463,7 +2158,6 @@ void ConvertToGRooTracker(void)
 
     // fill tree
     rootracker_tree->Fill();
-    mcrec->Clear();
 
   } // event loop
 
@@ -2472,16 +2166,14 @@ void ConvertToGRooTracker(void)
   rootracker_tree->SetWeight(pot);
 
   // Copy MC job metadata (gconfig and genv TFolders)
-  if(gOptCopyJobMeta) {
-    TFolder * genv    = (TFolder*) fin.Get("genv");
-    TFolder * gconfig = (TFolder*) fin.Get("gconfig");    
+  if(job.copy_meta) {
+    TFolder * genv    = (TFolder*) input.File()->Get("genv");
+    TFolder * gconfig = (TFolder*) input.File()->Get("gconfig");    
     fout.cd();
     genv    -> Write("genv");
     gconfig -> Write("gconfig");
   }
 
-  fin.Close();
-
   fout.Write();
   fout.Close();
 
@@ -2490,7 +2182,7 @@ void ConvertToGRooTracker(void)
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE -> NEUGEN-style format for AGKY studies 
 //____________________________________________________________________________________
-void ConvertToGHad(void)
+void ConvertToGHad(GNtpcJob_t & job)
 {
 // Neugen-style text format for the AGKY hadronization model studies
 // Format:
@@ -2504,21 +2196,12 @@ void ConvertToGHad(void)
 // ... then for each stable daughter
 // particle id, 5 vec 
 
-  //-- open the ROOT file and get the TTree & its header
-  TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           tree = 0;
-  NtpMCTreeHeader * thdr = 0;
-  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-
-  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
-
-  //-- get mc record
-  NtpMCEventRecord * mcrec = 0;
-  tree->SetBranchAddress("gmcrec", &mcrec);
+  //-- the input GHEP events & their header
+  GNtpcInput & input = *job.input;
+  LOG("gntpc", pINFO) << "Input tree header: " << *input.Header();
 
   //-- open the output stream
-  ofstream output(gOptOutFileName.c_str(), ios::out);
+  ofstream output(job.outfile.c_str(), ios::out);
 
   //-- open output root file and create ntuple -- if required
 #ifdef __GHAD_NTP__
@@ -2534,18 +2217,10 @@ void ConvertToGHad(void)
   ghad->Branch("pz",       brPz,           "pz[n]/D"   );
 #endif
 
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-      tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
-
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
-    tree->GetEntry(iev);
+  NtpMCEventRecord * mcrec = 0;
+  Long64_t iev = 0;
+  while( job.NextEvent(iev, mcrec) ) {
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
 
@@ -2575,10 +2250,7 @@ void ConvertToGHad(void)
     bool is_cc  = proc_info.IsWeakCC();
 
     bool pass   = is_cc && (is_dis || is_res);
-    if(!pass) {
-      mcrec->Clear();
-      continue;
-    }
+    if(!pass) continue;
 
     int ccnc   = is_cc ? 1 : 0;
     int inttyp = 3; 
@@ -2717,12 +2389,9 @@ void ConvertToGHad(void)
     ghad->Fill();
 #endif
 
-    mcrec->Clear();
-
   } // event loop
 
   output.close();
-  fin.Close();
 
 #ifdef __GHAD_NTP__
   ghad->Write("ghad");
@@ -2735,7 +2404,7 @@ void ConvertToGHad(void)
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE -> Summary tree for INTRANUKE studies 
 //____________________________________________________________________________________
-void ConvertToGINuke(void)
+void ConvertToGINuke(GNtpcJob_t & job)
 {
   //-- output tree branch variables
   //
@@ -2770,8 +2439,8 @@ void ConvertToGINuke(void)
   //-- open output file & create output summary tree & create the tree branches
   //
   LOG("gntpc", pNOTICE)
-       << "*** Saving summary tree to: " << gOptOutFileName;
-  TFile fout(gOptOutFileName.c_str(),"recreate");
+       << "*** Saving summary tree to: " << job.outfile;
+  TFile fout(job.outfile.c_str(),"recreate");
    
 TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
   assert(tEvtTree);
@@ -2806,38 +2475,14 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
   tEvtTree->Branch("npim",      &brNpim,         "npim/I"      );
   tEvtTree->Branch("npi0",      &brNpi0,         "npi0/I"      );
 
-  //-- open the ROOT file and get the TTree & its header
-  TFile fin(gOptInpFileName.c_str(),"READ");
-  TTree *           er_tree = 0;
-  NtpMCTreeHeader * thdr    = 0;
-  er_tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
-  thdr    = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-  if (!er_tree) {
-    LOG("gntpc", pERROR) << "Null input tree";
-    return;
-  }
-  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
+  //-- the input GHEP events & their header
+  GNtpcInput & input = *job.input;
+  LOG("gntpc", pINFO) << "Input tree header: " << *input.Header();
 
-  //-- get the mc record
   NtpMCEventRecord * mcrec = 0;
-  er_tree->SetBranchAddress("gmcrec", &mcrec);
-  if (!mcrec) {
-    LOG("gntpc", pERROR) << "Null MC record";
-    return;
-  }
-
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ?
-       er_tree->GetEntries() : TMath::Min( er_tree->GetEntries(), gOptN );
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
-
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  Long64_t iev = 0;
+  while( job.NextEvent(iev, mcrec) ) {
     brIEv = iev; 
-    er_tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
 
@@ -2934,12 +2579,8 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
     // fill the summary tree
     tEvtTree->Fill();
 
-    mcrec->Clear();
-
   } // event loop
 
-  fin.Close();
-
   fout.Write();
   fout.Close();
 
@@ -2979,44 +2620,88 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(2);
   }
 
-  // get output file format
+  // get output file format(s)
+  vector<string> formats;
   if( parser.OptionExists('f') ) {
-    LOG("gntpc", pINFO) << "Reading output file format";
-    string fmt = parser.ArgAsString('f');
-
-         if (fmt == "gst")                   { gOptOutFileFormat = kConvFmt_gst;                   }
-    else if (fmt == "gxml")                  { gOptOutFileFormat = kConvFmt_gxml;                  }
-    else if (fmt == "ghep_mock_data")        { gOptOutFileFormat = kConvFmt_ghep_mock_data;        }
-    else if (fmt == "rootracker")            { gOptOutFileFormat = kConvFmt_rootracker;            }
-    else if (fmt == "rootracker_mock_data")  { gOptOutFileFormat = kConvFmt_rootracker_mock_data;  }
-    else if (fmt == "t2k_rootracker")        { gOptOutFileFormat = kConvFmt_t2k_rootracker;        }
-    else if (fmt == "numi_rootracker")       { gOptOutFileFormat = kConvFmt_numi_rootracker;       }
-    else if (fmt == "t2k_tracker")           { gOptOutFileFormat = kConvFmt_t2k_tracker;           }
-    else if (fmt == "nuance_tracker" )       { gOptOutFileFormat = kConvFmt_nuance_tracker;        }
-    else if (fmt == "ghad")                  { gOptOutFileFormat = kConvFmt_ghad;                  }
-    else if (fmt == "ginuke")                { gOptOutFileFormat = kConvFmt_ginuke;                }
-    else                                     { gOptOutFileFormat = kConvFmt_undef;                 }
-
-    if(gOptOutFileFormat == kConvFmt_undef) {
+    LOG("gntpc", pINFO) << "Reading output file format(s)";
+    formats = parser.ArgAsStringTokens('f', ",");
+  }
+  if(formats.size() == 0) {
+    LOG("gntpc", pFATAL) << "Unspecified output file format";
+    gAbortingInErr = true;
+    exit(4);
+  }
+
+  bool t2k_flux  = false;
+  bool numi_flux = false;
+  vector<string>::const_iterator fmt_iter = formats.begin();
+  for( ; fmt_iter != formats.end(); ++fmt_iter) {
+    string fmt = *fmt_iter;
+    GNtpcFmt_t fmtid = kConvFmt_undef;
+
+         if (fmt == "gst")                   { fmtid = kConvFmt_gst;                   }
+    else if (fmt == "gxml")                  { fmtid = kConvFmt_gxml;                  }
+    else if (fmt == "ghep")                  { fmtid = kConvFmt_ghep;                  }
+    else if (fmt == "compact_ghep")          { fmtid = kConvFmt_compact_ghep;          }
+    else if (fmt == "ghep_mock_data")        { fmtid = kConvFmt_ghep_mock_data;        }
+    else if (fmt == "rootracker")            { fmtid = kConvFmt_rootracker;            }
+    else if (fmt == "rootracker_mock_data")  { fmtid = kConvFmt_rootracker_mock_data;  }
+    else if (fmt == "t2k_rootracker")        { fmtid = kConvFmt_t2k_rootracker;        }
+    else if (fmt == "numi_rootracker")       { fmtid = kConvFmt_numi_rootracker;       }
+    else if (fmt == "t2k_tracker")           { fmtid = kConvFmt_t2k_tracker;           }
+    else if (fmt == "nuance_tracker" )       { fmtid = kConvFmt_nuance_tracker;        }
+    else if (fmt == "ghad")                  { fmtid = kConvFmt_ghad;                  }
+    else if (fmt == "ginuke")                { fmtid = kConvFmt_ginuke;                }
+
+    if(fmtid == kConvFmt_undef) {
       LOG("gntpc", pFATAL) << "Unknown output file format (" << fmt << ")";
       gAbortingInErr = true;
       exit(3);
     }
+    if(std::count(gOptOutFileFormats.begin(), gOptOutFileFormats.end(), fmtid) > 0) {
+      LOG("gntpc", pFATAL) << "Output file format requested twice (" << fmt << ")";
+      gAbortingInErr = true;
+      exit(3);
+    }
+    gOptOutFileFormats.push_back(fmtid);
 
-  } else {
-    LOG("gntpc", pFATAL) << "Unspecified output file format";
+    t2k_flux  = t2k_flux  || (fmtid == kConvFmt_t2k_rootracker ||
+                              fmtid == kConvFmt_t2k_tracker);
+    numi_flux = numi_flux || (fmtid == kConvFmt_numi_rootracker);
+  }
+
+  // the flux pass-through branch can only be read as one type
+  if(t2k_flux && numi_flux) {
+    LOG("gntpc", pFATAL)
+       << "The T2K and NuMI formats can not be converted to in the same job";
     gAbortingInErr = true;
-    exit(4);
+    exit(3);
   }
 
   // get output file name 
   if( parser.OptionExists('o') ) {
     LOG("gntpc", pINFO) << "Reading output filename";
-    gOptOutFileName = parser.ArgAsString('o');
+    if(gOptOutFileFormats.size() > 1) {
+      LOG("gntpc", pFATAL)
+         << "An output filename can only be specified for a single output format";
+      gAbortingInErr = true;
+      exit(4);
+    }
+    gOptOutFileNames.push_back(parser.ArgAsString('o'));
   } else {
     LOG("gntpc", pINFO)
        << "Unspecified output filename - Using default";
-    gOptOutFileName = DefaultOutputFile();
+    for(unsigned int i = 0; i < gOptOutFileFormats.size(); i++) {
+      string filename = DefaultOutputFile(gOptOutFileFormats[i]);
+      if(std::count(gOptOutFileNames.begin(), gOptOutFileNames.end(), filename) > 0) {
+        LOG("gntpc", pFATAL)
+           << "Requested formats have the same default output filename ("
+           << filename << ") - Convert to them in separate jobs";
+        gAbortingInErr = true;
+        exit(4);
+      }
+      gOptOutFileNames.push_back(filename);
+    }
   }
 
   // get number of events to convert
@@ -3038,9 +2723,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   } else {
     LOG("gntpc", pINFO)
        << "Unspecified version number - Use latest";
-    gOptVersion = LatestFormatVersionNumber();
-    LOG("gntpc", pINFO)
-       << "Latest version number: " << gOptVersion;
+    gOptVersion = -1;
   }
 
   // check whether to copy MC job metadata (only if output file is in ROOT format)
@@ -3054,33 +2737,48 @@ void GetCommandLineArgs(int argc, char ** argv)
     LOG("gntpc", pINFO) << "Unspecified random number seed - Using default";
     gOptRanSeed = -1;
   }
+
+  // number of parallel worker processes
+  if( parser.OptionExists('j') ) {
+    LOG("gntpc", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt('j'));
+  } else {
+    gOptNWorkers = 1;
+  }
  
   LOG("gntpc", pNOTICE) << "Input filename  = " << gOptInpFileName;
-  LOG("gntpc", pNOTICE) << "Output filename = " << gOptOutFileName;
-  LOG("gntpc", pNOTICE) << "Conversion to format = " << gOptRanSeed 
-                        << ", vrs = " << gOptVersion;
+  for(unsigned int i = 0; i < gOptOutFileFormats.size(); i++) {
+    GNtpcFmt_t fmt = gOptOutFileFormats[i];
+    LOG("gntpc", pNOTICE) 
+      << "Conversion to format = " << formats[i] << ", vrs = "
+      << ((gOptVersion < 0) ? LatestFormatVersionNumber(fmt) : gOptVersion)
+      << ", output filename = " << gOptOutFileNames[i];
+  }
   LOG("gntpc", pNOTICE) << "Number of events to be converted = " << gOptN;
   LOG("gntpc", pNOTICE) << "Copy metadata? = " << ((gOptCopyJobMeta) ? "Yes" : "No");
   LOG("gntpc", pNOTICE) << "Random number seed = " << gOptRanSeed;
+  LOG("gntpc", pNOTICE) << "Number of worker processes = " << gOptNWorkers;
 
   LOG("gntpc", pNOTICE) << *RunOpt::Instance();
 }
 //____________________________________________________________________________________
-string DefaultOutputFile(void)
+string DefaultOutputFile(GNtpcFmt_t fmt)
 {
   // filename extension - depending on file format
   string ext="";
-  if      (gOptOutFileFormat == kConvFmt_gst                  ) { ext = "gst.root";         }
-  else if (gOptOutFileFormat == kConvFmt_gxml                 ) { ext = "gxml";             }
-  else if (gOptOutFileFormat == kConvFmt_ghep_mock_data       ) { ext = "mockd.ghep.root";  }
-  else if (gOptOutFileFormat == kConvFmt_rootracker           ) { ext = "gtrac.root";       }
-  else if (gOptOutFileFormat == kConvFmt_rootracker_mock_data ) { ext = "mockd.gtrac.root"; }
-  else if (gOptOutFileFormat == kConvFmt_t2k_rootracker       ) { ext = "gtrac.root";       }
-  else if (gOptOutFileFormat == kConvFmt_numi_rootracker      ) { ext = "gtrac.root";       }
-  else if (gOptOutFileFormat == kConvFmt_t2k_tracker          ) { ext = "gtrac.dat";        }
-  else if (gOptOutFileFormat == kConvFmt_nuance_tracker       ) { ext = "gtrac_legacy.dat"; }
-  else if (gOptOutFileFormat == kConvFmt_ghad                 ) { ext = "ghad.dat";         }
-  else if (gOptOutFileFormat == kConvFmt_ginuke               ) { ext = "ginuke.root";      }
+  if      (fmt == kConvFmt_gst                  ) { ext = "gst.root";         }
+  else if (fmt == kConvFmt_gxml                 ) { ext = "gxml";             }
+  else if (fmt == kConvFmt_ghep                 ) { ext = "ghep.root";        }
+  else if (fmt == kConvFmt_compact_ghep         ) { ext = "cghep.root";       }
+  else if (fmt == kConvFmt_ghep_mock_data       ) { ext = "mockd.ghep.root";  }
+  else if (fmt == kConvFmt_rootracker           ) { ext = "gtrac.root";       }
+  else if (fmt == kConvFmt_rootracker_mock_data ) { ext = "mockd.gtrac.root"; }
+  else if (fmt == kConvFmt_t2k_rootracker       ) { ext = "gtrac.root";       }
+  else if (fmt == kConvFmt_numi_rootracker      ) { ext = "gtrac.root";       }
+  else if (fmt == kConvFmt_t2k_tracker          ) { ext = "gtrac.dat";        }
+  else if (fmt == kConvFmt_nuance_tracker       ) { ext = "gtrac_legacy.dat"; }
+  else if (fmt == kConvFmt_ghad                 ) { ext = "ghad.dat";         }
+  else if (fmt == kConvFmt_ginuke               ) { ext = "ginuke.root";      }
 
   string inpname = gOptInpFileName;
   unsigned int L = inpname.length();
@@ -3103,19 +2801,21 @@ string DefaultOutputFile(void)
   return gSystem->BaseName(name.str().c_str());
 }
 //____________________________________________________________________________________
-int LatestFormatVersionNumber(void)
+int LatestFormatVersionNumber(GNtpcFmt_t fmt)
 {
-  if      (gOptOutFileFormat == kConvFmt_gst                  ) return 1;
-  else if (gOptOutFileFormat == kConvFmt_gxml                 ) return 1;
-  else if (gOptOutFileFormat == kConvFmt_ghep_mock_data       ) return 1;
-  else if (gOptOutFileFormat == kConvFmt_rootracker           ) return 1;
-  else if (gOptOutFileFormat == kConvFmt_rootracker_mock_data ) return 1;
-  else if (gOptOutFileFormat == kConvFmt_t2k_rootracker       ) return 1;
-  else if (gOptOutFileFormat == kConvFmt_numi_rootracker      ) return 1;
-  else if (gOptOutFileFormat == kConvFmt_t2k_tracker          ) return 2;
-  else if (gOptOutFileFormat == kConvFmt_nuance_tracker       ) return 1;
-  else if (gOptOutFileFormat == kConvFmt_ghad                 ) return 1;
-  else if (gOptOutFileFormat == kConvFmt_ginuke               ) return 1;
+  if      (fmt == kConvFmt_gst                  ) return 1;
+  else if (fmt == kConvFmt_gxml                 ) return 1;
+  else if (fmt == kConvFmt_ghep                 ) return 1;
+  else if (fmt == kConvFmt_compact_ghep         ) return 1;
+  else if (fmt == kConvFmt_ghep_mock_data       ) return 1;
+  else if (fmt == kConvFmt_rootracker           ) return 1;
+  else if (fmt == kConvFmt_rootracker_mock_data ) return 1;
+  else if (fmt == kConvFmt_t2k_rootracker       ) return 1;
+  else if (fmt == kConvFmt_numi_rootracker      ) return 1;
+  else if (fmt == kConvFmt_t2k_tracker          ) return 2;
+  else if (fmt == kConvFmt_nuance_tracker       ) return 1;
+  else if (fmt == kConvFmt_ghad                 ) return 1;
+  else if (fmt == kConvFmt_ginuke               ) return 1;
 
   return -1;
 }
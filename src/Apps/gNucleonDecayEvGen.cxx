@@ -10,13 +10,14 @@
          gevgen_ndcy [-h] 
                      [-r run#] 
                       -n n_of_events
-                      -m decay_mode
+                      -m decay_mode[,decay_mode,...] | all
 		     [-N decayed_nucleon_pdg]
 	              -g geometry
                      [-L geometry_length_units] 
                      [-D geometry_density_units]
                      [-t geometry_top_volume_name]
                      [-o output_event_file_prefix]
+                     [-j n_of_threads]
                      [--seed random_number_seed]
                      [--message-thresholds xml_file]
                      [--event-record-print-level level]
@@ -31,8 +32,14 @@
            -r 
               Specifies the MC run number [default: 1000].
            -n  
-              Specifies how many events to generate.
+              Specifies how many events to generate (per decay channel).
            -m 
+              Nucleon decay mode ID, a comma separated list of IDs or `all'
+              (all the valid decay mode / decayed nucleon combinations).
+              The events of each decay channel are written in an output
+              file of their own when more than one channel is generated,
+              with the decay mode ID and the decayed nucleon appended to
+              the file prefix, eg `gntp.mode1_p.1000.ghep.root'.
               Nucleon decay mode ID:
 	      see http://www-pdg.lbl.gov/2016/listings/rpp2016-list-p.pdf
 	      for nucleon decay mode numbering convention
@@ -97,6 +104,10 @@
               The default output filename is: 
               gntp.[run_number].ghep.root
               This cmd line arguments lets you override 'gntp'
+           -j
+              Number of event generation threads [default: 1].
+              Each thread generates every n-th event with its own copy of
+              the nucleon decay generator; the events are written in order.
            --seed
               Random number seed.
 
@@ -118,12 +129,16 @@
 #include <vector>
 #include <sstream>
 
+#include <RVersion.h>
+#include <TROOT.h>
+#include <TMath.h>
 #include <TSystem.h> 
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/EventGen/ThreadedEventLoopI.h"
 #include "Framework/EventGen/GMCJMonitor.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
@@ -146,11 +161,27 @@ using std::ostringstream;
 
 using namespace genie;
 
+// a decay channel: decay mode & decayed nucleon
+struct DecayChannel {
+  NucleonDecayMode_t mode;
+  int                nucleon;   // decayed nucleon PDG code
+  int                nucleon_opt; // decayed nucleon PDG code as input (0 if unspecified)
+};
+
 // function prototypes
 void  GetCommandLineArgs (int argc, char ** argv);
 void  PrintSyntax        (void);
-int   SelectInitState    (void);
-const EventRecordVisitorI * NucleonDecayGenerator(void);
+int   SelectInitState    (int dpdg);
+string ChannelFilePrefix (const DecayChannel & channel);
+void  GenerateEvents     (const DecayChannel & channel, int ichannel,
+                          const EventRecordVisitorI * mcgen,
+                          NtpWriter & ntpw, GMCJMonitor & mcjmonitor);
+void  GenerateEvents     (const DecayChannel & channel, int ichannel,
+                          const vector<const EventRecordVisitorI *> & mcgens,
+                          NtpWriter & ntpw, GMCJMonitor & mcjmonitor);
+EventRecord * GenerateEvent (const DecayChannel & channel, Long64_t ikey,
+                             const EventRecordVisitorI * mcgen);
+const EventRecordVisitorI * NucleonDecayGenerator(bool adopt = false);
 
 //
 string          kDefOptGeomLUnits   = "mm";    // default geometry length units
@@ -160,9 +191,8 @@ string          kDefOptEvFilePrefix = "gntp";
 
 //
 Long_t             gOptRunNu        = 1000;                // run number
-int                gOptNev          = 10;                  // number of events to generate
-NucleonDecayMode_t gOptDecayMode    = kNDNull;             // nucleon decay mode
-int                gOptDecayedNucleon = kNDNull;           // decayed nucleon PDG
+int                gOptNev          = 10;                  // number of events to generate (per decay channel)
+vector<DecayChannel> gOptDecayChannels;                    // decay channels (mode & decayed nucleon)
 string             gOptEvFilePrefix = kDefOptEvFilePrefix; // event file prefix
 bool               gOptUsingRootGeom = false;              // using root geom or target mix?
 map<int,double>    gOptTgtMix;                             // target mix  (tgt pdg -> wght frac) / if not using detailed root geom
@@ -171,6 +201,7 @@ string             gOptRootGeomTopVol = "";                // input geometry top
 double             gOptGeomLUnits = 0;                     // input geometry length units 
 double             gOptGeomDUnits = 0;                     // input geometry density units 
 long int           gOptRanSeed = -1;                       // random number seed
+int                gOptNThreads = 1;                       // number of event generation threads
 
 //_________________________________________________________________________________________
 int main(int argc, char ** argv)
@@ -182,11 +213,6 @@ int main(int argc, char ** argv)
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::RandGen(gOptRanSeed);
 
-  // Initialize an Ntuple Writer to save GHEP records into a TTree
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
-  ntpw.Initialize();
-
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
@@ -194,18 +220,91 @@ int main(int argc, char ** argv)
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
-  // Get the nucleon decay generator
-  const EventRecordVisitorI * mcgen = NucleonDecayGenerator();
+  // Get the nucleon decay generators: the one of the algorithm factory and,
+  // for each additional thread, a private copy (with its own sub-algorithms
+  // and caches). They are all configured here, serially, as the algorithm
+  // factory and the configuration pool are not thread-safe.
+  vector<const EventRecordVisitorI *> mcgens;
+  for(int ithread = 0; ithread < gOptNThreads; ithread++) {
+     mcgens.push_back(NucleonDecayGenerator(ithread > 0));
+  }
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  if(gOptNThreads > 1) ROOT::EnableThreadSafety();
+#endif
+
+  // Generate the events of each decay channel in an output file of its own
+  for(unsigned int ich = 0; ich < gOptDecayChannels.size(); ich++) {
+     const DecayChannel & channel = gOptDecayChannels[ich];
+
+     LOG("gevgen_ndcy", pNOTICE)
+        << " *** Generating " << gOptNev << " events for decay channel "
+        << utils::nucleon_decay::AsString(channel.mode, channel.nucleon_opt);
+
+     // Initialize an Ntuple Writer to save GHEP records into a TTree
+     NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+     ntpw.CustomizeFilenamePrefix(ChannelFilePrefix(channel));
+     ntpw.Initialize();
+
+     if(gOptNThreads > 1) {
+       GenerateEvents(channel, ich, mcgens, ntpw, mcjmonitor);
+     } else {
+       GenerateEvents(channel, ich, mcgens[0], ntpw, mcjmonitor);
+     }
+
+     // Save the generated event tree & close the output file
+     ntpw.Save();
+  }
+
+  // Clean-up the generators owned by the job
+  for(unsigned int i = 1; i < mcgens.size(); i++) {
+     delete mcgens[i];
+  }
+
+  LOG("gevgen_ndcy", pNOTICE) << "Done!";
+
+  return 0;
+}
+//_________________________________________________________________________________________
+string ChannelFilePrefix(const DecayChannel & channel)
+{
+// The output file prefix of a decay channel: the input prefix if there is a
+// single channel, otherwise the input prefix followed by the decay mode ID
+// and the decayed nucleon, eg `gntp.mode1_p'
+
+  if(gOptDecayChannels.size() == 1) return gOptEvFilePrefix;
+
+  ostringstream prefix;
+  prefix << gOptEvFilePrefix << ".mode" << (int) channel.mode << "_"
+         << ((channel.nucleon == kPdgProton) ? "p" : "n");
+  return prefix.str();
+}
+//_________________________________________________________________________________________
+EventRecord * GenerateEvent(
+   const DecayChannel & channel, Long64_t ikey, const EventRecordVisitorI * mcgen)
+{
+  // with counter-based random number streams, the event is keyed by
+  // its index in the job, whichever thread generates it
+  RandomGen * rnd = RandomGen::Instance();
+  if(rnd->CounterBased()) rnd->SetEventIndex(ikey);
+
+  EventRecord * event = new EventRecord;
+  int target = SelectInitState(channel.nucleon);
+  int decay  = (int)channel.mode;
+  Interaction * interaction = Interaction::NDecay(target,decay,channel.nucleon);
+  event->AttachSummary(interaction);
 
+  // Simulate decay     
+  mcgen->ProcessEventRecord(event);
+
+  return event;
+}
+//_________________________________________________________________________________________
+void GenerateEvents(
+   const DecayChannel & channel, int ichannel, const EventRecordVisitorI * mcgen,
+   NtpWriter & ntpw, GMCJMonitor & mcjmonitor)
+{
   // Event loop
   int ievent = 0;
-  int dpdg = 0;
-  if (gOptDecayedNucleon > 0) {
-    dpdg = gOptDecayedNucleon;
-  } else {
-    dpdg = utils::nucleon_decay::DecayedNucleonPdgCode(gOptDecayMode);
-  }  
-
   while (1)
   {
      if(ievent == gOptNev) break;
@@ -213,49 +312,75 @@ int main(int argc, char ** argv)
      LOG("gevgen_ndcy", pNOTICE)
           << " *** Generating event............ " << ievent;
 
-     EventRecord * event = new EventRecord;
-     int target = SelectInitState();
-     int decay  = (int)gOptDecayMode;
-     Interaction * interaction = Interaction::NDecay(target,decay,dpdg);
-     event->AttachSummary(interaction);
-
-     // Simulate decay     
-     mcgen->ProcessEventRecord(event);
+     Long64_t ikey = (Long64_t) ichannel * gOptNev + ievent;
+     EventRecord * event = GenerateEvent(channel, ikey, mcgen);
 
      LOG("gevgen_ndcy", pINFO)
          << "Generated event: " << *event;
 
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
+     mcjmonitor.Update(ikey,event);
      delete event;
 
      ievent++;
   } // event loop
+}
+//_________________________________________________________________________________________
+namespace {
+  // The multi-threaded event loop of a decay channel: thread i generates the
+  // events i, i+nthreads, ... with its own generator
+  class DecayLoop : public ThreadedEventLoopI {
+  public:
+    DecayLoop(const DecayChannel & channel, int ichannel,
+              const vector<const EventRecordVisitorI *> & mcgens,
+              NtpWriter & ntpw, GMCJMonitor & mcjmonitor) :
+      fChannel(channel), fIChannel(ichannel), fGenerators(mcgens),
+      fNtpWriter(ntpw), fMonitor(mcjmonitor) { }
+
+  protected:
+    EventRecord * GenerateEvent(int ithread, long int ievent)
+    {
+      Long64_t ikey = (Long64_t) fIChannel * gOptNev + ievent;
+      return ::GenerateEvent(fChannel, ikey, fGenerators[ithread]);
+    }
+    void WriteEvent(long int ievent, EventRecord * event)
+    {
+      LOG("gevgen_ndcy", pINFO)
+          << "Generated event: " << *event;
+
+      Long64_t ikey = (Long64_t) fIChannel * gOptNev + ievent;
+      fNtpWriter.AddEventRecord(ievent, event);
+      fMonitor.Update(ikey,event);
+    }
 
-  // Save the generated event tree & close the output file
-  ntpw.Save();
-
-  LOG("gevgen_ndcy", pNOTICE) << "Done!";
-
-  return 0;
+  private:
+    const DecayChannel &                        fChannel;
+    int                                         fIChannel;
+    const vector<const EventRecordVisitorI *> & fGenerators;
+    NtpWriter &                                 fNtpWriter;
+    GMCJMonitor &                               fMonitor;
+  };
 }
 //_________________________________________________________________________________________
-int SelectInitState(void)
+void GenerateEvents(
+   const DecayChannel & channel, int ichannel,
+   const vector<const EventRecordVisitorI *> & mcgens,
+   NtpWriter & ntpw, GMCJMonitor & mcjmonitor)
 {
-  if (!utils::nucleon_decay::IsValidMode(gOptDecayMode, gOptDecayedNucleon)) {
-    LOG("gevgen_ndcy", pFATAL) << "Not a valid decay mode and/or decayed nucleon...";
-    gAbortingInErr = true;
-    exit(1);
-  }
+// Multi-threaded event loop: thread i generates events i, i+nthreads, ...
+// with its own generator and random number generator, and the calling
+// thread writes them in order (see ThreadedEventLoopI). Without
+// counter-based streams, the thread seeds differ for each channel.
 
-  int dpdg = 0;
-  if (gOptDecayedNucleon > 0) {
-    dpdg = gOptDecayedNucleon;
-  } else {
-     dpdg = utils::nucleon_decay::DecayedNucleonPdgCode(gOptDecayMode);
-  }
+  int nthreads = mcgens.size();
 
+  DecayLoop loop(channel, ichannel, mcgens, ntpw, mcjmonitor);
+  loop.Run(gOptNev, nthreads, ichannel * nthreads);
+}
+//_________________________________________________________________________________________
+int SelectInitState(int dpdg)
+{
   map<int,double> cprob; // cumulative probability 
   map<int,double>::const_iterator iter;
  
@@ -295,13 +420,22 @@ int SelectInitState(void)
   exit(1);
 }
 //_________________________________________________________________________________________
-const EventRecordVisitorI * NucleonDecayGenerator(void)
+const EventRecordVisitorI * NucleonDecayGenerator(bool adopt)
 {
+// Returns the nucleon decay generator of the algorithm factory or, if adopt
+// is set, a copy owned by the caller, along with its sub-algorithms
+
   string sname   = "genie::EventGenerator";
   string sconfig = "NucleonDecay";
   AlgFactory * algf = AlgFactory::Instance();
-  const EventRecordVisitorI * mcgen =
-     dynamic_cast<const EventRecordVisitorI *> (algf->GetAlgorithm(sname,sconfig));
+  const EventRecordVisitorI * mcgen = 0;
+  if(adopt) {
+     Algorithm * alg = algf->AdoptAlgorithm(sname,sconfig);
+     if(alg) alg->AdoptSubstructure();
+     mcgen = dynamic_cast<const EventRecordVisitorI *> (alg);
+  } else {
+     mcgen = dynamic_cast<const EventRecordVisitorI *> (algf->GetAlgorithm(sname,sconfig));
+  }
   if(!mcgen) {
      LOG("gevgen_ndcy", pFATAL) << "Couldn't instantiate the nucleon decay generator";
      gAbortingInErr = true;
@@ -350,31 +484,66 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(0);
   } //-n
 
-  // decay mode
-  int mode = -1;
+  // decay mode(s)
+  string modes = "";
   if( parser.OptionExists('m') ) {
     LOG("gevgen_ndcy", pDEBUG) 
         << "Reading decay mode";
-    mode = parser.ArgAsInt('m');
+    modes = parser.ArgAsString('m');
   } else {
     LOG("gevgen_ndcy", pFATAL) 
         << "You need to specify the decay mode";
     PrintSyntax();
     exit(0);
   } //-m
-  gOptDecayMode = (NucleonDecayMode_t) mode;
 
   // decayed nucleon PDG
+  int decayed_nucleon = 0;
   if( parser.OptionExists('N') ) {
     LOG("gevgen_ndcy", pINFO) << "Reading decayed nucleon PDG";
-    gOptDecayedNucleon = parser.ArgAsInt('N');
+    decayed_nucleon = parser.ArgAsInt('N');
   } else {
     LOG("gevgen_ndcy", pINFO) << "Unspecified decayed nucleon PDG - Using default";
-    gOptDecayedNucleon = 0;
+    decayed_nucleon = 0;
   }  
 
-  bool valid_mode = utils::nucleon_decay::IsValidMode(gOptDecayMode, gOptDecayedNucleon);
-  if(!valid_mode) {
+  // build the list of decay channels: all the valid decay mode / decayed
+  // nucleon combinations, or the input comma separated list of modes
+  gOptDecayChannels.clear();
+  if(modes == "all") {
+    const int nucleons[2] = { kPdgProton, kPdgNeutron };
+    for(int mode = 1; mode <= (int) kNDn2fivenus; mode++) {
+      for(int in = 0; in < 2; in++) {
+        if(decayed_nucleon > 0 && decayed_nucleon != nucleons[in]) continue;
+        NucleonDecayMode_t ndm = (NucleonDecayMode_t) mode;
+        if(!utils::nucleon_decay::IsValidMode(ndm, nucleons[in])) continue;
+        DecayChannel channel;
+        channel.mode        = ndm;
+        channel.nucleon     = nucleons[in];
+        channel.nucleon_opt = nucleons[in];
+        gOptDecayChannels.push_back(channel);
+      }
+    }
+  } else {
+    vector<string> modev = utils::str::Split(modes, ",");
+    for(unsigned int i = 0; i < modev.size(); i++) {
+      DecayChannel channel;
+      channel.mode        = (NucleonDecayMode_t) atoi(modev[i].c_str());
+      channel.nucleon_opt = decayed_nucleon;
+      channel.nucleon     = (decayed_nucleon > 0) ? decayed_nucleon :
+             utils::nucleon_decay::DecayedNucleonPdgCode(channel.mode);
+      bool valid_mode = utils::nucleon_decay::IsValidMode(
+             channel.mode, channel.nucleon_opt);
+      if(!valid_mode) {
+        LOG("gevgen_ndcy", pFATAL) 
+            << "You need to specify a valid decay mode / decayed nucleon PDG combination";
+        PrintSyntax();
+        exit(0);
+      }
+      gOptDecayChannels.push_back(channel);
+    }
+  }
+  if(gOptDecayChannels.size() == 0) {
     LOG("gevgen_ndcy", pFATAL) 
         << "You need to specify a valid decay mode / decayed nucleon PDG combination";
     PrintSyntax();
@@ -500,6 +669,15 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // number of event generation threads
+  if( parser.OptionExists('j') ) {
+    LOG("gevgen_ndcy", pINFO) << "Reading number of threads";
+    gOptNThreads = TMath::Max(1, parser.ArgAsInt('j'));
+  } else {
+    LOG("gevgen_ndcy", pINFO) << "Unspecified number of threads - Using 1";
+    gOptNThreads = 1;
+  }
+
   //
   // >>> print the command line options
   //
@@ -527,6 +705,16 @@ void GetCommandLineArgs(int argc, char ** argv)
     }
   }
 
+  ostringstream chinfo;
+  for(unsigned int ich = 0; ich < gOptDecayChannels.size(); ich++) {
+    const DecayChannel & channel = gOptDecayChannels[ich];
+    if(ich > 0) chinfo << "\n                   ";
+    chinfo << utils::nucleon_decay::AsString(channel.mode, channel.nucleon_opt);
+    if(gOptDecayChannels.size() > 1) {
+      chinfo << " -> " << ChannelFilePrefix(channel);
+    }
+  }
+
   LOG("gevgen_ndcy", pNOTICE)
      << "\n\n"
      << utils::print::PrintFramedMesg("gevgen_ndcy job configuration");
@@ -534,9 +722,11 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gevgen_ndcy", pNOTICE) 
      << "\n @@ Run number: " << gOptRunNu
      << "\n @@ Random number seed: " << gOptRanSeed
-     << "\n @@ Decay channel $ " << utils::nucleon_decay::AsString(gOptDecayMode, gOptDecayedNucleon)
+     << "\n @@ Decay channel $ " << chinfo.str()
      << "\n @@ Geometry      $ " << gminfo.str()
-     << "\n @@ Statistics    $ " << gOptNev << " events";
+     << "\n @@ Statistics    $ " << gOptNev << " events"
+     << ((gOptDecayChannels.size() > 1) ? " per decay channel" : "")
+     << "\n @@ Threads       $ " << gOptNThreads;
 
   //
   // Temporary warnings...
@@ -557,7 +747,7 @@ void PrintSyntax(void)
    << "\n **Syntax**"
    << "\n gevgen_ndcy [-h] "
    << "\n             [-r run#]"
-   << "\n              -m decay_mode"
+   << "\n              -m decay_mode[,decay_mode,...] | all"
    << "\n             [-N decayed_nucleon]"
    << "\n              -g geometry"
    << "\n             [-t top_volume_name_at_geom]"
@@ -565,6 +755,7 @@ void PrintSyntax(void)
    << "\n             [-D density_units_at_geom]"
    << "\n              -n n_of_events "
    << "\n             [-o output_event_file_prefix]"
+   << "\n             [-j n_of_threads]"
    << "\n             [--seed random_number_seed]"
    << "\n             [--message-thresholds xml_file]"
    << "\n             [--event-record-print-level level]"
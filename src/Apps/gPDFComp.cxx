@@ -5,18 +5,44 @@
 
 \brief   PDF comparison tool
 
-\syntax  gpdfcomp --pdf-set pdf_set [-o output]
+\syntax  gpdfcomp --pdf-set pdf_set [-o output] [-j nthreads] [--no-plots]
+                  [--grid-output grid_file]
 
          --pdf-set :
           Specifies a comma separated list of GENIE PDFs.
           The full algorithm name and configuration should be provided for
           each GENIE PDF as in `genie::model_name/model_config'.
-          (unique color and line styles are defined for up to 4 sets)
+          (unique color and line styles are defined for up to 4 sets: only
+          the first 4 are plotted, all are saved in the n-tuple & grid file)
 
          -o :
           Specifies a name to be used in the output files.
           Default: pdf_comp
 
+         -j :
+          The number of threads evaluating the PDF sets in parallel, each on
+          a private copy of the PDF set (owning its sub-algorithms). The
+          sets using the LHAPDF5 (Fortran) library are evaluated one at a
+          time. Default: 1
+
+         --no-plots :
+          Do not make the postscript file of plots (the n-tuple, and the
+          grid file if requested, are still written).
+
+         --grid-output :
+          Write the PDFs at the nodes of the (x,Q2) grid of the 2-D plots in
+          a flat binary file, for comparisons with external codes. In the
+          native byte order, the file holds:
+          - the 8 characters "GGRID001",
+          - the numbers of PDF sets, targets, quantities, x and Q2 nodes
+            (5 x int32),
+          - the PDF set names (per set: an int32 length and the characters),
+          - the target PDG codes (int32; the proton for gpdfcomp),
+          - the quantity names (per quantity: an int32 length and the
+            characters; here uv,dv,us,ds,s,c,b,t,g),
+          - the x and the Q2 nodes (double),
+          - the values (double), as [set][target][x][Q2][quantity].
+
 \example gpdfcomp --pdf-set genie::GRV98LO/Default,genie::BYPDF/Default 
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
@@ -32,6 +58,11 @@
 
 #include <vector>
 #include <string>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include <stdint.h>
 
 #include <TNtuple.h>
 #include <TFile.h>
@@ -45,9 +76,12 @@
 #include <TGraph.h>
 #include <TLatex.h>
 #include <TPaletteAxis.h>
+#include <TROOT.h>
+#include <RVersion.h>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
 #include "Physics/PartonDistributions/PDFModelI.h"
 //#include "Physics/PartonDistributions/LHAPDF5.h"
 #include "Physics/PartonDistributions/PDF.h"
@@ -60,14 +94,49 @@ using namespace genie;
 using namespace genie::utils;
 
 // globals
-string        gOptPDFSet  = "";         // --pdf-set argument
-string        gOptOutFile = "pdf_comp"; // -o argument
+string        gOptPDFSet   = "";         // --pdf-set argument
+string        gOptOutFile  = "pdf_comp"; // -o argument
+string        gOptGridFile = "";         // --grid-output argument
+int           gOptNThreads = 1;          // -j argument
+bool          gOptNoPlots  = false;      // --no-plots
 vector<const PDFModelI *> gPDFAlgList;
 
+// (x,Q2) grids: the 1-D plots are made at the nodes of a coarse grid, the
+// 2-D plots at the bin centres of a fine grid
+const unsigned int kNx1D  = 22;
+const unsigned int kNQ21D = 20;
+const unsigned int kNx2D  = 50; // bin edges
+const unsigned int kNQ22D = 50; // bin edges
+vector<double> gX1D;
+vector<double> gQ21D;
+vector<double> gXEdges2D;
+vector<double> gQ2Edges2D;
+vector<double> gX2D;
+vector<double> gQ22D;
+
+// the PDFs of each set, at the 1-D grid points followed by the 2-D grid
+// points (x-major)
+vector< vector<PDF_t> > gPDFGrid;
+
 // function prototypes
 void GetCommandLineArgs (int argc, char ** argv);
 void GetAlgorithms (void);
+void BuildGrids    (void);
+void CalculateGrids(void);
+void CalculateGrid (const PDFModelI * pdf_alg, vector<PDF_t> & pdfs, std::mutex * mtx);
+bool Reentrant     (const Algorithm * alg);
 void MakePlots     (void);
+void SaveNtuple    (void);
+void SaveGrids     (void);
+
+inline unsigned int Index1D (unsigned int ix, unsigned int iq2)
+{
+  return ix*kNQ21D + iq2;
+}
+inline unsigned int Index2D (unsigned int ix, unsigned int iq2)
+{
+  return kNx1D*kNQ21D + ix*(kNQ22D-1) + iq2;
+}
 
 //___________________________________________________________________
 int main(int argc, char ** argv)
@@ -76,73 +145,193 @@ int main(int argc, char ** argv)
 
   GetCommandLineArgs (argc,argv);   // Get command line arguments
   GetAlgorithms();                  // Get requested PDF algorithms
-  MakePlots();   // Produce all output plots and fill output n-tuple
+  BuildGrids();                     // Set the (x,Q2) grids
+  CalculateGrids();                 // Evaluate all PDF sets on the grids
+
+  if(!gOptNoPlots)            MakePlots();  // Produce all output plots
+  SaveNtuple();                             // Fill & save the output n-tuple
+  if(gOptGridFile.size() > 0) SaveGrids();  // Save the grids in a flat file
+
+  std::cout<<"Done."<<std::endl;
 
   return 0;
 }
 //_________________________________________________________________________________
-void MakePlots (void)
+void BuildGrids (void)
 {
-  const unsigned int nm = 4; // number of models
-  int    col [nm] = { kBlack, kRed+1,  kBlue-3, kGreen+2 };
-  int    sty [nm] = { kSolid, kDashed, kDashed, kDashed  };
-  int    mrk [nm] = { 20,     20,      20,      20       };
-  double msz [nm] = { 0.7,    0.7,     0.7,     0.7      };
-  const char * opt   [nm] = { "ap", "l", "l", "l" };
-  const char * lgopt [nm] = { "P",  "L", "L", "L" };
-
-  // Q2 range and values for 1-D plots
-  const unsigned int nQ2 = 20;
+  // Q2 values for 1-D plots
   const double Q2min = 1E-1; // GeV^2
   const double Q2max = 1E+3; // GeV^2
   const double log10Q2min = TMath::Log10(Q2min);
   const double log10Q2max = TMath::Log10(Q2max);
-  const double dlog10Q2 = (log10Q2max-log10Q2min)/(nQ2-1);
-  double Q2_arr [nQ2];
-  for(unsigned int iq2 = 0; iq2 < nQ2; iq2++) {
-     double Q2 = TMath::Power(10, log10Q2min + iq2*dlog10Q2);
-     Q2_arr[iq2] = Q2;
+  const double dlog10Q2 = (log10Q2max-log10Q2min)/(kNQ21D-1);
+  for(unsigned int iq2 = 0; iq2 < kNQ21D; iq2++) {
+     gQ21D.push_back(TMath::Power(10, log10Q2min + iq2*dlog10Q2));
   }
 
   // x values for 1-D plots
-  const unsigned int nx = 22;
-  double x_arr [nx] = {
+  double x_arr [kNx1D] = {
     0.0001, 0.0010, 0.0100, 0.0250, 0.0500, 
     0.0750, 0.1000, 0.1500, 0.2000, 0.2500, 
     0.3500, 0.4000, 0.4500, 0.5000, 0.5500, 
     0.6000, 0.7000, 0.7500, 0.8000, 0.8500, 
     0.9000, 0.9500
   };
+  gX1D.assign(x_arr, x_arr + kNx1D);
 
-  // Q2 range and values for 2-D plots
-  const unsigned int nQ2_2d = 50;
+  // Q2 bins for 2-D plots
   const double Q2min_2d = 1E-1; // GeV^2
   const double Q2max_2d = 1E+3; // GeV^2
   const double log10Q2min_2d = TMath::Log10(Q2min_2d);
   const double log10Q2max_2d = TMath::Log10(Q2max_2d);
-  const double dlog10Q2_2d = (log10Q2max_2d-log10Q2min_2d)/(nQ2_2d-1);
-  double Q2_bin_edges_2d [nQ2_2d];
-  for(unsigned int iq2 = 0; iq2 < nQ2_2d; iq2++) {
-     double Q2 = TMath::Power(10, log10Q2min_2d + iq2*dlog10Q2_2d);
-     Q2_bin_edges_2d[iq2] = Q2;
+  const double dlog10Q2_2d = (log10Q2max_2d-log10Q2min_2d)/(kNQ22D-1);
+  for(unsigned int iq2 = 0; iq2 < kNQ22D; iq2++) {
+     gQ2Edges2D.push_back(TMath::Power(10, log10Q2min_2d + iq2*dlog10Q2_2d));
   }
 
-  // x range and values for 2-D plots
-  const unsigned int nx_2d = 50;
+  // x bins for 2-D plots
   const double xmin_2d = 1E-4; 
   const double xmax_2d = 0.95; 
   const double log10xmin_2d = TMath::Log10(xmin_2d);
   const double log10xmax_2d = TMath::Log10(xmax_2d);
-  const double dlog10x_2d = (log10xmax_2d-log10xmin_2d)/(nx_2d-1);
-  double x_bin_edges_2d [nx_2d];
-  for(unsigned int ix = 0; ix < nx_2d; ix++) {
-     double x = TMath::Power(10, log10xmin_2d + ix*dlog10x_2d);
-     x_bin_edges_2d[ix] = x;
+  const double dlog10x_2d = (log10xmax_2d-log10xmin_2d)/(kNx2D-1);
+  for(unsigned int ix = 0; ix < kNx2D; ix++) {
+     gXEdges2D.push_back(TMath::Power(10, log10xmin_2d + ix*dlog10x_2d));
   }
 
+  // the PDFs are evaluated at the bin centres (as in TAxis::GetBinCenter)
+  for(unsigned int ix = 0; ix < kNx2D-1; ix++) {
+     gX2D.push_back(gXEdges2D[ix] + 0.5*(gXEdges2D[ix+1]-gXEdges2D[ix]));
+  }
+  for(unsigned int iq2 = 0; iq2 < kNQ22D-1; iq2++) {
+     gQ22D.push_back(
+       gQ2Edges2D[iq2] + 0.5*(gQ2Edges2D[iq2+1]-gQ2Edges2D[iq2]));
+  }
+}
+//_________________________________________________________________________________
+void CalculateGrids (void)
+{
+  unsigned int nsets = gPDFAlgList.size();
+  gPDFGrid.assign(nsets, vector<PDF_t>());
 
-  // Output ntuple
-  TNtuple * ntpl = new TNtuple("nt","pdfs","i:uv:dv:us:ds:s:g:x:Q2");
+  unsigned int nthreads = std::min((unsigned int) gOptNThreads, nsets);
+  if(nthreads <= 1) {
+    for(unsigned int im = 0; im < nsets; im++) {
+      CalculateGrid(gPDFAlgList[im], gPDFGrid[im], 0);
+    }
+    return;
+  }
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+#endif
+
+  // The threads evaluate private copies of the PDF sets, made here (the
+  // algorithm factory and the configuration pool are not protected against
+  // concurrent writes). The PDF sets of the LHAPDF5 Fortran library share
+  // its state and are evaluated one at a time.
+  std::mutex serial;
+  AlgFactory * algf = AlgFactory::Instance();
+  for (unsigned int ibatch = 0; ibatch < nsets; ibatch += nthreads) {
+    unsigned int iend = std::min(nsets, ibatch + nthreads);
+
+    vector<PDFModelI *> clones;
+    for (unsigned int im = ibatch; im < iend; ++im) {
+      PDFModelI * clone = dynamic_cast<PDFModelI *> (
+          algf->AdoptAlgorithm(gPDFAlgList[im]->Id()));
+      clone->AdoptSubstructure();
+      clones.push_back(clone);
+    }
+
+    vector<std::thread> threads;
+    for (unsigned int im = ibatch; im < iend; ++im) {
+      std::mutex * mtx = Reentrant(gPDFAlgList[im]) ? 0 : &serial;
+      threads.push_back(std::thread(CalculateGrid,
+          clones[im-ibatch], std::ref(gPDFGrid[im]), mtx));
+    }
+    for (unsigned int it = 0; it < threads.size(); ++it) threads[it].join();
+
+    for (unsigned int ic = 0; ic < clones.size(); ++ic) delete clones[ic];
+  }
+}
+//_________________________________________________________________________________
+void CalculateGrid (
+   const PDFModelI * pdf_alg, vector<PDF_t> & pdfs, std::mutex * mtx)
+{
+// Evaluate the PDF set at all the points of the 1-D & 2-D grids in a single
+// (batch) call; if a mutex is given, the call is made holding it
+
+  vector<double> x;
+  vector<double> Q2;
+  for(unsigned int ix = 0; ix < kNx1D; ix++) {
+    for(unsigned int iq2 = 0; iq2 < kNQ21D; iq2++) {
+      x .push_back(gX1D [ix] );
+      Q2.push_back(gQ21D[iq2]);
+    }
+  }
+  for(unsigned int ix = 0; ix < kNx2D-1; ix++) {
+    for(unsigned int iq2 = 0; iq2 < kNQ22D-1; iq2++) {
+      x .push_back(gX2D [ix] );
+      Q2.push_back(gQ22D[iq2]);
+    }
+  }
+
+  pdfs.resize(x.size());
+  if(mtx) {
+    std::lock_guard<std::mutex> lock(*mtx);
+    pdf_alg->AllPDFs(&x[0], &Q2[0], &pdfs[0], (int) x.size());
+  } else {
+    pdf_alg->AllPDFs(&x[0], &Q2[0], &pdfs[0], (int) x.size());
+  }
+}
+//_________________________________________________________________________________
+bool Reentrant (const Algorithm * alg)
+{
+// May private copies of the algorithm be evaluated concurrently? Not if it,
+// or any of its sub-algorithms, is an interface to the LHAPDF5 Fortran
+// library (common blocks)
+
+  if(alg->Id().Name() == "genie::LHAPDF5") return false;
+
+  const RgIMap & rgmap = alg->GetConfig().GetItemMap();
+  RgIMapConstIter iter = rgmap.begin();
+  for( ; iter != rgmap.end(); ++iter) {
+    if(iter->second->TypeInfo() != kRgAlg) continue;
+    const Algorithm * subalg = alg->SubAlg(iter->first);
+    if(subalg && !Reentrant(subalg)) return false;
+  }
+  return true;
+}
+//_________________________________________________________________________________
+void MakePlots (void)
+{
+  const unsigned int nm = 4; // number of models
+  int    col [nm] = { kBlack, kRed+1,  kBlue-3, kGreen+2 };
+  int    sty [nm] = { kSolid, kDashed, kDashed, kDashed  };
+  int    mrk [nm] = { 20,     20,      20,      20       };
+  double msz [nm] = { 0.7,    0.7,     0.7,     0.7      };
+  const char * opt   [nm] = { "ap", "l", "l", "l" };
+  const char * lgopt [nm] = { "P",  "L", "L", "L" };
+
+  // number of plotted PDF sets
+  unsigned int np = gPDFAlgList.size();
+  if(np > nm) {
+    LOG("gpdfcomp", pWARN) 
+      << "Only the first " << nm << " PDF sets are plotted";
+    np = nm;
+  }
+
+  // x,Q2 values for 1-D plots (see BuildGrids())
+  const unsigned int nQ2 = kNQ21D;
+  const unsigned int nx  = kNx1D;
+  const double * Q2_arr = &gQ21D[0];
+  const double * x_arr  = &gX1D [0];
+
+  // x,Q2 bins for 2-D plots
+  const unsigned int nQ2_2d = kNQ22D;
+  const unsigned int nx_2d  = kNx2D;
+  const double * Q2_bin_edges_2d = &gQ2Edges2D[0];
+  const double * x_bin_edges_2d  = &gXEdges2D [0];
 
   // Canvas for output plots
   TCanvas * cnv = new TCanvas("c","",20,20,500,650);
@@ -164,7 +353,7 @@ void MakePlots (void)
   hdr.AddText(" ");
   hdr.AddText("Models used:");
   hdr.AddText(" ");
-  for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
+  for(unsigned int im=0; im < np; im++) {
       const char * label = gPDFAlgList[im]->Id().Key().c_str();
       hdr.AddText(label);
   }
@@ -225,26 +414,15 @@ void MakePlots (void)
     double max_gr_xstr_Q2 = -9E9;
     double max_gr_xglu_Q2 = -9E9;
     
-    for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
-      PDF pdf;
-      pdf.SetModel(gPDFAlgList[im]);
+    for(unsigned int im=0; im < np; im++) {
       for(unsigned int iq2 = 0; iq2 < nQ2; iq2++) {
-        double Q2 = Q2_arr[iq2];
-        pdf.Calculate(x, Q2);
-      //LOG("gpdfcomp", pINFO) << "PDFs:\n" << pdf;
-        double xuv  = pdf.UpValence();
-        double xdv  = pdf.DownValence();
-        double xus  = pdf.UpSea();
-        double xds  = pdf.DownSea();
-        double xstr = pdf.Strange();
-        double xglu = pdf.Gluon();
-        xuv_arr  [im][iq2] = x * xuv;
-        xdv_arr  [im][iq2] = x * xdv;
-        xus_arr  [im][iq2] = x * xus;
-        xds_arr  [im][iq2] = x * xds;
-        xstr_arr [im][iq2] = x * xstr;
-        xglu_arr [im][iq2] = x * xglu;
-        ntpl->Fill(im,xuv,xdv,xus,xds,xstr,xglu,x,Q2);
+        const PDF_t & pdf = gPDFGrid[im][Index1D(ix,iq2)];
+        xuv_arr  [im][iq2] = x * pdf.uval;
+        xdv_arr  [im][iq2] = x * pdf.dval;
+        xus_arr  [im][iq2] = x * pdf.usea;
+        xds_arr  [im][iq2] = x * pdf.dsea;
+        xstr_arr [im][iq2] = x * pdf.str;
+        xglu_arr [im][iq2] = x * pdf.gl;
       }//iq2
 
       gr_xuv_Q2  [im] = new TGraph (nQ2, Q2_arr, xuv_arr  [im]);
@@ -291,7 +469,7 @@ void MakePlots (void)
     }//im
     
     // Now loop to set sensible limits
-    for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
+    for(unsigned int im=0; im < np; im++) {
       gr_xuv_Q2  [im] -> SetMinimum(0.);
       gr_xdv_Q2  [im] -> SetMinimum(0.);
       gr_xus_Q2  [im] -> SetMinimum(0.);
@@ -318,7 +496,7 @@ void MakePlots (void)
     lgnd -> SetBorderSize(0);
 
     lgnd->Clear();
-    for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
+    for(unsigned int im=0; im < np; im++) {
       std::string label(gPDFAlgList[im]->Id().Key());
       lgnd->AddEntry(gr_xuv_Q2 [im], label.c_str(), lgopt[im]);
     }
@@ -333,7 +511,7 @@ void MakePlots (void)
     cnv->cd(5); gPad->SetLogx();
     cnv->cd(6); gPad->SetLogx();
 
-    for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
+    for(unsigned int im=0; im < np; im++) {
       cnv->cd(1); gr_xuv_Q2 [im]->Draw(opt[im]);
       cnv->cd(2); gr_xdv_Q2 [im]->Draw(opt[im]);
       cnv->cd(3); gr_xus_Q2 [im]->Draw(opt[im]);
@@ -356,29 +534,25 @@ void MakePlots (void)
   // Plot PDFs = f(x,Q2)
   //
 
-  for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
+  for(unsigned int im=0; im < np; im++) {
     h2_xuv [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xdv [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xus [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xds [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xstr[im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xglu[im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
-    PDF pdf;
-    pdf.SetModel(gPDFAlgList[im]);
     for(int ibinx = 1; 
             ibinx <= h2_xuv[im]->GetXaxis()->GetNbins(); ibinx++) {
-      double x = h2_xuv[im]->GetXaxis()->GetBinCenter(ibinx);
+      double x = gX2D[ibinx-1];
       for(int ibinq2 = 1; 
               ibinq2 <= h2_xuv[im]->GetYaxis()->GetNbins(); ibinq2++) {
-         double Q2 = h2_xuv[im]->GetYaxis()->GetBinCenter(ibinq2);
-         pdf.Calculate(x, Q2);
-       //LOG("gpdfcomp", pINFO) << "PDFs:\n" << pdf;
-         double xuv  = x * pdf.UpValence();
-         double xdv  = x * pdf.DownValence();
-         double xus  = x * pdf.UpSea();
-         double xds  = x * pdf.DownSea();
-         double xstr = x * pdf.Strange();
-         double xglu = x * pdf.Gluon();
+         const PDF_t & pdf = gPDFGrid[im][Index2D(ibinx-1,ibinq2-1)];
+         double xuv  = x * pdf.uval;
+         double xdv  = x * pdf.dval;
+         double xus  = x * pdf.usea;
+         double xds  = x * pdf.dsea;
+         double xstr = x * pdf.str;
+         double xglu = x * pdf.gl;
          h2_xuv [im] -> SetBinContent(ibinx, ibinq2, xuv );
          h2_xdv [im] -> SetBinContent(ibinx, ibinq2, xdv ); 
          h2_xus [im] -> SetBinContent(ibinx, ibinq2, xus ); 
@@ -497,7 +671,7 @@ void MakePlots (void)
   // For multiple PDFs sets, plot the ratio of each PDF = f(x,Q2) to the first one
   // 
 
-  for(unsigned int im=1; im < gPDFAlgList.size(); im++) {
+  for(unsigned int im=1; im < np; im++) {
     h2_xuv_r [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xdv_r [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xus_r [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
@@ -645,6 +819,22 @@ void MakePlots (void)
   delete cnv;
   delete ps;
   delete lgnd;
+}
+//_________________________________________________________________________________
+void SaveNtuple (void)
+{
+  TNtuple * ntpl = new TNtuple("nt","pdfs","i:uv:dv:us:ds:s:g:x:Q2");
+
+  for(unsigned int ix=0; ix < kNx1D; ix++) {
+    double x = gX1D[ix];
+    for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
+      for(unsigned int iq2 = 0; iq2 < kNQ21D; iq2++) {
+        const PDF_t & pdf = gPDFGrid[im][Index1D(ix,iq2)];
+        ntpl->Fill(im,pdf.uval,pdf.dval,pdf.usea,pdf.dsea,pdf.str,pdf.gl,
+                   x,gQ21D[iq2]);
+      }
+    }
+  }
 
   string root_filename = gOptOutFile + ".root";
   TFile f(root_filename.c_str(),"recreate");
@@ -652,8 +842,54 @@ void MakePlots (void)
 
   f.Close();
   delete ntpl;
-  
-  std::cout<<"Done."<<std::endl;
+}
+//_________________________________________________________________________________
+void SaveGrids (void)
+{
+// Save the PDFs at the nodes of the 2-D grid (see --grid-output)
+
+  ofstream out(gOptGridFile.c_str(), std::ios::out | std::ios::binary);
+  if(!out.is_open()) {
+    LOG("gpdfcomp", pFATAL) << "Couldn't create file = " << gOptGridFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  const char * quantities[] = { "uv","dv","us","ds","s","c","b","t","g" };
+  int32_t header[5] = {
+    (int32_t) gPDFAlgList.size(), 1, 9,
+    (int32_t) gX2D.size(), (int32_t) gQ22D.size() };
+  out.write("GGRID001", 8);
+  out.write((const char *) header, sizeof(header));
+  for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
+    string name = gPDFAlgList[im]->Id().Key();
+    int32_t len = name.size();
+    out.write((const char *) &len, sizeof(len));
+    out.write(name.c_str(), len);
+  }
+  int32_t target = kPdgProton;
+  out.write((const char *) &target, sizeof(target));
+  for(unsigned int iq = 0; iq < 9; iq++) {
+    string name = quantities[iq];
+    int32_t len = name.size();
+    out.write((const char *) &len, sizeof(len));
+    out.write(name.c_str(), len);
+  }
+  out.write((const char *) &gX2D [0], gX2D .size()*sizeof(double));
+  out.write((const char *) &gQ22D[0], gQ22D.size()*sizeof(double));
+  for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
+    for(unsigned int ix=0; ix < gX2D.size(); ix++) {
+      for(unsigned int iq2=0; iq2 < gQ22D.size(); iq2++) {
+        const PDF_t & pdf = gPDFGrid[im][Index2D(ix,iq2)];
+        double values[9] = { pdf.uval, pdf.dval, pdf.usea, pdf.dsea,
+                             pdf.str, pdf.chm, pdf.bot, pdf.top, pdf.gl };
+        out.write((const char *) values, sizeof(values));
+      }
+    }
+  }
+  out.close();
+
+  LOG("gpdfcomp", pNOTICE) << "Saved the PDF grids in " << gOptGridFile;
 }
 //_________________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
@@ -674,6 +910,16 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptOutFile = parser.Arg('o');
   }
 
+  if(parser.OptionExists('j')){
+    gOptNThreads = std::max(1, parser.ArgAsInt('j'));
+  }
+
+  gOptNoPlots = parser.OptionExists("no-plots");
+
+  if(parser.OptionExists("grid-output")){
+    gOptGridFile = parser.Arg("grid-output");
+  }
+
 }
 //_________________________________________________________________________________
 void GetAlgorithms(void)
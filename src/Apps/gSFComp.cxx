@@ -5,18 +5,42 @@
 
 \brief   Structure function comparison tool
 
-\syntax  gsfcomp --structure-func sf_set [-o output]
+\syntax  gsfcomp --structure-func sf_set [-t targets] [-o output] [-j nthreads]
+                 [--no-plots] [--grid-output grid_file]
 
          --structure-func :
           Specifies a comma separated list of GENIE structure function models.
           The full algorithm name and configuration should be provided for
           each GENIE model as in `genie::model_name/model_config'.
-          (unique color and line styles are defined for up to 4 sets)
+          (unique color and line styles are defined for up to 4 sets: only
+          the first 4 are plotted, all are saved in the n-tuple & grid file)
+
+         -t :
+          Specifies a comma separated list of target PDG codes. The hit
+          nucleon is a proton (a neutron for the free neutron target) and
+          the probe a nu_mu (CC). The plots are made for the first target.
+          Default: 1000010010
 
          -o :
           Specifies a name to be used in the output files.
           Default: sf_comp
 
+         -j :
+          The number of threads evaluating the structure functions of the
+          models & targets in parallel, each on a private copy of the model
+          (owning its sub-algorithms). The models using the LHAPDF5 (Fortran)
+          library are evaluated one at a time. Default: 1
+
+         --no-plots :
+          Do not make the postscript file of plots (the n-tuple, and the
+          grid file if requested, are still written).
+
+         --grid-output :
+          Write F1-F6 at the nodes of the (x,Q2) grid of the 2-D plots, for
+          all the models and targets, in a flat binary file for comparisons
+          with external codes. The format is the one of gpdfcomp (see its
+          --grid-output), with the quantities F1,F2,F3,F4,F5,F6.
+
 \example gsfcomp --structure-func genie::Blah/Default,genie::Blah/Tweaked
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
@@ -32,6 +56,11 @@
 
 #include <vector>
 #include <string>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include <stdint.h>
 
 #include <TNtuple.h>
 #include <TFile.h>
@@ -45,13 +74,15 @@
 #include <TGraph.h>
 #include <TLatex.h>
 #include <TPaletteAxis.h>
+#include <TROOT.h>
+#include <RVersion.h>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Messenger/Messenger.h"
-#include "Physics/DeepInelastic/XSection/DISStructureFunc.h"
 #include "Physics/DeepInelastic/XSection/DISStructureFuncModelI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/Style.h"
@@ -61,14 +92,51 @@ using namespace genie;
 using namespace genie::utils;
 
 // globals
-string        gOptSF      = "";         // --structure-func argument
-string        gOptOutFile = "sf_comp";  // -o argument
+string        gOptSF       = "";         // --structure-func argument
+string        gOptOutFile  = "sf_comp";  // -o argument
+string        gOptGridFile = "";         // --grid-output argument
+int           gOptNThreads = 1;          // -j argument
+bool          gOptNoPlots  = false;      // --no-plots
+vector<int>   gOptTgtPdg;                // -t argument
 vector<const DISStructureFuncModelI *> gSFAlgList;
 
+// (x,Q2) grids: the 1-D plots are made at the nodes of a coarse grid, the
+// 2-D plots at the bin centres of a fine grid
+const unsigned int kNx1D  = 22;
+const unsigned int kNQ21D = 20;
+const unsigned int kNx2D  = 50; // bin edges
+const unsigned int kNQ22D = 50; // bin edges
+vector<double> gX1D;
+vector<double> gQ21D;
+vector<double> gXEdges2D;
+vector<double> gQ2Edges2D;
+vector<double> gX2D;
+vector<double> gQ22D;
+
+// F1-F6 of each model & target, at the 1-D grid points followed by the 2-D
+// grid points (x-major): gSFGrid[model][target][6*point+k] = F(k+1)
+vector< vector< vector<double> > > gSFGrid;
+
 // function prototypes
 void GetCommandLineArgs (int argc, char ** argv);
 void GetAlgorithms      (void);
+void BuildGrids         (void);
+void CalculateGrids     (void);
+void CalculateGrid      (const DISStructureFuncModelI * sf_alg, int tgt,
+                         vector<double> & sf, std::mutex * mtx);
+bool Reentrant          (const Algorithm * alg);
 void MakePlots          (void);
+void SaveNtuple         (void);
+void SaveGrids          (void);
+
+inline unsigned int Index1D (unsigned int ix, unsigned int iq2)
+{
+  return ix*kNQ21D + iq2;
+}
+inline unsigned int Index2D (unsigned int ix, unsigned int iq2)
+{
+  return kNx1D*kNQ21D + ix*(kNQ22D-1) + iq2;
+}
 
 //___________________________________________________________________
 int main(int argc, char ** argv)
@@ -77,72 +145,207 @@ int main(int argc, char ** argv)
 
   GetCommandLineArgs (argc,argv);   // Get command line arguments
   GetAlgorithms();                  // Get requested SF algorithms
-  MakePlots();   // Produce all output plots and fill output n-tuple
+  BuildGrids();                     // Set the (x,Q2) grids
+  CalculateGrids();                 // Evaluate all models on the grids
+
+  if(!gOptNoPlots)            MakePlots();  // Produce all output plots
+  SaveNtuple();                             // Fill & save the output n-tuple
+  if(gOptGridFile.size() > 0) SaveGrids();  // Save the grids in a flat file
 
   return 0;
 }
 //_________________________________________________________________________________
-void MakePlots (void)
+void BuildGrids (void)
 {
-  const unsigned int nm = 4; // number of models
-  int    col [nm] = { kBlack, kRed+1,  kBlue-3, kGreen+2 };
-  int    sty [nm] = { kSolid, kDashed, kDashed, kDashed  };
-  int    mrk [nm] = { 20,     20,      20,      20       };
-  double msz [nm] = { 0.7,    0.7,     0.7,     0.7      };
-  const char * opt   [nm] = { "ap", "l", "l", "l" };
-  const char * lgopt [nm] = { "P",  "L", "L", "L" };
-
-  // Q2 range and values for 1-D plots
-  const unsigned int nQ2 = 20;
+  // Q2 values for 1-D plots
   const double Q2min = 1E-1; // GeV^2
   const double Q2max = 1E+3; // GeV^2
   const double log10Q2min = TMath::Log10(Q2min);
   const double log10Q2max = TMath::Log10(Q2max);
-  const double dlog10Q2 = (log10Q2max-log10Q2min)/(nQ2-1);
-  double Q2_arr [nQ2];
-  for(unsigned int iq2 = 0; iq2 < nQ2; iq2++) {
-     double Q2 = TMath::Power(10, log10Q2min + iq2*dlog10Q2);
-     Q2_arr[iq2] = Q2;
+  const double dlog10Q2 = (log10Q2max-log10Q2min)/(kNQ21D-1);
+  for(unsigned int iq2 = 0; iq2 < kNQ21D; iq2++) {
+     gQ21D.push_back(TMath::Power(10, log10Q2min + iq2*dlog10Q2));
   }
 
   // x values for 1-D plots
-  const unsigned int nx = 22;
-  double x_arr [nx] = {
+  double x_arr [kNx1D] = {
     0.0001, 0.0010, 0.0100, 0.0250, 0.0500, 
     0.0750, 0.1000, 0.1500, 0.2000, 0.2500, 
     0.3500, 0.4000, 0.4500, 0.5000, 0.5500, 
     0.6000, 0.7000, 0.7500, 0.8000, 0.8500, 
     0.9000, 0.9500
   };
+  gX1D.assign(x_arr, x_arr + kNx1D);
 
-  // Q2 range and values for 2-D plots
-  const unsigned int nQ2_2d = 50;
+  // Q2 bins for 2-D plots
   const double Q2min_2d = 1E-1; // GeV^2
   const double Q2max_2d = 1E+3; // GeV^2
   const double log10Q2min_2d = TMath::Log10(Q2min_2d);
   const double log10Q2max_2d = TMath::Log10(Q2max_2d);
-  const double dlog10Q2_2d = (log10Q2max_2d-log10Q2min_2d)/(nQ2_2d-1);
-  double Q2_bin_edges_2d [nQ2_2d];
-  for(unsigned int iq2 = 0; iq2 < nQ2_2d; iq2++) {
-     double Q2 = TMath::Power(10, log10Q2min_2d + iq2*dlog10Q2_2d);
-     Q2_bin_edges_2d[iq2] = Q2;
+  const double dlog10Q2_2d = (log10Q2max_2d-log10Q2min_2d)/(kNQ22D-1);
+  for(unsigned int iq2 = 0; iq2 < kNQ22D; iq2++) {
+     gQ2Edges2D.push_back(TMath::Power(10, log10Q2min_2d + iq2*dlog10Q2_2d));
   }
 
-  // x range and values for 2-D plots
-  const unsigned int nx_2d = 50;
+  // x bins for 2-D plots
   const double xmin_2d = 1E-4; 
   const double xmax_2d = 0.95; 
   const double log10xmin_2d = TMath::Log10(xmin_2d);
   const double log10xmax_2d = TMath::Log10(xmax_2d);
-  const double dlog10x_2d = (log10xmax_2d-log10xmin_2d)/(nx_2d-1);
-  double x_bin_edges_2d [nx_2d];
-  for(unsigned int ix = 0; ix < nx_2d; ix++) {
-     double x = TMath::Power(10, log10xmin_2d + ix*dlog10x_2d);
-     x_bin_edges_2d[ix] = x;
+  const double dlog10x_2d = (log10xmax_2d-log10xmin_2d)/(kNx2D-1);
+  for(unsigned int ix = 0; ix < kNx2D; ix++) {
+     gXEdges2D.push_back(TMath::Power(10, log10xmin_2d + ix*dlog10x_2d));
+  }
+
+  // the SFs are evaluated at the bin centres (as in TAxis::GetBinCenter)
+  for(unsigned int ix = 0; ix < kNx2D-1; ix++) {
+     gX2D.push_back(gXEdges2D[ix] + 0.5*(gXEdges2D[ix+1]-gXEdges2D[ix]));
+  }
+  for(unsigned int iq2 = 0; iq2 < kNQ22D-1; iq2++) {
+     gQ22D.push_back(
+       gQ2Edges2D[iq2] + 0.5*(gQ2Edges2D[iq2+1]-gQ2Edges2D[iq2]));
+  }
+}
+//_________________________________________________________________________________
+void CalculateGrids (void)
+{
+  unsigned int nmodels  = gSFAlgList.size();
+  unsigned int ntargets = gOptTgtPdg.size();
+  unsigned int ntasks   = nmodels * ntargets; // task = im*ntargets + it
+  gSFGrid.assign(nmodels, vector< vector<double> >(ntargets));
+
+  unsigned int nthreads = std::min((unsigned int) gOptNThreads, ntasks);
+  if(nthreads <= 1) {
+    for(unsigned int im = 0; im < nmodels; im++) {
+      for(unsigned int it = 0; it < ntargets; it++) {
+        CalculateGrid(gSFAlgList[im], gOptTgtPdg[it], gSFGrid[im][it], 0);
+      }
+    }
+    return;
+  }
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+#endif
+
+  // The threads evaluate private copies of the models, made here (the
+  // algorithm factory and the configuration pool are not protected against
+  // concurrent writes). The models using the LHAPDF5 Fortran library share
+  // its state and are evaluated one at a time.
+  std::mutex serial;
+  AlgFactory * algf = AlgFactory::Instance();
+  for (unsigned int ibatch = 0; ibatch < ntasks; ibatch += nthreads) {
+    unsigned int iend = std::min(ntasks, ibatch + nthreads);
+
+    vector<DISStructureFuncModelI *> clones;
+    for (unsigned int itask = ibatch; itask < iend; ++itask) {
+      unsigned int im = itask / ntargets;
+      DISStructureFuncModelI * clone = dynamic_cast<DISStructureFuncModelI *> (
+          algf->AdoptAlgorithm(gSFAlgList[im]->Id()));
+      clone->AdoptSubstructure();
+      clones.push_back(clone);
+    }
+
+    vector<std::thread> threads;
+    for (unsigned int itask = ibatch; itask < iend; ++itask) {
+      unsigned int im = itask / ntargets;
+      unsigned int it = itask % ntargets;
+      std::mutex * mtx = Reentrant(gSFAlgList[im]) ? 0 : &serial;
+      threads.push_back(std::thread(CalculateGrid,
+          clones[itask-ibatch], gOptTgtPdg[it], std::ref(gSFGrid[im][it]), mtx));
+    }
+    for (unsigned int it = 0; it < threads.size(); ++it) threads[it].join();
+
+    for (unsigned int ic = 0; ic < clones.size(); ++ic) delete clones[ic];
+  }
+}
+//_________________________________________________________________________________
+void CalculateGrid (const DISStructureFuncModelI * sf_alg, int tgt,
+                    vector<double> & sf, std::mutex * mtx)
+{
+// Evaluate the model at all the points of the 1-D & 2-D grids in a single
+// (batch) call, for nu_mu CC on the input target; if a mutex is given, the
+// call is made holding it
+
+  vector<double> x;
+  vector<double> Q2;
+  for(unsigned int ix = 0; ix < kNx1D; ix++) {
+    for(unsigned int iq2 = 0; iq2 < kNQ21D; iq2++) {
+      x .push_back(gX1D [ix] );
+      Q2.push_back(gQ21D[iq2]);
+    }
+  }
+  for(unsigned int ix = 0; ix < kNx2D-1; ix++) {
+    for(unsigned int iq2 = 0; iq2 < kNQ22D-1; iq2++) {
+      x .push_back(gX2D [ix] );
+      Q2.push_back(gQ22D[iq2]);
+    }
+  }
+
+  int hitnuc = (pdg::IonPdgCodeToZ(tgt) > 0) ? kPdgProton : kPdgNeutron;
+  Interaction * interaction = Interaction::DISCC(tgt,hitnuc,kPdgNuMu);
+
+  sf.resize(6*x.size());
+  if(mtx) {
+    std::lock_guard<std::mutex> lock(*mtx);
+    sf_alg->Calculate(interaction, &x[0], &Q2[0], (int) x.size(), &sf[0]);
+  } else {
+    sf_alg->Calculate(interaction, &x[0], &Q2[0], (int) x.size(), &sf[0]);
+  }
+
+  delete interaction;
+}
+//_________________________________________________________________________________
+bool Reentrant (const Algorithm * alg)
+{
+// May private copies of the algorithm be evaluated concurrently? Not if it,
+// or any of its sub-algorithms, is an interface to the LHAPDF5 Fortran
+// library (common blocks)
+
+  if(alg->Id().Name() == "genie::LHAPDF5") return false;
+
+  const RgIMap & rgmap = alg->GetConfig().GetItemMap();
+  RgIMapConstIter iter = rgmap.begin();
+  for( ; iter != rgmap.end(); ++iter) {
+    if(iter->second->TypeInfo() != kRgAlg) continue;
+    const Algorithm * subalg = alg->SubAlg(iter->first);
+    if(subalg && !Reentrant(subalg)) return false;
   }
+  return true;
+}
+//_________________________________________________________________________________
+void MakePlots (void)
+{
+  const unsigned int nm = 4; // number of models
+  int    col [nm] = { kBlack, kRed+1,  kBlue-3, kGreen+2 };
+  int    sty [nm] = { kSolid, kDashed, kDashed, kDashed  };
+  int    mrk [nm] = { 20,     20,      20,      20       };
+  double msz [nm] = { 0.7,    0.7,     0.7,     0.7      };
+  const char * opt   [nm] = { "ap", "l", "l", "l" };
+  const char * lgopt [nm] = { "P",  "L", "L", "L" };
 
-  // Output ntuple
-  TNtuple * ntpl = new TNtuple("nt","structure functions","i:F1:F2:F3:F4:F5:F6:x:Q2");
+  // number of plotted models
+  unsigned int np = gSFAlgList.size();
+  if(np > nm) {
+    LOG("gsfcomp", pWARN) 
+      << "Only the first " << nm << " structure function models are plotted";
+    np = nm;
+  }
+
+  // the plots are made for the first target
+  const unsigned int it = 0;
+
+  // x,Q2 values for 1-D plots (see BuildGrids())
+  const unsigned int nQ2 = kNQ21D;
+  const unsigned int nx  = kNx1D;
+  const double * Q2_arr = &gQ21D[0];
+  const double * x_arr  = &gX1D [0];
+
+  // x,Q2 bins for 2-D plots
+  const unsigned int nQ2_2d = kNQ22D;
+  const unsigned int nx_2d  = kNx2D;
+  const double * Q2_bin_edges_2d = &gQ2Edges2D[0];
+  const double * x_bin_edges_2d  = &gXEdges2D [0];
 
   // Canvas for output plots
   TCanvas * cnv = new TCanvas("c","",20,20,500,650);
@@ -164,7 +367,7 @@ void MakePlots (void)
   hdr.AddText(" ");
   hdr.AddText("Models used:");
   hdr.AddText(" ");
-  for(unsigned int im=0; im < gSFAlgList.size(); im++) {
+  for(unsigned int im=0; im < np; im++) {
       const char * label = gSFAlgList[im]->Id().Key().c_str();
       hdr.AddText(label);
   }
@@ -217,30 +420,15 @@ void MakePlots (void)
     double F4_arr [nm][nQ2];
     double F5_arr [nm][nQ2];
     double F6_arr [nm][nQ2];
-    for(unsigned int im=0; im < gSFAlgList.size(); im++) {
-      DISStructureFunc sf;
-      sf.SetModel(gSFAlgList[im]);
+    for(unsigned int im=0; im < np; im++) {
       for(unsigned int iq2 = 0; iq2 < nQ2; iq2++) {
-        double Q2 = Q2_arr[iq2];
-        Interaction * interaction = Interaction::DISCC(kPdgTgtFreeP,kPdgProton,kPdgNuMu);
-      //LOG("gsfcomp", pNOTICE) << "Setting x = " << x << ", Q2 = " << Q2;
-        interaction->KinePtr()->Setx(x);
-        interaction->KinePtr()->SetQ2(Q2);
-        sf.Calculate(interaction);
-        double F1 = sf.F1();
-        double F2 = sf.F2();
-        double F3 = sf.F3();
-        double F4 = sf.F4();
-        double F5 = sf.F5();
-        double F6 = sf.F6();
-        F1_arr [im][iq2] = F1;
-        F2_arr [im][iq2] = F2;
-        F3_arr [im][iq2] = F3;
-        F4_arr [im][iq2] = F4;
-        F5_arr [im][iq2] = F5;
-        F6_arr [im][iq2] = F6;
-        ntpl->Fill(im,F1,F2,F3,F4,F5,F6,x,Q2);
-        delete interaction;
+        const double * sf = &gSFGrid[im][it][6*Index1D(ix,iq2)];
+        F1_arr [im][iq2] = sf[0];
+        F2_arr [im][iq2] = sf[1];
+        F3_arr [im][iq2] = sf[2];
+        F4_arr [im][iq2] = sf[3];
+        F5_arr [im][iq2] = sf[4];
+        F6_arr [im][iq2] = sf[5];
       }//iq2
 
       gr_F1_Q2 [im] = new TGraph (nQ2, Q2_arr, F1_arr [im]);
@@ -285,7 +473,7 @@ void MakePlots (void)
     lgnd -> SetBorderSize(0);
 
     lgnd->Clear();
-    for(unsigned int im=0; im < gSFAlgList.size(); im++) {
+    for(unsigned int im=0; im < np; im++) {
       const char * label = gSFAlgList[im]->Id().Key().c_str();
       lgnd->AddEntry(gr_F1_Q2 [im], Form("%s",label), lgopt[im]);
     }
@@ -299,7 +487,7 @@ void MakePlots (void)
     cnv->cd(5); gPad->SetLogx();
     cnv->cd(6); gPad->SetLogx();
 
-    for(unsigned int im=0; im < gSFAlgList.size(); im++) {
+    for(unsigned int im=0; im < np; im++) {
       cnv->cd(1); gr_F1_Q2 [im]->Draw(opt[im]);
       cnv->cd(2); gr_F2_Q2 [im]->Draw(opt[im]);
       cnv->cd(3); gr_F3_Q2 [im]->Draw(opt[im]);
@@ -322,39 +510,30 @@ void MakePlots (void)
   // Plot structure functions = f(x,Q2)
   //
 
-  for(unsigned int im=0; im < gSFAlgList.size(); im++) {
+  for(unsigned int im=0; im < np; im++) {
     h2_F1 [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_F2 [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_F3 [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_F4 [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_F5 [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_F6 [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
-    DISStructureFunc sf;
-    sf.SetModel(gSFAlgList[im]);
     for(int ibinx = 1; 
             ibinx <= h2_F1[im]->GetXaxis()->GetNbins(); ibinx++) {
-      double x = h2_F1[im]->GetXaxis()->GetBinCenter(ibinx);
       for(int ibinq2 = 1; 
               ibinq2 <= h2_F1[im]->GetYaxis()->GetNbins(); ibinq2++) {
-         double Q2 = h2_F1[im]->GetYaxis()->GetBinCenter(ibinq2);
-         Interaction * interaction = Interaction::DISCC(kPdgTgtFreeP,kPdgProton,kPdgNuMu);
-       //LOG("gsfcomp", pNOTICE) << "Setting x (bin " << ibinx << ") = " << x << ", Q2 (bin " << ibinq2 << ") = " << Q2;
-         interaction->KinePtr()->Setx(x);
-         interaction->KinePtr()->SetQ2(Q2);
-         sf.Calculate(interaction);
-         double F1 = sf.F1();
-         double F2 = sf.F2();
-         double F3 = sf.F3();
-         double F4 = sf.F4();
-         double F5 = sf.F5();
-         double F6 = sf.F6();
+         const double * sf = &gSFGrid[im][it][6*Index2D(ibinx-1,ibinq2-1)];
+         double F1 = sf[0];
+         double F2 = sf[1];
+         double F3 = sf[2];
+         double F4 = sf[3];
+         double F5 = sf[4];
+         double F6 = sf[5];
          h2_F1 [im] -> SetBinContent(ibinx, ibinq2, F1);
          h2_F2 [im] -> SetBinContent(ibinx, ibinq2, F2); 
          h2_F3 [im] -> SetBinContent(ibinx, ibinq2, F3); 
          h2_F4 [im] -> SetBinContent(ibinx, ibinq2, F4); 
          h2_F5 [im] -> SetBinContent(ibinx, ibinq2, F5); 
          h2_F6 [im] -> SetBinContent(ibinx, ibinq2, F6); 
-         delete interaction;
       }
     }
 
@@ -459,7 +638,7 @@ void MakePlots (void)
   // plot the ratio of each structure function = f(x,Q2) to the first one
   // 
 
-  for(unsigned int im=1; im < gSFAlgList.size(); im++) {
+  for(unsigned int im=1; im < np; im++) {
     h2_F1_r [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_F2_r [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_F3_r [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
@@ -607,6 +786,28 @@ void MakePlots (void)
   delete cnv;
   delete ps;
   delete lgnd;
+}
+//_________________________________________________________________________________
+void SaveNtuple (void)
+{
+  // the last column is the index of the target (see -t)
+  TNtuple * ntpl = new TNtuple("nt","structure functions","i:F1:F2:F3:F4:F5:F6:x:Q2:t");
+
+  for(unsigned int ix=0; ix < kNx1D; ix++) {
+    double x = gX1D[ix];
+    for(unsigned int it=0; it < gOptTgtPdg.size(); it++) {
+      for(unsigned int im=0; im < gSFAlgList.size(); im++) {
+        for(unsigned int iq2 = 0; iq2 < kNQ21D; iq2++) {
+          const double * sf = &gSFGrid[im][it][6*Index1D(ix,iq2)];
+          float row[10] = { (float) im,
+            (float) sf[0], (float) sf[1], (float) sf[2],
+            (float) sf[3], (float) sf[4], (float) sf[5],
+            (float) x, (float) gQ21D[iq2], (float) it };
+          ntpl->Fill(row);
+        }
+      }
+    }
+  }
 
   string root_filename = gOptOutFile + ".root";
   TFile f(root_filename.c_str(),"recreate");
@@ -615,6 +816,56 @@ void MakePlots (void)
   delete ntpl;
 }
 //_________________________________________________________________________________
+void SaveGrids (void)
+{
+// Save F1-F6 at the nodes of the 2-D grid (see --grid-output)
+
+  ofstream out(gOptGridFile.c_str(), std::ios::out | std::ios::binary);
+  if(!out.is_open()) {
+    LOG("gsfcomp", pFATAL) << "Couldn't create file = " << gOptGridFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  const char * quantities[] = { "F1","F2","F3","F4","F5","F6" };
+  int32_t header[5] = {
+    (int32_t) gSFAlgList.size(), (int32_t) gOptTgtPdg.size(), 6,
+    (int32_t) gX2D.size(), (int32_t) gQ22D.size() };
+  out.write("GGRID001", 8);
+  out.write((const char *) header, sizeof(header));
+  for(unsigned int im=0; im < gSFAlgList.size(); im++) {
+    string name = gSFAlgList[im]->Id().Key();
+    int32_t len = name.size();
+    out.write((const char *) &len, sizeof(len));
+    out.write(name.c_str(), len);
+  }
+  for(unsigned int it=0; it < gOptTgtPdg.size(); it++) {
+    int32_t target = gOptTgtPdg[it];
+    out.write((const char *) &target, sizeof(target));
+  }
+  for(unsigned int iq = 0; iq < 6; iq++) {
+    string name = quantities[iq];
+    int32_t len = name.size();
+    out.write((const char *) &len, sizeof(len));
+    out.write(name.c_str(), len);
+  }
+  out.write((const char *) &gX2D [0], gX2D .size()*sizeof(double));
+  out.write((const char *) &gQ22D[0], gQ22D.size()*sizeof(double));
+  for(unsigned int im=0; im < gSFAlgList.size(); im++) {
+    for(unsigned int it=0; it < gOptTgtPdg.size(); it++) {
+      for(unsigned int ix=0; ix < gX2D.size(); ix++) {
+        for(unsigned int iq2=0; iq2 < gQ22D.size(); iq2++) {
+          const double * sf = &gSFGrid[im][it][6*Index2D(ix,iq2)];
+          out.write((const char *) sf, 6*sizeof(double));
+        }
+      }
+    }
+  }
+  out.close();
+
+  LOG("gsfcomp", pNOTICE) << "Saved the structure function grids in " << gOptGridFile;
+}
+//_________________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
 {
   CmdLnArgParser parser(argc,argv);
@@ -630,10 +881,25 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(1);
   }
 
+  if(parser.OptionExists('t')){
+    gOptTgtPdg = parser.ArgAsIntTokens('t',",");
+  }
+  if(gOptTgtPdg.size() == 0) gOptTgtPdg.push_back(kPdgTgtFreeP);
+
   if(parser.OptionExists('o')){
     gOptOutFile = parser.Arg('o');
   }
 
+  if(parser.OptionExists('j')){
+    gOptNThreads = std::max(1, parser.ArgAsInt('j'));
+  }
+
+  gOptNoPlots = parser.OptionExists("no-plots");
+
+  if(parser.OptionExists("grid-output")){
+    gOptGridFile = parser.Arg("grid-output");
+  }
+
 }
 //_________________________________________________________________________________
 void GetAlgorithms(void)
@@ -0,0 +1,169 @@
+//____________________________________________________________________________
+/*!
+
+\program gsimple2bin
+
+\brief   GENIE utility program converting GSimpleNtpFlux ROOT flux files
+         into a single flat binary flux file (see GSimpleNtpBinFile).
+
+         GSimpleNtpFlux reads the flat binary file through a memory map,
+         so that reading any flux entry costs a copy of a fixed size record
+         instead of the decoding of the flux tree branches. This pays off for
+         jobs cycling through the flux entries many times. The binary file is
+         used in place of the ROOT files, as the flux file of the job.
+
+         The "entry" branch and, unless --no-numi is given, the "numi"
+         branch of the "flux" trees are converted, together with the meta
+         data of the "meta" trees. The variable size "aux" branch is not
+         supported by the binary format and is dropped.
+         The binary file uses the byte order of the machine writing it.
+
+         Syntax :
+           gsimple2bin -f input_files -o output_file [--no-numi]
+                       [--message-thresholds xml_file]
+
+         Options :
+           -f
+              The input GSimpleNtpFlux ROOT file(s); wildcards are allowed,
+              as in TChain::Add(), and several inputs are comma separated.
+           -o
+              The output flat binary flux file.
+           --no-numi
+              Do not convert the "numi" branch.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Example:
+
+           gsimple2bin -f "gsimple_*.root" -o gsimple.bin
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <TChain.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Tools/Flux/GSimpleNtpBinFile.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+using namespace genie::flux;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+// User-specified options:
+string gOptInpFiles = "";     // input ROOT flux file(s)
+string gOptOutFile  = "";     // output binary flux file
+bool   gOptNuMI     = true;   // convert the "numi" branch?
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  TChain flux("flux");
+  TChain meta("meta");
+  vector<string> inputs = utils::str::Split(gOptInpFiles, ",");
+  for (unsigned int i = 0; i < inputs.size(); i++) {
+    string input = utils::str::TrimSpaces(inputs[i]);
+    if ( input.empty() ) continue;
+    LOG("gsimple2bin", pNOTICE) << "Adding flux file(s) " << input;
+    flux.Add(input.c_str());
+    meta.Add(input.c_str());
+  }
+  if ( flux.GetEntries() <= 0 ) {
+    LOG("gsimple2bin", pFATAL) << "No flux entries in " << gOptInpFiles;
+    exit(1);
+  }
+  if ( flux.GetBranch("aux") ) {
+    LOG("gsimple2bin", pWARN)
+      << "The \"aux\" branch is not supported by the binary format - Dropped";
+  }
+
+  bool ok = GSimpleNtpBinFile::Write(gOptOutFile, &flux, &meta, gOptNuMI);
+  if ( ! ok ) {
+    LOG("gsimple2bin", pFATAL) << "Failed to write " << gOptOutFile;
+    exit(1);
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gsimple2bin", pINFO) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // input flux file(s)
+  if( parser.OptionExists('f') ) {
+    gOptInpFiles = parser.ArgAsString('f');
+  } else {
+    LOG("gsimple2bin", pFATAL)
+       << "No input flux file was specified - Exiting";
+    PrintSyntax();
+    exit(1);
+  } //-f
+
+  // output binary file
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gsimple2bin", pFATAL)
+       << "No output file was specified - Exiting";
+    PrintSyntax();
+    exit(1);
+  } //-o
+
+  gOptNuMI = ! parser.OptionExists("no-numi");
+
+  LOG("gsimple2bin", pNOTICE)
+     << "\n"
+     << utils::print::PrintFramedMesg("gsimple2bin job inputs");
+  LOG("gsimple2bin", pNOTICE) << "Input flux file(s) : " << gOptInpFiles;
+  LOG("gsimple2bin", pNOTICE) << "Output binary file : " << gOptOutFile;
+  LOG("gsimple2bin", pNOTICE) << "Convert numi branch: " << gOptNuMI;
+  LOG("gsimple2bin", pNOTICE) << "\n";
+  LOG("gsimple2bin", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gsimple2bin", pNOTICE)
+      << "\n\n" << "Syntax:" << "\n"
+      << "   gsimple2bin"
+      << " -f input_files"
+      << " -o output_file"
+      << " [--no-numi]"
+      << " [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
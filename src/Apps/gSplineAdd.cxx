@@ -7,6 +7,7 @@
 
          Syntax :
            gspladd -f file_list -d directory_list -o output.xml
+                   [--stream] [--binary] [--jobs njobs]
                    [--message-thresholds xml_file]
 
          Options :
@@ -18,6 +19,18 @@
               files. If more than one then separate using commas.
            -o 
               output xml file
+           --stream
+              Streaming merge: The spline records of each input file are
+              copied to the output as they are read, and duplicate splines
+              are dropped, without loading all splines in memory.
+              The output keeps the input order of the splines.
+              Input files can be XML or binary spline files.
+           --binary
+              Write the output in the binary spline file format (see gspl2bin).
+           --jobs
+              Number of worker processes parsing the input files in parallel
+              (implies --stream). Each worker converts its share of the inputs
+              to temporary binary files, which are then merged in input order.
            --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -51,11 +64,17 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
 #include <TSystem.h>
+#include <TMath.h>
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Conventions/XmlParserStatus.h"
@@ -63,6 +82,7 @@
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/XSecSplineMerger.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/CmdLnArgParser.h"
@@ -76,12 +96,17 @@ using namespace genie;
 vector<string> GetAllInputFiles   (void);
 void           GetCommandLineArgs (int argc, char ** argv);
 void           PrintSyntax        (void);
+void           StreamMerge        (void);
+vector<string> ParseInParallel    (void);
 
 //User-specified options:
 string         gOutFile;   ///< output XML file
 vector<string> gInpFiles;  ///< list of input XML files
 vector<string> gInpDirs;   ///< list of input dirs (to look for XML files)
 vector<string> gAllFiles;  ///< list of all input files
+bool           gOptStream = false; ///< streaming merge?
+bool           gOptBinary = false; ///< binary output?
+int            gOptNJobs  = 1;     ///< number of worker processes parsing the inputs
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -89,7 +114,12 @@ int main(int argc, char ** argv)
   GetCommandLineArgs(argc,argv);
 
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-  
+
+  if(gOptStream) {
+    StreamMerge();
+    return 0;
+  }
+
   XSecSplineList * xspl = XSecSplineList::Instance();
 
   vector<string>::const_iterator file_iter = gAllFiles.begin();
@@ -104,11 +134,96 @@ int main(int argc, char ** argv)
 
   LOG("gspladd", pNOTICE) 
      << " ****** Saving all loaded splines into : " << gOutFile;
-  xspl->SaveAsXml(gOutFile);
+  if(gOptBinary) xspl->SaveAsBinary(gOutFile);
+  else            xspl->SaveAsXml(gOutFile);
 
   return 0;
 }
 //____________________________________________________________________________
+void StreamMerge(void)
+{
+  // with several jobs, the inputs are first converted to binary files
+  vector<string> inputs = (gOptNJobs > 1) ? ParseInParallel() : gAllFiles;
+
+  XSecSplineMerger merger;
+  if(!merger.Open(gOutFile, gOptBinary)) {
+    LOG("gspladd", pFATAL) << "Couldn't open output file: " << gOutFile;
+    exit(1);
+  }
+
+  bool ok = true;
+  for(unsigned int i = 0; i < inputs.size(); i++) {
+    if(ok) {
+      LOG("gspladd", pNOTICE) << " ---- >> Merging file : " << gAllFiles[i];
+      ok = (merger.Add(inputs[i]) == kXmlOK);
+    }
+    if(gOptNJobs > 1) unlink(inputs[i].c_str());
+  }
+  ok = merger.Close() && ok;
+  if(!ok) {
+    LOG("gspladd", pFATAL) << "Merging the spline files failed";
+    exit(1);
+  }
+
+  LOG("gspladd", pNOTICE)
+     << " ****** Saved " << merger.NSplines() << " splines into : " << gOutFile
+     << " (" << merger.NDuplicates() << " duplicates dropped)";
+}
+//____________________________________________________________________________
+vector<string> ParseInParallel(void)
+{
+// Fork gOptNJobs workers. Worker iw converts the input files iw, iw+njobs,
+// iw+2*njobs, ... to temporary binary spline files, merged later by the
+// parent (in input order, so that the output does not depend on njobs).
+
+  unsigned int nfiles = gAllFiles.size();
+  int          njobs  = TMath::Min(gOptNJobs, (int) nfiles);
+
+  vector<string> parts(nfiles);
+  for(unsigned int i = 0; i < nfiles; i++) {
+    ostringstream name;
+    name << gOutFile << ".part" << i << ".tmp";
+    parts[i] = name.str();
+  }
+
+  LOG("gspladd", pNOTICE)
+     << "Parsing " << nfiles << " input files with " << njobs << " workers";
+
+  vector<pid_t> pids;
+  for(int iw = 0; iw < njobs; iw++) {
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("gspladd", pFATAL) << "Couldn't fork worker process";
+      exit(1);
+    }
+    if(pid == 0) {
+      int status = 0;
+      for(unsigned int i = iw; i < nfiles && status == 0; i += njobs) {
+        XSecSplineMerger part;
+        bool ok = part.Open(parts[i], true) &&
+                  part.Add(gAllFiles[i]) == kXmlOK;
+        ok = part.Close() && ok;
+        if(!ok) status = 1;
+      }
+      _exit(status);
+    }
+    pids.push_back(pid);
+  }
+
+  bool ok = true;
+  for(unsigned int iw = 0; iw < pids.size(); iw++) {
+    int status = 0;
+    waitpid(pids[iw], &status, 0);
+    ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  }
+  if(!ok) {
+    LOG("gspladd", pFATAL) << "Parsing the input files failed";
+    for(unsigned int i = 0; i < nfiles; i++) unlink(parts[i].c_str());
+    exit(1);
+  }
+  return parts;
+}
+//____________________________________________________________________________
 vector<string> GetAllInputFiles(void)
 {
   vector<string> files;
@@ -184,6 +299,22 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(1);
   }
 
+  if( parser.OptionExists("stream") ) {
+    gOptStream = true;
+  }
+  if( parser.OptionExists("binary") ) {
+    LOG("gspladd", pINFO) << "Output will be a binary spline file";
+    gOptBinary = true;
+  }
+  if( parser.OptionExists("jobs") ) {
+    gOptNJobs  = TMath::Max(1, parser.ArgAsInt("jobs"));
+    gOptStream = true;
+  }
+  if(gOptStream) {
+    LOG("gspladd", pINFO)
+      << "Streaming merge, parsing inputs with " << gOptNJobs << " processes";
+  }
+
   gAllFiles = GetAllInputFiles();
   if(gAllFiles.size() <= 1) {
     LOG("gspladd", pFATAL) << "There must be at least 2 input files";
@@ -197,6 +328,7 @@ void PrintSyntax(void)
   LOG("gspladd", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
     << "   gspladd  -f file_list -d directory_list  -o output.xml\n"
+    << "            [--stream] [--binary] [--jobs njobs]\n"
     << "            [--message-thresholds xml_file]\n";
 
 }
@@ -0,0 +1,145 @@
+//____________________________________________________________________________
+/*!
+
+\program gspl2bin
+
+\brief   Utility converting a GENIE XML cross section spline file into the
+         memory-mappable binary spline format (and back).
+
+         The binary format can be read directly by all GENIE applications
+         (the format is detected from the file signature, not its extension).
+         It is loaded without any parsing and, since the file is mapped into
+         memory, its pages are shared by all jobs reading it on the same node.
+         The binary file is written in the native byte order of the machine.
+
+         Syntax :
+           gspl2bin -f input_file -o output_file [-x]
+                    [--message-thresholds xml_file]
+
+         Options :
+           []  denotes an optional argument
+
+           -f
+              the input cross section spline file (XML or binary)
+           -o
+              the output cross section spline file
+           -x
+              write the output file in XML rather than in binary format
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+
+         Example:
+
+           shell$ gspl2bin -f xsec_splines.xml -o xsec_splines.bin
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+
+#include "Framework/Conventions/XmlParserStatus.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/SystemUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+//User-specified options:
+string gInpFile;          ///< input spline file
+string gOutFile;          ///< output spline file
+bool   gWriteXml = false; ///< write out XML rather than binary
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+
+  bool is_binary = XSecSplineList::IsBinaryFile(gInpFile);
+
+  LOG("gspl2bin", pNOTICE)
+     << " ---- >> Loading " << (is_binary ? "binary" : "XML")
+     << " file : " << gInpFile;
+
+  XmlParserStatus_t ist = is_binary ?
+                          xspl->LoadFromBinary(gInpFile) :
+                          xspl->LoadFromXml(gInpFile);
+  if(ist != kXmlOK) {
+    LOG("gspl2bin", pFATAL)
+       << "Problem reading file: " << gInpFile << " - Status: "
+       << XmlParserStatus::AsString(ist);
+    exit(1);
+  }
+
+  LOG("gspl2bin", pNOTICE)
+     << " ****** Saving all loaded splines into : " << gOutFile;
+  if(gWriteXml) xspl->SaveAsXml   (gOutFile);
+  else          xspl->SaveAsBinary(gOutFile);
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gspl2bin", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('f') ) {
+    LOG("gspl2bin", pINFO) << "Reading input file name";
+    gInpFile = parser.ArgAsString('f');
+  } else {
+    LOG("gspl2bin", pFATAL) << "You must specify an input file name";
+    PrintSyntax();
+    exit(1);
+  }
+  if( ! utils::system::FileExists(gInpFile) ) {
+    LOG("gspl2bin", pFATAL) << "Input file " << gInpFile << " doesn't exist";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('o') ) {
+    LOG("gspl2bin", pINFO) << "Reading output file name";
+    gOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gspl2bin", pFATAL) << "You must specify an output file name";
+    PrintSyntax();
+    exit(1);
+  }
+
+  gWriteXml = parser.OptionExists('x');
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gspl2bin", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gspl2bin  -f input_file -o output_file [-x]\n"
+    << "             [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
@@ -8,7 +8,7 @@
 
          Syntax :
            gspl2root -f xml_file -p nu -t tgt [-e emax]
-                     [-o root_file] [-w] [-k]
+                     [-o root_file] [-w] [-k] [-j nthreads]
                      [--message-thresholds xml_file]
                      [--event-generator-list list_name]
 
@@ -29,6 +29,11 @@
               write out plots in a postscipt file
            -k
               keep spline knot points  (not yet implemented).
+           -j
+              the number of threads computing the cross section graphs of the
+              input initial states (probe & target pairs) in parallel.
+              The event generation drivers are configured, and the outputs are
+              written, in the order of the initial states. [default: 1]
            --message-thresholds
               Allows users to customize the message stream thresholds.
            --event-generator-list
@@ -82,6 +87,10 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <map>
+#include <algorithm>
+#include <functional>
+#include <thread>
 
 #include <TSystem.h>
 #include <TFile.h>
@@ -94,6 +103,8 @@
 #include <TPaveText.h>
 #include <TString.h>
 #include <TH1F.h>
+#include <TROOT.h>
+#include <RVersion.h>
 
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
@@ -116,20 +127,34 @@
 
 using std::string;
 using std::vector;
+using std::map;
 using std::ostringstream;
 
 using namespace genie;
 using namespace genie::utils;
 
+// The cross section graphs of an initial state
+struct XSecGraphs {
+  int              probe;
+  int              target;
+  GEVGDriver *     driver;
+  vector<TGraph *> graphs;
+};
+
+// The values of the splines at the graph energies, computed once per spline
+typedef map<const Spline *, vector<double> > SplineValues;
+
 //Prototypes:
-void       LoadSplines          (void);
-GEVGDriver GetEventGenDriver    (void);
-void       SaveToPsFile         (void);
-void       SaveGraphsToRootFile (void);
-void       SaveNtupleToRootFile (void);
-void       GetCommandLineArgs   (int argc, char ** argv);
-void       PrintSyntax          (void);
-PDGCodeList GetPDGCodeListFromString(std::string s);
+void         LoadSplines          (void);
+GEVGDriver * GetEventGenDriver    (int probe, int target);
+void         SaveToPsFile         (const GEVGDriver & evg_driver, int probe, int target);
+void         BuildXSecGraphs      (XSecGraphs & xsg);
+void         SaveGraphsToRootFile (XSecGraphs & xsg);
+void         SaveNtupleToRootFile (void);
+void         GetCommandLineArgs   (int argc, char ** argv);
+void         PrintSyntax          (void);
+void         AddXSecSpline        (SplineValues & values, const Spline * spl, const double * e, double * xs);
+PDGCodeList  GetPDGCodeListFromString(std::string s);
 
 //User-specified options:
 string gOptXMLFilename;  // input XML filename
@@ -140,6 +165,7 @@ PDGCodeList gOptTgtPdgList;    // list of target PDG codes
 int    gOptProbePdgCode; // probe PDG code (currently being processed)
 int    gOptTgtPdgCode;   // target PDG code
 bool   gWriteOutPlots;   // write out a postscript file with plots
+int    gOptNThreads = 1; // number of threads computing the graphs
 //bool   gKeepSplineKnots; // use spline abscissa points rather than equi-spaced
 
 //Globals & constants
@@ -170,14 +196,53 @@ int main(int argc, char ** argv)
     LOG("gspl2root", pWARN) << "No splines loaded for tune " << RunOpt::Instance() -> Tune() -> Name() ;
   }
 
+  vector<XSecGraphs> states;
   for (unsigned int indx_p = 0; indx_p < gOptProbePdgList.size(); ++indx_p ) {
     for (unsigned int indx_t = 0; indx_t < gOptTgtPdgList.size(); ++indx_t ) {
-      gOptProbePdgCode = gOptProbePdgList[indx_p];
-      gOptTgtPdgCode   = gOptTgtPdgList[indx_t];
+      XSecGraphs xsg;
+      xsg.probe  = gOptProbePdgList[indx_p];
+      xsg.target = gOptTgtPdgList[indx_t];
+      xsg.driver = 0;
+      states.push_back(xsg);
+    }
+  }
+
+  bool save_in_root = gOptROOTFilename.size()>0;
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  if(gOptNThreads > 1) ROOT::EnableThreadSafety();
+#endif
+
+  // The initial states are processed in batches of gOptNThreads: the drivers
+  // of a batch are configured serially (the algorithm factory and the
+  // configuration pool are not protected against concurrent writes), their
+  // graphs are computed in parallel, and the outputs are written in order.
+  // Only the drivers of the current batch are kept in memory.
+  for (unsigned int ibatch = 0; ibatch < states.size(); ibatch += gOptNThreads) {
+    unsigned int iend = std::min((unsigned int) states.size(), ibatch + gOptNThreads);
+
+    for (unsigned int is = ibatch; is < iend; ++is) {
+      states[is].driver = GetEventGenDriver(states[is].probe, states[is].target);
+    }
+
+    if(save_in_root) {
+      vector<std::thread> threads;
+      for (unsigned int is = ibatch+1; is < iend; ++is) {
+        threads.push_back(std::thread(BuildXSecGraphs, std::ref(states[is])));
+      }
+      BuildXSecGraphs(states[ibatch]);
+      for (unsigned int it = 0; it < threads.size(); ++it) threads[it].join();
+    }
+
+    for (unsigned int is = ibatch; is < iend; ++is) {
+      gOptProbePdgCode = states[is].probe;
+      gOptTgtPdgCode   = states[is].target;
       // save the cross section plots in a postscript file
-      SaveToPsFile();
+      SaveToPsFile(*states[is].driver, gOptProbePdgCode, gOptTgtPdgCode);
       // save the cross section graphs at a root file
-      SaveGraphsToRootFile();
+      if(save_in_root) SaveGraphsToRootFile(states[is]);
+      delete states[is].driver;
+      states[is].driver = 0;
     }
   }
 
@@ -193,30 +258,27 @@ void LoadSplines(void)
   assert(ist == kXmlOK);
 }
 //____________________________________________________________________________
-GEVGDriver GetEventGenDriver(void)
+GEVGDriver * GetEventGenDriver(int probe, int target)
 {
 // create an event genartion driver configured for the specified initial state
 // (so that cross section splines will be accessed through that driver as in
 // event generation mode)
 
-  InitialState init_state(gOptTgtPdgCode, gOptProbePdgCode);
+  InitialState init_state(target, probe);
 
-  GEVGDriver evg_driver;
-  evg_driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
-  evg_driver.Configure(init_state);
-  evg_driver.CreateSplines();
-  evg_driver.CreateXSecSumSpline (100, gEmin, gEmax);
+  GEVGDriver * evg_driver = new GEVGDriver;
+  evg_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  evg_driver->Configure(init_state);
+  evg_driver->CreateSplines();
+  evg_driver->CreateXSecSumSpline (100, gEmin, gEmax);
 
   return evg_driver;
 }
 //____________________________________________________________________________
-void SaveToPsFile(void)
+void SaveToPsFile(const GEVGDriver & evg_driver, int probe, int target)
 {
   if(!gWriteOutPlots) return;
 
-  //-- get the event generation driver
-  GEVGDriver evg_driver = GetEventGenDriver();
-
   //-- define some marker styles / colors
   const unsigned int kNMarkers = 5;
   const unsigned int kNColors  = 6;
@@ -236,8 +298,8 @@ void SaveToPsFile(void)
   PDGLibrary * pdglib = PDGLibrary::Instance();
   ostringstream filename;
   filename << "xsec-splines-"
-          <<  pdglib->Find(gOptProbePdgCode)->GetName()  << "-"
-          <<  pdglib->Find(gOptTgtPdgCode)->GetName() << ".ps";
+          <<  pdglib->Find(probe)->GetName()  << "-"
+          <<  pdglib->Find(target)->GetName() << ".ps";
   TPostScript * ps = new TPostScript(filename.str().c_str(), kPsType);
 
   //-- get the list of interactions that can be simulated by the driver
@@ -512,61 +574,48 @@ void SaveToPsFile(void)
 void FormatXSecGraph(TGraph * g)
 {
   g->SetTitle("GENIE cross section graph");
+}
+//____________________________________________________________________________
+void FormatXSecGraphAxes(TGraph * g)
+{
+// The axes are set when the graph is saved, by the main thread, as they
+// create the graph histogram
+
   g->GetXaxis()->SetTitle("Ev (GeV)");
   g->GetYaxis()->SetTitle("#sigma_{nuclear} (10^{-38} cm^{2})");
 }
 //____________________________________________________________________________
-void SaveGraphsToRootFile(void)
+void AddXSecSpline(
+   SplineValues & values, const Spline * spl, const double * e, double * xs)
+{
+// Adds the spline values at the kNSplineP energies e (in 1E-38 cm^2) to xs.
+// The spline is evaluated at all energies at once, the first time it is
+// added, and its values are kept in the input map for the totals it enters.
+
+  SplineValues::iterator it = values.find(spl);
+  if(it == values.end()) {
+    it = values.insert(
+           SplineValues::value_type(spl, vector<double>(kNSplineP))).first;
+    spl->Evaluate(e, &(it->second[0]), kNSplineP);
+  }
+  const vector<double> & xs_spl = it->second;
+  for(int i=0; i<kNSplineP; i++) {
+    xs[i] += (xs_spl[i] * (1E+38/units::cm2));
+  }
+}
+//____________________________________________________________________________
+void BuildXSecGraphs(XSecGraphs & xsg)
 {
-  //-- get the event generation driver
-  GEVGDriver evg_driver = GetEventGenDriver();
+// Computes the cross section graphs of an initial state, using its driver.
+// Called concurrently for the initial states of a batch (see main()).
+
+  const GEVGDriver & evg_driver = *xsg.driver;
 
   //-- get the list of interactions that can be simulated by the driver
   const InteractionList * ilist = evg_driver.Interactions();
 
-  //-- check whether the splines will be saved in a ROOT file - if not, exit now
-  bool save_in_root = gOptROOTFilename.size()>0;
-  if(!save_in_root) return;
-
-  //-- get pdglibrary for mapping pdg codes to names
-  PDGLibrary * pdglib = PDGLibrary::Instance();
-
-  //-- check whether the requested filename exists
-  //   if yes, then open the file in 'update' mode
-  bool exists = !(gSystem->AccessPathName(gOptROOTFilename.c_str()));
-
-  TFile * froot = 0;
-  if(exists) froot = new TFile(gOptROOTFilename.c_str(), "UPDATE");
-  else       froot = new TFile(gOptROOTFilename.c_str(), "RECREATE");
-  assert(froot);
-
-  //-- create directory
-  ostringstream dptr;
-
-  string probe_name = pdglib->Find(gOptProbePdgCode)->GetName();
-  string tgt_name   = (gOptTgtPdgCode==1000000010) ?
-                      "n" : pdglib->Find(gOptTgtPdgCode)->GetName();
-
-  dptr << probe_name << "_" << tgt_name;
-  ostringstream dtitle;
-  dtitle << "Cross sections for: "
-         << pdglib->Find(gOptProbePdgCode)->GetName() << "+"
-         << pdglib->Find(gOptTgtPdgCode)->GetName();
-
-  LOG("gspl2root", pINFO)
-           << "Will store graphs in root directory = " << dptr.str();
-  TDirectory * topdir =
-         dynamic_cast<TDirectory *> (froot->Get(dptr.str().c_str()));
-  if(topdir) {
-     LOG("gspl2root", pINFO)
-       << "Directory: " << dptr.str() << " already exists!! Exiting";
-     froot->Close();
-     delete froot;
-     return;
-  }
-
-  topdir = froot->mkdir(dptr.str().c_str(),dtitle.str().c_str());
-  topdir->cd();
+  vector<TGraph *> & graphs = xsg.graphs;
+  SplineValues values;
 
   double   de = (gEmax-gEmin)/(kNSplineP-1);
   double * e  = new double[kNSplineP];
@@ -659,16 +708,15 @@ void SaveGraphsToRootFile(void)
     }
 
     const Spline * spl = evg_driver.XSecSpline(interaction);
-    for(int i=0; i<kNSplineP; i++) {
-      xs[i] = spl->Evaluate(e[i]) * (1E+38/units::cm2);
-    }
+    for(int i=0; i<kNSplineP; i++) xs[i] = 0;
+    AddXSecSpline(values, spl, e, xs);
 
     TGraph * gr = new TGraph(kNSplineP, e, xs);
     gr->SetName(title.str().c_str());
     FormatXSecGraph(gr);
     gr->SetTitle(spl->GetName());
 
-    topdir->Add(gr);
+    graphs.push_back(gr);
   }
 
 
@@ -676,7 +724,7 @@ void SaveGraphsToRootFile(void)
   // totals for (anti-)neutrino scattering
   //
 
-  bool is_neutrino = pdg::IsNeutralLepton(gOptProbePdgCode);
+  bool is_neutrino = pdg::IsNeutralLepton(xsg.probe);
 
   if(is_neutrino) {
 
@@ -704,43 +752,35 @@ void SaveGraphsToRootFile(void)
        const Spline * spl = evg_driver.XSecSpline(interaction);
 
        if (proc.IsResonant() && proc.IsWeakCC() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsresccp);
        }
        if (proc.IsResonant() && proc.IsWeakCC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsresccn);
        }
        if (proc.IsResonant() && proc.IsWeakNC() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsresncp);
        }
        if (proc.IsResonant() && proc.IsWeakNC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsresncn);
        }
     }
 
     TGraph * gr_resccp = new TGraph(kNSplineP, e, xsresccp);
     gr_resccp->SetName("res_cc_p");
     FormatXSecGraph(gr_resccp);
-    topdir->Add(gr_resccp);
+    graphs.push_back(gr_resccp);
     TGraph * gr_resccn = new TGraph(kNSplineP, e, xsresccn);
     gr_resccn->SetName("res_cc_n");
     FormatXSecGraph(gr_resccn);
-    topdir->Add(gr_resccn);
+    graphs.push_back(gr_resccn);
     TGraph * gr_resncp = new TGraph(kNSplineP, e, xsresncp);
     gr_resncp->SetName("res_nc_p");
     FormatXSecGraph(gr_resncp);
-    topdir->Add(gr_resncp);
+    graphs.push_back(gr_resncp);
     TGraph * gr_resncn = new TGraph(kNSplineP, e, xsresncn);
     gr_resncn->SetName("res_nc_n");
     FormatXSecGraph(gr_resncn);
-    topdir->Add(gr_resncn);
+    graphs.push_back(gr_resncn);
 
     //
     // add-up all dis channels
@@ -768,42 +808,34 @@ void SaveGraphsToRootFile(void)
        if(xcls.IsCharmEvent()) continue;
 
        if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsdisccp);
        }
        if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsdisccn);
        }
        if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsdisncp);
        }
        if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsdisncn);
        }
     }
     TGraph * gr_disccp = new TGraph(kNSplineP, e, xsdisccp);
     gr_disccp->SetName("dis_cc_p");
     FormatXSecGraph(gr_disccp);
-    topdir->Add(gr_disccp);
+    graphs.push_back(gr_disccp);
     TGraph * gr_disccn = new TGraph(kNSplineP, e, xsdisccn);
     gr_disccn->SetName("dis_cc_n");
     FormatXSecGraph(gr_disccn);
-    topdir->Add(gr_disccn);
+    graphs.push_back(gr_disccn);
     TGraph * gr_disncp = new TGraph(kNSplineP, e, xsdisncp);
     gr_disncp->SetName("dis_nc_p");
     FormatXSecGraph(gr_disncp);
-    topdir->Add(gr_disncp);
+    graphs.push_back(gr_disncp);
     TGraph * gr_disncn = new TGraph(kNSplineP, e, xsdisncn);
     gr_disncn->SetName("dis_nc_n");
     FormatXSecGraph(gr_disncn);
-    topdir->Add(gr_disncn);
+    graphs.push_back(gr_disncn);
 
     //
     // add-up all charm dis channels
@@ -827,42 +859,34 @@ void SaveGraphsToRootFile(void)
       if(!xcls.IsCharmEvent()) continue;
 
       if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsProton(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xsdisccp);
       }
       if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xsdisccn);
       }
       if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsProton(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xsdisncp);
       }
       if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xsdisncn);
       }
     }
     TGraph * gr_disccp_charm = new TGraph(kNSplineP, e, xsdisccp);
     gr_disccp_charm->SetName("dis_cc_p_charm");
     FormatXSecGraph(gr_disccp_charm);
-    topdir->Add(gr_disccp_charm);
+    graphs.push_back(gr_disccp_charm);
     TGraph * gr_disccn_charm = new TGraph(kNSplineP, e, xsdisccn);
     gr_disccn_charm->SetName("dis_cc_n_charm");
     FormatXSecGraph(gr_disccn_charm);
-    topdir->Add(gr_disccn_charm);
+    graphs.push_back(gr_disccn_charm);
     TGraph * gr_disncp_charm = new TGraph(kNSplineP, e, xsdisncp);
     gr_disncp_charm->SetName("dis_nc_p_charm");
     FormatXSecGraph(gr_disncp_charm);
-    topdir->Add(gr_disncp_charm);
+    graphs.push_back(gr_disncp_charm);
     TGraph * gr_disncn_charm = new TGraph(kNSplineP, e, xsdisncn);
     gr_disncn_charm->SetName("dis_nc_n_charm");
     FormatXSecGraph(gr_disncn_charm);
-    topdir->Add(gr_disncn_charm);
+    graphs.push_back(gr_disncn_charm);
 
     //
     // add-up all mec channels
@@ -882,25 +906,21 @@ void SaveGraphsToRootFile(void)
        const Spline * spl = evg_driver.XSecSpline(interaction);
 
        if (proc.IsMEC() && proc.IsWeakCC()) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsmeccc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsmeccc);
        }
        if (proc.IsMEC() && proc.IsWeakNC()) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsmecnc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsmecnc);
        }
     }
 
     TGraph * gr_meccc = new TGraph(kNSplineP, e, xsmeccc);
     gr_meccc->SetName("mec_cc");
     FormatXSecGraph(gr_meccc);
-    topdir->Add(gr_meccc);
+    graphs.push_back(gr_meccc);
     TGraph * gr_mecnc = new TGraph(kNSplineP, e, xsmecnc);
     gr_mecnc->SetName("mec_nc");
     FormatXSecGraph(gr_mecnc);
-    topdir->Add(gr_mecnc);
+    graphs.push_back(gr_mecnc);
 
     //
     // total cross sections
@@ -933,62 +953,50 @@ void SaveGraphsToRootFile(void)
       bool offn = pdg::IsNeutron(tgt.HitNucPdg());
 
       if (iscc && offp) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xstotccp);
       }
       if (iscc && offn) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xstotccn);
       }
       if (isnc && offp) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xstotncp);
       }
       if (isnc && offn) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xstotncn);
       }
 
       if (iscc) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotcc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xstotcc);
       }
       if (isnc) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotnc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xstotnc);
       }
     }
 
     TGraph * gr_totcc = new TGraph(kNSplineP, e, xstotcc);
     gr_totcc->SetName("tot_cc");
     FormatXSecGraph(gr_totcc);
-    topdir->Add(gr_totcc);
+    graphs.push_back(gr_totcc);
     TGraph * gr_totccp = new TGraph(kNSplineP, e, xstotccp);
     gr_totccp->SetName("tot_cc_p");
     FormatXSecGraph(gr_totccp);
-    topdir->Add(gr_totccp);
+    graphs.push_back(gr_totccp);
     TGraph * gr_totccn = new TGraph(kNSplineP, e, xstotccn);
     gr_totccn->SetName("tot_cc_n");
     FormatXSecGraph(gr_totccn);
-    topdir->Add(gr_totccn);
+    graphs.push_back(gr_totccn);
     TGraph * gr_totnc = new TGraph(kNSplineP, e, xstotnc);
     gr_totnc->SetName("tot_nc");
     FormatXSecGraph(gr_totnc);
-    topdir->Add(gr_totnc);
+    graphs.push_back(gr_totnc);
     TGraph * gr_totncp = new TGraph(kNSplineP, e, xstotncp);
     gr_totncp->SetName("tot_nc_p");
     FormatXSecGraph(gr_totncp);
-    topdir->Add(gr_totncp);
+    graphs.push_back(gr_totncp);
     TGraph * gr_totncn = new TGraph(kNSplineP, e, xstotncn);
     gr_totncn->SetName("tot_nc_n");
     FormatXSecGraph(gr_totncn);
-    topdir->Add(gr_totncn);
+    graphs.push_back(gr_totncn);
 
     delete [] e;
     delete [] xs;
@@ -1014,7 +1022,7 @@ void SaveGraphsToRootFile(void)
   // totals for charged lepton scattering
   //
 
-  bool is_charged_lepton = pdg::IsChargedLepton(gOptProbePdgCode);
+  bool is_charged_lepton = pdg::IsChargedLepton(xsg.probe);
 
   if(is_charged_lepton) {
 
@@ -1038,25 +1046,21 @@ void SaveGraphsToRootFile(void)
        const Spline * spl = evg_driver.XSecSpline(interaction);
 
        if (proc.IsResonant() && proc.IsEM() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsresemp);
        }
        if (proc.IsResonant() && proc.IsEM() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsresemn);
        }
     }
 
     TGraph * gr_resemp = new TGraph(kNSplineP, e, xsresemp);
     gr_resemp->SetName("res_em_p");
     FormatXSecGraph(gr_resemp);
-    topdir->Add(gr_resemp);
+    graphs.push_back(gr_resemp);
     TGraph * gr_resemn = new TGraph(kNSplineP, e, xsresemn);
     gr_resemn->SetName("res_em_n");
     FormatXSecGraph(gr_resemn);
-    topdir->Add(gr_resemn);
+    graphs.push_back(gr_resemn);
 
     //
     // add-up all dis channels
@@ -1080,24 +1084,20 @@ void SaveGraphsToRootFile(void)
        if(xcls.IsCharmEvent()) continue;
 
        if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsdisemp);
        }
        if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-         }
+         AddXSecSpline(values, spl, e, xsdisemn);
        }
     }
     TGraph * gr_disemp = new TGraph(kNSplineP, e, xsdisemp);
     gr_disemp->SetName("dis_em_p");
     FormatXSecGraph(gr_disemp);
-    topdir->Add(gr_disemp);
+    graphs.push_back(gr_disemp);
     TGraph * gr_disemn = new TGraph(kNSplineP, e, xsdisemn);
     gr_disemn->SetName("dis_em_n");
     FormatXSecGraph(gr_disemn);
-    topdir->Add(gr_disemn);
+    graphs.push_back(gr_disemn);
 
     //
     // add-up all charm dis channels
@@ -1119,24 +1119,20 @@ void SaveGraphsToRootFile(void)
       if(!xcls.IsCharmEvent()) continue;
 
       if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsProton(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xsdisemp);
       }
       if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsNeutron(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xsdisemn);
       }
     }
     TGraph * gr_disemp_charm = new TGraph(kNSplineP, e, xsdisemp);
     gr_disemp_charm->SetName("dis_em_p_charm");
     FormatXSecGraph(gr_disemp_charm);
-    topdir->Add(gr_disemp_charm);
+    graphs.push_back(gr_disemp_charm);
     TGraph * gr_disemn_charm = new TGraph(kNSplineP, e, xsdisemn);
     gr_disemn_charm->SetName("dis_em_n_charm");
     FormatXSecGraph(gr_disemn_charm);
-    topdir->Add(gr_disemn_charm);
+    graphs.push_back(gr_disemn_charm);
 
     //
     // total cross sections
@@ -1162,34 +1158,28 @@ void SaveGraphsToRootFile(void)
       bool offn = pdg::IsNeutron(tgt.HitNucPdg());
 
       if (isem && offp) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xstotemp);
       }
       if (isem && offn) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xstotemn);
       }
       if (isem) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotem[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
-        }
+        AddXSecSpline(values, spl, e, xstotem);
       }
     }
 
     TGraph * gr_totem = new TGraph(kNSplineP, e, xstotem);
     gr_totem->SetName("tot_em");
     FormatXSecGraph(gr_totem);
-    topdir->Add(gr_totem);
+    graphs.push_back(gr_totem);
     TGraph * gr_totemp = new TGraph(kNSplineP, e, xstotemp);
     gr_totemp->SetName("tot_em_p");
     FormatXSecGraph(gr_totemp);
-    topdir->Add(gr_totemp);
+    graphs.push_back(gr_totemp);
     TGraph * gr_totemn = new TGraph(kNSplineP, e, xstotemn);
     gr_totemn->SetName("tot_em_n");
     FormatXSecGraph(gr_totemn);
-    topdir->Add(gr_totemn);
+    graphs.push_back(gr_totemn);
 
     delete [] e;
     delete [] xs;
@@ -1203,6 +1193,61 @@ void SaveGraphsToRootFile(void)
 
   }// charged leptons
 
+}
+//____________________________________________________________________________
+void SaveGraphsToRootFile(XSecGraphs & xsg)
+{
+// Saves the graphs of an initial state in their own directory of the output
+// ROOT file, which takes over their ownership
+
+  //-- get pdglibrary for mapping pdg codes to names
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
+  //-- check whether the requested filename exists
+  //   if yes, then open the file in 'update' mode
+  bool exists = !(gSystem->AccessPathName(gOptROOTFilename.c_str()));
+
+  TFile * froot = 0;
+  if(exists) froot = new TFile(gOptROOTFilename.c_str(), "UPDATE");
+  else       froot = new TFile(gOptROOTFilename.c_str(), "RECREATE");
+  assert(froot);
+
+  //-- create directory
+  ostringstream dptr;
+
+  string probe_name = pdglib->Find(xsg.probe)->GetName();
+  string tgt_name   = (xsg.target==1000000010) ?
+                      "n" : pdglib->Find(xsg.target)->GetName();
+
+  dptr << probe_name << "_" << tgt_name;
+  ostringstream dtitle;
+  dtitle << "Cross sections for: "
+         << pdglib->Find(xsg.probe)->GetName() << "+"
+         << pdglib->Find(xsg.target)->GetName();
+
+  LOG("gspl2root", pINFO)
+           << "Will store graphs in root directory = " << dptr.str();
+  TDirectory * topdir =
+         dynamic_cast<TDirectory *> (froot->Get(dptr.str().c_str()));
+  if(topdir) {
+     LOG("gspl2root", pINFO)
+       << "Directory: " << dptr.str() << " already exists!! Exiting";
+     froot->Close();
+     delete froot;
+     for(unsigned int i = 0; i < xsg.graphs.size(); i++) delete xsg.graphs[i];
+     xsg.graphs.clear();
+     return;
+  }
+
+  topdir = froot->mkdir(dptr.str().c_str(),dtitle.str().c_str());
+  topdir->cd();
+
+  for(unsigned int i = 0; i < xsg.graphs.size(); i++) {
+    FormatXSecGraphAxes(xsg.graphs[i]);
+    topdir->Add(xsg.graphs[i]);
+  }
+  xsg.graphs.clear();
+
   topdir->Write();
 
   if(froot) {
@@ -1316,6 +1361,14 @@ void GetCommandLineArgs(int argc, char ** argv)
   // write-out a PS file with plots
   gWriteOutPlots = parser.OptionExists('w');
 
+  // number of threads computing the graphs
+  if( parser.OptionExists('j') ) {
+    LOG("gspl2root", pINFO) << "Reading number of threads";
+    gOptNThreads = std::max(1, parser.ArgAsInt('j'));
+  } else {
+    gOptNThreads = 1;
+  }
+
   // use same abscissa points as splines
   //not yet//gKeepSplineKnots = parser.OptionExists('k');
 
@@ -1330,6 +1383,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gspl2root", pINFO) << "  Probe PDG code  = " << gOptProbePdgCode;
   LOG("gspl2root", pINFO) << "  Target PDG code = " << gOptTgtPdgCode;
   LOG("gspl2root", pINFO) << "  Max neutrino E  = " << gOptNuEnergy;
+  LOG("gspl2root", pINFO) << "  Threads         = " << gOptNThreads;
   //not yet//LOG("gspl2root", pINFO) << "  Keep spline knots  = " << (gKeepSplineKnots?"true":"false");
 }
 //____________________________________________________________________________
@@ -1338,7 +1392,7 @@ void PrintSyntax(void)
   LOG("gspl2root", pNOTICE)
       << "\n\n" << "Syntax:" << "\n"
       << "   gspl2root -f xml_file -p probe_pdg -t target_pdg"
-      << "            [-e emax] [-o output_root_file] [-w]\n"
+      << "            [-e emax] [-o output_root_file] [-w] [-j nthreads]\n"
       << "            [--message-thresholds xml_file]\n";
 }
 //____________________________________________________________________________
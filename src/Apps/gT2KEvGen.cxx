@@ -33,6 +33,14 @@
                       [-o output_event_file_prefix]
                       [-R]
                       [--seed random_number_seed]
+                      [--shard i/N]
+                      [--checkpoint-interval nev]
+                      [--restart]
+                      [--async-output]
+                      [--flux-read-ahead cache_MB[,n_entries]]
+                      [--channel-bias channel:factor,...]
+                      [--event-filter name/config]
+                      [--memory-report]
                        --cross-sections xml_file
                       [--tune genie_tune]
                       [--message-thresholds xml_file]
@@ -297,6 +305,50 @@
               starting at the same point when using very large flux input files.
            --seed
               Random number seed.
+           --shard
+              Runs job i of a production split in N jobs (given as i/N, with
+              0 <= i < N). Each job uses a random number seed derived from
+              --seed (or the default seed) and i, so that the jobs are
+              independent and reproducible. The job outputs can be merged with
+              gmerge, which combines the normalization stored in the tree
+              headers.
+           --checkpoint-interval
+              Writes a checkpoint every `nev' events: the events generated so
+              far are saved in the output file, along with the state of the
+              random number generators, the position in the JNUBEAM flux
+              ntuple and the normalization counters. Also written when the
+              job is ended with SIGTERM.
+           --restart
+              Restarts an interrupted job (run with the same options) from
+              its last checkpoint, in its output file.
+           --async-output
+              Writes the events from a writer thread, overlapping the output
+              with the event generation. Falls back to synchronous writing
+              when the JNUBEAM pass-through flux branch is added to the event
+              tree (ie only used with flux histograms).
+           --flux-read-ahead
+              Size (in MB) of the read cache of the JNUBEAM flux ntuple,
+              optionally followed by the number of flux entries decoded ahead
+              on a reader thread (eg 100,1000). Useful for flux files on
+              network storage.
+           --channel-bias
+              Oversamples the listed channels (scattering types such as COH,
+              DFR, NuEEL, IMD, GLR, or charm) by the given factors, eg
+              COH:10,DFR:10,charm:50. The events are weighted (see
+              GHepRecord::Weight()) so that the sample normalization is
+              unchanged, and the effective POT of each channel is printed at
+              the end of the job.
+           --event-filter
+              Keeps only the events accepted by the given EventFilterI
+              algorithm & configuration, eg
+              genie::PrimaryLeptonFilter/MuonAbove1GeV. The filter is run
+              before the hadron transport, so the rejected events cost little.
+              The POT is unchanged and the accept fraction is stored in the
+              output tree header.
+           --memory-report
+              Prints the memory held by the GENIE singletons and physics
+              tables, per category, after the initialization and at the end
+              of the job.
            --cross-sections
               Name (incl. full path) of an XML file with pre-computed
               cross-section values used for constructing splines.
@@ -432,9 +484,10 @@
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
-#include "Framework/EventGen/GMCJMonitor.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpMCJob.h"
+#include "Framework/Ntuple/NtpMCCheckpoint.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGCodeList.h"
@@ -471,6 +524,27 @@ using namespace genie;
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
 
+// The gevgen_t2k specifics of the event generation loop: JNUBEAM pass-through
+// flux branch, POT normalization, position in the flux ntuple & meta-data
+// (see NtpMCJob)
+class T2KMCJob : public NtpMCJob {
+public:
+  T2KMCJob(flux::GJPARCNuFlux * jparc_flux_driver);
+
+protected:
+  void   AddBranches      (NtpWriter & ntpw);
+  double Exposure         (void) const;
+  void   EventGenerated   (int ievent, const EventRecord & event);
+  void   EventWritten     (int ievent);
+  bool   SaveFluxState    (NtpMCCheckpoint & checkpoint) const;
+  bool   RestoreFluxState (const NtpMCCheckpoint & checkpoint);
+  void   Finalize         (NtpWriter & ntpw, long int nev);
+
+private:
+  flux::GJPARCNuFlux *                fJPARCFlux; ///< 0 if using flux histograms
+  flux::GJPARCNuFluxPassThroughInfo * fFluxInfo;  ///< pass-through info of the current event
+};
+
 // Default options (override them using the command line arguments):
 //
 string          kDefOptGeomLUnits   = "mm";    // default geometry length units
@@ -602,6 +676,9 @@ int main(int argc, char ** argv)
     jparc_flux_driver = new flux::GJPARCNuFlux;
     // before loading the beam sim data set whether to use a random offset when looping
     if(gOptRandomFluxOffset == false) jparc_flux_driver->DisableOffset();
+    // read the flux entries ahead, if requested (--flux-read-ahead)
+    jparc_flux_driver->SetReadAhead(RunOpt::Instance()->FluxReadAheadCache(),
+                                    RunOpt::Instance()->FluxPrefetch());
     // specify input JNUBEAM file & detector location
     bool beam_sim_data_success = jparc_flux_driver->LoadBeamSimData(gOptFluxFile, gOptDetectorLocation);
     if(!beam_sim_data_success) {
@@ -768,97 +845,103 @@ int main(int argc, char ** argv)
   }
 
   // *************************************************************************
-  // * Prepare for writing the output event tree & status file
+  // * Event generation loop & output (see NtpMCJob)
   // *************************************************************************
 
-  // Initialize an Ntuple Writer to save GHEP records into a TTree
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
-  ntpw.Initialize();
-
-  // Add a custom-branch at the standard GENIE event tree so that
-  // info on the flux neutrino parent particle can be passed-through
-  flux::GJPARCNuFluxPassThroughInfo * flux_info = 0;
-  if(!gOptUsingHistFlux) {
-    TBranch * flux = ntpw.EventTree()->Branch("flux",
-       "genie::flux::GJPARCNuFluxPassThroughInfo", &flux_info, 32000, 1);
-    assert(flux);
-    flux->SetAutoDelete(kFALSE);
-  }
-
-  // Create a MC job monitor for a periodically updated status file
-  GMCJMonitor mcjmonitor(gOptRunNu);
-  mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+  T2KMCJob job(jparc_flux_driver);
+  job.SetFilenamePrefix(gOptEvFilePrefix);
+  job.SetNumOfEvents(gOptNev);
+  // In case the required statistics was expressed as 'number of POT' and
+  // the user does not want to wait till the end of the flux cycle to exit
+  // the event loop, then quit if the requested POT has been generated.
+  // In this case the computed POT may not be as accurate as if the program
+  // was waiting for the current flux cycle to be completed.
+  if(!gOptExitAtEndOfFullFluxCycles) job.SetExposure(gOptPOT);
+  job.Run(mcj_driver);
 
   // *************************************************************************
-  // * Event generation loop
+  // * Clean-up
   // *************************************************************************
 
-  int ievent = 0;
-  while (1)
-  {
-     LOG("gevgen_t2k", pNOTICE)
-          << " *** Generating event............ " << ievent;
-
-     // In case the required statistics was expressed as 'number of events'
-     // then quit if that number has been generated
-     if(ievent == gOptNev) break;
-
-     // In case the required statistics was expressed as 'number of POT' and
-     // the user does not want to wait till the end of the flux cycle to exit
-     // the event loop, then quit if the requested POT has been generated.
-     // In this case the computed POT may not be as accurate as if the program
-     // was waiting for the current flux cycle to be completed.
-     if(!gOptExitAtEndOfFullFluxCycles && gOptPOT>0) {
-        double fpot = jparc_flux_driver->POT_curravg(); // current POT in flux file
-        double psc  = mcj_driver->GlobProbScale();      // interaction prob. scale
-        double pot  = fpot / psc;                       // POT for generated sample
-        if(pot >= gOptPOT) break;
-     }
-
-     // Generate a single event using neutrinos coming from the specified flux
-     // and hitting the specified geometry or target mix
-     EventRecord * event = mcj_driver->GenerateEvent();
+  // Clean-up
+  delete geom_driver;
+  delete flux_driver;
+  delete mcj_driver;
+  map<int,TH1D*>::iterator it = gOptFluxHst.begin();
+  for( ; it != gOptFluxHst.end(); ++it) {
+    TH1D * spectrum = it->second;
+    if(spectrum) delete spectrum;
+  }
+  gOptFluxHst.clear();
 
-     // Check whether a null event was returned due to the flux driver reaching
-     // the end of the input flux ntuple - exit the event generation loop
-     if(!event && jparc_flux_driver->End()) {
-        LOG("gevgen_t2k", pNOTICE)
-          << "** The JPARC flux driver read all the input flux ntuple entries";
-        break;
-     }
-     if(!event) {
-         LOG("gevgen_t2k", pERROR)
-             << "Got a null generated neutino event! Retrying ...";
-         continue;
-     }
-     LOG("gevgen_t2k", pINFO)
-         << "Generated event: " << *event;
-
-     // A valid event was generated: extract flux info (parent decay/prod
-     // position/kinematics) for that simulated event so that it can be
-     // passed-through.
-     // Can only do so if I am generating events using the JNUBEAM flux
-     // ntuples, not simple histograms
-     if(!gOptUsingHistFlux) {
-        flux_info = new flux::GJPARCNuFluxPassThroughInfo(
-            jparc_flux_driver->PassThroughInfo());
-        LOG("gevgen_t2k", pINFO)
-          << "Pass-through flux info associated with generated event: "
-          << *flux_info;
-     }
+  LOG("gevgen_t2k", pNOTICE) << "Done!";
 
-     // Add event at the output ntuple, refresh the mc job monitor & clean-up
-     ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
-     delete event;
-     if(flux_info) delete flux_info;
-     ievent++;
-  } //1
+  return 0;
+}
+//____________________________________________________________________________
+T2KMCJob::T2KMCJob(flux::GJPARCNuFlux * jparc_flux_driver) :
+NtpMCJob("gevgen_t2k", kDefOptNtpFormat, gOptRunNu),
+fJPARCFlux(jparc_flux_driver),
+fFluxInfo(0)
+{
 
-  LOG("gevgen_t2k", pNOTICE)
-    << "The GENIE MC job is done generaing events - Cleaning up & exiting...";
+}
+//____________________________________________________________________________
+void T2KMCJob::AddBranches(NtpWriter & ntpw)
+{
+  // Add a custom-branch at the standard GENIE event tree so that
+  // info on the flux neutrino parent particle can be passed-through
+  if(!fJPARCFlux) return;
 
+  TBranch * flux = ntpw.EventTree()->Branch("flux",
+     "genie::flux::GJPARCNuFluxPassThroughInfo", &fFluxInfo, 32000, 1);
+  assert(flux);
+  flux->SetAutoDelete(kFALSE);
+}
+//____________________________________________________________________________
+double T2KMCJob::Exposure(void) const
+{
+  // current POT in flux file
+  return (fJPARCFlux) ? fJPARCFlux->POT_curravg() : -1;
+}
+//____________________________________________________________________________
+void T2KMCJob::EventGenerated(int /* ievent */, const EventRecord & /* event */)
+{
+  // A valid event was generated: extract flux info (parent decay/prod
+  // position/kinematics) for that simulated event so that it can be
+  // passed-through.
+  // Can only do so if I am generating events using the JNUBEAM flux
+  // ntuples, not simple histograms
+  if(!fJPARCFlux) return;
+
+  fFluxInfo = new flux::GJPARCNuFluxPassThroughInfo(
+      fJPARCFlux->PassThroughInfo());
+  LOG("gevgen_t2k", pINFO)
+    << "Pass-through flux info associated with generated event: "
+    << *fFluxInfo;
+}
+//____________________________________________________________________________
+void T2KMCJob::EventWritten(int /* ievent */)
+{
+  if(fFluxInfo) delete fFluxInfo;
+  fFluxInfo = 0;
+}
+//____________________________________________________________________________
+bool T2KMCJob::SaveFluxState(NtpMCCheckpoint & checkpoint) const
+{
+  if(!fJPARCFlux) return false;
+  return fJPARCFlux->GetFluxCursor(checkpoint.fluxcounters, checkpoint.fluxsums);
+}
+//____________________________________________________________________________
+bool T2KMCJob::RestoreFluxState(const NtpMCCheckpoint & checkpoint)
+{
+  if(!fJPARCFlux) return true;
+  return checkpoint.hasfluxcursor &&
+    fJPARCFlux->SetFluxCursor(checkpoint.fluxcounters, checkpoint.fluxsums);
+}
+//____________________________________________________________________________
+void T2KMCJob::Finalize(NtpWriter & ntpw, long int nev)
+{
   // *************************************************************************
   // * Print job statistics &
   // * calculate normalization factor for the generated sample
@@ -868,15 +951,14 @@ int main(int argc, char ** argv)
     // POT normalization will only be calculated if event generation was based
     // on beam simulation  outputs (not just histograms) & a detailed detector
     // geometry description.
-    double fpot = jparc_flux_driver->POT_curravg(); // current POT in flux file
-    double psc  = mcj_driver->GlobProbScale();      // interaction prob. scale
+    double fpot = fJPARCFlux->POT_curravg();        // current POT in flux file
+    double psc  = fMCJDriver->GlobProbScale();      // interaction prob. scale
     double pot  = fpot / psc;                       // POT for generated sample
     // Get nunber of flux neutrinos read-in by flux friver, number of flux
     // neutrinos actually thrown to the event generation driver and number
     // of neutrino interactions actually generated
-    long int nflx_evg = mcj_driver        -> NFluxNeutrinos();
-    long int nflx     = jparc_flux_driver -> NFluxNeutrinos();
-    long int nev      = ievent;
+    long int nflx_evg = fMCJDriver -> NFluxNeutrinos();
+    long int nflx     = fJPARCFlux -> NFluxNeutrinos();
 
     LOG("gevgen_t2k", pNOTICE)
         << "\n >> Actual JNUBEAM flux file normalization:  " << fpot
@@ -888,7 +970,7 @@ int main(int argc, char ** argv)
         << "\n ** Normalization for generated sample:      " << pot
             << " POT * " << ((gOptDetectorLocation == "sk") ? "cm^2" : "det");
 
-    ntpw.EventTree()->SetWeight(pot); // POT
+    this->StoreSampleExposure(ntpw, pot); // POT
   }
 
   // *************************************************************************
@@ -909,28 +991,6 @@ int main(int argc, char ** argv)
   metadata -> flux_hists         = gOptFluxHst;
 
   ntpw.EventTree()->GetUserInfo()->Add(metadata);
-
-  // *************************************************************************
-  // * Save & clean-up
-  // *************************************************************************
-
-  // Save the generated event tree & close the output file
-  ntpw.Save();
-
-  // Clean-up
-  delete geom_driver;
-  delete flux_driver;
-  delete mcj_driver;
-  map<int,TH1D*>::iterator it = gOptFluxHst.begin();
-  for( ; it != gOptFluxHst.end(); ++it) {
-    TH1D * spectrum = it->second;
-    if(spectrum) delete spectrum;
-  }
-  gOptFluxHst.clear();
-
-  LOG("gevgen_t2k", pNOTICE) << "Done!";
-
-  return 0;
 }
 //____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
@@ -1481,6 +1541,12 @@ void PrintSyntax(void)
    << "\n           [-o output_event_file_prefix]"
    << "\n           [-R]"
    << "\n           [--seed random_number_seed]"
+   << "\n           [--shard i/N]"
+   << "\n           [--checkpoint-interval nev] [--restart]"
+   << "\n           [--async-output] [--flux-read-ahead cache_MB[,n_entries]]"
+   << "\n           [--channel-bias channel:factor,...]"
+   << "\n           [--event-filter name/config]"
+   << "\n           [--memory-report]"
    << "\n            --cross-sections xml_file"
    << "\n           [--event-generator-list list_name]"
    << "\n           [--message-thresholds xml_file]"
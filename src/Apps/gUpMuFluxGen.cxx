@@ -12,7 +12,8 @@
                         -f flux
                         -n n_of_events
                         -d detector_bounding_box_size
-                        -g rock_composition
+                       [-g rock_composition]
+                       [--mueloss-table root_file]
                        [--seed random_number_seed]
                         --cross-sections xml_file
                        [--message-thresholds xml_file]
@@ -48,10 +49,17 @@
               Specifies side length (in mm) of the detector bounding box.
               [default 100m (100000mm)]
            -g
-              rock composition << NOT IMPLEMENTED YET >>
-              Rock composition should be implemented in terms of materials defined in
-              src/MuELoss/MuELMaterial.h and their weight fraction
+              Specifies the rock composition in terms of the materials defined in
+              $GENIE/src/Physics/MuonEnergyLoss/MuELMaterial.h (by name, with the
+              spaces removed and case-insensitive, or by id) and their weight fractions,
               eg like -g 'silicon[0.30],calcium[0.29],iron[0.02],...'
+              The muon range in the rock, which weights the Emu pdf, is taken from
+              energy loss and range tables computed for this composition at startup.
+              [default: 'standardrock[1]']
+           --mueloss-table
+              Name of a ROOT file caching the muon energy loss and range tables.
+              The tables are loaded from it if it holds tables for the requested rock
+              composition, and are otherwise computed and saved in it.
            --seed
               Random number seed.
            --cross-sections
@@ -125,6 +133,7 @@
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/MuonEnergyLoss/MuELossTable.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
 #include "Tools/Flux/GFLUKAAtmoFlux.h"
@@ -139,6 +148,7 @@ using std::ostringstream;
 using namespace genie;
 using namespace genie::flux;
 using namespace genie::constants;
+using namespace genie::mueloss;
 
 void       GetCommandLineArgs     (int argc, char ** argv);
 void       PrintSyntax            (void);
@@ -149,6 +159,7 @@ TH1D *     GetEmuPdf              (double Enu, double costheta, const TH3D* pdf3
 TVector3   GetDetectorVertex      (double CosTheta, double Enu);
 double     GetCrossSection        (int nu_code, double Enu, double Emu);
 double     ProbabilityEmu         (int nu_code, double Enu, double Emu);
+void       BuildMuELossTable      (void);
 
 // User-specified options:
 //
@@ -159,14 +170,16 @@ int             gOptNev = -1;                  // exposure - in terms of number
 double          gOptDetectorSide;              // detector side length, in mm.
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
+string          gOptRockComposition;           // rock composition (material[weight],...)
+string          gOptMuELossTableFile;          // muon energy loss tables cache file
 
-// Constants
-const double a = 2e+6;           // a = 2 MeV / (g cm-2)
-const double e = 500e+9;         // e = 500 GeV
+// Muon energy loss and range tables for the rock composition
+MuELossTable    gMuELossTable;
 
 // Defaults:
 //
 double kDefOptDetectorSide = 1e+5;     // side length of detector, 100m (in mm)
+string kDefOptRockComposition = "standardrock[1]";
 
 //________________________________________________________________________________________
 int main(int argc, char** argv)
@@ -185,6 +198,8 @@ int main(int argc, char** argv)
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, true);
 
+  // Muon energy loss & range tables for the requested rock composition
+  BuildMuELossTable();
 
   // Get requested flux driver
   GFluxI * flux_driver = GetFlux();
@@ -435,12 +450,89 @@ void GenerateUpNu(GFluxI * flux_driver)
 double ProbabilityEmu(int nu_code, double Enu, double Emu)
 {
 // Calculate the probability of an incoming neutrino of energy Enu
-// generating a muon of energy Emu.
+// generating a muon of energy Emu: the muons reaching the detector are
+// produced within their CSDA range in the rock (in g/cm^2).
   double dxsec_dxdy = GetCrossSection(nu_code,Enu,Emu);
-  double Int = e * constants::kNA * dxsec_dxdy / (a * (1 + Emu/e));
+  double range = gMuELossTable.Range(Emu) / (units::g/units::cm2);
+  double Int = constants::kNA * dxsec_dxdy * range;
   return Int;
 }
 //________________________________________________________________________________________
+void BuildMuELossTable(void)
+{
+// Set the rock composition and load or compute its energy loss & range tables
+
+  vector<string> materials = utils::str::Split(gOptRockComposition, ",");
+  vector<string>::const_iterator miter = materials.begin();
+  for( ; miter != materials.end(); ++miter) {
+     string material_and_weight = utils::str::TrimSpaces(*miter);
+     string::size_type open_bracket  = material_and_weight.find("[");
+     string::size_type close_bracket = material_and_weight.find("]");
+     if (open_bracket ==string::npos ||
+         close_bracket==string::npos ||
+         close_bracket < open_bracket)
+     {
+         LOG("gevgen_upmu", pFATAL)
+            << "You made an error in specifying the rock composition: "
+            << material_and_weight;
+         PrintSyntax();
+         gAbortingInErr = true;
+         exit(1);
+     }
+     string name   = material_and_weight.substr(0,open_bracket);
+     double weight = atof(material_and_weight.substr(
+                        open_bracket+1,close_bracket-open_bracket-1).c_str());
+
+     // match the material name (case-insensitive, spaces removed) or id
+     string key;
+     for(string::size_type i=0; i<name.size(); i++) {
+        if(name[i] != ' ') key += tolower(name[i]);
+     }
+     MuELMaterial_t material = eMuUndefined;
+     int id = atoi(key.c_str());
+     for(int im = 0; im < 2 && material == eMuUndefined; im++) {
+        int first = (im==0) ? eMuHydrogen : eMuBariumFluoride;
+        int last  = (im==0) ? eMuUranium  : eMuWater;
+        for(int m = first; m <= last; m++) {
+           string mname = MuELMaterial::AsString((MuELMaterial_t) m);
+           string mkey;
+           for(string::size_type i=0; i<mname.size(); i++) {
+              if(mname[i] != ' ') mkey += tolower(mname[i]);
+           }
+           if(mkey == key || m == id) { material = (MuELMaterial_t) m; break; }
+        }
+     }
+     if(material == eMuUndefined || weight <= 0) {
+         LOG("gevgen_upmu", pFATAL)
+            << "Unknown rock material or invalid weight fraction: "
+            << material_and_weight;
+         PrintSyntax();
+         gAbortingInErr = true;
+         exit(1);
+     }
+     gMuELossTable.AddMaterial(material, weight);
+  }
+
+  bool loaded = false;
+  if(gOptMuELossTableFile.size() > 0) {
+     loaded = gMuELossTable.Load(gOptMuELossTableFile);
+  }
+  if(!loaded) {
+     if(!gMuELossTable.Build()) {
+        LOG("gevgen_upmu", pFATAL)
+           << "Couldn't compute the muon energy loss tables for: "
+           << gOptRockComposition;
+        gAbortingInErr = true;
+        exit(1);
+     }
+     if(gOptMuELossTableFile.size() > 0) {
+        gMuELossTable.Save(gOptMuELossTableFile);
+     }
+  }
+
+  LOG("gevgen_upmu", pNOTICE) << gMuELossTable;
+}
+//________________________________________________________________________________________
 TH3D* BuildEmuEnuCosThetaPdf(int nu_code)
 {
 // Set up a 3D histogram, with axes Emu, Enu, CosTheta.
@@ -801,6 +893,26 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  //
+  // *** rock composition
+  //
+  if( parser.OptionExists('g') ) {
+    LOG("gevgen_upmu", pINFO) << "Reading rock composition";
+    gOptRockComposition = parser.ArgAsString('g');
+  } else {
+    LOG("gevgen_upmu", pINFO) << "Unspecified rock composition - Using default";
+    gOptRockComposition = kDefOptRockComposition;
+  }
+
+  //
+  // *** muon energy loss tables cache
+  //
+  if( parser.OptionExists("mueloss-table") ) {
+    LOG("gevgen_upmu", pINFO) << "Reading muon energy loss tables file";
+    gOptMuELossTableFile = parser.ArgAsString("mueloss-table");
+  } else {
+    gOptMuELossTableFile = "";
+  }
 
   //
   // print-out summary
@@ -833,6 +945,7 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n @@ Run number: " << gOptRunNu
      << "\n @@ Random number seed: " << gOptRanSeed
      << "\n @@ Using cross-section file: " << gOptInpXSecFile
+     << "\n @@ Rock composition: " << gOptRockComposition
      << "\n @@ Flux"
      << "\n\t" << fluxinfo.str()
      << "\n @@ Exposure"
@@ -849,6 +962,8 @@ void PrintSyntax(void)
    << "\n              -f simulation:flux_file[neutrino_code],..."
    << "\n              -n n_of_events,"
    << "\n             [-d detector side length (mm)]"
+   << "\n             [-g material[weight_fraction],...]"
+   << "\n             [--mueloss-table root_file]"
    << "\n             [--seed random_number_seed]"
    << "\n              --cross-sections xml_file"
    << "\n            [--message-thresholds xml_file]"
@@ -22,13 +22,20 @@
    Use the GetXMLFilePath() to search the potential XML config file locations
    and return the first actual file that can be found. Adapt code to use the
    utils::xml namespace.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Optional binary snapshot of the XML configuration contents ($GCONFSNAPSHOT),
+   read instead of parsing the XML files if none of them has changed.
 */
 //____________________________________________________________________________
 
 #include <iomanip>
 #include <iostream>
+#include <fstream>
 #include <sstream>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <stdint.h>
 
 #include "libxml/xmlmemory.h"
 #include "libxml/parser.h"
@@ -45,6 +52,8 @@
 #include "Framework/Utils/XmlParserUtils.h"
 
 #include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/InitTimingStats.h"
+#include "Framework/Utils/MemoryStats.h"
 
 using std::setw;
 using std::setfill;
@@ -53,6 +62,59 @@ using std::ostringstream;
 
 using namespace genie;
 
+//____________________________________________________________________________
+namespace {
+
+  //! configuration snapshot file header
+  struct AlgConfSnapshotHeader
+  {
+    char     signature[8];  //!< kAlgConfSnapshotSignature
+    uint32_t version;       //!< kAlgConfSnapshotVersion
+    uint32_t byteOrder;     //!< kAlgConfSnapshotOrder
+    uint64_t size;          //!< of the contents following the header
+    uint64_t checksum;      //!< of the contents
+  };
+
+  const char     kAlgConfSnapshotSignature[8] = {'G','A','L','G','C','O','N','F'};
+  const uint32_t kAlgConfSnapshotVersion      = 1;
+  const uint32_t kAlgConfSnapshotOrder        = 0x01020304;
+
+  // 64-bit FNV-1a hash
+  uint64_t AlgConfHash(const char * data, size_t n)
+  {
+    uint64_t h = 14695981039346656037ULL;
+    for(size_t i = 0; i < n; i++) {
+      h ^= (unsigned char) data[i];
+      h *= 1099511628211ULL;
+    }
+    return h;
+  }
+
+  void PutInt(string & buf, int64_t v)
+  {
+    buf.append((const char *) &v, sizeof(v));
+  }
+  void PutString(string & buf, const string & s)
+  {
+    PutInt(buf, s.size());
+    buf.append(s);
+  }
+  bool GetInt(const char * & p, const char * end, int64_t & v)
+  {
+    if(end - p < (long) sizeof(v)) return false;
+    std::memcpy(&v, p, sizeof(v));
+    p += sizeof(v);
+    return true;
+  }
+  bool GetString(const char * & p, const char * end, string & s)
+  {
+    int64_t n = 0;
+    if(!GetInt(p, end, n) || n < 0 || end - p < n) return false;
+    s.assign(p, n);
+    p += n;
+    return true;
+  }
+}
 //____________________________________________________________________________
 namespace genie {
   ostream & operator<<(ostream & stream, const AlgConfigPool & config_pool)
@@ -64,7 +126,8 @@ namespace genie {
 //____________________________________________________________________________
 AlgConfigPool * AlgConfigPool::fInstance = 0;
 //____________________________________________________________________________
-AlgConfigPool::AlgConfigPool()
+AlgConfigPool::AlgConfigPool() :
+fRecordSnapshot(false)
 {
   if( ! this->LoadAlgConfig() )
   LOG("AlgConfigPool", pERROR) << "Could not load XML config file";
@@ -100,13 +163,56 @@ AlgConfigPool::~AlgConfigPool()
 AlgConfigPool * AlgConfigPool::Instance()
 {
   if(fInstance == 0) {
+    InitTimingScope timing("AlgConfigPool::Instance");
     static AlgConfigPool::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
     fInstance = new AlgConfigPool;
+    MemoryStats::Instance()->Register("AlgConfigPool", AlgConfigPool::ReportMemory);
   }
   return fInstance;
 }
 //____________________________________________________________________________
+void AlgConfigPool::ReportMemory(MemoryStats & stats)
+{
+// Report the memory held by the configuration registries (see MemoryStats).
+// The size of an item is estimated as that of a string item, the largest of
+// the basic types.
+
+  if(fInstance == 0) return;
+
+  const double node = 3 * sizeof(void *) + sizeof(int); // map node overhead
+
+  long int nitems = 0;
+  double   bytes  = 0, ibytes = 0;
+  map<string, Registry *>::const_iterator it = fInstance->fRegistryPool.begin();
+  for( ; it != fInstance->fRegistryPool.end(); ++it) {
+    bytes += node + sizeof(map<string, Registry *>::value_type) + it->first.capacity();
+    if(!it->second) continue;
+    bytes += sizeof(Registry);
+    const RgIMap & items = it->second->GetItemMap();
+    RgIMapConstIter r_iter = items.begin();
+    for( ; r_iter != items.end(); ++r_iter) {
+      nitems++;
+      ibytes += node + sizeof(RgIMapPair) + r_iter->first.capacity() +
+                sizeof(RegistryItem<RgStr>);
+    }
+  }
+  stats.Add("AlgConfigPool", "registries",
+            bytes, (long int) fInstance->fRegistryPool.size());
+  stats.Add("AlgConfigPool", "registry items", ibytes, nitems);
+
+  bytes = 0;
+  for(unsigned int i = 0; i < fInstance->fSnapshotSets.size(); i++) {
+    const ParamSetRecord & rec = fInstance->fSnapshotSets[i];
+    bytes += sizeof(ParamSetRecord) + rec.key.capacity() + rec.name.capacity();
+    for(unsigned int j = 0; j < rec.params.size(); j++) {
+      bytes += sizeof(string) + rec.params[j].capacity();
+    }
+  }
+  stats.Add("AlgConfigPool", "configuration snapshot records",
+            bytes, (long int) fInstance->fSnapshotSets.size());
+}
+//____________________________________________________________________________
 bool AlgConfigPool::LoadAlgConfig(void)
 {
 // Loads all algorithm XML configurations and creates a map with all loaded
@@ -115,6 +221,11 @@ bool AlgConfigPool::LoadAlgConfig(void)
   SLOG("AlgConfigPool", pINFO)
         << "AlgConfigPool late initialization: Loading all XML config. files";
 
+  //-- read the configuration snapshot, if any is valid
+  string snapshot = this->SnapshotFileName();
+  if(snapshot.size() > 0 && this->LoadSnapshot(snapshot)) return true;
+  fRecordSnapshot = (snapshot.size() > 0);
+
   //-- read the global parameter lists
   if(!this->LoadGlobalParamLists()) return false;
 
@@ -147,12 +258,21 @@ bool AlgConfigPool::LoadAlgConfig(void)
     string full_path = utils::xml::GetXMLFilePath(file_name);
     SLOG("AlgConfigPool", pNOTICE)
       << "*** GENIE XML config file " << full_path;
+    this->AddSnapshotSource(file_name, full_path);
     bool ok = this->LoadSingleAlgConfig(alg_name, full_path);
     if(!ok) {
       SLOG("AlgConfigPool", pERROR)
            << "Error in loading config sets for algorithm = " << alg_name;
     }
   }
+
+  //-- save the configuration snapshot for the next jobs
+  if(fRecordSnapshot) {
+    this->SaveSnapshot(snapshot);
+    fRecordSnapshot = false;
+    fSnapshotSets.clear();
+    fSnapshotSources.clear();
+  }
   return true;
 };
 //____________________________________________________________________________
@@ -163,6 +283,7 @@ bool AlgConfigPool::LoadMasterConfig(void)
 
   //-- get the master config XML file using GXMLPATH + default locations
   fMasterConfig = utils::xml::GetXMLFilePath("master_config.xml");
+  this->AddSnapshotSource("master_config.xml", fMasterConfig);
 
   bool is_accessible = ! (gSystem->AccessPathName( fMasterConfig.c_str() ));
   if (!is_accessible) {
@@ -224,6 +345,7 @@ bool AlgConfigPool::LoadGlobalParamLists(void)
 
   // -- get the user config XML file using GXMLPATH + default locations
   string glob_params = utils::xml::GetXMLFilePath("ModelConfiguration.xml");
+  this->AddSnapshotSource("ModelConfiguration.xml", glob_params);
 
   // fixed key prefix
   string key_prefix = "GlobalParameterList";
@@ -240,6 +362,7 @@ bool AlgConfigPool::LoadCommonParamLists(void)
 
   // -- get the user config XML file using GXMLPATH + default locations
   string glob_params = utils::xml::GetXMLFilePath("CommonParameters.xml");
+  this->AddSnapshotSource("CommonParameters.xml", glob_params);
 
   // fixed key prefix
   string key_prefix = "CommonParameterList";
@@ -256,6 +379,7 @@ bool AlgConfigPool::LoadTuneGeneratorList(void)
 
   // -- get the user config XML file using GXMLPATH + default locations
   string generator_list_file = utils::xml::GetXMLFilePath("TuneGeneratorList.xml");
+  this->AddSnapshotSource("TuneGeneratorList.xml", generator_list_file);
 
   // fixed key prefix
   string key_prefix = "TuneGeneratorList";
@@ -333,6 +457,14 @@ bool AlgConfigPool::LoadRegistries(
       // create a new Registry and fill it with the configuration params
       Registry * config = new Registry(param_set,false);
 
+      ParamSetRecord * record = 0;
+      if(fRecordSnapshot) {
+        fSnapshotSets.push_back(ParamSetRecord());
+        record = &fSnapshotSets.back();
+        record->key  = key.str();
+        record->name = param_set;
+      }
+
       xmlNodePtr xml_param = xml_cur->xmlChildrenNode;
       while (xml_param != NULL) {
         if( (!xmlStrcmp(xml_param->name, (const xmlChar *) "param")) ) {
@@ -349,6 +481,11 @@ bool AlgConfigPool::LoadRegistries(
                                  xml_doc, xml_param->xmlChildrenNode, 1));
             this->AddConfigParameter(
                              config, param_type, param_name, param_value);
+            if(record) {
+              record->params.push_back(param_type);
+              record->params.push_back(param_name);
+              record->params.push_back(param_value);
+            }
         }
         xml_param = xml_param->next;
       }
@@ -372,6 +509,223 @@ bool AlgConfigPool::LoadRegistries(
   return true;
 }
 //____________________________________________________________________________
+void AlgConfigPool::AddSnapshotSource(string basename, string file_name)
+{
+// Records an XML file read (or looked for) while loading the configuration,
+// for validating the snapshot built from it
+
+  if(!fRecordSnapshot) return;
+
+  SourceRecord source;
+  source.basename = basename;
+  source.path     = file_name;
+  source.size     = -1;
+  source.modtime  = 0;
+
+  Long_t id, flags, modtime;
+  Long64_t size;
+  if(gSystem->GetPathInfo(file_name.c_str(), &id, &size, &flags, &modtime) == 0) {
+    source.size    = size;
+    source.modtime = modtime;
+  }
+  fSnapshotSources.push_back(source);
+}
+//____________________________________________________________________________
+string AlgConfigPool::SnapshotFileName(void) const
+{
+// The configuration snapshot file for the current XML search path, in the
+// $GCONFSNAPSHOT directory ("" if it is not set)
+
+  const char * dir = std::getenv("GCONFSNAPSHOT");
+  if(!dir) return "";
+
+  string pathlist = utils::xml::GetXMLPathList();
+
+  ostringstream name;
+  name << dir << "/algconf_" << std::hex
+       << AlgConfHash(pathlist.c_str(), pathlist.size()) << ".bin";
+  return name.str();
+}
+//____________________________________________________________________________
+bool AlgConfigPool::LoadSnapshot(string filename)
+{
+// Loads the configuration from the snapshot file, if it is valid: checksum
+// and search path match and every XML file resolves to the same, unchanged
+// file. Nothing is loaded otherwise.
+
+  std::ifstream binary(filename.c_str(), std::ios::binary);
+  if(!binary.is_open()) return false;
+
+  AlgConfSnapshotHeader header;
+  binary.read((char*) &header, sizeof(header));
+  if(!binary ||
+     std::memcmp(header.signature, kAlgConfSnapshotSignature, 8) != 0 ||
+     header.version   != kAlgConfSnapshotVersion ||
+     header.byteOrder != kAlgConfSnapshotOrder)
+  {
+    SLOG("AlgConfigPool", pWARN)
+      << filename << " is not a configuration snapshot - Ignoring it";
+    return false;
+  }
+
+  string contents(header.size, '\0');
+  if(header.size > 0) binary.read(&contents[0], header.size);
+  if(!binary || AlgConfHash(contents.data(), contents.size()) != header.checksum) {
+    SLOG("AlgConfigPool", pWARN)
+      << "Configuration snapshot " << filename << " is corrupted - Ignoring it";
+    return false;
+  }
+
+  const char * p   = contents.data();
+  const char * end = p + contents.size();
+
+  string  pathlist, master;
+  int64_t n = 0;
+  bool ok = GetString(p, end, pathlist) && GetString(p, end, master) &&
+            GetInt(p, end, n);
+  if(!ok || pathlist != utils::xml::GetXMLPathList()) {
+    SLOG("AlgConfigPool", pNOTICE)
+      << "Configuration snapshot " << filename
+      << " is for another XML search path - Ignoring it";
+    return false;
+  }
+
+  // the XML files the snapshot was built from
+  for(int64_t i = 0; ok && i < n; i++) {
+    string  basename, path;
+    int64_t size = 0, modtime = 0;
+    ok = GetString(p, end, basename) && GetString(p, end, path) &&
+         GetInt(p, end, size) && GetInt(p, end, modtime);
+    if(!ok) break;
+
+    Long_t id, flags, mt = 0;
+    Long64_t sz = -1;
+    if(gSystem->GetPathInfo(path.c_str(), &id, &sz, &flags, &mt) != 0) sz = -1;
+    if(size < 0) mt = 0;
+
+    if(utils::xml::GetXMLFilePath(basename) != path || sz != size || mt != modtime) {
+      SLOG("AlgConfigPool", pNOTICE)
+        << "XML file " << basename << " has changed since configuration snapshot "
+        << filename << " was saved - Ignoring it";
+      return false;
+    }
+  }
+
+  // the algorithm -> XML file map
+  map<string, string> config_files;
+  if(ok) ok = GetInt(p, end, n);
+  for(int64_t i = 0; ok && i < n; i++) {
+    string alg_name, file_name;
+    ok = GetString(p, end, alg_name) && GetString(p, end, file_name);
+    if(ok) config_files.insert(pair<string, string>(alg_name, file_name));
+  }
+
+  // the parameter sets
+  vector<ParamSetRecord> sets;
+  if(ok) ok = GetInt(p, end, n);
+  for(int64_t i = 0; ok && i < n; i++) {
+    sets.push_back(ParamSetRecord());
+    ParamSetRecord & record = sets.back();
+    int64_t np = 0;
+    ok = GetString(p, end, record.key) && GetString(p, end, record.name) &&
+         GetInt(p, end, np);
+    for(int64_t ip = 0; ok && ip < np; ip++) {
+      string item;
+      ok = GetString(p, end, item);
+      record.params.push_back(item);
+    }
+    if(ok) ok = (record.params.size() % 3 == 0);
+  }
+  if(!ok || p != end) {
+    SLOG("AlgConfigPool", pWARN)
+      << "Configuration snapshot " << filename << " is corrupted - Ignoring it";
+    return false;
+  }
+
+  fMasterConfig = master;
+  fConfigFiles  = config_files;
+
+  vector<ParamSetRecord>::const_iterator siter = sets.begin();
+  for( ; siter != sets.end(); ++siter) {
+    fConfigKeyList.push_back(siter->key);
+    Registry * config = new Registry(siter->name,false);
+    for(unsigned int ip = 0; ip < siter->params.size(); ip += 3) {
+      this->AddConfigParameter(config,
+         siter->params[ip], siter->params[ip+1], siter->params[ip+2]);
+    }
+    config->SetName(siter->name);
+    config->Lock();
+    fRegistryPool.insert(pair<string, Registry *>(siter->key, config));
+  }
+
+  SLOG("AlgConfigPool", pNOTICE)
+    << "Loaded " << sets.size() << " configuration sets from snapshot " << filename;
+  return true;
+}
+//____________________________________________________________________________
+bool AlgConfigPool::SaveSnapshot(string filename) const
+{
+  string contents;
+  PutString(contents, utils::xml::GetXMLPathList());
+  PutString(contents, fMasterConfig);
+
+  PutInt(contents, fSnapshotSources.size());
+  vector<SourceRecord>::const_iterator src = fSnapshotSources.begin();
+  for( ; src != fSnapshotSources.end(); ++src) {
+    PutString(contents, src->basename);
+    PutString(contents, src->path);
+    PutInt   (contents, src->size);
+    PutInt   (contents, (src->size < 0) ? 0 : src->modtime);
+  }
+
+  PutInt(contents, fConfigFiles.size());
+  map<string, string>::const_iterator fiter = fConfigFiles.begin();
+  for( ; fiter != fConfigFiles.end(); ++fiter) {
+    PutString(contents, fiter->first);
+    PutString(contents, fiter->second);
+  }
+
+  PutInt(contents, fSnapshotSets.size());
+  vector<ParamSetRecord>::const_iterator siter = fSnapshotSets.begin();
+  for( ; siter != fSnapshotSets.end(); ++siter) {
+    PutString(contents, siter->key);
+    PutString(contents, siter->name);
+    PutInt(contents, siter->params.size());
+    for(unsigned int ip = 0; ip < siter->params.size(); ip++) {
+      PutString(contents, siter->params[ip]);
+    }
+  }
+
+  AlgConfSnapshotHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.signature, kAlgConfSnapshotSignature, 8);
+  header.version   = kAlgConfSnapshotVersion;
+  header.byteOrder = kAlgConfSnapshotOrder;
+  header.size      = contents.size();
+  header.checksum  = AlgConfHash(contents.data(), contents.size());
+
+  // written to a temporary file which is then renamed, so that concurrent
+  // jobs never read a partially written snapshot
+  ostringstream tmpname;
+  tmpname << filename << ".tmp." << gSystem->GetPid();
+
+  std::ofstream binary(tmpname.str().c_str(), std::ios::binary);
+  binary.write((const char*) &header, sizeof(header));
+  binary.write(contents.data(), contents.size());
+  binary.close();
+
+  if(!binary || std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    SLOG("AlgConfigPool", pWARN)
+      << "Couldn't write configuration snapshot " << filename;
+    std::remove(tmpname.str().c_str());
+    return false;
+  }
+
+  SLOG("AlgConfigPool", pNOTICE)
+    << "Saved configuration snapshot to " << filename;
+  return true;
+}
+//____________________________________________________________________________
 void AlgConfigPool::AddConfigParameter(
                       Registry * r, string ptype, string pname, string pvalue)
 {
@@ -6,6 +6,13 @@
 \brief    A singleton class holding all configuration registries built while
           parsing all loaded XML configuration files. 
 
+          If $GCONFSNAPSHOT is set to a directory, the contents of the XML
+          files, as read, are saved there in a binary snapshot named after
+          the XML search path (which includes the tune directories). Later
+          jobs with the same search path read the snapshot instead of parsing
+          the XML files, provided its checksum is valid and every XML file
+          still resolves to the same path, size and modification time.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -36,6 +43,7 @@ using std::ostream;
 namespace genie {
 
 class AlgConfigPool;
+class MemoryStats;
 ostream & operator << (ostream & stream, const AlgConfigPool & cp);
 
 class AlgConfigPool {
@@ -73,10 +81,16 @@ private:
   bool   LoadTuneGeneratorList(void);
   bool   LoadSingleAlgConfig (string alg_name, string file_name);
   bool   LoadRegistries      (string key_base, string file_name, string root);
+  void   AddSnapshotSource   (string basename, string file_name);
+  string SnapshotFileName    (void) const;
+  bool   LoadSnapshot        (string filename);
+  bool   SaveSnapshot        (string filename) const;
   void   AddConfigParameter  (Registry * r, string pt, string pn, string pv);
   void   AddBasicParameter   (Registry * r, string pt, string pn, string pv);
   void   AddRootObjParameter (Registry * r, string pt, string pn, string pv);
 
+  static void ReportMemory   (MemoryStats & stats);
+
   static AlgConfigPool * fInstance;
 
   map<string, Registry *> fRegistryPool;  ///< algorithm/param_set -> Registry
@@ -84,6 +98,22 @@ private:
   vector<string>          fConfigKeyList; ///< list of all available configuration keys
   string                  fMasterConfig;  ///< lists config files for all algorithms
 
+  // XML contents as read, for the configuration snapshot
+  struct ParamSetRecord {
+    string         key;
+    string         name;
+    vector<string> params;     ///< type, name and value of each parameter
+  };
+  struct SourceRecord {
+    string    basename;
+    string    path;
+    long long size;            ///< -1 if the file was not found
+    long      modtime;
+  };
+  bool                   fRecordSnapshot;
+  vector<ParamSetRecord> fSnapshotSets;
+  vector<SourceRecord>   fSnapshotSources;
+
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
@@ -16,6 +16,9 @@
  @ Oct 20, 2009 - CA
    Added argument in ForceReconfiguration() to ignore algorithm opt-outs.
    Default is to respect opt-outs.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The library of an algorithm not linked to the application is loaded on
+   demand, see AlgPluginManager.
 */
 //____________________________________________________________________________
 
@@ -27,6 +30,7 @@
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgPluginManager.h"
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Messenger/Messenger.h"
 
@@ -164,10 +168,13 @@ Algorithm * AlgFactory::InstantiateAlgorithm(string name, string config) const
 //! Instantiate the requested object based on the registration of its TClass
 //! through the generated ROOT dictionaries
 //! The class of any object instantiated here must have a LinkDef entry.
+//! Its library is loaded first if needed (see AlgPluginManager).
 
   // Get object through ROOT's TROOT::GetClass() mechanism
   LOG("AlgFactory", pDEBUG) << "Instantiating algorithm = " << name;
 
+  AlgPluginManager::Instance()->LoadClass(name);
+
   TClass * tclass = gROOT->GetClass(name.c_str());
   if(!tclass) {
      LOG("AlgFactory", pERROR)
@@ -0,0 +1,173 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <fstream>
+#include <sstream>
+#include <mutex>
+
+#include <TSystem.h>
+#include <TClassTable.h>
+
+#include "Framework/Algorithm/AlgPluginManager.h"
+#include "Framework/Messenger/Messenger.h"
+
+using std::ifstream;
+using std::istringstream;
+
+using namespace genie;
+
+namespace {
+  std::mutex gAlgPluginLock;
+}
+//____________________________________________________________________________
+AlgPluginManager * AlgPluginManager::fInstance = 0;
+//____________________________________________________________________________
+AlgPluginManager::AlgPluginManager() :
+fHasManifest(false)
+{
+  fInstance = 0;
+  this->ReadManifest();
+}
+//____________________________________________________________________________
+AlgPluginManager::~AlgPluginManager()
+{
+  if(!fLoaded.empty()) {
+    LOG("AlgPlugins", pINFO)
+      << "Libraries loaded on demand: " << fLoaded.size();
+  }
+  fInstance = 0;
+}
+//____________________________________________________________________________
+AlgPluginManager * AlgPluginManager::Instance()
+{
+  if(fInstance) return fInstance;
+
+  std::lock_guard<std::mutex> guard(gAlgPluginLock);
+
+  if(fInstance == 0) {
+    static AlgPluginManager::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new AlgPluginManager;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+bool AlgPluginManager::LoadClass(string class_name)
+{
+  // linked or already loaded?
+  if(TClassTable::GetDict(class_name.c_str())) return true;
+
+  std::map<string, string>::const_iterator it = fClassLibrary.find(class_name);
+  if(it == fClassLibrary.end()) return false;
+
+  LOG("AlgPlugins", pINFO)
+    << "Class " << class_name << " needs library: " << it->second;
+
+  if(!this->LoadLibrary(it->second)) return false;
+  return (TClassTable::GetDict(class_name.c_str()) != 0);
+}
+//____________________________________________________________________________
+bool AlgPluginManager::LoadLibrary(string library)
+{
+  std::lock_guard<std::mutex> guard(gAlgPluginLock);
+
+  set<string> visiting;
+  return this->Load(library, visiting);
+}
+//____________________________________________________________________________
+bool AlgPluginManager::Load(string library, set<string> & visiting)
+{
+// Loads the dependencies first (depth-first; the packages including each
+// other's headers are loaded once)
+
+  if(fLoaded.count(library) > 0) return true;
+  if(fFailed.count(library) > 0) return false;
+  if(visiting.count(library) > 0) return true;
+  visiting.insert(library);
+
+  map<string, vector<string> >::const_iterator dit = fDependencies.find(library);
+  if(dit != fDependencies.end()) {
+    const vector<string> & deps = dit->second;
+    for(unsigned int i = 0; i < deps.size(); i++) {
+      if(!this->Load(deps[i], visiting)) {
+        LOG("AlgPlugins", pERROR)
+          << "Could not load library " << deps[i] << " needed by " << library;
+        fFailed.insert(library);
+        return false;
+      }
+    }
+  }
+
+  int status = gSystem->Load(library.c_str());
+  if(status < 0) {
+    LOG("AlgPlugins", pERROR)
+      << "Could not load library: " << library << " (status: " << status << ")";
+    fFailed.insert(library);
+    return false;
+  }
+  fLoaded.insert(library);
+
+  LOG("AlgPlugins", pNOTICE) << "Loaded library: " << library;
+  return true;
+}
+//____________________________________________________________________________
+string AlgPluginManager::Library(string class_name) const
+{
+  map<string, string>::const_iterator it = fClassLibrary.find(class_name);
+  return (it == fClassLibrary.end()) ? "" : it->second;
+}
+//____________________________________________________________________________
+void AlgPluginManager::ReadManifest(void)
+{
+  const char * file = gSystem->Getenv("GPLUGINMANIFEST");
+  if(file) {
+    fManifestFile = file;
+  } else {
+    const char * genie = gSystem->Getenv("GENIE");
+    if(!genie) return;
+    fManifestFile = string(genie) + "/lib/genie-plugins.manifest";
+  }
+
+  ifstream manifest(fManifestFile.c_str());
+  if(!manifest.is_open()) {
+    LOG("AlgPlugins", pINFO)
+      << "No plugin manifest (" << fManifestFile << ") - Libraries are "
+      << "expected to be linked to the application";
+    return;
+  }
+
+  string line;
+  while(std::getline(manifest, line)) {
+    if(line.empty() || line[0] == '#') continue;
+    istringstream fields(line);
+    string type, name, value;
+    fields >> type >> name;
+    if(type == "library") {
+      string package;
+      fields >> package;
+      vector<string> & deps = fDependencies[name];
+      while(fields >> value) deps.push_back(value);
+    }
+    else if(type == "class") {
+      fields >> value;
+      if(!value.empty()) fClassLibrary[name] = value;
+    }
+  }
+  fHasManifest = true;
+
+  LOG("AlgPlugins", pNOTICE)
+    << "Read plugin manifest " << fManifestFile << ": "
+    << fDependencies.size() << " libraries, "
+    << fClassLibrary.size() << " classes";
+}
+//____________________________________________________________________________
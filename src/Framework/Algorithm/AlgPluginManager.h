@@ -0,0 +1,105 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AlgPluginManager
+
+\brief    Loads the GENIE physics & tools libraries on demand: Before the
+          AlgFactory instantiates an algorithm whose class has no dictionary
+          yet (its library is not linked to the application nor loaded), the
+          library of the class and the libraries it depends on are loaded,
+          as listed in the plugin manifest.
+          Applications linked against the framework libraries only (see
+          `genie-config --libs-framework') then load just the packages used
+          by the chosen tune & event generator list, and the dictionaries of
+          the other packages are never registered.
+
+          The manifest is written at the end of the build by
+          genie-write-plugin-manifest ($GENIE/lib/genie-plugins.manifest; the
+          GPLUGINMANIFEST env. var. can point to another one). Without a
+          manifest, nothing is loaded here (ROOT's autoloading may still find
+          the library of a class from the package rootmap files).
+
+          The libraries are loaded from the thread configuring the drivers
+          (the AlgFactory is not meant to be used concurrently); the loading
+          itself is serialised.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _ALG_PLUGIN_MANAGER_H_
+#define _ALG_PLUGIN_MANAGER_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using std::map;
+using std::set;
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class AlgPluginManager {
+
+public:
+  static AlgPluginManager * Instance();
+
+  //! Make sure that the dictionary of the input class is available, loading
+  //! its library (& dependencies) if needed. Returns false if the class has
+  //! no dictionary and could not be provided by the manifest.
+  bool LoadClass (string class_name);
+
+  //! Load the input library (eg "libGPhQELXS") after the libraries it
+  //! depends on, as listed in the manifest
+  bool LoadLibrary (string library);
+
+  //! A manifest was read?
+  bool HasManifest (void) const { return fHasManifest; }
+
+  //! The library (from the manifest) of the input class ("" if unknown)
+  string Library (string class_name) const;
+
+  //! The libraries loaded so far by the plugin manager
+  const set<string> & LoadedLibraries (void) const { return fLoaded; }
+
+private:
+  AlgPluginManager();
+  AlgPluginManager(const AlgPluginManager & mgr);
+  virtual ~AlgPluginManager();
+
+  void ReadManifest (void);
+  bool Load         (string library, set<string> & visiting);
+
+  static AlgPluginManager * fInstance;
+
+  bool                          fHasManifest;   ///< a manifest was read?
+  string                        fManifestFile;  ///< the manifest read
+  map<string, string>           fClassLibrary;  ///< class -> library
+  map<string, vector<string> >  fDependencies;  ///< library -> libraries it depends on
+  set<string>                   fLoaded;        ///< libraries loaded so far
+  set<string>                   fFailed;        ///< libraries that could not be loaded
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (AlgPluginManager::fInstance !=0) {
+            delete AlgPluginManager::fInstance;
+            AlgPluginManager::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _ALG_PLUGIN_MANAGER_H_
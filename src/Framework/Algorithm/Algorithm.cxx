@@ -14,11 +14,17 @@
    Added fAllowReconfig private data member and AllowReconfig() method.
    Algorithms can set this method to opt-out of reconfiguration. Speeds up 
    reweighting if algorithms (that don't need to be reconfigured) opt out.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Memoise the GetParam look-ups until any algorithm is reconfigured.
+   AdoptSubstructure() reconfigures the algorithm so that the
+   sub-algorithms it caches are its own copies.
 */
 //____________________________________________________________________________
 
 #include <vector>
 #include <string>
+#include <atomic>
+#include <unordered_map>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/Algorithm.h"
@@ -33,6 +39,24 @@ using std::endl;
 using namespace genie;
 using namespace genie::utils;
 
+namespace {
+
+  //! the registries the GetParam keys were resolved to, for an algorithm
+  struct ParamMemo
+  {
+    unsigned long generation;
+    std::unordered_map<string, const Registry *> registries;
+  };
+
+  //! bumped whenever the configuration of any algorithm changes: a memo
+  //! can point to the registries of sub-algorithms, so it is only valid
+  //! while none of them is reconfigured either
+  std::atomic<unsigned long> gParamMemoGeneration(1);
+
+  //! algorithms are shared by the event generation threads
+  thread_local std::unordered_map<const Algorithm *, ParamMemo> gParamMemos;
+}
+
 //____________________________________________________________________________
 namespace genie
 {
@@ -65,6 +89,7 @@ Algorithm::~Algorithm()
 {
   this->DeleteConfig();
   this->DeleteSubstructure();
+  gParamMemos.erase(this);
 }
 //____________________________________________________________________________
 void Algorithm::Configure(const Registry & config)
@@ -414,6 +439,7 @@ void Algorithm::AdoptSubstructure(void)
 
   fOwnedSubAlgMp = new AlgMap;
   fOwnsSubstruc  = true;
+  this->ForgetParams();
 
   AlgFactory * algf = AlgFactory::Instance();
 
@@ -449,6 +475,11 @@ void Algorithm::AdoptSubstructure(void)
     fConfig = 0 ;
   }
 
+  // reconfigure, so that the sub-algorithms looked up at configuration (and
+  // cached by the concrete algorithms) are the adopted ones: the adopted
+  // sub-algorithms have already done the same for their own substructure
+  Registry config( this->GetConfig() );
+  this->Configure( config );
 }
 //____________________________________________________________________________
 void Algorithm::DeleteConfig(void)
@@ -457,6 +488,8 @@ void Algorithm::DeleteConfig(void)
   // rather looked up from the configuration pool
   //
   
+  this->ForgetParams();
+
   for ( unsigned int i = 0 ; i < fConfVect.size() ; ++i ) {
     if ( fOwnerships[i] ) {
       delete fConfVect[i] ;
@@ -483,6 +516,8 @@ void Algorithm::DeleteSubstructure(void)
   //
   if(!fOwnsSubstruc) return;
 
+  this->ForgetParams();
+
   // delete local algorithm pool
   //
   AlgMapIter iter = fOwnedSubAlgMp->begin();
@@ -569,6 +604,7 @@ int Algorithm::AddTopRegistry( Registry * rp, bool own ) {
 
   fConfVect.insert( fConfVect.begin(), rp ) ;
   fOwnerships.insert( fOwnerships.begin(), own ) ;
+  ForgetParams() ;
 
   if ( fConfig ) {
     delete fConfig ;
@@ -585,6 +621,7 @@ int Algorithm::AddLowRegistry( Registry * rp, bool own ) {
 
   fConfVect.push_back( rp ) ;
   fOwnerships.push_back( own ) ;
+  ForgetParams() ;
 
   if ( fConfig ) {
     delete fConfig ;
@@ -612,6 +649,7 @@ int  Algorithm::MergeTopRegistry( const Registry & r )  {
   if ( fOwnerships[0] ) {
 	//the top registry is owned: it can be changed with no consequences for other algorithms
     fConfVect[0] -> Merge( r ) ;
+    ForgetParams() ;
   }
   else {
 	// The top registry is not owned so it cannot be changed
@@ -638,6 +676,7 @@ int Algorithm::AddTopRegisties( const vector<Registry*> & rs, bool own ) {
   fConfVect.insert( fConfVect.begin(), rs.begin(), rs.end() ) ;
   
   fOwnerships.insert( fOwnerships.begin(), rs.size(), own ) ;
+  ForgetParams() ;
   
   if ( fConfig ) {
     delete fConfig ;
@@ -647,3 +686,37 @@ int Algorithm::AddTopRegisties( const vector<Registry*> & rs, bool own ) {
   return fConfVect.size() ;  
 
 }
+//____________________________________________________________________________
+bool Algorithm::FindParamMemo( const RgKey & name, const Registry * & rp ) const {
+
+  ParamMemo & memo = gParamMemos[this] ;
+  unsigned long generation = gParamMemoGeneration.load( std::memory_order_relaxed ) ;
+  if ( memo.generation != generation ) {
+    memo.registries.clear() ;
+    memo.generation = generation ;
+    return false ;
+  }
+
+  std::unordered_map<string, const Registry *>::const_iterator it = memo.registries.find( name ) ;
+  if ( it == memo.registries.end() ) return false ;
+
+  rp = it -> second ;
+  return true ;
+}
+//____________________________________________________________________________
+void Algorithm::SetParamMemo( const RgKey & name, const Registry * rp ) const {
+
+  ParamMemo & memo = gParamMemos[this] ;
+  unsigned long generation = gParamMemoGeneration.load( std::memory_order_relaxed ) ;
+  if ( memo.generation != generation ) {
+    memo.registries.clear() ;
+    memo.generation = generation ;
+  }
+  memo.registries[name] = rp ;
+}
+//____________________________________________________________________________
+void Algorithm::ForgetParams( void ) {
+
+  gParamMemoGeneration.fetch_add( 1, std::memory_order_relaxed ) ;
+}
+//____________________________________________________________________________
@@ -127,7 +127,9 @@ public:
   //! pools. Having a series of algorithms/configurations behaving as a
   //! monolithic block, with a single point of configuration (the top level)
   //! is to be used when bits & pieces of GENIE are used in isolation for
-  //! data fitting or reweighting
+  //! data fitting or reweighting, or to give each thread its own copy of
+  //! an algorithm tree. The algorithm is then reconfigured, so that it
+  //! uses the adopted sub-algorithms.
   void AdoptSubstructure (void);
 
   //! Print algorithm info
@@ -183,8 +185,20 @@ protected:
                                                             ///< Otherwise an owned copy is added as a top registry
   int   AddTopRegisties( const vector<Registry*> & rs, bool owns = false ) ; ///< Add registries with top priority, also udated Ownerships  
 
+  //! Memo of the GetParam look-ups: the registry each key was resolved to
+  //! (0 if the key was not found), kept per thread until any algorithm is
+  //! reconfigured. FindParamMemo returns false if the key is not memoised
+  bool  FindParamMemo( const RgKey & name, const Registry * & rp ) const ;
+  void  SetParamMemo ( const RgKey & name, const Registry * rp ) const ;
+  void  ForgetParams ( void ) ;                             ///< invalidate the memo of all the algorithms
+
 private:
 
+  //! GetParam look-up through the registries and the sub-algorithms,
+  //! memoising the result
+  template<class T>
+    bool ResolveParam( const RgKey & name, T & p ) const ;
+
   Registry *   fConfig;        ///< Summary configuration derived from fConvVect, not necessarily allocated
 
 };
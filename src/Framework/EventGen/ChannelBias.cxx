@@ -0,0 +1,187 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cstdio>
+#include <strings.h>
+#include <iomanip>
+#include <mutex>
+
+#include "Framework/EventGen/ChannelBias.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Interaction/ScatteringType.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+
+using std::endl;
+using std::setw;
+using std::setfill;
+using std::setprecision;
+
+using namespace genie;
+
+//____________________________________________________________________________
+ChannelBias * ChannelBias::fInstance = 0;
+
+// serializes access from multiple event generation threads
+static std::recursive_mutex gChannelBiasLock;
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const ChannelBias & bias)
+  {
+    bias.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+ChannelBias::ChannelBias()
+{
+
+}
+//____________________________________________________________________________
+ChannelBias::~ChannelBias()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+ChannelBias * ChannelBias::Instance()
+{
+  std::lock_guard<std::recursive_mutex> guard(gChannelBiasLock);
+
+  if(fInstance == 0) {
+    static ChannelBias::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new ChannelBias;
+    fInstance->Configure(RunOpt::Instance()->ChannelBias());
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void ChannelBias::Configure(string spec)
+{
+  std::lock_guard<std::recursive_mutex> guard(gChannelBiasLock);
+
+  fNames.clear();
+  fFactors.clear();
+
+  vector<string> entries = utils::str::Split(spec, ",");
+  for(unsigned int i = 0; i < entries.size(); i++) {
+    string entry = utils::str::TrimSpaces(entries[i]);
+    if(entry.size() == 0) continue;
+
+    vector<string> fields = utils::str::Split(entry, ":");
+    double factor = 0;
+    string name   = (fields.size() == 2) ?
+                       utils::str::TrimSpaces(fields[0]) : "";
+    bool ok = (fields.size() == 2) &&
+              (sscanf(fields[1].c_str(), "%lf", &factor) == 1) && (factor > 0);
+
+    // the channel must be a scattering type or charm
+    bool known = (strcasecmp(name.c_str(), "charm") == 0);
+    for(int isc = 0; isc < 100 && !known; isc++) {
+      string sc = ScatteringType::AsString((ScatteringType_t) isc);
+      known = (sc != "Unknown" && strcasecmp(name.c_str(), sc.c_str()) == 0);
+    }
+    if(!ok || !known) {
+      LOG("ChannelBias", pFATAL)
+        << "Invalid channel oversampling factor: " << entry
+        << " (expected channel:factor, with the channel a scattering type"
+        << " or charm, and factor > 0)";
+      exit(1);
+    }
+    fNames.push_back(name);
+    fFactors.push_back(factor);
+  }
+
+  this->Reset();
+
+  if(this->Enabled()) {
+    LOG("ChannelBias", pNOTICE)
+      << "Oversampling the " << spec << " channels"
+      << " (the events are weighted accordingly)";
+  }
+}
+//____________________________________________________________________________
+unsigned int ChannelBias::Channel(const Interaction * interaction) const
+{
+  string sc = ScatteringType::AsString(
+              interaction->ProcInfo().ScatteringTypeId());
+  bool charm = interaction->ExclTag().IsCharmEvent();
+
+  unsigned int nch = fNames.size();
+  for(unsigned int ich = 0; ich < nch; ich++) {
+    const char * name = fNames[ich].c_str();
+    if(strcasecmp(name, "charm") == 0) {
+      if(charm) return ich;
+    }
+    else if(strcasecmp(name, sc.c_str()) == 0) return ich;
+  }
+  return nch;
+}
+//____________________________________________________________________________
+double ChannelBias::Factor(const Interaction * interaction) const
+{
+  if(!interaction) return 1.;
+
+  unsigned int ich = this->Channel(interaction);
+  return (ich < fFactors.size()) ? fFactors[ich] : 1.;
+}
+//____________________________________________________________________________
+void ChannelBias::AddEvent(const Interaction * interaction, double weight)
+{
+  if(!interaction) return;
+
+  unsigned int ich = this->Channel(interaction);
+
+  std::lock_guard<std::recursive_mutex> guard(gChannelBiasLock);
+  fNEvents   [ich]++;
+  fSumWeights[ich] += weight;
+}
+//____________________________________________________________________________
+void ChannelBias::Reset(void)
+{
+  std::lock_guard<std::recursive_mutex> guard(gChannelBiasLock);
+
+  fNEvents.assign   (fNames.size() + 1, 0);
+  fSumWeights.assign(fNames.size() + 1, 0.);
+}
+//____________________________________________________________________________
+void ChannelBias::Print(ostream & stream, double exposure) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gChannelBiasLock);
+
+  stream << "Channel oversampling: " << fNames.size() << " biased channels";
+  if(exposure >= 0) stream << ", sample exposure: " << exposure;
+  stream << endl;
+
+  for(unsigned int ich = 0; ich <= fNames.size(); ich++) {
+    bool   biased = (ich < fNames.size());
+    long   n      = fNEvents[ich];
+    double sumw   = fSumWeights[ich];
+    // exposure of an unweighted sample with the same number of events
+    double scale  = (sumw > 0) ? n / sumw : 0.;
+    stream << " | " << setfill(' ') << setw(12)
+           << (biased ? fNames[ich] : string("other"))
+           << " | factor: " << setw(8) << (biased ? fFactors[ich] : 1.)
+           << " | events: " << setw(10) << n
+           << " | sum of weights: " << setprecision(6) << setw(12) << sumw;
+    if(exposure >= 0) {
+      stream << " | effective exposure: " << setw(12) << exposure * scale;
+    } else {
+      stream << " | effective exposure / exposure: " << setw(12) << scale;
+    }
+    stream << " |" << endl;
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,112 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ChannelBias
+
+\brief    Singleton holding the oversampling factors of rare interaction
+          channels (COH, DFR, NuEEL, IMD, charm, GLR, ...) and the statistics
+          needed to normalize the biased samples.
+          The PhysInteractionSelector selects each channel with a probability
+          proportional to factor * xsec rather than to xsec, and sets the
+          compensating event weight
+            w = Sum{factor_j * xsec_j} / (factor_i * Sum{xsec_j})
+          in GHepRecord::Weight(). The mean weight is 1, so the number of
+          generated events and the normalization (exposure) of the sample are
+          unchanged, while the biased channels are generated factor times
+          more often (with weights < 1).
+          For each biased channel (and the rest, unbiased, channels) it keeps
+          the number of generated events n and the sum of their weights. The
+          effective exposure of the channel (the exposure of an unweighted
+          sample with the same number of events of the channel) is
+          exposure * n / Sum{w}, printed by NtpMCJob at the end of the job.
+          The factors are read from the RunOpt --channel-bias option (eg
+          --channel-bias COH:10,DFR:10,charm:50), or set with Configure()
+          before generating the first event. The channels are named after the
+          scattering types (see ScatteringType::AsString, case insensitive),
+          or 'charm' for the charm production channels. An interaction in
+          more than one biased channel is given the factor of the first one.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _CHANNEL_BIAS_H_
+#define _CHANNEL_BIAS_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+using std::string;
+using std::vector;
+using std::ostream;
+
+namespace genie {
+
+class ChannelBias;
+class Interaction;
+
+ostream & operator << (ostream & stream, const ChannelBias & bias);
+
+class ChannelBias
+{
+public:
+  static ChannelBias * Instance(void);
+
+  //! is any channel biased?
+  bool Enabled (void) const { return fNames.size() > 0; }
+
+  //! set the oversampling factors from a comma separated list of
+  //! channel:factor pairs (an empty list switches the biasing off)
+  void Configure (string spec);
+
+  //! oversampling factor of the input interaction (1 if not biased)
+  double Factor (const Interaction * interaction) const;
+
+  //! record a generated event of the input interaction, with the weight
+  //! compensating for its biased selection
+  void AddEvent (const Interaction * interaction, double weight);
+
+  void Reset (void);
+  void Print (ostream & stream, double exposure = -1) const;
+
+  friend ostream & operator << (ostream & stream, const ChannelBias & bias);
+
+private:
+  ChannelBias();
+  ChannelBias(const ChannelBias & bias);
+  virtual ~ChannelBias();
+
+  //! biased channel of the input interaction (fNames.size() if none)
+  unsigned int Channel (const Interaction * interaction) const;
+
+  //! self
+  static ChannelBias * fInstance;
+
+  vector<string>   fNames;      ///< biased channels
+  vector<double>   fFactors;    ///< their oversampling factors
+  vector<long int> fNEvents;    ///< generated events (biased channels, then the rest)
+  vector<double>   fSumWeights; ///< sum of their weights
+
+  //! clean
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (ChannelBias::fInstance !=0) {
+            delete ChannelBias::fInstance;
+            ChannelBias::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _CHANNEL_BIAS_H_
@@ -0,0 +1,75 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <atomic>
+
+#include "Framework/EventGen/EventFilterI.h"
+
+using namespace genie;
+
+namespace {
+  // filter statistics, updated by the event generation threads
+  std::atomic<bool>     gEventFilterInUse(false);
+  std::atomic<long int> gEventFilterNTried(0);
+  std::atomic<long int> gEventFilterNAccepted(0);
+}
+//___________________________________________________________________________
+EventFilterI::EventFilterI() :
+Algorithm()
+{
+
+}
+//___________________________________________________________________________
+EventFilterI::EventFilterI(string name) :
+Algorithm(name)
+{
+
+}
+//___________________________________________________________________________
+EventFilterI::EventFilterI(string name, string config) :
+Algorithm(name, config)
+{
+
+}
+//___________________________________________________________________________
+EventFilterI::~EventFilterI()
+{
+
+}
+//___________________________________________________________________________
+bool EventFilterI::InUse(void)
+{
+  return gEventFilterInUse;
+}
+//___________________________________________________________________________
+void EventFilterI::SetInUse(void)
+{
+  gEventFilterInUse = true;
+}
+//___________________________________________________________________________
+void EventFilterI::CountEvent(bool accepted)
+{
+  gEventFilterNTried++;
+  if(accepted) gEventFilterNAccepted++;
+}
+//___________________________________________________________________________
+long int EventFilterI::NEventsTried(void)
+{
+  return gEventFilterNTried;
+}
+//___________________________________________________________________________
+long int EventFilterI::NEventsAccepted(void)
+{
+  return gEventFilterNAccepted;
+}
+//___________________________________________________________________________
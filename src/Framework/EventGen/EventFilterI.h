@@ -0,0 +1,67 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::EventFilterI
+
+\brief   Defines the EventFilterI interface to be implemented by algorithms
+         selecting the events to be kept (eg signal topologies) before they
+         are fully generated.
+
+         The filter named by the RunOpt --event-filter option (eg
+         --event-filter genie::PrimaryLeptonFilter/MuonAbove1GeV) is run by
+         each EventGenerator after the kinematics & primary lepton modules,
+         before the hadronic system generation, the intranuclear transport
+         and the decays. The rejected events skip the remaining modules and
+         are not returned by GEVGDriver (the drivers move on to the next
+         event, or flux neutrino, so the exposure of the written sample is
+         unchanged).
+
+         The number of filtered events and of accepted ones are kept (see
+         NEventsTried() and NEventsAccepted()) and are stored in the output
+         tree header, giving the accept fraction needed to normalize samples
+         by cross section.
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _EVENT_FILTER_I_H_
+#define _EVENT_FILTER_I_H_
+
+#include "Framework/Algorithm/Algorithm.h"
+
+namespace genie {
+
+class GHepRecord;
+
+class EventFilterI : public Algorithm {
+
+public :
+  virtual ~EventFilterI();
+
+  //!  Define the EventFilterI interface: keep the (partially generated) event?
+  virtual bool AcceptEvent (const GHepRecord * event) const = 0;
+
+  //!  Filter statistics of the job, over all threads (accepted or rejected
+  //!  events, not counting the unphysical ones being regenerated)
+  static bool     InUse           (void);
+  static void     SetInUse        (void);
+  static void     CountEvent      (bool accepted);
+  static long int NEventsTried    (void);
+  static long int NEventsAccepted (void);
+
+protected:
+  EventFilterI();
+  EventFilterI(string name);
+  EventFilterI(string name, string config);
+};
+
+}      // genie namespace
+
+#endif // _EVENT_FILTER_I_H_
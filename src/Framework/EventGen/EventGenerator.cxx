@@ -16,6 +16,20 @@
  @ Feb 01, 2013 - CA
    The GUNPHYSMASK env. var is no longer used. The bit-field mask is stored
    in the GHEP record and GHepRecord::Accept() is now checked.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The GHEP daughter-lists are compactified once at the end of each
+   processing step rather than after every offending particle insertion.
+   The processing modules are instantiated when the first event is processed.
+   Added the truncated chains of RunOpt --stop-after (kinematics or
+   hadronization), which skip the hadronization, FSI & decay modules.
+   Stepping back restores the record from the GHepRecordHistory journal.
+   Runs the event filter of RunOpt --event-filter before the hadronization &
+   FSI modules, the rejected events skipping them (see EventFilterI).
+   Forwards EventRecordVisitorI::ResolveAlgs() to the processing modules.
+   Each processing step draws from its own random number sub-streams when
+   common random numbers are used (see RandomGen::StartProcessingStep()).
+   Once the processing modules are loaded, LoadModules() no longer takes
+   the loading lock (double-checked flag).
 */
 //____________________________________________________________________________
 
@@ -23,6 +37,10 @@
 #include <sstream>
 #include <cstdlib>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
 
 #include <TMath.h>
 #include <TBits.h>
@@ -30,17 +48,24 @@
 #include <TStopwatch.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Conventions/Controls.h"
 #include "Framework/EventGen/EventGenerator.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
 #include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/EventGen/EventFilterI.h"
 #include "Framework/EventGen/GVldContext.h"
+#include "Framework/EventGen/ModuleTimingStats.h"
 #include "Framework/GHEP/GHepVirtualListFolder.h"
 #include "Framework/GHEP/GHepRecord.h"
+#include "Framework/GHEP/GHepRecordHistory.h"
 #include "Framework/GHEP/GHepFlags.h"
+#include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/RunOpt.h"
 
 using std::ostringstream;
 
@@ -49,6 +74,55 @@ using namespace genie::utils;
 using namespace genie::controls;
 using namespace genie::exceptions;
 
+namespace genie {
+  //! have the processing modules of an EventGenerator been loaded? Set once
+  //! the modules are loaded, so that the threads only take the loading lock
+  //! while the modules are not yet loaded (see EventGenerator::LoadModules())
+  struct EventGeneratorLoadState {
+    EventGeneratorLoadState() : loaded(false) { }
+    std::atomic<bool> loaded;
+  };
+}
+
+namespace {
+  //! serialises the (lazy) loading of the processing modules, which can be
+  //! requested by several event generation threads at once
+  std::mutex gModuleLoadMutex;
+
+  //! serialises the use of the (global) GHepVirtualListFolder
+  std::mutex gVirtualListMutex;
+
+  //! the state of the event being generated (record history & module
+  //! timing): kept per thread and generator, as an EventGenerator is shared
+  //! by the event generation threads unless they use private copies
+  struct EventState {
+    GHepRecordHistory history;
+    TStopwatch        watch;
+    vector<double>    time;
+  };
+  thread_local std::map<const EventGenerator *, EventState> gEventStates;
+
+  //! does the module (algorithm name) start the part of the chain that is
+  //! skipped, when the event generation stops after the input stage?
+  bool IsPastStage(const string & module, const string & stage)
+  {
+    if(stage != "kinematics" && stage != "hadronization") return false;
+
+    const char * fsi_modules[] = {
+      "UnstableParticleDecayer", "NucDeExcitationSim",
+      "HadronTransporter", "NucBindEnergyAggregator", 0
+    };
+    for(int i = 0; fsi_modules[i]; i++) {
+      if(module.find(fsi_modules[i]) != string::npos) return true;
+    }
+    if(stage == "kinematics") {
+      if(module.find("HadronicSystemGenerator") != string::npos) return true;
+      if(module.find("TargetRemnantGenerator")  != string::npos) return true;
+    }
+    return false;
+  }
+}
+
 //___________________________________________________________________________
 EventGenerator::EventGenerator() :
 EventGeneratorI("genie::EventGenerator")
@@ -64,12 +138,12 @@ EventGeneratorI("genie::EventGenerator", config)
 //___________________________________________________________________________
 EventGenerator::~EventGenerator()
 {
-  delete fWatch;
   delete fFiltUnphysMask;
 
   if(fEVGModuleVec) delete fEVGModuleVec;
-  if(fEVGTime)      delete fEVGTime;
   if(fVldContext)   delete fVldContext;
+
+  delete fLoadState;
 }
 //___________________________________________________________________________
 void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
@@ -78,19 +152,30 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
 
   //-- Clear previous virtual list folder
   LOG("EventGenerator", pNOTICE) << "Clearing the GHepVirtualListFolder";
-  GHepVirtualListFolder * vlfolder = GHepVirtualListFolder::Instance();
-  vlfolder->Clear();
+  {
+    std::lock_guard<std::mutex> lock(gVirtualListMutex);
+    GHepVirtualListFolder * vlfolder = GHepVirtualListFolder::Instance();
+    vlfolder->Clear();
+  }
+
+  //-- The calling thread's event state for this generator
+  EventState & state = gEventStates[this];
+  GHepRecordHistory & rec_history = state.history;
 
   //-- Clean previous history + add the bootstrap record in the buffer
-  fRecHistory.PurgeHistory();
-  fRecHistory.AddSnapshot(-1, event_rec);
+  rec_history.PurgeHistory();
+  rec_history.AddSnapshot(-1, event_rec);
 
   //-- Initialize evg thread control flags
   bool ffwd = false;
   unsigned int nexceptions = 0;
 
-  //-- Reset stop-watch
-  fWatch->Reset();
+  //-- Instantiate the processing modules on first use
+  this->LoadModules();
+
+  //-- Reset stop-watch & timing info
+  state.watch.Reset();
+  state.time.assign(fEVGModuleVec->size(), 0.);
 
   string mesgh = "Event generation thread: " + this->Id().Key() + 
                  " -> Running module: ";
@@ -104,6 +189,11 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
   {
     const EventRecordVisitorI * visitor = *miter; // generation module
 
+    // run the event filter before the hadronization & FSI steps
+    if(!ffwd && fFilter && (unsigned int)istep == fFilterStep) {
+      if(!this->FilterEvent(event_rec)) break;
+    }
+
     string mesg = mesgh + visitor->Id().Key();
     LOG("EventGenerator", pNOTICE)
                  << utils::print::PrintFramedMesg(mesg,0,'~');
@@ -112,16 +202,38 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
            << "Fast Forward flag was set - Skipping processing step!";
       continue;
     }
+    // optional per-module wall-clock timing (see ModuleTimingStats)
+    bool timing = ModuleTimingStats::IsEnabled();
+    std::chrono::steady_clock::time_point tstart;
+    if(timing) tstart = std::chrono::steady_clock::now();
+
+    // daughter-lists broken by the module's insertions are compactified
+    // once, at the end of the step (see GHepRecord::UpdateDaughterLists())
+    event_rec->SetDeferredCompactification(true);
+    event_rec->SetAppendOnlyInsertion(visitor->AddsDaughtersContiguously());
+
+    // with common random numbers, the step draws from its own sub-streams
+    RandomGen::Instance()->StartProcessingStep(visitor->Id().Name());
+
     try
     {
-      fWatch->Start();
+      state.watch.Start();
       visitor->ProcessEventRecord(event_rec);
-      fWatch->Stop();
-      fRecHistory.AddSnapshot(istep, event_rec);
-      (*fEVGTime)[istep] = fWatch->CpuTime(); // sec
+      this->EndProcessingStep(event_rec);
+      state.watch.Stop();
+      if(timing) this->AddModuleTime(visitor, event_rec,
+        std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - tstart).count());
+      rec_history.AddSnapshot(istep, event_rec);
+      state.time[istep] = state.watch.CpuTime(); // sec
     }
     catch (EVGThreadException exception)
     {
+      this->EndProcessingStep(event_rec);
+      if(timing) this->AddModuleTime(visitor, event_rec,
+        std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - tstart).count());
+
       LOG("EventGenerator", pNOTICE)
            << "An exception was thrown and caught by EventGenerator!";
       LOG("EventGenerator", pNOTICE) << exception;
@@ -174,17 +286,26 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
            // step we are about to return to
            LOG("EventGenerator", pNOTICE)
                   << "Restoring GHEP as it was just before the return step";
-           event_rec->ResetRecord();
            istep--;
-           GHepRecord * snapshot = fRecHistory[istep];
-           fRecHistory.PurgeRecentHistory(istep+1);
-           event_rec->Copy(*snapshot);
+           rec_history.PurgeRecentHistory(istep+1);
+           if(!rec_history.Restore(istep, event_rec)) {
+             LOG("EventGenerator", pFATAL)
+               << "No GHEP snapshot for processing step " << istep
+               << " (see GHEPHISTENABLE) - Can not step back";
+             exit(1);
+           }
          } // valid-return-step
       } // step-back
     } // catch exception
 
     istep++;
   }
+  // chains without a hadronization or FSI step are filtered at their end
+  if(miter == fEVGModuleVec->end() && !ffwd && fFilter &&
+     fFilterStep == fEVGModuleVec->size()) {
+    this->FilterEvent(event_rec);
+  }
+  event_rec->SetDeferredCompactification(false);
 
   LOG("EventGenerator", pNOTICE)
               << utils::print::PrintFramedMesg("Thread Summary",0,'*');
@@ -199,11 +320,103 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
 
     BLOG("EventGenerator", pINFO)
        << "module " << visitor->Id().Key() << " -> ~"
-                        << TMath::Max(0.,(*fEVGTime)[istep++]) << " s";
+                        << TMath::Max(0.,state.time[istep++]) << " s";
   }
   LOG("EventGenerator", pNOTICE) << "Done generating event!";
 }
 //___________________________________________________________________________
+void EventGenerator::AddModuleTime(const EventRecordVisitorI * visitor,
+                            const GHepRecord * event_rec, double time) const
+{
+  const Interaction * interaction = event_rec->Summary();
+  string process = (interaction) ?
+                   interaction->ProcInfo().AsString() : "unknown";
+
+  ModuleTimingStats::Instance()->Add(visitor->Id().Key(), process, time);
+}
+//___________________________________________________________________________
+void EventGenerator::EndProcessingStep(GHepRecord * event_rec) const
+{
+// Runs the daughter-list compactification deferred during the processing
+// step, so that the next module (and the stored snapshot) sees a compact
+// record. Note that within a step a module inserting daughters out of order
+// sees widened, not yet compact, daughter-lists.
+// Also ends the random number sub-streams of the step (if any).
+
+  RandomGen::Instance()->EndProcessingStep();
+
+  event_rec->SetAppendOnlyInsertion(false);
+  if(event_rec->NeedsCompactification()) {
+    event_rec->CompactifyDaughterLists();
+  }
+}
+//___________________________________________________________________________
+bool EventGenerator::FilterEvent(GHepRecord * event_rec) const
+{
+// Asks the event filter whether the (partially generated) event is kept and
+// flags the rejected ones, see GHepRecord::FilteredOut()
+
+  bool accept = fFilter->AcceptEvent(event_rec);
+  if(!accept) {
+    LOG("EventGenerator", pNOTICE)
+      << "The event was rejected by " << fFilter->Id().Key()
+      << " - Skipping the remaining processing steps";
+    event_rec->SetFilteredOut(true);
+  }
+  return accept;
+}
+//___________________________________________________________________________
+const EventRecordVisitorI * EventGenerator::MaxXSecModule(void) const
+{
+  if(!fEVGModuleVec) return 0;
+  this->LoadModules();
+
+  vector<const EventRecordVisitorI *>::const_iterator miter;
+  for(miter = fEVGModuleVec->begin(); miter != fEVGModuleVec->end(); ++miter) {
+    if((*miter)->CachesMaxXSec()) return *miter;
+  }
+  return 0;
+}
+//___________________________________________________________________________
+bool EventGenerator::CachesMaxXSec(void) const
+{
+  return (this->MaxXSecModule() != 0);
+}
+//___________________________________________________________________________
+bool EventGenerator::LoadMaxXSecEnvelope(
+                  const Interaction * in, double Emin, double Emax) const
+{
+  const EventRecordVisitorI * module = this->MaxXSecModule();
+  if(!module) return false;
+  return module->LoadMaxXSecEnvelope(in, Emin, Emax);
+}
+//___________________________________________________________________________
+double EventGenerator::MaxXSecAt(const Interaction * in, double E) const
+{
+  const EventRecordVisitorI * module = this->MaxXSecModule();
+  if(!module) return -1;
+  return module->MaxXSecAt(in, E);
+}
+//___________________________________________________________________________
+void EventGenerator::SetMaxXSecEnvelope(const Interaction * in,
+       const vector<double> & E, const vector<double> & xsec) const
+{
+  const EventRecordVisitorI * module = this->MaxXSecModule();
+  if(!module) return;
+  module->SetMaxXSecEnvelope(in, E, xsec);
+}
+//___________________________________________________________________________
+void EventGenerator::ResolveAlgs(const Interaction * in, ResolvedAlgs & algs) const
+{
+  if(!fEVGModuleVec) return;
+  this->LoadModules();
+
+  vector<const EventRecordVisitorI *>::const_iterator miter;
+  for(miter = fEVGModuleVec->begin(); miter != fEVGModuleVec->end(); ++miter) {
+    (*miter)->ResolveAlgs(in, algs);
+  }
+}
+//___________________________________________________________________________
 const InteractionListGeneratorI * EventGenerator::IntListGenerator(void) const
 {
   return fIntListGen;
@@ -236,12 +449,13 @@ const GVldContext & EventGenerator::ValidityContext(void) const
 //___________________________________________________________________________
 void EventGenerator::Init(void)
 {
-  fWatch        = new TStopwatch;
   fVldContext   = 0;
   fEVGModuleVec = 0;
-  fEVGTime      = 0;
   fXSecModel    = 0;
   fIntListGen   = 0;
+  fLoadState     = new EventGeneratorLoadState;
+  fFilter        = 0;
+  fFilterStep    = 0;
 
   fFiltUnphysMask = new TBits(GHepFlags::NFlags());
   fFiltUnphysMask->ResetAllBits(false);
@@ -264,8 +478,9 @@ void EventGenerator::Init(void)
 //___________________________________________________________________________
 void EventGenerator::LoadConfig(void)
 {
+  std::lock_guard<std::mutex> lock(gModuleLoadMutex);
+
   if(fEVGModuleVec) delete fEVGModuleVec;
-  if(fEVGTime)      delete fEVGTime;
   if(fVldContext)   delete fVldContext;
 
   LOG("EventGenerator", pDEBUG) << "Loading the generator validity context";
@@ -275,7 +490,7 @@ void EventGenerator::LoadConfig(void)
   fVldContext = new GVldContext;
   fVldContext->Decode( encoded_vld_context );
 
-  LOG("EventGenerator", pDEBUG) << "Loading the event generation modules";
+  LOG("EventGenerator", pDEBUG) << "Checking the event generation modules";
 
   int nsteps ;
   GetParam("NModules", nsteps) ;
@@ -285,8 +500,9 @@ void EventGenerator::LoadConfig(void)
   }
   assert(nsteps>0);
 
-  fEVGModuleVec = new vector<const EventRecordVisitorI *> (nsteps);
-  fEVGTime      = new vector<double>(nsteps);
+  // the modules themselves are instantiated on first use (LoadModules())
+  fEVGModuleVec  = new vector<const EventRecordVisitorI *> (nsteps);
+  fLoadState->loaded.store(false);
 
   for(int istep = 0; istep < nsteps; istep++) {
 
@@ -298,13 +514,7 @@ void EventGenerator::LoadConfig(void)
     GetParam( key, temp_alg ) ;
 
     SLOG("EventGenerator", pINFO)
-        << " -- Loading module " << istep << " : " << temp_alg ;
-
-    const EventRecordVisitorI * visitor =
-               dynamic_cast<const EventRecordVisitorI *>(this->SubAlg(key));
-
-    (*fEVGModuleVec)[istep] = visitor;
-    (*fEVGTime)[istep]      = 0;
+        << " -- Module " << istep << " : " << temp_alg ;
   }
 
   //-- load the interaction list generator
@@ -329,5 +539,89 @@ void EventGenerator::LoadConfig(void)
   assert(fXSecModel);
 }
 //___________________________________________________________________________
+void EventGenerator::LoadModules(void) const
+{
+// Instantiates (or gets from AlgFactory's pool) the processing modules, the
+// first time they are needed
+
+  if(fLoadState->loaded.load(std::memory_order_acquire)) return;
+
+  std::lock_guard<std::mutex> lock(gModuleLoadMutex);
+  if(fLoadState->loaded.load(std::memory_order_relaxed)) return;
+
+  LOG("EventGenerator", pINFO)
+     << "Loading the event generation modules of " << this->Id().Key();
+
+  // truncate the chain before the first module of the skipped stages, which
+  // are then never instantiated
+  string stage = RunOpt::Instance()->StopAfter();
+  if(stage.size() > 0) {
+    unsigned int nsteps = fEVGModuleVec->size();
+    for(unsigned int istep = 0; istep < nsteps; istep++) {
+      ostringstream keystream;
+      keystream << "Module-" << istep;
+      RgAlg alg;
+      GetParam(keystream.str(), alg);
+      if(IsPastStage(alg.name, stage)) {
+        SLOG("EventGenerator", pNOTICE)
+          << this->Id().Key() << " stops after the " << stage << " stage: "
+          << "skipping modules " << istep << " - " << nsteps-1;
+        fEVGModuleVec->resize(istep);
+        break;
+      }
+    }
+  }
+
+  for(unsigned int istep = 0; istep < fEVGModuleVec->size(); istep++) {
+
+    ostringstream keystream;
+    keystream << "Module-" << istep;
+
+    const EventRecordVisitorI * visitor =
+      dynamic_cast<const EventRecordVisitorI *>(this->SubAlg(keystream.str()));
+    if(!visitor) {
+      LOG("EventGenerator", pFATAL)
+         << keystream.str() << " of " << this->Id().Key()
+         << " is not an event record visitor";
+      exit(1);
+    }
+    SLOG("EventGenerator", pINFO)
+        << " -- Loaded module " << istep << " : " << visitor->Id().Key();
+
+    (*fEVGModuleVec)[istep] = visitor;
+  }
 
+  // load the event filter, run before the first hadronization or FSI module
+  string filter = RunOpt::Instance()->EventFilter();
+  fFilter = 0;
+  if(filter.size() > 0) {
+    string name = filter;
+    string conf = "Default";
+    size_t pos  = filter.find('/');
+    if(pos != string::npos) {
+      name = filter.substr(0, pos);
+      conf = filter.substr(pos+1);
+    }
+    fFilter = dynamic_cast<const EventFilterI *>(
+        AlgFactory::Instance()->GetAlgorithm(name, conf));
+    if(!fFilter) {
+      LOG("EventGenerator", pFATAL)
+         << filter << " is not an event filter (see RunOpt --event-filter)";
+      exit(1);
+    }
+    EventFilterI::SetInUse();
 
+    fFilterStep = fEVGModuleVec->size();
+    for(unsigned int istep = 0; istep < fEVGModuleVec->size(); istep++) {
+      if(IsPastStage((*fEVGModuleVec)[istep]->Id().Name(), "kinematics")) {
+        fFilterStep = istep;
+        break;
+      }
+    }
+    SLOG("EventGenerator", pINFO)
+        << " -- Event filter " << fFilter->Id().Key()
+        << " run before module " << fFilterStep;
+  }
+  fLoadState->loaded.store(true, std::memory_order_release);
+}
+//___________________________________________________________________________
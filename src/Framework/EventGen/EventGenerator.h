@@ -10,6 +10,27 @@
 
          Is a concrete implementation of the EventGeneratorI interface.
 
+         The processing modules are only instantiated (through AlgFactory,
+         which shares them between the generators) when the generator first
+         processes an event, so that the modules of the generators which
+         handle no interaction in a job are never loaded.
+
+         The chain can be truncated after a generation stage (see RunOpt
+         --stop-after), for samples which only need the event kinematics:
+         - kinematics: stops before the hadronic system (or target remnant)
+           generation, with the Pauli blocking & the FSI / decay modules
+           following it,
+         - hadronization: stops before the decays, intranuclear transport,
+           nuclear de-excitation & binding energy modules.
+         The modules generating the full event at once (MEC, GLRES, ...)
+         only lose the FSI / decay modules following them.
+
+         The event filter of RunOpt --event-filter (see EventFilterI) is run
+         at the start of the 'kinematics' cut above, ie after the kinematics
+         & primary lepton modules (or at the end of chains without such a
+         cut). The rejected events are flagged (see
+         GHepRecord::FilteredOut()) and skip the remaining modules.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -27,15 +48,16 @@
 #include <vector>
 
 #include "Framework/EventGen/EventGeneratorI.h"
-#include "Framework/GHEP/GHepRecordHistory.h"
 
-class TStopwatch;
 class TBits;
 
 using std::vector;
 
 namespace genie {
 
+class EventFilterI;
+struct EventGeneratorLoadState;
+
 class EventGenerator: public EventGeneratorI {
 
 public :
@@ -46,6 +68,17 @@ public :
   //-- implement the original EventRecordVisitorI interface
   void ProcessEventRecord(GHepRecord * event_rec) const;
 
+  //-- forward the max xsec envelope precomputation to the module caching
+  //   the max xsec (typically the kinematics generator)
+  bool   CachesMaxXSec       (void) const;
+  bool   LoadMaxXSecEnvelope (const Interaction * in, double Emin, double Emax) const;
+  double MaxXSecAt           (const Interaction * in, double E) const;
+  void   SetMaxXSecEnvelope  (const Interaction * in,
+                              const vector<double> & E, const vector<double> & xsec) const;
+
+  //-- forward the algorithm resolution to all the processing modules
+  void   ResolveAlgs         (const Interaction * in, ResolvedAlgs & algs) const;
+
   //-- implement the extensions to the EventRecordVisitorI interface
   const GVldContext &               ValidityContext  (void) const;
   const InteractionListGeneratorI * IntListGenerator (void) const;
@@ -58,18 +91,26 @@ public :
 
 private:
 
-  void Init       (void);
-  void LoadConfig (void);
+  void Init        (void);
+  void LoadConfig  (void);
+  void LoadModules (void) const;
+
+  const EventRecordVisitorI * MaxXSecModule (void) const;
+
+  void AddModuleTime (const EventRecordVisitorI * visitor,
+                      const GHepRecord * event_rec, double time) const;
+  void EndProcessingStep (GHepRecord * event_rec) const;
+  bool FilterEvent       (GHepRecord * event_rec) const;
 
   //-- private data members
   vector<const EventRecordVisitorI *> * fEVGModuleVec;   ///< list of modules
-  vector<double> *                      fEVGTime;        ///< module timing info
   const XSecAlgorithmI *                fXSecModel;      ///< xsec model for events handled by thread
   const InteractionListGeneratorI *     fIntListGen;     ///< generates list of handled interactions
   GVldContext *                         fVldContext;     ///< validity context
-  TStopwatch *                          fWatch;          ///< stopwatch for module timing
   TBits *                               fFiltUnphysMask; ///< mask for allowing unphysical events to pass through (if requested)
-  mutable GHepRecordHistory             fRecHistory;     ///< event record history 
+  EventGeneratorLoadState *             fLoadState;      ///< fEVGModuleVec filled? (double-checked flag, see LoadModules())
+  mutable const EventFilterI *          fFilter;         ///< event filter (null: none), loaded with the modules
+  mutable unsigned int                  fFilterStep;     ///< processing step before which the filter is run
 };
 
 }      // genie namespace
@@ -10,10 +10,16 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added AdoptGenerators(): the list can own private copies of its event
+   generators.
 
 */
 //____________________________________________________________________________
 
+#include <cassert>
+
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/EventGen/EventGeneratorList.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/Messenger/Messenger.h"
@@ -30,14 +36,48 @@ namespace genie {
  }
 }
 //___________________________________________________________________________
-EventGeneratorList::EventGeneratorList()
+EventGeneratorList::EventGeneratorList() :
+fOwnsGenerators(false)
 {
 
 }
 //___________________________________________________________________________
 EventGeneratorList::~EventGeneratorList()
 {
+  this->DeleteGenerators();
+}
+//___________________________________________________________________________
+void EventGeneratorList::AdoptGenerators(void)
+{
+  if(fOwnsGenerators) return;
+
+  LOG("EvGenList", pNOTICE)
+     << "Taking private copies of " << this->size() << " event generators";
+
+  AlgFactory * algf = AlgFactory::Instance();
+
+  EventGeneratorList::iterator iter;
+  for(iter = this->begin(); iter != this->end(); ++iter) {
+    if(!*iter) continue;
+    EventGeneratorI * evgen =
+        dynamic_cast<EventGeneratorI *> (algf->AdoptAlgorithm((*iter)->Id()));
+    assert(evgen);
+    evgen->AdoptSubstructure();
+    *iter = evgen;
+  }
+  fOwnsGenerators = true;
+}
+//___________________________________________________________________________
+void EventGeneratorList::DeleteGenerators(void)
+{
+  if(!fOwnsGenerators) return;
 
+  EventGeneratorList::iterator iter;
+  for(iter = this->begin(); iter != this->end(); ++iter) {
+    if(*iter) delete *iter;
+    *iter = 0;
+  }
+  fOwnsGenerators = false;
 }
 //___________________________________________________________________________
 void EventGeneratorList::Print(ostream & stream) const
@@ -5,6 +5,13 @@
 
 \brief   A vector of EventGeneratorI objects
 
+         The event generators are normally shared instances from the
+         AlgFactory pool. AdoptGenerators() replaces them by private copies,
+         each with its own copy of its sub-algorithms (see
+         Algorithm::AdoptSubstructure()), owned by the list: the events of
+         a list with adopted generators can be generated in one thread while
+         other threads use other lists.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -39,9 +46,19 @@ public :
   EventGeneratorList();
   ~EventGeneratorList();
 
+  //! Replace the event generators by private copies owned by the list
+  void AdoptGenerators (void);
+  bool OwnsGenerators  (void) const { return fOwnsGenerators; }
+
   void Print(ostream & stream) const;
 
   friend ostream & operator << (ostream & stream, const EventGeneratorList & evgl);
+
+private:
+  EventGeneratorList(const EventGeneratorList & evgl);
+  void DeleteGenerators (void);
+
+  bool fOwnsGenerators; ///< the generators are copies owned by the list?
 };
 
 }      // genie namespace
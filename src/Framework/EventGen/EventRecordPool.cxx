@@ -0,0 +1,77 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
+
+using namespace genie;
+
+//___________________________________________________________________________
+EventRecordPool::EventRecordPool(unsigned int max_size) :
+fMaxSize(max_size),
+fBuffer(0),
+fBufferOut(false)
+{
+
+}
+//___________________________________________________________________________
+EventRecordPool::~EventRecordPool()
+{
+  this->SetMaxSize(0);
+}
+//___________________________________________________________________________
+EventRecord * EventRecordPool::Get(void)
+{
+  if(fBuffer && !fBufferOut) {
+    fBufferOut = true;
+    fBuffer->ResetRecord();
+    return fBuffer;
+  }
+  if(fRecords.empty()) return 0;
+
+  EventRecord * event = fRecords.back();
+  fRecords.pop_back();
+  return event;
+}
+//___________________________________________________________________________
+void EventRecordPool::Recycle(EventRecord * event)
+{
+  if(!event) return;
+
+  if(event == fBuffer) {
+    fBufferOut = false;
+    return;
+  }
+  if(fRecords.size() >= fMaxSize) {
+    delete event;
+    return;
+  }
+  event->ResetRecord();
+  fRecords.push_back(event);
+}
+//___________________________________________________________________________
+void EventRecordPool::SetBuffer(EventRecord * event)
+{
+  fBuffer    = event;
+  fBufferOut = false;
+}
+//___________________________________________________________________________
+void EventRecordPool::SetMaxSize(unsigned int max_size)
+{
+  fMaxSize = max_size;
+  while(fRecords.size() > fMaxSize) {
+    delete fRecords.back();
+    fRecords.pop_back();
+  }
+}
+//___________________________________________________________________________
@@ -0,0 +1,73 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::EventRecordPool
+
+\brief   A pool of event records that are no longer needed, for re-use.
+         Rather than deleting a generated event after it was written out,
+         clients can give it back to the pool (see Recycle()). The event
+         generation drivers then take their next record from the pool, and
+         its particle slots, vertex, flags and summary are re-used (see
+         GHepRecord::ResetRecord()) instead of being re-allocated.
+         A pool must only be used by one thread at a time.
+         A record owned by the caller can also be lent to the pool (see
+         SetBuffer()), so that the next event is generated in it: It is
+         handed out first and is kept (never pooled or deleted) when it is
+         given back.
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _EVENT_RECORD_POOL_H_
+#define _EVENT_RECORD_POOL_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+
+class EventRecordPool {
+
+public :
+  EventRecordPool(unsigned int max_size = 16);
+ ~EventRecordPool();
+
+  //! Get a (reset) record from the pool; the caller adopts it. Returns 0
+  //! if the pool is empty
+  EventRecord * Get     (void);
+
+  //! Give back a record that is no longer needed; the pool adopts it
+  //! (records beyond the maximum pool size are deleted)
+  void          Recycle (EventRecord * event);
+
+  //! Lend a caller-owned record, handed out (reset) by the next Get() and
+  //! kept aside when recycled, until the buffer is cleared (input 0)
+  void          SetBuffer (EventRecord * event);
+  EventRecord * Buffer    (void) const { return fBuffer; }
+
+  unsigned int  NRecords   (void) const { return fRecords.size(); }
+  unsigned int  MaxSize    (void) const { return fMaxSize; }
+  void          SetMaxSize (unsigned int max_size);
+
+private:
+  EventRecordPool(const EventRecordPool & pool);
+
+  vector<EventRecord *> fRecords;  ///< records available for re-use
+  unsigned int          fMaxSize;  ///< maximum number of pooled records
+  EventRecord *         fBuffer;   ///< caller-owned record (not adopted)
+  bool                  fBufferOut; ///< buffer handed out by Get()?
+};
+
+}      // genie namespace
+
+#endif // _EVENT_RECORD_POOL_H_
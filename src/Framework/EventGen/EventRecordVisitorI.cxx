@@ -10,6 +10,8 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the optional ResolveAlgs() interface (see ResolvedAlgs).
 
 */
 //____________________________________________________________________________
@@ -42,3 +44,37 @@ EventRecordVisitorI::~EventRecordVisitorI()
 
 }
 //___________________________________________________________________________
+bool EventRecordVisitorI::CachesMaxXSec(void) const
+{
+  return false;
+}
+//___________________________________________________________________________
+bool EventRecordVisitorI::LoadMaxXSecEnvelope(
+                       const Interaction * /*in*/, double /*Emin*/, double /*Emax*/) const
+{
+  return false;
+}
+//___________________________________________________________________________
+double EventRecordVisitorI::MaxXSecAt(
+                              const Interaction * /*in*/, double /*E*/) const
+{
+  return -1;
+}
+//___________________________________________________________________________
+void EventRecordVisitorI::SetMaxXSecEnvelope(const Interaction * /*in*/,
+     const vector<double> & /*E*/, const vector<double> & /*xsec*/) const
+{
+
+}
+//___________________________________________________________________________
+bool EventRecordVisitorI::AddsDaughtersContiguously(void) const
+{
+  return false;
+}
+//___________________________________________________________________________
+void EventRecordVisitorI::ResolveAlgs(
+                     const Interaction * /*in*/, ResolvedAlgs & /*algs*/) const
+{
+
+}
+//___________________________________________________________________________
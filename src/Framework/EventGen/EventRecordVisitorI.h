@@ -21,11 +21,17 @@
 #ifndef _EVENT_RECORD_VISITOR_I_H_
 #define _EVENT_RECORD_VISITOR_I_H_
 
+#include <vector>
+
 #include "Framework/Algorithm/Algorithm.h"
 
+using std::vector;
+
 namespace genie {
 
 class GHepRecord;
+class Interaction;
+class ResolvedAlgs;
 
 class EventRecordVisitorI : public Algorithm {
 
@@ -37,6 +43,28 @@ public :
 
   virtual void ProcessEventRecord(GHepRecord * event_rec) const = 0;
 
+  //-- optional interface for the modules caching the max{dxsec/dK} used
+  //   for kinematics generation, so that it can be precomputed at init
+  //   (see KineGeneratorWithCache). The defaults do nothing
+
+  virtual bool   CachesMaxXSec       (void) const;
+  virtual bool   LoadMaxXSecEnvelope (const Interaction * in, double Emin, double Emax) const;
+  virtual double MaxXSecAt           (const Interaction * in, double E) const;
+  virtual void   SetMaxXSecEnvelope  (const Interaction * in,
+                                      const vector<double> & E, const vector<double> & xsec) const;
+
+  //-- optional interface for the modules adding the daughters of each mother
+  //   in consecutive GHEP slots, so that the daughter-lists need no checks
+  //   (see GHepRecord::SetAppendOnlyInsertion()). The default is false
+
+  virtual bool   AddsDaughtersContiguously (void) const;
+
+  //-- optional interface for the modules selecting, for every event, one of
+  //   several algorithms (eg NuclearModelMap) so that the selection can be
+  //   done once per channel (see ResolvedAlgs). The default does nothing
+
+  virtual void   ResolveAlgs (const Interaction * in, ResolvedAlgs & algs) const;
+
 protected :
 
   EventRecordVisitorI();
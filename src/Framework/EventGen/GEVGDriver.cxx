@@ -12,6 +12,14 @@
 #include <cassert>
 #include <cstdlib>
 #include <sstream>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+#include <unistd.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
 
 #include <TSystem.h>
 #include <TMath.h>
@@ -22,6 +30,9 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
+#include "Framework/EventGen/ChannelBias.h"
+#include "Framework/EventGen/EventFilterI.h"
 #include "Framework/EventGen/EventGeneratorList.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/ToyInteractionSelector.h"
@@ -31,15 +42,19 @@
 #include "Framework/EventGen/InteractionListGeneratorI.h"
 #include "Framework/EventGen/InteractionGeneratorMap.h"
 #include "Framework/EventGen//RunningThreadInfo.h"
+#include "Framework/EventGen/RejectedEventStats.h"
+#include "Framework/EventGen/ResolvedAlgs.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/InitTimingStats.h"
 
 using std::ostringstream;
 
@@ -74,7 +89,8 @@ void GEVGDriver::Init(void)
   fCurrentRecord = 0;
 
   // list of Event Generator objects loaded into the driver
-  fEvGenList = 0;
+  fEvGenList     = 0;
+  fOwnsEvGenList = false;
 
   // interaction selector
   fIntSelector = 0;
@@ -92,6 +108,9 @@ void GEVGDriver::Init(void)
   // depths
   fNRecLevel = 0;
 
+  // was the last event rejected by the event filter (see EventFilterI)?
+  fFilteredOut = false;
+
   // an "interaction" -> "generator" associative contained built for all
   // simulated interactions (from the loaded Event Generators and for the
   // input initial state)
@@ -104,6 +123,9 @@ void GEVGDriver::Init(void)
   // GMCJDriver for selecting an initial state.
   fXSecSumSpl = 0;
 
+  // pool of recycled event records (not owned), if used
+  fRecordPool = 0;
+
   // Default driver behaviour is to filter out unphysical events
   // If needed, set the fUnphysEventMask bitfield to get pre-selected types of
   // unphysical events (just set to 1 the bit you want ignored from the check).
@@ -123,7 +145,7 @@ void GEVGDriver::CleanUp(void)
 {
   if (fUnphysEventMask)  delete fUnphysEventMask;
   if (fInitState)        delete fInitState;
-  if (fEvGenList)        delete fEvGenList;
+  if (fEvGenList && fOwnsEvGenList) delete fEvGenList;
   if (fIntSelector)      delete fIntSelector;
   if (fIntGenMap)        delete fIntGenMap;
   if (fXSecSumSpl)       delete fXSecSumSpl;
@@ -143,8 +165,10 @@ void GEVGDriver::Configure(int nu_pdgc, int Z, int A)
   this->Configure(init_state);
 }
 //___________________________________________________________________________
-void GEVGDriver::Configure(const InitialState & is)
+void GEVGDriver::Configure(const InitialState & is, bool build_map)
 {
+  InitTimingScope timing("GEVGDriver::Configure");
+
   InitialState init_state(is.TgtPdg(), is.ProbePdg()); // filter any other init state info
 
   ostringstream mesg;
@@ -158,8 +182,8 @@ void GEVGDriver::Configure(const InitialState & is)
 
   this -> BuildInitialState            (init_state);
   this -> BuildGeneratorList           ();
-  this -> BuildInteractionGeneratorMap ();
   this -> BuildInteractionSelector     ();
+  if(build_map) this -> BuildInteractionGeneratorMap ();
 
   LOG("GEVGDriver", pINFO) << "Done configuring. \n";
 }
@@ -179,12 +203,20 @@ void GEVGDriver::BuildGeneratorList(void)
 //! Load event generators.
 //! The list of event generators is named by fEventGenList.
 
+  if(fEvGenList && !fOwnsEvGenList) {
+    LOG("GEVGDriver", pINFO) << "Using a shared event generator list";
+    return;
+  }
+
   LOG("GEVGDriver", pINFO)
     << "Building the event generator list (specified list name: "
     << fEventGenList << ")";
 
+  if(fEvGenList) delete fEvGenList;
+
   EventGeneratorListAssembler evglist_assembler(fEventGenList.c_str());
-  fEvGenList = evglist_assembler.AssembleGeneratorList();
+  fEvGenList     = evglist_assembler.AssembleGeneratorList();
+  fOwnsEvGenList = true;
 }
 //___________________________________________________________________________
 void GEVGDriver::BuildInteractionGeneratorMap(void)
@@ -195,6 +227,13 @@ void GEVGDriver::BuildInteractionGeneratorMap(void)
   LOG("GEVGDriver", pINFO)
          << "Building the interaction -> generator associations...";
 
+  if(!fEvGenList || !fInitState) {
+    LOG("GEVGDriver", pFATAL)
+      << "The driver must be configured before building its interaction map";
+    exit(1);
+  }
+
+  if(fIntGenMap) delete fIntGenMap;
   fIntGenMap = new InteractionGeneratorMap;
   fIntGenMap->UseGeneratorList(fEvGenList);
   fIntGenMap->BuildMap(*fInitState);
@@ -233,103 +272,190 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
   InitialState init_state(*fInitState);
   init_state.SetProbeP4(nu4p);
 
-  //-- Select the interaction to be generated (amongst the entries of the
-  //   InteractionList assembled by the EventGenerators) and bootstrap the
-  //   event record
-  LOG("GEVGDriver", pINFO)
-     << "Selecting an Interaction & Bootstraping the EventRecord";
-  fCurrentRecord = fIntSelector->SelectInteraction(fIntGenMap, nu4p);
-
-  if(!fCurrentRecord) {
-     LOG("GEVGDriver", pWARN)
-         << "No interaction could be selected for: "
-         << init_state.AsString() << " at E = " << nu4p.E() << " GeV";
-     return 0;
-  }
-
-  //-- Get a ptr to the interaction summary
-  LOG("GEVGDriver", pDEBUG) << "Getting the selected interaction";
-  Interaction * interaction = fCurrentRecord->Summary();
-
-  //-- Find the appropriate concrete EventGeneratorI implementation
-  //   for generating this event.
-  //
-  //   The right EventGeneratorI will be selecting by iterating over the
-  //   entries of the EventGeneratorList and compare the interaction
-  //   against the ValidityContext declared by each EventGeneratorI
-  //
-  //   (note: use of the 'Chain of Responsibility' Design Pattern)
-
-  LOG("GEVGDriver", pINFO) << "Finding an appropriate EventGenerator";
-
-  const EventGeneratorI * evgen = fIntGenMap->FindGenerator(interaction);
-  assert(evgen);
-
-  RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
-  rtinfo->UpdateRunningThread(evgen);
-
-  //-- Generate the selected event
-  //
-  //   The selected EventGeneratorI subclass will start processing the
-  //   event record (by sequentially asking each entry in its list of
-  //   EventRecordVisitorI subclasses to visit and process the record).
-  //   Most of the actual event generation takes place in this step.
-  //
-  //   (note: use of the 'Visitor' Design Pattern)
-
-  string mesg = "Requesting from event generation thread: " +
-         evgen->Id().Key() + " to generate the selected interaction";
+  //-- Generate events till a physical one (or an unphysical one accepted
+  //   by the user) is produced. The event record allocated at the first
+  //   try is reset & reused by the following ones. The number of rejected
+  //   tries and the time spent on them are tallied per interaction channel
+  //   in RejectedEventStats. If a pool of records is used, the first try
+  //   starts from a recycled record. The events rejected by the event filter
+  //   (see EventFilterI) are not regenerated: a null event is returned.
+
+  fFilteredOut = false;
+
+  EventRecord * evrec = 0;
+  if(fRecordPool) evrec = fRecordPool->Get();
+
+  for(fNRecLevel = 0; fNRecLevel <= kRecursiveModeMaxDepth; fNRecLevel++) {
+
+    std::chrono::steady_clock::time_point try_start = 
+                                           std::chrono::steady_clock::now();
+
+    //-- Select the interaction to be generated (amongst the entries of the
+    //   InteractionList assembled by the EventGenerators) and bootstrap the
+    //   event record
+    LOG("GEVGDriver", pINFO)
+       << "Selecting an Interaction & Bootstraping the EventRecord";
+    bool selected = false;
+    if(!evrec) {
+       evrec    = fIntSelector->SelectInteraction(fIntGenMap, nu4p);
+       selected = (evrec != 0);
+    } else {
+       evrec->ResetRecord();
+       selected = fIntSelector->SelectInteractionInRecord(fIntGenMap, nu4p, evrec);
+    }
+    if(!selected) {
+       LOG("GEVGDriver", pWARN)
+           << "No interaction could be selected for: "
+           << init_state.AsString() << " at E = " << nu4p.E() << " GeV";
+       this->DiscardRecord(evrec);
+       fCurrentRecord = 0;
+       fNRecLevel     = 0;
+       return 0;
+    }
+    fCurrentRecord = evrec;
+
+    //-- The weight of the freshly bootstrapped record compensates for the
+    //   oversampling of the selected channel, if any (see ChannelBias)
+    double bias_weight = fCurrentRecord->Weight();
+
+    //-- With counter-based random number streams, keep the key of the
+    //   event streams so that the event can be re-generated on its own
+    RandomGen * rnd = RandomGen::Instance();
+    if(rnd->CounterBased()) {
+       fCurrentRecord->SetRndmCheckpoint(
+          rnd->GetSeed(), rnd->RunNumber(), rnd->EventIndex());
+    }
+
+    //-- Get a ptr to the interaction summary
+    LOG("GEVGDriver", pDEBUG) << "Getting the selected interaction";
+    Interaction * interaction = fCurrentRecord->Summary();
+
+    //-- Find the appropriate concrete EventGeneratorI implementation
+    //   for generating this event.
+    //
+    //   The right EventGeneratorI will be selecting by iterating over the
+    //   entries of the EventGeneratorList and compare the interaction
+    //   against the ValidityContext declared by each EventGeneratorI
+    //
+    //   (note: use of the 'Chain of Responsibility' Design Pattern)
+
+    //   The interactions of the map normally carry the algorithms resolved
+    //   for their channel (see ResolvedAlgs), including the generator, and
+    //   the generator modules fill in theirs on the first event of the channel
+
+    LOG("GEVGDriver", pINFO) << "Finding an appropriate EventGenerator";
+
+    const ResolvedAlgs * algs = interaction->ResolvedAlgsPtr();
+    const EventGeneratorI * evgen =
+         (algs) ? algs->Generator() : fIntGenMap->FindGenerator(interaction);
+    assert(evgen);
+    if(algs) algs->ResolveModules(interaction);
+
+    RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
+    rtinfo->UpdateRunningThread(evgen);
+
+    //-- Generate the selected event
+    //
+    //   The selected EventGeneratorI subclass will start processing the
+    //   event record (by sequentially asking each entry in its list of
+    //   EventRecordVisitorI subclasses to visit and process the record).
+    //   Most of the actual event generation takes place in this step.
+    //
+    //   (note: use of the 'Visitor' Design Pattern)
+
+    string mesg = "Requesting from event generation thread: " +
+           evgen->Id().Key() + " to generate the selected interaction";
+
+    LOG("GEVGDriver", pNOTICE)
+           << utils::print::PrintFramedMesg(mesg,1,'=');
+
+    fCurrentRecord->SetUnphysEventMask(*fUnphysEventMask);
+    evgen->ProcessEventRecord(fCurrentRecord);
+
+    //-- Events rejected by the event filter skipped the rest of the chain
+    //   and are not returned
+    if(fCurrentRecord->FilteredOut()) {
+       LOG("GEVGDriver", pINFO) << "The event was rejected by the event filter";
+       EventFilterI::CountEvent(false);
+       this->DiscardRecord(evrec);
+       fCurrentRecord = 0;
+       fNRecLevel     = 0;
+       fFilteredOut   = true;
+       return 0;
+    }
+
+    //-- Check the generated event flags. The default behaviour is
+    //   to reject an unphysical event and try to regenerate it. 
+    //   If an unphysical event mask has been set, error conditions may 
+    //   be ignored so that the requested classes of unphysical events 
+    //   can be passed-through.
+
+    bool unphys = fCurrentRecord->IsUnphysical();
+    if(!unphys) {
+       LOG("GEVGDriver", pINFO) << "Returning the current event!";
+       fNRecLevel = 0;
+       ChannelBias * bias = ChannelBias::Instance();
+       if(bias->Enabled()) bias->AddEvent(interaction, bias_weight);
+       if(EventFilterI::InUse()) EventFilterI::CountEvent(true);
+       return fCurrentRecord; // The client 'adopts' the event record
+    }
 
-  LOG("GEVGDriver", pNOTICE)
-         << utils::print::PrintFramedMesg(mesg,1,'=');
-
-  fCurrentRecord->SetUnphysEventMask(*fUnphysEventMask);
-  evgen->ProcessEventRecord(fCurrentRecord);
-
-  //-- Check the generated event flags. The default behaviour is
-  //   to reject an unphysical event and enter in recursive mode
-  //   and try to regenerate it. If an unphysical event mask has
-  //   been set, error conditions may be ignored so that the
-  //   requested classes of unphysical events can be passed-through.
-
-  bool unphys = fCurrentRecord->IsUnphysical();
-  if(!unphys) {
-     LOG("GEVGDriver", pINFO) << "Returning the current event!";
-     fNRecLevel = 0;
-     return fCurrentRecord; // The client 'adopts' the event record
-  } else {
-     LOG("GEVGDriver", pWARN) << "An unphysical event was generated...";
-     // Check whether the user wants to ignore the err
-     bool accept = fCurrentRecord->Accept();
-     if(accept) {
+    LOG("GEVGDriver", pWARN) << "An unphysical event was generated...";
+    // Check whether the user wants to ignore the err
+    bool accept = fCurrentRecord->Accept();
+    if(accept) {
        LOG("GEVGDriver", pWARN)
           << "The generated unphysical event is accepted by the user";
        fNRecLevel = 0;
+       ChannelBias * bias = ChannelBias::Instance();
+       if(bias->Enabled()) bias->AddEvent(interaction, bias_weight);
+       if(EventFilterI::InUse()) EventFilterI::CountEvent(true);
        return fCurrentRecord; // The client 'adopts' the event record
+    }
 
-     } else {
-       LOG("GEVGDriver", pWARN)
+    LOG("GEVGDriver", pWARN)
           << "The generated unphysical event is rejected";
-       delete fCurrentRecord;
-       fCurrentRecord = 0;
-       fNRecLevel++; // increase the nested level counter
 
-       if(fNRecLevel<=kRecursiveModeMaxDepth) {
-          LOG("GEVGDriver", pWARN)
+    std::chrono::duration<double> try_time = 
+                             std::chrono::steady_clock::now() - try_start;
+    RejectedEventStats * rejstats = RejectedEventStats::Instance();
+    rejstats->AddRejected(interaction, try_time.count());
+
+    if(fNRecLevel < kRecursiveModeMaxDepth) {
+       LOG("GEVGDriver", pWARN)
             << "Attempting to regenerate the event...";
-          return this->GenerateEvent(nu4p);
-       } else {
-          LOG("GEVGDriver", pERROR)
-               << "Could not produce a physical event after "
-                      << kRecursiveModeMaxDepth << " attempts!";
-          delete fCurrentRecord;
-          fCurrentRecord = 0;
-          fNRecLevel = 0;
-          return 0;
-//        exit(1);
-       }
-     }
-  }
+    } else {
+       rejstats->AddAbandoned(interaction);
+    }
+  } // tries
+
+  LOG("GEVGDriver", pERROR)
+       << "Could not produce a physical event after "
+       << kRecursiveModeMaxDepth << " attempts!";
+  this->DiscardRecord(evrec);
+  fCurrentRecord = 0;
+  fNRecLevel = 0;
+  return 0;
+}
+//___________________________________________________________________________
+void GEVGDriver::UseRecordPool(EventRecordPool * pool)
+{
+  fRecordPool = pool;
+}
+//___________________________________________________________________________
+void GEVGDriver::UseGeneratorList(const EventGeneratorList * evgl)
+{
+  if(fEvGenList && fOwnsEvGenList) delete fEvGenList;
+
+  fEvGenList     = evgl;
+  fOwnsEvGenList = false;
+}
+//___________________________________________________________________________
+void GEVGDriver::DiscardRecord(EventRecord * evrec)
+{
+  if(!evrec) return;
+  if(fRecordPool) fRecordPool->Recycle(evrec);
+  else            delete evrec;
 }
 //___________________________________________________________________________
 const InteractionList * GEVGDriver::Interactions(void) const
@@ -406,10 +532,10 @@ double GEVGDriver::XSecSum(const TLorentzVector & nup4)
 
      // compute (or evaluate) the cross section
      double xsec = 0;
-     bool spline_exists = xssl->SplineExists(xsec_alg, interaction);
-     if (spline_exists && fUseSplines) {
+     int spl_handle = xssl->GetSplineHandle(xsec_alg, interaction);
+     if (spl_handle >= 0 && fUseSplines) {
         double E = nup4.Energy();
-        xsec = xssl->GetSpline(xsec_alg,interaction)->Evaluate(E);
+        xsec = xssl->GetSpline(spl_handle)->Evaluate(E);
      } else
         xsec = xsec_alg->Integral(interaction);
 
@@ -486,6 +612,161 @@ void GEVGDriver::CreateXSecSumSpline(
   delete [] xsec;
 }
 //___________________________________________________________________________
+void GEVGDriver::PrecomputeMaxXSec(
+                       double Emin, double Emax, int nknots, int njobs)
+{
+// Precomputes, before event generation, the max{dxsec/dK} values that the
+// kinematics generators would otherwise compute and cache on the fly (on the
+// first events at each energy). The envelope of each interaction is set to
+// its generator, which consults it without locking during event generation.
+// The max xsec computation uses algorithms with mutable state, so it is run
+// in forked worker processes rather than in threads.
+
+  if(!fIntGenMap) {
+     LOG("GEVGDriver", pWARN)
+          << "Driver not configured - Can not precompute max xsecs";
+     return;
+  }
+  if(Emax <= 0 || nknots < 2) return;
+
+  // the max xsec grid, for each interaction whose envelope is not cached
+  vector<const Interaction *>     interactions;
+  vector<const EventGeneratorI *> generators;
+  vector< vector<double> >        Egrid;
+
+  const InteractionList & ilst = fIntGenMap->GetInteractionList();
+  InteractionList::const_iterator intliter;
+  for(intliter = ilst.begin(); intliter != ilst.end(); ++intliter) {
+     const Interaction * interaction = *intliter;
+     const EventGeneratorI * evgen = fIntGenMap->FindGenerator(interaction);
+     if(!evgen || !evgen->CachesMaxXSec()) continue;
+
+     // start from the threshold (and not much below Emax, on a log grid)
+     double Ethr = interaction->PhaseSpace().Threshold();
+     double E0   = TMath::Max(Emin, 1.001*Ethr);
+     E0 = TMath::Max(E0, 1E-3*Emax);
+     if(E0 >= Emax) continue;
+
+     if(evgen->LoadMaxXSecEnvelope(interaction, E0, Emax)) continue;
+
+     vector<double> E(nknots);
+     double logE0 = TMath::Log(E0);
+     double dlogE = (TMath::Log(Emax) - logE0) / (nknots-1);
+     for(int i = 0; i < nknots; i++) {
+       E[i] = TMath::Exp(logE0 + i*dlogE);
+     }
+     E[nknots-1] = Emax;
+
+     interactions.push_back(interaction);
+     generators  .push_back(evgen);
+     Egrid       .push_back(E);
+  }
+
+  unsigned int nint = interactions.size();
+  LOG("GEVGDriver", pNOTICE)
+     << "Precomputing the max{dxsec/dK} envelope for " << nint
+     << " interactions in E = [" << Emin << ", " << Emax << "] GeV using "
+     << nknots << " knots and " << njobs << " job(s)";
+  if(nint == 0) return;
+
+  // the tasks: (interaction, knot), to be shared among the workers
+  unsigned int ntasks = nint * nknots;
+  vector< vector<double> > xsec(nint, vector<double>(nknots, -1.));
+
+  RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
+
+  int nworkers = TMath::Min(njobs, (int) ntasks);
+  if(nworkers <= 1) {
+    for(unsigned int it = 0; it < ntasks; it++) {
+      int ii = it / nknots;
+      int ik = it % nknots;
+      rtinfo->UpdateRunningThread(generators[ii]);
+      xsec[ii][ik] = generators[ii]->MaxXSecAt(interactions[ii], Egrid[ii][ik]);
+    }
+  } else {
+    // worker iw computes the tasks iw, iw + nworkers, ... and sends back
+    // (task, max xsec) pairs
+    struct Result_t { unsigned int task; double xsec; };
+
+    vector<pid_t> pids  (nworkers);
+    vector<int>   fr_wrk(nworkers);
+
+    // flush before forking so that buffered output is not written twice
+    std::cout.flush();
+    std::cerr.flush();
+
+    for(int iw = 0; iw < nworkers; iw++) {
+      int fd[2];
+      if(pipe(fd) != 0) {
+        LOG("GEVGDriver", pFATAL) << "Could not create pipe";
+        exit(1);
+      }
+      pid_t pid = fork();
+      if(pid < 0) {
+        LOG("GEVGDriver", pFATAL) << "Could not fork worker process";
+        exit(1);
+      }
+      if(pid == 0) {
+        close(fd[0]);
+        for(int jw = 0; jw < iw; jw++) close(fr_wrk[jw]);
+        for(unsigned int it = iw; it < ntasks; it += nworkers) {
+          int ii = it / nknots;
+          int ik = it % nknots;
+          rtinfo->UpdateRunningThread(generators[ii]);
+          Result_t result;
+          result.task = it;
+          result.xsec = generators[ii]->MaxXSecAt(interactions[ii], Egrid[ii][ik]);
+          if(write(fd[1], &result, sizeof(result)) != (ssize_t) sizeof(result)) break;
+        }
+        std::cout.flush();
+        _exit(0);
+      }
+      close(fd[1]);
+      pids  [iw] = pid;
+      fr_wrk[iw] = fd[0];
+    }
+
+    // collect the results until all workers are done
+    int nopen = nworkers;
+    vector<struct pollfd> pfds(nworkers);
+    for(int iw = 0; iw < nworkers; iw++) {
+      pfds[iw].fd     = fr_wrk[iw];
+      pfds[iw].events = POLLIN;
+    }
+    while(nopen > 0) {
+      if(poll(&pfds[0], nworkers, -1) < 0) continue;
+      for(int iw = 0; iw < nworkers; iw++) {
+        if(pfds[iw].fd < 0 || pfds[iw].revents == 0) continue;
+        Result_t result;
+        ssize_t nr = read(fr_wrk[iw], &result, sizeof(result));
+        if(nr != (ssize_t) sizeof(result)) {
+          // worker done (or dead: its remaining points are skipped)
+          close(fr_wrk[iw]);
+          pfds[iw].fd = -1;
+          nopen--;
+          continue;
+        }
+        if(result.task < ntasks) {
+          xsec[result.task / nknots][result.task % nknots] = result.xsec;
+        }
+      }
+    }
+    for(int iw = 0; iw < nworkers; iw++) {
+      int status = 0;
+      waitpid(pids[iw], &status, 0);
+      if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        LOG("GEVGDriver", pWARN)
+          << "Max xsec worker process " << pids[iw] << " failed - "
+          << "Its max xsec values will be computed on the fly";
+      }
+    }
+  }
+
+  for(unsigned int ii = 0; ii < nint; ii++) {
+    generators[ii]->SetMaxXSecEnvelope(interactions[ii], Egrid[ii], xsec[ii]);
+  }
+}
+//___________________________________________________________________________
 const Spline * GEVGDriver::XSecSpline(const Interaction * interaction) const
 {
 // Returns the cross section spline for the input interaction as was
@@ -589,7 +870,7 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
   xsl->SetLogE(useLogE);
 
   EventGeneratorList::const_iterator evgliter; // event generator list iter
-  InteractionList::iterator          intliter; // interaction list iter
+  InteractionList::const_iterator    intliter; // interaction list iter
 
   // loop over all EventGenerator objects used in the current job
   for(evgliter = fEvGenList->begin();
@@ -603,7 +884,7 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
      // ask the event generator to produce a list of all interaction it can
      // generate for the input initial state
      const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
-     InteractionList * ilst = ilstgen->CreateInteractionList(*fInitState);
+     const InteractionList * ilst = ilstgen->InteractionListTemplate(*fInitState);
      if(!ilst) continue;
 
      // total cross section algorithm used by the current EventGenerator
@@ -657,8 +938,6 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
              SLOG("GEVGDriver", pDEBUG) << "Spline was found";
          }
      } // loop over interaction that can be generated by this generator
-     delete ilst;
-     ilst = 0;
   } // loop over event generators
 
   LOG("GEVGDriver", pINFO) << *xsl; // print list of splines
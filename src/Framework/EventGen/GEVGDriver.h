@@ -40,6 +40,7 @@ namespace genie {
 
 class GEVGDriver;
 class EventRecord;
+class EventRecordPool;
 class EventGeneratorList;
 class EventGeneratorI;
 class InteractionSelectorI;
@@ -62,16 +63,31 @@ public :
   // - Set before calling Configure()
   void UseSplines (void);
   void SetEventGeneratorList(string listname);
+  // - Use the (not owned) event generator list of another driver rather
+  //   than assembling one: the list does not depend on the initial state
+  void UseGeneratorList(const EventGeneratorList * evgl);
   // - Set before GenerateEvent()
   void SetUnphysEventMask(const TBits & mask);
+  // - Take the event records from (and give the failed ones back to) the
+  //   input pool of recycled records (not owned); 0 to always allocate
+  void UseRecordPool(EventRecordPool * pool);
 
   // Configure the driver
   void Configure (int nu_pdgc, int Z, int A);
-  void Configure (const InitialState & init_state);
+  void Configure (const InitialState & init_state, bool build_map = true);
+
+  // Build the interaction -> generator map (done by Configure() unless
+  // build_map is false). Instantiates no algorithm, so it can run for
+  // several drivers concurrently
+  void BuildInteractionGeneratorMap (void);
 
   // Generate single event
   EventRecord * GenerateEvent (const TLorentzVector & nu4p);
 
+  // Was the last null event of GenerateEvent() rejected by the event filter
+  // (see EventFilterI), rather than a failure?
+  bool LastEventFilteredOut (void) const { return fFilteredOut; }
+
   // Get the list of all interactions that can be simulated for the specified 
   // initial state (depends on which event generation threads were loaded into
   // the event generation driver driver)
@@ -95,6 +111,12 @@ public :
   double XSecSum             (const TLorentzVector & nup4);
   void   CreateXSecSumSpline (int nk, double Emin, double Emax, bool inlogE=true);
 
+  // Precompute the max{dxsec/dK} envelopes used by the kinematics generators
+  // on a log grid of probe energies in [Emin, Emax], with njobs forked worker
+  // processes. Envelopes already found in the cache (eg read from a cache
+  // file) are not recomputed. Call after Configure(), before GenerateEvent()
+  void PrecomputeMaxXSec (double Emin, double Emax, int nknots=100, int njobs=1);
+
   // Get validity range (combined validity range of loaded evg threads)
   Range1D_t ValidEnergyRange (void) const;
 
@@ -111,21 +133,24 @@ private:
   void CleanUp                      (void);
   void BuildInitialState            (const InitialState & init_state);
   void BuildGeneratorList           (void);
-  void BuildInteractionGeneratorMap (void);
   void BuildInteractionSelector     (void);
   void AssertIsValidInitState       (void) const;
+  void DiscardRecord                (EventRecord * evrec);
 
   // Private data members
   InitialState *            fInitState;       ///< initial state information for driver instance
   EventRecord *             fCurrentRecord;   ///< ptr to the event record being processed
-  EventGeneratorList *      fEvGenList;       ///< all Event Generators available at this job
+  const EventGeneratorList * fEvGenList;      ///< all Event Generators available at this job
+  bool                      fOwnsEvGenList;   ///< fEvGenList assembled by this driver (rather than shared)?
   InteractionSelectorI *    fIntSelector;     ///< interaction selector
   InteractionGeneratorMap * fIntGenMap;       ///< interaction -> generator assosiative container
   TBits *                   fUnphysEventMask; ///< controls whether unphysical events are returned
   bool                      fUseSplines;      ///< controls whether xsecs are computed or interpolated
   Spline *                  fXSecSumSpl;      ///< sum{xsec(all interactions | this init state)}
-  unsigned int              fNRecLevel;       ///< recursive mode depth counter
+  unsigned int              fNRecLevel;       ///< counter of tries to generate a physical event
+  bool                      fFilteredOut;     ///< was the last event rejected by the event filter?
   string                    fEventGenList;    ///< list of event generators loaded by this driver (what used to be the $GEVGL setting)
+  EventRecordPool *         fRecordPool;      ///< recycled event records (not owned), if used
 };
 
 }      // genie namespace
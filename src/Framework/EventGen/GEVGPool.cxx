@@ -49,9 +49,31 @@ GEVGPool::~GEVGPool()
 //___________________________________________________________________________
 GEVGDriver * GEVGPool::FindDriver(const InitialState & init) const
 {
-  string str_init = init.AsString();
+  return this->FindDriver(init.Key(), init);
+}
+//___________________________________________________________________________
+GEVGDriver * GEVGPool::FindDriver(int nu_pdgc, int tgt_pdgc) const
+{
+  ULong64_t key = InitialState::Key(tgt_pdgc, nu_pdgc);
+
+  map<ULong64_t, GEVGDriver *>::const_iterator kiter = fKeyIndex.find(key);
+  if(kiter != fKeyIndex.end()) return kiter->second;
+
+  InitialState init(tgt_pdgc, nu_pdgc);
+  return this->FindDriver(key, init);
+}
+//___________________________________________________________________________
+GEVGDriver * GEVGPool::FindDriver(ULong64_t key, const InitialState & init) const
+{
+  map<ULong64_t, GEVGDriver *>::const_iterator kiter = fKeyIndex.find(key);
+  if(kiter != fKeyIndex.end()) return kiter->second;
 
-  return this->FindDriver(str_init);
+  // Not looked-up before: use the string key & remember the association
+  GEVGDriver * driver = this->FindDriver(init.AsString());
+  if(driver) {
+    fKeyIndex.insert(map<ULong64_t, GEVGDriver *>::value_type(key,driver));
+  }
+  return driver;
 }
 //___________________________________________________________________________
 GEVGDriver * GEVGPool::FindDriver(string init) const
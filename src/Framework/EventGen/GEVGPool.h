@@ -23,6 +23,8 @@
 #include <string>
 #include <ostream>
 
+#include <Rtypes.h>
+
 using std::map;
 using std::string;
 using std::ostream;
@@ -42,12 +44,21 @@ public :
   GEVGPool();
   ~GEVGPool();
 
-  GEVGDriver * FindDriver (const InitialState & init) const;
-  GEVGDriver * FindDriver (string init)               const;
+  GEVGDriver * FindDriver (const InitialState & init)  const;
+  GEVGDriver * FindDriver (int nu_pdgc, int tgt_pdgc)  const;
+  GEVGDriver * FindDriver (string init)                const;
 
   void Print (ostream & stream) const;
 
   friend ostream & operator << (ostream & stream, const GEVGPool & pool);
+
+private:
+
+  GEVGDriver * FindDriver (ULong64_t key, const InitialState & init) const;
+
+  //! InitialState::Key() -> driver index, filled lazily by FindDriver() so
+  //! that the string key is only built the first time an init state is looked up
+  mutable map<ULong64_t, GEVGDriver *> fKeyIndex;
 };
 
 }      // genie namespace
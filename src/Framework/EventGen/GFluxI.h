@@ -19,6 +19,9 @@
    GFluxI::GenerateWeighted methods needed so that can be used with the new 
    pre-generation of flux interaction probabilities functionality added to
    GMCJDriver. 
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the optional GFluxI::SetEnergyBias and GFluxI::BiasWeight methods
+   used by the importance sampling mode of GMCJDriver.
 
 */
 //____________________________________________________________________________
@@ -29,6 +32,7 @@
 #include <TObject.h>
 
 class TLorentzVector;
+class TH1D;
 
 namespace genie {
 
@@ -54,6 +58,25 @@ public :
   virtual void                   Clear            (Option_t * opt   ) = 0; ///< reset state variables based on opt
   virtual void                   GenerateWeighted (bool gen_weighted) = 0; ///< set whether to generate weighted or unweighted neutrinos
 
+  //
+  // optional importance sampling support:
+  // a driver supporting it generates the neutrinos of the input species
+  // from its spectrum multiplied by the input bias = f(Ev) (a null bias
+  // restores the unbiased spectrum) and reports, for each neutrino, the
+  // compensating weight (unbiased / biased pdf) via BiasWeight().
+  // The default implementation does not support it.
+  //
+  virtual bool                   SetEnergyBias (int /*nu_pdgc*/, const TH1D * /*bias*/) { return false; } ///< bias the energy spectrum of nu_pdgc (false if not supported)
+  virtual double                 BiasWeight    (void) { return 1.; } ///< compensating weight of the current flux neutrino
+
+  //
+  // optional: a driver whose flux neutrinos of given Index() always have the
+  // same 4-position & direction (eg fixed rays read from a flux ntuple, that
+  // is cycled or whose entries are re-used) can declare it, so that the path
+  // lengths of each ray can be cached (see GMCJDriver::CachePathLengths())
+  //
+  virtual bool                   FixedRays     (void) { return false; } ///< same ray for the same Index()?
+
 protected:
   GFluxI();
 };
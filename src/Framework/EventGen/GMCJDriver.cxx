@@ -100,36 +100,187 @@
 //____________________________________________________________________________
 
 #include <cassert>
-
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <sstream>
+#include <iomanip>
+
+#include <RVersion.h>
+#include <TROOT.h>
 #include <TVector3.h>
 #include <TSystem.h>
 #include <TStopwatch.h>
+#include <TAxis.h>
+#include <TNamed.h>
+#include <TParameter.h>
+#include <TDirectory.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/EventGen/EventGeneratorList.h"
+#include "Framework/EventGen/EventGeneratorListAssembler.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/EventGen/GMCJEventSinkI.h"
+#include "Framework/EventGen/GMCJWorkerFactoryI.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/EventGen/GEVGPool.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GeomAnalyzerI.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Interaction/InitialState.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
+#include "Framework/Numerical/SplineBank.h"
 #include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/InitTimingStats.h"
+#include "Framework/Utils/MemoryStats.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/TuneId.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Conventions/Constants.h"
 
+using std::vector;
+using std::sort;
+using std::lower_bound;
+using std::upper_bound;
+using std::ostringstream;
+using std::setprecision;
+using std::setfill;
+using std::setw;
+
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace {
+  // State shared by the worker threads of GMCJDriver::GenerateEvents()
+  struct GMCJThreadPool {
+    GMCJWorkerFactoryI *  factory;
+    long int              nev;
+    Long64_t              first_event; ///< index of the first event
+    std::atomic<long int> nrequested;
+    std::atomic<long int> ngenerated;
+    std::mutex            handler_lock;
+  };
+
+  void GMCJWorkerLoop(
+     GMCJThreadPool * pool, GMCJDriver * worker, int ithread, long int seed)
+  {
+    // Thread-private singletons: the random number sequence, the record of
+    // the running event generation thread and the cache of each worker must
+    // not be seen by the others
+    RandomGen::CreateThreadInstance(seed);
+    RunningThreadInfo::CreateThreadInstance();
+    Cache::CreateThreadInstance();
+
+    long int ievent = 0;
+    while((ievent = pool->nrequested.fetch_add(1)) < pool->nev) {
+      worker->SetEventIndex(pool->first_event + ievent);
+      EventRecord * event = worker->GenerateEvent();
+      if(!event) {
+        // flux driver exhausted (or in error): stop this worker
+        LOG("GMCJDriver", pNOTICE) 
+          << "Worker thread " << ithread << " stopped generating events";
+        break;
+      }
+      pool->ngenerated.fetch_add(1);
+      std::lock_guard<std::mutex> guard(pool->handler_lock);
+      pool->factory->HandleEvent(ithread, event, *worker);
+    }
+
+    Cache::DeleteThreadInstance();
+    RunningThreadInfo::DeleteThreadInstance();
+    RandomGen::DeleteThreadInstance();
+  }
+
+  // Energy grid refinement & max. merged bin size (in fine bins) used for
+  // the adaptive binning of the probability scales
+  const int kPmaxRefine   = 8;
+  const int kPmaxMaxMerge = 64;
+
+  // Total cross sections needed by GMCJDriver::ComputeProbScales(), filled
+  // by one or more threads (each taking every nthreads-th energy)
+  struct GMCJProbScaleTask {
+    const vector<const Spline*> * xsec_splines; // [inu * nmat + imat]
+    const vector<double> *        plmax;        // [imat]
+    const vector<double> *        energies;     // [ie]
+    unsigned int                  nnu;
+    unsigned int                  nmat;
+    vector<double>                xsec;         // [(inu * nE + ie) * nmat + imat]
+  };
+
+  void GMCJProbScaleLoop(GMCJProbScaleTask * task, int ithread, int nthreads)
+  {
+    unsigned int nE   = task->energies->size();
+    unsigned int nmat = task->nmat;
+
+    // the (sorted) energies handled by this thread
+    vector<unsigned int> ie_thread;
+    vector<double>       E_thread;
+    for(unsigned int ie = ithread; ie < nE; ie += nthreads) {
+      ie_thread.push_back(ie);
+      E_thread.push_back((*task->energies)[ie]);
+    }
+    unsigned int n = E_thread.size();
+    if(n == 0) return;
+
+    // evaluate each spline at all energies at once
+    vector<double> xsec(n);
+    for(unsigned int inu = 0; inu < task->nnu; inu++) {
+      for(unsigned int imat = 0; imat < nmat; imat++) {
+        // no need to evaluate for materials that can not be reached
+        if((*task->plmax)[imat] <= 0.) continue;
+        const Spline * spl = (*task->xsec_splines)[inu*nmat + imat];
+        spl->Evaluate(&E_thread[0], &xsec[0], n);
+        for(unsigned int i = 0; i < n; i++) {
+          task->xsec[(inu*nE + ie_thread[i])*nmat + imat] = xsec[i];
+        }
+      }
+    }
+  }
+
+  // values stored per flux entry by GMCJDriver::ScanFluxIntProbs()
+  const unsigned int kNFluxIntVars = 5;
+
+  // Installs the random number generator of a driver (if any) as the
+  // instance of the calling thread while the driver generates events
+  class GMCJRandomGenGuard {
+  public:
+    GMCJRandomGenGuard(RandomGen * rnd) :
+      fRandomGen(rnd), fPrevious(rnd ? RandomGen::SetThreadInstance(rnd) : 0) { }
+   ~GMCJRandomGenGuard() { if(fRandomGen) RandomGen::SetThreadInstance(fPrevious); }
+  private:
+    RandomGen * fRandomGen;
+    RandomGen * fPrevious;
+  };
+
+  // FNV-1a hash of the input string, as a hex string
+  string GMCJHash(const string & str)
+  {
+    ULong64_t hash = 0xcbf29ce484222325ULL;
+    for(unsigned int i = 0; i < str.size(); i++) {
+      hash ^= (unsigned char) str[i];
+      hash *= 0x100000001b3ULL;
+    }
+    ostringstream hash_str;
+    hash_str << std::hex << setfill('0') << setw(16) << hash;
+    return hash_str.str();
+  }
+}
+
 //____________________________________________________________________________
 GMCJDriver::GMCJDriver()
 {
@@ -140,6 +291,18 @@ GMCJDriver::~GMCJDriver()
 {
   if(fUnphysEventMask) delete fUnphysEventMask;
   if (fGPool) delete fGPool;
+  if (fPrivateEvGenList) delete fPrivateEvGenList;
+  if (fRecordPool) delete fRecordPool;
+  if (fRandomGen) RandomGen::DeleteInstance(fRandomGen);
+
+  this->ClearPreSelection();
+
+  if(fNPathLengthCacheHits > 0) {
+    LOG("GMCJDriver", pNOTICE)
+      << "Path lengths of " << fPathLengthCache.size() << " flux rays were "
+      << "cached, saving " << fNPathLengthCacheHits << " geometry navigations";
+  }
+  fPathLengthCache.clear();
 
   map<int,TH1D*>::iterator pmax_iter = fPmax.begin();
   for( ; pmax_iter != fPmax.end(); ++pmax_iter) {
@@ -154,6 +317,11 @@ GMCJDriver::~GMCJDriver()
   if(fFluxIntProbFile) delete fFluxIntProbFile;
 }
 //___________________________________________________________________________
+void GMCJDriver::UseWorkerFactory(GMCJWorkerFactoryI * factory)
+{
+  fWorkerFactory = factory;
+}
+//___________________________________________________________________________
 void GMCJDriver::SetEventGeneratorList(string listname)
 {
   LOG("GMCJDriver", pNOTICE)
@@ -174,11 +342,13 @@ void GMCJDriver::SetUnphysEventMask(const TBits & mask)
 void GMCJDriver::UseFluxDriver(GFluxI * flux_driver)
 {
   fFluxDriver = flux_driver;
+  fPathLengthCache.clear();
 }
 //___________________________________________________________________________
 void GMCJDriver::UseGeomAnalyzer(GeomAnalyzerI * geom_analyzer)
 {
   fGeomAnalyzer = geom_analyzer;
+  fPathLengthCache.clear();
 }
 //___________________________________________________________________________
 void GMCJDriver::UseSplines(bool useLogE)
@@ -245,6 +415,8 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
 // already been loaded then just returns true. Also save tree to a TFile
 // for use in later jobs if flag is set 
 //
+  InitTimingScope timing("GMCJDriver::PreCalcFluxProbabilities");
+
   bool success = true;
  
   bool save_to_file = fFluxIntProbFile == 0 && fFluxIntFileName.size()>0;
@@ -281,63 +453,77 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
     // Associate to file otherwise get std::bad_alloc when writing large trees 
     if(save_to_file) fFluxIntTree->SetDirectory(fFluxIntProbFile); 
  
-    fFluxDriver->GenerateWeighted(true);
-  
     fGlobPmax = 1.0; // Force ComputeInteractionProbabilities to return absolute value
   
+    int nthreads = fNFluxProbThreads;
+    if(nthreads > 1 && !fWorkerFactory) {
+      LOG("GMCJDriver", pWARN) 
+        << "No GMCJWorkerFactoryI was set (see UseWorkerFactory()) - "
+        << "Computing the flux interaction probabilities serially";
+      nthreads = 1;
+    }
+
     // Loop over flux entries and calculate interaction probabilities
     TStopwatch stopwatch; 
     stopwatch.Start();
-    long int first_index = -1;
-    bool first_loop = true;
-    // loop until at end of flux ntuple
-    while(fFluxDriver->End() == false){ 
-
-      // get the next flux neutrino
-      bool gotnext = fFluxDriver->GenerateNext(); 
-      if(!gotnext){
-        LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
-        continue;
+    vector<double> entries;
+    if(nthreads <= 1) {
+      success = this->ScanFluxIntProbs(0, 1, entries);
+    }
+    else {
+      LOG("GMCJDriver", pNOTICE) 
+        << "Computing the flux interaction probabilities using " 
+        << nthreads << " threads";
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+      ROOT::EnableThreadSafety();
+#endif
+      // each worker, with its own flux & geometry drivers, goes through a
+      // full flux cycle and traces 1/nthreads of the flux entries
+      vector<GMCJDriver *> workers;
+      for(int ithread = 0; ithread < nthreads; ithread++) {
+        workers.push_back( this->CreateWorker(ithread, false) );
       }
-
-      // stop if completed a full cycle (this check is necessary as fluxdriver
-      // may be set to loop over more than one cycle before reaching end) 
-      bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
-      if(already_been_here) break; 
-   
-      // compute the path lengths for current flux neutrino 
-      if(this->ComputePathLengths() == false){ success = false; break;}
-  
-      // compute and store the interaction probability 
-      double psum = this->ComputeInteractionProbabilities(false /*Based on actual PLs*/);
-      assert(psum+controls::kASmallNum > 0.);
-      fBrFluxIntProb = psum;
-      fBrFluxIndex   = fFluxDriver->Index();
-      fBrFluxEnu     = fFluxDriver->Momentum().E();
-      fBrFluxWeight  = fFluxDriver->Weight();
-      fBrFluxPDG     = fFluxDriver->PdgCode();
-      fFluxIntTree->Fill();
-
-      // store the first index so know when have cycled exactly once
-      if(first_loop){
-        first_index = fFluxDriver->Index();
-        first_loop = false;
+      vector< vector<double> > wentries(nthreads);
+      vector<int>              wsuccess(nthreads, 0);
+      vector<std::thread>      threads;
+      for(int ithread = 0; ithread < nthreads; ithread++) {
+        threads.push_back( std::thread( 
+          [&workers, &wentries, &wsuccess, ithread, nthreads] {
+            wsuccess[ithread] = 
+              workers[ithread]->ScanFluxIntProbs(ithread, nthreads, wentries[ithread]);
+          } ) );
       }
-    } // flux loop
+      for(int ithread = 0; ithread < nthreads; ithread++) {
+        threads[ithread].join();
+        success = success && wsuccess[ithread];
+        entries.insert(entries.end(), wentries[ithread].begin(), wentries[ithread].end());
+        delete workers[ithread];
+      }
+    }
+    for(unsigned int i = 0; i + kNFluxIntVars <= entries.size(); i += kNFluxIntVars) {
+      fBrFluxIndex   = (int) entries[i];
+      fBrFluxIntProb = entries[i+1];
+      fBrFluxEnu     = entries[i+2];
+      fBrFluxWeight  = entries[i+3];
+      fBrFluxPDG     = (int) entries[i+4];
+      fFluxIntTree->Fill();
+    }
     stopwatch.Stop();            
     LOG("GMCJDriver", pNOTICE)
                     << "Finished pre-calculating flux interaction probabilities. "
                     << "Total CPU time to process "<< fFluxIntTree->GetEntries()
-                    << " entries: "<< stopwatch.CpuTime();
-
-    // reset the flux driver so can be used at next stage. N.B. This 
-    // should also reset flux driver to throw de-weighted flux neutrinos
-    fFluxDriver->Clear("CycleHistory");
+                    << " entries: "<< stopwatch.CpuTime()
+                    << " (real time: " << stopwatch.RealTime() << ")";
   }
 
   // If successfully calculated/loaded interaction probabilities then set global
   // probability scale and, if requested, save tree to output file
-  if(success){
+  if(success && fFluxSummaryLoaded){
+    LOG("GMCJDriver", pNOTICE) <<
+        "Using the global probability scale & flux interaction probability "
+        "sums of the pre-generated file: fGlobPmax = "<< fGlobPmax; 
+  }
+  else if(success){
     fGlobPmax = 0.0;
     double safety_factor = 1.01;
     for(int i = 0; i< fFluxIntTree->GetEntries(); i++){
@@ -362,6 +548,7 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
           fFluxIntProbFile->GetName();
       fFluxIntProbFile->cd();
       fFluxIntTree->Write();
+      this->WriteFluxSummary();
     }
 
     // Also build index for use later
@@ -381,6 +568,7 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
   else if(fFluxIntTree){ 
     delete fFluxIntTree; 
     fFluxIntTree = 0;
+    fFluxSummaryLoaded = false;
   }
   
   // Return whether have successfully pre-calculated flux interaction probabilities
@@ -393,7 +581,12 @@ bool GMCJDriver::LoadFluxProbabilities(string filename)
 // file. This is recommended when using large flux files (>100k entries) as  
 // for these the time to calculate the interaction probabilities can exceed 
 // ~20 minutes. After loading the input tree we call PreCalcFluxProbabilities
-// to check that has successfully loaded
+// to check that has successfully loaded.
+// Files written by SaveFluxProbabilities also keep a summary of the job
+// inputs (hashes of the flux neutrino list & max energy, of the target list
+// and of the total cross sections): such a file is rejected if it doesn't
+// match the current job. The stored global probability scale & flux
+// interaction probability sums are then used as is.
 //
   if(fFluxIntProbFile){
     LOG("GMCJDriver", pWARN) 
@@ -405,7 +598,13 @@ bool GMCJDriver::LoadFluxProbabilities(string filename)
 
   if(fFluxIntProbFile){
     fFluxIntTree = dynamic_cast<TTree*>(fFluxIntProbFile->Get(fFluxIntTreeName.c_str())); 
-    if(fFluxIntTree){
+    if(fFluxIntTree && !this->ReadFluxSummary()){
+      LOG("GMCJDriver", pERROR) 
+        << "The flux interaction probabilities in " << filename 
+        << " were not computed for the current job inputs!"; 
+      fFluxIntTree = 0;
+    }
+    else if(fFluxIntTree){
       bool set_addresses = 
         fFluxIntTree->SetBranchAddress("FluxIntProb", &fBrFluxIntProb) >= 0 &&
         fFluxIntTree->SetBranchAddress("FluxIndex", &fBrFluxIndex) >= 0 &&
@@ -424,6 +623,7 @@ bool GMCJDriver::LoadFluxProbabilities(string filename)
       LOG("GMCJDriver", pERROR) << 
           "Cannot find expected branches in input flux probability tree!"; 
       delete fFluxIntTree; fFluxIntTree = 0; 
+      fFluxSummaryLoaded = false;
     }
     else LOG("GMCJDriver", pERROR) 
           << "Cannot find tree: "<< fFluxIntTreeName.c_str();
@@ -443,56 +643,350 @@ void GMCJDriver::SaveFluxProbabilities(string outfilename)
   fFluxIntFileName = outfilename;
 }
 //___________________________________________________________________________
-void GMCJDriver::Configure(bool calc_prob_scales)
+void GMCJDriver::SetFluxProbThreads(int nthreads)
+{
+// Number of threads computing the flux interaction probabilities at 
+// PreCalcFluxProbabilities(). Each thread uses its own flux & geometry 
+// drivers, obtained from the worker factory (see UseWorkerFactory()).
+//
+  fNFluxProbThreads = TMath::Max(1, nthreads);
+}
+//___________________________________________________________________________
+bool GMCJDriver::ScanFluxIntProbs(
+                     int ithread, int nthreads, vector<double> & entries)
+{
+// Loop over a complete cycle of flux entries and compute the interaction 
+// probability of the entries with index % nthreads == ithread. For each
+// one, the flux index, interaction probability, energy, weight & PDG code
+// (kNFluxIntVars values) are appended to the input vector.
+//
+  fFluxDriver->GenerateWeighted(true);
+
+  bool success = true;
+  long int first_index = -1;
+  bool first_loop = true;
+  // loop until at end of flux ntuple
+  while(fFluxDriver->End() == false){ 
+
+    // get the next flux neutrino
+    bool gotnext = fFluxDriver->GenerateNext(); 
+    if(!gotnext){
+      LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
+      continue;
+    }
+
+    // stop if completed a full cycle (this check is necessary as fluxdriver
+    // may be set to loop over more than one cycle before reaching end) 
+    long int index = fFluxDriver->Index();
+    bool already_been_here = first_loop ? false : first_index == index;
+    if(already_been_here) break; 
+
+    // store the first index so know when have cycled exactly once
+    if(first_loop){
+      first_index = index;
+      first_loop = false;
+    }
+
+    // entry left to another thread
+    if(index % nthreads != ithread) continue;
+ 
+    // compute the path lengths for current flux neutrino 
+    if(this->ComputePathLengths() == false){ success = false; break;}
+
+    // compute and store the interaction probability 
+    double psum = this->ComputeInteractionProbabilities(false /*Based on actual PLs*/);
+    assert(psum+controls::kASmallNum > 0.);
+    entries.push_back( index );
+    entries.push_back( psum );
+    entries.push_back( fFluxDriver->Momentum().E() );
+    entries.push_back( fFluxDriver->Weight() );
+    entries.push_back( fFluxDriver->PdgCode() );
+  } // flux loop
+
+  // reset the flux driver so can be used at next stage. N.B. This 
+  // should also reset flux driver to throw de-weighted flux neutrinos
+  fFluxDriver->Clear("CycleHistory");
+
+  return success;
+}
+//___________________________________________________________________________
+void GMCJDriver::FluxProbHashes(
+              string & flux_hash, string & geom_hash, string & tune_hash) const
+{
+// Hashes of the inputs the flux interaction probabilities depend on, other
+// than the flux entries themselves (checked entry by entry, see 
+// PreGenFluxInteractionProbability): the flux neutrino species & max. energy,
+// the geometry target list, and the tune & total cross sections
+
+  ostringstream flux;
+  flux << setprecision(17) << fEmax << ";";
+  for(unsigned int inu = 0; inu < fNuList.size(); inu++) {
+    flux << fNuList[inu] << ";";
+  }
+
+  ostringstream geom;
+  for(unsigned int itgt = 0; itgt < fTgtList.size(); itgt++) {
+    geom << fTgtList[itgt] << ";";
+  }
+
+  string prob_scale_flux_hash, prob_scale_geom_hash;
+  this->ProbScaleHashes(prob_scale_flux_hash, prob_scale_geom_hash, tune_hash);
+
+  flux_hash = GMCJHash(flux.str());
+  geom_hash = GMCJHash(geom.str());
+}
+//___________________________________________________________________________
+bool GMCJDriver::ReadFluxSummary(void)
+{
+// Check the summary of the pre-generated flux interaction probability file
+// against the current job and load the global probability scale & flux 
+// interaction probability sums. Files without a summary are accepted (and
+// the probability scale & sums recomputed from the tree).
+
+  fFluxSummaryLoaded = false;
+
+  string hash[3];
+  this->FluxProbHashes(hash[0], hash[1], hash[2]);
+  const char * hash_name[3] = { "FluxHash", "GeomHash", "TuneHash" };
+  for(int i = 0; i < 3; i++) {
+    TNamed * stored = dynamic_cast<TNamed *> (fFluxIntProbFile->Get(hash_name[i]));
+    if(!stored) {
+      LOG("GMCJDriver", pWARN) 
+        << "No job summary in " << fFluxIntProbFile->GetName() 
+        << " - Can't check that it matches the current job";
+      return true;
+    }
+    if(hash[i] != stored->GetTitle()) {
+      LOG("GMCJDriver", pWARN)
+        << "Flux interaction probabilities in " << fFluxIntProbFile->GetName()
+        << " don't match the current job (" << hash_name[i] << ")";
+      return false;
+    }
+  }
+
+  TParameter<double> * globpmax = 
+       dynamic_cast<TParameter<double> *> (fFluxIntProbFile->Get("GlobPmax"));
+  if(!globpmax) return true;
+
+  map<int, double> sums;
+  PDGCodeList::const_iterator nuiter;
+  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+    ostringstream name;
+    name << "SumFluxIntProb_" << *nuiter;
+    TParameter<double> * sum = 
+       dynamic_cast<TParameter<double> *> (fFluxIntProbFile->Get(name.str().c_str()));
+    if(sum) sums[*nuiter] = sum->GetVal();
+  }
+
+  fGlobPmax          = globpmax->GetVal();
+  fSumFluxIntProbs   = sums;
+  fFluxSummaryLoaded = true;
+
+  return true;
+}
+//___________________________________________________________________________
+void GMCJDriver::WriteFluxSummary(void) const
+{
+// Write the job summary (see ReadFluxSummary) to the current directory
+
+  string flux_hash, geom_hash, tune_hash;
+  this->FluxProbHashes(flux_hash, geom_hash, tune_hash);
+  TNamed("FluxHash", flux_hash.c_str()).Write();
+  TNamed("GeomHash", geom_hash.c_str()).Write();
+  TNamed("TuneHash", tune_hash.c_str()).Write();
+  TParameter<double>("GlobPmax", fGlobPmax).Write();
+
+  map<int, double>::const_iterator sum_iter = fSumFluxIntProbs.begin();
+  for( ; sum_iter != fSumFluxIntProbs.end(); ++sum_iter) {
+    ostringstream name;
+    name << "SumFluxIntProb_" << sum_iter->first;
+    TParameter<double>(name.str().c_str(), sum_iter->second).Write();
+  }
+}
+//___________________________________________________________________________
+void GMCJDriver::UseAdaptiveProbScales(double tolerance)
+{
+// Compute the probability scales in variable-size energy bins: fine bins
+// where the max. interaction probability changes quickly (eg. near process
+// thresholds) and coarse ones where it is flat (within the input relative
+// tolerance). This reduces the number of flux neutrinos needed per event.
+//
+  fAdaptivePmax    = true;
+  fAdaptivePmaxTol = TMath::Max(0., tolerance);
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Using adaptive energy binning for the probability scales "
+    << "(tolerance: " << fAdaptivePmaxTol << ")";
+}
+//___________________________________________________________________________
+void GMCJDriver::SetProbScaleThreads(int nthreads)
+{
+// Number of threads used for evaluating the total cross sections needed
+// for the probability scales at initialization
+
+  fNProbScaleThreads = TMath::Max(1, nthreads);
+}
+//___________________________________________________________________________
+void GMCJDriver::SetDriverPoolThreads(int nthreads)
+{
+// Number of threads used for building the interaction lists (and checking
+// the cross section splines) of the GEVGPool drivers at initialization
+
+  fNPoolThreads = TMath::Max(1, nthreads);
+}
+//___________________________________________________________________________
+void GMCJDriver::PrecomputeMaxXSec(int nknots, int njobs)
+{
+// Precompute at Configure(), for all interactions and up to the max. flux
+// energy, the max{dxsec/dK} values used by the kinematics generators instead
+// of computing them on the fly during the first events. The envelopes are
+// added to the cache, so that they can be reused by later jobs via a cache
+// file (see genie::Cache), with njobs processes used for the computation
+
+  fPrecompMaxXSec       = true;
+  fPrecompMaxXSecNKnots = TMath::Max(2, nknots);
+  fPrecompMaxXSecNJobs  = TMath::Max(1, njobs);
+}
+//___________________________________________________________________________
+void GMCJDriver::LoadProbScales(string filename)
+{
+// Reuse the probability scales saved by an earlier job (see SaveProbScales).
+// They are reloaded at Configure() only if they were computed for the same
+// flux neutrinos & max. energy, geometry max. path lengths and cross section
+// tune. Otherwise they are computed as usual.
+//
+  fProbScalesInFile = filename;
+}
+//___________________________________________________________________________
+void GMCJDriver::SaveProbScales(string outfilename)
+{
+// Save the probability scales computed at Configure() for use in later jobs
+
+  fProbScalesOutFile = outfilename;
+}
+//___________________________________________________________________________
+void GMCJDriver::UseImportanceSampling(bool on)
 {
+// Importance sampling of the flux neutrinos: the flux driver is asked to
+// generate the neutrinos of each species from its spectrum multiplied by
+// the max. interaction probability (sum over materials of total xsec x max.
+// path length) = f(Ev), ie the probability scale of the weighted mode, and
+// the compensating flux weight is folded into the EventRecord weight.
+// Flux neutrinos are then thrown where they are likely to interact, instead
+// of being rejected in the low energy tail, and the event weights are
+// constant (the summed weights normalize as in the unbiased weighted mode).
+// Requires the per-energy probability scales (no ForceSingleProbScale())
+// and a flux driver supporting GFluxI::SetEnergyBias(); otherwise event
+// generation is unbiased.
+//
+  fImportanceSampling = on;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Importance sampling of the flux neutrinos? : "
+    << utils::print::BoolAsYNString(on);
+}
+//___________________________________________________________________________
+void GMCJDriver::CachePathLengths(long int max_entries)
+{
+// Caches the path lengths computed for the rays of a flux driver declaring
+// FixedRays() (eg GSimpleNtpFlux), keyed by the flux driver Index(): when a
+// flux ntuple is cycled, or its entries re-used, the geometry is navigated
+// only the first time each ray is thrown. The path lengths of at most
+// max_entries rays are kept (0 switches the caching off). The cache is
+// cleared whenever the flux driver or geometry analyzer is changed.
+//
+  fPathLengthCacheMax = TMath::Max(0L, max_entries);
+  fPathLengthCache.clear();
+
   LOG("GMCJDriver", pNOTICE)
-     << utils::print::PrintFramedMesg("Configuring GMCJDriver");
-
-  // Get the list of neutrino types from the input flux driver and the list
-  // of target materials from the input geometry driver
-  this->GetParticleLists();
-
-  // Ask the input GFluxI for the max. neutrino energy (to compute Pmax)
-  this->GetMaxFluxEnergy();
-
-  // Create all possible initial states and for each one initialize, 
-  // configure & store an GEVGDriver event generation driver object.
-  // Once an 'initial state' has been selected from the input flux / geom,
-  // the responsibility for generating the neutrino interaction will be
-  // delegated to one of these drivers.
-  this->PopulateEventGenDriverPool();
-
-  // If the user wants to use cross section splines in order to speed things
-  // up, then coordinate spline creation from all GEVGDriver objects pushed 
-  // into GEVGPool. This will create all xsec splines needed for all (enabled)
-  // processes that can be simulated involving the particles in the input flux 
-  // and geometry. 
-  // Spline creation will be skipped for every spline that has been pre-loaded 
-  // into the the XSecSplineList.
-  // Once more it is noted that computing cross section splines is a huge 
-  // overhead. The user is encouraged to generate them in advance and load
-  // them into the XSecSplineList
-  this->BootstrapXSecSplines();
-
-  // Create cross section splines describing the total interaction xsec
-  // for a given initial state (Create them by summing all xsec splines
-  // for each possible initial state)
-  this->BootstrapXSecSplineSummation();
-
-  if(calc_prob_scales){
-    // Ask the input geometry driver to compute the max. path length for each
-    // material in the list of target materials (or load a precomputed list)
-    this->GetMaxPathLengthList();
-
-    // Compute the max. interaction probability to scale all interaction
-    // probabilities to be computed by this driver
-    this->ComputeProbScales();
+    << "Caching the path lengths of (at most) " << fPathLengthCacheMax
+    << " fixed flux rays";
+}
+//___________________________________________________________________________
+void GMCJDriver::Configure(bool calc_prob_scales)
+{
+  {
+    InitTimingScope timing("GMCJDriver::Configure");
+
+    LOG("GMCJDriver", pNOTICE)
+       << utils::print::PrintFramedMesg("Configuring GMCJDriver");
+
+    // Get the list of neutrino types from the input flux driver and the list
+    // of target materials from the input geometry driver
+    this->GetParticleLists();
+
+    // Ask the input GFluxI for the max. neutrino energy (to compute Pmax)
+    this->GetMaxFluxEnergy();
+
+    // Create all possible initial states and for each one initialize, 
+    // configure & store an GEVGDriver event generation driver object.
+    // Once an 'initial state' has been selected from the input flux / geom,
+    // the responsibility for generating the neutrino interaction will be
+    // delegated to one of these drivers.
+    this->PopulateEventGenDriverPool();
+
+    // If the user wants to use cross section splines in order to speed things
+    // up, then coordinate spline creation from all GEVGDriver objects pushed 
+    // into GEVGPool. This will create all xsec splines needed for all (enabled)
+    // processes that can be simulated involving the particles in the input flux 
+    // and geometry. 
+    // Spline creation will be skipped for every spline that has been pre-loaded 
+    // into the the XSecSplineList.
+    // Once more it is noted that computing cross section splines is a huge 
+    // overhead. The user is encouraged to generate them in advance and load
+    // them into the XSecSplineList
+    this->BootstrapXSecSplines();
+
+    // Create cross section splines describing the total interaction xsec
+    // for a given initial state (Create them by summing all xsec splines
+    // for each possible initial state)
+    this->BootstrapXSecSplineSummation();
+
+    // Precompute the max{dxsec/dK} envelopes used for generating the event
+    // kinematics (if requested)
+    if(fPrecompMaxXSec) this->BootstrapMaxXSecEnvelopes();
+
+    // Index target materials and pre-resolve, per neutrino & material, the
+    // event generation drivers and total cross section splines used in the
+    // event loop
+    this->IndexMaterials();
+
+    if(calc_prob_scales){
+      // Ask the input geometry driver to compute the max. path length for each
+      // material in the list of target materials (or load a precomputed list)
+      this->GetMaxPathLengthList();
+      this->FillPathLengthArray(fMaxPathLengths, fMatMaxPL, false);
+
+      // Compute the max. interaction probability to scale all interaction
+      // probabilities to be computed by this driver (or load them, if they
+      // were saved by an earlier job with the same flux, geometry and tune)
+      this->ComputeProbScales();
+      this->IndexProbScales();
+
+      // Prepare the vectorized flux neutrino pre-selection
+      this->BuildPreSelection();
+
+      // Bias the flux driver spectra by the probability scales (if requested)
+      if(fImportanceSampling) this->BiasFluxDriver();
+    }
   }
+
   LOG("GMCJDriver", pNOTICE) << "Finished configuring GMCJDriver\n\n";
+
+  // report where the initialization time went
+  LOG("GMCJDriver", pNOTICE) << "\n" << *InitTimingStats::Instance();
+
+  // and, if requested, which tables the memory went to
+  if(RunOpt::Instance()->MemoryReport()) {
+    MemoryStats::Instance()->Poll();
+    LOG("GMCJDriver", pNOTICE) << "\n" << *MemoryStats::Instance();
+  }
 }
 //___________________________________________________________________________
 void GMCJDriver::InitJob(void)
 {
+  InitTimingScope timing("GMCJDriver::InitJob");
+
   fEventGenList       = "Default";  // <-- set of event generators to be loaded by this driver
 
   fUnphysEventMask = new TBits(GHepFlags::NFlags()); //<-- unphysical event mask
@@ -509,6 +1003,7 @@ void GMCJDriver::InitJob(void)
   fUseExtMaxPl        = false;
   fUseSplines         = false;
   fNFluxNeutrinos     = 0;     // <-- number of flux neutrinos thrown so far
+  fEventIndex         = 0;     // <-- index of the next event
 
   fGlobPmax           = 0;     // <-- maximum interaction probability (global prob scale)
   fPmax.clear();               // <-- maximum interaction probability per neutrino & per energy bin
@@ -518,6 +1013,7 @@ void GMCJDriver::InitJob(void)
 
   fSelTgtPdg          = 0;
   fCurEvt             = 0;
+  fCurEvtFilteredOut  = false;
   fCurVtx.SetXYZT(0.,0.,0.,0.);
 
   fFluxIntProbFile    = 0; 
@@ -530,6 +1026,29 @@ void GMCJDriver::InitJob(void)
   fBrFluxWeight       = -1.;
   fBrFluxPDG          = 0;
   fSumFluxIntProbs.clear();
+  fFluxSummaryLoaded  = false;
+  fNFluxProbThreads   = 1;
+
+  fWorkerFactory      = 0;
+  fRecordPool         = new EventRecordPool; // <-- event records given back by the client, for re-use
+  fRandomGen          = 0;     // <-- default to the running thread's random number generator
+  fPrivateAlgorithms  = false; // <-- use the event generators of the AlgFactory pool
+  fPrivateEvGenList   = 0;
+
+  fAdaptivePmax       = false; // <-- default to fixed energy bins for the probability scales
+  fAdaptivePmaxTol    = 0.05;
+  fNProbScaleThreads  = 1;
+  fNPoolThreads       = 1;
+  fPrecompMaxXSec       = false; // <-- default to compute the max{dxsec/dK} values on the fly
+  fPrecompMaxXSecNKnots = 100;
+  fPrecompMaxXSecNJobs  = 1;
+  fProbScalesInFile   = "";
+  fProbScalesOutFile  = "";
+  fImportanceSampling = false; // <-- default to sample the flux neutrinos from the unbiased flux
+  fFluxBiased         = false;
+  fPathLengthCacheMax = 0;     // <-- default to compute the path lengths of every flux neutrino
+  fPathLengthCache.clear();
+  fNPathLengthCacheHits = 0;
 
   // Throw as many flux neutrinos as necessary till one has interacted
   // so that GenerateEvent() never  returns NULL (except when in error)
@@ -555,10 +1074,28 @@ void GMCJDriver::InitJob(void)
   // Clear the maximum path length list
   fMaxPathLengths.clear();
   fCurPathLengths.clear();
+
+  // Clear the material-indexed arrays
+  fCurCumulProb.clear();
+  fCurPL.clear();
+  fPreSelBanks.clear();
+  fPreSelFirstBank.clear();
+  fPreSelFirstCoef.clear();
+  fPreSelCoef.clear();
+  fPreSelXSec.clear();
+  fPreSelBanked = false;
+  fMatPdg.clear();
+  fMatA.clear();
+  fMatMaxPL.clear();
+  fMatDrivers.clear();
+  fMatXSecSum.clear();
+  fNuPmax.clear();
 }
 //___________________________________________________________________________
 void GMCJDriver::GetParticleLists(void)
 {
+  InitTimingScope timing("GMCJDriver::GetParticleLists");
+
   // Get the list of flux neutrinos from the flux driver
   LOG("GMCJDriver", pNOTICE)
                     << "Asking the flux driver for its list of neutrinos";
@@ -576,6 +1113,8 @@ void GMCJDriver::GetParticleLists(void)
 //___________________________________________________________________________
 void GMCJDriver::GetMaxPathLengthList(void)
 {
+  InitTimingScope timing("GMCJDriver::GetMaxPathLengthList");
+
   if(fUseExtMaxPl) {
      LOG("GMCJDriver", pNOTICE)
        << "Loading external max path-length list for input geometry from "
@@ -604,11 +1143,33 @@ void GMCJDriver::GetMaxFluxEnergy(void)
 //___________________________________________________________________________
 void GMCJDriver::PopulateEventGenDriverPool(void)
 {
+  InitTimingScope timing("GMCJDriver::PopulateEventGenDriverPool");
+
   LOG("GMCJDriver", pDEBUG)
        << "Creating GEVGPool & adding a GEVGDriver object per init-state";
 
   if (fGPool) delete fGPool;
   fGPool = new GEVGPool;
+  if (fPrivateEvGenList) delete fPrivateEvGenList;
+  fPrivateEvGenList = 0;
+
+  // The drivers are set up serially, as this instantiates & configures
+  // algorithms, except for their interaction -> generator maps (the bulk of
+  // the work) which are then built by fNPoolThreads threads. The event
+  // generator list does not depend on the initial state: all the drivers
+  // share the one assembled by the first driver (or, with private
+  // algorithms, the private copies of the generators made here).
+  vector<GEVGDriver *>       drivers;
+  const EventGeneratorList * evglist = 0;
+
+  if(fPrivateAlgorithms) {
+    LOG("GMCJDriver", pNOTICE)
+      << "Using private copies of the event generators";
+    EventGeneratorListAssembler evglist_assembler(fEventGenList.c_str());
+    fPrivateEvGenList = evglist_assembler.AssembleGeneratorList();
+    fPrivateEvGenList->AdoptGenerators();
+    evglist = fPrivateEvGenList;
+  }
 
   PDGCodeList::const_iterator nuiter;
   PDGCodeList::const_iterator tgtiter;
@@ -627,14 +1188,46 @@ void GMCJDriver::PopulateEventGenDriverPool(void)
 
      GEVGDriver * evgdriver = new GEVGDriver;
      evgdriver->SetEventGeneratorList(fEventGenList); // specify list of generators
-     evgdriver->Configure(init_state);
-     evgdriver->UseSplines(); // check if all splines needed are loaded
+     if(evglist) evgdriver->UseGeneratorList(evglist);
+     evgdriver->Configure(init_state, false);
+     evgdriver->UseRecordPool(fRecordPool);
+     evglist = evgdriver->EventGenerators();
+     drivers.push_back(evgdriver);
 
      LOG("GMCJDriver", pDEBUG) << "Adding new GEVGDriver object to GEVGPool";
      fGPool->insert( GEVGPool::value_type(init_state.AsString(), evgdriver) );
    } // targets
   } // neutrinos
 
+  // build the interaction lists & check that all the splines needed are
+  // loaded
+  int nthreads = TMath::Min(fNPoolThreads, (int) drivers.size());
+  if(nthreads <= 1) {
+    for(unsigned int i = 0; i < drivers.size(); i++) {
+      drivers[i]->BuildInteractionGeneratorMap();
+      drivers[i]->UseSplines();
+    }
+  } else {
+    LOG("GMCJDriver", pNOTICE)
+      << "Building the interaction lists of " << drivers.size()
+      << " drivers using " << nthreads << " threads";
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+    ROOT::EnableThreadSafety();
+#endif
+    std::atomic<unsigned int> next(0);
+    vector<std::thread> threads;
+    for(int ithread = 0; ithread < nthreads; ithread++) {
+      threads.push_back( std::thread( [&drivers, &next] {
+          unsigned int i = 0;
+          while((i = next.fetch_add(1)) < drivers.size()) {
+            drivers[i]->BuildInteractionGeneratorMap();
+            drivers[i]->UseSplines();
+          }
+        } ) );
+    }
+    for(int ithread = 0; ithread < nthreads; ithread++) threads[ithread].join();
+  }
+
   LOG("GMCJDriver", pNOTICE)
              << "All necessary GEVGDriver object were pushed into GEVGPool\n";
 }
@@ -644,8 +1237,15 @@ void GMCJDriver::BootstrapXSecSplines(void)
 // Bootstrap cross section spline generation by the event generation drivers
 // that handle each initial state.
 
+  InitTimingScope timing("GMCJDriver::BootstrapXSecSplines");
+
   if(!fUseSplines) return;
 
+  // Let a lazily loaded spline list know which initial states are needed, so
+  // that only the corresponding splines are decoded (and before any event
+  // generation thread starts)
+  XSecSplineList::Instance()->DeclareInitialStates(fNuList, fTgtList);
+
   LOG("GMCJDriver", pNOTICE) 
     << "Asking event generation drivers to compute all needed xsec splines";
 
@@ -671,6 +1271,8 @@ void GMCJDriver::BootstrapXSecSplineSummation(void)
 // Sum-up the cross section splines for all the interaction that can be
 // simulated for each initial state
 
+  InitTimingScope timing("GMCJDriver::BootstrapXSecSplineSummation");
+
   LOG("GMCJDriver", pNOTICE)
     << "Summing-up splines to get total cross section for each init state";
 
@@ -702,6 +1304,36 @@ void GMCJDriver::BootstrapXSecSplineSummation(void)
      << "Finished summing all interaction xsec splines per initial state";
 }
 //___________________________________________________________________________
+void GMCJDriver::BootstrapMaxXSecEnvelopes(void)
+{
+// Precompute the max{dxsec/dK} envelopes for all the interactions that can
+// be simulated for each initial state, up to the maximum flux energy
+
+  InitTimingScope timing("GMCJDriver::BootstrapMaxXSecEnvelopes");
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Precomputing the max{dxsec/dK} envelopes for each init state";
+
+  GEVGPool::iterator diter;
+  for(diter = fGPool->begin(); diter != fGPool->end(); ++diter) {
+    string       init_state = diter->first;
+    GEVGDriver * evgdriver  = diter->second;
+    assert(evgdriver);
+    LOG("GMCJDriver", pNOTICE)
+             << "**** Max xsec envelopes for init-state = " << init_state;
+
+    Range1D_t rE = evgdriver->ValidEnergyRange();
+    evgdriver->PrecomputeMaxXSec(rE.min, fEmax,
+                     fPrecompMaxXSecNKnots, fPrecompMaxXSecNJobs);
+  }
+  // store them in the cache file now (if any), for the jobs starting while
+  // this one is running
+  Cache::Instance()->SaveCacheFile();
+
+  LOG("GMCJDriver", pNOTICE)
+     << "Finished precomputing the max{dxsec/dK} envelopes";
+}
+//___________________________________________________________________________
 void GMCJDriver::ComputeProbScales(void)
 {
 // Computing interaction probability scales.
@@ -714,6 +1346,11 @@ void GMCJDriver::ComputeProbScales(void)
 // A global probability scale is also being constructed for keeping the correct 
 // proportions between differect flux neutrino species or flux neutrinos of 
 // different energies.
+// The total cross sections are evaluated for all species and energies first
+// (in parallel, see SetProbScaleThreads) and the scales are then filled in
+// fixed or adaptive (see UseAdaptiveProbScales) energy bins.
+
+  InitTimingScope timing("GMCJDriver::ComputeProbScales");
 
   LOG("GMCJDriver", pNOTICE)
     << "Computing the max. interaction probability (probability scale)";
@@ -732,6 +1369,11 @@ void GMCJDriver::ComputeProbScales(void)
     fPmax.clear();
   }
 
+  // reuse the probability scales computed by an earlier job, if possible
+  if(fProbScalesInFile.size() > 0) {
+    if(this->ReadProbScales()) return;
+  }
+
   // for maximum interaction probability vs E /for given geometry/ I will
   // be using 300 bins up to the maximum energy for the input flux
   // double de   = fEmax/300.;//djk june 5, 2013
@@ -740,68 +1382,144 @@ void GMCJDriver::ComputeProbScales(void)
   double emax = fEmax + de;
   int n = 1 + (int) ((emax-emin)/de);
 
-  PDGCodeList::const_iterator nuiter;
-  PDGCodeList::const_iterator tgtiter;
-
-  // loop over all neutrino types generated by the flux driver
-  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
-    int neutrino_pdgc = *nuiter;
-    TH1D * pmax_hst = new TH1D("pmax_hst",
-             "max interaction probability vs E | geom",n,emin,emax);
-    pmax_hst->SetDirectory(0);
-
-    // loop over energy bins
-    for(int ie = 1; ie <= pmax_hst->GetNbinsX(); ie++) {
-      double EvLow  = pmax_hst->GetBinCenter(ie) - 0.5*pmax_hst->GetBinWidth(ie); 
-      double EvHigh = pmax_hst->GetBinCenter(ie) + 0.5*pmax_hst->GetBinWidth(ie); 
-      //double Ev = pmax_hst->GetBinCenter(ie);
-
-       // loop over targets in input geometry, form initial state and compute
-       // the sum of maximum interaction probabilities at the current energy bin
-       //
-       for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
-         int target_pdgc = *tgtiter;
-
-         InitialState init_state(target_pdgc, neutrino_pdgc);
-
-         LOG("GMCJDriver", pDEBUG)
-           << "Computing Pmax for init-state: " << init_state.AsString() << " E from " << EvLow << "-" << EvHigh;
-
-         // get the appropriate driver
-         GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
-
-         // get xsec sum over all modelled processes for given neutrino+target)
-         double sxsecLow  = evgdriver->XSecSumSpline()->Evaluate(EvLow);
-	 double sxsecHigh = evgdriver->XSecSumSpline()->Evaluate(EvHigh);
-
-         // get max{path-length x density}
-         double plmax = fMaxPathLengths.PathLength(target_pdgc);
+  // energies at which the total cross sections are evaluated: the bin edges
+  // of the uniform grid (subdivided further when using adaptive binning)
+  int nfine = (fAdaptivePmax) ? kPmaxRefine * n : n;
+  TAxis grid(nfine, emin, emax);
+  vector<double> energies(nfine+1);
+  for(int ie = 0; ie < nfine; ie++) energies[ie] = grid.GetBinLowEdge(ie+1);
+  energies[nfine] = grid.GetBinUpEdge(nfine);
+
+  unsigned int nnu  = fNuList.size();
+  unsigned int nmat = fMatPdg.size();
+  unsigned int nE   = energies.size();
+
+  for(unsigned int i = 0; i < fMatXSecSum.size(); i++) {
+    if(!fMatXSecSum[i]) {
+      LOG("GMCJDriver", pFATAL)
+        << "\n * The MC Job driver isn't properly configured!"
+        << "\n * Couldn't retrieve total cross section spline for init state: " 
+        << InitialState(fMatPdg[i%nmat], fNuList[i/nmat]).AsString();
+      exit(1);
+    }
+  }
 
-         // compute/store the max interaction probabiity (for given energy)
-         int A = pdg::IonPdgCodeToA(target_pdgc);
-         double pmaxLow  = this->InteractionProbability(sxsecLow, plmax, A);
-         double pmaxHigh = this->InteractionProbability(sxsecHigh, plmax, A);
+  // evaluate xsec sum over all modelled processes for given neutrino+target
+  // at all energies
+  GMCJProbScaleTask task;
+  task.xsec_splines = &fMatXSecSum;
+  task.plmax        = &fMatMaxPL;
+  task.energies     = &energies;
+  task.nnu          = nnu;
+  task.nmat         = nmat;
+  task.xsec.assign(nnu*nE*nmat, 0.);
+
+  int nthreads = TMath::Min(fNProbScaleThreads, (int) nE);
+  if(nthreads <= 1) {
+    GMCJProbScaleLoop(&task, 0, 1);
+  } else {
+    LOG("GMCJDriver", pNOTICE)
+      << "Evaluating total cross sections using " << nthreads << " threads";
+    vector<std::thread> threads;
+    for(int ithread = 0; ithread < nthreads; ithread++) {
+      threads.push_back( std::thread(GMCJProbScaleLoop, &task, ithread, nthreads) );
+    }
+    for(int ithread = 0; ithread < nthreads; ithread++) threads[ithread].join();
+  }
 
-	 double pmax = pmaxHigh;
-	 if ( pmaxLow > pmaxHigh){
-	   pmax = pmaxLow;
-	   LOG("GMCJDriver", pWARN)
-	     << "Lower energy neutrinos have a higher probability of interacting than those at higher energy."
-	     << " pmaxLow(E=" << EvLow << ")=" << pmaxLow << " and " << " pmaxHigh(E=" << EvHigh << ")=" << pmaxHigh;
-	 }
+  // loop over all neutrino types generated by the flux driver
+  for(unsigned int inu = 0; inu < nnu; inu++) {
+    int neutrino_pdgc = fNuList[inu];
+
+    // compute the max interaction probabiity for each target in the input
+    // geometry (at its max{path-length x density}), at each energy
+    vector<double> prob(nE*nmat, 0.);
+    for(unsigned int ie = 0; ie < nE; ie++) {
+      for(unsigned int imat = 0; imat < nmat; imat++) {
+        double sxsec = task.xsec[(inu*nE + ie)*nmat + imat];
+        prob[ie*nmat + imat] = 
+           this->InteractionProbability(sxsec, fMatMaxPL[imat], fMatA[imat]);
+      }
+    }
 
-         pmax_hst->SetBinContent(ie, pmax_hst->GetBinContent(ie) + pmax);
+    // the max interaction probability in each (fine) energy bin is the sum
+    // over targets of the max at the bin edges
+    int nwarn = 0;
+    vector<double> pfine(nfine, 0.);
+    for(int ie = 0; ie < nfine; ie++) {
+      for(unsigned int imat = 0; imat < nmat; imat++) {
+        double pmaxLow  = prob[ie*nmat + imat];
+        double pmaxHigh = prob[(ie+1)*nmat + imat];
+        if(pmaxLow > pmaxHigh) nwarn++;
+        pfine[ie] += TMath::Max(pmaxLow, pmaxHigh);
+      }
+    }
+    if(nwarn > 0) {
+      LOG("GMCJDriver", pWARN)
+        << "Lower energy neutrinos have a higher probability of interacting "
+        << "than those at higher energy in " << nwarn << " (energy bin, target) "
+        << "pairs for nu = " << neutrino_pdgc;
+    }
 
-         LOG("GMCJDriver", pDEBUG)
-           << "Pmax[" << init_state.AsString() << ", Ev from " << EvLow << "-" << EvHigh << "] = " << pmax;
-       } // targets
+    TH1D * pmax_hst = 0;
+    if(!fAdaptivePmax) {
+      pmax_hst = new TH1D("pmax_hst",
+             "max interaction probability vs E | geom",n,emin,emax);
+      for(int ie = 1; ie <= n; ie++) {
+        pmax_hst->SetBinContent(ie, 1.2 * pfine[ie-1]);
+      }
+    } else {
+      // merge consecutive fine bins as long as the max interaction probability
+      // over the merged bin stays within tolerance of its smallest fine-bin value
+      vector<double> edges;
+      vector<double> contents;
+      vector<double> mmax(nmat), mmax_next(nmat);
+      int ie = 0;
+      while(ie < nfine) {
+        int istart = ie;
+        for(unsigned int imat = 0; imat < nmat; imat++) {
+          mmax[imat] = TMath::Max(prob[ie*nmat + imat], prob[(ie+1)*nmat + imat]);
+        }
+        double content = pfine[ie];
+        double pmin    = pfine[ie];
+        ie++;
+        while(ie < nfine && ie - istart < kPmaxMaxMerge) {
+          double content_next = 0;
+          for(unsigned int imat = 0; imat < nmat; imat++) {
+            mmax_next[imat] = TMath::Max(mmax[imat], prob[(ie+1)*nmat + imat]);
+            content_next += mmax_next[imat];
+          }
+          double pmin_next = TMath::Min(pmin, pfine[ie]);
+          if(content_next > (1+fAdaptivePmaxTol)*pmin_next) break;
+          mmax.swap(mmax_next);
+          content = content_next;
+          pmin    = pmin_next;
+          ie++;
+        }
+        edges.push_back(energies[istart]);
+        contents.push_back(content);
+      }
+      edges.push_back(energies[nfine]);
 
-       pmax_hst->SetBinContent(ie, 1.2 * pmax_hst->GetBinContent(ie));
+      int nbins = contents.size();
+      pmax_hst = new TH1D("pmax_hst",
+             "max interaction probability vs E | geom", nbins, &edges[0]);
+      for(int ib = 1; ib <= nbins; ib++) {
+        pmax_hst->SetBinContent(ib, 1.2 * contents[ib-1]);
+      }
+      LOG("GMCJDriver", pNOTICE)
+        << "Probability scale for nu = " << neutrino_pdgc << " uses " 
+        << nbins << " adaptive energy bins";
+    }
+    pmax_hst->SetDirectory(0);
 
+    for(int ib = 1; ib <= pmax_hst->GetNbinsX(); ib++) {
        LOG("GMCJDriver", pINFO)
-	 << "Pmax[nu=" << neutrino_pdgc << ", Ev from " << EvLow << "-" << EvHigh << "] = "
-          <<  pmax_hst->GetBinContent(ie);
-    } // E
+         << "Pmax[nu=" << neutrino_pdgc << ", Ev from " 
+         << pmax_hst->GetBinLowEdge(ib) << "-" 
+         << pmax_hst->GetBinLowEdge(ib) + pmax_hst->GetBinWidth(ib) << "] = "
+         <<  pmax_hst->GetBinContent(ib);
+    }
 
     fPmax.insert(map<int,TH1D*>::value_type(neutrino_pdgc,pmax_hst));
   } // nu
@@ -811,6 +1529,7 @@ void GMCJDriver::ComputeProbScales(void)
   //   all neutrinos, all targets, @  max path length, @ max energy}
   //
   {
+    PDGCodeList::const_iterator nuiter;
     for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
       int neutrino_pdgc = *nuiter;
       map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(neutrino_pdgc);
@@ -825,12 +1544,366 @@ void GMCJDriver::ComputeProbScales(void)
     }
     LOG("GMCJDriver", pNOTICE) << "*** Probability scale = " << fGlobPmax;
   }
+
+  if(fProbScalesOutFile.size() > 0) this->WriteProbScales();
+}
+//___________________________________________________________________________
+void GMCJDriver::ProbScaleHashes(
+              string & flux_hash, string & geom_hash, string & tune_hash) const
+{
+// Hashes of the inputs the probability scales depend on: the flux neutrino
+// species & max. energy (and the energy binning options), the geometry max.
+// path lengths, and the tune & total cross sections
+
+  ostringstream flux;
+  flux << setprecision(17) << fEmax << ";";
+  for(unsigned int inu = 0; inu < fNuList.size(); inu++) {
+    flux << fNuList[inu] << ";";
+  }
+  flux << fAdaptivePmax << ";" << fAdaptivePmaxTol;
+
+  ostringstream geom;
+  geom << setprecision(17);
+  PathLengthList::const_iterator pliter;
+  for(pliter = fMaxPathLengths.begin(); pliter != fMaxPathLengths.end(); ++pliter) {
+    geom << pliter->first << ":" << pliter->second << ";";
+  }
+
+  ostringstream tune;
+  tune << setprecision(17);
+  TuneId * tune_id = RunOpt::Instance()->Tune();
+  if(tune_id) tune << tune_id->Name();
+  tune << ";" << fEventGenList << ";";
+  for(unsigned int i = 0; i < fMatXSecSum.size(); i++) {
+    const Spline * spl = fMatXSecSum[i];
+    if(!spl) continue;
+    for(int iknot = 0; iknot < spl->NKnots(); iknot++) {
+      double x = 0, y = 0;
+      spl->GetKnot(iknot, x, y);
+      tune << x << ":" << y << ";";
+    }
+  }
+
+  flux_hash = GMCJHash(flux.str());
+  geom_hash = GMCJHash(geom.str());
+  tune_hash = GMCJHash(tune.str());
+}
+//___________________________________________________________________________
+bool GMCJDriver::ReadProbScales(void)
+{
+  TFile file(fProbScalesInFile.c_str(), "READ");
+  if(file.IsZombie()) {
+    LOG("GMCJDriver", pWARN)
+      << "Can not read probability scales from " << fProbScalesInFile;
+    return false;
+  }
+
+  string hash[3];
+  this->ProbScaleHashes(hash[0], hash[1], hash[2]);
+  const char * hash_name[3] = { "FluxHash", "GeomHash", "TuneHash" };
+  for(int i = 0; i < 3; i++) {
+    TNamed * stored = dynamic_cast<TNamed *> (file.Get(hash_name[i]));
+    if(!stored || hash[i] != stored->GetTitle()) {
+      LOG("GMCJDriver", pNOTICE)
+        << "Probability scales in " << fProbScalesInFile << " don't match "
+        << "the current job (" << hash_name[i] << ") - Recomputing them";
+      return false;
+    }
+  }
+
+  TParameter<double> * globpmax = 
+       dynamic_cast<TParameter<double> *> (file.Get("GlobPmax"));
+  if(!globpmax) {
+    LOG("GMCJDriver", pWARN)
+      << "No global probability scale in " << fProbScalesInFile;
+    return false;
+  }
+
+  map<int,TH1D*> pmax;
+  PDGCodeList::const_iterator nuiter;
+  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+    ostringstream name;
+    name << "pmax_" << *nuiter;
+    TH1D * stored = dynamic_cast<TH1D *> (file.Get(name.str().c_str()));
+    if(!stored) {
+      LOG("GMCJDriver", pWARN)
+        << "No probability scale for nu = " << *nuiter 
+        << " in " << fProbScalesInFile;
+      map<int,TH1D*>::iterator pmax_iter = pmax.begin();
+      for( ; pmax_iter != pmax.end(); ++pmax_iter) delete pmax_iter->second;
+      return false;
+    }
+    TH1D * pmax_hst = (TH1D*) stored->Clone("pmax_hst");
+    pmax_hst->SetDirectory(0);
+    pmax.insert(map<int,TH1D*>::value_type(*nuiter,pmax_hst));
+  }
+
+  fPmax     = pmax;
+  fGlobPmax = globpmax->GetVal();
+
+  LOG("GMCJDriver", pNOTICE) 
+    << "Loaded the probability scales from " << fProbScalesInFile;
+  LOG("GMCJDriver", pNOTICE) << "*** Probability scale = " << fGlobPmax;
+
+  return true;
+}
+//___________________________________________________________________________
+void GMCJDriver::WriteProbScales(void) const
+{
+  TDirectory * curr_dir = gDirectory;
+
+  TFile file(fProbScalesOutFile.c_str(), "RECREATE");
+  if(file.IsZombie()) {
+    LOG("GMCJDriver", pERROR)
+      << "Can not write probability scales to " << fProbScalesOutFile;
+    if(curr_dir) curr_dir->cd();
+    return;
+  }
+
+  string flux_hash, geom_hash, tune_hash;
+  this->ProbScaleHashes(flux_hash, geom_hash, tune_hash);
+  TNamed("FluxHash", flux_hash.c_str()).Write();
+  TNamed("GeomHash", geom_hash.c_str()).Write();
+  TNamed("TuneHash", tune_hash.c_str()).Write();
+  TParameter<double>("GlobPmax", fGlobPmax).Write();
+
+  map<int,TH1D*>::const_iterator pmax_iter = fPmax.begin();
+  for( ; pmax_iter != fPmax.end(); ++pmax_iter) {
+    ostringstream name;
+    name << "pmax_" << pmax_iter->first;
+    pmax_iter->second->Write(name.str().c_str());
+  }
+  file.Close();
+  if(curr_dir) curr_dir->cd();
+
+  LOG("GMCJDriver", pNOTICE) 
+    << "Saved the probability scales to " << fProbScalesOutFile;
+}
+//___________________________________________________________________________
+void GMCJDriver::IndexMaterials(void)
+{
+// Assigns an index to each target material (materials are indexed in order
+// of increasing PDG code, as in a PathLengthList) and pre-resolves the 
+// quantities needed for each flux neutrino so that the event loop works
+// on contiguous arrays rather than on map look-ups
+
+  InitTimingScope timing("GMCJDriver::IndexMaterials");
+
+  fMatPdg.clear();
+  PDGCodeList::const_iterator tgtiter;
+  for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
+     fMatPdg.push_back(*tgtiter);
+  }
+  sort(fMatPdg.begin(), fMatPdg.end());
+
+  unsigned int nmat = fMatPdg.size();
+  unsigned int nnu  = fNuList.size();
+
+  fMatA.resize(nmat);
+  for(unsigned int imat = 0; imat < nmat; imat++) {
+     fMatA[imat] = pdg::IonPdgCodeToA(fMatPdg[imat]);
+  }
+
+  fMatDrivers.assign(nnu*nmat, 0);
+  fMatXSecSum.assign(nnu*nmat, 0);
+  for(unsigned int inu = 0; inu < nnu; inu++) {
+    for(unsigned int imat = 0; imat < nmat; imat++) {
+       GEVGDriver * evgdriver = fGPool->FindDriver(fNuList[inu], fMatPdg[imat]);
+       fMatDrivers[inu*nmat + imat] = evgdriver;
+       fMatXSecSum[inu*nmat + imat] = 
+                        (evgdriver) ? evgdriver->XSecSumSpline() : 0;
+    }
+  }
+
+  fCurPL.assign(nmat, 0.);
+  fCurCumulProb.assign(nmat, 0.);
+
+  this->FillPathLengthArray(fMaxPathLengths, fMatMaxPL, false);
+  this->IndexProbScales();
+
+  LOG("GMCJDriver", pNOTICE) 
+     << "Indexed " << nmat << " target materials for " << nnu 
+     << " flux neutrino species";
+}
+//___________________________________________________________________________
+void GMCJDriver::IndexProbScales(void)
+{
+// Resolve the probability scale histogram of each flux neutrino species
+
+  fNuPmax.assign(fNuList.size(), 0);
+  for(unsigned int inu = 0; inu < fNuList.size(); inu++) {
+     map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(fNuList[inu]);
+     if(pmax_iter != fPmax.end()) fNuPmax[inu] = pmax_iter->second;
+  }
+}
+//___________________________________________________________________________
+void GMCJDriver::FillPathLengthArray(
+   const PathLengthList & pl, vector<double> & plarr, bool is_current) const
+{
+// Copies the input path length list to an array indexed by material.
+// An unknown material in the path lengths of the current flux neutrino is
+// a fatal configuration error (no event generation driver for it).
+
+  // usual case: the list holds exactly the indexed materials
+  if(pl.HasCodes(fMatPdg)) {
+    pl.PathLengths(plarr);
+    return;
+  }
+
+  plarr.assign(fMatPdg.size(), 0.);
+
+  PathLengthList::const_iterator pliter;
+  for(pliter = pl.begin(); pliter != pl.end(); ++pliter) {
+     int imat = this->MaterialIndex(pliter->first);
+     if(imat < 0) {
+       if(is_current) {
+         LOG("GMCJDriver", pFATAL)
+          << "\n * The MC Job driver isn't properly configured!"
+          << "\n * No event generation driver could be found for target: " 
+          << pliter->first;
+         exit(1);
+       }
+       LOG("GMCJDriver", pWARN)
+          << "Ignoring path length for unknown target material: " 
+          << pliter->first;
+       continue;
+     }
+     plarr[imat] = pliter->second;
+  }
+}
+//___________________________________________________________________________
+int GMCJDriver::MaterialIndex(int tgt_pdgc) const
+{
+  vector<int>::const_iterator it = 
+        lower_bound(fMatPdg.begin(), fMatPdg.end(), tgt_pdgc);
+  if(it == fMatPdg.end() || *it != tgt_pdgc) return -1;
+  return it - fMatPdg.begin();
+}
+//___________________________________________________________________________
+int GMCJDriver::NeutrinoIndex(int nu_pdgc) const
+{
+  for(unsigned int inu = 0; inu < fNuList.size(); inu++) {
+     if(fNuList[inu] == nu_pdgc) return inu;
+  }
+  return -1;
+}
+//___________________________________________________________________________
+void GMCJDriver::BuildPreSelection(void)
+{
+// Prepare the flux neutrino pre-selection kernel: for each neutrino species
+// the total cross section splines of all materials with a non-zero maximum
+// path length are put in SplineBank objects (one per common knot grid) and
+// weighted by the interaction probability per unit cross section at the
+// maximum path length. The max. path length interaction probability for a
+// flux neutrino is then obtained with one knot search and one vectorized
+// loop per bank, rather than with one spline evaluation per material.
+
+  InitTimingScope timing("GMCJDriver::BuildPreSelection");
+
+  this->ClearPreSelection();
+
+  unsigned int nnu  = fNuList.size();
+  unsigned int nmat = fMatPdg.size();
+
+  fPreSelFirstBank.push_back(0);
+  for(unsigned int inu = 0; inu < nnu; inu++) {
+    unsigned int first_bank = fPreSelBanks.size();
+    vector< vector<double> > coef;
+    for(unsigned int imat = 0; imat < nmat; imat++) {
+      double plmax = fMatMaxPL[imat];
+      if(plmax <= 0.) continue;
+      const Spline * spl = fMatXSecSum[inu*nmat + imat];
+      if(!spl) {
+        this->ClearPreSelection();
+        return;
+      }
+      unsigned int ib = first_bank;
+      for( ; ib < fPreSelBanks.size(); ib++) {
+        if(fPreSelBanks[ib]->SharesKnots(spl)) break;
+      }
+      if(ib == fPreSelBanks.size()) {
+        fPreSelBanks.push_back(new SplineBank);
+        coef.push_back(vector<double>());
+      }
+      if(!fPreSelBanks[ib]->Add(spl)) {
+        this->ClearPreSelection();
+        return;
+      }
+      coef[ib-first_bank].push_back(
+           this->InteractionProbability(1., plmax, fMatA[imat]));
+    }
+    for(unsigned int ib = 0; ib < coef.size(); ib++) {
+      fPreSelFirstCoef.push_back(fPreSelCoef.size());
+      fPreSelCoef.insert(fPreSelCoef.end(), coef[ib].begin(), coef[ib].end());
+    }
+    fPreSelFirstBank.push_back(fPreSelBanks.size());
+  }
+  fPreSelXSec.assign(nmat, 0.);
+  fPreSelBanked = true;
+
+  LOG("GMCJDriver", pNOTICE) 
+    << "Flux neutrino pre-selection uses " << fPreSelBanks.size()
+    << " spline banks for " << nnu << " flux neutrino species";
+}
+//___________________________________________________________________________
+void GMCJDriver::ClearPreSelection(void)
+{
+  for(unsigned int ib = 0; ib < fPreSelBanks.size(); ib++) {
+    delete fPreSelBanks[ib];
+  }
+  fPreSelBanks.clear();
+  fPreSelFirstBank.clear();
+  fPreSelFirstCoef.clear();
+  fPreSelCoef.clear();
+  fPreSelXSec.clear();
+  fPreSelBanked = false;
+}
+//___________________________________________________________________________
+double GMCJDriver::PreSelectionProbability(void)
+{
+// Same as ComputeInteractionProbabilities(true) (sum of normalized
+// interaction probabilities for the max. path lengths) for the current
+// flux neutrino, using the pre-selection spline banks
+
+  int                    nupdg = fFluxDriver->PdgCode();
+  const TLorentzVector & nup4  = fFluxDriver->Momentum();
+  double                 Ev    = nup4.Energy();
+
+  int inu = this->NeutrinoIndex(nupdg);
+  if(inu < 0) {
+    LOG("GMCJDriver", pFATAL)
+      << "\n * The MC Job driver isn't properly configured!"
+      << "\n * Flux neutrino " << nupdg << " is not in the list of flux particles";
+    exit(1);
+  }
+
+  double psum = 0;
+  for(int ib = fPreSelFirstBank[inu]; ib < fPreSelFirstBank[inu+1]; ib++) {
+    const SplineBank * bank = fPreSelBanks[ib];
+    bank->Evaluate(Ev, &fPreSelXSec[0]);
+    const double * coef = &fPreSelCoef[fPreSelFirstCoef[ib]];
+    int nspl = bank->NSplines();
+    for(int i = 0; i < nspl; i++) psum += coef[i] * fPreSelXSec[i];
+  }
+  if(psum <= 0.) return 0.;
+
+  double pmax = 0;
+  if(fGenerateUnweighted) pmax = fGlobPmax;
+  else {
+    TH1D * pmax_hst = fNuPmax[inu];
+    assert(pmax_hst);
+    pmax = pmax_hst->GetBinContent(pmax_hst->FindBin(Ev));
+  }
+  assert(pmax>0);
+  return psum/pmax;
 }
 //___________________________________________________________________________
 void GMCJDriver::InitEventGeneration(void)
 {
   fCurPathLengths.clear();
+  fCurPL.assign(fMatPdg.size(), 0.);
   fCurEvt    = 0;
+  fCurEvtFilteredOut = false;
   fSelTgtPdg = 0;
   fCurVtx.SetXYZT(0.,0.,0.,0.);
 }
@@ -839,6 +1912,14 @@ EventRecord * GMCJDriver::GenerateEvent(void)
 {
   LOG("GMCJDriver", pNOTICE) << "Generating next event...";
 
+  GMCJRandomGenGuard rnd_guard(fRandomGen);
+
+  // all the draws made for this event (including the flux neutrinos that
+  // do not interact) come from the streams of this event index
+  RandomGen * rnd = RandomGen::Instance();
+  if(rnd->CounterBased()) rnd->SetEventIndex(fEventIndex);
+  fEventIndex++;
+
   this->InitEventGeneration();
 
   while(1) {
@@ -864,6 +1945,274 @@ EventRecord * GMCJDriver::GenerateEvent(void)
   return 0;
 }
 //___________________________________________________________________________
+bool GMCJDriver::GenerateEvent(EventRecord & event)
+{
+// Generate the next event in the input record, owned by the caller: It is
+// lent to the pool of records of the event generation drivers, which take
+// it first (and keep re-using it for all the tries of this event)
+
+  fRecordPool->SetBuffer(&event);
+  EventRecord * generated = this->GenerateEvent();
+  fRecordPool->SetBuffer(0);
+
+  if(!generated) return false;
+  if(generated != &event) {
+    // not expected (all the records come from the pool), but safe
+    event.Copy(*generated);
+    fRecordPool->Recycle(generated);
+  }
+  return true;
+}
+//___________________________________________________________________________
+long int GMCJDriver::GenerateEvents(long int nev, GMCJEventSinkI & sink)
+{
+// Generate events for a sink: each event is lent to the sink and its record
+// is then given back to the pool for the next event
+
+  long int ngen = 0;
+  while(ngen < nev) {
+    EventRecord * event = this->GenerateEvent();
+    if(!event) break;
+    ngen++;
+    bool more = sink.HandleEvent(*event, *this);
+    this->RecycleEvent(event);
+    if(!more) break;
+  }
+  return ngen;
+}
+//___________________________________________________________________________
+void GMCJDriver::UseRandomGen(long int seed)
+{
+  if(fRandomGen) RandomGen::DeleteInstance(fRandomGen);
+  fRandomGen = RandomGen::CreateInstance(seed);
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Using a private random number generator (seed: " << seed << ")";
+}
+//___________________________________________________________________________
+void GMCJDriver::RecycleEvent(EventRecord * event) const
+{
+// Give back an event generated by this driver once it is no longer needed
+// (eg after it was written out), instead of deleting it: The driver adopts
+// it and its allocated memory is re-used for a following event.
+// Must be called from the thread generating events with this driver (in the
+// multi-threaded mode, HandleEvent() may pass the event to the input driver)
+
+  fRecordPool->Recycle(event);
+}
+//___________________________________________________________________________
+void GMCJDriver::RestoreCounters(
+             long int nflux, const map<int, double> & sumfluxintprobs)
+{
+  fNFluxNeutrinos  = (double) nflux;
+  fSumFluxIntProbs = sumfluxintprobs;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Restored counters: " << nflux << " flux neutrinos thrown so far";
+}
+//___________________________________________________________________________
+long int GMCJDriver::GenerateEvents(long int nev, int nthreads)
+{
+// Multi-threaded event generation.
+// The driver must have been configured already: All cross section splines
+// are created here (serially) and the probability scales computed here are
+// copied to every worker so that all threads generate events with a common
+// normalization. Each worker is a GMCJDriver with its own GEVGDriver pool
+// and with flux & geometry drivers obtained from the input worker factory.
+// The read-only XSecSplineList, AlgConfigPool and hadron data tables are
+// shared. Workers get their own RandomGen, RunningThreadInfo & Cache.
+// Note that the event generation modules invoked by the workers must be
+// re-entrant (eg the Fortran-based PYTHIA6 is not).
+//
+  if(!fWorkerFactory) {
+    LOG("GMCJDriver", pFATAL) 
+      << "No GMCJWorkerFactoryI was set - Call UseWorkerFactory() first";
+    exit(1);
+  }
+  if(!fGPool) {
+    LOG("GMCJDriver", pFATAL) 
+      << "The GMCJDriver must be configured before calling GenerateEvents()";
+    exit(1);
+  }
+
+  // the worker seeds are derived from this driver's generator, if it has one
+  GMCJRandomGenGuard rnd_guard(fRandomGen);
+
+  if(fFluxIntTree && nthreads > 1) {
+    LOG("GMCJDriver", pWARN) 
+      << "Pre-calculated flux interaction probabilities can not be used "
+      << "in the multi-threaded mode - Generating events serially";
+    nthreads = 1;
+  }
+
+  if(nthreads <= 1) {
+    long int ngen = 0;
+    while(ngen < nev) {
+      EventRecord * event = this->GenerateEvent();
+      if(!event) break;
+      ngen++;
+      fWorkerFactory->HandleEvent(0, event, *this);
+    }
+    return ngen;
+  }
+
+  LOG("GMCJDriver", pNOTICE)
+     << utils::print::PrintFramedMesg("Starting multi-threaded event generation");
+  LOG("GMCJDriver", pNOTICE) 
+     << "Generating " << nev << " events using " << nthreads << " threads";
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+#endif
+
+  // Configure the workers serially (the algorithm factory, the configuration
+  // pool and the spline list are not protected against concurrent writes).
+  // Each worker generates events with its own copy of the event generators.
+  vector<GMCJDriver *> workers;
+  for(int ithread = 0; ithread < nthreads; ithread++) {
+    workers.push_back( this->CreateWorker(ithread, true) );
+  }
+
+  GMCJThreadPool pool;
+  pool.factory    = fWorkerFactory;
+  pool.nev        = nev;
+  pool.first_event = fEventIndex;
+  pool.nrequested = 0;
+  pool.ngenerated = 0;
+
+  // With counter-based random number streams every worker uses the same seed
+  // (each event is keyed by its index, whichever thread generates it)
+  RandomGen * rnd = RandomGen::Instance();
+  long int seed = rnd->GetSeed();
+  bool counter_based = rnd->CounterBased();
+
+  vector<std::thread> threads;
+  for(int ithread = 0; ithread < nthreads; ithread++) {
+    long int thread_seed = (counter_based) ? seed : seed+ithread+1;
+    threads.push_back( std::thread(
+        GMCJWorkerLoop, &pool, workers[ithread], ithread, thread_seed) );
+  }
+  for(int ithread = 0; ithread < nthreads; ithread++) {
+    threads[ithread].join();
+  }
+
+  // Collect the information needed for computing the sample normalization
+  for(int ithread = 0; ithread < nthreads; ithread++) {
+    fNFluxNeutrinos += workers[ithread]->fNFluxNeutrinos;
+    delete workers[ithread];
+  }
+  workers.clear();
+  fEventIndex += nev;
+
+  LOG("GMCJDriver", pNOTICE) 
+     << "Generated " << pool.ngenerated << " events using " 
+     << nthreads << " threads (" << (long int) fNFluxNeutrinos 
+     << " flux neutrinos thrown)";
+
+  return pool.ngenerated;
+}
+//___________________________________________________________________________
+GMCJDriver * GMCJDriver::CreateWorker(int ithread, bool generate_events)
+{
+// Create & configure the driver used by the input worker thread. Workers
+// generating events use private copies of the event generators (the workers
+// computing flux interaction probabilities only read the cross section
+// splines).
+
+  LOG("GMCJDriver", pNOTICE) << "Configuring worker driver: " << ithread;
+
+  GFluxI *        flux = fWorkerFactory->CreateFluxDriver   (ithread);
+  GeomAnalyzerI * geom = fWorkerFactory->CreateGeomAnalyzer (ithread);
+  if(!flux || !geom) {
+    LOG("GMCJDriver", pFATAL) 
+      << "Couldn't get flux/geometry drivers for worker thread: " << ithread;
+    exit(1);
+  }
+
+  GMCJDriver * worker = new GMCJDriver;
+  worker->SetEventGeneratorList (fEventGenList);
+  worker->SetUnphysEventMask    (*fUnphysEventMask);
+  worker->UseFluxDriver         (flux);
+  worker->UseGeomAnalyzer       (geom);
+  if(fUseSplines) worker->UseSplines(fUseLogE);
+  worker->KeepOnThrowingFluxNeutrinos(fKeepThrowingFluxNu);
+  if(fGenerateUnweighted) worker->ForceSingleProbScale();
+  worker->PreSelectEvents(fPreSelect);
+  worker->UseImportanceSampling(fImportanceSampling);
+  if(fPathLengthCacheMax > 0) worker->CachePathLengths(fPathLengthCacheMax);
+  worker->UsePrivateAlgorithms(generate_events);
+
+  // All splines were created by this driver, so the worker configuration
+  // only builds its own GEVGDriver objects. All workers use the probability
+  // scales computed by this driver.
+  worker->Configure(false);
+  worker->CopyProbScales(*this);
+
+  return worker;
+}
+//___________________________________________________________________________
+void GMCJDriver::CopyProbScales(const GMCJDriver & driver)
+{
+  map<int,TH1D*>::iterator pmax_iter = fPmax.begin();
+  for( ; pmax_iter != fPmax.end(); ++pmax_iter) {
+    if(pmax_iter->second) delete pmax_iter->second;
+  }
+  fPmax.clear();
+
+  map<int,TH1D*>::const_iterator src_iter = driver.fPmax.begin();
+  for( ; src_iter != driver.fPmax.end(); ++src_iter) {
+    TH1D * pmax_hst = (TH1D*) src_iter->second->Clone();
+    pmax_hst->SetDirectory(0);
+    fPmax.insert(map<int,TH1D*>::value_type(src_iter->first,pmax_hst));
+  }
+  fGlobPmax       = driver.fGlobPmax;
+  fMaxPathLengths = driver.fMaxPathLengths;
+
+  this->FillPathLengthArray(fMaxPathLengths, fMatMaxPL, false);
+  this->IndexProbScales();
+  this->BuildPreSelection();
+  if(fImportanceSampling) this->BiasFluxDriver();
+}
+//___________________________________________________________________________
+void GMCJDriver::BiasFluxDriver(void)
+{
+// Ask the flux driver to generate each neutrino species from its spectrum
+// multiplied by the corresponding probability scale = f(Ev).
+// The flux neutrinos are then accepted with probability P/Pmax(Ev) and their
+// weight Pmax(Ev)/GlobPmax x (flux bias weight) is flat
+
+  fFluxBiased = false;
+
+  if(fGenerateUnweighted) {
+    LOG("GMCJDriver", pWARN)
+      << "Importance sampling needs the per-energy probability scales "
+      << "(not used with a single probability scale) - Disabled";
+    return;
+  }
+
+  bool ok = true;
+  for(unsigned int inu = 0; inu < fNuList.size(); inu++) {
+    TH1D * pmax_hst = (inu < fNuPmax.size()) ? fNuPmax[inu] : 0;
+    if(!pmax_hst || !fFluxDriver->SetEnergyBias(fNuList[inu], pmax_hst)) {
+      ok = false;
+      break;
+    }
+  }
+  if(!ok) {
+    // restore the unbiased spectra of any species biased so far
+    for(unsigned int inu = 0; inu < fNuList.size(); inu++) {
+      fFluxDriver->SetEnergyBias(fNuList[inu], 0);
+    }
+    LOG("GMCJDriver", pWARN)
+      << "The flux driver does not support importance sampling - Disabled";
+    return;
+  }
+
+  fFluxBiased = true;
+  LOG("GMCJDriver", pNOTICE)
+    << "Flux neutrinos are sampled from flux x max. interaction probability";
+}
+//___________________________________________________________________________
 EventRecord * GMCJDriver::GenerateEvent1Try(void)
 {
 // attempt generating a neutrino interaction by firing a single flux neutrino
@@ -892,7 +2241,9 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
        LOG("GMCJDriver", pNOTICE) 
           << "Computing interaction probabilities for max. path lengths";
 
-       Psum = this->ComputeInteractionProbabilities(true /* <- max PL*/);
+       Psum = (fPreSelBanked) ? 
+            this->PreSelectionProbability() :
+            this->ComputeInteractionProbabilities(true /* <- max PL*/);
        Pno  = 1-Psum;
        LOG("GMCJDriver", pNOTICE)
           << "The no-interaction probability (max. path lengths) is: " 
@@ -1010,6 +2361,12 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   // Ask the GEVGDriver object to select and generate an interaction and
   // its kinematics for the selected initial state & neutrino 4-momentum
   this->GenerateEventKinematics();
+  if(!fCurEvt && fCurEvtFilteredOut) {
+     // the flux neutrino is used up, as for the non-interacting ones
+     LOG("GMCJDriver", pINFO)
+        << "** The selected interaction was rejected by the event filter";
+     return 0;
+  }
   if(!fCurEvt) {
      LOG("GMCJDriver", pWARN) 
         << "** Couldn't generate kinematics for selected interaction";
@@ -1082,12 +2439,27 @@ bool GMCJDriver::ComputePathLengths(void)
 // for all detector materials for the neutrino generated by the flux driver
 // and make sure that things look ok...
 
-  fCurPathLengths.clear();
-
+  // (not cleared: the materials are the same for all flux neutrinos, so the
+  //  path lengths are copied in place)
   const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
   const TLorentzVector & nux4  = fFluxDriver -> Position ();
 
-  fCurPathLengths = fGeomAnalyzer->ComputePathLengths(nux4, nup4);
+  // flux rays seen before (see CachePathLengths()) don't need the geometry
+  bool cacheable = (fPathLengthCacheMax > 0 && fFluxDriver->FixedRays());
+  map<long int, PathLengthList>::const_iterator cached;
+  if(cacheable) cached = fPathLengthCache.find(fFluxDriver->Index());
+
+  if(cacheable && cached != fPathLengthCache.end()) {
+    fCurPathLengths = cached->second;
+    fNPathLengthCacheHits++;
+  } else {
+    fCurPathLengths = fGeomAnalyzer->ComputePathLengths(nux4, nup4);
+    if(cacheable && (long int) fPathLengthCache.size() < fPathLengthCacheMax) {
+      fPathLengthCache.insert(
+          std::make_pair(fFluxDriver->Index(), fCurPathLengths));
+    }
+  }
+  this->FillPathLengthArray(fCurPathLengths, fCurPL, true);
 
   LOG("GMCJDriver", pNOTICE) << fCurPathLengths;
 
@@ -1113,76 +2485,78 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
   // current flux neutrino code & 4-p
   int                    nupdg = fFluxDriver->PdgCode();
   const TLorentzVector & nup4  = fFluxDriver->Momentum();
+  double                 Ev    = nup4.Energy();
 
-  fCurCumulProbMap.clear();
+  int inu = this->NeutrinoIndex(nupdg);
+  if(inu < 0) {
+    LOG("GMCJDriver", pFATAL)
+      << "\n * The MC Job driver isn't properly configured!"
+      << "\n * Flux neutrino " << nupdg << " is not in the list of flux particles";
+    exit(1);
+  }
 
-  const PathLengthList & path_length_list = 
-        (use_max_path_length) ? fMaxPathLengths : fCurPathLengths;
+  const vector<double> & path_lengths = 
+        (use_max_path_length) ? fMatMaxPL : fCurPL;
 
-  double probsum=0;
-  PathLengthList::const_iterator pliter;
+  unsigned int nmat = fMatPdg.size();
+  const Spline * const * totxsecspl = &fMatXSecSum[inu*nmat];
 
-  for(pliter = path_length_list.begin();
-                            pliter != path_length_list.end(); ++pliter) {
-     int    mpdg  = pliter->first;            // material PDG code
-     double pl    = pliter->second;           // density x path-length
-     int    A     = pdg::IonPdgCodeToA(mpdg);
+  // The probability scale depends only on the neutrino: look it up once
+  // (when a non-zero path length is first found)
+  double pmax = -1;
+
+  double probsum=0;
+  for(unsigned int imat = 0; imat < nmat; imat++) {
+     double pl    = path_lengths[imat];       // density x path-length
      double xsec  = 0.;                       // sum of xsecs for all modelled processes for given init state
-     double prob  = 0.;                       // interaction probability
      double probn = 0.;                       // normalized interaction probability
 
-     // find the GEVGDriver object that is handling the current init state
-     InitialState init_state(mpdg, nupdg);
-     GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
-     if(!evgdriver) {
-       LOG("GMCJDriver", pFATAL)
-        << "\n * The MC Job driver isn't properly configured!"
-        << "\n * No event generation driver could be found for init state: " 
-        << init_state.AsString();
-       exit(1);
-     }
      // compute the interaction xsec and probability (if path-length>0)
      if(pl>0.) {
-        const Spline * totxsecspl = evgdriver->XSecSumSpline();
-        if(!totxsecspl) {
+        if(!fMatDrivers[inu*nmat + imat]) {
+          LOG("GMCJDriver", pFATAL)
+           << "\n * The MC Job driver isn't properly configured!"
+           << "\n * No event generation driver could be found for init state: " 
+           << InitialState(fMatPdg[imat], nupdg).AsString();
+          exit(1);
+        }
+        if(!totxsecspl[imat]) {
             LOG("GMCJDriver", pFATAL)
               << "\n * The MC Job driver isn't properly configured!"
               << "\n * Couldn't retrieve total cross section spline for init state: " 
-              << init_state.AsString();
+              << InitialState(fMatPdg[imat], nupdg).AsString();
             exit(1);
-        } else {
-            xsec = totxsecspl->Evaluate( nup4.Energy() );
         }
-        prob = this->InteractionProbability(xsec,pl,A);
+        xsec = totxsecspl[imat]->Evaluate(Ev);
+        double prob = this->InteractionProbability(xsec,pl,fMatA[imat]);
         LOG("GMCJDriver", pDEBUG)
-          << " (xsec, pl, A)=(" << xsec << "," << pl << "," << A << ")";
+          << " (xsec, pl, A)=(" << xsec << "," << pl << "," << fMatA[imat] << ")";
 
         // scale the interaction probability to the maximum one so as not
         // to have to throw few billions of flux neutrinos before getting
         // an interaction...
-        double pmax = 0;
-        if(fGenerateUnweighted) pmax = fGlobPmax;
-        else {
-           map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nupdg);
-           assert(pmax_iter != fPmax.end());
-           TH1D * pmax_hst = pmax_iter->second;
-           assert(pmax_hst);
-           int    ie   = pmax_hst->FindBin(nup4.Energy());
-           pmax = pmax_hst->GetBinContent(ie);
+        if(pmax < 0) {
+          if(fGenerateUnweighted) pmax = fGlobPmax;
+          else {
+             TH1D * pmax_hst = fNuPmax[inu];
+             assert(pmax_hst);
+             int    ie   = pmax_hst->FindBin(Ev);
+             pmax = pmax_hst->GetBinContent(ie);
+          }
+          assert(pmax>0);        
+          LOG("GMCJDriver", pDEBUG)
+            << "Pmax=" << pmax;
         }
-        assert(pmax>0);        
-        LOG("GMCJDriver", pDEBUG)
-          << "Pmax=" << pmax;
         probn = prob/pmax;
      }
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
      LOG("GMCJDriver", pNOTICE)
-         << "tgt: " << mpdg << " -> TotXSec = "
+         << "tgt: " << fMatPdg[imat] << " -> TotXSec = "
          << xsec/units::cm2 << " cm^2, Norm.Prob = " << 100*probn << "%";
 #endif
 
      probsum += probn;
-     fCurCumulProbMap.insert(map<int,double>::value_type(mpdg,probsum));
+     fCurCumulProb[imat] = probsum;
   }
   return probsum;
 }
@@ -1193,16 +2567,15 @@ int GMCJDriver::SelectTargetMaterial(double R)
 // for a flux neutrino that has already been determined that interacts
 
   LOG("GMCJDriver", pNOTICE) << "Selecting target material";
-  int tgtpdg = 0;
-  map<int,double>::const_iterator probiter = fCurCumulProbMap.begin();
-  for( ; probiter != fCurCumulProbMap.end(); ++probiter) {
-     double prob = probiter->second;
-     if(R<prob) {
-        tgtpdg = probiter->first;
-        LOG("GMCJDriver", pNOTICE) 
+
+  // first material with a cummulative probability above R
+  vector<double>::const_iterator probiter = 
+        upper_bound(fCurCumulProb.begin(), fCurCumulProb.end(), R);
+  if(probiter != fCurCumulProb.end()) {
+     int tgtpdg = fMatPdg[probiter - fCurCumulProb.begin()];
+     LOG("GMCJDriver", pNOTICE) 
           << "Selected target material = " << tgtpdg;
-        return tgtpdg;
-     }
+     return tgtpdg;
   }
   LOG("GMCJDriver", pERROR)
      << "Could not select target material for an interacting neutrino";
@@ -1216,11 +2589,14 @@ void GMCJDriver::GenerateEventKinematics(void)
 
   // Find the GEVGDriver object that generates interactions for the
   // given initial state (neutrino + target)
-  InitialState init_state(fSelTgtPdg, nupdg);
-  GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+  int inu  = this->NeutrinoIndex(nupdg);
+  int imat = this->MaterialIndex(fSelTgtPdg);
+  GEVGDriver * evgdriver = (inu >= 0 && imat >= 0) ? 
+        fMatDrivers[inu*fMatPdg.size() + imat] : 0;
   if(!evgdriver) {
      LOG("GMCJDriver", pFATAL)
-       << "No GEVGDriver object for init state: " << init_state.AsString();
+       << "No GEVGDriver object for init state: " 
+       << InitialState(fSelTgtPdg, nupdg).AsString();
      exit(1);
   }
 
@@ -1232,6 +2608,7 @@ void GMCJDriver::GenerateEventKinematics(void)
   LOG("GMCJDriver", pNOTICE)
           << "Asking the selected GEVGDriver object to generate an event";
   fCurEvt = evgdriver->GenerateEvent(nup4);
+  fCurEvtFilteredOut = (!fCurEvt && evgdriver->LastEventFilteredOut());
 }
 //___________________________________________________________________________
 void GMCJDriver::GenerateVertexPosition(void)
@@ -1297,6 +2674,9 @@ void GMCJDriver::ComputeEventProbability(void)
      weight = pmax/fGlobPmax;
   }
 
+  // compensate for the biased flux neutrino sampling
+  if(fFluxBiased) weight *= fFluxDriver->BiasWeight();
+
   // set probability & update weight
   fCurEvt->SetProbability(P);
   fCurEvt->SetWeight(weight * fCurEvt->Weight());
@@ -7,6 +7,31 @@
           generation cases involving detailed flux descriptions and detector 
           geometry descriptions.
 
+          Embedding in experiment frameworks: events can be generated in a
+          record owned by the caller (GenerateEvent(EventRecord &)) or lent
+          to a sink one at a time (GenerateEvents(long int, GMCJEventSinkI &)),
+          so that no record is allocated per event, and their particles read
+          in place (EventRecord::Particles()). A driver can own its random
+          number generator (UseRandomGen()).
+
+          Thread-safety contract:
+          - A driver must only be used (configured or generating events) by
+            one thread at a time.
+          - Drivers may generate events concurrently in different threads if
+            each has its own flux and geometry drivers and random number
+            generator (UseRandomGen(), or a RandomGen thread instance), and
+            the threads have their own RunningThreadInfo and Cache instances
+            (see CreateThreadInstance()).
+          - Drivers must be configured serially, as the algorithm factory,
+            the configuration pool and the spline list are not protected
+            against concurrent writes.
+          - The event generators and their modules keep per-event state, so
+            drivers generating events concurrently must use private copies
+            of them (UsePrivateAlgorithms()) rather than the AlgFactory
+            instances. ROOT's gRandom and PYTHIA6, which can not be copied,
+            are used under the ProcessGeneratorLock.
+          GenerateEvents(long int, int) applies this contract for the caller.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -23,6 +48,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include <TH1D.h>
 #include <TLorentzVector.h>
@@ -35,14 +61,23 @@
 
 using std::string;
 using std::map;
+using std::vector;
 
 namespace genie {
 
 class EventRecord;
+class EventRecordPool;
+class EventGeneratorList;
 class GFluxI;
 class GeomAnalyzerI;
 class GENIE;
 class GEVGPool;
+class GEVGDriver;
+class GMCJWorkerFactoryI;
+class GMCJEventSinkI;
+class RandomGen;
+class Spline;
+class SplineBank;
 
 class GMCJDriver {
 
@@ -63,16 +98,65 @@ public :
   bool PreCalcFluxProbabilities    (void);
   bool LoadFluxProbabilities       (string filename);
   void SaveFluxProbabilities       (string outfilename);
+  void SetFluxProbThreads          (int nthreads);
+  void UseAdaptiveProbScales       (double tolerance = 0.05);
+  void SetProbScaleThreads         (int nthreads);
+  void SetDriverPoolThreads        (int nthreads);
+  void PrecomputeMaxXSec           (int nknots = 100, int njobs = 1);
+  void LoadProbScales              (string filename);
+  void SaveProbScales              (string outfilename);
+  void UseImportanceSampling       (bool on = true);
+  void CachePathLengths            (long int max_entries = 1000000);
   void Configure                   (bool calc_prob_scales = true);
 
   // generate single neutrino event for input flux & geometry
   EventRecord * GenerateEvent (void);
 
+  // generate single neutrino event in the input (caller-owned) record, which
+  // is reset first. Returns false if no event could be generated.
+  bool GenerateEvent (EventRecord & event);
+
+  // generate (up to) nev events, lending each in turn to the input sink (the
+  // records are re-used). Stops early if the sink asks so or if the flux
+  // driver is exhausted. Returns the number of events handed to the sink.
+  long int GenerateEvents (long int nev, GMCJEventSinkI & sink);
+
+  // use a random number generator owned by this driver (seeded with the
+  // input seed, see RandomGen::CreateInstance()) rather than the running
+  // thread's one, for all the draws made while generating events
+  void        UseRandomGen (long int seed);
+  RandomGen * RandomGenPtr (void) const { return fRandomGen; }
+
+  // use private copies of the event generators (& of all their modules)
+  // rather than the AlgFactory instances shared by all drivers, so that
+  // events can be generated while other drivers do so in other threads.
+  // To be set before Configure().
+  void UsePrivateAlgorithms (bool on = true) { fPrivateAlgorithms = on; }
+
+  // give back a generated event (instead of deleting it) for re-use
+  void RecycleEvent (EventRecord * event) const;
+
+  // index of the next event to be generated (the event index of the
+  // counter-based random number streams, see RandomGen)
+  void     SetEventIndex (Long64_t ievent) { fEventIndex = ievent; }
+  Long64_t EventIndex    (void) const      { return fEventIndex;   }
+
+  // multi-threaded event generation: generate nev events using nthreads
+  // worker drivers, each with its own flux and geometry driver (obtained
+  // from the input factory) and sharing the read-only physics tables.
+  // Returns the number of events handed to the factory.
+  void     UseWorkerFactory (GMCJWorkerFactoryI * factory);
+  long int GenerateEvents   (long int nev, int nthreads);
+
   // info needed for computing the generated sample normalization
   double   GlobProbScale  (void) const { return fGlobPmax;                  }
   long int NFluxNeutrinos (void) const { return (long int) fNFluxNeutrinos; }
   map<int, double> SumFluxIntProbs(void) const { return fSumFluxIntProbs;   }
 
+  // restart of an interrupted MC job: restore the normalization counters
+  // saved at its last checkpoint (see NtpMCCheckpoint)
+  void RestoreCounters (long int nflux, const map<int, double> & sumfluxintprobs);
+
   // input flux and geometry drivers
   const GFluxI &        FluxDriver      (void) const { return *fFluxDriver;   }
   const GeomAnalyzerI & GeomAnalyzer    (void) const { return *fGeomAnalyzer; }
@@ -90,20 +174,40 @@ private:
   void          PopulateEventGenDriverPool      (void);
   void          BootstrapXSecSplines            (void);
   void          BootstrapXSecSplineSummation    (void);
+  void          BootstrapMaxXSecEnvelopes       (void);
   void          ComputeProbScales               (void);
+  void          ProbScaleHashes                 (string & flux_hash, string & geom_hash, string & tune_hash) const;
+  bool          ReadProbScales                  (void);
+  void          WriteProbScales                 (void) const;
+  void          FluxProbHashes                  (string & flux_hash, string & geom_hash, string & tune_hash) const;
+  bool          ScanFluxIntProbs                (int ithread, int nthreads, vector<double> & entries);
+  bool          ReadFluxSummary                 (void);
+  void          WriteFluxSummary                (void) const;
+  void          IndexMaterials                  (void);
+  void          IndexProbScales                 (void);
+  void          FillPathLengthArray             (const PathLengthList & pl, vector<double> & plarr, bool is_current) const;
+  int           MaterialIndex                   (int tgt_pdgc) const;
+  int           NeutrinoIndex                   (int nu_pdgc) const;
   EventRecord * GenerateEvent1Try               (void);
   bool          GenerateFluxNeutrino            (void);
   bool          ComputePathLengths              (void);
   double	ComputeInteractionProbabilities (bool use_max_path_length);
+  void          BuildPreSelection               (void);
+  void          ClearPreSelection               (void);
+  double        PreSelectionProbability         (void);
   int           SelectTargetMaterial            (double R);
   void          GenerateEventKinematics         (void);
   void          GenerateVertexPosition          (void);
   void          ComputeEventProbability         (void);
   double        InteractionProbability          (double xsec, double pl, int A);
   double        PreGenFluxInteractionProbability(void);
+  GMCJDriver *  CreateWorker                    (int ithread, bool generate_events);
+  void          CopyProbScales                  (const GMCJDriver & driver);
+  void          BiasFluxDriver                  (void);
 
   // private data members:
   GEVGPool *      fGPool;              ///< A pool of GEVGDrivers properly configured event generation drivers / one per init state
+  EventRecordPool * fRecordPool;       ///< event records given back by the client (see RecycleEvent()), shared by all GEVGDrivers of the pool
   GFluxI *        fFluxDriver;         ///< [input] neutrino flux driver
   GeomAnalyzerI * fGeomAnalyzer;       ///< [input] detector geometry analyzer
   double          fEmax;               ///< [declared by the flux driver] maximum neutrino energy 
@@ -113,9 +217,24 @@ private:
   PathLengthList  fCurPathLengths;     ///< [current] path length list for current flux neutrino
   TLorentzVector  fCurVtx;             ///< [current] interaction vertex
   EventRecord *   fCurEvt;             ///< [current] generated event
+  bool            fCurEvtFilteredOut;  ///< [current] event rejected by the event filter (see EventFilterI)?
   int             fSelTgtPdg;          ///< [current] selected target material PDG code
-  map<int,double> fCurCumulProbMap;    ///< [current] cummulative interaction probabilities
+  vector<double>  fCurCumulProb;       ///< [current] cummulative interaction probabilities, per material index
+  vector<double>  fCurPL;              ///< [current] path lengths for current flux neutrino, per material index
+  vector<int>     fMatPdg;             ///< [computed at init] target material PDG codes in increasing order (material index -> PDG code)
+  vector<int>     fMatA;               ///< [computed at init] target material mass numbers, per material index
+  vector<double>  fMatMaxPL;           ///< [computed at init] maximum path lengths, per material index
+  vector<GEVGDriver*>   fMatDrivers;   ///< [computed at init] event generation drivers, index: neutrino index * nmat + material index
+  vector<const Spline*> fMatXSecSum;   ///< [computed at init] total xsec splines, same indexing as fMatDrivers
+  vector<TH1D*>   fNuPmax;             ///< [computed at init] fPmax content per neutrino index (not owned)
+  bool                 fPreSelBanked;     ///< [computed at init] pre-selection kernel available?
+  vector<SplineBank*>  fPreSelBanks;      ///< [computed at init] pre-selection: total xsec splines of materials with max path length > 0, banked
+  vector<int>          fPreSelFirstBank;  ///< [computed at init] pre-selection: first bank of each neutrino index (size: nnu+1)
+  vector<int>          fPreSelFirstCoef;  ///< [computed at init] pre-selection: first coefficient of each bank
+  vector<double>       fPreSelCoef;       ///< [computed at init] pre-selection: interaction probability per unit xsec at max path length
+  vector<double>       fPreSelXSec;       ///< pre-selection work buffer
   double          fNFluxNeutrinos;     ///< [current] number of flux nuetrinos fired by the flux driver so far 
+  Long64_t        fEventIndex;         ///< [current] index of the next event (keys the counter-based random number streams)
   map<int,TH1D*>  fPmax;               ///< [computed at init] interaction probability scale /neutrino /energy for given geometry
   double          fGlobPmax;           ///< [computed at init] global interaction probability scale for given flux & geometry
   string          fEventGenList;       ///< [config] list of event generators loaded by this driver (what used to be the $GEVGL setting)
@@ -137,6 +256,26 @@ private:
   string          fFluxIntFileName;    ///< whether to save pre-generated flux tree for use in later jobs
   string          fFluxIntTreeName;    ///< name for tree holding flux probabilities 
   map<int, double> fSumFluxIntProbs;   ///< map where the key is flux pdg code and the value is sum of fBrFluxWeight * fBrFluxIntProb for all these flux neutrinos 
+  bool            fFluxSummaryLoaded;  ///< [loaded] fGlobPmax & fSumFluxIntProbs read from the pre-generated flux interaction probability file?
+  int             fNFluxProbThreads;   ///< [config] number of threads computing the flux interaction probabilities
+  GMCJWorkerFactoryI * fWorkerFactory; ///< [config] creates per-thread flux & geometry drivers in multi-threaded mode
+  bool            fAdaptivePmax;       ///< [config] use adaptive energy bins for the probability scales?
+  double          fAdaptivePmaxTol;    ///< [config] relative tolerance for merging probability scale energy bins
+  int             fNProbScaleThreads;  ///< [config] number of threads used for computing the probability scales
+  int             fNPoolThreads;       ///< [config] number of threads building the interaction lists of the GEVGPool drivers
+  bool            fPrecompMaxXSec;     ///< [config] precompute the max{dxsec/dK} envelopes at init?
+  int             fPrecompMaxXSecNKnots; ///< [config] number of energy knots of the max{dxsec/dK} envelopes
+  int             fPrecompMaxXSecNJobs;  ///< [config] number of processes used for computing the max{dxsec/dK} envelopes
+  string          fProbScalesInFile;   ///< [config] file with probability scales saved by an earlier job
+  string          fProbScalesOutFile;  ///< [config] file to save the computed probability scales to
+  bool            fImportanceSampling; ///< [config] have the flux driver sample from flux x max. interaction probability?
+  bool            fFluxBiased;         ///< [computed at init] the flux driver samples from the biased spectra
+  long int        fPathLengthCacheMax; ///< [config] max number of flux rays with cached path lengths (0: no caching)
+  map<long int, PathLengthList> fPathLengthCache; ///< [current] path lengths per flux ray (flux driver Index()), for flux drivers with FixedRays()
+  long int        fNPathLengthCacheHits; ///< [current] number of path length computations skipped
+  RandomGen *     fRandomGen;          ///< [config] random number generator owned by this driver (if any, see UseRandomGen())
+  bool            fPrivateAlgorithms;  ///< [config] use private copies of the event generators?
+  EventGeneratorList * fPrivateEvGenList; ///< [computed at init] private event generators, shared by the GEVGPool drivers (owned)
 };
 
 }      // genie namespace
@@ -0,0 +1,28 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include "Framework/EventGen/GMCJEventSinkI.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+GMCJEventSinkI::GMCJEventSinkI() 
+{
+
+}
+//___________________________________________________________________________
+GMCJEventSinkI::~GMCJEventSinkI()
+{
+
+}
+//___________________________________________________________________________
@@ -0,0 +1,51 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GMCJEventSinkI
+
+\brief    Interface for the code that consumes the events generated by a
+          GMCJDriver embedded in an experiment framework (see
+          GMCJDriver::GenerateEvents(long int, GMCJEventSinkI &)).
+          The sink is lent each event in turn, eg to convert it to the event
+          data model of the framework, and must copy whatever it needs:
+          The record is re-used for the next event as soon as HandleEvent()
+          returns (so no record is allocated or deleted per event).
+          The particles can be read in place through EventRecord::Particles()
+          (see GHepParticleView).
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_MC_JOB_EVENT_SINK_I_H_
+#define _G_MC_JOB_EVENT_SINK_I_H_
+
+namespace genie {
+
+class EventRecord;
+class GMCJDriver;
+
+class GMCJEventSinkI {
+
+public :
+  virtual ~GMCJEventSinkI();
+
+  //
+  // define the GMCJEventSinkI interface:
+  //
+  //! consume a generated event (lent only for the duration of the call);
+  //! return false to stop the event generation
+  virtual bool HandleEvent (const EventRecord & event, const GMCJDriver & driver) = 0;
+
+protected:
+  GMCJEventSinkI();
+};
+
+}      // genie namespace
+#endif // _G_MC_JOB_EVENT_SINK_I_H_
@@ -14,12 +14,17 @@
    fCpuTime wasn't initialized.
  @ Jan 30, 2013 - CA
    Added SetRefreshRate(int rate)
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the export of the job metrics (throughput, flux neutrinos per event,
+   rejected tries per channel, time per module, memory, application gauges)
+   as JSON lines or in the Prometheus text format, see SetMetricsFormat().
 
 */
 //____________________________________________________________________________
 
 #include <sstream>
 #include <fstream>
+#include <cstdio>
 #include <cstdlib>
 
 #include <TSystem.h>
@@ -27,8 +32,12 @@
 
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/EventGen/ModuleTimingStats.h"
+#include "Framework/EventGen/RejectedEventStats.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/MemoryStats.h"
 #include "Framework/Utils/PrintUtils.h"
 
 using std::ostringstream;
@@ -38,6 +47,39 @@ using std::ofstream;
 
 using namespace genie;
 
+namespace {
+  //! escapes a string for a JSON string / Prometheus label value
+  string Quoted(const string & s)
+  {
+    string q = "\"";
+    for(unsigned int i = 0; i < s.size(); i++) {
+      if     (s[i] == '"' || s[i] == '\\') { q += '\\'; q += s[i]; }
+      else if(s[i] == '\n')                { q += "\\n";          }
+      else                                 { q += s[i];            }
+    }
+    return q + "\"";
+  }
+  //! appends a metric sample in the Prometheus text format
+  void AddSample(ostringstream & out, const string & name, Long_t runnu,
+                 double value, const string & label = "", const string & lval = "")
+  {
+    out << name << "{run=\"" << runnu << "\"";
+    if(label.size()) out << "," << label << "=" << Quoted(lval);
+    out << "} " << value << endl;
+  }
+  //! appends a map of values as a JSON object
+  template<class T> void AddObject(ostringstream & out, const map<string,T> & m)
+  {
+    out << "{";
+    typename map<string,T>::const_iterator it = m.begin();
+    for( ; it != m.end(); ++it) {
+      if(it != m.begin()) out << ",";
+      out << Quoted(it->first) << ":" << it->second;
+    }
+    out << "}";
+  }
+}
+
 //____________________________________________________________________________
 GMCJMonitor::GMCJMonitor(Long_t runnu) :
 fRunNu(runnu)
@@ -61,6 +103,8 @@ void GMCJMonitor::Update(int iev, const EventRecord * event)
 
   fWatch.Stop();
   fCpuTime += (fWatch.CpuTime());
+  double interval = fWatch.RealTime();
+  fRealTime += interval;
 
   ofstream out(fStatusFile.c_str(), ios::out);
 
@@ -74,15 +118,157 @@ void GMCJMonitor::Update(int iev, const EventRecord * event)
   status << "Approximate processing time/event: " 
                      << fCpuTime/(iev+1) << " s" << endl;
 
+  // time lost in events rejected as unphysical, per interaction channel
+  RejectedEventStats * rejstats = RejectedEventStats::Instance();
+  status << *rejstats << endl;
+
   if(!event) status << "NULL" << endl;
   else       status << *event << endl;
 
   out << status.str();
   out.close();
 
+  if(this->MetricsEnabled()) this->WriteMetrics(iev, interval);
+
   fWatch.Start();
 }
 //____________________________________________________________________________
+void GMCJMonitor::SetMetricsFormat(string format, string filename)
+{
+  if(format != "" && format != "json" && format != "prometheus") {
+    LOG("GMCJMonitor", pFATAL)
+      << "Unknown job metrics format: " << format
+      << " (expected json or prometheus) - Exiting";
+    exit(1);
+  }
+  fMetricsFormat = format;
+  fMetricsOpen   = false;
+
+  if(filename.size() > 0) {
+    fMetricsFile = filename;
+  } else {
+    ostringstream name;
+    name << "genie-mcjob-" << fRunNu
+         << ((format == "json") ? ".metrics.jsonl" : ".prom");
+    fMetricsFile = name.str();
+  }
+}
+//____________________________________________________________________________
+void GMCJMonitor::WriteMetrics(int iev, double interval)
+{
+// Exports the job metrics at a refresh. Everything exported here is either
+// kept by the monitor or summarized from statistics collected anyway, so
+// that the cost is paid once per refresh rather than per event
+
+  long int nev = iev + 1;
+  double rate      = (interval > 0) ? (nev - fNEvLast) / interval : 0.;
+  double mean_rate = (fRealTime > 0) ? nev / fRealTime : 0.;
+  fNEvLast = nev;
+
+  double nflux = (fMCJDriver) ? (double) fMCJDriver->NFluxNeutrinos() : -1.;
+
+  RejectedEventStats * rejstats = RejectedEventStats::Instance();
+  map<string, long int> nrej = rejstats->NRejectedPerChannel();
+  map<string, double>   trej = rejstats->TimeRejectedPerChannel();
+
+  map<string, double> tmod;
+  if(ModuleTimingStats::IsEnabled()) {
+    tmod = ModuleTimingStats::Instance()->TotalTimePerModule();
+  }
+
+  double rss = MemoryStats::ResidentBytes();
+
+  ostringstream metrics;
+  map<string, long int>::const_iterator nit;
+  map<string, double>::const_iterator   dit;
+
+  if(fMetricsFormat == "json") {
+    metrics << "{\"run\":" << fRunNu
+            << ",\"events\":" << nev
+            << ",\"wall_time\":" << fRealTime
+            << ",\"cpu_time\":" << fCpuTime
+            << ",\"events_per_second\":" << rate
+            << ",\"mean_events_per_second\":" << mean_rate;
+    if(fMCJDriver) {
+      metrics << ",\"flux_neutrinos\":" << nflux
+              << ",\"flux_neutrinos_per_event\":" << nflux/nev;
+    }
+    metrics << ",\"rejected_tries\":" << rejstats->NRejected()
+            << ",\"rejected_tries_per_event\":"
+            << double(rejstats->NRejected())/nev
+            << ",\"abandoned_events\":" << rejstats->NAbandoned()
+            << ",\"rejected_tries_per_channel\":";
+    AddObject(metrics, nrej);
+    metrics << ",\"rejected_time_per_channel\":";
+    AddObject(metrics, trej);
+    if(tmod.size() > 0) {
+      metrics << ",\"module_time\":";
+      AddObject(metrics, tmod);
+    }
+    metrics << ",\"resident_bytes\":" << rss;
+    for(dit = fGauges.begin(); dit != fGauges.end(); ++dit) {
+      metrics << "," << Quoted(dit->first) << ":" << dit->second;
+    }
+    metrics << "}" << endl;
+
+    // one line per refresh
+    ofstream out(fMetricsFile.c_str(), (fMetricsOpen) ? ios::app : ios::out);
+    out << metrics.str();
+    out.close();
+  }
+  else {
+    const string p = "genie_mcjob_";
+    metrics << "# TYPE " << p << "events_total counter" << endl;
+    AddSample(metrics, p+"events_total", fRunNu, nev);
+    metrics << "# TYPE " << p << "wall_seconds_total counter" << endl;
+    AddSample(metrics, p+"wall_seconds_total", fRunNu, fRealTime);
+    metrics << "# TYPE " << p << "cpu_seconds_total counter" << endl;
+    AddSample(metrics, p+"cpu_seconds_total", fRunNu, fCpuTime);
+    metrics << "# TYPE " << p << "events_per_second gauge" << endl;
+    AddSample(metrics, p+"events_per_second", fRunNu, rate);
+    if(fMCJDriver) {
+      metrics << "# TYPE " << p << "flux_neutrinos_total counter" << endl;
+      AddSample(metrics, p+"flux_neutrinos_total", fRunNu, nflux);
+      metrics << "# TYPE " << p << "flux_neutrinos_per_event gauge" << endl;
+      AddSample(metrics, p+"flux_neutrinos_per_event", fRunNu, nflux/nev);
+    }
+    metrics << "# TYPE " << p << "abandoned_events_total counter" << endl;
+    AddSample(metrics, p+"abandoned_events_total", fRunNu, rejstats->NAbandoned());
+    metrics << "# TYPE " << p << "rejected_tries_total counter" << endl;
+    for(nit = nrej.begin(); nit != nrej.end(); ++nit) {
+      AddSample(metrics, p+"rejected_tries_total", fRunNu,
+                nit->second, "channel", nit->first);
+    }
+    metrics << "# TYPE " << p << "rejected_seconds_total counter" << endl;
+    for(dit = trej.begin(); dit != trej.end(); ++dit) {
+      AddSample(metrics, p+"rejected_seconds_total", fRunNu,
+                dit->second, "channel", dit->first);
+    }
+    if(tmod.size() > 0) {
+      metrics << "# TYPE " << p << "module_seconds_total counter" << endl;
+      for(dit = tmod.begin(); dit != tmod.end(); ++dit) {
+        AddSample(metrics, p+"module_seconds_total", fRunNu,
+                  dit->second, "module", dit->first);
+      }
+    }
+    metrics << "# TYPE " << p << "resident_bytes gauge" << endl;
+    AddSample(metrics, p+"resident_bytes", fRunNu, rss);
+    for(dit = fGauges.begin(); dit != fGauges.end(); ++dit) {
+      metrics << "# TYPE " << p << dit->first << " gauge" << endl;
+      AddSample(metrics, p+dit->first, fRunNu, dit->second);
+    }
+
+    // rewritten at each refresh; renamed into place so that a scraper never
+    // reads a partial file
+    string tmpfile = fMetricsFile + ".tmp";
+    ofstream out(tmpfile.c_str(), ios::out);
+    out << metrics.str();
+    out.close();
+    rename(tmpfile.c_str(), fMetricsFile.c_str());
+  }
+  fMetricsOpen = true;
+}
+//____________________________________________________________________________
 void GMCJMonitor::Init(void)
 {
   // build the filename of the GENIE status file
@@ -93,7 +279,11 @@ void GMCJMonitor::Init(void)
   // create a stopwatch
   fWatch.Reset(); 
   fWatch.Start();
-  fCpuTime = 0;
+  fCpuTime  = 0;
+  fRealTime = 0;
+  fNEvLast  = 0;
+  fMCJDriver = 0;
+  fGauges.clear();
 
   // get rehreah rate of set default / protect from invalid refresh rates
   if( gSystem->Getenv("GMCJMONREFRESH") ) {
@@ -101,6 +291,12 @@ void GMCJMonitor::Init(void)
   } else fRefreshRate = 100;
 
   fRefreshRate = TMath::Max(1,fRefreshRate);
+
+  // export the job metrics?
+  fMetricsOpen = false;
+  if( gSystem->Getenv("GMCJMONMETRICS") ) {
+   this->SetMetricsFormat( gSystem->Getenv("GMCJMONMETRICS") );
+  }
 }
 //____________________________________________________________________________
 
@@ -6,6 +6,20 @@
 \brief   Simple class to create & update MC job status files and env. vars.
          This is used to be able to keep track of an MC job status even when
          all output is suppressed or redirected to /dev/null.
+         The status file also summarizes, per interaction channel, the
+         event generation tries rejected as unphysical (RejectedEventStats).
+
+         It can also export, at each refresh, the job metrics in a machine
+         readable format, for monitoring a fleet of jobs: event throughput,
+         flux neutrinos thrown per event (see SetMCJDriver()), rejected tries
+         per channel, time per event generation module (when the module
+         timing is on, see ModuleTimingStats), resident memory and any gauge
+         provided by the application (eg the writer queue depth). The format
+         is either `json' (one JSON object per refresh appended to
+         genie-mcjob-[run].metrics.jsonl) or `prometheus' (the Prometheus
+         text format, genie-mcjob-[run].prom rewritten at each refresh, as
+         expected by the node exporter textfile collector). It is set with
+         SetMetricsFormat() or the GMCJMONMETRICS env. var.
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
@@ -21,11 +35,18 @@
 #ifndef _G_MC_JOB_MONITOR_H_
 #define _G_MC_JOB_MONITOR_H_
 
+#include <map>
+#include <string>
+
 #include <TStopwatch.h>
 
+using std::map;
+using std::string;
+
 namespace genie {
 
 class EventRecord;
+class GMCJDriver;
 
 class GMCJMonitor {
 
@@ -37,15 +58,35 @@ public :
   void Update (int iev, const EventRecord * event);
   void CustomizeFilename(string filename);
 
+  //! export the job metrics: format is json, prometheus or empty (none);
+  //! the filename defaults to genie-mcjob-[run].metrics.jsonl / .prom
+  void SetMetricsFormat (string format, string filename = "");
+  bool MetricsEnabled   (void) const { return fMetricsFormat.size() > 0; }
+
+  //! the driver whose flux neutrino count is exported with the metrics
+  void SetMCJDriver (const GMCJDriver * mcj_driver) { fMCJDriver = mcj_driver; }
+
+  //! set an application-provided metric (exported as genie_mcjob_[name])
+  void SetGauge (string name, double value) { fGauges[name] = value; }
+
 private:
 
-  void Init (void);
+  void Init         (void);
+  void WriteMetrics (int iev, double interval);
 
   Long_t     fRunNu;       ///< run number
   string     fStatusFile;  ///< name of output status file
   TStopwatch fWatch;       
   double     fCpuTime;     ///< total cpu time so far
   int        fRefreshRate; ///< update output every so many events
+
+  string              fMetricsFormat; ///< json, prometheus or empty (no metrics)
+  string              fMetricsFile;   ///< name of output metrics file
+  bool                fMetricsOpen;   ///< metrics file already created?
+  double              fRealTime;      ///< total wall-clock time so far
+  long int            fNEvLast;       ///< number of events at the last refresh
+  const GMCJDriver *  fMCJDriver;     ///< driver of the job (optional)
+  map<string, double> fGauges;        ///< application-provided metrics
 };
 
 }      // genie namespace
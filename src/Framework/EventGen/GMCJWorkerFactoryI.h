@@ -0,0 +1,53 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GMCJWorkerFactoryI
+
+\brief    Interface used by GMCJDriver in its multi-threaded event generation
+          mode (see GMCJDriver::GenerateEvents). 
+          Each worker thread needs its own flux cursor and geometry navigator,
+          so the user supplies a factory creating one flux driver and one
+          geometry analyzer per worker. Generated events are handed back to
+          the factory, one at a time (calls to HandleEvent are serialized).
+          Once done with an event, HandleEvent may give it back to the input
+          (worker) driver for re-use, see GMCJDriver::RecycleEvent(), rather
+          than deleting it.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_MC_JOB_WORKER_FACTORY_I_H_
+#define _G_MC_JOB_WORKER_FACTORY_I_H_
+
+namespace genie {
+
+class EventRecord;
+class GFluxI;
+class GeomAnalyzerI;
+class GMCJDriver;
+
+class GMCJWorkerFactoryI {
+
+public :
+  virtual ~GMCJWorkerFactoryI();
+
+  //
+  // define the GMCJWorkerFactoryI interface:
+  //
+  virtual GFluxI *        CreateFluxDriver   (int ithread) = 0; ///< flux driver for the given worker (the factory retains ownership)
+  virtual GeomAnalyzerI * CreateGeomAnalyzer (int ithread) = 0; ///< geometry analyzer for the given worker (the factory retains ownership)
+  virtual void            HandleEvent        (int ithread, EventRecord * event, const GMCJDriver & driver) = 0; ///< adopt a generated event (serialized)
+
+protected:
+  GMCJWorkerFactoryI();
+};
+
+}      // genie namespace
+#endif // _G_MC_JOB_WORKER_FACTORY_I_H_
@@ -10,11 +10,19 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added a batch ComputePathLengths() filling a dense [rays x targets] matrix.
 
 */
 //____________________________________________________________________________
 
+#include <TMath.h>
+
 #include "Framework/EventGen/GeomAnalyzerI.h"
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+
+using std::vector;
 
 using namespace genie;
 
@@ -29,4 +37,22 @@ GeomAnalyzerI::~GeomAnalyzerI()
 
 }
 //____________________________________________________________________________
+void GeomAnalyzerI::ComputePathLengths(
+  const vector<TLorentzVector> & x, const vector<TLorentzVector> & p, 
+  vector<double> & pl)
+{
+  const PDGCodeList & targets = this->ListOfTargetNuclei();
+  const unsigned int ntgt  = targets.size();
+  const unsigned int nrays = TMath::Min(x.size(), p.size());
+
+  pl.assign(nrays*ntgt, 0.);
+
+  for(unsigned int iray = 0; iray < nrays; iray++) {
+    const PathLengthList & raypl = this->ComputePathLengths(x[iray], p[iray]);
+    for(unsigned int itgt = 0; itgt < ntgt; itgt++) {
+      pl[iray*ntgt + itgt] = raypl.PathLength(targets[itgt]);
+    }
+  }
+}
+//____________________________________________________________________________
 
@@ -19,7 +19,10 @@
 #ifndef _GEOMETRY_ANALYZER_I_H_
 #define _GEOMETRY_ANALYZER_I_H_
 
-class TLorentzVector;
+#include <vector>
+
+#include <TLorentzVector.h>
+
 class TVector3;
 
 namespace genie {
@@ -43,6 +46,15 @@ public :
   virtual const PathLengthList &
             ComputePathLengths (
               const TLorentzVector & x, const TLorentzVector & p) = 0;
+
+  /// Path lengths of a batch of rays (x[i], p[i]) in the dense, row-major
+  /// [rays x targets] matrix pl, with targets ordered as ListOfTargetNuclei().
+  /// The default implementation loops over the single-ray method; geometry
+  /// drivers may override it to amortize their setup over the batch.
+  virtual void
+            ComputePathLengths (
+              const std::vector<TLorentzVector> & x, 
+              const std::vector<TLorentzVector> & p, std::vector<double> & pl);
   virtual const TVector3 &
             GenerateVertex (
               const TLorentzVector & x, const TLorentzVector & p, int tgtpdg) = 0;
@@ -10,6 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The interactions linked to a generator are given the bundle of resolved
+   algorithms of their channel (see ResolvedAlgs).
 
 */
 //____________________________________________________________________________
@@ -23,6 +26,7 @@
 #include "Framework/EventGen/InteractionGeneratorMap.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/ResolvedAlgs.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 
@@ -70,6 +74,7 @@ void InteractionGeneratorMap::Init(void)
 
   fInitState       = new InitialState;
   fInteractionList = new InteractionList;
+  fInteractionList->SetOwner(false); // references the list generator templates
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::CleanUp(void)
@@ -78,6 +83,9 @@ void InteractionGeneratorMap::CleanUp(void)
   delete fInteractionList;
 
   this->clear();
+
+  fKeyIndex.clear();
+  fCollidingKeys.clear();
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
@@ -97,6 +105,9 @@ void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
 
     this->insert(map<string, const EventGeneratorI *>::value_type(code,evg));
   }
+
+  fKeyIndex      = xsmap.fKeyIndex;
+  fCollidingKeys = xsmap.fCollidingKeys;
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::UseGeneratorList(const EventGeneratorList * l)
@@ -119,7 +130,7 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
   fInitState->Copy(init_state);
 
   EventGeneratorList::const_iterator evgliter; // event generator list iter
-  InteractionList::iterator          intliter; // interaction list iter
+  InteractionList::const_iterator    intliter; // interaction list iter
 
   // loop over all EventGenerator objects used in the current job
   for(evgliter = fEventGeneratorList->begin();
@@ -128,18 +139,19 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
      const EventGeneratorI * evgen = *evgliter;
      assert(evgen);
 
-     // ask the event generator to produce a list of all interaction it can
-     // generate for the input initial state
+     // ask the event generator for the list of all interaction it can
+     // generate for the input initial state (shared by all the maps built
+     // for this initial state)
      SLOG("IntGenMap", pNOTICE)
         << "Querying [" << evgen->Id().Key() << "] for its InteractionList";
 
      const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
-     InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
+     const InteractionList * ilst = ilstgen->InteractionListTemplate(init_state);
 
      // no point to go on if the list is NULL - continue to next iteration
      if(!ilst) continue;
 
-     // append the new InteractionList to the local copy
+     // append references to the interactions of the list
      fInteractionList->Append(*ilst);
 
      // loop over all interaction that can be genererated by the current
@@ -154,10 +166,56 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
               << "\nLinking: " << code << " --> to: " << evgen->Id().Key();
         this->insert(
              map<string, const EventGeneratorI *>::value_type(code,evgen));
+
+        // resolve the algorithms of the channel once, here
+        ResolvedAlgs::Attach(interaction, evgen);
      } // loop over interactions
-     delete ilst;
-     ilst = 0;
   } // loop over event generators
+
+  this->BuildKeyIndex();
+}
+//___________________________________________________________________________
+void InteractionGeneratorMap::BuildKeyIndex(void)
+{
+// Index all associations by Interaction::Key() so that FindGenerator() does
+// not need to build & compare string codes for every event. Keys that turn
+// out to be shared by interactions with different string codes are flagged
+// and, for them, the look-up falls back to using the string code.
+
+  fKeyIndex.clear();
+  fCollidingKeys.clear();
+
+  map<ULong64_t, string> key_codes;
+
+  InteractionList::const_iterator intliter;
+  for(intliter = fInteractionList->begin(); 
+                      intliter != fInteractionList->end(); ++intliter) {
+     const Interaction * interaction = *intliter;
+     ULong64_t key  = interaction->Key();
+     string    code = interaction->AsString();
+
+     map<ULong64_t, string>::const_iterator kciter = key_codes.find(key);
+     if(kciter != key_codes.end()) {
+       if(kciter->second != code) {
+         LOG("IntGenMap", pINFO) 
+           << "Interaction key collision: " << code << " / " << kciter->second;
+         fCollidingKeys.insert(key);
+       }
+       continue;
+     }
+     key_codes.insert(map<ULong64_t, string>::value_type(key,code));
+
+     InteractionGeneratorMap::const_iterator evgiter = this->find(code);
+     if(evgiter != this->end()) {
+       fKeyIndex.insert(
+         map<ULong64_t, const EventGeneratorI *>::value_type(key,evgiter->second));
+     }
+  }
+
+  set<ULong64_t>::const_iterator citer;
+  for(citer = fCollidingKeys.begin(); citer != fCollidingKeys.end(); ++citer) {
+     fKeyIndex.erase(*citer);
+  }
 }
 //___________________________________________________________________________
 const EventGeneratorI * InteractionGeneratorMap::FindGenerator(
@@ -167,6 +225,11 @@ const EventGeneratorI * InteractionGeneratorMap::FindGenerator(
     LOG("IntGenMap", pWARN) << "Null interaction!!";
     return 0;
   }
+  ULong64_t key = interaction->Key();
+  map<ULong64_t, const EventGeneratorI *>::const_iterator kiter = 
+                                                       fKeyIndex.find(key);
+  if(kiter != fKeyIndex.end()) return kiter->second;
+
   string code = interaction->AsString();
   InteractionGeneratorMap::const_iterator evgiter = this->find(code);
   if(evgiter == this->end()) {
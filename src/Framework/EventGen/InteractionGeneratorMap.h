@@ -23,12 +23,14 @@
 #define _INTERACTION_GENERATOR_MAP_H_
 
 #include <map>
+#include <set>
 #include <string>
 #include <ostream>
 
 #include "Framework/Interaction/Interaction.h"
 
 using std::map;
+using std::set;
 using std::string;
 using std::ostream;
 
@@ -64,13 +66,17 @@ public :
 
 private:
 
-  void Init    (void);
-  void CleanUp (void);
+  void Init          (void);
+  void CleanUp       (void);
+  void BuildKeyIndex (void);
 
   const EventGeneratorList * fEventGeneratorList;
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+
+  map<ULong64_t, const EventGeneratorI *> fKeyIndex;     ///< Interaction::Key() -> generator
+  set<ULong64_t>                          fCollidingKeys; ///< keys shared by distinct interactions (looked-up by string)
 };
 
 }      // genie namespace
@@ -10,10 +10,15 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added lists holding references to Interaction objects owned elsewhere
+   (SetOwner()).
 
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
+
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
@@ -32,13 +37,15 @@ namespace genie {
 }
 //___________________________________________________________________________
 InteractionList::InteractionList() :
-vector<Interaction *>()
+vector<Interaction *>(),
+fOwner(true)
 {
 
 }
 //___________________________________________________________________________
 InteractionList::InteractionList(const InteractionList & intl) :
-vector<Interaction *>()
+vector<Interaction *>(),
+fOwner(true)
 {
   this->Copy(intl);
 }
@@ -52,32 +59,46 @@ void InteractionList::Reset(void)
 {
   InteractionList::const_iterator iter;
 
-  for(iter = this->begin(); iter != this->end(); ++iter) {
-    Interaction * interaction = *iter;
-    delete interaction;
-    interaction = 0;
+  if(fOwner) {
+    for(iter = this->begin(); iter != this->end(); ++iter) {
+      Interaction * interaction = *iter;
+      delete interaction;
+      interaction = 0;
+    }
   }
   this->clear();
 }
 //___________________________________________________________________________
 void InteractionList::Append(const InteractionList & intl)
 {
+// Appends copies of the input Interaction objects or, for a list that does
+// not own its Interaction objects, references to them
+
   InteractionList::const_iterator iter;
   for(iter = intl.begin(); iter != intl.end(); ++iter) {
     Interaction * interaction = *iter;
-    this->push_back(new Interaction(*interaction));
+    if(fOwner) this->push_back(new Interaction(*interaction));
+    else       this->push_back(interaction);
   }
 }
 //___________________________________________________________________________
 void InteractionList::Copy(const InteractionList & intl)
 {
-  this->Reset();
+// Copies the input list, with the same ownership of the Interaction objects
 
-  InteractionList::const_iterator iter;
-  for(iter = intl.begin(); iter != intl.end(); ++iter) {
-    Interaction * interaction = *iter;
-    this->push_back(new Interaction(*interaction));
+  this->Reset();
+  fOwner = intl.fOwner;
+  this->Append(intl);
+}
+//___________________________________________________________________________
+void InteractionList::SetOwner(bool owner)
+{
+  if(!this->empty()) {
+    LOG("IntLst", pFATAL)
+      << "Can not change the ownership of a non-empty interaction list";
+    exit(1);
   }
+  fOwner = owner;
 }
 //___________________________________________________________________________
 void InteractionList::Print(ostream & stream) const
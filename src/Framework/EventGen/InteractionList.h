@@ -4,6 +4,11 @@
 \class   genie::InteractionList
 
 \brief   A vector of Interaction objects.
+         By default the list owns its Interaction objects: they are deleted
+         by Reset() and deep copied by Copy() & Append(). A list set not to
+         own them (see SetOwner()) holds references to Interaction objects
+         owned elsewhere, eg the interaction list templates of the
+         InteractionListGeneratorI algorithms.
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
@@ -39,13 +44,21 @@ public :
   InteractionList(const InteractionList & intl);
   ~InteractionList();
 
-  void Reset  (void);
-  void Append (const InteractionList & intl);
-  void Copy   (const InteractionList & intl);
-  void Print  (ostream & stream) const;
+  void Reset    (void);
+  void Append   (const InteractionList & intl);
+  void Copy     (const InteractionList & intl);
+  void Print    (ostream & stream) const;
+
+  //! does the list own (delete, deep copy) its Interaction objects?
+  //! (to be set on an empty list)
+  void SetOwner (bool owner);
+  bool IsOwner  (void) const { return fOwner; }
 
   InteractionList & operator =  (const InteractionList & intl);
   friend ostream &  operator << (ostream & stream, const InteractionList & intl);
+
+private:
+  bool fOwner;
 };
 
 }      // genie namespace
@@ -10,14 +10,27 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the interaction list templates (InteractionListTemplate()),
+   built under a lock and discarded at reconfiguration.
 
 */
 //____________________________________________________________________________
 
+#include <mutex>
+
+#include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Messenger/Messenger.h"
 
 using namespace genie;
 
+namespace {
+  // the list generators are shared (AlgFactory) by drivers built in parallel
+  std::mutex gInteractionListTemplateLock;
+}
+
 //___________________________________________________________________________
 InteractionListGeneratorI::InteractionListGeneratorI() :
 Algorithm()
@@ -40,6 +53,50 @@ Algorithm(name, config)
 //___________________________________________________________________________
 InteractionListGeneratorI::~InteractionListGeneratorI()
 {
+  this->DeleteTemplates();
+}
+//___________________________________________________________________________
+void InteractionListGeneratorI::Configure(const Registry & config)
+{
+  this->DeleteTemplates();
+  Algorithm::Configure(config);
+}
+//___________________________________________________________________________
+void InteractionListGeneratorI::Configure(string config)
+{
+  this->DeleteTemplates();
+  Algorithm::Configure(config);
+}
+//___________________________________________________________________________
+void InteractionListGeneratorI::DeleteTemplates(void)
+{
+  std::lock_guard<std::mutex> guard(gInteractionListTemplateLock);
+
+  map<string, InteractionList *>::iterator iter;
+  for(iter = fTemplates.begin(); iter != fTemplates.end(); ++iter) {
+    delete iter->second;
+  }
+  fTemplates.clear();
+}
+//___________________________________________________________________________
+const InteractionList * InteractionListGeneratorI::InteractionListTemplate(
+                                         const InitialState & init) const
+{
+  string key = init.AsString();
+
+  std::lock_guard<std::mutex> guard(gInteractionListTemplateLock);
+
+  map<string, InteractionList *>::const_iterator iter = fTemplates.find(key);
+  if(iter != fTemplates.end()) return iter->second;
+
+  InteractionList * ilst = this->CreateInteractionList(init);
+  fTemplates.insert(map<string, InteractionList *>::value_type(key, ilst));
+
+  LOG("IntLst", pINFO)
+    << "Created the interaction list template of [" << this->Id().Key()
+    << "] for init state: " << key << " ("
+    << ((ilst) ? ilst->size() : 0) << " interactions)";
 
+  return ilst;
 }
 //___________________________________________________________________________
@@ -7,6 +7,11 @@
          Concrete implementations of this interface generate a list of all
          Interaction (= event summary) objects that can be generated by
          EventGeneratorI subclasses.
+         The lists created for each initial state are also kept by the
+         algorithm as immutable templates (see InteractionListTemplate()),
+         that the event generation drivers reference instead of copying.
+         The templates are discarded when the algorithm is reconfigured
+         (the subclasses Configure() methods call this class Configure()).
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
@@ -22,8 +27,14 @@
 #ifndef _INTERACTION_LIST_GENERATOR_I_H_
 #define _INTERACTION_LIST_GENERATOR_I_H_
 
+#include <map>
+#include <string>
+
 #include "Framework/Algorithm/Algorithm.h"
 
+using std::map;
+using std::string;
+
 namespace genie {
 
 class InteractionList;
@@ -38,12 +49,31 @@ public :
   virtual InteractionList *
                  CreateInteractionList(const InitialState & init) const = 0;
 
+  //-- the list of interactions for the input initial state, created (see
+  //   CreateInteractionList()) at the first request and owned by the
+  //   algorithm, so that all the drivers for the same initial state share
+  //   it. Can be null. The Interaction objects are not to be modified:
+  //   copy them first. Can be called concurrently (the drivers of a
+  //   GMCJDriver are built in parallel).
+  const InteractionList *
+                 InteractionListTemplate(const InitialState & init) const;
+
+  //-- override the Algorithm methods to discard the templates built with
+  //   the previous configuration
+  virtual void Configure (const Registry & config);
+  virtual void Configure (string config);
+
 protected :
 
   InteractionListGeneratorI();
   InteractionListGeneratorI(string name);
   InteractionListGeneratorI(string name, string config);
   ~InteractionListGeneratorI();
+
+private:
+  void DeleteTemplates (void);
+
+  mutable map<string, InteractionList *> fTemplates; //! init state -> interaction list
 };
 
 }      // genie namespace
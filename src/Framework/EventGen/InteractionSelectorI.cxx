@@ -15,6 +15,7 @@
 //____________________________________________________________________________
 
 #include "Framework/EventGen/InteractionSelectorI.h"
+#include "Framework/EventGen/EventRecord.h"
 #include "Framework/Interaction/Interaction.h"
 
 using namespace genie;
@@ -43,3 +44,22 @@ InteractionSelectorI::~InteractionSelectorI()
 
 }
 //___________________________________________________________________________
+bool InteractionSelectorI::SelectInteractionInRecord(
+     const InteractionGeneratorMap * igmp, const TLorentzVector & p4, 
+     EventRecord * evrec) const
+{
+// Default implementation: select using SelectInteraction() and transfer the
+// selected interaction to the input event record.
+
+  EventRecord * selected = this->SelectInteraction(igmp, p4);
+  if(!selected) return false;
+
+  evrec->AttachSummary(selected->Summary());
+  evrec->SetXSec(selected->XSec());
+
+  selected->AttachSummary(0);
+  delete selected;
+
+  return true;
+}
+//___________________________________________________________________________
@@ -38,6 +38,12 @@ public :
   virtual EventRecord * SelectInteraction
     (const InteractionGeneratorMap * igmp, const TLorentzVector & p4) const = 0;
 
+  //!  Same, but attach the selected interaction (and its cross section) to
+  //!  an existing, reset, event record rather than allocating a new one
+  virtual bool SelectInteractionInRecord
+    (const InteractionGeneratorMap * igmp, const TLorentzVector & p4, 
+     EventRecord * evrec) const;
+
 protected:
   InteractionSelectorI();
   InteractionSelectorI(string name);
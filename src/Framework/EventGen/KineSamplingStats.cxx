@@ -0,0 +1,201 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <iomanip>
+#include <mutex>
+
+#include <TTree.h>
+
+#include "Framework/EventGen/KineSamplingStats.h"
+#include "Framework/Messenger/Messenger.h"
+
+using std::endl;
+using std::setw;
+using std::setfill;
+using std::setprecision;
+
+using namespace genie;
+
+//____________________________________________________________________________
+KineSamplingStats * KineSamplingStats::fInstance = 0;
+bool                KineSamplingStats::fEnabled  =
+                                 (std::getenv("GEVGKINESTATS") != 0);
+
+// serializes access from multiple event generation threads
+static std::recursive_mutex gKineSamplingStatsLock;
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const KineSamplingStats & stats)
+  {
+    stats.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+KineSamplingStats::KineSamplingStats()
+{
+
+}
+//____________________________________________________________________________
+KineSamplingStats::~KineSamplingStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+KineSamplingStats * KineSamplingStats::Instance()
+{
+  std::lock_guard<std::recursive_mutex> guard(gKineSamplingStatsLock);
+
+  if(fInstance == 0) {
+    static KineSamplingStats::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new KineSamplingStats;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void KineSamplingStats::SetEnabled(bool on)
+{
+  fEnabled = on;
+}
+//____________________________________________________________________________
+void KineSamplingStats::Add(
+     const string & generator, const string & interaction, double E,
+     long int ntrials, long int nviolations, bool selected)
+{
+  int ie = (E > 0) ? int(std::floor(std::log10(E) * kNBinsPerDecade)) : -9999;
+
+  std::lock_guard<std::recursive_mutex> guard(gKineSamplingStatsLock);
+
+  Key_t key(Channel_t(generator, interaction), ie);
+  map<Key_t, Entry>::iterator it = fEntries.find(key);
+  if(it == fEntries.end()) {
+    Entry entry;
+    entry.nselected   = 0;
+    entry.nfailed     = 0;
+    entry.ntrials     = 0;
+    entry.nviolations = 0;
+    it = fEntries.insert(std::make_pair(key, entry)).first;
+  }
+  Entry & entry = it->second;
+  if(selected) entry.nselected++;
+  else         entry.nfailed++;
+  entry.ntrials     += ntrials;
+  entry.nviolations += nviolations;
+}
+//____________________________________________________________________________
+long int KineSamplingStats::NTrials(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gKineSamplingStatsLock);
+  long int n = 0;
+  map<Key_t, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) n += it->second.ntrials;
+  return n;
+}
+//____________________________________________________________________________
+long int KineSamplingStats::NSelected(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gKineSamplingStatsLock);
+  long int n = 0;
+  map<Key_t, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) n += it->second.nselected;
+  return n;
+}
+//____________________________________________________________________________
+void KineSamplingStats::Reset(void)
+{
+  std::lock_guard<std::recursive_mutex> guard(gKineSamplingStatsLock);
+  fEntries.clear();
+}
+//____________________________________________________________________________
+void KineSamplingStats::Print(ostream & stream) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gKineSamplingStatsLock);
+
+  long int ntrials   = this->NTrials();
+  long int nselected = this->NSelected();
+
+  stream << "Kinematics rejection sampling: " << nselected
+         << " selected kinematics in " << ntrials << " trials" << endl;
+
+  map<Key_t, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) {
+    const Entry & entry = it->second;
+    int    ie   = it->first.second;
+    double E0   = std::pow(10., double(ie)   / kNBinsPerDecade);
+    double E1   = std::pow(10., double(ie+1) / kNBinsPerDecade);
+    double eff  = (entry.ntrials > 0) ?
+                     100. * entry.nselected / entry.ntrials : 0.;
+    double fvio = (entry.ntrials > 0) ?
+                     100. * entry.nviolations / entry.ntrials : 0.;
+    stream << " | " << setfill(' ') << setw(40) << it->first.first.first
+           << " | " << setw(50) << it->first.first.second
+           << " | E: " << setprecision(3) << setw(8) << E0
+           << " - "    << setw(8) << E1 << " GeV"
+           << " | selected: "   << setw(10) << entry.nselected
+           << " | failed: "     << setw(6)  << entry.nfailed
+           << " | trials: "     << setw(12) << entry.ntrials
+           << " | efficiency: " << setw(8)  << eff << "%"
+           << " | violations: " << setw(8)  << entry.nviolations
+           << " (" << setw(8) << fvio << "%) |"
+           << setprecision(6) << endl;
+  }
+}
+//____________________________________________________________________________
+TTree * KineSamplingStats::MakeTree(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gKineSamplingStatsLock);
+
+  char     generator   [256];
+  char     interaction [256];
+  double   emin, emax;
+  Long64_t nselected, nfailed, ntrials, nviolations;
+
+  TTree * tree = new TTree("gkinestats",
+                     "GENIE kinematics rejection sampling statistics");
+  tree->Branch("generator",   generator,    "generator/C");
+  tree->Branch("interaction", interaction,  "interaction/C");
+  tree->Branch("emin",        &emin,        "emin/D");
+  tree->Branch("emax",        &emax,        "emax/D");
+  tree->Branch("nselected",   &nselected,   "nselected/L");
+  tree->Branch("nfailed",     &nfailed,     "nfailed/L");
+  tree->Branch("ntrials",     &ntrials,     "ntrials/L");
+  tree->Branch("nviolations", &nviolations, "nviolations/L");
+
+  map<Key_t, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) {
+    const Entry & entry = it->second;
+    int ie = it->first.second;
+    strncpy(generator,   it->first.first.first.c_str(),  sizeof(generator)-1);
+    strncpy(interaction, it->first.first.second.c_str(), sizeof(interaction)-1);
+    generator  [sizeof(generator)-1]   = 0;
+    interaction[sizeof(interaction)-1] = 0;
+    emin        = std::pow(10., double(ie)   / kNBinsPerDecade);
+    emax        = std::pow(10., double(ie+1) / kNBinsPerDecade);
+    nselected   = entry.nselected;
+    nfailed     = entry.nfailed;
+    ntrials     = entry.ntrials;
+    nviolations = entry.nviolations;
+    tree->Fill();
+  }
+
+  LOG("KineStats", pNOTICE)
+    << "Stored kinematics sampling statistics for " << fEntries.size()
+    << " (generator, interaction, energy bin) keys in tree " << tree->GetName();
+
+  return tree;
+}
+//____________________________________________________________________________
@@ -0,0 +1,113 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::KineSamplingStats
+
+\brief    Singleton collecting the rejection sampling statistics of the
+          kinematics generators, keyed by the generator algorithm id, the
+          interaction and the probe energy bin (kNBinsPerDecade bins per
+          decade of log10(E/GeV)).
+          For each key it keeps the number of selected and failed (too many
+          iterations) kinematics, the number of trials and the number of
+          trials where the differential xsec exceeded the max xsec (or the
+          tabulated envelope) used for the rejection.
+          Collection is off by default. It is switched on either by calling
+          SetEnabled(true) or by setting the GEVGKINESTATS env. var.
+          When enabled, NtpWriter::Save() prints a summary table and adds a
+          'gkinestats' TTree to the output event file.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _KINE_SAMPLING_STATS_H_
+#define _KINE_SAMPLING_STATS_H_
+
+#include <map>
+#include <string>
+#include <ostream>
+#include <utility>
+
+using std::map;
+using std::string;
+using std::ostream;
+using std::pair;
+
+class TTree;
+
+namespace genie {
+
+class KineSamplingStats;
+
+ostream & operator << (ostream & stream, const KineSamplingStats & stats);
+
+class KineSamplingStats
+{
+public:
+  static KineSamplingStats * Instance(void);
+
+  //! cheap check, to be done before building the keys
+  static bool IsEnabled  (void) { return fEnabled; }
+  static void SetEnabled (bool on);
+
+  //! record the outcome of a kinematics selection for the input generator,
+  //! interaction and probe energy (GeV): the number of trials, the number of
+  //! max xsec violations and whether the kinematics were selected
+  void Add (const string & generator, const string & interaction, double E,
+            long int ntrials, long int nviolations, bool selected);
+
+  long int NTrials   (void) const;
+  long int NSelected (void) const;
+
+  void    Reset     (void);
+  void    Print     (ostream & stream) const;
+  TTree * MakeTree  (void) const;  ///< created in the current ROOT directory
+
+  friend ostream & operator << (ostream & stream, const KineSamplingStats & stats);
+
+  //! log10(E/GeV) binning
+  static const int kNBinsPerDecade = 4;
+
+private:
+  KineSamplingStats();
+  KineSamplingStats(const KineSamplingStats & stats);
+  virtual ~KineSamplingStats();
+
+  //! per (generator, interaction, energy bin) statistics
+  struct Entry {
+    long int nselected;   ///< selected kinematics
+    long int nfailed;     ///< kinematics selections giving up
+    long int ntrials;     ///< trials
+    long int nviolations; ///< trials with xsec > max xsec
+  };
+  typedef pair<string,string> Channel_t;
+  typedef pair<Channel_t,int> Key_t;
+
+  //! self
+  static KineSamplingStats * fInstance;
+  static bool                fEnabled;
+
+  map<Key_t, Entry> fEntries;
+
+  //! clean
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (KineSamplingStats::fInstance !=0) {
+            delete KineSamplingStats::fInstance;
+            KineSamplingStats::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _KINE_SAMPLING_STATS_H_
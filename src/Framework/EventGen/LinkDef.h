@@ -8,15 +8,22 @@
 
 #pragma link C++ class genie::EventRecord;
 #pragma link C++ class genie::EventRecordVisitorI;
+#pragma link C++ class genie::EventRecordPool;
 #pragma link C++ class genie::GVldContext;
 #pragma link C++ class genie::EventGenerator;
 #pragma link C++ class genie::EventGeneratorI;
 #pragma link C++ class genie::EventGeneratorList;
 #pragma link C++ class genie::EventGeneratorListAssembler;
 #pragma link C++ class genie::RunningThreadInfo;
+#pragma link C++ class genie::RejectedEventStats;
+#pragma link C++ class genie::ModuleTimingStats;
+#pragma link C++ class genie::KineSamplingStats;
+#pragma link C++ class genie::ChannelBias;
+#pragma link C++ class genie::ResolvedAlgs;
 #pragma link C++ class genie::InteractionSelectorI;
 #pragma link C++ class genie::ToyInteractionSelector;
 #pragma link C++ class genie::PhysInteractionSelector;
+#pragma link C++ class genie::EventFilterI;
 #pragma link C++ class genie::InteractionList;
 #pragma link C++ class genie::InteractionListAssembler;
 #pragma link C++ class genie::InteractionListGeneratorI;
@@ -28,6 +35,9 @@
 #pragma link C++ class genie::GEVGPool;
 #pragma link C++ class genie::PathLengthList;
 #pragma link C++ class genie::GFluxI;
+#pragma link C++ class genie::GMCJWorkerFactoryI;
+#pragma link C++ class genie::GMCJEventSinkI;
+#pragma link C++ class genie::ThreadedEventLoopI;
 #pragma link C++ class genie::GeomAnalyzerI;
 #pragma link C++ class genie::GMCJMonitor;
 
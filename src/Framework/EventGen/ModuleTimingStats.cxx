@@ -0,0 +1,239 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <iomanip>
+#include <mutex>
+
+#include <TTree.h>
+#include <TString.h>
+
+#include "Framework/EventGen/ModuleTimingStats.h"
+#include "Framework/Messenger/Messenger.h"
+
+using std::endl;
+using std::setw;
+using std::setfill;
+using std::setprecision;
+
+using namespace genie;
+
+//____________________________________________________________________________
+ModuleTimingStats * ModuleTimingStats::fInstance = 0;
+bool                ModuleTimingStats::fEnabled  =
+                                 (std::getenv("GEVGMODTIMING") != 0);
+
+const double ModuleTimingStats::kLog10T0 = -7.; // 100 ns
+const double ModuleTimingStats::kLog10T1 =  1.; // 10 s
+
+// serializes access from multiple event generation threads
+static std::recursive_mutex gModuleTimingStatsLock;
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const ModuleTimingStats & stats)
+  {
+    stats.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+ModuleTimingStats::ModuleTimingStats()
+{
+
+}
+//____________________________________________________________________________
+ModuleTimingStats::~ModuleTimingStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+ModuleTimingStats * ModuleTimingStats::Instance()
+{
+  std::lock_guard<std::recursive_mutex> guard(gModuleTimingStatsLock);
+
+  if(fInstance == 0) {
+    static ModuleTimingStats::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new ModuleTimingStats;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void ModuleTimingStats::SetEnabled(bool on)
+{
+  fEnabled = on;
+}
+//____________________________________________________________________________
+void ModuleTimingStats::Add(
+          const string & module, const string & process, double time)
+{
+  // log10(time) bin; 0 is the underflow and kNBins+1 the overflow bin
+  int ibin = 0;
+  if(time > 0) {
+    double u = (std::log10(time) - kLog10T0) / (kLog10T1 - kLog10T0);
+    if      (u <  0.) ibin = 0;
+    else if (u >= 1.) ibin = kNBins + 1;
+    else              ibin = 1 + int(u * kNBins);
+  }
+
+  std::lock_guard<std::recursive_mutex> guard(gModuleTimingStatsLock);
+
+  Key_t key(module, process);
+  map<Key_t, Entry>::iterator it = fEntries.find(key);
+  if(it == fEntries.end()) {
+    Entry entry;
+    entry.ncalls = 0;
+    entry.total  = 0;
+    entry.min    = time;
+    entry.max    = time;
+    entry.hist.assign(kNBins + 2, 0);
+    it = fEntries.insert(std::make_pair(key, entry)).first;
+  }
+  Entry & entry = it->second;
+  entry.ncalls++;
+  entry.total += time;
+  if(time < entry.min) entry.min = time;
+  if(time > entry.max) entry.max = time;
+  entry.hist[ibin]++;
+}
+//____________________________________________________________________________
+long int ModuleTimingStats::NCalls(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gModuleTimingStatsLock);
+  long int n = 0;
+  map<Key_t, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) n += it->second.ncalls;
+  return n;
+}
+//____________________________________________________________________________
+double ModuleTimingStats::TotalTime(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gModuleTimingStatsLock);
+  double t = 0;
+  map<Key_t, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) t += it->second.total;
+  return t;
+}
+//____________________________________________________________________________
+map<string, double> ModuleTimingStats::TotalTimePerModule(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gModuleTimingStatsLock);
+  map<string, double> times;
+  map<Key_t, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) times[it->first.first] += it->second.total;
+  return times;
+}
+//____________________________________________________________________________
+void ModuleTimingStats::Reset(void)
+{
+  std::lock_guard<std::recursive_mutex> guard(gModuleTimingStatsLock);
+  fEntries.clear();
+}
+//____________________________________________________________________________
+double ModuleTimingStats::Quantile(const Entry & entry, double q) const
+{
+  // Approximate quantile, taken at the upper edge of the histogram bin
+  // where the cumulative count crosses q (clamped to the observed range)
+  if(entry.ncalls <= 0) return 0;
+
+  double   dlog   = (kLog10T1 - kLog10T0) / kNBins;
+  double   target = q * entry.ncalls;
+  long int cumul  = 0;
+  for(int ibin = 0; ibin < kNBins + 2; ibin++) {
+    cumul += entry.hist[ibin];
+    if(cumul >= target) {
+      if(ibin == 0)          return entry.min;
+      if(ibin == kNBins + 1) return entry.max;
+      double t = std::pow(10., kLog10T0 + ibin * dlog);
+      if(t < entry.min) t = entry.min;
+      if(t > entry.max) t = entry.max;
+      return t;
+    }
+  }
+  return entry.max;
+}
+//____________________________________________________________________________
+void ModuleTimingStats::Print(ostream & stream) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gModuleTimingStatsLock);
+
+  double ttot = this->TotalTime();
+
+  stream << "Event generation module timing: " << this->NCalls()
+         << " module calls, " << ttot << " s" << endl;
+
+  map<Key_t, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) {
+    const Entry & entry = it->second;
+    double mean = (entry.ncalls > 0) ? entry.total / entry.ncalls : 0.;
+    double frac = (ttot > 0) ? 100. * entry.total / ttot : 0.;
+    stream << " | " << setfill(' ') << setw(50) << it->first.first
+           << " | " << setw(40) << it->first.second
+           << " | calls: "  << setw(10) << entry.ncalls
+           << " | total: "  << setw(12) << entry.total << " s"
+           << " (" << setw(5) << setprecision(3) << frac << "%)"
+           << setprecision(6)
+           << " | mean: "   << setw(12) << mean << " s"
+           << " | median: " << setw(12) << this->Quantile(entry, 0.5)  << " s"
+           << " | 90%: "    << setw(12) << this->Quantile(entry, 0.9)  << " s"
+           << " | max: "    << setw(12) << entry.max << " s |" << endl;
+  }
+}
+//____________________________________________________________________________
+TTree * ModuleTimingStats::MakeTree(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gModuleTimingStatsLock);
+
+  char     module  [256];
+  char     process [256];
+  Long64_t ncalls;
+  double   total, tmin, tmax, median, q90;
+  Long64_t hist[kNBins+2];
+
+  TTree * tree = new TTree("gmodtiming", "GENIE event generation module timing");
+  tree->Branch("module",  module,  "module/C");
+  tree->Branch("process", process, "process/C");
+  tree->Branch("ncalls",  &ncalls, "ncalls/L");
+  tree->Branch("total",   &total,  "total/D");
+  tree->Branch("min",     &tmin,   "min/D");
+  tree->Branch("max",     &tmax,   "max/D");
+  tree->Branch("median",  &median, "median/D");
+  tree->Branch("q90",     &q90,    "q90/D");
+  tree->Branch("hist",    hist,    Form("hist[%d]/L", kNBins+2));
+
+  map<Key_t, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) {
+    const Entry & entry = it->second;
+    strncpy(module,  it->first.first.c_str(),  sizeof(module)-1);
+    strncpy(process, it->first.second.c_str(), sizeof(process)-1);
+    module [sizeof(module)-1]  = 0;
+    process[sizeof(process)-1] = 0;
+    ncalls = entry.ncalls;
+    total  = entry.total;
+    tmin   = entry.min;
+    tmax   = entry.max;
+    median = this->Quantile(entry, 0.5);
+    q90    = this->Quantile(entry, 0.9);
+    for(int ibin = 0; ibin < kNBins + 2; ibin++) hist[ibin] = entry.hist[ibin];
+    tree->Fill();
+  }
+
+  LOG("ModTiming", pNOTICE)
+    << "Stored timing info for " << fEntries.size()
+    << " (module, process) pairs in tree " << tree->GetName();
+
+  return tree;
+}
+//____________________________________________________________________________
@@ -0,0 +1,116 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ModuleTimingStats
+
+\brief    Singleton collecting the wall-clock time spent in each event record
+          visitor (event generation module), keyed by the module algorithm id
+          and by the process type of the event being generated.
+          For each (module, process) pair it keeps the number of calls, the
+          total / min / max time and a histogram of log10(time/sec).
+          Collection is off by default. It is switched on either by calling
+          SetEnabled(true) or by setting the GEVGMODTIMING env. var.
+          When enabled, NtpWriter::Save() prints a summary table and adds a
+          'gmodtiming' TTree to the output event file.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _MODULE_TIMING_STATS_H_
+#define _MODULE_TIMING_STATS_H_
+
+#include <map>
+#include <vector>
+#include <string>
+#include <ostream>
+#include <utility>
+
+using std::map;
+using std::vector;
+using std::string;
+using std::ostream;
+using std::pair;
+
+class TTree;
+
+namespace genie {
+
+class ModuleTimingStats;
+
+ostream & operator << (ostream & stream, const ModuleTimingStats & stats);
+
+class ModuleTimingStats
+{
+public:
+  static ModuleTimingStats * Instance(void);
+
+  //! cheap check, to be done before sampling the clock
+  static bool IsEnabled  (void) { return fEnabled; }
+  static void SetEnabled (bool on);
+
+  //! record the time (in sec) spent by a module on an event of given process
+  void Add (const string & module, const string & process, double time);
+
+  long int NCalls    (void) const;
+  double   TotalTime (void) const;
+
+  //! total time (in sec) spent in each module, summed over the processes
+  map<string, double> TotalTimePerModule (void) const;
+
+  void    Reset     (void);
+  void    Print     (ostream & stream) const;
+  TTree * MakeTree  (void) const;  ///< created in the current ROOT directory
+
+  friend ostream & operator << (ostream & stream, const ModuleTimingStats & stats);
+
+  //! log10(time/sec) histogram binning
+  static const int    kNBins   = 40;
+  static const double kLog10T0;
+  static const double kLog10T1;
+
+private:
+  ModuleTimingStats();
+  ModuleTimingStats(const ModuleTimingStats & stats);
+  virtual ~ModuleTimingStats();
+
+  //! per (module, process) statistics
+  struct Entry {
+    long int         ncalls;
+    double           total;
+    double           min;
+    double           max;
+    vector<long int> hist;   ///< log10(time) histogram, kNBins+2 bins (incl. under/overflow)
+  };
+  typedef pair<string,string> Key_t;
+
+  double Quantile (const Entry & entry, double q) const;
+
+  //! self
+  static ModuleTimingStats * fInstance;
+  static bool                fEnabled;
+
+  map<Key_t, Entry> fEntries;
+
+  //! clean
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (ModuleTimingStats::fInstance !=0) {
+            delete ModuleTimingStats::fInstance;
+            ModuleTimingStats::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _MODULE_TIMING_STATS_H_
@@ -12,6 +12,10 @@
  Important revisions after version 2.0.0 :
  @ Aug 25, 2009 - CA
    Adapt code to use the new utils::xml namespace.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the flat accessors SetPathLengths(), PathLengths() and HasCodes().
+   Single look-up setters & getters. Copying a list onto a list with the
+   same materials overwrites the values in place.
 
 */
 //____________________________________________________________________________
@@ -94,7 +98,8 @@ void PathLengthList::AddPathLength(int pdgc, double pl)
 {
 // Adds pl to the total path length for material with code = pdgc
 
-  if (this->count(pdgc) == 1) { (*this)[pdgc] += pl; }
+  map<int, double>::iterator pl_iter = this->find(pdgc);
+  if (pl_iter != this->end()) { pl_iter->second += pl; }
   else {
      LOG("PathL", pWARN)
          << "No material with PDG code = " << pdgc << " in path length list";
@@ -105,7 +110,8 @@ void PathLengthList::SetPathLength(int pdgc, double pl)
 {
 // Sets the total path length for material with code = pdgc to be pl
 
-  if (this->count(pdgc) == 1) { (*this)[pdgc] = pl; }
+  map<int, double>::iterator pl_iter = this->find(pdgc);
+  if (pl_iter != this->end()) { pl_iter->second = pl; }
   else {
      LOG("PathL", pWARN)
          << "No material with PDG code = " << pdgc << " in path length list";
@@ -116,10 +122,9 @@ void PathLengthList::ScalePathLength(int pdgc, double scale)
 {
 // Scales pl for material with code = pdgc with the input scale factor
 
-  if (this->count(pdgc) == 1) {
-     double pl = (*this)[pdgc];
-     pl *= scale;
-     (*this)[pdgc] = pl;
+  map<int, double>::iterator pl_iter = this->find(pdgc);
+  if (pl_iter != this->end()) {
+     pl_iter->second *= scale;
   } else {
      LOG("PathL", pWARN)
          << "No material with PDG code = " << pdgc << " in path length list";
@@ -130,8 +135,8 @@ double PathLengthList::PathLength(int pdgc) const
 {
 // Gets the total path length for material with code = pdgc to be pl
 
-  if ( this->count(pdgc) == 1 ) {
-     map<int, double>::const_iterator pl_iter = this->find(pdgc);
+  map<int, double>::const_iterator pl_iter = this->find(pdgc);
+  if ( pl_iter != this->end() ) {
      return pl_iter->second;
   } else {
      LOG("PathL", pWARN)
@@ -140,13 +145,56 @@ double PathLengthList::PathLength(int pdgc) const
   return 0;
 }
 //___________________________________________________________________________
-void PathLengthList::SetAllToZero(void)
+void PathLengthList::SetPathLengths(const vector<double> & pl)
+{
+// Sets the path lengths of all materials, given in order of increasing PDG
+// code (the i-th entry is the path length of the i-th material)
+
+  if (pl.size() != this->size()) {
+     LOG("PathL", pWARN)
+         << "Got " << pl.size() << " path lengths for "
+         << this->size() << " materials - Ignoring them";
+     return;
+  }
+  unsigned int imat = 0;
+  PathLengthList::iterator pl_iter;
+  for(pl_iter = this->begin(); pl_iter != this->end(); ++pl_iter) {
+    pl_iter->second = pl[imat++];
+  }
+}
+//___________________________________________________________________________
+void PathLengthList::PathLengths(vector<double> & pl) const
 {
+// Gets the path lengths of all materials, in order of increasing PDG code
+
+  pl.resize(this->size());
+  unsigned int imat = 0;
   PathLengthList::const_iterator pl_iter;
+  for(pl_iter = this->begin(); pl_iter != this->end(); ++pl_iter) {
+    pl[imat++] = pl_iter->second;
+  }
+}
+//___________________________________________________________________________
+bool PathLengthList::HasCodes(const vector<int> & pdgcodes) const
+{
+// Checks whether the list holds exactly the input PDG codes (in increasing
+// order), ie whether the flat accessors use the same material index
 
+  if (pdgcodes.size() != this->size()) return false;
+  unsigned int imat = 0;
+  PathLengthList::const_iterator pl_iter;
   for(pl_iter = this->begin(); pl_iter != this->end(); ++pl_iter) {
-    int pdgc = pl_iter->first;
-    (*this)[pdgc] = 0.;
+    if (pl_iter->first != pdgcodes[imat++]) return false;
+  }
+  return true;
+}
+//___________________________________________________________________________
+void PathLengthList::SetAllToZero(void)
+{
+  PathLengthList::iterator pl_iter;
+
+  for(pl_iter = this->begin(); pl_iter != this->end(); ++pl_iter) {
+    pl_iter->second = 0.;
   }
 }
 //___________________________________________________________________________
@@ -165,6 +213,24 @@ bool PathLengthList::AreAllZero(void) const
 //___________________________________________________________________________
 void PathLengthList::Copy(const PathLengthList & plist)
 {
+  if (this == &plist) return;
+
+  // same materials (eg the lists of successive flux neutrinos): overwrite
+  // the path lengths in place
+  if (this->size() == plist.size()) {
+    PathLengthList::iterator       it  = this->begin();
+    PathLengthList::const_iterator pit = plist.begin();
+    for( ; it != this->end(); ++it, ++pit) {
+      if (it->first != pit->first) break;
+    }
+    if (it == this->end()) {
+      for(it = this->begin(), pit = plist.begin(); it != this->end(); ++it, ++pit) {
+        it->second = pit->second;
+      }
+      return;
+    }
+  }
+
   this->clear();
   PathLengthList::const_iterator pl_iter;
   for(pl_iter = plist.begin(); pl_iter != plist.end(); ++pl_iter) {
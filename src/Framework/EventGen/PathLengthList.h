@@ -7,6 +7,11 @@
          geometry materials, when starting from a position x and travelling
          along the direction of the neutrino 4-momentum.
 
+         The path lengths are kept in order of increasing PDG code: that
+         order defines a fixed (dense) material index, which is used by the
+         flat accessors SetPathLengths() / PathLengths() to exchange all the
+         path lengths with a contiguous array at once.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -22,6 +27,7 @@
 #define _PATH_LENGTH_LIST_H_
 
 #include <map>
+#include <vector>
 #include <ostream>
 #include <string>
 
@@ -30,6 +36,7 @@
 class TLorentzVector;
 
 using std::map;
+using std::vector;
 using std::ostream;
 using std::string;
 
@@ -56,6 +63,12 @@ public :
   void   ScalePathLength (int pdgc, double scale);
   double PathLength      (int pdgc) const;
 
+  //! flat access: the path lengths of all materials, in PDG code order
+  void   SetPathLengths  (const vector<double> & pl);
+  void   PathLengths     (vector<double> & pl) const;
+  //! true if the list holds exactly the (sorted) input codes
+  bool   HasCodes        (const vector<int> & pdgcodes) const;
+
   XmlParserStatus_t LoadFromXml (string filename);
   void              SaveAsXml   (string filename) const;
 
@@ -17,6 +17,12 @@
    itself doesn't and its hard to diagnose problems from its actuall err mesg.
  @ Jun 23, 2008 - CA
    Protect against round off err / negative xsec
+ @ Oct 14, 2026 - The GENIE Collaboration
+   SelectInteractionInRecord() re-uses the summary of the previous event.
+   The cross section loop refills a single scratch interaction rather than
+   copy-constructing one per candidate.
+   The channels can be oversampled, with compensating event weights (see
+   ChannelBias).
 */
 //____________________________________________________________________________
 
@@ -24,12 +30,14 @@
 #include <sstream>
 #include <cstdlib>
 #include <iomanip>
+#include <algorithm>
 
 #include <TMath.h>
 #include <TLorentzVector.h>
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/ChannelBias.h"
 #include "Framework/EventGen/PhysInteractionSelector.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/EventGeneratorI.h"
@@ -38,6 +46,7 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
+#include "Framework/Numerical/SplineBank.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/PrintUtils.h"
 
@@ -47,25 +56,30 @@ using std::setw;
 using std::setprecision;
 using std::setfill;
 using std::ostringstream;
+using std::upper_bound;
 using namespace genie;
 //using namespace genie::units;
 
 //___________________________________________________________________________
 PhysInteractionSelector::PhysInteractionSelector() :
-InteractionSelectorI("genie::PhysInteractionSelector")
+InteractionSelectorI("genie::PhysInteractionSelector"),
+fChnMap(0),
+fChnValid(false)
 {
 
 }
 //___________________________________________________________________________
 PhysInteractionSelector::PhysInteractionSelector(string config) :
-InteractionSelectorI("genie::PhysInteractionSelector", config)
+InteractionSelectorI("genie::PhysInteractionSelector", config),
+fChnMap(0),
+fChnValid(false)
 {
 
 }
 //___________________________________________________________________________
 PhysInteractionSelector::~PhysInteractionSelector()
 {
-
+  this->ClearChannels();
 }
 //___________________________________________________________________________
 EventRecord * PhysInteractionSelector::SelectInteraction
@@ -82,6 +96,22 @@ EventRecord * PhysInteractionSelector::SelectInteraction
      return 0;
   }
 
+  // Fast path: use the compiled channel table
+  if (this->UseCompiledChannels(igmap)) {
+     double xsec   = 0;
+     double weight = 1;
+     Interaction * selected_interaction = 
+                           this->SelectCompiledInteraction(p4, xsec, weight);
+     if(!selected_interaction) return 0;
+
+     // bootstrap the event record
+     EventRecord * evrec = new EventRecord;
+     evrec->AttachSummary(selected_interaction);
+     evrec->SetXSec(xsec);
+     evrec->SetWeight(weight * evrec->Weight());
+     return evrec;
+  }
+
   // Get the list of spline objects
   // Should have been constructed at the job initialization
   XSecSplineList * xssl = 0;
@@ -89,6 +119,14 @@ EventRecord * PhysInteractionSelector::SelectInteraction
 
   const InteractionList & ilst = igmap->GetInteractionList();
   vector<double> xseclist(ilst.size());
+  vector<double> biaslist(ilst.size(), 1.);
+
+  ChannelBias * bias = ChannelBias::Instance();
+  if(bias->Enabled()) {
+    for(unsigned int iint = 0; iint < ilst.size(); iint++) {
+      biaslist[iint] = bias->Factor(ilst[iint]);
+    }
+  }
 
   string istate = ilst[0]->InitState().AsString();
   ostringstream msg;
@@ -103,17 +141,23 @@ EventRecord * PhysInteractionSelector::SelectInteraction
   unsigned int i=0;
   InteractionList::const_iterator intliter = ilst.begin(); 
 
+  // only build the xsec table if it is going to be printed
+  bool print_table = 
+     (*Messenger::Instance())("IntSel").isPriorityEnabled(pNOTICE);
+
   ostringstream xsec_table_printout;
 
-  xsec_table_printout 
+  if (print_table) xsec_table_printout 
       << " |"  << setfill('-') << setw(112) << "|" << endl     
       << " | " << setfill(' ') << setw(80) << "interaction"
       << " | cross-section (1E-38*cm^2) |" << endl
       << " |"  << setfill('-') << setw(112) << "|" << endl;
 
+  Interaction * interaction = new Interaction;
+
   for( ; intliter != ilst.end(); ++intliter) {
 
-     Interaction * interaction = new Interaction(**intliter);
+     interaction->Copy(**intliter);
      interaction->InitStatePtr()->SetProbeP4(p4);
 
      SLOG("IntSel", pDEBUG)
@@ -126,8 +170,9 @@ EventRecord * PhysInteractionSelector::SelectInteraction
 
      double xsec = 0; // cross section for this interaction
 
-     bool spline_computed = xssl->SplineExists(xsec_alg, interaction);
-     bool eval = fUseSplines && spline_computed;
+     int spl_handle =
+         (fUseSplines) ? xssl->GetSplineHandle(xsec_alg, interaction) : -1;
+     bool eval = (spl_handle >= 0);
      if (eval) {
            const InitialState & init = interaction->InitState();
            const ProcessInfo & proc  = interaction->ProcInfo();
@@ -141,42 +186,48 @@ EventRecord * PhysInteractionSelector::SelectInteraction
     		 BLOG("IntSel", pFATAL) << "E = " << E;
 		 abort();
 	   }
-           const Spline * spl = xssl->GetSpline(xsec_alg,interaction);
+           const Spline * spl = xssl->GetSpline(spl_handle);
            if(spl->ClosestKnotValueIsZero(E,"-")) xsec = 0;
            else xsec = spl->Evaluate(E);
      } else {
            xsec = xsec_alg->Integral(interaction);
      }
-     TMath::Max(0., xsec);
+     xsec = TMath::Max(0., xsec);
 /*
      LOG("IntSel", pNOTICE)
        << interaction->AsString() 
        << " --> xsec " << (eval ? "[**interp**]" : "[**calc**]") 
        << " = " << xsec/genie::units::cm2 << " cm^2";
 */
-     xsec_table_printout 
+     if (print_table) xsec_table_printout 
            << " | " << setfill(' ') << setw(80) << interaction->AsString()
            << " | " << setfill(' ') << setw(26) << xsec/(1E-38*genie::units::cm2)
            << " | " << endl;
 
      xseclist[i++] = xsec;
-     delete interaction;
 
   } // loop over interaction that can be generated
 
-  xsec_table_printout
-      << " |"  << setfill('-') << setw(112) << "|" << endl;
+  delete interaction;
 
-  LOG("IntSel", pNOTICE)
-    << "\n" << xsec_table_printout.str();
+  if (print_table) {
+    xsec_table_printout
+        << " |"  << setfill('-') << setw(112) << "|" << endl;
+
+    LOG("IntSel", pNOTICE)
+      << "\n" << xsec_table_printout.str();
+  }
 
   // select an interaction
 
   LOG("IntSel", pINFO)
             << "Selecting an entry from the Interaction List";
+  // (with the channels oversampled by their ChannelBias factors)
   double xsec_sum  = 0;
+  double xsec_tot  = 0;
   for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
-     xsec_sum       += xseclist[iint];
+     xsec_tot       += xseclist[iint];
+     xsec_sum       += biaslist[iint] * xseclist[iint];
      xseclist[iint]  = xsec_sum;
 
      SLOG("IntSel", pINFO)
@@ -200,16 +251,17 @@ EventRecord * PhysInteractionSelector::SelectInteraction
        // set the cross section for the selected interaction (just extract it
        // from the array of summed xsecs rather than recomputing it)
        double xsec_pedestal = (iint > 0) ? xseclist[iint-1] : 0.;
-       double xsec = xseclist[iint] - xsec_pedestal;
+       double xsec = (xseclist[iint] - xsec_pedestal) / biaslist[iint];
        assert(xsec>0);
 
        LOG("IntSel", pNOTICE)
          << "Selected interaction: " << selected_interaction->AsString();
 
-       // bootstrap the event record
+       // bootstrap the event record, weighted for the biased selection
        EventRecord * evrec = new EventRecord;
        evrec->AttachSummary(selected_interaction);
        evrec->SetXSec(xsec);
+       evrec->SetWeight(xsec_sum / (xsec_tot * biaslist[iint]));
 
        return evrec;
      }
@@ -218,6 +270,238 @@ EventRecord * PhysInteractionSelector::SelectInteraction
   return 0;
 }
 //___________________________________________________________________________
+bool PhysInteractionSelector::CompileChannels(
+                                 const InteractionGeneratorMap * igmap) const
+{
+// Compiles the flat channel table for the input InteractionGeneratorMap.
+// For each channel it resolves the cross section spline and the velocity of
+// the frame in which the spline is to be evaluated (Lab frame for coherent
+// and electron scattering, hit nucleon rest frame otherwise). Splines with a
+// common knot grid and frame are put in the same SplineBank, so that the
+// per-event work reduces to one energy transform, one knot search and one
+// vectorized loop per bank.
+// Returns false (so that the generic code path is used) if a spline is missing.
+
+  this->ClearChannels();
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+
+  const InteractionList & ilst = igmap->GetInteractionList();
+  unsigned int nch = ilst.size();
+
+  vector<int> bank_of_channel(nch);
+  vector<int> pos_in_bank(nch);
+
+  ChannelBias * bias = ChannelBias::Instance();
+
+  for(unsigned int ich = 0; ich < nch; ich++) {
+     const Interaction * interaction = ilst[ich];
+
+     const EventGeneratorI * evg = igmap->FindGenerator(interaction);
+     const XSecAlgorithmI * xsec_alg = (evg) ? evg->CrossSectionAlg() : 0;
+     int spl_handle = (xsec_alg) ? xssl->GetSplineHandle(xsec_alg, interaction) : -1;
+     if(spl_handle < 0) {
+        LOG("IntSel", pWARN)
+          << "No cross section spline for " << interaction->AsString()
+          << " - Cross sections will be computed on the fly";
+        this->ClearChannels();
+        return false;
+     }
+     const Spline * spl = xssl->GetSpline(spl_handle);
+
+     double boost[4] = { 0., 0., 0., 1. };
+     const ProcessInfo & proc = interaction->ProcInfo();
+     bool lab = proc.IsCoherent() || proc.IsElectronScattering();
+     if(!lab) {
+        // same boost as InitialState::ProbeE(kRfHitNucRest)
+        const TLorentzVector * pnuc4 = 
+                       interaction->InitState().Tgt().HitNucP4Ptr();
+        assert(pnuc4);
+        boost[0] = pnuc4->Px() / pnuc4->Energy();
+        boost[1] = pnuc4->Py() / pnuc4->Energy();
+        boost[2] = pnuc4->Pz() / pnuc4->Energy();
+        boost[3] = 1. / TMath::Sqrt(1. - (boost[0]*boost[0] + 
+                        boost[1]*boost[1] + boost[2]*boost[2]));
+     }
+
+     // find a bank with the same frame and knot grid, or open a new one
+     int ibank = -1;
+     for(unsigned int ib = 0; ib < fChnBanks.size(); ib++) {
+        const double * bb = &fChnBankBoost[4*ib];
+        bool same_frame = (bb[0] == boost[0] && bb[1] == boost[1] && 
+                           bb[2] == boost[2] && bb[3] == boost[3]);
+        if(same_frame && fChnBanks[ib]->SharesKnots(spl)) {
+           ibank = ib;
+           break;
+        }
+     }
+     if(ibank < 0) {
+        SplineBank * bank = new SplineBank;
+        bank->SetZeroAfterZeroKnot(true);
+        fChnBanks.push_back(bank);
+        for(int i = 0; i < 4; i++) fChnBankBoost.push_back(boost[i]);
+        ibank = fChnBanks.size() - 1;
+     }
+     pos_in_bank[ich] = fChnBanks[ibank]->NSplines();
+     bool added = fChnBanks[ibank]->Add(spl);
+     if(!added) {
+        LOG("IntSel", pWARN)
+          << "Can not bank the cross section spline for " 
+          << interaction->AsString()
+          << " - Cross sections will be computed on the fly";
+        this->ClearChannels();
+        return false;
+     }
+     bank_of_channel[ich] = ibank;
+     fChnInteractions.push_back(interaction);
+     fChnBias.push_back(bias->Enabled() ? bias->Factor(interaction) : 1.);
+  }
+
+  // map each channel to its slot in the output buffer (banks back-to-back)
+  vector<int> bank_offset(fChnBanks.size(), 0);
+  int offset = 0;
+  for(unsigned int ib = 0; ib < fChnBanks.size(); ib++) {
+     bank_offset[ib] = offset;
+     offset += fChnBanks[ib]->NSplines();
+  }
+  fChnSlot.resize(nch);
+  for(unsigned int ich = 0; ich < nch; ich++) {
+     fChnSlot[ich] = bank_offset[bank_of_channel[ich]] + pos_in_bank[ich];
+  }
+  fChnXSec.resize(nch);
+  fChnXSecSum.resize(nch);
+
+  LOG("IntSel", pINFO)
+    << "Compiled a table of " << nch << " channels (" << fChnBanks.size()
+    << " spline banks) for initial state: "
+    << ilst[0]->InitState().AsString();
+
+  return true;
+}
+//___________________________________________________________________________
+void PhysInteractionSelector::ClearChannels(void) const
+{
+  for(unsigned int ib = 0; ib < fChnBanks.size(); ib++) {
+     delete fChnBanks[ib];
+  }
+  fChnBanks.clear();
+  fChnBankBoost.clear();
+  fChnInteractions.clear();
+  fChnBias.clear();
+  fChnSlot.clear();
+  fChnXSec.clear();
+  fChnXSecSum.clear();
+}
+//___________________________________________________________________________
+bool PhysInteractionSelector::SelectInteractionInRecord(
+     const InteractionGeneratorMap * igmap, const TLorentzVector & p4,
+     EventRecord * evrec) const
+{
+  if (igmap && igmap->size() > 0 && this->UseCompiledChannels(igmap)) {
+     // re-use the summary of the previous event in the record, if any
+     Interaction * recycled = evrec->ReleaseSpareSummary();
+     double xsec   = 0;
+     double weight = 1;
+     Interaction * selected_interaction = 
+                  this->SelectCompiledInteraction(p4, xsec, weight, recycled);
+     if(!selected_interaction) {
+        if(recycled) delete recycled;
+        return false;
+     }
+
+     evrec->AttachSummary(selected_interaction);
+     evrec->SetXSec(xsec);
+     evrec->SetWeight(weight * evrec->Weight());
+     return true;
+  }
+  return InteractionSelectorI::SelectInteractionInRecord(igmap, p4, evrec);
+}
+//___________________________________________________________________________
+bool PhysInteractionSelector::UseCompiledChannels(
+                                 const InteractionGeneratorMap * igmap) const
+{
+// Check whether the compiled channel table can be used for the input map
+// (compile it on first use)
+
+  if (!fUseSplines) return false;
+  if (igmap != fChnMap) {
+     fChnValid = this->CompileChannels(igmap);
+     fChnMap   = igmap;
+  }
+  return fChnValid;
+}
+//___________________________________________________________________________
+Interaction * PhysInteractionSelector::SelectCompiledInteraction(
+   const TLorentzVector & p4, double & xsec, double & weight,
+   Interaction * recycled) const
+{
+// Select an interaction from the compiled channel table. The selected one is
+// copied into the input (recycled) interaction, if any, or into a new one.
+// The channels are selected with probability ~ bias factor * xsec; the
+// output weight compensates for it (1 for unbiased tables).
+
+  double E  = p4.E();
+  double px = p4.Px();
+  double py = p4.Py();
+  double pz = p4.Pz();
+  if(TMath::IsNaN(E)) {
+     LOG("IntSel", pFATAL) << "E = " << E;
+     abort();
+  }
+
+  // evaluate all channel cross sections, bank by bank
+  double * xsec_buffer = &fChnXSec[0];
+  unsigned int nbanks = fChnBanks.size();
+  for(unsigned int ib = 0; ib < nbanks; ib++) {
+     const double * b = &fChnBankBoost[4*ib];
+     double Eb = b[3] * (E - b[0]*px - b[1]*py - b[2]*pz);
+     fChnBanks[ib]->Evaluate(Eb, xsec_buffer);
+     xsec_buffer += fChnBanks[ib]->NSplines();
+  }
+
+  // accumulate in interaction list order
+  unsigned int nch = fChnInteractions.size();
+  double xsec_sum = 0;
+  double xsec_tot = 0;
+  for(unsigned int ich = 0; ich < nch; ich++) {
+     double xs = TMath::Max(0., fChnXSec[fChnSlot[ich]]);
+     xsec_tot += xs;
+     xsec_sum += fChnBias[ich] * xs;
+     fChnXSecSum[ich] = xsec_sum;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  double R = xsec_sum * rnd->RndISel().Rndm();
+
+  LOG("IntSel", pINFO)
+      << "Generating Rndm (0. -> max = " << xsec_sum << ") = " << R;
+
+  vector<double>::const_iterator sel =
+        upper_bound(fChnXSecSum.begin(), fChnXSecSum.end(), R);
+  if(sel == fChnXSecSum.end()) {
+     LOG("IntSel", pERROR) << "Could not select interaction";
+     return 0;
+  }
+  unsigned int isel = sel - fChnXSecSum.begin();
+
+  Interaction * selected_interaction = recycled;
+  if(selected_interaction) selected_interaction->Copy(*fChnInteractions[isel]);
+  else selected_interaction = new Interaction(*fChnInteractions[isel]);
+  selected_interaction->InitStatePtr()->SetProbeP4(p4);
+
+  // set the cross section for the selected interaction (just extract it
+  // from the array of summed xsecs rather than recomputing it)
+  double xsec_pedestal = (isel > 0) ? fChnXSecSum[isel-1] : 0.;
+  xsec   = (fChnXSecSum[isel] - xsec_pedestal) / fChnBias[isel];
+  weight = xsec_sum / (xsec_tot * fChnBias[isel]);
+  assert(xsec>0);
+
+  LOG("IntSel", pNOTICE)
+     << "Selected interaction: " << selected_interaction->AsString();
+
+  return selected_interaction;
+}
+//___________________________________________________________________________
 void PhysInteractionSelector::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -237,5 +521,10 @@ void PhysInteractionSelector::LoadConfigData(void)
   fUseSplines = false ;
   GetParam( "UseStoredXSecs", fUseSplines ) ;
 
+  // force recompilation of the channel table
+  this->ClearChannels();
+  fChnMap   = 0;
+  fChnValid = false;
+
 }
 //___________________________________________________________________________
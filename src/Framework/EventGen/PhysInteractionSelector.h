@@ -7,6 +7,16 @@
 
          Is a concrete implementation of the InteractionSelectorI interface.
 
+         When stored cross sections are used, the selector compiles, on first
+         use, a flat per-channel table for the input InteractionGeneratorMap
+         so that selecting an interaction needs no look-ups and no per-channel
+         allocations. Channel splines sharing a knot grid and an energy frame
+         are grouped in SplineBank objects and evaluated together.
+
+         The channels given oversampling factors in ChannelBias are selected
+         with a probability proportional to factor * xsec, and the event
+         weight compensating for it is set in the bootstrapped record.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -21,10 +31,17 @@
 #ifndef _PHYS_INTERACTION_SELECTOR_H_
 #define _PHYS_INTERACTION_SELECTOR_H_
 
+#include <vector>
+
 #include "Framework/EventGen/InteractionSelectorI.h"
 
+using std::vector;
+
 namespace genie {
 
+class Interaction;
+class SplineBank;
+
 class PhysInteractionSelector : public InteractionSelectorI {
 
 public :
@@ -35,6 +52,9 @@ public :
   //! implement the InteractionSelectorI interface
   EventRecord * SelectInteraction
      (const InteractionGeneratorMap * igmp, const TLorentzVector & p4) const;
+  bool SelectInteractionInRecord
+     (const InteractionGeneratorMap * igmp, const TLorentzVector & p4,
+      EventRecord * evrec) const;
 
   //! override the Algorithm::Configure methods to load configuration
   //! data to private data members
@@ -44,7 +64,23 @@ public :
 private:
   void LoadConfigData (void);
 
+  bool          CompileChannels          (const InteractionGeneratorMap * igmap) const;
+  void          ClearChannels            (void) const;
+  bool          UseCompiledChannels      (const InteractionGeneratorMap * igmap) const;
+  Interaction * SelectCompiledInteraction(const TLorentzVector & p4, double & xsec, double & weight, Interaction * recycled = 0) const;
+
   bool fUseSplines;
+
+  // Compiled channel table (built lazily by SelectInteraction)
+  mutable const InteractionGeneratorMap * fChnMap;          ///< map the table was compiled for
+  mutable bool                            fChnValid;        ///< table usable? (false if a spline is missing)
+  mutable vector<const Interaction *>     fChnInteractions; ///< channels (owned by the InteractionGeneratorMap)
+  mutable vector<int>                     fChnSlot;         ///< channel -> position in the bank output buffer
+  mutable vector<double>                  fChnBias;         ///< channel oversampling factors (see ChannelBias)
+  mutable vector<SplineBank *>            fChnBanks;        ///< channel cross section splines, grouped in banks (owned)
+  mutable vector<double>                  fChnBankBoost;    ///< 4 per bank: beta_x,y,z & gamma of the spline energy frame
+  mutable vector<double>                  fChnXSec;         ///< work buffer: bank outputs, bank after bank
+  mutable vector<double>                  fChnXSecSum;      ///< work buffer: cumulative cross sections
 };
 
 }      // genie namespace
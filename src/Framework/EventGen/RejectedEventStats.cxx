@@ -0,0 +1,149 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <iomanip>
+#include <mutex>
+
+#include "Framework/EventGen/RejectedEventStats.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+
+using std::endl;
+using std::setw;
+using std::setfill;
+
+using namespace genie;
+
+//____________________________________________________________________________
+RejectedEventStats * RejectedEventStats::fInstance = 0;
+
+// serializes access from multiple event generation threads
+static std::recursive_mutex gRejectedEventStatsLock;
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const RejectedEventStats & stats)
+  {
+    stats.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+RejectedEventStats::RejectedEventStats()
+{
+
+}
+//____________________________________________________________________________
+RejectedEventStats::~RejectedEventStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+RejectedEventStats * RejectedEventStats::Instance()
+{
+  std::lock_guard<std::recursive_mutex> guard(gRejectedEventStatsLock);
+
+  if(fInstance == 0) {
+    static RejectedEventStats::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new RejectedEventStats;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void RejectedEventStats::AddRejected(
+                               const Interaction * interaction, double time)
+{
+  string code = (interaction) ? interaction->AsString() : "unknown";
+
+  std::lock_guard<std::recursive_mutex> guard(gRejectedEventStatsLock);
+  fNRejected[code]++;
+  fTimeRejected[code] += time;
+}
+//____________________________________________________________________________
+void RejectedEventStats::AddAbandoned(const Interaction * interaction)
+{
+  string code = (interaction) ? interaction->AsString() : "unknown";
+
+  std::lock_guard<std::recursive_mutex> guard(gRejectedEventStatsLock);
+  fNAbandoned[code]++;
+}
+//____________________________________________________________________________
+long int RejectedEventStats::NRejected(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gRejectedEventStatsLock);
+  long int n = 0;
+  map<string, long int>::const_iterator it = fNRejected.begin();
+  for( ; it != fNRejected.end(); ++it) n += it->second;
+  return n;
+}
+//____________________________________________________________________________
+double RejectedEventStats::TimeRejected(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gRejectedEventStatsLock);
+  double t = 0;
+  map<string, double>::const_iterator it = fTimeRejected.begin();
+  for( ; it != fTimeRejected.end(); ++it) t += it->second;
+  return t;
+}
+//____________________________________________________________________________
+long int RejectedEventStats::NAbandoned(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gRejectedEventStatsLock);
+  long int n = 0;
+  map<string, long int>::const_iterator it = fNAbandoned.begin();
+  for( ; it != fNAbandoned.end(); ++it) n += it->second;
+  return n;
+}
+//____________________________________________________________________________
+map<string, long int> RejectedEventStats::NRejectedPerChannel(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gRejectedEventStatsLock);
+  return fNRejected;
+}
+//____________________________________________________________________________
+map<string, double> RejectedEventStats::TimeRejectedPerChannel(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gRejectedEventStatsLock);
+  return fTimeRejected;
+}
+//____________________________________________________________________________
+void RejectedEventStats::Reset(void)
+{
+  std::lock_guard<std::recursive_mutex> guard(gRejectedEventStatsLock);
+  fNRejected.clear();
+  fTimeRejected.clear();
+  fNAbandoned.clear();
+}
+//____________________________________________________________________________
+void RejectedEventStats::Print(ostream & stream) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gRejectedEventStatsLock);
+
+  stream << "Rejected unphysical event tries: " << this->NRejected()
+         << " (" << this->TimeRejected() << " s), abandoned events: "
+         << this->NAbandoned() << endl;
+
+  map<string, long int>::const_iterator it = fNRejected.begin();
+  for( ; it != fNRejected.end(); ++it) {
+    string code = it->first;
+    map<string, double>::const_iterator   tit = fTimeRejected.find(code);
+    map<string, long int>::const_iterator ait = fNAbandoned.find(code);
+    stream << " | " << setfill(' ') << setw(80) << code
+           << " | rejected: " << setw(10) << it->second
+           << " | time: "     << setw(12) 
+           << ((tit != fTimeRejected.end()) ? tit->second : 0.) << " s"
+           << " | abandoned: " << setw(8)
+           << ((ait != fNAbandoned.end()) ? ait->second : 0) << " |" << endl;
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,89 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::RejectedEventStats
+
+\brief    Singleton keeping track, per interaction channel, of the number of
+          event generation tries rejected as unphysical by GEVGDriver and of
+          the time spent on them. Shared by all event generation threads.
+          The summary is included in the GMCJMonitor status file.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _REJECTED_EVENT_STATS_H_
+#define _REJECTED_EVENT_STATS_H_
+
+#include <map>
+#include <string>
+#include <ostream>
+
+using std::map;
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class Interaction;
+class RejectedEventStats;
+
+ostream & operator << (ostream & stream, const RejectedEventStats & stats);
+
+class RejectedEventStats
+{
+public:
+  static RejectedEventStats * Instance(void);
+
+  //! record a rejected try (time in sec) / an event abandoned after too many tries
+  void AddRejected  (const Interaction * interaction, double time);
+  void AddAbandoned (const Interaction * interaction);
+
+  long int NRejected    (void) const;
+  double   TimeRejected (void) const;
+  long int NAbandoned   (void) const;
+
+  //! the per channel (interaction code) statistics
+  map<string, long int> NRejectedPerChannel    (void) const;
+  map<string, double>   TimeRejectedPerChannel (void) const;
+
+  void Reset (void);
+  void Print (ostream & stream) const;
+
+  friend ostream & operator << (ostream & stream, const RejectedEventStats & stats);
+
+private:
+  RejectedEventStats();
+  RejectedEventStats(const RejectedEventStats & stats);
+  virtual ~RejectedEventStats();
+
+  //! self
+  static RejectedEventStats * fInstance;
+
+  //! per channel (interaction code) statistics
+  map<string, long int> fNRejected;    ///< number of rejected tries
+  map<string, double>   fTimeRejected; ///< time spent on rejected tries (sec)
+  map<string, long int> fNAbandoned;   ///< number of events abandoned (max number of tries reached)
+
+  //! clean
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (RejectedEventStats::fInstance !=0) {
+            delete RejectedEventStats::fInstance;
+            RejectedEventStats::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _REJECTED_EVENT_STATS_H_
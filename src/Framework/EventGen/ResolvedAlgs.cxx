@@ -0,0 +1,124 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <map>
+#include <set>
+#include <mutex>
+#include <utility>
+
+#include "Framework/EventGen/ResolvedAlgs.h"
+#include "Framework/EventGen/EventGeneratorI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+
+using std::map;
+using std::set;
+using std::pair;
+
+using namespace genie;
+
+namespace {
+
+  typedef pair<ULong64_t, const EventGeneratorI *> ChannelKey_t;
+
+  //! serialises the building, attaching & filling of the bundles, which are
+  //! shared by the drivers (and threads) using the same channels
+  std::mutex gResolvedAlgsMutex;
+
+  //! the bundles of all channels, kept until the end of the job
+  map<ChannelKey_t, ResolvedAlgs *> * gResolvedAlgs = 0;
+
+  //! interactions linked to more than one generator (get no bundle)
+  set<const Interaction *> * gSharedInteractions = 0;
+}
+//___________________________________________________________________________
+ResolvedAlgs::ResolvedAlgs(int tgt_pdg, const EventGeneratorI * evgen) :
+fTgtPdg(tgt_pdg),
+fGenerator(evgen),
+fXSecModel(evgen->CrossSectionAlg()),
+fModulesResolved(false)
+{
+
+}
+//___________________________________________________________________________
+ResolvedAlgs::~ResolvedAlgs()
+{
+
+}
+//___________________________________________________________________________
+void ResolvedAlgs::Attach(Interaction * in, const EventGeneratorI * evgen)
+{
+  if(!in || !evgen) return;
+
+  std::lock_guard<std::mutex> lock(gResolvedAlgsMutex);
+
+  if(!gResolvedAlgs) {
+    gResolvedAlgs       = new map<ChannelKey_t, ResolvedAlgs *>;
+    gSharedInteractions = new set<const Interaction *>;
+  }
+  if(gSharedInteractions->count(in) > 0) return;
+
+  ChannelKey_t key(in->Key(), evgen);
+  map<ChannelKey_t, ResolvedAlgs *>::const_iterator iter = gResolvedAlgs->find(key);
+
+  ResolvedAlgs * algs = 0;
+  if(iter != gResolvedAlgs->end()) algs = iter->second;
+  else {
+    algs = new ResolvedAlgs(in->InitState().Tgt().Pdg(), evgen);
+    gResolvedAlgs->insert(
+       map<ChannelKey_t, ResolvedAlgs *>::value_type(key, algs));
+  }
+
+  // the (shared) interaction list templates are only modified here, and
+  // only if they do not carry the same bundle already
+  const ResolvedAlgs * curr = in->ResolvedAlgsPtr();
+  if(curr == algs) return;
+  if(curr) {
+    LOG("ResolvedAlgs", pINFO)
+      << "Interaction: " << in->AsString()
+      << " is linked to more than one generator - It gets no resolved algorithms";
+    gSharedInteractions->insert(in);
+    in->SetResolvedAlgs(0);
+    return;
+  }
+  in->SetResolvedAlgs(algs);
+}
+//___________________________________________________________________________
+void ResolvedAlgs::AddResolved(const Algorithm * alg, const Algorithm * resolved)
+{
+  if(!alg || !resolved || alg == resolved) return;
+
+  for(unsigned int i = 0; i < fAlgs.size(); i++) {
+    if(fAlgs[i] == alg) { fResolved[i] = resolved; return; }
+  }
+  fAlgs.push_back(alg);
+  fResolved.push_back(resolved);
+
+  LOG("ResolvedAlgs", pINFO)
+    << "Resolved " << alg->Id().Key() << " -> " << resolved->Id().Key()
+    << " for target: " << fTgtPdg;
+}
+//___________________________________________________________________________
+void ResolvedAlgs::ResolveModules(const Interaction * in) const
+{
+  std::lock_guard<std::mutex> lock(gResolvedAlgsMutex);
+  if(fModulesResolved) return;
+
+  // the bundles are built non-const (see Attach()) and only filled here,
+  // once and under the lock
+  ResolvedAlgs & algs = const_cast<ResolvedAlgs &>(*this);
+  fGenerator->ResolveAlgs(in, algs);
+
+  fModulesResolved = true;
+}
+//___________________________________________________________________________
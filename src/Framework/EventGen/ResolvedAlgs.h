@@ -0,0 +1,95 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::ResolvedAlgs
+
+\brief   The algorithms used to generate the events of one interaction
+         channel (initial state & process), resolved once when the event
+         generation drivers are configured rather than for every event.
+
+         The bundles are built by InteractionGeneratorMap::BuildMap() for
+         each interaction it links to a generator, and are attached to the
+         interaction (see Interaction::ResolvedAlgsPtr()) so that they follow
+         it into the event records. They hold
+         - the event generator and its cross section model, so that
+           GEVGDriver does not look them up for every event,
+         - the algorithms that the processing modules would otherwise
+           select for every event (eg the model of a NuclearModelMap for the
+           target nucleus), filled by EventRecordVisitorI::ResolveAlgs()
+           when the first event of the channel is generated (so that the
+           modules are still instantiated on first use).
+
+         The bundles are shared by all the drivers & threads using the same
+         channel and are never deleted.
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _RESOLVED_ALGS_H_
+#define _RESOLVED_ALGS_H_
+
+#include <vector>
+
+#include "Framework/Algorithm/Algorithm.h"
+
+using std::vector;
+
+namespace genie {
+
+class EventGeneratorI;
+class XSecAlgorithmI;
+class Interaction;
+
+class ResolvedAlgs {
+
+public :
+  //! attach to the input interaction (linked to the input generator) the
+  //! bundle of its channel. Interactions shared by generators get no bundle.
+  static void Attach (Interaction * in, const EventGeneratorI * evgen);
+
+  int                     TgtPdg    (void) const { return fTgtPdg;    }
+  const EventGeneratorI * Generator (void) const { return fGenerator; }
+  const XSecAlgorithmI *  XSecModel (void) const { return fXSecModel; }
+
+  //! the algorithm to be used in place of the input one for this channel
+  //! (the input algorithm itself if the modules resolved nothing for it)
+  template<class T> const T * Resolved (const T * alg) const
+  {
+    const Algorithm * key = alg;
+    for(unsigned int i = 0; i < fAlgs.size(); i++) {
+      if(fAlgs[i] == key) return static_cast<const T *>(fResolved[i]);
+    }
+    return alg;
+  }
+
+  //! record the algorithm to be used in place of the input one (from
+  //! EventRecordVisitorI::ResolveAlgs())
+  void AddResolved (const Algorithm * alg, const Algorithm * resolved);
+
+  //! have the processing modules of the generator fill the bundle, the
+  //! first time it is called for the channel
+  void ResolveModules (const Interaction * in) const;
+
+private :
+  ResolvedAlgs(int tgt_pdg, const EventGeneratorI * evgen);
+  ResolvedAlgs(const ResolvedAlgs & algs);
+ ~ResolvedAlgs();
+
+  int                       fTgtPdg;          ///< target nucleus pdg code
+  const EventGeneratorI *   fGenerator;       ///< event generator of the channel
+  const XSecAlgorithmI *    fXSecModel;       ///< its cross section model
+  vector<const Algorithm *> fAlgs;            ///< algorithms resolved for the channel
+  vector<const Algorithm *> fResolved;        ///< the algorithms to use in their place
+  mutable bool              fModulesResolved; ///< filled by the modules? (guarded by a mutex in the .cxx)
+};
+
+}      // genie namespace
+
+#endif // _RESOLVED_ALGS_H_
@@ -22,19 +22,24 @@ using namespace genie;
 
 //____________________________________________________________________________
 RunningThreadInfo * RunningThreadInfo::fInstance = 0;
+
+// private instance of the calling thread (if any)
+static thread_local RunningThreadInfo * gThreadRunningThreadInfo = 0;
 //____________________________________________________________________________
 RunningThreadInfo::RunningThreadInfo()
 {
-  fInstance =  0;
+  fRunningThread = 0;
 }
 //____________________________________________________________________________
 RunningThreadInfo::~RunningThreadInfo()
 {
-  fInstance = 0;
+  if(this != gThreadRunningThreadInfo) fInstance = 0;
 }
 //____________________________________________________________________________
 RunningThreadInfo * RunningThreadInfo::Instance()
 {
+  if(gThreadRunningThreadInfo) return gThreadRunningThreadInfo;
+
   if(fInstance == 0) {
     static RunningThreadInfo::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
@@ -43,3 +48,21 @@ RunningThreadInfo * RunningThreadInfo::Instance()
   return fInstance;
 }
 //____________________________________________________________________________
+RunningThreadInfo * RunningThreadInfo::CreateThreadInstance(void)
+{
+// Create a private instance for the calling thread. While it exists, all
+// RunningThreadInfo::Instance() calls made from that thread return it.
+
+  RunningThreadInfo::DeleteThreadInstance();
+  gThreadRunningThreadInfo = new RunningThreadInfo;
+  return gThreadRunningThreadInfo;
+}
+//____________________________________________________________________________
+void RunningThreadInfo::DeleteThreadInstance(void)
+{
+  if(gThreadRunningThreadInfo) {
+    delete gThreadRunningThreadInfo;
+    gThreadRunningThreadInfo = 0;
+  }
+}
+//____________________________________________________________________________
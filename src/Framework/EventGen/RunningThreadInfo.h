@@ -32,6 +32,10 @@ class RunningThreadInfo
 public:
   static RunningThreadInfo * Instance(void);
 
+  //! per-thread instances, used by multi-threaded event generation drivers
+  static RunningThreadInfo * CreateThreadInstance (void);
+  static void                DeleteThreadInstance (void);
+
   const EventGeneratorI * RunningThread(void) 
   {   
     return fRunningThread; 
@@ -0,0 +1,169 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <RVersion.h>
+#include <TROOT.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
+#include "Framework/EventGen/ThreadedEventLoopI.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
+
+using std::vector;
+
+using namespace genie;
+
+const unsigned int ThreadedEventLoopI::kMaxQueuedEvents;
+
+namespace genie {
+  // runs the threads of the loop (a friend of the ThreadedEventLoopI)
+  class ThreadedEventLoopRunner {
+  public:
+    // events of a thread waiting to be written / written, to give back
+    struct ThreadQueue {
+      std::deque<EventRecord *> generated;
+      vector<EventRecord *>     written;
+    };
+
+    // state shared by the threads & the writer (calling) thread
+    struct LoopState {
+      long int                nev;
+      int                     nthreads;
+      vector<ThreadQueue>     queues;
+      std::mutex              lock;
+      std::condition_variable cond;
+    };
+
+    static void Loop(
+       ThreadedEventLoopI * loop, LoopState * st, int ithread, long int seed)
+    {
+      // Thread-private singletons (see GMCJDriver::GenerateEvents())
+      RandomGen::CreateThreadInstance(seed);
+      RunningThreadInfo::CreateThreadInstance();
+      Cache::CreateThreadInstance();
+
+      ThreadQueue & queue = st->queues[ithread];
+      vector<EventRecord *> released;
+
+      for(long int ievent = ithread; ievent < st->nev; ievent += st->nthreads) {
+        // give back the events written meanwhile
+        for(unsigned int i = 0; i < released.size(); i++) {
+          loop->ReleaseEvent(ithread, released[i]);
+        }
+        released.clear();
+
+        EventRecord * event = loop->GenerateEvent(ithread, ievent);
+
+        std::unique_lock<std::mutex> guard(st->lock);
+        st->cond.wait(guard, [&queue] {
+           return queue.generated.size() < ThreadedEventLoopI::kMaxQueuedEvents; });
+        queue.generated.push_back(event);
+        released.swap(queue.written);
+        st->cond.notify_all();
+      }
+      for(unsigned int i = 0; i < released.size(); i++) {
+        loop->ReleaseEvent(ithread, released[i]);
+      }
+
+      Cache::DeleteThreadInstance();
+      RunningThreadInfo::DeleteThreadInstance();
+      RandomGen::DeleteThreadInstance();
+    }
+  };
+}
+//____________________________________________________________________________
+ThreadedEventLoopI::ThreadedEventLoopI()
+{
+
+}
+//___________________________________________________________________________
+ThreadedEventLoopI::~ThreadedEventLoopI()
+{
+
+}
+//___________________________________________________________________________
+void ThreadedEventLoopI::ReleaseEvent(int /*ithread*/, EventRecord * event)
+{
+  delete event;
+}
+//___________________________________________________________________________
+void ThreadedEventLoopI::Run(long int nev, int nthreads, int seed_shard)
+{
+  LOG("EvLoop", pNOTICE)
+    << "Generating " << nev << " events using " << nthreads << " threads";
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+#endif
+
+  ThreadedEventLoopRunner::LoopState st;
+  st.nev      = nev;
+  st.nthreads = nthreads;
+  st.queues.resize(nthreads);
+
+  // With counter-based random number streams every thread uses the same
+  // seed (each event is keyed by its index), otherwise one derived from it
+  RandomGen * rnd = RandomGen::Instance();
+  long int seed = rnd->GetSeed();
+  bool counter_based = rnd->CounterBased();
+
+  vector<std::thread> threads;
+  for(int ithread = 0; ithread < nthreads; ithread++) {
+    long int thread_seed = (counter_based) ?
+         seed : utils::app_init::ShardSeed(seed, seed_shard + ithread);
+    threads.push_back( std::thread(
+         ThreadedEventLoopRunner::Loop, this, &st, ithread, thread_seed) );
+  }
+
+  // Write the events in order, with event ievent from thread ievent%nthreads
+  for(long int ievent = 0; ievent < nev; ievent++) {
+     ThreadedEventLoopRunner::ThreadQueue & queue = st.queues[ievent % nthreads];
+     EventRecord * event = 0;
+     {
+       std::unique_lock<std::mutex> guard(st.lock);
+       st.cond.wait(guard, [&queue] { return !queue.generated.empty(); });
+       event = queue.generated.front();
+       queue.generated.pop_front();
+       st.cond.notify_all();
+     }
+
+     this->WriteEvent(ievent, event);
+
+     std::lock_guard<std::mutex> guard(st.lock);
+     queue.written.push_back(event);
+  }
+
+  for(int ithread = 0; ithread < nthreads; ithread++) {
+    threads[ithread].join();
+  }
+
+  // the events written after the last event of a thread are still to be
+  // given back
+  for(int ithread = 0; ithread < nthreads; ithread++) {
+    vector<EventRecord *> & written = st.queues[ithread].written;
+    for(unsigned int i = 0; i < written.size(); i++) {
+      this->ReleaseEvent(ithread, written[i]);
+    }
+    written.clear();
+  }
+}
+//___________________________________________________________________________
@@ -0,0 +1,70 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ThreadedEventLoopI
+
+\brief    Multi-threaded event loop with ordered output, for the event
+          generation applications (gevgen, gevgen_ndcy, gevgen_nnbar_osc).
+
+          Run(nev, nthreads) starts nthreads threads: thread i generates the
+          events i, i+nthreads, ... (GenerateEvent()), with its own RandomGen,
+          RunningThreadInfo and Cache thread instances, and the calling
+          thread writes them in order (WriteEvent()), so that the output is
+          reproducible for a given number of threads (and, with counter-based
+          random number streams, for any number). At most kMaxQueuedEvents
+          events per thread wait to be written. The written events are given
+          back to the thread that generated them (ReleaseEvent()).
+
+          The threads must not share any algorithm with per-event state (see
+          EventGeneratorList::AdoptGenerators()). With counter-based random
+          number streams every thread uses the seed of the calling thread's
+          generator (each event is keyed by its index), otherwise the seed
+          of job shard seed_shard+i (see utils::app_init::ShardSeed()).
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _THREADED_EVENT_LOOP_I_H_
+#define _THREADED_EVENT_LOOP_I_H_
+
+namespace genie {
+
+class EventRecord;
+class ThreadedEventLoopRunner;
+
+class ThreadedEventLoopI {
+
+friend class ThreadedEventLoopRunner;
+
+public :
+  virtual ~ThreadedEventLoopI();
+
+  //! generate & write the events 0 ... nev-1 using nthreads threads
+  void Run (long int nev, int nthreads, int seed_shard = 0);
+
+  static const unsigned int kMaxQueuedEvents = 16;
+
+protected:
+  ThreadedEventLoopI();
+
+  //
+  // define the ThreadedEventLoopI interface:
+  //
+  //! generate event ievent (called by thread ithread)
+  virtual EventRecord * GenerateEvent (int ithread, long int ievent) = 0;
+  //! write event ievent (called by the calling thread, in event order)
+  virtual void          WriteEvent    (long int ievent, EventRecord * event) = 0;
+  //! dispose of a written event (called by thread ithread, or by the
+  //! calling thread once all threads are done): deleted by default
+  virtual void          ReleaseEvent  (int ithread, EventRecord * event);
+};
+
+}      // genie namespace
+#endif // _THREADED_EVENT_LOOP_I_H_
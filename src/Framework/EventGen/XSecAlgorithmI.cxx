@@ -10,6 +10,11 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added XSecBatch(), evaluating the cross section at several kinematical
+   points in one call.
+   Added IntegralBatch(), integrating the cross section for several
+   interactions (eg the energy knots of a spline) in one call.
 
 */
 //____________________________________________________________________________
@@ -41,6 +46,22 @@ Algorithm(name, config)
 XSecAlgorithmI::~XSecAlgorithmI()
 {
 
+}
+//___________________________________________________________________________
+void XSecAlgorithmI::XSecBatch(
+  const Interaction * const * in, size_t n, KinePhaseSpace_t k, double * xsec) const
+{
+  for(size_t j = 0; j < n; j++) {
+    xsec[j] = this->XSec(in[j], k);
+  }
+}
+//___________________________________________________________________________
+void XSecAlgorithmI::IntegralBatch(
+  const Interaction * const * in, size_t n, double * xsec) const
+{
+  for(size_t j = 0; j < n; j++) {
+    xsec[j] = this->Integral(in[j]);
+  }
 }
 //___________________________________________________________________________
 bool XSecAlgorithmI::ValidKinematics(const Interaction* interaction) const
@@ -63,4 +84,9 @@ bool XSecAlgorithmI::ValidKinematics(const Interaction* interaction) const
   return true;
 }
 //___________________________________________________________________________
+bool XSecAlgorithmI::AllowsParallelIntegration(void) const
+{
+  return true;
+}
+//___________________________________________________________________________
 
@@ -19,6 +19,8 @@
 #ifndef _XSEC_ALGORITHM_I_H_
 #define _XSEC_ALGORITHM_I_H_
 
+#include <cstddef>
+
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Framework/Interaction/Interaction.h"
@@ -33,16 +35,35 @@ public:
   //! Compute the cross section for the input interaction
   virtual double XSec (const Interaction* i, KinePhaseSpace_t k=kPSfE) const = 0;
 
+  //! Compute the cross sections xsec[j] for the n interactions in[j] (eg the
+  //! same process at n kinematical points). By default, one XSec() call per
+  //! interaction: models sharing intermediates between points can override it
+  virtual void XSecBatch (const Interaction * const * in, size_t n,
+                          KinePhaseSpace_t k, double * xsec) const;
+
   //! Integrate the model over the kinematic phase space available to the
   //! input interaction (kinematical cuts can be included)
   virtual double Integral (const Interaction* i) const = 0;
 
+  //! Compute the integrals xsec[j] for the n interactions in[j] (eg the same
+  //! process at the n energy knots of a spline). By default, one Integral()
+  //! call per interaction: models can override it to hand the whole set to
+  //! their integrator (see XSecIntegratorI::IntegrateBatch())
+  virtual void IntegralBatch (const Interaction * const * in, size_t n,
+                              double * xsec) const;
+
   //! Can this cross section algorithm handle the input process?
   virtual bool ValidProcess    (const Interaction* i) const = 0;
 
   //! Is the input kinematical point a physically allowed one?
   virtual bool ValidKinematics (const Interaction* i) const;
 
+  //! May private clones of this algorithm (owning their substructure) be
+  //! evaluated concurrently by the threads of a parallel integration?
+  //! Algorithms relying on thread-unsafe shared state (eg the LHAPDF5 Fortran
+  //! library) should return false
+  virtual bool AllowsParallelIntegration (void) const;
+
 protected:
   XSecAlgorithmI();
   XSecAlgorithmI(string name);
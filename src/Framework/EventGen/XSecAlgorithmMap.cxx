@@ -64,6 +64,7 @@ void XSecAlgorithmMap::Init(void)
 
   fInitState       = new InitialState;
   fInteractionList = new InteractionList;
+  fInteractionList->SetOwner(false); // references the list generator templates
 }
 //___________________________________________________________________________
 void XSecAlgorithmMap::CleanUp(void)
@@ -114,7 +115,7 @@ void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
   fInitState->Copy(init_state);
 
   EventGeneratorList::const_iterator evgliter; // event generator list iter
-  InteractionList::iterator          intliter; // interaction list iter
+  InteractionList::const_iterator    intliter; // interaction list iter
 
   // loop over all EventGenerator objects used in the current job
   for(evgliter = fEventGeneratorList->begin();
@@ -129,12 +130,12 @@ void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
         << "Querying [" << evgen->Id().Key() << "] for its InteractionList";
 
      const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
-     InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
+     const InteractionList * ilst = ilstgen->InteractionListTemplate(init_state);
 
      // no point to go on if the list is NULL - continue to next iteration
      if(!ilst) continue;
 
-     // append the new InteractionList to the local copy
+     // append references to the interactions of the list
      fInteractionList->Append(*ilst);
 
      // cross section algorithm used by this EventGenerator
@@ -156,8 +157,6 @@ void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
             map<string, const XSecAlgorithmI *>::value_type(code,xsec_alg));
 
      } // loop over interactions
-     delete ilst;
-     ilst = 0;
   } // loop over event generators
 }
 //___________________________________________________________________________
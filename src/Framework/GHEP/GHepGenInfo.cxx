@@ -0,0 +1,79 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include "Framework/GHEP/GHepGenInfo.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+bool GHepGenInfo::fEnabled = (std::getenv("GEVGGENINFO") != 0);
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const GHepGenInfo & info)
+  {
+    info.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+GHepGenInfo::GHepGenInfo() :
+fHadronizer(kGHadUndefined)
+{
+
+}
+//____________________________________________________________________________
+GHepGenInfo::GHepGenInfo(const GHepGenInfo & info) :
+fHadronizer(kGHadUndefined)
+{
+  this->Copy(info);
+}
+//____________________________________________________________________________
+GHepGenInfo::~GHepGenInfo()
+{
+
+}
+//____________________________________________________________________________
+void GHepGenInfo::SetEnabled(bool on)
+{
+  fEnabled = on;
+}
+//____________________________________________________________________________
+void GHepGenInfo::Reset(void)
+{
+  fHadronizer = kGHadUndefined;
+  fINuke.clear(); // keeps the allocated capacity
+}
+//____________________________________________________________________________
+void GHepGenInfo::Copy(const GHepGenInfo & info)
+{
+  fHadronizer = info.fHadronizer;
+  fINuke      = info.fINuke;
+}
+//____________________________________________________________________________
+void GHepGenInfo::Print(ostream & stream) const
+{
+  stream << "\n[-] Generation info: hadronizer = " << (int) fHadronizer;
+  for(unsigned int i = 0; i < fINuke.size(); i++) {
+    const GHepINukeStep & step = fINuke[i];
+    stream << "\n |-> INuke: GHEP entry " << step.position
+           << " (pdg = " << step.pdg << ", KE = " << step.ke << " GeV)"
+           << ", fate = " << step.fate
+           << ", " << step.nsteps << " steps, path = " << step.path
+           << " fm, tau = " << step.tau
+           << ((step.interacted) ? ", interacted" : ", escaped");
+  }
+  stream << "\n";
+}
+//____________________________________________________________________________
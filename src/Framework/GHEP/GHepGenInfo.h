@@ -0,0 +1,101 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GHepGenInfo
+
+\brief    Intermediate quantities of the event generation that are not kept
+          in the GHEP record (the selected hadronization model branch, the
+          steps of the hadrons transported through the nucleus), recorded by
+          the generation modules for the downstream reweighting tools.
+
+          Collection is off by default. It is switched on either by calling
+          SetEnabled(true) or by setting the GEVGGENINFO env. var. When
+          enabled, each GHepRecord holds a GHepGenInfo (see
+          GHepRecord::GenInfo()) and NtpWriter writes the `ggeninfo' tree
+          (see NtpGenInfo) alongside the GHEP event tree, with the quantities
+          recorded here and the ones readily found in the record (hit nucleon
+          momentum & removal energy, resonance, selected kinematics, ...).
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _GHEP_GEN_INFO_H_
+#define _GHEP_GEN_INFO_H_
+
+#include <vector>
+#include <ostream>
+
+using std::vector;
+using std::ostream;
+
+namespace genie {
+
+//! The hadronization model branch used for the event
+typedef enum EGHepHadronizer {
+  kGHadUndefined = 0,  ///< not hadronized (or unknown model)
+  kGHadKNO,            ///< KNO-based (AGKY) model
+  kGHadPythia,         ///< PYTHIA/JETSET string fragmentation
+  kGHadCharm,          ///< charm hadronization model
+  kGHadOther           ///< other hadronization model
+} GHepHadronizer_t;
+
+//! The transport of a hadron through the nucleus
+class GHepINukeStep {
+public :
+  int    position;  ///< GHEP position of the transported hadron when it was transported
+  int    pdg;       ///< hadron pdg code
+  double ke;        ///< hadron kinetic energy at the start of the transport (GeV)
+  int    fate;      ///< hadron fate (see GHepParticle::RescatterCode())
+  int    nsteps;    ///< number of transport steps
+  double path;      ///< path length travelled in the nucleus (fm)
+  double tau;       ///< integral of dl / (mean free path) along the path
+  bool   interacted;///< did the hadron interact (rather than escape)?
+};
+
+class GHepGenInfo;
+ostream & operator << (ostream & stream, const GHepGenInfo & info);
+
+class GHepGenInfo {
+
+public :
+  GHepGenInfo();
+  GHepGenInfo(const GHepGenInfo & info);
+ ~GHepGenInfo();
+
+  //! is the collection switched on?
+  static bool IsEnabled  (void) { return fEnabled; }
+  static void SetEnabled (bool on);
+
+  void Reset (void);
+  void Copy  (const GHepGenInfo & info);
+
+  //! the hadronization model branch
+  GHepHadronizer_t Hadronizer    (void) const { return fHadronizer; }
+  void             SetHadronizer (GHepHadronizer_t h) { fHadronizer = h; }
+
+  //! the intranuclear transport records, in the order of transport
+  void  AddINukeStep (const GHepINukeStep & step) { fINuke.push_back(step); }
+  unsigned int          NINukeSteps (void)           const { return fINuke.size(); }
+  const GHepINukeStep & INukeStep   (unsigned int i) const { return fINuke[i];     }
+
+  void Print (ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const GHepGenInfo & info);
+
+private:
+
+  GHepHadronizer_t      fHadronizer; ///< hadronization model branch
+  vector<GHepINukeStep> fINuke;      ///< intranuclear transport records
+
+  static bool fEnabled;
+};
+
+}      // genie namespace
+
+#endif // _GHEP_GEN_INFO_H_
@@ -22,11 +22,21 @@
    Adding special ctor for ROOT I/O purposes so as to avoid memory leak due to
    memory allocated in the default ctor when objects of this class are read by 
    the ROOT Streamer. 
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added Set(). Clear("keep") leaves the particle in its slot, so that
+   GHepRecord can re-use its particle slots.
+   Added IsIdentical(), used by the GHepRecordHistory journal.
+   The 4-vectors are held by value (class version 3). Added Momentum(),
+   Position() & the non-allocating GetP4/X4(TLorentzVector &); the
+   allocating GetP4/X4() are deprecated.
+   A particle held by a GHepRecord tells it of its pdg code changes (see
+   GHepRecord::Index()).
 
 */
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <cstring>
 #include <cassert>
 #include <iomanip>
 
@@ -66,7 +76,8 @@ namespace genie {
 }
 //___________________________________________________________________________
 GHepParticle::GHepParticle() :
-TObject()
+TObject(),
+fOwnerIdVersion(0)
 {
   this->Init();
 }
@@ -76,17 +87,18 @@ GHepParticle::GHepParticle(int pdg, GHepStatus_t status,
         int mother1, int mother2, int daughter1, int daughter2,
         const TLorentzVector & p, const TLorentzVector & v) :
 TObject(),
+fPdgCode(0),
 fStatus(status),
 fFirstMother(mother1),
 fLastMother(mother2),
 fFirstDaughter(daughter1),
-fLastDaughter(daughter2)
+fLastDaughter(daughter2),
+fP4(p),
+fX4(v),
+fOwnerIdVersion(0)
 {
   this->SetPdgCode(pdg);
 
-  fP4 = new TLorentzVector(p);
-  fX4 = new TLorentzVector(v);
-
   fRescatterCode  = -1;
   fPolzTheta      = -999; 
   fPolzPhi        = -999;    
@@ -100,16 +112,40 @@ GHepParticle::GHepParticle(int pdg, GHepStatus_t status,
         double px, double py, double pz, double En,
         double x, double y, double z, double t) :
 TObject(),
+fPdgCode(0),
 fStatus(status),
 fFirstMother(mother1),
 fLastMother(mother2),
 fFirstDaughter(daughter1),
-fLastDaughter(daughter2)
+fLastDaughter(daughter2),
+fP4(px,py,pz,En),
+fX4(x,y,z,t),
+fOwnerIdVersion(0)
 {
   this->SetPdgCode(pdg);
 
-  fP4 = new TLorentzVector(px,py,pz,En);
-  fX4 = new TLorentzVector(x,y,z,t);
+  fRescatterCode  = -1;
+  fPolzTheta      = -999; 
+  fPolzPhi        = -999;   
+  fIsBound        = false;
+  fRemovalEnergy  = 0.; 
+}
+//___________________________________________________________________________
+void GHepParticle::Set(int pdg, GHepStatus_t status,
+        int mother1, int mother2, int daughter1, int daughter2,
+        double px, double py, double pz, double En,
+        double x, double y, double z, double t)
+{
+  this->SetPdgCode(pdg);
+
+  fStatus         = status;
+  fFirstMother    = mother1;
+  fLastMother     = mother2;
+  fFirstDaughter  = daughter1;
+  fLastDaughter   = daughter2;
+
+  this->SetMomentum(px,py,pz,En);
+  this->SetPosition(x,y,z,t);
 
   fRescatterCode  = -1;
   fPolzTheta      = -999; 
@@ -120,7 +156,8 @@ fLastDaughter(daughter2)
 //___________________________________________________________________________
 // Copy constructor
 GHepParticle::GHepParticle(const GHepParticle & particle) :
-TObject()
+TObject(),
+fOwnerIdVersion(0)
 {
   this->Init();
   this->Copy(particle);
@@ -135,12 +172,13 @@ fFirstMother(-1),
 fLastMother(-1),
 fFirstDaughter(-1),
 fLastDaughter(-1),
-fP4(0), 
-fX4(0),
+fP4(0,0,0,0), 
+fX4(0,0,0,0),
 fPolzTheta(-999.),
 fPolzPhi(-999.),
 fRemovalEnergy(0),
-fIsBound(false)
+fIsBound(false),
+fOwnerIdVersion(0)
 {
 
 }
@@ -162,27 +200,20 @@ double GHepParticle::Mass(void) const
 {
   this->AssertIsKnownParticle();
 
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  return p->Mass();
+  return PDGLibrary::Instance()->Mass(fPdgCode);
 }
 //___________________________________________________________________________
 double GHepParticle::Charge(void) const
 {
   this->AssertIsKnownParticle();
 
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  return p->Charge();
+  return PDGLibrary::Instance()->Charge(fPdgCode);
 }
 //___________________________________________________________________________
 double GHepParticle::KinE(bool mass_from_pdg) const
 {
-  if(!fP4) {
-    LOG("GHepParticle", pWARN) << "4-momentum not yet set!";
-    return 0;
-  }
-
-  double En = fP4->Energy();
-  double M = ( (mass_from_pdg) ? this->Mass() : fP4->M() );
+  double En = fP4.Energy();
+  double M = ( (mass_from_pdg) ? this->Mass() : fP4.M() );
   double K = En - M;
 
   K = TMath::Max(K,0.);
@@ -211,60 +242,54 @@ int GHepParticle::A(void) const
 //___________________________________________________________________________
 TLorentzVector * GHepParticle::GetP4(void) const 
 { 
-// see GHepParticle::P4() for a method that does not create a new object and
-// transfers its ownership 
+// Deprecated: see GHepParticle::P4() & GetP4(TLorentzVector &) for methods 
+// that do not create a new object and transfer its ownership 
 
-  if(fP4) {
-     TLorentzVector * p4 = new TLorentzVector(*fP4); 
+  TLorentzVector * p4 = new TLorentzVector(fP4); 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHepParticle", pDEBUG) 
-          << "Return vp = " << utils::print::P4AsShortString(p4);
+  LOG("GHepParticle", pDEBUG) 
+       << "Return vp = " << utils::print::P4AsShortString(p4);
 #endif
-     return p4;
-  } else {
-    LOG("GHepParticle", pWARN) << "NULL 4-momentum TLorentzVector";
-    return 0;
-  }
+  return p4;
 }
 //___________________________________________________________________________
 TLorentzVector * GHepParticle::GetX4(void) const 
 { 
-// see GHepParticle::X4() for a method that does not create a new object and
-// transfers its ownership
+// Deprecated: see GHepParticle::X4() & GetX4(TLorentzVector &) for methods 
+// that do not create a new object and transfer its ownership
 
-  if(fX4) {
-     TLorentzVector * x4 = new TLorentzVector(*fX4); 
+  TLorentzVector * x4 = new TLorentzVector(fX4); 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHepParticle", pDEBUG) 
-         << "Return x4 = " << utils::print::X4AsString(x4);
+  LOG("GHepParticle", pDEBUG) 
+      << "Return x4 = " << utils::print::X4AsString(x4);
 #endif
-     return x4;
-  } else {
-    LOG("GHepParticle", pWARN) << "NULL 4-position TLorentzVector";
-    return 0;
-  }
+  return x4;
 }
 //___________________________________________________________________________
 void GHepParticle::SetPdgCode(int code)
 {
-  fPdgCode = code;
+  if(code != fPdgCode) {
+    fPdgCode = code;
+    this->PdgCodeChanged();
+  }
   this->AssertIsKnownParticle();
 }
 //___________________________________________________________________________
+void GHepParticle::PdgCodeChanged(void)
+{
+// tells the owning record (if any) that its search index is stale
+
+  if(fOwnerIdVersion) ++(*fOwnerIdVersion);
+}
+//___________________________________________________________________________
 void GHepParticle::SetMomentum(const TLorentzVector & p4)
 {
-  if(fP4)
-      fP4->SetPxPyPzE( p4.Px(), p4.Py(), p4.Pz(), p4.Energy() );
-  else
-      fP4 = new TLorentzVector(p4);
+  fP4.SetPxPyPzE( p4.Px(), p4.Py(), p4.Pz(), p4.Energy() );
 }
 //___________________________________________________________________________
 void GHepParticle::SetMomentum(double px, double py, double pz, double En)
 {
-  if(fP4)
-      fP4->SetPxPyPzE(px, py, pz, En);
-  else
-      fP4 = new TLorentzVector(px, py, pz, En);
+  fP4.SetPxPyPzE(px, py, pz, En);
 }
 //___________________________________________________________________________
 void GHepParticle::SetPosition(const TLorentzVector & v4)
@@ -280,8 +305,7 @@ void GHepParticle::SetPosition(double x, double y, double z, double t)
                                << y << ", z = " << z << ", t = " << t << ")";
 #endif
 
-  if(fX4) fX4->SetXYZT(x,y,z,t);
-  else    fX4 = new TLorentzVector(x,y,z,t);
+  fX4.SetXYZT(x,y,z,t);
 }
 //___________________________________________________________________________
 void GHepParticle::SetEnergy(double En)
@@ -308,10 +332,8 @@ bool GHepParticle::IsOnMassShell(void) const
 {
   this->AssertIsKnownParticle();
 
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-
-  double Mpdg = p->Mass();
-  double M4p  = (fP4) ? fP4->M() : 0.;
+  double Mpdg = PDGLibrary::Instance()->Mass(fPdgCode);
+  double M4p  = fP4.M();
 
 //  return utils::math::AreEqual(Mpdg, M4p);
 
@@ -407,6 +429,7 @@ void GHepParticle::Init(void)
 {
   fPdgCode       = 0;
   fStatus        = kIStUndefined;
+  this->PdgCodeChanged();
   fRescatterCode = -1;
   fFirstMother   = -1;
   fLastMother    = -1;
@@ -416,33 +439,35 @@ void GHepParticle::Init(void)
   fPolzPhi       = -999;    
   fIsBound       = false;
   fRemovalEnergy = 0.;
-  fP4            = new TLorentzVector(0,0,0,0);
-  fX4            = new TLorentzVector(0,0,0,0);
+  fP4.SetPxPyPzE(0,0,0,0);
+  fX4.SetXYZT   (0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::CleanUp(void)
 {
-// deallocate memory
+// the 4-vectors are held by value: there is nothing to deallocate, zero them
 
-  if(fP4) delete fP4;
-  if(fX4) delete fX4;
-  fP4 = 0;
-  fX4 = 0;
+  fP4.SetPxPyPzE(0,0,0,0);
+  fX4.SetXYZT   (0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::Reset(void)
 {
-// deallocate memory + initialize
+// clean-up + initialize
 
   this->CleanUp();
   this->Init();
 }
 //___________________________________________________________________________
-void GHepParticle::Clear(Option_t * /*option*/)
+void GHepParticle::Clear(Option_t * option)
 {
 // implement the Clear(Option_t *) method so that the GHepParticle when is a
 // member of a GHepRecord, gets deleted properly when calling TClonesArray's
 // Clear("C")
+// With the "keep" option (TClonesArray's Clear("C+keep"), see
+// GHepRecord::ResetRecord()) the slot is left as is, to be overwritten
+
+  if(option && strcmp(option, "keep") == 0) return;
 
   this->CleanUp();
 }
@@ -530,6 +555,25 @@ bool GHepParticle::CompareMomentum(const GHepParticle * p) const
   return same_momentum;
 }
 //___________________________________________________________________________
+bool GHepParticle::IsIdentical(const GHepParticle & p) const
+{
+// Unlike Compare(), all data members are compared & without any tolerance
+
+  if( fPdgCode       != p.fPdgCode       ||
+      fStatus        != p.fStatus        ||
+      fRescatterCode != p.fRescatterCode ||
+      !this->CompareFamily(&p) ) return false;
+
+  if( fPolzTheta     != p.fPolzTheta     ||
+      fPolzPhi       != p.fPolzPhi       ||
+      fRemovalEnergy != p.fRemovalEnergy ||
+      fIsBound       != p.fIsBound       ) return false;
+
+  if( fP4 != p.fP4 || fX4 != p.fX4 ) return false;
+
+  return true;
+}
+//___________________________________________________________________________
 void GHepParticle::Copy(const GHepParticle & particle)
 {
   this->SetStatus           (particle.Status()          );
@@ -540,8 +584,8 @@ void GHepParticle::Copy(const GHepParticle & particle)
   this->SetFirstDaughter    (particle.FirstDaughter()   );
   this->SetLastDaughter     (particle.LastDaughter()    );
 
-  this->SetMomentum (*particle.P4());
-  this->SetPosition (*particle.X4());
+  this->SetMomentum (particle.fP4);
+  this->SetPosition (particle.fX4);
 
   this->fPolzTheta = particle.fPolzTheta;
   this->fPolzPhi   = particle.fPolzPhi;
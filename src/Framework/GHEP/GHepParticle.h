@@ -75,27 +75,36 @@ public :
   double Mass   (void) const; ///< Mass that corresponds to the PDG code
   double Charge (void) const; ///< Chrg that corresponds to the PDG code
 
-  // Returns the momentum & position 4-vectors
-  const TLorentzVector * P4 (void) const { return fP4; }
-  const TLorentzVector * X4 (void) const { return fX4; }
-  TLorentzVector * P4 (void) { return fP4; }
-  TLorentzVector * X4 (void) { return fX4; }
+  // Returns the momentum & position 4-vectors (held by the particle, the
+  // pointers are never null)
+  const TLorentzVector * P4 (void) const { return &fP4; }
+  const TLorentzVector * X4 (void) const { return &fX4; }
+  TLorentzVector * P4 (void) { return &fP4; }
+  TLorentzVector * X4 (void) { return &fX4; }
+  const TLorentzVector & Momentum (void) const { return fP4; }
+  const TLorentzVector & Position (void) const { return fX4; }
+
+  // Copy the momentum & position 4-vectors into the input ones
+  void GetP4 (TLorentzVector & p4) const { p4 = fP4; }
+  void GetX4 (TLorentzVector & x4) const { x4 = fX4; }
 
   // Hand over clones of the momentum & position 4-vectors (+ their ownership)
+  // Deprecated: use P4(), X4(), Momentum(), Position() or the GetP4/X4
+  // overloads above, which do not allocate
   TLorentzVector * GetP4 (void) const;
   TLorentzVector * GetX4 (void) const;
 
   // Returns the momentum & position 4-vectors components
-  double Px     (void) const { return (fP4) ? fP4->Px()     : 0; } ///< Get Px
-  double Py     (void) const { return (fP4) ? fP4->Py()     : 0; } ///< Get Py
-  double Pz     (void) const { return (fP4) ? fP4->Pz()     : 0; } ///< Get Pz 
-  double E      (void) const { return (fP4) ? fP4->Energy() : 0; } ///< Get energy
-  double Energy (void) const { return this->E();                 } ///< Get energy
-  double KinE   (bool mass_from_pdg = false) const;                ///< Get kinetic energy
-  double Vx     (void) const { return (fX4) ? fX4->X()      : 0; } ///< Get production x
-  double Vy     (void) const { return (fX4) ? fX4->Y()      : 0; } ///< Get production y
-  double Vz     (void) const { return (fX4) ? fX4->Z()      : 0; } ///< Get production z
-  double Vt     (void) const { return (fX4) ? fX4->T()      : 0; } ///< Get production time
+  double Px     (void) const { return fP4.Px();     } ///< Get Px
+  double Py     (void) const { return fP4.Py();     } ///< Get Py
+  double Pz     (void) const { return fP4.Pz();     } ///< Get Pz 
+  double E      (void) const { return fP4.Energy(); } ///< Get energy
+  double Energy (void) const { return this->E();    } ///< Get energy
+  double KinE   (bool mass_from_pdg = false) const; ///< Get kinetic energy
+  double Vx     (void) const { return fX4.X();      } ///< Get production x
+  double Vy     (void) const { return fX4.Y();      } ///< Get production y
+  double Vz     (void) const { return fX4.Z();      } ///< Get production z
+  double Vt     (void) const { return fX4.T();      } ///< Get production time
 
   // Return removal energy /set only for bound nucleons/
   double RemovalEnergy (void) const { return fRemovalEnergy; } ///< Get removal energy 
@@ -107,6 +116,9 @@ public :
   bool CompareFamily      (const GHepParticle * p) const;
   bool CompareMomentum    (const GHepParticle * p) const;
 
+  // Exact comparison of all the particle data (see GHepRecordHistory)
+  bool IsIdentical        (const GHepParticle & p) const;
+
   // On/Off "shellness" if mass from PDG != mass from 4-P
   bool IsOnMassShell  (void) const;
   bool IsOffMassShell (void) const;
@@ -135,6 +147,12 @@ public :
   void SetFirstDaughter  (int d)          { fFirstDaughter = d; }
   void SetLastDaughter   (int d)          { fLastDaughter  = d; }
 
+  // Set all the properties, as the TParticle-like constructor does
+  void Set (int pdg, GHepStatus_t status,
+            int mother1, int mother2, int daughter1, int daughter2,
+            double px, double py, double pz, double E,
+            double x, double y, double z, double t);
+
   // Set the momentum & position 4-vectors
   void SetMomentum (const TLorentzVector & p4);
   void SetPosition (const TLorentzVector & v4);
@@ -169,8 +187,11 @@ public :
 
 private:
 
+  friend class GHepRecord;
+
   void Init(void);
   void AssertIsKnownParticle(void) const;
+  void PdgCodeChanged(void);
 
   int              fPdgCode;        ///< particle PDG code
   GHepStatus_t     fStatus;         ///< particle status
@@ -179,14 +200,15 @@ private:
   int              fLastMother;     ///< last mother idx
   int              fFirstDaughter;  ///< first daughter idx
   int              fLastDaughter;   ///< last daughter idx
-  TLorentzVector * fP4;             ///< momentum 4-vector (GeV)
-  TLorentzVector * fX4;             ///< position 4-vector (in the target nucleus coordinate system / x,y,z in fm / t=0)
+  TLorentzVector   fP4;             ///< momentum 4-vector (GeV)
+  TLorentzVector   fX4;             ///< position 4-vector (in the target nucleus coordinate system / x,y,z in fm / t=0)
   double           fPolzTheta;      ///< polar polarization angle (rad)
   double           fPolzPhi;        ///< azimuthal polarization angle (rad)
   double           fRemovalEnergy;  ///< removal energy for bound nucleons (GeV)
   bool             fIsBound;        ///< 'is it a bound particle?' flag
+  unsigned long *  fOwnerIdVersion; //! pdg code version of the owning GHepRecord (see GHepRecord::Index()), if any
 
-ClassDef(GHepParticle, 2)
+ClassDef(GHepParticle, 3)
 
 };
 
@@ -0,0 +1,76 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GHepParticleView
+
+\brief    A read-only view of the particle list of a GHEP record, for code
+          converting GENIE events to another format (eg the event data model
+          of an experiment framework): the particles are accessed in place,
+          without copying them or going through the (checked, virtual)
+          GHepRecord::Particle() calls, and can be iterated over with a
+          range-based for loop.
+          The view is valid while the record is neither modified nor reset
+          (eg recycled or re-used for the next event).
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _GHEP_PARTICLE_VIEW_H_
+#define _GHEP_PARTICLE_VIEW_H_
+
+#include <TClonesArray.h>
+
+#include "Framework/GHEP/GHepParticle.h"
+
+namespace genie {
+
+class GHepParticleView {
+
+public :
+  GHepParticleView(const TClonesArray & particles) : fParticles(&particles) { }
+
+  //! number of particles (the record positions are 0 ... Size()-1)
+  int  Size  (void) const { return fParticles->GetEntriesFast(); }
+  bool Empty (void) const { return this->Size() == 0; }
+
+  //! the particle at the input position (not checked)
+  const GHepParticle & operator[] (int position) const
+  { return *static_cast<const GHepParticle *>(fParticles->UncheckedAt(position)); }
+
+  class const_iterator {
+  public :
+    const_iterator(const TClonesArray * particles, int position) :
+       fParticles(particles), fPosition(position) { }
+
+    const GHepParticle & operator*  (void) const
+    { return *static_cast<const GHepParticle *>(fParticles->UncheckedAt(fPosition)); }
+    const GHepParticle * operator-> (void) const { return &(**this); }
+
+    const_iterator & operator++ (void) { fPosition++; return *this; }
+    bool operator== (const const_iterator & it) const { return fPosition == it.fPosition; }
+    bool operator!= (const const_iterator & it) const { return fPosition != it.fPosition; }
+
+    int Position (void) const { return fPosition; }
+
+  private :
+    const TClonesArray * fParticles;
+    int                  fPosition;
+  };
+
+  const_iterator begin (void) const { return const_iterator(fParticles, 0); }
+  const_iterator end   (void) const { return const_iterator(fParticles, this->Size()); }
+
+private :
+  const TClonesArray * fParticles; ///< the particles of the record (not owned)
+};
+
+}      // genie namespace
+
+#endif // _GHEP_PARTICLE_VIEW_H_
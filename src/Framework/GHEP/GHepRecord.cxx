@@ -48,6 +48,21 @@
    set it and tweaked Print() accordingly.
  @ May 02, 2013 - CA
    Added `KinePhaseSpace_t DiffXSecVars(void) const' to return fDiffXSecPhSp.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added a (transient) random number checkpoint, see SetRndmCheckpoint().
+   ResetRecord() re-uses the particle slots, vertex, flags and summary
+   (see ReleaseSpareSummary()) rather than re-allocating them.
+   CompactifyDaughterLists() and FinalizeDaughterLists() now run in linear
+   time over the whole record. Added the deferred and append-only daughter-
+   list maintenance modes. Added an index of the positions of each pdg code,
+   used by the searches by pdg code. It is kept current by the record's own
+   pdg code changes only (see GHepParticle::PdgCodeChanged()); the role
+   accessors check their fixed slots.
+   Added CopyHeader(), SetParticle() and Truncate(), used by the
+   GHepRecordHistory journal.
+   Added the (transient) event filter decision, see SetFilteredOut().
+   Added the (transient) intermediate generation quantities, see GenInfo().
+   Added Particles(), a zero-copy view of the particle list.
 
 */
 //____________________________________________________________________________
@@ -55,6 +70,7 @@
 #include <cassert>
 #include <algorithm>
 #include <iomanip>
+#include <map>
 
 #include <TLorentzVector.h>
 #include <TVector3.h>
@@ -64,7 +80,9 @@
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepParticleView.h"
 #include "Framework/GHEP/GHepRecord.h"
+#include "Framework/GHEP/GHepGenInfo.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/GHEP/GHepUtils.h"
@@ -78,6 +96,7 @@ using std::setw;
 using std::setprecision;
 using std::setfill;
 using std::ios;
+using std::map;
 
 using namespace genie;
 
@@ -85,6 +104,18 @@ ClassImp(GHepRecord)
 
 int GHepRecord::fPrintLevel = 3;
 
+//___________________________________________________________________________
+namespace genie {
+ // Search index of a GHepRecord (see GHepRecord::Index())
+ class GHepRecordIndex {
+ public:
+   GHepRecordIndex() : fNSlots(0) {}
+
+   int                    fNSlots; ///< number of slots when last validated
+   map<int, vector<int> > fPdg;    ///< (ascending) positions of each pdg code
+ };
+}
+
 //___________________________________________________________________________
 namespace genie {
  ostream & operator << (ostream & stream, const GHepRecord & rec)
@@ -122,7 +153,19 @@ fEventMask(0),
 fWeight(0.),
 fProb(0.),
 fXSec(0.),
-fDiffXSec(0.)
+fDiffXSec(0.),
+fSpareSummary(0),
+fRndmSeed(-1),
+fRndmRun(-1),
+fRndmEvent(-1),
+fDeferCompactify(false),
+fAppendOnly(false),
+fNeedCompactify(false),
+fFilteredOut(false),
+fGenInfo(0),
+fIndex(0),
+fIndexVersion(0),
+fIdVersion(1)
 {
 
 }
@@ -145,6 +188,21 @@ void GHepRecord::AttachSummary(Interaction * interaction)
   fInteraction = interaction;
 }
 //___________________________________________________________________________
+Interaction * GHepRecord::ReleaseSpareSummary(void)
+{
+  Interaction * interaction = fSpareSummary;
+  fSpareSummary = 0;
+  return interaction;
+}
+//___________________________________________________________________________
+GHepParticle * GHepRecord::ParticleSlot(int pos)
+{
+// Particles cleared by ResetRecord() are kept in their slots (with their
+// 4-vectors) and re-used here. Other slots get a default-constructed one.
+
+  return (GHepParticle *) this->ConstructedAt(pos);
+}
+//___________________________________________________________________________
 GHepParticle * GHepRecord::Particle(int position) const
 {
 // Returns the GHepParticle from the specified position of the event record.
@@ -159,23 +217,21 @@ GHepParticle * GHepRecord::Particle(int position) const
   return 0;
 }
 //___________________________________________________________________________
+GHepParticleView GHepRecord::Particles(void) const
+{
+  return GHepParticleView(*this);
+}
+//___________________________________________________________________________
 GHepParticle * GHepRecord::FindParticle(
     int pdg, GHepStatus_t status, int start) const
 {
 // Returns the first GHepParticle with the input pdg-code and status
 // starting from the specified position of the event record.
 
-  int nentries = this->GetEntries();
-  for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Status() == status && p->Pdg() == pdg) return p;
-  }
-
-  LOG("GHEP", pINFO)
-    << "No particle found with: (pos >= " << start
-    << ", pdg = " << pdg << ", ist = " << status << ")";
+  int pos = this->ParticlePosition(pdg, status, start);
+  if(pos < 0) return 0;
 
-  return 0;
+  return (GHepParticle *) (*this)[pos];
 }
 //___________________________________________________________________________
 int GHepRecord::ParticlePosition(
@@ -184,10 +240,16 @@ int GHepRecord::ParticlePosition(
 // Returns the position of the first GHepParticle with the input pdg-code
 // and status starting from the specified position of the event record.
 
-  int nentries = this->GetEntries();
-  for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Status() == status && p->Pdg() == pdg) return i;
+  const GHepRecordIndex * index = this->Index();
+  map<int, vector<int> >::const_iterator it = index->fPdg.find(pdg);
+  if(it != index->fPdg.end()) {
+     const vector<int> & slots = it->second;
+     vector<int>::const_iterator sit =
+                        std::lower_bound(slots.begin(), slots.end(), start);
+     for( ; sit != slots.end(); ++sit) {
+        GHepParticle * p = (GHepParticle *) (*this)[*sit];
+        if(p && p->Status() == status) return *sit;
+     }
   }
 
   LOG("GHEP", pINFO)
@@ -457,7 +519,7 @@ int GHepRecord::HitNucleonPosition(void) const
 // If a struck nucleon is set it will be at slot 2 (for scattering off nuclear
 // targets) or at slot 1 (for free nucleon scattering).
 // If the struck nucleon is not set (eg coherent scattering, ve- scattering) 
-// it returns 0.
+// it returns -1.
 
   GHepParticle * nucleus = this->TargetNucleus();
 
@@ -514,22 +576,79 @@ unsigned int GHepRecord::NEntries(int pdg, GHepStatus_t ist, int start) const
 {
   unsigned int nentries = 0;
 
-  for(int i = start; i < this->GetEntries(); i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Pdg()==pdg && p->Status()==ist) nentries++;
+  const GHepRecordIndex * index = this->Index();
+  map<int, vector<int> >::const_iterator it = index->fPdg.find(pdg);
+  if(it == index->fPdg.end()) return 0;
+
+  const vector<int> & slots = it->second;
+  vector<int>::const_iterator sit =
+                        std::lower_bound(slots.begin(), slots.end(), start);
+  for( ; sit != slots.end(); ++sit) {
+     GHepParticle * p = (GHepParticle *) (*this)[*sit];
+     if(p && p->Status()==ist) nentries++;
   }
   return nentries;
 }
 //___________________________________________________________________________
 unsigned int GHepRecord::NEntries(int pdg, int start) const
 {
-  unsigned int nentries = 0;
+  const GHepRecordIndex * index = this->Index();
+  map<int, vector<int> >::const_iterator it = index->fPdg.find(pdg);
+  if(it == index->fPdg.end()) return 0;
+
+  const vector<int> & slots = it->second;
+  vector<int>::const_iterator sit =
+                        std::lower_bound(slots.begin(), slots.end(), start);
+  return slots.end() - sit;
+}
+//___________________________________________________________________________
+const GHepRecordIndex * GHepRecord::Index(void) const
+{
+// Returns the search index, re-building it if it is stale
 
-  for(int i = start; i < this->GetEntries(); i++) {
+  if(this->IndexIsCurrent()) return fIndex;
+
+  if(!fIndex) fIndex = new GHepRecordIndex;
+
+  // keep the per-pdg vectors (and their buffers) for re-use
+  map<int, vector<int> >::iterator it = fIndex->fPdg.begin();
+  for( ; it != fIndex->fPdg.end(); ++it) it->second.clear();
+
+  int nslots = this->GetEntriesFast();
+  for(int i = 0; i < nslots; i++) {
      GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Pdg()==pdg) nentries++;
+     if(!p) continue;
+     p->fOwnerIdVersion = &fIdVersion;
+     fIndex->fPdg[p->Pdg()].push_back(i);
   }
-  return nentries;
+  fIndex->fNSlots = nslots;
+
+  fIndexVersion = fIdVersion;
+  return fIndex;
+}
+//___________________________________________________________________________
+bool GHepRecord::IndexIsCurrent(void) const
+{
+  return (fIndex && fIndexVersion != 0 &&
+          fIndexVersion == fIdVersion &&
+          fIndex->fNSlots == this->GetEntriesFast());
+}
+//___________________________________________________________________________
+void GHepRecord::IndexParticle(int pos) const
+{
+// Adds the particle just inserted at the input slot to the (otherwise
+// current) search index
+
+  GHepParticle * p = (GHepParticle *) (*this)[pos];
+  if(!p) {
+    this->InvalidateIndex();
+    return;
+  }
+  p->fOwnerIdVersion = &fIdVersion;
+  fIndex->fPdg[p->Pdg()].push_back(pos);
+  fIndex->fNSlots = this->GetEntriesFast();
+
+  fIndexVersion = fIdVersion;
 }
 //___________________________________________________________________________
 void GHepRecord::AddParticle(const GHepParticle & p)
@@ -537,12 +656,14 @@ void GHepRecord::AddParticle(const GHepParticle & p)
 // Provides a simplified method for inserting entries in the TClonesArray
 
   unsigned int pos = this->GetEntries();
+  bool indexed = this->IndexIsCurrent();
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GHEP", pINFO)
     << "Adding particle with pdgc = " << p.Pdg() << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(p);
+  this->ParticleSlot(pos)->Copy(p);
+  if(indexed) this->IndexParticle(pos);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -556,12 +677,15 @@ void GHepRecord::AddParticle(
 // Provides a 'simplified' method for inserting entries in the TClonesArray
 
   unsigned int pos = this->GetEntries();
+  bool indexed = this->IndexIsCurrent();
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(pdg,status, mom1,mom2,dau1,dau2, p, v);
+  this->ParticleSlot(pos)->Set(pdg, status, mom1, mom2, dau1, dau2,
+                  p.Px(), p.Py(), p.Pz(), p.E(), v.X(), v.Y(), v.Z(), v.T());
+  if(indexed) this->IndexParticle(pos);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -576,13 +700,15 @@ void GHepRecord::AddParticle(
 // Provides a 'simplified' method for inserting entries in the TClonesArray
 
   unsigned int pos = this->GetEntries();
+  bool indexed = this->IndexIsCurrent();
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ( (*this)[pos] ) GHepParticle (
+  this->ParticleSlot(pos)->Set(
             pdg, status, mom1, mom2, dau1, dau2, px, py, pz, E, x, y, z, t);
+  if(indexed) this->IndexParticle(pos);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -612,6 +738,13 @@ void GHepRecord::UpdateDaughterLists(void)
   int dau1 = mom->FirstDaughter();
   int dau2 = mom->LastDaughter();
 
+  // in the append-only mode the new daughter simply extends the list
+  if(fAppendOnly) {
+     if(dau1 == -1) mom->SetFirstDaughter(pos);
+     mom->SetLastDaughter(pos);
+     return;
+  }
+
   // handles the case where the daughter list was initially empty
   if(dau1 == -1) {
      mom->SetFirstDaughter(pos);
@@ -644,7 +777,18 @@ void GHepRecord::UpdateDaughterLists(void)
   }
 
   // If you are here, then the last particle insertion broke the daughter
-  // list compactification - Run the compactifier
+  // list compactification - Run the compactifier, or just mark the record
+  // and widen the list if the compactification is deferred
+  if(fDeferCompactify) {
+     fNeedCompactify = true;
+     mom->SetFirstDaughter (TMath::Min(dau1,pos));
+     mom->SetLastDaughter  (TMath::Max(dau2,pos));
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+     LOG("GHEP", pINFO)
+       << "Daughter-list is not compact - Deferring compactification";
+#endif
+     return;
+  }
   LOG("GHEP", pNOTICE)
       << "Daughter-list is not compact - Running compactifier";
   this->CompactifyDaughterLists();
@@ -684,53 +828,131 @@ void GHepRecord::RemoveIntermediateParticles(void)
   this->Compress(); 
 }
 //___________________________________________________________________________
-void GHepRecord::CompactifyDaughterLists(void)
+TObject * GHepRecord::RemoveAt(Int_t idx)
+{
+  this->InvalidateIndex();
+  return TClonesArray::RemoveAt(idx);
+}
+//___________________________________________________________________________
+void GHepRecord::Compress(void)
+{
+  this->InvalidateIndex();
+  TClonesArray::Compress();
+}
+//___________________________________________________________________________
+void GHepRecord::SetParticle(int pos, const GHepParticle & p)
+{
+  if(pos < 0 || pos > this->GetEntries()) {
+    LOG("GHEP", pERROR)
+      << "Can not set the particle at slot " << pos << " of a record with "
+      << this->GetEntries() << " entries";
+    return;
+  }
+  this->InvalidateIndex();
+  this->ParticleSlot(pos)->Copy(p);
+}
+//___________________________________________________________________________
+void GHepRecord::Truncate(int nentries)
 {
   int n = this->GetEntries();
-  if(n<1) return;
+  if(nentries >= n) return;
 
-  int i = this->Particle(n-1)->FirstMother();
-  if(i<0) return;
-
-  //  for(int i=0; i<n; i++) {
-     bool compact = this->HasCompactDaughterList(i);
+  this->InvalidateIndex();
+  for(int i = n-1; i >= TMath::Max(0,nentries); i--) {
+    TClonesArray::RemoveAt(i);
+  }
+}
+//___________________________________________________________________________
+void GHepRecord::CompactifyDaughterLists(void)
+{
+// Re-orders the record so that the daughters of each particle occupy
+// consecutive slots, then re-builds all daughter-lists. Particles are taken
+// in their current order and each one is placed right after the last placed
+// daughter of its mother (or at the end, if its mother has no placed
+// daughters yet). This gives the same ordering as compactifying after each
+// insertion, but the whole record is handled in a single stable, linear-time
+// pass: the new order is built as a linked list, then the particles are
+// moved following the cycles of the permutation.
 
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHEP", pNOTICE) 
-        << "Particle's " << i << " daughter list is " 
-        << ((compact) ? "compact" : "__not__ compact");
-#endif
+  fNeedCompactify = false;
 
-     if(!compact) {
-        GHepParticle * p = this->Particle(i);
+  int n = this->GetEntries();
+  if(n<2) return;
 
-        int dau1 = p->FirstDaughter();
-        int dau2 = p->LastDaughter();
-        int ndau = dau2-dau1+1;
-        int ndp  = dau2+1;
-        if(dau1==-1) {ndau=0;}
+  for(int i=0; i<n; i++) {
+     if(!this->Particle(i)) {
+        LOG("GHEP", pWARN)
+          << "Empty slot at: " << i << " - Can not compactify daughter-lists";
+        return;
+     }
+  }
 
-        int curr_pos = n-1;   
-        while (curr_pos > ndp) {
-           this->SwapParticles(curr_pos,curr_pos-1);
-           curr_pos--;
-        }
-        if(ndau>0) {
-          this->Particle(i)->SetFirstDaughter(dau1);
-          this->Particle(i)->SetLastDaughter(dau2+1);
-        } else {
-          this->Particle(i)->SetFirstDaughter(-1);
-          this->Particle(i)->SetLastDaughter(-1);
-        }
-        this->FinalizeDaughterLists();
+  // build the new order as a linked list over the current slots
+  vector<int> next    (n, -1);
+  vector<int> lastdau (n, -1);
+  int head = -1;
+  int tail = -1;
+  for(int i=0; i<n; i++) {
+     int mom = this->Particle(i)->FirstMother();
+     bool has_mom = (mom >= 0 && mom < n);
+     int after = (has_mom) ? lastdau[mom] : -1;
+     if(after >= 0) {
+        next[i]     = next[after];
+        next[after] = i;
+        if(tail == after) tail = i;
+     } else {
+        if(tail < 0) head = i;
+        else next[tail] = i;
+        tail = i;
+     }
+     if(has_mom) lastdau[mom] = i;
+  }
 
-     } //!compact
+  // old slot -> new slot, and new slot -> old slot
+  vector<int> newpos (n, -1);
+  vector<int> oldpos (n, -1);
+  bool reorder = false;
+  int j = 0;
+  for(int i = head; i >= 0; i = next[i]) {
+     newpos[i] = j;
+     oldpos[j] = i;
+     reorder = reorder || (i != j);
+     j++;
+  }
 
+  if(reorder) {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHEP", pINFO)
-        << "Done ompactifying daughter-list for particle at slot: " << i;
+     LOG("GHEP", pINFO) << "Re-ordering particles to compactify daughter-lists";
 #endif
-     //  }
+     // re-map the mother indices
+     for(int i=0; i<n; i++) {
+        GHepParticle * p = this->Particle(i);
+        int mom1 = p->FirstMother();
+        int mom2 = p->LastMother();
+        if(mom1 >= 0 && mom1 < n) p->SetFirstMother (newpos[mom1]);
+        if(mom2 >= 0 && mom2 < n) p->SetLastMother  (newpos[mom2]);
+     }
+     // move the particles to their new slots, one permutation cycle at a time
+     vector<bool> done (n, false);
+     GHepParticle tmp;
+     for(int start=0; start<n; start++) {
+        if(done[start] || oldpos[start] == start) { done[start] = true; continue; }
+        tmp.Copy(*this->Particle(start));
+        int curr = start;
+        while(true) {
+           done[curr] = true;
+           int src = oldpos[curr];
+           if(src == start) {
+              this->Particle(curr)->Copy(tmp);
+              break;
+           }
+           this->Particle(curr)->Copy(*this->Particle(src));
+           curr = src;
+        }
+     }
+  }
+
+  this->FinalizeDaughterLists();
 }
 //___________________________________________________________________________
 bool GHepRecord::HasCompactDaughterList(int pos)
@@ -837,26 +1059,25 @@ void GHepRecord::FinalizeDaughterLists(void)
 // Update all daughter-lists based on particle 'first mother' field.
 // To work correctly, the daughter-lists must have been compactified first.
 
-  GHepParticle * p1 = 0;
-  TIter iter1(this);
-  int i1=0;
-  while( (p1 = (GHepParticle *)iter1.Next()) ) {
-    int dau1 = -1;
-    int dau2 = -1;
-    GHepParticle * p2 = 0;
-    TIter iter2(this);
-    int i2=0;
-    while( (p2 = (GHepParticle *)iter2.Next()) ) {
-
-       if(p2->FirstMother() == i1) {
-          dau1 = (dau1<0) ? i2 : TMath::Min(dau1,i2);
-          dau2 = (dau2<0) ? i2 : TMath::Max(dau2,i2);
-       }
-       i2++;
-    }
-    i1++;
-    p1 -> SetFirstDaughter (dau1);
-    p1 -> SetLastDaughter  (dau2);
+  int n = this->GetEntries();
+
+  for(int i=0; i<n; i++) {
+    GHepParticle * p = this->Particle(i);
+    if(!p) continue;
+    p -> SetFirstDaughter (-1);
+    p -> SetLastDaughter  (-1);
+  }
+  for(int i=0; i<n; i++) {
+    GHepParticle * p = this->Particle(i);
+    if(!p) continue;
+    int mom_pos = p->FirstMother();
+    if(mom_pos < 0 || mom_pos >= n) continue;
+    GHepParticle * mom = this->Particle(mom_pos);
+    if(!mom) continue;
+    int dau1 = mom->FirstDaughter();
+    int dau2 = mom->LastDaughter();
+    mom -> SetFirstDaughter ( (dau1<0) ? i : TMath::Min(dau1,i) );
+    mom -> SetLastDaughter  ( (dau2<0) ? i : TMath::Max(dau2,i) );
   }
 }
 //___________________________________________________________________________
@@ -876,11 +1097,23 @@ void GHepRecord::InitRecord(void)
   LOG("GHEP", pDEBUG) << "Initializing GHepRecord";
 #endif
   fInteraction  = 0;
+  fSpareSummary = 0;
   fWeight       = 1.;
   fProb         = 1.;
   fXSec         = 0.;
   fDiffXSec     = 0.;
   fDiffXSecPhSp = kPSNull;
+  fRndmSeed     = -1;
+  fRndmRun      = -1;
+  fRndmEvent    = -1;
+  fDeferCompactify = false;
+  fAppendOnly      = false;
+  fNeedCompactify  = false;
+  fFilteredOut     = false;
+  fGenInfo         = 0;
+  fIndex        = 0;
+  fIndexVersion = 0;
+  fIdVersion    = 1;
   fVtx          = new TLorentzVector(0,0,0,0);
 
   fEventFlags  = new TBits(GHepFlags::NFlags());
@@ -909,11 +1142,45 @@ void GHepRecord::CleanRecord(void)
 //___________________________________________________________________________
 void GHepRecord::ResetRecord(void)
 {
+// Resets the record for generating a new event. Nothing is re-allocated:
+// The particles are cleared but kept in their slots (see ParticleSlot())
+// and the summary is kept for re-use (see ReleaseSpareSummary())
+
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GHEP", pDEBUG) << "Reseting GHepRecord";
 #endif
-  this->CleanRecord();
-  this->InitRecord();
+  if(!fVtx || !fEventFlags || !fEventMask) {
+    this->CleanRecord();
+    this->InitRecord();
+    return;
+  }
+
+  if(fInteraction) {
+    if(fSpareSummary) delete fSpareSummary;
+    fSpareSummary = fInteraction;
+    fInteraction  = 0;
+  }
+
+  TClonesArray::Clear("C+keep");
+
+  fWeight       = 1.;
+  fProb         = 1.;
+  fXSec         = 0.;
+  fDiffXSec     = 0.;
+  fDiffXSecPhSp = kPSNull;
+  fRndmSeed     = -1;
+  fRndmRun      = -1;
+  fRndmEvent    = -1;
+  fNeedCompactify = false;
+  fFilteredOut    = false;
+  if(fGenInfo) fGenInfo->Reset();
+  this->InvalidateIndex();
+  fVtx->SetXYZT(0,0,0,0);
+
+  fEventFlags->ResetAllBits(false);
+  for(unsigned int i = 0; i < GHepFlags::NFlags(); i++) {
+   fEventMask->SetBitNumber(i, true);
+  }
 }
 //___________________________________________________________________________
 void GHepRecord::Clear(Option_t * opt)
@@ -921,6 +1188,9 @@ void GHepRecord::Clear(Option_t * opt)
   if (fInteraction) delete fInteraction;
   fInteraction=0;
 
+  if (fSpareSummary) delete fSpareSummary;
+  fSpareSummary=0;
+
   if (fVtx) delete fVtx;
   fVtx=0;
 
@@ -930,6 +1200,13 @@ void GHepRecord::Clear(Option_t * opt)
   if(fEventMask) delete fEventMask;
   fEventMask=0;
 
+  if(fIndex) delete fIndex;
+  fIndex=0;
+  fIndexVersion=0;
+
+  if(fGenInfo) delete fGenInfo;
+  fGenInfo=0;
+
   TClonesArray::Clear(opt);
 
 //  if (fInteraction) delete fInteraction;
@@ -950,10 +1227,28 @@ void GHepRecord::Copy(const GHepRecord & record)
   GHepParticle * p = 0;
   TIter ghepiter(&record);
   while ( (p = (GHepParticle *) ghepiter.Next()) )
-                              new ( (*this)[ientry++] ) GHepParticle(*p);
+                              this->ParticleSlot(ientry++)->Copy(*p);
+
+  // copy the rest of the record
+  this->CopyHeader(record);
+}
+//___________________________________________________________________________
+void GHepRecord::CopyHeader(const GHepRecord & record)
+{
+// Copies everything but the particle entries
 
-  // copy summary
-  fInteraction = new Interaction( *record.fInteraction );
+  // copy summary (re-using the previous one, if any)
+  if(fInteraction) {
+    if(fSpareSummary) delete fSpareSummary;
+    fSpareSummary = fInteraction;
+    fInteraction  = 0;
+  }
+  if(record.fInteraction) {
+    Interaction * summary = this->ReleaseSpareSummary();
+    if(summary) summary->Copy(*record.fInteraction);
+    else        summary = new Interaction( *record.fInteraction );
+    fInteraction = summary;
+  }
 
   // copy flags & mask
   *fEventFlags = *(record.EventFlags());
@@ -969,6 +1264,27 @@ void GHepRecord::Copy(const GHepRecord & record)
   fXSec         = record.fXSec;
   fDiffXSec     = record.fDiffXSec;
   fDiffXSecPhSp = record.fDiffXSecPhSp;
+
+  // copy the random number checkpoint
+  fRndmSeed     = record.fRndmSeed;
+  fRndmRun      = record.fRndmRun;
+  fRndmEvent    = record.fRndmEvent;
+
+  fFilteredOut  = record.fFilteredOut;
+
+  // copy the generation info, if any
+  if(record.fGenInfo) {
+    if(!fGenInfo) fGenInfo = new GHepGenInfo;
+    fGenInfo->Copy(*record.fGenInfo);
+  } else if(fGenInfo) {
+    fGenInfo->Reset();
+  }
+}
+//___________________________________________________________________________
+GHepGenInfo * GHepRecord::GenInfo(void) const
+{
+  if(!fGenInfo && GHepGenInfo::IsEnabled()) fGenInfo = new GHepGenInfo;
+  return fGenInfo;
 }
 //___________________________________________________________________________
 void GHepRecord::SetUnphysEventMask(const TBits & mask)
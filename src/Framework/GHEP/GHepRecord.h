@@ -40,6 +40,9 @@ namespace genie {
 
 class GHepRecord;
 class GHepParticle;
+class GHepParticleView;
+class GHepRecordIndex;
+class GHepGenInfo;
 
 ostream & operator << (ostream & stream, const GHepRecord & event);
 
@@ -60,6 +63,10 @@ public :
   virtual Interaction * Summary       (void) const;
   virtual void          AttachSummary (Interaction * interaction);
 
+  // Hand over (the caller adopts it) the summary detached by ResetRecord(),
+  // so that its buffers can be re-used for the next interaction (or 0)
+  virtual Interaction * ReleaseSpareSummary (void);
+
   // Provide a simplified wrapper of the 'new with placement'
   // TClonesArray object insertion method
   // ALWAYS use these methods to insert new particles as they check
@@ -76,11 +83,20 @@ public :
                            double px, double py, double pz, double E,
                                     double x, double y, double z, double t);
 
-  // Methods to search the GHEP record
+  // Methods to search the GHEP record.
+  // The positions of each pdg code are kept in an index, built on the first
+  // search by pdg code and updated with every AddParticle(). It is rebuilt
+  // after any re-arrangement of the record or pdg code change of one of its
+  // particles (the status is checked at each search). The role positions
+  // (probe, hit nucleon,...) are fixed slots and are checked directly.
 
   virtual GHepParticle * Particle     (int position) const;
   virtual GHepParticle * FindParticle (int pdg, GHepStatus_t ist, int start) const;
 
+  // A read-only, zero-copy view of all the particles, for converting the
+  // record to other formats (see GHepParticleView)
+  GHepParticleView Particles (void) const;
+
   virtual int ParticlePosition (int pdg, GHepStatus_t i, int start=0) const;
   virtual int ParticlePosition (GHepParticle * particle, int start=0) const;
 
@@ -120,6 +136,17 @@ public :
   virtual bool    IsUnphysical (void) const { return (fEventFlags->CountBits()>0); }
   virtual bool    Accept       (void) const;
 
+  // Set/ask whether the event was rejected by the event filter (see
+  // EventFilterI) and was only partially generated
+
+  virtual bool    FilteredOut    (void) const { return fFilteredOut; }
+  virtual void    SetFilteredOut (bool on)    { fFilteredOut = on;   }
+
+  // Intermediate generation quantities kept for the reweighting tools
+  // (null unless their collection is enabled, see GHepGenInfo)
+
+  virtual GHepGenInfo * GenInfo (void) const;
+
   // Methods to set/get the event weight and cross sections
 
   virtual double Weight         (void) const  { return fWeight;   }
@@ -136,6 +163,17 @@ public :
     fDiffXSec = (xsec>0) ? xsec : 0.; 
   }
 
+  // Set/get the random number checkpoint of the event: the (seed, run,
+  // event index) keying the counter-based random number streams it was
+  // generated with (-1 if it was not generated with counter-based streams)
+
+  virtual Long64_t RndmSeed  (void) const { return fRndmSeed;  }
+  virtual Long64_t RndmRun   (void) const { return fRndmRun;   }
+  virtual Long64_t RndmEvent (void) const { return fRndmEvent; }
+
+  virtual void SetRndmCheckpoint (Long64_t seed, Long64_t run, Long64_t ievent)
+  { fRndmSeed = seed; fRndmRun = run; fRndmEvent = ievent; }
+
   // Set/get event vertex in detector coordinate system
 
   virtual TLorentzVector * Vertex (void) const { return fVtx; }
@@ -146,11 +184,36 @@ public :
   // Common event record operations
 
   virtual void Copy        (const GHepRecord & record);
+  virtual void CopyHeader  (const GHepRecord & record);
   virtual void Clear       (Option_t * opt="");
   virtual void ResetRecord (void);
   virtual void CompactifyDaughterLists     (void);
   virtual void RemoveIntermediateParticles (void);
 
+  // Overloaded TClonesArray methods (invalidating the search index)
+
+  virtual TObject * RemoveAt (Int_t idx);
+  virtual void      Compress (void);
+
+  // Raw entry updates, with no daughter-list checks, used to rebuild a
+  // record from the GHepRecordHistory journal: overwrite (or append, at
+  // pos = GetEntries()) the entry at the input position / drop the entries
+  // from the input position on
+
+  virtual void SetParticle (int pos, const GHepParticle & p);
+  virtual void Truncate    (int nentries);
+
+  // Daughter-list maintenance modes (see UpdateDaughterLists()).
+  // In the deferred mode an insertion breaking the compactness of a
+  // daughter-list only marks the record and the caller runs
+  // CompactifyDaughterLists() once, after a batch of insertions.
+  // In the append-only mode the caller guarantees that the daughters of
+  // each mother are added in consecutive slots and no checks are made.
+
+  virtual void SetDeferredCompactification (bool on) { fDeferCompactify = on; }
+  virtual void SetAppendOnlyInsertion      (bool on) { fAppendOnly      = on; }
+  virtual bool NeedsCompactification       (void) const { return fNeedCompactify; }
+
   // Set mask
   void SetUnphysEventMask(const TBits & mask);
 
@@ -182,10 +245,43 @@ protected:
   double           fDiffXSec;       ///< differential cross section for selected event kinematics
   KinePhaseSpace_t fDiffXSecPhSp;   ///< specifies which differential cross-section (dsig/dQ2, dsig/dQ2dW, dsig/dxdy,...)
 
+  // Summary detached by ResetRecord(), kept for re-use
+  Interaction * fSpareSummary; //! spare summary
+
+  // Random number checkpoint (stored in the ntuple header, see NtpMCRecHeader)
+  Long64_t fRndmSeed;  //! seed
+  Long64_t fRndmRun;   //! run number
+  Long64_t fRndmEvent; //! event index
+
+  // Daughter-list maintenance state
+  bool fDeferCompactify; //! defer compactification?
+  bool fAppendOnly;      //! daughters added in consecutive slots?
+  bool fNeedCompactify;  //! is there a pending (deferred) compactification?
+
+  // Rejected by the event filter?
+  bool fFilteredOut; //! filtered out
+
+  // Intermediate generation quantities (allocated on first use, if enabled)
+  mutable GHepGenInfo * fGenInfo; //! generation info
+
+  // Search index (reset when the record is read back, see LinkDef.h)
+  mutable GHepRecordIndex * fIndex;        //! search index
+  mutable unsigned long     fIndexVersion; //! fIdVersion when last validated, 0 if stale
+  mutable unsigned long     fIdVersion;    //! bumped by the pdg code changes of the indexed particles
+
   // Utility methods
   void InitRecord  (void);
   void CleanRecord (void);
 
+  // Get the (possibly re-used) particle object at the input slot
+  GHepParticle * ParticleSlot (int pos);
+
+  // Search index maintenance
+  const GHepRecordIndex * Index        (void) const;
+  bool              IndexIsCurrent     (void) const;
+  void              IndexParticle      (int pos) const;
+  void              InvalidateIndex    (void) const { fIndexVersion = 0; }
+
   // Methods used by the daughter list compactifier
   virtual void UpdateDaughterLists    (void);
   virtual bool HasCompactDaughterList (int pos);
@@ -10,6 +10,12 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The processing steps are kept as a journal of the entries they appended
+   or modified, rather than as full copies of the record, and the record
+   after a step is rebuilt on demand (see Restore()). The copies are re-used
+   from one event to the next. Fixed PurgeRecentHistory() erasing entries
+   of the map it was iterating over.
 
 */
 //____________________________________________________________________________
@@ -18,6 +24,7 @@
 
 #include "Framework/GHEP/GHepRecordHistory.h"
 #include "Framework/GHEP/GHepRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/PrintUtils.h"
 
@@ -35,27 +42,53 @@ namespace genie {
  }
 }
 //___________________________________________________________________________
+GHepRecordStep::GHepRecordStep() :
+step(0),
+nentries(0),
+nchanged(0),
+header(new GHepRecord)
+{
+
+}
+//___________________________________________________________________________
+GHepRecordStep::~GHepRecordStep()
+{
+  for(unsigned int i = 0; i < particles.size(); i++) delete particles[i];
+  delete header;
+}
+//___________________________________________________________________________
 GHepRecordHistory::GHepRecordHistory() :
-map<int, GHepRecord*>()
+fBootstrap(0),
+fHasBootstrap(false),
+fCurrent(0),
+fNSteps(0)
 {
   this->ReadFlags();
 }
 //___________________________________________________________________________
 GHepRecordHistory::GHepRecordHistory(const GHepRecordHistory & history) :
-map<int, GHepRecord*>()
+fBootstrap(0),
+fHasBootstrap(false),
+fCurrent(0),
+fNSteps(0)
 {
-  this->Copy(history);
   this->ReadFlags();
+  this->Copy(history);
 }
 //___________________________________________________________________________
 GHepRecordHistory::~GHepRecordHistory()
 {
-  this->PurgeHistory();
+  for(unsigned int i = 0; i < fSteps.size(); i++) delete fSteps[i];
+  if(fBootstrap) delete fBootstrap;
+  if(fCurrent)   delete fCurrent;
 }
 //___________________________________________________________________________
 void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
 {
-// Adds a GHepRecord 'snapshot' at the history buffer
+// Adds a GHepRecord 'snapshot' at the history buffer.
+// The bootstrap record is copied (into a re-used record). For the next
+// steps, the record is compared with the one after the previous step and
+// only the entries that the step appended or modified are kept
 
   bool go_on = (fEnabledFull || (fEnabledBootstrapStep && step==-1));
   if(!go_on) return;
@@ -66,42 +99,112 @@ void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
     return;
   }
 
-  if( this->count(step) == 0 ) {
-
-     LOG("GHEP", pNOTICE)
-                     << "Adding GHEP snapshot for processing step: " << step;
-
-     GHepRecord * snapshot = new GHepRecord(*record);
-     this->insert( map<int, GHepRecord*>::value_type(step,snapshot));
-
-  } else {
+  if( this->HasSnapshot(step) ) {
      // If you have already stepped back and reprocessing, then you should
      // have purged the 'recent' history (corresponing to 'after the return
      // processing step')
      LOG("GHEP", pWARN)
       << "GHEP snapshot for processing step: " << step << " already exists!";
+     return;
+  }
+
+  LOG("GHEP", pNOTICE)
+                   << "Adding GHEP snapshot for processing step: " << step;
+
+  if(step == -1) {
+     if(!fBootstrap) fBootstrap = new GHepRecord;
+     fBootstrap->Copy(*record);
+     fHasBootstrap = true;
+     if(fEnabledFull) {
+       if(!fCurrent) fCurrent = new GHepRecord;
+       fCurrent->Copy(*record);
+     }
+     return;
+  }
+
+  if(!fHasBootstrap) {
+     LOG("GHEP", pWARN)
+      << "No bootstrap GHEP snapshot: the snapshot for processing step "
+      << step << " can not be journaled";
+     return;
+  }
+
+  GHepRecordStep * entry = this->NewStep();
+  entry->step     = step;
+  entry->nentries = record->GetEntries();
+  entry->nchanged = 0;
+
+  int nprev = fCurrent->GetEntries();
+  for(int i = 0; i < entry->nentries; i++) {
+     GHepParticle * p = record->Particle(i);
+     if(!p) continue;
+     if(i < nprev && fCurrent->Particle(i)->IsIdentical(*p)) continue;
+
+     if(entry->nchanged == entry->particles.size()) {
+       entry->positions.push_back(i);
+       entry->particles.push_back(new GHepParticle(*p));
+     } else {
+       entry->positions[entry->nchanged] = i;
+       entry->particles[entry->nchanged]->Copy(*p);
+     }
+     entry->nchanged++;
+
+     fCurrent->SetParticle(i, *p);
   }
+  fCurrent->Truncate(entry->nentries);
+
+  entry->header->CopyHeader(*record);
+  fCurrent->CopyHeader(*record);
 }
 //___________________________________________________________________________
-void GHepRecordHistory::PurgeHistory(void)
+GHepRecordStep * GHepRecordHistory::NewStep(void)
 {
-  LOG("GHEP", pNOTICE) << "Purging GHEP history buffer";
+  if(fNSteps == fSteps.size()) fSteps.push_back(new GHepRecordStep);
+  return fSteps[fNSteps++];
+}
+//___________________________________________________________________________
+bool GHepRecordHistory::HasSnapshot(int step) const
+{
+  if(step == -1) return fHasBootstrap;
+
+  for(unsigned int i = 0; i < fNSteps; i++) {
+    if(fSteps[i]->step == step) return true;
+  }
+  return false;
+}
+//___________________________________________________________________________
+bool GHepRecordHistory::Restore(int step, GHepRecord * record) const
+{
+// Rebuilds the record after the input step: the bootstrap record updated
+// with the changes of all steps up to the input one
+
+  if(!record || !this->HasSnapshot(step)) return false;
 
-  GHepRecordHistory::iterator history_iter;
-  for(history_iter = this->begin();
-                              history_iter != this->end(); ++history_iter) {
+  LOG("GHEP", pNOTICE)
+     << "Restoring the GHEP record after processing step: " << step;
 
-    int step = history_iter->first;
-    LOG("GHEP", pINFO) 
-                  << "Deleting GHEP snapshot for processing step: " << step;
+  record->Copy(*fBootstrap);
 
-    GHepRecord * record = history_iter->second;
-    if(record) {
-      delete record;
-      record = 0;
+  for(unsigned int i = 0; i < fNSteps; i++) {
+    const GHepRecordStep * entry = fSteps[i];
+    if(entry->step > step) break;
+    for(unsigned int j = 0; j < entry->nchanged; j++) {
+      record->SetParticle(entry->positions[j], *entry->particles[j]);
     }
+    record->Truncate(entry->nentries);
+    record->CopyHeader(*entry->header);
   }
-  this->clear();
+  return true;
+}
+//___________________________________________________________________________
+void GHepRecordHistory::PurgeHistory(void)
+{
+// The copies are kept, to be re-used for the next event
+
+  LOG("GHEP", pNOTICE) << "Purging GHEP history buffer";
+
+  fHasBootstrap = false;
+  fNSteps       = 0;
 }
 //___________________________________________________________________________
 void GHepRecordHistory::PurgeRecentHistory(int start_step)
@@ -127,54 +230,54 @@ void GHepRecordHistory::PurgeRecentHistory(int start_step)
     return;
   }
 
-  GHepRecordHistory::iterator history_iter;
-  for(history_iter = this->begin();
-                              history_iter != this->end(); ++history_iter) {
+  unsigned int nkeep = 0;
+  while(nkeep < fNSteps && fSteps[nkeep]->step < start_step) nkeep++;
+  if(nkeep == fNSteps) return;
 
-    if(history_iter->first >= start_step) { 
-       int step = history_iter->first;
-       LOG("GHEP", pINFO) 
-                  << "Deleting GHEP snapshot for processing step: " << step;
-       this->erase(history_iter); 
-    }
-  }
+  LOG("GHEP", pINFO)
+     << "Deleting GHEP snapshots for processing steps: "
+     << fSteps[nkeep]->step << " - " << fSteps[fNSteps-1]->step;
+  fNSteps = nkeep;
+
+  // the next step is compared with the record after the last kept one
+  int last = (nkeep > 0) ? fSteps[nkeep-1]->step : -1;
+  if(fCurrent) this->Restore(last, fCurrent);
 }
 //___________________________________________________________________________
 void GHepRecordHistory::Copy(const GHepRecordHistory & history)
 {
   this->PurgeHistory();
 
-  GHepRecordHistory::const_iterator history_iter;
-  for(history_iter = history.begin();
-                           history_iter != history.end(); ++history_iter) {
-
-    unsigned int step   = history_iter->first;
-    GHepRecord * record = history_iter->second;
-
-    this->AddSnapshot(step, record);
+  if(!history.fHasBootstrap) return;
+
+  // re-journal the input history, step by step
+  bool full = fEnabledFull;
+  fEnabledFull = true;
+  GHepRecord record;
+  history.Restore(-1, &record);
+  this->AddSnapshot(-1, &record);
+  for(unsigned int i = 0; i < history.fNSteps; i++) {
+    int step = history.fSteps[i]->step;
+    history.Restore(step, &record);
+    this->AddSnapshot(step, &record);
   }
+  fEnabledFull = full;
 }
 //___________________________________________________________________________
 void GHepRecordHistory::Print(ostream & stream) const
 {
+  unsigned int depth = (fHasBootstrap) ? fNSteps + 1 : 0;
   stream << "\n ****** Printing GHEP record history"
-                              << " [depth: " << this->size() << "]" << endl;
+                              << " [depth: " << depth << "]" << endl;
 
-  GHepRecordHistory::const_iterator history_iter;
-  for(history_iter = this->begin();
-                              history_iter != this->end(); ++history_iter) {
-
-    unsigned int step   = history_iter->first;
-    GHepRecord * record = history_iter->second;
+  if(!fHasBootstrap) return;
 
+  GHepRecord record;
+  for(int i = -1; i < (int) fNSteps; i++) {
+    int step = (i < 0) ? -1 : fSteps[i]->step;
     stream << "\n[After processing step = " << step << "] :";
-
-    if(!record) {
-      stream
-         << "** ERR: No history record available for this processing step!";
-    } else {
-      stream << *record;
-    }
+    this->Restore(step, &record);
+    stream << record;
   }
 }
 //___________________________________________________________________________
@@ -3,12 +3,19 @@
 
 \class    genie::GHepRecordHistory
 
-\brief    Holds the history of the GHEP event record as it being modified by 
+\brief    Holds the history of the GHEP event record as it being modified by
           the processing steps of an event generation thread.
           The event record history can be used to step back in the generation
           sequence if a processing step is to be re-run (this the GENIE event
           generation framework equivalent of an 'Undo')
 
+          Only the record that bootstrapped the generation cycle (step -1) is
+          copied in full. Each processing step is kept as a journal entry,
+          holding the particle entries it appended or modified, the number of
+          entries it left and the rest of the record (summary, vertex, flags,
+          weights). The record after any step is rebuilt on demand, see
+          Restore(). The copies are re-used from one event to the next.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -23,11 +30,11 @@
 #ifndef _GHEP_RECORD_HISTORY_H_
 #define _GHEP_RECORD_HISTORY_H_
 
-#include <map>
+#include <vector>
 #include <string>
 #include <ostream>
 
-using std::map;
+using std::vector;
 using std::string;
 using std::ostream;
 
@@ -35,10 +42,25 @@ namespace genie {
 
 class GHepRecordHistory;
 class GHepRecord;
+class GHepParticle;
 
 ostream & operator << (ostream & stream, const GHepRecordHistory & history);
 
-class GHepRecordHistory : public map<int, GHepRecord*> {
+//! The changes made to the event record by a processing step
+class GHepRecordStep {
+public :
+  GHepRecordStep();
+ ~GHepRecordStep();
+
+  int                    step;       ///< processing step
+  int                    nentries;   ///< number of entries after the step
+  unsigned int           nchanged;   ///< number of entries appended or modified
+  vector<int>            positions;  ///< (first nchanged) positions of these entries
+  vector<GHepParticle *> particles;  ///< (first nchanged) entries after the step
+  GHepRecord *           header;     ///< the rest of the record after the step (no entries)
+};
+
+class GHepRecordHistory {
 
 public :
 
@@ -51,6 +73,11 @@ public :
   void PurgeRecentHistory (int start_step);
   void ReadFlags          (void);
 
+  //! is there a snapshot of the record after the input step?
+  bool HasSnapshot (int step) const;
+  //! rewrites the input record as it was after the input step
+  bool Restore     (int step, GHepRecord * r) const;
+
   void Copy  (const GHepRecordHistory & history);
   void Print (ostream & stream) const;
 
@@ -58,8 +85,16 @@ public :
 
 private:
 
+  GHepRecordStep * NewStep (void);
+
   bool fEnabledFull;          ///< keep the full GHEP record history
   bool fEnabledBootstrapStep; ///< keep only the record that bootsrapped the generation cycle
+
+  GHepRecord *             fBootstrap;    //! record before the first step
+  bool                     fHasBootstrap; //! is fBootstrap set?
+  GHepRecord *             fCurrent;      //! record after the last journaled step
+  vector<GHepRecordStep *> fSteps;        //! journal (the first fNSteps are used)
+  unsigned int             fNSteps;       //! number of journaled steps
 };
 
 }      // genie namespace
@@ -9,7 +9,10 @@
 
 #pragma link C++ class genie::GHepParticle+;
 #pragma link C++ class genie::GHepRecord+;
+#pragma read sourceClass="genie::GHepRecord" targetClass="genie::GHepRecord" version="[1-]" source="" target="fIndexVersion" code="{ fIndexVersion = 0; }"
+#pragma link C++ class genie::GHepParticleView;
 #pragma link C++ class genie::GHepRecordHistory;
+#pragma link C++ class genie::GHepGenInfo;
 #pragma link C++ class genie::GHepVirtualList;
 #pragma link C++ class genie::GHepVirtualListFolder;
 
@@ -303,10 +303,9 @@ TLorentzVector * InitialState::GetTgtP4(RefFrame_t ref_frame) const
   return 0;
 }
 //___________________________________________________________________________
-TLorentzVector * InitialState::GetProbeP4(RefFrame_t ref_frame) const
+TLorentzVector InitialState::ProbeP4(RefFrame_t ref_frame) const
 {
-// Return the probe 4-momentum in the specified reference frame
-// Note: the caller adopts the TLorentzVector object
+// Return the probe 4-momentum in the specified reference frame, by value
 
   switch (ref_frame) {
 
@@ -317,8 +316,7 @@ TLorentzVector * InitialState::GetProbeP4(RefFrame_t ref_frame) const
              // and it is only the struck nucleons that can move:
              // so the [target rest frame] = [LAB frame]
 
-             TLorentzVector * p4 = new TLorentzVector(*fProbeP4);
-             return p4;
+             return *fProbeP4;
        }
 
        //------------------ STRUCK NUCLEON REST FRAME:
@@ -339,50 +337,53 @@ TLorentzVector * InitialState::GetProbeP4(RefFrame_t ref_frame) const
 
              // BOOST
 
-             TLorentzVector * p4 = new TLorentzVector(*fProbeP4);
+             TLorentzVector p4(*fProbeP4);
 
-             p4->Boost(-bx,-by,-bz);
+             p4.Boost(-bx,-by,-bz);
 
              return p4;
-
-             break;
        }
        //------------------ LAB:
        case (kRfLab) :
        {
-             TLorentzVector * p4 = new TLorentzVector(*fProbeP4);
-             return p4;
-
-             break;
+             return *fProbeP4;
        }
        default:
 
              LOG("Interaction", pERROR) << "Uknown reference frame";
   }
-  return 0;
+  return TLorentzVector(0,0,0,0);
+}
+//___________________________________________________________________________
+TLorentzVector * InitialState::GetProbeP4(RefFrame_t ref_frame) const
+{
+// Return the probe 4-momentum in the specified reference frame
+// Note: the caller adopts the TLorentzVector object
+
+  if (ref_frame != kRfTgtRest && ref_frame != kRfHitNucRest &&
+      ref_frame != kRfLab) {
+     LOG("Interaction", pERROR) << "Uknown reference frame";
+     return 0;
+  }
+  return new TLorentzVector(this->ProbeP4(ref_frame));
 }
 //___________________________________________________________________________
 double InitialState::ProbeE(RefFrame_t ref_frame) const
 {
-  TLorentzVector * p4 = this->GetProbeP4(ref_frame);
-  double E = p4->Energy();
+  if (ref_frame == kRfLab || ref_frame == kRfTgtRest) return fProbeP4->Energy();
 
-  delete p4;
-  return E;
+  return this->ProbeP4(ref_frame).Energy();
 }
 
 //___________________________________________________________________________
 double InitialState::CMEnergy() const
 {
-  TLorentzVector * k4 = this->GetProbeP4(kRfLab);
-  TLorentzVector * p4 = fTgt->HitNucP4Ptr();
-  
-  *k4 += *p4; // now k4 represents centre-of-mass 4-momentum
-  double s = k4->Dot(*k4); // dot-product with itself
+  TLorentzVector k4 = *fProbeP4;
+  k4 += *(fTgt->HitNucP4Ptr()); // now k4 represents centre-of-mass 4-momentum
+
+  double s = k4.Dot(k4); // dot-product with itself
   double E = TMath::Sqrt(s);
 
-  delete k4;
-  
   return E;
 }
 //___________________________________________________________________________
@@ -405,6 +406,25 @@ string InitialState::AsString(void) const
   return init_state.str();
 }
 //___________________________________________________________________________
+ULong64_t InitialState::Key(void) const
+{
+// Pack the initial state into a 64-bit integer key: The probe PDG code is
+// stored in the upper and the target PDG code in the lower 32 bits.
+// The key carries the same information as AsString() (used by the GENIE
+// drivers for keying objects per initial state) but it is much cheaper to
+// build and compare when looking up objects on an event-by-event basis.
+
+  return InitialState::Key(fTgt->Pdg(), fProbePdg);
+}
+//___________________________________________________________________________
+ULong64_t InitialState::Key(int tgt_pdgc, int probe_pdgc)
+{
+  ULong64_t probe = (UInt_t) probe_pdgc;
+  ULong64_t tgt   = (UInt_t) tgt_pdgc;
+
+  return (probe << 32) | tgt;
+}
+//___________________________________________________________________________
 void InitialState::Print(ostream & stream) const
 {
   stream << "[-] [Init-State] " << endl;
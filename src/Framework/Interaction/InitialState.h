@@ -67,7 +67,9 @@ public:
   const Target &   Tgt        (void) const { return *fTgt; }
   Target *         TgtPtr     (void) const { return  fTgt; }
   TLorentzVector * GetTgtP4   (RefFrame_t rf = kRfLab) const;
-  TLorentzVector * GetProbeP4 (RefFrame_t rf = kRfHitNucRest) const;
+  TLorentzVector * GetProbeP4 (RefFrame_t rf = kRfHitNucRest) const; ///< the caller adopts it
+  TLorentzVector   ProbeP4    (RefFrame_t rf) const;                 ///< by value: no allocation
+  const TLorentzVector & ProbeP4 (void) const { return *fProbeP4; } ///< in LAB-frame, not copied
   double           ProbeE     (RefFrame_t rf) const;
   double           CMEnergy   () const; ///< centre-of-mass energy (sqrt s)
 
@@ -92,6 +94,11 @@ public:
   string AsString (void) const;
   void   Print    (ostream & stream) const;
 
+  //-- Packed integer key (probe & target PDG codes), a cheap alternative
+  //   to AsString() for look-ups in the event loop
+  ULong64_t        Key (void) const;
+  static ULong64_t Key (int tgt_pdgc, int probe_pdgc);
+
   //-- Overloaded operators
   bool             operator == (const InitialState & i) const;             ///< equal?
   InitialState &   operator =  (const InitialState & i);                   ///< copy
@@ -29,6 +29,15 @@ using namespace genie::constants;
 using std::endl;
 using std::ostringstream;
 
+//____________________________________________________________________________
+namespace {
+  // mix a value into a 64-bit hash (boost::hash_combine with a 64-bit constant)
+  inline void HashCombine(ULong64_t & h, Long64_t v)
+  {
+    h ^= (ULong64_t) v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+  }
+}
+
 ClassImp(Interaction)
 
 //____________________________________________________________________________
@@ -68,7 +77,8 @@ fInitialState(0),
 fProcInfo(0),
 fKinematics(0), 
 fExclusiveTag(0), 
-fKinePhSp(0)
+fKinePhSp(0),
+fResolvedAlgs(0)
 {
 
 }
@@ -91,6 +101,7 @@ void Interaction::Init(void)
   fKinematics   = new Kinematics   ();
   fExclusiveTag = new XclsTag      ();
   fKinePhSp     = new KPhaseSpace  (this);
+  fResolvedAlgs = 0;
 }
 //___________________________________________________________________________
 void Interaction::CleanUp(void)
@@ -119,6 +130,8 @@ void Interaction::Copy(const Interaction & interaction)
   fProcInfo     -> Copy (proc);
   fKinematics   -> Copy (kine);
   fExclusiveTag -> Copy (xcls);
+
+  fResolvedAlgs = interaction.fResolvedAlgs;
 }
 //___________________________________________________________________________
 TParticlePDG * Interaction::FSPrimLepton(void) const
@@ -273,6 +286,39 @@ string Interaction::AsString(void) const
   return interaction.str();
 }
 //___________________________________________________________________________
+ULong64_t Interaction::Key(void) const
+{
+// Build a 64-bit key from all the information codified by AsString(): 
+// initial state, hit nucleon / quark, process info and exclusive tag.
+// Unlike AsString() no string is built, so the key is cheap enough to be 
+// used for per-event look-ups. Distinct interactions yield distinct keys
+// unless there is a (very unlikely) hash collision, so containers keyed on
+// it should detect collisions when being built.
+
+  const Target &  tgt  = fInitialState->Tgt();
+  const XclsTag & xcls = *fExclusiveTag;
+
+  ULong64_t h = fInitialState->Key();
+
+  HashCombine(h, tgt.HitNucIsSet() ? tgt.HitNucPdg() : 0);
+  HashCombine(h, tgt.HitQrkIsSet() ? tgt.HitQrkPdg() : 0);
+  HashCombine(h, tgt.HitQrkIsSet() && tgt.HitSeaQrk() ? 1 : 0);
+  HashCombine(h, (int) fProcInfo->InteractionTypeId());
+  HashCombine(h, (int) fProcInfo->ScatteringTypeId());
+
+  HashCombine(h, xcls.IsCharmEvent()   ? 1+xcls.CharmHadronPdg()   : 0);
+  HashCombine(h, xcls.IsStrangeEvent() ? 1+xcls.StrangeHadronPdg() : 0);
+  HashCombine(h, xcls.NProtons());
+  HashCombine(h, xcls.NNeutrons());
+  HashCombine(h, xcls.NPiPlus());
+  HashCombine(h, xcls.NPiMinus());
+  HashCombine(h, xcls.NPi0());
+  HashCombine(h, (int) xcls.Resonance());
+  HashCombine(h, xcls.DecayMode());
+
+  return h;
+}
+//___________________________________________________________________________
 void Interaction::Print(ostream & stream) const
 {
   const string line(110, '-');
@@ -44,6 +44,8 @@ class TRootIOCtor;
 
 namespace genie {
 
+class ResolvedAlgs;
+
 const UInt_t kISkipProcessChk      = 1<<17; ///< if set, skip process validity checks
 const UInt_t kISkipKinematicChk    = 1<<16; ///< if set, skip kinematic validity checks
 const UInt_t kIAssumeFreeNucleon   = 1<<15; ///<
@@ -77,6 +79,11 @@ public:
   XclsTag *            ExclTagPtr    (void) const { return fExclusiveTag;  }
   KPhaseSpace *        PhaseSpacePtr (void) const { return fKinePhSp;      }
 
+  // Algorithms resolved once for the channel (see ResolvedAlgs), copied with
+  // the interaction; null if none were resolved
+  const ResolvedAlgs * ResolvedAlgsPtr (void) const { return fResolvedAlgs; }
+  void                 SetResolvedAlgs (const ResolvedAlgs * algs) { fResolvedAlgs = algs; }
+
   // Methods to set interaction's properties
   void SetInitState (const InitialState & init);
   void SetProcInfo  (const ProcessInfo &  proc);
@@ -96,6 +103,9 @@ public:
   string AsString (void) const;
   void   Print    (ostream & stream) const;
 
+  // Hashed integer key built from the same information as AsString()
+  ULong64_t Key   (void) const;
+
   // Overloaded operators
   Interaction &    operator =  (const Interaction & i);                   ///< copy
   friend ostream & operator << (ostream & stream, const Interaction & i); ///< print
@@ -175,6 +185,8 @@ private:
   Kinematics *   fKinematics;    ///< kinematical variables
   XclsTag *      fExclusiveTag;  ///< Additional info for exclusive channels
   KPhaseSpace *  fKinePhSp;      ///< Kinematic phase space
+
+  const ResolvedAlgs * fResolvedAlgs; //! algorithms resolved for the channel (not owned)
   
 ClassDef(Interaction,2)
 };
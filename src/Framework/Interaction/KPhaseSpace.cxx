@@ -36,15 +36,26 @@ using namespace genie::constants;
 
 ClassImp(KPhaseSpace)
 
+namespace {
+  // bits of KPhaseSpace::fCached
+  const unsigned int kCachedEthr  = 1<<0;
+  const unsigned int kCachedWLim  = 1<<1;
+  const unsigned int kCachedQ2Lim = 1<<2;
+  const unsigned int kCachedXLim  = 1<<3;
+  const unsigned int kCachedYLim  = 1<<4;
+  const unsigned int kCachedQ2LimW= 1<<5;
+  const int          kNCacheCodes = 11;
+}
+
 //____________________________________________________________________________
 KPhaseSpace::KPhaseSpace(void) :
-TObject(), fInteraction(NULL)
+TObject(), fInteraction(NULL), fCacheValid(false)
 {
   this->UseInteraction(0);
 }
 //___________________________________________________________________________
 KPhaseSpace::KPhaseSpace(const Interaction * in) :
-TObject(), fInteraction(NULL)
+TObject(), fInteraction(NULL), fCacheValid(false)
 {
   this->UseInteraction(in);
 }
@@ -56,17 +67,12 @@ KPhaseSpace::~KPhaseSpace(void)
 //___________________________________________________________________________
 double KPhaseSpace::GetTMaxDFR()
 {
-  static bool tMaxLoaded = false;
-  static double DFR_tMax = -1;
-
-  if (!tMaxLoaded)
-  {
+  // read once, by the first thread calling
+  static const double DFR_tMax = [] {
     AlgConfigPool * confp = AlgConfigPool::Instance();
     const Registry * r = confp->CommonParameterList( "Diffractive" ) ;
-    double tmax = r->GetDouble("DFR-t-max");
-    DFR_tMax = tmax;
-    tMaxLoaded = true;
-  }
+    return r->GetDouble("DFR-t-max");
+  }();
 
   return DFR_tMax;
 
@@ -75,24 +81,78 @@ double KPhaseSpace::GetTMaxDFR()
 void KPhaseSpace::UseInteraction(const Interaction * in) 
 {
   fInteraction = in;
+  fCacheValid  = false;
+}
+//___________________________________________________________________________
+void KPhaseSpace::UpdateCache(void) const
+{
+// Compares the probe and hit nucleon 4-momenta and the codes of the particles
+// and process the limits depend on with these the cached values were computed
+// for; if any changed, the cache is dropped and its inputs recomputed
+
+  const InitialState & init_state = fInteraction->InitState();
+  const Target &       tgt        = init_state.Tgt();
+  const ProcessInfo &  pi         = fInteraction->ProcInfo();
+  const XclsTag &      xcls       = fInteraction->ExclTag();
+
+  const TLorentzVector & k4 = init_state.ProbeP4();
+  const TLorentzVector & p4 = *tgt.HitNucP4Ptr();
+
+  double P4[8] = { k4.Px(), k4.Py(), k4.Pz(), k4.E(),
+                   p4.Px(), p4.Py(), p4.Pz(), p4.E() };
+  int codes[kNCacheCodes] = {
+     init_state.ProbePdg(), tgt.Pdg(), tgt.HitNucPdg(),
+     pi.ScatteringTypeId(), pi.InteractionTypeId(),
+     xcls.IsCharmEvent(),   xcls.CharmHadronPdg(),
+     xcls.IsStrangeEvent(), xcls.StrangeHadronPdg(),
+     xcls.NProtons(),       xcls.NNeutrons() };
+
+  if(fCacheValid) {
+    bool same = true;
+    for(int i = 0; i < 8 && same; i++) same = (P4[i] == fCacheP4[i]);
+    for(int i = 0; i < kNCacheCodes && same; i++) same = (codes[i] == fCacheCodes[i]);
+    if(same) return;
+  }
+
+  for(int i = 0; i < 8; i++) fCacheP4[i] = P4[i];
+  for(int i = 0; i < kNCacheCodes; i++) fCacheCodes[i] = codes[i];
+
+  TParticlePDG * fsl = fInteraction->FSPrimLepton();
+
+  fEv         = init_state.ProbeE(kRfHitNucRest);
+  fEvL        = k4.E();
+  fM          = p4.M();
+  fMl         = (fsl) ? fsl->Mass() : 0.;
+  fCached     = 0;
+  fCacheValid = true;
 }
 //___________________________________________________________________________
 double KPhaseSpace::Threshold(void) const
+{
+  this->UpdateCache();
+  if(!(fCached & kCachedEthr)) {
+    fLimits.Ethr = this->ComputeThreshold();
+    fCached |= kCachedEthr;
+  }
+  return fLimits.Ethr;
+}
+//___________________________________________________________________________
+double KPhaseSpace::ComputeThreshold(void) const
 {
   const ProcessInfo &  pi         = fInteraction->ProcInfo();
   const InitialState & init_state = fInteraction->InitState();
   const XclsTag &      xcls       = fInteraction->ExclTag();
   const Target &       tgt        = init_state.Tgt();
 
-  double ml = fInteraction->FSPrimLepton()->Mass();
+  double ml = fMl;
 
   if (pi.IsSingleKaon()) {
     int kaon_pdgc = xcls.StrangeHadronPdg();
-    double Mi   = tgt.HitNucP4Ptr()->M(); // initial nucleon mass
+    double Mi   = fM; // initial nucleon mass
     // Final nucleon can be different for K0 interaction
     double Mf = (xcls.NProtons()==1) ? kProtonMass : kNeutronMass;  
-    double mk   = PDGLibrary::Instance()->Find(kaon_pdgc)->Mass();
-  //double ml   = PDGLibrary::Instance()->Find(fInteraction->FSPrimLeptonPdg())->Mass();
+    double mk   = PDGLibrary::Instance()->Mass(kaon_pdgc);
+  //double ml   = PDGLibrary::Instance()->Mass(fInteraction->FSPrimLeptonPdg());
     double mtot = ml + mk + Mf; // total mass of FS particles
     double Ethresh = (mtot*mtot - Mi*Mi)/(2. * Mf);
     return Ethresh;
@@ -101,7 +161,7 @@ double KPhaseSpace::Threshold(void) const
   if (pi.IsCoherent()) {
     int tgtpdgc = tgt.Pdg(); // nuclear target PDG code (10LZZZAAAI)
     double mpi  = pi.IsWeakCC() ? kPionMass : kPi0Mass;
-    double MA   = PDGLibrary::Instance()->Find(tgtpdgc)->Mass();
+    double MA   = PDGLibrary::Instance()->Mass(tgtpdgc);
     double m    = ml + mpi;
     double m2   = TMath::Power(m,2);
     double Ethr = m + 0.5*m2/MA;
@@ -117,7 +177,7 @@ double KPhaseSpace::Threshold(void) const
      pi.IsDiffractive()) 
   {
     assert(tgt.HitNucIsSet());
-    double Mn   = tgt.HitNucP4Ptr()->M();
+    double Mn   = fM;
     double Mn2  = TMath::Power(Mn,2);
     double Wmin = (pi.IsQuasiElastic() || pi.IsDarkMatterElastic() || pi.IsInverseBetaDecay()) ? 
                   kNucleonMass : kNucleonMass+kPionMass;
@@ -130,7 +190,7 @@ double KPhaseSpace::Threshold(void) const
           Wmin = kNucleonMass+kLightestChmHad;
        } else {
           int cpdg = xcls.CharmHadronPdg();
-          double mchm = PDGLibrary::Instance()->Find(cpdg)->Mass();
+          double mchm = PDGLibrary::Instance()->Mass(cpdg);
           if(pi.IsQuasiElastic() || pi.IsInverseBetaDecay()) { 
             Wmin = mchm + controls::kASmallNum; 
           } 
@@ -163,7 +223,7 @@ double KPhaseSpace::Threshold(void) const
   }
   if (pi.IsMEC()) {
     if (tgt.HitNucIsSet()) {
-        double Mn   = tgt.HitNucP4Ptr()->M();
+        double Mn   = fM;
         double Mn2  = TMath::Power(Mn,2);
         double Wmin = fInteraction->RecoilNucleon()->Mass(); // mass of the recoil nucleon cluster 
         double smin = TMath::Power(Wmin+ml,2.);
@@ -205,6 +265,22 @@ Range1D_t KPhaseSpace::Limits(KineVar_t kvar) const
   }
 }
 //____________________________________________________________________________
+const KPhaseSpaceLimits & KPhaseSpace::AllLimits(void) const
+{
+  // Computes (or retrieves from the cache) all the limits at once, from the
+  // same probe energy, hit nucleon and lepton masses
+  //
+  assert(fInteraction);
+
+  this->Threshold();
+  this->WLim();
+  this->Q2Lim();
+  this->XLim();
+  this->YLim();
+
+  return fLimits;
+}
+//____________________________________________________________________________
 double KPhaseSpace::Minimum(KineVar_t kvar) const
 {
   Range1D_t lim = this->Limits(kvar);
@@ -223,7 +299,6 @@ bool KPhaseSpace::IsAboveThreshold(void) const
   double Ethr = this->Threshold();
 
   const ProcessInfo &  pi         = fInteraction->ProcInfo();
-  const InitialState & init_state = fInteraction->InitState();
 
   if (pi.IsCoherent()       || 
       pi.IsInverseMuDecay() || 
@@ -231,7 +306,7 @@ bool KPhaseSpace::IsAboveThreshold(void) const
       pi.IsNuElectronElastic() ||
       pi.IsMEC()) 
   {
-      E = init_state.ProbeE(kRfLab);
+      E = fEvL;
   }
 
   if(pi.IsQuasiElastic()            || 
@@ -244,7 +319,7 @@ bool KPhaseSpace::IsAboveThreshold(void) const
      pi.IsSingleKaon()              ||
      pi.IsAMNuGamma())
   {
-      E = init_state.ProbeE(kRfHitNucRest);
+      E = fEv;
   }
 
   LOG("KPhaseSpace", pDEBUG) << "E = " << E << ", Ethr = " << Ethr; 
@@ -362,6 +437,16 @@ bool KPhaseSpace::IsAllowed(void) const
 }
 //___________________________________________________________________________
 Range1D_t KPhaseSpace::WLim(void) const
+{
+  this->UpdateCache();
+  if(!(fCached & kCachedWLim)) {
+    fLimits.W = this->ComputeWLim();
+    fCached |= kCachedWLim;
+  }
+  return fLimits.W;
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeWLim(void) const
 {
 // Computes hadronic invariant mass limits. 
 // For QEL the range reduces to the recoil nucleon mass. 
@@ -384,10 +469,9 @@ Range1D_t KPhaseSpace::WLim(void) const
     return Wl;
   }
   if(is_inel) {
-    const InitialState & init_state = fInteraction->InitState();
-    double Ev = init_state.ProbeE(kRfHitNucRest);
-    double M  = init_state.Tgt().HitNucP4Ptr()->M(); //can be off m/shell
-    double ml = fInteraction->FSPrimLepton()->Mass();
+    double Ev = fEv;
+    double M  = fM; //can be off m/shell
+    double ml = fMl;
     Wl = kinematics::InelWLim(Ev,M,ml);  
     if(fInteraction->ExclTag().IsCharmEvent()) {
       //Wl.min = TMath::Max(Wl.min, kNeutronMass+kPionMass+kLightestChmHad);
@@ -402,10 +486,9 @@ Range1D_t KPhaseSpace::WLim(void) const
     return Wl;
   }
   if(is_dmdis) {
-    const InitialState & init_state = fInteraction->InitState();
-    double Ev = init_state.ProbeE(kRfHitNucRest);
-    double M  = init_state.Tgt().HitNucP4Ptr()->M(); //can be off m/shell
-    double ml = fInteraction->FSPrimLepton()->Mass();
+    double Ev = fEv;
+    double M  = fM; //can be off m/shell
+    double ml = fMl;
     Wl = kinematics::DarkWLim(Ev,M,ml);  
     if(fInteraction->ExclTag().IsCharmEvent()) {
       //Wl.min = TMath::Max(Wl.min, kNeutronMass+kPionMass+kLightestChmHad);
@@ -452,15 +535,19 @@ Range1D_t KPhaseSpace::Q2Lim_W(void) const
     return Q2Lim();
   }
 
-  const InitialState & init_state = fInteraction->InitState();
-  double Ev  = init_state.ProbeE(kRfHitNucRest);
-  double M   = init_state.Tgt().HitNucP4Ptr()->M(); // can be off m/shell
-  double ml  = fInteraction->FSPrimLepton()->Mass();
+  this->UpdateCache();
+
+  double Ev  = fEv;
+  double M   = fM; // can be off m/shell
+  double ml  = fMl;
 
   double W = 0;
   if(is_qel || is_dme) W = fInteraction->RecoilNucleon()->Mass();
   else       W = kinematics::W(fInteraction);
 
+  // same W as at the last call?
+  if((fCached & kCachedQ2LimW) && W == fQ2LimW_W) return fQ2LimW;
+
   if (pi.IsInverseBetaDecay()) {
      Q2l = kinematics::InelQ2Lim_W(Ev,M,ml,W, controls::kMinQ2Limit_VLE);
   } else if (is_dme || is_dmdis) {
@@ -469,6 +556,10 @@ Range1D_t KPhaseSpace::Q2Lim_W(void) const
      Q2l = kinematics::InelQ2Lim_W(Ev,M,ml,W);
   }
 
+  fQ2LimW_W = W;
+  fQ2LimW   = Q2l;
+  fCached  |= kCachedQ2LimW;
+
   return Q2l;
 }
 //____________________________________________________________________________
@@ -484,6 +575,16 @@ Range1D_t KPhaseSpace::q2Lim_W(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::Q2Lim(void) const
+{
+  this->UpdateCache();
+  if(!(fCached & kCachedQ2Lim)) {
+    fLimits.Q2 = this->ComputeQ2Lim();
+    fCached |= kCachedQ2Lim;
+  }
+  return fLimits.Q2;
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeQ2Lim(void) const
 {
   // Computes momentum transfer (Q2>0) limits irrespective of the invariant mass
   // For QEL this is identical to Q2Lim_W (since W is fixed)
@@ -502,10 +603,9 @@ Range1D_t KPhaseSpace::Q2Lim(void) const
 
   if(!is_qel && !is_inel && !is_coh && !is_dme && !is_dmdis) return Q2l;
 
-  const InitialState & init_state = fInteraction->InitState();
-  double Ev  = init_state.ProbeE(kRfHitNucRest);
-  double M   = init_state.Tgt().HitNucP4Ptr()->M(); // can be off m/shell
-  double ml  = fInteraction->FSPrimLepton()->Mass();
+  double Ev  = fEv;
+  double M   = fM; // can be off m/shell
+  double ml  = fMl;
 
   if(is_coh) {
     bool pionIsCharged = pi.IsWeakCC();
@@ -521,10 +621,10 @@ Range1D_t KPhaseSpace::Q2Lim(void) const
     double W = fInteraction->RecoilNucleon()->Mass();
     if(xcls.IsCharmEvent()) { 
       int charm_pdgc = xcls.CharmHadronPdg();           
-      W = PDGLibrary::Instance()->Find(charm_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(charm_pdgc);
     }  else if(xcls.IsStrangeEvent()) { 
       int strange_pdgc = xcls.StrangeHadronPdg();           
-      W = PDGLibrary::Instance()->Find(strange_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(strange_pdgc);
     }
     if (pi.IsInverseBetaDecay()) {
       Q2l = kinematics::InelQ2Lim_W(Ev,M,ml,W,controls::kMinQ2Limit_VLE);
@@ -540,10 +640,10 @@ Range1D_t KPhaseSpace::Q2Lim(void) const
     double W = fInteraction->RecoilNucleon()->Mass();
     if(xcls.IsCharmEvent()) { 
       int charm_pdgc = xcls.CharmHadronPdg();           
-      W = PDGLibrary::Instance()->Find(charm_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(charm_pdgc);
     }  else if(xcls.IsStrangeEvent()) { 
       int strange_pdgc = xcls.StrangeHadronPdg();           
-      W = PDGLibrary::Instance()->Find(strange_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(strange_pdgc);
     }
     if (pi.IsInverseBetaDecay()) {
       Q2l = kinematics::DarkQ2Lim_W(Ev,M,ml,W,controls::kMinQ2Limit_VLE);
@@ -587,6 +687,16 @@ Range1D_t KPhaseSpace::q2Lim(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::XLim(void) const
+{
+  this->UpdateCache();
+  if(!(fCached & kCachedXLim)) {
+    fLimits.x = this->ComputeXLim();
+    fCached |= kCachedXLim;
+  }
+  return fLimits.x;
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeXLim(void) const
 {
   // Computes x-limits;
 
@@ -599,20 +709,18 @@ Range1D_t KPhaseSpace::XLim(void) const
   //RES+DIS
   bool is_inel = pi.IsDeepInelastic() || pi.IsResonant();
   if(is_inel) {
-    const InitialState & init_state  = fInteraction->InitState();
-    double Ev  = init_state.ProbeE(kRfHitNucRest);
-    double M   = init_state.Tgt().HitNucP4Ptr()->M(); // can be off m/shell
-    double ml  = fInteraction->FSPrimLepton()->Mass();
+    double Ev  = fEv;
+    double M   = fM; // can be off m/shell
+    double ml  = fMl;
     xl = kinematics::InelXLim(Ev,M,ml);
     return xl;
   }
   //DMDIS
   bool is_dmdis = pi.IsDarkMatterDeepInelastic();
   if(is_dmdis) {
-    const InitialState & init_state  = fInteraction->InitState();
-    double Ev  = init_state.ProbeE(kRfHitNucRest);
-    double M   = init_state.Tgt().HitNucP4Ptr()->M(); // can be off m/shell
-    double ml  = fInteraction->FSPrimLepton()->Mass();
+    double Ev  = fEv;
+    double M   = fM; // can be off m/shell
+    double ml  = fMl;
     xl = kinematics::DarkXLim(Ev,M,ml);
     return xl;
   }
@@ -640,6 +748,16 @@ Range1D_t KPhaseSpace::XLim(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::YLim(void) const
+{
+  this->UpdateCache();
+  if(!(fCached & kCachedYLim)) {
+    fLimits.y = this->ComputeYLim();
+    fCached |= kCachedYLim;
+  }
+  return fLimits.y;
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeYLim(void) const
 {
   Range1D_t yl;
   yl.min = -1;
@@ -650,37 +768,33 @@ Range1D_t KPhaseSpace::YLim(void) const
   //RES+DIS
   bool is_inel = pi.IsDeepInelastic() || pi.IsResonant();
   if(is_inel) {
-    const InitialState & init_state = fInteraction->InitState();
-    double Ev  = init_state.ProbeE(kRfHitNucRest);
-    double M   = init_state.Tgt().HitNucP4Ptr()->M(); // can be off m/shell
-    double ml  = fInteraction->FSPrimLepton()->Mass();
+    double Ev  = fEv;
+    double M   = fM; // can be off m/shell
+    double ml  = fMl;
     yl = kinematics::InelYLim(Ev,M,ml);
     return yl;
   }
   //DMDIS
   bool is_dmdis = pi.IsDarkMatterDeepInelastic();
   if(is_dmdis) {
-    const InitialState & init_state = fInteraction->InitState();
-    double Ev  = init_state.ProbeE(kRfHitNucRest);
-    double M   = init_state.Tgt().HitNucP4Ptr()->M(); // can be off m/shell
-    double ml  = fInteraction->FSPrimLepton()->Mass();
+    double Ev  = fEv;
+    double M   = fM; // can be off m/shell
+    double ml  = fMl;
     yl = kinematics::DarkYLim(Ev,M,ml);
     return yl;
   }
   //COH
   bool is_coh = pi.IsCoherent();
   if(is_coh) {  
-    const InitialState & init_state = fInteraction->InitState();
-    double EvL = init_state.ProbeE(kRfLab);
-    double ml  = fInteraction->FSPrimLepton()->Mass();
+    double EvL = fEvL;
+    double ml  = fMl;
     yl = kinematics::CohYLim(EvL,ml);
     return yl;
   }
   // IMD
   if(pi.IsInverseMuDecay() || pi.IsIMDAnnihilation() || pi.IsNuElectronElastic()) {
-    const InitialState & init_state = fInteraction->InitState();
-    double Ev = init_state.ProbeE(kRfLab);
-    double ml = fInteraction->FSPrimLepton()->Mass();
+    double Ev = fEvL;
+    double ml = fMl;
     double me = kElectronMass;
     yl.min = controls::kASmallNum;
     yl.max = 1 - (ml*ml + me*me)/(2*me*Ev) - controls::kASmallNum;
@@ -688,9 +802,8 @@ Range1D_t KPhaseSpace::YLim(void) const
   }
   bool is_dfr = pi.IsDiffractive();
   if(is_dfr) {
-    const InitialState & init_state = fInteraction -> InitState();
-    double Ev = init_state.ProbeE(kRfHitNucRest); 
-    double ml = fInteraction->FSPrimLepton()->Mass();
+    double Ev = fEv; 
+    double ml = fMl;
     yl.min = kPionMass/Ev + controls::kASmallNum;
     yl.max = 1. -ml/Ev - controls::kASmallNum;
     return yl;
@@ -706,15 +819,16 @@ Range1D_t KPhaseSpace::YLim_X(void) const
   yl.min = -1;
   yl.max = -1;
 
+  this->UpdateCache();
+
   const ProcessInfo & pi = fInteraction->ProcInfo();
 
   //RES+DIS
   bool is_inel = pi.IsDeepInelastic() || pi.IsResonant();
   if(is_inel) {
-    const InitialState & init_state = fInteraction->InitState();
-    double Ev  = init_state.ProbeE(kRfHitNucRest);
-    double M   = init_state.Tgt().HitNucP4Ptr()->M(); // can be off m/shell
-    double ml  = fInteraction->FSPrimLepton()->Mass();
+    double Ev  = fEv;
+    double M   = fM; // can be off m/shell
+    double ml  = fMl;
     double x   = fInteraction->Kine().x();
     yl = kinematics::InelYLim_X(Ev,M,ml,x);
     return yl;
@@ -722,10 +836,9 @@ Range1D_t KPhaseSpace::YLim_X(void) const
   //DMDIS
   bool is_dmdis = pi.IsDarkMatterDeepInelastic();
   if(is_dmdis) {
-    const InitialState & init_state = fInteraction->InitState();
-    double Ev  = init_state.ProbeE(kRfHitNucRest);
-    double M   = init_state.Tgt().HitNucP4Ptr()->M(); // can be off m/shell
-    double ml  = fInteraction->FSPrimLepton()->Mass();
+    double Ev  = fEv;
+    double M   = fM; // can be off m/shell
+    double ml  = fMl;
     double x   = fInteraction->Kine().x();
     yl = kinematics::DarkYLim_X(Ev,M,ml,x);
     return yl;
@@ -733,9 +846,8 @@ Range1D_t KPhaseSpace::YLim_X(void) const
   //COH
   bool is_coh = pi.IsCoherent();
   if(is_coh) {  
-    const InitialState & init_state = fInteraction->InitState();
-    double EvL = init_state.ProbeE(kRfLab);
-    double ml  = fInteraction->FSPrimLepton()->Mass();
+    double EvL = fEvL;
+    double ml  = fMl;
     yl = kinematics::CohYLim(EvL,ml);
     return yl;
   }
@@ -756,14 +868,15 @@ Range1D_t KPhaseSpace::YLim(double xsi) const
   //COH
   bool is_coh = pi.IsCoherent();
   if(is_coh) {  
+    this->UpdateCache();
     const InitialState & init_state = fInteraction->InitState();
     const Kinematics & kine = fInteraction->Kine();
-    double Ev = init_state.ProbeE(kRfHitNucRest);
+    double Ev = fEv;
     double Q2 = kine.Q2();
     bool pionIsCharged = pi.IsWeakCC();
     double Mn = init_state.Tgt().Mass();
     double mpi = pionIsCharged ? kPionMass : kPi0Mass;
-    double mlep = fInteraction->FSPrimLepton()->Mass();
+    double mlep = fMl;
     yl = kinematics::CohYLim(Mn, mpi, mlep, Ev, Q2, xsi);
     return yl;
   } else {
@@ -797,11 +910,13 @@ Range1D_t KPhaseSpace::TLim(void) const
   tl.min = -1;
   tl.max = -1;
 
+  this->UpdateCache();
+
   const InitialState & init_state = fInteraction->InitState();
   const ProcessInfo & pi = fInteraction->ProcInfo();
   const Kinematics & kine = fInteraction->Kine();
   kinematics::UpdateWQ2FromXY(fInteraction);
-  double Ev = init_state.ProbeE(kRfHitNucRest);
+  double Ev = fEv;
   double Q2 = kine.Q2();
   double nu = Ev * kine.y();
   bool pionIsCharged = pi.IsWeakCC();
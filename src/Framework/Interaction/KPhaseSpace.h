@@ -5,6 +5,13 @@
 
 \brief    Kinematical phase space 
 
+          The energy threshold and the kinematical limits which do not depend
+          on the running kinematics are cached, along with the probe energy,
+          hit nucleon mass and final state primary lepton mass they are
+          computed from. The cache is dropped when the probe or hit nucleon
+          4-momentum, or the process, changes. The Q2 limits at fixed W are
+          also kept for the last W.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -31,6 +38,17 @@ namespace genie {
 
 class Interaction;
 
+//! The energy threshold and the kinematical limits of an interaction,
+//! irrespective of any other kinematical variable (see KPhaseSpace::Limits());
+//! limits not relevant to its process are set to [-1,-1]
+struct KPhaseSpaceLimits {
+  double    Ethr;  ///< energy threshold
+  Range1D_t W;     ///< W  limits
+  Range1D_t Q2;    ///< Q2 limits
+  Range1D_t x;     ///< x  limits
+  Range1D_t y;     ///< y  limits
+};
+
 class KPhaseSpace : public TObject {
 
 public:
@@ -54,6 +72,9 @@ public:
   double     Minimum (KineVar_t kvar) const;
   double     Maximum (KineVar_t kvar) const;
 
+  //! Return the threshold and all the W, Q2, x, y limits at once
+  const KPhaseSpaceLimits & AllLimits (void) const;
+
   Range1D_t  WLim    (void) const;  ///< W  limits
   Range1D_t  Q2Lim_W (void) const;  ///< Q2 limits @ fixed W
   Range1D_t  q2Lim_W (void) const;  ///< q2 limits @ fixed W
@@ -71,8 +92,28 @@ public:
 private:
   void Init(void);
 
+  //! Drop the cached values if the interaction changed since they were computed
+  void      UpdateCache      (void) const;
+  double    ComputeThreshold (void) const;
+  Range1D_t ComputeWLim      (void) const;
+  Range1D_t ComputeQ2Lim     (void) const;
+  Range1D_t ComputeXLim      (void) const;
+  Range1D_t ComputeYLim      (void) const;
+
   const Interaction * fInteraction;
 
+  mutable bool              fCacheValid;     //! are the cached values valid?
+  mutable double            fCacheP4[8];     //! probe (LAB) & hit nucleon 4-momenta of the cache
+  mutable int               fCacheCodes[11]; //! particle & process codes of the cache
+  mutable unsigned int      fCached;         //! bit field of the cached limits
+  mutable double            fEv;             //! probe energy @ hit nucleon rest frame
+  mutable double            fEvL;            //! probe energy @ LAB
+  mutable double            fM;              //! hit nucleon mass (can be off m/shell)
+  mutable double            fMl;             //! final state primary lepton mass
+  mutable KPhaseSpaceLimits fLimits;         //! cached limits
+  mutable double            fQ2LimW_W;       //! W of the cached Q2 limits @ fixed W
+  mutable Range1D_t         fQ2LimW;         //! cached Q2 limits @ fixed W
+
 ClassDef(KPhaseSpace,2)
 };
 
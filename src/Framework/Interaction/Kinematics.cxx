@@ -14,6 +14,8 @@
    Adding special ctor for ROOT I/O purposes so as to avoid memory leak due to
    memory allocated in the default ctor when objects of this class are read by
    the ROOT Streamer.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Copy() re-uses the allocated kinematic variable map nodes.
 
 */
 //____________________________________________________________________________
@@ -92,15 +94,8 @@ void Kinematics::Reset(void)
 //____________________________________________________________________________
 void Kinematics::Copy(const Kinematics & kinematics)
 {
-  this->Reset();
-
-  map<KineVar_t, double>::const_iterator iter;
-
-  for(iter = kinematics.fKV.begin(); iter != kinematics.fKV.end(); ++iter) {
-    KineVar_t kv  = iter->first;
-    double    val = iter->second;
-    this->SetKV(kv,val);
-  }
+  // map assignment re-uses the already allocated nodes
+  fKV = kinematics.fKV;
 
   this->SetFSLeptonP4 (*kinematics.fP4Fsl);
   this->SetHadSystP4  (*kinematics.fP4HadSyst);
@@ -0,0 +1,152 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <chrono>
+
+#include "log4cpp/Priority.hh"
+
+#include "Framework/Messenger/AsyncAppender.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+AsyncAppender::AsyncAppender(
+      const string & name, ostream * stream, size_t capacity) :
+log4cpp::LayoutAppender(name),
+fStream        (stream),
+fCapacity      (2),
+fSlots         (0),
+fTail          (0),
+fHead          (0),
+fStop          (false),
+fNWriters      (0),
+fNDropped      (0),
+fNDroppedTotal (0)
+{
+  while(fCapacity < capacity) fCapacity *= 2;
+
+  fSlots = new Slot[fCapacity];
+  for(size_t i = 0; i < fCapacity; i++) {
+    fSlots[i].seq.store(i, std::memory_order_relaxed);
+  }
+  fThread = std::thread(&AsyncAppender::Drain, this);
+}
+//____________________________________________________________________________
+AsyncAppender::~AsyncAppender()
+{
+  this->close();
+  delete [] fSlots;
+}
+//____________________________________________________________________________
+void AsyncAppender::close(void)
+{
+  fStop.store(true);
+  if(fThread.joinable()) fThread.join();
+}
+//____________________________________________________________________________
+void AsyncAppender::_append(const log4cpp::LoggingEvent & event)
+{
+  string text = this->_getLayout().format(event);
+
+  fNWriters.fetch_add(1);
+  if(!fStop.load()) {
+    bool wait = (event.priority <= log4cpp::Priority::ERROR);
+    while(!this->Push(text)) {
+      if(!wait) {
+        fNDropped.fetch_add(1, std::memory_order_relaxed);
+        fNDroppedTotal.fetch_add(1, std::memory_order_relaxed);
+        break;
+      }
+      std::this_thread::yield();
+    }
+    fNWriters.fetch_sub(1);
+    return;
+  }
+  fNWriters.fetch_sub(1);
+
+  // closed: write directly
+  std::lock_guard<std::mutex> lock(fSyncLock);
+  (*fStream) << text;
+  fStream->flush();
+}
+//____________________________________________________________________________
+bool AsyncAppender::Push(string & text)
+{
+// Bounded multi-producer queue: each slot carries the ring position it is
+// free for (seq == pos) or full for (seq == pos+1)
+
+  size_t pos = fTail.load(std::memory_order_relaxed);
+  Slot * slot = 0;
+  while(true) {
+    slot = &fSlots[pos & (fCapacity-1)];
+    size_t seq = slot->seq.load(std::memory_order_acquire);
+    long diff = (long) seq - (long) pos;
+    if(diff == 0) {
+      if(fTail.compare_exchange_weak(pos, pos+1, std::memory_order_relaxed)) break;
+    }
+    else if(diff < 0) {
+      return false; // full
+    }
+    else {
+      pos = fTail.load(std::memory_order_relaxed);
+    }
+  }
+  slot->text.swap(text);
+  slot->seq.store(pos+1, std::memory_order_release);
+  return true;
+}
+//____________________________________________________________________________
+bool AsyncAppender::Pop(string & text)
+{
+  Slot * slot = &fSlots[fHead & (fCapacity-1)];
+  if(slot->seq.load(std::memory_order_acquire) != fHead+1) return false;
+
+  text.swap(slot->text);
+  slot->text.clear();
+  slot->seq.store(fHead + fCapacity, std::memory_order_release);
+  fHead++;
+  return true;
+}
+//____________________________________________________________________________
+void AsyncAppender::Drain(void)
+{
+  string text;
+  int nidle = 0;
+  while(true) {
+    if(this->Pop(text)) {
+      (*fStream) << text;
+      nidle = 0;
+      continue;
+    }
+    unsigned long ndropped = fNDropped.exchange(0, std::memory_order_relaxed);
+    if(ndropped > 0) {
+      (*fStream) << "[AsyncAppender] " << ndropped
+                 << " message(s) dropped (message buffer full)" << std::endl;
+    }
+    // quit only once all the messages pushed before close() are written
+    if(fStop.load() && fNWriters.load() == 0) {
+      if(!this->Pop(text)) break;
+      (*fStream) << text;
+      continue;
+    }
+    if(nidle == 0) fStream->flush();
+    if(nidle < 64) {
+      nidle++;
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  fStream->flush();
+}
+//____________________________________________________________________________
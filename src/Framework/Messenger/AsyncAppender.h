@@ -0,0 +1,91 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AsyncAppender
+
+\brief    A log4cpp appender that keeps message output off the calling thread.
+          Formatted messages are placed in a bounded, lock-free ring buffer
+          and are written to the output stream by a background thread.
+          If the buffer is full, messages less severe than ERROR are dropped
+          (and counted, the counts are reported in the output), whilst more
+          severe ones wait for space. After close(), messages are written
+          synchronously.
+          Enabled by setting the GMSGASYNC env. var (see Messenger).
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _ASYNC_APPENDER_H_
+#define _ASYNC_APPENDER_H_
+
+// ROOT5 has difficulty with parsing log4cpp headers
+#if !defined(__CINT__) && !defined(__MAKECINT__)
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "log4cpp/LayoutAppender.hh"
+#include "log4cpp/LoggingEvent.hh"
+
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class AsyncAppender : public log4cpp::LayoutAppender
+{
+public:
+  AsyncAppender(const string & name, ostream * stream, size_t capacity = 8192);
+  virtual ~AsyncAppender();
+
+  //! Write all the buffered messages and stop the background thread
+  virtual void close  (void);
+  virtual bool reopen (void) { return true; }
+
+  size_t        Capacity (void) const { return fCapacity; }
+  unsigned long NDropped (void) const { return fNDroppedTotal.load(); }
+
+protected:
+  virtual void _append (const log4cpp::LoggingEvent & event);
+
+private:
+  AsyncAppender(const AsyncAppender & appender);
+
+  struct Slot {
+    std::atomic<size_t> seq;  ///< slot sequence number (ring position it is free/full for)
+    string              text; ///< formatted message
+  };
+
+  bool Push  (string & text);
+  bool Pop   (string & text);
+  void Drain (void);
+
+  ostream *                  fStream;
+  size_t                     fCapacity;      ///< a power of 2
+  Slot *                     fSlots;
+  std::atomic<size_t>        fTail;          ///< next position to write (producers)
+  size_t                     fHead;          ///< next position to read (drain thread only)
+  std::atomic<bool>          fStop;
+  std::atomic<int>           fNWriters;      ///< producers currently pushing
+  std::atomic<unsigned long> fNDropped;      ///< dropped since last reported
+  std::atomic<unsigned long> fNDroppedTotal;
+  std::mutex                 fSyncLock;      ///< serializes writes after close()
+  std::thread                fThread;
+};
+
+}      // genie namespace
+
+#endif // !__CINT__ && !__MAKECINT__
+
+#endif // _ASYNC_APPENDER_H_
@@ -26,13 +26,20 @@
  @ Jan 31, 2013 - CA
    The $GMSGCONF var is no longer used. Instead, call 
    Messenger::SetPrioritiesFromXmlFile(string filename) explicitly.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added per message site rate limiting, with periodic reports of the number
+   of suppressed messages (see SetRateLimit() and the GMSGRATELIMIT env. var),
+   and an asynchronous appender (set the GMSGASYNC env. var).
 
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include <mutex>
+#include <chrono>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -41,6 +48,7 @@
 #include <TSystem.h>
 
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Messenger/AsyncAppender.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XmlParserUtils.h"
@@ -50,13 +58,39 @@ using std::setfill;
 using std::cout;
 using std::endl;
 using std::vector;
+using std::map;
+using std::pair;
 
 using namespace genie;
 
 bool genie::gAbortingInErr = false;
 
+//____________________________________________________________________________
+namespace {
+
+  std::mutex             gMesgRateLock;            // guards the limits & site list below
+  map<string, int>       gMesgRateLimits;          // stream -> rate limit
+  int                    gMesgDefaultRateLimit = 0;
+  vector<MessengerSite*> gMesgSuppressedSites;     // sites that suppressed messages
+  std::atomic<long long> gMesgRateInterval(10000); // msec
+  std::atomic<long long> gMesgNextReport(0);       // msec
+  AsyncAppender *        gMesgAsyncAppender = 0;
+
+  long long MesgClock(void)
+  {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+       std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  void MesgAtExit(void)
+  {
+    Messenger::Instance()->Flush();
+  }
+}
+
 //____________________________________________________________________________
 Messenger * Messenger::fInstance = 0;
+std::atomic<unsigned int> Messenger::fGeneration(1);
 //____________________________________________________________________________
 Messenger::Messenger()
 {
@@ -80,8 +114,17 @@ Messenger * Messenger::Instance()
 
     fInstance = new Messenger;
 
+    // GMSGASYNC: 1, or the message buffer capacity, to write asynchronously
     log4cpp::Appender * appender;
-    appender = new log4cpp::OstreamAppender("default", &cout);
+    const char* asyncenv = gSystem->Getenv("GMSGASYNC");
+    int asyncsize = (asyncenv) ? atoi(asyncenv) : 0;
+    if ( asyncsize > 0 ) {
+      gMesgAsyncAppender = new AsyncAppender(
+                     "default", &cout, (asyncsize > 1) ? asyncsize : 8192);
+      appender = gMesgAsyncAppender;
+    }
+    else
+      appender = new log4cpp::OstreamAppender("default", &cout);
     const char* layoutenv = gSystem->Getenv("GMSGLAYOUT");
     std::string layoutstr = (layoutenv) ? string(layoutenv) : "BASIC";
     if ( layoutstr == "SIMPLE" ) 
@@ -95,7 +138,19 @@ Messenger * Messenger::Instance()
     MSG.setAdditivity(false);
     MSG.addAppender(appender);
 
+    // GMSGRATELIMIT: default rate limit, as max[/interval in sec]
+    const char* rateenv = gSystem->Getenv("GMSGRATELIMIT");
+    if ( rateenv ) {
+      vector<string> rate = utils::str::Split(rateenv, "/");
+      if ( rate.size() > 0 ) fInstance->SetDefaultRateLimit(atoi(rate[0].c_str()));
+      if ( rate.size() > 1 ) fInstance->SetRateLimitInterval(atof(rate[1].c_str()));
+    }
+
     fInstance->Configure(); // set user-defined priority levels
+
+    // report suppressed messages & write out buffered ones before log4cpp is
+    // torn down
+    atexit(MesgAtExit);
   }
   return fInstance;
 }
@@ -113,6 +168,126 @@ void Messenger::SetPriorityLevel(
   log4cpp::Category & MSG = log4cpp::Category::getInstance(stream);
 
   MSG.setPriority(priority);
+
+  // the thresholds cached by the message sites must be looked-up again
+  fGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+//____________________________________________________________________________
+void Messenger::SetRateLimit(const char * stream, int max)
+{
+  std::lock_guard<std::mutex> lock(gMesgRateLock);
+  gMesgRateLimits[stream] = max;
+  fGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+//____________________________________________________________________________
+void Messenger::SetDefaultRateLimit(int max)
+{
+  std::lock_guard<std::mutex> lock(gMesgRateLock);
+  gMesgDefaultRateLimit = max;
+  fGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+//____________________________________________________________________________
+void Messenger::SetRateLimitInterval(double seconds)
+{
+  if(seconds <= 0) return;
+  gMesgRateInterval.store((long long) (1000*seconds));
+}
+//____________________________________________________________________________
+int Messenger::RateLimit(const char * stream) const
+{
+  std::lock_guard<std::mutex> lock(gMesgRateLock);
+  map<string, int>::const_iterator it = gMesgRateLimits.find(stream);
+  if(it != gMesgRateLimits.end()) return it->second;
+  return gMesgDefaultRateLimit;
+}
+//____________________________________________________________________________
+double Messenger::RateLimitInterval(void) const
+{
+  return gMesgRateInterval.load() / 1000.;
+}
+//____________________________________________________________________________
+void Messenger::PrintSuppressed(void)
+{
+  vector< pair<MessengerSite *, unsigned long> > suppressed;
+  {
+    std::lock_guard<std::mutex> lock(gMesgRateLock);
+    vector<MessengerSite*>::iterator it = gMesgSuppressedSites.begin();
+    for( ; it != gMesgSuppressedSites.end(); ++it) {
+      unsigned long n = (*it)->TakeSuppressed();
+      if(n > 0) suppressed.push_back(pair<MessengerSite *, unsigned long>(*it, n));
+    }
+  }
+
+  // not through the LOG macros, so as not to be rate limited
+  vector< pair<MessengerSite *, unsigned long> >::const_iterator it = suppressed.begin();
+  for( ; it != suppressed.end(); ++it) {
+    const char * stream = it->first->Stream();
+    (*this)("Messenger")
+      << pNOTICE << "[s] <PrintSuppressed> : Suppressed " << it->second
+      << " message(s) from " << it->first->File() << " (" << it->first->Line()
+      << ") [stream: " << (stream ? stream : "?") << "]";
+  }
+}
+//____________________________________________________________________________
+void Messenger::Flush(void)
+{
+  this->PrintSuppressed();
+  if(gMesgAsyncAppender) gMesgAsyncAppender->close();
+}
+//____________________________________________________________________________
+bool MessengerSite::Update(const char * stream, int priority)
+{
+// Looks-up the priority threshold of the input stream and caches it, if the
+// site is used with this stream only
+
+  Messenger * msg = Messenger::Instance();
+
+  // take the generation first: a threshold set meanwhile makes it stale
+  unsigned int generation = Messenger::Generation();
+  int threshold = (*msg)(stream).getChainedPriority();
+  int limit     = msg->RateLimit(stream);
+
+  const char * expected = 0;
+  if(fStream.compare_exchange_strong(expected, stream) || expected == stream) {
+    unsigned long long state =
+      ((unsigned long long) generation << 32) | (unsigned int) threshold;
+    fLimit.store(limit, std::memory_order_relaxed);
+    fState.store(state, std::memory_order_release);
+  }
+  if(priority > threshold) return false;
+  if(limit <= 0 || priority <= log4cpp::Priority::ERROR) return true;
+  return this->Admit(limit);
+}
+//____________________________________________________________________________
+bool MessengerSite::Admit(int limit)
+{
+// Counts the message against the rate limit of the current interval and,
+// once per interval (over all sites), reports the suppressed messages
+
+  long long now      = MesgClock();
+  long long interval = gMesgRateInterval.load(std::memory_order_relaxed);
+
+  long long window = fWindow.load(std::memory_order_relaxed);
+  if(now - window >= interval &&
+     fWindow.compare_exchange_strong(window, now)) {
+    fNPrinted.store(0, std::memory_order_relaxed);
+  }
+  bool admit = (fNPrinted.fetch_add(1, std::memory_order_relaxed) < limit);
+  if(!admit) {
+    fNSuppressed.fetch_add(1, std::memory_order_relaxed);
+    if(!fRegistered.exchange(true)) {
+      std::lock_guard<std::mutex> lock(gMesgRateLock);
+      gMesgSuppressedSites.push_back(this);
+    }
+  }
+
+  long long next = gMesgNextReport.load(std::memory_order_relaxed);
+  if(now >= next &&
+     gMesgNextReport.compare_exchange_strong(next, now + interval)) {
+    // the first report is due one interval after the first limited message
+    if(next > 0) Messenger::Instance()->PrintSuppressed();
+  }
+  return admit;
 }
 //____________________________________________________________________________
 void Messenger::Configure(void)
@@ -200,6 +375,32 @@ bool Messenger::SetPrioritiesFromXmlFile(string filenames)
                   << "Set priority level: " << setfill('.')
                           << setw(24) << msgstream << " --> " << priority;
       }
+
+      // enter everytime you find a <rate_limit> tag (no msgstream: default)
+      if( (!xmlStrcmp(xml_msgp->name, (const xmlChar *) "rate_limit")) ) {
+
+         string msgstream = "";
+         if(xmlHasProp(xml_msgp, (const xmlChar *) "msgstream")) {
+           msgstream = utils::str::TrimSpaces(
+                  utils::xml::GetAttribute(xml_msgp, "msgstream"));
+         }
+         string max =
+                utils::xml::TrimSpaces( xmlNodeListGetString(
+                               xml_doc, xml_msgp->xmlChildrenNode, 1));
+         if(msgstream.size() == 0) this->SetDefaultRateLimit(atoi(max.c_str()));
+         else this->SetRateLimit(msgstream.c_str(), atoi(max.c_str()));
+         SLOG("Messenger", pINFO)
+                  << "Set rate limit: " << setfill('.')
+                          << setw(24) << msgstream << " --> " << max;
+      }
+
+      // enter everytime you find a <rate_limit_interval> tag
+      if( (!xmlStrcmp(xml_msgp->name, (const xmlChar *) "rate_limit_interval")) ) {
+         string interval =
+                utils::xml::TrimSpaces( xmlNodeListGetString(
+                               xml_doc, xml_msgp->xmlChildrenNode, 1));
+         this->SetRateLimitInterval(atof(interval.c_str()));
+      }
       xml_msgp = xml_msgp->next;
     }//xml_msgp != NULL
 
@@ -26,6 +26,7 @@
 
 // ROOT5 has difficulty with parsing log4cpp headers
 #if !defined(__CINT__) && !defined(__MAKECINT__)
+  #include <atomic>
   #include "log4cpp/Category.hh"
   #include "log4cpp/Appender.hh"
   #include "log4cpp/OstreamAppender.hh"
@@ -63,6 +64,34 @@ using std::string;
 #define pINFO   log4cpp::Priority::INFO
 #define pDEBUG  log4cpp::Priority::DEBUG
 
+/*!
+  \def   __GENIE_MESG_PRIORITY_FLOOR__
+  \brief The lowest priority level compiled in (set with the --with-mesg-floor
+         configure option, see GBuild.h): Messages with a lower priority are
+         removed at compile time.
+
+  \def   GENIE_MESG_ENABLED(stream, priority)
+  \brief Whether a message would be printed. It is checked by all the LOG
+         macros before anything is evaluated or formatted, using the priority
+         threshold of the stream cached at each message site. Messages less
+         severe than ERROR are also subject to the rate limit of the stream
+         (see Messenger::SetRateLimit()).
+*/
+
+#ifndef __GENIE_MESG_PRIORITY_FLOOR__
+  #define __GENIE_MESG_PRIORITY_FLOOR__ log4cpp::Priority::DEBUG
+#endif
+
+#if !defined(__CINT__) && !defined(__MAKECINT__)
+  #define GENIE_MESG_ENABLED(stream, priority) \
+    ( (priority) <= __GENIE_MESG_PRIORITY_FLOOR__ && \
+      ([]() -> genie::MessengerSite & \
+          { static genie::MessengerSite site(__FILE__, __LINE__); return site; })() \
+            .Enabled(stream, priority) )
+#else
+  #define GENIE_MESG_ENABLED(stream, priority) (true)
+#endif
+
 /*! \def ENDL  \brief A shortcut for log4cpp's CategoryStream::ENDLINE or std manipulators*/
 
 #ifdef __GENIE_USES_LOG4CPP_VERSION__
@@ -83,6 +112,7 @@ using std::string;
 */
 
 #define SLOG(stream, priority) \
+           if( !GENIE_MESG_ENABLED(stream, priority) ) {} else \
            (*Messenger::Instance())(stream) \
                << priority << "[s] <" \
                << __FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -95,6 +125,7 @@ using std::string;
 */
 
 #define LOG(stream, priority) \
+           if( !GENIE_MESG_ENABLED(stream, priority) ) {} else \
            (*Messenger::Instance())(stream) \
                << priority << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -111,41 +142,49 @@ using std::string;
 #ifndef HIDE_GENIE_MSG_LOG_MACROS
 
 #define LOG_FATAL(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::FATAL) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::FATAL << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_ALERT(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::ALERT) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ALERT << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_CRIT(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::CRIT) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::CRIT << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_ERROR(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::ERROR) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ERROR << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_WARN(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::WARN) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::WARN << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_NOTICE(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::NOTICE) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::NOTICE << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_INFO(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::INFO) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::INFO << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_DEBUG(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::DEBUG) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::DEBUG << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -160,46 +199,55 @@ using std::string;
 */
 
 #define LLOG(stream, priority) \
+           if( !GENIE_MESG_ENABLED(stream, priority) ) {} else \
            (*Messenger::Instance())(stream) \
                << priority << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_FATAL(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::FATAL) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::FATAL << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_ALERT(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::ALERT) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ALERT << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_CRIT(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::CRIT) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::CRIT << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_ERROR(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::ERROR) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ERROR << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_WARN(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::WARN) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::WARN << "'[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_NOTICE(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::NOTICE) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::NOTICE << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_INFO(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::INFO) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::INFO << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_DEBUG(stream) \
+          if( !GENIE_MESG_ENABLED(stream, log4cpp::Priority::DEBUG) ) {} else \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::DEBUG << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -211,6 +259,7 @@ using std::string;
 */
 
 #define BLOG(stream, priority) \
+          if( !GENIE_MESG_ENABLED(stream, priority) ) {} else \
           (*Messenger::Instance())(stream) << priority
 
 /*!
@@ -266,12 +315,36 @@ public:
 
   bool SetPrioritiesFromXmlFile(string filename);
 
+  // Rate limiting: at most `max' messages less severe than ERROR are printed
+  // per message site and per interval (default: 10 sec), for the given stream
+  // or by default. The number of messages suppressed at each site is reported
+  // once per interval and at exit. A limit of 0 means no limit (the default)
+  void   SetRateLimit         (const char * stream, int max);
+  void   SetDefaultRateLimit  (int max);
+  void   SetRateLimitInterval (double seconds);
+  int    RateLimit            (const char * stream) const;
+  double RateLimitInterval    (void) const;
+  void   PrintSuppressed      (void);
+
+  //! Write out the messages buffered by an asynchronous appender (see the
+  //! GMSGASYNC env. var) and report the suppressed messages. Called at exit
+  void   Flush (void);
+
+#if !defined(__CINT__) && !defined(__MAKECINT__)
+  //! changes whenever priority levels are set (invalidating the thresholds
+  //! cached by the message sites)
+  static unsigned int Generation (void) { return fGeneration.load(std::memory_order_acquire); }
+#endif
+
 private:
   Messenger();
   Messenger(const Messenger & config_pool);
   virtual ~Messenger();
 
   static Messenger * fInstance;
+#if !defined(__CINT__) && !defined(__MAKECINT__)
+  static std::atomic<unsigned int> fGeneration;
+#endif
 
   void Configure(void);
 
@@ -289,5 +362,53 @@ private:
   friend struct Cleaner;
 };
 
+#if !defined(__CINT__) && !defined(__MAKECINT__)
+//! Priority threshold and rate limit of the stream used at a message site
+//! (see the GENIE_MESG_ENABLED macro). Sites always used with the same stream
+//! name look them up once per change of priority levels or rate limits. Sites
+//! used with varying stream names look them up at each call.
+//! With a rate limit, the site counts the messages printed in the current
+//! interval and the messages suppressed since the last report.
+class MessengerSite
+{
+public:
+  constexpr MessengerSite(const char * file, int line) :
+    fFile(file), fLine(line), fStream(0), fState(0), fLimit(0),
+    fWindow(0), fNPrinted(0), fNSuppressed(0), fRegistered(false) { }
+
+  bool Enabled(const char * stream, int priority)
+  {
+    unsigned long long state = fState.load(std::memory_order_acquire);
+    if(stream == fStream.load(std::memory_order_relaxed) &&
+       (state >> 32) == Messenger::Generation()) {
+      if(priority > (int) (state & 0xffffffffULL)) return false;
+      int limit = fLimit.load(std::memory_order_relaxed);
+      if(limit <= 0 || priority <= log4cpp::Priority::ERROR) return true;
+      return this->Admit(limit);
+    }
+    return this->Update(stream, priority);
+  }
+
+  const char *  File        (void) const { return fFile; }
+  int           Line        (void) const { return fLine; }
+  const char *  Stream      (void) const { return fStream.load(); }
+  unsigned long TakeSuppressed (void) { return fNSuppressed.exchange(0); }
+
+private:
+  bool Update (const char * stream, int priority);
+  bool Admit  (int limit);
+
+  const char *                     fFile;
+  int                              fLine;
+  std::atomic<const char *>        fStream;      ///< stream name the threshold was cached for
+  std::atomic<unsigned long long>  fState;       ///< generation (high 32 bits) & threshold (low 32 bits)
+  std::atomic<int>                 fLimit;       ///< cached rate limit (0: none)
+  std::atomic<long long>           fWindow;      ///< start of the current rate limit interval (msec)
+  std::atomic<int>                 fNPrinted;    ///< messages printed in the current interval
+  std::atomic<unsigned long>       fNSuppressed; ///< messages suppressed since the last report
+  std::atomic<bool>                fRegistered;  ///< listed for the suppressed message reports?
+};
+#endif
+
 }      // genie namespace
 #endif // _MESSENGER_H_
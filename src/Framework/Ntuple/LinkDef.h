@@ -6,13 +6,24 @@
 
 #pragma link C++ namespace genie;
 
+#pragma link C++ class std::map<int,double>+; // in NtpMCTreeHeader
 #pragma link C++ class genie::NtpMCTreeHeader;
+#pragma link C++ class std::vector<Long64_t>+; // in NtpMCCheckpoint
+#pragma link C++ class genie::NtpMCCheckpoint;
 #pragma link C++ class genie::NtpMCDTime;
 #pragma link C++ class genie::NtpMCJobEnv;
 #pragma link C++ class genie::NtpMCJobConfig;
 #pragma link C++ class genie::NtpMCRecHeader;
 #pragma link C++ class genie::NtpMCRecordI;
 #pragma link C++ class genie::NtpMCEventRecord;
+#pragma link C++ class genie::NtpMCCompactRecord;
 #pragma link C++ class genie::NtpWriter;
+#pragma link C++ class genie::NtpMCJob;
+#pragma link C++ class genie::NtpGSTRecord;
+#pragma link C++ class genie::NtpKineRecord;
+#pragma link C++ class genie::NtpEventIndex;
+#pragma link C++ class genie::NtpGenInfo;
+#pragma link C++ class genie::NtpStreamWriter;
+#pragma link C++ class genie::NtpStreamReader;
 
 #endif
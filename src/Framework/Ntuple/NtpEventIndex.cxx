@@ -0,0 +1,161 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+
+#include <TFile.h>
+#include <TTree.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpEventIndex.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpEventIndex::NtpEventIndex() :
+ievent(-1), probe(0), target(0), hitnuc(0), proc(0), scat(0),
+Ev(0), weight(0),
+nfp(0), nfn(0), nfpip(0), nfpi0(0), nfpim(0),
+nfkp(0), nfkm(0), nfk0(0), nfhyp(0), nfother(0)
+{
+
+}
+//____________________________________________________________________________
+NtpEventIndex::~NtpEventIndex()
+{
+
+}
+//____________________________________________________________________________
+void NtpEventIndex::CreateBranches(TTree * tree)
+{
+  assert(tree);
+
+  tree->Branch("iev",     &ievent,  "iev/L"     );
+  tree->Branch("probe",   &probe,   "probe/I"   );
+  tree->Branch("tgt",     &target,  "tgt/I"     );
+  tree->Branch("hitnuc",  &hitnuc,  "hitnuc/I"  );
+  tree->Branch("proc",    &proc,    "proc/I"    );
+  tree->Branch("scat",    &scat,    "scat/I"    );
+  tree->Branch("Ev",      &Ev,      "Ev/D"      );
+  tree->Branch("wght",    &weight,  "wght/D"    );
+  tree->Branch("nfp",     &nfp,     "nfp/I"     );
+  tree->Branch("nfn",     &nfn,     "nfn/I"     );
+  tree->Branch("nfpip",   &nfpip,   "nfpip/I"   );
+  tree->Branch("nfpi0",   &nfpi0,   "nfpi0/I"   );
+  tree->Branch("nfpim",   &nfpim,   "nfpim/I"   );
+  tree->Branch("nfkp",    &nfkp,    "nfkp/I"    );
+  tree->Branch("nfkm",    &nfkm,    "nfkm/I"    );
+  tree->Branch("nfk0",    &nfk0,    "nfk0/I"    );
+  tree->Branch("nfhyp",   &nfhyp,   "nfhyp/I"   );
+  tree->Branch("nfother", &nfother, "nfother/I" );
+}
+//____________________________________________________________________________
+void NtpEventIndex::SetBranchAddresses(TTree * tree)
+{
+  assert(tree);
+
+  tree->SetBranchAddress("iev",     &ievent  );
+  tree->SetBranchAddress("probe",   &probe   );
+  tree->SetBranchAddress("tgt",     &target  );
+  tree->SetBranchAddress("hitnuc",  &hitnuc  );
+  tree->SetBranchAddress("proc",    &proc    );
+  tree->SetBranchAddress("scat",    &scat    );
+  tree->SetBranchAddress("Ev",      &Ev      );
+  tree->SetBranchAddress("wght",    &weight  );
+  tree->SetBranchAddress("nfp",     &nfp     );
+  tree->SetBranchAddress("nfn",     &nfn     );
+  tree->SetBranchAddress("nfpip",   &nfpip   );
+  tree->SetBranchAddress("nfpi0",   &nfpi0   );
+  tree->SetBranchAddress("nfpim",   &nfpim   );
+  tree->SetBranchAddress("nfkp",    &nfkp    );
+  tree->SetBranchAddress("nfkm",    &nfkm    );
+  tree->SetBranchAddress("nfk0",    &nfk0    );
+  tree->SetBranchAddress("nfhyp",   &nfhyp   );
+  tree->SetBranchAddress("nfother", &nfother );
+}
+//____________________________________________________________________________
+void NtpEventIndex::Fill(Long64_t iev, const EventRecord & event)
+{
+  ievent = iev;
+  weight = event.Weight();
+
+  GHepParticle * nu = event.Probe();
+  probe = (nu) ? nu->Pdg() : 0;
+  Ev    = (nu) ? nu->E()   : 0;
+
+  const Interaction * interaction = event.Summary();
+  if(interaction) {
+    const InitialState & init_state = interaction->InitState();
+    target = init_state.Tgt().Pdg();
+    hitnuc = init_state.Tgt().HitNucIsSet() ? init_state.Tgt().HitNucPdg() : 0;
+    proc   = (int) interaction->ProcInfo().InteractionTypeId();
+    scat   = (int) interaction->ProcInfo().ScatteringTypeId();
+  } else {
+    GHepParticle * tgt = event.TargetNucleus();
+    if(!tgt) tgt = event.HitNucleon();
+    target = (tgt) ? tgt->Pdg() : 0;
+    hitnuc = 0;
+    proc   = 0;
+    scat   = 0;
+  }
+
+  // final state hadronic system multiplicities, counted as in gevpick:
+  // stable final state particles, excluding the primary lepton (and any
+  // other daughter of the probe) and pseudo-particles
+  nfp = nfn = nfpip = nfpi0 = nfpim = nfkp = nfkm = nfk0 = nfhyp = nfother = 0;
+
+  int np = event.GetEntries();
+  for(int ip = 0; ip < np; ip++) {
+    GHepParticle * p = event.Particle(ip);
+    if(p->Status() != kIStStableFinalState) continue;
+    if(p->FirstMother() == 0) continue;
+    int pdgc = p->Pdg();
+    if(pdg::IsPseudoParticle(pdgc)) continue;
+
+    if      (pdgc == kPdgProton ) nfp++;
+    else if (pdgc == kPdgNeutron) nfn++;
+    else if (pdgc == kPdgPiP    ) nfpip++;
+    else if (pdgc == kPdgPi0    ) nfpi0++;
+    else if (pdgc == kPdgPiM    ) nfpim++;
+    else if (pdgc == kPdgKP     ) nfkp++;
+    else if (pdgc == kPdgKM     ) nfkm++;
+    else if (pdgc == kPdgK0 || pdgc == kPdgAntiK0) nfk0++;
+    else if (pdgc == kPdgSigmaP || pdgc == kPdgSigma0 || pdgc == kPdgSigmaM ||
+             pdgc == kPdgLambda || pdgc == kPdgXi0    || pdgc == kPdgXiM    ||
+             pdgc == kPdgOmegaM ) nfhyp++;
+    else nfother++;
+  }
+}
+//____________________________________________________________________________
+TTree * NtpEventIndex::IndexTree(TFile * file, TTree * ghep_tree)
+{
+  if(!file || !ghep_tree) return 0;
+
+  TTree * index = dynamic_cast<TTree *> (file->Get(NtpEventIndex::TreeName()));
+  if(!index) return 0;
+
+  if(index->GetEntries() != ghep_tree->GetEntries()) {
+    LOG("Ntp", pWARN)
+      << "The event index of " << file->GetName()
+      << " does not match its GHEP tree - Ignoring it";
+    return 0;
+  }
+  return index;
+}
+//____________________________________________________________________________
@@ -0,0 +1,81 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpEventIndex
+
+\brief   Compact per-event summary (event number, probe, target, process,
+         energy and final state hadron multiplicities), written by NtpWriter
+         in the `gindex' tree alongside the GHEP event tree. The index tree
+         has one entry per GHEP tree entry, so that applications (eg gevpick,
+         gevdump) can select events and seek to the matching GHEP entries
+         without reading every NtpMCEventRecord. It can also be used as a
+         friend of the GHEP tree (gtree->AddFriend("gindex")).
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_EVENT_INDEX_H_
+#define _NTP_EVENT_INDEX_H_
+
+#ifndef ROOT_Rtypes
+#include "Rtypes.h"
+#endif
+
+class TFile;
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpEventIndex {
+
+public :
+  NtpEventIndex();
+ ~NtpEventIndex();
+
+  ///< create the index branches in the input tree (for writing)
+  void CreateBranches (TTree * tree);
+
+  ///< set the input index tree branch addresses (for reading)
+  void SetBranchAddresses (TTree * tree);
+
+  ///< compute the summary of the input event
+  void Fill (Long64_t iev, const EventRecord & event);
+
+  ///< get the index tree of the input file, if it is present and matches,
+  ///< entry by entry, the input GHEP event tree (0 otherwise)
+  static TTree * IndexTree (TFile * file, TTree * ghep_tree);
+
+  ///< index tree name
+  static const char * TreeName (void) { return "gindex"; }
+
+  Long64_t ievent;   ///< event number (as in NtpMCRecHeader)
+  Int_t    probe;    ///< probe pdg code
+  Int_t    target;   ///< target pdg code
+  Int_t    hitnuc;   ///< hit nucleon pdg code (0 if none)
+  Int_t    proc;     ///< interaction type (see InteractionType_t)
+  Int_t    scat;     ///< scattering type (see ScatteringType_t)
+  Double_t Ev;       ///< probe energy in the LAB frame (GeV)
+  Double_t weight;   ///< event weight
+  Int_t    nfp;      ///< number of final state p's (excl. the primary lepton)
+  Int_t    nfn;      ///< number of final state n's
+  Int_t    nfpip;    ///< number of final state pi+'s
+  Int_t    nfpi0;    ///< number of final state pi0's
+  Int_t    nfpim;    ///< number of final state pi-'s
+  Int_t    nfkp;     ///< number of final state K+'s
+  Int_t    nfkm;     ///< number of final state K-'s
+  Int_t    nfk0;     ///< number of final state K0's and \bar{K0}'s
+  Int_t    nfhyp;    ///< number of final state hyperons (Sigma, Lambda, Xi, Omega)
+  Int_t    nfother;  ///< number of other final state particles
+};
+
+}      // genie namespace
+#endif // _NTP_EVENT_INDEX_H_
@@ -0,0 +1,673 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <vector>
+#include <algorithm>
+
+#include <TTree.h>
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepUtils.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpGSTRecord.h"
+#include "Framework/ParticleData/BaryonResonance.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
+
+using std::vector;
+
+using namespace genie;
+using namespace genie::constants;
+
+// typical e/h ratio used for computing mean `calorimetric response'
+static const double e_h = 1.3;
+
+const int NtpGSTRecord::kNPmax;
+
+//____________________________________________________________________________
+NtpGSTRecord::NtpGSTRecord()
+{
+  // all branch variables are set by Fill()
+  fNi = 0;
+  fNf = 0;
+}
+//____________________________________________________________________________
+NtpGSTRecord::~NtpGSTRecord()
+{
+
+}
+//____________________________________________________________________________
+void NtpGSTRecord::CreateBranches(TTree * tree)
+{
+  assert(tree);
+
+  tree->Branch("iev",         &fIev,          "iev/I"          );
+  tree->Branch("neu",         &fNeutrino,     "neu/I"          );
+  tree->Branch("fspl",        &fFSPrimLept,   "fspl/I"         );
+  tree->Branch("tgt",         &fTarget,       "tgt/I"          );
+  tree->Branch("Z",           &fTargetZ,      "Z/I"            );
+  tree->Branch("A",           &fTargetA,      "A/I"            );
+  tree->Branch("hitnuc",      &fHitNuc,       "hitnuc/I"       );
+  tree->Branch("hitqrk",      &fHitQrk,       "hitqrk/I"       );
+  tree->Branch("resid",       &fResId,        "resid/I"        );
+  tree->Branch("sea",         &fFromSea,      "sea/O"          );
+  tree->Branch("qel",         &fIsQel,        "qel/O"          );
+  tree->Branch("mec",         &fIsMec,        "mec/O"          );
+  tree->Branch("res",         &fIsRes,        "res/O"          );
+  tree->Branch("dis",         &fIsDis,        "dis/O"          );
+  tree->Branch("coh",         &fIsCoh,        "coh/O"          );
+  tree->Branch("dfr",         &fIsDfr,        "dfr/O"          );
+  tree->Branch("imd",         &fIsImd,        "imd/O"          );
+  tree->Branch("imdanh",      &fIsImdAnh,     "imdanh/O"       );
+  tree->Branch("singlek",     &fIsSingleK,    "singlek/O"      );
+  tree->Branch("nuel",        &fIsNuEL,       "nuel/O"         );
+  tree->Branch("em",          &fIsEM,         "em/O"           );
+  tree->Branch("cc",          &fIsCC,         "cc/O"           );
+  tree->Branch("nc",          &fIsNC,         "nc/O"           );
+  tree->Branch("charm",       &fIsCharmPro,   "charm/O"        );
+  tree->Branch("amnugamma",   &fIsAMNuGamma,  "amnugamma/O"    );
+  tree->Branch("neut_code",   &fCodeNeut,     "neut_code/I"    );
+  tree->Branch("nuance_code", &fCodeNuance,   "nuance_code/I"  );
+  tree->Branch("wght",        &fWeight,       "wght/D"         );
+  tree->Branch("xs",          &fKineXs,       "xs/D"           );
+  tree->Branch("ys",          &fKineYs,       "ys/D"           );
+  tree->Branch("ts",          &fKineTs,       "ts/D"           );
+  tree->Branch("Q2s",         &fKineQ2s,      "Q2s/D"          );
+  tree->Branch("Ws",          &fKineWs,       "Ws/D"           );
+  tree->Branch("x",           &fKineX,        "x/D"            );
+  tree->Branch("y",           &fKineY,        "y/D"            );
+  tree->Branch("t",           &fKineT,        "t/D"            );
+  tree->Branch("Q2",          &fKineQ2,       "Q2/D"           );
+  tree->Branch("W",           &fKineW,        "W/D"            );
+  tree->Branch("EvRF",        &fEvRF,         "EvRF/D"         );
+  tree->Branch("Ev",          &fEv,           "Ev/D"           );
+  tree->Branch("pxv",         &fPxv,          "pxv/D"          );
+  tree->Branch("pyv",         &fPyv,          "pyv/D"          );
+  tree->Branch("pzv",         &fPzv,          "pzv/D"          );
+  tree->Branch("En",          &fEn,           "En/D"           );
+  tree->Branch("pxn",         &fPxn,          "pxn/D"          );
+  tree->Branch("pyn",         &fPyn,          "pyn/D"          );
+  tree->Branch("pzn",         &fPzn,          "pzn/D"          );
+  tree->Branch("El",          &fEl,           "El/D"           );
+  tree->Branch("pxl",         &fPxl,          "pxl/D"          );
+  tree->Branch("pyl",         &fPyl,          "pyl/D"          );
+  tree->Branch("pzl",         &fPzl,          "pzl/D"          );
+  tree->Branch("pl",          &fPl,           "pl/D"           );
+  tree->Branch("cthl",        &fCosthl,       "cthl/D"         );
+  tree->Branch("nfp",         &fNfP,          "nfp/I"          );
+  tree->Branch("nfn",         &fNfN,          "nfn/I"          );
+  tree->Branch("nfpip",       &fNfPip,        "nfpip/I"        );
+  tree->Branch("nfpim",       &fNfPim,        "nfpim/I"        );
+  tree->Branch("nfpi0",       &fNfPi0,        "nfpi0/I"        );
+  tree->Branch("nfkp",        &fNfKp,         "nfkp/I"         );
+  tree->Branch("nfkm",        &fNfKm,         "nfkm/I"         );
+  tree->Branch("nfk0",        &fNfK0,         "nfk0/I"         );
+  tree->Branch("nfem",        &fNfEM,         "nfem/I"         );
+  tree->Branch("nfother",     &fNfOther,      "nfother/I"      );
+  tree->Branch("nip",         &fNiP,          "nip/I"          );
+  tree->Branch("nin",         &fNiN,          "nin/I"          );
+  tree->Branch("nipip",       &fNiPip,        "nipip/I"        );
+  tree->Branch("nipim",       &fNiPim,        "nipim/I"        );
+  tree->Branch("nipi0",       &fNiPi0,        "nipi0/I"        );
+  tree->Branch("nikp",        &fNiKp,         "nikp/I"         );
+  tree->Branch("nikm",        &fNiKm,         "nikm/I"         );
+  tree->Branch("nik0",        &fNiK0,         "nik0/I"         );
+  tree->Branch("niem",        &fNiEM,         "niem/I"         );
+  tree->Branch("niother",     &fNiOther,      "niother/I"      );
+  tree->Branch("ni",          &fNi,           "ni/I"           );
+  tree->Branch("pdgi",        fPdgi,          "pdgi[ni]/I"     );
+  tree->Branch("resc",        fResc,          "resc[ni]/I"     );
+  tree->Branch("Ei",          fEi,            "Ei[ni]/D"       );
+  tree->Branch("pxi",         fPxi,           "pxi[ni]/D"      );
+  tree->Branch("pyi",         fPyi,           "pyi[ni]/D"      );
+  tree->Branch("pzi",         fPzi,           "pzi[ni]/D"      );
+  tree->Branch("nf",          &fNf,           "nf/I"           );
+  tree->Branch("pdgf",        fPdgf,          "pdgf[nf]/I"     );
+  tree->Branch("Ef",          fEf,            "Ef[nf]/D"       );
+  tree->Branch("pxf",         fPxf,           "pxf[nf]/D"      );
+  tree->Branch("pyf",         fPyf,           "pyf[nf]/D"      );
+  tree->Branch("pzf",         fPzf,           "pzf[nf]/D"      );
+  tree->Branch("pf",          fPf,            "pf[nf]/D"       );
+  tree->Branch("cthf",        fCosthf,        "cthf[nf]/D"     );
+  tree->Branch("vtxx",        &fVtxX,         "vtxx/D"         );
+  tree->Branch("vtxy",        &fVtxY,         "vtxy/D"         );
+  tree->Branch("vtxz",        &fVtxZ,         "vtxz/D"         );
+  tree->Branch("vtxt",        &fVtxT,         "vtxt/D"         );
+  tree->Branch("sumKEf",      &fSumKEf,       "sumKEf/D"       );
+  tree->Branch("calresp0",    &fCalResp0,     "calresp0/D"     );
+}
+//____________________________________________________________________________
+bool NtpGSTRecord::Fill(int iev, const EventRecord & event)
+{
+// Computes the summary of the input event. The calorimetric response to the
+// hadronic system (calresp0) is approximated as the sum of
+//  - (kinetic energy) for pi+, pi-, p, n
+//  - (energy + 2*mass) for antiproton, antineutron
+//  - ((e/h) * energy)   for pi0, gamma, e-, e+, where e/h is set to 1.3
+//  - (kinetic energy) for other particles
+
+  TLorentzVector pdummy(0,0,0,0);
+
+  // Go further only if the event is physical
+  bool is_unphysical = event.IsUnphysical();
+  if(is_unphysical) {
+    LOG("Ntp", pINFO) << "Skipping unphysical event";
+    return false;
+  }
+
+  // Clean-up arrays
+  //
+  for(int j=0; j<kNPmax; j++) {
+     fPdgi   [j] =  0;
+     fResc   [j] = -1;
+     fEi     [j] =  0;
+     fPxi    [j] =  0;
+     fPyi    [j] =  0;
+     fPzi    [j] =  0;
+     fPdgf   [j] =  0;
+     fEf     [j] =  0;
+     fPxf    [j] =  0;
+     fPyf    [j] =  0;
+     fPzf    [j] =  0;
+     fPf     [j] =  0;
+     fCosthf [j] =  0;
+  }
+
+  // Computing event characteristics
+  //
+
+  //input particles
+  GHepParticle * neutrino = event.Probe();
+  GHepParticle * target = event.Particle(1);
+  assert(target);
+  GHepParticle * fsl = event.FinalStatePrimaryLepton();
+  GHepParticle * hitnucl = event.HitNucleon();
+
+  int tgtZ = 0;
+  int tgtA = 0;
+  if(pdg::IsIon(target->Pdg())) {
+     tgtZ = pdg::IonPdgCodeToZ(target->Pdg());
+     tgtA = pdg::IonPdgCodeToA(target->Pdg());
+  }
+  if(target->Pdg() == kPdgProton   ) { tgtZ = 1; tgtA = 1; }
+  if(target->Pdg() == kPdgNeutron  ) { tgtZ = 0; tgtA = 1; }
+
+  // Summary info
+  const Interaction * interaction = event.Summary();
+  const InitialState & init_state = interaction->InitState();
+  const ProcessInfo &  proc_info  = interaction->ProcInfo();
+  const Kinematics &   kine       = interaction->Kine();
+  const XclsTag &      xcls       = interaction->ExclTag();
+  const Target &       tgt        = init_state.Tgt();
+
+  // Vertex in detector coord system
+  TLorentzVector * vtx = event.Vertex();
+
+  // Process id
+  bool is_qel    = proc_info.IsQuasiElastic();
+  bool is_res    = proc_info.IsResonant();
+  bool is_dis    = proc_info.IsDeepInelastic();
+  bool is_coh    = proc_info.IsCoherent();
+  bool is_dfr    = proc_info.IsDiffractive();
+  bool is_imd    = proc_info.IsInverseMuDecay();
+  bool is_imdanh = proc_info.IsIMDAnnihilation();
+  bool is_singlek = proc_info.IsSingleKaon();
+  bool is_nuel      = proc_info.IsNuElectronElastic();
+  bool is_em        = proc_info.IsEM();
+  bool is_weakcc    = proc_info.IsWeakCC();
+  bool is_weaknc    = proc_info.IsWeakNC();
+  bool is_mec       = proc_info.IsMEC();
+  bool is_amnugamma = proc_info.IsAMNuGamma();
+
+  if (!hitnucl && neutrino) {
+      assert(is_coh || is_imd || is_imdanh || is_nuel | is_amnugamma);
+  }
+
+  // Hit quark - set only for DIS events
+  int  qrk  = (is_dis) ? tgt.HitQrkPdg() : 0;
+  bool seaq = (is_dis) ? tgt.HitSeaQrk() : false;
+
+  // Resonance id ($GENIE/src/BaryonResonance/BaryonResonance.h) -
+  // set only for resonance neutrinoproduction
+  int resid = (is_res) ? EResonance(xcls.Resonance()) : -99;
+
+  // (qel or dis) charm production?
+  bool charm = xcls.IsCharmEvent();
+
+  // Get NEUT and NUANCE equivalent reaction codes (if any)
+  fCodeNeut    = utils::ghep::NeutReactionCode(&event);
+  fCodeNuance  = utils::ghep::NuanceReactionCode(&event);
+
+  // Get event weight
+  double weight = event.Weight();
+
+  // Access kinematical params _exactly_ as they were selected internally
+  // (at the hit nucleon rest frame;
+  // for bound nucleons: taking into account fermi momentum and off-shell kinematics)
+  //
+  bool get_selected = true;
+  double xs  = kine.x (get_selected);
+  double ys  = kine.y (get_selected);
+  double ts  = (is_coh || is_dfr) ? kine.t (get_selected) : -1;
+  double Q2s = kine.Q2(get_selected);
+  double Ws  = kine.W (get_selected);
+
+  LOG("Ntp", pDEBUG)
+     << "[Select] Q2 = " << Q2s << ", W = " << Ws
+     << ", x = " << xs << ", y = " << ys << ", t = " << ts;
+
+  // Calculate the same kinematical params but now as an experimentalist would
+  // measure them by neglecting the fermi momentum and off-shellness of bound nucleons
+  //
+
+  const TLorentzVector & k1 = (neutrino) ? *(neutrino->P4()) : pdummy;  // v 4-p (k1)
+  const TLorentzVector & k2 = (fsl)      ? *(fsl->P4())      : pdummy;  // l 4-p (k2)
+  const TLorentzVector & p1 = (hitnucl)  ? *(hitnucl->P4())  : pdummy;  // N 4-p (p1)
+
+  double M  = kNucleonMass;
+  TLorentzVector q  = k1-k2;                     // q=k1-k2, 4-p transfer
+  double Q2 = -1 * q.M2();                       // momemtum transfer
+
+  double v  = (hitnucl) ? q.Energy()       : -1; // v (E transfer to the nucleus)
+  double x, y, W2, W;
+  if(!is_coh){
+
+     x  = (hitnucl) ? 0.5*Q2/(M*v)     : -1; // Bjorken x
+     y  = (hitnucl) ? v/k1.Energy()    : -1; // Inelasticity, y = q*P1/k1*P1
+
+     W2 = (hitnucl) ? M*M + 2*M*v - Q2 : -1; // Hadronic Invariant mass ^ 2
+     W  = (hitnucl) ? TMath::Sqrt(W2)  : -1;
+  } else{
+
+     v = q.Energy();
+     x  =  0.5*Q2/(M*v);      // Bjorken x
+     y  = v/k1.Energy();    // Inelasticity, y = q*P1/k1*P1
+
+     W2 = M*M + 2*M*v - Q2;  // Hadronic Invariant mass ^ 2
+     W  = TMath::Sqrt(W2);
+
+  }
+
+  double t  = (is_coh || is_dfr) ? kine.t (get_selected) : -1;
+
+  // Get v 4-p at hit nucleon rest-frame
+  TLorentzVector k1_rf = k1;
+  if(hitnucl) {
+     k1_rf.Boost(-1.*p1.BoostVector());
+  }
+
+//    if(is_mec){
+//      v = q.Energy();
+//      x = 0.5*Q2/(M*v);
+//      y = v/k1.Energy();
+//      W2 = M*M + 2*M*v - Q2;
+//      W = TMath::Sqrt(W2);
+//    }
+
+  LOG("Ntp", pDEBUG)
+     << "[Calc] Q2 = " << Q2 << ", W = " << W
+     << ", x = " << x << ", y = " << y << ", t = " << t;
+
+  // Extract more info on the hadronic system
+  // Only for QEL/RES/DIS/COH/MEC events
+  //
+  bool study_hadsyst = (is_qel || is_res || is_dis || is_coh || is_dfr || is_mec || is_singlek);
+
+  //
+  TObjArrayIter piter(&event);
+  GHepParticle * p = 0;
+  int ip=-1;
+
+  //
+  // Extract the final state system originating from the hadronic vertex
+  // (after the intranuclear rescattering step)
+  //
+
+  LOG("Ntp", pDEBUG) << "Extracting final state hadronic system";
+
+  vector<int> final_had_syst;
+  while( (p = (GHepParticle *) piter.Next()) && study_hadsyst)
+  {
+    ip++;
+    // don't count final state lepton as part hadronic system
+    //if(!is_coh && event.Particle(ip)->FirstMother()==0) continue;
+    if(event.Particle(ip)->FirstMother()==0) continue;
+    if(pdg::IsPseudoParticle(p->Pdg())) continue;
+    int pdgc = p->Pdg();
+    int ist  = p->Status();
+    if(ist==kIStStableFinalState) {
+       if (pdgc == kPdgGamma || pdgc == kPdgElectron || pdgc == kPdgPositron)  {
+          int igmom = p->FirstMother();
+          if(igmom!=-1) {
+            // only count e+'s e-'s or gammas not from decay of pi0
+            if(event.Particle(igmom)->Pdg() != kPdgPi0) { final_had_syst.push_back(ip); }
+          }
+       } else {
+          final_had_syst.push_back(ip);
+       }
+    }
+    // now add pi0's that were decayed as short lived particles
+    else if(pdgc == kPdgPi0){
+      int ifd = p->FirstDaughter();
+      int fd_pdgc = event.Particle(ifd)->Pdg();
+      // just require that first daughter is one of gamma, e+ or e-
+      if(fd_pdgc == kPdgGamma || fd_pdgc == kPdgElectron || fd_pdgc == kPdgPositron){
+        final_had_syst.push_back(ip);
+      }
+    }
+  }//particle-loop
+
+  if( std::count(final_had_syst.begin(), final_had_syst.end(), -1) > 0) {
+      return false;
+  }
+
+  //
+  // Extract info on the primary hadronic system (before any intranuclear rescattering)
+  // looking for particles with status_code == kIStHadronInTheNucleus
+  // An exception is the coherent production and scattering off free nucleon targets
+  // (no intranuclear rescattering) in which case primary hadronic system is set to be
+  // 'identical' with the final  state hadronic system
+  //
+
+  LOG("Ntp", pDEBUG) << "Extracting primary hadronic system";
+
+  ip = -1;
+  TObjArrayIter piter_prim(&event);
+
+  vector<int> prim_had_syst;
+  if(study_hadsyst) {
+    // if coherent or free nucleon target set primary states equal to final states
+    if(!pdg::IsIon(target->Pdg()) || (is_coh)) {
+       vector<int>::const_iterator hiter = final_had_syst.begin();
+       for( ; hiter != final_had_syst.end(); ++hiter) {
+         prim_had_syst.push_back(*hiter);
+       }
+    }
+    //to find the true particles emitted from the principal vertex,
+    // looping over all Ist=14 particles ok for hA, but doesn't
+    // work for hN.  We must now look specifically for these particles.
+    int ist_store = -10;
+    if(is_res){
+      while( (p = (GHepParticle *) piter_prim.Next()) ){
+        ip++;
+        int ist_comp  = p->Status();
+        if(ist_comp==kIStDecayedState) {
+          ist_store = ip;    //store this mother
+          continue;
+        }
+        //          LOG("Ntp",pNOTICE) << p->FirstMother()<< "  "<<ist_store;
+        if(p->FirstMother()==ist_store) {
+            prim_had_syst.push_back(ip);
+          }
+      }
+    }
+    if(is_dis){
+      while( (p = (GHepParticle *) piter_prim.Next()) ){
+        ip++;
+        int ist_comp  = p->Status();
+        if(ist_comp==kIStDISPreFragmHadronicState) {
+          ist_store = ip;    //store this mother
+          continue;
+        }
+        if(p->FirstMother()==ist_store) {
+            prim_had_syst.push_back(ip);
+          }
+      }
+    }
+    if(is_qel){
+      while( (p = (GHepParticle *) piter_prim.Next()) ){
+        ip++;
+        int ist_comp  = p->Status();
+        if(ist_comp==kIStNucleonTarget) {
+          ist_store = ip;    //store this mother
+          continue;
+        }
+        //          LOG("Ntp",pNOTICE) << p->FirstMother()<< "  "<<ist_store;
+        if(p->FirstMother()==ist_store) {
+            prim_had_syst.push_back(ip);
+          }
+      }
+    }
+    if(is_mec){
+      while( (p = (GHepParticle *) piter_prim.Next()) ){
+        ip++;
+        int ist_comp  = p->Status();
+        if(ist_comp==kIStDecayedState) {
+          ist_store = ip;    //store this mother
+          continue;
+        }
+        //          LOG("Ntp",pNOTICE) << "MEC: " << p->FirstMother()<< "  "<<ist_store;
+        if(p->FirstMother()==ist_store) {
+            prim_had_syst.push_back(ip);
+          }
+      }
+    }
+    // otherwise loop over all particles and store indices of those which are hadrons
+    // created within the nucleus
+    /*      else {
+      while( (p = (GHepParticle *) piter_prim.Next()) ){
+        ip++;
+        int ist_comp  = p->Status();
+        if(ist_comp==kIStHadronInTheNucleus) {
+          prim_had_syst.push_back(ip);
+        }
+        }//particle-loop   */
+      //
+      // also include gammas from nuclear de-excitations (appearing in the daughter list of the
+      // hit nucleus, earlier than the primary hadronic system extracted above)
+      for(int i = target->FirstDaughter(); i <= target->LastDaughter(); i++) {
+        if(i<0) continue;
+        if(event.Particle(i)->Status()==kIStStableFinalState) { prim_had_syst.push_back(i); }
+      }
+      //      }//freenuc?
+  }//study_hadsystem?
+
+  if( std::count(prim_had_syst.begin(), prim_had_syst.end(), -1) > 0) {
+      return false;
+  }
+
+  if( (int)final_had_syst.size() > kNPmax || (int)prim_had_syst.size() > kNPmax ) {
+      LOG("Ntp", pWARN)
+        << "Too many hadronic system particles (max: " << kNPmax
+        << ") - Skipping event " << iev;
+      return false;
+  }
+
+  //
+  // Al information has been assembled -- Start filling up the tree branches
+  //
+  fIev        = iev;
+  fNeutrino   = (neutrino) ? neutrino->Pdg() : 0;
+  fFSPrimLept = (fsl) ? fsl->Pdg() : 0;
+  fTarget     = target->Pdg();
+  fTargetZ    = tgtZ;
+  fTargetA    = tgtA;
+  fHitNuc     = (hitnucl) ? hitnucl->Pdg() : 0;
+  fHitQrk     = qrk;
+  fFromSea    = seaq;
+  fResId      = resid;
+  fIsQel      = is_qel;
+  fIsRes      = is_res;
+  fIsDis      = is_dis;
+  fIsCoh      = is_coh;
+  fIsDfr      = is_dfr;
+  fIsImd      = is_imd;
+  fIsSingleK  = is_singlek;
+  fIsNuEL     = is_nuel;
+  fIsEM       = is_em;
+  fIsMec      = is_mec;
+  fIsCC       = is_weakcc;
+  fIsNC       = is_weaknc;
+  fIsCharmPro = charm;
+  fIsAMNuGamma= is_amnugamma;
+  fWeight     = weight;
+  fKineXs     = xs;
+  fKineYs     = ys;
+  fKineTs     = ts;
+  fKineQ2s    = Q2s;
+  fKineWs     = Ws;
+  fKineX      = x;
+  fKineY      = y;
+  fKineT      = t;
+  fKineQ2     = Q2;
+  fKineW      = W;
+  fEvRF       = k1_rf.Energy();
+  fEv         = k1.Energy();
+  fPxv        = k1.Px();
+  fPyv        = k1.Py();
+  fPzv        = k1.Pz();
+  fEn         = (hitnucl) ? p1.Energy() : 0;
+  fPxn        = (hitnucl) ? p1.Px()     : 0;
+  fPyn        = (hitnucl) ? p1.Py()     : 0;
+  fPzn        = (hitnucl) ? p1.Pz()     : 0;
+  fEl         = k2.Energy();
+  fPxl        = k2.Px();
+  fPyl        = k2.Py();
+  fPzl        = k2.Pz();
+  fPl         = k2.P();
+  fCosthl     = TMath::Cos( k2.Vect().Angle(k1.Vect()) );
+
+  // Primary hadronic system (from primary neutrino interaction, before FSI)
+  fNiP        = 0;
+  fNiN        = 0;
+  fNiPip      = 0;
+  fNiPim      = 0;
+  fNiPi0      = 0;
+  fNiKp       = 0;
+  fNiKm       = 0;
+  fNiK0       = 0;
+  fNiEM       = 0;
+  fNiOther    = 0;
+  fNi = prim_had_syst.size();
+  for(int j=0; j<fNi; j++) {
+    p = event.Particle(prim_had_syst[j]);
+    assert(p);
+    fPdgi[j] = p->Pdg();
+    fResc[j] = p->RescatterCode();
+    fEi  [j] = p->Energy();
+    fPxi [j] = p->Px();
+    fPyi [j] = p->Py();
+    fPzi [j] = p->Pz();
+
+    if      (p->Pdg() == kPdgProton  || p->Pdg() == kPdgAntiProton)   fNiP++;
+    else if (p->Pdg() == kPdgNeutron || p->Pdg() == kPdgAntiNeutron)  fNiN++;
+    else if (p->Pdg() == kPdgPiP) fNiPip++;
+    else if (p->Pdg() == kPdgPiM) fNiPim++;
+    else if (p->Pdg() == kPdgPi0) fNiPi0++;
+    else if (p->Pdg() == kPdgKP)  fNiKp++;
+    else if (p->Pdg() == kPdgKM)  fNiKm++;
+    else if (p->Pdg() == kPdgK0    || p->Pdg() == kPdgAntiK0)  fNiK0++;
+    else if (p->Pdg() == kPdgGamma || p->Pdg() == kPdgElectron || p->Pdg() == kPdgPositron) fNiEM++;
+    else fNiOther++;
+
+    LOG("Ntp", pINFO)
+      << "Counting in primary hadronic system: idx = " << prim_had_syst[j]
+      << " -> " << p->Name();
+  }
+
+  LOG("Ntp", pINFO)
+   << "N(p):"             << fNiP
+   << ", N(n):"           << fNiN
+   << ", N(pi+):"         << fNiPip
+   << ", N(pi-):"         << fNiPim
+   << ", N(pi0):"         << fNiPi0
+   << ", N(K+,K-,K0):"    << fNiKp+fNiKm+fNiK0
+   << ", N(gamma,e-,e+):" << fNiEM
+   << ", N(etc):"         << fNiOther << "\n";
+
+  // Final state (visible) hadronic system
+  fNfP        = 0;
+  fNfN        = 0;
+  fNfPip      = 0;
+  fNfPim      = 0;
+  fNfPi0      = 0;
+  fNfKp       = 0;
+  fNfKm       = 0;
+  fNfK0       = 0;
+  fNfEM       = 0;
+  fNfOther    = 0;
+
+  fSumKEf     = (fsl) ? fsl->KinE() : 0;
+  fCalResp0   = 0;
+
+  fNf = final_had_syst.size();
+  for(int j=0; j<fNf; j++) {
+    p = event.Particle(final_had_syst[j]);
+    assert(p);
+
+    int    hpdg = p->Pdg();
+    double hE   = p->Energy();
+    double hKE  = p->KinE();
+    double hpx  = p->Px();
+    double hpy  = p->Py();
+    double hpz  = p->Pz();
+    double hp   = TMath::Sqrt(hpx*hpx + hpy*hpy + hpz*hpz);
+    double hm   = p->Mass();
+    double hcth = TMath::Cos( p->P4()->Vect().Angle(k1.Vect()) );
+
+    fPdgf  [j] = hpdg;
+    fEf    [j] = hE;
+    fPxf   [j] = hpx;
+    fPyf   [j] = hpy;
+    fPzf   [j] = hpz;
+    fPf    [j] = hp;
+    fCosthf[j] = hcth;
+
+    fSumKEf += hKE;
+
+    if      ( hpdg == kPdgProton      )  { fNfP++;     fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgAntiProton  )  { fNfP++;     fCalResp0 += (hE + 2*hm);}
+    else if ( hpdg == kPdgNeutron     )  { fNfN++;     fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgAntiNeutron )  { fNfN++;     fCalResp0 += (hE + 2*hm);}
+    else if ( hpdg == kPdgPiP         )  { fNfPip++;   fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgPiM         )  { fNfPim++;   fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgPi0         )  { fNfPi0++;   fCalResp0 += (e_h * hE); }
+    else if ( hpdg == kPdgKP          )  { fNfKp++;    fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgKM          )  { fNfKm++;    fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgK0          )  { fNfK0++;    fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgAntiK0      )  { fNfK0++;    fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgGamma       )  { fNfEM++;    fCalResp0 += (e_h * hE); }
+    else if ( hpdg == kPdgElectron    )  { fNfEM++;    fCalResp0 += (e_h * hE); }
+    else if ( hpdg == kPdgPositron    )  { fNfEM++;    fCalResp0 += (e_h * hE); }
+    else                                 { fNfOther++; fCalResp0 += hKE;        }
+
+    LOG("Ntp", pINFO)
+      << "Counting in f/s system from hadronic vtx: idx = " << final_had_syst[j]
+      << " -> " << p->Name();
+  }
+
+  LOG("Ntp", pINFO)
+   << "N(p):"             << fNfP
+   << ", N(n):"           << fNfN
+   << ", N(pi+):"         << fNfPip
+   << ", N(pi-):"         << fNfPim
+   << ", N(pi0):"         << fNfPi0
+   << ", N(K+,K-,K0):"    << fNfKp+fNfKm+fNfK0
+   << ", N(gamma,e-,e+):" << fNfEM
+   << ", N(etc):"         << fNfOther << "\n";
+
+  fVtxX = vtx->X();
+  fVtxY = vtx->Y();
+  fVtxZ = vtx->Z();
+  fVtxT = vtx->T();
+
+  return true;
+}
+//____________________________________________________________________________
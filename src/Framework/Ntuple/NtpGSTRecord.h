@@ -0,0 +1,146 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpGSTRecord
+
+\brief   Flat, `gst'-style summary of a GENIE event (kinematics, process
+         flags and the primary / final state hadronic system as arrays of
+         primitive types), filled into the branches of a TTree.
+         It is used by gntpc (-f gst) and by NtpWriter, which can write the
+         summary tree directly during event generation (see kNFFlat).
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_GST_RECORD_H_
+#define _NTP_GST_RECORD_H_
+
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpGSTRecord {
+
+public :
+  NtpGSTRecord();
+ ~NtpGSTRecord();
+
+  ///< create the `gst' branches in the input tree
+  void CreateBranches (TTree * tree);
+
+  ///< compute the summary of the input event; returns false if the event
+  ///< is not to be stored (unphysical event, inconsistent hadronic system)
+  bool Fill (int iev, const EventRecord & event);
+
+  ///< max number of hadronic system particles stored
+  static const int kNPmax = 250;
+
+private:
+
+  int    fIev;              ///< Event number
+  int    fNeutrino;         ///< Neutrino pdg code
+  int    fFSPrimLept;       ///< Final state primary lepton pdg code
+  int    fTarget;           ///< Nuclear target pdg code (10LZZZAAAI)
+  int    fTargetZ;          ///< Nuclear target Z (extracted from pdg code above)
+  int    fTargetA;          ///< Nuclear target A (extracted from pdg code above)
+  int    fHitNuc;           ///< Hit nucleon pdg code      (not set for COH,IMD and NuEL events)
+  int    fHitQrk;           ///< Hit quark pdg code        (set for DIS events only)
+  bool   fFromSea;          ///< Hit quark is from sea     (set for DIS events only)
+  int    fResId;            ///< Produced baryon resonance (set for resonance events only)
+  bool   fIsQel;            ///< Is QEL?
+  bool   fIsRes;            ///< Is RES?
+  bool   fIsDis;            ///< Is DIS?
+  bool   fIsCoh;            ///< Is Coherent?
+  bool   fIsMec;            ///< Is MEC?
+  bool   fIsDfr;            ///< Is Diffractive?
+  bool   fIsImd;            ///< Is IMD?
+  bool   fIsSingleK;        ///< Is single kaon?
+  bool   fIsImdAnh;         ///< Is IMD annihilation?
+  bool   fIsNuEL;           ///< Is ve elastic?
+  bool   fIsEM;             ///< Is EM process?
+  bool   fIsCC;             ///< Is Weak CC process?
+  bool   fIsNC;             ///< Is Weak NC process?
+  bool   fIsCharmPro;       ///< Produces charm?
+  bool   fIsAMNuGamma;      ///< is anomaly mediated nu gamma
+  int    fCodeNeut;         ///< The equivalent NEUT reaction code (if any)
+  int    fCodeNuance;       ///< The equivalent NUANCE reaction code (if any)
+  double fWeight;           ///< Event weight
+  double fKineXs;           ///< Bjorken x as was generated during kinematical selection; takes fermi momentum / off-shellness into account
+  double fKineYs;           ///< Inelasticity y as was generated during kinematical selection; takes fermi momentum / off-shellness into account
+  double fKineTs;           ///< Energy transfer to nucleus at COH events as was generated during kinematical selection
+  double fKineQ2s;          ///< Momentum transfer Q^2 as was generated during kinematical selection; takes fermi momentum / off-shellness into account
+  double fKineWs;           ///< Hadronic invariant mass W as was generated during kinematical selection; takes fermi momentum / off-shellness into account
+  double fKineX;            ///< Experimental-like Bjorken x; neglects fermi momentum / off-shellness
+  double fKineY;            ///< Experimental-like inelasticity y; neglects fermi momentum / off-shellness
+  double fKineT;            ///< Experimental-like energy transfer to nucleus at COH events
+  double fKineQ2;           ///< Experimental-like momentum transfer Q^2; neglects fermi momentum / off-shellness
+  double fKineW;            ///< Experimental-like hadronic invariant mass W; neglects fermi momentum / off-shellness
+  double fEvRF;             ///< Neutrino energy @ the rest-frame of the hit-object (eg nucleon for CCQE, e- for ve- elastic,...)
+  double fEv;               ///< Neutrino energy @ LAB
+  double fPxv;              ///< Neutrino px @ LAB
+  double fPyv;              ///< Neutrino py @ LAB
+  double fPzv;              ///< Neutrino pz @ LAB
+  double fEn;               ///< Initial state hit nucleon energy @ LAB
+  double fPxn;              ///< Initial state hit nucleon px @ LAB
+  double fPyn;              ///< Initial state hit nucleon py @ LAB
+  double fPzn;              ///< Initial state hit nucleon pz @ LAB
+  double fEl;               ///< Final state primary lepton energy @ LAB
+  double fPxl;              ///< Final state primary lepton px @ LAB
+  double fPyl;              ///< Final state primary lepton py @ LAB
+  double fPzl;              ///< Final state primary lepton pz @ LAB
+  double fPl;               ///< Final state primary lepton p  @ LAB
+  double fCosthl;           ///< Final state primary lepton cos(theta) wrt to neutrino direction
+  int    fNfP;              ///< Nu. of final state p's + \bar{p}'s (after intranuclear rescattering)
+  int    fNfN;              ///< Nu. of final state n's + \bar{n}'s
+  int    fNfPip;            ///< Nu. of final state pi+'s
+  int    fNfPim;            ///< Nu. of final state pi-'s
+  int    fNfPi0;            ///< Nu. of final state pi0's
+  int    fNfKp;             ///< Nu. of final state K+'s
+  int    fNfKm;             ///< Nu. of final state K-'s
+  int    fNfK0;             ///< Nu. of final state K0's + \bar{K0}'s
+  int    fNfEM;             ///< Nu. of final state gammas and e-/e+
+  int    fNfOther;          ///< Nu. of heavier final state hadrons (D+/-,D0,Ds+/-,Lamda,Sigma,Lamda_c,Sigma_c,...)
+  int    fNiP;              ///< Nu. of `primary' (: before intranuclear rescattering) p's + \bar{p}'s
+  int    fNiN;              ///< Nu. of `primary' n's + \bar{n}'s
+  int    fNiPip;            ///< Nu. of `primary' pi+'s
+  int    fNiPim;            ///< Nu. of `primary' pi-'s
+  int    fNiPi0;            ///< Nu. of `primary' pi0's
+  int    fNiKp;             ///< Nu. of `primary' K+'s
+  int    fNiKm;             ///< Nu. of `primary' K-'s
+  int    fNiK0;             ///< Nu. of `primary' K0's + \bar{K0}'s
+  int    fNiEM;             ///< Nu. of `primary' gammas and e-/e+
+  int    fNiOther;          ///< Nu. of other `primary' hadron shower particles
+  int    fNf;               ///< Nu. of final state particles in hadronic system
+  int    fPdgf[kNPmax];     ///< Pdg code of k^th final state particle in hadronic system
+  double fEf[kNPmax];       ///< Energy     of k^th final state particle in hadronic system @ LAB
+  double fPxf[kNPmax];      ///< Px         of k^th final state particle in hadronic system @ LAB
+  double fPyf[kNPmax];      ///< Py         of k^th final state particle in hadronic system @ LAB
+  double fPzf[kNPmax];      ///< Pz         of k^th final state particle in hadronic system @ LAB
+  double fPf[kNPmax];       ///< P          of k^th final state particle in hadronic system @ LAB
+  double fCosthf[kNPmax];   ///< cos(theta) of k^th final state particle in hadronic system @ LAB wrt to neutrino direction
+  int    fNi;               ///< Nu. of particles in 'primary' hadronic system (before intranuclear rescattering)
+  int    fPdgi[kNPmax];     ///< Pdg code of k^th particle in 'primary' hadronic system
+  int    fResc[kNPmax];     ///< FSI code of k^th particle in 'primary' hadronic system
+  double fEi[kNPmax];       ///< Energy   of k^th particle in 'primary' hadronic system @ LAB
+  double fPxi[kNPmax];      ///< Px       of k^th particle in 'primary' hadronic system @ LAB
+  double fPyi[kNPmax];      ///< Py       of k^th particle in 'primary' hadronic system @ LAB
+  double fPzi[kNPmax];      ///< Pz       of k^th particle in 'primary' hadronic system @ LAB
+  double fVtxX;             ///< Vertex x in detector coord system (SI)
+  double fVtxY;             ///< Vertex y in detector coord system (SI)
+  double fVtxZ;             ///< Vertex z in detector coord system (SI)
+  double fVtxT;             ///< Vertex t in detector coord system (SI)
+  double fSumKEf;           ///< Sum of kinetic energies of all final state particles
+  double fCalResp0;         ///< Approximate calorimetric response to the hadronic system (see Fill())
+};
+
+}      // genie namespace
+#endif // _NTP_GST_RECORD_H_
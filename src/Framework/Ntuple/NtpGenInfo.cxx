@@ -0,0 +1,153 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+
+#include <TTree.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepGenInfo.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpGenInfo.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpGenInfo::NtpGenInfo() :
+ievent(-1), xsec(0), dxsec(0), dxsecps(0),
+hitnuc(0), pxn(0), pyn(0), pzn(0), En(0), eremoval(0),
+resonance(-1), W(-1), Q2(-1), x(-1), y(-1),
+hadronizer(0), ninuke(0)
+{
+
+}
+//____________________________________________________________________________
+NtpGenInfo::~NtpGenInfo()
+{
+
+}
+//____________________________________________________________________________
+void NtpGenInfo::CreateBranches(TTree * tree)
+{
+  assert(tree);
+
+  tree->Branch("iev",         &ievent,     "iev/L"                     );
+  tree->Branch("xsec",        &xsec,       "xsec/D"                    );
+  tree->Branch("dxsec",       &dxsec,      "dxsec/D"                   );
+  tree->Branch("dxsecps",     &dxsecps,    "dxsecps/I"                 );
+  tree->Branch("hitnuc",      &hitnuc,     "hitnuc/I"                  );
+  tree->Branch("pxn",         &pxn,        "pxn/D"                     );
+  tree->Branch("pyn",         &pyn,        "pyn/D"                     );
+  tree->Branch("pzn",         &pzn,        "pzn/D"                     );
+  tree->Branch("En",          &En,         "En/D"                      );
+  tree->Branch("eremoval",    &eremoval,   "eremoval/D"                );
+  tree->Branch("resonance",   &resonance,  "resonance/I"               );
+  tree->Branch("W",           &W,          "W/D"                       );
+  tree->Branch("Q2",          &Q2,         "Q2/D"                      );
+  tree->Branch("x",           &x,          "x/D"                       );
+  tree->Branch("y",           &y,          "y/D"                       );
+  tree->Branch("hadronizer",  &hadronizer, "hadronizer/I"              );
+  tree->Branch("ninuke",      &ninuke,     "ninuke/I"                  );
+  tree->Branch("inukepdg",    inukepdg,    "inukepdg[ninuke]/I"        );
+  tree->Branch("inukefate",   inukefate,   "inukefate[ninuke]/I"       );
+  tree->Branch("inukensteps", inukensteps, "inukensteps[ninuke]/I"     );
+  tree->Branch("inukeke",     inukeke,     "inukeke[ninuke]/D"         );
+  tree->Branch("inukepath",   inukepath,   "inukepath[ninuke]/D"       );
+  tree->Branch("inuketau",    inuketau,    "inuketau[ninuke]/D"        );
+}
+//____________________________________________________________________________
+void NtpGenInfo::SetBranchAddresses(TTree * tree)
+{
+  assert(tree);
+
+  tree->SetBranchAddress("iev",         &ievent     );
+  tree->SetBranchAddress("xsec",        &xsec       );
+  tree->SetBranchAddress("dxsec",       &dxsec      );
+  tree->SetBranchAddress("dxsecps",     &dxsecps    );
+  tree->SetBranchAddress("hitnuc",      &hitnuc     );
+  tree->SetBranchAddress("pxn",         &pxn        );
+  tree->SetBranchAddress("pyn",         &pyn        );
+  tree->SetBranchAddress("pzn",         &pzn        );
+  tree->SetBranchAddress("En",          &En         );
+  tree->SetBranchAddress("eremoval",    &eremoval   );
+  tree->SetBranchAddress("resonance",   &resonance  );
+  tree->SetBranchAddress("W",           &W          );
+  tree->SetBranchAddress("Q2",          &Q2         );
+  tree->SetBranchAddress("x",           &x          );
+  tree->SetBranchAddress("y",           &y          );
+  tree->SetBranchAddress("hadronizer",  &hadronizer );
+  tree->SetBranchAddress("ninuke",      &ninuke     );
+  tree->SetBranchAddress("inukepdg",    inukepdg    );
+  tree->SetBranchAddress("inukefate",   inukefate   );
+  tree->SetBranchAddress("inukensteps", inukensteps );
+  tree->SetBranchAddress("inukeke",     inukeke     );
+  tree->SetBranchAddress("inukepath",   inukepath   );
+  tree->SetBranchAddress("inuketau",    inuketau    );
+}
+//____________________________________________________________________________
+void NtpGenInfo::Fill(Long64_t iev, const EventRecord & event)
+{
+  ievent  = iev;
+  xsec    = event.XSec();
+  dxsec   = event.DiffXSec();
+  dxsecps = (int) event.DiffXSecVars();
+
+  GHepParticle * nucleon = event.HitNucleon();
+  hitnuc   = (nucleon) ? nucleon->Pdg()           : 0;
+  pxn      = (nucleon) ? nucleon->Px()            : 0;
+  pyn      = (nucleon) ? nucleon->Py()            : 0;
+  pzn      = (nucleon) ? nucleon->Pz()            : 0;
+  En       = (nucleon) ? nucleon->E()             : 0;
+  eremoval = (nucleon) ? nucleon->RemovalEnergy() : 0;
+
+  resonance = -1;
+  W = Q2 = x = y = -1;
+  const Interaction * interaction = event.Summary();
+  if(interaction) {
+    resonance = (int) interaction->ExclTag().Resonance();
+    const Kinematics & kine = interaction->Kine();
+    if(kine.KVSet(kKVSelW )) W  = kine.GetKV(kKVSelW );
+    if(kine.KVSet(kKVSelQ2)) Q2 = kine.GetKV(kKVSelQ2);
+    if(kine.KVSet(kKVSelx )) x  = kine.GetKV(kKVSelx );
+    if(kine.KVSet(kKVSely )) y  = kine.GetKV(kKVSely );
+  }
+
+  hadronizer = 0;
+  ninuke     = 0;
+
+  const GHepGenInfo * info = event.GenInfo();
+  if(!info) return;
+
+  hadronizer = (int) info->Hadronizer();
+
+  unsigned int n = info->NINukeSteps();
+  if(n > (unsigned int) kNINukeMax) {
+    LOG("Ntp", pWARN)
+      << "Keeping the first " << kNINukeMax << " of the " << n
+      << " intranuclear transport records of event " << iev;
+    n = kNINukeMax;
+  }
+  ninuke = n;
+  for(unsigned int i = 0; i < n; i++) {
+    const GHepINukeStep & step = info->INukeStep(i);
+    inukepdg    [i] = step.pdg;
+    inukefate   [i] = step.fate;
+    inukeke     [i] = step.ke;
+    inukensteps [i] = step.nsteps;
+    inukepath   [i] = step.path;
+    inuketau    [i] = step.tau;
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,87 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpGenInfo
+
+\brief   Compact per-event block of the intermediate quantities of the event
+         generation (cross sections, hit nucleon momentum & removal energy,
+         resonance, selected kinematics, hadronization model branch and
+         intranuclear transport records), written by NtpWriter in the
+         `ggeninfo' tree alongside the GHEP event tree when the collection
+         of GHepGenInfo is enabled (GEVGGENINFO env. var.). The tree has one
+         entry per GHEP tree entry, so that the reweighting tools can use it
+         as a friend of the GHEP tree instead of re-simulating the events.
+         It takes ~130 bytes per event, plus ~36 bytes per transported hadron
+         (before compression).
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_GEN_INFO_H_
+#define _NTP_GEN_INFO_H_
+
+#ifndef ROOT_Rtypes
+#include "Rtypes.h"
+#endif
+
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpGenInfo {
+
+public :
+  NtpGenInfo();
+ ~NtpGenInfo();
+
+  ///< create the branches in the input tree (for writing)
+  void CreateBranches (TTree * tree);
+
+  ///< set the input tree branch addresses (for reading)
+  void SetBranchAddresses (TTree * tree);
+
+  ///< copy the generation info of the input event
+  void Fill (Long64_t iev, const EventRecord & event);
+
+  ///< tree name
+  static const char * TreeName (void) { return "ggeninfo"; }
+
+  enum { kNINukeMax = 250 };
+
+  Long64_t ievent;      ///< event number (as in NtpMCRecHeader)
+  Double_t xsec;        ///< cross section of the selected interaction (as GHepRecord::XSec())
+  Double_t dxsec;       ///< differential cross section of the selected kinematics (as GHepRecord::DiffXSec())
+  Int_t    dxsecps;     ///< phase space of dxsec (see KinePhaseSpace_t)
+  Int_t    hitnuc;      ///< hit nucleon pdg code (0 if none)
+  Double_t pxn;         ///< hit nucleon px (GeV), incl. Fermi motion
+  Double_t pyn;         ///< hit nucleon py (GeV)
+  Double_t pzn;         ///< hit nucleon pz (GeV)
+  Double_t En;          ///< hit nucleon energy (GeV), incl. binding
+  Double_t eremoval;    ///< hit nucleon removal energy (GeV)
+  Int_t    resonance;   ///< excited resonance (see Resonance_t, -1 if none)
+  Double_t W;           ///< selected hadronic invariant mass (GeV, -1 if not set)
+  Double_t Q2;          ///< selected Q2 (GeV^2, -1 if not set)
+  Double_t x;           ///< selected Bjorken x (-1 if not set)
+  Double_t y;           ///< selected inelasticity y (-1 if not set)
+  Int_t    hadronizer;  ///< hadronization model branch (see GHepHadronizer_t)
+  Int_t    ninuke;      ///< number of hadrons transported through the nucleus
+  Int_t    inukepdg    [kNINukeMax]; ///< transported hadron pdg code
+  Int_t    inukefate   [kNINukeMax]; ///< transported hadron fate (see GHepParticle::RescatterCode())
+  Int_t    inukensteps [kNINukeMax]; ///< number of transport steps
+  Double_t inukeke     [kNINukeMax]; ///< kinetic energy at the start of the transport (GeV)
+  Double_t inukepath   [kNINukeMax]; ///< path length in the nucleus (fm)
+  Double_t inuketau    [kNINukeMax]; ///< integral of dl / (mean free path) along the path
+};
+
+}      // genie namespace
+
+#endif // _NTP_GEN_INFO_H_
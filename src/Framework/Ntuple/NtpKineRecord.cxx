@@ -0,0 +1,143 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+
+#include <TTree.h>
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepUtils.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpKineRecord.h"
+
+using namespace genie;
+using namespace genie::constants;
+
+//____________________________________________________________________________
+NtpKineRecord::NtpKineRecord()
+{
+  // all branch variables are set by Fill()
+}
+//____________________________________________________________________________
+NtpKineRecord::~NtpKineRecord()
+{
+
+}
+//____________________________________________________________________________
+void NtpKineRecord::CreateBranches(TTree * tree)
+{
+  assert(tree);
+
+  // named as the corresponding `gst' branches (see NtpGSTRecord)
+  tree->Branch("iev",       &fIev,        "iev/I"       );
+  tree->Branch("neu",       &fProbe,      "neu/I"       );
+  tree->Branch("fspl",      &fFSPrimLept, "fspl/I"      );
+  tree->Branch("tgt",       &fTarget,     "tgt/I"       );
+  tree->Branch("hitnuc",    &fHitNuc,     "hitnuc/I"    );
+  tree->Branch("scat",      &fScatType,   "scat/I"      );
+  tree->Branch("int",       &fIntType,    "int/I"       );
+  tree->Branch("neut_code", &fCodeNeut,   "neut_code/I" );
+  tree->Branch("resid",     &fResId,      "resid/I"     );
+  tree->Branch("wght",      &fWeight,     "wght/D"      );
+  tree->Branch("Ev",        &fEv,         "Ev/D"        );
+  tree->Branch("xs",        &fKineXs,     "xs/D"        );
+  tree->Branch("ys",        &fKineYs,     "ys/D"        );
+  tree->Branch("Q2s",       &fKineQ2s,    "Q2s/D"       );
+  tree->Branch("Ws",        &fKineWs,     "Ws/D"        );
+  tree->Branch("ts",        &fKineTs,     "ts/D"        );
+  tree->Branch("x",         &fKineX,      "x/D"         );
+  tree->Branch("y",         &fKineY,      "y/D"         );
+  tree->Branch("Q2",        &fKineQ2,     "Q2/D"        );
+  tree->Branch("W",         &fKineW,      "W/D"         );
+  tree->Branch("El",        &fEl,         "El/D"        );
+  tree->Branch("pxl",       &fPxl,        "pxl/D"       );
+  tree->Branch("pyl",       &fPyl,        "pyl/D"       );
+  tree->Branch("pzl",       &fPzl,        "pzl/D"       );
+}
+//____________________________________________________________________________
+bool NtpKineRecord::Fill(int iev, const EventRecord & event)
+{
+// Computes the summary of the input event. The kinematics computed from the
+// primary lepton neglect the fermi momentum & off-shellness of bound
+// nucleons, as for the `gst' tree; they are set to -1 if there is no primary
+// lepton (or no hit nucleon, for x, y and W).
+
+  if(event.IsUnphysical()) {
+    LOG("Ntp", pINFO) << "Skipping unphysical event";
+    return false;
+  }
+
+  GHepParticle * probe   = event.Probe();
+  GHepParticle * target  = event.Particle(1);
+  GHepParticle * fsl     = event.FinalStatePrimaryLepton();
+  GHepParticle * hitnucl = event.HitNucleon();
+  assert(target);
+
+  const Interaction * interaction = event.Summary();
+  const ProcessInfo & proc_info   = interaction->ProcInfo();
+  const Kinematics &  kine        = interaction->Kine();
+  bool is_coh = proc_info.IsCoherent();
+  bool is_dfr = proc_info.IsDiffractive();
+
+  fIev        = iev;
+  fProbe      = (probe)   ? probe->Pdg()   : 0;
+  fFSPrimLept = (fsl)     ? fsl->Pdg()     : 0;
+  fTarget     = target->Pdg();
+  fHitNuc     = (hitnucl) ? hitnucl->Pdg() : 0;
+  fScatType   = (int) proc_info.ScatteringTypeId();
+  fIntType    = (int) proc_info.InteractionTypeId();
+  fCodeNeut   = utils::ghep::NeutReactionCode(&event);
+  fResId      = (proc_info.IsResonant()) ?
+                    (int) interaction->ExclTag().Resonance() : -99;
+  fWeight     = event.Weight();
+
+  // kinematics _exactly_ as they were selected by the generator
+  bool get_selected = true;
+  fKineXs  = kine.x (get_selected);
+  fKineYs  = kine.y (get_selected);
+  fKineQ2s = kine.Q2(get_selected);
+  fKineWs  = kine.W (get_selected);
+  fKineTs  = (is_coh || is_dfr) ? kine.t (get_selected) : -1;
+
+  TLorentzVector k1 = (probe) ? *(probe->P4()) : TLorentzVector(0,0,0,0);
+  fEv = k1.Energy();
+
+  fKineX = fKineY = fKineQ2 = fKineW = -1;
+  fEl = fPxl = fPyl = fPzl = 0;
+  if(fsl) {
+    const TLorentzVector & k2 = *(fsl->P4());
+    fEl  = k2.Energy();
+    fPxl = k2.Px();
+    fPyl = k2.Py();
+    fPzl = k2.Pz();
+
+    TLorentzVector q = k1 - k2;
+    double M  = kNucleonMass;
+    double v  = q.Energy();
+    fKineQ2 = -1 * q.M2();
+    if((hitnucl || is_coh) && v > 0) {
+      double W2 = M*M + 2*M*v - fKineQ2;
+      fKineX = 0.5*fKineQ2/(M*v);
+      fKineY = v/k1.Energy();
+      fKineW = (W2 > 0) ? TMath::Sqrt(W2) : 0;
+    }
+  }
+
+  return true;
+}
+//____________________________________________________________________________
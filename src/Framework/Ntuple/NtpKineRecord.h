@@ -0,0 +1,78 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpKineRecord
+
+\brief   Minimal flat summary of a GENIE event: the probe & target, the
+         interaction codes, the kinematics (as selected and as computed
+         from the primary lepton) and the primary lepton 4-momentum, filled
+         into the branches of a TTree.
+         It is the event tree of the kNFKine format, meant for the samples
+         generated with a truncated chain of event generation modules (see
+         RunOpt --stop-after), for which the hadronic system is not
+         simulated. Unlike NtpGSTRecord it does not look at the hadronic
+         system at all.
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_KINE_RECORD_H_
+#define _NTP_KINE_RECORD_H_
+
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpKineRecord {
+
+public :
+  NtpKineRecord();
+ ~NtpKineRecord();
+
+  ///< create the branches in the input tree
+  void CreateBranches (TTree * tree);
+
+  ///< compute the summary of the input event; returns false if the event
+  ///< is not to be stored (unphysical event)
+  bool Fill (int iev, const EventRecord & event);
+
+private:
+
+  int    fIev;         ///< Event number
+  int    fProbe;       ///< Probe pdg code
+  int    fFSPrimLept;  ///< Final state primary lepton pdg code (0 if not generated)
+  int    fTarget;      ///< Nuclear target pdg code (10LZZZAAAI)
+  int    fHitNuc;      ///< Hit nucleon pdg code (0 if none)
+  int    fScatType;    ///< Scattering type (see ScatteringType_t)
+  int    fIntType;     ///< Interaction type (see InteractionType_t)
+  int    fCodeNeut;    ///< The equivalent NEUT reaction code (if any)
+  int    fResId;       ///< Produced baryon resonance (set for resonance events only)
+  double fWeight;      ///< Event weight
+  double fEv;          ///< Probe energy @ LAB
+  double fKineXs;      ///< Bjorken x as selected (hit nucleon rest frame)
+  double fKineYs;      ///< Inelasticity y as selected
+  double fKineQ2s;     ///< Momentum transfer Q^2 as selected
+  double fKineWs;      ///< Hadronic invariant mass W as selected
+  double fKineTs;      ///< Energy transfer to nucleus at COH/DFR events as selected
+  double fKineX;       ///< Bjorken x from the primary lepton, for a nucleon at rest
+  double fKineY;       ///< Inelasticity y from the primary lepton
+  double fKineQ2;      ///< Momentum transfer Q^2 from the primary lepton
+  double fKineW;       ///< Hadronic invariant mass W from the primary lepton, for a nucleon at rest
+  double fEl;          ///< Final state primary lepton energy @ LAB
+  double fPxl;         ///< Final state primary lepton px @ LAB
+  double fPyl;         ///< Final state primary lepton py @ LAB
+  double fPzl;         ///< Final state primary lepton pz @ LAB
+};
+
+}      // genie namespace
+
+#endif // _NTP_KINE_RECORD_H_
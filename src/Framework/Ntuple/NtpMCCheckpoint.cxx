@@ -0,0 +1,125 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCCheckpoint.h"
+#include "Framework/Numerical/RandomGen.h"
+
+using namespace genie;
+
+ClassImp(NtpMCCheckpoint)
+
+using std::endl;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator<< (ostream& stream, const NtpMCCheckpoint & ckp)
+  {
+     ckp.PrintToStream(stream);
+     return stream;
+  }
+}
+//____________________________________________________________________________
+NtpMCCheckpoint::NtpMCCheckpoint() :
+TNamed("checkpoint","GENIE MC job checkpoint")
+{
+  this->Init();
+}
+//____________________________________________________________________________
+NtpMCCheckpoint::NtpMCCheckpoint(const NtpMCCheckpoint & ckp) :
+TNamed("checkpoint","GENIE MC job checkpoint")
+{
+  this->Copy(ckp);
+}
+//____________________________________________________________________________
+NtpMCCheckpoint::~NtpMCCheckpoint()
+{
+
+}
+//____________________________________________________________________________
+void NtpMCCheckpoint::SaveRandomState(void)
+{
+  RandomGen * rnd = RandomGen::Instance();
+
+  this->seed = rnd->GetSeed();
+  rnd->GetState(this->rndm, this->groot, this->pythia_mrpy, this->pythia_rrpy);
+}
+//____________________________________________________________________________
+void NtpMCCheckpoint::RestoreRandomState(void) const
+{
+  RandomGen * rnd = RandomGen::Instance();
+
+  if(rnd->GetSeed() != this->seed) {
+    LOG("Ntp", pWARN)
+      << "The checkpoint was written with random number seed " << this->seed
+      << " (current seed: " << rnd->GetSeed() << ")";
+  }
+  rnd->SetState(this->rndm, this->groot, this->pythia_mrpy, this->pythia_rrpy);
+}
+//____________________________________________________________________________
+void NtpMCCheckpoint::PrintToStream(ostream & stream) const
+{
+  stream << "MC Job Checkpoint:"                           << endl
+         << "MC run number     -> " << this->runnu         << endl
+         << "Next event        -> " << this->ievent        << endl
+         << "Event tree entries-> " << this->nentries      << endl
+         << "N flux neutrinos  -> " << this->nfluxnu       << endl
+         << "Random num. seed  -> " << this->seed          << endl;
+
+  for(unsigned int i = 0; i < this->trees.size(); i++) {
+    stream << "Output tree       -> " << this->trees[i]
+           << ";" << this->cycles[i] << endl;
+  }
+  if(this->hasfluxcursor && this->fluxcounters.size() > 0) {
+    stream << "Flux ntuple entry -> " << this->fluxcounters[0] << endl;
+  }
+}
+//____________________________________________________________________________
+void NtpMCCheckpoint::Copy(const NtpMCCheckpoint & ckp)
+{
+  this->trees           = ckp.trees;
+  this->cycles          = ckp.cycles;
+  this->nentries        = ckp.nentries;
+  this->runnu           = ckp.runnu;
+  this->ievent          = ckp.ievent;
+  this->rndmevent       = ckp.rndmevent;
+  this->nfluxnu         = ckp.nfluxnu;
+  this->sumfluxintprobs = ckp.sumfluxintprobs;
+  this->seed            = ckp.seed;
+  this->rndm            = ckp.rndm;
+  this->groot           = ckp.groot;
+  this->pythia_mrpy     = ckp.pythia_mrpy;
+  this->pythia_rrpy     = ckp.pythia_rrpy;
+  this->hasfluxcursor   = ckp.hasfluxcursor;
+  this->fluxcounters    = ckp.fluxcounters;
+  this->fluxsums        = ckp.fluxsums;
+}
+//____________________________________________________________________________
+void NtpMCCheckpoint::Init(void)
+{
+  this->trees.clear();
+  this->cycles.clear();
+  this->nentries  = 0;
+  this->runnu     = 0;
+  this->ievent    = 0;
+  this->rndmevent = 0;
+  this->nfluxnu   = 0;
+  this->sumfluxintprobs.clear();
+  this->seed      = 0;
+  this->pythia_mrpy.clear();
+  this->pythia_rrpy.clear();
+  this->hasfluxcursor = false;
+  this->fluxcounters.clear();
+  this->fluxsums.clear();
+}
+//____________________________________________________________________________
@@ -0,0 +1,97 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCCheckpoint
+
+\brief   Checkpoint of a MC job, written periodically in the output file by
+         NtpWriter (see NtpWriter::WriteCheckpoint()). It holds the state
+         needed for continuing an interrupted job, without changing its
+         results: the output trees written so far (their key cycles in the
+         output file), the number of the next event, the state of the random
+         number generators, the normalization counters of the MC job driver
+         and the position of the flux driver in its flux ntuple(s).
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_CHECKPOINT_H_
+#define _NTP_MC_CHECKPOINT_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <map>
+
+#include <TNamed.h>
+#include <TRandom3.h>
+
+using std::string;
+using std::ostream;
+using std::vector;
+using std::map;
+
+namespace genie {
+
+class NtpMCCheckpoint;
+ostream & operator << (ostream & stream, const NtpMCCheckpoint & ckp);
+
+class NtpMCCheckpoint : public TNamed {
+
+public :
+  using TNamed::Copy;
+
+  NtpMCCheckpoint();
+  NtpMCCheckpoint(const NtpMCCheckpoint & ckp);
+  virtual ~NtpMCCheckpoint();
+
+  void Init (void);
+  void Copy (const NtpMCCheckpoint & ckp);
+
+  //! snapshot / restore the state of the random number generators (RandomGen)
+  void SaveRandomState    (void);
+  void RestoreRandomState (void) const;
+
+  void PrintToStream(ostream & stream) const;
+
+  friend ostream & operator << (ostream & stream, const NtpMCCheckpoint & ckp);
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+
+  // output trees
+  vector<string>   trees;        ///< name of the output trees
+  vector<int>      cycles;       ///< key cycle of each output tree in the output file
+  Long64_t         nentries;     ///< number of entries in the event tree
+
+  // MC job
+  Long_t           runnu;        ///< MC job run number
+  Long64_t         ievent;       ///< number of the next event to be generated
+  Long64_t         rndmevent;    ///< event index of the counter-based random number streams (GMCJDriver::EventIndex)
+  Double_t         nfluxnu;      ///< number of flux neutrinos thrown (GMCJDriver::NFluxNeutrinos)
+  map<int, double> sumfluxintprobs; ///< sums of flux interaction probabilities (GMCJDriver::SumFluxIntProbs)
+
+  // random number generators
+  Long_t           seed;         ///< random number seed
+  TRandom3         rndm;         ///< Mersenne Twister state (RandomGen)
+  TRandom3         groot;        ///< ROOT's gRandom state
+  vector<int>      pythia_mrpy;  ///< PYTHIA6 MRPY array
+  vector<double>   pythia_rrpy;  ///< PYTHIA6 RRPY array
+
+  // flux driver (see GFluxFileConfigI::GetFluxCursor())
+  Bool_t           hasfluxcursor; ///< flux driver position saved?
+  vector<Long64_t> fluxcounters;  ///< flux driver position & counters
+  vector<double>   fluxsums;      ///< flux driver sums (POTs, weights, ...)
+
+  ClassDef(NtpMCCheckpoint, 1)
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_CHECKPOINT_H_
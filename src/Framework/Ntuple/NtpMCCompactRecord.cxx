@@ -0,0 +1,271 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+
+#include <TBits.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCCompactRecord.h"
+
+using std::endl;
+
+using namespace genie;
+
+ClassImp(NtpMCCompactRecord)
+
+const int NtpMCCompactRecord::kSchemaVersion;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator<< (ostream& stream, const NtpMCCompactRecord & rec)
+  {
+     rec.PrintToStream(stream);
+     return stream;
+  }
+}
+//____________________________________________________________________________
+namespace {
+  // particle indices are stored relative to the particle position, with
+  // 0 (a particle is never its own mother or daughter) standing for -1
+  Short_t EncodeIndex(int idx, int pos) { return (idx < 0) ? 0 : (Short_t) (idx - pos); }
+  int     DecodeIndex(Short_t d, int pos) { return (d == 0) ? -1 : pos + d; }
+}
+//____________________________________________________________________________
+NtpMCCompactRecord::NtpMCCompactRecord() :
+NtpMCRecordI(),
+interaction(0)
+{
+  this->Init();
+}
+//____________________________________________________________________________
+NtpMCCompactRecord::NtpMCCompactRecord(const NtpMCCompactRecord & rec) :
+NtpMCRecordI(),
+interaction(0)
+{
+  this->Init();
+  this->Copy(rec);
+}
+//____________________________________________________________________________
+NtpMCCompactRecord::~NtpMCCompactRecord()
+{
+  this->Clear();
+}
+//____________________________________________________________________________
+void NtpMCCompactRecord::PrintToStream(ostream & stream) const
+{
+  EventRecord event;
+  this->Unpack(event);
+
+  stream << this->hdr << endl;
+  stream << event     << endl;
+}
+//____________________________________________________________________________
+void NtpMCCompactRecord::Fill(unsigned int ievent, const EventRecord * ev_rec)
+{
+  assert(ev_rec);
+
+  this->Clear();
+
+  hdr.ievent    = ievent;
+  hdr.rndmseed  = ev_rec->RndmSeed();
+  hdr.rndmrun   = ev_rec->RndmRun();
+  hdr.rndmevent = ev_rec->RndmEvent();
+
+  version = kSchemaVersion;
+  weight  = ev_rec->Weight();
+  prob    = ev_rec->Probability();
+  xsec    = ev_rec->XSec();
+  dxsec   = ev_rec->DiffXSec();
+  dxsecps = (int) ev_rec->DiffXSecVars();
+
+  const TLorentzVector * v = ev_rec->Vertex();
+  vtx[0] = v->X();
+  vtx[1] = v->Y();
+  vtx[2] = v->Z();
+  vtx[3] = v->T();
+
+  TBits * ev_flags = ev_rec->EventFlags();
+  TBits * ev_mask  = ev_rec->EventMask();
+  for(unsigned int i = 0; i < 32; i++) {
+    if(i < ev_flags->GetNbits() && ev_flags->TestBitNumber(i)) flags |= (1u << i);
+    if(i < ev_mask ->GetNbits() && ev_mask ->TestBitNumber(i)) mask  |= (1u << i);
+  }
+
+  if(ev_rec->Summary()) interaction = new Interaction(*ev_rec->Summary());
+
+  int np = ev_rec->GetEntries();
+  assert(np < 32767);
+
+  pdg.reserve(np); status.reserve(np); rescat.reserve(np);
+  mom1.reserve(np); mom2.reserve(np); dau1.reserve(np); dau2.reserve(np);
+  px.reserve(np); py.reserve(np); pz.reserve(np); e.reserve(np);
+  x.reserve(np);  y.reserve(np);  z.reserve(np);  t.reserve(np);
+
+  for(int i = 0; i < np; i++) {
+    GHepParticle * p = ev_rec->Particle(i);
+
+    pdg   .push_back (p->Pdg());
+    status.push_back ((Short_t) p->Status());
+    rescat.push_back (p->RescatterCode());
+    mom1  .push_back (EncodeIndex(p->FirstMother(),   i));
+    mom2  .push_back (EncodeIndex(p->LastMother(),    i));
+    dau1  .push_back (EncodeIndex(p->FirstDaughter(), i));
+    dau2  .push_back (EncodeIndex(p->LastDaughter(),  i));
+    px    .push_back (p->Px());
+    py    .push_back (p->Py());
+    pz    .push_back (p->Pz());
+    e     .push_back (p->E());
+    x     .push_back (p->Vx());
+    y     .push_back (p->Vy());
+    z     .push_back (p->Vz());
+    t     .push_back (p->Vt());
+
+    if(p->PolzIsSet() || p->IsBound() || p->RemovalEnergy() != 0.) {
+      xpos  .push_back (i);
+      xpolth.push_back (p->PolzPolarAngle());
+      xpolph.push_back (p->PolzAzimuthAngle());
+      xerm  .push_back (p->RemovalEnergy());
+      xbound.push_back (p->IsBound() ? 1 : 0);
+    }
+  }
+}
+//____________________________________________________________________________
+void NtpMCCompactRecord::Unpack(EventRecord & event) const
+{
+  if(version > kSchemaVersion) {
+    LOG("Ntp", pERROR)
+      << "Compact event record schema version " << version
+      << " is newer than the supported one (" << kSchemaVersion << ")";
+  }
+
+  event.ResetRecord();
+
+  event.SetWeight      (weight);
+  event.SetProbability (prob);
+  event.SetXSec        (xsec);
+  event.SetDiffXSec    (dxsec, (KinePhaseSpace_t) dxsecps);
+  event.SetVertex      (vtx[0], vtx[1], vtx[2], vtx[3]);
+  event.SetRndmCheckpoint(hdr.rndmseed, hdr.rndmrun, hdr.rndmevent);
+
+  event.EventFlags()->ResetAllBits();
+  event.EventMask() ->ResetAllBits();
+  for(unsigned int i = 0; i < 32; i++) {
+    if(flags & (1u << i)) event.EventFlags()->SetBitNumber(i, true);
+    if(mask  & (1u << i)) event.EventMask() ->SetBitNumber(i, true);
+  }
+
+  if(interaction) event.AttachSummary(new Interaction(*interaction));
+
+  // the particles are appended as they are, and the stored mother and
+  // daughter lists are restored after their insertion
+  int np = pdg.size();
+  event.SetAppendOnlyInsertion(true);
+  for(int i = 0; i < np; i++) {
+    event.AddParticle(pdg[i], (GHepStatus_t) status[i],
+                      DecodeIndex(mom1[i], i), DecodeIndex(mom2[i], i), -1, -1,
+                      px[i], py[i], pz[i], e[i], x[i], y[i], z[i], t[i]);
+  }
+  event.SetAppendOnlyInsertion(false);
+
+  for(int i = 0; i < np; i++) {
+    GHepParticle * p = event.Particle(i);
+    p->SetRescatterCode (rescat[i]);
+    p->SetFirstDaughter (DecodeIndex(dau1[i], i));
+    p->SetLastDaughter  (DecodeIndex(dau2[i], i));
+  }
+  for(unsigned int k = 0; k < xpos.size(); k++) {
+    GHepParticle * p = event.Particle(xpos[k]);
+    if(!p) continue;
+    if(xpolth[k] != -999 || xpolph[k] != -999) {
+      p->SetPolarization(xpolth[k], xpolph[k]);
+    }
+    p->SetBound(xbound[k] != 0);
+    p->SetRemovalEnergy(xerm[k]);
+  }
+}
+//____________________________________________________________________________
+void NtpMCCompactRecord::Copy(const NtpMCCompactRecord & rec)
+{
+  this->Clear();
+
+  hdr.Copy(rec.hdr);
+
+  version = rec.version;
+  weight  = rec.weight;
+  prob    = rec.prob;
+  xsec    = rec.xsec;
+  dxsec   = rec.dxsec;
+  dxsecps = rec.dxsecps;
+  for(int i = 0; i < 4; i++) vtx[i] = rec.vtx[i];
+  flags   = rec.flags;
+  mask    = rec.mask;
+  if(rec.interaction) interaction = new Interaction(*rec.interaction);
+
+  pdg    = rec.pdg;
+  status = rec.status;
+  rescat = rec.rescat;
+  mom1   = rec.mom1;
+  mom2   = rec.mom2;
+  dau1   = rec.dau1;
+  dau2   = rec.dau2;
+  px     = rec.px;
+  py     = rec.py;
+  pz     = rec.pz;
+  e      = rec.e;
+  x      = rec.x;
+  y      = rec.y;
+  z      = rec.z;
+  t      = rec.t;
+  xpos   = rec.xpos;
+  xpolth = rec.xpolth;
+  xpolph = rec.xpolph;
+  xerm   = rec.xerm;
+  xbound = rec.xbound;
+}
+//____________________________________________________________________________
+void NtpMCCompactRecord::Init(void)
+{
+  hdr.Init();
+
+  version = kSchemaVersion;
+  weight  = 1.;
+  prob    = 1.;
+  xsec    = 0.;
+  dxsec   = 0.;
+  dxsecps = (int) kPSNull;
+  for(int i = 0; i < 4; i++) vtx[i] = 0.;
+  flags   = 0;
+  mask    = 0;
+}
+//____________________________________________________________________________
+void NtpMCCompactRecord::Clear(Option_t * /*opt*/)
+{
+  if(interaction) delete interaction;
+  interaction = 0;
+
+  pdg.clear();  status.clear(); rescat.clear();
+  mom1.clear(); mom2.clear();   dau1.clear();   dau2.clear();
+  px.clear();   py.clear();     pz.clear();     e.clear();
+  x.clear();    y.clear();      z.clear();      t.clear();
+  xpos.clear(); xpolth.clear(); xpolph.clear(); xerm.clear(); xbound.clear();
+
+  this->Init();
+}
+//____________________________________________________________________________
@@ -0,0 +1,114 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCCompactRecord
+
+\brief   Compact alternative to NtpMCEventRecord (see the kNFCompact format).
+         Rather than streaming every GHepParticle object, the particles are
+         stored as plain arrays:
+          - momenta and positions in single precision,
+          - mother & daughter indices relative to the particle (small ints),
+          - polarization, bound flag and removal energy only for the
+            (few) particles that have them set.
+         The event-level information (weight, cross sections, vertex, flags,
+         interaction summary) is stored as in the full record.
+         Unpack() restores a complete EventRecord, identical to the original
+         apart from the single-precision particle kinematics.
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_COMPACT_RECORD_H_
+#define _NTP_MC_COMPACT_RECORD_H_
+
+#include <ostream>
+#include <vector>
+
+#include "Framework/Ntuple/NtpMCRecordI.h"
+
+using std::ostream;
+using std::vector;
+
+namespace genie {
+
+class Interaction;
+class NtpMCCompactRecord;
+
+ostream & operator<< (ostream& stream, const NtpMCCompactRecord & rec);
+
+class NtpMCCompactRecord : public NtpMCRecordI {
+
+public :
+  NtpMCCompactRecord();
+  NtpMCCompactRecord(const NtpMCCompactRecord & rec);
+  virtual ~NtpMCCompactRecord();
+
+  ///< encode the input event
+  void Fill   (unsigned int ievent, const EventRecord * ev_rec);
+
+  ///< decode the stored event into the input event record
+  void Unpack (EventRecord & event) const;
+
+  void Copy   (const NtpMCCompactRecord & rec);
+  void Clear  (Option_t * opt = "");
+  void PrintToStream(ostream & stream) const;
+
+  friend ostream & operator<< (ostream& stream, const NtpMCCompactRecord & rec);
+
+  ///< encoding schema version written by Fill()
+  static const int kSchemaVersion = 1;
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+
+  Int_t            version;  ///< encoding schema version
+  Double_t         weight;   ///< event weight
+  Double_t         prob;     ///< event probability
+  Double_t         xsec;     ///< cross section for the selected event
+  Double_t         dxsec;    ///< differential cross section for the selected event kinematics
+  Int_t            dxsecps;  ///< differential cross section phase space (see KinePhaseSpace_t)
+  Double_t         vtx[4];   ///< vertex x,y,z,t in the detector coordinate system
+  UInt_t           flags;    ///< event flags (bit i: GHEP flag i, see GHepFlags)
+  UInt_t           mask;     ///< unphysical event mask
+  Interaction *    interaction; ///< interaction summary (may be 0)
+
+  vector<Int_t>    pdg;      ///< particle pdg codes
+  vector<Short_t>  status;   ///< particle status codes (see GHepStatus_t)
+  vector<Int_t>    rescat;   ///< particle rescattering codes
+  vector<Short_t>  mom1;     ///< first mother  - particle position (0: no mother)
+  vector<Short_t>  mom2;     ///< last mother   - particle position (0: no mother)
+  vector<Short_t>  dau1;     ///< first daughter - particle position (0: no daughter)
+  vector<Short_t>  dau2;     ///< last daughter  - particle position (0: no daughter)
+  vector<Float_t>  px;       ///< particle px (GeV)
+  vector<Float_t>  py;       ///< particle py (GeV)
+  vector<Float_t>  pz;       ///< particle pz (GeV)
+  vector<Float_t>  e;        ///< particle energy (GeV)
+  vector<Float_t>  x;        ///< particle x (fm)
+  vector<Float_t>  y;        ///< particle y (fm)
+  vector<Float_t>  z;        ///< particle z (fm)
+  vector<Float_t>  t;        ///< particle t
+
+  vector<Short_t>  xpos;     ///< positions of the particles with polarization / bound flag / removal energy set
+  vector<Double_t> xpolth;   ///< their polar polarization angle (rad, -999 if not set)
+  vector<Double_t> xpolph;   ///< their azimuthal polarization angle (rad, -999 if not set)
+  vector<Double_t> xerm;     ///< their removal energy (GeV)
+  vector<Char_t>   xbound;   ///< their bound flag
+
+private:
+
+  void Init (void);
+
+ClassDef(NtpMCCompactRecord, 1)
+
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_COMPACT_RECORD_H_
@@ -59,25 +59,28 @@ void NtpMCEventRecord::PrintToStream(ostream & stream) const
 void NtpMCEventRecord::Fill(unsigned int ievent, const EventRecord * ev_rec)
 {
   this->event->Copy(*ev_rec);
-  this->hdr.ievent = ievent;
+  this->hdr.ievent    = ievent;
+  this->hdr.rndmseed  = ev_rec->RndmSeed();
+  this->hdr.rndmrun   = ev_rec->RndmRun();
+  this->hdr.rndmevent = ev_rec->RndmEvent();
 }
 //____________________________________________________________________________
 void NtpMCEventRecord::Copy(const NtpMCEventRecord & ntpmcrec)
 {
   this->event->Copy(*ntpmcrec.event);
-  this->hdr.ievent = ntpmcrec.hdr.ievent;
+  this->hdr.Copy(ntpmcrec.hdr);
 }
 //____________________________________________________________________________
 void NtpMCEventRecord::Init(void)
 {
   this->event      = new EventRecord;
-  this->hdr.ievent = 0;
+  this->hdr.Init();
 }
 //____________________________________________________________________________
 void NtpMCEventRecord::Clear(Option_t * /*opt*/)
 {
   delete (this->event);
   this->event      = 0;
-  this->hdr.ievent = 0;
+  this->hdr.Init();
 }
 //____________________________________________________________________________
@@ -28,7 +28,10 @@ namespace genie {
 typedef enum ENtpMCFormat {
 
    kNFUndefined = -1,
-   kNFGHEP   /* each mc tree leaf contains the full GHEP EventRecord */
+   kNFGHEP,  /* each mc tree leaf contains the full GHEP EventRecord */
+   kNFFlat,  /* flat `gst' summary tree of primitive branches (see NtpGSTRecord) */
+   kNFCompact, /* each mc tree leaf contains a compact encoding of the GHEP EventRecord (see NtpMCCompactRecord) */
+   kNFKine    /* flat `gkine' tree of the event kinematics only (see NtpKineRecord) */
 
 } NtpMCFormat_t;
 
@@ -42,6 +45,15 @@ class NtpMCFormat {
      case kNFGHEP:
               return "[NtpMCEventRecord]";
               break;
+     case kNFFlat:
+              return "[NtpGSTRecord]";
+              break;
+     case kNFCompact:
+              return "[NtpMCCompactRecord]";
+              break;
+     case kNFKine:
+              return "[NtpKineRecord]";
+              break;
      default:
               break;
      }
@@ -60,6 +72,15 @@ class NtpMCFormat {
      case kNFGHEP:
               return "ghep";
               break;
+     case kNFFlat:
+              return "gst";
+              break;
+     case kNFCompact:
+              return "cghep";
+              break;
+     case kNFKine:
+              return "gkine";
+              break;
      default:
               break;
      }
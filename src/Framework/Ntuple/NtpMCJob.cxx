@@ -0,0 +1,272 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#include <TTree.h>
+
+#include "Framework/EventGen/ChannelBias.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GFluxI.h"
+#include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCJob.h"
+#include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpMCTreeHeader.h"
+#include "Framework/Ntuple/NtpMCCheckpoint.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+
+using namespace genie;
+
+// set by the SIGTERM handler, to end the event loop gracefully
+static volatile sig_atomic_t gNtpMCJobSigTERM = 0;
+
+static void NtpMCJobSIGTERMHandler(int /* s */)
+{
+  gNtpMCJobSigTERM = 1;
+  std::cerr << "Caught SIGTERM" << std::endl;
+}
+//____________________________________________________________________________
+NtpMCJob::NtpMCJob(string name, NtpMCFormat_t fmt, Long_t runnu) :
+fName(name),
+fMCJDriver(0),
+fFormat(fmt),
+fRunNu(runnu),
+fFilenamePrefix(""),
+fNev(-1),
+fExposure(-1),
+fAsync(RunOpt::Instance()->AsyncOutput()),
+fInterrupted(false)
+{
+
+}
+//____________________________________________________________________________
+NtpMCJob::~NtpMCJob()
+{
+
+}
+//____________________________________________________________________________
+long int NtpMCJob::Run(GMCJDriver * mcj_driver)
+{
+  fMCJDriver   = mcj_driver;
+  fInterrupted = false;
+
+  RunOpt * opt = RunOpt::Instance();
+
+  // Initialize an Ntuple Writer to save GHEP records into a TTree
+  NtpWriter ntpw(fFormat, fRunNu);
+  if(fFilenamePrefix.size() > 0) ntpw.CustomizeFilenamePrefix(fFilenamePrefix);
+  ntpw.SetAsynchronous(fAsync);
+  ntpw.Initialize();
+
+  // Add the experiment-specific branches (eg flux pass-through info)
+  this->AddBranches(ntpw);
+
+  // Create a MC job monitor for a periodically updated status file
+  GMCJMonitor mcjmonitor(fRunNu);
+  mcjmonitor.SetRefreshRate(opt->MCJobStatusRefreshRate());
+  mcjmonitor.SetMCJDriver(mcj_driver);
+
+  // define handler to allow signal to end job gracefully
+  gNtpMCJobSigTERM = 0;
+  signal(SIGTERM, NtpMCJobSIGTERMHandler);
+
+  long int ievent = 0;
+
+  // Continue an interrupted job from its last checkpoint, if requested
+  long int ckp_interval = opt->CheckpointInterval();
+  if(opt->Restart()) {
+    NtpMCCheckpoint checkpoint;
+    if(!ntpw.Restart(checkpoint)) {
+      LOG(fName, pFATAL) << "Could not restart the MC job - Exiting";
+      exit(1);
+    }
+    this->RestoreCheckpoint(checkpoint);
+    ievent = checkpoint.ievent;
+  }
+
+  GFluxI * flux_driver = mcj_driver->FluxDriverPtr();
+
+  while(!gNtpMCJobSigTERM)
+  {
+     LOG(fName, pNOTICE) << " *** Generating event............ " << ievent;
+
+     // In case the required statistics was expressed as 'number of events'
+     // then quit if that number has been generated
+     if(fNev > 0 && ievent >= fNev) break;
+
+     // In case the required statistics was expressed as an exposure (POT)
+     // then quit if the requested exposure has been generated
+     if(fExposure > 0) {
+        double fexposure = this->Exposure();           // flux exposure used
+        double psc       = mcj_driver->GlobProbScale(); // interaction prob. scale
+        if(fexposure >= 0 && psc > 0 && fexposure/psc >= fExposure) break;
+     }
+
+     // Generate a single event using neutrinos coming from the specified flux
+     // and hitting the specified geometry or target mix
+     EventRecord * event = mcj_driver->GenerateEvent();
+
+     // Check whether a null event was returned due to the flux driver reaching
+     // the end of the input flux ntuple - exit the event generation loop
+     if(!event && flux_driver && flux_driver->End()) {
+        LOG(fName, pNOTICE)
+          << "** The flux driver read all the input flux entries: End()==true";
+        break;
+     }
+     if(!event) {
+        LOG(fName, pERROR)
+          << "Got a null generated neutino event! Retrying ...";
+        continue;
+     }
+     LOG(fName, pINFO) << "Generated event: " << *event;
+
+     // Add event at the output ntuple, refresh the mc job monitor & clean-up
+     this->EventGenerated(ievent, *event);
+     ntpw.AddEventRecord(ievent, event);
+     if(mcjmonitor.MetricsEnabled()) {
+       mcjmonitor.SetGauge("writer_queue_depth", ntpw.QueueDepth());
+     }
+     mcjmonitor.Update(ievent, event);
+     mcj_driver->RecycleEvent(event);
+     this->EventWritten(ievent);
+     ievent++;
+
+     // Periodically save the job state, for restarting an interrupted job
+     if(ckp_interval > 0 && ievent % ckp_interval == 0) {
+        this->WriteCheckpoint(ntpw, ievent);
+     }
+  }
+
+  // The job was ended early: keep a checkpoint for restarting it
+  fInterrupted = (gNtpMCJobSigTERM != 0);
+  signal(SIGTERM, SIG_DFL);
+  if(fInterrupted && ckp_interval > 0) {
+    this->WriteCheckpoint(ntpw, ievent);
+    ntpw.KeepCheckpoint();
+  }
+
+  LOG(fName, pNOTICE)
+    << "The GENIE MC job is done generating events - Cleaning up & exiting...";
+
+  // Report the effective exposure of each oversampled channel
+  ChannelBias * bias = ChannelBias::Instance();
+  if(bias->Enabled()) {
+    double fexposure = this->Exposure();
+    double psc       = mcj_driver->GlobProbScale();
+    std::ostringstream report;
+    bias->Print(report, (fexposure >= 0 && psc > 0) ? fexposure/psc : -1);
+    LOG(fName, pNOTICE) << "\n" << report.str();
+  }
+
+  // Print the job statistics & add the experiment-specific normalization
+  // and meta-data
+  this->Finalize(ntpw, ievent);
+
+  // store the sample normalization in the tree header (combined by gmerge
+  // when the outputs of a production split in jobs are merged)
+  NtpMCTreeHeader * tree_header = ntpw.TreeHeader();
+  if(tree_header) {
+    tree_header->nfluxnu         = mcj_driver->NFluxNeutrinos();
+    tree_header->globprobscale   = mcj_driver->GlobProbScale();
+    tree_header->sumfluxintprobs = mcj_driver->SumFluxIntProbs();
+  }
+
+  // Save the generated event tree & close the output file
+  ntpw.Save();
+
+  utils::app_init::MemoryReport("at the end of the job");
+
+  fMCJDriver = 0;
+
+  return ievent;
+}
+//____________________________________________________________________________
+void NtpMCJob::StoreSampleExposure(NtpWriter & ntpw, double exposure)
+{
+  if(ntpw.EventTree()) ntpw.EventTree()->SetWeight(exposure);
+  if(ntpw.TreeHeader()) ntpw.TreeHeader()->pot = exposure;
+}
+//____________________________________________________________________________
+void NtpMCJob::WriteCheckpoint(NtpWriter & ntpw, long int ievent)
+{
+  NtpMCCheckpoint checkpoint;
+
+  checkpoint.ievent          = ievent;
+  checkpoint.rndmevent       = fMCJDriver->EventIndex();
+  checkpoint.nfluxnu         = fMCJDriver->NFluxNeutrinos();
+  checkpoint.sumfluxintprobs = fMCJDriver->SumFluxIntProbs();
+  checkpoint.SaveRandomState();
+  checkpoint.hasfluxcursor   = this->SaveFluxState(checkpoint);
+
+  ntpw.WriteCheckpoint(checkpoint);
+}
+//____________________________________________________________________________
+void NtpMCJob::RestoreCheckpoint(const NtpMCCheckpoint & checkpoint)
+{
+  fMCJDriver->RestoreCounters(
+      (long int) checkpoint.nfluxnu, checkpoint.sumfluxintprobs);
+  fMCJDriver->SetEventIndex(checkpoint.rndmevent);
+
+  checkpoint.RestoreRandomState();
+
+  if(!this->RestoreFluxState(checkpoint)) {
+    LOG(fName, pFATAL)
+      << "Could not restore the position of the flux driver - Exiting";
+    exit(1);
+  }
+
+  LOG(fName, pNOTICE)
+    << "Continuing the MC job from event " << checkpoint.ievent;
+}
+//____________________________________________________________________________
+void NtpMCJob::AddBranches(NtpWriter & /* ntpw */)
+{
+
+}
+//____________________________________________________________________________
+double NtpMCJob::Exposure(void) const
+{
+  return -1;
+}
+//____________________________________________________________________________
+void NtpMCJob::EventGenerated(int /* ievent */, const EventRecord & /* event */)
+{
+
+}
+//____________________________________________________________________________
+void NtpMCJob::EventWritten(int /* ievent */)
+{
+
+}
+//____________________________________________________________________________
+bool NtpMCJob::SaveFluxState(NtpMCCheckpoint & /* checkpoint */) const
+{
+  return false;
+}
+//____________________________________________________________________________
+bool NtpMCJob::RestoreFluxState(const NtpMCCheckpoint & /* checkpoint */)
+{
+  return true;
+}
+//____________________________________________________________________________
+void NtpMCJob::Finalize(NtpWriter & /* ntpw */, long int /* nev */)
+{
+
+}
+//____________________________________________________________________________
@@ -0,0 +1,132 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCJob
+
+\brief   The event generation loop of the flux & geometry driven MC jobs
+         (gevgen_t2k, gevgen_fnal, ...): generates the events with a
+         configured GMCJDriver and writes them with an NtpWriter, updating
+         a GMCJMonitor status file, until the requested number of events or
+         exposure is reached, the flux driver reads all its entries or the
+         job is sent a SIGTERM.
+
+         It takes care of the pieces common to all these jobs, so that they
+         all benefit from them:
+         - the asynchronous writer (see RunOpt --async-output),
+         - periodic checkpoints & restart of interrupted jobs (see RunOpt
+           --checkpoint-interval & --restart), with the job kept restartable
+           when it is ended early by a SIGTERM,
+         - the sample normalization stored in the tree header (combined by
+           gmerge over the shards of a split production, see --shard i/N),
+         - the job metrics of GMCJMonitor, including the flux neutrinos per
+           event and the writer queue depth (see GMCJMONMETRICS),
+         - the effective exposure of the oversampled channels, reported at
+           the end of the job (see RunOpt --channel-bias & ChannelBias).
+
+         The experiment-specific pieces (pass-through flux branches, flux
+         exposure & position in the flux ntuples, meta-data) are provided by
+         the applications, which derive from NtpMCJob and override the
+         protected hooks.
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_JOB_H_
+#define _NTP_MC_JOB_H_
+
+#include <string>
+
+#include "Framework/Ntuple/NtpMCFormat.h"
+
+using std::string;
+
+namespace genie {
+
+class EventRecord;
+class GMCJDriver;
+class NtpWriter;
+class NtpMCCheckpoint;
+
+class NtpMCJob {
+
+public :
+  NtpMCJob(string name, NtpMCFormat_t fmt = kNFGHEP, Long_t runnu = 0);
+  virtual ~NtpMCJob();
+
+  ///< use before Run() to set the output filename prefix (see NtpWriter)
+  void SetFilenamePrefix (string prefix) { fFilenamePrefix = prefix; }
+
+  ///< use before Run() to stop after nev events (<= 0: no limit)
+  void SetNumOfEvents (long int nev) { fNev = nev; }
+
+  ///< use before Run() to stop once the exposure of the generated sample
+  ///< (Exposure() / GMCJDriver::GlobProbScale(), eg in POT) reaches the
+  ///< input value (<= 0: no limit)
+  void SetExposure (double exposure) { fExposure = exposure; }
+
+  ///< use before Run() to override the RunOpt --async-output setting
+  void SetAsynchronous (bool async) { fAsync = async; }
+
+  ///< generate events with the input (configured) driver and save them;
+  ///< returns the number of events in the output
+  long int Run (GMCJDriver * mcj_driver);
+
+  ///< was the job ended early by a SIGTERM?
+  bool Interrupted (void) const { return fInterrupted; }
+
+protected :
+
+  ///< add the experiment-specific branches to the event tree (called after
+  ///< NtpWriter::Initialize(); the writer is then synchronous, see
+  ///< NtpWriter::SetAsynchronous())
+  virtual void AddBranches (NtpWriter & ntpw);
+
+  ///< the flux exposure used so far (eg POT in the flux ntuples), < 0 if it
+  ///< is not known
+  virtual double Exposure (void) const;
+
+  ///< called for each generated event, before and after writing it
+  virtual void EventGenerated (int ievent, const EventRecord & event);
+  virtual void EventWritten   (int ievent);
+
+  ///< save / restore the position of the flux driver in checkpoints (see
+  ///< GFluxFileConfigI::GetFluxCursor()). By default the flux has no state
+  ///< beyond the random number generators.
+  virtual bool SaveFluxState    (NtpMCCheckpoint & checkpoint) const;
+  virtual bool RestoreFluxState (const NtpMCCheckpoint & checkpoint);
+
+  ///< called at the end of the job, before saving the output (print the job
+  ///< statistics, add meta-data, ...)
+  virtual void Finalize (NtpWriter & ntpw, long int nev);
+
+  ///< store the exposure of the generated sample (eg POT) as the event tree
+  ///< weight and in the tree header; use from Finalize()
+  void StoreSampleExposure (NtpWriter & ntpw, double exposure);
+
+  string       fName;       ///< name used in the log messages
+  GMCJDriver * fMCJDriver;  ///< event generation driver (during Run())
+
+private :
+
+  void WriteCheckpoint   (NtpWriter & ntpw, long int ievent);
+  void RestoreCheckpoint (const NtpMCCheckpoint & checkpoint);
+
+  NtpMCFormat_t fFormat;
+  Long_t        fRunNu;
+  string        fFilenamePrefix;
+  long int      fNev;
+  double        fExposure;
+  bool          fAsync;
+  bool          fInterrupted;
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_JOB_H_
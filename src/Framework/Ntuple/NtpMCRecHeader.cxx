@@ -10,6 +10,8 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the random number checkpoint (rndmseed, rndmrun, rndmevent).
 
 */
 //____________________________________________________________________________
@@ -49,16 +51,27 @@ NtpMCRecHeader::~NtpMCRecHeader()
 void NtpMCRecHeader::PrintToStream(ostream & stream) const
 {
   stream << "\n\n*** Event #: " << this->ievent;
+  if(this->rndmevent >= 0) {
+    stream << " [rndm checkpoint: seed = " << this->rndmseed
+           << ", run = " << this->rndmrun
+           << ", event index = " << this->rndmevent << "]";
+  }
 }
 //____________________________________________________________________________
 void NtpMCRecHeader::Copy(const NtpMCRecHeader & hdr)
 {
-  this->ievent = hdr.ievent;
+  this->ievent    = hdr.ievent;
+  this->rndmseed  = hdr.rndmseed;
+  this->rndmrun   = hdr.rndmrun;
+  this->rndmevent = hdr.rndmevent;
 }
 //____________________________________________________________________________
 void NtpMCRecHeader::Init(void)
 {
-  this->ievent = 0;
+  this->ievent    =  0;
+  this->rndmseed  = -1;
+  this->rndmrun   = -1;
+  this->rndmevent = -1;
 }
 //____________________________________________________________________________
 
@@ -5,6 +5,11 @@
 
 \brief   MINOS-style Ntuple Class to hold an MC Event Record Header
 
+         When counter-based random number streams are used (see RandomGen),
+         the header also stores the (seed, run, event index) triplet keying
+         the streams of the event, so that it can be re-generated on its own
+         (see gevgen --replay).
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -47,9 +52,12 @@ public :
 
   // Ntuple is treated like a C-struct with public data members and
   // rule-breaking field data members not prefaced by "f" and mostly lowercase.
-  unsigned int  ievent;  ///< Event number
+  unsigned int  ievent;    ///< Event number
+  Long64_t      rndmseed;  ///< Random number checkpoint: seed     (-1 if not stored)
+  Long64_t      rndmrun;   ///< Random number checkpoint: run      (-1 if not stored)
+  Long64_t      rndmevent; ///< Random number checkpoint: event index of the counter-based streams (-1 if not stored)
 
-  ClassDef(NtpMCRecHeader, 1)
+  ClassDef(NtpMCRecHeader, 2)
 };
 
 }      // genie namespace
@@ -10,6 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the job (shard) and sample normalization fields (version 2).
+  Added the event filter statistics (version 3).
 
 */
 //____________________________________________________________________________
@@ -66,6 +69,30 @@ void NtpMCTreeHeader::PrintToStream(ostream & stream) const
          << "NtpRecord Format  -> " << sformat      << endl
          << "GENIE CVS Vrs Nu  -> " << scvstag      << endl
          << "File generated at -> " << this->datime << endl;
+
+  if(this->nshards > 1 || this->ishard < 0) {
+    stream << "Production shard  -> ";
+    if(this->ishard < 0) stream << "merged";
+    else                 stream << this->ishard;
+    stream << " of " << this->nshards << endl;
+  }
+  stream << "Random num. seed  -> " << this->seed << endl;
+  if(this->pot > 0) {
+    stream << "Exposure (POT)    -> " << this->pot << endl;
+  }
+  if(this->nfluxnu > 0) {
+    stream << "N flux neutrinos  -> " << this->nfluxnu << endl
+           << "Int. prob. scale  -> " << this->globprobscale << endl;
+  }
+  map<int, double>::const_iterator it = this->sumfluxintprobs.begin();
+  for( ; it != this->sumfluxintprobs.end(); ++it) {
+    stream << "Sum flux int. prob. (pdg = " << it->first << ") -> "
+           << it->second << endl;
+  }
+  if(this->nfilttried > 0) {
+    stream << "Event filter      -> " << this->nfiltaccepted << " / "
+           << this->nfilttried << " events accepted" << endl;
+  }
 }
 //____________________________________________________________________________
 void NtpMCTreeHeader::Copy(const NtpMCTreeHeader & hdr)
@@ -74,6 +101,16 @@ void NtpMCTreeHeader::Copy(const NtpMCTreeHeader & hdr)
   this->cvstag.SetString(hdr.cvstag.GetString().Data());
   this->datime.Copy(hdr.datime);
   this->runnu  = hdr.runnu;
+
+  this->ishard          = hdr.ishard;
+  this->nshards         = hdr.nshards;
+  this->seed            = hdr.seed;
+  this->pot             = hdr.pot;
+  this->nfluxnu         = hdr.nfluxnu;
+  this->globprobscale   = hdr.globprobscale;
+  this->sumfluxintprobs = hdr.sumfluxintprobs;
+  this->nfilttried      = hdr.nfilttried;
+  this->nfiltaccepted   = hdr.nfiltaccepted;
 }
 //____________________________________________________________________________
 void NtpMCTreeHeader::Init(void)
@@ -96,5 +133,15 @@ void NtpMCTreeHeader::Init(void)
   this->cvstag.SetString(version.c_str());
   this->datime.Now();
   this->runnu  = 0;
+
+  this->ishard        = 0;
+  this->nshards       = 1;
+  this->seed          = 0;
+  this->pot           = 0;
+  this->nfluxnu       = 0;
+  this->globprobscale = 0;
+  this->sumfluxintprobs.clear();
+  this->nfilttried    = 0;
+  this->nfiltaccepted = 0;
 }
 //____________________________________________________________________________
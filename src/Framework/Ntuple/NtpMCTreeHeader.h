@@ -20,6 +20,7 @@
 #define _NTP_MC_TREE_HEADER_H_
 
 #include <ostream>
+#include <map>
 
 #include <TNamed.h>
 #include <TObjString.h>
@@ -29,6 +30,7 @@
 
 using std::string;
 using std::ostream;
+using std::map;
 
 namespace genie {
 
@@ -59,7 +61,21 @@ public :
   NtpMCDTime    datime;  ///< Date and Time that the event ntuple was generated
   Long_t        runnu;   ///< MC Job run number
 
-  ClassDef(NtpMCTreeHeader, 1)
+  // Production split in jobs (see RunOpt, --shard i/N) and sample
+  // normalization, combined by gmerge when the job outputs are merged.
+  // The normalization fields are set by the driver apps, if available.
+
+  Int_t         ishard;  ///< Job (shard) index, or -1 for merged outputs
+  Int_t         nshards; ///< Number of jobs the production was split in
+  Long_t        seed;    ///< Random number seed used by the job
+  Double_t      pot;     ///< Exposure (POT) represented by the sample, 0 if not set
+  Double_t      nfluxnu; ///< Number of flux neutrinos thrown (GMCJDriver::NFluxNeutrinos)
+  Double_t      globprobscale;         ///< Interaction probability scale (GMCJDriver::GlobProbScale)
+  map<int, double> sumfluxintprobs;    ///< Sum of flux interaction probabilities per flux neutrino pdg code (GMCJDriver::SumFluxIntProbs)
+  Double_t      nfilttried;            ///< Number of events run through the event filter (EventFilterI), 0 if not used
+  Double_t      nfiltaccepted;         ///< Number of events accepted by the event filter
+
+  ClassDef(NtpMCTreeHeader, 3)
 };
 
 }      // genie namespace
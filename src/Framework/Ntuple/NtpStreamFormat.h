@@ -0,0 +1,63 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpStreamFormat
+
+\brief    Encapsulates an enumeration of possible GENIE event stream formats
+          (see NtpStreamWriter)
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_STREAM_FORMAT_H_
+#define _NTP_STREAM_FORMAT_H_
+
+#include <string>
+
+using std::string;
+
+namespace genie {
+
+typedef enum ENtpStreamFormat {
+
+   kNSUndefined = -1,
+   kNSBinary,  /* compact binary event records (see NtpStreamWriter) */
+   kNSHepMC3   /* HepMC3 Asciiv3 event listing */
+
+} NtpStreamFormat_t;
+
+class NtpStreamFormat {
+ public:
+  static const char * AsString(NtpStreamFormat_t fmt) {
+     switch (fmt) {
+     case kNSUndefined:
+              return "undefined";
+              break;
+     case kNSBinary:
+              return "binary";
+              break;
+     case kNSHepMC3:
+              return "hepmc3";
+              break;
+     default:
+              break;
+     }
+     return " ";
+  }
+
+  static NtpStreamFormat_t FromString(string fmt) {
+     if(fmt == "binary") return kNSBinary;
+     if(fmt == "hepmc3") return kNSHepMC3;
+     return kNSUndefined;
+  }
+};
+
+}
+#endif
@@ -0,0 +1,186 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstring>
+
+#include <unistd.h>
+
+#include <TBits.h>
+
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpStreamReader.h"
+#include "Framework/Utils/SystemUtils.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpStreamReader::NtpStreamReader() :
+fFd(-1),
+fOwnFd(false),
+fPos(0),
+fEventNumber(-1),
+fNEvents(0)
+{
+
+}
+//____________________________________________________________________________
+NtpStreamReader::~NtpStreamReader()
+{
+  this->Close();
+}
+//____________________________________________________________________________
+bool NtpStreamReader::Open(string source)
+{
+  this->Close();
+
+  LOG("Ntp", pNOTICE) << "Opening event stream: " << source;
+
+  fFd    = utils::system::OpenStreamSource(source);
+  fOwnFd = (fFd >= 0 && fFd != STDIN_FILENO);
+  if(fFd < 0) return false;
+
+  fEventNumber = -1;
+  fNEvents     = 0;
+
+  char  magic[8];
+  Int_t version = 0;
+  bool ok =
+     utils::system::ReadFully(fFd, magic, sizeof(magic)) &&
+     utils::system::ReadFully(fFd, (char *) &version, sizeof(version));
+  if(!ok || strncmp(magic, "GENIEEVS", sizeof(magic)) != 0) {
+    LOG("Ntp", pERROR) << source << " is not a binary GENIE event stream";
+    this->Close();
+    return false;
+  }
+  if(version != 1) {
+    LOG("Ntp", pERROR)
+      << "Unsupported event stream version: " << version
+      << " (or a stream written with a different byte order)";
+    this->Close();
+    return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+void NtpStreamReader::Close(void)
+{
+  if(fFd < 0) return;
+  if(fOwnFd) close(fFd);
+  fFd = -1;
+}
+//____________________________________________________________________________
+EventRecord * NtpStreamReader::ReadEvent(void)
+{
+  if(fFd < 0) return 0;
+
+  Int_t nbytes = 0;
+  if(!utils::system::ReadFully(fFd, (char *) &nbytes, sizeof(nbytes))) {
+    LOG("Ntp", pERROR) << "Event stream ended without an end-of-stream marker";
+    this->Close();
+    return 0;
+  }
+  if(nbytes <= 0) {
+    LOG("Ntp", pNOTICE) << "End of event stream, after " << fNEvents << " events";
+    this->Close();
+    return 0;
+  }
+
+  fRecord.resize(nbytes);
+  fPos = 0;
+  if(!utils::system::ReadFully(fFd, &fRecord[0], nbytes)) {
+    LOG("Ntp", pERROR) << "Truncated event record in event stream";
+    this->Close();
+    return 0;
+  }
+
+  EventRecord * event = new EventRecord;
+
+  fEventNumber = GetLong();
+  int flags = GetInt();
+  event->SetWeight      (GetDouble());
+  event->SetProbability (GetDouble());
+  event->SetXSec        (GetDouble());
+  double dxsec = GetDouble();
+  event->SetDiffXSec    (dxsec, (KinePhaseSpace_t) GetInt());
+  double vx = GetDouble();
+  double vy = GetDouble();
+  double vz = GetDouble();
+  double vt = GetDouble();
+  event->SetVertex(vx, vy, vz, vt);
+  for(int i = 0; i < 32; i++) {
+    if(flags & (1 << i)) event->EventFlags()->SetBitNumber(i, true);
+  }
+
+  // the particles are appended as they are, and the daughter lists stored
+  // in the stream are restored after their insertion
+  int np = GetInt();
+  vector<int> dau1(np), dau2(np);
+  event->SetAppendOnlyInsertion(true);
+  for(int i = 0; i < np; i++) {
+    int pdg  = GetInt();
+    int ist  = GetInt();
+    int resc = GetInt();
+    int mom1 = GetInt();
+    int mom2 = GetInt();
+    dau1[i]  = GetInt();
+    dau2[i]  = GetInt();
+    double px = GetDouble();
+    double py = GetDouble();
+    double pz = GetDouble();
+    double E  = GetDouble();
+    double x  = GetDouble();
+    double y  = GetDouble();
+    double z  = GetDouble();
+    double t  = GetDouble();
+    event->AddParticle(pdg, (GHepStatus_t) ist, mom1, mom2, -1, -1,
+                       px, py, pz, E, x, y, z, t);
+    event->Particle(i)->SetRescatterCode(resc);
+  }
+  event->SetAppendOnlyInsertion(false);
+  for(int i = 0; i < np; i++) {
+    event->Particle(i)->SetFirstDaughter(dau1[i]);
+    event->Particle(i)->SetLastDaughter (dau2[i]);
+  }
+
+  fNEvents++;
+  return event;
+}
+//____________________________________________________________________________
+int NtpStreamReader::GetInt(void)
+{
+  Int_t v = 0;
+  if(fPos + sizeof(v) <= fRecord.size()) memcpy(&v, &fRecord[fPos], sizeof(v));
+  fPos += sizeof(v);
+  return v;
+}
+//____________________________________________________________________________
+Long64_t NtpStreamReader::GetLong(void)
+{
+  Long64_t v = 0;
+  if(fPos + sizeof(v) <= fRecord.size()) memcpy(&v, &fRecord[fPos], sizeof(v));
+  fPos += sizeof(v);
+  return v;
+}
+//____________________________________________________________________________
+double NtpStreamReader::GetDouble(void)
+{
+  double v = 0;
+  if(fPos + sizeof(v) <= fRecord.size()) memcpy(&v, &fRecord[fPos], sizeof(v));
+  fPos += sizeof(v);
+  return v;
+}
+//____________________________________________________________________________
@@ -0,0 +1,71 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpStreamReader
+
+\brief   Reads the events of a binary GENIE event stream (see NtpStreamWriter)
+         back into GHEP event records, eg in a detector simulation receiving
+         the events through a pipe or socket as they are generated.
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_STREAM_READER_H_
+#define _NTP_STREAM_READER_H_
+
+#include <string>
+#include <vector>
+
+#ifndef ROOT_Rtypes
+#include "Rtypes.h"
+#endif
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpStreamReader {
+
+public :
+  NtpStreamReader();
+ ~NtpStreamReader();
+
+  ///< open the stream (see utils::system::OpenStreamSource()) & read its header
+  bool Open (string source);
+
+  ///< read the next event (the caller adopts it), or 0 at the end of stream
+  EventRecord * ReadEvent (void);
+
+  ///< close the stream
+  void Close (void);
+
+  bool     IsOpen      (void) const { return fFd >= 0;     }
+  Long64_t EventNumber (void) const { return fEventNumber; } ///< of the last event read
+  Long64_t NEvents     (void) const { return fNEvents;     } ///< events read so far
+
+private:
+
+  int      GetInt    (void);
+  Long64_t GetLong   (void);
+  double   GetDouble (void);
+
+  int          fFd;          ///< stream file descriptor (-1: closed)
+  bool         fOwnFd;       ///< close the descriptor? (not for stdin)
+  vector<char> fRecord;      ///< the current event record
+  size_t       fPos;         ///< read position in the current record
+  Long64_t     fEventNumber; ///< event number of the last event read
+  Long64_t     fNEvents;     ///< number of events read
+};
+
+}      // genie namespace
+#endif // _NTP_STREAM_READER_H_
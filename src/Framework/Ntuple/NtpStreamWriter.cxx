@@ -0,0 +1,281 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstring>
+#include <cmath>
+#include <sstream>
+#include <iomanip>
+
+#include <unistd.h>
+
+#include <TBits.h>
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpStreamWriter.h"
+#include "Framework/Utils/SystemUtils.h"
+
+using std::ostringstream;
+using std::setprecision;
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpStreamWriter::NtpStreamWriter(NtpStreamFormat_t fmt) :
+fFormat(fmt),
+fFd(-1),
+fOwnFd(false),
+fBufferSize(65536),
+fNEvents(0)
+{
+
+}
+//____________________________________________________________________________
+NtpStreamWriter::~NtpStreamWriter()
+{
+  this->Close();
+}
+//____________________________________________________________________________
+bool NtpStreamWriter::Open(string target)
+{
+  this->Close();
+
+  if(fFormat != kNSBinary && fFormat != kNSHepMC3) {
+    LOG("Ntp", pERROR) << "Unknown event stream format";
+    return false;
+  }
+
+  LOG("Ntp", pNOTICE)
+    << "Opening " << NtpStreamFormat::AsString(fFormat)
+    << " event stream: " << target;
+
+  fTarget  = target;
+  fNEvents = 0;
+  fFd      = utils::system::OpenStreamSink(target);
+  fOwnFd   = (fFd >= 0 && fFd != STDOUT_FILENO);
+  if(fFd < 0) return false;
+
+  fBuffer.clear();
+  fBuffer.reserve(fBufferSize + 4096);
+
+  if(fFormat == kNSBinary) {
+    PutText("GENIEEVS");
+    PutInt(1);
+  } else {
+    PutText("HepMC::Version 3.02.00\n");
+    PutText("HepMC::Asciiv3-START_EVENT_LISTING\n");
+  }
+  return this->Flush();
+}
+//____________________________________________________________________________
+bool NtpStreamWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
+{
+  if(!ev_rec) {
+    LOG("Ntp", pERROR) << "NULL input EventRecord!";
+    return false;
+  }
+  if(fFd < 0) {
+    LOG("Ntp", pERROR) << "No open event stream to add the input EventRecord!";
+    return false;
+  }
+
+  if(fFormat == kNSBinary) this->EncodeBinary(ievent, *ev_rec);
+  else                     this->EncodeHepMC3(ievent, *ev_rec);
+  fNEvents++;
+
+  if(fBuffer.size() >= fBufferSize) return this->Flush();
+  return true;
+}
+//____________________________________________________________________________
+void NtpStreamWriter::Close(void)
+{
+  if(fFd < 0) return;
+
+  if(fFormat == kNSBinary) PutInt(0);
+  else                     PutText("HepMC::Asciiv3-END_EVENT_LISTING\n\n");
+  this->Flush();
+
+  if(fOwnFd) close(fFd);
+  fFd = -1;
+
+  LOG("Ntp", pNOTICE)
+    << "Wrote " << fNEvents << " events to event stream " << fTarget;
+}
+//____________________________________________________________________________
+bool NtpStreamWriter::Flush(void)
+{
+  if(fFd < 0) return false;
+  if(fBuffer.empty()) return true;
+
+  bool ok = utils::system::WriteFully(fFd, &fBuffer[0], fBuffer.size());
+  fBuffer.clear();
+  if(!ok) {
+    LOG("Ntp", pERROR)
+      << "Event stream " << fTarget << " is no longer writable - Closing it";
+    if(fOwnFd) close(fFd);
+    fFd = -1;
+  }
+  return ok;
+}
+//____________________________________________________________________________
+void NtpStreamWriter::PutInt(int value)
+{
+  Int_t v = value;
+  const char * bytes = reinterpret_cast<const char *>(&v);
+  fBuffer.insert(fBuffer.end(), bytes, bytes + sizeof(v));
+}
+//____________________________________________________________________________
+void NtpStreamWriter::PutLong(Long64_t value)
+{
+  const char * bytes = reinterpret_cast<const char *>(&value);
+  fBuffer.insert(fBuffer.end(), bytes, bytes + sizeof(value));
+}
+//____________________________________________________________________________
+void NtpStreamWriter::PutDouble(double value)
+{
+  const char * bytes = reinterpret_cast<const char *>(&value);
+  fBuffer.insert(fBuffer.end(), bytes, bytes + sizeof(value));
+}
+//____________________________________________________________________________
+void NtpStreamWriter::PutText(string text)
+{
+  fBuffer.insert(fBuffer.end(), text.begin(), text.end());
+}
+//____________________________________________________________________________
+void NtpStreamWriter::EncodeBinary(int ievent, const EventRecord & event)
+{
+  // reserve the record size word, filled in once the record is encoded
+  size_t start = fBuffer.size();
+  PutInt(0);
+
+  PutLong   (ievent);
+  TBits * flags = event.EventFlags();
+  int mask = 0;
+  for(unsigned int i = 0; i < flags->GetNbits() && i < 32; i++) {
+    if(flags->TestBitNumber(i)) mask |= (1 << i);
+  }
+  PutInt    (mask);
+  PutDouble (event.Weight());
+  PutDouble (event.Probability());
+  PutDouble (event.XSec());
+  PutDouble (event.DiffXSec());
+  PutInt    ((int) event.DiffXSecVars());
+
+  const TLorentzVector * vtx = event.Vertex();
+  PutDouble (vtx->X());
+  PutDouble (vtx->Y());
+  PutDouble (vtx->Z());
+  PutDouble (vtx->T());
+
+  int np = event.GetEntries();
+  PutInt(np);
+  for(int i = 0; i < np; i++) {
+    GHepParticle * p = event.Particle(i);
+    PutInt    (p->Pdg());
+    PutInt    ((int) p->Status());
+    PutInt    (p->RescatterCode());
+    PutInt    (p->FirstMother());
+    PutInt    (p->LastMother());
+    PutInt    (p->FirstDaughter());
+    PutInt    (p->LastDaughter());
+    PutDouble (p->Px());
+    PutDouble (p->Py());
+    PutDouble (p->Pz());
+    PutDouble (p->E());
+    PutDouble (p->Vx());
+    PutDouble (p->Vy());
+    PutDouble (p->Vz());
+    PutDouble (p->Vt());
+  }
+
+  Int_t nbytes = fBuffer.size() - start - sizeof(Int_t);
+  memcpy(&fBuffer[start], &nbytes, sizeof(nbytes));
+}
+//____________________________________________________________________________
+void NtpStreamWriter::EncodeHepMC3(int ievent, const EventRecord & event)
+{
+  const double m2mm = 1.E3;          // event vertex: m -> mm
+  const double s2mm = 2.99792458E11; // event vertex: s -> mm/c
+
+  int np = event.GetEntries();
+
+  // the HepMC parent of each particle: 0 for particles with no mother (that
+  // go in the primary vertex), the id (1-based position) of the mother, or
+  // the primary vertex (-1) if the mother comes later in the record
+  vector<int>  parent(np, 0);
+  vector<bool> is_mother(np, false);
+  int  nvtx = 0;
+  bool primary = false;
+  for(int i = 0; i < np; i++) {
+    int mom = event.Particle(i)->FirstMother();
+    if(mom < 0) continue;
+    if(mom < i && event.Particle(mom)->FirstMother() >= 0) {
+      parent[i] = mom + 1;
+      if(!is_mother[mom]) nvtx++;
+      is_mother[mom] = true;
+    } else {
+      parent[i] = -1;
+      primary   = true;
+    }
+  }
+  if(primary) nvtx++;
+
+  ostringstream out;
+  out << setprecision(10);
+  out << "E " << ievent << " " << nvtx << " " << np << "\n";
+  out << "U GEV MM\n";
+  out << "W " << event.Weight() << "\n";
+  out << "A 0 GENIE.XSec "      << event.XSec()     << "\n";
+  out << "A 0 GENIE.DiffXSec "  << event.DiffXSec() << "\n";
+  out << "A 0 GENIE.Unphysical " << (event.IsUnphysical() ? 1 : 0) << "\n";
+
+  bool vtx_written = false;
+  for(int i = 0; i < np; i++) {
+    GHepParticle * p = event.Particle(i);
+
+    // the primary vertex, once all the particles coming into it are listed
+    if(parent[i] != 0 && !vtx_written) {
+      const TLorentzVector * vtx = event.Vertex();
+      out << "V -1 0 [";
+      bool first = true;
+      for(int j = 0; j < i; j++) {
+        if(parent[j] != 0) continue;
+        out << (first ? "" : ",") << j+1;
+        first = false;
+      }
+      out << "] @ " << vtx->X() * m2mm << " " << vtx->Y() * m2mm
+          << " "    << vtx->Z() * m2mm << " " << vtx->T() * s2mm << "\n";
+      vtx_written = true;
+    }
+
+    int ist = (int) p->Status();
+    int status = 20 + ist;
+    if      (ist == kIStInitialState    ) status = 4;
+    else if (ist == kIStStableFinalState) status = 1;
+    else if (ist == kIStDecayedState    ) status = 2;
+
+    double E  = p->E();
+    double m2 = E*E - p->Px()*p->Px() - p->Py()*p->Py() - p->Pz()*p->Pz();
+    double m  = (m2 > 0) ? std::sqrt(m2) : 0.;
+
+    out << "P " << i+1 << " " << parent[i] << " " << p->Pdg()
+        << " " << p->Px() << " " << p->Py() << " " << p->Pz()
+        << " " << E << " " << m << " " << status << "\n";
+  }
+
+  PutText(out.str());
+}
+//____________________________________________________________________________
@@ -0,0 +1,117 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpStreamWriter
+
+\brief   Serializes the generated GHEP event records and writes them to a
+         stream (pipe, named pipe, TCP or Unix domain socket, or file), so
+         that a downstream application (eg a Geant4-based detector simulation)
+         can consume the events as they are generated, with no intermediate
+         ROOT file. See utils::system::OpenStreamSink() for the targets.
+
+         Writes block while the consumer is not reading, so a slow consumer
+         throttles event generation (back-pressure). If the consumer goes
+         away, AddEventRecord() returns false.
+
+         Formats (see NtpStreamFormat):
+
+         kNSBinary: compact binary records, in the host byte order.
+           stream header : char[8] "GENIEEVS", int32 format version (1)
+           each event    : int32 record size in bytes (excluding this word),
+                           int64 event number, int32 event flags (bit i
+                           set if GHEP flag i is set, see GHepFlags),
+                           double weight, probability, xsec, diff xsec,
+                           int32 diff xsec phase space,
+                           double vertex x, y, z, t,
+                           int32 number of particles and, for each particle,
+                           int32 pdg, status, rescattering code,
+                                 first/last mother, first/last daughter,
+                           double px, py, pz, E, x, y, z, t
+           end of stream : int32 0
+           The quantities are as stored in the GHEP record (natural units for
+           cross sections and momenta, the event vertex in the geometry
+           units). The interaction summary is not streamed. The stream can be
+           read back into EventRecords with NtpStreamReader.
+
+         kNSHepMC3: HepMC3 Asciiv3 event listing (GeV, mm), readable with
+           HepMC3::ReaderAscii. Particles with no mother are incoming to a
+           vertex at the event vertex (assumed in m & s), every other particle
+           is produced in the decay of its first mother. HepMC status is 4 for
+           the initial state, 1 for the stable final state, 2 for decayed
+           particles and 20 + the GENIE status code otherwise.
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_STREAM_WRITER_H_
+#define _NTP_STREAM_WRITER_H_
+
+#include <string>
+#include <vector>
+
+#include "Framework/Ntuple/NtpStreamFormat.h"
+
+#ifndef ROOT_Rtypes
+#include "Rtypes.h"
+#endif
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpStreamWriter {
+
+public :
+  NtpStreamWriter(NtpStreamFormat_t fmt = kNSBinary);
+ ~NtpStreamWriter();
+
+  ///< open the stream and write the stream header
+  bool Open (string target);
+
+  ///< serialize & write an event (false if the stream is not writable)
+  bool AddEventRecord (int ievent, const EventRecord * ev_rec);
+
+  ///< write the end-of-stream marker, flush & close the stream
+  void Close (void);
+
+  ///< use before Open() to set the size of the write buffer: buffered events
+  ///< are written when it is full (0: write every event immediately, for
+  ///< the lowest latency) [default: 64 kB]
+  void SetBufferSize (unsigned int nbytes) { fBufferSize = nbytes; }
+
+  bool              IsOpen  (void) const { return fFd >= 0; }
+  NtpStreamFormat_t Format  (void) const { return fFormat;   }
+  string            Target  (void) const { return fTarget;   }
+  Long64_t          NEvents (void) const { return fNEvents;  }
+
+private:
+
+  void EncodeBinary (int ievent, const EventRecord & event);
+  void EncodeHepMC3 (int ievent, const EventRecord & event);
+  void PutInt       (int      value);
+  void PutLong      (Long64_t value);
+  void PutDouble    (double   value);
+  void PutText      (string   text);
+  bool Flush        (void);
+
+  NtpStreamFormat_t fFormat;     ///< stream format
+  string            fTarget;     ///< stream target
+  int               fFd;         ///< stream file descriptor (-1: closed)
+  bool              fOwnFd;      ///< close the descriptor? (not for stdout)
+  unsigned int      fBufferSize; ///< write buffer size
+  vector<char>      fBuffer;     ///< encoded events not written yet
+  Long64_t          fNEvents;    ///< number of events written
+};
+
+}      // genie namespace
+#endif // _NTP_STREAM_WRITER_H_
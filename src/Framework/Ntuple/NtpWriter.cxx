@@ -18,25 +18,80 @@
    Added CustomizeFilename() and CustomizeFilenamePrefix() to allow the use
    to customize either the entire output name or just the prefix before the
    run number.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the kNFFlat format and EnableFlatTree(): the flat `gst' summary tree
+   (see NtpGSTRecord) is filled directly during event generation, either on
+   its own or alongside the GHEP event tree.
+   Added the asynchronous mode, see SetAsynchronous().
+   Made the compression, basket size, auto-flush, auto-save and split level
+   configurable (replacing the hardcoded 0.2 GB auto-save and the default
+   compression) and added write throughput and file size reporting in Save().
+   Added SetOutputStream(), to also (or only) write the events to an event
+   stream (see NtpStreamWriter).
+   Write the `gindex' event index tree (see NtpEventIndex) alongside the
+   GHEP event tree, unless disabled with EnableEventIndex(false).
+   Added the kNFCompact format (see NtpMCCompactRecord).
+   Record the job shard (see RunOpt, --shard i/N) and seed in the tree
+   header, and add the shard index to the default filename. Added
+   TreeHeader(), to let the driver apps store the sample normalization,
+   and re-write the tree header in Save().
+   Added WriteCheckpoint() and Restart(), for checkpointing long MC jobs and
+   restarting them after an interruption (see NtpMCCheckpoint).
+   Added the kNFKine format: the `gkine' tree of the event kinematics only
+   (see NtpKineRecord), for the truncated generation chains of RunOpt
+   --stop-after.
+   Added QueueDepth(), monitored by GMCJMonitor.
+   Save() writes the `gkinestats' tree of the kinematics rejection sampling
+   statistics, if they were collected (see KineSamplingStats).
+   Save() stores the event filter statistics in the tree header, if an
+   event filter was used (see EventFilterI).
+   Write the `ggeninfo' tree (see NtpGenInfo) alongside the GHEP event tree,
+   if the collection of the intermediate generation quantities is enabled
+   (see GHepGenInfo).
 
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdlib>
 #include <sstream>
+#include <chrono>
+#include <deque>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <TFile.h>
+#include <TKey.h>
+#include <TSystem.h>
 #include <TTree.h>
 #include <TClonesArray.h>
 #include <TFolder.h>
+#include <TROOT.h>
 
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventFilterI.h"
+#include "Framework/GHEP/GHepGenInfo.h"
+#include "Framework/EventGen/ModuleTimingStats.h"
+#include "Framework/EventGen/KineSamplingStats.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCCompactRecord.h"
+#include "Framework/Ntuple/NtpGSTRecord.h"
+#include "Framework/Ntuple/NtpKineRecord.h"
+#include "Framework/Ntuple/NtpEventIndex.h"
+#include "Framework/Ntuple/NtpGenInfo.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
+#include "Framework/Ntuple/NtpMCCheckpoint.h"
 #include "Framework/Ntuple/NtpMCJobConfig.h"
 #include "Framework/Ntuple/NtpMCJobEnv.h"
+#include "Framework/Ntuple/NtpStreamWriter.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
 
 #include "RVersion.h"
 
@@ -44,6 +99,24 @@ using std::ostringstream;
 
 using namespace genie;
 
+//____________________________________________________________________________
+namespace genie {
+ // Writer thread and the queue of records handed over to it
+ class NtpWriterQueue {
+ public:
+   NtpWriterQueue() : nrecords(0), stop(false) {}
+
+   std::thread                    thread;
+   std::mutex                     mutex;
+   std::condition_variable        cv_queued;  ///< a record was queued (or stop)
+   std::condition_variable        cv_written; ///< a record was written
+   std::deque<NtpMCEventRecord *> queued;     ///< records to write, in order
+   std::vector<NtpMCEventRecord*> spare;      ///< written records, for re-use
+   unsigned int                   nrecords;   ///< number of records allocated
+   bool                           stop;       ///< no more records to come
+ };
+}
+
 //____________________________________________________________________________
 NtpWriter::NtpWriter(NtpMCFormat_t fmt, Long_t runnu) :
 fNtpFormat(fmt),
@@ -52,18 +125,82 @@ fOutFile(0),
 fOutTree(0),
 fEventBranch(0),
 fNtpMCEventRecord(0),
-fNtpMCTreeHeader(0)
+fNtpMCTreeHeader(0),
+fWriteFlatTree(false),
+fFlatTree(0),
+fGSTRecord(0),
+fCompactRecord(0),
+fKineRecord(0),
+fWriteIndex(true),
+fIndexTree(0),
+fIndex(0),
+fGenInfoTree(0),
+fGenInfo(0),
+fAsync(false),
+fQueueSize(16),
+fNBranches(0),
+fQueue(0),
+fCompression(-1),
+fBasketSize(32000),
+fAutoFlush(-30000000), // the ROOT default: flush baskets every ~30 MB
+fAutoSave(200000000),  // autosave when 0.2 Gbyte written
+fSplitLevel(-1),
+fWriteTime(0),
+fTotBytes(0),
+fZipBytes(0),
+fFileSize(0),
+fStreamTarget(""),
+fStreamFormat(kNSBinary),
+fStreamOnly(false),
+fStream(0),
+fRestart(false),
+fRestartFilename(""),
+fCheckpoint(0),
+fCheckpointCycle(0),
+fKeepCheckpoint(false)
 {
   LOG("Ntp", pNOTICE) << "Run number: " << runnu;
   LOG("Ntp", pNOTICE)
     << "Requested G/ROOT tree format: " << NtpMCFormat::AsString(fNtpFormat);
 
   this->SetDefaultFilename();
+
+  // output settings requested through the common run options, if any
+  RunOpt * opt = RunOpt::Instance();
+  if(opt->OutputCompression().size() > 0) {
+    this->SetCompression(opt->OutputCompression());
+  }
+  if(opt->OutputBasketSize() > 0) fBasketSize = opt->OutputBasketSize();
+  if(opt->OutputAutoFlush() != 0) fAutoFlush  = opt->OutputAutoFlush();
+  if(opt->OutputSplitLevel() >= 0) fSplitLevel = opt->OutputSplitLevel();
+  if(opt->OutputStream().size() > 0) {
+    NtpStreamFormat_t sfmt =
+          NtpStreamFormat::FromString(opt->OutputStreamFormat());
+    if(sfmt == kNSUndefined) {
+      LOG("Ntp", pFATAL)
+        << "Unknown event stream format: " << opt->OutputStreamFormat()
+        << " (expected binary or hepmc3) - Exiting";
+      exit(1);
+    }
+    this->SetOutputStream(opt->OutputStream(), sfmt, opt->OutputStreamOnly());
+  }
+
+  // checkpoints keep the key cycles of the trees they refer to, which
+  // ROOT's auto-save would delete
+  if(opt->CheckpointInterval() > 0) fAutoSave = 0;
+  fRestart = opt->Restart();
 }
 //____________________________________________________________________________
 NtpWriter::~NtpWriter()
 {
-
+  this->StopWriterThread();
+  if(fGSTRecord) delete fGSTRecord;
+  if(fIndex)     delete fIndex;
+  if(fGenInfo)   delete fGenInfo;
+  if(fCompactRecord) delete fCompactRecord;
+  if(fKineRecord) delete fKineRecord;
+  if(fStream)    delete fStream;
+  if(fCheckpoint) delete fCheckpoint;
 }
 //____________________________________________________________________________
 void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
@@ -74,11 +211,45 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
     LOG("Ntp", pERROR) << "NULL input EventRecord!";
     return;
   }
+
+  if(fStream) {
+    if(!fStream->AddEventRecord(ievent, ev_rec)) {
+      if(fStreamOnly) {
+        LOG("Ntp", pFATAL)
+          << "Can not write to the event stream " << fStreamTarget
+          << " - Exiting";
+        exit(1);
+      }
+      LOG("Ntp", pERROR)
+        << "Can not write to the event stream " << fStreamTarget
+        << " - Writing the output file only";
+      delete fStream;
+      fStream = 0;
+    }
+  }
+  if(fStreamOnly) return;
+
   if(!fOutTree) {
     LOG("Ntp", pERROR) << "No open output TTree to add the input EventRecord!";
     return;
   }
 
+  if(fQueue) {
+    // user-defined branches are filled by the caller, so they can not be
+    // written later from the writer thread
+    if(fOutTree->GetListOfBranches()->GetEntries() != fNBranches) {
+      LOG("Ntp", pWARN)
+        << "Additional event tree branches found - Writing synchronously";
+      this->StopWriterThread();
+    } else {
+      this->QueueEventRecord(ievent, ev_rec);
+      return;
+    }
+  }
+
+  std::chrono::steady_clock::time_point tstart =
+                                      std::chrono::steady_clock::now();
+
   switch (fNtpFormat) {
      case kNFGHEP:
           fNtpMCEventRecord = new NtpMCEventRecord();
@@ -86,22 +257,70 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
           fOutTree->Fill();
           delete fNtpMCEventRecord;
           fNtpMCEventRecord = 0;
+          this->FillSummaryTrees(ievent, *ev_rec);
+          break;
+     case kNFCompact:
+          fCompactRecord->Fill(ievent, ev_rec);
+          fOutTree->Fill();
+          this->FillSummaryTrees(ievent, *ev_rec);
+          break;
+     case kNFFlat:
+          if(fGSTRecord->Fill(ievent, *ev_rec)) fOutTree->Fill();
+          break;
+     case kNFKine:
+          if(fKineRecord->Fill(ievent, *ev_rec)) fOutTree->Fill();
           break;
      default:
         break;
   }
+
+  fWriteTime += std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - tstart).count();
 }
 //____________________________________________________________________________
 void NtpWriter::Initialize()
 {
   LOG("Ntp",pINFO) << "Initializing GENIE output MC tree";
 
+  fWriteTime = 0;
+  fTotBytes  = 0;
+  fZipBytes  = 0;
+  fFileSize  = 0;
+
+  //-- open the event stream, if any
+  if(fStreamTarget.size() > 0) {
+    if(fStream) delete fStream;
+    fStream = new NtpStreamWriter(fStreamFormat);
+    if(!fStream->Open(fStreamTarget)) {
+      LOG("Ntp", pFATAL)
+        << "Can not open the event stream " << fStreamTarget << " - Exiting";
+      exit(1);
+    }
+    if(fStreamOnly) {
+      LOG("Ntp", pNOTICE) << "Writing the events to the event stream only";
+      return;
+    }
+  }
+
+  //-- move the output file of an interrupted MC job aside
+  if(fRestart) this->PrepareRestart();
+
   this->OpenFile(fOutFilename); // open ROOT file
   this->CreateTree();           // create output tree
 
   //-- create the event branch
   this->CreateEventBranch(); 
 
+  //-- create the flat summary tree, if it is requested alongside GHEP
+  bool is_flat = (fNtpFormat == kNFFlat || fNtpFormat == kNFKine);
+  if(fWriteFlatTree && !is_flat) this->CreateFlatTree();
+
+  //-- create the event index tree
+  if(fWriteIndex && !is_flat) this->CreateIndexTree();
+
+  //-- create the generation info tree, if the info is collected
+  if(GHepGenInfo::IsEnabled() && !is_flat) this->CreateGenInfoTree();
+
   //-- create the tree header
   this->CreateTreeHeader();
   fNtpMCTreeHeader->Write();
@@ -113,6 +332,232 @@ void NtpWriter::Initialize()
   //-- take a snapshot of the user's environment
   NtpMCJobEnv environment;
   environment.TakeSnapshot()->Write();
+
+  //-- hand the output trees over to the writer thread
+  if(fAsync) this->StartWriterThread();
+}
+//____________________________________________________________________________
+void NtpWriter::SetAsynchronous(bool async, unsigned int queue_size)
+{
+  fAsync     = async;
+  fQueueSize = (queue_size > 0) ? queue_size : 1;
+
+#if ROOT_VERSION_CODE < ROOT_VERSION(6,0,0)
+  if(fAsync) {
+    LOG("Ntp", pWARN)
+      << "The asynchronous mode requires ROOT 6 - Writing synchronously";
+    fAsync = false;
+  }
+#endif
+}
+//____________________________________________________________________________
+unsigned int NtpWriter::QueueDepth(void) const
+{
+  if(!fQueue) return 0;
+
+  std::lock_guard<std::mutex> lock(fQueue->mutex);
+  return fQueue->queued.size();
+}
+//____________________________________________________________________________
+void NtpWriter::StartWriterThread(void)
+{
+  LOG("Ntp", pNOTICE)
+    << "Writing events from a writer thread (max queued records: "
+    << fQueueSize << ")";
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+#endif
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0) && defined(R__USE_IMT)
+  // compress the baskets in parallel
+  ROOT::EnableImplicitMT();
+#endif
+
+  fNBranches = fOutTree->GetListOfBranches()->GetEntries();
+
+  fQueue = new NtpWriterQueue;
+  fQueue->thread = std::thread( [this] { this->RunWriterThread(); } );
+}
+//____________________________________________________________________________
+void NtpWriter::StopWriterThread(void)
+{
+// Writes all queued records, joins the writer thread and deletes the records
+
+  if(!fQueue) return;
+
+  {
+    std::lock_guard<std::mutex> lock(fQueue->mutex);
+    fQueue->stop = true;
+  }
+  fQueue->cv_queued.notify_one();
+  fQueue->thread.join();
+
+  std::vector<NtpMCEventRecord*>::iterator it = fQueue->spare.begin();
+  for( ; it != fQueue->spare.end(); ++it) delete *it;
+
+  delete fQueue;
+  fQueue = 0;
+}
+//____________________________________________________________________________
+void NtpWriter::RunWriterThread(void)
+{
+  while(true) {
+    NtpMCEventRecord * rec = 0;
+    {
+      std::unique_lock<std::mutex> lock(fQueue->mutex);
+      fQueue->cv_queued.wait(lock,
+          [this] { return fQueue->stop || !fQueue->queued.empty(); });
+      if(fQueue->queued.empty()) break; // stopped & drained
+      rec = fQueue->queued.front();
+      fQueue->queued.pop_front();
+    }
+
+    this->WriteEventRecord(rec);
+
+    {
+      std::lock_guard<std::mutex> lock(fQueue->mutex);
+      fQueue->spare.push_back(rec);
+    }
+    fQueue->cv_written.notify_one();
+  }
+}
+//____________________________________________________________________________
+void NtpWriter::QueueEventRecord(int ievent, const EventRecord * ev_rec)
+{
+// Copies the input event into a spare record (waiting for one to be written
+// if all have been handed over already) and queues it for writing
+
+  NtpMCEventRecord * rec = 0;
+  {
+    std::unique_lock<std::mutex> lock(fQueue->mutex);
+    fQueue->cv_written.wait(lock, [this] {
+       return !fQueue->spare.empty() || fQueue->nrecords < fQueueSize; });
+    if(!fQueue->spare.empty()) {
+      rec = fQueue->spare.back();
+      fQueue->spare.pop_back();
+    } else {
+      fQueue->nrecords++;
+    }
+  }
+  if(!rec) rec = new NtpMCEventRecord();
+
+  rec->Fill(ievent, ev_rec);
+
+  {
+    std::lock_guard<std::mutex> lock(fQueue->mutex);
+    fQueue->queued.push_back(rec);
+  }
+  fQueue->cv_queued.notify_one();
+}
+//____________________________________________________________________________
+void NtpWriter::WriteEventRecord(NtpMCEventRecord * rec)
+{
+// Writes a queued record (called from the writer thread)
+
+  std::chrono::steady_clock::time_point tstart =
+                                      std::chrono::steady_clock::now();
+
+  switch (fNtpFormat) {
+     case kNFGHEP:
+          fNtpMCEventRecord = rec;
+          fOutTree->Fill();
+          fNtpMCEventRecord = 0;
+          this->FillSummaryTrees(rec->hdr.ievent, *rec->event);
+          break;
+     case kNFCompact:
+          fCompactRecord->Fill(rec->hdr.ievent, rec->event);
+          fCompactRecord->hdr.Copy(rec->hdr);
+          fOutTree->Fill();
+          this->FillSummaryTrees(rec->hdr.ievent, *rec->event);
+          break;
+     case kNFFlat:
+          if(fGSTRecord->Fill(rec->hdr.ievent, *rec->event)) fOutTree->Fill();
+          break;
+     case kNFKine:
+          if(fKineRecord->Fill(rec->hdr.ievent, *rec->event)) fOutTree->Fill();
+          break;
+     default:
+        break;
+  }
+
+  fWriteTime += std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - tstart).count();
+}
+//____________________________________________________________________________
+void NtpWriter::FillSummaryTrees(int ievent, const EventRecord & event)
+{
+// Fills the event index, generation info & flat summary trees written
+// alongside the GHEP (or compact GHEP) event tree, if any
+
+  if(fIndexTree) {
+    fIndex->Fill(ievent, event);
+    fIndexTree->Fill();
+  }
+  if(fGenInfoTree) {
+    fGenInfo->Fill(ievent, event);
+    fGenInfoTree->Fill();
+  }
+  if(fFlatTree) {
+    if(fGSTRecord->Fill(ievent, event)) fFlatTree->Fill();
+  }
+}
+//____________________________________________________________________________
+void NtpWriter::SetCompression(string algorithm, int level)
+{
+  int settings = NtpWriter::CompressionSettings(algorithm, level);
+  if(settings < 0) {
+    LOG("Ntp", pWARN)
+      << "Unsupported output compression: " << algorithm << ":" << level
+      << " - Using the ROOT default";
+    return;
+  }
+  fCompression = settings;
+}
+//____________________________________________________________________________
+void NtpWriter::SetCompression(string setting)
+{
+// Sets the compression from an "algorithm:level" string. If the level is
+// not given, the ROOT default level for the algorithm is used
+
+  vector<string> tokens = utils::str::Split(setting, ":");
+  if(tokens.size() == 0) return;
+
+  string algorithm = utils::str::TrimSpaces(tokens[0]);
+  int    level     = (tokens.size() > 1) ? atoi(tokens[1].c_str()) : -1;
+
+  if(level < 0) {
+    string alg = utils::str::ToLower(algorithm);
+    level = (alg == "lz4") ? 4 : ( (alg == "zlib") ? 1 : 5 );
+  }
+  this->SetCompression(algorithm, level);
+}
+//____________________________________________________________________________
+int NtpWriter::CompressionSettings(string algorithm, int level)
+{
+// See ROOT::RCompressionSetting: the setting is 100*algorithm + level
+
+  if(level < 0 || level > 9) return -1;
+
+  string alg = utils::str::ToLower(algorithm);
+
+  if(alg == "zlib") return 100 + level;
+  if(alg == "lzma") return 200 + level;
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,12,0)
+  if(alg == "lz4")  return 400 + level;
+#endif
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,20,0)
+  if(alg == "zstd") return 500 + level;
+#endif
+
+  return -1;
+}
+//____________________________________________________________________________
+void NtpWriter::SetOutputStream(
+               string target, NtpStreamFormat_t fmt, bool stream_only)
+{
+  fStreamTarget = target;
+  fStreamFormat = fmt;
+  fStreamOnly   = stream_only && (target.size() > 0);
 }
 //____________________________________________________________________________
 void NtpWriter::CustomizeFilename(string filename)
@@ -129,8 +574,11 @@ void NtpWriter::SetDefaultFilename(string filename_prefix)
 {
   ostringstream fnstr;
   fnstr << filename_prefix  << "." 
-        << fRunNu << "."
-        << NtpMCFormat::FilenameTag(fNtpFormat)
+        << fRunNu << ".";
+  if(RunOpt::Instance()->NShards() > 1) {
+    fnstr << "shard" << RunOpt::Instance()->Shard() << ".";
+  }
+  fnstr << NtpMCFormat::FilenameTag(fNtpFormat)
         << ".root";
 
   fOutFilename = fnstr.str();
@@ -146,6 +594,15 @@ void NtpWriter::OpenFile(string filename)
   // use "TFile::Open()" instead of "new TFile()" so that it can handle
   // alternative URLs (e.g. xrootd, etc)
   fOutFile = TFile::Open(filename.c_str(),"RECREATE");
+  if(!fOutFile) {
+    LOG("Ntp", pFATAL) << "Could not open the output ROOT file: " << filename;
+    exit(1);
+  }
+
+  if(fCompression >= 0) {
+    LOG("Ntp", pNOTICE) << "Output compression settings: " << fCompression;
+    fOutFile->SetCompressionSettings(fCompression);
+  }
 }
 //____________________________________________________________________________
 void NtpWriter::CreateTree(void)
@@ -158,8 +615,24 @@ void NtpWriter::CreateTree(void)
   title << "GENIE MC Truth TTree"
               << ", Format: " << NtpMCFormat::AsString(fNtpFormat);
 
-  fOutTree = new TTree("gtree",title.str().c_str());
-  fOutTree->SetAutoSave(200000000);  // autosave when 0.2 Gbyte written
+  // the flat format tree is named as the one written by gntpc -f gst
+  if(fNtpFormat == kNFFlat) {
+    fOutTree = new TTree("gst",title.str().c_str());
+  } else if(fNtpFormat == kNFKine) {
+    fOutTree = new TTree("gkine",title.str().c_str());
+  } else {
+    fOutTree = new TTree("gtree",title.str().c_str());
+  }
+  this->ApplyTreeSettings(fOutTree);
+}
+//____________________________________________________________________________
+void NtpWriter::ApplyTreeSettings(TTree * tree)
+{
+  LOG("Ntp", pINFO)
+    << "Tree auto-flush: " << fAutoFlush << ", auto-save: " << fAutoSave;
+
+  tree->SetAutoFlush(fAutoFlush);
+  tree->SetAutoSave (fAutoSave);
 }
 //____________________________________________________________________________
 void NtpWriter::CreateEventBranch(void)
@@ -167,14 +640,32 @@ void NtpWriter::CreateEventBranch(void)
   switch (fNtpFormat) {
      case kNFGHEP:
         this->CreateGHEPEventBranch();
+        assert(fEventBranch);
+        fEventBranch->SetAutoDelete(kFALSE);
+        break;
+     case kNFCompact:
+        this->CreateCompactEventBranch();
+        assert(fEventBranch);
+        break;
+     case kNFFlat:
+        LOG("Ntp", pINFO) << "Creating the flat summary tree TBranches";
+        if(!fGSTRecord) fGSTRecord = new NtpGSTRecord;
+        fGSTRecord->CreateBranches(fOutTree);
+        fOutTree->SetBasketSize("*", fBasketSize);
+        fFlatTree = fOutTree;
+        break;
+     case kNFKine:
+        LOG("Ntp", pINFO) << "Creating the kinematics tree TBranches";
+        if(!fKineRecord) fKineRecord = new NtpKineRecord;
+        fKineRecord->CreateBranches(fOutTree);
+        fOutTree->SetBasketSize("*", fBasketSize);
         break;
      default:
         LOG("Ntp", pERROR)
            << "Unknown TTree format. Can not create TBranches";
+        assert(false);
         break;
   }
-  assert(fEventBranch);
-  fEventBranch->SetAutoDelete(kFALSE);
 }
 //____________________________________________________________________________
 void NtpWriter::CreateGHEPEventBranch(void)
@@ -189,14 +680,69 @@ void NtpWriter::CreateGHEPEventBranch(void)
 #else
   int split = 1;
 #endif
+  if(fSplitLevel >= 0) split = fSplitLevel;
+
+  LOG("Ntp", pINFO)
+    << "Event branch basket size: " << fBasketSize << ", split level: " << split;
 
   fEventBranch = fOutTree->Branch("gmcrec",
-      "genie::NtpMCEventRecord", &fNtpMCEventRecord, 32000, split);
+      "genie::NtpMCEventRecord", &fNtpMCEventRecord, fBasketSize, split);
   // was split=1 ... but, at least w/ ROOT 6.06/04, this generates
   //   Warning in <TTree::Bronch>: genie::NtpMCEventRecord cannot be split, resetting splitlevel to 0
   // which the art framework turns into a fatal error
 }
 //____________________________________________________________________________
+void NtpWriter::CreateCompactEventBranch(void)
+{
+  LOG("Ntp", pINFO) << "Creating a NtpMCCompactRecord TBranch";
+
+  if(!fCompactRecord) fCompactRecord = new NtpMCCompactRecord;
+
+  // split the particle arrays into separate branches (column-wise storage
+  // compresses best)
+  int split = (fSplitLevel >= 0) ? fSplitLevel : 99;
+
+  LOG("Ntp", pINFO)
+    << "Event branch basket size: " << fBasketSize << ", split level: " << split;
+
+  fEventBranch = fOutTree->Branch("gcmrec",
+      "genie::NtpMCCompactRecord", &fCompactRecord, fBasketSize, split);
+}
+//____________________________________________________________________________
+void NtpWriter::CreateFlatTree(void)
+{
+  LOG("Ntp", pINFO) << "Creating the flat summary tree";
+
+  fFlatTree = new TTree("gst","GENIE Summary Event Tree");
+  this->ApplyTreeSettings(fFlatTree);
+
+  if(!fGSTRecord) fGSTRecord = new NtpGSTRecord;
+  fGSTRecord->CreateBranches(fFlatTree);
+  fFlatTree->SetBasketSize("*", fBasketSize);
+}
+//____________________________________________________________________________
+void NtpWriter::CreateIndexTree(void)
+{
+  LOG("Ntp", pINFO) << "Creating the event index tree";
+
+  fIndexTree = new TTree(NtpEventIndex::TreeName(),"GENIE Event Index Tree");
+  this->ApplyTreeSettings(fIndexTree);
+
+  if(!fIndex) fIndex = new NtpEventIndex;
+  fIndex->CreateBranches(fIndexTree);
+}
+//____________________________________________________________________________
+void NtpWriter::CreateGenInfoTree(void)
+{
+  LOG("Ntp", pINFO) << "Creating the generation info tree";
+
+  fGenInfoTree = new TTree(NtpGenInfo::TreeName(),"GENIE Generation Info Tree");
+  this->ApplyTreeSettings(fGenInfoTree);
+
+  if(!fGenInfo) fGenInfo = new NtpGenInfo;
+  fGenInfo->CreateBranches(fGenInfoTree);
+}
+//____________________________________________________________________________
 void NtpWriter::CreateTreeHeader(void)
 {
   LOG("Ntp", pINFO) << "Creating the NtpMCTreeHeader";
@@ -205,8 +751,11 @@ void NtpWriter::CreateTreeHeader(void)
 
   fNtpMCTreeHeader = new NtpMCTreeHeader;
 
-  fNtpMCTreeHeader->format = fNtpFormat;
-  fNtpMCTreeHeader->runnu  = fRunNu;
+  fNtpMCTreeHeader->format  = fNtpFormat;
+  fNtpMCTreeHeader->runnu   = fRunNu;
+  fNtpMCTreeHeader->ishard  = RunOpt::Instance()->Shard();
+  fNtpMCTreeHeader->nshards = RunOpt::Instance()->NShards();
+  fNtpMCTreeHeader->seed    = RandomGen::Instance()->GetSeed();
 
   LOG("Ntp", pINFO) << *fNtpMCTreeHeader;
 }
@@ -215,16 +764,339 @@ void NtpWriter::Save(void)
 {
   LOG("Ntp", pINFO) << "Saving the output tree";
 
+  // write all queued events first
+  this->StopWriterThread();
+
+  // close the event stream
+  if(fStream) {
+    fStream->Close();
+    if(fStreamOnly) return;
+  }
+
   if(fOutFile) {
 
+    // per-module event generation timing, if it was collected
+    if(ModuleTimingStats::IsEnabled()) {
+      ModuleTimingStats * timing = ModuleTimingStats::Instance();
+      LOG("Ntp", pNOTICE) << *timing;
+      fOutFile->cd();
+      timing->MakeTree();
+    }
+
+    // kinematics rejection sampling statistics, if they were collected
+    if(KineSamplingStats::IsEnabled()) {
+      KineSamplingStats * kinestats = KineSamplingStats::Instance();
+      LOG("Ntp", pNOTICE) << *kinestats;
+      fOutFile->cd();
+      kinestats->MakeTree();
+    }
+
+    std::chrono::steady_clock::time_point tstart =
+                                      std::chrono::steady_clock::now();
+
     fOutFile->Write();
+
+    // the accept fraction of the event filter, needed for the normalization
+    if(EventFilterI::InUse()) {
+      long int ntried    = EventFilterI::NEventsTried();
+      long int naccepted = EventFilterI::NEventsAccepted();
+      LOG("Ntp", pNOTICE)
+        << "The event filter accepted " << naccepted << " / " << ntried
+        << " events (" << ((ntried > 0) ? 100.*naccepted/ntried : 0.) << " %)";
+      if(fNtpMCTreeHeader) {
+        fNtpMCTreeHeader->nfilttried    = ntried;
+        fNtpMCTreeHeader->nfiltaccepted = naccepted;
+      }
+    }
+
+    // the normalization may have been added to the header after Initialize()
+    if(fNtpMCTreeHeader) {
+      fOutFile->cd();
+      fNtpMCTreeHeader->Write("header", TObject::kOverwrite);
+    }
+
+    // the job is complete: its last checkpoint is no longer needed
+    if(!fKeepCheckpoint) this->DeleteCheckpoint();
+
+    Long64_t nev = fOutTree->GetEntries();
+    fTotBytes = fOutTree->GetTotBytes();
+    fZipBytes = fOutTree->GetZipBytes();
+    if(fFlatTree && fFlatTree != fOutTree) {
+      fTotBytes += fFlatTree->GetTotBytes();
+      fZipBytes += fFlatTree->GetZipBytes();
+    }
+    if(fIndexTree) {
+      fTotBytes += fIndexTree->GetTotBytes();
+      fZipBytes += fIndexTree->GetZipBytes();
+    }
+    if(fGenInfoTree) {
+      fTotBytes += fGenInfoTree->GetTotBytes();
+      fZipBytes += fGenInfoTree->GetZipBytes();
+    }
+
     fOutFile->Close();
+    fFileSize = fOutFile->GetEND();
     delete fOutFile;
-    fOutFile = 0;
+    fOutFile  = 0;
+    fOutTree   = 0;
+    fFlatTree  = 0;
+    fIndexTree = 0;
+    fGenInfoTree = 0;
+
+    fWriteTime += std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - tstart).count();
+
+    double mb = 1024. * 1024.;
+    ostringstream stats;
+    stats << "Wrote " << nev << " events to " << fOutFilename
+          << "\n File size: " << fFileSize/mb << " MB"
+          << ", uncompressed: " << fTotBytes/mb << " MB"
+          << ", compression factor: "
+          << ((fZipBytes > 0) ? double(fTotBytes)/fZipBytes : 0.)
+          << "\n Time spent writing: " << fWriteTime << " s";
+    if(fWriteTime > 0) {
+      stats << " (" << nev/fWriteTime << " events/s, "
+            << fTotBytes/mb/fWriteTime << " MB/s uncompressed)";
+    }
+    LOG("Ntp", pNOTICE) << stats.str();
 
   } else {
      LOG("Ntp", pERROR) << "No open ROOT file was found";
   }
 }
 //____________________________________________________________________________
+void NtpWriter::WriteCheckpoint(NtpMCCheckpoint & checkpoint)
+{
+// Writes the output trees (as new key cycles, the ones of the previous
+// checkpoint being kept until this one is complete) and the input checkpoint
+// with the cycles of the trees. If the job is interrupted at any point, the
+// output file then holds a complete checkpoint and the trees it refers to
+
+  if(!fOutFile) {
+    LOG("Ntp", pWARN) << "No output file - Can not write a checkpoint";
+    return;
+  }
+
+  std::chrono::steady_clock::time_point tstart =
+                                      std::chrono::steady_clock::now();
+
+  // write all queued events first
+  bool async = (fQueue != 0);
+  this->StopWriterThread();
+
+  fOutFile->cd();
+
+  checkpoint.trees.clear();
+  checkpoint.cycles.clear();
+
+  TTree * trees[4] = {
+    fOutTree, (fFlatTree != fOutTree) ? fFlatTree : 0, fIndexTree,
+    fGenInfoTree };
+  for(int i = 0; i < 4; i++) {
+    if(!trees[i]) continue;
+    trees[i]->FlushBaskets();
+    trees[i]->Write();
+    TKey * key = fOutFile->GetKey(trees[i]->GetName());
+    checkpoint.trees.push_back(trees[i]->GetName());
+    checkpoint.cycles.push_back((key) ? key->GetCycle() : 0);
+  }
+  checkpoint.runnu    = fRunNu;
+  checkpoint.nentries = fOutTree->GetEntries();
+
+  checkpoint.Write("checkpoint");
+  TKey * ckpkey = fOutFile->GetKey("checkpoint");
+
+  // update the file directory & flush it to disk
+  fOutFile->SaveSelf();
+  fOutFile->Flush();
+
+  // the previous checkpoint is no longer needed
+  this->DeleteCheckpoint();
+  fCheckpoint      = new NtpMCCheckpoint(checkpoint);
+  fCheckpointCycle = (ckpkey) ? ckpkey->GetCycle() : 0;
+
+  fOutFile->SaveSelf();
+
+  if(async) this->StartWriterThread();
+
+  fWriteTime += std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - tstart).count();
+
+  LOG("Ntp", pNOTICE)
+    << "Wrote checkpoint after " << checkpoint.nentries << " events"
+    << " (next event: " << checkpoint.ievent << ")";
+}
+//____________________________________________________________________________
+void NtpWriter::DeleteCheckpoint(void)
+{
+// Deletes the last checkpoint written and the tree key cycles it refers to
+
+  if(!fCheckpoint || !fOutFile) return;
+
+  for(unsigned int i = 0; i < fCheckpoint->trees.size(); i++) {
+    ostringstream name;
+    name << fCheckpoint->trees[i] << ";" << fCheckpoint->cycles[i];
+    fOutFile->Delete(name.str().c_str());
+  }
+  ostringstream name;
+  name << "checkpoint;" << fCheckpointCycle;
+  fOutFile->Delete(name.str().c_str());
+
+  delete fCheckpoint;
+  fCheckpoint = 0;
+}
+//____________________________________________________________________________
+bool NtpWriter::HasCheckpoint(string filename)
+{
+  if(gSystem->AccessPathName(filename.c_str())) return false; // no file
+
+  TFile * file = TFile::Open(filename.c_str(), "READ");
+  bool found = (file && !file->IsZombie() && file->GetKey("checkpoint"));
+  if(file) {
+    file->Close();
+    delete file;
+  }
+  return found;
+}
+//____________________________________________________________________________
+void NtpWriter::PrepareRestart(void)
+{
+// Moves the output file of the interrupted job aside. If it has no
+// checkpoint (eg it was written by a restarted job, itself interrupted
+// before its first checkpoint), the file moved aside then is used instead
 
+  fRestartFilename = fOutFilename + ".restart";
+
+  if(NtpWriter::HasCheckpoint(fOutFilename)) {
+    LOG("Ntp", pNOTICE)
+      << "Restarting the MC job of " << fOutFilename
+      << " (moved to " << fRestartFilename << ")";
+    if(gSystem->Rename(fOutFilename.c_str(), fRestartFilename.c_str()) != 0) {
+      LOG("Ntp", pFATAL)
+        << "Could not move " << fOutFilename << " to " << fRestartFilename;
+      exit(1);
+    }
+  }
+  else
+  if(NtpWriter::HasCheckpoint(fRestartFilename)) {
+    LOG("Ntp", pNOTICE)
+      << "Restarting the MC job of " << fRestartFilename;
+  }
+  else {
+    LOG("Ntp", pFATAL)
+      << "No checkpoint to restart from was found in " << fOutFilename
+      << " or " << fRestartFilename << " - Exiting";
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+NtpMCCheckpoint * NtpWriter::ReadCheckpoint(TFile * file) const
+{
+// Returns the last complete checkpoint of the input file: the checkpoint
+// with the highest key cycle whose trees are all found (a checkpoint being
+// written when the job was interrupted may be incomplete)
+
+  vector<int> cycles;
+  TIter next_key(file->GetListOfKeys());
+  TKey * key = 0;
+  while( (key = dynamic_cast<TKey *>(next_key())) ) {
+    if(string(key->GetName()) == "checkpoint") cycles.push_back(key->GetCycle());
+  }
+  std::sort(cycles.rbegin(), cycles.rend());
+
+  for(unsigned int ic = 0; ic < cycles.size(); ic++) {
+    ostringstream name;
+    name << "checkpoint;" << cycles[ic];
+    NtpMCCheckpoint * ckp =
+        dynamic_cast<NtpMCCheckpoint *> (file->Get(name.str().c_str()));
+    if(!ckp) continue;
+
+    bool complete = (ckp->trees.size() == ckp->cycles.size());
+    for(unsigned int i = 0; complete && i < ckp->trees.size(); i++) {
+      complete = (file->GetKey(ckp->trees[i].c_str(), ckp->cycles[i]) != 0);
+    }
+    if(complete) return ckp;
+
+    LOG("Ntp", pWARN) << "Skipping incomplete checkpoint " << name.str();
+    delete ckp;
+  }
+  return 0;
+}
+//____________________________________________________________________________
+TTree * NtpWriter::OutputTree(string name)
+{
+  if(fOutTree   && name == fOutTree  ->GetName()) return fOutTree;
+  if(fFlatTree  && name == fFlatTree ->GetName()) return fFlatTree;
+  if(fIndexTree && name == fIndexTree->GetName()) return fIndexTree;
+  if(fGenInfoTree && name == fGenInfoTree->GetName()) return fGenInfoTree;
+  return 0;
+}
+//____________________________________________________________________________
+bool NtpWriter::Restart(NtpMCCheckpoint & checkpoint)
+{
+  if(!fOutFile || fRestartFilename.size() == 0) {
+    LOG("Ntp", pERROR)
+      << "Restart() must follow Initialize(), with restart enabled";
+    return false;
+  }
+
+  // opening the file recovers its keys if it was not closed
+  TFile * file = TFile::Open(fRestartFilename.c_str(), "READ");
+  if(!file || file->IsZombie()) {
+    LOG("Ntp", pERROR) << "Could not open " << fRestartFilename;
+    return false;
+  }
+
+  NtpMCCheckpoint * ckp = this->ReadCheckpoint(file);
+  if(!ckp) {
+    LOG("Ntp", pERROR) << "No complete checkpoint in " << fRestartFilename;
+    file->Close();
+    delete file;
+    return false;
+  }
+  LOG("Ntp", pNOTICE) << "Restarting from:\n" << *ckp;
+
+  bool async = (fQueue != 0);
+  this->StopWriterThread();
+
+  // copy the trees of the checkpoint (the baskets are copied as they are,
+  // the trees having the same branches)
+  for(unsigned int i = 0; i < ckp->trees.size(); i++) {
+    ostringstream name;
+    name << ckp->trees[i] << ";" << ckp->cycles[i];
+    TTree * src = dynamic_cast<TTree *> (file->Get(name.str().c_str()));
+    TTree * dst = this->OutputTree(ckp->trees[i]);
+    if(!src || !dst) {
+      LOG("Ntp", pWARN)
+        << "Tree " << ckp->trees[i] << " is not written by this job - Skipped";
+      continue;
+    }
+    fOutFile->cd();
+    dst->CopyEntries(src, -1, "fast");
+    LOG("Ntp", pNOTICE)
+      << "Copied " << dst->GetEntries() << " entries of " << ckp->trees[i];
+  }
+
+  bool ok = (fOutTree->GetEntries() == ckp->nentries);
+  if(!ok) {
+    LOG("Ntp", pERROR)
+      << "Copied " << fOutTree->GetEntries() << " events, while the "
+      << "checkpoint was written after " << ckp->nentries;
+  }
+
+  checkpoint.Copy(*ckp);
+  delete ckp;
+  file->Close();
+  delete file;
+
+  if(!ok) return false;
+
+  // the new output file holds the checkpoint from now on
+  this->WriteCheckpoint(checkpoint);
+  gSystem->Unlink(fRestartFilename.c_str());
+
+  if(async && !fQueue) this->StartWriterThread();
+
+  return true;
+}
+//____________________________________________________________________________
@@ -23,6 +23,7 @@
 #include <string>
 
 #include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpStreamFormat.h"
 
 class TFile;
 class TTree;
@@ -35,7 +36,15 @@ namespace genie {
 
 class EventRecord;
 class NtpMCEventRecord;
+class NtpMCCompactRecord;
 class NtpMCTreeHeader;
+class NtpMCCheckpoint;
+class NtpGSTRecord;
+class NtpKineRecord;
+class NtpEventIndex;
+class NtpGenInfo;
+class NtpWriterQueue;
+class NtpStreamWriter;
 
 class NtpWriter {
 
@@ -55,11 +64,106 @@ public :
   ///< get the even tree
   TTree *  EventTree (void) { return fOutTree; }  
 
+  ///< get the tree header (available after Initialize()). Driver apps may
+  ///< set the sample normalization fields before Save(), where the header
+  ///< is re-written
+  NtpMCTreeHeader * TreeHeader (void) { return fNtpMCTreeHeader; }
+
   ///< use before Initialize() only if you wish to override the default
   ///< filename, or the default filename prefix
   void CustomizeFilename       (string filename);   
   void CustomizeFilenamePrefix (string prefix);
 
+  ///< use before Initialize() only if you wish to write, alongside the GHEP
+  ///< (or compact GHEP) event tree, the flat `gst' summary tree (see kNFFlat)
+  ///< in the same file
+  void EnableFlatTree (bool enable = true) { fWriteFlatTree = enable; }
+
+  ///< get the flat summary tree (the event tree, for the kNFFlat format)
+  TTree *  FlatTree (void) { return fFlatTree; }
+
+  ///< use before Initialize() only if you wish not to write, alongside the
+  ///< GHEP event tree, the `gindex' event index tree (see NtpEventIndex)
+  ///< used by gevpick and gevdump to seek directly to the selected events
+  void EnableEventIndex (bool enable = true) { fWriteIndex = enable; }
+
+  ///< the `ggeninfo' tree of the intermediate generation quantities (see
+  ///< NtpGenInfo) is written alongside the GHEP event tree if their
+  ///< collection is enabled before Initialize() (see GHepGenInfo)
+
+  ///< use before Initialize() only if you wish to write the events from a
+  ///< writer thread owning the output trees, so that generation and I/O
+  ///< overlap. AddEventRecord() copies the event into one of (at most)
+  ///< queue_size buffered records, waiting if all are still to be written.
+  ///< Not to be used with additional user-defined EventTree() branches (if
+  ///< any is found the writer falls back to writing synchronously)
+  void SetAsynchronous (bool async, unsigned int queue_size = 16);
+
+  ///< number of records waiting for the writer thread (0 if synchronous)
+  unsigned int QueueDepth (void) const;
+
+  ///< use before Initialize() only if you wish to override the output file
+  ///< and tree I/O settings. The defaults are taken from the common run
+  ///< options (see RunOpt: --output-compression, --output-basket-size,
+  ///< --output-auto-flush, --output-split-level), otherwise ROOT's defaults
+  ///< are used for compression and auto-flush, 32000 bytes for the basket
+  ///< size, 0 (ROOT 6) or 1 for the split level and 0.2 GB for auto-save.
+  ///< The compression algorithm is one of zlib, lzma, lz4 and zstd, and
+  ///< may also be given along with the level as "algorithm:level"
+  void SetCompression (string algorithm, int level);
+  void SetCompression (string setting);
+  void SetBasketSize  (int      nbytes) { fBasketSize = nbytes;   }
+  void SetAutoFlush   (Long64_t nflush) { fAutoFlush  = nflush;   }
+  void SetAutoSave    (Long64_t nbytes) { fAutoSave   = nbytes;   }
+  void SetSplitLevel  (int      split ) { fSplitLevel = split;    }
+
+  ///< use before Initialize() only if you wish to also send the events to an
+  ///< event stream (pipe, socket, ...) for direct consumption by another
+  ///< application, eg a detector simulation (see NtpStreamWriter). With
+  ///< stream_only, no output file is written (and EventTree() is 0).
+  ///< The default is taken from the common run options (see RunOpt:
+  ///< --output-stream, --output-stream-format, --output-stream-only)
+  void SetOutputStream (string target, NtpStreamFormat_t fmt = kNSBinary,
+                        bool stream_only = false);
+
+  ///< get the event stream (0 if none was requested)
+  NtpStreamWriter * EventStream (void) { return fStream; }
+
+  ///< checkpointing of long MC jobs: write the events added so far, and the
+  ///< input MC job state (see NtpMCCheckpoint), to the output file so that
+  ///< the job can be restarted from this point if it is interrupted. The
+  ///< previous checkpoint is deleted once this one is written.
+  ///< With checkpoints (see RunOpt: --checkpoint-interval), the trees are
+  ///< not auto-saved by ROOT
+  void WriteCheckpoint (NtpMCCheckpoint & checkpoint);
+
+  ///< use before Save() only if the job was ended early (eg on SIGTERM) and
+  ///< may be restarted: the last checkpoint is then kept in the output file
+  void KeepCheckpoint (bool keep = true) { fKeepCheckpoint = keep; }
+
+  ///< use before Initialize() only if you wish to restart an interrupted MC
+  ///< job from its last checkpoint (the default is taken from the common run
+  ///< options, see RunOpt: --restart). The output file of the interrupted
+  ///< job is then moved aside (to <filename>.restart) by Initialize()
+  void SetRestart (bool restart = true) { fRestart = restart; }
+
+  ///< restart of an interrupted MC job: use after Initialize() and after
+  ///< adding any user-defined EventTree() branches. Copies the events of
+  ///< the last checkpoint of the interrupted job into the output file and
+  ///< returns that checkpoint, for restoring the MC job state. Returns false
+  ///< if no valid checkpoint was found
+  bool Restart (NtpMCCheckpoint & checkpoint);
+
+  ///< ROOT compression settings code for the input algorithm and level,
+  ///< or -1 if the algorithm is unknown or unsupported in this ROOT version
+  static int CompressionSettings (string algorithm, int level);
+
+  ///< output statistics, available after Save()
+  double   WriteTime (void) const { return fWriteTime; } ///< time spent writing (sec)
+  Long64_t TotBytes  (void) const { return fTotBytes;  } ///< uncompressed tree bytes
+  Long64_t ZipBytes  (void) const { return fZipBytes;  } ///< compressed tree bytes
+  Long64_t FileSize  (void) const { return fFileSize;  } ///< output file size (bytes)
+
 private:
 
   void SetDefaultFilename    (string filename_prefix="gntp");
@@ -68,6 +172,22 @@ private:
   void CreateTreeHeader      (void);
   void CreateEventBranch     (void);
   void CreateGHEPEventBranch (void);
+  void CreateCompactEventBranch (void);
+  void CreateFlatTree        (void);
+  void CreateIndexTree       (void);
+  void CreateGenInfoTree     (void);
+  void ApplyTreeSettings     (TTree * tree);
+  void StartWriterThread     (void);
+  void StopWriterThread      (void);
+  void RunWriterThread       (void);
+  void QueueEventRecord      (int ievent, const EventRecord * ev_rec);
+  void WriteEventRecord      (NtpMCEventRecord * rec);
+  void FillSummaryTrees      (int ievent, const EventRecord & event);
+  void PrepareRestart        (void);
+  void DeleteCheckpoint      (void);
+  TTree * OutputTree         (string name);
+  NtpMCCheckpoint * ReadCheckpoint (TFile * file) const;
+  static bool HasCheckpoint  (string filename);
 
   NtpMCFormat_t      fNtpFormat;          ///< enumeration of event formats
   Long_t             fRunNu;              ///< run nu
@@ -77,6 +197,38 @@ private:
   TBranch *          fEventBranch;        ///< the generated event branch 
   NtpMCEventRecord * fNtpMCEventRecord;   ///< 
   NtpMCTreeHeader *  fNtpMCTreeHeader;    ///<
+  bool               fWriteFlatTree;      ///< write the flat summary tree alongside GHEP?
+  TTree *            fFlatTree;           ///< flat summary tree
+  NtpGSTRecord *     fGSTRecord;          ///< flat summary tree branch variables
+  NtpMCCompactRecord * fCompactRecord;    ///< compact event record (kNFCompact)
+  NtpKineRecord *    fKineRecord;         ///< kinematics tree branch variables (kNFKine)
+  bool               fWriteIndex;         ///< write the event index tree alongside GHEP?
+  TTree *            fIndexTree;          ///< event index tree
+  NtpEventIndex *    fIndex;              ///< event index tree branch variables
+  TTree *            fGenInfoTree;        ///< generation info tree
+  NtpGenInfo *       fGenInfo;            ///< generation info tree branch variables
+  bool               fAsync;              ///< write from a writer thread?
+  unsigned int       fQueueSize;          ///< max number of buffered records
+  int                fNBranches;          ///< number of event tree branches created by the writer
+  NtpWriterQueue *   fQueue;              ///< writer thread & record queue
+  int                fCompression;        ///< ROOT compression settings (-1: ROOT default)
+  int                fBasketSize;         ///< event branch basket size (bytes)
+  Long64_t           fAutoFlush;          ///< see TTree::SetAutoFlush()
+  Long64_t           fAutoSave;           ///< see TTree::SetAutoSave()
+  int                fSplitLevel;         ///< event branch split level (-1: default)
+  double             fWriteTime;          ///< time spent writing events & file (sec)
+  Long64_t           fTotBytes;           ///< uncompressed size of the output trees
+  Long64_t           fZipBytes;           ///< compressed size of the output trees
+  Long64_t           fFileSize;           ///< output file size
+  string             fStreamTarget;       ///< event stream target (empty: none)
+  NtpStreamFormat_t  fStreamFormat;       ///< event stream format
+  bool               fStreamOnly;         ///< write the event stream only (no file)?
+  NtpStreamWriter *  fStream;             ///< event stream
+  bool               fRestart;            ///< restart an interrupted MC job?
+  string             fRestartFilename;    ///< output file of the interrupted MC job
+  NtpMCCheckpoint *  fCheckpoint;         ///< last checkpoint written
+  int                fCheckpointCycle;    ///< key cycle of the last checkpoint written
+  bool               fKeepCheckpoint;     ///< keep the last checkpoint in Save()?
 };
 
 }      // genie namespace
@@ -0,0 +1,94 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include "Framework/Numerical/AliasSampler.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+AliasSampler::AliasSampler() :
+fSum(0)
+{
+
+}
+//____________________________________________________________________________
+AliasSampler::AliasSampler(const std::vector<double> & weights) :
+fSum(0)
+{
+  this->Build(weights);
+}
+//____________________________________________________________________________
+AliasSampler::~AliasSampler()
+{
+
+}
+//____________________________________________________________________________
+void AliasSampler::Clear(void)
+{
+  fProb.clear();
+  fAlias.clear();
+  fNorm.clear();
+  fSum = 0;
+}
+//____________________________________________________________________________
+bool AliasSampler::Build(const std::vector<double> & weights)
+{
+  this->Clear();
+
+  int n = weights.size();
+  double sum = 0;
+  for(int i = 0; i < n; i++) {
+    if(weights[i] > 0) sum += weights[i];
+  }
+  if(n == 0 || sum <= 0) return false;
+
+  fSum = sum;
+  fNorm.resize(n);
+  fProb.resize(n);
+  fAlias.resize(n);
+
+  // Vose's construction: split the columns (scaled to a mean of 1) into
+  // the ones below and above the mean and pair them up
+  std::vector<int> small, large;
+  small.reserve(n);
+  large.reserve(n);
+  for(int i = 0; i < n; i++) {
+    fNorm[i]  = (weights[i] > 0) ? weights[i]/sum : 0;
+    fProb[i]  = fNorm[i] * n;
+    fAlias[i] = i;
+    if(fProb[i] < 1) small.push_back(i);
+    else             large.push_back(i);
+  }
+  while(!small.empty() && !large.empty()) {
+    int s = small.back(); small.pop_back();
+    int l = large.back();
+    fAlias[s] = l;
+    fProb[l] -= (1 - fProb[s]);
+    if(fProb[l] < 1) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // left-overs are full columns (up to rounding)
+  for(unsigned int i = 0; i < large.size(); i++) fProb[large[i]] = 1;
+  for(unsigned int i = 0; i < small.size(); i++) fProb[small[i]] = 1;
+
+  return true;
+}
+//____________________________________________________________________________
+double AliasSampler::Probability(int i) const
+{
+  if(i < 0 || i >= (int)fNorm.size()) return 0;
+  return fNorm[i];
+}
+//____________________________________________________________________________
@@ -0,0 +1,71 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AliasSampler
+
+\brief    Walker's alias method for sampling a discrete distribution.
+
+          The table is built once, in O(n), from the (not necessarily
+          normalised) weights of the n outcomes. Each draw then takes a
+          single uniform random number and O(1) operations, whatever the
+          number of outcomes, instead of the binary search over a cumulative
+          distribution (TH1::GetRandom() and alike) or the linear scan over
+          the outcomes.
+
+          See: A.J.Walker, ACM Trans. Math. Software 3 (1977) 253 and
+          M.D.Vose, IEEE Trans. Software Eng. 17 (1991) 972
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _ALIAS_SAMPLER_H_
+#define _ALIAS_SAMPLER_H_
+
+#include <vector>
+
+namespace genie {
+
+class AliasSampler {
+
+public:
+  AliasSampler();
+  AliasSampler(const std::vector<double> & weights);
+ ~AliasSampler();
+
+  //! Build the table; false (and an empty table) if no weight is positive.
+  //! Negative weights are taken as 0.
+  bool   Build       (const std::vector<double> & weights);
+  void   Clear       (void);
+
+  int    Size        (void) const { return fProb.size(); }
+  bool   IsEmpty     (void) const { return fProb.empty(); }
+  double Sum         (void) const { return fSum; }        ///< sum of the weights
+  double Probability (int i) const;                       ///< normalised weight of outcome i
+
+  //! Outcome for the uniform random number u in [0,1)
+  int Sample (double u) const
+  {
+    int    n = fProb.size();
+    double x = u * n;
+    int    i = (int) x;
+    if (i >= n) i = n - 1;
+    return (x - i < fProb[i]) ? i : fAlias[i];
+  }
+
+private:
+  std::vector<double> fProb;   ///< probability of keeping column i
+  std::vector<int>    fAlias;  ///< outcome taken instead of i otherwise
+  std::vector<double> fNorm;   ///< normalised weights
+  double              fSum;
+};
+
+}      // genie namespace
+
+#endif // _ALIAS_SAMPLER_H_
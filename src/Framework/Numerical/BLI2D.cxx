@@ -17,6 +17,10 @@
    in all lines similar to `int ix = (xmax-xmin)/dx'.
  @ July 29, 2011 - AM
    Added BLI2DNonUnifGrid.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   BLI2DNonUnifGrid::Evaluate finds the cell with an index of uniform buckets
+   (near uniform axes) or a binary search, instead of a linear scan. Added a
+   batch Evaluate.
 
 */
 //____________________________________________________________________________
@@ -25,12 +29,36 @@
 
 #include <cassert>
 #include <limits>
+#include <algorithm>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/BLI2D.h"
 
 using namespace genie;
 
+namespace {
+  // Knot interval k (knots[k] <= v <= knots[k+1], 0 <= k <= n-2) of v
+  // in [knots[0], knots[n-1]], from the bucket index if there is one
+  inline int FindInterval(
+     const double * knots, int n, const int * idx, int nidx, double v)
+  {
+    int k = 0;
+    if(nidx > 0) {
+      int b = (int) ((v - knots[0]) * nidx / (knots[n-1] - knots[0]));
+      if(b < 0)      b = 0;
+      if(b > nidx-1) b = nidx-1;
+      k = idx[b];
+      while(k < n-2 && v > knots[k+1]) k++;
+      while(k > 0   && v < knots[k]  ) k--;
+    } else {
+      k = (int) (std::lower_bound(knots, knots+n, v) - knots) - 1;
+      if(k < 0)   k = 0;
+      if(k > n-2) k = n-2;
+    }
+    return k;
+  }
+}
+
 ClassImp(BLI2DGrid)
 
 //___________________________________________________________________________
@@ -51,6 +79,11 @@ int BLI2DGrid::IdxZ(int ix, int iy) const
   return ix*fNY+iy;
 }
 //___________________________________________________________________________
+size_t BLI2DGrid::MemorySize(void) const
+{
+  return sizeof(BLI2DGrid) + (fNX + fNY + fNZ) * sizeof(double);
+}
+//___________________________________________________________________________
 //___________________________________________________________________________
 //___________________________________________________________________________
 ClassImp(BLI2DUnifGrid)
@@ -215,6 +248,12 @@ BLI2DNonUnifGrid::BLI2DNonUnifGrid(
   }
 }
 //___________________________________________________________________________
+BLI2DNonUnifGrid::~BLI2DNonUnifGrid()
+{
+  if (fIdxX) { delete [] fIdxX; }
+  if (fIdxY) { delete [] fIdxY; }
+}
+//___________________________________________________________________________
 bool BLI2DNonUnifGrid::AddPoint(double x, double y, double z)
 {
 
@@ -320,6 +359,10 @@ bool BLI2DNonUnifGrid::AddPoint(double x, double y, double z)
       fYmax = TMath::Max(y,fYmax);
     }
 
+  // the knots changed: rebuild the cell index
+  if (changex) this->BuildIndex(fX, fNFillX, fNIdxX, fIdxX);
+  if (changey) this->BuildIndex(fY, fNFillY, fNIdxY, fIdxY);
+
   int iz = this->IdxZ(xidx,yidx);
 
   fZ[iz] = z;
@@ -342,31 +385,14 @@ double BLI2DNonUnifGrid::Evaluate(double x, double y) const
   double evaly=TMath::Min(y,fYmax);
   evaly=TMath::Max(evaly,fYmin);
 
-  int ix_lo  = -2; 
-  int iy_lo  = -2;
-  for (int i=0;i<fNFillX;i++)
-    {
-      if (evalx<=fX[fNFillX-1-i]) ix_lo=fNFillX-2-i;
-      else break;
-    }
-  for (int i=0;i<fNFillY;i++)
-    {
-      if (evaly<=fY[fNFillY-1-i]) iy_lo=fNFillY-2-i;
-      else break;
-    }
+  // if the grid isn't filled
+  if (fNFillX<2 || fNFillY<2) return 0.;
+
+  int ix_lo  = FindInterval(fX, fNFillX, fIdxX, fNIdxX, evalx);
+  int iy_lo  = FindInterval(fY, fNFillY, fIdxY, fNIdxY, evaly);
   int ix_hi  = ix_lo + 1;
   int iy_hi  = iy_lo + 1;
 
-  // in case x = xmin
-  if (ix_lo==-1) {ix_lo++; ix_hi++;}
-  if (iy_lo==-1) {iy_lo++; iy_hi++;}
-  // in case x = xmax
-  if (ix_lo==-2) {ix_lo=fNFillX-2; ix_hi=fNFillX-1;}
-  if (iy_lo==-2) {iy_lo=fNFillY-2; iy_hi=fNFillY-1;}
-  // if an error occurs
-  if (ix_lo<0       || iy_lo<0      ) return 0.;
-  if (ix_hi>fNFillX || iy_hi>fNFillY) return 0.;
-
   double x1  = fX[ix_lo];
   double x2  = fX[ix_hi];
   double y1  = fY[iy_lo];
@@ -397,6 +423,56 @@ double BLI2DNonUnifGrid::Evaluate(double x, double y) const
   return z;
 }
 //___________________________________________________________________________
+void BLI2DNonUnifGrid::Evaluate(
+  const double * x, const double * y, double * z, int n) const
+{
+  for (int i=0;i<n;i++) z[i] = this->Evaluate(x[i], y[i]);
+}
+//___________________________________________________________________________
+size_t BLI2DNonUnifGrid::MemorySize(void) const
+{
+  return BLI2DGrid::MemorySize() - sizeof(BLI2DGrid) + sizeof(BLI2DNonUnifGrid) +
+         (fNIdxX + fNIdxY) * sizeof(int);
+}
+//___________________________________________________________________________
+void BLI2DNonUnifGrid::BuildIndex(
+  const double * knots, int nknots, int & nidx, int *& idx)
+{
+// Index of 2(n-1) uniform buckets over the n knots: the knot interval at the
+// start of each bucket. Dropped if any bucket spans more than a few knot
+// intervals (a far from uniform axis), which is then binary searched.
+
+  const int kMaxIntervalsPerBucket = 4;
+
+  if (idx) { delete [] idx; }
+  idx  = 0;
+  nidx = 0;
+
+  if (nknots<3) return;
+  double span = knots[nknots-1] - knots[0];
+  if (span<=0) return;
+
+  int nb = 2*(nknots-1);
+  int * buckets = new int[nb];
+  int k = 0;
+  for (int b=0;b<nb;b++)
+    {
+      double start = knots[0] + b*span/nb;
+      while (k<nknots-2 && knots[k+1]<=start) k++;
+      buckets[b] = k;
+    }
+  for (int b=0;b<nb;b++)
+    {
+      int next = (b<nb-1) ? buckets[b+1] : nknots-2;
+      if (next-buckets[b] > kMaxIntervalsPerBucket) {
+        delete [] buckets;
+        return;
+      }
+    }
+  idx  = buckets;
+  nidx = nb;
+}
+//___________________________________________________________________________
 void BLI2DNonUnifGrid::Init(
   int nx, double xmin, double xmax, int ny, double ymin, double ymax)
 {
@@ -405,6 +481,10 @@ void BLI2DNonUnifGrid::Init(
   fNZ    = 0;
   fNFillX= 0;
   fNFillY= 0;
+  fNIdxX = 0;
+  fNIdxY = 0;
+  fIdxX  = 0;
+  fIdxY  = 0;
   fXmin  = 0.;
   fXmax  = 0.;
   fYmin  = 0.;
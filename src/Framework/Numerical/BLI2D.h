@@ -46,6 +46,9 @@ public:
   double ZMin (void) const { return fZmin; }
   double ZMax (void) const { return fZmax; }
 
+  //-- bytes held by the grid (see MemoryStats)
+  virtual size_t MemorySize (void) const;
+
 protected:
 
   virtual void Init (int nx, double xmin, double xmax, int ny, double ymin, double ymax) =0;
@@ -104,6 +107,7 @@ public:
   BLI2DNonUnifGrid();
   BLI2DNonUnifGrid(int nx, double xmin, double xmax, int ny, double ymin, double ymax);
   BLI2DNonUnifGrid(int nx, int ny, double *x, double *y, double *z);
+ ~BLI2DNonUnifGrid();
 
   //-- add another point in the grid
   bool AddPoint(double x, double y, double z);
@@ -111,13 +115,28 @@ public:
   //-- evaluate the function at the input position
   double Evaluate (double x, double y) const;
 
+  //-- evaluate the function at n input positions: z[i] = f(x[i],y[i])
+  void   Evaluate (const double * x, const double * y, double * z, int n) const;
+
+  size_t MemorySize (void) const;
+
 private:
 
-  void Init (int nx=0, double xmin=0, double xmax=0, int ny=0, double ymin=0, double ymax=0);
+  void Init       (int nx=0, double xmin=0, double xmax=0, int ny=0, double ymin=0, double ymax=0);
+  void BuildIndex (const double * knots, int nknots, int & nidx, int *& idx);
+
   int      fNFillX;
   int      fNFillY;
 
-  ClassDef(BLI2DNonUnifGrid, 1)
+  // The cells are found with a single lookup in an index of uniform buckets,
+  // sent to the knot interval at the bucket start, for (near) uniform axes
+  // and with a binary search otherwise (no index)
+  int      fNIdxX;
+  int      fNIdxY;
+  int *    fIdxX;  //[fNIdxX]
+  int *    fIdxY;  //[fNIdxY]
+
+  ClassDef(BLI2DNonUnifGrid, 2)
   };
 
 }
@@ -0,0 +1,215 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include "Framework/Numerical/CounterRandom.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace {
+
+  const uint32_t kPhiloxM0 = 0xD2511F53;
+  const uint32_t kPhiloxM1 = 0xCD9E8D57;
+  const uint32_t kPhiloxW0 = 0x9E3779B9;
+  const uint32_t kPhiloxW1 = 0xBB67AE85;
+
+  // SplitMix64 finalizer, used to spread (seed, run) over the key bits
+  uint64_t Mix64(uint64_t x)
+  {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+  }
+}
+//____________________________________________________________________________
+CounterRandom::CounterRandom(unsigned int stream) :
+TRandom3()
+{
+  fCounter[0] = 0;
+  fCounter[1] = stream;
+  fCounter[2] = 0;
+  fCounter[3] = 0;
+  fSubStream  = 0;
+  this->SetKey(0, 0);
+}
+//____________________________________________________________________________
+CounterRandom::~CounterRandom()
+{
+
+}
+//____________________________________________________________________________
+void CounterRandom::SetKey(Long64_t seed, Long64_t run)
+{
+  fBaseKey = Mix64( Mix64((uint64_t) seed) ^ (uint64_t) run );
+  this->SetSubStream(fSubStream);
+}
+//____________________________________________________________________________
+void CounterRandom::SetSubStream(ULong64_t sub)
+{
+  fSubStream = sub;
+
+  uint64_t key = (sub == 0) ? fBaseKey : Mix64(fBaseKey ^ Mix64((uint64_t) sub));
+  fKey[0] = (uint32_t) (key & 0xFFFFFFFFULL);
+  fKey[1] = (uint32_t) (key >> 32);
+
+  this->SetEvent(this->Event());
+}
+//____________________________________________________________________________
+void CounterRandom::SetEvent(ULong64_t ievent)
+{
+  fCounter[0] = 0;
+  fCounter[2] = (uint32_t) (ievent & 0xFFFFFFFFULL);
+  fCounter[3] = (uint32_t) (ievent >> 32);
+  fNUsed      = 2;
+}
+//____________________________________________________________________________
+ULong64_t CounterRandom::Event(void) const
+{
+  return ((ULong64_t) fCounter[3] << 32) | fCounter[2];
+}
+//____________________________________________________________________________
+ULong64_t CounterRandom::NDrawn(void) const
+{
+  return 2 * (ULong64_t) fCounter[0] + fNUsed - 2;
+}
+//____________________________________________________________________________
+void CounterRandom::Seek(ULong64_t ndrawn)
+{
+  fCounter[0] = (uint32_t) (ndrawn / 2);
+  fNUsed      = 2;
+  if(ndrawn % 2 == 1) {
+    Philox4x32(fCounter, fKey, fBlock);
+    fCounter[0]++;
+    fNUsed = 1;
+  }
+}
+//____________________________________________________________________________
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+Double_t CounterRandom::Rndm(void)
+#else
+Double_t CounterRandom::Rndm(Int_t)
+#endif
+{
+  return this->Next();
+}
+//____________________________________________________________________________
+void CounterRandom::RndmArray(Int_t n, Float_t * array)
+{
+  for(Int_t i = 0; i < n; i++) {
+    // keep the (0,1) range after rounding to float
+    Float_t r = 0;
+    while(r <= 0 || r >= 1) r = (Float_t) this->Next();
+    array[i] = r;
+  }
+}
+//____________________________________________________________________________
+void CounterRandom::RndmArray(Int_t n, Double_t * array)
+{
+// Same numbers as n calls to Rndm(), with the blocks computed in batches
+
+  const double kNorm = 1.0 / 9007199254740992.0;
+
+  Int_t i = 0;
+  while(i < n && fNUsed < 2) array[i++] = this->Next();
+
+  uint32_t out[4][kNBatch];
+  while(n - i >= 2*kNBatch) {
+    Philox4x32Batch(fCounter, fKey, out);
+    double r[2*kNBatch];
+    bool   zero = false;
+    for(int j = 0; j < kNBatch; j++) {
+      r[2*j]   = ((out[0][j] >> 5) * 67108864.0 + (out[1][j] >> 6)) * kNorm;
+      r[2*j+1] = ((out[2][j] >> 5) * 67108864.0 + (out[3][j] >> 6)) * kNorm;
+      zero = zero || (r[2*j] == 0) || (r[2*j+1] == 0);
+    }
+    // zeros are skipped: leave those (very rare) batches to Next()
+    if(zero) break;
+    for(int j = 0; j < 2*kNBatch; j++) array[i+j] = r[j];
+    i           += 2*kNBatch;
+    fCounter[0] += kNBatch;
+  }
+
+  while(i < n) array[i++] = this->Next();
+}
+//____________________________________________________________________________
+double CounterRandom::Next(void)
+{
+// Uniform in (0,1), with 53 random bits (2 per 4x32-bit block)
+
+  while(true) {
+    if(fNUsed == 2) {
+      Philox4x32(fCounter, fKey, fBlock);
+      fCounter[0]++;
+      fNUsed = 0;
+    }
+    uint32_t a = fBlock[2*fNUsed]   >> 5;
+    uint32_t b = fBlock[2*fNUsed+1] >> 6;
+    fNUsed++;
+    double r = (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+    if(r > 0) return r;
+  }
+}
+//____________________________________________________________________________
+void CounterRandom::Philox4x32(
+   const uint32_t counter[4], const uint32_t key[2], uint32_t out[4])
+{
+  uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+  uint32_t k0 = key[0],     k1 = key[1];
+
+  for(int round = 0; round < 10; round++) {
+    uint64_t p0 = (uint64_t) kPhiloxM0 * c0;
+    uint64_t p1 = (uint64_t) kPhiloxM1 * c2;
+    uint32_t hi0 = (uint32_t) (p0 >> 32), lo0 = (uint32_t) p0;
+    uint32_t hi1 = (uint32_t) (p1 >> 32), lo1 = (uint32_t) p1;
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+    k0 += kPhiloxW0;
+    k1 += kPhiloxW1;
+  }
+  out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+//____________________________________________________________________________
+void CounterRandom::Philox4x32Batch(
+   const uint32_t counter[4], const uint32_t key[2], uint32_t out[4][kNBatch])
+{
+  uint32_t c0[kNBatch], c1[kNBatch], c2[kNBatch], c3[kNBatch];
+  for(int i = 0; i < kNBatch; i++) {
+    c0[i] = counter[0] + i;
+    c1[i] = counter[1];
+    c2[i] = counter[2];
+    c3[i] = counter[3];
+  }
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for(int round = 0; round < 10; round++) {
+    for(int i = 0; i < kNBatch; i++) {
+      uint64_t p0 = (uint64_t) kPhiloxM0 * c0[i];
+      uint64_t p1 = (uint64_t) kPhiloxM1 * c2[i];
+      uint32_t n0 = (uint32_t) (p1 >> 32) ^ c1[i] ^ k0;
+      uint32_t n2 = (uint32_t) (p0 >> 32) ^ c3[i] ^ k1;
+      c1[i] = (uint32_t) p1;
+      c3[i] = (uint32_t) p0;
+      c0[i] = n0;
+      c2[i] = n2;
+    }
+    k0 += kPhiloxW0;
+    k1 += kPhiloxW1;
+  }
+  for(int i = 0; i < kNBatch; i++) {
+    out[0][i] = c0[i]; out[1][i] = c1[i]; out[2][i] = c2[i]; out[3][i] = c3[i];
+  }
+}
+//____________________________________________________________________________
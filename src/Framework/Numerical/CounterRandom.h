@@ -0,0 +1,107 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::CounterRandom
+
+\brief    A counter-based (Philox4x32-10) random number generator, usable
+          wherever a TRandom3 is expected (see RandomGen).
+
+          Each random number is a pure function of a key and a counter:
+          The key is derived from the (seed, run number) pair and the counter
+          from the (event index, stream id, draw index) triplet. Independent
+          streams (eg one per GENIE subsystem) are obtained by using distinct
+          stream ids, and the draws of a given event do not depend on the
+          events generated before it (or on the thread or node generating it).
+          All TRandom methods (Gaus(), Uniform(), Poisson(), ...) draw from
+          the counter-based sequence through the Rndm() override. The
+          TRandom3::SetSeed() state is not used.
+          RndmArray() computes the generator blocks in batches (a loop that
+          the compiler can vectorize), and Seek() moves the position within
+          the event's sequence, so that buffered draws can hand back the
+          numbers they did not use (see UniformBuffer).
+          SetSubStream() switches to one of the independent sub-streams of
+          the current key, eg one per event processing step (see the common
+          random numbers of RandomGen).
+
+          See: J.K.Salmon et al., Parallel random numbers: As easy as 1, 2, 3,
+          SC11 (2011)
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _COUNTER_RANDOM_H_
+#define _COUNTER_RANDOM_H_
+
+#include <stdint.h>
+
+#include <TRandom3.h>
+#include <RVersion.h>
+
+namespace genie {
+
+class CounterRandom : public TRandom3 {
+
+public:
+  CounterRandom(unsigned int stream = 0);
+  virtual ~CounterRandom();
+
+  //! Set the key (resets the draws of the current event)
+  void      SetKey     (Long64_t seed, Long64_t run);
+
+  //! Start the draws of the input event
+  void      SetEvent   (ULong64_t ievent);
+
+  //! Switch to the input sub-stream of the (seed, run) key, from the start
+  //! of the current event's draws (0: the key itself)
+  void      SetSubStream (ULong64_t sub);
+  ULong64_t SubStream    (void) const { return fSubStream; }
+
+  unsigned int Stream  (void) const { return fCounter[1]; }
+  ULong64_t Event      (void) const;
+  ULong64_t NDrawn     (void) const; ///< uniform numbers drawn for the current event
+
+  //! Move to the input position (uniform numbers drawn) in the current event
+  void      Seek       (ULong64_t ndrawn);
+
+  using TRandom3::Rndm;
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  virtual Double_t Rndm      (void);
+#else
+  virtual Double_t Rndm      (Int_t i = 0);
+#endif
+  virtual void     RndmArray (Int_t n, Float_t  * array);
+  virtual void     RndmArray (Int_t n, Double_t * array);
+
+  //! The Philox4x32 bijection (10 rounds)
+  static void Philox4x32 (const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]);
+
+  //! Same, for kNBatch consecutive block indices starting at counter[0]
+  //! (out[j][i]: word j of block i)
+  static const int kNBatch = 8;
+  static void Philox4x32Batch (const uint32_t counter[4], const uint32_t key[2],
+                               uint32_t out[4][kNBatch]);
+
+private:
+  CounterRandom(const CounterRandom & rnd);
+
+  double Next (void);
+
+  uint64_t  fBaseKey;   ///< key derived from (seed, run)
+  ULong64_t fSubStream; ///< current sub-stream (0: none)
+
+  uint32_t fKey     [2];
+  uint32_t fCounter [4]; ///< block index, stream id, event index (low & high 32 bits)
+  uint32_t fBlock   [4]; ///< output of the current block
+  int      fNUsed;       ///< doubles taken from the current block (2 per block)
+};
+
+}      // genie namespace
+
+#endif // _COUNTER_RANDOM_H_
@@ -5,11 +5,20 @@
  or see $GENIE/LICENSE
 
  Author: Steve Dennis <s.r.dennis \at liverpool.ac.uk>
+
+ Important revisions:
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The GSL accelerators (look-up caches modified by each evaluation) are
+   kept per thread, so that interpolators can be shared by the event
+   generation threads. The TGraph2D version is serialised. The GSL objects
+   are released with the GSL free functions.
 */
 //____________________________________________________________________________
 
 #include <cassert>
 #include <cstdlib>
+#include <atomic>
+#include <mutex>
 
 #include "Framework/Numerical/Interpolator2D.h"
 #include "gsl/gsl_version.h"
@@ -24,18 +33,47 @@ using namespace genie;
 // define our Pimpl structs
 struct Interpolator2D::spline2d_container
 {
-  spline2d_container() : spl(NULL) {};
-  ~spline2d_container() { if (spl) delete spl; };
+  spline2d_container() : spl(NULL), id(0) {};
+  ~spline2d_container() { if (spl) gsl_spline2d_free(spl); };
   gsl_spline2d * spl;
+  unsigned long  id;  ///< unique id of the interpolator (see Accelerators())
 };
 //____________________________________________________________________________
 struct Interpolator2D::interp_accel_container
 {
   interp_accel_container() : acc(NULL) {};
-  ~interp_accel_container() { if (acc) delete acc; };
+  ~interp_accel_container() { if (acc) gsl_interp_accel_free(acc); };
   gsl_interp_accel * acc;
 };
 //____________________________________________________________________________
+namespace {
+  // The accelerators of the interpolator last evaluated by the thread. They
+  // are reset when the thread moves to another interpolator (identified by
+  // a unique id, as addresses are re-used), so that the experience of one
+  // grid is never used on another.
+  struct ThreadAccel_t {
+    ThreadAccel_t() : id(0), x(gsl_interp_accel_alloc()), y(gsl_interp_accel_alloc()) {}
+   ~ThreadAccel_t() { gsl_interp_accel_free(x); gsl_interp_accel_free(y); }
+    unsigned long      id;
+    gsl_interp_accel * x;
+    gsl_interp_accel * y;
+  };
+  thread_local ThreadAccel_t gThreadAccel;
+
+  std::atomic<unsigned long> gInterpolator2DIds(0);
+
+  inline ThreadAccel_t & Accelerators(unsigned long id)
+  {
+    ThreadAccel_t & acc = gThreadAccel;
+    if (acc.id != id) {
+      gsl_interp_accel_reset(acc.x);
+      gsl_interp_accel_reset(acc.y);
+      acc.id = id;
+    }
+    return acc;
+  }
+}
+//____________________________________________________________________________
 
 // Now define our actual code (GSL)
 //____________________________________________________________________________
@@ -43,14 +81,13 @@ Interpolator2D::Interpolator2D(
   const size_t & size_x, const double * grid_x,
   const size_t & size_y, const double * grid_y,
   const double * knots) :
-  fSpline (new Interpolator2D::spline2d_container()     ),
-  fAcc_x  (new Interpolator2D::interp_accel_container() ),
-  fAcc_y  (new Interpolator2D::interp_accel_container() )
+  fSpline (new Interpolator2D::spline2d_container()),
+  fAcc_x  (NULL),
+  fAcc_y  (NULL)
 {
   fSpline->spl = gsl_spline2d_alloc(gsl_interp2d_bilinear,size_x,size_y);
   gsl_spline2d_init(fSpline->spl,grid_x,grid_y,knots,size_x,size_y);
-  fAcc_x->acc = gsl_interp_accel_alloc();
-  fAcc_y->acc = gsl_interp_accel_alloc();
+  fSpline->id  = ++gInterpolator2DIds;
 }
 //____________________________________________________________________________
 Interpolator2D::~Interpolator2D()
@@ -62,50 +99,44 @@ Interpolator2D::~Interpolator2D()
 //____________________________________________________________________________
 double Interpolator2D::Eval(const double & x, const double & y) const
 {
+  ThreadAccel_t & acc = Accelerators(fSpline->id);
   return gsl_spline2d_eval(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+    fSpline->spl, x, y, acc.x, acc.y);
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivX(const double & x, const double & y) const
 {
+  ThreadAccel_t & acc = Accelerators(fSpline->id);
   return gsl_spline2d_eval_deriv_x(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+    fSpline->spl, x, y, acc.x, acc.y);
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivY(const double & x, const double & y) const
 {
+  ThreadAccel_t & acc = Accelerators(fSpline->id);
   return gsl_spline2d_eval_deriv_y(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+    fSpline->spl, x, y, acc.x, acc.y);
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivXX(const double & x, const double & y) const
 {
+  ThreadAccel_t & acc = Accelerators(fSpline->id);
   return gsl_spline2d_eval_deriv_xx(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+    fSpline->spl, x, y, acc.x, acc.y);
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivXY(const double & x, const double & y) const
 {
+  ThreadAccel_t & acc = Accelerators(fSpline->id);
   return gsl_spline2d_eval_deriv_xy(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+    fSpline->spl, x, y, acc.x, acc.y);
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivYY(const double & x, const double & y) const
 {
+  ThreadAccel_t & acc = Accelerators(fSpline->id);
   return gsl_spline2d_eval_deriv_yy(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+    fSpline->spl, x, y, acc.x, acc.y);
 }
 //____________________________________________________________________________
 //____________________________________________________________________________
@@ -127,6 +158,12 @@ struct Interpolator2D::interp_accel_container
   ~interp_accel_container() { };
 };
 //____________________________________________________________________________
+// TGraph2D::Interpolate() builds its Delaunay triangles on first use and
+// caches the last triangle found
+namespace {
+  std::mutex gInterpolator2DLock;
+}
+//____________________________________________________________________________
 // Now define our actual code (TGraph2D)
 //____________________________________________________________________________
 Interpolator2D::Interpolator2D(
@@ -157,6 +194,7 @@ Interpolator2D::~Interpolator2D()
 //____________________________________________________________________________
 double Interpolator2D::Eval(const double & x, const double & y) const
 {
+  std::lock_guard<std::mutex> guard(gInterpolator2DLock);
   return fSpline->spl->Interpolate(x,y);
 }
 //____________________________________________________________________________
@@ -5,6 +5,8 @@
 
 \brief    A 2D interpolator using the GSL spline type
           If GSL version is not sufficient, does an inefficient version using TGraph2D.
+          The evaluation can be called concurrently by several threads (the
+          GSL accelerators are kept per thread).
 
 \author   Steve Dennis <s.r.dennis \at liverpool.ac.uk>
           University of Liverpool
@@ -45,6 +47,7 @@ class Interpolator2D
     struct spline2d_container    ; // stores type gsl_spline2d
     struct interp_accel_container; // stores type gsl_interp_accel
     // And these are our actual members
+    // (the accelerators are now per thread, see the .cxx: fAcc_x/y are unused)
     spline2d_container             * fSpline;
     mutable interp_accel_container * fAcc_x;
     mutable interp_accel_container * fAcc_y;
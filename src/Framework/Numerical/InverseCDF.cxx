@@ -0,0 +1,118 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+#include <cmath>
+
+#include "Framework/Numerical/InverseCDF.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+InverseCDF::InverseCDF() :
+fIntegral(0)
+{
+
+}
+//____________________________________________________________________________
+InverseCDF::~InverseCDF()
+{
+
+}
+//____________________________________________________________________________
+void InverseCDF::Clear(void)
+{
+  fX.clear();
+  fPdf.clear();
+  fCDF.clear();
+  fIntegral = 0;
+}
+//____________________________________________________________________________
+bool InverseCDF::Build(
+              const std::vector<double> & x, const std::vector<double> & pdf)
+{
+  this->Clear();
+
+  int n = x.size();
+  if(n < 2 || (int)pdf.size() != n) return false;
+
+  fX = x;
+  fPdf.resize(n);
+  fCDF.resize(n);
+  for(int i = 0; i < n; i++) {
+    fPdf[i] = (pdf[i] > 0) ? pdf[i] : 0;
+  }
+
+  // trapezoidal integration (exact for the piecewise linear pdf)
+  fCDF[0] = 0;
+  for(int i = 1; i < n; i++) {
+    fCDF[i] = fCDF[i-1] + 0.5 * (fPdf[i-1] + fPdf[i]) * (fX[i] - fX[i-1]);
+  }
+  double sum = fCDF[n-1];
+  if(sum <= 0) {
+    this->Clear();
+    return false;
+  }
+
+  fIntegral = sum;
+  for(int i = 0; i < n; i++) {
+    fPdf[i] /= sum;
+    fCDF[i] /= sum;
+  }
+  fCDF[n-1] = 1;
+
+  return true;
+}
+//____________________________________________________________________________
+double InverseCDF::XMin(void) const
+{
+  return (fX.empty()) ? 0. : fX.front();
+}
+//____________________________________________________________________________
+double InverseCDF::XMax(void) const
+{
+  return (fX.empty()) ? 0. : fX.back();
+}
+//____________________________________________________________________________
+double InverseCDF::Sample(double u) const
+{
+  if(fCDF.empty()) return 0;
+
+  // interval [x_i, x_i+1] with CDF(x_i) <= u < CDF(x_i+1)
+  int n = fCDF.size();
+  int i = std::upper_bound(fCDF.begin(), fCDF.end(), u) - fCDF.begin() - 1;
+  if(i < 0    ) i = 0;
+  if(i > n - 2) i = n - 2;
+
+  // solve f0*s + (f1-f0)/(2h)*s^2 = u - CDF(x_i) for s in [0,h]
+  double h  = fX[i+1] - fX[i];
+  double f0 = fPdf[i];
+  double f1 = fPdf[i+1];
+  double r  = u - fCDF[i];
+  double a  = 0.5 * (f1 - f0) / h;
+
+  double s = 0;
+  if(std::fabs(a*h) < 1E-9 * (f0 + f1)) {
+    s = (f0 > 0) ? r/f0 : 0.5*h;
+  } else {
+    double disc = std::max(0., f0*f0 + 4*a*r);
+    // numerically stable root of a*s^2 + f0*s - r = 0
+    double den  = f0 + std::sqrt(disc);
+    s = (den > 0) ? 2*r/den : 0.;
+  }
+  if(s < 0) s = 0;
+  if(s > h) s = h;
+
+  return fX[i] + s;
+}
+//____________________________________________________________________________
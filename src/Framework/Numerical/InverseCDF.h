@@ -0,0 +1,62 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::InverseCDF
+
+\brief    Inverse cumulative distribution of a tabulated 1-D pdf.
+
+          The pdf is taken as linear between the input nodes, so that its
+          cumulative distribution is piecewise quadratic and is inverted in
+          closed form within each interval: a draw takes a binary search over
+          the node cumulants and a square root, with no rejection and no
+          truncation at the ends of the range (unlike the fixed binning of
+          TF1::GetRandom()). The nodes need not be equidistant and should be
+          denser where the pdf varies most.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _INVERSE_CDF_H_
+#define _INVERSE_CDF_H_
+
+#include <vector>
+
+namespace genie {
+
+class InverseCDF {
+
+public:
+  InverseCDF();
+ ~InverseCDF();
+
+  //! Build the table from the pdf values at the increasing nodes x;
+  //! false (and an empty table) if the pdf integral is not positive.
+  //! Negative pdf values are taken as 0.
+  bool   Build    (const std::vector<double> & x, const std::vector<double> & pdf);
+  void   Clear    (void);
+
+  bool   IsEmpty  (void) const { return fCDF.empty(); }
+  double Integral (void) const { return fIntegral;    } ///< integral of the input pdf
+  double XMin     (void) const;
+  double XMax     (void) const;
+
+  //! Value x of the distribution for the uniform random number u in [0,1)
+  double Sample   (double u) const;
+
+private:
+  std::vector<double> fX;        ///< nodes
+  std::vector<double> fPdf;      ///< normalised pdf at the nodes
+  std::vector<double> fCDF;      ///< cumulative distribution at the nodes
+  double              fIntegral;
+};
+
+}      // genie namespace
+
+#endif // _INVERSE_CDF_H_
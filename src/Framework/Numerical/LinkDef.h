@@ -10,6 +10,7 @@
 
 #pragma link C++ class genie::RandomGen;
 #pragma link C++ class genie::Spline;
+#pragma link C++ class genie::SplineBank;
 #pragma link C++ class genie::BLI2DGrid;
 #pragma link C++ class genie::BLI2DUnifGrid;
 #pragma link C++ class genie::BLI2DNonUnifGrid;
@@ -0,0 +1,138 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <TRandom.h>
+#include <TRandom3.h>
+#include <TPythia6.h>
+
+#include "Framework/Numerical/ProcessGeneratorLock.h"
+#include "Framework/Numerical/RandomGen.h"
+
+using std::map;
+using std::vector;
+
+using namespace genie;
+
+namespace {
+
+  // gRandom & PYTHIA6 generator states of a RandomGen thread instance (or,
+  // with a null key, of the process) while another one is installed
+  struct ProcessGeneratorState {
+    ProcessGeneratorState() :
+      saved(false), seeded(false), groot_seed(0), pythia6_seed(0) { }
+    bool           saved;        ///< the states below were saved
+    TRandom3       groot;        ///< gRandom
+    vector<int>    mrpy;         ///< PYTHIA6 MRPY(1-6)
+    vector<double> rrpy;         ///< PYTHIA6 RRPY(1-100)
+    bool           seeded;       ///< seeds to apply when installed
+    UInt_t         groot_seed;
+    int            pythia6_seed;
+  };
+
+  std::recursive_mutex gProcessGeneratorMutex;
+  const RandomGen *    gInstalled = 0;  ///< whose states are in gRandom & PYTHIA6 (0: the process)
+  map<const RandomGen *, ProcessGeneratorState> gSavedStates;
+
+  void ApplySeeds(UInt_t groot_seed, int pythia6_seed)
+  {
+    gRandom->SetSeed(groot_seed);
+    // MRPY(2) = 0 forces PYTHIA6 to re-initialize its generator from MRPY(1)
+    TPythia6 * pythia6 = TPythia6::Instance();
+    pythia6->SetMRPY(1, pythia6_seed);
+    pythia6->SetMRPY(2, 0);
+  }
+
+  void SaveStates(const RandomGen * owner)
+  {
+    ProcessGeneratorState & state = gSavedStates[owner];
+    TRandom3 * groot3 = dynamic_cast<TRandom3 *> (gRandom);
+    if(groot3) state.groot = *groot3;
+    TPythia6 * pythia6 = TPythia6::Instance();
+    state.mrpy.resize(6);
+    state.rrpy.resize(100);
+    for(int i = 0; i < 6;   i++) state.mrpy[i] = pythia6->GetMRPY(i+1);
+    for(int i = 0; i < 100; i++) state.rrpy[i] = pythia6->GetRRPY(i+1);
+    state.saved = true;
+  }
+
+  void LoadStates(const RandomGen * owner)
+  {
+    ProcessGeneratorState & state = gSavedStates[owner];
+    if(state.seeded) {
+      ApplySeeds(state.groot_seed, state.pythia6_seed);
+      state.seeded = false;
+      return;
+    }
+    if(!state.saved) return;
+    TRandom3 * groot3 = dynamic_cast<TRandom3 *> (gRandom);
+    if(groot3) *groot3 = state.groot;
+    TPythia6 * pythia6 = TPythia6::Instance();
+    for(int i = 0; i < 6;   i++) pythia6->SetMRPY(i+1, state.mrpy[i]);
+    for(int i = 0; i < 100; i++) pythia6->SetRRPY(i+1, state.rrpy[i]);
+  }
+
+  void Install(const RandomGen * owner)
+  {
+    if(owner == gInstalled) return;
+    SaveStates(gInstalled);
+    LoadStates(owner);
+    gInstalled = owner;
+  }
+}
+//____________________________________________________________________________
+ProcessGeneratorLock::ProcessGeneratorLock()
+{
+  gProcessGeneratorMutex.lock();
+
+  const RandomGen * rnd = RandomGen::Instance();
+  Install( (rnd->IsThreadInstance()) ? rnd : 0 );
+}
+//____________________________________________________________________________
+ProcessGeneratorLock::~ProcessGeneratorLock()
+{
+  gProcessGeneratorMutex.unlock();
+}
+//____________________________________________________________________________
+void ProcessGeneratorLock::Seed(
+   const RandomGen * rnd, UInt_t groot_seed, int pythia6_seed)
+{
+  std::lock_guard<std::recursive_mutex> guard(gProcessGeneratorMutex);
+
+  if(rnd == gInstalled) {
+    ApplySeeds(groot_seed, pythia6_seed);
+    return;
+  }
+  ProcessGeneratorState & state = gSavedStates[rnd];
+  state.seeded       = true;
+  state.groot_seed   = groot_seed;
+  state.pythia6_seed = pythia6_seed;
+}
+//____________________________________________________________________________
+void ProcessGeneratorLock::Release(const RandomGen * rnd)
+{
+  if(!rnd) return;
+
+  std::lock_guard<std::recursive_mutex> guard(gProcessGeneratorMutex);
+
+  // give the generators back to the process
+  if(rnd == gInstalled) {
+    LoadStates(0);
+    gInstalled = 0;
+  }
+  gSavedStates.erase(rnd);
+}
+//____________________________________________________________________________
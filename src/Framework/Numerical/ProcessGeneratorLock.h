@@ -0,0 +1,59 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ProcessGeneratorLock
+
+\brief    Scoped lock for the random number generators shared by the whole
+          process, which event generation threads can not own: ROOT's
+          gRandom (used by TGenPhaseSpace, TF1::GetRandom(), ...) and PYTHIA6
+          (its generator and common blocks).
+          Code drawing from gRandom or calling PYTHIA6 holds the lock for the
+          duration of the calls. Each RandomGen thread instance has its own
+          copy of the gRandom & PYTHIA6 generator states, installed when its
+          thread takes the lock after another thread used them. The numbers
+          drawn by a thread therefore do not depend on the other threads, and
+          the per-event seeds of the counter-based streams (see RandomGen)
+          apply to threads as to the global instance.
+          Locking is recursive. Without thread instances, the lock is never
+          contended and no state is swapped.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _PROCESS_GENERATOR_LOCK_H_
+#define _PROCESS_GENERATOR_LOCK_H_
+
+#include <Rtypes.h>
+
+namespace genie {
+
+class RandomGen;
+
+class ProcessGeneratorLock {
+
+public:
+  ProcessGeneratorLock();
+ ~ProcessGeneratorLock();
+
+  //! Seed the gRandom & PYTHIA6 generators of the input thread instance:
+  //! at once if its state is installed, otherwise when it is next installed
+  static void Seed    (const RandomGen * rnd, UInt_t groot_seed, int pythia6_seed);
+
+  //! Forget the generator states of the input thread instance (deleted)
+  static void Release (const RandomGen * rnd);
+
+private:
+  ProcessGeneratorLock(const ProcessGeneratorLock &);
+  ProcessGeneratorLock & operator = (const ProcessGeneratorLock &);
+};
+
+}      // genie namespace
+
+#endif // _PROCESS_GENERATOR_LOCK_H_
@@ -12,11 +12,25 @@
  Important revisions after version 2.0.0 :
  @ Jan 24, 2013 - CA
    No longer uses the $GSEED variable for setting the random number seed.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added optional counter-based streams (one per subsystem), keyed by the
+   seed and run number and set at each event (see SetCounterBased()).
+   With counter-based streams, gRandom and PYTHIA6 are re-seeded at each
+   event so that single events can be replayed exactly.
+   Added GetState() and SetState(), used for checkpointing MC jobs.
+   Added common random numbers (sub-streams per event processing step, see
+   SetCommonRandomNumbers()) for correlated comparisons of tunes & models.
+   The global instance is created under a lock.
+   Added independent generators owned by the caller (CreateInstance()),
+   installed per thread with SetThreadInstance().
+   Thread instances have their own gRandom & PYTHIA6 generator states,
+   installed by the ProcessGeneratorLock.
 
 */
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <mutex>
 
 #include <TSystem.h>
 #include <TPythia6.h>
@@ -24,6 +38,8 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/CounterRandom.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
 
 using namespace genie::controls;
 
@@ -31,12 +47,16 @@ namespace genie {
 
 //____________________________________________________________________________
 RandomGen * RandomGen::fInstance = 0;
+
+// private instance of the calling thread (if any)
+static thread_local RandomGen * gThreadRandomGen = 0;
 //____________________________________________________________________________
 RandomGen::RandomGen()
 {
   LOG("Rndm", pINFO) << "RandomGen late initialization";
 
   fInitalized = false;
+  fIsThreadInstance = false;
   fInstance = 0;
 /*
   // try to get this job's random number seed from the environment
@@ -67,17 +87,43 @@ RandomGen::RandomGen()
   fCurrSeed = kDefaultRandSeed; // a default seed number is set a init
   this->InitRandomGenerators(fCurrSeed);
 
+  if ( gSystem->Getenv("GRNDMCOUNTER") ) {
+    this->SetCounterBased(true);
+  }
+  if ( gSystem->Getenv("GRNDMCRN") ) {
+    this->SetCommonRandomNumbers(true);
+  }
+
+  fInitalized = true;
+}
+//____________________________________________________________________________
+RandomGen::RandomGen(long int seed, bool is_thread_instance)
+{
+  fInitalized = false;
+  fIsThreadInstance = is_thread_instance;
+
+  fCurrSeed = seed;
+  this->InitRandomGenerators(fCurrSeed);
+
   fInitalized = true;
 }
 //____________________________________________________________________________
 RandomGen::~RandomGen()
 {
-  fInstance = 0;
+  if(!fIsThreadInstance) fInstance = 0;
+  else ProcessGeneratorLock::Release(this);
+  this->SetCounterBased(false);
   if(fRandom3) delete fRandom3;
 }
 //____________________________________________________________________________
 RandomGen * RandomGen::Instance()
 {
+  if(gThreadRandomGen) return gThreadRandomGen;
+  if(fInstance) return fInstance;
+
+  static std::mutex instance_lock;
+  std::lock_guard<std::mutex> guard(instance_lock);
+
   if(fInstance == 0) {
     static RandomGen::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
@@ -87,6 +133,66 @@ RandomGen * RandomGen::Instance()
   return fInstance;
 }
 //____________________________________________________________________________
+RandomGen * RandomGen::CreateThreadInstance(long int seed)
+{
+// Create a private random number generator for the calling thread. While it
+// exists, RandomGen::Instance() returns it (rather than the global instance)
+// for every call made from that thread.
+// If the global instance uses counter-based streams, so does this one (with
+// the same run number): Using the global seed, events are then generated
+// identically by any thread.
+
+  if(gThreadRandomGen) delete gThreadRandomGen;
+  gThreadRandomGen = CreateInstance(seed);
+  return gThreadRandomGen;
+}
+//____________________________________________________________________________
+RandomGen * RandomGen::CreateInstance(long int seed)
+{
+// Create an independent generator, owned by the caller. As the thread
+// instances, it uses counter-based streams (with the same run number) if
+// the global instance does, and it does not re-seed gRandom & PYTHIA6.
+
+  RandomGen * rnd = new RandomGen(seed, true);
+  if(fInstance && fInstance->CounterBased()) {
+    rnd->SetRunNumber(fInstance->RunNumber());
+    rnd->SetCounterBased(true);
+    rnd->SetCommonRandomNumbers(fInstance->CommonRandomNumbers());
+  }
+  return rnd;
+}
+//____________________________________________________________________________
+void RandomGen::DeleteInstance(RandomGen * rnd)
+{
+  if(!rnd || rnd == fInstance) return;
+  if(rnd == gThreadRandomGen) gThreadRandomGen = 0;
+  delete rnd;
+}
+//____________________________________________________________________________
+RandomGen * RandomGen::SetThreadInstance(RandomGen * rnd)
+{
+// Make the input generator (owned by the caller) the instance of the calling
+// thread, returned by Instance(), or none with a null input. Returns the
+// previous one, which is not deleted.
+
+  RandomGen * previous = gThreadRandomGen;
+  gThreadRandomGen = rnd;
+  return previous;
+}
+//____________________________________________________________________________
+void RandomGen::DeleteThreadInstance(void)
+{
+  if(gThreadRandomGen) {
+    delete gThreadRandomGen;
+    gThreadRandomGen = 0;
+  }
+}
+//____________________________________________________________________________
+bool RandomGen::HasThreadInstance(void)
+{
+  return (gThreadRandomGen != 0);
+}
+//____________________________________________________________________________
 void RandomGen::SetSeed(long int seed)
 {
   LOG("Rndm", pNOTICE)
@@ -109,6 +215,26 @@ void RandomGen::SetSeed(long int seed)
   this->RndNum  ().SetSeed(seed); 
   this->RndGen  ().SetSeed(seed);
 
+  fCurrSeed = seed;
+
+  if(fCounterBased) {
+    for(int i = 0; i < kNRndmStreams; i++) {
+      fCounterRandom[i]->SetKey(fCurrSeed, fRunNumber);
+    }
+    fSeedStream->SetKey(fCurrSeed, fRunNumber);
+    LOG("Rndm", pINFO)
+      << "Counter-based random number streams keyed by seed = " << fCurrSeed
+      << ", run = " << fRunNumber;
+  }
+
+  // Thread instances seed their own copy of the process-wide generators
+  if(fIsThreadInstance) {
+    ProcessGeneratorLock::Seed(this, (UInt_t) seed, (int) (seed % 900000000));
+    LOG("Rndm", pINFO) 
+      << "Thread-local random number generator seed = " << this->RndGen().GetSeed();
+    return;
+  }
+
   // Set the seed number for ROOT's gRandom
   gRandom ->SetSeed (seed);
 
@@ -131,9 +257,223 @@ void RandomGen::SetSeed(long int seed)
   LOG("Rndm", pINFO) << "PYTHIA6  seed = " << pythia6->GetMRPY(1);
 }
 //____________________________________________________________________________
+void RandomGen::SetCounterBased(bool on)
+{
+  if(on == fCounterBased) return;
+  if(!on) this->SetCommonRandomNumbers(false);
+
+  if(on) {
+    LOG("Rndm", pNOTICE) << "Using counter-based random number streams";
+    for(int i = 0; i < kNRndmStreams; i++) {
+      fCounterRandom[i] = new CounterRandom(i);
+      fCounterRandom[i]->SetKey  (fCurrSeed, fRunNumber);
+      fCounterRandom[i]->SetEvent(fEventIndex);
+      fStreams[i] = fCounterRandom[i];
+    }
+    fSeedStream = new CounterRandom(kNRndmStreams);
+    fSeedStream->SetKey(fCurrSeed, fRunNumber);
+  } else {
+    for(int i = 0; i < kNRndmStreams; i++) {
+      fStreams[i] = fRandom3;
+      delete fCounterRandom[i];
+      fCounterRandom[i] = 0;
+    }
+    delete fSeedStream;
+    fSeedStream = 0;
+  }
+  fCounterBased = on;
+}
+//____________________________________________________________________________
+void RandomGen::SetRunNumber(long int run)
+{
+  fRunNumber = run;
+  if(!fCounterBased) return;
+
+  for(int i = 0; i < kNRndmStreams; i++) {
+    fCounterRandom[i]->SetKey(fCurrSeed, fRunNumber);
+  }
+  fSeedStream->SetKey(fCurrSeed, fRunNumber);
+}
+//____________________________________________________________________________
+void RandomGen::SetEventIndex(Long64_t ievent)
+{
+  fEventIndex = ievent;
+  if(!fCounterBased) return;
+
+  fStepDepth = 0;
+  fStepModules.clear();
+  fStepCounts.clear();
+
+  for(int i = 0; i < kNRndmStreams; i++) {
+    fCounterRandom[i]->SetSubStream(0);
+    fCounterRandom[i]->SetEvent(ievent);
+  }
+  this->SeedProcessGenerators();
+}
+//____________________________________________________________________________
+void RandomGen::SetCommonRandomNumbers(bool on)
+{
+  if(on == fCommonRandom) return;
+
+  if(on) {
+    this->SetCounterBased(true);
+    LOG("Rndm", pNOTICE)
+      << "Using common random numbers: Each event processing step draws "
+      << "from its own sub-streams";
+  } else {
+    // back to the streams of the current event (if in a processing step)
+    if(fStepDepth > 0) {
+      fStepDepth = 1;
+      this->EndProcessingStep();
+    }
+    fStepModules.clear();
+    fStepCounts.clear();
+  }
+  fCommonRandom = on;
+}
+//____________________________________________________________________________
+void RandomGen::StartProcessingStep(const string & module)
+{
+// Switch all the streams to the sub-streams of the input module (keyed by
+// its name and by the number of times it was already run in this event, so
+// that a step re-run after an unphysical event gets fresh numbers), saving
+// the position reached in the event's streams
+
+  if(!fCommonRandom) return;
+
+  fStepDepth++;
+  if(fStepDepth > 1) return;
+
+  // FNV-1a hash of the module name
+  ULong64_t hash = 14695981039346656037ULL;
+  for(unsigned int i = 0; i < module.size(); i++) {
+    hash ^= (unsigned char) module[i];
+    hash *= 1099511628211ULL;
+  }
+
+  unsigned int imod = 0;
+  for( ; imod < fStepModules.size(); imod++) {
+    if(fStepModules[imod] == hash) break;
+  }
+  if(imod == fStepModules.size()) {
+    fStepModules.push_back(hash);
+    fStepCounts.push_back(0);
+  }
+  int count = fStepCounts[imod]++;
+
+  // never 0 (the event's streams themselves)
+  ULong64_t sub = (hash ^ (ULong64_t) count * 0x9E3779B97F4A7C15ULL) | 1;
+
+  for(int i = 0; i < kNRndmStreams; i++) {
+    fStepDrawn[i] = fCounterRandom[i]->NDrawn();
+    fCounterRandom[i]->SetSubStream(sub);
+  }
+  this->SeedProcessGenerators(sub);
+}
+//____________________________________________________________________________
+void RandomGen::EndProcessingStep(void)
+{
+// Back to the event's streams, where they were at the start of the step
+
+  if(!fCommonRandom || fStepDepth == 0) return;
+
+  fStepDepth--;
+  if(fStepDepth > 0) return;
+
+  for(int i = 0; i < kNRndmStreams; i++) {
+    fCounterRandom[i]->SetSubStream(0);
+    fCounterRandom[i]->Seek(fStepDrawn[i]);
+  }
+}
+//____________________________________________________________________________
+void RandomGen::SeedProcessGenerators(ULong64_t sub)
+{
+// Re-seed ROOT's gRandom and PYTHIA6 (not counter-based, and used outside
+// RandomGen, eg by TGenPhaseSpace and the PYTHIA6 hadronization) with
+// seeds derived from the key of the current event (and processing step)
+
+  fSeedStream->SetSubStream(sub);
+  fSeedStream->SetEvent(fEventIndex);
+
+  UInt_t groot_seed = 1 + (UInt_t) (4.0e+9 * fSeedStream->Rndm());
+
+  // PYTHIA6 seeds must be in [0, 900000000]; MRPY(2) = 0 forces PYTHIA6 to
+  // re-initialize its generator from MRPY(1) at its next call
+  int pythia6_seed = (int) (9.0e+8 * fSeedStream->Rndm());
+
+  // Thread instances seed their own copy of the process-wide generators,
+  // installed when they take the ProcessGeneratorLock
+  if(fIsThreadInstance) {
+    ProcessGeneratorLock::Seed(this, groot_seed, pythia6_seed);
+    return;
+  }
+
+  gRandom->SetSeed(groot_seed);
+  TPythia6 * pythia6 = TPythia6::Instance();
+  pythia6->SetMRPY(1, pythia6_seed);
+  pythia6->SetMRPY(2, 0);
+}
+//____________________________________________________________________________
+void RandomGen::GetState(TRandom3 & mt, TRandom3 & groot,
+                         vector<int> & mrpy, vector<double> & rrpy) const
+{
+  mt = *fRandom3;
+
+  mrpy.clear();
+  rrpy.clear();
+
+  // Process-wide generators are not owned by thread instances
+  if(fIsThreadInstance) return;
+
+  TRandom3 * groot3 = dynamic_cast<TRandom3 *> (gRandom);
+  if(groot3) groot = *groot3;
+
+  TPythia6 * pythia6 = TPythia6::Instance();
+  for(int i = 1; i <= 6;   i++) mrpy.push_back(pythia6->GetMRPY(i));
+  for(int i = 1; i <= 100; i++) rrpy.push_back(pythia6->GetRRPY(i));
+}
+//____________________________________________________________________________
+void RandomGen::SetState(const TRandom3 & mt, const TRandom3 & groot,
+                   const vector<int> & mrpy, const vector<double> & rrpy)
+{
+  *fRandom3 = mt;
+
+  if(fIsThreadInstance) return;
+
+  TRandom3 * groot3 = dynamic_cast<TRandom3 *> (gRandom);
+  if(groot3) {
+    *groot3 = groot;
+  } else {
+    LOG("Rndm", pWARN)
+      << "gRandom is not a TRandom3 - Its state was not restored";
+  }
+
+  TPythia6 * pythia6 = TPythia6::Instance();
+  for(unsigned int i = 0; i < mrpy.size(); i++) {
+    pythia6->SetMRPY(i+1, mrpy[i]);
+  }
+  for(unsigned int i = 0; i < rrpy.size(); i++) {
+    pythia6->SetRRPY(i+1, rrpy[i]);
+  }
+
+  LOG("Rndm", pNOTICE) << "Restored the random number generator state";
+}
+//____________________________________________________________________________
 void RandomGen::InitRandomGenerators(long int seed)
 {
   fRandom3 = new TRandom3();
+  for(int i = 0; i < kNRndmStreams; i++) {
+    fCounterRandom[i] = 0;
+    fStreams[i]       = fRandom3;
+  }
+  fSeedStream   = 0;
+  fCounterBased = false;
+  fRunNumber    = 0;
+  fEventIndex   = 0;
+  fCommonRandom = false;
+  fStepDepth    = 0;
+  for(int i = 0; i < kNRndmStreams; i++) fStepDrawn[i] = 0;
+
   this->SetSeed(seed);
 }
 //____________________________________________________________________________
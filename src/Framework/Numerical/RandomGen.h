@@ -9,6 +9,31 @@
           to all GENIE modules and that all modules use the preferred rndm
           number generator.
 
+          Optionally (see SetCounterBased(), or set the GRNDMCOUNTER env.
+          var.) each of the generators below is an independent counter-based
+          stream (see CounterRandom), keyed by the seed and the run number.
+          The draws of each event then depend only on (seed, run, event index,
+          stream), so that any event can be re-generated on its own, on any
+          thread or node. The event index must be set at the start of each
+          event (see SetEventIndex(), done by GMCJDriver).
+          ROOT's gRandom and PYTHIA6 are also re-seeded at each event, with
+          seeds derived from the same key (for thread instances, their own
+          copies of these generators, see ProcessGeneratorLock).
+
+          For the comparison of samples generated with different tunes or
+          model options, the counter-based streams can also be used as
+          common random numbers (see SetCommonRandomNumbers(), or set the
+          GRNDMCRN env. var.): Each event processing step (see EventGenerator)
+          then draws from its own sub-streams, keyed by (seed, run, event
+          index, stream, module name, occurrence of the module in the event),
+          while the draws made outside the steps (flux, geometry, interaction
+          selection, ...) continue the event's streams as if the steps had
+          drawn nothing. A step consuming more or fewer numbers in one job
+          therefore does not shift the numbers seen by the other steps, and
+          two jobs consume identical sequences wherever their logic coincides,
+          so that the differences between their samples are highly correlated.
+          Events generated this way can only be replayed in the same mode.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -23,79 +48,171 @@
 #ifndef _RANDOM_GEN_H_
 #define _RANDOM_GEN_H_
 
+#include <vector>
+#include <string>
+
 #include <TRandom3.h>
 
+using std::vector;
+using std::string;
+
 namespace genie {
 
+class CounterRandom;
+
+//! Random number streams (one per GENIE subsystem)
+typedef enum ERndmStream {
+  kRndmKine = 0,
+  kRndmHadro,
+  kRndmDec,
+  kRndmFsi,
+  kRndmLep,
+  kRndmISel,
+  kRndmGeom,
+  kRndmFlux,
+  kRndmEvg,
+  kRndmNum,
+  kRndmGen,
+  kNRndmStreams
+} RndmStream_t;
+
 class RandomGen {
 
 public:
 
   //! Access instance
+  //! (returns the calling thread's private instance, if one was created)
   static RandomGen * Instance();
 
+  //! Per-thread instances, used by multi-threaded event generation drivers.
+  //! Each worker thread gets an independently seeded generator so that its
+  //! random number sequence does not depend on the scheduling of the others.
+  static RandomGen * CreateThreadInstance (long int seed);
+  static void        DeleteThreadInstance (void);
+  static bool        HasThreadInstance    (void);
+
+  //! Thread (or caller-owned) instance? Such instances have their own copy
+  //! of the gRandom & PYTHIA6 states (see ProcessGeneratorLock)
+  bool               IsThreadInstance     (void) const { return fIsThreadInstance; }
+
+  //! Independent generators owned by the caller (eg one per event generation
+  //! driver embedded in a framework, see GMCJDriver::UseRandomGen()). They
+  //! are used when installed as the instance of the calling thread, which
+  //! SetThreadInstance() does (returning the previously installed one, to
+  //! be restored by the caller before the thread instance is deleted).
+  static RandomGen * CreateInstance    (long int seed);
+  static void        DeleteInstance    (RandomGen * rnd);
+  static RandomGen * SetThreadInstance (RandomGen * rnd);
+
   //! Random number generators used by various GENIE modules.
   //! (See note at http://root.cern.ch/root/html//TRandom.html
   //!  on using several TRandom objects each with each own
   //!  "independent" run sequence).
 
   //! At this point, since the actual random number generator
-  //! periodicity is very high, all the generators are in fact one!
-  //! However, the option to use many generators is reserved.
+  //! periodicity is very high, all the generators are in fact one,
+  //! unless counter-based streams are used.
 
   //! Currently, the preferred generator is the "Mersenne Twister"
   //! with a periodicity of 10**6000
   //! See: http://root.cern.ch/root/html/TRandom3.html
 
   //! rnd number generator used by kinematics generators
-  TRandom3 & RndKine (void) const { return *fRandom3; } 
+  TRandom3 & RndKine (void) const { return *fStreams[kRndmKine]; } 
 
   //! rnd number generator used by hadronization models 
-  TRandom3 & RndHadro (void) const { return *fRandom3; }
+  TRandom3 & RndHadro (void) const { return *fStreams[kRndmHadro]; }
 
   //! rnd number generator used by decay models 
-  TRandom3 & RndDec (void) const { return *fRandom3; }
+  TRandom3 & RndDec (void) const { return *fStreams[kRndmDec]; }
 
   //! rnd number generator used by intranuclear cascade monte carlos
-  TRandom3 & RndFsi (void) const { return *fRandom3; }
+  TRandom3 & RndFsi (void) const { return *fStreams[kRndmFsi]; }
 
   //! rnd number generator used by final state primary lepton generators
-  TRandom3 & RndLep (void) const { return *fRandom3; } 
+  TRandom3 & RndLep (void) const { return *fStreams[kRndmLep]; } 
 
   //! rnd number generator used by interaction selectors
-  TRandom3 & RndISel (void) const { return *fRandom3; }
+  TRandom3 & RndISel (void) const { return *fStreams[kRndmISel]; }
 
   //! rnd number generator used by geometry drivers
-  TRandom3 & RndGeom (void) const { return *fRandom3; }
+  TRandom3 & RndGeom (void) const { return *fStreams[kRndmGeom]; }
 
   //! rnd number generator used by flux drivers
-  TRandom3 & RndFlux (void) const { return *fRandom3; }
+  TRandom3 & RndFlux (void) const { return *fStreams[kRndmFlux]; }
 
   //! rnd number generator used by the event generation drivers
-  TRandom3 & RndEvg (void) const { return *fRandom3; }
+  TRandom3 & RndEvg (void) const { return *fStreams[kRndmEvg]; }
 
   //! rnd number generator used by MC integrators & other numerical methods
-  TRandom3 & RndNum (void) const { return *fRandom3; }
+  TRandom3 & RndNum (void) const { return *fStreams[kRndmNum]; }
 
   //! rnd number generator for generic usage
-  TRandom3 & RndGen  (void) const { return *fRandom3; }
+  TRandom3 & RndGen  (void) const { return *fStreams[kRndmGen]; }
+
+  //! rnd number generator of the input stream
+  TRandom3 & Rnd (RndmStream_t stream) const { return *fStreams[stream]; }
+
+  //! Fill the input array with n uniform numbers in (0,1) from the input
+  //! stream (the same numbers as n calls to Rndm(); see also UniformBuffer)
+  void FillUniform (RndmStream_t stream, double * array, int n) const
+  { fStreams[stream]->RndmArray(n, array); }
 
   long int GetSeed (void)         const { return fCurrSeed; }
   void     SetSeed (long int seed);
 
+  //! Counter-based streams, keyed by (seed, run number) & set for each event
+  void     SetCounterBased (bool on);
+  bool     CounterBased    (void) const { return fCounterBased; }
+  void     SetRunNumber    (long int run);
+  long int RunNumber       (void) const { return fRunNumber; }
+  void     SetEventIndex   (Long64_t ievent);
+  Long64_t EventIndex      (void) const { return fEventIndex; }
+
+  //! Common random numbers across jobs (implies counter-based streams)
+  void     SetCommonRandomNumbers (bool on);
+  bool     CommonRandomNumbers    (void) const { return fCommonRandom; }
+
+  //! Start / end an event processing step of the input module (used by
+  //! EventGenerator; nothing is done unless common random numbers are used)
+  void     StartProcessingStep (const string & module);
+  void     EndProcessingStep   (void);
+
+  //! State of the generators, for checkpointing & restarting MC jobs: the
+  //! Mersenne Twister (shared by all but the counter-based streams, which
+  //! are set at each event), ROOT's gRandom and PYTHIA6 (MRPY & RRPY arrays)
+  void     GetState (TRandom3 & mt, TRandom3 & groot,
+                     vector<int> & mrpy, vector<double> & rrpy) const;
+  void     SetState (const TRandom3 & mt, const TRandom3 & groot,
+                     const vector<int> & mrpy, const vector<double> & rrpy);
+
 private:
 
   RandomGen();
+  RandomGen(long int seed, bool is_thread_instance);
   RandomGen(const RandomGen & rgen);
   virtual ~RandomGen();
 
   static RandomGen * fInstance;
 
-  TRandom3 * fRandom3;    ///< Mersenne Twistor
+  TRandom3 *      fRandom3;    ///< Mersenne Twistor
+  CounterRandom * fCounterRandom [kNRndmStreams]; ///< counter-based streams (if used)
+  CounterRandom * fSeedStream;   ///< counter-based stream for the per-event gRandom & PYTHIA6 seeds
+  TRandom3 *      fStreams       [kNRndmStreams]; ///< generator used for each stream
+  bool            fCounterBased; ///< using counter-based streams?
+  long int        fRunNumber;    ///< run number (counter-based streams key)
+  Long64_t        fEventIndex;   ///< current event index (counter-based streams)
+  bool            fCommonRandom; ///< using common random numbers?
+  int             fStepDepth;    ///< nested processing steps (only the outermost one is keyed)
+  ULong64_t       fStepDrawn     [kNRndmStreams]; ///< event's draws before the current step
+  vector<ULong64_t> fStepModules; ///< modules run in the current event...
+  vector<int>       fStepCounts;  ///< ...and the times each was run
   long int   fCurrSeed;   ///< random number generator seed number
   bool       fInitalized; ///< done initializing singleton?
+  bool       fIsThreadInstance; ///< private instance of a worker thread?
 
   void InitRandomGenerators(long int seed);
+  void SeedProcessGenerators(ULong64_t sub = 0);
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
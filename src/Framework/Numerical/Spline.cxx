@@ -10,8 +10,10 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cmath>
 #include <iomanip>
 #include <cfloat>
+#include <algorithm>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -35,11 +37,27 @@ using std::setw;
 using std::setprecision;
 using std::setfill;
 using std::ios;
+using std::lower_bound;
 
 using namespace genie;
 
 ClassImp(Spline)
 
+// Knots with |y| below this value are considered to be y=0 knots
+// (same tolerance as in utils::math::AreEqual)
+static const double kSplZeroKnotY = 0.001*DBL_EPSILON;
+
+// Relative tolerance on the knot spacing for a part of the knot grid to be
+// considered as uniform (in x or in log x). Non-exact uniformity, eg due to
+// the finite precision of knots read from XML files, is corrected for by
+// FindInterval() so it only costs a few extra comparisons.
+static const double kSplGridTolerance = 0.25;
+static const int    kSplGridMinKnots  = 4;
+
+// Max number of knot intervals walked through, before switching to a search,
+// when evaluating the spline at an array of points
+static const int    kSplMaxWalk       = 8;
+
 //___________________________________________________________________________
 namespace genie
 {
@@ -130,19 +148,31 @@ TObject()
 }
 //___________________________________________________________________________
 Spline::Spline(const Spline & spline) :
-  TObject(), fInterpolator(0)
+  TObject()
 {
   LOG("Spline", pDEBUG) << "Spline copy constructor";
 
-  this->LoadFromTSpline3( *spline.GetAsTSpline(), spline.NKnots() );
+  this->InitSpline();
+
+  fNKnots      = spline.fNKnots;
+  fXMin        = spline.fXMin;
+  fXMax        = spline.fXMax;
+  fYMax        = spline.fYMax;
+  fX           = spline.fX;
+  fCoeff       = spline.fCoeff;
+  fGrid        = spline.fGrid;
+  fGridFirst   = spline.fGridFirst;
+  fGridU0      = spline.fGridU0;
+  fGridInvStep = spline.fGridInvStep;
 }
 //___________________________________________________________________________
 Spline::Spline(const TSpline3 & spline, int nknots) :
-  TObject(), fInterpolator(0)
+  TObject()
 {
   LOG("Spline", pDEBUG)
                     << "Constructing spline from the input TSpline3 object";
 
+  this->InitSpline();
   this->LoadFromTSpline3( spline, nknots );
 }
 //___________________________________________________________________________
@@ -324,32 +354,47 @@ bool Spline::LoadFromTSpline3(const TSpline3 & spline, int nknots)
 //___________________________________________________________________________
 void Spline::GetKnot(int iknot, double & x, double & y) const
 {
-  if(!fInterpolator) {
+  if(fNKnots <= 0) {
      LOG("Spline", pWARN) << "Spline has not been built yet!";
      return;
   }
-  fInterpolator->GetKnot(iknot,x,y);
+  // same clamping of the knot index as in TSpline3::GetKnot
+  if(iknot < 0)        iknot = 0;
+  if(iknot >= fNKnots) iknot = fNKnots-1;
+
+  x = fX[iknot];
+  y = fCoeff[4*iknot];
 }
 //___________________________________________________________________________
-double Spline::GetKnotX(int iknot) const
+void Spline::GetCoeff(int iknot, double & x, double & y,
+                              double & b, double & c, double & d) const
 {
-  if(!fInterpolator) {
+  if(fNKnots <= 0) {
      LOG("Spline", pWARN) << "Spline has not been built yet!";
-     return 0;
+     return;
   }
-  double x,y;
-  fInterpolator->GetKnot(iknot,x,y);
+  if(iknot < 0)        iknot = 0;
+  if(iknot >= fNKnots) iknot = fNKnots-1;
+
+  const double * coeff = &fCoeff[4*iknot];
+  x = fX[iknot];
+  y = coeff[0];
+  b = coeff[1];
+  c = coeff[2];
+  d = coeff[3];
+}
+//___________________________________________________________________________
+double Spline::GetKnotX(int iknot) const
+{
+  double x=0, y=0;
+  this->GetKnot(iknot,x,y);
   return x;
 }
 //___________________________________________________________________________
 double Spline::GetKnotY(int iknot) const
 {
-  if(!fInterpolator) {
-     LOG("Spline", pWARN) << "Spline has not been built yet!";
-     return 0;
-  }
-  double x,y;
-  fInterpolator->GetKnot(iknot,x,y);
+  double x=0, y=0;
+  this->GetKnot(iknot,x,y);
   return y;
 }
 //___________________________________________________________________________
@@ -359,55 +404,146 @@ bool Spline::IsWithinValidRange(double x) const
   return is_in_range;
 }
 //___________________________________________________________________________
+size_t Spline::MemorySize(void) const
+{
+  size_t bytes = sizeof(Spline) + fName.capacity() +
+          (fX.capacity() + fCoeff.capacity()) * sizeof(double);
+  if(fInterpolator) {
+    bytes += sizeof(TSpline3) + fNKnots * sizeof(TSplinePoly3);
+  }
+  return bytes;
+}
+//___________________________________________________________________________
 double Spline::Evaluate(double x) const
 {
-  LOG("Spline", pDEBUG) << "Evaluating spline at point x = " << x;
   assert(!TMath::IsNaN(x));
 
   double y = 0;
-  if( this->IsWithinValidRange(x) ) {
+  if( fNKnots > 1 && this->IsWithinValidRange(x) ) {
+    y = this->EvaluateInInterval(this->FindInterval(x), x);
+  } else if ( fNKnots == 1 && this->IsWithinValidRange(x) ) {
+    y = fCoeff[0];
+  } else {
+    LOG("Spline", pDEBUG) << "x = " << x
+     << " is not within spline range [" << fXMin << ", " << fXMax << "]";
+  }
 
-    // we can interpolate within the range of spline knots - be careful with
-    // strange cubic spline behaviour when close to knots with y=0
-    bool is0p = this->ClosestKnotValueIsZero(x, "+");
-    bool is0n = this->ClosestKnotValueIsZero(x, "-");
+  if(y<0 && !fYCanBeNegative) this->WarnNegative(x,y);
 
-    if(!is0p && !is0n) {
-      // both knots (on the left and right are non-zero) - just interpolate
-      LOG("Spline", pDEBUG) << "Point is between non-zero knots";
-      y = fInterpolator->Eval(x);
-    } else {
-      // at least one of the neighboring knots has y=0
-      if(is0p && is0n) {
-        // both neighboring knots have y=0
-        LOG("Spline", pDEBUG) << "Point is between zero knots";
-        y=0;
-      } else {
-        // just 1 neighboring knot has y=0 - do a linear interpolation
-        LOG("Spline", pDEBUG) 
-          << "Point has zero" << (is0n ? " left " : " right ") << "knot";
-        double xpknot=0, ypknot=0, xnknot=0, ynknot=0;
-        this->FindClosestKnot(x, xnknot, ynknot, "-");
-        this->FindClosestKnot(x, xpknot, ypknot, "+");
-        if(is0n) y = ypknot * (x-xnknot)/(xpknot-xnknot);
-        else     y = ynknot * (x-xnknot)/(xpknot-xnknot);
+  return y;
+}
+//___________________________________________________________________________
+void Spline::Evaluate(const double * x, double * y, size_t n) const
+{
+// Evaluates the spline at n points: y[i] = Evaluate(x[i]).
+// The knot interval of each point is searched for starting from the interval
+// of the previous point, so that for sorted input all intervals are found in
+// a single pass over the knots. Unsorted input is handled correctly too.
+
+  if(fNKnots < 2) {
+    for(size_t i = 0; i < n; i++) y[i] = this->Evaluate(x[i]);
+    return;
+  }
+
+  int k    = 0;
+  int kmax = fNKnots-2;
+  for(size_t i = 0; i < n; i++) {
+    double xi = x[i];
+    assert(!TMath::IsNaN(xi));
+
+    double yi = 0;
+    if( this->IsWithinValidRange(xi) ) {
+      if(xi > fX[k+1]) {
+        // walk forward for nearby points, search for distant ones
+        int kwalk = TMath::Min(k + kSplMaxWalk, kmax);
+        while(k < kwalk && xi > fX[k+1]) k++;
+        if(k < kmax && xi > fX[k+1]) k = this->FindInterval(xi);
+      }
+      else if(k > 0 && xi <= fX[k]) {
+        k = this->FindInterval(xi);
       }
+      yi = this->EvaluateInInterval(k, xi);
+    } else {
+      LOG("Spline", pDEBUG) << "x = " << xi
+       << " is not within spline range [" << fXMin << ", " << fXMax << "]";
     }
 
-  } else {
-    LOG("Spline", pDEBUG) << "x = " << x
-     << " is not within spline range [" << fXMin << ", " << fXMax << "]";
+    if(yi<0 && !fYCanBeNegative) this->WarnNegative(xi,yi);
+
+    y[i] = yi;
   }
+}
+//___________________________________________________________________________
+void Spline::Evaluate(
+           double x, const Spline * const splines[], double y[], size_t n)
+{
+// Evaluates n splines at the same point: y[i] = splines[i]->Evaluate(x).
+// The knot interval found for one spline is tried first for the next one,
+// so that the knot search is only done once for splines sharing the same
+// knots (as the cross section splines of an initial state typically do).
 
-  if(y<0 && !fYCanBeNegative) {
-    LOG("Spline", pINFO) << "Negative y (" << y << ")";
-    LOG("Spline", pINFO) << "x = " << x;
-    LOG("Spline", pINFO) << "spline range [" << fXMin << ", " << fXMax << "]";
+  assert(!TMath::IsNaN(x));
+
+  int k = -1;
+  for(size_t i = 0; i < n; i++) {
+    const Spline * spl = splines[i];
+    if(!spl) {
+      y[i] = 0;
+      continue;
+    }
+    if( spl->fNKnots > 1 && spl->IsWithinValidRange(x) ) {
+      if(!spl->IsInInterval(k,x)) k = spl->FindInterval(x);
+      double yi = spl->EvaluateInInterval(k,x);
+      if(yi<0 && !spl->fYCanBeNegative) spl->WarnNegative(x,yi);
+      y[i] = yi;
+    } else {
+      y[i] = spl->Evaluate(x);
+    }
+  }
+}
+//___________________________________________________________________________
+double Spline::EvaluateInInterval(int k, double x) const
+{
+// Evaluates the spline at x, inside the knot interval k
+
+  // be careful with strange cubic spline behaviour when close to knots with y=0
+  const double * coeff = &fCoeff[4*k];
+  double yn = coeff[0];
+  double yp = coeff[4];
+  bool is0n = (TMath::Abs(yn) < kSplZeroKnotY);
+  bool is0p = (TMath::Abs(yp) < kSplZeroKnotY);
+
+  // both knots (on the left and right are non-zero) - just interpolate
+  if(!is0n && !is0p) {
+    double dx = x - fX[k];
+    return coeff[0] + dx * (coeff[1] + dx * (coeff[2] + dx * coeff[3]));
   }
 
-  LOG("Spline", pDEBUG) << "Spline(x = " << x << ") = " << y;
+  // both neighboring knots have y=0
+  if(is0p && is0n) return 0.;
 
-  return y;
+  // just 1 neighboring knot has y=0 - do a linear interpolation
+  double t = (x - fX[k]) / (fX[k+1] - fX[k]);
+  return (is0n) ? yp * t : yn * t;
+}
+//___________________________________________________________________________
+bool Spline::IsInInterval(int k, double x) const
+{
+// Is k the knot interval of x, as it would be returned by FindInterval() ?
+// (x is assumed to be within the valid range)
+
+  int kmax = fNKnots-2;
+  if(k < 0 || k > kmax) return false;
+  if(k > 0    && x <= fX[k]  ) return false;
+  if(k < kmax && x >  fX[k+1]) return false;
+  return true;
+}
+//___________________________________________________________________________
+void Spline::WarnNegative(double x, double y) const
+{
+  LOG("Spline", pINFO) << "Negative y (" << y << ")";
+  LOG("Spline", pINFO) << "x = " << x;
+  LOG("Spline", pINFO) << "spline range [" << fXMin << ", " << fXMax << "]";
 }
 //___________________________________________________________________________
 void Spline::SaveAsXml(
@@ -441,7 +577,7 @@ void Spline::SaveAsXml(
   double x=0, y=0;
   for(int iknot = 0; iknot < nknots; iknot++)
   {
-    fInterpolator->GetKnot(iknot, x, y);
+    this->GetKnot(iknot, x, y);
 
     ofs  << std::fixed << setprecision(5);
     ofs  << "\t<knot>"
@@ -467,7 +603,7 @@ void Spline::SaveAsText(string filename, string format) const
 
   double x=0, y=0;
   for(int iknot = 0; iknot < nknots; iknot++) {
-    fInterpolator->GetKnot(iknot, x, y);
+    this->GetKnot(iknot, x, y);
     char line[1024];
     sprintf(line,format.c_str(),x,y);
     outtxt << line << endl;
@@ -483,7 +619,8 @@ void Spline::SaveAsROOT(string filename, string name, bool recreate) const
   string opt = ( (recreate) ? "RECREATE" : "UPDATE" );
 
   TFile f(filename.c_str(), opt.c_str());
-  if(fInterpolator) fInterpolator->Write(spline_name.c_str());
+  TSpline3 * interpolator = this->GetAsTSpline();
+  if(interpolator) interpolator->Write(spline_name.c_str());
   f.Close();
 }
 //___________________________________________________________________________
@@ -509,8 +646,10 @@ TGraph * Spline::GetAsTGraph(
 
   for(int i=0; i<np; i++) {
       x[i] = ( (use_log) ? TMath::Power(10, xmin+i*dx) : xmin + i*dx );
-      y[i] = this->Evaluate( x[i] );
+  }
+  this->Evaluate(x, y, np);
 
+  for(int i=0; i<np; i++) {
       // scale with x if needed
       if (scale_with_x) y[i] /= x[i];
 
@@ -525,6 +664,20 @@ TGraph * Spline::GetAsTGraph(
   return graph;
 }
 //___________________________________________________________________________
+TSpline3 * Spline::GetAsTSpline(void) const
+{
+// The TSpline3 is not used for evaluating the spline and it is only built
+// (from the spline knots) when it is requested
+
+  if(!fInterpolator && fNKnots > 0) {
+    vector<double> x(fX);
+    vector<double> y(fNKnots);
+    for(int i = 0; i < fNKnots; i++) y[i] = fCoeff[4*i];
+    fInterpolator = new TSpline3("spl3", &x[0], &y[0], fNKnots, "0");
+  }
+  return fInterpolator;
+}
+//___________________________________________________________________________
 void Spline::FindClosestKnot(
               double x, double & xknot, double & yknot, Option_t * opt) const
 {
@@ -535,11 +688,11 @@ void Spline::FindClosestKnot(
 
   if(!pos && !neg) return;
 
-  int iknot = fInterpolator->FindX(x);
+  int iknot = this->FindInterval(x);
 
   double xp=0, yp=0, xn=0, yn=0;
-  fInterpolator->GetKnot(iknot,  xn,yn);
-  fInterpolator->GetKnot(iknot+1,xp,yp);
+  this->GetKnot(iknot,  xn,yn);
+  this->GetKnot(iknot+1,xp,yp);
 
   bool p = (TMath::Abs(x-xp) < TMath::Abs(x-xn));
 
@@ -590,17 +743,21 @@ void Spline::Add(const Spline & spl, double c)
   }
 
   int nknots = this->NKnots();
-  double * x = new double[nknots];
-  double * y = new double[nknots];
+  double * x  = new double[nknots];
+  double * y  = new double[nknots];
+  double * ys = new double[nknots];
+
+  for(int i=0; i<nknots; i++) this->GetKnot(i,x[i],y[i]);
+  spl.Evaluate(x, ys, nknots);
 
   for(int i=0; i<nknots; i++) {  
-    this->GetKnot(i,x[i],y[i]); 
-    y[i] += (c * spl.Evaluate(x[i]));
+    y[i] += (c * ys[i]);
   }
   this->ResetSpline();
   this->BuildSpline(nknots,x,y);
   delete [] x;
   delete [] y;
+  delete [] ys;
 }
 //___________________________________________________________________________
 void Spline::Multiply(const Spline & spl, double c)
@@ -615,17 +772,21 @@ void Spline::Multiply(const Spline & spl, double c)
   }
 
   int nknots = this->NKnots();
-  double * x = new double[nknots];
-  double * y = new double[nknots];
+  double * x  = new double[nknots];
+  double * y  = new double[nknots];
+  double * ys = new double[nknots];
+
+  for(int i=0; i<nknots; i++) this->GetKnot(i,x[i],y[i]);
+  spl.Evaluate(x, ys, nknots);
 
   for(int i=0; i<nknots; i++) {  
-    this->GetKnot(i,x[i],y[i]); 
-    y[i] *= (c * spl.Evaluate(x[i]));
+    y[i] *= (c * ys[i]);
   }
   this->ResetSpline();
   this->BuildSpline(nknots,x,y);
   delete [] x;
   delete [] y;
+  delete [] ys;
 }
 //___________________________________________________________________________
 void Spline::Divide(const Spline & spl, double c)
@@ -640,17 +801,21 @@ void Spline::Divide(const Spline & spl, double c)
   }
 
   int nknots = this->NKnots();
-  double * x = new double[nknots];
-  double * y = new double[nknots];
+  double * x  = new double[nknots];
+  double * y  = new double[nknots];
+  double * ys = new double[nknots];
+
+  for(int i=0; i<nknots; i++) this->GetKnot(i,x[i],y[i]);
+  spl.Evaluate(x, ys, nknots);
 
   for(int i=0; i<nknots; i++) {  
-    this->GetKnot(i,x[i],y[i]); 
-    double denom = c * spl.Evaluate(x[i]);
+    double denom = c * ys[i];
     bool denom_is_zero = TMath::Abs(denom) < DBL_EPSILON;
     if(denom_is_zero) {
         LOG("Spline", pERROR) << "** Refusing to divide spline knot by 0";
         delete [] x;
         delete [] y;
+        delete [] ys;
         return;
     }
     y[i] /= denom;
@@ -659,6 +824,7 @@ void Spline::Divide(const Spline & spl, double c)
   this->BuildSpline(nknots,x,y);
   delete [] x;
   delete [] y;
+  delete [] ys;
 }
 //___________________________________________________________________________
 void Spline::Add(double a)
@@ -718,10 +884,18 @@ void Spline::InitSpline(void)
 {
   LOG("Spline", pDEBUG) << "Initializing spline...";
 
-  fName = "genie-spline";
-  fXMin = 0.0;
-  fXMax = 0.0;
-  fYMax = 0.0;
+  fName   = "genie-spline";
+  fNKnots = 0;
+  fXMin   = 0.0;
+  fXMax   = 0.0;
+  fYMax   = 0.0;
+
+  fX.clear();
+  fCoeff.clear();
+  fGrid        = kGridIrregular;
+  fGridFirst   = 0;
+  fGridU0      = 0.0;
+  fGridInvStep = 0.0;
 
   fInterpolator = 0;
 
@@ -749,9 +923,162 @@ void Spline::BuildSpline(int nentries, double x[], double y[])
   fYMax   = y[ TMath::LocMax(nentries, y) ]; // maximum y in spline
 
   if(fInterpolator) delete fInterpolator;
+  fInterpolator = 0;
 
-  fInterpolator = new TSpline3("spl3", x, y, nentries, "0");
+  fX.assign(x, x+nentries);
+  this->BuildCoeff(y);
+  this->BuildGrid();
 
   LOG("Spline", pDEBUG) << "...done building spline";
 }
 //___________________________________________________________________________
+void Spline::BuildCoeff(const double y[])
+{
+// Computes the cubic polynomial coefficients for all knot intervals.
+// The knot slopes are obtained solving the tridiagonal linear system of
+// de Boor's CUBSPL with 'not-a-knot' conditions at both ends, as TSpline3
+// does, so that both give the same interpolation.
+
+  int n = fNKnots;
+  fCoeff.assign(4*n, 0.);
+  if(n <= 0) return;
+
+  for(int i = 0; i < n; i++) fCoeff[4*i] = y[i];
+  if(n == 1) return;
+
+  vector<double> h  (n-1); // knot spacing
+  vector<double> dd (n-1); // first divided differences
+  for(int i = 0; i < n-1; i++) {
+    h [i] = fX[i+1] - fX[i];
+    dd[i] = (y[i+1] - y[i]) / h[i];
+  }
+
+  vector<double> s(n); // slopes at knots
+  if(n == 2) {
+    // straight line
+    s[0] = dd[0];
+    s[1] = dd[0];
+  }
+  else
+  if(n == 3) {
+    // the not-a-knot conditions give the parabola through the 3 knots
+    double a = (dd[1] - dd[0]) / (h[0] + h[1]);
+    s[0] = dd[0] - a * h[0];
+    s[1] = dd[0] + a * h[0];
+    s[2] = dd[0] + a * (h[0] + 2*h[1]);
+  }
+  else {
+    // row i reads: lo[i] * s[i-1] + di[i] * s[i] + up[i] * s[i+1] = r[i]
+    vector<double> lo(n,0.), di(n,0.), up(n,0.), r(n,0.);
+
+    double g0 = h[0] + h[1];
+    di[0] = h[1];
+    up[0] = g0;
+    r [0] = ((h[0] + 2*g0) * dd[0] * h[1] + h[0] * h[0] * dd[1]) / g0;
+
+    for(int m = 1; m < n-1; m++) {
+      lo[m] = h[m];
+      di[m] = 2 * (h[m-1] + h[m]);
+      up[m] = h[m-1];
+      r [m] = 3 * (h[m] * dd[m-1] + h[m-1] * dd[m]);
+    }
+
+    double g1 = h[n-3] + h[n-2];
+    lo[n-1] = g1;
+    di[n-1] = h[n-3];
+    r [n-1] = ((h[n-2] + 2*g1) * dd[n-2] * h[n-3] +
+                h[n-2] * h[n-2] * dd[n-3]) / g1;
+
+    // forward elimination & back substitution
+    for(int m = 1; m < n; m++) {
+      double w = lo[m] / di[m-1];
+      di[m] -= w * up[m-1];
+      r [m] -= w * r [m-1];
+    }
+    s[n-1] = r[n-1] / di[n-1];
+    for(int m = n-2; m >= 0; m--) {
+      s[m] = (r[m] - up[m] * s[m+1]) / di[m];
+    }
+  }
+
+  for(int i = 0; i < n-1; i++) {
+    double divdf3 = s[i] + s[i+1] - 2*dd[i];
+    double * coeff = &fCoeff[4*i];
+    coeff[1] = s[i];
+    coeff[2] = (dd[i] - s[i] - divdf3) / h[i];
+    coeff[3] = divdf3 / (h[i] * h[i]);
+  }
+  fCoeff[4*(n-1)+1] = s[n-1];
+}
+//___________________________________________________________________________
+void Spline::BuildGrid(void)
+{
+// Finds the longest tail of the knot grid that is (approximately) uniform in
+// x or in log(x) and caches what is needed for the O(1) interval search.
+// Cross section splines have a few linearly spaced knots below threshold
+// which are followed by knots uniform in log(E) (or in E).
+
+  fGrid        = kGridIrregular;
+  fGridFirst   = 0;
+  fGridU0      = 0.;
+  fGridInvStep = 0.;
+
+  int n = fNKnots;
+  if(n < kSplGridMinKnots) return;
+
+  int first[2] = { n-1, n-1 }; // linear, log
+
+  for(int igrid = 0; igrid < 2; igrid++) {
+    bool inlog = (igrid == 1);
+    if(inlog && fX[n-2] <= 0) continue;
+    double href = (inlog) ? std::log(fX[n-1]/fX[n-2]) : fX[n-1]-fX[n-2];
+    if(href <= 0) continue;
+    int i = n-2;
+    while(i > 0) {
+      if(inlog && fX[i-1] <= 0) break;
+      double hi = (inlog) ? std::log(fX[i]/fX[i-1]) : fX[i]-fX[i-1];
+      if(TMath::Abs(hi - href) > kSplGridTolerance * href) break;
+      i--;
+    }
+    first[igrid] = i;
+  }
+
+  bool inlog = (first[1] < first[0]);
+  int  ifirst = (inlog) ? first[1] : first[0];
+  if(n - ifirst < kSplGridMinKnots) return;
+
+  double u0 = (inlog) ? std::log(fX[ifirst]) : fX[ifirst];
+  double u1 = (inlog) ? std::log(fX[n-1])    : fX[n-1];
+
+  fGrid        = (inlog) ? kGridLog : kGridLinear;
+  fGridFirst   = ifirst;
+  fGridU0      = u0;
+  fGridInvStep = (n - 1 - ifirst) / (u1 - u0);
+}
+//___________________________________________________________________________
+int Spline::FindInterval(double x) const
+{
+// Returns the knot interval k containing x, using the TSpline3::FindX
+// convention: x_k < x <= x_{k+1}, with k clamped in [0, nknots-2]
+
+  int n = fNKnots;
+  if(n < 2) return 0;
+
+  int k = 0;
+  if(fGrid != kGridIrregular && x >= fX[fGridFirst]) {
+    double u  = (fGrid == kGridLog) ? std::log(x) : x;
+    double fk = (u - fGridU0) * fGridInvStep;
+    k = (fk < n) ? fGridFirst + int(fk) : n-2;
+    if(k > n-2) k = n-2;
+    // correct for grids that are only approximately uniform
+    while(k > 0   && x <= fX[k])   k--;
+    while(k < n-2 && x >  fX[k+1]) k++;
+  } else {
+    int nsearch = (fGrid != kGridIrregular) ? fGridFirst+1 : n;
+    k = (lower_bound(fX.begin(), fX.begin()+nsearch, x) - fX.begin()) - 1;
+    if(k < 0)   k = 0;
+    if(k > n-2) k = n-2;
+  }
+  return k;
+}
+//___________________________________________________________________________
@@ -5,9 +5,15 @@
 
 \brief    A numeric analysis tool class for interpolating 1-D functions.
 
-          Uses ROOT's TSpline3 for the actual interpolation and can retrieve
-          function (x,y(x)) pairs from an XML file, a flat ascii file, a
-          TNtuple, a TTree or an SQL database.
+          Uses a native cubic spline engine (with the same 'not-a-knot' end
+          conditions as ROOT's TSpline3) for the actual interpolation and can
+          retrieve function (x,y(x)) pairs from an XML file, a flat ascii file,
+          a TNtuple, a TTree or an SQL database.
+          The polynomial coefficients of all knot intervals are packed in a
+          contiguous array. The interval search takes O(1) time for knots
+          distributed uniformly in x or in log(x) (as the ones produced by
+          XSecSplineList::CreateSpline()) and it is a binary search otherwise.
+          A TSpline3 is only built on demand, by GetAsTSpline().
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -23,7 +29,9 @@
 #ifndef _SPLINE_H_
 #define _SPLINE_H_
 
+#include <cstddef>
 #include <string>
+#include <vector>
 #include <fstream>
 #include <ostream>
 
@@ -36,6 +44,7 @@ class TSQLServer;
 class TGraph;
 
 using std::string;
+using std::vector;
 using std::ostream;
 using std::ofstream;
 
@@ -72,13 +81,20 @@ public:
   // Get xmin,xmax,nknots, check x variable against valid range and evaluate spline
   int    NKnots             (void) const {return fNKnots;}
   void   GetKnot            (int iknot, double & x, double & y) const;
+  void   GetCoeff           (int iknot, double & x, double & y,
+                             double & b, double & c, double & d) const;
   double GetKnotX           (int iknot) const;
   double GetKnotY           (int iknot) const;
   double XMin               (void) const {return fXMin;  }
   double XMax               (void) const {return fXMax;  }
   double YMax               (void) const {return fYMax;  }
   double Evaluate           (double x) const;
+  void   Evaluate           (const double * x, double * y, size_t n) const;
   bool   IsWithinValidRange (double x) const;
+  size_t MemorySize         (void) const; ///< bytes held by the spline (see MemoryStats)
+
+  // Evaluate many splines at the same x (fastest if they share their knots)
+  static void Evaluate (double x, const Spline * const splines[], double y[], size_t n);
 
   void   SetName (string name) { fName = name; }
   string Name (void) const     { return fName; }
@@ -94,9 +110,9 @@ public:
   // Export Spline as TGraph or TSpline3
   TGraph *   GetAsTGraph  (int np = 500, bool xscaling = false,
                            bool inlog=false, double fx=1., double fy=1.) const;
-  TSpline3 * GetAsTSpline (void) const { return fInterpolator; }
+  TSpline3 * GetAsTSpline (void) const;
 
-  // Knot manipulation methods in additions to the TSpline3 ones
+  // Knot manipulation methods
   void FindClosestKnot(double x, double & xknot, double & yknot, Option_t * opt="-+") const;
   bool ClosestKnotValueIsZero(double x, Option_t * opt="-+") const;
 
@@ -120,17 +136,41 @@ private:
   void InitSpline  (void);
   void ResetSpline (void);
   void BuildSpline (int nentries, double x[], double y[]);
+  void BuildCoeff  (const double y[]);
+  void BuildGrid   (void);
+  int  FindInterval(double x) const;
+  bool IsInInterval(int k, double x) const;
+
+  double EvaluateInInterval (int k, double x) const;
+  void   WarnNegative       (double x, double y) const;
+
+  // Knot interval search modes
+  enum EGrid {
+    kGridIrregular = 0,  ///< binary search
+    kGridLinear,         ///< O(1) search for knots uniform in x
+    kGridLog             ///< O(1) search for knots uniform in log(x)
+  };
 
   // Private data members
-  string     fName;
-  int        fNKnots;
-  double     fXMin;
-  double     fXMax;
-  double     fYMax;
-  TSpline3 * fInterpolator;
-  bool       fYCanBeNegative;
-
-ClassDef(Spline,1)
+  string         fName;
+  int            fNKnots;
+  double         fXMin;
+  double         fXMax;
+  double         fYMax;
+  bool           fYCanBeNegative;
+
+  // The cubic polynomial of interval k is stored at fCoeff[4k],...,fCoeff[4k+3]
+  // and evaluated as y = Y + dx * (B + dx * (C + dx * D)), with dx = x - x_k
+  vector<double> fX;             ///< knot x
+  vector<double> fCoeff;         ///< packed Y,B,C,D coefficients per knot
+  int            fGrid;          ///< knot interval search mode (see EGrid)
+  int            fGridFirst;     ///< first knot of the uniform part of the grid
+  double         fGridU0;        ///< x (or log x) at the first uniform knot
+  double         fGridInvStep;   ///< 1/step (in x or log x) of the uniform knots
+
+  mutable TSpline3 * fInterpolator; //! built on demand by GetAsTSpline()
+
+ClassDef(Spline,2)
 };
 
 }
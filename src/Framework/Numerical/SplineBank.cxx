@@ -0,0 +1,191 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include "Framework/Numerical/SplineBank.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Numerical/MathUtils.h"
+
+using std::lower_bound;
+
+using namespace genie;
+
+//___________________________________________________________________________
+SplineBank::SplineBank() :
+fZeroAfterZeroKnot(false)
+{
+
+}
+//___________________________________________________________________________
+SplineBank::~SplineBank()
+{
+
+}
+//___________________________________________________________________________
+void SplineBank::Clear(void)
+{
+  fSplines.clear();
+  fX.clear();
+  fY.clear();
+  fB.clear();
+  fC.clear();
+  fD.clear();
+}
+//___________________________________________________________________________
+void SplineBank::SetZeroAfterZeroKnot(bool tf)
+{
+  if(tf == fZeroAfterZeroKnot) return;
+  fZeroAfterZeroKnot = tf;
+  this->Fill();
+}
+//___________________________________________________________________________
+bool SplineBank::SharesKnots(const Spline * spl) const
+{
+  if(!spl) return false;
+  int nknots = spl->NKnots();
+  if(nknots < 2) return false;
+  if(fSplines.size() == 0) return true;
+  if(nknots != (int)fX.size()) return false;
+
+  for(int i = 0; i < nknots; i++) {
+    if(spl->GetKnotX(i) != fX[i]) return false;
+  }
+  return true;
+}
+//___________________________________________________________________________
+bool SplineBank::Add(const Spline * spl)
+{
+  if(!this->SharesKnots(spl)) return false;
+
+  if(fSplines.size() == 0) {
+    int nknots = spl->NKnots();
+    fX.resize(nknots);
+    for(int i = 0; i < nknots; i++) fX[i] = spl->GetKnotX(i);
+  }
+
+  // re-stride the coefficients of the splines already in the bank
+  int nint = fX.size() - 1;
+  int nold = fSplines.size();
+  int nnew = nold + 1;
+
+  vector<double> Y(nint*nnew), B(nint*nnew), C(nint*nnew), D(nint*nnew);
+  for(int k = 0; k < nint; k++) {
+    for(int i = 0; i < nold; i++) {
+      Y[k*nnew + i] = fY[k*nold + i];
+      B[k*nnew + i] = fB[k*nold + i];
+      C[k*nnew + i] = fC[k*nold + i];
+      D[k*nnew + i] = fD[k*nold + i];
+    }
+  }
+  fY.swap(Y);
+  fB.swap(B);
+  fC.swap(C);
+  fD.swap(D);
+
+  fSplines.push_back(spl);
+  this->FillColumn(nold, nnew);
+
+  return true;
+}
+//___________________________________________________________________________
+double SplineBank::XMin(void) const
+{
+  return (fX.size() > 0) ? fX.front() : 0.;
+}
+//___________________________________________________________________________
+double SplineBank::XMax(void) const
+{
+  return (fX.size() > 0) ? fX.back() : 0.;
+}
+//___________________________________________________________________________
+void SplineBank::Evaluate(double x, double * y) const
+{
+  int nspl = fSplines.size();
+  if(nspl == 0) return;
+
+  // outside the knot grid all splines evaluate to 0 (cf Spline::Evaluate)
+  if(x < fX.front() || x > fX.back()) {
+    for(int i = 0; i < nspl; i++) y[i] = 0.;
+    return;
+  }
+
+  int    k  = this->FindInterval(x);
+  double dx = x - fX[k];
+
+  const double * Y = &fY[k*nspl];
+  const double * B = &fB[k*nspl];
+  const double * C = &fC[k*nspl];
+  const double * D = &fD[k*nspl];
+
+  // branch-free loop over contiguous coefficients: vectorized by the compiler
+  for(int i = 0; i < nspl; i++) {
+    y[i] = Y[i] + dx * (B[i] + dx * (C[i] + dx * D[i]));
+  }
+}
+//___________________________________________________________________________
+int SplineBank::FindInterval(double x) const
+{
+// Same convention as TSpline3::FindX: the interval k is the one for which
+// x_k < x <= x_{k+1}
+
+  int k = (lower_bound(fX.begin(), fX.end(), x) - fX.begin()) - 1;
+  int kmax = fX.size() - 2;
+  if(k < 0)    k = 0;
+  if(k > kmax) k = kmax;
+  return k;
+}
+//___________________________________________________________________________
+void SplineBank::Fill(void)
+{
+  int nspl = fSplines.size();
+  for(int i = 0; i < nspl; i++) this->FillColumn(i, nspl);
+}
+//___________________________________________________________________________
+void SplineBank::FillColumn(int ispl, int nspl)
+{
+// Copies the polynomial coefficients of the input spline. Intervals next to
+// y=0 knots are written as the linear (or null) polynomials used by
+// Spline::Evaluate so that the evaluation needs no branching.
+
+  const Spline * spl = fSplines[ispl];
+
+  int nint = fX.size() - 1;
+  for(int k = 0; k < nint; k++) {
+    double x0 = 0, y0 = 0, b = 0, c = 0, d = 0;
+    double x1 = 0, y1 = 0;
+    spl->GetCoeff(k, x0, y0, b, c, d);
+    spl->GetKnot (k+1, x1, y1);
+
+    double h = fX[k+1] - fX[k];
+
+    bool is0n = utils::math::AreEqual(y0, 0.);
+    bool is0p = utils::math::AreEqual(y1, 0.);
+
+    int idx = k*nspl + ispl;
+    if(!is0n && !is0p) {
+      fY[idx] = y0;
+      fB[idx] = b;
+      fC[idx] = c;
+      fD[idx] = d;
+    } else {
+      fY[idx] = 0.;
+      fC[idx] = 0.;
+      fD[idx] = 0.;
+      if      ( is0n &&  is0p) fB[idx] = 0.;
+      else if ( is0n         ) fB[idx] = (fZeroAfterZeroKnot) ? 0. : y1/h;
+      else                     fB[idx] = y0/h;
+    }
+  }
+}
+//___________________________________________________________________________
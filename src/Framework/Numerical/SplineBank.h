@@ -0,0 +1,82 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::SplineBank
+
+\brief    A bank of Spline objects defined on a common knot grid, allowing
+          all of them to be evaluated at once.
+
+          The cubic polynomial coefficients of all splines are stored in
+          structure-of-arrays layout, interval by interval, so that a single
+          knot search followed by one tight (vectorizable) loop evaluates
+          every spline in the bank at the input x.
+          The evaluation reproduces Spline::Evaluate(), including the linear
+          interpolation next to knots with y=0. Optionally (see
+          SetZeroAfterZeroKnot()) intervals whose lower knot has y=0 evaluate
+          to 0, as done by the interaction selector.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _SPLINE_BANK_H_
+#define _SPLINE_BANK_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class Spline;
+
+class SplineBank {
+
+public:
+  SplineBank();
+ ~SplineBank();
+
+  // Add a spline to the bank. Returns false (and does not add it) if its
+  // knot grid differs from the grid of the splines already in the bank.
+  bool   Add          (const Spline * spl);
+  bool   SharesKnots  (const Spline * spl) const;
+  void   Clear        (void);
+
+  // Treat intervals whose lower knot has y=0 as y=0 (mimics a
+  // Spline::ClosestKnotValueIsZero(x,"-") check before evaluating)
+  void   SetZeroAfterZeroKnot (bool tf);
+
+  int    NSplines     (void) const { return fSplines.size(); }
+  int    NKnots       (void) const { return fX.size();       }
+  double XMin         (void) const;
+  double XMax         (void) const;
+
+  // Evaluate all splines at x; y must have room for NSplines() values
+  void   Evaluate     (double x, double * y) const;
+
+private:
+
+  void   Fill         (void);
+  void   FillColumn   (int ispl, int nspl);
+  int    FindInterval (double x) const;
+
+  // Per interval k, the polynomial of spline i is stored at [k * nsplines + i]
+  // and evaluated as y = Y + dx * (B + dx * (C + dx * D)), with dx = x - x_k
+  vector<const Spline *> fSplines;          ///< banked splines (not owned)
+  vector<double>         fX;                ///< common knot grid
+  vector<double>         fY;                ///< constant  coefficients
+  vector<double>         fB;                ///< linear    coefficients
+  vector<double>         fC;                ///< quadratic coefficients
+  vector<double>         fD;                ///< cubic     coefficients
+  bool                   fZeroAfterZeroKnot; ///< y=0 in intervals with a y=0 lower knot?
+};
+
+}      // genie namespace
+
+#endif // _SPLINE_BANK_H_
@@ -0,0 +1,63 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include "Framework/Numerical/UniformBuffer.h"
+#include "Framework/Numerical/CounterRandom.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+UniformBuffer::UniformBuffer(RndmStream_t stream, int size) :
+fRandom        (&RandomGen::Instance()->Rnd(stream)),
+fCounterRandom (0),
+fSize          (size),
+fN             (0),
+fPos           (0),
+fFillStart     (0)
+{
+  if(fSize < 1)        fSize = 1;
+  if(fSize > kMaxSize) fSize = kMaxSize;
+
+  if(RandomGen::Instance()->CounterBased()) {
+    fCounterRandom = dynamic_cast<CounterRandom *> (fRandom);
+  }
+}
+//____________________________________________________________________________
+UniformBuffer::~UniformBuffer()
+{
+  this->Release();
+}
+//____________________________________________________________________________
+void UniformBuffer::Refill(void)
+{
+  fFillStart = fCounterRandom->NDrawn();
+  fCounterRandom->RndmArray(fSize, fBuffer);
+  fN   = fSize;
+  fPos = 0;
+}
+//____________________________________________________________________________
+void UniformBuffer::Release(void)
+{
+  if(fCounterRandom && fPos < fN) {
+    // a (very rare) zero skipped by the generator shifts the positions
+    if(fCounterRandom->NDrawn() - fFillStart == (ULong64_t) fN) {
+      fCounterRandom->Seek(fFillStart + fPos);
+    } else {
+      fCounterRandom->Seek(fFillStart);
+      for(int i = 0; i < fPos; i++) fCounterRandom->Rndm();
+    }
+  }
+  fN   = 0;
+  fPos = 0;
+}
+//____________________________________________________________________________
@@ -0,0 +1,72 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::UniformBuffer
+
+\brief    Block-wise drawing of uniform random numbers for rejection loops.
+
+          The buffer takes the numbers of a RandomGen stream in blocks. When
+          it goes out of scope (or on Release()), the stream is moved back to
+          just after the last number actually used. The sampler thus gets the
+          very numbers that successive Rndm() calls would have returned.
+          This is possible for the counter-based streams only (see
+          CounterRandom). For the default TRandom3 generator the buffer
+          passes each call through to Rndm(), so that the outputs of existing
+          jobs are not modified.
+          While a buffer is in use, its stream should not be used directly.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _UNIFORM_BUFFER_H_
+#define _UNIFORM_BUFFER_H_
+
+#include "Framework/Numerical/RandomGen.h"
+
+namespace genie {
+
+class CounterRandom;
+
+class UniformBuffer {
+
+public:
+  UniformBuffer(RndmStream_t stream, int size = 64);
+ ~UniformBuffer();
+
+  //! Next uniform number in (0,1)
+  double Next (void)
+  {
+    if(!fCounterRandom) return fRandom->Rndm();
+    if(fPos == fN) this->Refill();
+    return fBuffer[fPos++];
+  }
+
+  //! Hand the unused numbers back to the stream
+  void Release (void);
+
+private:
+  UniformBuffer(const UniformBuffer & buffer);
+
+  static const int kMaxSize = 256;
+
+  void Refill (void);
+
+  TRandom3 *      fRandom;
+  CounterRandom * fCounterRandom; ///< null if the stream is not counter-based
+  int             fSize;
+  int             fN;             ///< numbers in the buffer
+  int             fPos;           ///< next number to use
+  ULong64_t       fFillStart;     ///< stream position of the first number in the buffer
+  double          fBuffer[kMaxSize];
+};
+
+}      // genie namespace
+
+#endif // _UNIFORM_BUFFER_H_
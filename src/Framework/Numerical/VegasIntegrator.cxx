@@ -0,0 +1,240 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/VegasIntegrator.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+VegasIntegrator::VegasIntegrator() :
+fNDim(0),
+fNBins(0),
+fRelTol(1E-2),
+fAbsTol(0),
+fMaxEval(100000),
+fNCalls(10000),
+fNWarmUp(3),
+fAlpha(1.5),
+fIsWarm(false),
+fRandom(4357),
+fError(0),
+fChi2(0),
+fNEval(0),
+fNIter(0),
+fStatus(0)
+{
+
+}
+//____________________________________________________________________________
+VegasIntegrator::VegasIntegrator(unsigned int ndim, int nbins) :
+fRelTol(1E-2),
+fAbsTol(0),
+fMaxEval(100000),
+fNCalls(10000),
+fNWarmUp(3),
+fAlpha(1.5),
+fRandom(4357),
+fError(0),
+fChi2(0),
+fNEval(0),
+fNIter(0),
+fStatus(0)
+{
+  this->SetNDim(ndim, nbins);
+}
+//____________________________________________________________________________
+VegasIntegrator::~VegasIntegrator()
+{
+
+}
+//____________________________________________________________________________
+void VegasIntegrator::SetNDim(unsigned int ndim, int nbins)
+{
+  if(ndim < 1 || nbins < 2) {
+    LOG("Vegas", pFATAL)
+      << "Invalid VEGAS grid: " << ndim << " variables, " << nbins << " bins";
+    exit(1);
+  }
+  fNDim  = ndim;
+  fNBins = nbins;
+  this->ResetGrid();
+}
+//____________________________________________________________________________
+void VegasIntegrator::ResetGrid(void)
+{
+  fGrid.resize(fNDim * (fNBins+1));
+  for(unsigned int j = 0; j < fNDim; j++) {
+    double * xi = &fGrid[j * (fNBins+1)];
+    for(int k = 0; k <= fNBins; k++) xi[k] = double(k) / fNBins;
+  }
+  fD.assign(fNDim * fNBins, 0.);
+  fIsWarm = false;
+}
+//____________________________________________________________________________
+double VegasIntegrator::Integral(
+  const ROOT::Math::IBaseFunctionMultiDim & f, const double * a, const double * b)
+{
+  if(fNDim == 0 || f.NDim() != fNDim) {
+    LOG("Vegas", pFATAL)
+      << "The integrand has " << f.NDim() << " variables but the VEGAS grid "
+      << fNDim;
+    exit(1);
+  }
+
+  double vol = 1;
+  for(unsigned int j = 0; j < fNDim; j++) vol *= (b[j] - a[j]);
+
+  std::vector<double> x   (fNDim);
+  std::vector<int>    bins(fNDim);
+
+  // sums over the accumulated iterations of I/var, 1/var and I^2/var
+  double swi = 0, sw = 0, swi2 = 0;
+  double integral = 0;
+  double mean = 0, var = 0;
+
+  fError  = 0;
+  fChi2   = 0;
+  fNEval  = 0;
+  fNIter  = 0;
+  fStatus = 1;
+
+  unsigned int ncalls = TMath::Max(fNCalls, (unsigned int) 2);
+  int nwarmup = fIsWarm ? 0 : fNWarmUp;
+  int iter    = 0;
+
+  while(iter == 0 || fNEval + ncalls <= fMaxEval) {
+
+    double s1 = 0, s2 = 0;
+    fD.assign(fNDim * fNBins, 0.);
+
+    for(unsigned int i = 0; i < ncalls; i++) {
+      double jac = vol;
+      for(unsigned int j = 0; j < fNDim; j++) {
+        const double * xi = &fGrid[j * (fNBins+1)];
+        double z = fRandom.Rndm() * fNBins;
+        int    k = TMath::Min((int) z, fNBins-1);
+        double w = xi[k+1] - xi[k];
+        x[j]    = a[j] + (b[j] - a[j]) * (xi[k] + w * (z - k));
+        jac    *= fNBins * w;
+        bins[j] = k;
+      }
+      double fval = f(&x[0]) * jac;
+      double f2   = fval * fval;
+      s1 += fval;
+      s2 += f2;
+      for(unsigned int j = 0; j < fNDim; j++) fD[j*fNBins + bins[j]] += f2;
+    }
+    fNEval += ncalls;
+    iter++;
+
+    mean = s1 / ncalls;
+    var  = (s2 / ncalls - mean * mean) / (ncalls - 1);
+
+    this->Refine();
+
+    if(iter <= nwarmup) continue;
+
+    fNIter++;
+    if(var <= 0) {
+      // the estimate is exact (eg the integrand vanishes)
+      integral = mean;
+      fError   = 0;
+      fStatus  = 0;
+      break;
+    }
+    swi  += mean / var;
+    sw   += 1. / var;
+    swi2 += mean * mean / var;
+
+    integral = swi / sw;
+    fError   = 1. / TMath::Sqrt(sw);
+    fChi2    = (fNIter > 1) ?
+               TMath::Max(0., swi2 - integral * swi) / (fNIter - 1) : 0.;
+
+    if(fNIter > 1 &&
+       (fError <= fRelTol * TMath::Abs(integral) || fError <= fAbsTol)) {
+      fStatus = 0;
+      break;
+    }
+  }
+  if(fNIter == 0) {
+    // the evaluations ran out in the warm-up: use the last iteration
+    integral = mean;
+    fError   = TMath::Sqrt(TMath::Max(var, 0.));
+    LOG("Vegas", pWARN)
+      << "No VEGAS iteration after the grid warm-up ("
+      << fNEval << " evaluations)";
+  }
+  fIsWarm = true;
+
+  LOG("Vegas", pINFO)
+    << "Integral = " << integral << " +/- " << fError
+    << " (chi2/dof = " << fChi2 << ", " << fNIter << " iterations, "
+    << fNEval << " evaluations)";
+
+  return integral;
+}
+//____________________________________________________________________________
+void VegasIntegrator::Refine(void)
+{
+// Move the bin edges of each variable so that the bins get equal shares of
+// the (smoothed and damped) contributions to the variance
+
+  if(fAlpha <= 0) return;
+
+  std::vector<double> d(fNBins), r(fNBins), xnew(fNBins+1);
+
+  for(unsigned int j = 0; j < fNDim; j++) {
+    const double * dj = &fD[j * fNBins];
+    double       * xi = &fGrid[j * (fNBins+1)];
+
+    // smooth over the neighbouring bins
+    d[0]        = (dj[0] + dj[1]) / 2.;
+    d[fNBins-1] = (dj[fNBins-2] + dj[fNBins-1]) / 2.;
+    for(int k = 1; k < fNBins-1; k++) d[k] = (dj[k-1] + dj[k] + dj[k+1]) / 3.;
+
+    double dsum = 0;
+    for(int k = 0; k < fNBins; k++) dsum += d[k];
+    if(dsum <= 0) continue;
+
+    double rsum = 0;
+    for(int k = 0; k < fNBins; k++) {
+      double rho = d[k] / dsum;
+      if      (rho <= 0) r[k] = 0;
+      else if (rho >= 1) r[k] = 1;
+      else               r[k] = TMath::Power((1. - rho) / -TMath::Log(rho), fAlpha);
+      rsum += r[k];
+    }
+    if(rsum <= 0) continue;
+
+    // new edges: equal shares of r, spread uniformly within the old bins
+    double step = rsum / fNBins;
+    double acc  = 0;
+    int    k    = -1;
+    xnew[0]      = 0.;
+    xnew[fNBins] = 1.;
+    for(int i = 1; i < fNBins; i++) {
+      double target = i * step;
+      while(acc < target && k < fNBins-1) { k++; acc += r[k]; }
+      double frac = (r[k] > 0) ? 1. - (acc - target) / r[k] : 1.;
+      xnew[i] = xi[k] + (xi[k+1] - xi[k]) * TMath::Min(TMath::Max(frac, 0.), 1.);
+    }
+    for(int i = 0; i <= fNBins; i++) xi[i] = xnew[i];
+  }
+}
+//____________________________________________________________________________
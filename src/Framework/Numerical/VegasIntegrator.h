@@ -0,0 +1,105 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::VegasIntegrator
+
+\brief    Adaptive Monte Carlo (VEGAS) integrator whose importance sampling
+          grid survives between integrations.
+
+          Each variable is mapped to [0,1] and the importance grid is kept in
+          these unit coordinates, so that it can seed the integration of an
+          integrand of similar shape over a different range: eg the cross
+          section at the next energy knot of a spline. A cold grid is first
+          adapted over a few warm-up iterations whose estimates are dropped;
+          a warm (already adapted) grid goes straight to the accumulated
+          iterations, and keeps adapting.
+
+          The iterations are combined with inverse variance weights until
+          the requested relative (or absolute) error or the maximum number
+          of evaluations is reached. The error estimate, the chi2 per degree
+          of freedom of the iteration estimates and the number of
+          evaluations are reported.
+
+          See: G.P.Lepage, J.Comput.Phys. 27 (1978) 192
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _VEGAS_INTEGRATOR_H_
+#define _VEGAS_INTEGRATOR_H_
+
+#include <vector>
+
+#include <TRandom3.h>
+#include <Math/IFunction.h>
+
+namespace genie {
+
+class VegasIntegrator {
+
+public:
+  VegasIntegrator();
+  VegasIntegrator(unsigned int ndim, int nbins=50);
+ ~VegasIntegrator();
+
+  //! Set the number of variables and grid bins per variable (resets the grid)
+  void   SetNDim           (unsigned int ndim, int nbins=50);
+  void   SetRelTolerance   (double tol)        { fRelTol   = tol; }
+  void   SetAbsTolerance   (double tol)        { fAbsTol   = tol; }
+  void   SetMaxEval        (unsigned int n)    { fMaxEval  = n;   }
+  void   SetCallsPerIter   (unsigned int n)    { fNCalls   = n;   }
+  void   SetNWarmUpIter    (int n)             { fNWarmUp  = n;   }
+  //! Grid adaptation speed (0: no adaptation)
+  void   SetAlpha          (double alpha)      { fAlpha    = alpha; }
+  void   SetSeed           (unsigned int seed) { fRandom.SetSeed(seed); }
+
+  //! Return to a uniform (cold) grid
+  void   ResetGrid         (void);
+  bool   IsWarm            (void) const { return fIsWarm; }
+
+  //! Integrate f over [a,b], starting from the current grid
+  double Integral          (const ROOT::Math::IBaseFunctionMultiDim & f,
+                            const double * a, const double * b);
+
+  //! Results of the last integration
+  double       Error       (void) const { return fError;  }
+  double       ChiSqPerDoF (void) const { return fChi2;   }
+  unsigned int NEval       (void) const { return fNEval;  }
+  int          NIter       (void) const { return fNIter;  }
+  //! 0 if the tolerance was reached, 1 if the evaluations ran out first
+  int          Status      (void) const { return fStatus; }
+
+private:
+  void   Refine (void);
+
+  unsigned int fNDim;
+  int          fNBins;
+  double       fRelTol;
+  double       fAbsTol;
+  unsigned int fMaxEval;
+  unsigned int fNCalls;
+  int          fNWarmUp;
+  double       fAlpha;
+
+  std::vector<double> fGrid;  ///< fNBins+1 bin edges in [0,1] per variable
+  std::vector<double> fD;     ///< sum of (f*jacobian)^2 per variable and bin in the current iteration
+  bool                fIsWarm;
+  TRandom3            fRandom;
+
+  double       fError;
+  double       fChi2;
+  unsigned int fNEval;
+  int          fNIter;
+  int          fStatus;
+};
+
+}      // genie namespace
+
+#endif // _VEGAS_INTEGRATOR_H_
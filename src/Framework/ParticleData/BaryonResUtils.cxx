@@ -26,6 +26,8 @@
    through a BaryonResDataSetI implementation. Simplified BaryonResonance
    package by removing the redundant BaryonResDataPDG, BaryonResDataSetI
    BreitWignerI, BreitWignerRes, BreitWignerLRes and BaryonResParams classes.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The cache of BWNorm() is kept per thread.
 
 */
 //____________________________________________________________________________
@@ -486,7 +488,8 @@ double genie::utils::res::Width(Resonance_t res)
 //____________________________________________________________________________
 double genie::utils::res::BWNorm(Resonance_t res, double N0ResMaxNWidths, double N2ResMaxNWidths, double GnResMaxNWidths)
 {
-    static genie::utils::res::CacheBWNorm cbwn;
+    // per thread, as it is filled on first use
+    static thread_local genie::utils::res::CacheBWNorm cbwn;
     if (res==kNoResonance)      return -1;
     if (cbwn.cache[res]!=0)   return cbwn.cache[res];
 
@@ -14,12 +14,16 @@
 
 #include <iostream>
 #include <string>
+#include <mutex>
+#include <unordered_map>
 
 #include <TSystem.h>
+#include <TList.h>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/InitTimingStats.h"
 
 using std::string;
 
@@ -28,9 +32,15 @@ using namespace genie;
 //____________________________________________________________________________
 PDGLibrary * PDGLibrary::fInstance = 0;
 //____________________________________________________________________________
-PDGLibrary::PDGLibrary()
+PDGLibrary::PDGLibrary() :
+fDatabasePDG(0),
+fMask(0),
+fShift(0),
+fNUsed(0),
+fRevision(0)
 {
   if( ! LoadDBase() ) LOG("PDG", pERROR) << "Could not load PDG data";
+  this->FillTable();
 
   fInstance =  0;
 }
@@ -42,9 +52,15 @@ PDGLibrary::~PDGLibrary()
 //____________________________________________________________________________
 PDGLibrary * PDGLibrary::Instance()
 {
+  if(fInstance) return fInstance;
+
+  static std::mutex instance_lock;
+  std::lock_guard<std::mutex> guard(instance_lock);
+
   if(fInstance == 0) {
     LOG("PDG", pINFO) << "PDGLibrary late initialization";
 
+    InitTimingScope timing("PDGLibrary::Instance");
     static PDGLibrary::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
 
@@ -58,13 +74,113 @@ TDatabasePDG * PDGLibrary::DBase(void)
   return fDatabasePDG;
 }
 //____________________________________________________________________________
-TParticlePDG * PDGLibrary::Find(int pdgc)
+const PDGLibrary::Entry_t & PDGLibrary::AddEntry(int pdgc)
 {
-// save some typing in the most frequently typed TDatabasePDG method
+// a PDG code missing from the table: look it up in the database once (per
+// thread) and remember the result, whether the particle is known or not.
+// The table itself is not modified, as it is read concurrently by the
+// event generation threads.
+
+  static thread_local std::unordered_map<int, Entry_t> missing;
+  static thread_local unsigned long revision = 0;
+
+  if(revision != fRevision) {
+    missing.clear();
+    revision = fRevision;
+  }
+  std::unordered_map<int, Entry_t>::const_iterator it = missing.find(pdgc);
+  if(it != missing.end()) return it->second;
 
-  return fDatabasePDG->GetParticle(pdgc);
+  Entry_t & entry = missing[pdgc];
+  this->FillEntry(entry, pdgc, fDatabasePDG ? fDatabasePDG->GetParticle(pdgc) : 0);
+  return entry;
+}
+//____________________________________________________________________________
+void PDGLibrary::FillEntry(Entry_t & entry, int pdgc, TParticlePDG * particle) const
+{
+  entry.pdg      = pdgc;
+  entry.used     = true;
+  entry.particle = particle;
+  entry.mass     = particle ? particle->Mass()     : 0.;
+  entry.width    = particle ? particle->Width()    : 0.;
+  entry.charge   = particle ? particle->Charge()   : 0.;
+  entry.lifetime = particle ? particle->Lifetime() : 0.;
+  entry.stable   = particle ? particle->Stable()   : false;
 }
+//____________________________________________________________________________
+const PDGLibrary::Entry_t &
+  PDGLibrary::Insert(int pdgc, TParticlePDG * particle)
+{
+  // keep the load factor below 1/2
+  if( 2*(fNUsed+1) > fTable.size() ) this->Resize(2*fTable.size());
 
+  unsigned int i = this->Slot(pdgc);
+  while( fTable[i].used && fTable[i].pdg != pdgc ) i = (i + 1) & fMask;
+
+  Entry_t & entry = fTable[i];
+  if( ! entry.used ) fNUsed++;
+  this->FillEntry(entry, pdgc, particle);
+  return entry;
+}
+//____________________________________________________________________________
+void PDGLibrary::Resize(unsigned int nslots)
+{
+  unsigned int size  = 16;
+  unsigned int nbits = 4;
+  while( size < nslots ) { size *= 2; nbits++; }
+
+  std::vector<Entry_t> old;
+  old.swap(fTable);
+
+  Entry_t empty;
+  empty.pdg      = 0;
+  empty.used     = false;
+  empty.particle = 0;
+  empty.mass     = 0.;
+  empty.width    = 0.;
+  empty.charge   = 0.;
+  empty.lifetime = 0.;
+  empty.stable   = false;
+
+  fTable.assign(size, empty);
+  fMask  = size - 1;
+  fShift = 32 - nbits;
+  fNUsed = 0;
+
+  for(unsigned int j = 0; j < old.size(); j++) {
+    if( ! old[j].used ) continue;
+    unsigned int i = this->Slot(old[j].pdg);
+    while( fTable[i].used ) i = (i + 1) & fMask;
+    fTable[i] = old[j];
+    fNUsed++;
+  }
+}
+//____________________________________________________________________________
+void PDGLibrary::FillTable(void)
+{
+// (re)build the property table from the particles in the database
+
+  fTable.clear();
+  fNUsed = 0;
+  fRevision++;
+
+  // builds the code map of the database (on its first look-up), so that the
+  // look-ups of the missing codes only read it
+  if( fDatabasePDG ) fDatabasePDG->GetParticle(kPdgProton);
+
+  const TList * particles = fDatabasePDG ? fDatabasePDG->ParticleList() : 0;
+  unsigned int n = particles ? particles->GetSize() : 0;
+  this->Resize(2*n + 2);
+
+  if( ! particles ) return;
+  TIter next(particles);
+  TParticlePDG * particle = 0;
+  while( (particle = (TParticlePDG *) next()) ) {
+    this->Insert(particle->PdgCode(), particle);
+  }
+  LOG("PDG", pINFO)
+    << "Tabulated the properties of " << fNUsed << " particles";
+}
 //____________________________________________________________________________
 bool PDGLibrary::LoadDBase(void)
 {
@@ -131,6 +247,8 @@ void PDGLibrary::AddDarkMatter(double mass, double med_ratio)
   else {
     assert(med_particle->Mass() == med_mass);
   }
+
+  this->FillTable();
 }
 //____________________________________________________________________________
 // EDIT: need a way to clear and then reload the PDG database
@@ -141,4 +259,5 @@ void PDGLibrary::ReloadDBase(void)
   }
 
   if( ! LoadDBase() ) LOG("PDG", pERROR) << "Could not load PDG data";
+  this->FillTable();
 }
@@ -5,6 +5,17 @@
 
 \brief    Singleton class to load & serve a TDatabasePDG.
 
+          The mass, width, charge, lifetime and stability flag of each
+          particle are copied, with its TParticlePDG, into an open addressing
+          hash table keyed by the PDG code (multiplicative hashing, load
+          factor below 1/2). Find() and the property accessors are inline and
+          take O(1) operations; a PDG code not in the table is looked up in
+          the TDatabasePDG once and remembered (known or not), per thread.
+          The table is rebuilt whenever the PDGLibrary adds particles to, or
+          reloads, its TDatabasePDG (which must then not be used by other
+          threads); otherwise it is only read, so that the library can be
+          used concurrently by the event generation threads.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -22,6 +33,8 @@
 #ifndef _PDG_LIBRARY_H_
 #define _PDG_LIBRARY_H_
 
+#include <vector>
+
 #include <TDatabasePDG.h>
 #include <TParticlePDG.h>
 
@@ -34,9 +47,18 @@ public:
   static PDGLibrary * Instance(void);
 
   TDatabasePDG * DBase (void);
-  TParticlePDG * Find  (int pdgc);
+  TParticlePDG * Find  (int pdgc) { return this->Lookup(pdgc).particle; }
   void           ReloadDBase (void);
 
+  //! Particle properties, as in TParticlePDG (the charge is in units of |e|/3);
+  //! 0 (false) for a PDG code not in the database
+  double Mass     (int pdgc) { return this->Lookup(pdgc).mass;     }
+  double Width    (int pdgc) { return this->Lookup(pdgc).width;    }
+  double Charge   (int pdgc) { return this->Lookup(pdgc).charge;   }
+  double Lifetime (int pdgc) { return this->Lookup(pdgc).lifetime; }
+  bool   IsStable (int pdgc) { return this->Lookup(pdgc).stable;   }
+  bool   IsKnown  (int pdgc) { return this->Lookup(pdgc).particle != 0; }
+
   // Add dark matter and mediator with parameters from Boosted Dark Matter app configuration
   // Ideally, this code should be in the Dark Matter app, not here.
   // But presently there is no way to edit the PDGLibrary after it has been created.
@@ -50,8 +72,46 @@ private:
 
   bool LoadDBase(void);
 
+  // Properties of a particle (particle = 0 if not in the database)
+  struct Entry_t {
+    int            pdg;
+    bool           used;
+    TParticlePDG * particle;
+    double         mass;
+    double         width;
+    double         charge;
+    double         lifetime;
+    bool           stable;
+  };
+
+  const Entry_t & Lookup (int pdgc)
+  {
+    unsigned int i = this->Slot(pdgc);
+    while (fTable[i].used) {
+      if (fTable[i].pdg == pdgc) return fTable[i];
+      i = (i + 1) & fMask;
+    }
+    return this->AddEntry(pdgc);
+  }
+  unsigned int Slot (int pdgc) const
+  {
+    return ((unsigned int) pdgc * 2654435761u) >> fShift;
+  }
+
+  const Entry_t & AddEntry  (int pdgc);
+  const Entry_t & Insert    (int pdgc, TParticlePDG * particle);
+  void            FillEntry (Entry_t & entry, int pdgc, TParticlePDG * particle) const;
+  void            Resize    (unsigned int nslots);
+  void            FillTable (void);
+
   static PDGLibrary * fInstance;
   TDatabasePDG      * fDatabasePDG;
+
+  std::vector<Entry_t> fTable;   ///< hash table of particle properties
+  unsigned int         fMask;    ///< table size - 1 (the size is a power of 2)
+  unsigned int         fShift;   ///< 32 - log2(table size)
+  unsigned int         fNUsed;   ///< number of used table slots
+  unsigned long        fRevision; ///< number of times the table was built
   
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -9,6 +9,10 @@
 
          Changes required to implement the GENIE Boosted Dark Matter module
          were installed by Josh Berger (Univ. of Wisconsin)
+
+ Important revisions after version 3.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Moved the PDG code classification predicates inline, to PDGUtils.h.
 */
 //____________________________________________________________________________
 
@@ -21,300 +25,6 @@
 
 using namespace genie;
 
-//____________________________________________________________________________
-bool genie::pdg::IsPseudoParticle(int pdgc)
-{
-// ROOT's rootino has PDG code=0
-// GENIE pseudoparticles are in the 2000000000-2000100000 range
-// Include PYTHIA's pseudoparticles
-
-  bool is_fake =
-     ( (pdgc == 0) ||
-       (pdgc > 2000000000 && pdgc < 2000100000) ||
-       (pdgc == kPdgCluster || pdgc == kPdgString || pdgc == kPdgIndep)
-     );
-      
-  return is_fake;
-}
-//____________________________________________________________________________
-bool genie::pdg::IsIon(int pdgc)
-{
-  return (pdgc > 1000000000 && pdgc < 1999999999);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsParticle(int pdgc)
-{
-  if( genie::pdg::IsPseudoParticle (pdgc) ) return false;
-  if( genie::pdg::IsIon            (pdgc) ) return false;
-
-  return true;
-}
-//____________________________________________________________________________
-int genie::pdg::IonPdgCodeToZ(int ion_pdgc)
-{
-// Decoding Z from the PDG code (PDG ion code convention: 10LZZZAAAI)
-
-  int Z = (ion_pdgc/10000) - 1000*(ion_pdgc/10000000); // don't factor out!
-  return Z;
-}
-//____________________________________________________________________________
-int genie::pdg::IonPdgCodeToA(int ion_pdgc)
-{
-// Decoding A from the PDG code (PDG ion code convention: 10LZZZAAAI)
-
-  int A = (ion_pdgc/10) - 1000*(ion_pdgc/10000); // don't factor out!
-  return A;
-}
-//____________________________________________________________________________
-int genie::pdg::IonPdgCode(int A, int Z)
-{
-// Build ion PDG code from A,Z
-
-  return IonPdgCode(A,Z,0,0);
-}
-//____________________________________________________________________________
-int genie::pdg::IonPdgCode(int A, int Z, int L, int I)
-{
-// Build ion PDG code from A,Z,L,I
-
-  int ion_pdgc = 1000000000 +  L*100000000 + Z*10000 + A*10 + I;
-  return ion_pdgc;
-}
-//____________________________________________________________________________
-bool genie::pdg::IsLepton(int pdgc)
-{
-  bool is_neutral_lepton = genie::pdg::IsNeutralLepton(pdgc);
-  bool is_charged_lepton = genie::pdg::IsChargedLepton(pdgc);
-
-  bool is_lepton = (is_neutral_lepton || is_charged_lepton);
-  return is_lepton;
-}
-//____________________________________________________________________________
-bool genie::pdg::IsNeutralLepton(int pdgc)
-{
-  bool is_neutral_lepton = IsNeutrino(pdgc) || IsAntiNeutrino(pdgc);
-  return is_neutral_lepton;
-}
-//____________________________________________________________________________
-bool genie::pdg::IsChargedLepton(int pdgc)
-{
-  bool is_neg_lepton = genie::pdg::IsNegChargedLepton(pdgc);
-  bool is_pos_lepton = genie::pdg::IsPosChargedLepton(pdgc);
-
-  bool is_charged_lepton = is_neg_lepton || is_pos_lepton;
-  return is_charged_lepton;
-}
-//____________________________________________________________________________
-bool genie::pdg::IsNeutrino(int pdgc)
-{
-  bool is_nu = (pdgc == kPdgNuE)  ||
-               (pdgc == kPdgNuMu) ||
-               (pdgc == kPdgNuTau);
-  return is_nu;
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiNeutrino(int pdgc)
-{
-  bool is_nubar = (pdgc == kPdgAntiNuE)  ||
-                  (pdgc == kPdgAntiNuMu) ||
-                  (pdgc == kPdgAntiNuTau);
-
-  return is_nubar;
-}
-//____________________________________________________________________________
-bool genie::pdg::IsDarkMatter(int pdgc)
-{
-  bool is_dm = (pdgc == kPdgDarkMatter);
-  return is_dm;
-}
-//____________________________________________________________________________
-bool genie::pdg::IsNegChargedLepton(int pdgc)
-{
-  bool is_neg_lepton = (pdgc ==  kPdgElectron) ||
-                       (pdgc ==  kPdgMuon)     ||
-                       (pdgc ==  kPdgTau);
-
-  return is_neg_lepton;
-}
-//____________________________________________________________________________
-bool genie::pdg::IsPosChargedLepton(int pdgc)
-{
-  bool is_pos_lepton = (pdgc ==  kPdgPositron) ||
-                       (pdgc ==  kPdgAntiMuon) ||
-                       (pdgc ==  kPdgAntiTau);
-
-  return is_pos_lepton;
-}
-//____________________________________________________________________________
-
-bool genie::pdg::IsNuE(int pdgc)
-{
-  return (pdgc == kPdgNuE);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsNuMu(int pdgc)
-{
-  return (pdgc == kPdgNuMu);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsNuTau(int pdgc)
-{
-  return (pdgc == kPdgNuTau);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiNuE(int pdgc)
-{
-  return (pdgc == kPdgAntiNuE);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiNuMu(int pdgc)
-{
-  return (pdgc == kPdgAntiNuMu);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiNuTau(int pdgc)
-{
-  return (pdgc == kPdgAntiNuTau);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsElectron(int pdgc)
-{
-  return (pdgc == kPdgElectron);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsPositron(int pdgc)
-{
-  return (pdgc == kPdgPositron);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsMuon(int pdgc)
-{
-  return (pdgc == kPdgMuon);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiMuon(int pdgc)
-{
-  return (pdgc == kPdgAntiMuon);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsTau(int pdgc)
-{
-  return (pdgc == kPdgTau);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiTau(int pdgc)
-{
-  return (pdgc == kPdgAntiTau);
-}
-//____________________________________________________________________________
-int genie::pdg::Neutrino2ChargedLepton(int pdgc)
-{
-  switch(pdgc) {
-       case (kPdgNuE)      : return kPdgElectron; break;
-       case (kPdgAntiNuE)  : return kPdgPositron; break;
-       case (kPdgNuMu)     : return kPdgMuon;     break;
-       case (kPdgAntiNuMu) : return kPdgAntiMuon; break;
-       case (kPdgNuTau)    : return kPdgTau;      break;
-       case (kPdgAntiNuTau): return kPdgAntiTau;  break;
-  }
-  return -1;
-}
-//____________________________________________________________________________
-bool genie::pdg::IsDiQuark(int pdgc)
-{
-  return ( pdgc == kPdgDDDiquarkS1 || pdgc == kPdgUDDiquarkS0 ||
-           pdgc == kPdgUDDiquarkS1 || pdgc == kPdgUUDiquarkS1 ||
-           pdgc == kPdgSDDiquarkS0 || pdgc == kPdgSDDiquarkS1 ||
-           pdgc == kPdgSUDiquarkS0 || pdgc == kPdgSUDiquarkS1 ||
-           pdgc == kPdgSSDiquarkS1
-         );
-}
-//____________________________________________________________________________
-bool genie::pdg::IsQuark(int pdgc)
-{
-  return ( pdgc == kPdgDQuark || pdgc == kPdgUQuark ||
-           pdgc == kPdgSQuark || pdgc == kPdgCQuark ||
-           pdgc == kPdgBQuark || pdgc == kPdgTQuark
-         );
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiQuark(int pdgc)
-{
-  return ( pdgc == kPdgAntiDQuark || pdgc == kPdgAntiUQuark ||
-           pdgc == kPdgAntiSQuark || pdgc == kPdgAntiCQuark ||
-           pdgc == kPdgAntiBQuark || pdgc == kPdgAntiTQuark
-         );
-}
-//____________________________________________________________________________
-bool genie::pdg::IsUQuark(int pdgc)
-{
-  return (pdgc == kPdgUQuark);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsDQuark(int pdgc)
-{
-  return (pdgc == kPdgDQuark);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsSQuark(int pdgc)
-{
-  return (pdgc == kPdgSQuark);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsCQuark(int pdgc)
-{
-  return (pdgc == kPdgCQuark);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiUQuark(int pdgc)
-{
-  return (pdgc == kPdgAntiUQuark);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiDQuark(int pdgc)
-{
-  return (pdgc == kPdgAntiDQuark);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiSQuark(int pdgc)
-{
-  return (pdgc == kPdgAntiSQuark);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsAntiCQuark(int pdgc)
-{
-  return (pdgc == kPdgAntiCQuark);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsPion(int pdgc)
-{
-  return (pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsKaon(int pdgc)
-{
-  return (pdgc == kPdgKP || pdgc == kPdgK0 || pdgc == kPdgKM);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsProton(int pdgc)
-{
-  return (pdgc == kPdgProton);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsNeutron(int pdgc)
-{
-  return (pdgc == kPdgNeutron);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsNucleon(int pdgc)
-{
-  return (pdgc == kPdgNeutron || pdgc == kPdgProton);
-}
-//____________________________________________________________________________
-bool genie::pdg::IsNeutronOrProton(int pdgc)
-{
-  return (pdgc == kPdgNeutron || pdgc == kPdgProton);
-}
 //____________________________________________________________________________
 int genie::pdg::SwitchProtonNeutron(int pdgc)
 {
@@ -352,25 +62,11 @@ int genie::pdg::ModifyNucleonCluster(int pdgc, int dQ)
   return 0;
 }
 //____________________________________________________________________________
-bool genie::pdg::IsHadron(int pdgc)
-{
-  return ((pdgc>=100 && pdgc<=9999) || (pdgc>=-9999 && pdgc<=-100));
-}
-//____________________________________________________________________________
 bool genie::pdg::IsBaryonResonance(int pdgc)
 {
   return utils::res::IsBaryonResonance(pdgc);
 }
 //____________________________________________________________________________
-bool genie::pdg::Is2NucleonCluster(int pdgc)
-{
-   return (
-      pdgc == kPdgClusterNN   ||
-      pdgc == kPdgClusterNP   ||
-      pdgc == kPdgClusterPP
-   );
-}
-//____________________________________________________________________________
 int genie::pdg::GeantToPdg(int geant_code)
 {
   if(geant_code ==  3) return kPdgElectron;     //    11 / e-
@@ -431,4 +127,3 @@ int genie::pdg::GeantToPdg(int geant_code)
   return 0;
 }
 //____________________________________________________________________________
-
@@ -5,6 +5,12 @@
 
 \brief     Utilities for improving the code readability when using PDG codes.
 
+           The PDG code classification predicates are called for every
+           particle in the event record, by the hadronization, intranuclear
+           transport, hadronic system generation and event record code: the
+           simple ones are inline, so that they reduce to a few integer
+           comparisons at the point of use.
+
 \author    Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
            University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -22,73 +28,230 @@
 #ifndef _PDG_UTILS_H_
 #define _PDG_UTILS_H_
 
+#include "Framework/ParticleData/PDGCodes.h"
+
 namespace genie {
 
 namespace pdg
 {
-  bool IsPseudoParticle   (int pdgc);
-  bool IsIon              (int pdgc);
-  bool IsParticle         (int pdgc); ///< not ion or pseudo-particle
-
-  int  IonPdgCodeToZ      (int pdgc);
-  int  IonPdgCodeToA      (int pdgc);
-  int  IonPdgCode         (int A, int Z);
-  int  IonPdgCode         (int A, int Z, int L, int I);
-  
-  bool IsLepton           (int pdgc);
-  bool IsNeutralLepton    (int pdgc);
-  bool IsChargedLepton    (int pdgc);
-
-  bool IsNeutrino         (int pdgc);
-  bool IsAntiNeutrino     (int pdgc);
-  bool IsNegChargedLepton (int pdgc);
-  bool IsPosChargedLepton (int pdgc);
-
-  bool IsDarkMatter       (int pdgc);
-  
-  bool IsNuE              (int pdgc);
-  bool IsNuMu             (int pdgc);
-  bool IsNuTau            (int pdgc);
-  bool IsAntiNuE          (int pdgc);
-  bool IsAntiNuMu         (int pdgc);
-  bool IsAntiNuTau        (int pdgc);
-  
-  bool IsElectron         (int pdgc);
-  bool IsPositron         (int pdgc);
-  bool IsMuon             (int pdgc);
-  bool IsAntiMuon         (int pdgc);
-  bool IsTau              (int pdgc);
-  bool IsAntiTau          (int pdgc);
-  
-  bool IsDiQuark          (int pdgc);
-  bool IsQuark            (int pdgc);
-  bool IsUQuark           (int pdgc);
-  bool IsDQuark           (int pdgc);
-  bool IsSQuark           (int pdgc);
-  bool IsCQuark           (int pdgc);
-  bool IsAntiQuark        (int pdgc);
-  bool IsAntiUQuark       (int pdgc);
-  bool IsAntiDQuark       (int pdgc);
-  bool IsAntiSQuark       (int pdgc);
-  bool IsAntiCQuark       (int pdgc);
-  
-  bool IsKaon             (int pdgc);
-  bool IsPion             (int pdgc);
-  bool IsProton           (int pdgc);
-  bool IsNeutron          (int pdgc);
-  bool IsNucleon          (int pdgc);
-  bool IsNeutronOrProton  (int pdgc);
-  bool IsHadron           (int pdgc);
-  bool IsBaryonResonance  (int pdgc);
-  bool Is2NucleonCluster  (int pdgc);
-  
-  int  SwitchProtonNeutron    (int pdgc);
-  int  ModifyNucleonCluster   (int pdgc, int dQ);
-  int  Neutrino2ChargedLepton (int pdgc);
-
-  int  GeantToPdg (int geant_code);
+  inline bool IsPseudoParticle (int pdgc);
+  inline bool IsIon            (int pdgc);
+  inline bool IsParticle       (int pdgc); ///< not ion or pseudo-particle
+
+  inline int  IonPdgCodeToZ    (int pdgc);
+  inline int  IonPdgCodeToA    (int pdgc);
+  inline int  IonPdgCode       (int A, int Z);
+  inline int  IonPdgCode       (int A, int Z, int L, int I);
+
+  inline bool IsNeutrino         (int pdgc);
+  inline bool IsAntiNeutrino     (int pdgc);
+  inline bool IsNegChargedLepton (int pdgc);
+  inline bool IsPosChargedLepton (int pdgc);
+  inline bool IsLepton           (int pdgc);
+  inline bool IsNeutralLepton    (int pdgc);
+  inline bool IsChargedLepton    (int pdgc);
+
+  inline bool IsDarkMatter       (int pdgc);
+
+  inline bool IsNuE              (int pdgc);
+  inline bool IsNuMu             (int pdgc);
+  inline bool IsNuTau            (int pdgc);
+  inline bool IsAntiNuE          (int pdgc);
+  inline bool IsAntiNuMu         (int pdgc);
+  inline bool IsAntiNuTau        (int pdgc);
+
+  inline bool IsElectron         (int pdgc);
+  inline bool IsPositron         (int pdgc);
+  inline bool IsMuon             (int pdgc);
+  inline bool IsAntiMuon         (int pdgc);
+  inline bool IsTau              (int pdgc);
+  inline bool IsAntiTau          (int pdgc);
+
+  inline bool IsDiQuark          (int pdgc);
+  inline bool IsQuark            (int pdgc);
+  inline bool IsUQuark           (int pdgc);
+  inline bool IsDQuark           (int pdgc);
+  inline bool IsSQuark           (int pdgc);
+  inline bool IsCQuark           (int pdgc);
+  inline bool IsAntiQuark        (int pdgc);
+  inline bool IsAntiUQuark       (int pdgc);
+  inline bool IsAntiDQuark       (int pdgc);
+  inline bool IsAntiSQuark       (int pdgc);
+  inline bool IsAntiCQuark       (int pdgc);
+
+  inline bool IsKaon             (int pdgc);
+  inline bool IsPion             (int pdgc);
+  inline bool IsProton           (int pdgc);
+  inline bool IsNeutron          (int pdgc);
+  inline bool IsNucleon          (int pdgc);
+  inline bool IsNeutronOrProton  (int pdgc);
+  inline bool IsHadron           (int pdgc);
+         bool IsBaryonResonance  (int pdgc);
+  inline bool Is2NucleonCluster  (int pdgc);
+
+         int  SwitchProtonNeutron    (int pdgc);
+         int  ModifyNucleonCluster   (int pdgc, int dQ);
+  inline int  Neutrino2ChargedLepton (int pdgc);
+
+         int  GeantToPdg (int geant_code);
 
 }      // pdg namespace
 }      // genie namespace
 
+//____________________________________________________________________________
+// inline definitions
+
+inline bool genie::pdg::IsPseudoParticle(int pdgc)
+{
+// ROOT's rootino has PDG code=0
+// GENIE pseudoparticles are in the 2000000000-2000100000 range
+// Include PYTHIA's pseudoparticles
+
+  return ( (pdgc == 0) ||
+           (pdgc > 2000000000 && pdgc < 2000100000) ||
+           (pdgc == kPdgCluster || pdgc == kPdgString || pdgc == kPdgIndep) );
+}
+inline bool genie::pdg::IsIon(int pdgc)
+{
+  return (pdgc > 1000000000 && pdgc < 1999999999);
+}
+inline bool genie::pdg::IsParticle(int pdgc)
+{
+  return !IsPseudoParticle(pdgc) && !IsIon(pdgc);
+}
+inline int genie::pdg::IonPdgCodeToZ(int ion_pdgc)
+{
+// Decoding Z from the PDG code (PDG ion code convention: 10LZZZAAAI)
+
+  return (ion_pdgc/10000) - 1000*(ion_pdgc/10000000); // don't factor out!
+}
+inline int genie::pdg::IonPdgCodeToA(int ion_pdgc)
+{
+// Decoding A from the PDG code (PDG ion code convention: 10LZZZAAAI)
+
+  return (ion_pdgc/10) - 1000*(ion_pdgc/10000); // don't factor out!
+}
+inline int genie::pdg::IonPdgCode(int A, int Z)
+{
+  return IonPdgCode(A,Z,0,0);
+}
+inline int genie::pdg::IonPdgCode(int A, int Z, int L, int I)
+{
+  return 1000000000 +  L*100000000 + Z*10000 + A*10 + I;
+}
+inline bool genie::pdg::IsNeutrino(int pdgc)
+{
+  return (pdgc == kPdgNuE || pdgc == kPdgNuMu || pdgc == kPdgNuTau);
+}
+inline bool genie::pdg::IsAntiNeutrino(int pdgc)
+{
+  return (pdgc == kPdgAntiNuE || pdgc == kPdgAntiNuMu || pdgc == kPdgAntiNuTau);
+}
+inline bool genie::pdg::IsNegChargedLepton(int pdgc)
+{
+  return (pdgc == kPdgElectron || pdgc == kPdgMuon || pdgc == kPdgTau);
+}
+inline bool genie::pdg::IsPosChargedLepton(int pdgc)
+{
+  return (pdgc == kPdgPositron || pdgc == kPdgAntiMuon || pdgc == kPdgAntiTau);
+}
+inline bool genie::pdg::IsNeutralLepton(int pdgc)
+{
+  return IsNeutrino(pdgc) || IsAntiNeutrino(pdgc);
+}
+inline bool genie::pdg::IsChargedLepton(int pdgc)
+{
+  return IsNegChargedLepton(pdgc) || IsPosChargedLepton(pdgc);
+}
+inline bool genie::pdg::IsLepton(int pdgc)
+{
+  // e, mu, tau & their neutrinos (and antiparticles): |pdgc| = 11 - 16
+  return (pdgc >= kPdgElectron && pdgc <= kPdgNuTau) ||
+         (pdgc <= kPdgPositron && pdgc >= kPdgAntiNuTau);
+}
+inline bool genie::pdg::IsDarkMatter (int pdgc) { return (pdgc == kPdgDarkMatter); }
+
+inline bool genie::pdg::IsNuE        (int pdgc) { return (pdgc == kPdgNuE);       }
+inline bool genie::pdg::IsNuMu       (int pdgc) { return (pdgc == kPdgNuMu);      }
+inline bool genie::pdg::IsNuTau      (int pdgc) { return (pdgc == kPdgNuTau);     }
+inline bool genie::pdg::IsAntiNuE    (int pdgc) { return (pdgc == kPdgAntiNuE);   }
+inline bool genie::pdg::IsAntiNuMu   (int pdgc) { return (pdgc == kPdgAntiNuMu);  }
+inline bool genie::pdg::IsAntiNuTau  (int pdgc) { return (pdgc == kPdgAntiNuTau); }
+
+inline bool genie::pdg::IsElectron   (int pdgc) { return (pdgc == kPdgElectron);  }
+inline bool genie::pdg::IsPositron   (int pdgc) { return (pdgc == kPdgPositron);  }
+inline bool genie::pdg::IsMuon       (int pdgc) { return (pdgc == kPdgMuon);      }
+inline bool genie::pdg::IsAntiMuon   (int pdgc) { return (pdgc == kPdgAntiMuon);  }
+inline bool genie::pdg::IsTau        (int pdgc) { return (pdgc == kPdgTau);       }
+inline bool genie::pdg::IsAntiTau    (int pdgc) { return (pdgc == kPdgAntiTau);   }
+
+inline bool genie::pdg::IsDiQuark(int pdgc)
+{
+  return ( pdgc == kPdgDDDiquarkS1 || pdgc == kPdgUDDiquarkS0 ||
+           pdgc == kPdgUDDiquarkS1 || pdgc == kPdgUUDiquarkS1 ||
+           pdgc == kPdgSDDiquarkS0 || pdgc == kPdgSDDiquarkS1 ||
+           pdgc == kPdgSUDiquarkS0 || pdgc == kPdgSUDiquarkS1 ||
+           pdgc == kPdgSSDiquarkS1
+         );
+}
+inline bool genie::pdg::IsQuark(int pdgc)
+{
+  // d, u, s, c, b, t: pdgc = 1 - 6
+  return (pdgc >= kPdgDQuark && pdgc <= kPdgTQuark);
+}
+inline bool genie::pdg::IsAntiQuark(int pdgc)
+{
+  return (pdgc <= kPdgAntiDQuark && pdgc >= kPdgAntiTQuark);
+}
+inline bool genie::pdg::IsUQuark     (int pdgc) { return (pdgc == kPdgUQuark);     }
+inline bool genie::pdg::IsDQuark     (int pdgc) { return (pdgc == kPdgDQuark);     }
+inline bool genie::pdg::IsSQuark     (int pdgc) { return (pdgc == kPdgSQuark);     }
+inline bool genie::pdg::IsCQuark     (int pdgc) { return (pdgc == kPdgCQuark);     }
+inline bool genie::pdg::IsAntiUQuark (int pdgc) { return (pdgc == kPdgAntiUQuark); }
+inline bool genie::pdg::IsAntiDQuark (int pdgc) { return (pdgc == kPdgAntiDQuark); }
+inline bool genie::pdg::IsAntiSQuark (int pdgc) { return (pdgc == kPdgAntiSQuark); }
+inline bool genie::pdg::IsAntiCQuark (int pdgc) { return (pdgc == kPdgAntiCQuark); }
+
+inline bool genie::pdg::IsPion(int pdgc)
+{
+  return (pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM);
+}
+inline bool genie::pdg::IsKaon(int pdgc)
+{
+  return (pdgc == kPdgKP || pdgc == kPdgK0 || pdgc == kPdgKM);
+}
+inline bool genie::pdg::IsProton  (int pdgc) { return (pdgc == kPdgProton);  }
+inline bool genie::pdg::IsNeutron (int pdgc) { return (pdgc == kPdgNeutron); }
+inline bool genie::pdg::IsNucleon(int pdgc)
+{
+  return (pdgc == kPdgNeutron || pdgc == kPdgProton);
+}
+inline bool genie::pdg::IsNeutronOrProton(int pdgc)
+{
+  return (pdgc == kPdgNeutron || pdgc == kPdgProton);
+}
+inline bool genie::pdg::IsHadron(int pdgc)
+{
+  return ((pdgc>=100 && pdgc<=9999) || (pdgc>=-9999 && pdgc<=-100));
+}
+inline bool genie::pdg::Is2NucleonCluster(int pdgc)
+{
+  return ( pdgc == kPdgClusterNN ||
+           pdgc == kPdgClusterNP ||
+           pdgc == kPdgClusterPP );
+}
+inline int genie::pdg::Neutrino2ChargedLepton(int pdgc)
+{
+  switch(pdgc) {
+       case (kPdgNuE)      : return kPdgElectron;
+       case (kPdgAntiNuE)  : return kPdgPositron;
+       case (kPdgNuMu)     : return kPdgMuon;
+       case (kPdgAntiNuMu) : return kPdgAntiMuon;
+       case (kPdgNuTau)    : return kPdgTau;
+       case (kPdgAntiNuTau): return kPdgAntiTau;
+  }
+  return -1;
+}
+//____________________________________________________________________________
+
 #endif // _PDG_UTILS_H_
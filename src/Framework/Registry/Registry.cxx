@@ -19,6 +19,9 @@
    cascaded through the entire pool of instantiated algorithms.
  @ Sep 30, 2009 - CA
    Added 'RgType_t ItemType(RgKey) const', 'RgKeyList FindKeys(RgKey) const'
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The typed getters check the item type via TypeInfo() and downcast with a
+   static_cast rather than a dynamic_cast.
 
 */
 //____________________________________________________________________________
@@ -349,9 +352,8 @@ void Registry::Get(RgKey key, RgBool & item) const
   LOG("Registry", pDEBUG) << "Get an RgBool item with key: " << key;
 #endif
 
-  RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgBool> * ri = dynamic_cast<RegistryItem<RgBool>*> (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgBool);
+  RegistryItem<RgBool> * ri = static_cast<RegistryItem<RgBool>*> (rib);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Item value = " << ri->Data();
@@ -365,9 +367,8 @@ void Registry::Get(RgKey key, RgInt & item) const
   LOG("Registry", pDEBUG) << "Getting an RgInt item with key: " << key;
 #endif
 
-  RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgInt> * ri = dynamic_cast< RegistryItem<RgInt> * > (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgInt);
+  RegistryItem<RgInt> * ri = static_cast<RegistryItem<RgInt>*> (rib);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Item value = " << ri->Data();
@@ -381,9 +382,8 @@ void Registry::Get(RgKey key, RgDbl & item) const
   LOG("Registry", pDEBUG) << "Getting an RgDbl item with key: " << key;
 #endif
 
-  RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgDbl> * ri = dynamic_cast<RegistryItem<RgDbl>*> (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgDbl);
+  RegistryItem<RgDbl> * ri = static_cast<RegistryItem<RgDbl>*> (rib);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Item value = " << ri->Data();
@@ -397,9 +397,8 @@ void Registry::Get(RgKey key, RgStr & item) const
   LOG("Registry", pDEBUG) << "Getting an RgStr item with  key: " << key;
 #endif
 
-  RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgStr> * ri = dynamic_cast<RegistryItem<RgStr>*> (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgStr);
+  RegistryItem<RgStr> * ri = static_cast<RegistryItem<RgStr>*> (rib);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Item value = " << ri->Data();
@@ -413,9 +412,8 @@ void Registry::Get(RgKey key, RgAlg & item) const
   LOG("Registry", pDEBUG) << "Getting an RgAlg item with key: " << key;
 #endif
 
-  RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgAlg> * ri = dynamic_cast<RegistryItem<RgAlg>*> (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgAlg);
+  RegistryItem<RgAlg> * ri = static_cast<RegistryItem<RgAlg>*> (rib);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Item value = " << ri->Data();
@@ -430,9 +428,8 @@ void Registry::Get(RgKey key, RgH1F & item) const
   LOG("Registry", pDEBUG) << "Getting an RgH1F item with key: " << key;
 #endif
 
-  RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgH1F> *ri = dynamic_cast<RegistryItem<RgH1F>*> (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgH1F);
+  RegistryItem<RgH1F> * ri = static_cast<RegistryItem<RgH1F>*> (rib);
   item = ri->Data();
 
   if(!item) {
@@ -446,9 +443,8 @@ void Registry::Get(RgKey key, RgH2F & item) const
   LOG("Registry", pDEBUG) << "Getting an RgH2F item with key: " << key;
 #endif
 
-  RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgH2F> *ri = dynamic_cast<RegistryItem<RgH2F>*> (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgH2F);
+  RegistryItem<RgH2F> * ri = static_cast<RegistryItem<RgH2F>*> (rib);
   item = ri->Data();
 
   if(!item) {
@@ -462,9 +458,8 @@ void Registry::Get(RgKey key, RgTree & item) const
   LOG("Registry", pDEBUG) << "Getting an RgTree item with key: " << key;
 #endif
 
-  RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgTree> *ri =  dynamic_cast<RegistryItem<RgTree>*> (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgTree);
+  RegistryItem<RgTree> * ri = static_cast<RegistryItem<RgTree>*> (rib);
   item = ri->Data();
 
   if(!item) {
@@ -509,9 +504,8 @@ RgAlg Registry::GetAlg(RgKey key) const
 //____________________________________________________________________________
 RgH1F Registry::GetH1F(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgH1F> *ri = dynamic_cast<RegistryItem<RgH1F>*> (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgH1F);
+  RegistryItem<RgH1F> * ri = static_cast<RegistryItem<RgH1F>*> (rib);
 
   RgH1F item = ri->Data();
   return item;
@@ -519,9 +513,8 @@ RgH1F Registry::GetH1F(RgKey key) const
 //____________________________________________________________________________
 RgH2F Registry::GetH2F(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgH2F> *ri = dynamic_cast<RegistryItem<RgH2F>*> (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgH2F);
+  RegistryItem<RgH2F> * ri = static_cast<RegistryItem<RgH2F>*> (rib);
 
   RgH2F item = ri->Data();
   return item;
@@ -529,9 +522,8 @@ RgH2F Registry::GetH2F(RgKey key) const
 //____________________________________________________________________________
 RgTree Registry::GetTree(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgTree> *ri = dynamic_cast<RegistryItem<RgTree>*> (rib);
+  RegistryItemI * rib = this->SafeFind(key, kRgTree);
+  RegistryItem<RgTree> * ri = static_cast<RegistryItem<RgTree>*> (rib);
 
   RgTree item = ri->Data();
   return item;
@@ -575,6 +567,23 @@ RgIMapConstIter Registry::SafeFind(RgKey key) const
   exit(1);    
 }
 //____________________________________________________________________________
+RegistryItemI * Registry::SafeFind(RgKey key, RgType_t type) const
+{
+// Find the item with the input key and check its type, so that the caller
+// can downcast it to RegistryItem<T> with a static_cast
+
+  RegistryItemI * item = this->SafeFind(key)->second;
+  if (item->TypeInfo() == type) {
+    return item;
+  }
+  LOG("Registry/SafeFind", pFATAL)
+       << "*** Key: " << key << " in registry: " << this->Name()
+       << " holds a " << RgType::AsString(item->TypeInfo())
+       << " item, not a " << RgType::AsString(type);
+  gAbortingInErr = true;
+  exit(1);
+}
+//____________________________________________________________________________
 bool Registry::Exists(RgKey key) const
 {
   RgIMapConstIter entry = fRegistry.find(key);
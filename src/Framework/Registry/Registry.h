@@ -140,6 +140,7 @@ public:
   RgAlg  GetAlgDef    (RgKey key, RgAlg  def_opt, bool set_def=true);
   
   RgIMapConstIter SafeFind  (RgKey key) const;
+  RegistryItemI * SafeFind  (RgKey key, RgType_t type) const; ///< find an item of the given type
 
   int    NEntries     (void) const;                     ///< get number of items
   bool   Exists       (RgKey key) const;                ///< item with input key exists?
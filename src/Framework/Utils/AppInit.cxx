@@ -21,6 +21,8 @@
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/MemoryStats.h"
+#include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/XmlParserUtils.h"
 
@@ -30,12 +32,38 @@ using namespace genie;
 
 void genie::utils::app_init::RandGen(long int seed)
 {
+  // Set a per-job seed derived from the input (or the default) one, if the
+  // production is split in jobs
+  RunOpt * opt = RunOpt::Instance();
+  if(opt->NShards() > 1) {
+    long int base = (seed > 0) ? seed : RandomGen::Instance()->GetSeed();
+    long int shard_seed = ShardSeed(base, opt->Shard());
+    LOG("AppInit", pNOTICE)
+      << "Shard " << opt->Shard() << "/" << opt->NShards()
+      << ": using random number seed " << shard_seed
+      << " (derived from " << base << ")";
+    RandomGen::Instance()->SetSeed(shard_seed);
+    return;
+  }
+
   // Set random number seed, if a value was set at the command-line.
   if(seed > 0) {
     RandomGen::Instance()->SetSeed(seed);
   }
 }
 //___________________________________________________________________________
+long int genie::utils::app_init::ShardSeed(long int seed, int ishard)
+{
+  // Hash (splitmix64 finalizer) of the seed and the shard index, mapped to
+  // a positive 31-bit seed
+  ULong64_t z = (ULong64_t) seed * 0x9E3779B97F4A7C15ULL + (ULong64_t) ishard + 1;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z =  z ^ (z >> 31);
+
+  return (long int) (z % 2147483646ULL) + 1;
+}
+//___________________________________________________________________________
 void genie::utils::app_init::XSecTable (string inpfile, bool require_table)
 {
   // Load cross-section splines using file specified at the command-line.
@@ -61,7 +89,10 @@ void genie::utils::app_init::XSecTable (string inpfile, bool require_table)
   // file was specified & exists - load table
   if (utils::system::FileExists(fullinpfile)) {
     xspl = XSecSplineList::Instance();
-    XmlParserStatus_t status = xspl->LoadFromXml(fullinpfile);
+    XmlParserStatus_t status = kXmlOK;
+    if      (xspl->SharedMemory())                         status = xspl->LoadFromSharedMemory(fullinpfile);
+    else if (XSecSplineList::IsBinaryFile(fullinpfile))    status = xspl->LoadFromBinary(fullinpfile);
+    else                                                   status = xspl->LoadFromXml(fullinpfile);
     if (status != kXmlOK) {
       LOG("AppInit", pFATAL)
          << "Problem reading file: " << expandedinpfile;
@@ -122,4 +153,13 @@ void genie::utils::app_init::CacheFile(string inp_file)
   }
 }
 //___________________________________________________________________________
+void genie::utils::app_init::MemoryReport(string when)
+{
+  if(!RunOpt::Instance()->MemoryReport()) return;
+
+  MemoryStats * stats = MemoryStats::Instance();
+  stats->Poll();
+  LOG("AppInit", pNOTICE) << "[" << when << "] " << *stats;
+}
+//___________________________________________________________________________
 
@@ -26,11 +26,20 @@ namespace utils {
 
 namespace app_init
 {
+  // Sets the random number seed, if one was set at the command-line (seed>0).
+  // For a production split in jobs (see RunOpt, --shard i/N) each job uses
+  // the seed ShardSeed(seed,i), so that the jobs are independent and each
+  // one is reproducible.
   void RandGen        (long int seed);
+  long int ShardSeed  (long int seed, int ishard);
   void XSecTable      (string inpfile, bool require_table);
   void MesgThresholds (string inpfile);
   void CacheFile      (string inpfile);
 
+  // Prints the memory footprint breakdown (see MemoryStats), if requested
+  // at the command-line (see RunOpt, --memory-report)
+  void MemoryReport   (string when);
+
 } // app_init namespace
 } // utils namespace
 } // genie namespace
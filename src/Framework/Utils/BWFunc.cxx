@@ -12,21 +12,65 @@
  Important revisions after version 2.0.0 :
  @ May 01, 2016 - Libo Jiang
    Add W dependence to Delta->N gamma 
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the tabulated versions of BreitWignerLGamma and BreitWignerL, which
+   interpolate the L-dependent resonance widths in W tables built per
+   resonance when first needed.
 
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdlib>
+#include <map>
+#include <vector>
 
 #include <TMath.h>
 
 #include "Framework/Utils/BWFunc.h"
 #include "Framework/Conventions/Constants.h"
+#include "Framework/Messenger/Messenger.h"
 
 using namespace genie;
 using namespace genie::constants;
 
-//
+//____________________________________________________________________________
+namespace {
+  // L-dependent resonance widths
+  double WidthLGamma (double W, double mass, double width0);
+  double WidthL      (double W, int L, double mass, double width0);
+
+  // the widths of a resonance on a grid uniform in W, from just above the
+  // N pi threshold (where the width varies as a power of the pion momentum)
+  const int    kBWTabNW        = 8001;
+  const double kBWTabWMin      = kNucleonMass + kPi0Mass + 0.02;
+  const double kBWTabWMax      = 5.0;
+  const double kBWTabTolerance = 1E-4;
+
+  struct BWTable {
+    BWTable() : valid(false), dW(0) { }
+    bool   valid;
+    double dW;
+    std::vector<double> width;
+  };
+  // the tables of each resonance (width function, L, mass, width0), kept
+  // per thread as they are built during event generation
+  struct BWTableKey {
+    int    type, L;
+    double mass, width0;
+    bool operator < (const BWTableKey & k) const {
+      if(type != k.type) return type < k.type;
+      if(L    != k.L   ) return L    < k.L;
+      if(mass != k.mass) return mass < k.mass;
+      return width0 < k.width0;
+    }
+  };
+  thread_local std::map<BWTableKey, BWTable> gBWTables;
+
+  const BWTable & Table   (int type, int L, double mass, double width0);
+  bool            Validate(void);
+}
+//____________________________________________________________________________
 double genie::utils::bwfunc::BreitWignerLGamma(
                double W, int L, double mass, double width0, double norm)
 {
@@ -44,6 +88,137 @@ double genie::utils::bwfunc::BreitWignerLGamma(
   assert(W      >  0);
   assert(L      >= 0);
 
+  //-- calculate the L-dependent resonance width
+  if(W < kNucleonMass) {
+//  cout<< "Two small W!!! W is lower than one Nucleon Mass!!!!"<<endl;
+  return 0;
+  }
+  double width = WidthLGamma(W, mass, width0);
+
+  //-- calculate the Breit Wigner function for the input W
+  double width_2 = TMath::Power( width,  2);
+  double W_m_2   = TMath::Power( W-mass, 2);
+
+  double bw = (0.5/kPi) * (width/norm) / (W_m_2 + 0.25*width_2);
+
+  return bw;
+}
+//______________________________________________________________________
+double genie::utils::bwfunc::BreitWignerL(
+               double W, int L, double mass, double width0, double norm)
+{
+//Inputs:
+// - W:      Invariant mass (GeV)
+// - L:      Resonance orbital angular momentum
+// - mass:   Resonance mass (GeV)
+// - width0: Resonance width
+// - norm:   Breit Wigner norm
+
+  //-- sanity checks
+  assert(mass   >  0);
+  assert(width0 >  0);
+  assert(norm   >  0);
+  assert(W      >  0);
+  assert(L      >= 0);
+
+  //-- calculate the L-dependent resonance width
+  double width = WidthL(W, L, mass, width0);
+
+  //-- calculate the Breit Wigner function for the input W
+  double width_2 = TMath::Power( width,  2);
+  double W_m_2   = TMath::Power( W-mass, 2);
+
+  double bw = (0.5/kPi) * (width/norm) / (W_m_2 + 0.25*width_2);
+  return bw;
+}
+//______________________________________________________________________
+double genie::utils::bwfunc::BreitWigner(
+                       double W, double mass, double width, double norm)
+{
+//Inputs:
+// - W:     Invariant mass (GeV)
+// - mass:  Resonance mass (GeV)
+// - width: Resonance width
+// - norm:  Breit Wigner norm
+
+  //-- sanity checks
+  assert(mass  >  0);
+  assert(width >  0);
+  assert(norm  >  0);
+  assert(W     >  0);
+
+  //-- auxiliary parameters
+  double width_2 = TMath::Power( width,  2);
+  double W_m_2   = TMath::Power( W-mass, 2);
+
+  //-- calculate the Breit Wigner function for the input W
+  double bw = (0.5/kPi) * (width/norm) / (W_m_2 + 0.25*width_2);
+  return bw;
+}
+//______________________________________________________________________
+double genie::utils::bwfunc::BreitWignerLGammaTab(
+               double W, int L, double mass, double width0, double norm)
+{
+// As BreitWignerLGamma, with the width interpolated in the resonance table
+
+  const BWTable & t = Table(0, L, mass, width0);
+  double x = (W - kBWTabWMin) / t.dW;
+  if(!t.valid || x < 0 || x >= kBWTabNW - 1) {
+    return BreitWignerLGamma(W, L, mass, width0, norm);
+  }
+  int    i     = (int) x;
+  double f     = x - i;
+  double width = (1-f) * t.width[i] + f * t.width[i+1];
+  double W_m   = W - mass;
+
+  double bw = (0.5/kPi) * (width/norm) / (W_m*W_m + 0.25*width*width);
+
+  if(Validate()) {
+    double bw0 = BreitWignerLGamma(W, L, mass, width0, norm);
+    double dev = TMath::Abs(bw - bw0) / (bw0 + 1E-3 * 2/(kPi*width0*norm));
+    if(dev > kBWTabTolerance) {
+      LOG("BWFunc", pWARN)
+        << "BreitWignerLGamma(W = " << W << ", M = " << mass
+        << ", Width = " << width0 << "): tabulated: " << bw
+        << ", analytic: " << bw0;
+    }
+  }
+  return bw;
+}
+//______________________________________________________________________
+double genie::utils::bwfunc::BreitWignerLTab(
+               double W, int L, double mass, double width0, double norm)
+{
+// As BreitWignerL, with the width interpolated in the resonance table
+
+  const BWTable & t = Table(1, L, mass, width0);
+  double x = (W - kBWTabWMin) / t.dW;
+  if(!t.valid || x < 0 || x >= kBWTabNW - 1) {
+    return BreitWignerL(W, L, mass, width0, norm);
+  }
+  int    i     = (int) x;
+  double f     = x - i;
+  double width = (1-f) * t.width[i] + f * t.width[i+1];
+  double W_m   = W - mass;
+
+  double bw = (0.5/kPi) * (width/norm) / (W_m*W_m + 0.25*width*width);
+
+  if(Validate()) {
+    double bw0 = BreitWignerL(W, L, mass, width0, norm);
+    double dev = TMath::Abs(bw - bw0) / (bw0 + 1E-3 * 2/(kPi*width0*norm));
+    if(dev > kBWTabTolerance) {
+      LOG("BWFunc", pWARN)
+        << "BreitWignerL(W = " << W << ", L = " << L << ", M = " << mass
+        << ", Width = " << width0 << "): tabulated: " << bw
+        << ", analytic: " << bw0;
+    }
+  }
+  return bw;
+}
+//______________________________________________________________________
+namespace {
+double WidthLGamma(double W, double mass, double width0)
+{
   //-- auxiliary parameters
   double mN    = kNucleonMass;
   double mPi   = kPi0Mass;
@@ -62,15 +237,9 @@ double genie::utils::bwfunc::BreitWignerLGamma(
   double widPi0   = width0*BRPi0;  
   double widgamma0= width0*BRgamma0;  
 
-  //-- calculate the L-dependent resonance width
   double EgammaW= (W_2-mN_2)/(2*W);
   double Egammam= (m_2-mN_2)/(2*m);
 
-
-  if(EgammaW<0) {
-//  cout<< "Two small W!!! W is lower than one Nucleon Mass!!!!"<<endl;
-  return 0;
-  }
   //pPiW pion momentum 
   double pPiW     = 0;
   // 
@@ -95,32 +264,11 @@ double genie::utils::bwfunc::BreitWignerLGamma(
 
   //double width = widPi0*(TPiW/TPim)+widgamma0*(EgammaW_3*fgammaW_2/(Egammam_3*fgammam_2));
   double width = widPi0*TMath::Power((pPiW/pPim),3)+widgamma0*(EgammaW_3*fgammaW_2/(Egammam_3*fgammam_2));
-  //-- calculate the Breit Wigner function for the input W
-  double width_2 = TMath::Power( width,  2);
-  double W_m_2   = TMath::Power( W-mass, 2);
-
-  double bw = (0.5/kPi) * (width/norm) / (W_m_2 + 0.25*width_2);
-
-  return bw;
+  return width;
 }
 //______________________________________________________________________
-double genie::utils::bwfunc::BreitWignerL(
-               double W, int L, double mass, double width0, double norm)
+double WidthL(double W, int L, double mass, double width0)
 {
-//Inputs:
-// - W:      Invariant mass (GeV)
-// - L:      Resonance orbital angular momentum
-// - mass:   Resonance mass (GeV)
-// - width0: Resonance width
-// - norm:   Breit Wigner norm
-
-  //-- sanity checks
-  assert(mass   >  0);
-  assert(width0 >  0);
-  assert(norm   >  0);
-  assert(W      >  0);
-  assert(L      >= 0);
-
   //-- auxiliary parameters
   double mN    = kNucleonMass;
   double mPi   = kPi0Mass;
@@ -129,7 +277,6 @@ double genie::utils::bwfunc::BreitWignerL(
   double mPi_2 = TMath::Power(mPi,  2);
   double W_2   = TMath::Power(W,    2);
 
-  //-- calculate the L-dependent resonance width
   double qpW_2 = ( TMath::Power(W_2 - mN_2 - mPi_2, 2) - 4*mN_2*mPi_2 );
   double qpM_2 = ( TMath::Power(m_2 - mN_2 - mPi_2, 2) - 4*mN_2*mPi_2 );
   if(qpW_2 < 0) qpW_2 = 0;
@@ -137,37 +284,65 @@ double genie::utils::bwfunc::BreitWignerL(
   double qpW   = TMath::Sqrt(qpW_2) / (2*W);
   double qpM   = TMath::Sqrt(qpM_2) / (2*mass);
   double width = width0 * TMath::Power( qpW/qpM, 2*L+1 );
-
-  //-- calculate the Breit Wigner function for the input W
-  double width_2 = TMath::Power( width,  2);
-  double W_m_2   = TMath::Power( W-mass, 2);
-
-  double bw = (0.5/kPi) * (width/norm) / (W_m_2 + 0.25*width_2);
-  return bw;
+  return width;
 }
 //______________________________________________________________________
-double genie::utils::bwfunc::BreitWigner(
-                       double W, double mass, double width, double norm)
+const BWTable & Table(int type, int L, double mass, double width0)
 {
-//Inputs:
-// - W:     Invariant mass (GeV)
-// - mass:  Resonance mass (GeV)
-// - width: Resonance width
-// - norm:  Breit Wigner norm
-
-  //-- sanity checks
-  assert(mass  >  0);
-  assert(width >  0);
-  assert(norm  >  0);
-  assert(W     >  0);
-
-  //-- auxiliary parameters
-  double width_2 = TMath::Power( width,  2);
-  double W_m_2   = TMath::Power( W-mass, 2);
+  BWTableKey key;
+  key.type   = type;
+  key.L      = L;
+  key.mass   = mass;
+  key.width0 = width0;
+
+  std::map<BWTableKey, BWTable>::iterator it = gBWTables.find(key);
+  if(it != gBWTables.end()) return it->second;
+
+  BWTable & t = gBWTables[key];
+  t.dW = (kBWTabWMax - kBWTabWMin) / (kBWTabNW - 1);
+  t.width.resize(kBWTabNW);
+  for(int i = 0; i < kBWTabNW; i++) {
+    double Wi = kBWTabWMin + i * t.dW;
+    t.width[i] = (type==0) ? WidthLGamma(Wi, mass, width0) :
+                             WidthL     (Wi, L, mass, width0);
+  }
 
-  //-- calculate the Breit Wigner function for the input W
-  double bw = (0.5/kPi) * (width/norm) / (W_m_2 + 0.25*width_2);
-  return bw;
+  // check the interpolation against the analytic widths at the cell
+  // centres, relative to the largest width
+  double wmax = 0;
+  for(int i = 0; i < kBWTabNW; i++) {
+    wmax = TMath::Max(wmax, TMath::Abs(t.width[i]));
+  }
+  double maxdev = 0;
+  for(int i = 0; i < kBWTabNW - 1; i++) {
+    double Wc = kBWTabWMin + (i+0.5) * t.dW;
+    double wc = (type==0) ? WidthLGamma(Wc, mass, width0) :
+                            WidthL     (Wc, L, mass, width0);
+    double dev = TMath::Abs(0.5*(t.width[i] + t.width[i+1]) - wc) /
+                 (TMath::Abs(wc) + 1E-3 * wmax);
+    maxdev = TMath::Max(maxdev, dev);
+  }
+  t.valid = (wmax > 0 && maxdev <= kBWTabTolerance);
+  if(t.valid) {
+    LOG("BWFunc", pINFO)
+      << "Built the width table for the resonance with M = " << mass
+      << ", Width = " << width0 << ", L = " << L << ", max deviation: "
+      << maxdev;
+  } else {
+    LOG("BWFunc", pWARN)
+      << "The width table for the resonance with M = " << mass
+      << ", Width = " << width0 << ", L = " << L << " deviates by "
+      << maxdev << " > " << kBWTabTolerance
+      << " from the analytic widths - Not using it";
+  }
+  return t;
+}
+//______________________________________________________________________
+bool Validate(void)
+{
+  // compare each tabulated value with the analytic form?
+  static bool validate = (std::getenv("GUTILSTABCHECK") != 0);
+  return validate;
+}
 }
 //______________________________________________________________________
-
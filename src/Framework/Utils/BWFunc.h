@@ -35,6 +35,16 @@ namespace bwfunc {
   //-- A simple Breit-Wigner distribution.
   double BreitWigner(double W, double mass, double width, double norm);
 
+  //-- Tabulated versions of BreitWignerLGamma and BreitWignerL.
+  //   The widths of each resonance are interpolated in a fine W table, built
+  //   when first needed and checked against the analytic widths (the
+  //   analytic forms are used outside the table or if the check fails).
+  //   Set GUTILSTABCHECK to compare every value with the analytic form.
+  double BreitWignerLGammaTab(
+             double W, int L, double mass, double width0, double norm);
+  double BreitWignerLTab(
+             double W, int L, double mass, double width0, double norm);
+
 } // bwfunc namespace
 } // utils  namespace
 } // genie  namespace
@@ -14,23 +14,46 @@
    Cache is not autoloaded and use of variables $GCACHEFILE is no longer
    supported. Instead, call Cache::OpenCacheFile(string filename) explicitly.
    Now cached data are stored in the top-level 'directory'.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The cache file is signed with the GENIE version, tune and global config
+   and branches are tagged with the config hash of their algorithm: stale
+   contents are ignored. The file is read at OpenCacheFile() and refreshed
+   atomically (temporary file + rename) at the end of the job.
 */
 //____________________________________________________________________________
 
 #include <sstream>
 #include <iostream>
+#include <iomanip>
+#include <cstdio>
+#include <vector>
+#include <mutex>
 
 #include <TSystem.h>
 #include <TDirectory.h>
+#include <TFile.h>
 #include <TList.h>
+#include <TNtupleD.h>
 #include <TObjString.h>
 
+#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Conventions/GVersion.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Registry/Registry.h"
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchI.h"
+#include "Framework/Utils/CacheBranchFx.h"
+#include "Framework/Utils/CacheBranchNtp.h"
+#include "Framework/Utils/MemoryStats.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
 
 using std::ostringstream;
 using std::endl;
+using std::setw;
+using std::setfill;
+using std::vector;
 
 namespace genie {
 
@@ -42,12 +65,53 @@ ostream & operator << (ostream & stream, const Cache & cache)
 }
 //____________________________________________________________________________
 Cache * Cache::fInstance = 0;
+
+// private instance of the calling thread (if any)
+static thread_local Cache * gThreadCache = 0;
+
+// serializes the access to the branch maps & the revision counter
+static std::mutex    gCacheLock;
+static unsigned long gCacheRevision = 0;
+
+// 64-bit FNV-1a hash
+static string CacheHash(const string & str)
+{
+  ULong64_t hash = 0xcbf29ce484222325ULL;
+  for(unsigned int i = 0; i < str.size(); i++) {
+    hash ^= (unsigned char) str[i];
+    hash *= 0x100000001b3ULL;
+  }
+  ostringstream hash_str;
+  hash_str << std::hex << setfill('0') << setw(16) << hash;
+  return hash_str.str();
+}
+
+// the contents of a registry (excluding the item lock status, which depends
+// on the stage of the job)
+static string RegistryContents(const Registry & registry)
+{
+  ostringstream contents;
+  const RgIMap & items = registry.GetItemMap();
+  RgIMap::const_iterator riter = items.begin();
+  for( ; riter != items.end(); ++riter) {
+    if(!riter->second) continue;
+    ostringstream item;
+    riter->second->Print(item);
+    string value = item.str();
+    size_t pos = value.find(" : ");
+    if(pos != string::npos) value = value.substr(pos+3);
+    contents << riter->first << "=" << value << ";";
+  }
+  return contents.str();
+}
 //____________________________________________________________________________
 Cache::Cache()
 {
-  fInstance  = 0;
   fCacheMap  = 0;
-  fCacheFile = 0;
+  fCacheFileName = "";
+
+  std::lock_guard<std::mutex> guard(gCacheLock);
+  fRevision  = ++gCacheRevision;
 }
 //____________________________________________________________________________
 Cache::~Cache()
@@ -66,15 +130,17 @@ Cache::~Cache()
     fCacheMap->clear();
     delete fCacheMap;
   }
-  if(fCacheFile) {
-    fCacheFile->Close();
-    delete fCacheFile;
-  }
-  fInstance = 0;
+  if(this != gThreadCache) fInstance = 0;
 }
 //____________________________________________________________________________
 Cache * Cache::Instance()
 {
+  if(gThreadCache) return gThreadCache;
+  if(fInstance) return fInstance;
+
+  static std::mutex instance_lock;
+  std::lock_guard<std::mutex> guard(instance_lock);
+
   if(fInstance == 0) {
     static Cache::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
@@ -82,12 +148,68 @@ Cache * Cache::Instance()
     fInstance = new Cache;
 
     fInstance->fCacheMap = new map<string, CacheBranchI * >;
+
+    MemoryStats::Instance()->Register("Cache", Cache::ReportMemory);
   }
   return fInstance;
 }
 //____________________________________________________________________________
+void Cache::ReportMemory(MemoryStats & stats)
+{
+// Report the memory held by the branches of the global cache (the thread
+// instances are short-lived copies and are not included)
+
+  if(fInstance == 0 || fInstance->fCacheMap == 0) return;
+
+  std::lock_guard<std::mutex> guard(gCacheLock);
+
+  long int nfx = 0, nntp = 0;
+  double   bfx = 0, bntp = 0;
+  map<string, CacheBranchI *>::const_iterator it = fInstance->fCacheMap->begin();
+  for( ; it != fInstance->fCacheMap->end(); ++it) {
+    const CacheBranchFx  * fx  = dynamic_cast<const CacheBranchFx  *> (it->second);
+    const CacheBranchNtp * ntp = dynamic_cast<const CacheBranchNtp *> (it->second);
+    if(fx) {
+      nfx++;
+      bfx += sizeof(CacheBranchFx) +
+             (fx->X().capacity() + fx->Y().capacity()) * sizeof(double);
+      if(fx->Spl()) bfx += fx->Spl()->MemorySize();
+    }
+    else if(ntp) {
+      nntp++;
+      bntp += sizeof(CacheBranchNtp);
+      const TNtupleD * nt = ntp->Ntuple();
+      if(nt) bntp += nt->GetEntries() * nt->GetNvar() * sizeof(double);
+    }
+  }
+  stats.Add("Cache", "function branches", bfx,  nfx);
+  stats.Add("Cache", "ntuple branches",   bntp, nntp);
+}
+//____________________________________________________________________________
+Cache * Cache::CreateThreadInstance(void)
+{
+// Create a private cache for the calling thread. While it exists, all
+// Cache::Instance() calls made from that thread return it, so that cache
+// branches filled by algorithms running in different threads do not clash.
+
+  Cache::DeleteThreadInstance();
+  gThreadCache = new Cache;
+  gThreadCache->fCacheMap = new map<string, CacheBranchI * >;
+  return gThreadCache;
+}
+//____________________________________________________________________________
+void Cache::DeleteThreadInstance(void)
+{
+  if(gThreadCache) {
+    delete gThreadCache;
+    gThreadCache = 0;
+  }
+}
+//____________________________________________________________________________
 CacheBranchI * Cache::FindCacheBranch(string key)
 {
+  std::lock_guard<std::mutex> guard(gCacheLock);
+
   map<string, CacheBranchI *>::const_iterator map_iter = fCacheMap->find(key);
 
   if (map_iter == fCacheMap->end()) return 0;
@@ -96,7 +218,14 @@ CacheBranchI * Cache::FindCacheBranch(string key)
 //____________________________________________________________________________
 void Cache::AddCacheBranch(string key, CacheBranchI * branch)
 {
+  // tag the branches to be saved in the cache file
+  string tag = "";
+  if(fCacheFileName.size() > 0) tag = this->ConfigTag(key);
+
+  std::lock_guard<std::mutex> guard(gCacheLock);
+
   fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,branch) );
+  if(fCacheFileName.size() > 0) fCacheTags[key] = tag;
 }
 //____________________________________________________________________________
 string Cache::CacheBranchKey(string k0, string k1, string k2) const
@@ -120,6 +249,9 @@ void Cache::RmAllCacheBranches(void)
 {
   LOG("Cache", pNOTICE) << "Removing cache branches";
 
+  std::lock_guard<std::mutex> guard(gCacheLock);
+  fRevision = ++gCacheRevision;
+
   if(fCacheMap) {
     map<string, CacheBranchI * >::iterator citer;
     for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
@@ -131,6 +263,7 @@ void Cache::RmAllCacheBranches(void)
     }
     fCacheMap->clear();
   }
+  fCacheTags.clear();
 }
 //____________________________________________________________________________
 void Cache::RmMatchedCacheBranches(string key_substring)
@@ -141,75 +274,209 @@ void Cache::RmMatchedCacheBranches(string key_substring)
 //____________________________________________________________________________
 void Cache::Load(void)
 {
+  if(fCacheFileName.size() == 0) return;
+
+  if(gSystem->AccessPathName(fCacheFileName.c_str())) {
+    LOG("Cache", pNOTICE)
+      << "Cache file " << fCacheFileName << " not found - It will be created";
+    return;
+  }
+
   LOG("Cache", pNOTICE) << "Loading cache";
 
-  if(!fCacheFile) return;
-  TList * keys = (TList*) fCacheFile->Get("key_list");
-  TIter kiter(keys);
-  TObjString * keyobj = 0;
-  int ib=0;
-  while ((keyobj = (TObjString *)kiter.Next())) {
-    string key = string(keyobj->GetString().Data());
+  TFile file(fCacheFileName.c_str(), "READ");
+  if(file.IsZombie()) {
+    LOG("Cache", pWARN)
+      << "Could not read cache file: " << fCacheFileName
+      << " - It will be overwritten";
+    return;
+  }
+
+  // the cached data must have been computed with the same GENIE version,
+  // tune and global configuration
+  TObjString * signature = dynamic_cast<TObjString *> (file.Get("signature"));
+  string stored = (signature) ? signature->GetString().Data() : "";
+  delete signature;
+  if(stored != this->Signature()) {
+    LOG("Cache", pWARN)
+      << "Cache file " << fCacheFileName << " was written by another GENIE "
+      << "version or for another tune / configuration - Ignoring its "
+      << "contents (it will be refreshed)";
+    return;
+  }
+
+  TList * keys = dynamic_cast<TList *> (file.Get("key_list"));
+  TList * tags = dynamic_cast<TList *> (file.Get("tag_list"));
+  if(!keys || !tags || keys->GetEntries() != tags->GetEntries()) {
+    LOG("Cache", pWARN)
+      << "Invalid cache file: " << fCacheFileName << " - It will be overwritten";
+    delete keys;
+    delete tags;
+    return;
+  }
+  keys->SetOwner(true);
+  tags->SetOwner(true);
+
+  int nloaded  = 0;
+  int ndropped = 0;
+  for(int ib = 0; ib < keys->GetEntries(); ib++) {
+    string key = ((TObjString *) keys->At(ib))->GetString().Data();
+    string tag = ((TObjString *) tags->At(ib))->GetString().Data();
+
+    // drop branches computed with another configuration of their algorithm
+    string current_tag = this->ConfigTag(key);
+    if(tag != current_tag) {
+      LOG("Cache", pINFO) << "Dropping stale cache branch: " << key;
+      ndropped++;
+      continue;
+    }
+
     ostringstream bname;
-    bname << "buffer_" << ib++;
-    CacheBranchI * buffer = (CacheBranchI*) fCacheFile->Get(bname.str().c_str());
-    if(buffer) {
-     fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,buffer) );
+    bname << "buffer_" << ib;
+    CacheBranchI * buffer =
+        dynamic_cast<CacheBranchI *> (file.Get(bname.str().c_str()));
+    if(!buffer) continue;
+
+    std::lock_guard<std::mutex> guard(gCacheLock);
+    bool inserted = fCacheMap->insert(
+         map<string, CacheBranchI *>::value_type(key,buffer) ).second;
+    if(inserted) {
+      fCacheTags[key] = tag;
+      nloaded++;
+    } else {
+      delete buffer;
     }
   }
-  LOG("Cache", pNOTICE) << "Cache loaded...";
+  delete keys;
+  delete tags;
+  file.Close();
+
+  {
+    std::lock_guard<std::mutex> guard(gCacheLock);
+    fRevision = ++gCacheRevision;
+  }
+
+  LOG("Cache", pNOTICE)
+    << "Cache loaded: " << nloaded << " branches ("
+    << ndropped << " stale branches dropped)";
   LOG("Cache", pNOTICE) << *this;
 }
 //____________________________________________________________________________
 void Cache::Save(void)
 {
-  if(!fCacheFile) {
+  if(fCacheFileName.size() == 0) return;
+
+  // write to a temporary file which then replaces the cache file, so that
+  // other jobs never read an incomplete cache file
+  ostringstream tmpname;
+  tmpname << fCacheFileName << ".tmp." << gSystem->GetPid();
+
+  TDirectory * cwd = gDirectory;
+  TFile file(tmpname.str().c_str(), "RECREATE");
+  if(file.IsZombie()) {
+    LOG("Cache", pWARN)
+      << "Could not write cache file: " << tmpname.str();
+    if(cwd) cwd->cd();
     return;
   }
-  fCacheFile->cd();
+  file.cd();
 
-  int ib=0;
-  TList * keys = new TList;
-  keys->SetOwner(true);
+  TList keys;
+  TList tags;
+  keys.SetOwner(true);
+  tags.SetOwner(true);
+  {
+    std::lock_guard<std::mutex> guard(gCacheLock);
+    int ib=0;
+    map<string, CacheBranchI * >::iterator citer;
+    for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
+      string key = citer->first;
+      CacheBranchI * branch = citer->second;
+      if(!branch) continue;
+      map<string, string>::const_iterator titer = fCacheTags.find(key);
+      string tag = (titer != fCacheTags.end()) ? titer->second : "";
 
-  map<string, CacheBranchI * >::iterator citer;
-  for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
-    string key = citer->first;
-    CacheBranchI * branch = citer->second;
-    if(branch) {
       ostringstream bname;
       bname << "buffer_" << ib++;
-      keys->Add(new TObjString(key.c_str()));
+      keys.Add(new TObjString(key.c_str()));
+      tags.Add(new TObjString(tag.c_str()));
       branch->Write(bname.str().c_str(), TObject::kOverwrite);
     }
   }
-  keys->Write("key_list", TObject::kSingleKey | TObject::kOverwrite );
+  keys.Write("key_list", TObject::kSingleKey | TObject::kOverwrite );
+  tags.Write("tag_list", TObject::kSingleKey | TObject::kOverwrite );
+  TObjString signature(fSignature.c_str());
+  signature.Write("signature", TObject::kOverwrite);
+  file.Close();
+  if(cwd) cwd->cd();
 
-  keys->Clear();
-  delete keys;
+  if(rename(tmpname.str().c_str(), fCacheFileName.c_str()) != 0) {
+    LOG("Cache", pWARN)
+      << "Could not update cache file: " << fCacheFileName;
+    gSystem->Unlink(tmpname.str().c_str());
+    return;
+  }
+  LOG("Cache", pNOTICE)
+    << "Saved " << keys.GetEntries() << " cache branches in " << fCacheFileName;
+}
+//____________________________________________________________________________
+void Cache::SaveCacheFile(void)
+{
+// Refresh the cache file now (it is otherwise refreshed at the end of the job)
+
+  this->Save();
 }
 //____________________________________________________________________________
 void Cache::OpenCacheFile(string filename)
 {
   if(filename.size() == 0) return;
 
-  if(fCacheFile) {
-    if(fCacheFile->IsOpen()) {
-       delete fCacheFile;
-       fCacheFile = 0;
+  LOG("Cache", pNOTICE) << "Using cache file: " << filename;
+
+  fCacheFileName = filename;
+  fSignature     = this->Signature();
+
+  // tag the branches created so far
+  map<string, CacheBranchI * >::const_iterator citer;
+  for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
+    if(fCacheTags.count(citer->first) == 0) {
+      fCacheTags[citer->first] = this->ConfigTag(citer->first);
     }
   }
 
-  LOG("Cache", pNOTICE) << "Using cache file: " << filename;
+  this->Load();
+}
+//____________________________________________________________________________
+string Cache::Signature(void) const
+{
+// GENIE version, tune & hash of the global configuration
 
-  fCacheFile = new TFile(filename.c_str(),"update");
-  if(!fCacheFile->IsOpen()) {
-     delete fCacheFile;
-     fCacheFile = 0;
-     LOG("Cache", pWARN) << "Could not open cache file: " << filename;
+  ostringstream signature;
+  signature << "GENIE " << __GENIE_RELEASE__;
+
+  TuneId * tune = RunOpt::Instance()->Tune();
+  signature << " / tune: " << ((tune) ? tune->Name() : "none");
+
+  Registry * global = AlgConfigPool::Instance()->GlobalParameterList();
+  if(global) {
+    signature << " / config: " << CacheHash(RegistryContents(*global));
   }
+  return signature.str();
+}
+//____________________________________________________________________________
+string Cache::ConfigTag(string key) const
+{
+// Hash of the configuration of the algorithm the key belongs to (keys start
+// with the algorithm name and configuration, see CacheBranchKey())
 
-  this->Load();
+  vector<string> tokens = utils::str::Split(key, "/");
+  if(tokens.size() < 2) return "";
+
+  Registry * config =
+       AlgConfigPool::Instance()->FindRegistry(tokens[0], tokens[1]);
+  if(!config) return "";
+
+  return CacheHash(RegistryContents(*config));
 }
 //____________________________________________________________________________
 void Cache::Print(ostream & stream) const
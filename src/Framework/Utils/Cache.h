@@ -5,6 +5,24 @@
 
 \brief    GENIE Cache Memory
 
+          Access to the branch map is serialized, so that the shared cache
+          can be used by the threads of the multi-threaded drivers. The
+          contents of a branch are not protected: Each event generation
+          thread works with its own thread instance. Since looking up
+          branches by key is relatively expensive, clients may keep pointers
+          to the branches they found, for as long as the cache Revision()
+          is unchanged.
+
+          A cache file (see OpenCacheFile()) lets later jobs reuse the cached
+          data (eg max{dxsec/dK} envelopes, resonance excitation xsecs).
+          The file is signed with the GENIE version, the tune and the global
+          configuration, and each branch is tagged with a hash of the
+          configuration of the algorithm it belongs to. Files with another
+          signature are ignored, and branches with another tag are dropped.
+          The file is refreshed atomically at the end of the job (written to
+          a temporary file which is then renamed), so concurrent jobs always
+          read a complete file.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -23,8 +41,6 @@
 #include <string>
 #include <ostream>
 
-#include <TFile.h>
-
 using std::map;
 using std::string;
 using std::ostream;
@@ -33,6 +49,7 @@ namespace genie {
 
 class Cache;
 class CacheBranchI;
+class MemoryStats;
 
 ostream & operator << (ostream & stream, const Cache & cache);
 
@@ -42,14 +59,25 @@ public:
 
   static Cache * Instance(void);
 
+  //! per-thread instances, used by multi-threaded event generation drivers
+  //! (a thread instance is never backed by a cache file)
+  static Cache * CreateThreadInstance (void);
+  static void    DeleteThreadInstance (void);
+
   //! cache file
-  void OpenCacheFile (string filename);
+  void   OpenCacheFile (string filename);
+  void   SaveCacheFile (void);
+  string CacheFile     (void) const { return fCacheFileName; }
 
   //! finding/adding cache branches
   CacheBranchI * FindCacheBranch (string key);
   void           AddCacheBranch  (string key, CacheBranchI * branch);
   string         CacheBranchKey  (string k0, string k1="", string k2="") const;
 
+  //! changes whenever branches may have been removed or replaced (unique to
+  //! each cache instance, so that cached branch pointers can be validated)
+  unsigned long  Revision        (void) const { return fRevision; }
+
   //! removing cache branches
   void RmCacheBranch         (string key);
   void RmAllCacheBranches    (void);
@@ -65,12 +93,22 @@ private:
   void Load (void);
   void Save (void);
 
+  //! validity of cache file contents
+  string Signature (void) const;
+  string ConfigTag (string key) const;
+
+  //! memory held by the cache branches (see MemoryStats)
+  static void ReportMemory (MemoryStats & stats);
+
   //! singleton instance
   static Cache * fInstance;
 
   //! map of cache buffers & cache file
   map<string, CacheBranchI * > * fCacheMap;
-  TFile *                        fCacheFile;
+  map<string, string>            fCacheTags;     ///< key -> config tag (if backed by a cache file)
+  string                         fCacheFileName;
+  string                         fSignature;     ///< signature of the cache file contents (set when the file is opened)
+  unsigned long                  fRevision;
 
   //! singleton class: constructors are private
   Cache();
@@ -13,10 +13,14 @@
  @ Jun 25, 2008 - CA
    Partial re-write to fix a serious memory leak. Holding x,y values in a map
    rather than a circular ntuple.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added SetValue(), replacing the value stored at an existing point.
 
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+
 #include "Framework/Utils/CacheBranchFx.h"
 
 using namespace genie;
@@ -55,12 +59,14 @@ void CacheBranchFx::Init(void)
 {
   fName   = "";
   fSpline = 0;
+  fDirty  = false;
 }
 //____________________________________________________________________________
 void CacheBranchFx::CleanUp(void)
 {
   if(fSpline) delete fSpline;
-  fFx.clear();
+  fX.clear();
+  fY.clear();
 }
 //____________________________________________________________________________
 void CacheBranchFx::Reset(void)
@@ -71,33 +77,53 @@ void CacheBranchFx::Reset(void)
 //____________________________________________________________________________
 void CacheBranchFx::AddValues(double x, double y)
 {
-  fFx.insert(map<double,double>::value_type(x,y));
+  // values are typically added in increasing x
+  if(fX.empty() || x > fX.back()) {
+    fX.push_back(x);
+    fY.push_back(y);
+    fDirty = true;
+    return;
+  }
+  vector<double>::iterator xiter = std::lower_bound(fX.begin(), fX.end(), x);
+  if(*xiter == x) return;
+
+  fY.insert(fY.begin() + (xiter - fX.begin()), y);
+  fX.insert(xiter, x);
+  fDirty = true;
 }
 //____________________________________________________________________________
-void CacheBranchFx::CreateSpline(void)
+void CacheBranchFx::SetValue(double x, double y)
 {
-  int n = fFx.size();
-  double * x = new double[n];
-  double * y = new double[n];
-
-  int i=0;
-  map<double,double>::const_iterator iter = fFx.begin();
-  for( ; iter !=fFx.end(); ++iter) {
-    x[i] = iter->first;
-    y[i] = iter->second;
-    i++;
+  unsigned int i = this->LowerBound(x);
+  if(i < fX.size() && fX[i] == x) {
+    if(fY[i] != y) {
+      fY[i]  = y;
+      fDirty = true;
+    }
+    return;
   }
+  this->AddValues(x, y);
+}
+//____________________________________________________________________________
+unsigned int CacheBranchFx::LowerBound(double x) const
+{
+  return std::lower_bound(fX.begin(), fX.end(), x) - fX.begin();
+}
+//____________________________________________________________________________
+void CacheBranchFx::CreateSpline(void)
+{
+  // nothing added since the spline was last built?
+  if(fSpline && !fDirty) return;
+  if(fX.empty()) return;
 
   if(fSpline) delete fSpline;
-  fSpline = new Spline(n,x,y);
-
-  delete [] x;
-  delete [] y;
+  fSpline = new Spline(fX.size(), &fX[0], &fY[0]);
+  fDirty  = false;
 }
 //____________________________________________________________________________
 void CacheBranchFx::Print(ostream & stream) const
 {
-  stream << "type: [CacheBranchFx]  - nentries: " << fFx.size()
+  stream << "type: [CacheBranchFx]  - nentries: " << fX.size()
            << " / spline: " << ((fSpline) ? "built" : "null");
 }
 //____________________________________________________________________________
@@ -3,7 +3,11 @@
 
 \class    genie::CacheBranchFx
 
-\brief    A simple cache branch storing the cached data in a TNtuple
+\brief    A simple cache branch storing y = f(x) values, with a spline
+          interpolating them.
+          The (x,y) values are kept in contiguous arrays, sorted in x (the
+          first value added for a given x is kept). The spline is rebuilt
+          by CreateSpline() only if values were added since it was built.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -21,14 +25,14 @@
 
 #include <iostream>
 #include <string>
-#include <map>
+#include <vector>
 
 #include "Framework/Numerical/Spline.h"
 #include "Framework/Utils/CacheBranchI.h"
 
 using std::string;
 using std::ostream;
-using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -44,11 +48,19 @@ public:
   CacheBranchFx(string name);
   ~CacheBranchFx();
 
-  const map<double,double> & Map (void) const { return fFx;     }
-  Spline *                   Spl (void) const { return fSpline; }
+  unsigned int           NPoints (void) const { return fX.size(); }
+  const vector<double> & X       (void) const { return fX;        }
+  const vector<double> & Y       (void) const { return fY;        }
+  Spline *               Spl     (void) const { return fSpline;   }
+  bool                   Dirty   (void) const { return fDirty;    }
 
-  void CreateSpline(void);
-  void AddValues(double x, double y);
+  //! index of the first point with x' >= x (NPoints() if none)
+  unsigned int LowerBound (double x) const;
+
+  void CreateSpline (void);
+  void AddValues    (double x, double y);
+  //! as AddValues(), but replacing the y value of an existing x
+  void SetValue     (double x, double y);
 
   void Reset (void);
   void Print (ostream & stream) const;
@@ -60,11 +72,13 @@ private:
   void Init    (void);
   void CleanUp (void);
 
-  string             fName;   ///< cache branch name
-  map<double,double> fFx;     ///< x->y map 
-  Spline *           fSpline; ///< spline y = f(x)
+  string         fName;   ///< cache branch name
+  vector<double> fX;      ///< x values, in increasing order
+  vector<double> fY;      ///< y values, same indexing as fX
+  Spline *       fSpline; ///< spline y = f(x)
+  bool           fDirty;  //! points added since the spline was built?
 
-ClassDef(CacheBranchFx,1)
+ClassDef(CacheBranchFx,2)
 };
 
 }      // genie namespace
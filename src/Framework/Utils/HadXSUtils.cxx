@@ -14,17 +14,68 @@
  Fixed indexing bug in InelasticPionNucleonXSec and TotalPionNucleonXSec
  @ Jul 18, 2013 - Daniel Scully
  Added pion-nucleon cross-sections from C. Berger, provided via D. Cherdack
+ @ Oct 14, 2026 - The GENIE Collaboration
+ Added the fast-path versions of InelasticPionNucleonXSec and
+ TotalPionNucleonXSec for arrays of pion energies.
 */
 //____________________________________________________________________________
 
+#include <cmath>
+#include <cstdlib>
+
 #include <TMath.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
+#include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/HadXSUtils.h"
 
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace {
+  // interpolates the tabulated pion-nucleon cross section sig (uniform in
+  // log10(P), as in the scalar functions) for n pion energies
+  void TableXSec(int n, const double * Epion, double * xsec,
+                 bool isChargedPion, const double * sig, int nsig,
+                 double minlog10p, double dlog10p)
+  {
+    double mpi2 = isChargedPion ? kPionMass2 : kPi0Mass*kPi0Mass;
+    double siglast = sig[nsig-1];
+    for(int i = 0; i < n; i++) {
+      double P2 = Epion[i]*Epion[i] - mpi2;
+      double P  = std::sqrt(P2 > 0 ? P2 : 1E-30);
+      double x  = (std::log10(P) - minlog10p) / dlog10p;
+      double xc = x < 0 ? 0 : (x > nsig-2 ? nsig-2 : x);
+      int    j  = (int) xc;
+      double f  = xc - j;
+      double xs = sig[j] + (sig[j+1]-sig[j]) * f;
+      xs = (x < 0)         ? (P/0.1059)*sig[0] : xs;
+      xs = (j+1 > nsig-2)  ? siglast           : xs;
+      xsec[i] = (P2 > 0)   ? xs * units::mb    : 0.;
+    }
+  }
+  // compare the fast-path values with the scalar functions?
+  bool Validate(void)
+  {
+    static bool validate = (std::getenv("GUTILSTABCHECK") != 0);
+    return validate;
+  }
+  void Check(const char * name, int n, const double * Epion,
+             const double * xsec, bool isChargedPion,
+             double (*xsecf)(double, bool))
+  {
+    for(int i = 0; i < n; i++) {
+      double xs0 = xsecf(Epion[i], isChargedPion);
+      if(TMath::Abs(xsec[i] - xs0) > 1E-9 * TMath::Abs(xs0)) {
+        LOG("HadXS", pWARN)
+          << name << "(Epion = " << Epion[i] << "): fast path: "
+          << xsec[i] << ", scalar: " << xs0;
+      }
+    }
+  }
+}
+
 //____________________________________________________________________________
 double genie::utils::hadxs::InelasticPionNucleonXSec(double Epion,
     bool isChargedPion)
@@ -88,6 +139,30 @@ double genie::utils::hadxs::TotalPionNucleonXSec(double Epion,
   return (xs * units::mb);
 }
 //____________________________________________________________________________
+void genie::utils::hadxs::InelasticPionNucleonXSec(int n,
+    const double * Epion, double * xsec, bool isChargedPion)
+{
+  TableXSec(n, Epion, xsec, isChargedPion,
+            kInelSig, kInelNDataPoints, kInelMinLog10P, kIneldLog10P);
+
+  if(Validate()) {
+    Check("InelasticPionNucleonXSec", n, Epion, xsec, isChargedPion,
+          genie::utils::hadxs::InelasticPionNucleonXSec);
+  }
+}
+//____________________________________________________________________________
+void genie::utils::hadxs::TotalPionNucleonXSec(int n,
+    const double * Epion, double * xsec, bool isChargedPion)
+{
+  TableXSec(n, Epion, xsec, isChargedPion,
+            kTotSig, kTotNDataPoints, kTotMinLog10P, kTotdLog10P);
+
+  if(Validate()) {
+    Check("TotalPionNucleonXSec", n, Epion, xsec, isChargedPion,
+          genie::utils::hadxs::TotalPionNucleonXSec);
+  }
+}
+//____________________________________________________________________________
 double genie::utils::hadxs::berger::InelasticPionNucleonXSec(double Epion, 
     bool isChargedPion)
 {
@@ -69,6 +69,15 @@ namespace hadxs
   double InelasticPionNucleonXSec (double Epion, bool isChargedPion=true);
   double TotalPionNucleonXSec     (double Epion, bool isChargedPion=true);
 
+  // Fast-path versions of the above, for n pion energies at once: the loop
+  // has no data dependent branches (the table bin & the low / high energy
+  // extrapolations are selected arithmetically) and can be vectorized.
+  // Set GUTILSTABCHECK to compare every value with the functions above.
+  void InelasticPionNucleonXSec (int n, const double * Epion, double * xsec,
+                                 bool isChargedPion=true);
+  void TotalPionNucleonXSec     (int n, const double * Epion, double * xsec,
+                                 bool isChargedPion=true);
+
 
   // Pion-Nucleon cross-sections as implemented by C. Berger for re-implementation
   // of the Rein-Sehgal coherent pion production model, and provided to D. Cherdack.
@@ -0,0 +1,165 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+
+#include "Framework/Utils/InitTimingStats.h"
+
+using std::endl;
+using std::setw;
+using std::setfill;
+using std::setprecision;
+
+using namespace genie;
+
+//____________________________________________________________________________
+InitTimingStats * InitTimingStats::fInstance = 0;
+
+// serializes access from multiple threads
+static std::recursive_mutex gInitTimingStatsLock;
+
+// nesting depth of the open scopes of the running thread
+static thread_local int gInitTimingDepth = 0;
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const InitTimingStats & stats)
+  {
+    stats.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+InitTimingStats::InitTimingStats()
+{
+
+}
+//____________________________________________________________________________
+InitTimingStats::~InitTimingStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+InitTimingStats * InitTimingStats::Instance()
+{
+  std::lock_guard<std::recursive_mutex> guard(gInitTimingStatsLock);
+
+  if(fInstance == 0) {
+    static InitTimingStats::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new InitTimingStats;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+double InitTimingStats::Now(void)
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+//____________________________________________________________________________
+InitPhase & InitTimingStats::Find(const string & phase, int depth)
+{
+// The entry of the input phase, created (at the end of the list) if needed
+
+  map<string, unsigned int>::const_iterator it = fIndex.find(phase);
+  if(it == fIndex.end()) {
+    InitPhase entry;
+    entry.name   = phase;
+    entry.depth  = depth;
+    entry.ncalls = 0;
+    entry.total  = 0;
+    it = fIndex.insert(std::make_pair(phase, (unsigned int) fPhases.size())).first;
+    fPhases.push_back(entry);
+  }
+  return fPhases[it->second];
+}
+//____________________________________________________________________________
+void InitTimingStats::Open(const string & phase, int depth)
+{
+  std::lock_guard<std::recursive_mutex> guard(gInitTimingStatsLock);
+  this->Find(phase, depth);
+}
+//____________________________________________________________________________
+void InitTimingStats::Add(const string & phase, int depth, double time)
+{
+  std::lock_guard<std::recursive_mutex> guard(gInitTimingStatsLock);
+
+  InitPhase & entry = this->Find(phase, depth);
+  entry.ncalls++;
+  entry.total += time;
+}
+//____________________________________________________________________________
+vector<InitPhase> InitTimingStats::Phases(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gInitTimingStatsLock);
+  return fPhases;
+}
+//____________________________________________________________________________
+double InitTimingStats::TotalTime(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gInitTimingStatsLock);
+  double t = 0;
+  for(unsigned int i = 0; i < fPhases.size(); i++) {
+    if(fPhases[i].depth == 0) t += fPhases[i].total;
+  }
+  return t;
+}
+//____________________________________________________________________________
+void InitTimingStats::Reset(void)
+{
+  std::lock_guard<std::recursive_mutex> guard(gInitTimingStatsLock);
+  fIndex.clear();
+  fPhases.clear();
+}
+//____________________________________________________________________________
+void InitTimingStats::Print(ostream & stream) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gInitTimingStatsLock);
+
+  // the phases are listed in the order they were first entered, ie each one
+  // ahead of the phases nested in it
+  double ttot = this->TotalTime();
+
+  stream << "Initialization timing: " << ttot << " s in "
+         << fPhases.size() << " phases" << endl;
+
+  for(unsigned int i = 0; i < fPhases.size(); i++) {
+    const InitPhase & entry = fPhases[i];
+    double frac = (ttot > 0) ? 100. * entry.total / ttot : 0.;
+    string name = string(2*entry.depth, ' ') + entry.name;
+    stream << " | " << std::left << setfill(' ') << setw(60) << name
+           << std::right
+           << " | calls: " << setw(6)  << entry.ncalls
+           << " | total: " << setw(12) << entry.total << " s"
+           << " (" << setw(5) << setprecision(3) << frac << "%) |"
+           << setprecision(6) << endl;
+  }
+}
+//____________________________________________________________________________
+InitTimingScope::InitTimingScope(const string & phase) :
+fPhase(phase),
+fDepth(gInitTimingDepth++),
+fStart(0)
+{
+  InitTimingStats::Instance()->Open(fPhase, fDepth);
+  fStart = InitTimingStats::Now();
+}
+//____________________________________________________________________________
+InitTimingScope::~InitTimingScope()
+{
+  gInitTimingDepth--;
+  InitTimingStats::Instance()->Add(fPhase, fDepth, InitTimingStats::Now() - fStart);
+}
+//____________________________________________________________________________
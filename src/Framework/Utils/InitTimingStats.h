@@ -0,0 +1,121 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::InitTimingStats
+
+\brief    Singleton collecting the wall-clock time spent in the phases of the
+          job initialization (configuration parsing, particle data, spline
+          loading, hadron data tables, geometry & flux scans, probability
+          scales, ...), so that the relevant caches can be chosen per site.
+
+          A phase is timed by an InitTimingScope object living over its
+          extent. Scopes may nest: a phase is reported, indented, below the
+          phase it was entered from, with the number of times it was
+          entered and its total time. GMCJDriver::Configure() prints the
+          report at the end of the initialization; the numbers are also
+          available through Phases().
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _INIT_TIMING_STATS_H_
+#define _INIT_TIMING_STATS_H_
+
+#include <map>
+#include <vector>
+#include <string>
+#include <ostream>
+
+using std::map;
+using std::vector;
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class InitTimingStats;
+
+ostream & operator << (ostream & stream, const InitTimingStats & stats);
+
+//! timing of an initialization phase
+struct InitPhase {
+  string   name;
+  int      depth;   ///< nesting depth of its first entry (0: top level)
+  long int ncalls;  ///< number of times it was entered
+  double   total;   ///< total wall-clock time (sec)
+};
+
+class InitTimingStats
+{
+public:
+  static InitTimingStats * Instance(void);
+
+  //! a monotonic wall-clock time (sec)
+  static double Now (void);
+
+  //! declare a phase entered at the given depth (fixes its report position)
+  void Open (const string & phase, int depth);
+  //! record the time (in sec) spent in a phase
+  void Add  (const string & phase, int depth, double time);
+
+  //! the phases in the order they were first entered
+  vector<InitPhase> Phases    (void) const;
+  //! time spent in the top level phases
+  double            TotalTime (void) const;
+
+  void Reset (void);
+  void Print (ostream & stream) const;
+
+  friend ostream & operator << (ostream & stream, const InitTimingStats & stats);
+
+private:
+  InitTimingStats();
+  InitTimingStats(const InitTimingStats & stats);
+  virtual ~InitTimingStats();
+
+  InitPhase & Find (const string & phase, int depth);
+
+  //! self
+  static InitTimingStats * fInstance;
+
+  map<string, unsigned int> fIndex;   ///< phase name -> position in fPhases
+  vector<InitPhase>         fPhases;
+
+  //! clean
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (InitTimingStats::fInstance !=0) {
+            delete InitTimingStats::fInstance;
+            InitTimingStats::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+//! Times the initialization phase it lives over (see InitTimingStats)
+class InitTimingScope
+{
+public:
+  InitTimingScope(const string & phase);
+ ~InitTimingScope();
+
+private:
+  InitTimingScope(const InitTimingScope & scope);
+
+  string fPhase;
+  int    fDepth;
+  double fStart;
+};
+
+}      // genie namespace
+
+#endif // _INIT_TIMING_STATS_H_
@@ -153,12 +153,18 @@ double genie::utils::kinematics::Jacobian(
   bool forward;
   const Kinematics & kine = i->Kine();
 
+  // the formulas are those of the compile time kernels (see KineUtils.h),
+  // fed with the variables each of them uses
+  KineConsts kc;
+  KinePoint  kp;
+
   //
   // transformation: {Q2}|E -> {lnQ2}|E
   //
   if ( TransformMatched(fromps,tops,kPSQ2fE,kPSlogQ2fE,forward) )
   {
-    J = 1. / kine.Q2();
+    kp.Q2 = kine.Q2();
+    J = Jacobian<kPSQ2fE,kPSlogQ2fE>(kc,kp);
   }
 
   //
@@ -167,7 +173,8 @@ double genie::utils::kinematics::Jacobian(
   else
   if ( TransformMatched(fromps,tops,kPSQD2fE,kPSQ2fE,forward) )
   {
-    J = TMath::Power(1+kine.Q2()/controls::kMQD2,-2)/controls::kMQD2;
+    kp.Q2 = kine.Q2();
+    J = Jacobian<kPSQD2fE,kPSQ2fE>(kc,kp);
   }
 
   //
@@ -176,7 +183,9 @@ double genie::utils::kinematics::Jacobian(
   else
   if ( TransformMatched(fromps,tops,kPSxyfE,kPSlogxlogyfE,forward) )
   {
-    J = 1. / (kine.x() * kine.y());
+    kp.x = kine.x();
+    kp.y = kine.y();
+    J = Jacobian<kPSxyfE,kPSlogxlogyfE>(kc,kp);
   }
 
   //
@@ -185,7 +194,9 @@ double genie::utils::kinematics::Jacobian(
   else
   if ( TransformMatched(fromps,tops,kPSQ2yfE,kPSlogQ2logyfE,forward) )
   {
-    J = 1. / (kine.Q2() * kine.y());
+    kp.Q2 = kine.Q2();
+    kp.y  = kine.y();
+    J = Jacobian<kPSQ2yfE,kPSlogQ2logyfE>(kc,kp);
   }
 
   //
@@ -195,10 +206,10 @@ double genie::utils::kinematics::Jacobian(
   if ( TransformMatched(fromps,tops,kPSQ2yfE,kPSxyfE,forward) )
   {
     const InitialState & init_state = i->InitState();
-    double Ev = init_state.ProbeE(kRfHitNucRest);
-    double M  = init_state.Tgt().HitNucP4Ptr()->M();
-    double y  = kine.y();
-    J = 2*y*Ev*M;
+    SetKineConsts(init_state.ProbeE(kRfHitNucRest),
+                  init_state.Tgt().HitNucP4Ptr()->M(), 0., kc);
+    kp.y = kine.y();
+    J = Jacobian<kPSQ2yfE,kPSxyfE>(kc,kp);
   }
 
   //
@@ -206,7 +217,8 @@ double genie::utils::kinematics::Jacobian(
   //
   else if ( TransformMatched(fromps,tops,kPSWQ2fE,kPSWlogQ2fE,forward) )
   {
-    J = 1. / kine.Q2();
+    kp.Q2 = kine.Q2();
+    J = Jacobian<kPSWQ2fE,kPSWlogQ2fE>(kc,kp);
   }
 
   //
@@ -215,7 +227,8 @@ double genie::utils::kinematics::Jacobian(
   else
   if ( TransformMatched(fromps,tops,kPSWQD2fE,kPSWQ2fE,forward) )
   {
-    J = TMath::Power(1+kine.Q2()/controls::kMQD2,-2)/controls::kMQD2;
+    kp.Q2 = kine.Q2();
+    J = Jacobian<kPSWQD2fE,kPSWQ2fE>(kc,kp);
   }
 
   //
@@ -225,10 +238,10 @@ double genie::utils::kinematics::Jacobian(
   if ( TransformMatched(fromps,tops,kPSW2Q2fE,kPSxyfE,forward) )
   {
     const InitialState & init_state = i->InitState();
-    double Ev = init_state.ProbeE(kRfHitNucRest);
-    double M  = init_state.Tgt().HitNucP4Ptr()->M();
-    double y  = kine.y();
-    J = TMath::Power(2*M*Ev,2) * y;
+    SetKineConsts(init_state.ProbeE(kRfHitNucRest),
+                  init_state.Tgt().HitNucP4Ptr()->M(), 0., kc);
+    kp.y = kine.y();
+    J = Jacobian<kPSW2Q2fE,kPSxyfE>(kc,kp);
   }
 
   //
@@ -238,17 +251,17 @@ double genie::utils::kinematics::Jacobian(
   if ( TransformMatched(fromps,tops,kPSWQ2fE,kPSxyfE,forward) )
   {
     const InitialState & init_state = i->InitState();
-    double Ev = init_state.ProbeE(kRfHitNucRest);
-    double M  = init_state.Tgt().HitNucP4Ptr()->M();
-    double y  = kine.y();
-    double W  = kine.W();
-    J = 2*TMath::Power(M*Ev,2) * y/W;
+    SetKineConsts(init_state.ProbeE(kRfHitNucRest),
+                  init_state.Tgt().HitNucP4Ptr()->M(), 0., kc);
+    kp.y = kine.y();
+    kp.W = kine.W();
+    J = Jacobian<kPSWQ2fE,kPSxyfE>(kc,kp);
   }
 
   // Transformation: {Omegalep,Omegapi}|E -> {Omegalep,Thetapi}|E
   else if ( TransformMatched(fromps,tops,kPSElOlOpifE,kPSElOlTpifE,forward) ) {
     // Use symmetry to turn 4d integral into 3d * 2pi
-    J = 2*constants::kPi;
+    J = Jacobian<kPSElOlOpifE,kPSElOlTpifE>(kc,kp);
   }
 
   // Transformation: centre-of-mass plep,Omega_lep, p_p, omega_p|E
@@ -262,10 +275,10 @@ double genie::utils::kinematics::Jacobian(
 
     // Get beta for a Lorentz boost from the lab frame to the COM frame and
     // vice-versa
-    TLorentzVector* probe = i->InitStatePtr()->GetProbeP4(kRfLab);
+    const TLorentzVector& probe = i->InitStatePtr()->ProbeP4();
     const TLorentzVector& target = i->InitStatePtr()->TgtPtr()
       ->HitNucP4();
-    TLorentzVector total_p4 = (*probe) + target;
+    TLorentzVector total_p4 = probe + target;
     TVector3 beta_COM_to_lab = total_p4.BoostVector();
     TVector3 beta_lab_to_COM = -beta_COM_to_lab;
 
@@ -867,7 +880,7 @@ double genie::utils::kinematics::W(const Interaction * const interaction)
   if(process_info.IsQuasiElastic()) {
     // hadronic inv. mass is equal to the recoil nucleon on-shell mass
     int rpdgc = interaction->RecoilNucleonPdg();
-    double M = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+    double M = PDGLibrary::Instance()->Mass(rpdgc);
     return M;
   }
 
@@ -1066,6 +1079,62 @@ void genie::utils::kinematics::UpdateXYFromWQ2(const Interaction * in)
   }
 }
 //___________________________________________________________________________
+void genie::utils::kinematics::UpdateWQ2FromXY(
+                          const KineConsts & kc, const Interaction * in)
+{
+// As UpdateWQ2FromXY(in), with the probe energy and hit nucleon mass of kc
+
+  Kinematics * kine = in->KinePtr();
+
+  if(kine->KVSet(kKVx) && kine->KVSet(kKVy)) {
+    double Q2=-1,W=-1;
+    kinematics::XYtoWQ2(kc,W,Q2,kine->x(),kine->y());
+    kine->SetQ2(Q2);
+    kine->SetW(W);
+  }
+}
+//___________________________________________________________________________
+void genie::utils::kinematics::UpdateXYFromWQ2(
+                          const KineConsts & kc, const Interaction * in)
+{
+// As UpdateXYFromWQ2(in), with the probe energy and hit nucleon mass of kc
+
+  Kinematics * kine = in->KinePtr();
+
+  if(kine->KVSet(kKVW) && kine->KVSet(kKVQ2)) {
+    double x=-1,y=-1;
+    kinematics::WQ2toXY(kc,kine->W(),kine->Q2(),x,y);
+    kine->Setx(x);
+    kine->Sety(y);
+  }
+}
+//___________________________________________________________________________
+void genie::utils::kinematics::SetKineConsts(
+                          const Interaction * in, KineConsts & kc)
+{
+// Fills kc for the current initial state: the probe energy at the hit nucleon
+// rest frame and the hit nucleon mass (can be off the mass shell), as used by
+// UpdateWQ2FromXY(), UpdateXYFromWQ2() and Jacobian()
+
+  const InitialState & init_state = in->InitState();
+  TParticlePDG * fsl = in->FSPrimLepton();
+
+  SetKineConsts(init_state.ProbeE(kRfHitNucRest),
+                init_state.Tgt().HitNucP4Ptr()->M(),
+                (fsl) ? fsl->Mass() : 0., kc);
+}
+//___________________________________________________________________________
+void genie::utils::kinematics::SetKineConsts(
+                          double Ev, double M, double ml, KineConsts & kc)
+{
+  kc.Ev  = Ev;
+  kc.M   = M;
+  kc.M2  = M*M;
+  kc.ml  = ml;
+  kc.ml2 = ml*ml;
+  kc.MEv = M*Ev;
+}
+//___________________________________________________________________________
 void genie::utils::kinematics::UpdateXFromQ2Y(const Interaction * in)
 {
   Kinematics * kine = in->KinePtr();
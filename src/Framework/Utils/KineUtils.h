@@ -11,6 +11,13 @@
             Changes required to implement the GENIE Boosted Dark Matter module
             were installed by Josh Berger (Univ. of Wisconsin)
 
+            The inline kernels at the end take the probe energy and masses in
+            a KineConsts struct, filled once per interaction (eg when an
+            integrand is built), and the Jacobians select the phase space
+            pair at compile time: integrands evaluated many times for a fixed
+            initial state skip the frame boosts, mass look-ups and the run
+            time dispatch of the Interaction-based functions.
+
 \created    November 26, 2004
 
 \cpright    Copyright (c) 2003-2018, The GENIE Collaboration
@@ -22,7 +29,11 @@
 #ifndef _KINE_UTILS_H_
 #define _KINE_UTILS_H_
 
+#include <algorithm>
+#include <cmath>
+
 #include "Framework/Conventions/KineVar.h"
+#include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Framework/Interaction/Interaction.h"
@@ -98,6 +109,127 @@ namespace kinematics
   double DISImportanceSamplingEnvelope(double * x, double * par);
   double COHImportanceSamplingEnvelope(double * x, double * par);
 
+  //-- fast kernels for a fixed initial state
+
+  //! Probe energy and masses used by the kinematical transforms
+  struct KineConsts {
+    double Ev;   ///< probe energy at the hit nucleon rest frame
+    double M;    ///< hit nucleon mass (can be off the mass shell)
+    double M2;
+    double ml;   ///< final state primary lepton mass (0 if there is none)
+    double ml2;
+    double MEv;  ///< M*Ev
+  };
+  //! A kinematical point (only the variables used by a kernel need be set)
+  struct KinePoint {
+    double x;
+    double y;
+    double Q2;
+    double W;
+  };
+
+  void SetKineConsts (const Interaction * in, KineConsts & kc);
+  void SetKineConsts (double Ev, double M, double ml, KineConsts & kc);
+
+  void UpdateWQ2FromXY (const KineConsts & kc, const Interaction * in);
+  void UpdateXYFromWQ2 (const KineConsts & kc, const Interaction * in);
+
+  inline void XYtoWQ2 (const KineConsts & kc, double & W, double & Q2, double x, double y)
+  {
+    W  = std::sqrt(std::max(0., kc.M2 + 2*kc.MEv*y*(1-x)));
+    Q2 = 2*x*y*kc.MEv;
+  }
+  inline void WQ2toXY (const KineConsts & kc, double W, double Q2, double & x, double & y)
+  {
+    double d = W*W - kc.M2 + Q2;
+    x = std::min(1., std::max(0., Q2 / d));
+    y = std::min(1., std::max(0., d / (2*kc.MEv)));
+  }
+  inline double XYtoQ2 (const KineConsts & kc, double x, double y) { return 2*x*y*kc.MEv;     }
+  inline double Q2YtoX (const KineConsts & kc, double Q2, double y) { return Q2/(2*y*kc.MEv); }
+
+  //! The Jacobian of the transformation fromps -> tops (same convention as
+  //! Jacobian(const Interaction *, ...)). Only the transformations between
+  //! the variables of a KinePoint have a kernel: any other pair fails to
+  //! compile.
+  template <KinePhaseSpace_t fromps, KinePhaseSpace_t tops>
+  struct JacobianKernel;
+
+  template <KinePhaseSpace_t fromps, KinePhaseSpace_t tops>
+  struct InverseJacobianKernel {
+    static double Value(const KineConsts & kc, const KinePoint & kp)
+    { return 1. / JacobianKernel<tops,fromps>::Value(kc,kp); }
+  };
+
+  template <KinePhaseSpace_t fromps, KinePhaseSpace_t tops>
+  inline double Jacobian (const KineConsts & kc, const KinePoint & kp)
+  {
+    return JacobianKernel<fromps,tops>::Value(kc,kp);
+  }
+
+  // {Q2}|E -> {lnQ2}|E
+  template <> struct JacobianKernel<kPSQ2fE, kPSlogQ2fE> {
+    static double Value(const KineConsts &, const KinePoint & kp)
+    { return 1. / kp.Q2; }
+  };
+  // {QD2}|E -> {Q2}|E
+  template <> struct JacobianKernel<kPSQD2fE, kPSQ2fE> {
+    static double Value(const KineConsts &, const KinePoint & kp)
+    { double t = 1 + kp.Q2/controls::kMQD2; return 1. / (t*t*controls::kMQD2); }
+  };
+  // {x,y}|E -> {lnx,lny}|E
+  template <> struct JacobianKernel<kPSxyfE, kPSlogxlogyfE> {
+    static double Value(const KineConsts &, const KinePoint & kp)
+    { return 1. / (kp.x * kp.y); }
+  };
+  // {Q2,y}|E -> {lnQ2,lny}|E
+  template <> struct JacobianKernel<kPSQ2yfE, kPSlogQ2logyfE> {
+    static double Value(const KineConsts &, const KinePoint & kp)
+    { return 1. / (kp.Q2 * kp.y); }
+  };
+  // {Q2,y}|E -> {x,y}|E
+  template <> struct JacobianKernel<kPSQ2yfE, kPSxyfE> {
+    static double Value(const KineConsts & kc, const KinePoint & kp)
+    { return 2*kp.y*kc.MEv; }
+  };
+  // {W,Q2}|E -> {W,lnQ2}|E
+  template <> struct JacobianKernel<kPSWQ2fE, kPSWlogQ2fE> {
+    static double Value(const KineConsts &, const KinePoint & kp)
+    { return 1. / kp.Q2; }
+  };
+  // {W,QD2}|E -> {W,Q2}|E
+  template <> struct JacobianKernel<kPSWQD2fE, kPSWQ2fE> {
+    static double Value(const KineConsts &, const KinePoint & kp)
+    { double t = 1 + kp.Q2/controls::kMQD2; return 1. / (t*t*controls::kMQD2); }
+  };
+  // {W2,Q2}|E -> {x,y}|E
+  template <> struct JacobianKernel<kPSW2Q2fE, kPSxyfE> {
+    static double Value(const KineConsts & kc, const KinePoint & kp)
+    { return 4*kc.MEv*kc.MEv * kp.y; }
+  };
+  // {W,Q2}|E -> {x,y}|E
+  template <> struct JacobianKernel<kPSWQ2fE, kPSxyfE> {
+    static double Value(const KineConsts & kc, const KinePoint & kp)
+    { return 2*kc.MEv*kc.MEv * kp.y / kp.W; }
+  };
+  // {Omegalep,Omegapi}|E -> {Omegalep,Thetapi}|E
+  template <> struct JacobianKernel<kPSElOlOpifE, kPSElOlTpifE> {
+    static double Value(const KineConsts &, const KinePoint &)
+    { return 2*constants::kPi; }
+  };
+
+  // the reverse transformations
+  template <> struct JacobianKernel<kPSlogQ2fE,     kPSQ2fE  > : InverseJacobianKernel<kPSlogQ2fE,     kPSQ2fE  > { };
+  template <> struct JacobianKernel<kPSQ2fE,        kPSQD2fE > : InverseJacobianKernel<kPSQ2fE,        kPSQD2fE > { };
+  template <> struct JacobianKernel<kPSlogxlogyfE,  kPSxyfE  > : InverseJacobianKernel<kPSlogxlogyfE,  kPSxyfE  > { };
+  template <> struct JacobianKernel<kPSlogQ2logyfE, kPSQ2yfE > : InverseJacobianKernel<kPSlogQ2logyfE, kPSQ2yfE > { };
+  template <> struct JacobianKernel<kPSxyfE,        kPSQ2yfE > : InverseJacobianKernel<kPSxyfE,        kPSQ2yfE > { };
+  template <> struct JacobianKernel<kPSWlogQ2fE,    kPSWQ2fE > : InverseJacobianKernel<kPSWlogQ2fE,    kPSWQ2fE > { };
+  template <> struct JacobianKernel<kPSWQ2fE,       kPSWQD2fE> : InverseJacobianKernel<kPSWQ2fE,       kPSWQD2fE> { };
+  template <> struct JacobianKernel<kPSxyfE,        kPSW2Q2fE> : InverseJacobianKernel<kPSxyfE,        kPSW2Q2fE> { };
+  template <> struct JacobianKernel<kPSxyfE,        kPSWQ2fE > : InverseJacobianKernel<kPSxyfE,        kPSWQ2fE > { };
+  template <> struct JacobianKernel<kPSElOlTpifE,   kPSElOlOpifE> : InverseJacobianKernel<kPSElOlTpifE, kPSElOlOpifE> { };
+
 } // kinematics namespace
 } // utils namespace
 } // genie namespace
@@ -28,6 +28,8 @@
 #pragma link C++ class genie::CacheBranchFx;
 #pragma link C++ class genie::CmdLnArgParser;
 #pragma link C++ class genie::XSecSplineList;
+#pragma link C++ class genie::InitTimingStats;
+#pragma link C++ class genie::MemoryStats;
 #pragma link C++ class genie::Range1D_t;
 #pragma link C++ class genie::Range1F_t;
 #pragma link C++ class genie::Range1I_t;
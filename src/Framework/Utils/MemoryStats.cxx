@@ -0,0 +1,187 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <iomanip>
+#include <mutex>
+
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include "Framework/Utils/MemoryStats.h"
+
+using std::endl;
+using std::setw;
+using std::setfill;
+using std::setprecision;
+
+using namespace genie;
+
+//____________________________________________________________________________
+MemoryStats * MemoryStats::fInstance = 0;
+
+// serializes access from multiple threads
+static std::recursive_mutex gMemoryStatsLock;
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const MemoryStats & stats)
+  {
+    stats.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+MemoryStats::MemoryStats()
+{
+
+}
+//____________________________________________________________________________
+MemoryStats::~MemoryStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+MemoryStats * MemoryStats::Instance()
+{
+  std::lock_guard<std::recursive_mutex> guard(gMemoryStatsLock);
+
+  if(fInstance == 0) {
+    static MemoryStats::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new MemoryStats;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+double MemoryStats::ResidentBytes(void)
+{
+  FILE * statm = fopen("/proc/self/statm", "r");
+  if(!statm) return 0;
+  long int size = 0, resident = 0;
+  int nread = fscanf(statm, "%ld %ld", &size, &resident);
+  fclose(statm);
+  if(nread != 2) return 0;
+  return double(resident) * sysconf(_SC_PAGESIZE);
+}
+//____________________________________________________________________________
+double MemoryStats::PeakResidentBytes(void)
+{
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+  return double(usage.ru_maxrss);         // bytes
+#else
+  return double(usage.ru_maxrss) * 1024.; // kB
+#endif
+}
+//____________________________________________________________________________
+void MemoryStats::Register(const string & component, MemoryReporter reporter)
+{
+  std::lock_guard<std::recursive_mutex> guard(gMemoryStatsLock);
+
+  if(fReporters.find(component) == fReporters.end()) {
+    fComponents.push_back(component);
+  }
+  fReporters[component] = reporter;
+}
+//____________________________________________________________________________
+void MemoryStats::Add(
+     const string & component, const string & category,
+     double bytes, long int count)
+{
+  std::lock_guard<std::recursive_mutex> guard(gMemoryStatsLock);
+
+  string key = component + "/" + category;
+  map<string, unsigned int>::const_iterator it = fIndex.find(key);
+  if(it == fIndex.end()) {
+    MemoryUsage entry;
+    entry.component = component;
+    entry.category  = category;
+    entry.count     = 0;
+    entry.bytes     = 0;
+    it = fIndex.insert(std::make_pair(key, (unsigned int) fUsage.size())).first;
+    fUsage.push_back(entry);
+  }
+  fUsage[it->second].count += count;
+  fUsage[it->second].bytes += bytes;
+}
+//____________________________________________________________________________
+void MemoryStats::Poll(void)
+{
+  std::lock_guard<std::recursive_mutex> guard(gMemoryStatsLock);
+
+  fIndex.clear();
+  fUsage.clear();
+  for(unsigned int i = 0; i < fComponents.size(); i++) {
+    MemoryReporter reporter = fReporters[fComponents[i]];
+    if(reporter) reporter(*this);
+  }
+}
+//____________________________________________________________________________
+vector<MemoryUsage> MemoryStats::Usage(void) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gMemoryStatsLock);
+  return fUsage;
+}
+//____________________________________________________________________________
+double MemoryStats::TotalBytes(const string & component) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gMemoryStatsLock);
+  double bytes = 0;
+  for(unsigned int i = 0; i < fUsage.size(); i++) {
+    if(component.size() == 0 || fUsage[i].component == component) {
+      bytes += fUsage[i].bytes;
+    }
+  }
+  return bytes;
+}
+//____________________________________________________________________________
+void MemoryStats::Print(ostream & stream) const
+{
+  std::lock_guard<std::recursive_mutex> guard(gMemoryStatsLock);
+
+  const double MB = 1024. * 1024.;
+
+  double total = this->TotalBytes();
+  double rss   = MemoryStats::ResidentBytes();
+  double peak  = MemoryStats::PeakResidentBytes();
+
+  stream << "Memory footprint: " << setprecision(4) << total/MB
+         << " MB accounted for, resident size: " << rss/MB
+         << " MB (peak: " << peak/MB << " MB)" << endl;
+
+  // the categories of each component follow the component total, with the
+  // components in registration order
+  for(unsigned int ic = 0; ic < fComponents.size(); ic++) {
+    const string & component = fComponents[ic];
+    double ctotal = this->TotalBytes(component);
+    double frac = (rss > 0) ? 100. * ctotal / rss : 0.;
+    stream << " | " << std::left << setfill(' ') << setw(48) << component
+           << std::right
+           << " | " << setw(8) << ""
+           << " | " << setw(10) << setprecision(4) << ctotal/MB << " MB"
+           << " (" << setw(5) << setprecision(3) << frac << "% of RSS) |"
+           << endl;
+    for(unsigned int i = 0; i < fUsage.size(); i++) {
+      const MemoryUsage & entry = fUsage[i];
+      if(entry.component != component) continue;
+      stream << " | " << std::left << setw(48) << ("  " + entry.category)
+             << std::right
+             << " | " << setw(8) << entry.count
+             << " | " << setw(10) << setprecision(4) << entry.bytes/MB << " MB"
+             << setw(17) << " |" << endl;
+    }
+  }
+  stream << setprecision(6);
+}
+//____________________________________________________________________________
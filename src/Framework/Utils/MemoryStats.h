@@ -0,0 +1,119 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::MemoryStats
+
+\brief    Singleton collecting the memory footprint of the GENIE singletons
+          and physics tables (cross section splines, hadron data tables,
+          hadron tensors, cache branches, configuration registries, ...),
+          broken down by category, so that the components responsible for
+          the resident size of a job can be identified.
+
+          Each singleton registers a reporter function when it is created.
+          Poll() calls all the registered reporters, which Add() the bytes
+          held by their singleton, per category; memory mapped from files or
+          shared memory is reported in categories of its own, as it does not
+          all count against the resident size. The numbers are estimates of
+          the allocated payload (container capacities, object sizes), not
+          of the allocator overheads.
+
+          With the --memory-report option (see RunOpt), GMCJDriver prints the
+          breakdown at the end of its configuration and the event generation
+          applications at the end of the job.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _MEMORY_STATS_H_
+#define _MEMORY_STATS_H_
+
+#include <map>
+#include <vector>
+#include <string>
+#include <ostream>
+
+using std::map;
+using std::vector;
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class MemoryStats;
+
+ostream & operator << (ostream & stream, const MemoryStats & stats);
+
+//! memory held by a component in a category
+struct MemoryUsage {
+  string   component;
+  string   category;
+  long int count;     ///< number of objects (tables, splines, ...)
+  double   bytes;
+};
+
+//! adds the memory held by a component to the input stats (see Add())
+typedef void (*MemoryReporter)(MemoryStats & stats);
+
+class MemoryStats
+{
+public:
+  static MemoryStats * Instance(void);
+
+  //! the resident size of the process and its peak (bytes, 0 if unknown)
+  static double ResidentBytes     (void);
+  static double PeakResidentBytes (void);
+
+  //! register the reporter of a component (called by the singletons)
+  void Register (const string & component, MemoryReporter reporter);
+  //! add bytes held by a component in a category (called by the reporters)
+  void Add      (const string & component, const string & category,
+                 double bytes, long int count = 1);
+
+  //! re-collect the usage from all the registered reporters
+  void Poll (void);
+
+  //! the usage collected by the last Poll(), in the order it was added
+  vector<MemoryUsage> Usage      (void) const;
+  //! the bytes held by a component (all components if empty)
+  double              TotalBytes (const string & component = "") const;
+
+  void Print (ostream & stream) const;
+
+  friend ostream & operator << (ostream & stream, const MemoryStats & stats);
+
+private:
+  MemoryStats();
+  MemoryStats(const MemoryStats & stats);
+  virtual ~MemoryStats();
+
+  //! self
+  static MemoryStats * fInstance;
+
+  map<string, MemoryReporter> fReporters;  ///< component -> reporter
+  vector<string>              fComponents; ///< components in registration order
+  map<string, unsigned int>   fIndex;      ///< component/category -> position in fUsage
+  vector<MemoryUsage>         fUsage;
+
+  //! clean
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (MemoryStats::fInstance !=0) {
+            delete MemoryStats::fInstance;
+            MemoryStats::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _MEMORY_STATS_H_
@@ -0,0 +1,129 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+
+#include <TLorentzVector.h>
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/PhaseSpaceDecayer.h"
+
+using namespace genie;
+
+const double PhaseSpaceDecayer::kMaxWtBinWidth = 0.01;
+const double PhaseSpaceDecayer::kBoostBinWidth = 0.05;
+
+//____________________________________________________________________________
+PhaseSpaceDecayer::PhaseSpaceDecayer() :
+fMassSum(0),
+fCurMaxWt(0)
+{
+
+}
+//____________________________________________________________________________
+PhaseSpaceDecayer::~PhaseSpaceDecayer()
+{
+
+}
+//____________________________________________________________________________
+bool PhaseSpaceDecayer::SetDecay(
+              const TLorentzVector & p4, const std::vector<int> & pdgv,
+              bool frame_dependent)
+{
+  fCurMaxWt = 0;
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
+  int n = pdgv.size();
+  fMass.resize(n);
+  fMassSum = 0;
+  for(int i = 0; i < n; i++) {
+    fMass[i]  = pdglib->Mass(pdgv[i]);
+    fMassSum += fMass[i];
+  }
+
+  bool permitted = fGenerator.SetDecay(
+      const_cast<TLorentzVector &>(p4), n, &fMass[0]);
+  if(!permitted) return false;
+
+  // cache key: the ordered decay products and the (logarithmic) bin of the
+  // kinetic energy made available to them, plus the bins of the transverse
+  // and longitudinal momentum over mass of the decaying system if the
+  // weight is frame dependent (azimuthal rotations are taken as symmetries)
+  double M = p4.M();
+  double T = M - fMassSum;
+  fKey.first = pdgv;
+  fKey.second.resize(frame_dependent ? 3 : 1);
+  fKey.second[0] = (T > 0) ?
+    (int) TMath::Floor(std::log(T) / std::log(1 + kMaxWtBinWidth)) : 0;
+  if(frame_dependent) {
+    fKey.second[1] = (int) TMath::Floor(p4.Pt() / M / kBoostBinWidth);
+    fKey.second[2] = (int) TMath::Floor(p4.Pz() / M / kBoostBinWidth);
+  }
+
+  return true;
+}
+//____________________________________________________________________________
+double PhaseSpaceDecayer::MaxWeight(int ntrials)
+{
+  double wmax = -1;
+  if(this->CachedMaxWeight(wmax)) return wmax;
+
+  {
+    ProcessGeneratorLock lock;
+    for(int k = 0; k < ntrials; k++) {
+      wmax = TMath::Max(wmax, fGenerator.Generate());
+    }
+  }
+  this->SetMaxWeight(wmax);
+
+  return wmax;
+}
+//____________________________________________________________________________
+double PhaseSpaceDecayer::Generate(void)
+{
+  ProcessGeneratorLock lock;
+  return fGenerator.Generate();
+}
+//____________________________________________________________________________
+bool PhaseSpaceDecayer::CachedMaxWeight(double & wmax)
+{
+  if(!fCurMaxWt) {
+    std::map<MaxWtKey_t, double>::iterator it = fMaxWt.find(fKey);
+    if(it == fMaxWt.end()) return false;
+    fCurMaxWt = &(it->second);
+  }
+  wmax = *fCurMaxWt;
+  return true;
+}
+//____________________________________________________________________________
+void PhaseSpaceDecayer::SetMaxWeight(double wmax)
+{
+  if(fMaxWt.size() >= kMaxCacheSize) {
+    LOG("PhSpDecayer", pINFO)
+      << "Clearing the cache of " << fMaxWt.size() << " max decay weights";
+    fMaxWt.clear();
+  }
+  double & cached = fMaxWt[fKey];
+  cached    = wmax;
+  fCurMaxWt = &cached;
+}
+//____________________________________________________________________________
+void PhaseSpaceDecayer::UpdateMaxWeight(double w)
+{
+  if(fCurMaxWt && w > *fCurMaxWt) *fCurMaxWt = w;
+}
+//____________________________________________________________________________
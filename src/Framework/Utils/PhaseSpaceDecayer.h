@@ -0,0 +1,103 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::PhaseSpaceDecayer
+
+\brief    A TGenPhaseSpace wrapper for the rejection sampling of (unweighted)
+          phase space decays.
+
+          The decay product masses are kept in a buffer reused from decay to
+          decay. The maximum decay weight, which the users of TGenPhaseSpace
+          used to estimate from a few hundred trial decays at each call, is
+          estimated once per final state (the ordered list of decay products)
+          and bin of the kinetic energy available to the decay products, and
+          then cached. The TGenPhaseSpace weight is Lorentz invariant, so the
+          cache does not depend on the momentum of the decaying system.
+          The kinetic energy bins have a relative width of kMaxWtBinWidth.
+          Users multiplying the TGenPhaseSpace weight by a frame dependent
+          factor set the decay as frame dependent: its max weight is then
+          also binned in the transverse and longitudinal components of the
+          decaying system momentum over its mass (bins of kBoostBinWidth),
+          is estimated by the user and stored with SetMaxWeight().
+          A weight above the cached maximum, seen while sampling, should be
+          passed to UpdateMaxWeight() to raise the cached value.
+
+          The cached maxima save the trial decays, but change the numbers
+          drawn from gRandom (used by TGenPhaseSpace) from event to event.
+          The decays are generated under the ProcessGeneratorLock.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _PHASE_SPACE_DECAYER_H_
+#define _PHASE_SPACE_DECAYER_H_
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <TGenPhaseSpace.h>
+
+class TLorentzVector;
+
+namespace genie {
+
+class PhaseSpaceDecayer {
+
+public:
+  PhaseSpaceDecayer();
+ ~PhaseSpaceDecayer();
+
+  //! Set the decay of the system with 4-momentum p4 to the particles pdgv
+  //! (at their PDGLibrary masses); false if it is not permitted.
+  //! The max weight of a frame dependent decay is cached per p4 direction bin.
+  bool   SetDecay        (const TLorentzVector & p4, const std::vector<int> & pdgv,
+                          bool frame_dependent = false);
+
+  //! Maximum weight of the current decay: looked up in the cache or, the
+  //! first time its final state and kinetic energy bin are seen, estimated
+  //! from ntrials trial decays
+  double MaxWeight       (int ntrials = 200);
+  //! Cached maximum weight of the current decay, if any (no trial decays)
+  bool   CachedMaxWeight (double & wmax);
+  //! Cache wmax as the maximum weight of the current decay
+  void   SetMaxWeight    (double wmax);
+  //! Raise the cached maximum weight of the current decay to w, if it is above
+  void   UpdateMaxWeight (double w);
+  void   ClearCache      (void) { fMaxWt.clear(); fCurMaxWt = 0; }
+
+  double           Generate (void);
+  TLorentzVector * GetDecay (int i)       { return fGenerator.GetDecay(i); }
+  int              NDecay   (void) const  { return fMass.size(); }
+  double           Mass     (int i) const { return fMass[i];     }
+  double           MassSum  (void) const  { return fMassSum;     }
+
+  static const double kMaxWtBinWidth;
+  static const double kBoostBinWidth;
+
+private:
+  PhaseSpaceDecayer(const PhaseSpaceDecayer & decayer);
+
+  // decay products & (kinetic energy bin [, boost bins])
+  typedef std::pair<std::vector<int>, std::vector<int> > MaxWtKey_t;
+
+  static const unsigned int kMaxCacheSize = 4096;
+
+  TGenPhaseSpace        fGenerator;
+  std::vector<double>   fMass;      ///< decay product masses
+  double                fMassSum;
+  MaxWtKey_t            fKey;       ///< cache key of the current decay
+  double *              fCurMaxWt;  ///< cached max weight of the current decay (null if not yet estimated)
+  std::map<MaxWtKey_t, double> fMaxWt; ///< max weight per final state and kinetic energy bin
+};
+
+}      // genie namespace
+
+#endif // _PHASE_SPACE_DECAYER_H_
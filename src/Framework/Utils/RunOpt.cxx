@@ -12,12 +12,31 @@
  Important revisions after version 2.0.0 :
  @ Jan 29, 2013 - CA
    Added in preparartion for v2.8.0, when use of env. vars was phased out.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the --output-compression, --output-basket-size, --output-auto-flush
+   and --output-split-level options, used by NtpWriter.
+   Added the --output-stream, --output-stream-format and --output-stream-only
+   options, used by NtpWriter to stream the events (see NtpStreamWriter).
+   Added the --shard i/N option for splitting a production in N jobs.
+  Added the --checkpoint-interval and --restart options, for checkpointing
+  and restarting long MC jobs (see NtpWriter).
+  Added the --memory-report option (see MemoryStats).
+  Added the --async-output and --flux-read-ahead options, used by the MC
+  jobs run through NtpMCJob.
+  Added the --stop-after option, truncating the event generation chains
+  (see EventGenerator).
+  Added the --path-length-cache option (see GMCJDriver::CachePathLengths()).
+  Added the --channel-bias option, for oversampling rare channels (see
+  ChannelBias).
+  Added the --event-filter option, for rejecting the unwanted events before
+  the hadron transport (see EventFilterI).
 
 */
 //____________________________________________________________________________
 
 #include <iostream>
 #include <cstdlib>
+#include <cstdio>
 
 #include <TMath.h>
 #include <TBits.h>
@@ -84,6 +103,25 @@ void RunOpt::Init(void)
   fEventRecordPrintLevel  = 3;
   fEventGeneratorList     = "Default";
   fXMLPath = "";
+  fOutputCompression = "";
+  fOutputBasketSize  = 0;
+  fOutputAutoFlush   = 0;
+  fOutputSplitLevel  = -1;
+  fOutputStream       = "";
+  fOutputStreamFormat = "binary";
+  fOutputStreamOnly   = false;
+  fShard   = 0;
+  fNShards = 1;
+  fCheckpointInterval = 0;
+  fRestart = false;
+  fMemoryReport = false;
+  fAsyncOutput  = false;
+  fFluxReadAheadCache = 0;
+  fFluxPrefetch       = 0;
+  fStopAfter = "";
+  fPathLengthCache = 0;
+  fChannelBias = "";
+  fEventFilter = "";
 }
 //____________________________________________________________________________
 void RunOpt::SetTuneName(string tuneName)
@@ -141,6 +179,101 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
     fXMLPath = parser.ArgAsString("xml-path");
   }
 
+  if( parser.OptionExists("output-compression") ) {
+    fOutputCompression = parser.ArgAsString("output-compression");
+  }
+
+  if( parser.OptionExists("output-basket-size") ) {
+    fOutputBasketSize = TMath::Max(0, parser.ArgAsInt("output-basket-size"));
+  }
+
+  if( parser.OptionExists("output-auto-flush") ) {
+    fOutputAutoFlush = parser.ArgAsLong("output-auto-flush");
+  }
+
+  if( parser.OptionExists("output-split-level") ) {
+    fOutputSplitLevel = parser.ArgAsInt("output-split-level");
+  }
+
+  if( parser.OptionExists("output-stream") ) {
+    fOutputStream = parser.ArgAsString("output-stream");
+  }
+
+  if( parser.OptionExists("output-stream-format") ) {
+    fOutputStreamFormat = parser.ArgAsString("output-stream-format");
+  }
+
+  fOutputStreamOnly = parser.OptionExists("output-stream-only");
+
+  if( parser.OptionExists("shard") ) {
+    string shard = parser.ArgAsString("shard");
+    int ishard = -1, nshards = -1;
+    if(sscanf(shard.c_str(), "%d/%d", &ishard, &nshards) != 2 ||
+       nshards < 1 || ishard < 0 || ishard >= nshards) {
+      LOG("RunOpt", pFATAL)
+        << "Invalid --shard value: " << shard << " (expected i/N, 0 <= i < N)";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    fShard   = ishard;
+    fNShards = nshards;
+  }
+
+  if( parser.OptionExists("checkpoint-interval") ) {
+    fCheckpointInterval = TMath::Max(0L, parser.ArgAsLong("checkpoint-interval"));
+  }
+
+  fRestart = parser.OptionExists("restart");
+
+  fMemoryReport = parser.OptionExists("memory-report");
+
+  fAsyncOutput = parser.OptionExists("async-output");
+
+  if( parser.OptionExists("flux-read-ahead") ) {
+    // TTreeCache size in MB, optionally followed by the number of flux
+    // entries decoded ahead on a reader thread (eg 100,1000)
+    string readahead = parser.ArgAsString("flux-read-ahead");
+    double cache_mb = 0;
+    int nprefetch = 0;
+    int nread = sscanf(readahead.c_str(), "%lf,%d", &cache_mb, &nprefetch);
+    if(nread < 1 || cache_mb < 0 || nprefetch < 0) {
+      LOG("RunOpt", pFATAL)
+        << "Invalid --flux-read-ahead value: " << readahead
+        << " (expected cache_MB[,n_entries])";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    fFluxReadAheadCache = (Long64_t) (cache_mb * 1024 * 1024);
+    fFluxPrefetch       = (unsigned int) nprefetch;
+  }
+
+  if( parser.OptionExists("path-length-cache") ) {
+    fPathLengthCache = TMath::Max(0L, parser.ArgAsLong("path-length-cache"));
+  }
+
+  if( parser.OptionExists("channel-bias") ) {
+    // comma separated channel:factor pairs (eg COH:10,DFR:10,charm:50),
+    // parsed by ChannelBias
+    fChannelBias = parser.ArgAsString("channel-bias");
+  }
+
+  if( parser.OptionExists("event-filter") ) {
+    // filter algorithm & configuration, as name/config (eg
+    // genie::PrimaryLeptonFilter/MuonAbove1GeV), see EventGenerator
+    fEventFilter = parser.ArgAsString("event-filter");
+  }
+
+  if( parser.OptionExists("stop-after") ) {
+    fStopAfter = parser.ArgAsString("stop-after");
+    if(fStopAfter != "kinematics" && fStopAfter != "hadronization") {
+      LOG("RunOpt", pFATAL)
+        << "Invalid --stop-after value: " << fStopAfter
+        << " (expected kinematics or hadronization)";
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+
   if( parser.OptionExists("tune") ) {
     SetTuneName( parser.ArgAsString("tune") ) ;
   }
@@ -176,6 +309,57 @@ void RunOpt::Print(ostream & stream) const
   stream << "\n Pre-calculate all free-nucleon cross-sections? : "
          << ((fEnableBareXSecPreCalc) ? "Yes" : "No");
 
+  if (fOutputCompression.size()) {
+    stream << "\n Output compression : " << fOutputCompression;
+  }
+  if (fOutputBasketSize > 0) {
+    stream << "\n Output basket size : " << fOutputBasketSize;
+  }
+  if (fOutputAutoFlush != 0) {
+    stream << "\n Output auto-flush : " << fOutputAutoFlush;
+  }
+  if (fOutputSplitLevel >= 0) {
+    stream << "\n Output split level : " << fOutputSplitLevel;
+  }
+  if (fOutputStream.size()) {
+    stream << "\n Output event stream : " << fOutputStream
+           << " (" << fOutputStreamFormat << ")"
+           << ((fOutputStreamOnly) ? ", no output file" : "");
+  }
+
+  if (fNShards > 1) {
+    stream << "\n Production shard : " << fShard << " of " << fNShards;
+  }
+  if (fCheckpointInterval > 0) {
+    stream << "\n Checkpoint every : " << fCheckpointInterval << " events";
+  }
+  if (fRestart) {
+    stream << "\n Restarting from the last checkpoint";
+  }
+  if (fMemoryReport) {
+    stream << "\n Memory footprint report : Yes";
+  }
+  if (fAsyncOutput) {
+    stream << "\n Writing events from a writer thread : Yes";
+  }
+  if (fFluxReadAheadCache > 0 || fFluxPrefetch > 0) {
+    stream << "\n Flux read-ahead : " << fFluxReadAheadCache/(1024*1024)
+           << " MB cache, " << fFluxPrefetch << " entries ahead";
+  }
+  if (fStopAfter.size()) {
+    stream << "\n Event generation stops after the " << fStopAfter << " stage";
+  }
+  if (fPathLengthCache > 0) {
+    stream << "\n Path lengths cached for (at most) " << fPathLengthCache
+           << " flux rays";
+  }
+  if (fChannelBias.size()) {
+    stream << "\n Channel oversampling factors : " << fChannelBias;
+  }
+  if (fEventFilter.size()) {
+    stream << "\n Event filter : " << fEventFilter;
+  }
+
   if (fXMLPath.size()) {
     stream << "\n XMLPath over-ride : "<<fXMLPath;
   }
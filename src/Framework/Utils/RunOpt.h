@@ -22,6 +22,8 @@
 #include <iostream>
 #include <string>
 
+#include <Rtypes.h>
+
 #include "Framework/Utils/TuneId.h"
 
 class TBits;
@@ -51,6 +53,25 @@ public:
   int    MCJobStatusRefreshRate (void) const { return fMCJobStatusRefreshRate; }
   bool   BareXSecPreCalc        (void) const { return fEnableBareXSecPreCalc;  }
   string XMLPath                (void) const { return fXMLPath;  }
+  string OutputCompression      (void) const { return fOutputCompression;      }
+  int    OutputBasketSize       (void) const { return fOutputBasketSize;       }
+  long   OutputAutoFlush        (void) const { return fOutputAutoFlush;        }
+  int    OutputSplitLevel       (void) const { return fOutputSplitLevel;       }
+  string OutputStream           (void) const { return fOutputStream;           }
+  string OutputStreamFormat     (void) const { return fOutputStreamFormat;     }
+  bool   OutputStreamOnly       (void) const { return fOutputStreamOnly;       }
+  int    Shard                  (void) const { return fShard;                  }
+  int    NShards                (void) const { return fNShards;                }
+  long   CheckpointInterval     (void) const { return fCheckpointInterval;     }
+  bool   Restart                (void) const { return fRestart;                }
+  bool   MemoryReport           (void) const { return fMemoryReport;           }
+  bool   AsyncOutput            (void) const { return fAsyncOutput;            }
+  Long64_t     FluxReadAheadCache (void) const { return fFluxReadAheadCache; }
+  unsigned int FluxPrefetch       (void) const { return fFluxPrefetch;       }
+  string StopAfter              (void) const { return fStopAfter;              }
+  long   PathLengthCache        (void) const { return fPathLengthCache;        }
+  string ChannelBias            (void) const { return fChannelBias;            }
+  string EventFilter            (void) const { return fEventFilter;            }
 
   // If a user accesses the GENIE objects directly, then most of the options above
   // can be set directly to the relevant objects (Messenger, Cache, etc).
@@ -79,6 +100,25 @@ private:
   bool   fEnableBareXSecPreCalc;     ///< Cache calcs relevant to free-nucleon xsecs before any nuclear xsec computation?
                                      ///< The option switches on/off cacheing calculations which interfere with event reweighting.
   string fXMLPath;                   ///< An path to look for XML in. Higher priority than GXMLPATH
+  string fOutputCompression;         ///< Output file compression, as algorithm:level (zlib, lzma, lz4, zstd). Empty for the ROOT default.
+  int    fOutputBasketSize;          ///< Output event tree basket size in bytes (0 for the NtpWriter default).
+  long   fOutputAutoFlush;           ///< Output event tree auto-flush setting, see TTree::SetAutoFlush() (0 for the ROOT default).
+  int    fOutputSplitLevel;          ///< Output event tree split level (-1 for the NtpWriter default).
+  string fOutputStream;              ///< Event stream target (pipe, socket, ...), see NtpStreamWriter. Empty for no stream.
+  string fOutputStreamFormat;        ///< Event stream format: binary or hepmc3.
+  bool   fOutputStreamOnly;          ///< Write the events to the event stream only (no output ROOT file)?
+  int    fShard;                     ///< Index of this job in a production split in fNShards jobs (see --shard i/N).
+  int    fNShards;                   ///< Number of jobs the production is split in (1: not split).
+  long   fCheckpointInterval;        ///< Number of events between checkpoints of the MC job (0: no checkpoints), see NtpWriter::WriteCheckpoint().
+  bool   fRestart;                   ///< Restart an interrupted MC job from its last checkpoint?
+  bool   fMemoryReport;              ///< Print the memory footprint breakdown after the initialization and at the end of the job (see MemoryStats)?
+  bool   fAsyncOutput;               ///< Write the events from a writer thread (see NtpWriter::SetAsynchronous())?
+  Long64_t     fFluxReadAheadCache;  ///< TTreeCache size (bytes) of the flux ntuples (0: ROOT default), see GFluxFileConfigI::SetReadAhead().
+  unsigned int fFluxPrefetch;        ///< Number of flux entries decoded ahead on a reader thread (0: no reader thread).
+  string fStopAfter;                 ///< Stage after which the event generation chains stop: kinematics or hadronization (empty: full chains), see EventGenerator.
+  long   fPathLengthCache;           ///< Max number of flux rays with cached path lengths (0: no caching), see GMCJDriver::CachePathLengths().
+  string fChannelBias;               ///< Channel oversampling factors, as channel:factor,... (empty: unbiased), see ChannelBias.
+  string fEventFilter;               ///< Event filter run before the hadron transport, as name/config (empty: none), see EventFilterI.
 
   // Self
   static RunOpt * fInstance;
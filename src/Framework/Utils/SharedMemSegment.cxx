@@ -0,0 +1,306 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <stdint.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/SharedMemSegment.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace {
+
+  const char kShmMagic[8] = { 'G','S','H','M','S','E','G','1' };
+
+  const uint64_t kShmBuilding = 0;
+  const uint64_t kShmReady    = 1;
+  const uint64_t kShmBroken   = 2;
+
+  // segment header, followed by the image (kept 8-byte aligned)
+  struct ShmHeader {
+    char     magic[8];
+    uint64_t state;
+    uint64_t size;  ///< image size
+    uint64_t pid;   ///< creator process id
+    uint64_t reserved[4];
+  };
+
+  volatile uint64_t & ShmState(void * header)
+  {
+    return ((volatile ShmHeader *) header)->state;
+  }
+}
+//____________________________________________________________________________
+SharedMemSegment::SharedMemSegment() :
+fName    (""),
+fCreator (false),
+fHeader  (0),
+fMapSize (0),
+fSize    (0)
+{
+
+}
+//____________________________________________________________________________
+SharedMemSegment::~SharedMemSegment()
+{
+  // don't leave other processes waiting for an image that won't come
+  if(fCreator && fHeader && ShmState(fHeader) == kShmBuilding) {
+    this->Abandon();
+  }
+  this->Detach();
+}
+//____________________________________________________________________________
+SharedMemStatus_t SharedMemSegment::Open(const string & name, double timeout)
+{
+  this->Detach();
+  fName    = name;
+  fCreator = false;
+
+  int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+  if(fd >= 0) {
+    // first process: create the segment, in the `building' state
+    void * addr = MAP_FAILED;
+    if(ftruncate(fd, sizeof(ShmHeader)) == 0) {
+      addr = mmap(0, sizeof(ShmHeader),
+                  PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if(addr == MAP_FAILED) {
+      LOG("SharedMem", pERROR)
+        << "Could not initialize shared memory segment " << name
+        << ": " << strerror(errno);
+      shm_unlink(name.c_str());
+      return kShmFailed;
+    }
+    ShmHeader * header = (ShmHeader *) addr;
+    memset(header, 0, sizeof(ShmHeader));
+    memcpy(header->magic, kShmMagic, sizeof(kShmMagic));
+    header->pid   = getpid();
+    header->state = kShmBuilding;
+
+    fHeader  = addr;
+    fMapSize = sizeof(ShmHeader);
+    fCreator = true;
+    LOG("SharedMem", pNOTICE)
+      << "Created shared memory segment " << name << " (building image)";
+    return kShmCreated;
+  }
+
+  if(errno != EEXIST) {
+    LOG("SharedMem", pERROR)
+      << "Could not open shared memory segment " << name
+      << ": " << strerror(errno);
+    return kShmFailed;
+  }
+
+  // segment created by another process: wait for its image
+  if(!this->Wait(timeout)) {
+    this->Detach();
+    return kShmFailed;
+  }
+  LOG("SharedMem", pNOTICE)
+    << "Attached to shared memory segment " << name
+    << " (" << fSize << " bytes)";
+  return kShmAttached;
+}
+//____________________________________________________________________________
+bool SharedMemSegment::Wait(double timeout)
+{
+  time_t start = time(0);
+
+  while(true) {
+    int fd = shm_open(fName.c_str(), O_RDONLY, 0);
+    if(fd < 0) {
+      LOG("SharedMem", pWARN)
+        << "Shared memory segment " << fName << " was removed";
+      return false;
+    }
+    struct stat st;
+    bool has_header =
+      (fstat(fd, &st) == 0 && (size_t) st.st_size >= sizeof(ShmHeader));
+
+    if(has_header) {
+      void * addr = mmap(0, sizeof(ShmHeader), PROT_READ, MAP_SHARED, fd, 0);
+      if(addr == MAP_FAILED) {
+        close(fd);
+        return false;
+      }
+      const ShmHeader * header = (const ShmHeader *) addr;
+      uint64_t state = ShmState(addr);
+      uint64_t size  = header->size;
+      pid_t    pid   = (pid_t) header->pid;
+      bool     valid = (memcmp(header->magic, kShmMagic, sizeof(kShmMagic)) == 0);
+      munmap(addr, sizeof(ShmHeader));
+
+      if(valid && state == kShmReady) {
+        // map the header and the image
+        size_t map_size = sizeof(ShmHeader) + size;
+        addr = MAP_FAILED;
+        if(fstat(fd, &st) == 0 && (size_t) st.st_size >= map_size) {
+          addr = mmap(0, map_size, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        if(addr == MAP_FAILED) return false;
+        fHeader  = addr;
+        fMapSize = map_size;
+        fSize    = size;
+        return true;
+      }
+      if(valid && state == kShmBroken) {
+        close(fd);
+        return false;
+      }
+      if(valid && pid > 0 && kill(pid, 0) != 0 && errno == ESRCH) {
+        close(fd);
+        LOG("SharedMem", pWARN)
+          << "The process building shared memory segment " << fName
+          << " has died - Remove the stale segment (/dev/shm" << fName << ")";
+        return false;
+      }
+    }
+    close(fd);
+
+    if(difftime(time(0), start) > timeout) {
+      LOG("SharedMem", pWARN)
+        << "Timed out waiting for shared memory segment " << fName;
+      return false;
+    }
+    usleep(50000);
+  }
+  return false;
+}
+//____________________________________________________________________________
+bool SharedMemSegment::Publish(const void * data, size_t size)
+{
+  if(!fCreator || !fHeader) {
+    LOG("SharedMem", pERROR)
+      << "Only the creator of a shared memory segment can publish its image";
+    return false;
+  }
+
+  int fd = shm_open(fName.c_str(), O_RDWR, 0);
+  if(fd < 0) {
+    this->Abandon();
+    return false;
+  }
+  size_t map_size = sizeof(ShmHeader) + size;
+  void * addr = MAP_FAILED;
+  if(ftruncate(fd, map_size) == 0) {
+    addr = mmap(0, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("SharedMem", pERROR)
+      << "Could not resize shared memory segment " << fName
+      << " to " << map_size << " bytes: " << strerror(errno);
+    this->Abandon();
+    return false;
+  }
+
+  ShmHeader * header = (ShmHeader *) addr;
+  if(size > 0) memcpy((char *) addr + sizeof(ShmHeader), data, size);
+  header->size = size;
+  // the image must be complete before it is flagged as ready
+  __sync_synchronize();
+  ShmState(addr) = kShmReady;
+
+  munmap(fHeader, fMapSize);
+  mprotect(addr, map_size, PROT_READ);
+  fHeader  = addr;
+  fMapSize = map_size;
+  fSize    = size;
+
+  LOG("SharedMem", pNOTICE)
+    << "Published " << size << " bytes in shared memory segment " << fName;
+  return true;
+}
+//____________________________________________________________________________
+void SharedMemSegment::Abandon(void)
+{
+  if(!fCreator) return;
+
+  if(fHeader) {
+    ShmState(fHeader) = kShmBroken;
+  }
+  shm_unlink(fName.c_str());
+  this->Detach();
+  fCreator = false;
+
+  LOG("SharedMem", pWARN)
+    << "Abandoned shared memory segment " << fName;
+}
+//____________________________________________________________________________
+void SharedMemSegment::Detach(void)
+{
+  if(fHeader) {
+    munmap(fHeader, fMapSize);
+  }
+  fHeader  = 0;
+  fMapSize = 0;
+  fSize    = 0;
+}
+//____________________________________________________________________________
+const void * SharedMemSegment::Data(void) const
+{
+  if(!fHeader || fSize == 0) return 0;
+  return (const char *) fHeader + sizeof(ShmHeader);
+}
+//____________________________________________________________________________
+string SharedMemSegment::SegmentName(
+                        const string & prefix, const string & filename)
+{
+  char   path[PATH_MAX];
+  string fullpath = (realpath(filename.c_str(), path) != 0) ? path : filename;
+
+  struct stat st;
+  long long size  = 0;
+  long long mtime = 0;
+  if(stat(fullpath.c_str(), &st) == 0) {
+    size  = st.st_size;
+    mtime = st.st_mtime;
+  }
+
+  // 64-bit FNV-1a hash
+  char extra[64];
+  snprintf(extra, sizeof(extra), ":%lld:%lld", size, mtime);
+  string   input = fullpath + extra;
+  uint64_t hash  = 14695981039346656037ULL;
+  for(size_t i = 0; i < input.size(); i++) {
+    hash ^= (unsigned char) input[i];
+    hash *= 1099511628211ULL;
+  }
+
+  char name[128];
+  snprintf(name, sizeof(name), "/%s-%016llx",
+           prefix.c_str(), (unsigned long long) hash);
+  return name;
+}
+//____________________________________________________________________________
+bool SharedMemSegment::Remove(const string & name)
+{
+  return (shm_unlink(name.c_str()) == 0);
+}
+//____________________________________________________________________________
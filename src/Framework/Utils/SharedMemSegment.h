@@ -0,0 +1,88 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::SharedMemSegment
+
+\brief    A named, node-wide POSIX shared memory segment holding a read-only
+          data image (eg the binary image of a cross section spline list).
+          The first process to open a given name creates the segment and
+          builds the image, whilst the processes opening the same name later
+          wait until the image is published and then attach to it read-only.
+          If the creator dies or fails before publishing the image, the
+          waiting processes give up (and are expected to load their data
+          privately). Segments outlive the processes using them: They are
+          removed with Remove() or, eg, `rm /dev/shm/<name>`.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _SHARED_MEM_SEGMENT_H_
+#define _SHARED_MEM_SEGMENT_H_
+
+#include <cstddef>
+#include <string>
+
+using std::string;
+
+namespace genie {
+
+typedef enum ESharedMemStatus {
+  kShmFailed = 0,
+  kShmCreated,    ///< this process must build the image and Publish() it
+  kShmAttached    ///< attached to an already published image
+} SharedMemStatus_t;
+
+class SharedMemSegment
+{
+public:
+  SharedMemSegment();
+ ~SharedMemSegment();
+
+  //! Create, or attach to, the named segment. Waits for up to `timeout'
+  //! seconds for the image of a segment being built by another process
+  SharedMemStatus_t Open (const string & name, double timeout = 600.);
+
+  //! Publish the image (creator only). The segment becomes read-only
+  bool Publish (const void * data, size_t size);
+
+  //! Remove the segment of a failed build (creator only)
+  void Abandon (void);
+
+  //! Unmap the segment. The segment itself stays available to other processes
+  void Detach  (void);
+
+  const void * Data     (void) const;
+  size_t       Size     (void) const { return fSize;    }
+  bool         IsOpen   (void) const { return fHeader != 0; }
+  string       Name     (void) const { return fName;    }
+
+  //! Build a valid segment name from a prefix and a file: the file path,
+  //! size and modification time are hashed, so that an updated file does
+  //! not map to stale segments
+  static string SegmentName (const string & prefix, const string & filename);
+
+  //! Remove the named segment
+  static bool   Remove      (const string & name);
+
+private:
+  SharedMemSegment(const SharedMemSegment & segment);
+
+  bool Wait (double timeout);
+
+  string   fName;
+  bool     fCreator;
+  void *   fHeader;  ///< mapped segment (header followed by the image)
+  size_t   fMapSize; ///< size of the mapping
+  size_t   fSize;    ///< size of the image
+};
+
+}      // genie namespace
+
+#endif // _SHARED_MEM_SEGMENT_H_
@@ -14,18 +14,34 @@
    That file was added in 2.5.1
  @ Apr 20, 2012 - CA
    Added LocalTimeAsString(string format) to tag validation program outputs.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added OpenStreamSink(), OpenStreamSource(), WriteFully() and ReadFully()
+   used for streaming events through pipes and sockets.
+   Added RunInWorkerProcesses() used for processing event files in parallel
+   entry ranges.
 
 */
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <csignal>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <dirent.h>
 #include <ctime>
 
 #include <TSystem.h>
+#include <TMath.h>
 
 
 #include "Framework/Messenger/Messenger.h"
@@ -164,3 +180,206 @@ string genie::utils::system::LocalTimeAsString(string format)
   return local_time_as_string;
 }
 //___________________________________________________________________________
+namespace {
+  int OpenTcpStream(string address)
+  {
+    size_t colon = address.rfind(':');
+    if(colon == string::npos) {
+      LOG("System", pERROR)
+        << "Expected a tcp://host:port address, got: tcp://" << address;
+      return -1;
+    }
+    string host = address.substr(0, colon);
+    string port = address.substr(colon+1);
+    bool   listening = (host.size() == 0 || host == "*");
+
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if(listening) hints.ai_flags = AI_PASSIVE;
+
+    addrinfo * res = 0;
+    int err = getaddrinfo(
+       (listening ? 0 : host.c_str()), port.c_str(), &hints, &res);
+    if(err != 0) {
+      LOG("System", pERROR)
+        << "Can not resolve tcp://" << address << ": " << gai_strerror(err);
+      return -1;
+    }
+
+    int fd = -1;
+    for(addrinfo * ai = res; ai != 0; ai = ai->ai_next) {
+      fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+      if(fd < 0) continue;
+      if(listening) {
+        int on = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        if(bind(fd, ai->ai_addr, ai->ai_addrlen) == 0 && listen(fd, 1) == 0) {
+          LOG("System", pNOTICE)
+            << "Waiting for a connection on TCP port " << port << "...";
+          int conn = accept(fd, 0, 0);
+          close(fd);
+          fd = conn;
+          if(fd >= 0) break;
+        }
+      } else {
+        if(connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) break;
+      }
+      if(fd >= 0) close(fd);
+      fd = -1;
+    }
+    freeaddrinfo(res);
+
+    if(fd < 0) {
+      LOG("System", pERROR)
+        << "Can not open tcp://" << address << ": " << strerror(errno);
+    }
+    return fd;
+  }
+  //_________________________________________________________________________
+  int OpenUnixStream(string path)
+  {
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if(path.size() >= sizeof(addr.sun_path)) {
+      LOG("System", pERROR) << "Unix socket path too long: " << path;
+      return -1;
+    }
+    strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path)-1);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd >= 0 &&
+       connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+      close(fd);
+      fd = -1;
+    }
+    if(fd < 0) {
+      LOG("System", pERROR)
+        << "Can not connect to unix://" << path << ": " << strerror(errno);
+    }
+    return fd;
+  }
+  //_________________________________________________________________________
+  int OpenStream(string target, bool output)
+  {
+    if(target == "-") return (output ? STDOUT_FILENO : STDIN_FILENO);
+
+    if(target.find("tcp://")  == 0) return OpenTcpStream (target.substr(6));
+    if(target.find("unix://") == 0) return OpenUnixStream(target.substr(7));
+
+    string path = target;
+    if(target.find("fifo://") == 0) {
+      path = target.substr(7);
+      if(!genie::utils::system::FileExists(path) &&
+         mkfifo(path.c_str(), 0644) != 0) {
+        LOG("System", pERROR)
+          << "Can not create named pipe " << path << ": " << strerror(errno);
+        return -1;
+      }
+      LOG("System", pNOTICE)
+        << "Waiting for the other end of named pipe " << path << "...";
+    }
+
+    int flags = output ? (O_WRONLY | O_CREAT | O_TRUNC) : O_RDONLY;
+    int fd = open(path.c_str(), flags, 0644);
+    if(fd < 0) {
+      LOG("System", pERROR)
+        << "Can not open " << path << ": " << strerror(errno);
+    }
+    return fd;
+  }
+}
+//___________________________________________________________________________
+int genie::utils::system::OpenStreamSink(string target)
+{
+  signal(SIGPIPE, SIG_IGN);
+  return OpenStream(target, true);
+}
+//___________________________________________________________________________
+int genie::utils::system::OpenStreamSource(string source)
+{
+  return OpenStream(source, false);
+}
+//___________________________________________________________________________
+bool genie::utils::system::WriteFully(
+                               int fd, const char * buffer, size_t nbytes)
+{
+  while(nbytes > 0) {
+    ssize_t n = write(fd, buffer, nbytes);
+    if(n < 0) {
+      if(errno == EINTR) continue;
+      LOG("System", pERROR) << "Stream write failed: " << strerror(errno);
+      return false;
+    }
+    buffer += n;
+    nbytes -= n;
+  }
+  return true;
+}
+//___________________________________________________________________________
+bool genie::utils::system::ReadFully(int fd, char * buffer, size_t nbytes)
+{
+  while(nbytes > 0) {
+    ssize_t n = read(fd, buffer, nbytes);
+    if(n < 0) {
+      if(errno == EINTR) continue;
+      LOG("System", pERROR) << "Stream read failed: " << strerror(errno);
+      return false;
+    }
+    if(n == 0) return false; // end of stream
+    buffer += n;
+    nbytes -= n;
+  }
+  return true;
+}
+//___________________________________________________________________________
+int genie::utils::system::RunInWorkerProcesses(
+   int nworkers, Long64_t first, Long64_t last,
+   EntryRangeWork_t work, void * args)
+{
+  Long64_t nentries = last - first;
+  if(nentries <= 0) return 0;
+
+  int nchunks = (int) TMath::Max(1LL, TMath::Min((Long64_t) nworkers, nentries));
+
+  // flush before forking so that buffered output is not written twice
+  std::cout.flush();
+  std::cerr.flush();
+
+  vector<pid_t> workers;
+  for(int ichunk = 0; ichunk < nchunks; ichunk++) {
+    Long64_t chunk_first = first + (nentries *  ichunk   ) / nchunks;
+    Long64_t chunk_last  = first + (nentries * (ichunk+1)) / nchunks;
+
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("System", pERROR)
+        << "Could not fork worker process: " << strerror(errno);
+      break;
+    }
+    if(pid == 0) {
+      work(ichunk, nchunks, chunk_first, chunk_last, args);
+      std::cout.flush();
+      std::cerr.flush();
+      _exit(0);
+    }
+    workers.push_back(pid);
+  }
+
+  bool ok = ((int) workers.size() == nchunks);
+  for(unsigned int i = 0; i < workers.size(); i++) {
+    int status = 0;
+    pid_t ret = 0;
+    do { ret = waitpid(workers[i], &status, 0); }
+    while(ret < 0 && errno == EINTR);
+    if(ret < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      LOG("System", pERROR) << "Worker process " << i << " did not complete";
+      ok = false;
+    }
+  }
+
+  return (ok ? nchunks : -1);
+}
+//___________________________________________________________________________
@@ -19,9 +19,12 @@
 #ifndef _SYST_UTILS_H_
 #define _SYST_UTILS_H_
 
+#include <cstddef>
 #include <vector>
 #include <string>
 
+#include <Rtypes.h>
+
 using std::vector;
 using std::string;
 
@@ -42,6 +45,39 @@ namespace system
 
   string LocalTimeAsString(string format);
 
+  // Open an event stream and return its file descriptor (-1 on failure).
+  // Supported targets / sources:
+  //   "-"                : standard output / standard input
+  //   "tcp://host:port"  : connect to a listening TCP server
+  //   "tcp://:port"      : listen on the TCP port and accept one connection
+  //   "unix://path"      : connect to a listening Unix domain socket
+  //   "fifo://path"      : named pipe, created if it does not exist
+  //   anything else      : a regular file (or an existing named pipe)
+  // Opening a named pipe blocks until the other end is opened too.
+  // Opening a sink ignores SIGPIPE so that a consumer going away shows up
+  // as a write error rather than terminating the job.
+  int  OpenStreamSink   (string target);
+  int  OpenStreamSource (string source);
+
+  // Write / read exactly nbytes, retrying on interrupts and partial
+  // transfers. Writes block while the consumer is not reading (so a slow
+  // consumer throttles the producer). Both return false on error / EOF.
+  bool WriteFully (int fd, const char * buffer, size_t nbytes);
+  bool ReadFully  (int fd, char * buffer, size_t nbytes);
+
+  // Split the entries [first, last) in (at most) nworkers contiguous ranges
+  // and process each range in a forked worker process, which calls
+  // work(ichunk, nchunks, chunk_first, chunk_last, args) and exits.
+  // Blocks until all workers are done. Returns the number of chunks, or -1
+  // if a worker could not be started or did not complete successfully.
+  // Processes rather than threads are used because the GENIE singletons and
+  // the ROOT objects used by the applications are not thread-safe.
+  typedef void (*EntryRangeWork_t) (
+     int ichunk, int nchunks, Long64_t first, Long64_t last, void * args);
+
+  int  RunInWorkerProcesses (int nworkers, Long64_t first, Long64_t last,
+                             EntryRangeWork_t work, void * args = 0);
+
 } // system namespace
 } // utils  namespace
 } // genie  namespace
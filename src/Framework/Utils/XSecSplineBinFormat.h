@@ -0,0 +1,70 @@
+//____________________________________________________________________________
+/*!
+
+\file     XSecSplineBinFormat.h
+
+\brief    Layout of the binary cross section spline file (see
+          XSecSplineList::SaveAsBinary() and XSecSplineMerger).
+          All offsets are in bytes from the start of the file and all sections
+          are 8-byte aligned. The file is written in the native byte order,
+          recorded in the header. It contains, in order:
+           - the header,
+           - the tune table (one entry per tune)
+           - the spline table (the splines of each tune are contiguous and
+             sorted by key, so that the table can be binary-searched),
+           - the string pool (tune names and spline keys, not null-terminated),
+           - the knots (for each spline, nknots energies followed by nknots
+             xsecs)
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _XSEC_SPLINE_BIN_FORMAT_H_
+#define _XSEC_SPLINE_BIN_FORMAT_H_
+
+#include <stdint.h>
+
+namespace genie {
+
+  const char     kXSecBinMagic[8] = { 'G','X','S','P','L','B','I','N' };
+  const uint32_t kXSecBinOrder    = 0x01020304;
+  const uint32_t kXSecBinVersion  = 1;
+
+  struct XSecBinHeader {
+    char     magic[8];
+    uint32_t byte_order;
+    uint32_t version;
+    uint32_t uselog;
+    uint32_t ntunes;
+    uint64_t nsplines;
+    uint64_t tune_table;
+    uint64_t spline_table;
+    uint64_t strings;
+    uint64_t knots;
+    uint64_t file_size;
+  };
+  struct XSecBinTune {
+    uint64_t name;
+    uint64_t name_len;
+    uint64_t first_spline;
+    uint64_t nsplines;
+  };
+  struct XSecBinSpline {
+    uint64_t key;
+    uint64_t key_len;
+    uint64_t nknots;
+    uint64_t knots;
+  };
+
+  inline uint64_t XSecBinAlign(uint64_t offset) { return (offset + 7) & ~uint64_t(7); }
+
+}      // genie namespace
+
+#endif // _XSEC_SPLINE_BIN_FORMAT_H_
@@ -13,7 +13,17 @@
 #include <cmath>   //provides: std::isnan()
 
 #include <fstream>
+#include <sstream>
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <mutex>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -27,16 +37,69 @@
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/SharedMemSegment.h"
 #include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/InitTimingStats.h"
+#include "Framework/Utils/MemoryStats.h"
+#include "Framework/Utils/XSecSplineBinFormat.h"
 #include "Framework/Utils/XmlParserUtils.h"
 
 using std::ofstream;
+using std::ifstream;
+using std::ostringstream;
 using std::endl;
 
 namespace genie {
 
+//____________________________________________________________________________
+namespace {
+
+  // serializes the on-demand decoding of lazily loaded splines
+  std::mutex gXSecSplineDecodeLock;
+
+  // adaptive knot placement
+  const int    kAdaptiveMinKnots  = 10;   // min number of knots in initial grid
+  const double kAdaptiveXSecFloor = 1E-3; // errors below this fraction of the max xsec are ignored
+  const double kAdaptiveMinWidth  = 1E-6; // min relative width of a bisected interval
+
+  bool LargerAdaptiveError(const pair<double, pair<double,double> > & a,
+                           const pair<double, pair<double,double> > & b)
+  { return a.first > b.first; }
+
+  // sets the probe energy of an interaction to the energy of a spline knot
+  void SetKnotEnergy(Interaction * interaction, double E)
+  {
+    double pr_mass = interaction->InitStatePtr()->Probe()->Mass();
+    TLorentzVector p4(0,0,E,E);
+    if (pr_mass > 0.) {
+      double pz = TMath::Max(0.,E*E - pr_mass*pr_mass);
+      pz = TMath::Sqrt(pz);
+      p4.SetPz(pz);
+    }
+    interaction->InitStatePtr()->SetProbeP4(p4);
+  }
+
+  // reports the cross section computed at a spline knot
+  double CheckKnotXSec(double E, double xsec)
+  {
+    SLOG("XSecSplLst", pNOTICE)
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2";
+    if ( std::isnan(xsec) ) {
+      // this sometimes happens near threshold, warn and move on
+      SLOG("XSecSplLst", pWARN)
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2"
+                     << " : converting NaN to 0.0";
+      xsec = 0.0;
+    }
+    return xsec;
+  }
+}
+
 //____________________________________________________________________________
 ostream & operator << (ostream & stream, const XSecSplineList & list)
 {
@@ -51,6 +114,11 @@ XSecSplineList::XSecSplineList()
   fInstance    =  0;
   fCurrentTune = "";
   fUseLogE     = true;
+  fLazyLoading = (std::getenv("GSPLLAZY") != 0);
+  fSharedMemory = (std::getenv("GSPLSHM")  != 0);
+  fQueueSplines = false;
+  fAdaptiveKnots = false;
+  fAdaptiveTol   = 1E-3;
   fNKnots      = 100;
   fEmin        =   0.01; // GeV
   fEmax        = 100.00; // GeV
@@ -60,19 +128,27 @@ XSecSplineList::~XSecSplineList()
 {
 // Clean up.
 
-  map<string,  map<string, Spline *> >::iterator mm_iter = fSplineMap.begin();
-  for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
-    // loop over splines for given tune
-    map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-    map<string, Spline *>::iterator m_iter = spl_map_curr_tune.begin();
-    for( ; m_iter != spl_map_curr_tune.end(); ++m_iter) {
-      Spline * spline = m_iter->second;
-      delete spline;
-      spline = 0;
-    }
-    spl_map_curr_tune.clear();
+  vector<Spline *>::iterator s_iter = fSplines.begin();
+  for( ; s_iter != fSplines.end(); ++s_iter) {
+    Spline * spline = *s_iter;
+    delete spline;
+    spline = 0;
   }
+  fSplines.clear();
   fSplineMap.clear();
+  fDeferredSplines.clear();
+
+  for(unsigned int i = 0; i < fMappedFiles.size(); i++) {
+    munmap(fMappedFiles[i].first, fMappedFiles[i].second);
+  }
+  fMappedFiles.clear();
+  for(unsigned int i = 0; i < fSharedSegments.size(); i++) {
+    delete fSharedSegments[i];
+  }
+  fSharedSegments.clear();
+
+  this->ClearQueuedSplines();
+
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -82,10 +158,67 @@ XSecSplineList * XSecSplineList::Instance()
     static XSecSplineList::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
     fInstance = new XSecSplineList;
+    MemoryStats::Instance()->Register("XSecSplineList", XSecSplineList::ReportMemory);
   }
   return fInstance;
 }
 //____________________________________________________________________________
+void XSecSplineList::ReportMemory(MemoryStats & stats)
+{
+// Report the memory held by the spline list (see MemoryStats). Splines
+// shared by several tunes are counted once.
+
+  if(fInstance == 0) return;
+
+  std::lock_guard<std::mutex> guard(gXSecSplineDecodeLock);
+
+  const string name = "XSecSplineList";
+
+  long int nspl = 0;
+  double   bytes = fInstance->fSplines.capacity() * sizeof(Spline *);
+  for(unsigned int i = 0; i < fInstance->fSplines.size(); i++) {
+    const Spline * spline = fInstance->fSplines[i];
+    if(!spline) continue;
+    nspl++;
+    bytes += spline->MemorySize();
+  }
+  stats.Add(name, "decoded splines", bytes, nspl);
+
+  bytes = 0;
+  map<int, DeferredSpline>::const_iterator d_iter = fInstance->fDeferredSplines.begin();
+  for( ; d_iter != fInstance->fDeferredSplines.end(); ++d_iter) {
+    bytes += sizeof(DeferredSpline) + d_iter->second.buffer.capacity() * sizeof(double);
+  }
+  stats.Add(name, "deferred splines (not decoded)", bytes,
+            (long int) fInstance->fDeferredSplines.size());
+
+  long int nkeys = 0;
+  bytes = 0;
+  map<string, map<string, int> >::const_iterator t_iter = fInstance->fSplineMap.begin();
+  for( ; t_iter != fInstance->fSplineMap.end(); ++t_iter) {
+    map<string, int>::const_iterator k_iter = t_iter->second.begin();
+    for( ; k_iter != t_iter->second.end(); ++k_iter) {
+      nkeys++;
+      bytes += sizeof(map<string, int>::value_type) + k_iter->first.capacity();
+    }
+  }
+  stats.Add(name, "spline keys (all tunes)", bytes, nkeys);
+
+  bytes = 0;
+  for(unsigned int i = 0; i < fInstance->fMappedFiles.size(); i++) {
+    bytes += fInstance->fMappedFiles[i].second;
+  }
+  stats.Add(name, "mapped spline files",
+            bytes, (long int) fInstance->fMappedFiles.size());
+
+  bytes = 0;
+  for(unsigned int i = 0; i < fInstance->fSharedSegments.size(); i++) {
+    bytes += fInstance->fSharedSegments[i]->Size();
+  }
+  stats.Add(name, "shared memory spline images",
+            bytes, (long int) fInstance->fSharedSegments.size());
+}
+//____________________________________________________________________________
 bool XSecSplineList::SplineExists(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
@@ -95,24 +228,7 @@ bool XSecSplineList::SplineExists(
 //____________________________________________________________________________
 bool XSecSplineList::SplineExists(string key) const
 {
-
-  if ( fCurrentTune.size() == 0 ) {
-    SLOG("XSecSplLst", pERROR) << "Spline requested while CurrentTune not set" ;
-    return false ;
-  }
-
-  SLOG("XSecSplLst", pDEBUG)
-    << "Checking for spline: " << key << " in tune: " << fCurrentTune;
-
-  map<string,  map<string, Spline *> >::const_iterator //
-  mm_iter = fSplineMap.find(fCurrentTune);
-  if(mm_iter == fSplineMap.end()) {
-    SLOG("XSecSplLst", pWARN)
-       << "No splines for tune " << fCurrentTune << " were found!";
-    return false;
-  }
-  const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-  bool exists = (spl_map_curr_tune.count(key) == 1);
+  bool exists = (this->GetSplineHandle(key) >= 0);
   SLOG("XSecSplLst", pDEBUG)
     << "Spline found?...." << utils::print::BoolAsYNString(exists);
   return exists;
@@ -127,33 +243,70 @@ const Spline * XSecSplineList::GetSpline(
 //____________________________________________________________________________
 const Spline * XSecSplineList::GetSpline(string key) const
 {
-
   if ( fCurrentTune.size() == 0 ) {
     SLOG("XSecSplLst", pFATAL) << "Spline requested while CurrentTune not set" ;
     exit(0) ;
   }
 
+  int handle = this->GetSplineHandle(key);
+  if(handle < 0) {
+    SLOG("XSecSplLst", pWARN)
+      << "Couldn't find spline: " << key << " in tune: " << fCurrentTune;
+    return 0;
+  }
+  return this->GetSpline(handle);
+}
+//____________________________________________________________________________
+int XSecSplineList::GetSplineHandle(
+            const XSecAlgorithmI * alg, const Interaction * interaction) const
+{
+  string key = this->BuildSplineKey(alg,interaction);
+  return this->GetSplineHandle(key);
+}
+//____________________________________________________________________________
+int XSecSplineList::GetSplineHandle(string key) const
+{
+// Get the handle of the spline with the input key, in the current tune.
+// Returns -1 if there is no such spline.
+
+  if ( fCurrentTune.size() == 0 ) {
+    SLOG("XSecSplLst", pERROR) << "Spline requested while CurrentTune not set" ;
+    return -1 ;
+  }
+
   SLOG("XSecSplLst", pDEBUG)
-    << "Getting spline: " << key << " in tune: " << fCurrentTune;
+    << "Checking for spline: " << key << " in tune: " << fCurrentTune;
 
-  map<string,  map<string, Spline *> >::const_iterator //\/
+  map<string,  map<string, int> >::const_iterator //\/
   mm_iter = fSplineMap.find(fCurrentTune);
   if(mm_iter == fSplineMap.end()) {
     SLOG("XSecSplLst", pWARN)
        << "No splines for tune " << fCurrentTune << " were found!";
-    return 0;
+    return -1;
   }
-  const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-  map<string, Spline *>::const_iterator //\/
+  const map<string, int> & spl_map_curr_tune = mm_iter->second;
+  map<string, int>::const_iterator //\/
   m_iter = spl_map_curr_tune.find(key);
-  if(m_iter == spl_map_curr_tune.end()) {
-    SLOG("XSecSplLst", pWARN)
-      << "Couldn't find spline: " << key << " in tune: " << fCurrentTune;
-    return 0;
-  }
+  if(m_iter == spl_map_curr_tune.end()) return -1;
+
   return m_iter->second;
 }
 //____________________________________________________________________________
+const Spline * XSecSplineList::GetSpline(int handle) const
+{
+// Get the spline with the input handle (see GetSplineHandle())
+
+  if(handle < 0 || handle >= (int) fSplines.size()) return 0;
+
+  const Spline * spline = fSplines[handle];
+  if(spline == 0) {
+    // lazily loaded spline, accessed for the first time
+    std::lock_guard<std::mutex> guard(gXSecSplineDecodeLock);
+    return const_cast<XSecSplineList *>(this)->DecodeSpline(handle);
+  }
+  return spline;
+}
+//____________________________________________________________________________
 void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
         const Interaction * interaction, int nknots, double e_min, double e_max)
 {
@@ -167,9 +320,6 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   // rwh -- uncomment to catch NaN
   // feenableexcept(FE_DIVBYZERO|FE_INVALID|FE_OVERFLOW);
 
-  double xsec[nknots];
-  double E   [nknots];
-
   SLOG("XSecSplLst", pNOTICE)
      << "Creating cross section spline using the algorithm: " << *alg;
 
@@ -183,6 +333,16 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   if (nknots <= 2) nknots = this->NKnots();
   assert( e_min < e_max );
 
+  // With adaptive knots, nknots is the knot budget and the knots placed
+  // below are only the initial grid
+  int budget = nknots;
+  if (fAdaptiveKnots) {
+    nknots = TMath::Min(budget, TMath::Max(budget/4, kAdaptiveMinKnots));
+  }
+
+  vector<double> E   (nknots);
+  vector<double> xsec(nknots);
+
   // Distribute the knots in the energy range (e_min,e_max) :
   // - Will use 5 knots linearly spaced below the energy thresholds so that the
   //   spline behaves correctly in (e_min,Ethr)
@@ -221,33 +381,182 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   // force last point to avoid floating point cumulative slew
   E[nknots-1] = e_max;
 
+  QueuedSpline queued;
+  queued.alg         = alg;
+  queued.interaction = new Interaction(*interaction);
+  queued.key         = key;
+  queued.E           = E;
+  queued.nknots      = budget;
+
+  // If queuing, leave the knot cross sections to the caller
+  //
+  if(fQueueSplines) {
+    vector<QueuedSpline>::const_iterator q_iter = fQueuedSplines.begin();
+    for( ; q_iter != fQueuedSplines.end(); ++q_iter) {
+      if(q_iter->key == key) break;
+    }
+    if(q_iter == fQueuedSplines.end()) {
+      SLOG("XSecSplLst", pNOTICE) << "Queued spline: " << key;
+      fQueuedSplines.push_back(queued);
+    } else {
+      delete queued.interaction;
+    }
+    return;
+  }
+
   // Compute cross sections for the input interaction at the selected
   // set of energies
   //
-  double pr_mass = interaction->InitStatePtr()->Probe()->Mass();
-  for (int i = 0; i < nknots; i++) {
-    TLorentzVector p4(0,0,E[i],E[i]);
-    if (pr_mass > 0.) {
-      double pz = TMath::Max(0.,E[i]*E[i] - pr_mass*pr_mass);
-      pz = TMath::Sqrt(pz);
-      p4.SetPz(pz);
+  this->ComputeKnots(queued, E, xsec);
+
+  this->CreateSpline(queued, E, xsec);
+
+  delete queued.interaction;
+}
+//____________________________________________________________________________
+double XSecSplineList::KnotXSec(
+   const XSecAlgorithmI * alg, Interaction * interaction, double E) const
+{
+// Compute the cross section for the input interaction at a spline knot
+
+  SetKnotEnergy(interaction, E);
+  return CheckKnotXSec(E, alg->Integral(interaction));
+}
+//____________________________________________________________________________
+void XSecSplineList::KnotXSecBatch(
+   const XSecAlgorithmI * alg, const Interaction * interaction,
+   const vector<double> & E, vector<double> & xsec) const
+{
+// Compute the cross sections for the input interaction at a set of spline
+// knots, handed to the model as one batch (see XSecAlgorithmI::IntegralBatch)
+
+  unsigned int n = E.size();
+  xsec.assign(n, 0.);
+  if (n == 0) return;
+
+  vector<Interaction *> knots(n);
+  for (unsigned int i = 0; i < n; i++) {
+    knots[i] = new Interaction(*interaction);
+    SetKnotEnergy(knots[i], E[i]);
+  }
+  alg->IntegralBatch(&knots[0], n, &xsec[0]);
+  for (unsigned int i = 0; i < n; i++) {
+    xsec[i] = CheckKnotXSec(E[i], xsec[i]);
+    delete knots[i];
+  }
+}
+//____________________________________________________________________________
+void XSecSplineList::ComputeKnots(const QueuedSpline & queued,
+                      vector<double> & E, vector<double> & xsec) const
+{
+// Compute the cross sections at the knots of the input (queued) spline.
+// With adaptive knots, refine the knots until the interpolation error
+// tolerance or the knot budget is met.
+
+  E = queued.E;
+  this->KnotXSecBatch(queued.alg, queued.interaction, E, xsec);
+  if (!fAdaptiveKnots) return;
+
+  vector<double> Etest, xsec_test, Enext;
+  this->RefineKnots(E, xsec, Etest, xsec_test, queued.nknots, Enext);
+  while (Enext.size() > 0) {
+    Etest = Enext;
+    this->KnotXSecBatch(queued.alg, queued.interaction, Etest, xsec_test);
+    this->RefineKnots(E, xsec, Etest, xsec_test, queued.nknots, Enext);
+  }
+  SLOG("XSecSplLst", pNOTICE)
+     << "Adaptive knots: " << E.size() << " knots (budget: "
+     << queued.nknots << ") for " << queued.key;
+}
+//____________________________________________________________________________
+void XSecSplineList::RefineKnots(
+     vector<double> & E, vector<double> & xsec,
+     const vector<double> & Etest, const vector<double> & xsec_test,
+     int budget, vector<double> & Enext) const
+{
+// One step of the adaptive knot placement.
+// The input test points are the midpoints of the intervals of the current
+// knots (E, xsec) that are under test, with their computed cross sections.
+// An interval is bisected further if the cross section at its midpoint
+// differs from the interpolated one by more than the tolerance. The test
+// points are then added to the knots (the integrals are not wasted) and
+// the midpoints of the intervals to be tested next are returned, as long as
+// the knot budget allows (the halves of the intervals with the largest
+// errors first). If there are no test points, all the intervals of the
+// initial grid are tested (except the ones below threshold).
+
+  Enext.clear();
+
+  // (relative error, interval) for the intervals to be tested next
+  vector< pair<double, pair<double,double> > > intervals;
+
+  if (Etest.size() == 0) {
+    for (unsigned int i = 0; i+1 < E.size(); i++) {
+      if (xsec[i] == 0 && xsec[i+1] == 0) continue;
+      intervals.push_back(std::make_pair(0., pair<double,double>(E[i], E[i+1])));
     }
-    interaction->InitStatePtr()->SetProbeP4(p4);
-    xsec[i] = alg->Integral(interaction);
-    SLOG("XSecSplLst", pNOTICE)
-                       << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2";
-    if ( std::isnan(xsec[i]) ) {
-      // this sometimes happens near threshold, warn and move on
-      SLOG("XSecSplLst", pWARN)
-                       << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2"
-                       << " : converting NaN to 0.0";
-      xsec[i] = 0.0;
+  } else {
+    vector<double> Ek(E), xk(xsec); // Spline's ctor does not take const input
+    Spline spline(Ek.size(), &Ek[0], &xk[0]);
+
+    double xsec_max = 0;
+    for (unsigned int i = 0; i < xsec.size(); i++) {
+      xsec_max = TMath::Max(xsec_max, TMath::Abs(xsec[i]));
+    }
+    for (unsigned int i = 0; i < xsec_test.size(); i++) {
+      xsec_max = TMath::Max(xsec_max, TMath::Abs(xsec_test[i]));
     }
 
+    for (unsigned int i = 0; i < Etest.size(); i++) {
+      double err = TMath::Abs(spline.Evaluate(Etest[i]) - xsec_test[i]);
+      double ref = TMath::Max(TMath::Abs(xsec_test[i]), kAdaptiveXSecFloor * xsec_max);
+      if (err <= fAdaptiveTol * ref) continue;
+      vector<double>::const_iterator it =
+                          std::lower_bound(E.begin(), E.end(), Etest[i]);
+      if (it == E.begin() || it == E.end()) continue;
+      double rerr = err / ref;
+      intervals.push_back(std::make_pair(rerr, pair<double,double>(*(it-1), Etest[i])));
+      intervals.push_back(std::make_pair(rerr, pair<double,double>(Etest[i], *it)));
+    }
+    std::stable_sort(intervals.begin(), intervals.end(), LargerAdaptiveError);
+
+    // add the test points to the knots
+    vector< pair<double,double> > knots;
+    for (unsigned int i = 0; i < E.size();     i++) knots.push_back(pair<double,double>(E[i],     xsec[i]));
+    for (unsigned int i = 0; i < Etest.size(); i++) knots.push_back(pair<double,double>(Etest[i], xsec_test[i]));
+    std::sort(knots.begin(), knots.end());
+    E.resize(knots.size());
+    xsec.resize(knots.size());
+    for (unsigned int i = 0; i < knots.size(); i++) {
+      E[i]    = knots[i].first;
+      xsec[i] = knots[i].second;
+    }
   }
 
+  int nfree = budget - (int) E.size();
+  for (unsigned int i = 0; i < intervals.size() && (int) Enext.size() < nfree; i++) {
+    double Elo = intervals[i].second.first;
+    double Ehi = intervals[i].second.second;
+    if (Ehi - Elo < kAdaptiveMinWidth * Ehi) continue;
+    double Emid = (this->UseLogE() && Elo > 0) ?
+                     TMath::Sqrt(Elo * Ehi) : 0.5 * (Elo + Ehi);
+    Enext.push_back(Emid);
+  }
+}
+//____________________________________________________________________________
+void XSecSplineList::CreateSpline(const QueuedSpline & queued,
+                 const vector<double> & E_in, const vector<double> & xsec_in)
+{
+// Build the cross section spline from the knots computed for the input
+// (queued) spline and store it in the list
+
+  const string & key = queued.key;
+  int nknots = E_in.size();
+  assert( (int) xsec_in.size() == nknots && nknots > 1 );
+
+  vector<double> E   (E_in);
+  vector<double> xsec(xsec_in);
+
   // Warn about odd case of decreasing cross section
   //    but allow for small variation due to integration errors
   const double eps_xsec = 1.0e-5;
@@ -261,32 +570,32 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
 
   // Build
   //
-  Spline * spline = new Spline(nknots, E, xsec);
+  Spline * spline = new Spline(nknots, &E[0], &xsec[0]);
 
   // Save
   //
-  map<string,  map<string, Spline *> >::iterator //\/
-  mm_iter = fSplineMap.find(fCurrentTune);
-  if(mm_iter == fSplineMap.end()) {
-    map<string, Spline *> spl_map_curr_tune;
-    fSplineMap.insert( map<string, map<string, Spline *> >::value_type(
-      fCurrentTune, spl_map_curr_tune) );
-    mm_iter = fSplineMap.find(fCurrentTune);
+  this->AddSpline(fCurrentTune, key, spline);
+}
+//____________________________________________________________________________
+void XSecSplineList::ClearQueuedSplines(void)
+{
+  vector<QueuedSpline>::iterator q_iter = fQueuedSplines.begin();
+  for( ; q_iter != fQueuedSplines.end(); ++q_iter) {
+    delete q_iter->interaction;
   }
-  map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-  spl_map_curr_tune.insert( map<string, Spline *>::value_type(key, spline) );
+  fQueuedSplines.clear();
 }
 //____________________________________________________________________________
 int XSecSplineList::NSplines(void) const
 {
-  map<string,  map<string, Spline *> >::const_iterator //
+  map<string,  map<string, int> >::const_iterator //
   mm_iter = fSplineMap.find(fCurrentTune);
   if(mm_iter == fSplineMap.end()) {
     SLOG("XSecSplLst", pWARN)
        << "No splines for tune " << fCurrentTune << " were found!";
     return 0;
   }
-  const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
+  const map<string, int> & spl_map_curr_tune = mm_iter->second;
   return (int) spl_map_curr_tune.size();
 }
 //____________________________________________________________________________
@@ -317,6 +626,12 @@ void XSecSplineList::SetMaxE(double Ev)
   if(Ev>0) fEmax = Ev;
 }
 //____________________________________________________________________________
+void XSecSplineList::SetAdaptiveKnots(bool on, double tol)
+{
+  fAdaptiveKnots = on;
+  if(tol>0) fAdaptiveTol = tol;
+}
+//____________________________________________________________________________
 void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
 {
 //! Save XSecSplineList to XML file
@@ -324,6 +639,8 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
   SLOG("XSecSplLst", pNOTICE)
        << "Saving XSecSplineList as XML in file: " << filename;
 
+  const_cast<XSecSplineList *>(this)->DecodeAll();
+
   ofstream outxml(filename.c_str());
   if(!outxml.is_open()) {
     SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << filename;
@@ -340,17 +657,28 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
   outxml << endl << endl;
 
   // loop over tunes
-  map<string,  map<string, Spline *> >::const_iterator //\/
+  map<string,  map<string, int> >::const_iterator //\/
   mm_iter = fSplineMap.begin();
   for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
 
     string tune_name = mm_iter->first;
-    outxml << "  <genie_tune name=\"" << tune_name << "\">";
+
+    // a derived tune only lists the splines that differ from its parent's
+    string parent_name = this->TuneParent(tune_name);
+    map<string,  map<string, int> >::const_iterator //\/
+    pm_iter = fSplineMap.find(parent_name);
+    if(parent_name.size() > 0 && pm_iter != fSplineMap.end()) {
+      outxml << "  <genie_tune name=\"" << tune_name
+             << "\" parent=\"" << parent_name << "\">";
+    } else {
+      pm_iter = fSplineMap.end();
+      outxml << "  <genie_tune name=\"" << tune_name << "\">";
+    }
     outxml << endl << endl;
 
     // loop over splines for given tune
-    const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-    map<string, Spline *>::const_iterator //\/
+    const map<string, int> & spl_map_curr_tune = mm_iter->second;
+    map<string, int>::const_iterator //\/
     m_iter = spl_map_curr_tune.begin();
     for( ; m_iter != spl_map_curr_tune.end(); ++m_iter) {
       string key = m_iter->first;
@@ -367,8 +695,16 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
       }
       if(from_init_set && !save_init) continue;
 
+      // Skip the splines inherited from the parent tune
+      if(pm_iter != fSplineMap.end()) {
+        map<string, int>::const_iterator //\/
+        p_iter = pm_iter->second.find(key);
+        if(p_iter != pm_iter->second.end() &&
+           this->SameSpline(m_iter->second, p_iter->second)) continue;
+      }
+
       // Add current spline to output file
-      Spline * spline = m_iter->second;
+      Spline * spline = fSplines[m_iter->second];
       spline->SaveAsXml(outxml,"E","xsec", key);
     }//spline loop
 
@@ -380,11 +716,16 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
   outxml.close();
 }
 //____________________________________________________________________________
-XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep)
+XmlParserStatus_t XSecSplineList::LoadFromXml(
+                           const string & filename, bool keep, bool init)
 {
 //! Load XSecSplineList from ROOT file. If keep = true, then the loaded splines
 //! are added to the existing list. If false, then the existing list is reset
 //! before loading the splines.
+//! If init = false, the loaded splines are not marked as part of the initial
+//! set of splines (see SaveAsXml()).
+
+  InitTimingScope timing("XSecSplineList::LoadFromXml");
 
   SLOG("XSecSplLst", pNOTICE)
     << "Loading splines from: " << filename;
@@ -392,7 +733,11 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
     << "Option to keep pre-existing splines is switched "
     << ( (keep) ? "ON" : "OFF" );
 
-  if(!keep) fSplineMap.clear();
+  if(!keep) {
+    fSplineMap.clear();
+    fDeferredSplines.clear();
+    fSplineDigests.clear();
+  }
 
   const int kNodeTypeStartElement = 1;
   const int kNodeTypeEndElement   = 15;
@@ -405,6 +750,7 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
   double * E = 0, * xsec = 0;
   string spline_name = "";
   string temp_tune ;
+  bool skip_tune = false;
 
   reader = xmlNewTextReaderFilename(filename.c_str());
   if (reader != NULL) {
@@ -439,13 +785,33 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
             }
 
             if( (!xmlStrcmp(name, (const xmlChar *) "genie_tune")) && type==kNodeTypeStartElement) {
-               xmlChar * xtune = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
+               xmlChar * xtune   = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
+               xmlChar * xparent = xmlTextReaderGetAttribute(reader,(const xmlChar*)"parent");
                temp_tune    = utils::str::TrimSpaces((const char *)xtune);
-               SLOG("XSecSplLst", pNOTICE) << "Loading x-section splines for GENIE tune: " << temp_tune;
+               string parent_tune = (xparent) ?
+                      utils::str::TrimSpaces((const char *)xparent) : "";
+               // in lazy-loading mode only the current tune is read in
+               // (and, in a further pass, the tunes it derives from)
+               if(fXmlPassTunes.size() > 0) {
+                 skip_tune = (fXmlPassTunes.count(temp_tune) == 0);
+               } else {
+                 skip_tune = fLazyLoading && fCurrentTune.size() > 0 && temp_tune != fCurrentTune;
+               }
+               if(skip_tune) {
+                 SLOG("XSecSplLst", pNOTICE) << "Skipping x-section splines for GENIE tune: " << temp_tune;
+               } else {
+                 SLOG("XSecSplLst", pNOTICE) << "Loading x-section splines for GENIE tune: " << temp_tune;
+                 if(parent_tune.size() > 0) {
+                   SLOG("XSecSplLst", pNOTICE)
+                      << "Tune " << temp_tune << " derives from tune: " << parent_tune;
+                   this->SetTuneParent(temp_tune, parent_tune);
+                 }
+               }
                xmlFree(xtune);
+               if(xparent) xmlFree(xparent);
             }
 
-            if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeStartElement) {
+            if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeStartElement && !skip_tune) {
                xmlChar * xname = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
                xmlChar * xnkn  = xmlTextReaderGetAttribute(reader,(const xmlChar*)"nknots");
                string sname    = utils::str::TrimSpaces((const char *)xname);
@@ -466,38 +832,26 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
             if( (!xmlStrcmp(name, (const xmlChar *) "E"))    && type==kNodeTypeStartElement) { val_type = kKnotX; }
             if( (!xmlStrcmp(name, (const xmlChar *) "xsec")) && type==kNodeTypeStartElement) { val_type = kKnotY; }
 
-            if( (!xmlStrcmp(name, (const xmlChar *) "#text")) && depth==5) {
+            if( (!xmlStrcmp(name, (const xmlChar *) "#text")) && depth==5 && !skip_tune) {
                 if      (val_type==kKnotX) E   [iknot] = atof((const char *)value);
                 else if (val_type==kKnotY) xsec[iknot] = atof((const char *)value);
             }
             if( (!xmlStrcmp(name, (const xmlChar *) "knot")) && type==kNodeTypeEndElement) {
                iknot++;
             }
-            if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeEndElement) {
+            if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeEndElement && !skip_tune) {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
                LOG("XSecSplLst", pINFO) << "Done with current spline";
                for(int i=0; i<nknots; i++) {
                   LOG("XSecSplLst", pINFO) << "xsec[E = " << E[i] << "] = " << xsec[i];
                }
 #endif
-               // done looping over knots - build the spline
-               Spline * spline = new Spline(nknots, E, xsec);
+               // done looping over knots - build the spline (or keep its knots
+               // until it is first accessed) and insert it to the map
+               this->AddLoadedSpline(temp_tune, spline_name, E, xsec, nknots, fLazyLoading);
                delete [] E;
                delete [] xsec;
-
-               // insert the spline to the map
-               map<string,  map<string, Spline *> >::iterator //\/
-               mm_iter = fSplineMap.find( temp_tune );
-               if(mm_iter == fSplineMap.end()) {
-                 map<string, Spline *> spl_map_curr_tune;
-                 fSplineMap.insert( map<string, map<string, Spline *> >::value_type(
-                    temp_tune, spl_map_curr_tune) );
-                 mm_iter = fSplineMap.find( temp_tune );
-               }
-               map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-               spl_map_curr_tune.insert(
-                  map<string, Spline *>::value_type(spline_name, spline) );
-               fLoadedSplineSet[temp_tune].insert(spline_name);
+               if(init) fLoadedSplineSet[temp_tune].insert(spline_name);
             }
             xmlFree(name);
             xmlFree(value);
@@ -514,9 +868,791 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
           << "\nXML file could not be found! [filename: " << filename << "]";
   }
 
+  // derived tunes inherit the splines of their parents. The parents that are
+  // not loaded (eg skipped in lazy-loading mode) are read in a further pass
+  set<string> missing;
+  this->InheritTunes(init, missing);
+  if(missing.size() > 0) {
+    set<string>::const_iterator t_iter = missing.begin();
+    for( ; t_iter != missing.end(); ++t_iter) {
+      if(fXmlPassTunes.count(*t_iter) == 1) {
+        LOG("XSecSplLst", pERROR)
+          << "\nParent tune " << *t_iter << " could not be found! [filename: "
+          << filename << "]";
+        return kXmlNotParsed;
+      }
+    }
+    set<string> pass_tunes = fXmlPassTunes;
+    fXmlPassTunes = missing;
+    SLOG("XSecSplLst", pNOTICE)
+      << "Reading in " << missing.size() << " parent tune(s) from: " << filename;
+    XmlParserStatus_t status = this->LoadFromXml(filename, true, init);
+    fXmlPassTunes = pass_tunes;
+    return status;
+  }
+
+  return kXmlOK;
+}
+//____________________________________________________________________________
+void XSecSplineList::SaveAsBinary(const string & filename, bool save_init) const
+{
+//! Save XSecSplineList to the binary spline file format
+
+  SLOG("XSecSplLst", pNOTICE)
+       << "Saving XSecSplineList as binary in file: " << filename;
+
+  ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+  if(!out.is_open()) {
+    SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << filename;
+    return;
+  }
+  this->WriteBinary(out, save_init);
+  out.close();
+}
+//____________________________________________________________________________
+void XSecSplineList::WriteBinary(ostream & out, bool save_init) const
+{
+//! Write the binary image of the XSecSplineList (see SaveAsBinary)
+
+  const_cast<XSecSplineList *>(this)->DecodeAll();
+
+  // collect what is to be written out (std::map keeps the keys sorted)
+  vector<XSecBinTune>    tunes;
+  vector<XSecBinSpline>  splines;
+  vector<const Spline *> spline_ptrs;
+  string                 strings;
+  uint64_t               nknots_tot = 0;
+  map<int, uint64_t>     knot_offsets; // handle -> knots of the splines written
+
+  map<string,  map<string, int> >::const_iterator //\/
+  mm_iter = fSplineMap.begin();
+  for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
+    string tune_name = mm_iter->first;
+
+    XSecBinTune tune;
+    tune.name         = strings.size();
+    tune.name_len     = tune_name.size();
+    tune.first_spline = splines.size();
+    strings += tune_name;
+
+    map<string, set<string> >::const_iterator //\/
+    it = fLoadedSplineSet.find(tune_name);
+
+    const map<string, int> & spl_map_curr_tune = mm_iter->second;
+    map<string, int>::const_iterator //\/
+    m_iter = spl_map_curr_tune.begin();
+    for( ; m_iter != spl_map_curr_tune.end(); ++m_iter) {
+      string key = m_iter->first;
+
+      bool from_init_set =
+        (it != fLoadedSplineSet.end() && it->second.count(key) == 1);
+      if(from_init_set && !save_init) continue;
+
+      const Spline * spline = fSplines[m_iter->second];
+      XSecBinSpline entry;
+      entry.key     = strings.size();
+      entry.key_len = key.size();
+      entry.nknots  = spline->NKnots();
+      strings += key;
+
+      // the knots of a spline shared by several keys are written once
+      map<int, uint64_t>::const_iterator k_iter = knot_offsets.find(m_iter->second);
+      if(k_iter != knot_offsets.end()) {
+        entry.knots = k_iter->second; // fixed below
+      } else {
+        entry.knots = nknots_tot;     // fixed below
+        knot_offsets[m_iter->second] = nknots_tot;
+        nknots_tot += 2*entry.nknots;
+        spline_ptrs.push_back(spline);
+      }
+      splines.push_back(entry);
+    }
+    tune.nsplines = splines.size() - tune.first_spline;
+    tunes.push_back(tune);
+  }
+
+  XSecBinHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kXSecBinMagic, sizeof(header.magic));
+  header.byte_order   = kXSecBinOrder;
+  header.version      = kXSecBinVersion;
+  header.uselog       = (fUseLogE ? 1 : 0);
+  header.ntunes       = tunes.size();
+  header.nsplines     = splines.size();
+  header.tune_table   = XSecBinAlign(sizeof(XSecBinHeader));
+  header.spline_table = XSecBinAlign(header.tune_table   + tunes.size()   * sizeof(XSecBinTune));
+  header.strings      = XSecBinAlign(header.spline_table + splines.size() * sizeof(XSecBinSpline));
+  header.knots        = XSecBinAlign(header.strings      + strings.size());
+  header.file_size    = header.knots + nknots_tot * sizeof(double);
+
+  // spline knot offsets: in bytes from the start of the file
+  for(unsigned int i = 0; i < splines.size(); i++) {
+    splines[i].knots = header.knots + splines[i].knots * sizeof(double);
+  }
+
+  const char padding[8] = { 0,0,0,0,0,0,0,0 };
+  out.write((const char *) &header, sizeof(header));
+  out.write(padding, header.tune_table - sizeof(header));
+  if(tunes.size() > 0) {
+    out.write((const char *) &tunes[0], tunes.size() * sizeof(XSecBinTune));
+  }
+  out.write(padding, header.spline_table -
+                (header.tune_table + tunes.size() * sizeof(XSecBinTune)));
+  if(splines.size() > 0) {
+    out.write((const char *) &splines[0], splines.size() * sizeof(XSecBinSpline));
+  }
+  out.write(padding, header.strings -
+                (header.spline_table + splines.size() * sizeof(XSecBinSpline)));
+  out.write(strings.data(), strings.size());
+  out.write(padding, header.knots - (header.strings + strings.size()));
+
+  vector<double> E, xsec;
+  for(unsigned int i = 0; i < spline_ptrs.size(); i++) {
+    const Spline * spline = spline_ptrs[i];
+    int nknots = spline->NKnots();
+    E   .resize(nknots);
+    xsec.resize(nknots);
+    for(int iknot = 0; iknot < nknots; iknot++) {
+      spline->GetKnot(iknot, E[iknot], xsec[iknot]);
+    }
+    if(nknots > 0) {
+      out.write((const char *) &E[0],    nknots * sizeof(double));
+      out.write((const char *) &xsec[0], nknots * sizeof(double));
+    }
+  }
+
+  SLOG("XSecSplLst", pNOTICE)
+     << "Wrote " << splines.size() << " splines (" << spline_ptrs.size()
+     << " distinct) for " << tunes.size() << " tunes in "
+     << header.file_size << " bytes";
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadFromBinary(
+                                         const string & filename, bool keep)
+{
+//! Load XSecSplineList from a binary spline file. The file is memory-mapped,
+//! so its pages are shared by all jobs reading it on the same node, and the
+//! splines are built directly from the mapped knot arrays, with no parsing.
+//! If keep = true, then the loaded splines are added to the existing list.
+//! If false, then the existing list is reset before loading the splines.
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Loading binary splines from: " << filename;
+  SLOG("XSecSplLst", pINFO)
+    << "Option to keep pre-existing splines is switched "
+    << ( (keep) ? "ON" : "OFF" );
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary spline file could not be found! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (uint64_t) st.st_size < sizeof(XSecBinHeader)) {
+    LOG("XSecSplLst", pERROR)
+          << "\nInvalid binary spline file! [filename: " << filename << "]";
+    close(fd);
+    return kXmlInvalidRoot;
+  }
+  uint64_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("XSecSplLst", pERROR)
+          << "\nCould not map binary spline file! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+
+  // the deferred splines of a lazily loaded file point into the mapped file
+  XmlParserStatus_t status =
+     this->LoadFromImage((const char *) addr, size, filename, keep, fLazyLoading);
+  if(fLazyLoading && status == kXmlOK) {
+    fMappedFiles.push_back(pair<void *, size_t>(addr, size));
+  } else {
+    munmap(addr, size);
+  }
+  return status;
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadFromSharedMemory(
+                                         const string & filename, bool keep)
+{
+//! Load XSecSplineList from the node-wide shared memory image of the input
+//! (XML or binary) spline file. The first job on the node to load a given
+//! file reads it and publishes its binary image in a shared memory segment.
+//! The other jobs attach to the segment read-only: They don't read the file
+//! and their splines are built, on first access, from the shared knots.
+//! If the segment can't be used, the file is loaded privately.
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Loading splines from: " << filename << " via shared memory";
+
+  string name = SharedMemSegment::SegmentName("genie-xspl", filename);
+
+  SharedMemSegment * segment = new SharedMemSegment;
+  SharedMemStatus_t shm_status = segment->Open(name);
+
+  if(shm_status == kShmCreated) {
+    // Build the image of the file alone (all tunes): load it in an empty
+    // list, and restore the current one afterwards
+    map<string, map<string, int> > spline_map;
+    map<string, set<string> >      loaded_set;
+    map<int, DeferredSpline>       deferred;
+    vector<Spline *>               splines;
+    map<unsigned long, vector<int> > digests;
+    std::swap(spline_map, fSplineMap);
+    std::swap(loaded_set, fLoadedSplineSet);
+    std::swap(deferred,   fDeferredSplines);
+    std::swap(splines,    fSplines);
+    std::swap(digests,    fSplineDigests);
+    bool lazy = fLazyLoading;
+    bool uselog = fUseLogE;
+    fLazyLoading = false;
+
+    XmlParserStatus_t status = IsBinaryFile(filename) ?
+       this->LoadFromBinary(filename) : this->LoadFromXml(filename);
+    ostringstream image;
+    if(status == kXmlOK) this->WriteBinary(image, true);
+
+    for(unsigned int i = 0; i < fSplines.size(); i++) delete fSplines[i];
+    std::swap(spline_map, fSplineMap);
+    std::swap(loaded_set, fLoadedSplineSet);
+    std::swap(deferred,   fDeferredSplines);
+    std::swap(splines,    fSplines);
+    std::swap(digests,    fSplineDigests);
+    fLazyLoading = lazy;
+    fUseLogE     = uselog;
+
+    if(status != kXmlOK) {
+      segment->Abandon();
+      delete segment;
+      return status;
+    }
+    string data = image.str();
+    if(!segment->Publish(data.data(), data.size())) shm_status = kShmFailed;
+  }
+
+  if(shm_status != kShmFailed) {
+    // the deferred splines point into the segment, which is kept mapped
+    XmlParserStatus_t status = this->LoadFromImage(
+        (const char *) segment->Data(), segment->Size(), name, keep, true);
+    if(status == kXmlOK) {
+      fSharedSegments.push_back(segment);
+      return kXmlOK;
+    }
+  }
+  delete segment;
+
+  SLOG("XSecSplLst", pWARN)
+    << "Couldn't use shared memory - Loading splines from: " << filename;
+  return IsBinaryFile(filename) ?
+     this->LoadFromBinary(filename, keep) : this->LoadFromXml(filename, keep);
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadFromImage(const char * data,
+       size_t size, const string & source, bool keep, bool defer)
+{
+//! Load splines from a binary image (a mapped binary spline file or a shared
+//! memory segment). If defer = true, the splines are built on first access
+//! from the knots in the image, which must then stay mapped.
+
+  if(!data || size < sizeof(XSecBinHeader)) {
+    LOG("XSecSplLst", pERROR)
+       << "\nInvalid binary spline image! [source: " << source << "]";
+    return kXmlInvalidRoot;
+  }
+
+  // check the header and the consistency of the offsets
+  const XSecBinHeader * header = (const XSecBinHeader *) data;
+  if(memcmp(header->magic, kXSecBinMagic, sizeof(header->magic)) != 0 ||
+     header->byte_order != kXSecBinOrder ||
+     header->version    != kXSecBinVersion) {
+    LOG("XSecSplLst", pERROR)
+       << "\nBinary spline image has an invalid header, a wrong byte order or "
+       << "an unsupported version! [source: " << source << "]";
+    return kXmlInvalidRoot;
+  }
+  bool ok =
+     header->file_size == size &&
+     header->tune_table   + header->ntunes   * sizeof(XSecBinTune)   <= size &&
+     header->spline_table + header->nsplines * sizeof(XSecBinSpline) <= size &&
+     header->strings <= size && header->knots <= size;
+  if(!ok) {
+    LOG("XSecSplLst", pERROR)
+       << "\nBinary spline image is truncated or corrupted! [source: " << source << "]";
+    return kXmlNotParsed;
+  }
+
+  if(!keep) {
+    fSplineMap.clear();
+    fDeferredSplines.clear();
+    fSplineDigests.clear();
+  }
+
+  this->SetLogE(header->uselog == 1);
+
+  const XSecBinTune *   tunes   = (const XSecBinTune *)   (data + header->tune_table);
+  const XSecBinSpline * splines = (const XSecBinSpline *) (data + header->spline_table);
+  const char *          strings = data + header->strings;
+  uint64_t              nstring = header->knots - header->strings;
+
+  XmlParserStatus_t status = kXmlOK;
+  int nloaded = 0;
+  map<uint64_t, int> image_knots; // knots offset -> handle of the deferred splines
+
+  for(uint32_t itune = 0; itune < header->ntunes && status == kXmlOK; itune++) {
+    const XSecBinTune & tune = tunes[itune];
+    if(tune.name + tune.name_len > nstring ||
+       tune.first_spline + tune.nsplines > header->nsplines) {
+      status = kXmlNotParsed;
+      break;
+    }
+    string tune_name(strings + tune.name, tune.name_len);
+
+    // in lazy-loading mode only the current tune is read in
+    if(fLazyLoading && fCurrentTune.size() > 0 && tune_name != fCurrentTune) {
+      SLOG("XSecSplLst", pNOTICE)
+        << "Skipping x-section splines for GENIE tune: " << tune_name;
+      continue;
+    }
+    SLOG("XSecSplLst", pNOTICE)
+      << "Loading x-section splines for GENIE tune: " << tune_name;
+
+    for(uint64_t i = 0; i < tune.nsplines; i++) {
+      const XSecBinSpline & entry = splines[tune.first_spline + i];
+      if(entry.key + entry.key_len > nstring ||
+         entry.knots + 2 * entry.nknots * sizeof(double) > size ||
+         entry.knots % sizeof(double) != 0) {
+        status = kXmlNotParsed;
+        break;
+      }
+      string key(strings + entry.key, entry.key_len);
+      SLOG("XSecSplLst", pINFO) << "Loading spline: " << key;
+
+      const double * knots = (const double *) (data + entry.knots);
+      if(defer) {
+        // keep pointing to the mapped knots until the spline is accessed;
+        // keys sharing their knots in the image share the spline
+        map<uint64_t, int>::const_iterator k_iter = image_knots.find(entry.knots);
+        if(k_iter != image_knots.end()) {
+          this->ShareSpline(tune_name, key, k_iter->second);
+        } else if(this->AddDeferred(tune_name, key, knots, entry.nknots)) {
+          image_knots[entry.knots] = fSplines.size()-1;
+        }
+      } else {
+        this->AddLoadedSpline(tune_name, key,
+                 knots, knots + entry.nknots, entry.nknots, false);
+      }
+      fLoadedSplineSet[tune_name].insert(key);
+      nloaded++;
+    }
+  }
+
+  if(status != kXmlOK) {
+    LOG("XSecSplLst", pERROR)
+       << "\nBinary spline image is corrupted! [source: " << source << "]";
+    return status;
+  }
+
+  SLOG("XSecSplLst", pNOTICE)
+       << "Loaded " << nloaded << " splines from " << source;
+
   return kXmlOK;
 }
 //____________________________________________________________________________
+bool XSecSplineList::IsBinaryFile(const string & filename)
+{
+// Checks the file signature (the file extension is not used)
+
+  ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!in.is_open()) return false;
+  char magic[8];
+  in.read(magic, sizeof(magic));
+  if(in.gcount() != (std::streamsize) sizeof(magic)) return false;
+  return (memcmp(magic, kXSecBinMagic, sizeof(magic)) == 0);
+}
+//____________________________________________________________________________
+bool XSecSplineList::AddSpline(
+              const string & tune, const string & key, Spline * spline)
+{
+// Insert the spline to the list: the spline is appended to the flat spline
+// store and its handle is added to the key index of the given tune.
+// A null spline is a placeholder for a deferred spline (see AddDeferred)
+
+  map<string, int> & spl_map_tune = fSplineMap[tune];
+  bool inserted = spl_map_tune.insert(
+       map<string, int>::value_type(key, (int) fSplines.size()) ).second;
+  if(!inserted) {
+    // keep the spline that was already in the list
+    SLOG("XSecSplLst", pWARN)
+       << "Spline " << key << " for tune " << tune << " was already loaded";
+    delete spline;
+    return false;
+  }
+  fSplines.push_back(spline);
+  return true;
+}
+//____________________________________________________________________________
+XSecSplineList::DeferredSpline * XSecSplineList::AddDeferred(
+  const string & tune, const string & key, const double * knots, int nknots)
+{
+// Index a spline that is to be decoded on first access. If the knots are not
+// in a mapped file (knots = 0) the caller fills in the returned buffer.
+// Returns 0 if the spline was already in the list
+
+  if(!this->AddSpline(tune, key, 0)) return 0;
+
+  DeferredSpline & deferred = fDeferredSplines[fSplines.size()-1];
+  deferred.knots  = knots;
+  deferred.nknots = nknots;
+  return &deferred;
+}
+//____________________________________________________________________________
+Spline * XSecSplineList::DecodeSpline(int handle)
+{
+// Build the Spline for a deferred spline and replace the placeholder in the
+// flat spline store. The deferred knots are released.
+
+  if(handle < 0 || handle >= (int) fSplines.size()) return 0;
+  if(fSplines[handle] != 0) return fSplines[handle]; // decoded meanwhile
+
+  map<int, DeferredSpline>::iterator d_iter = fDeferredSplines.find(handle);
+  if(d_iter == fDeferredSplines.end()) return 0;
+
+  const DeferredSpline & deferred = d_iter->second;
+  int nknots = deferred.nknots;
+  const double * knots = deferred.knots;
+  if(!knots && deferred.buffer.size() == (size_t) 2*nknots && nknots > 0) {
+    knots = &deferred.buffer[0];
+  }
+
+  Spline * spline = 0;
+  if(knots && nknots > 0) {
+    // Spline's ctor does not take const input
+    vector<double> E   (knots,          knots +   nknots);
+    vector<double> xsec(knots + nknots, knots + 2*nknots);
+    spline = new Spline(nknots, &E[0], &xsec[0]);
+  } else {
+    spline = new Spline;
+  }
+  SLOG("XSecSplLst", pINFO) << "Decoded spline with handle: " << handle;
+
+  fSplines[handle] = spline;
+  fDeferredSplines.erase(d_iter);
+
+  return spline;
+}
+//____________________________________________________________________________
+void XSecSplineList::DecodeAll(void)
+{
+  std::lock_guard<std::mutex> guard(gXSecSplineDecodeLock);
+
+  // DecodeSpline erases the deferred entries: copy the handles first
+  vector<int> handles;
+  map<int, DeferredSpline>::const_iterator d_iter = fDeferredSplines.begin();
+  for( ; d_iter != fDeferredSplines.end(); ++d_iter) {
+    handles.push_back(d_iter->first);
+  }
+  for(unsigned int i = 0; i < handles.size(); i++) {
+    this->DecodeSpline(handles[i]);
+  }
+  fDeferredSplines.clear();
+}
+//____________________________________________________________________________
+int XSecSplineList::AddLoadedSpline(const string & tune, const string & key,
+   const double * E, const double * xsec, int nknots, bool defer)
+{
+// Add a spline read in from a file. If a spline with identical knots was
+// loaded already (eg for another tune), the key is mapped to its handle.
+// Otherwise the spline is built (or, if defer = true, its knots are kept
+// until it is first accessed). Returns the handle, or -1 if the key was
+// already in the list.
+
+  unsigned long digest = 0;
+  int handle = this->FindDuplicate(E, xsec, nknots, digest);
+  if(handle >= 0) {
+    return this->ShareSpline(tune, key, handle) ? handle : -1;
+  }
+
+  if(defer) {
+    DeferredSpline * deferred = this->AddDeferred(tune, key, 0, nknots);
+    if(!deferred) return -1;
+    deferred->buffer.reserve(2*nknots);
+    deferred->buffer.insert(deferred->buffer.end(), E,    E    + nknots);
+    deferred->buffer.insert(deferred->buffer.end(), xsec, xsec + nknots);
+  } else {
+    Spline * spline = 0;
+    if(nknots > 0) {
+      // Spline's ctor does not take const input
+      vector<double> vE   (E,    E    + nknots);
+      vector<double> vxsec(xsec, xsec + nknots);
+      spline = new Spline(nknots, &vE[0], &vxsec[0]);
+    } else {
+      spline = new Spline;
+    }
+    if(!this->AddSpline(tune, key, spline)) return -1;
+  }
+  handle = fSplines.size()-1;
+  fSplineDigests[digest].push_back(handle);
+  return handle;
+}
+//____________________________________________________________________________
+int XSecSplineList::FindDuplicate(const double * E, const double * xsec,
+                             int nknots, unsigned long & digest) const
+{
+// Computes the digest (64-bit FNV-1a hash) of the input knots and returns the
+// handle of a loaded spline with identical knots (-1 if there is none)
+
+  uint64_t h = 14695981039346656037ULL;
+  const unsigned char * bytes = (const unsigned char *) &nknots;
+  for(unsigned int i = 0; i < sizeof(nknots); i++) {
+    h = (h ^ bytes[i]) * 1099511628211ULL;
+  }
+  if(nknots > 0) {
+    const double * arrays[2] = { E, xsec };
+    for(int a = 0; a < 2; a++) {
+      bytes = (const unsigned char *) arrays[a];
+      for(size_t i = 0; i < nknots * sizeof(double); i++) {
+        h = (h ^ bytes[i]) * 1099511628211ULL;
+      }
+    }
+  }
+  digest = (unsigned long) h;
+
+  map<unsigned long, vector<int> >::const_iterator d_iter = fSplineDigests.find(digest);
+  if(d_iter == fSplineDigests.end()) return -1;
+
+  const vector<int> & handles = d_iter->second;
+  for(unsigned int i = 0; i < handles.size(); i++) {
+    if(this->SameKnots(handles[i], E, xsec, nknots)) return handles[i];
+  }
+  return -1;
+}
+//____________________________________________________________________________
+bool XSecSplineList::SameKnots(int handle,
+           const double * E, const double * xsec, int nknots) const
+{
+// Checks whether the spline with the input handle (decoded or not) has the
+// input knots
+
+  if(handle < 0 || handle >= (int) fSplines.size()) return false;
+
+  const Spline * spline = fSplines[handle];
+  if(spline) {
+    if(spline->NKnots() != nknots) return false;
+    double x = 0, y = 0;
+    for(int i = 0; i < nknots; i++) {
+      spline->GetKnot(i, x, y);
+      if(x != E[i] || y != xsec[i]) return false;
+    }
+    return true;
+  }
+
+  map<int, DeferredSpline>::const_iterator d_iter = fDeferredSplines.find(handle);
+  if(d_iter == fDeferredSplines.end()) return false;
+  const DeferredSpline & deferred = d_iter->second;
+  if(deferred.nknots != nknots) return false;
+  if(nknots == 0) return true;
+  const double * knots = deferred.knots;
+  if(!knots) {
+    if(deferred.buffer.size() != (size_t) 2*nknots) return false;
+    knots = &deferred.buffer[0];
+  }
+  return memcmp(knots,          E,    nknots * sizeof(double)) == 0 &&
+         memcmp(knots + nknots, xsec, nknots * sizeof(double)) == 0;
+}
+//____________________________________________________________________________
+bool XSecSplineList::SameSpline(int handle1, int handle2) const
+{
+// Checks whether two decoded splines have identical knots
+
+  if(handle1 == handle2) return true;
+  if(handle1 < 0 || handle1 >= (int) fSplines.size()) return false;
+  if(handle2 < 0 || handle2 >= (int) fSplines.size()) return false;
+
+  const Spline * s1 = fSplines[handle1];
+  const Spline * s2 = fSplines[handle2];
+  if(!s1 || !s2 || s1->NKnots() != s2->NKnots()) return false;
+
+  double x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+  for(int i = 0; i < s1->NKnots(); i++) {
+    s1->GetKnot(i, x1, y1);
+    s2->GetKnot(i, x2, y2);
+    if(x1 != x2 || y1 != y2) return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+bool XSecSplineList::ShareSpline(
+                     const string & tune, const string & key, int handle)
+{
+// Map the key of the given tune to an existing spline
+
+  map<string, int> & spl_map_tune = fSplineMap[tune];
+  bool inserted = spl_map_tune.insert(
+       map<string, int>::value_type(key, handle) ).second;
+  if(!inserted) {
+    SLOG("XSecSplLst", pWARN)
+       << "Spline " << key << " for tune " << tune << " was already loaded";
+  }
+  return inserted;
+}
+//____________________________________________________________________________
+void XSecSplineList::InheritTunes(bool init, set<string> & missing)
+{
+// Add to each loaded derived tune the splines of its parent for the keys it
+// doesn't list itself. Parents are completed before the tunes deriving from
+// them. The parents that are not loaded are returned in missing.
+
+  // order the derived tunes by their depth in the derivation chain
+  vector< pair<int, string> > derived;
+  map<string, string>::const_iterator p_iter = fTuneParents.begin();
+  for( ; p_iter != fTuneParents.end(); ++p_iter) {
+    if(fSplineMap.count(p_iter->first) == 0) continue;
+    int depth = 0;
+    string tune = p_iter->first;
+    map<string, string>::const_iterator it;
+    while((it = fTuneParents.find(tune)) != fTuneParents.end()) {
+      tune = it->second;
+      if(++depth > (int) fTuneParents.size()) break;
+    }
+    if(depth > (int) fTuneParents.size()) {
+      LOG("XSecSplLst", pERROR)
+        << "Circular tune derivation for tune: " << p_iter->first;
+      continue;
+    }
+    derived.push_back(pair<int, string>(depth, p_iter->first));
+  }
+  std::sort(derived.begin(), derived.end());
+
+  for(unsigned int i = 0; i < derived.size(); i++) {
+    const string & tune   = derived[i].second;
+    const string & parent = fTuneParents[tune];
+
+    map<string,  map<string, int> >::const_iterator //\/
+    pm_iter = fSplineMap.find(parent);
+    if(pm_iter == fSplineMap.end()) {
+      missing.insert(parent);
+      continue;
+    }
+    map<string, int> & spl_map_tune = fSplineMap[tune];
+    int ninherited = 0;
+    map<string, int>::const_iterator m_iter = pm_iter->second.begin();
+    for( ; m_iter != pm_iter->second.end(); ++m_iter) {
+      if(!spl_map_tune.insert(*m_iter).second) continue;
+      if(init) fLoadedSplineSet[tune].insert(m_iter->first);
+      ninherited++;
+    }
+    if(ninherited > 0) {
+      SLOG("XSecSplLst", pNOTICE)
+        << "Tune " << tune << " inherited " << ninherited
+        << " splines from tune: " << parent;
+    }
+  }
+}
+//____________________________________________________________________________
+void XSecSplineList::SetTuneParent(const string & tune, const string & parent)
+{
+  if(parent.size() == 0) {
+    fTuneParents.erase(tune);
+    return;
+  }
+  if(parent == tune) {
+    LOG("XSecSplLst", pERROR) << "Tune " << tune << " can't derive from itself";
+    return;
+  }
+  fTuneParents[tune] = parent;
+}
+//____________________________________________________________________________
+string XSecSplineList::TuneParent(const string & tune) const
+{
+  map<string, string>::const_iterator it = fTuneParents.find(tune);
+  return (it == fTuneParents.end()) ? "" : it->second;
+}
+//____________________________________________________________________________
+void XSecSplineList::DeclareInitialStates(
+                   const vector<int> & probes, const vector<int> & targets)
+{
+// Declare the initial states (all probe & target combinations) that will be
+// used. In lazy-loading mode the deferred splines of the current tune are
+// decoded if they are for a declared initial state (so that no decoding
+// takes place during event generation) and dropped otherwise.
+// Splines are matched on the probe and target fields of the key, as built
+// by Interaction::AsString(): "nu:<pdg>;tgt:<pdg>;" (or "dm;tgt:<pdg>;")
+
+  if(!fLazyLoading) return;
+
+  set<string> tags;
+  vector<int>::const_iterator p_iter, t_iter;
+  for(p_iter = probes.begin(); p_iter != probes.end(); ++p_iter) {
+    for(t_iter = targets.begin(); t_iter != targets.end(); ++t_iter) {
+      ostringstream tag;
+      if(*p_iter == kPdgDarkMatter) tag << "dm;";
+      else                          tag << "nu:" << *p_iter << ";";
+      tag << "tgt:" << *t_iter << ";";
+      tags.insert(tag.str());
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(gXSecSplineDecodeLock);
+
+  map<string,  map<string, int> >::iterator //\/
+  mm_iter = fSplineMap.find(fCurrentTune);
+  if(mm_iter == fSplineMap.end()) return;
+
+  map<string, int> & spl_map_tune = mm_iter->second;
+  set<string> &      loaded_tune  = fLoadedSplineSet[fCurrentTune];
+
+  vector<string> keep, drop;
+  map<string, int>::const_iterator m_iter = spl_map_tune.begin();
+  for( ; m_iter != spl_map_tune.end(); ++m_iter) {
+    // only the deferred splines are considered
+    if(fDeferredSplines.count(m_iter->second) == 0) continue;
+    const string & key = m_iter->first;
+    // the interaction part of the key follows the algorithm name and config
+    string tag = "";
+    size_t pos = key.find('/');
+    if(pos != string::npos) pos = key.find('/', pos+1);
+    if(pos != string::npos) {
+      string intkey = key.substr(pos+1);
+      size_t tpos = intkey.find("tgt:");
+      size_t epos = (tpos == string::npos) ? tpos : intkey.find(';', tpos);
+      if(epos != string::npos) tag = intkey.substr(0, epos+1);
+    }
+    if(tags.count(tag) == 1) keep.push_back(key);
+    else                     drop.push_back(key);
+  }
+
+  // the knots of splines shared with kept keys or other tunes are kept
+  set<int> used;
+  for(unsigned int i = 0; i < keep.size(); i++) used.insert(spl_map_tune[keep[i]]);
+  map<string,  map<string, int> >::const_iterator //\/
+  ot_iter = fSplineMap.begin();
+  for( ; ot_iter != fSplineMap.end(); ++ot_iter) {
+    if(ot_iter->first == fCurrentTune) continue;
+    for(m_iter = ot_iter->second.begin(); m_iter != ot_iter->second.end(); ++m_iter) {
+      used.insert(m_iter->second);
+    }
+  }
+
+  for(unsigned int i = 0; i < drop.size(); i++) {
+    // the slot in the flat store stays (null) so that handles remain valid
+    int handle = spl_map_tune[drop[i]];
+    if(used.count(handle) == 0) fDeferredSplines.erase(handle);
+    spl_map_tune.erase(drop[i]);
+    loaded_tune .erase(drop[i]);
+  }
+  for(unsigned int i = 0; i < keep.size(); i++) {
+    this->DecodeSpline(spl_map_tune[keep[i]]);
+  }
+
+  SLOG("XSecSplLst", pNOTICE)
+     << "Declared " << tags.size() << " initial states: decoded "
+     << keep.size() << " and dropped " << drop.size()
+     << " splines of tune " << fCurrentTune;
+}
+//____________________________________________________________________________
 string XSecSplineList::BuildSplineKey(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
@@ -543,17 +1679,17 @@ string XSecSplineList::BuildSplineKey(
 //____________________________________________________________________________
 const vector<string> * XSecSplineList::GetSplineKeys(void) const
 {
-  map<string,  map<string, Spline *> >::const_iterator //\/
+  map<string,  map<string, int> >::const_iterator //\/
   mm_iter = fSplineMap.find(fCurrentTune);
   if(mm_iter == fSplineMap.end()) {
     SLOG("XSecSplLst", pWARN)
        << "No splines for tune " << fCurrentTune << " were found!";
     return 0;
   }
-  const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
+  const map<string, int> & spl_map_curr_tune = mm_iter->second;
   vector<string> * keyv = new vector<string>(spl_map_curr_tune.size());
   unsigned int i=0;
-  map<string, Spline *>::const_iterator m_iter = spl_map_curr_tune.begin();
+  map<string, int>::const_iterator m_iter = spl_map_curr_tune.begin();
   for( ; m_iter != spl_map_curr_tune.end(); ++m_iter) {
     string key = m_iter->first;
     (*keyv)[i++]=key;
@@ -572,15 +1708,15 @@ void XSecSplineList::Print(ostream & stream) const
   stream << "\n  |-----o  Spline NKnots............." << fEmax;
   stream << "\n  |";
 
-  map<string, map<string, Spline *> >::const_iterator mm_iter;
+  map<string, map<string, int> >::const_iterator mm_iter;
   for(mm_iter = fSplineMap.begin(); mm_iter != fSplineMap.end(); ++mm_iter) {
 
     string curr_tune = mm_iter->first;
     stream << "\n [-] Available x-section splines for tune: " << curr_tune ;
     stream << "\n  |";
 
-    const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-    map<string, Spline *>::const_iterator m_iter = spl_map_curr_tune.begin();
+    const map<string, int> & spl_map_curr_tune = mm_iter->second;
+    map<string, int>::const_iterator m_iter = spl_map_curr_tune.begin();
     for( ; m_iter != spl_map_curr_tune.end(); ++m_iter) {
       string key = m_iter->first;
       stream << "\n  |-----o  " << key;
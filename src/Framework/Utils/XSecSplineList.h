@@ -5,6 +5,33 @@
 
 \brief    List of cross section vs energy splines
 
+          In lazy-loading mode (see SetLazyLoading(), or set the GSPLLAZY
+          env. var) only the splines of the current tune are read in, and
+          each one is decoded into a Spline only on first access. Event
+          generation drivers can further declare the initial states they
+          need (DeclareInitialStates()), so that all other splines are
+          dropped and the ones needed are decoded up-front.
+
+          With adaptive knots (see SetAdaptiveKnots()) each spline starts from
+          a coarse grid. The intervals where the cross section at the midpoint
+          differs from the interpolated one by more than the tolerance are
+          bisected recursively, up to the knot budget of the spline.
+
+          With shared memory (see LoadFromSharedMemory(), or set the GSPLSHM
+          env. var for the apps) all jobs on a node share a single read-only
+          copy of the spline knots, built by the first job. Splines are
+          decoded privately, on first access (combine with GSPLLAZY to skip
+          the tunes and initial states that are not needed).
+
+          Loaded splines with identical knots (eg the channels that two tunes
+          differing only in their FSI model have in common) are stored once
+          and share a spline handle. In the XML file a tune can be declared
+          as derived from a parent tune (<genie_tune name=".." parent="..">):
+          it then lists only the splines that differ from the parent's, and
+          inherits all other splines of the parent (see SetTuneParent()).
+          Binary files list all splines of each tune but store the knots of
+          shared splines once.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -19,6 +46,7 @@
 #ifndef _XSEC_SPLINE_LIST_H_
 #define _XSEC_SPLINE_LIST_H_
 
+#include <cstddef>
 #include <ostream>
 #include <map>
 #include <set>
@@ -39,6 +67,8 @@ namespace genie {
 class XSecAlgorithmI;
 class Interaction;
 class Spline;
+class SharedMemSegment;
+class MemoryStats;
 
 class XSecSplineList;
 ostream & operator << (ostream & stream, const XSecSplineList & xsl);
@@ -49,9 +79,35 @@ public:
 
   static XSecSplineList * Instance();
 
-  // Save/load to/from XML file
+  // Save/load to/from XML file.
+  // Splines loaded with init = false are not part of the initial set (they
+  // are saved even with save_init = false, eg when resuming from a checkpoint)
   void               SaveAsXml   (const string & filename, bool save_init = true) const;
-  XmlParserStatus_t  LoadFromXml (const string & filename, bool keep = false);
+  XmlParserStatus_t  LoadFromXml (const string & filename, bool keep = false, bool init = true);
+
+  // Save/load to/from the compact binary format (memory-mapped when loading).
+  // XML remains the interchange format; binary files are produced from it
+  // (see gspl2bin) for fast job start-up
+  void               SaveAsBinary   (const string & filename, bool save_init = true) const;
+  XmlParserStatus_t  LoadFromBinary (const string & filename, bool keep = false);
+  static bool        IsBinaryFile   (const string & filename);
+
+  // Load via a node-wide shared memory image of the input (XML or binary)
+  // file, built by the first job on the node and attached to by the others.
+  // SharedMemory() tells whether this is the default (GSPLSHM env. var. set)
+  XmlParserStatus_t  LoadFromSharedMemory (const string & filename, bool keep = false);
+  void   SetSharedMemory (bool on) { fSharedMemory = on;   }
+  bool   SharedMemory    (void) const { return fSharedMemory; }
+
+  // Lazy loading: Set before loading splines. Only the splines of the
+  // current tune are indexed at load time and decoded on first access
+  void   SetLazyLoading (bool on) { fLazyLoading = on;   }
+  bool   LazyLoading    (void) const { return fLazyLoading; }
+
+  // Declare the probe and target PDG codes (all combinations) that will be
+  // used. In lazy-loading mode, the not-yet-decoded splines of the current
+  // tune for other initial states are dropped and the rest are decoded
+  void   DeclareInitialStates (const vector<int> & probes, const vector<int> & targets);
 
   // Print available splines
   void   Print (ostream & stream) const;
@@ -64,6 +120,12 @@ public:
   string CurrentTune    (void) const  { return fCurrentTune; }
   bool   HasSplineFromTune( const string & tune ) const { return fSplineMap.count(tune) > 0 ; }
 
+  // Declare a tune as derived from a parent tune: in the XML output it only
+  // lists the splines that differ from the parent's (parent = "" to undo).
+  // Set when a derived tune is loaded
+  void   SetTuneParent  (const string & tune, const string & parent);
+  string TuneParent     (const string & tune) const;
+
   // Query the existence, access or create a spline
   // The results of the following methods depend on the current tune setting
   bool           SplineExists (const XSecAlgorithmI * alg, const Interaction * i) const;
@@ -72,6 +134,44 @@ public:
   const Spline * GetSpline    (string spline_key) const;
   void           CreateSpline (const XSecAlgorithmI * alg, const Interaction * i,
                                int nknots = -1, double e_min = -1, double e_max = -1);
+
+  // Spline handles: the key lookup is done once (eg at configuration time)
+  // and the handle is then used for O(1) access to the spline. A handle is
+  // valid for the lifetime of the list; -1 means that no spline was found
+  int            GetSplineHandle (const XSecAlgorithmI * alg, const Interaction * i) const;
+  int            GetSplineHandle (string spline_key) const;
+  const Spline * GetSpline       (int handle) const;
+
+  // Spline creation in steps, so that the knots can be computed elsewhere
+  // (eg in parallel, see gmkspl). If queuing is switched on, CreateSpline()
+  // only places the knots and queues the spline. Its cross section at each
+  // knot (KnotXSec(), or KnotXSecBatch() for a set of knots integrated in
+  // one batch) is then computed by the caller and the spline is added to the
+  // list by CreateSpline(queued_spline, E, xsec).
+  // With adaptive knots, the queued knots are the initial (coarse) grid, to
+  // be refined by the caller with RefineKnots() (or use ComputeKnots())
+  struct QueuedSpline {
+    const XSecAlgorithmI * alg;
+    Interaction *          interaction; ///< owned copy
+    string                 key;
+    vector<double>         E;           ///< (initial) knot energies
+    int                    nknots;      ///< knot budget
+  };
+  void   SetQueueSplines    (bool on) { fQueueSplines = on; }
+  bool   QueueSplines       (void) const { return fQueueSplines; }
+  const vector<QueuedSpline> & QueuedSplines (void) const { return fQueuedSplines; }
+  void   ClearQueuedSplines (void);
+  double KnotXSec           (const XSecAlgorithmI * alg, Interaction * i, double E) const;
+  void   KnotXSecBatch      (const XSecAlgorithmI * alg, const Interaction * i,
+                             const vector<double> & E, vector<double> & xsec) const;
+  void   ComputeKnots       (const QueuedSpline & queued,
+                             vector<double> & E, vector<double> & xsec) const;
+  void   RefineKnots        (vector<double> & E, vector<double> & xsec,
+                             const vector<double> & Etest, const vector<double> & xsec_test,
+                             int budget, vector<double> & Enext) const;
+  void   CreateSpline       (const QueuedSpline & queued,
+                             const vector<double> & E, const vector<double> & xsec);
+
   int  NSplines (void) const;
   bool IsEmpty  (void) const;
 
@@ -86,10 +186,13 @@ public:
   void   SetNKnots (int    nk); ///< set default number of knots for building the spline
   void   SetMinE   (double Ev); ///< set default minimum energy for xsec splines
   void   SetMaxE   (double Ev); ///< set default maximum energy for xsec splines
+  void   SetAdaptiveKnots (bool on, double tol = 1E-3); ///< set opt to place knots adaptively, with given rel. interpolation error tolerance
   bool   UseLogE   (void) const { return fUseLogE;  }
   int    NKnots    (void) const { return fNKnots;   }
   double Emin      (void) const { return fEmin;     }
   double Emax      (void) const { return fEmax;     }
+  bool   AdaptiveKnots     (void) const { return fAdaptiveKnots; }
+  double AdaptiveTolerance (void) const { return fAdaptiveTol;   }
 
 private:
 
@@ -97,18 +200,64 @@ private:
   XSecSplineList(const XSecSplineList & spline_list);
   virtual ~XSecSplineList();
 
+  //! knots of a spline, indexed at load time but not decoded yet
+  struct DeferredSpline {
+    const double * knots;  ///< nknots energies followed by nknots xsecs (in a mapped file)
+    int            nknots;
+    vector<double> buffer; ///< used instead of knots when those are not in a mapped file
+  };
+
+  bool             AddSpline    (const string & tune, const string & key, Spline * spline);
+  DeferredSpline * AddDeferred  (const string & tune, const string & key,
+                                 const double * knots, int nknots);
+  Spline *         DecodeSpline (int handle);
+  void             DecodeAll    (void);
+
+  // content deduplication of the loaded splines
+  int              FindDuplicate  (const double * E, const double * xsec, int nknots,
+                                   unsigned long & digest) const;
+  bool             SameKnots      (int handle, const double * E, const double * xsec,
+                                   int nknots) const;
+  bool             SameSpline     (int handle1, int handle2) const;
+  bool             ShareSpline    (const string & tune, const string & key, int handle);
+  int              AddLoadedSpline(const string & tune, const string & key,
+                                   const double * E, const double * xsec, int nknots,
+                                   bool defer);
+  void             InheritTunes   (bool init, set<string> & missing);
+
+  static void      ReportMemory   (MemoryStats & stats);
+
+  void               WriteBinary   (ostream & out, bool save_init) const;
+  XmlParserStatus_t  LoadFromImage (const char * data, size_t size,
+                                    const string & source, bool keep, bool defer);
+
   static XSecSplineList * fInstance;
 
   bool   fUseLogE;
+  bool   fLazyLoading;
+  bool   fSharedMemory;
+  bool   fQueueSplines;
+  bool   fAdaptiveKnots;
+  double fAdaptiveTol;
   int    fNKnots;
   double fEmin;
   double fEmax;
 
   string fCurrentTune; ///< The `active' tune, out the many that can co-exist
 
-  map<string, map<string, Spline *> > fSplineMap;       ///< tune -> { xsec_alg/xsec_config/interaction -> Spline }
+  map<string, map<string, int>      > fSplineMap;       ///< tune -> { xsec_alg/xsec_config/interaction -> spline handle }
   map<string, set<string>           > fLoadedSplineSet; ///< tune -> { set of initialy loaded splines             }
 
+  vector<Spline *>                          fSplines;         ///< flat spline store, indexed by spline handle (null if not decoded yet)
+  map<int, DeferredSpline>                  fDeferredSplines; ///< handle -> knots for splines not decoded yet
+  vector< pair<void *, size_t> >            fMappedFiles;     ///< binary spline files kept mapped for lazy decoding
+  vector<SharedMemSegment *>                fSharedSegments;  ///< shared memory spline images kept mapped for decoding
+  map<unsigned long, vector<int> >          fSplineDigests;   ///< knot content digest -> handles of the loaded splines with that content
+  map<string, string>                       fTuneParents;     ///< derived tune -> parent tune
+  set<string>                               fXmlPassTunes;    ///< if not empty, the only tunes LoadFromXml() reads in (to fetch parent tunes)
+
+  vector<QueuedSpline> fQueuedSplines; ///< splines queued by CreateSpline() for computation by the caller
+
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
@@ -0,0 +1,465 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <vector>
+#include <stdint.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "libxml/parser.h"
+#include "libxml/xmlmemory.h"
+#include "libxml/xmlreader.h"
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/XSecSplineMerger.h"
+#include "Framework/Utils/XSecSplineBinFormat.h"
+
+using std::endl;
+using std::setw;
+using std::setfill;
+using std::setprecision;
+using std::vector;
+using std::ifstream;
+
+using namespace genie;
+
+//____________________________________________________________________________
+XSecSplineMerger::XSecSplineMerger() :
+fFilename    (""),
+fBinary      (false),
+fUseLog      (-1),
+fOut         (0),
+fTune        (""),
+fKnotBytes   (0),
+fNSplines    (0),
+fNDuplicates (0)
+{
+
+}
+//____________________________________________________________________________
+XSecSplineMerger::~XSecSplineMerger()
+{
+  if(fOut) this->Close();
+}
+//____________________________________________________________________________
+bool XSecSplineMerger::Open(const string & filename, bool binary)
+{
+  if(fOut) this->Close();
+
+  fFilename    = filename;
+  fBinary      = binary;
+  fUseLog      = -1;
+  fTune        = "";
+  fKnotBytes   = 0;
+  fNSplines    = 0;
+  fNDuplicates = 0;
+  fIndex.clear();
+
+  // binary output: the knots are written to a temporary file and copied
+  // after the tables, which are only known once all inputs are read
+  string outname = (binary) ? filename + ".knots.tmp" : filename;
+  fOut = (binary) ?
+     new ofstream(outname.c_str(), std::ios::out | std::ios::binary) :
+     new ofstream(outname.c_str());
+  if(!fOut->is_open()) {
+    LOG("XSecSplMrg", pERROR) << "Couldn't create file = " << outname;
+    delete fOut;
+    fOut = 0;
+    return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineMerger::Add(const string & filename)
+{
+  if(!fOut) {
+    LOG("XSecSplMrg", pERROR) << "No output file is open";
+    return kXmlNotParsed;
+  }
+
+  int nsplines = fNSplines;
+  int ndup     = fNDuplicates;
+
+  XmlParserStatus_t status = XSecSplineList::IsBinaryFile(filename) ?
+                     this->AddBinary(filename) : this->AddXml(filename);
+
+  LOG("XSecSplMrg", pNOTICE)
+     << "Merged " << fNSplines - nsplines << " splines from " << filename
+     << " (" << fNDuplicates - ndup << " duplicates dropped)";
+  return status;
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineMerger::AddXml(const string & filename)
+{
+// Stream the splines of the input XML file. The parsing follows the one in
+// XSecSplineList::LoadFromXml()
+
+  const int kNodeTypeStartElement = 1;
+  const int kNodeTypeEndElement   = 15;
+  const int kKnotX                = 0;
+  const int kKnotY                = 1;
+
+  int ret = 0, val_type = -1, iknot = 0, nknots = 0;
+  vector<double> E, xsec;
+  string spline_name = "";
+  string tune = "";
+
+  xmlTextReaderPtr reader = xmlNewTextReaderFilename(filename.c_str());
+  if(reader == NULL) {
+    LOG("XSecSplMrg", pERROR)
+          << "\nXML file could not be found! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+
+  ret = xmlTextReaderRead(reader);
+  while (ret == 1) {
+    xmlChar * name  = xmlTextReaderName     (reader);
+    xmlChar * value = xmlTextReaderValue    (reader);
+    int       type  = xmlTextReaderNodeType (reader);
+    int       depth = xmlTextReaderDepth    (reader);
+
+    if(depth==0 && type==kNodeTypeStartElement) {
+      if(xmlStrcmp(name, (const xmlChar *) "genie_xsec_spline_list")) {
+        LOG("XSecSplMrg", pERROR)
+          << "\nXML doc. has invalid root element! [filename: " << filename << "]";
+        xmlFree(name);
+        xmlFree(value);
+        xmlFreeTextReader(reader);
+        return kXmlInvalidRoot;
+      }
+      xmlChar * xinlog = xmlTextReaderGetAttribute(reader,(const xmlChar*)"uselog");
+      string sinlog = utils::str::TrimSpaces((const char *)xinlog);
+      this->SetUseLog(atoi(sinlog.c_str()) == 1, filename);
+      xmlFree(xinlog);
+    }
+
+    if( (!xmlStrcmp(name, (const xmlChar *) "genie_tune")) && type==kNodeTypeStartElement) {
+      xmlChar * xtune = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
+      tune = utils::str::TrimSpaces((const char *)xtune);
+      xmlFree(xtune);
+    }
+
+    if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeStartElement) {
+      xmlChar * xname = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
+      xmlChar * xnkn  = xmlTextReaderGetAttribute(reader,(const xmlChar*)"nknots");
+      spline_name = utils::str::TrimSpaces((const char *)xname);
+      nknots      = atoi( utils::str::TrimSpaces((const char *)xnkn).c_str() );
+      iknot = 0;
+      E   .assign(nknots, 0.);
+      xsec.assign(nknots, 0.);
+      xmlFree(xname);
+      xmlFree(xnkn);
+    }
+
+    if( (!xmlStrcmp(name, (const xmlChar *) "E"))    && type==kNodeTypeStartElement) { val_type = kKnotX; }
+    if( (!xmlStrcmp(name, (const xmlChar *) "xsec")) && type==kNodeTypeStartElement) { val_type = kKnotY; }
+
+    if( (!xmlStrcmp(name, (const xmlChar *) "#text")) && depth==5 && iknot < nknots) {
+      if      (val_type==kKnotX) E   [iknot] = atof((const char *)value);
+      else if (val_type==kKnotY) xsec[iknot] = atof((const char *)value);
+    }
+    if( (!xmlStrcmp(name, (const xmlChar *) "knot")) && type==kNodeTypeEndElement) {
+      iknot++;
+    }
+    if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeEndElement) {
+      this->Write(tune, spline_name, nknots,
+                  (nknots > 0) ? &E[0] : 0, (nknots > 0) ? &xsec[0] : 0);
+    }
+    xmlFree(name);
+    xmlFree(value);
+    ret = xmlTextReaderRead(reader);
+  }
+  xmlFreeTextReader(reader);
+
+  if (ret != 0) {
+    LOG("XSecSplMrg", pERROR)
+      << "\nXML file could not be parsed! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  return kXmlOK;
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineMerger::AddBinary(const string & filename)
+{
+// Stream the splines of the input binary file, straight from the mapped file
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("XSecSplMrg", pERROR)
+          << "\nBinary spline file could not be found! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (uint64_t) st.st_size < sizeof(XSecBinHeader)) {
+    close(fd);
+    LOG("XSecSplMrg", pERROR)
+          << "\nInvalid binary spline file! [filename: " << filename << "]";
+    return kXmlInvalidRoot;
+  }
+  uint64_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("XSecSplMrg", pERROR)
+          << "\nCould not map binary spline file! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  madvise(addr, size, MADV_SEQUENTIAL);
+
+  const char *          data    = (const char *) addr;
+  const XSecBinHeader * header  = (const XSecBinHeader *) data;
+  bool ok =
+     memcmp(header->magic, kXSecBinMagic, sizeof(header->magic)) == 0 &&
+     header->byte_order == kXSecBinOrder   &&
+     header->version    == kXSecBinVersion &&
+     header->file_size  == size &&
+     header->tune_table   + header->ntunes   * sizeof(XSecBinTune)   <= size &&
+     header->spline_table + header->nsplines * sizeof(XSecBinSpline) <= size &&
+     header->strings <= header->knots && header->knots <= size;
+
+  if(ok) {
+    this->SetUseLog(header->uselog == 1, filename);
+
+    const XSecBinTune *   tunes   = (const XSecBinTune *)   (data + header->tune_table);
+    const XSecBinSpline * splines = (const XSecBinSpline *) (data + header->spline_table);
+    const char *          strings = data + header->strings;
+    uint64_t              nstring = header->knots - header->strings;
+
+    for(uint32_t itune = 0; itune < header->ntunes && ok; itune++) {
+      const XSecBinTune & tune = tunes[itune];
+      if(tune.name + tune.name_len > nstring ||
+         tune.first_spline + tune.nsplines > header->nsplines) {
+        ok = false;
+        break;
+      }
+      string tune_name(strings + tune.name, tune.name_len);
+
+      for(uint64_t i = 0; i < tune.nsplines; i++) {
+        const XSecBinSpline & entry = splines[tune.first_spline + i];
+        if(entry.key + entry.key_len > nstring ||
+           entry.knots + 2 * entry.nknots * sizeof(double) > size ||
+           entry.knots % sizeof(double) != 0) {
+          ok = false;
+          break;
+        }
+        string key(strings + entry.key, entry.key_len);
+        const double * knots = (const double *) (data + entry.knots);
+        this->Write(tune_name, key, entry.nknots, knots, knots + entry.nknots);
+      }
+    }
+  }
+  munmap(addr, size);
+
+  if(!ok) {
+    LOG("XSecSplMrg", pERROR)
+       << "\nBinary spline file is corrupted! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  return kXmlOK;
+}
+//____________________________________________________________________________
+void XSecSplineMerger::SetUseLog(bool uselog, const string & filename)
+{
+  int flag = (uselog) ? 1 : 0;
+  if(fUseLog < 0) {
+    fUseLog = flag;
+    if(!fBinary) {
+      *fOut << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
+      *fOut << endl << endl;
+      *fOut << "<!-- generated by genie::XSecSplineMerger -->";
+      *fOut << endl << endl;
+      *fOut << "<genie_xsec_spline_list "
+            << "version=\"3.00\" uselog=\"" << fUseLog << "\">";
+      *fOut << endl << endl;
+    }
+  }
+  else if(flag != fUseLog) {
+    LOG("XSecSplMrg", pWARN)
+      << "The uselog flag of " << filename << " differs from that of the "
+      << "previous inputs - Keeping uselog = " << fUseLog;
+  }
+}
+//____________________________________________________________________________
+void XSecSplineMerger::Write(const string & tune, const string & key,
+                        int nknots, const double * E, const double * xsec)
+{
+  map<string, pair<long int, int> > & index_tune = fIndex[tune];
+  if(index_tune.count(key) == 1) {
+    LOG("XSecSplMrg", pINFO)
+       << "Spline " << key << " for tune " << tune << " was already merged";
+    fNDuplicates++;
+    return;
+  }
+  index_tune[key] = pair<long int, int>(fKnotBytes, nknots);
+  fNSplines++;
+
+  if(fBinary) {
+    if(nknots > 0) {
+      fOut->write((const char *) E,    nknots * sizeof(double));
+      fOut->write((const char *) xsec, nknots * sizeof(double));
+      fKnotBytes += 2 * nknots * sizeof(double);
+    }
+    return;
+  }
+
+  // same output as XSecSplineList::SaveAsXml() & Spline::SaveAsXml()
+  if(tune != fTune) {
+    if(fTune.size() > 0) *fOut << "  </genie_tune>" << endl;
+    *fOut << "  <genie_tune name=\"" << tune << "\">";
+    *fOut << endl << endl;
+    fTune = tune;
+  }
+  string padding = "    ";
+  *fOut << padding << "<spline name=\"" << key
+        << "\" nknots=\"" << nknots << "\">" << endl;
+  for(int iknot = 0; iknot < nknots; iknot++) {
+    *fOut << std::fixed << setprecision(5);
+    *fOut << "\t<knot>"
+          << " <E> " << setfill(' ') << setw(10) << E[iknot] << " </E>";
+    *fOut << std::scientific << setprecision(10);
+    *fOut << " <xsec> " << setfill(' ') << setw(10) << xsec[iknot] << " </xsec>"
+          << " </knot>" << endl;
+  }
+  *fOut << padding << "</spline>" << endl;
+}
+//____________________________________________________________________________
+bool XSecSplineMerger::Close(void)
+{
+  if(!fOut) return false;
+
+  bool ok = true;
+  if(fBinary) {
+    ok = this->CloseBinary();
+  } else {
+    if(fUseLog < 0) this->SetUseLog(true, fFilename); // no input
+    if(fTune.size() > 0) *fOut << "  </genie_tune>" << endl;
+    *fOut << "</genie_xsec_spline_list>" << endl;
+    ok = fOut->good();
+    fOut->close();
+    delete fOut;
+    fOut = 0;
+  }
+
+  LOG("XSecSplMrg", pNOTICE)
+     << "Wrote " << fNSplines << " splines in " << fFilename
+     << " (" << fNDuplicates << " duplicates dropped)";
+  return ok;
+}
+//____________________________________________________________________________
+bool XSecSplineMerger::CloseBinary(void)
+{
+// Write the header and tables of the binary output (same layout as in
+// XSecSplineList::SaveAsBinary()), followed by the temporary knot file
+
+  string knotfile = fFilename + ".knots.tmp";
+  fOut->close();
+  bool ok = !fOut->fail();
+  delete fOut;
+  fOut = 0;
+
+  vector<XSecBinTune>   tunes;
+  vector<XSecBinSpline> splines;
+  string                strings;
+
+  map<string, map<string, pair<long int, int> > >::const_iterator //\/
+  mm_iter = fIndex.begin();
+  for( ; mm_iter != fIndex.end(); ++mm_iter) {
+    XSecBinTune tune;
+    tune.name         = strings.size();
+    tune.name_len     = mm_iter->first.size();
+    tune.first_spline = splines.size();
+    strings += mm_iter->first;
+
+    map<string, pair<long int, int> >::const_iterator //\/
+    m_iter = mm_iter->second.begin();
+    for( ; m_iter != mm_iter->second.end(); ++m_iter) {
+      XSecBinSpline entry;
+      entry.key     = strings.size();
+      entry.key_len = m_iter->first.size();
+      entry.nknots  = m_iter->second.second;
+      entry.knots   = m_iter->second.first; // fixed below
+      strings += m_iter->first;
+      splines.push_back(entry);
+    }
+    tune.nsplines = splines.size() - tune.first_spline;
+    tunes.push_back(tune);
+  }
+
+  XSecBinHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kXSecBinMagic, sizeof(header.magic));
+  header.byte_order   = kXSecBinOrder;
+  header.version      = kXSecBinVersion;
+  header.uselog       = (fUseLog == 0) ? 0 : 1;
+  header.ntunes       = tunes.size();
+  header.nsplines     = splines.size();
+  header.tune_table   = XSecBinAlign(sizeof(XSecBinHeader));
+  header.spline_table = XSecBinAlign(header.tune_table   + tunes.size()   * sizeof(XSecBinTune));
+  header.strings      = XSecBinAlign(header.spline_table + splines.size() * sizeof(XSecBinSpline));
+  header.knots        = XSecBinAlign(header.strings      + strings.size());
+  header.file_size    = header.knots + fKnotBytes;
+
+  for(unsigned int i = 0; i < splines.size(); i++) {
+    splines[i].knots += header.knots;
+  }
+
+  ofstream out(fFilename.c_str(), std::ios::out | std::ios::binary);
+  if(!out.is_open()) {
+    LOG("XSecSplMrg", pERROR) << "Couldn't create file = " << fFilename;
+    unlink(knotfile.c_str());
+    return false;
+  }
+
+  const char padding[8] = { 0,0,0,0,0,0,0,0 };
+  out.write((const char *) &header, sizeof(header));
+  out.write(padding, header.tune_table - sizeof(header));
+  if(tunes.size() > 0) {
+    out.write((const char *) &tunes[0], tunes.size() * sizeof(XSecBinTune));
+  }
+  out.write(padding, header.spline_table -
+                (header.tune_table + tunes.size() * sizeof(XSecBinTune)));
+  if(splines.size() > 0) {
+    out.write((const char *) &splines[0], splines.size() * sizeof(XSecBinSpline));
+  }
+  out.write(padding, header.strings -
+                (header.spline_table + splines.size() * sizeof(XSecBinSpline)));
+  out.write(strings.data(), strings.size());
+  out.write(padding, header.knots - (header.strings + strings.size()));
+
+  // append the knots
+  ifstream in(knotfile.c_str(), std::ios::in | std::ios::binary);
+  vector<char> buffer(1 << 20);
+  while(in.good()) {
+    in.read(&buffer[0], buffer.size());
+    if(in.gcount() > 0) out.write(&buffer[0], in.gcount());
+  }
+  in.close();
+  unlink(knotfile.c_str());
+
+  ok = ok && out.good() && (uint64_t) out.tellp() == header.file_size;
+  out.close();
+  if(!ok) {
+    LOG("XSecSplMrg", pERROR) << "Failed writing binary file = " << fFilename;
+  }
+  return ok;
+}
+//____________________________________________________________________________
@@ -0,0 +1,86 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::XSecSplineMerger
+
+\brief    Streaming merge of cross section spline files (XML or binary) into
+          a single XML or binary file (see gspladd).
+          The spline records of each input are copied to the output as they
+          are read, without building Spline objects or holding the knots in
+          memory: Only the keys are kept, so that duplicate splines (same
+          tune and key) can be dropped. The first copy of a spline is kept,
+          as with XSecSplineList::LoadFromXml(filename, true).
+          XML output keeps the input order of the splines. Binary output
+          sorts the splines of each tune by key, as XSecSplineList does.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _XSEC_SPLINE_MERGER_H_
+#define _XSEC_SPLINE_MERGER_H_
+
+#include <fstream>
+#include <string>
+#include <map>
+#include <utility>
+
+#include "Framework/Conventions/XmlParserStatus.h"
+
+using std::string;
+using std::map;
+using std::pair;
+using std::ofstream;
+
+namespace genie {
+
+class XSecSplineMerger
+{
+public:
+  XSecSplineMerger();
+ ~XSecSplineMerger();
+
+  //! Open the output file (a binary spline file if binary = true)
+  bool              Open  (const string & filename, bool binary = false);
+
+  //! Copy all the splines of an input (XML or binary) file not already in the output
+  XmlParserStatus_t Add   (const string & filename);
+
+  //! Complete the output file
+  bool              Close (void);
+
+  int NSplines    (void) const { return fNSplines;    }  ///< splines written
+  int NDuplicates (void) const { return fNDuplicates; }  ///< duplicate splines dropped
+
+private:
+  XSecSplineMerger(const XSecSplineMerger & merger);
+
+  XmlParserStatus_t AddXml      (const string & filename);
+  XmlParserStatus_t AddBinary   (const string & filename);
+  void              SetUseLog   (bool uselog, const string & filename);
+  void              Write       (const string & tune, const string & key,
+                                 int nknots, const double * E, const double * xsec);
+  bool              CloseBinary (void);
+
+  string     fFilename;   ///< output file
+  bool       fBinary;     ///< binary output?
+  int        fUseLog;     ///< uselog flag of the output (-1 until the first input is read)
+  ofstream * fOut;        ///< XML output or, for binary output, temporary knot file
+  string     fTune;       ///< tune of the last <genie_tune> block written (XML output)
+  long int   fKnotBytes;  ///< size of the temporary knot file (binary output)
+  int        fNSplines;
+  int        fNDuplicates;
+
+  //! tune -> { key -> (knot offset in the temporary knot file, nknots) }
+  map<string, map<string, pair<long int, int> > > fIndex;
+};
+
+}      // genie namespace
+
+#endif // _XSEC_SPLINE_MERGER_H_
@@ -182,7 +182,7 @@ void AMNuGammaGenerator::AddRecoilNucleon(GHepRecord * evrec) const
   // (for nuclear targets only)
   if (is_nuclear_target) {
     double p = p4.Vect().Mag();
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double m = PDGLibrary::Instance()->Mass(pdgc);
     double E = TMath::Sqrt(m*m+p*p);
     p4.SetE(E);
   }
@@ -128,13 +128,13 @@ InteractionList * DMDISInteractionListGenerator::CreateInteractionList(
 //___________________________________________________________________________
 void DMDISInteractionListGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfigData();
 }
 //____________________________________________________________________________
 void DMDISInteractionListGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfigData();
 }
 //____________________________________________________________________________
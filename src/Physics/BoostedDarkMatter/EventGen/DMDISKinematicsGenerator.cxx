@@ -22,6 +22,7 @@
 #include "Framework/Conventions/KineVar.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Physics/BoostedDarkMatter/EventGen/DMDISKinematicsGenerator.h"
+#include "Physics/Common/KineEnvelope2D.h"
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/RunningThreadInfo.h"
@@ -104,14 +105,18 @@ void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space, or from a tabulated envelope, the max xsec is irrelevant
+  KineEnvelope2D * envelope =
+     (fUseTabulatedEnvelope && !fGenerateUniformly) ?
+          this->TabulatedEnvelope(interaction) : 0;
+  double xsec_max = (fGenerateUniformly || envelope) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid (x,y) pair using the rejection method
 
   double dx = xl.max - xl.min;
   double dy = yl.max - yl.min;
   double gx=-1, gy=-1, gW=-1, gQ2=-1, xsec=-1;
+  double gs=-1, gt=-1, genv=-1;
 
   unsigned int iter = 0;
   bool accept = false;
@@ -127,9 +132,18 @@ void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        throw exception;
      }
 
-     //-- random x,y
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
+     //-- random x,y: uniform, or distributed as the tabulated envelope
+     if(envelope) {
+        double r1 = rnd->RndKine().Rndm();
+        double r2 = rnd->RndKine().Rndm();
+        double r3 = rnd->RndKine().Rndm();
+        genv = envelope->Sample(r1, r2, r3, gs, gt);
+        gx = xl.min + dx * gs;
+        gy = yl.min + dy * gt;
+     } else {
+        gx = xl.min + dx * rnd->RndKine().Rndm();
+        gy = yl.min + dy * rnd->RndKine().Rndm();
+     }
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
      kinematics::UpdateWQ2FromXY(interaction);
@@ -144,8 +158,14 @@ void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
-        double t = xsec_max * rnd->RndKine().Rndm();
+        if(envelope) {
+          if(xsec > genv) {
+            this->RaiseTabulatedEnvelope(envelope, interaction, gs, gt, xsec, genv);
+          }
+        } else {
+          this->AssertXSecLimits(interaction, xsec, xsec_max);
+        }
+        double t = ((envelope) ? genv : xsec_max) * rnd->RndKine().Rndm();
 	double J = 1;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -236,6 +256,8 @@ void DMDISKinematicsGenerator::LoadConfig(void)
   //   an event weight?
     GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Select (x,y) from tabulated envelopes of d2xsec/dxdy?
+    this->LoadTabulatedEnvelopeConfig();
 }
 //____________________________________________________________________________
 double DMDISKinematicsGenerator::ComputeMaxXSec(
@@ -361,3 +383,23 @@ double DMDISKinematicsGenerator::ComputeMaxXSec(
 }
 //___________________________________________________________________________
 
+double DMDISKinematicsGenerator::TabulatedEnvelopeXSec(
+              Interaction * interaction, double s, double t) const
+{
+// d2xsec/dxdy at x = xmin + s*(xmax-xmin), y = ymin + t*(ymax-ymin), as for
+// the kinematics selection
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t W  = kps.Limits(kKVW);
+  if(W.max <=0 || W.min>=W.max) return 0;
+
+  Range1D_t xl = kps.Limits(kKVx);
+  Range1D_t yl = kps.Limits(kKVy);
+
+  interaction->KinePtr()->Setx(xl.min + (xl.max - xl.min) * s);
+  interaction->KinePtr()->Sety(yl.min + (yl.max - yl.min) * t);
+  kinematics::UpdateWQ2FromXY(interaction);
+
+  return fXSecModel->XSec(interaction, kPSxyfE);
+}
+//___________________________________________________________________________
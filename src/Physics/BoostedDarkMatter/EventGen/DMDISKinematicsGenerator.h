@@ -48,8 +48,9 @@ public :
   void Configure(string config);
 
 private:
-  void   LoadConfig      (void);
-  double ComputeMaxXSec  (const Interaction * interaction) const;
+  void   LoadConfig            (void);
+  double ComputeMaxXSec        (const Interaction * interaction) const;
+  double TabulatedEnvelopeXSec (Interaction * interaction, double s, double t) const;
 };
 
 }      // genie namespace
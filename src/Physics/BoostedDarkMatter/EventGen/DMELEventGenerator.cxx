@@ -13,6 +13,9 @@
 */
 //____________________________________________________________________________
 
+#include <map>
+#include <sstream>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgFactory.h"
@@ -45,22 +48,39 @@ using namespace genie::controls;
 using namespace genie::constants;
 using namespace genie::utils;
 
+using std::ostringstream;
+
+//___________________________________________________________________________
+namespace {
+  // the max xsec energy grid filled by each generator, per xsec model,
+  // interaction and energy bin, and its counts of kinematics throws: kept
+  // per thread, as they are filled during event generation
+  struct MaxXSecGrid {
+    MaxXSecGrid() : nevents(0), nthrows(0) { }
+    map<string, double> bins;
+    unsigned long       nevents;
+    unsigned long       nthrows;
+  };
+  thread_local map<const DMELEventGenerator *, MaxXSecGrid> gMaxXSecGrids;
+}
 //___________________________________________________________________________
 DMELEventGenerator::DMELEventGenerator() :
-    KineGeneratorWithCache("genie::DMELEventGenerator")
+    KineGeneratorWithCache("genie::DMELEventGenerator"),
+    fUseMaxXSecGrid(false)
 {
 
 }
 //___________________________________________________________________________
 DMELEventGenerator::DMELEventGenerator(string config) :
-    KineGeneratorWithCache("genie::DMELEventGenerator", config)
+    KineGeneratorWithCache("genie::DMELEventGenerator", config),
+    fUseMaxXSecGrid(false)
 {
 
 }
 //___________________________________________________________________________
 DMELEventGenerator::~DMELEventGenerator()
 {
-
+    gMaxXSecGrids.erase(this);
 }
 //___________________________________________________________________________
 void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
@@ -106,7 +126,12 @@ void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
     //   value is found.
     //   If the kinematics are generated uniformly over the allowed phase
     //   space the max xsec is irrelevant
-    double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+    double * xsec_max_bin = 0;
+    double   xsec_max     = -1;
+    if(!fGenerateUniformly) {
+        if(fUseMaxXSecGrid) xsec_max_bin = this->MaxXSecGridBin(interaction);
+        xsec_max = (xsec_max_bin) ? *xsec_max_bin : this->MaxXSec(evrec);
+    }
     
     //
     // Try to generate (simultaneously):
@@ -292,7 +317,15 @@ void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
         double xsec = this->ComputeXSec(interaction, costheta, phi);
      
         // select/reject event
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
+        if(xsec_max_bin && xsec > xsec_max) {
+            // raise the grid bin for the next events
+            LOG("DMELEvent", pWARN)
+                << "xsec: (curr) = " << xsec << " > (max) = " << xsec_max
+                << " - Raising the max xsec grid\n for " << *interaction;
+            *xsec_max_bin = TMath::Max(*xsec_max_bin, fSafetyFactor * xsec);
+        } else {
+            this->AssertXSecLimits(interaction, xsec, xsec_max);
+        }
 
         double t = xsec_max * rnd->RndKine().Rndm();
         //        LOG("DMELEvent", pNOTICE) << "dsigma/dQ2 (random) = " << t/(1E-38*units::cm2) << " 1E-38 cm^2/GeV^2";
@@ -307,6 +340,8 @@ void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
         if(accept) {
             double gQ2 = interaction->KinePtr()->Q2(false);
             LOG("DMELEvent", pINFO) << "*Selected* Q^2 = " << gQ2 << " GeV^2";
+
+            if(!fGenerateUniformly) this->CountThrows(iter);
             
             // reset bits
             interaction->ResetBit(kISkipProcessChk);
@@ -335,7 +370,7 @@ void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
                 rpdgc = interaction->RecoilNucleonPdg();
             }
             assert(rpdgc);
-            double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+            double gW = PDGLibrary::Instance()->Mass(rpdgc);
             LOG("DMELEvent", pNOTICE) << "Selected: W = "<< gW;
          
             // (W,Q2) -> (x,y)
@@ -493,6 +528,103 @@ void DMELEventGenerator::LoadConfig(void)
     //  fQ2min   = 99999999;
     //  fQ2max   = -1;
     GetParamDef( "SF-MinAngleEMscattering", fMinAngleEM, 0. ) ;
+
+    // Read the max xsec from a grid binned in the probe energy at the hit
+    // nucleon rest frame?
+    GetParamDef( "MaxXSec-UseEnergyGrid",          fUseMaxXSecGrid,          false ) ;
+    GetParamDef( "MaxXSec-EnergyGrid-NEPerDecade", fMaxXSecGridNEPerDecade,  20    ) ;
+    GetParamDef( "AcceptanceRate-ReportNEvents",   fAcceptanceReportNEvents, 10000 ) ;
+    if(fMaxXSecGridNEPerDecade < 1) {
+        LOG("DMELEvent", pFATAL)
+            << "Invalid max xsec energy grid: "
+            << fMaxXSecGridNEPerDecade << " bins per decade";
+        exit(1);
+    }
+
+    // grid filled and throws counted with the previous configuration
+    gMaxXSecGrids.erase(this);
+}
+//____________________________________________________________________________
+double * DMELEventGenerator::MaxXSecGridBin(const Interaction * interaction) const
+{
+    // Returns the bin of the max xsec grid for this interaction, with the
+    // xsec model of the running thread, holding the probe energy at the hit
+    // nucleon rest frame (see Energy()). A bin is filled at its first use,
+    // with the max of the max xsec (safety factor included) computed at both
+    // edges of the bin for a hit nucleon at rest: ComputeMaxXSec() already
+    // scans the nucleon momenta, so the bin holds for any hit nucleon.
+    // The probe (dark matter) mass is part of the key, as it is not in the
+    // interaction string and a mass scan (see gevgen_dm -m) changes it.
+    // Returns 0 below the minimum caching energy or if the max xsec vanishes,
+    // and the max xsec is then obtained as usual.
+
+    double E = this->Energy(interaction);
+    if(E <= 0 || E < fEMin) return 0;
+
+    int ie = TMath::FloorNint(TMath::Log10(E) * fMaxXSecGridNEPerDecade);
+
+    ostringstream key;
+    key << fXSecModel->Id().Key() << "/" << interaction->AsString()
+        << "/" << interaction->InitState().Probe()->Mass() << "/" << ie;
+
+    MaxXSecGrid & grid = gMaxXSecGrids[this];
+    map<string, double>::iterator iter = grid.bins.find(key.str());
+    if(iter == grid.bins.end()) {
+        double E0 = TMath::Power(10., double(ie)   / fMaxXSecGridNEPerDecade);
+        double E1 = TMath::Power(10., double(ie+1) / fMaxXSecGridNEPerDecade);
+
+        Interaction * in = new Interaction(*interaction);
+        Target * tgt = in->InitStatePtr()->TgtPtr();
+        if(tgt->HitNucIsSet()) {
+            TLorentzVector p4(0, 0, 0, tgt->HitNucMass());
+            tgt->SetHitNucP4(p4);
+        }
+        double xsec_max = 0;
+        in->InitStatePtr()->SetProbeE(E0);
+        xsec_max = TMath::Max(xsec_max, this->ComputeMaxXSec(in));
+        in->InitStatePtr()->SetProbeE(E1);
+        xsec_max = TMath::Max(xsec_max, this->ComputeMaxXSec(in));
+        delete in;
+
+        LOG("DMELEvent", pINFO)
+            << "Max xsec grid: max xsec (E in [" << E0 << ", " << E1
+            << "] GeV) = " << xsec_max << " for " << interaction->AsString();
+
+        iter = grid.bins.insert(
+               map<string, double>::value_type(key.str(), xsec_max)).first;
+    }
+    if(iter->second <= 0) return 0;
+
+    return &(iter->second);
+}
+//____________________________________________________________________________
+void DMELEventGenerator::CountThrows(unsigned int nthrows) const
+{
+    // Counts the kinematics throws of an accepted event and reports the
+    // acceptance rate of the rejection method every fAcceptanceReportNEvents
+    // events
+
+    MaxXSecGrid & grid = gMaxXSecGrids[this];
+    grid.nevents++;
+    grid.nthrows += nthrows;
+
+    if(fAcceptanceReportNEvents > 0 &&
+       grid.nevents % fAcceptanceReportNEvents == 0) {
+        LOG("DMELEvent", pNOTICE)
+            << "Acceptance rate of the rejection method = "
+            << this->AcceptanceRate() << " (" << grid.nevents << " events, "
+            << grid.nthrows << " throws, MaxXSec-SafetyFactor = "
+            << fSafetyFactor << ")";
+    }
+}
+//____________________________________________________________________________
+double DMELEventGenerator::AcceptanceRate(void) const
+{
+    map<const DMELEventGenerator *, MaxXSecGrid>::const_iterator iter =
+                                                   gMaxXSecGrids.find(this);
+    if(iter == gMaxXSecGrids.end() || iter->second.nthrows == 0) return 0;
+
+    return double(iter->second.nevents) / iter->second.nthrows;
 }
 //____________________________________________________________________________
 double DMELEventGenerator::ComputeMaxXSec(const Interaction * in) const
@@ -751,7 +883,7 @@ double DMELEventGenerator::ComputeXSec( Interaction * interaction, double costhe
     //LOG("DMELEvent", pINFO) << "outNucleon boosted = " << utils::print::P4AsString(&outNucleon);
     /*
       LOG("DMELEvent", pINFO) << "neutrino LAB EvGen: ";
-      interaction->InitState().GetProbeP4(kRfLab)->Print();
+      interaction->InitState().ProbeP4().Print();
       LOG("DMELEvent", pINFO) << "inNucleon LAB EvGen:\n";
       interaction->InitState().Tgt().HitNucP4().Print();
       LOG("DMELEvent", pINFO) << "Lepton LAB EvGen:\n";
@@ -769,9 +901,7 @@ double DMELEventGenerator::ComputeXSec( Interaction * interaction, double costhe
         return 0;
     }
     // Check if Q2 above Minimum Q2 // important for eA scattering
-    TLorentzVector * nuP4 = interaction->InitState().GetProbeP4();
-    TLorentzVector qP4 = *nuP4 - lepton;
-    delete nuP4;
+    TLorentzVector qP4 = interaction->InitState().ProbeP4(kRfHitNucRest) - lepton;
     double Q2 = -1 * qP4.Mag2();
     
     interaction->KinePtr()->SetFSLeptonP4(lepton);
@@ -795,16 +925,15 @@ double DMELEventGenerator::ComputeXSec( Interaction * interaction, double costhe
     return xsec;
 }
 //___________________________________________________________________________
-TVector3 DMELEventGenerator::COMframe2Lab(InitialState initialState) const
+TVector3 DMELEventGenerator::COMframe2Lab(const InitialState & initialState) const
 {
     
-    TLorentzVector * k4 = initialState.GetProbeP4(kRfLab);
+    const TLorentzVector & k4 = initialState.ProbeP4();
     TLorentzVector * p4 = initialState.TgtPtr()->HitNucP4Ptr();
-    TLorentzVector totMom = *k4 + *p4;
+    TLorentzVector totMom = k4 + *p4;
 
     TVector3 beta = totMom.BoostVector();
     
-    delete k4;
     
     return beta;
 }
@@ -39,6 +39,9 @@ public :
   // implement the EventRecordVisitorI interface
   void ProcessEventRecord(GHepRecord * event_rec) const;
 
+  //! Fraction of the kinematics throws accepted so far by the running thread
+  double AcceptanceRate(void) const;
+
   // overload the Algorithm::Configure() methods to load private data
   // members from configuration options
   void Configure(const Registry & config);
@@ -47,7 +50,7 @@ public :
 private:
 
   double ComputeXSec (Interaction * in, double costheta, double phi) const;
-  TVector3 COMframe2Lab(InitialState initialState) const;
+  TVector3 COMframe2Lab(const InitialState & initialState) const;
 
   double COMJacobian(TLorentzVector lepton, TLorentzVector leptonCOM, TLorentzVector outNucleon, TVector3 beta) const;
   
@@ -56,6 +59,8 @@ private:
 
   void   LoadConfig     (void);
   double  ComputeMaxXSec(const Interaction * in) const;
+  double * MaxXSecGridBin(const Interaction * in) const;
+  void     CountThrows   (unsigned int nthrows) const;
 
   void AddTargetNucleusRemnant (GHepRecord * evrec) const; ///< add a recoiled nucleus remnant
 
@@ -67,6 +72,10 @@ private:
   //
   mutable double fMinAngleEM;
 
+  bool   fUseMaxXSecGrid;          ///< read the max xsec from the energy grid?
+  int    fMaxXSecGridNEPerDecade;  ///< energy grid bins per decade
+  int    fAcceptanceReportNEvents; ///< report the acceptance rate every that many events (0: never)
+
 
 }; // class definition
 
@@ -107,13 +107,13 @@ InteractionList * DMELInteractionListGenerator::CreateInteractionListDM(
 //____________________________________________________________________________
 void DMELInteractionListGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfigData();
 }
 //____________________________________________________________________________
 void DMELInteractionListGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfigData();
 }
 //____________________________________________________________________________
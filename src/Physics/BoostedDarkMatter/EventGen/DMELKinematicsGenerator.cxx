@@ -200,7 +200,7 @@ void DMELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         else if(xcls.IsStrangeEvent()) { rpdgc = xcls.StrangeHadronPdg();           }
         else                    { rpdgc = interaction->RecoilNucleonPdg(); }
         assert(rpdgc);
-        double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+        double gW = PDGLibrary::Instance()->Mass(rpdgc);
 
         LOG("DMELKinematics", pNOTICE) << "Selected: W = "<< gW;
 
@@ -344,7 +344,7 @@ void DMELKinematicsGenerator::SpectralFuncExperimentalCode(
      if(xcls.IsCharmEvent()) { rpdgc = xcls.CharmHadronPdg();           }
      else                    { rpdgc = interaction->RecoilNucleonPdg(); }
      assert(rpdgc);
-     gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+     gW = PDGLibrary::Instance()->Mass(rpdgc);
 
      // (W,Q2) -> (x,y)
      kinematics::WQ2toXY(E,Mn,gW,gQ2,gx,gy);
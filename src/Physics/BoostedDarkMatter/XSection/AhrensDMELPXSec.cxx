@@ -64,7 +64,7 @@ double AhrensDMELPXSec::XSec(
   LOG("AhrensDMEL", pDEBUG) << "Using v^" << fVelMode << " dependence";
   
   double E    = init_state.ProbeE(kRfHitNucRest);
-  double ml   = init_state.GetProbeP4(kRfHitNucRest)->M();
+  double ml   = init_state.ProbeP4().M();
   double Q2   = kinematics.Q2();
   double M    = target.HitNucMass();
   double M2   = TMath::Power(M, 2.);
@@ -207,7 +207,7 @@ void AhrensDMELPXSec::LoadConfig(void)
   this->GetParam("ZpCoupling", fgZp ) ;
 
   // mediator mass
-  fMedMass = PDGLibrary::Instance()->Find(kPdgMediator)->Mass();
+  fMedMass = PDGLibrary::Instance()->Mass(kPdgMediator);
 
   // load XSec Integrator
   fXSecIntegrator =
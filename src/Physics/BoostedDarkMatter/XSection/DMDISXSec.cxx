@@ -86,8 +86,9 @@ double DMDISXSec::Integrate(
     Target * target = interaction->InitStatePtr()->TgtPtr();
     if(pdg::IsProton(nucpdgc)) { target->SetId(kPdgTgtFreeP); }
     else                       { target->SetId(kPdgTgtFreeN); }
-    if(xsl->SplineExists(model,interaction)) {
-      const Spline * spl = xsl->GetSpline(model, interaction);
+    int spl_handle = xsl->GetSplineHandle(model, interaction);
+    if(spl_handle >= 0) {
+      const Spline * spl = xsl->GetSpline(spl_handle);
       double xsec = spl->Evaluate(Ed);
       LOG("DMDISXSec", pINFO)  
         << "From XSecSplineList: XSec[DIS,free nucleon] (E = " << Ed << " GeV) = " << xsec;
@@ -268,7 +269,7 @@ void DMDISXSec::CacheFreeNucleonXSec(
      new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
 
   // Compute the cross section at the given set of knots
-  double Md = interaction->InitStatePtr()->GetProbeP4()->M();
+  double Md = interaction->InitStatePtr()->ProbeP4().M();
   double Md2 = Md*Md;
   for(int ie=0; ie<nknots; ie++) {
     LOG("DMDISXSec", pDEBUG) << "Dealing with knot " << ie << " out of " << nknots;
@@ -455,7 +455,7 @@ void QPMDMDISPXSec::LoadConfig(void)
   this->GetParam("ZpCoupling", fgzp);
 
   // mediator mass ratio and mediator mass
-  fMedMass = PDGLibrary::Instance()->Find(kPdgMediator)->Mass();
+  fMedMass = PDGLibrary::Instance()->Mass(kPdgMediator);
   
   //-- load the differential cross section integrator
   fXSecIntegrator =
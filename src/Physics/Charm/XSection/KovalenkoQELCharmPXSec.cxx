@@ -235,7 +235,7 @@ double KovalenkoQELCharmPXSec::MRes(const Interaction * interaction) const
   const XclsTag & xcls = interaction->ExclTag();
 
   int pdgc  = xcls.CharmHadronPdg();
-  double MR = PDGLibrary::Instance()->Find(pdgc)->Mass();
+  double MR = PDGLibrary::Instance()->Mass(pdgc);
   return MR;
 }
 //____________________________________________________________________________
@@ -106,13 +106,13 @@ InteractionList * COHInteractionListGenerator::CreateInteractionList(
 //___________________________________________________________________________
 void COHInteractionListGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfigData();
 }
 //____________________________________________________________________________
 void COHInteractionListGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfigData();
 }
 //____________________________________________________________________________
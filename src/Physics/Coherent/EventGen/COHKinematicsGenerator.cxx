@@ -24,6 +24,12 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Optionally select the Berger-Sehgal (Q2,y) from a tabulated envelope of
+   d2xsec/dQ2dy instead of uniformly below the max xsec (UseTabulatedEnvelope).
+   Restored the UniformOverPhaseSpace option for the Berger-Sehgal models and
+   added the tabulated envelope sampling of (y,t) for Berger-Sehgal FM.
+   The envelope is sampled under the ProcessGeneratorLock (gRandom).
 
 */
 //____________________________________________________________________________
@@ -42,6 +48,7 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Conventions/Units.h"
 #include "Physics/Coherent/EventGen/COHKinematicsGenerator.h"
+#include "Physics/Common/KineEnvelope2D.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/EventGeneratorI.h"
@@ -50,6 +57,7 @@
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
 
@@ -63,12 +71,14 @@ COHKinematicsGenerator::COHKinematicsGenerator() :
   KineGeneratorWithCache("genie::COHKinematicsGenerator")
 {
   fEnvelope = 0;
+  fEnvelopeNQ2 = 10;
 }
 //___________________________________________________________________________
 COHKinematicsGenerator::COHKinematicsGenerator(string config) :
   KineGeneratorWithCache("genie::COHKinematicsGenerator", config)
 {
   fEnvelope = 0;
+  fEnvelopeNQ2 = 10;
 }
 //___________________________________________________________________________
 COHKinematicsGenerator::~COHKinematicsGenerator()
@@ -117,9 +127,11 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
   //   Calculate the max differential cross section or retrieve it from the
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
-  //
-  //   TODO: We are not offering the "fGenerateUniformly" option here.
-  double xsec_max = this->MaxXSec(evrec);
+  //   The max xsec is irrelevant if (Q2,y) are generated uniformly over the
+  //   allowed phase space or from a tabulated envelope.
+  KineEnvelope2D * envelope = (fUseTabulatedEnvelope && !fGenerateUniformly) ?
+      this->TabulatedEnvelope(interaction) : 0;
+  double xsec_max = (envelope || fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
 
   //-- Get the kinematical limits for the generated x,y
   const KPhaseSpace & kps = interaction->PhaseSpace();
@@ -137,17 +149,27 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
   unsigned int iter = 0;
   bool accept=false;
   double xsec=-1, gy=-1, gQ2=-1;
+  double gs=-1, gu=-1, genv=-1;
 
   while(1) {
     iter++;
     if(iter > kRjMaxIterations) this->throwOnTooManyIterations(iter,evrec);
 
-    //-- Select unweighted kinematics using importance sampling method. 
-    // TODO: The importance sampling envelope is not used. Currently, 
-    // we just employ a standard rejection-method approach.
-
-    gy  = ymin  + dy  * rnd->RndKine().Rndm(); 
-    gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm(); 
+    //-- Select unweighted kinematics with the rejection method, either
+    //   below the max xsec or below the tabulated envelope (unless they
+    //   are generated uniformly over the allowed phase space)
+
+    if(envelope) {
+      double r1 = rnd->RndKine().Rndm();
+      double r2 = rnd->RndKine().Rndm();
+      double r3 = rnd->RndKine().Rndm();
+      genv = envelope->Sample(r1, r2, r3, gs, gu);
+      gy  = ymin  + dy  * gs;
+      gQ2 = Q2min + dQ2 * gu;
+    } else {
+      gy  = ymin  + dy  * rnd->RndKine().Rndm(); 
+      gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm(); 
+    }
 
     LOG("COHKinematics", pINFO) << 
       "Trying: Q^2 = " << gQ2 << ", y = " << gy; /* << ", t = " << gt; */
@@ -160,10 +182,20 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
     xsec = fXSecModel->XSec(interaction, kPSQ2yfE);
 
     //-- decide whether to accept the current kinematics
-    accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
+    if(fGenerateUniformly) {
+      accept = (xsec>0);
+    } else if(envelope) {
+      if(xsec > genv) {
+        this->RaiseTabulatedEnvelope(envelope, interaction, gs, gu, xsec, genv);
+      }
+      accept = (genv * rnd->RndKine().Rndm() < xsec);
+    } else {
+      accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
+    }
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
+      this->CountKineThrows(interaction, iter, true);
       LOG("COHKinematics", pNOTICE)
         << "Selected: Q^2 = " << gQ2 << ", y = " << gy; /* << ", t = " << gt; */
 
@@ -194,8 +226,19 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
       double rt    = tsum * rnd->RndKine().Rndm();
       double gt    = -1.*TMath::Log(-1.*b*rt + TMath::Exp(-1.*b*tmin))/b;
 
-      // TODO: If we re-install the fGenerateUniformly option, we 
-      // would compute the event weight here.
+      // for uniform kinematics, compute an event weight as
+      // wght = (phase space volume)*(differential xsec)/(event total xsec)
+      if(fGenerateUniformly) {
+        double vol     = dy*dQ2; // t: integrated out
+        double totxsec = evrec->XSec();
+        double wght    = (vol/totxsec)*xsec;
+        LOG("COHKinematics", pNOTICE)  << "Kinematics wght = "<< wght;
+
+        // apply computed weight to the current event weight
+        wght *= evrec->Weight();
+        LOG("COHKinematics", pNOTICE) << "Current event wght = " << wght;
+        evrec->SetWeight(wght);
+      }
 
       // reset bits
       interaction->ResetBit(kISkipProcessChk);
@@ -231,9 +274,11 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgalFM(GHepRecord * evrec) con
   //   Calculate the max differential cross section or retrieve it from the
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
-  //
-  //   TODO: We are not offering the "fGenerateUniformly" option here.
-  double xsec_max = this->MaxXSec(evrec);
+  //   The max xsec is irrelevant if (Q2,y,t) are generated uniformly over
+  //   the allowed phase space or (y,t) from a tabulated envelope.
+  KineEnvelope2D * envelope = (fUseTabulatedEnvelope && !fGenerateUniformly) ?
+      this->TabulatedEnvelope(interaction) : 0;
+  double xsec_max = (envelope || fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
 
   //-- Get the kinematical limits for the generated x,y
   const KPhaseSpace & kps = interaction->PhaseSpace();
@@ -256,18 +301,29 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgalFM(GHepRecord * evrec) con
   unsigned int iter = 0;
   bool accept=false;
   double xsec=-1, gy=-1, gt=-1, gQ2=-1;
+  double gs=-1, gu=-1, genv=-1;
 
   while(1) {
     iter++;
     if(iter > kRjMaxIterations) this->throwOnTooManyIterations(iter,evrec);
 
-    //-- Select unweighted kinematics using importance sampling method. 
-    // TODO: The importance sampling envelope is not used. Currently, 
-    // we just employ a standard rejection-method approach.
-
-    gy  = ymin  + dy  * rnd->RndKine().Rndm(); 
-    gt  = tmin  + dt  * rnd->RndKine().Rndm(); 
-    gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm(); 
+    //-- Select unweighted kinematics with the rejection method, either
+    //   below the max xsec or below the tabulated envelope of (y,t), which
+    //   bounds the xsec over Q2 (unless they are generated uniformly over
+    //   the allowed phase space)
+
+    if(envelope) {
+      double r1 = rnd->RndKine().Rndm();
+      double r2 = rnd->RndKine().Rndm();
+      double r3 = rnd->RndKine().Rndm();
+      genv = envelope->Sample(r1, r2, r3, gs, gu);
+      gy  = ymin  + dy  * gs;
+      gt  = tmin  + dt  * gu;
+    } else {
+      gy  = ymin  + dy  * rnd->RndKine().Rndm();
+      gt  = tmin  + dt  * rnd->RndKine().Rndm();
+    }
+    gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm();
 
     LOG("COHKinematics", pINFO) << 
       "Trying: Q^2 = " << gQ2 << ", y = " << gy << ", t = " << gt;
@@ -280,15 +336,36 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgalFM(GHepRecord * evrec) con
     xsec = fXSecModel->XSec(interaction, kPSxyfE);
 
     //-- decide whether to accept the current kinematics
-    accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
+    if(fGenerateUniformly) {
+      accept = (xsec>0);
+    } else if(envelope) {
+      if(xsec > genv) {
+        this->RaiseTabulatedEnvelope(envelope, interaction, gs, gu, xsec, genv);
+      }
+      accept = (genv * rnd->RndKine().Rndm() < xsec);
+    } else {
+      accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
+    }
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
+      this->CountKineThrows(interaction, iter, true);
       LOG("COHKinematics", pNOTICE)
         << "Selected: Q^2 = " << gQ2 << ", y = " << gy << ", t = " << gt; 
 
-      // TODO: If we re-install the fGenerateUniformly option, we 
-      // would compute the event weight here.
+      // for uniform kinematics, compute an event weight as
+      // wght = (phase space volume)*(differential xsec)/(event total xsec)
+      if(fGenerateUniformly) {
+        double vol     = dy*dQ2*dt;
+        double totxsec = evrec->XSec();
+        double wght    = (vol/totxsec)*xsec;
+        LOG("COHKinematics", pNOTICE)  << "Kinematics wght = "<< wght;
+
+        // apply computed weight to the current event weight
+        wght *= evrec->Weight();
+        LOG("COHKinematics", pNOTICE) << "Current event wght = " << wght;
+        evrec->SetWeight(wght);
+      }
 
       // reset bits
       interaction->ResetBit(kISkipProcessChk);
@@ -365,7 +442,8 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
         fEnvelope->SetParameter(1, Ev);        
       }
 
-      // Generate W,QD2 using the 2-D envelope as PDF
+      // Generate W,QD2 using the 2-D envelope as PDF (draws from gRandom)
+      ProcessGeneratorLock lock;
       fEnvelope->GetRandom2(gx,gy);
     }
 
@@ -395,6 +473,7 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
+      this->CountKineThrows(interaction, iter, true);
       LOG("COHKinematics", pNOTICE) << "Selected: x = "<< gx << ", y = "<< gy;
 
       // the Rein-Sehgal COH cross section should be a triple differential cross section
@@ -482,7 +561,7 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
   //Set up limits of integration variables
   // Primary lepton energy
   const double E_l_min = interaction->FSPrimLepton()->Mass();
-  const double E_l_max = interaction->InitStatePtr()->GetProbeP4(kRfLab)->E() - kPionMass;
+  const double E_l_max = interaction->InitStatePtr()->ProbeE(kRfLab) - kPionMass;
   // Primary lepton angle with respect to the beam axis
   const double ctheta_l_min = 0.4;
   const double ctheta_l_max = 1.0 - kASmallNum;
@@ -548,6 +627,7 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
+      this->CountKineThrows(interaction, iter, true);
       LOG("COHKinematics", pNOTICE) << "Selected: Lepton(" << 
         g_E_l << ", " << g_theta_l << ", " << 
         g_phi_l << ") Pion(" << g_theta_pi << ", " << g_phi_pi << ")";
@@ -557,7 +637,7 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
       double theta_pi = g_theta_pi;
       double phi_l = g_phi_l;
       double phi_pi = g_phi_pi;
-      const TLorentzVector P4_nu = *(interaction->InitStatePtr()->GetProbeP4(kRfLab));
+      const TLorentzVector & P4_nu = interaction->InitStatePtr()->ProbeP4();
       double E_nu       = P4_nu.E();
       double E_pi= E_nu-E_l;
       double m_l = interaction->FSPrimLepton()->Mass();
@@ -620,7 +700,7 @@ void COHKinematicsGenerator::SetKinematics(const double E_l,
                                            const Interaction* interaction,
                                            Kinematics* kinematics) const
 {
-  const TLorentzVector P4_nu = *(interaction->InitStatePtr()->GetProbeP4(kRfLab));
+  const TLorentzVector & P4_nu = interaction->InitStatePtr()->ProbeP4();
   double E_nu       = P4_nu.E();
   double E_pi= E_nu-E_l;
   double m_l = interaction->FSPrimLepton()->Mass();
@@ -665,7 +745,7 @@ bool COHKinematicsGenerator::CheckKinematics(const double E_l,
                                              const double /*  phi_pi     */ ,
                                              const Interaction* interaction) const
 {
-  const TLorentzVector P4_nu = *(interaction->InitStatePtr()->GetProbeP4(kRfLab));
+  const TLorentzVector & P4_nu = interaction->InitStatePtr()->ProbeP4();
   double E_nu       = P4_nu.E();
   double E_pi= E_nu-E_l;
   double m_l = interaction->FSPrimLepton()->Mass();
@@ -948,6 +1028,55 @@ double COHKinematicsGenerator::Energy(const Interaction * interaction) const
   return E;
 }
 //___________________________________________________________________________
+double COHKinematicsGenerator::TabulatedEnvelopeXSec(
+                              Interaction * in, double s, double t) const
+{
+  // Berger-Sehgal: d2xsec/dQ2dy at y = ymin + s*(ymax-ymin),
+  // Q2 = Q2min + t*(Q2max-Q2min), as for its kinematics selection.
+  // Berger-Sehgal FM: the max of d3xsec/dQ2dydt over fEnvelopeNQ2 + 1
+  // equidistant Q2 values, at y = ymin + s*(ymax-ymin), t = tmin + t*(tmax-tmin)
+  bool is_bs   = (fXSecModel->Id().Name() == "genie::BergerSehgalCOHPiPXSec2015");
+  bool is_bsfm = (fXSecModel->Id().Name() == "genie::BergerSehgalFMCOHPiPXSec2015");
+  if (!is_bs && !is_bsfm) {
+    LOG("COHKinematicsGenerator",pFATAL) <<
+      "No tabulated envelope sampling for " << fXSecModel->Id().Name();
+    exit(1);
+  }
+
+  in->SetBit(kISkipProcessChk);
+  in->SetBit(kISkipKinematicChk);
+
+  const KPhaseSpace & kps = in->PhaseSpace();
+  Range1D_t y = kps.YLim();
+  if (y.min <= 0. || y.max >= 1. || y.min >= y.max) return 0;
+
+  const double ymin  = y.min + kASmallNum;
+  const double ymax  = y.max - kASmallNum;
+  const double Q2min = fQ2Min + kASmallNum;
+  const double Q2max = fQ2Max - kASmallNum;
+
+  in->KinePtr()->Sety (ymin  + (ymax  - ymin ) * s);
+
+  if (is_bs) {
+    in->KinePtr()->SetQ2(Q2min + (Q2max - Q2min) * t);
+    kinematics::UpdateXFromQ2Y(in);
+
+    return fXSecModel->XSec(in, kPSQ2yfE);
+  }
+
+  const double tmin = kASmallNum;
+  const double tmax = fTMax - kASmallNum;
+
+  in->KinePtr()->Sett(tmin + (tmax - tmin) * t);
+
+  double xsec_max = 0;
+  for (int iq = 0; iq <= fEnvelopeNQ2; iq++) {
+    in->KinePtr()->SetQ2(Q2min + (Q2max - Q2min) * iq / fEnvelopeNQ2);
+    xsec_max = TMath::Max(xsec_max, fXSecModel->XSec(in, kPSxyfE));
+  }
+  return xsec_max;
+}
+//___________________________________________________________________________
 double COHKinematicsGenerator::pionMass(const Interaction* in) const
 {
   double m_pi = 0.0;
@@ -965,6 +1094,7 @@ void COHKinematicsGenerator::throwOnTooManyIterations(unsigned int iters,
   LOG("COHKinematics", pWARN)
     << "*** Could not select valid kinematics after "
     << iters << " iterations";
+  this->CountKineThrows(evrec->Summary(), iters, false);
   evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
   genie::exceptions::EVGThreadException exception;
   exception.SetReason("Couldn't select kinematics");
@@ -996,6 +1126,9 @@ void COHKinematicsGenerator::LoadConfig(void)
 
   //-- max xsec safety factor (for rejection method) and min cached energy
   GetParamDef( "MaxXSec-SafetyFactor", fSafetyFactor, 1.6 ) ;
+
+  //-- Tighten the max xsec online (adaptive safety factor)?
+  this->LoadAdaptiveSafetyFactorConfig();
   GetParamDef( "Cache-MinEnergy", fEMin,  -1.0 ) ;
 
   //-- Generate kinematics uniformly over allowed phase space and compute
@@ -1007,6 +1140,17 @@ void COHKinematicsGenerator::LoadConfig(void)
   GetParamDef( "MaxXSec-DiffTolerance", fMaxXSecDiffTolerance, 999999. ) ;
     assert(fMaxXSecDiffTolerance>=0);
 
+  //-- Select the Berger-Sehgal (Q2,y) / Berger-Sehgal FM (y,t) from
+  //   tabulated envelopes?
+  this->LoadTabulatedEnvelopeConfig();
+  GetParamDef( "TabulatedEnvelope-NQ2", fEnvelopeNQ2, 10 ) ;
+  if(fEnvelopeNQ2 < 1) {
+    LOG("COHKinematics", pFATAL)
+       << "Invalid number of Q2 intervals for the tabulated envelope: "
+       << fEnvelopeNQ2;
+    exit(1);
+  }
+
   //-- Envelope employed when importance sampling is used 
   //   (initialize with dummy range)
   if(fEnvelope) delete fEnvelope;
@@ -68,6 +68,10 @@ namespace genie {
     // overload KineGeneratorWithCache method to get energy
     double Energy         (const Interaction * in) const;
 
+    // overload KineGeneratorWithCache method for the tabulated envelope
+    // sampling (Berger-Sehgal models)
+    double TabulatedEnvelopeXSec (Interaction * in, double s, double t) const;
+
     // TODO: should fEnvelope and fRo be public? They look like they should be private
     mutable TF2 * fEnvelope; ///< 2-D envelope used for importance sampling
     double fRo;              ///< nuclear scale parameter
@@ -79,6 +83,7 @@ namespace genie {
     double fQ2Min;  ///< lower bound of integration for Q^2 in Berger-Sehgal Model
     double fQ2Max;  ///< upper bound of integration for Q^2 in Berger-Sehgal Model
     double fTMax;   ///< upper bound for t = (q - p_pi)^2
+    int    fEnvelopeNQ2; ///< Q2 intervals over which the Berger-Sehgal FM (y,t) envelope is maximised
   };
 
 }      // genie namespace
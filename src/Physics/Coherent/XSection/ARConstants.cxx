@@ -41,17 +41,17 @@ ARConstants::ARConstants() {
   fCosCabibboAngle  = TMath::Cos( 0.22853207 ) ;
   fSinWeinbergAngle = TMath::Sin( 0.49744211 ) ;
   
-  massElectron = genie::PDGLibrary::Instance()->Find(genie::kPdgElectron)->Mass() / HBar();
-  massMuon     = genie::PDGLibrary::Instance()->Find(genie::kPdgMuon)->Mass() / HBar();
-  massTau      = genie::PDGLibrary::Instance()->Find(genie::kPdgTau)->Mass() / HBar();
-  massProton   = genie::PDGLibrary::Instance()->Find(genie::kPdgProton)->Mass() / HBar();
-  massNeutron  = genie::PDGLibrary::Instance()->Find(genie::kPdgNeutron)->Mass() / HBar();
+  massElectron = genie::PDGLibrary::Instance()->Mass(genie::kPdgElectron) / HBar();
+  massMuon     = genie::PDGLibrary::Instance()->Mass(genie::kPdgMuon) / HBar();
+  massTau      = genie::PDGLibrary::Instance()->Mass(genie::kPdgTau) / HBar();
+  massProton   = genie::PDGLibrary::Instance()->Mass(genie::kPdgProton) / HBar();
+  massNeutron  = genie::PDGLibrary::Instance()->Mass(genie::kPdgNeutron) / HBar();
   massNucleon  = (massProton + massNeutron)/2.0;
   massNucleon2 = massNucleon*massNucleon;
-  massDeltaP   = genie::PDGLibrary::Instance()->Find(genie::kPdgP33m1232_DeltaP)->Mass() / HBar();
-  massDelta0   = genie::PDGLibrary::Instance()->Find(genie::kPdgP33m1232_Delta0)->Mass() / HBar();
-  massPiP      = genie::PDGLibrary::Instance()->Find(genie::kPdgPiP)->Mass() / HBar();
-  massPi0      = genie::PDGLibrary::Instance()->Find(genie::kPdgPi0)->Mass() / HBar();
+  massDeltaP   = genie::PDGLibrary::Instance()->Mass(genie::kPdgP33m1232_DeltaP) / HBar();
+  massDelta0   = genie::PDGLibrary::Instance()->Mass(genie::kPdgP33m1232_Delta0) / HBar();
+  massPiP      = genie::PDGLibrary::Instance()->Mass(genie::kPdgPiP) / HBar();
+  massPi0      = genie::PDGLibrary::Instance()->Mass(genie::kPdgPi0) / HBar();
   
   ncFactor = 1.0 - 2.0*fSinWeinbergAngle*fSinWeinbergAngle;
 }
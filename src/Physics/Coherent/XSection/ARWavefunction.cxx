@@ -26,7 +26,7 @@ namespace alvarezruso
 ARWavefunction::ARWavefunction(unsigned int sampling_in, bool debug)
   : debug_(debug),
   sampling_(2*sampling_in),
-  wavefunction_(sampling_, std::vector<std::complex<double> >(sampling_, std::complex<double> (0.0,0.0)) )
+  wavefunction_(sampling_*sampling_, std::complex<double> (0.0,0.0))
 {
   if(debug_) std::cerr << "WF@ Constructor" << std::endl;
 }
@@ -51,24 +51,24 @@ std::string ARWavefunction::print() const
   return oss.str();
 }
 
-const std::vector<std::complex<double> >& ARWavefunction::operator[] (unsigned int i) const
+const std::complex<double> * ARWavefunction::operator[] (unsigned int i) const
 {
-  return wavefunction_[i];
+  return &wavefunction_[i*sampling_];
 }
 
 const std::complex<double> & ARWavefunction::operator() (unsigned int i, unsigned int j) const
 {
-  return wavefunction_[i][j];
+  return wavefunction_[i*sampling_ + j];
 }
 
 std::complex<double>  ARWavefunction::get(unsigned int i, unsigned int j) const
 {
-  return wavefunction_[i][j];
+  return wavefunction_[i*sampling_ + j];
 }
 
 void ARWavefunction::set(unsigned int i, unsigned int j, const std::complex<double> & value)
 {
-  wavefunction_[i][j] = value;
+  wavefunction_[i*sampling_ + j] = value;
 }
 
 unsigned int ARWavefunction::sampling() const  {  return sampling_;  }
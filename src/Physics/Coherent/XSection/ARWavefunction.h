@@ -22,6 +22,7 @@
 
 #include <string>
 #include <complex>
+#include <vector>
 
 namespace genie
 {
@@ -38,7 +39,8 @@ class ARWavefunction
     
     std::string print() const;
     
-    const std::vector<std::complex<double> >& operator[] (unsigned int i) const;
+    // row i of the wavefunction (the values are stored contiguously, row by row)
+    const std::complex<double> * operator[] (unsigned int i) const;
     
     const std::complex<double> & operator() (unsigned int i, unsigned int j) const;
     
@@ -52,7 +54,7 @@ class ARWavefunction
       
       bool debug_;
       unsigned int sampling_;
-      std::vector< std::vector<std::complex<double> > > wavefunction_;
+      std::vector<std::complex<double> > wavefunction_;
 }; // class ARWavefunction
 
 } //namespace alvarezruso
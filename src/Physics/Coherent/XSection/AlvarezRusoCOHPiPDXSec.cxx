@@ -43,6 +43,16 @@ typedef std::complex<double> cdouble;
 typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > LorentzVector;
 typedef ROOT::Math::SVector< cdouble , 4> CVector;
 
+namespace {
+  // Wavefunction nodes: kWFNodeStep [GeV] apart in pion kinetic energy up
+  // to kWFNodeTKnee, then a fraction kWFNodeFraction apart. At most
+  // kMaxWFNodes nodes are kept (the cache is cleared when it is full).
+  const double       kWFNodeStep     = 0.002;
+  const double       kWFNodeFraction = 0.01;
+  const double       kWFNodeTKnee    = kWFNodeStep / kWFNodeFraction;
+  const unsigned int kMaxWFNodes     = 1024;
+}
+
 namespace genie {
 namespace alvarezruso {
 
@@ -63,7 +73,8 @@ AlvarezRusoCOHPiPDXSec::AlvarezRusoCOHPiPDXSec(unsigned int Z_, unsigned int A_,
   fLastE_pi  (-9999999.),
   fUwave      ( new ARWavefunction(fSampling, debug_) ),
   fUwaveDr    ( new ARWavefunction(fSampling, debug_) ),
-  fUwaveDtheta( new ARWavefunction(fSampling, debug_) )
+  fUwaveDtheta( new ARWavefunction(fSampling, debug_) ),
+  fUseWFCache (true)
 {
   SetCurrent();
   SetFlavour();
@@ -296,9 +307,69 @@ void AlvarezRusoCOHPiPDXSec::SetCurrent()
 /// This is only a function of the nucleus and pion momentum/energy
 /// so if neither of those have changed there is no need to re-calculate
 /// the wavefunction values.
-/// Such a caching has not been implemented here yet!
+/// The wavefunctions are interpolated between the solutions cached at
+/// the nearest pion kinetic energy nodes (see WavefunctionNode()). The
+/// node values are stored without the plane wave phase exp(i p z), which
+/// is the fast varying part, and the phase at the pion energy is restored.
 
 void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
+{
+  const unsigned int n_points = fNucleus->GetNDensities();
+  const double e_pion = fP_pi.E();
+  
+  const double x = WFNodeCoordinate( (e_pion - fM_pi) * fConstants->HBar() );
+  const int k = (int) x;
+  
+  if( !fUseWFCache || k < 1 )
+  {
+    // solve directly (the node at zero kinetic energy can't be solved)
+    fWFBuffer.resize(3 * n_points * n_points);
+    SolveWavefunctions(e_pion, &fWFBuffer[0]);
+    for(unsigned int i = 0; i != n_points; ++i)
+    {
+      for(unsigned int j = 0; j != n_points; ++j)
+      {
+        const cdouble * wf = &fWFBuffer[3*(i*n_points + j)];
+        fUwave     ->set(i, j, wf[0]);
+        fUwaveDr   ->set(i, j, wf[1]);
+        fUwaveDtheta->set(i, j, wf[2]);
+      }
+    }
+    return;
+  }
+  
+  if( fWFNodeSlot.size() + 2 > kMaxWFNodes )
+  {
+    fWFNodeSlot.clear();
+    fWFNodeData.clear();
+  }
+  const unsigned int slot_lo = WavefunctionNode(k);
+  const unsigned int slot_hi = WavefunctionNode(k+1);
+  const cdouble * wf_lo = &fWFNodeData[slot_lo * 3 * n_points * n_points];
+  const cdouble * wf_hi = &fWFNodeData[slot_hi * 3 * n_points * n_points];
+  const double t = x - k;
+  
+  // plane wave phase at the pion energy, for each z sampling point
+  const double ppim = EikonalPionMomentum(e_pion);
+  std::vector<cdouble> phase(n_points);
+  for(unsigned int j = 0; j != n_points; ++j)
+  {
+    phase[j] = exp( cdouble(0, ppim * fNucleus->SamplePoint2(j)) );
+  }
+  
+  for(unsigned int i = 0; i != n_points; ++i)
+  {
+    for(unsigned int j = 0; j != n_points; ++j)
+    {
+      const unsigned int idx = 3*(i*n_points + j);
+      fUwave     ->set(i, j, ((1-t)*wf_lo[idx]   + t*wf_hi[idx]  ) * phase[j]);
+      fUwaveDr   ->set(i, j, ((1-t)*wf_lo[idx+1] + t*wf_hi[idx+1]) * phase[j]);
+      fUwaveDtheta->set(i, j, ((1-t)*wf_lo[idx+2] + t*wf_hi[idx+2]) * phase[j]);
+    }
+  }
+}
+
+void AlvarezRusoCOHPiPDXSec::SolveWavefunctions(const double e_pion, cdouble * wf)
 {
   unsigned int n_points = fNucleus->GetNDensities();
   
@@ -324,37 +395,116 @@ void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
       radius = fNucleus->Radius(i,j);
       // angle of sampling point wrt to neutrino direction
       cosine_rz = x2 / radius;
+      
+      cdouble * wf_ij = wf + 3*(i*n_points + j);
     
       // Calculate wavefunction
-      fUwave->set(i, j, fWfsolution->Element(radius, -cosine_rz, 
-                          fP_pi.E()));
+      wf_ij[0] = fWfsolution->Element(radius, -cosine_rz, e_pion);
       delta_r = 0.0001;
       if( radius < delta_r ) delta_r = radius;
     
       // Calculate derivative of wavefunction in the radial direction
-      uwave_plus  = fWfsolution->Element( (radius+delta_r), -cosine_rz, 
-                                     fP_pi.E());
-      uwave_minus = fWfsolution->Element( (radius-delta_r), -cosine_rz, 
-                                     fP_pi.E());
+      uwave_plus  = fWfsolution->Element( (radius+delta_r), -cosine_rz, e_pion);
+      uwave_minus = fWfsolution->Element( (radius-delta_r), -cosine_rz, e_pion);
                                      
-      fUwaveDr->set(i, j, (uwave_plus - uwave_minus) / (2.0 * delta_r) );
+      wf_ij[1] = (uwave_plus - uwave_minus) / (2.0 * delta_r);
       
       // Calculate derivative of wavefunction in the angle space
       delta_c = 0.0001;
       if     ( (cosine_rz - delta_c) <= -1.0 )  delta_c = cosine_rz + 1.0 - 1E-12;
       else if( (cosine_rz + delta_c) >=  1.0 )  delta_c = 1.0 - cosine_rz - 1E-12;
       
-      uwave_plus  = fWfsolution->Element(radius, -(cosine_rz+delta_c), 
-                                        fP_pi.E());
-      uwave_minus = fWfsolution->Element(radius, -(cosine_rz-delta_c), 
-                                        fP_pi.E());
-      fUwaveDtheta->set( i, j, (uwave_plus - uwave_minus) / (2.0 * delta_c) );
+      uwave_plus  = fWfsolution->Element(radius, -(cosine_rz+delta_c), e_pion);
+      uwave_minus = fWfsolution->Element(radius, -(cosine_rz-delta_c), e_pion);
+      wf_ij[2] = (uwave_plus - uwave_minus) / (2.0 * delta_c);
       
     }
   }
   
 }
 
+unsigned int AlvarezRusoCOHPiPDXSec::WavefunctionNode(const int k)
+{
+  std::map<int, unsigned int>::const_iterator it = fWFNodeSlot.find(k);
+  if( it != fWFNodeSlot.end() ) return it->second;
+  
+  const unsigned int n_points = fNucleus->GetNDensities();
+  const unsigned int n_values = 3 * n_points * n_points;
+  const unsigned int slot = fWFNodeSlot.size();
+  fWFNodeData.resize( (slot+1) * n_values );
+  cdouble * wf = &fWFNodeData[slot * n_values];
+  
+  const double e_pion = fM_pi + WFNodeKineticEnergy(k) / fConstants->HBar();
+  SolveWavefunctions(e_pion, wf);
+  
+  // remove the plane wave phase
+  const double ppim = EikonalPionMomentum(e_pion);
+  for(unsigned int j = 0; j != n_points; ++j)
+  {
+    const cdouble phase = exp( cdouble(0, -ppim * fNucleus->SamplePoint2(j)) );
+    for(unsigned int i = 0; i != n_points; ++i)
+    {
+      cdouble * wf_ij = wf + 3*(i*n_points + j);
+      wf_ij[0] *= phase;
+      wf_ij[1] *= phase;
+      wf_ij[2] *= phase;
+    }
+  }
+  
+  fWFNodeSlot[k] = slot;
+  return slot;
+}
+
+void AlvarezRusoCOHPiPDXSec::PrecomputeWavefunctions(const double E_pi_min_, const double E_pi_max_)
+{
+  if( !fUseWFCache ) return;
+  
+  const double t_min = TMath::Max(E_pi_min_ - fM_pi * fConstants->HBar(), 0.);
+  const double t_max = E_pi_max_ - fM_pi * fConstants->HBar();
+  if( t_max <= t_min ) return;
+  
+  const int k_min = TMath::Max( (int) WFNodeCoordinate(t_min), 1 );
+  const int k_max = (int) WFNodeCoordinate(t_max) + 1;
+  if( (unsigned int) (k_max - k_min + 1) > kMaxWFNodes )
+  {
+    LOG("AlvarezRusoCOHPiPDXSec",pWARN)
+      << "Too many wavefunction nodes for pion energies in [" << E_pi_min_
+      << ", " << E_pi_max_ << "] GeV - Not precomputing them";
+    return;
+  }
+  if( fWFNodeSlot.size() + (k_max - k_min + 1) > kMaxWFNodes )
+  {
+    fWFNodeSlot.clear();
+    fWFNodeData.clear();
+  }
+  for(int k = k_min; k <= k_max; ++k) WavefunctionNode(k);
+  
+  LOG("AlvarezRusoCOHPiPDXSec",pINFO)
+    << "Solved wavefunction nodes " << k_min << " to " << k_max
+    << " for pion energies in [" << E_pi_min_ << ", " << E_pi_max_ << "] GeV";
+}
+
+double AlvarezRusoCOHPiPDXSec::WFNodeCoordinate(const double t_pi) const
+{
+  if( t_pi < kWFNodeTKnee ) return t_pi / kWFNodeStep;
+  return kWFNodeTKnee / kWFNodeStep + TMath::Log(t_pi / kWFNodeTKnee) / TMath::Log(1. + kWFNodeFraction);
+}
+
+double AlvarezRusoCOHPiPDXSec::WFNodeKineticEnergy(const int k) const
+{
+  const double k_knee = kWFNodeTKnee / kWFNodeStep;
+  if( k < k_knee ) return k * kWFNodeStep;
+  return kWFNodeTKnee * TMath::Power(1. + kWFNodeFraction, k - k_knee);
+}
+
+double AlvarezRusoCOHPiPDXSec::EikonalPionMomentum(const double e_pion) const
+{
+  // as in AREikonalSolution::Element()
+  const double mpi   = fConstants->PiPMass();
+  const double omepi = e_pion - fM_pi + mpi;
+  return TMath::Sqrt(omepi*omepi - mpi*mpi);
+}
+
 cdouble AlvarezRusoCOHPiPDXSec::DeltaPropagatorInMed(LorentzVector delta_momentum)
 {
   //Energy dependent in-medium Delta propagator
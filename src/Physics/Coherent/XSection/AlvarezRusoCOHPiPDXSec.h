@@ -5,6 +5,13 @@
 
 \brief    5d differential cross section for Alvarez-Ruso Coherent Pion Production xsec
 
+          The eikonal pion wavefunctions depend only on the nucleus and on
+          the pion energy. They are solved on a grid of pion kinetic energy
+          nodes (2 MeV apart up to 200 MeV, 1% apart above), once per node,
+          and stored contiguously without their plane wave phase. The
+          wavefunctions at any pion energy are interpolated between the two
+          nearest nodes, and the plane wave phase is restored.
+
 \ref      
 
 \author   Steve Dennis
@@ -31,6 +38,8 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 
 #include <complex>
+#include <map>
+#include <vector>
 
 namespace genie
 {
@@ -59,6 +68,14 @@ class AlvarezRusoCOHPiPDXSec
            
     void SetDebug(bool debug)  {  debug_ = debug;  };
     
+    // Interpolate the wavefunctions between the cached node solutions (true,
+    // default) or solve them at each new pion energy (false)
+    void SetWavefunctionCache(bool use) { fUseWFCache = use; fLastE_pi = -9999999.; }
+    
+    // Solve the wavefunction nodes covering the pion energies [E_pi_min_, E_pi_max_]
+    // (GeV) ahead of the DXSec() calls
+    void PrecomputeWavefunctions(const double E_pi_min_, const double E_pi_max_);
+    
     ARConstants      & GetConstants(void);
     ARSampledNucleus & GetNucleus  (void);
     
@@ -103,6 +120,20 @@ class AlvarezRusoCOHPiPDXSec
         // Fill the wavefunctions
         void SolveWavefunctions();
         
+        // Solve the wavefunction, and its r and theta derivatives, at the pion
+        // energy e_pion for all the sampling points: wf[3*(i*n+j) + 0,1,2]
+        void SolveWavefunctions(const double e_pion, std::complex<double> * wf);
+        
+        // Slot of wavefunction node k in fWFNodeData, solved at the first call
+        unsigned int WavefunctionNode(const int k);
+        
+        // Pion kinetic energy [GeV] <-> wavefunction node coordinate
+        double WFNodeCoordinate   (const double t_pi) const;
+        double WFNodeKineticEnergy(const int k) const;
+        
+        // Pion momentum of the eikonal plane wave at the pion energy e_pion
+        double EikonalPionMomentum(const double e_pion) const;
+        
         //______________________________________________________________
         // Properties
         
@@ -163,6 +194,12 @@ class AlvarezRusoCOHPiPDXSec
         ARWavefunction* fUwaveDtheta;
         
         std::complex<double>  fJ_hadronic[4];
+        
+        // Wavefunction node cache
+        bool fUseWFCache;
+        std::map<int, unsigned int>         fWFNodeSlot;  // node -> slot
+        std::vector<std::complex<double> >  fWFNodeData;  // node wavefunctions, slot by slot
+        std::vector<std::complex<double> >  fWFBuffer;
 };
 
 } //namespace alvarezruso
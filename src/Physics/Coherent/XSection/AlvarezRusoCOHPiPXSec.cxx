@@ -47,19 +47,19 @@ AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec() :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec")
 {
   fMultidiff = NULL;
-  fLastInteraction = NULL;
+  fUseWFCache = true;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec(string config) :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec", config)
 {
   fMultidiff = NULL;
-  fLastInteraction = NULL;
+  fUseWFCache = true;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::~AlvarezRusoCOHPiPXSec()
 {
-  if (fMultidiff) delete fMultidiff;
+  this->ClearMultidiffs();
 }
 //____________________________________________________________________________
 double AlvarezRusoCOHPiPXSec::XSec(
@@ -71,57 +71,14 @@ double AlvarezRusoCOHPiPXSec::XSec(
   const Kinematics &   kinematics = interaction -> Kine();
   const InitialState & init_state = interaction -> InitState();
   
-  int A       = init_state.Tgt().A(); // mass number
-  int Z       = init_state.Tgt().Z(); // atomic number
   double E_nu = init_state.ProbeE(kRfLab); // neutrino energy
   
   const TLorentzVector p4_lep = kinematics.FSLeptonP4();
   const TLorentzVector p4_pi  = kinematics.HadSystP4();
   double E_lep = p4_lep.E();
  
-  if (fLastInteraction!=interaction) {
-    if (fMultidiff != NULL) {
-      delete fMultidiff;
-      fMultidiff = NULL;
-    }
-
-    current_t current;
-    if ( interaction->ProcInfo().IsWeakCC() ) {
-      current = kCC;
-    }
-    else if ( interaction->ProcInfo().IsWeakNC() ) {
-      current = kNC;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
-      return 0.;
-    }
-    
-    flavour_t flavour;
-    if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
-      flavour=kE;
-    }
-    else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
-      flavour=kMu;
-    }
-    else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
-      flavour=kTau;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
-      return 0.;
-    }
-
-    nutype_t nutype;
-    if ( init_state.ProbePdg() > 0) {
-      nutype = kNu;
-    } else {
-      nutype = kAntiNu;
-    }
- 
-    fMultidiff = new AlvarezRusoCOHPiPDXSec(Z, A ,current, flavour, nutype);
-    fLastInteraction = interaction;
-  }
+  fMultidiff = this->Multidiff(interaction);
+  if (!fMultidiff) return 0.;
 
   double xsec = fMultidiff->DXSec(E_nu, E_lep, p4_lep.Theta(), p4_lep.Phi(), p4_pi.Theta(), p4_pi.Phi());
   xsec = xsec * 1E-38 * units::cm2;
@@ -133,6 +90,80 @@ double AlvarezRusoCOHPiPXSec::XSec(
   return (xsec);
 }
 //____________________________________________________________________________
+AlvarezRusoCOHPiPDXSec * AlvarezRusoCOHPiPXSec::Multidiff(
+                                      const Interaction * interaction) const
+{
+// The 5d cross section calculator (and its cached pion wavefunctions) for
+// the target, current and neutrino of the input interaction. One calculator
+// is kept for each of them. Returns null for an unsupported interaction.
+
+  const InitialState & init_state = interaction -> InitState();
+
+  current_t current;
+  if ( interaction->ProcInfo().IsWeakCC() ) {
+    current = kCC;
+  }
+  else if ( interaction->ProcInfo().IsWeakNC() ) {
+    current = kNC;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
+    return 0;
+  }
+  
+  flavour_t flavour;
+  if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
+    flavour=kE;
+  }
+  else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
+    flavour=kMu;
+  }
+  else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
+    flavour=kTau;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
+    return 0;
+  }
+
+  nutype_t nutype;
+  if ( init_state.ProbePdg() > 0) {
+    nutype = kNu;
+  } else {
+    nutype = kAntiNu;
+  }
+
+  std::pair<int,int> key(init_state.Tgt().Pdg(), 
+                         (int) current * 6 + (int) flavour * 2 + (int) nutype);
+  std::map<std::pair<int,int>, AlvarezRusoCOHPiPDXSec *>::const_iterator iter =
+     fMultidiffs.find(key);
+  if (iter != fMultidiffs.end()) return iter->second;
+
+  int A = init_state.Tgt().A(); // mass number
+  int Z = init_state.Tgt().Z(); // atomic number
+  AlvarezRusoCOHPiPDXSec * multidiff = 
+     new AlvarezRusoCOHPiPDXSec(Z, A, current, flavour, nutype);
+  multidiff->SetWavefunctionCache(fUseWFCache);
+  fMultidiffs[key] = multidiff;
+  return multidiff;
+}
+//____________________________________________________________________________
+void AlvarezRusoCOHPiPXSec::PrecomputeWavefunctions(
+   const Interaction * interaction, double E_pi_min, double E_pi_max) const
+{
+  AlvarezRusoCOHPiPDXSec * multidiff = this->Multidiff(interaction);
+  if (multidiff) multidiff->PrecomputeWavefunctions(E_pi_min, E_pi_max);
+}
+//____________________________________________________________________________
+void AlvarezRusoCOHPiPXSec::ClearMultidiffs(void) const
+{
+  std::map<std::pair<int,int>, AlvarezRusoCOHPiPDXSec *>::iterator iter =
+     fMultidiffs.begin();
+  for ( ; iter != fMultidiffs.end(); ++iter) delete iter->second;
+  fMultidiffs.clear();
+  fMultidiff = NULL;
+}
+//____________________________________________________________________________
 double AlvarezRusoCOHPiPXSec::Integral(const Interaction * interaction) const
 {
   double xsec = fXSecIntegrator->Integrate(this,interaction);
@@ -185,6 +216,10 @@ void AlvarezRusoCOHPiPXSec::LoadConfig(void)
   ffStar   = fConfig->GetDoubleDef("fStar",         gc->GetDouble("COHAR-fStar"));*/
 
 
+  // interpolate the pion wavefunctions between cached solutions?
+  GetParamDef( "UseWavefunctionCache", fUseWFCache, true ) ;
+  this->ClearMultidiffs();
+
   //-- load the differential cross section integrator
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
@@ -23,6 +23,9 @@
 #ifndef _ALVAREZ_RUSO_COH_XSEC_H_
 #define _ALVAREZ_RUSO_COH_XSEC_H_
 
+#include <map>
+#include <utility>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
 
@@ -43,6 +46,10 @@ public:
   double Integral        (const Interaction * i) const;
   bool   ValidProcess    (const Interaction * i) const;
 
+  //-- solve the pion wavefunctions used for the pion energies in
+  //   [E_pi_min, E_pi_max] (GeV) ahead of the calls to XSec()
+  void   PrecomputeWavefunctions (const Interaction * i, double E_pi_min, double E_pi_max) const;
+
   //-- overload the Algorithm::Configure() methods to load private data
   //   members from configuration options
   void Configure(const Registry & config);
@@ -51,12 +58,17 @@ public:
 private:
   void LoadConfig(void);
 
+  alvarezruso::AlvarezRusoCOHPiPDXSec * Multidiff (const Interaction * i) const;
+  void ClearMultidiffs (void) const;
+
   //-- private data members loaded from config Registry or set to defaults
 
   const XSecIntegratorI * fXSecIntegrator;
   
   mutable alvarezruso::AlvarezRusoCOHPiPDXSec * fMultidiff;
-  mutable const Interaction * fLastInteraction;
+  // one calculator per target and (current, flavour, neutrino type)
+  mutable std::map<std::pair<int,int>, alvarezruso::AlvarezRusoCOHPiPDXSec *> fMultidiffs;
+  bool fUseWFCache;
   //Parameters
   //bool fUseLookupTable;
   //double fa4;
@@ -23,6 +23,7 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Conventions/Units.h"
 #include "Physics/Coherent/XSection/COHXSecAR.h"
+#include "Physics/Coherent/XSection/AlvarezRusoCOHPiPXSec.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -35,6 +36,14 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+namespace {
+  ROOT::Math::IBaseFunctionMultiDim * MakeIntegrand(
+      const XSecAlgorithmI * model, const Interaction * in)
+  {
+    return new utils::gsl::d4Xsec_dEldThetaldOmegapi(model, in);
+  }
+}
+
 //____________________________________________________________________________
 COHXSecAR::COHXSecAR() :
 XSecIntegratorI("genie::COHXSecAR")
@@ -79,6 +88,14 @@ double COHXSecAR::Integrate(
   Interaction * interaction = new Interaction(*in);
   interaction->SetBit(kISkipProcessChk);
   //interaction->SetBit(kISkipKinematicChk);
+
+  // solve the pion wavefunctions for the pion energies of the integration
+  // range (E_pi = Enu - Elep) at once
+  const AlvarezRusoCOHPiPXSec * ar_model = 
+     dynamic_cast<const AlvarezRusoCOHPiPXSec *> (model);
+  if (ar_model) {
+    ar_model->PrecomputeWavefunctions(interaction, Enu - Elep_max, Enu - Elep_min);
+  }
   
   double xsec = 0;
   if (fSplitIntegral) {
@@ -107,19 +124,12 @@ double COHXSecAR::Integrate(
     //~ double kine_min[5] = { Elep_min, zero , zero    , zero, zero };
     //~ double kine_max[5] = { Elep_max, pi   , twopi   , pi  , twopi};
     
-    ROOT::Math::IBaseFunctionMultiDim * func = 
-          new utils::gsl::d4Xsec_dEldThetaldOmegapi(model, interaction);
     double kine_min[4] = { Elep_min, zero , zero    , zero    };
     double kine_max[4] = { Elep_max, pi   , pi      , twopi   };
     
-    ROOT::Math::IntegrationMultiDim::Type ig_type = 
-      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-        
     double abstol = 1; //We mostly care about relative tolerance.
-    ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-  
-    xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-    delete func;
+    xsec = this->IntegrateNDim(MakeIntegrand, model, interaction,
+               4, kine_min, kine_max, abstol, false) * (1E-38 * units::cm2);
   }
 
   delete interaction;
@@ -151,6 +161,7 @@ void COHXSecAR::LoadConfig(void)
   GetParamDef( "gsl-relative-tolerance", fGSLRelTol,  0.01) ;
   GetParamDef( "split-integral", fSplitIntegral, true ) ;
 
+  this->LoadIntegratorConfig();
 }
 //_____________________________________________________________________________
 
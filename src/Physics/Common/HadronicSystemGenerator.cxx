@@ -217,7 +217,7 @@ int HadronicSystemGenerator::HadronShowerCharge(GHepRecord * evrec) const
 
   double qfsl  = interaction->FSPrimLepton()->Charge() / 3.;
   double qp    = interaction->InitState().Probe()->Charge() / 3.;
-  double qnuc  = PDGLibrary::Instance()->Find(hit_nucleon)->Charge() / 3.;
+  double qnuc  = PDGLibrary::Instance()->Charge(hit_nucleon) / 3.;
 
   // probe + nucleon - primary final state lepton
   hadronShowerCharge = (int) (qp + qnuc - qfsl);
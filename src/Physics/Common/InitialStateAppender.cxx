@@ -77,16 +77,14 @@ void InitialStateAppender::AddNeutrino(GHepRecord * evrec) const
   Interaction * interaction = evrec->Summary();
   const InitialState & init_state = interaction->InitState();
 
-  TLorentzVector * p4 = init_state.GetProbeP4(kRfLab);
+  const TLorentzVector & p4 = init_state.ProbeP4();
   const TLorentzVector v4(0.,0.,0.,0.);
 
   int pdgc = init_state.ProbePdg();
 
   LOG("ISApp", pINFO) << "Adding neutrino [pdgc = " << pdgc << "]";
 
-  evrec->AddParticle(pdgc,kIStInitialState, -1,-1,-1,-1, *p4, v4);
-
-  delete p4;
+  evrec->AddParticle(pdgc,kIStInitialState, -1,-1,-1,-1, p4, v4);
 }
 //___________________________________________________________________________
 void InitialStateAppender::AddNucleus(GHepRecord * evrec) const
@@ -103,7 +101,7 @@ void InitialStateAppender::AddNucleus(GHepRecord * evrec) const
   int    A    = init_state.Tgt().A();
   int    Z    = init_state.Tgt().Z();
   int    pdgc = pdg::IonPdgCode(A, Z);
-  double M    = PDGLibrary::Instance()->Find(pdgc)->Mass();
+  double M    = PDGLibrary::Instance()->Mass(pdgc);
 
   LOG("ISApp", pINFO)
           << "Adding nucleus [A = " << A << ", Z = " << Z
@@ -125,7 +123,7 @@ void InitialStateAppender::AddStruckParticle(GHepRecord * evrec) const
 
   if(hit_e) {
     int    pdgc = kPdgElectron;
-    double mass = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double mass = PDGLibrary::Instance()->Mass(pdgc);
     const TLorentzVector p4(0,0,0, mass);
     const TLorentzVector v4(0.,0.,0.,0.);
 
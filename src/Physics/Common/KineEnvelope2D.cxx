@@ -0,0 +1,90 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/Common/KineEnvelope2D.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+KineEnvelope2D::KineEnvelope2D() :
+fNS(0),
+fNT(0)
+{
+
+}
+//____________________________________________________________________________
+KineEnvelope2D::KineEnvelope2D(int ns, int nt)
+{
+  if(ns < 1 || nt < 1) {
+    LOG("Kinematics", pFATAL)
+      << "Invalid envelope table: " << ns << " x " << nt << " cells";
+    exit(1);
+  }
+  fNS = ns;
+  fNT = nt;
+  fCells.assign(ns * nt, 0.);
+}
+//____________________________________________________________________________
+KineEnvelope2D::~KineEnvelope2D()
+{
+
+}
+//____________________________________________________________________________
+void KineEnvelope2D::SetCell(int is, int it, double g)
+{
+  fCells[is * fNT + it] = g;
+}
+//____________________________________________________________________________
+bool KineEnvelope2D::Build(void)
+{
+  return fSampler.Build(fCells);
+}
+//____________________________________________________________________________
+double KineEnvelope2D::Sample(
+           double r1, double r2, double r3, double & s, double & t) const
+{
+  int icell = fSampler.Sample(r1);
+  int is = icell / fNT;
+  int it = icell % fNT;
+  s = (is + r2) / fNS;
+  t = (it + r3) / fNT;
+  return fCells[icell];
+}
+//____________________________________________________________________________
+double KineEnvelope2D::Value(double s, double t) const
+{
+  return fCells[this->Cell(s,t)];
+}
+//____________________________________________________________________________
+void KineEnvelope2D::Raise(double s, double t, double g)
+{
+  int icell = this->Cell(s,t);
+  if(g <= fCells[icell]) return;
+  fCells[icell] = g;
+  this->Build();
+}
+//____________________________________________________________________________
+int KineEnvelope2D::Cell(double s, double t) const
+{
+  int is = (int) (s * fNS);
+  int it = (int) (t * fNT);
+  if(is < 0) is = 0;
+  if(it < 0) it = 0;
+  if(is >= fNS) is = fNS-1;
+  if(it >= fNT) it = fNT-1;
+  return is * fNT + it;
+}
+//____________________________________________________________________________
@@ -0,0 +1,77 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::KineEnvelope2D
+
+\brief    Tabulated, piecewise constant envelope of a differential cross
+          section over two kinematical variables, for sampling kinematics
+          with the rejection method.
+
+          The variables are normalised to s,t in [0,1] and the unit square
+          is divided in ns x nt cells, each holding an upper bound of the
+          differential cross section over the cell. A candidate (s,t) is
+          drawn by picking a cell with the alias method, with probability
+          proportional to its value (times its area, equal for all cells),
+          and then a uniform point within the cell: candidates are thus
+          distributed as the envelope, and accepting them with probability
+          xsec / envelope yields unweighted kinematics, with much fewer
+          rejections than a single maximum over the whole phase space for
+          a peaked cross section.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _KINE_ENVELOPE_2D_H_
+#define _KINE_ENVELOPE_2D_H_
+
+#include <vector>
+
+#include "Framework/Numerical/AliasSampler.h"
+
+namespace genie {
+
+class KineEnvelope2D {
+
+public:
+  KineEnvelope2D();
+  KineEnvelope2D(int ns, int nt);
+ ~KineEnvelope2D();
+
+  int    NS      (void) const { return fNS; }
+  int    NT      (void) const { return fNT; }
+
+  //! Set the value of cell (is,it); Build() must be called afterwards
+  void   SetCell (int is, int it, double g);
+  //! Build the cell sampling table; false if no cell is positive
+  bool   Build   (void);
+  bool   IsBuilt (void) const { return !fSampler.IsEmpty(); }
+
+  //! Draw (s,t) from the envelope with the uniform random numbers r1
+  //! (cell) and r2,r3 (position within the cell); returns the envelope
+  //! at (s,t)
+  double Sample  (double r1, double r2, double r3, double & s, double & t) const;
+  //! The envelope at (s,t)
+  double Value   (double s, double t) const;
+  //! Raise the envelope of the cell holding (s,t) to g (if it is lower)
+  //! and rebuild the table
+  void   Raise   (double s, double t, double g);
+
+private:
+  int    Cell    (double s, double t) const;
+
+  int                 fNS;
+  int                 fNT;
+  std::vector<double> fCells;   ///< value per cell, s-major
+  AliasSampler        fSampler;
+};
+
+}      // genie namespace
+
+#endif // _KINE_ENVELOPE_2D_H_
@@ -15,6 +15,16 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the optional kinematics sampling from tabulated envelopes of the
+   differential cross section (see KineEnvelope2D).
+   Added CountKineThrows(), recording the rejection sampling statistics of
+   the generators (see KineSamplingStats).
+   Added the optional online tightening of the max xsec (adaptive safety
+   factors), with the tuned factors optionally kept in the cache.
+   The adaptive max xsec is never tightened below the computed max xsec nor
+   by more than AdaptiveSafetyFactor-MinScale, and it switches on the
+   KineSamplingStats collection, recording the max xsec violations.
 
 */
 //____________________________________________________________________________
@@ -26,43 +36,141 @@
 //#include <TSQLResult.h>
 //#include <TSQLRow.h>
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Physics/Common/KineGeneratorWithCache.h"
+#include "Physics/Common/KineEnvelope2D.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
+#include "Framework/EventGen/EventGeneratorI.h"
+#include "Framework/EventGen/KineSamplingStats.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/Spline.h"
 
 using std::ostringstream;
 using std::map;
 
 using namespace genie;
 
+//___________________________________________________________________________
+namespace {
+  // the cache branches found by each generator, per interaction: kept per
+  // thread (each event generation thread has its own cache) and valid for
+  // as long as the revision of the cache is unchanged
+  struct CacheBranchHandles {
+    CacheBranchHandles() : revision(0) { }
+    unsigned long                revision;
+    map<string, CacheBranchFx *> branches;
+  };
+  thread_local map<const KineGeneratorWithCache *, CacheBranchHandles> gCacheBranchHandles;
+
+  // the tabulated envelopes built by each generator, per xsec model,
+  // interaction and energy bin: kept per thread too, as they are raised
+  // during event generation
+  struct TabulatedEnvelopes {
+   ~TabulatedEnvelopes() {
+      map<string, KineEnvelope2D *>::iterator iter = envelopes.begin();
+      for( ; iter != envelopes.end(); ++iter) delete iter->second;
+    }
+    map<string, KineEnvelope2D *> envelopes;
+  };
+  thread_local map<const KineGeneratorWithCache *, TabulatedEnvelopes> gTabulatedEnvelopes;
+
+  // max xsec (or tabulated envelope) violations seen since the last
+  // CountKineThrows() call of the running thread
+  thread_local long int gNXSecViolations = 0;
+
+  // the adaptive max xsec scale factors of each generator, per interaction
+  // and energy bin: kept per thread too, as they are tuned during event
+  // generation
+  struct AdaptiveFactor {
+    AdaptiveFactor() : scale(1), nselected(0), ntrials(0), maxratio(0),
+                       tuned(false), reverted(false) { }
+    double   scale;     ///< multiplies the max xsec (1: as configured)
+    long int nselected; ///< selected kinematics
+    long int ntrials;   ///< trials
+    double   maxratio;  ///< largest xsec / (configured) max xsec seen
+    bool     tuned;     ///< warm-up done?
+    bool     reverted;  ///< tightened max xsec violated: as configured from then on
+  };
+  thread_local map<const KineGeneratorWithCache *,
+                   map<string, AdaptiveFactor> > gAdaptiveFactors;
+
+  // the adaptive factor used by the kinematics selection of the running
+  // thread (from MaxXSec() to CountKineThrows())
+  struct AdaptiveSelection {
+    AdaptiveSelection() : generator(0), factor(0), evrec(0), ie(0),
+                          scale(1), ntrials(0) { }
+    const KineGeneratorWithCache * generator;
+    AdaptiveFactor *               factor;
+    GHepRecord *                   evrec;
+    int                            ie;      ///< energy bin
+    double                         scale;   ///< scale of the selection's max xsec
+    long int                       ntrials; ///< trials checked so far
+  };
+  thread_local AdaptiveSelection gAdaptiveSelection;
+
+  // the cache branch keeping the tuned factors of a generator & interaction,
+  // vs the energy bin
+  CacheBranchFx * AdaptiveFactorBranch(
+      const string & algkey, const string & intkey, bool create)
+  {
+    Cache * cache = Cache::Instance();
+    string key = cache->CacheBranchKey(algkey, intkey + "/AdaptiveSafetyFactor");
+    CacheBranchFx * cb =
+        dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+    if(!cb && create) {
+      cb = new CacheBranchFx("max[d^nXSec/d^n{K}] scale factor vs energy bin");
+      cache->AddCacheBranch(key, cb);
+    }
+    return cb;
+  }
+}
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache() :
-EventRecordVisitorI()
+EventRecordVisitorI(),
+fUseTabulatedEnvelope(false),
+fAdaptiveSafetyFactor(false),
+fAdaptiveMinScale(1.)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name) :
-EventRecordVisitorI(name)
+EventRecordVisitorI(name),
+fUseTabulatedEnvelope(false),
+fAdaptiveSafetyFactor(false),
+fAdaptiveMinScale(1.)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name, string config) :
-EventRecordVisitorI(name, config)
+EventRecordVisitorI(name, config),
+fUseTabulatedEnvelope(false),
+fAdaptiveSafetyFactor(false),
+fAdaptiveMinScale(1.)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::~KineGeneratorWithCache()
 {
-
+  gCacheBranchHandles.erase(this);
+  gTabulatedEnvelopes.erase(this);
+  gAdaptiveFactors.erase(this);
+  if(gAdaptiveSelection.generator == this) gAdaptiveSelection = AdaptiveSelection();
+
+  map<string, Spline *>::iterator iter = fMaxXSecEnvelope.begin();
+  for( ; iter != fMaxXSecEnvelope.end(); ++iter) {
+    delete iter->second;
+  }
+  fMaxXSecEnvelope.clear();
 }
 //___________________________________________________________________________
 double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
@@ -76,7 +184,7 @@ double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
   LOG("Kinematics", pINFO)
                   << "Attempting to find a cached max{dxsec/dK} value";
   xsec_max = this->FindMaxXSec(interaction);
-  if(xsec_max>0) return xsec_max;
+  if(xsec_max>0) return this->AdaptMaxXSec(event_rec, xsec_max);
 
   LOG("Kinematics", pINFO)
                   << "Attempting to compute the max{dxsec/dK} value";
@@ -84,7 +192,7 @@ double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
   if(xsec_max>0) {
      LOG("Kinematics", pINFO) << "max{dxsec/dK} = " << xsec_max;
      this->CacheMaxXSec(interaction, xsec_max);
-     return xsec_max;
+     return this->AdaptMaxXSec(event_rec, xsec_max);
   }
 
   LOG("Kinematics", pNOTICE)
@@ -121,6 +229,21 @@ double KineGeneratorWithCache::FindMaxXSec(
      return -1.;
   }
 
+  // look-up the envelope precomputed at initialization, if any
+  if( ! fMaxXSecEnvelope.empty() ) {
+     map<string, Spline *>::const_iterator eiter =
+                         fMaxXSecEnvelope.find(interaction->AsString());
+     if(eiter != fMaxXSecEnvelope.end()) {
+       const Spline * envelope = eiter->second;
+       if( E >= envelope->XMin() && E <= envelope->XMax()) {
+         double env_max_xsec = envelope->Evaluate(E);
+         LOG("Kinematics", pINFO)
+            << "\nPrecomputed: max xsec (E=" << E << ") = " << env_max_xsec;
+         return env_max_xsec;
+       }
+     }
+  }
+
   // access the the cache branch
   CacheBranchFx * cb = this->AccessCacheBranch(interaction);
 
@@ -141,10 +264,9 @@ double KineGeneratorWithCache::FindMaxXSec(
   // if there are not enough points at the cache buffer to have a spline,
   // look whether there is another point that is sufficiently close
   double dE = TMath::Min(0.25, 0.05*E);
-  const map<double,double> & fmap = cb->Map();
-  map<double,double>::const_iterator iter = fmap.lower_bound(E);
-  if(iter != fmap.end()) {
-     if(TMath::Abs(E - iter->first) < dE) return iter->second;
+  unsigned int ip = cb->LowerBound(E);
+  if(ip < cb->NPoints()) {
+     if(TMath::Abs(E - cb->X()[ip]) < dE) return cb->Y()[ip];
   }
 
   return -1;
@@ -201,7 +323,7 @@ void KineGeneratorWithCache::CacheMaxXSec(
   if(max_xsec>0) cb->AddValues(E,max_xsec);
 
   if(! cb->Spl() ) {
-    if( cb->Map().size() > 40 ) cb->CreateSpline();
+    if( cb->NPoints() > 40 ) cb->CreateSpline();
   }
 
   if( cb->Spl() ) {
@@ -211,6 +333,107 @@ void KineGeneratorWithCache::CacheMaxXSec(
   }
 }
 //___________________________________________________________________________
+bool KineGeneratorWithCache::LoadMaxXSecEnvelope(
+          const Interaction * interaction, double Emin, double Emax) const
+{
+// Builds the envelope from the cached max xsec values (eg read from a cache
+// file saved by a previous job), if these cover the requested probe energy
+// range
+
+  Cache * cache = Cache::Instance();
+  string key = cache->CacheBranchKey(this->Id().Key(), interaction->AsString());
+
+  CacheBranchFx * cb =
+           dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if(!cb) return false;
+  if(!cb->Spl()) return false;
+  if(cb->Spl()->XMin() > this->EnergyAt(interaction, Emin) ||
+     cb->Spl()->XMax() < this->EnergyAt(interaction, Emax)) return false;
+
+  if(!this->BuildMaxXSecEnvelope(interaction, cb->X(), cb->Y())) return false;
+
+  LOG("Kinematics", pINFO)
+     << "Loaded max{dxsec/dK} envelope from the cache for "
+     << interaction->AsString();
+  return true;
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::MaxXSecAt(
+                          const Interaction * interaction, double E) const
+{
+// Computes the max xsec at the input probe energy, with the xsec model of the
+// running thread (the caller is expected to have updated it)
+
+  RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
+  fXSecModel = rtinfo->RunningThread()->CrossSectionAlg();
+
+  Interaction * in = new Interaction(*interaction);
+  in->InitStatePtr()->SetProbeE(E);
+
+  double xsec_max = this->ComputeMaxXSec(in);
+  delete in;
+
+  return xsec_max;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::SetMaxXSecEnvelope(const Interaction * interaction,
+             const vector<double> & E, const vector<double> & xsec) const
+{
+// Sets the max xsec envelope for the input interaction from the max xsec
+// values at the input probe energies (see MaxXSecAt()). The non-positive
+// values are skipped. The points are added to the cache too, so that they
+// are saved along with it
+
+  vector<double> x, y;
+  for(unsigned int i = 0; i < E.size() && i < xsec.size(); i++) {
+    if(xsec[i] > 0) {
+      x.push_back(this->EnergyAt(interaction, E[i]));
+      y.push_back(xsec[i]);
+    }
+  }
+  if(!this->BuildMaxXSecEnvelope(interaction, x, y)) return;
+
+  CacheBranchFx * cb = this->AccessCacheBranch(interaction);
+  for(unsigned int i = 0; i < x.size(); i++) {
+    cb->AddValues(x[i], y[i]);
+  }
+  cb->CreateSpline();
+}
+//___________________________________________________________________________
+bool KineGeneratorWithCache::BuildMaxXSecEnvelope(const Interaction * interaction,
+             const vector<double> & x, const vector<double> & y) const
+{
+// Builds the envelope from max xsec values vs the energy used for caching
+
+  if(x.size() < 2) {
+    LOG("Kinematics", pWARN)
+       << "Not enough points for a max{dxsec/dK} envelope for "
+       << interaction->AsString();
+    return false;
+  }
+
+  string intkey = interaction->AsString();
+  map<string, Spline *>::iterator iter = fMaxXSecEnvelope.find(intkey);
+  if(iter != fMaxXSecEnvelope.end()) delete iter->second;
+
+  vector<double> xs(x), ys(y);
+  fMaxXSecEnvelope[intkey] = new Spline(xs.size(), &xs[0], &ys[0]);
+  return true;
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::EnergyAt(
+                         const Interaction * interaction, double E) const
+{
+// Returns the energy used for caching (see Energy()) for the input probe
+// energy
+
+  Interaction * in = new Interaction(*interaction);
+  in->InitStatePtr()->SetProbeE(E);
+  double Ec = this->Energy(in);
+  delete in;
+  return Ec;
+}
+//___________________________________________________________________________
 double KineGeneratorWithCache::Energy(const Interaction * interaction) const
 {
 // Returns the neutrino energy at the struck nucleon rest frame. Kinematic
@@ -229,10 +452,20 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
 // branch is found then one is created.
 
   Cache * cache = Cache::Instance();
+  string intkey = interaction->AsString();
+
+  // branch found at an earlier call?
+  CacheBranchHandles & handles = gCacheBranchHandles[this];
+  if(handles.revision != cache->Revision()) {
+    handles.branches.clear();
+    handles.revision = cache->Revision();
+  }
+  map<string, CacheBranchFx *>::const_iterator hiter =
+                                            handles.branches.find(intkey);
+  if(hiter != handles.branches.end()) return hiter->second;
 
   // build the cache branch key as: namespace::algorithm/config/interaction
   string algkey = this->Id().Key();
-  string intkey = interaction->AsString();
   string key    = cache->CacheBranchKey(algkey, intkey);
 
   CacheBranchFx * cache_branch =
@@ -247,16 +480,54 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
   }
   assert(cache_branch);
 
+  handles.branches.insert(
+      map<string, CacheBranchFx *>::value_type(intkey, cache_branch));
+
   return cache_branch;
 }
 //___________________________________________________________________________
 void KineGeneratorWithCache::AssertXSecLimits(
          const Interaction * interaction, double xsec, double xsec_max) const
 {
+  // with the adaptive max xsec, track the largest xsec / max xsec ratio and,
+  // at a violation of a tightened max xsec, revert to the configured safety
+  // factor and regenerate the event (its kinematics were selected below a
+  // max xsec known to be too low)
+  AdaptiveSelection & adaptive = gAdaptiveSelection;
+  if(adaptive.generator == this && xsec_max > 0) {
+    adaptive.ntrials++;
+    AdaptiveFactor * factor = adaptive.factor;
+    factor->maxratio = TMath::Max(factor->maxratio, adaptive.scale * xsec/xsec_max);
+
+    if(xsec > xsec_max && adaptive.scale < 1) {
+      gNXSecViolations++;
+      LOG("Kinematics", pWARN)
+         << "xsec: (curr) = " << xsec << " > (tightened max) = " << xsec_max
+         << " - Reverting to the configured safety factor\n for " << *interaction;
+      factor->scale    = 1;
+      factor->reverted = true;
+      if(fAdaptiveUseCache) {
+        AdaptiveFactorBranch(this->Id().Key(), interaction->AsString(), true)
+            ->SetValue(adaptive.ie, 1.);
+      }
+      GHepRecord * evrec = adaptive.evrec;
+      this->CountKineThrows(interaction, adaptive.ntrials, false);
+
+      evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
+      evrec->Summary()->ResetBit(kISkipProcessChk);
+      evrec->Summary()->ResetBit(kISkipKinematicChk);
+      genie::exceptions::EVGThreadException exception;
+      exception.SetReason("kinematics generation: tightened max_xsec exceeded");
+      exception.SwitchOnFastForward();
+      throw exception;
+    }
+  }
+
   // check the computed cross section for the current kinematics against the
   // maximum cross section used in the rejection MC method for the current
   // interaction at the current energy.
   if(xsec>xsec_max) {
+    gNXSecViolations++;
     double f = 200*(xsec-xsec_max)/(xsec_max+xsec);
     if(f>fMaxXSecDiffTolerance) {
        LOG("Kinematics", pFATAL) 
@@ -281,3 +552,305 @@ void KineGeneratorWithCache::AssertXSecLimits(
   }
 }
 //___________________________________________________________________________
+KineEnvelope2D * KineGeneratorWithCache::TabulatedEnvelope(
+                                      const Interaction * interaction) const
+{
+// Returns the tabulated envelope for this interaction, with the xsec model of
+// the running thread, in the energy bin of the energy used for caching (see
+// Energy()). If no envelope is found then one is built.
+
+  // no adaptive max xsec with the tabulated envelope
+  if(gAdaptiveSelection.generator == this) gAdaptiveSelection = AdaptiveSelection();
+
+  double E = this->Energy(interaction);
+  if(E <= 0) return 0;
+
+  int ie = TMath::FloorNint(TMath::Log10(E) * fEnvelopeNEPerDecade);
+
+  ostringstream key;
+  key << fXSecModel->Id().Key() << "/" << interaction->AsString() << "/" << ie;
+
+  TabulatedEnvelopes & tabulated = gTabulatedEnvelopes[this];
+  map<string, KineEnvelope2D *>::const_iterator iter =
+                                   tabulated.envelopes.find(key.str());
+  if(iter != tabulated.envelopes.end()) return iter->second;
+
+  double E0 = TMath::Power(10., double(ie)   / fEnvelopeNEPerDecade);
+  double E1 = TMath::Power(10., double(ie+1) / fEnvelopeNEPerDecade);
+
+  KineEnvelope2D * envelope = this->BuildTabulatedEnvelope(interaction, E0, E1);
+  tabulated.envelopes.insert(
+      map<string, KineEnvelope2D *>::value_type(key.str(), envelope));
+
+  return envelope;
+}
+//___________________________________________________________________________
+KineEnvelope2D * KineGeneratorWithCache::BuildTabulatedEnvelope(
+           const Interaction * interaction, double E0, double E1) const
+{
+// Tabulates the xsec at the nodes and centres of the cells of the normalised
+// variables, for an on-shell hit nucleon at rest and at both edges E0, E1 of
+// the energy bin. Each cell gets the max of its 5 points, with a floor (so
+// that a cell where the xsec only opens up within the bin is not excluded),
+// times the safety factor.
+
+  int ns = fEnvelopeNS;
+  int nt = fEnvelopeNT;
+
+  vector<double> nodes  ((ns+1)*(nt+1), 0.);
+  vector<double> centres(ns*nt,         0.);
+
+  Interaction * in = new Interaction(*interaction);
+  in->SetBit(kISkipProcessChk,   interaction->TestBit(kISkipProcessChk));
+  in->SetBit(kISkipKinematicChk, interaction->TestBit(kISkipKinematicChk));
+
+  Target * tgt = in->InitStatePtr()->TgtPtr();
+  if(tgt->HitNucIsSet()) {
+    TLorentzVector p4(0, 0, 0, tgt->HitNucMass());
+    tgt->SetHitNucP4(p4);
+  }
+
+  double Eb[2] = { E0, E1 };
+  for(int ib = 0; ib < 2; ib++) {
+    in->InitStatePtr()->SetProbeE(Eb[ib]);
+    for(int is = 0; is <= ns; is++) {
+      for(int it = 0; it <= nt; it++) {
+        double xsec = this->TabulatedEnvelopeXSec(in, double(is)/ns, double(it)/nt);
+        double & g  = nodes[is*(nt+1) + it];
+        g = TMath::Max(g, xsec);
+      }
+    }
+    for(int is = 0; is < ns; is++) {
+      for(int it = 0; it < nt; it++) {
+        double xsec = this->TabulatedEnvelopeXSec(in, (is+0.5)/ns, (it+0.5)/nt);
+        double & g  = centres[is*nt + it];
+        g = TMath::Max(g, xsec);
+      }
+    }
+  }
+  delete in;
+
+  double gmax = 0;
+  for(int is = 0; is < ns; is++) {
+    for(int it = 0; it < nt; it++) {
+      double & g = centres[is*nt + it];
+      g = TMath::Max(g, nodes[ is   *(nt+1) + it  ]);
+      g = TMath::Max(g, nodes[ is   *(nt+1) + it+1]);
+      g = TMath::Max(g, nodes[(is+1)*(nt+1) + it  ]);
+      g = TMath::Max(g, nodes[(is+1)*(nt+1) + it+1]);
+      gmax = TMath::Max(gmax, g);
+    }
+  }
+  if(gmax <= 0) {
+    LOG("Kinematics", pWARN)
+       << "Vanishing xsec for E in [" << E0 << ", " << E1
+       << "] GeV - No tabulated envelope for " << interaction->AsString();
+    return 0;
+  }
+
+  KineEnvelope2D * envelope = new KineEnvelope2D(ns, nt);
+  for(int is = 0; is < ns; is++) {
+    for(int it = 0; it < nt; it++) {
+      double g = TMath::Max(centres[is*nt + it], fEnvelopeFloor * gmax);
+      envelope->SetCell(is, it, fEnvelopeSafetyFactor * g);
+    }
+  }
+  envelope->Build();
+
+  LOG("Kinematics", pINFO)
+     << "Tabulated the max{dxsec/dK} envelope for E in [" << E0 << ", " << E1
+     << "] GeV (" << ns << " x " << nt << " cells) for "
+     << interaction->AsString();
+
+  return envelope;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::RaiseTabulatedEnvelope(
+             KineEnvelope2D * envelope, const Interaction * interaction,
+             double s, double t, double xsec, double g) const
+{
+  LOG("Kinematics", pWARN)
+     << "xsec: (curr) = " << xsec << " > (envelope) = " << g
+     << " - Raising the tabulated envelope\n for " << *interaction;
+
+  gNXSecViolations++;
+
+  envelope->Raise(s, t, fEnvelopeSafetyFactor * xsec);
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::CountKineThrows(
+      const Interaction * interaction, long int ntrials, bool selected) const
+{
+// Records the outcome of a kinematics selection (called once the kinematics
+// are selected, or before giving up), with the max xsec violations seen
+// during its trials
+
+  long int nviolations = gNXSecViolations;
+  gNXSecViolations = 0;
+
+  // with the adaptive max xsec, tighten it at the end of the warm-up
+  AdaptiveSelection adaptive = gAdaptiveSelection;
+  gAdaptiveSelection = AdaptiveSelection();
+  if(adaptive.generator == this) {
+    AdaptiveFactor * factor = adaptive.factor;
+    factor->ntrials += ntrials;
+    if(selected) factor->nselected++;
+
+    if(!factor->tuned && factor->nselected >= fAdaptiveNWarmUp) {
+      factor->tuned = true;
+      double scale = factor->maxratio * fAdaptiveMargin;
+      if(factor->maxratio > 0 && scale < 1) {
+        factor->scale = TMath::Max(scale, fAdaptiveMinScale);
+        if(fAdaptiveUseCache) {
+          AdaptiveFactorBranch(this->Id().Key(), interaction->AsString(), true)
+              ->SetValue(adaptive.ie, factor->scale);
+        }
+      }
+      double E0 = TMath::Power(10., double(adaptive.ie)   / fAdaptiveNEPerDecade);
+      double E1 = TMath::Power(10., double(adaptive.ie+1) / fAdaptiveNEPerDecade);
+      LOG("Kinematics", pNOTICE)
+         << "Adaptive max{dxsec/dK} for E in [" << E0 << ", " << E1 << "] GeV: "
+         << "largest xsec/max = " << factor->maxratio << " in "
+         << factor->nselected << " selections (acceptance = "
+         << double(factor->nselected)/TMath::Max(factor->ntrials, 1L)
+         << ") - Scaling the max xsec by " << factor->scale
+         << "\n for " << interaction->AsString();
+    }
+  }
+
+  if(!KineSamplingStats::IsEnabled()) return;
+
+  KineSamplingStats::Instance()->Add(this->Id().Key(),
+     interaction->AsString(), this->Energy(interaction),
+     ntrials, nviolations, selected);
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::TabulatedEnvelopeXSec(
+                              Interaction * /*in*/, double, double) const
+{
+  LOG("Kinematics", pFATAL)
+     << this->Id().Name() << " does not support the tabulated envelope sampling";
+  exit(1);
+
+  return 0;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::LoadTabulatedEnvelopeConfig(void)
+{
+// Reads the configuration of the tabulated envelope sampling. Called by the
+// LoadConfig() of the generators supporting it.
+
+  GetParamDef( "UseTabulatedEnvelope",           fUseTabulatedEnvelope,  false ) ;
+  GetParamDef( "TabulatedEnvelope-NS",           fEnvelopeNS,            20    ) ;
+  GetParamDef( "TabulatedEnvelope-NT",           fEnvelopeNT,            20    ) ;
+  GetParamDef( "TabulatedEnvelope-NEPerDecade",  fEnvelopeNEPerDecade,   10    ) ;
+  GetParamDef( "TabulatedEnvelope-SafetyFactor", fEnvelopeSafetyFactor,  1.2   ) ;
+  GetParamDef( "TabulatedEnvelope-Floor",        fEnvelopeFloor,         1E-2  ) ;
+
+  if(fEnvelopeNS < 1 || fEnvelopeNT < 1 || fEnvelopeNEPerDecade < 1 ||
+     fEnvelopeSafetyFactor < 1 || fEnvelopeFloor < 0) {
+    LOG("Kinematics", pFATAL)
+       << "Invalid tabulated envelope configuration: " << fEnvelopeNS
+       << " x " << fEnvelopeNT << " cells, " << fEnvelopeNEPerDecade
+       << " energy bins per decade, safety factor = " << fEnvelopeSafetyFactor
+       << ", floor = " << fEnvelopeFloor;
+    exit(1);
+  }
+
+  // envelopes built with the previous configuration
+  gTabulatedEnvelopes.erase(this);
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::AdaptMaxXSec(
+                            GHepRecord * evrec, double xsec_max) const
+{
+// Scales the max xsec by the factor tuned for the interaction & energy bin (1
+// during the warm-up, or once the bin reverted to the configured safety
+// factor) and starts tracking the selection
+
+  gAdaptiveSelection = AdaptiveSelection();
+  if(!fAdaptiveSafetyFactor) return xsec_max;
+
+  const Interaction * interaction = evrec->Summary();
+  double E = this->Energy(interaction);
+  if(E <= 0) return xsec_max;
+
+  int ie = TMath::FloorNint(TMath::Log10(E) * fAdaptiveNEPerDecade);
+
+  ostringstream key;
+  key << interaction->AsString() << "/" << ie;
+
+  map<string, AdaptiveFactor> & factors = gAdaptiveFactors[this];
+  map<string, AdaptiveFactor>::iterator iter = factors.find(key.str());
+  if(iter == factors.end()) {
+    AdaptiveFactor factor;
+    // start from the factor tuned by an earlier job, if any (1 if the
+    // bin had reverted to the configured safety factor)
+    if(fAdaptiveUseCache) {
+      CacheBranchFx * cb = AdaptiveFactorBranch(
+                      this->Id().Key(), interaction->AsString(), false);
+      if(cb) {
+        unsigned int ip = cb->LowerBound(ie);
+        if(ip < cb->NPoints() && cb->X()[ip] == ie) {
+          factor.scale    = TMath::Range(fAdaptiveMinScale, 1., cb->Y()[ip]);
+          factor.tuned    = true;
+          factor.reverted = (factor.scale >= 1.);
+          LOG("Kinematics", pINFO)
+             << "Adaptive max{dxsec/dK} scale factor from the cache: "
+             << factor.scale << " for " << key.str();
+        }
+      }
+    }
+    iter = factors.insert(
+        map<string, AdaptiveFactor>::value_type(key.str(), factor)).first;
+  }
+
+  gAdaptiveSelection.generator = this;
+  gAdaptiveSelection.factor    = &(iter->second);
+  gAdaptiveSelection.evrec     = evrec;
+  gAdaptiveSelection.ie        = ie;
+  gAdaptiveSelection.scale     = iter->second.scale;
+
+  return xsec_max * iter->second.scale;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::LoadAdaptiveSafetyFactorConfig(void)
+{
+// Reads the configuration of the online tightening of the max xsec. Called by
+// the LoadConfig() of the generators using MaxXSec().
+
+  GetParamDef( "AdaptiveSafetyFactor",             fAdaptiveSafetyFactor, false ) ;
+  GetParamDef( "AdaptiveSafetyFactor-NWarmUp",     fAdaptiveNWarmUp,      200   ) ;
+  GetParamDef( "AdaptiveSafetyFactor-Margin",      fAdaptiveMargin,       1.2   ) ;
+  GetParamDef( "AdaptiveSafetyFactor-NEPerDecade", fAdaptiveNEPerDecade,  10    ) ;
+  GetParamDef( "AdaptiveSafetyFactor-UseCache",    fAdaptiveUseCache,     false ) ;
+  GetParamDef( "AdaptiveSafetyFactor-MinScale",    fAdaptiveMinScale,     0.8   ) ;
+
+  if(fAdaptiveNWarmUp < 1 || fAdaptiveMargin < 1 || fAdaptiveNEPerDecade < 1 ||
+     fAdaptiveMinScale <= 0 || fAdaptiveMinScale > 1) {
+    LOG("Kinematics", pFATAL)
+       << "Invalid adaptive safety factor configuration: " << fAdaptiveNWarmUp
+       << " warm-up selections, margin = " << fAdaptiveMargin << ", "
+       << fAdaptiveNEPerDecade << " energy bins per decade, min scale = "
+       << fAdaptiveMinScale;
+    exit(1);
+  }
+
+  // The max xsec is never tightened below the computed one, without the
+  // safety factor (loaded by the generator before calling this)
+  if(fSafetyFactor > 1) {
+    fAdaptiveMinScale = TMath::Max(fAdaptiveMinScale, 1./fSafetyFactor);
+  } else {
+    fAdaptiveMinScale = 1.;
+  }
+
+  // The events selected before a violation of a tightened max xsec keep
+  // the bias: record the violations, so that it can be told from the
+  // output (the gkinestats tree, see KineSamplingStats)
+  if(fAdaptiveSafetyFactor) KineSamplingStats::SetEnabled(true);
+
+  // factors tuned with the previous configuration
+  gAdaptiveFactors.erase(this);
+  if(gAdaptiveSelection.generator == this) gAdaptiveSelection = AdaptiveSelection();
+}
+//___________________________________________________________________________
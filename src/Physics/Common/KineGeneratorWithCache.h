@@ -13,6 +13,42 @@
           method for computing the maximum xsec in case it has not already
           being pushed into the cache at a previous iteration.
 
+          The max xsec can also be precomputed at initialization on an
+          energy grid (see GEVGDriver::PrecomputeMaxXSec()). The resulting
+          envelope is only read during event generation and it is consulted
+          before the cache, without any locking. Its points are also added
+          to the cache, so that a saved cache file can be reused by later
+          jobs without recomputing the envelope.
+
+          Generators may optionally sample their kinematics from a tabulated
+          envelope of the differential xsec (see KineEnvelope2D) over two
+          normalised kinematical variables, instead of uniformly below the
+          max xsec: the envelope is built, per thread, at the first event of
+          each interaction and probe energy bin (as the cell by cell max of
+          the xsec at the bin edges) and raised, with a warning, wherever the
+          exact xsec is found to exceed it.
+
+          The generators record the number of trials of each kinematics
+          selection, and the max xsec violations, with CountKineThrows():
+          see KineSamplingStats.
+
+          Optionally, the max xsec (including the configured safety factor)
+          can be tightened online, per thread, for each interaction and probe
+          energy bin: over the first selections (warm-up) the largest ratio
+          of the xsec to the max xsec is tracked, and the max xsec is then
+          scaled down to that ratio times a margin, but never below the
+          computed max xsec (without the safety factor) nor by more than a
+          configured min scale. At any violation of the tightened max xsec,
+          the bin reverts to the configured safety factor for the rest of
+          the job and the event is regenerated. The events selected in that
+          bin before the violation are NOT regenerated: they were sampled
+          from min(xsec, tightened max xsec) and stay biased. The violations
+          are counted in the KineSamplingStats, which are switched on with
+          the tightening and written to the output (gkinestats tree), so
+          that a job where it happened can be told.
+          The tuned factors are reported and can be kept in the cache, to be
+          reused by the later jobs (which skip the warm-up).
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -28,20 +64,34 @@
 #define _KINE_GENERATOR_WITH_CACHE_H_
 
 #include <string>
+#include <map>
+#include <vector>
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Utils/Range1.h"
 
 using std::string;
+using std::map;
+using std::vector;
 
 namespace genie {
 
+class Spline;
 class CacheBranchFx;
+class KineEnvelope2D;
 class XSecAlgorithmI;
 
 class KineGeneratorWithCache : public EventRecordVisitorI {
 
+public:
+  //-- init-time precomputation of the max xsec envelope
+  bool   CachesMaxXSec       (void) const { return true; }
+  bool   LoadMaxXSecEnvelope (const Interaction * in, double Emin, double Emax) const;
+  double MaxXSecAt           (const Interaction * in, double E) const;
+  void   SetMaxXSecEnvelope  (const Interaction * in,
+                              const vector<double> & E, const vector<double> & xsec) const;
+
 protected:
   KineGeneratorWithCache();
   KineGeneratorWithCache(string name);
@@ -54,16 +104,65 @@ protected:
   virtual void   CacheMaxXSec   (const Interaction * in, double xsec) const;
   virtual double Energy         (const Interaction * in) const;
 
+  bool   BuildMaxXSecEnvelope (const Interaction * in,
+                               const vector<double> & x, const vector<double> & y) const;
+  double EnergyAt             (const Interaction * in, double E) const;
+
   virtual CacheBranchFx * AccessCacheBranch (const Interaction * in) const;
 
   virtual void AssertXSecLimits (const Interaction * in, double xsec, double xsec_max) const;
 
+  //! Record the rejection sampling statistics (see KineSamplingStats) of a
+  //! kinematics selection, after ntrials trials: call it once the kinematics
+  //! are selected, or before giving up
+  void CountKineThrows (const Interaction * in, long int ntrials, bool selected) const;
+
+  //-- optional sampling from a tabulated envelope of the differential xsec
+
+  //! The tabulated envelope for the interaction and its energy bin (built at
+  //! the first call); 0 if the xsec vanishes over the whole bin
+  KineEnvelope2D * TabulatedEnvelope (const Interaction * in) const;
+  //! Raise the envelope at the normalised variables (s,t), where the exact
+  //! xsec was found to exceed its value g
+  void   RaiseTabulatedEnvelope (KineEnvelope2D * envelope, const Interaction * in,
+                                 double s, double t, double xsec, double g) const;
+  //! The differential xsec used for kinematics selection at the normalised
+  //! kinematical variables (s,t) in [0,1]: generators supporting the
+  //! tabulated envelope sampling must override it (in may be modified)
+  virtual double TabulatedEnvelopeXSec (Interaction * in, double s, double t) const;
+  void   LoadTabulatedEnvelopeConfig (void);
+
+  //-- optional online tightening of the max xsec
+
+  //! The max xsec to use for the selection at hand, given the cached (or
+  //! computed) one: called by MaxXSec()
+  double AdaptMaxXSec (GHepRecord * evrec, double xsec_max) const;
+  void   LoadAdaptiveSafetyFactorConfig (void);
+
+  KineEnvelope2D * BuildTabulatedEnvelope (const Interaction * in, double E0, double E1) const;
+
   mutable const XSecAlgorithmI * fXSecModel;
 
+  mutable map<string, Spline *> fMaxXSecEnvelope; ///< interaction -> max xsec envelope precomputed at init (read-only afterwards)
+
   double fSafetyFactor;         ///< maxxsec -> maxxsec * safety_factor
   double fMaxXSecDiffTolerance; ///< max{100*(xsec-maxxsec)/.5*(xsec+maxxsec)} if xsec>maxxsec
   double fEMin;                 ///< min E for which maxxsec is cached - forcing explicit calc.
   bool   fGenerateUniformly;    ///< uniform over allowed phase space + event weight?
+
+  bool   fUseTabulatedEnvelope;  ///< sample kinematics from tabulated envelopes?
+  int    fEnvelopeNS;            ///< envelope cells in the 1st normalised variable
+  int    fEnvelopeNT;            ///< envelope cells in the 2nd normalised variable
+  int    fEnvelopeNEPerDecade;   ///< envelope energy bins per decade
+  double fEnvelopeSafetyFactor;  ///< multiplies the tabulated xsec values
+  double fEnvelopeFloor;         ///< min cell value, as a fraction of the max cell value
+
+  bool   fAdaptiveSafetyFactor;  ///< tighten the max xsec online?
+  int    fAdaptiveNWarmUp;       ///< selections per interaction & energy bin before tightening
+  double fAdaptiveMargin;        ///< tightened max = margin x largest xsec/max seen
+  int    fAdaptiveNEPerDecade;   ///< energy bins per decade
+  bool   fAdaptiveUseCache;      ///< read & write back the tuned factors in the cache?
+  double fAdaptiveMinScale;      ///< the max xsec is not scaled below this (nor below 1/fSafetyFactor)
 };
 
 }      // genie namespace
@@ -0,0 +1,97 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include <TMath.h>
+
+#include "Framework/GHEP/GHepRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/Common/PrimaryLeptonFilter.h"
+
+using namespace genie;
+
+//___________________________________________________________________________
+PrimaryLeptonFilter::PrimaryLeptonFilter() :
+EventFilterI("genie::PrimaryLeptonFilter")
+{
+
+}
+//___________________________________________________________________________
+PrimaryLeptonFilter::PrimaryLeptonFilter(string config) :
+EventFilterI("genie::PrimaryLeptonFilter", config)
+{
+
+}
+//___________________________________________________________________________
+PrimaryLeptonFilter::~PrimaryLeptonFilter()
+{
+
+}
+//___________________________________________________________________________
+bool PrimaryLeptonFilter::AcceptEvent(const GHepRecord * event) const
+{
+  if(fCCOnly) {
+    Interaction * interaction = event->Summary();
+    if(!interaction || !interaction->ProcInfo().IsWeakCC()) return false;
+  }
+
+  GHepParticle * probe  = event->Probe();
+  GHepParticle * lepton = event->FinalStatePrimaryLepton();
+  if(!probe || !lepton) return false;
+
+  if(fLeptonPdg != 0 && TMath::Abs(lepton->Pdg()) != fLeptonPdg) return false;
+  if(lepton->E() < fMinEnergy) return false;
+
+  if(fMaxCosAngle > -1) {
+    TVector3 p_probe  = probe ->P4()->Vect();
+    TVector3 p_lepton = lepton->P4()->Vect();
+    double pp = p_probe.Mag() * p_lepton.Mag();
+    if(pp <= 0) return false;
+    if(p_probe.Dot(p_lepton) / pp < fMaxCosAngle) return false;
+  }
+
+  LOG("LeptonFilter", pDEBUG) << "Accepted event with a " << lepton->Name()
+     << " of E = " << lepton->E() << " GeV";
+
+  return true;
+}
+//___________________________________________________________________________
+void PrimaryLeptonFilter::Configure(const Registry & config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//___________________________________________________________________________
+void PrimaryLeptonFilter::Configure(string config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//___________________________________________________________________________
+void PrimaryLeptonFilter::LoadConfig(void)
+{
+  GetParamDef( "CCOnly",          fCCOnly,    false ) ;
+  GetParamDef( "LeptonPdg",       fLeptonPdg, 0     ) ;
+  GetParamDef( "MinLeptonEnergy", fMinEnergy, 0.    ) ; // GeV
+
+  double max_angle = 180.; // deg
+  GetParamDef( "MaxLeptonAngle", max_angle, 180. ) ;
+  fMaxCosAngle = TMath::Cos(max_angle * TMath::DegToRad());
+  if(max_angle >= 180.) fMaxCosAngle = -1;
+
+  fLeptonPdg = TMath::Abs(fLeptonPdg);
+}
+//___________________________________________________________________________
@@ -0,0 +1,53 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::PrimaryLeptonFilter
+
+\brief    An EventFilterI selecting the events from the kinematics of their
+          final state primary lepton (its type, energy & angle to the probe
+          direction), eg to generate only CC events with a forward muon above
+          1 GeV. It is run before the hadron transport, see EventFilterI.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _PRIMARY_LEPTON_FILTER_H_
+#define _PRIMARY_LEPTON_FILTER_H_
+
+#include "Framework/EventGen/EventFilterI.h"
+
+namespace genie {
+
+class PrimaryLeptonFilter : public EventFilterI {
+
+public :
+  PrimaryLeptonFilter();
+  PrimaryLeptonFilter(string config);
+ ~PrimaryLeptonFilter();
+
+  //-- implement the EventFilterI interface
+  bool AcceptEvent (const GHepRecord * event) const;
+
+  //-- override the Algorithm::Configure methods to load configuration
+  //   data to private data members
+  void Configure (const Registry & config);
+  void Configure (string param_set);
+
+private:
+  void LoadConfig (void);
+
+  bool   fCCOnly;       ///< keep only the weak CC events
+  int    fLeptonPdg;    ///< |pdg code| of the primary lepton (0: any)
+  double fMinEnergy;    ///< min primary lepton energy (GeV)
+  double fMaxCosAngle;  ///< cos of the max primary lepton angle to the probe
+};
+
+}      // genie namespace
+#endif // _PRIMARY_LEPTON_FILTER_H_
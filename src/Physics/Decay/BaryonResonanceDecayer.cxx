@@ -14,11 +14,20 @@
    Add dummy `UnInhibitDecay(int,TDecayChannel*) const' and `InhibitDecay(int,
    TDecayChannel*) const' methods to conform to the DecayModelI interface.
    To implement soon.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Cache the decay channels of each resonance (daughters, final state mass,
+   cumulative branching ratios) instead of reading them from the PDG database
+   at each decay.
+   Decays generated under the ProcessGeneratorLock (gRandom).
+   The decay tables are built at configuration and only read at decay time;
+   per-thread scratch buffer for the cumulative branching ratios and weight
+   of the last decay.
 */
 //____________________________________________________________________________
 
 #include <TClonesArray.h>
 #include <TDecayChannel.h>
+#include <TList.h>
 #include <RVersion.h>
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
 #include <TMCParticle.h>
@@ -33,12 +42,23 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Conventions/Constants.h"
 
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::constants;
+
+namespace {
+  // final state mass of the decay channels switched off (see FinalStateMass())
+  const double kDisabledChannelMass = 999999999;
+
+  // the weight of the last decay generated by the calling thread (the
+  // decayer is shared by the event generation threads, see Weight())
+  thread_local const BaryonResonanceDecayer * gLastDecayer = 0;
+  thread_local double                         gLastWeight  = 1.;
+}
 //____________________________________________________________________________
 BaryonResonanceDecayer::BaryonResonanceDecayer() :
 DecayModelI("genie::BaryonResonanceDecayer")
@@ -167,7 +187,8 @@ TClonesArray* BaryonResonanceDecayer::Decay(const DecayerInputs_t & inp) const
                         << " with P4 = " << utils::print::P4AsString(inp.P4);
   
   //-- Reset previous weight
-  fWeight = 1.;
+  gLastDecayer = this;
+  gLastWeight  = 1.;
 
   //-- Get the resonance mass W (generally different from the mass associated
   //   with the input pdg_code, since the it is produced off the mass shell)
@@ -175,57 +196,53 @@ TClonesArray* BaryonResonanceDecayer::Decay(const DecayerInputs_t & inp) const
   LOG("Decay", pINFO) << "Available mass W = " << W;
   
   //-- Get all decay channels
-  TObjArray * decay_list = mother->DecayList();
-  unsigned int nch = decay_list->GetEntries();
+  const DecayTable_t & table = this->DecayTable(inp.PdgCode);
+  unsigned int nch = table.channels.size();
   LOG("Decay", pINFO)
                << mother->GetName() << " has: " << nch << " decay channels";
 
   //-- Loop over the decay channels (dc) and write down the branching
   //   ratios to be used for selecting a decay channel.
   //   Since a baryon resonance can be created at W < Mres, explicitly
-  //   check and inhibit decay channels for which W > final-state-mass
-  
-  double BR[nch], tot_BR = 0;    
- 
-//------------------ cusomizing ------------------------------
-  if(inp.PdgCode== 2114 || inp.PdgCode==-2114 || inp.PdgCode==2214||inp.PdgCode==-2214){
-	  for(unsigned int ich = 0; ich < nch; ich++) {
+  //   check and inhibit decay channels for which W > final-state-mass.
+  //   If all channels are open, use the cached cumulative branching ratios.
 
-     TDecayChannel * ch = (TDecayChannel *) decay_list->At(ich);
-     double fsmass = this->FinalStateMass(ch);
+  bool is_delta = (inp.PdgCode== 2114 || inp.PdgCode==-2114 ||
+                   inp.PdgCode== 2214 || inp.PdgCode==-2214);
 
-     if(fsmass < W) {
-       SLOG("Decay", pDEBUG)
-               << "Using channel: " << ich 
-                        << " with final state mass = " << fsmass << " GeV";         
-       tot_BR += BaryonResonanceDecayer::DealsDeltaNGamma(inp.PdgCode, ich, W);
-     } else {       
-       SLOG("Decay", pINFO)
-               << "Suppresing channel: " << ich 
-                        << " with final state mass = " << fsmass << " GeV";         
-     }
-     BR[ich] = tot_BR;
-  }
-  }  else {
-  for(unsigned int ich = 0; ich < nch; ich++) {
+  const std::vector<double> * BR = &table.cum_br;
+  double tot_BR = (nch > 0) ? table.cum_br[nch-1] : 0;
 
-     TDecayChannel * ch = (TDecayChannel *) decay_list->At(ich);
-     double fsmass = this->FinalStateMass(ch);
+  // cumulative branching ratios of the open channels (per thread)
+  static thread_local std::vector<double> cum_br;
 
-     if(fsmass < W) {
-       SLOG("Decay", pDEBUG)
-               << "Using channel: " << ich 
-                        << " with final state mass = " << fsmass << " GeV";         
-       tot_BR += ch->BranchingRatio();
-     } else {       
-       SLOG("Decay", pINFO)
-               << "Suppresing channel: " << ich 
-                        << " with final state mass = " << fsmass << " GeV";         
-     }
-     BR[ich] = tot_BR;
-  }
+  if(is_delta || W <= table.max_fsmass) {
+    cum_br.resize(nch);
+    tot_BR = 0;
+    for(unsigned int ich = 0; ich < nch; ich++) {
+
+       const DecayChannel_t & ch = table.channels[ich];
+
+       if(ch.fsmass < W) {
+         SLOG("Decay", pDEBUG)
+                 << "Using channel: " << ich 
+                          << " with final state mass = " << ch.fsmass << " GeV";
+//------------------ cusomizing ------------------------------
+         if(is_delta) {
+           tot_BR += BaryonResonanceDecayer::DealsDeltaNGamma(inp.PdgCode, ich, W);
+         } else {
+           tot_BR += ch.br;
+         }
+//--------------customizing ends -----------------------------
+       } else {       
+         SLOG("Decay", pINFO)
+                 << "Suppresing channel: " << ich 
+                          << " with final state mass = " << ch.fsmass << " GeV";
+       }
+       cum_br[ich] = tot_BR;
+    }
+    BR = &cum_br;
   }
-//--------------customizing ends --------------------------------------------------
 /*  for(unsigned int ich = 0; ich < nch; ich++) {
 
      TDecayChannel * ch = (TDecayChannel *) decay_list->At(ich);
@@ -257,13 +274,13 @@ TClonesArray* BaryonResonanceDecayer::Decay(const DecayerInputs_t & inp) const
   do { 
     sel_ich = ich;
     
-  } while (x > BR[ich++]);
+  } while (x > (*BR)[ich++]);
 
-  TDecayChannel * ch = (TDecayChannel *) decay_list->At(sel_ich);
+  const DecayChannel_t & ch = table.channels[sel_ich];
 
   LOG("Decay", pINFO) 
-    << "Selected " << ch->NDaughters() << "-particle decay chan (" 
-    << sel_ich << ") has BR = " << ch->BranchingRatio();
+    << "Selected " << ch.pdgc.size() << "-particle decay chan (" 
+    << sel_ich << ") has BR = " << ch.br;
 
   //-- Decay the exclusive state and return the particle list
   TLorentzVector p4(*inp.P4);
@@ -273,16 +290,75 @@ TClonesArray* BaryonResonanceDecayer::Decay(const DecayerInputs_t & inp) const
 void BaryonResonanceDecayer::Initialize(void) const
 {
 
+}
+//____________________________________________________________________________
+const BaryonResonanceDecayer::DecayTable_t &
+  BaryonResonanceDecayer::DecayTable(int pdg_code) const
+{
+// Decay channels of the input resonance, as read from the PDG database at
+// configuration (only read here, so that the decayer can be shared by the
+// event generation threads)
+
+  std::map<int, DecayTable_t>::const_iterator it = fDecayTables.find(pdg_code);
+  if(it != fDecayTables.end()) return it->second;
+
+  LOG("Decay", pWARN)
+    << "No decay table for the resonance with PDG code = " << pdg_code
+    << " (not in the PDG database at configuration)";
+  static const DecayTable_t kNoDecayTable = DecayTable_t();
+  return kNoDecayTable;
+}
+//____________________________________________________________________________
+void BaryonResonanceDecayer::BuildDecayTable(TParticlePDG * mother)
+{
+// Reads the decay channels of the input resonance from the PDG database
+
+  int pdg_code = mother->PdgCode();
+
+  DecayTable_t table;
+  table.mass       = 0;
+  table.max_fsmass = 0;
+
+  TObjArray * decay_list = mother->DecayList();
+  unsigned int nch = (decay_list) ? decay_list->GetEntries() : 0;
+  table.mass = mother->Mass();
+
+  double tot_BR = 0;
+  for(unsigned int ich = 0; ich < nch; ich++) {
+     TDecayChannel * dc = (TDecayChannel *) decay_list->At(ich);
+
+     DecayChannel_t ch;
+     unsigned int nd = dc->NDaughters();
+     for(unsigned int id = 0; id < nd; id++) {
+       int daughter_code = dc->DaughterPdgCode(id);
+       TParticlePDG * daughter = PDGLibrary::Instance()->Find(daughter_code);
+       assert(daughter);
+       ch.pdgc.push_back(daughter_code);
+       ch.mass.push_back(daughter->Mass());
+     }
+     ch.fsmass = this->FinalStateMass(dc);
+     ch.br     = dc->BranchingRatio();
+
+     // switched off channels never contribute
+     if(ch.fsmass < kDisabledChannelMass) {
+       tot_BR += ch.br;
+       table.max_fsmass = TMath::Max(table.max_fsmass, ch.fsmass);
+     }
+     table.channels.push_back(ch);
+     table.cum_br.push_back(tot_BR);
+  }
+
+  fDecayTables[pdg_code] = table;
 }
 //____________________________________________________________________________
 TClonesArray * BaryonResonanceDecayer::DecayExclusive(
-     int pdg_code, TLorentzVector & p, TDecayChannel * ch) const
+     int pdg_code, TLorentzVector & p, const DecayChannel_t & ch) const
 {
   //-- Get the final state mass spectrum and the particle codes
-  unsigned int nd = ch->NDaughters();
+  unsigned int nd = ch.pdgc.size();
 
-  int    pdgc[nd];
-  double mass[nd];
+  const int    * pdgc = &ch.pdgc[0];
+  const double * mass = &ch.mass[0];
 
 // Customized part
   bool twobody=false;      // flag of expected channel Delta->pion+nucleon
@@ -292,13 +368,6 @@ TClonesArray * BaryonResonanceDecayer::DecayExclusive(
 
   for(unsigned int iparticle = 0; iparticle < nd; iparticle++) {
 
-     int daughter_code = ch->DaughterPdgCode(iparticle);
-     TParticlePDG * daughter = PDGLibrary::Instance()->Find(daughter_code);
-     assert(daughter);
-
-     pdgc[iparticle] = daughter_code;
-     mass[iparticle] = daughter->Mass();
-
 // Customized part--find out the expected channel Delta->pion+nucleon
 	 if(nd==2 && (pdg_code==2224 || pdg_code==2214 || pdg_code==2114) ){
 	    if(pdgc[iparticle]==211 || pdgc[iparticle]==111 ||pdgc[iparticle]==-211){ npi=npi+1;}
@@ -310,13 +379,17 @@ TClonesArray * BaryonResonanceDecayer::DecayExclusive(
 
      SLOG("Decay", pINFO)
        << "+ daughter[" << iparticle << "]: "
-        << daughter->GetName() << " (pdg-code = "
+        << PDGLibrary::Instance()->Find(pdgc[iparticle])->GetName()
+          << " (pdg-code = "
           << pdgc[iparticle] << ", mass = " << mass[iparticle] << ")";
   }
 
   //-- Decay the resonance using an N-body phase space generator
   //   The particle will be decayed in its rest frame and then the daughters
   //   will be boosted back to the original frame.
+  //   The phase space generator and gRandom are used under the lock.
+
+  ProcessGeneratorLock lock;
 
   bool is_permitted = fPhaseSpaceGenerator.SetDecay(p, nd, mass);
   assert(is_permitted);
@@ -355,7 +428,7 @@ while(1){  //start a loop until break;
   {
      // *** generating weighted decays ***
      double w = fPhaseSpaceGenerator.Generate();
-     fWeight *= TMath::Max(w/wmax, 1.);
+     gLastWeight *= TMath::Max(w/wmax, 1.);
   }
   else
   {
@@ -390,13 +463,11 @@ while(1){  //start a loop until break;
 
 
   //-- Add the mother particle to the event record (KS=11 as in PYTHIA)
-  TParticlePDG * mother = PDGLibrary::Instance()->Find(pdg_code);
-
   double px   = p.Px();
   double py   = p.Py();
   double pz   = p.Pz();
   double E    = p.Energy();
-  double M    = mother->Mass();
+  double M    = this->DecayTable(pdg_code).mass;
 
   if(twobody){vcheckdelta.SetPxPyPzE(px,py,pz,E);}  // restore mother particle's 4-momentum.
 
@@ -451,7 +522,9 @@ while(1){  //start a loop until break;
 //____________________________________________________________________________
 double BaryonResonanceDecayer::Weight(void) const
 {
-  return fWeight;
+// Weight of the last decay generated by the calling thread with this decayer
+
+  return (gLastDecayer == this) ? gLastWeight : 1.;
 }
 //____________________________________________________________________________
 void BaryonResonanceDecayer::InhibitDecay(int pdgc, TDecayChannel * dc) const
@@ -490,7 +563,7 @@ double BaryonResonanceDecayer::FinalStateMass(TDecayChannel * ch) const
      if(TMath::Abs(daughter_code) == 1114) {
          LOG("Decay", pNOTICE)
                   << "Disabling decay channel containing resonance 1114";;
-         md = 999999999;
+         md = kDisabledChannelMass;
      }
      mass += md;
   }  
@@ -513,6 +586,23 @@ void BaryonResonanceDecayer::LoadConfig(void)
 {
 // Read configuration options or set defaults
 
+  //-- Tabulate the decay channels of all the resonances in the PDG database
+
+  fDecayTables.clear();
+  const TList * particles = PDGLibrary::Instance()->DBase()->ParticleList();
+  if(particles) {
+    TIter next(particles);
+    TParticlePDG * particle = 0;
+    while( (particle = (TParticlePDG *) next()) ) {
+      if( utils::res::IsBaryonResonance(particle->PdgCode()) ) {
+        this->BuildDecayTable(particle);
+      }
+    }
+  }
+  LOG("Decay", pINFO)
+    << "Tabulated the decay channels of " << fDecayTables.size()
+    << " baryon resonances";
+
   //-- Generated weighted or un-weighted hadronic systems
 
   // note that this variable is not present in any of the xml configuration files
@@ -9,6 +9,10 @@
           an N-body phase space generator. Since the resonance can be produced
           off-shell, decay channels with total-mass > W are suppressed. \n
 
+          The decay channels of each resonance (daughter codes & masses,
+          final state mass and branching ratio) are read from the PDG
+          database the first time the resonance is decayed, and cached. \n
+
           Is a concrete implementation of the DecayModelI interface.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
@@ -25,11 +29,16 @@
 #ifndef _BARYON_RESONANCE_DECAYER_H_
 #define _BARYON_RESONANCE_DECAYER_H_
 
+#include <map>
+#include <vector>
+
 #include <TGenPhaseSpace.h>
 #include <TLorentzVector.h>
 
 #include "Physics/Decay/DecayModelI.h"
 
+class TParticlePDG;
+
 namespace genie {
 
 class BaryonResonanceDecayer : public DecayModelI {
@@ -58,12 +67,30 @@ public:
 
 private:
 
-  void           LoadConfig     (void);
-  TClonesArray * DecayExclusive (int pdgc, TLorentzVector & p, TDecayChannel * ch) const;
-  double         FinalStateMass (TDecayChannel * channel) const;
+  // A decay channel of a resonance
+  struct DecayChannel_t {
+    std::vector<int>    pdgc;    ///< daughter PDG codes
+    std::vector<double> mass;    ///< daughter masses
+    double              fsmass;  ///< final state mass
+    double              br;      ///< branching ratio
+  };
+  // The decay channels of a resonance
+  struct DecayTable_t {
+    double                      mass;      ///< resonance mass
+    std::vector<DecayChannel_t> channels;
+    std::vector<double>         cum_br;    ///< cumulative branching ratios
+    double                      max_fsmass;///< largest final state mass
+  };
+
+  void                 LoadConfig     (void);
+  const DecayTable_t & DecayTable     (int pdgc) const;
+  void                 BuildDecayTable(TParticlePDG * mother);
+  TClonesArray *       DecayExclusive (int pdgc, TLorentzVector & p,
+                                       const DecayChannel_t & ch) const;
+  double               FinalStateMass (TDecayChannel * channel) const;
 
   mutable TGenPhaseSpace fPhaseSpaceGenerator;
-  mutable double         fWeight;
+  std::map<int, DecayTable_t> fDecayTables; ///< per resonance PDG code, built at configuration
 
   bool fGenerateWeighted;
 };
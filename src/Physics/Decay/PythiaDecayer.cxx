@@ -22,6 +22,9 @@
    channels, a weight is calculated as w = 1./sum{BR for enabled channels}.
  @ Feb 04, 2010 - CA
    Comment out (unused) code using the fForceDecay flag
+ @ Oct 14, 2026 - The GENIE Collaboration
+   PYTHIA6 is called under the ProcessGeneratorLock. The weight of the last
+   decay is kept per thread.
 
 */
 //____________________________________________________________________________
@@ -45,6 +48,7 @@
 #include "Physics/Decay/PythiaDecayer.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 
 using std::vector;
@@ -56,6 +60,13 @@ using namespace genie;
 extern "C" void py1ent_(int *,  int *, double *, double *, double *);
 extern "C" void pydecy_(int *);
 
+namespace {
+  // the weight of the last decay generated by the calling thread (the
+  // decayer is shared by the event generation threads, see Weight())
+  thread_local const PythiaDecayer * gLastDecayer = 0;
+  thread_local double                gLastWeight  = 1.;
+}
+
 //____________________________________________________________________________
 PythiaDecayer::PythiaDecayer() :
 DecayModelI("genie::PythiaDecayer")
@@ -88,7 +99,6 @@ bool PythiaDecayer::IsHandled(int code) const
 void PythiaDecayer::Initialize(void) const
 {
   fPythia = TPythia6::Instance();
-  fWeight = 1.;
 
   // sync GENIE/PYTHIA6 seeds
   RandomGen::Instance();
@@ -96,11 +106,15 @@ void PythiaDecayer::Initialize(void) const
 //____________________________________________________________________________
 TClonesArray * PythiaDecayer::Decay(const DecayerInputs_t & inp) const
 {
-  fWeight = 1.; // reset weight
+  gLastDecayer = this;
+  gLastWeight  = 1.; // reset weight
 
   int pdgc = inp.PdgCode;
 
   if ( ! this->IsHandled(pdgc) ) return 0;
+
+  // decay & read back the PYJETS record under the PYTHIA6 lock
+  ProcessGeneratorLock lock;
   
   int kc   = fPythia->Pycomp(pdgc);
   int mdcy = fPythia->GetMDCY(kc, 1);
@@ -120,7 +134,7 @@ TClonesArray * PythiaDecayer::Decay(const DecayerInputs_t & inp) const
     return 0;
   }
 
-  fWeight = 1./sumbr; // update weight to account for inhibited channels
+  gLastWeight = 1./sumbr; // update weight to account for inhibited channels
 
   int    ip    = 0;
   double E     = inp.P4->Energy();
@@ -177,13 +191,17 @@ TClonesArray * PythiaDecayer::Decay(const DecayerInputs_t & inp) const
 //____________________________________________________________________________
 double PythiaDecayer::Weight(void) const 
 {
-  return fWeight; 
+// Weight of the last decay generated by the calling thread with this decayer
+
+  return (gLastDecayer == this) ? gLastWeight : 1.;
 }
 //____________________________________________________________________________
 void PythiaDecayer::InhibitDecay(int pdgc, TDecayChannel * dc) const
 {
   if(! this->IsHandled(pdgc)) return; 
 
+  ProcessGeneratorLock lock;
+
   int kc = fPythia->Pycomp(pdgc);
 
   if(!dc) {
@@ -207,6 +225,8 @@ void PythiaDecayer::UnInhibitDecay(int pdgc, TDecayChannel * dc) const
 {
   if(! this->IsHandled(pdgc)) return; 
 
+  ProcessGeneratorLock lock;
+
   int kc = fPythia->Pycomp(pdgc);
 
   if(!dc) {
@@ -56,7 +56,6 @@ private:
   bool   MatchDecayChannels     (int ichannel, TDecayChannel * dc) const;
 
   mutable TPythia6 * fPythia;  ///< PYTHIA6 wrapper class
-  mutable double fWeight;
 //bool fForceDecay;
 };
 
@@ -30,11 +30,18 @@
    Solved problem with, say, inhibiting pi0 decay at this module, but having 
    other pi0 decayed deep in pythia when it decays hadrons (eg rho0) having
    pi0 in their decay products.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Declare that the decay products of each particle are added in consecutive
+   GHEP slots (see EventRecordVisitorI::AddsDaughtersContiguously()).
+   Decide whether to decay a particle, and find the decayer handling it,
+   once per PDG code instead of once per particle: the decayer index is
+   built at configuration, with a per-thread last-code shortcut.
 
 */
 //____________________________________________________________________________
 
 #include <algorithm>
+#include <atomic>
 #include <sstream>
 
 #include <RVersion.h>
@@ -43,6 +50,7 @@
 #else
 #include <TMCParticle6.h>
 #endif
+#include <TList.h>
 #include <TParticlePDG.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -67,17 +75,24 @@ using std::ostringstream;
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // unique configuration ids (see UnstableParticleDecayer::DecayerIndex())
+  std::atomic<unsigned long> gUnstableParticleDecayerConfigIds(0);
+}
+
 //___________________________________________________________________________
 UnstableParticleDecayer::UnstableParticleDecayer() :
 EventRecordVisitorI("genie::UnstableParticleDecayer")
 {
   fDecayers = 0;
+  fConfigId = 0;
 }
 //___________________________________________________________________________
 UnstableParticleDecayer::UnstableParticleDecayer(string config) :
 EventRecordVisitorI("genie::UnstableParticleDecayer", config)
 {
   fDecayers = 0;
+  fConfigId = 0;
 }
 //___________________________________________________________________________
 UnstableParticleDecayer::~UnstableParticleDecayer()
@@ -96,8 +111,6 @@ void UnstableParticleDecayer::ProcessEventRecord(GHepRecord * evrec) const
   GHepParticle * p = 0;
   unsigned int ipos = 0;
 
-  vector<const DecayModelI *>::const_iterator dec_iter;
-
   //-- Check whether the interaction is off a nuclear target or free nucleon
   //   Depending on whether this module is run before or after the hadron
   //   transport module it would affect the daughters status code
@@ -113,23 +126,15 @@ void UnstableParticleDecayer::ProcessEventRecord(GHepRecord * evrec) const
            << "Decaying unstable particle: " << p->Name();
 
         //-- find the first decayer to handle the current particle
-        dec_iter = fDecayers->begin();
-        fCurrDecayer=0;
-        for( ; dec_iter != fDecayers->end(); ++dec_iter) {
-          const DecayModelI * decayer = *dec_iter;
-          LOG("ParticleDecayer", pINFO)
-                 << "Requesting decay from " << decayer->Id().Key();
-          if(decayer->IsHandled(p->Pdg())) {
-            fCurrDecayer = decayer;
-            break;
-          }
-        }
+        int idec = this->DecayerIndex(p->Pdg());
         //-- handle the case where no decayer is found
-        if(fCurrDecayer==0) {
+        if(idec < 0) {
            LOG("ParticleDecayer", pWARN) 
             << "Couldn't find a decayer for: " << p->Name() << ". Skipping!";
+           ipos++;
            continue;        
         }
+        const DecayModelI * decayer = (*fDecayers)[idec];
 
         //-- Decay it & retrieve the decay products
         //   The decayer might not be able to handle it - in which case it
@@ -140,7 +145,7 @@ void UnstableParticleDecayer::ProcessEventRecord(GHepRecord * evrec) const
         dinp.PdgCode = p->Pdg();
         dinp.P4      = &p4;
 
-        TClonesArray * decay_products = fCurrDecayer->Decay(dinp);
+        TClonesArray * decay_products = decayer->Decay(dinp);
 
         //-- Check whether the particle was decayed
         if(decay_products) {
@@ -153,7 +158,7 @@ void UnstableParticleDecayer::ProcessEventRecord(GHepRecord * evrec) const
            this->CopyToEventRecord(decay_products, evrec, p, ipos, in_nucleus);
 
            //-- Update the event weight for each weighted particle decay
-           double decay_weight = fCurrDecayer->Weight();
+           double decay_weight = decayer->Weight();
            evrec->SetWeight(evrec->Weight() * decay_weight);
 
            //-- Clean-up decay products
@@ -180,15 +185,77 @@ bool UnstableParticleDecayer::ToBeDecayed(GHepParticle * particle) const
      } else {
        check = (ist == kIStStableFinalState);
      }
-     if(check) { return this->IsUnstable(particle); }
+     if(check) { return this->DecayerIndex(particle->Pdg()) != kNotDecayed; }
    }
    return false;
 }
 //___________________________________________________________________________
-bool UnstableParticleDecayer::IsUnstable(GHepParticle * particle) const
+int UnstableParticleDecayer::DecayerIndex(int pdg_code) const
 {
-  int pdg_code = particle->Pdg();
+// Index (in fDecayers) of the first decayer to handle particles with the
+// input PDG code, kNotDecayed if they are not to be decayed or kNoDecayer if
+// no decayer handles them (see BuildDecayerIndex()).
+
+  // the PDG code looked up last by the calling thread (the module is shared
+  // by the event generation threads; configurations have unique ids)
+  static thread_local unsigned long last_id   = 0;
+  static thread_local int           last_pdgc = 0;
+  static thread_local int           last_idec = kNotDecayed;
 
+  if(last_id == fConfigId && pdg_code == last_pdgc) return last_idec;
+
+  map<int, int>::const_iterator it = fDecayerIndex.find(pdg_code);
+  int idec = (it != fDecayerIndex.end()) ? it->second : kNotDecayed;
+
+  last_id   = fConfigId;
+  last_pdgc = pdg_code;
+  last_idec = idec;
+  return idec;
+}
+//___________________________________________________________________________
+void UnstableParticleDecayer::BuildDecayerIndex(void)
+{
+// Finds, at configuration, the first decayer to handle each of the particles
+// to be decayed: the baryon resonances of the PDG database (before the hadron
+// transport) or the configured particles (after the hadron transport)
+
+  fDecayerIndex.clear();
+
+  vector<int> codes;
+  if(fRunBefHadroTransp) {
+    const TList * particles = PDGLibrary::Instance()->DBase()->ParticleList();
+    if(particles) {
+      TIter next(particles);
+      TParticlePDG * particle = 0;
+      while( (particle = (TParticlePDG *) next()) ) {
+        codes.push_back(particle->PdgCode());
+      }
+    }
+  } else {
+    codes.assign(fParticlesToDecay.begin(), fParticlesToDecay.end());
+  }
+
+  for(unsigned int ic = 0; ic < codes.size(); ic++) {
+    int pdg_code = codes[ic];
+    if(! this->IsUnstable(pdg_code)) continue;
+
+    int idec = kNoDecayer;
+    for(unsigned int i = 0; i < fDecayers->size(); i++) {
+      const DecayModelI * decayer = (*fDecayers)[i];
+      LOG("ParticleDecayer", pDEBUG)
+             << "Requesting decay from " << decayer->Id().Key();
+      if(decayer->IsHandled(pdg_code)) {
+        idec = i;
+        break;
+      }
+    }
+    fDecayerIndex[pdg_code] = idec;
+  }
+  fConfigId = ++gUnstableParticleDecayerConfigIds;
+}
+//___________________________________________________________________________
+bool UnstableParticleDecayer::IsUnstable(int pdg_code) const
+{
   // ROOT's TParticlepdg::Lifetime() does not work properly
   // do something else instead (temporarily)
   //
@@ -392,6 +459,8 @@ void UnstableParticleDecayer::LoadConfig(void)
   sort(fParticlesToDecay.begin(),    fParticlesToDecay.end());
   sort(fParticlesNotToDecay.begin(), fParticlesNotToDecay.end());
 
+  this->BuildDecayerIndex();
+
   // Print-out for only one of the two instances of this module
   if(!fRunBefHadroTransp) {
     LOG("ParticleDecayer", pNOTICE) 
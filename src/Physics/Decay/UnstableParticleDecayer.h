@@ -24,12 +24,14 @@
 #ifndef _UNSTABLE_PARTICLE_DECAYER_H_
 #define _UNSTABLE_PARTICLE_DECAYER_H_
 
+#include <map>
 #include <vector>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 
 using std::vector;
+using std::map;
 
 namespace genie {
 
@@ -46,6 +48,7 @@ public :
 
   // implement the EventRecordVisitorI interface
   void ProcessEventRecord(GHepRecord * event_rec) const;
+  bool AddsDaughtersContiguously(void) const { return true; }
 
   // overload the Algorithm::Configure() methods to load private data
   // members from configuration options
@@ -56,7 +59,9 @@ private:
 
   void  LoadConfig        (void);
   bool  ToBeDecayed       (GHepParticle * particle) const;
-  bool  IsUnstable        (GHepParticle * particle) const;
+  bool  IsUnstable        (int pdg_code) const;
+  int   DecayerIndex      (int pdg_code) const;
+  void  BuildDecayerIndex (void);
   void  CopyToEventRecord (TClonesArray * dp, GHepRecord * ev, GHepParticle * p,
                            int mother_pos, bool in_nucleus) const;
 
@@ -64,7 +69,11 @@ private:
   PDGCodeList                    fParticlesToDecay;    ///< list of particles to be decayed
   PDGCodeList                    fParticlesNotToDecay; ///< list of particles for which decay is inhibited
   vector <const DecayModelI *> * fDecayers;            ///< list of all specified decayers
-  mutable const DecayModelI *    fCurrDecayer;         ///< current selected decayer
+  map<int, int>                  fDecayerIndex;        ///< per unstable PDG code: index of the decayer handling it or kNoDecayer
+  unsigned long                  fConfigId;            ///< unique id of the current configuration
+
+  static const int kNotDecayed = -1; ///< a particle not to be decayed
+  static const int kNoDecayer  = -2; ///< a particle to be decayed that no decayer handles
 
   //double fMaxLifetime; ///< define "unstable" particle
 };
@@ -26,6 +26,9 @@
  @ Feb 08, 2013 - CA
    Use the formation zone code from PhysUtils (also used by reweighting) 
    rather than having own implementation here
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Record the hadronization model branch for the reweighting tools, if
+   enabled (see GHepGenInfo).
 */
 //____________________________________________________________________________
 
@@ -46,6 +49,7 @@
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
+#include "Framework/GHEP/GHepGenInfo.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -60,6 +64,17 @@ using namespace genie::controls;
 using namespace genie::constants;
 using namespace genie::utils;
 
+namespace {
+  //! the hadronization model branch of the input hadronizer
+  GHepHadronizer_t HadronizerBranch(const HadronizationModelI * hadronizer)
+  {
+    string name = hadronizer->Id().Name();
+    if(name.find("KNO")    != string::npos) return kGHadKNO;
+    if(name.find("Pythia") != string::npos) return kGHadPythia;
+    if(name.find("Charm")  != string::npos) return kGHadCharm;
+    return kGHadOther;
+  }
+}
 //___________________________________________________________________________
 DISHadronicSystemGenerator::DISHadronicSystemGenerator() :
 HadronicSystemGenerator("genie::DISHadronicSystemGenerator")
@@ -132,6 +147,13 @@ void DISHadronicSystemGenerator::AddFragmentationProducts(
   //   was asked to produce weighted events
   double wght = fHadronizationModel->Weight();
 
+  //-- Keep the model branch that was run, for the reweighting tools
+  GHepGenInfo * geninfo = evrec->GenInfo();
+  if(geninfo) {
+    geninfo->SetHadronizer(
+        HadronizerBranch(fHadronizationModel->LastHadronizer()));
+  }
+
   //-- Translate the fragmentation products from TMCParticles to
   //   GHepParticles and copy them to the event record.
 
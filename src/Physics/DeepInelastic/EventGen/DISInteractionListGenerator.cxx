@@ -134,13 +134,13 @@ InteractionList * DISInteractionListGenerator::CreateInteractionList(
 //___________________________________________________________________________
 void DISInteractionListGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfigData();
 }
 //____________________________________________________________________________
 void DISInteractionListGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfigData();
 }
 //____________________________________________________________________________
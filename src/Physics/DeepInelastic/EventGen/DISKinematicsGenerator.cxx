@@ -15,6 +15,9 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Optionally select (x,y) from a tabulated envelope of d2xsec/dxdy instead
+   of uniformly below the max xsec (UseTabulatedEnvelope).
 */
 //____________________________________________________________________________
 
@@ -28,6 +31,7 @@
 #include "Framework/Conventions/KineVar.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Physics/DeepInelastic/EventGen/DISKinematicsGenerator.h"
+#include "Physics/Common/KineEnvelope2D.h"
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/RunningThreadInfo.h"
@@ -35,6 +39,7 @@
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/UniformBuffer.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -68,9 +73,6 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
           << "Generating kinematics uniformly over the allowed phase space";
   }
 
-  //-- Get the random number generators
-  RandomGen * rnd = RandomGen::Instance();
-
   //-- Access cross section algorithm for running thread
   RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
   const EventGeneratorI * evg = rtinfo->RunningThread();
@@ -110,14 +112,21 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space, or from a tabulated envelope, the max xsec is irrelevant
+  KineEnvelope2D * envelope =
+     (fUseTabulatedEnvelope && !fGenerateUniformly) ?
+          this->TabulatedEnvelope(interaction) : 0;
+  double xsec_max = (fGenerateUniformly || envelope) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid (x,y) pair using the rejection method
 
   double dx = xl.max - xl.min;
   double dy = yl.max - yl.min;
   double gx=-1, gy=-1, gW=-1, gQ2=-1, xsec=-1;
+  double gs=-1, gt=-1, genv=-1;
+
+  // candidates drawn in blocks
+  UniformBuffer rndkine(kRndmKine);
 
   unsigned int iter = 0;
   bool accept = false;
@@ -126,6 +135,7 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      if(iter > kRjMaxIterations) {
        LOG("DISKinematics", pWARN)
          << " Couldn't select kinematics after " << iter << " iterations";
+       this->CountKineThrows(interaction, iter, false);
        evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
        genie::exceptions::EVGThreadException exception;
        exception.SetReason("Couldn't select kinematics");
@@ -133,9 +143,18 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        throw exception;
      }
 
-     //-- random x,y
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
+     //-- random x,y: uniform, or distributed as the tabulated envelope
+     if(envelope) {
+        double r1 = rndkine.Next();
+        double r2 = rndkine.Next();
+        double r3 = rndkine.Next();
+        genv = envelope->Sample(r1, r2, r3, gs, gt);
+        gx = xl.min + dx * gs;
+        gy = yl.min + dy * gt;
+     } else {
+        gx = xl.min + dx * rndkine.Next();
+        gy = yl.min + dy * rndkine.Next();
+     }
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
      kinematics::UpdateWQ2FromXY(interaction);
@@ -150,8 +169,14 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
-        double t = xsec_max * rnd->RndKine().Rndm();
+        if(envelope) {
+          if(xsec > genv) {
+            this->RaiseTabulatedEnvelope(envelope, interaction, gs, gt, xsec, genv);
+          }
+        } else {
+          this->AssertXSecLimits(interaction, xsec, xsec_max);
+        }
+        double t = ((envelope) ? genv : xsec_max) * rndkine.Next();
 	double J = 1;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -166,6 +191,7 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+         this->CountKineThrows(interaction, iter, true);
          LOG("DISKinematics", pNOTICE) 
             << "Selected:  x = " << gx << ", y = " << gy
             << " (W  = " << interaction->KinePtr()->W()  << ","
@@ -229,6 +255,9 @@ void DISKinematicsGenerator::LoadConfig(void)
   //-- Safety factor for the maximum differential cross section
 	GetParamDef( "MaxXSec-SafetyFactor", fSafetyFactor,  1.25 ) ;
 
+  //-- Tighten the max xsec online (adaptive safety factor)?
+  this->LoadAdaptiveSafetyFactorConfig();
+
   //-- Minimum energy for which max xsec would be cached, forcing explicit
   //   calculation for lower eneries
 	GetParamDef( "Cache-MinEnergy", fEMin, 0.8 ) ;
@@ -242,6 +271,8 @@ void DISKinematicsGenerator::LoadConfig(void)
   //   an event weight?
     GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Select (x,y) from tabulated envelopes of d2xsec/dxdy?
+    this->LoadTabulatedEnvelopeConfig();
 }
 //____________________________________________________________________________
 double DISKinematicsGenerator::ComputeMaxXSec(
@@ -385,3 +416,23 @@ double DISKinematicsGenerator::ComputeMaxXSec(
 }
 //___________________________________________________________________________
 
+double DISKinematicsGenerator::TabulatedEnvelopeXSec(
+              Interaction * interaction, double s, double t) const
+{
+// d2xsec/dxdy at x = xmin + s*(xmax-xmin), y = ymin + t*(ymax-ymin), as for
+// the kinematics selection
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t W  = kps.Limits(kKVW);
+  if(W.max <=0 || W.min>=W.max) return 0;
+
+  Range1D_t xl = kps.Limits(kKVx);
+  Range1D_t yl = kps.Limits(kKVy);
+
+  interaction->KinePtr()->Setx(xl.min + (xl.max - xl.min) * s);
+  interaction->KinePtr()->Sety(yl.min + (yl.max - yl.min) * t);
+  kinematics::UpdateWQ2FromXY(interaction);
+
+  return fXSecModel->XSec(interaction, kPSxyfE);
+}
+//___________________________________________________________________________
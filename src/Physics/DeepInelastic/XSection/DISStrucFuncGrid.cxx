@@ -0,0 +1,281 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <TMath.h>
+#include <TSystem.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/DeepInelastic/XSection/DISStrucFuncGrid.h"
+
+using namespace genie;
+
+namespace {
+
+  //! binary file header
+  struct DISSFGridHeader
+  {
+    char               signature[8]; //!< kDISSFGridSignature
+    unsigned int       version;      //!< kDISSFGridVersion
+    unsigned int       byteOrder;    //!< kDISSFGridOrder
+    unsigned int       nSF;
+    unsigned int       nX;
+    unsigned int       nQ2;
+    double             lnXMin;
+    double             dLnX;
+    double             lnQ2Min;
+    double             dLnQ2;
+    double             mass;
+    int                key[7];       //!< the DISStrucFuncGrid::Key fields
+    unsigned long long config;
+  };
+
+  const char         kDISSFGridSignature[8] = {'G','D','I','S','S','F','G','R'};
+  const unsigned int kDISSFGridVersion      = 1;
+  const unsigned int kDISSFGridOrder        = 0x01020304;
+
+  void KeyFields(const DISStrucFuncGrid::Key & key, int * fields)
+  {
+    fields[0] = key.probe;
+    fields[1] = key.nucleon;
+    fields[2] = key.quark;
+    fields[3] = key.sea;
+    fields[4] = key.proc;
+    fields[5] = key.A;
+    fields[6] = key.tgt;
+  }
+}
+
+//____________________________________________________________________________
+const int DISStrucFuncGrid::kNSF;
+//____________________________________________________________________________
+DISStrucFuncGrid::Key::Key() :
+probe(0), nucleon(0), quark(0), sea(0), proc(0), A(0), tgt(0)
+{
+
+}
+//____________________________________________________________________________
+bool DISStrucFuncGrid::Key::operator == (const Key & key) const
+{
+  return (probe == key.probe && nucleon == key.nucleon &&
+          quark == key.quark && sea     == key.sea     &&
+          proc  == key.proc  && A       == key.A       && tgt == key.tgt);
+}
+//____________________________________________________________________________
+bool DISStrucFuncGrid::Key::operator < (const Key & key) const
+{
+  int f1[7], f2[7];
+  KeyFields(*this, f1);
+  KeyFields(key,   f2);
+  for(int i = 0; i < 7; i++) {
+    if(f1[i] != f2[i]) return (f1[i] < f2[i]);
+  }
+  return false;
+}
+//____________________________________________________________________________
+std::string DISStrucFuncGrid::Key::AsString(void) const
+{
+  std::ostringstream s;
+  s << probe << "_" << nucleon << "_" << quark << "_" << sea << "_"
+    << proc  << "_" << A       << "_" << tgt;
+  return s.str();
+}
+//____________________________________________________________________________
+DISStrucFuncGrid::DISStrucFuncGrid() :
+fNX(0),
+fNQ2(0),
+fLnXMin(0),
+fDLnX(0),
+fLnQ2Min(0),
+fDLnQ2(0),
+fM(0)
+{
+
+}
+//____________________________________________________________________________
+DISStrucFuncGrid::DISStrucFuncGrid(
+   int nx, double xmin, int nq2, double q2min, double q2max) :
+fM(0)
+{
+  if(nx < 4 || nq2 < 4 || xmin <= 0 || xmin >= 1 ||
+     q2min <= 0 || q2max <= q2min)
+  {
+    LOG("DISSFGrid", pFATAL)
+      << "Invalid grid: " << nx << " x in [" << xmin << ", 1], "
+      << nq2 << " Q2 in [" << q2min << ", " << q2max << "] GeV^2";
+    exit(1);
+  }
+  fNX      = nx;
+  fNQ2     = nq2;
+  fLnXMin  = TMath::Log(xmin);
+  fDLnX    = -fLnXMin / (nx-1);
+  fLnQ2Min = TMath::Log(q2min);
+  fDLnQ2   = (TMath::Log(q2max) - fLnQ2Min) / (nq2-1);
+  fValues.assign(kNSF * nx * nq2, 0.);
+}
+//____________________________________________________________________________
+DISStrucFuncGrid::~DISStrucFuncGrid()
+{
+
+}
+//____________________________________________________________________________
+double DISStrucFuncGrid::X(int ix) const
+{
+  // the last node is exactly x = 1
+  return (ix == fNX-1) ? 1. : TMath::Exp(fLnXMin + ix * fDLnX);
+}
+//____________________________________________________________________________
+double DISStrucFuncGrid::Q2(int iq2) const
+{
+  return TMath::Exp(fLnQ2Min + iq2 * fDLnQ2);
+}
+//____________________________________________________________________________
+bool DISStrucFuncGrid::IsForMass(double M) const
+{
+  return (TMath::Abs(M - fM) < 1E-9 * fM);
+}
+//____________________________________________________________________________
+void DISStrucFuncGrid::Set(int ix, int iq2, const double * xf)
+{
+  double * v = &fValues[kNSF * (ix * fNQ2 + iq2)];
+  for(int i = 0; i < kNSF; i++) v[i] = xf[i];
+}
+//____________________________________________________________________________
+void DISStrucFuncGrid::Stencil(double t, int n, int & i0, double * w) const
+{
+// The first of the 4 nodes around the grid coordinate t (kept inside the
+// grid) and their cubic Lagrange interpolation weights
+
+  i0 = TMath::FloorNint(t) - 1;
+  if(i0 < 0  ) i0 = 0;
+  if(i0 > n-4) i0 = n-4;
+
+  double u = t - i0;
+  w[0] = -(u-1.) * (u-2.) * (u-3.) / 6.;
+  w[1] =   u     * (u-2.) * (u-3.) / 2.;
+  w[2] =  -u     * (u-1.) * (u-3.) / 2.;
+  w[3] =   u     * (u-1.) * (u-2.) / 6.;
+}
+//____________________________________________________________________________
+bool DISStrucFuncGrid::Evaluate(double x, double Q2, double * xf) const
+{
+  if(fNX == 0 || x <= 0 || x > 1 || Q2 <= 0) return false;
+
+  double tx = (TMath::Log(x)  - fLnXMin ) / fDLnX;
+  double tq = (TMath::Log(Q2) - fLnQ2Min) / fDLnQ2;
+  if(tx < 0 || tq < 0 || tq > fNQ2-1) return false;
+
+  int    ix0, iq0;
+  double wx[4], wq[4];
+  this->Stencil(tx, fNX,  ix0, wx);
+  this->Stencil(tq, fNQ2, iq0, wq);
+
+  for(int i = 0; i < kNSF; i++) xf[i] = 0;
+  for(int jx = 0; jx < 4; jx++) {
+    const double * v = &fValues[kNSF * ((ix0+jx) * fNQ2 + iq0)];
+    for(int jq = 0; jq < 4; jq++) {
+      double w = wx[jx] * wq[jq];
+      for(int i = 0; i < kNSF; i++) xf[i] += w * v[kNSF*jq + i];
+    }
+  }
+  return true;
+}
+//____________________________________________________________________________
+bool DISStrucFuncGrid::Read(
+  const std::string & filename, const Key & key, unsigned long long config)
+{
+  std::ifstream binary(filename.c_str(), std::ios::binary);
+  if(!binary.is_open()) return false;
+
+  DISSFGridHeader header;
+  binary.read((char*) &header, sizeof(header));
+
+  int fields[7];
+  KeyFields(key, fields);
+
+  if(!binary || std::memcmp(header.signature, kDISSFGridSignature, 8) != 0 ||
+     header.version   != kDISSFGridVersion ||
+     header.byteOrder != kDISSFGridOrder   ||
+     header.nSF       != (unsigned int) kNSF ||
+     header.nX        != (unsigned int) fNX  ||
+     header.nQ2       != (unsigned int) fNQ2 ||
+     header.lnXMin    != fLnXMin  || header.dLnX  != fDLnX  ||
+     header.lnQ2Min   != fLnQ2Min || header.dLnQ2 != fDLnQ2 ||
+     header.config    != config   ||
+     std::memcmp(header.key, fields, sizeof(fields)) != 0)
+  {
+    LOG("DISSFGrid", pWARN)
+      << filename << " is not a structure function grid for this model - Ignoring it";
+    return false;
+  }
+
+  std::vector<double> values(fValues.size());
+  binary.read((char*) &values[0], values.size() * sizeof(double));
+  if(!binary) {
+    LOG("DISSFGrid", pWARN)
+      << "Structure function grid " << filename << " is corrupted - Ignoring it";
+    return false;
+  }
+
+  fM = header.mass;
+  fValues.swap(values);
+
+  LOG("DISSFGrid", pINFO) << "Loaded structure function grid " << filename;
+  return true;
+}
+//____________________________________________________________________________
+bool DISStrucFuncGrid::Write(
+  const std::string & filename, const Key & key, unsigned long long config) const
+{
+  DISSFGridHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.signature, kDISSFGridSignature, 8);
+  header.version   = kDISSFGridVersion;
+  header.byteOrder = kDISSFGridOrder;
+  header.nSF       = kNSF;
+  header.nX        = fNX;
+  header.nQ2       = fNQ2;
+  header.lnXMin    = fLnXMin;
+  header.dLnX      = fDLnX;
+  header.lnQ2Min   = fLnQ2Min;
+  header.dLnQ2     = fDLnQ2;
+  header.mass      = fM;
+  header.config    = config;
+  KeyFields(key, header.key);
+
+  // written to a temporary file which is then renamed, so that concurrent
+  // jobs never read a partially written grid
+  std::ostringstream tmpname;
+  tmpname << filename << ".tmp." << gSystem->GetPid();
+
+  std::ofstream binary(tmpname.str().c_str(), std::ios::binary);
+  binary.write((const char*) &header, sizeof(header));
+  binary.write((const char*) &fValues[0], fValues.size() * sizeof(double));
+  binary.close();
+
+  if(!binary || std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    LOG("DISSFGrid", pWARN)
+      << "Couldn't write structure function grid " << filename;
+    std::remove(tmpname.str().c_str());
+    return false;
+  }
+
+  LOG("DISSFGrid", pINFO) << "Saved structure function grid to " << filename;
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,105 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::DISStrucFuncGrid
+
+\brief    Precomputed grid of the DIS structure functions F1-F5 of a
+          QPMDISStrucFuncBase model, for one probe, hit nucleon, hit quark
+          selection, process and nuclear modification, and its binary file.
+
+          The grid holds x*F1, F2, x*F3, x*F4 and x*F5 (Bjorken x) at the
+          nodes of a grid uniform in ln(x), for x in [xmin,1], and in ln(Q2),
+          for Q2 in [Q2min,Q2max]. The structure functions are evaluated by
+          bicubic (4x4 point Lagrange) interpolation in (ln(x),ln(Q2)).
+          The grid is computed for an on-shell hit nucleon at rest, whose
+          mass it records: the structure functions of an off-shell nucleon
+          depend on its mass (through the charm threshold and the slow
+          rescaling variable) and are not looked up in the grid.
+
+          The binary file records the grid layout, the grid key and a hash
+          of the structure function model configuration, and uses the byte
+          order of the machine writing it.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _DIS_STRUC_FUNC_GRID_H_
+#define _DIS_STRUC_FUNC_GRID_H_
+
+#include <string>
+#include <vector>
+
+namespace genie {
+
+class DISStrucFuncGrid {
+
+public:
+
+  //! The channel of a grid: the structure functions differ between keys
+  struct Key {
+    Key();
+    int probe;    ///< probe pdg code
+    int nucleon;  ///< hit nucleon pdg code
+    int quark;    ///< hit quark pdg code (0 if not set)
+    int sea;      ///< hit sea quark?
+    int proc;     ///< interaction type
+    int A;        ///< mass number for the nuclear modification (0 if not applied)
+    int tgt;      ///< 1 if the target has protons + 2 if it has neutrons
+    bool operator == (const Key & key) const;
+    bool operator <  (const Key & key) const;
+    std::string AsString (void) const;
+  };
+
+  DISStrucFuncGrid();
+  DISStrucFuncGrid(int nx, double xmin, int nq2, double q2min, double q2max);
+ ~DISStrucFuncGrid();
+
+  static const int kNSF = 5; ///< number of tabulated structure functions
+
+  int    NX       (void) const { return fNX;  }
+  int    NQ2      (void) const { return fNQ2; }
+  double X        (int ix)  const;
+  double Q2       (int iq2) const;
+
+  //! Set the mass of the hit nucleon the grid is computed for
+  void   SetMass  (double M) { fM = M; }
+  //! Is the grid valid for a hit nucleon of mass M?
+  bool   IsForMass(double M) const;
+
+  //! Set x*F1, F2, x*F3, x*F4, x*F5 at node (ix,iq2)
+  void   Set      (int ix, int iq2, const double * xf);
+  //! Interpolated x*F1, F2, x*F3, x*F4, x*F5 at (x,Q2); false outside the grid
+  bool   Evaluate (double x, double Q2, double * xf) const;
+
+  //! Read the grid of key, made with a model configuration of hash config,
+  //! from filename; false if it is missing or was made differently
+  bool   Read     (const std::string & filename, const Key & key,
+                   unsigned long long config);
+  bool   Write    (const std::string & filename, const Key & key,
+                   unsigned long long config) const;
+
+private:
+  DISStrucFuncGrid(const DISStrucFuncGrid & grid);
+
+  void Stencil (double t, int n, int & i0, double * w) const;
+
+  int    fNX;
+  int    fNQ2;
+  double fLnXMin;
+  double fDLnX;
+  double fLnQ2Min;
+  double fDLnQ2;
+  double fM;                   ///< hit nucleon mass
+  std::vector<double> fValues; ///< kNSF values per (ix,iq2) node
+};
+
+}      // genie namespace
+
+#endif // _DIS_STRUC_FUNC_GRID_H_
@@ -10,6 +10,8 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the batch Calculate(), over a set of (x,Q2) points.
 
 */
 //____________________________________________________________________________
@@ -42,6 +44,26 @@ DISStructureFuncModelI::~DISStructureFuncModelI()
 
 }
 //____________________________________________________________________________
+void DISStructureFuncModelI::Calculate(const Interaction * in,
+    const double * x, const double * Q2, int n, double * sf) const
+{
+  Interaction interaction(*in);
+  Kinematics * kine = interaction.KinePtr();
+
+  for(int i = 0; i < n; i++) {
+    kine->Setx (x[i]);
+    kine->SetQ2(Q2[i]);
+    this->Calculate(&interaction);
+    double * sfi = sf + 6*i;
+    sfi[0] = this->F1();
+    sfi[1] = this->F2();
+    sfi[2] = this->F3();
+    sfi[3] = this->F4();
+    sfi[4] = this->F5();
+    sfi[5] = this->F6();
+  }
+}
+//____________________________________________________________________________
 
 
 
@@ -34,6 +34,14 @@ public:
   //! Calculate the structure functions F1-F6 for the input interaction
   virtual void Calculate (const Interaction * interaction) const = 0;
 
+  //! Calculate the structure functions F1-F6 for the input interaction at n
+  //! (x,Q2) points, filling sf[6*i+k] with F(k+1) at point i. By default the
+  //! points are calculated one by one (on a copy of the interaction); models
+  //! may override it to evaluate their inputs (eg PDFs) in batches.
+  virtual void Calculate (const Interaction * interaction,
+                          const double * x, const double * Q2, int n,
+                          double * sf) const;
+
   //! Get the computed structure function F1
   virtual double F1 (void) const = 0;
 
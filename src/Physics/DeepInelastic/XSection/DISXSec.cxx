@@ -25,10 +25,15 @@
  @ Jan 29, 2013 - CA
    Don't look-up depreciated $GDISABLECACHING environmental variable.
    Use the RunOpt singleton instead.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Integrates the QPMDISPXSec model through a function bound to its concrete
+   type (see utils::gsl::d2XSec_dWdQ2_E_T).
 
 */
 //____________________________________________________________________________
 
+#include <typeinfo>
+
 #include <TMath.h>
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
@@ -40,6 +45,7 @@
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
 #include "Physics/DeepInelastic/XSection/DISXSec.h"
+#include "Physics/DeepInelastic/XSection/QPMDISPXSec.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -56,6 +62,19 @@ using namespace genie;
 using namespace genie::controls;
 using namespace genie::constants;
 
+namespace {
+  ROOT::Math::IBaseFunctionMultiDim * MakeIntegrand(
+      const XSecAlgorithmI * model, const Interaction * in)
+  {
+    // direct calls to the default model (not to models derived from it)
+    if(typeid(*model) == typeid(QPMDISPXSec)) {
+      return new utils::gsl::d2XSec_dWdQ2_E_T<QPMDISPXSec>(
+                 static_cast<const QPMDISPXSec *>(model), in);
+    }
+    return new utils::gsl::d2XSec_dWdQ2_E(model, in);
+  }
+}
+
 //____________________________________________________________________________
 DISXSec::DISXSec() :
 XSecIntegratorI("genie::DISXSec")
@@ -103,8 +122,9 @@ double DISXSec::Integrate(
     Target * target = interaction->InitStatePtr()->TgtPtr();
     if(pdg::IsProton(nucpdgc)) { target->SetId(kPdgTgtFreeP); }
     else                       { target->SetId(kPdgTgtFreeN); }
-    if(xsl->SplineExists(model,interaction)) {
-      const Spline * spl = xsl->GetSpline(model, interaction);
+    int spl_handle = xsl->GetSplineHandle(model, interaction);
+    if(spl_handle >= 0) {
+      const Spline * spl = xsl->GetSpline(spl_handle);
       double xsec = spl->Evaluate(Ev);
       LOG("DISXSec", pINFO)  
         << "From XSecSplineList: XSec[DIS,free nucleon] (E = " << Ev << " GeV) = " << xsec;
@@ -177,17 +197,11 @@ double DISXSec::Integrate(
      double xsec = 0.;
 
      if(phsp_ok) {
-       ROOT::Math::IBaseFunctionMultiDim * func = 
-          new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
-       ROOT::Math::IntegrationMultiDim::Type ig_type = 
-           utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-           
        double abstol = 1; //We mostly care about relative tolerance.
-       ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
        double kine_min[2] = { Wl.min, Q2l.min };
        double kine_max[2] = { Wl.max, Q2l.max };
-       xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-       delete func;
+       xsec = this->IntegrateNDim(MakeIntegrand, model, interaction,
+                 2, kine_min, kine_max, abstol, false) * (1E-38 * units::cm2);
      }//phase space ok?
 
      LOG("DISXSec", pINFO)  << "XSec[DIS] (E = " << Ev << " GeV) = " << xsec;
@@ -224,6 +238,8 @@ void DISXSec::LoadConfig(void)
   fGSLMaxEval  = (unsigned int) max_eval ;
   fGSLMinEval  = (unsigned int) min_eval ;
 
+  this->LoadIntegratorConfig();
+
   // Energy range for cached splines
   GetParam( "GVLD-Emin", fVldEmin) ;
   GetParam( "GVLD-Emax", fVldEmax) ;
@@ -280,10 +296,6 @@ void DISXSec::CacheFreeNucleonXSec(
       E[i+nkb] = TMath::Power(10., TMath::Log10(E0) + i * dEa);
   }
 
-  // Create the integrand
-  ROOT::Math::IBaseFunctionMultiDim * func = 
-     new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
-
   // Compute the cross section at the given set of knots
   for(int ie=0; ie<nknots; ie++) {
     double Ev = E[ie];
@@ -303,21 +315,11 @@ void DISXSec::CacheFreeNucleonXSec(
             Wl.min >= 0. &&  Wl.max >= 0. &&  Wl.max >=  Wl.min);
 
        if(phsp_ok) {
-         ROOT::Math::IntegrationMultiDim::Type ig_type = 
-             utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
          double abstol = 1; //We mostly care about relative tolerance.
-         ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-
-         if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-            ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-              dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-            assert(cast);
-            cast->SetMinPts(fGSLMinEval);
-         }
-
          double kine_min[2] = { Wl.min, Q2l.min };
          double kine_max[2] = { Wl.max, Q2l.max };
-         xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+         xsec = this->IntegrateNDim(MakeIntegrand, model, interaction,
+                   2, kine_min, kine_max, abstol, true) * (1E-38 * units::cm2);
        }// phase space limits ok?
     }//Ev>threshold
 
@@ -331,7 +333,6 @@ void DISXSec::CacheFreeNucleonXSec(
   cache_branch->CreateSpline();
 
   delete [] E;
-  delete func;
 }
 //____________________________________________________________________________
 string DISXSec::CacheBranchName(
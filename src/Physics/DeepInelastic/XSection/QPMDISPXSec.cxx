@@ -18,6 +18,9 @@
  @ Jan 29, 2013 - CA
    Don't look-up depreciated $GDISABLECACHING environmental variable.
    Use the RunOpt singleton instead.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The Jacobian to {W,Q2}, needed by the integrand of the total xsec, uses the
+   compile time kernel and the already computed probe energy.
 
 */
 //____________________________________________________________________________
@@ -181,7 +184,18 @@ double QPMDISPXSec::XSec(
   // The algorithm computes d^2xsec/dxdy
   // Check whether variable tranformation is needed
   if(kps!=kPSxyfE) {
-    double J = utils::kinematics::Jacobian(interaction,kPSxyfE,kps);
+    double J = 0;
+    if(kps == kPSWQ2fE) {
+      utils::kinematics::KineConsts kc;
+      utils::kinematics::SetKineConsts(
+                 E, init_state.Tgt().HitNucP4Ptr()->M(), ml, kc);
+      utils::kinematics::KinePoint kp;
+      kp.y = y;
+      kp.W = kinematics.W();
+      J = utils::kinematics::Jacobian<kPSxyfE,kPSWQ2fE>(kc,kp);
+    } else {
+      J = utils::kinematics::Jacobian(interaction,kPSxyfE,kps);
+    }
     xsec *= J;
   }
 
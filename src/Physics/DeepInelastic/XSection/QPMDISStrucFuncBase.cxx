@@ -25,7 +25,14 @@
 */
 //____________________________________________________________________________
 
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/GBuild.h"
@@ -42,21 +49,55 @@
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+
+  //! FNV-1a hash of text
+  unsigned long long HashText(const std::string & text)
+  {
+    unsigned long long hash = 14695981039346656037ULL;
+    for(std::string::size_type i = 0; i < text.size(); i++) {
+      hash ^= (unsigned char) text[i];
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+
+  // serialises the look-up, building & clearing of the SF grids
+  std::mutex gSFGridsLock;
+  // unique configuration ids (see QPMDISStrucFuncBase::SFGrid())
+  std::atomic<unsigned long> gSFGridConfigIds(0);
+}
+
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase() :
-DISStructureFuncModelI()
+DISStructureFuncModelI(),
+fBatchPDF(0),
+fBatchPDFc(0),
+fUseSFGrid(false),
+fSFGridConfigId(0),
+fSFGridConfig(0)
 {
   this->InitPDF();
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase(string name) :
-DISStructureFuncModelI(name)
+DISStructureFuncModelI(name),
+fBatchPDF(0),
+fBatchPDFc(0),
+fUseSFGrid(false),
+fSFGridConfigId(0),
+fSFGridConfig(0)
 {
   this->InitPDF();
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase(string name, string config):
-DISStructureFuncModelI(name, config)
+DISStructureFuncModelI(name, config),
+fBatchPDF(0),
+fBatchPDFc(0),
+fUseSFGrid(false),
+fSFGridConfigId(0),
+fSFGridConfig(0)
 {
   this->InitPDF();
 }
@@ -65,6 +106,7 @@ QPMDISStrucFuncBase::~QPMDISStrucFuncBase()
 {
   delete fPDF;
   delete fPDFc;
+  this->ClearSFGrids();
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Configure(const Registry & config)
@@ -126,6 +168,17 @@ void QPMDISStrucFuncBase::LoadConfig(void)
   GetParam( "WeinbergAngle", thw ) ;
   fSin2thw = TMath::Power(TMath::Sin(thw), 2);
 
+  //-- look up the SFs in precomputed (x,Q2) grids?
+  GetParamDef( "UseSFGrid",       fUseSFGrid,   false ) ;
+  GetParamDef( "SFGrid-NX",       fSFGridNX,    160   ) ;
+  GetParamDef( "SFGrid-XMin",     fSFGridXMin,  1E-5  ) ;
+  GetParamDef( "SFGrid-NQ2",      fSFGridNQ2,   120   ) ;
+  GetParamDef( "SFGrid-Q2Min",    fSFGridQ2Min, 1E-4  ) ;
+  GetParamDef( "SFGrid-Q2Max",    fSFGridQ2Max, 1E+4  ) ;
+
+  // the grids of the previous configuration are stale
+  this->ClearSFGrids();
+
   LOG("DISSF", pDEBUG) << "Done loading configuration";
 }
 //____________________________________________________________________________
@@ -137,6 +190,78 @@ void QPMDISStrucFuncBase::InitPDF(void)
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
+{
+  if(fUseSFGrid) {
+    if(this->GridSF(interaction)) return;
+  }
+  this->CalcSF(interaction);
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::Calculate(const Interaction * in,
+    const double * x, const double * Q2, int n, double * sf) const
+{
+// Calculate the SFs at n (x,Q2) points, with the PDFs of all the points
+// computed in two PDFModelI::AllPDFs() batch calls. The grid lookups are
+// done point by point.
+
+  const PDFModelI * pdf_model = fPDF->Model();
+  if(fUseSFGrid || !pdf_model || n <= 0) {
+    DISStructureFuncModelI::Calculate(in, x, Q2, n, sf);
+    return;
+  }
+
+  Interaction interaction(*in);
+  Kinematics * kine = interaction.KinePtr();
+  double M = interaction.InitState().Tgt().HitNucP4().M();
+
+  // the (x,Q2) where the PDFs are evaluated at each point, as in CalcPDFs()
+  std::vector<double> xpdf (n);
+  std::vector<double> q2pdf(n);
+  std::vector<double> xcpdf;
+  std::vector<double> q2cpdf;
+  std::vector<int>    icharm(n, -1);
+  for(int i = 0; i < n; i++) {
+    kine->Setx (x[i]);
+    kine->SetQ2(Q2[i]);
+    double xs    = this->ScalingVar(&interaction);
+    double Q2val = this->Q2(&interaction);
+    xpdf [i] = xs;
+    q2pdf[i] = TMath::Max(Q2val, fQ2min);
+    if(fCharmOff) continue;
+    if(!utils::kinematics::IsAboveCharmThreshold(xs, Q2val, M, fMc)) continue;
+    double xc = utils::kinematics::SlowRescalingVar(xs, Q2val, M, fMc);
+    if(xc<0 || xc>1) continue;
+    icharm[i] = (int) xcpdf.size();
+    xcpdf .push_back(xc);
+    q2cpdf.push_back(q2pdf[i]);
+  }
+
+  std::vector<PDF_t> pdfs (n);
+  std::vector<PDF_t> pdfsc(xcpdf.size());
+  pdf_model->AllPDFs(&xpdf[0], &q2pdf[0], &pdfs[0], n);
+  if(xcpdf.size() > 0) {
+    pdf_model->AllPDFs(&xcpdf[0], &q2cpdf[0], &pdfsc[0], (int) xcpdf.size());
+  }
+
+  for(int i = 0; i < n; i++) {
+    kine->Setx (x[i]);
+    kine->SetQ2(Q2[i]);
+    fBatchPDF  = &pdfs[i];
+    fBatchPDFc = (icharm[i] >= 0) ? &pdfsc[icharm[i]] : 0;
+    this->CalcSF(&interaction);
+    double * sfi = sf + 6*i;
+    sfi[0] = fF1;
+    sfi[1] = fF2;
+    sfi[2] = fF3;
+    sfi[3] = fF4;
+    sfi[4] = fF5;
+    sfi[5] = fF6;
+  }
+  fBatchPDF  = 0;
+  fBatchPDFc = 0;
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::CalcSF(const Interaction * interaction) const
 {
   // Reset mutable members
   fF1 = 0;
@@ -515,7 +640,8 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("DISSF", pDEBUG) << "Calculating PDFs @ x = " << x << ", Q2 = " << Q2pdf;
 #endif
-  fPDF->Calculate(x, Q2pdf);
+  if(fBatchPDF) fPDF->Set(*fBatchPDF);
+  else          fPDF->Calculate(x, Q2pdf);
 
   // Check whether it is above charm threshold
   bool above_charm = 
@@ -538,7 +664,8 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
           LOG("DISSF", pDEBUG) 
               << "Calculating PDFs @ xc (slow rescaling) = " << x << ", Q2 = " << Q2val;
 #endif
-          fPDFc->Calculate(xc, Q2pdf);
+          if(fBatchPDFc) fPDFc->Set(*fBatchPDFc);
+          else           fPDFc->Calculate(xc, Q2pdf);
        }
     }// charm off?
   }//above charm thr?
@@ -626,3 +753,158 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
 
 }
 //____________________________________________________________________________
+bool QPMDISStrucFuncBase::GridSF(const Interaction * interaction) const
+{
+// Look up the SFs in the grid of the interaction channel; false if the
+// point is outside the grid or the hit nucleon is off its mass shell
+
+  const Target & tgt = interaction->InitState().Tgt();
+  double M = tgt.HitNucP4Ptr()->M();
+  if(TMath::Abs(M - tgt.HitNucMass()) > 1E-9 * M) return false;
+
+  const DISStrucFuncGrid * grid = this->SFGrid(interaction);
+  if(!grid->IsForMass(M)) return false;
+
+  double x     = interaction->Kine().x();
+  double Q2val = this->Q2(interaction);
+
+  double xf[DISStrucFuncGrid::kNSF];
+  if(!grid->Evaluate(x, Q2val, xf)) return false;
+
+  fF1 = xf[0] / x;
+  fF2 = xf[1];
+  fF3 = xf[2] / x;
+  fF4 = xf[3] / x;
+  fF5 = xf[4] / x;
+  fF6 = 0;
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISSF", pDEBUG) 
+     << "F1-F5 (grid) = " 
+     << fF1 << ", " << fF2 << ", " << fF3 << ", " << fF4 << ", " << fF5;
+#endif
+  return true;
+}
+//____________________________________________________________________________
+const DISStrucFuncGrid * QPMDISStrucFuncBase::SFGrid(
+   const Interaction * interaction) const
+{
+// The SF grid of the interaction channel, read from $GDISSFGRIDCACHE or
+// computed the first time the channel is seen
+
+  const InitialState & init_state = interaction->InitState();
+  const Target & tgt = init_state.Tgt();
+
+  bool nucl_mod = fIncludeNuclMod &&
+                  !interaction->TestBit(kIAssumeFreeNucleon) &&
+                  !interaction->TestBit(kINoNuclearCorrection);
+
+  DISStrucFuncGrid::Key key;
+  key.probe   = init_state.ProbePdg();
+  key.nucleon = tgt.HitNucPdg();
+  if(tgt.HitQrkIsSet()) {
+    key.quark = tgt.HitQrkPdg();
+    key.sea   = tgt.HitSeaQrk() ? 1 : 0;
+  }
+  key.proc    = (int) interaction->ProcInfo().InteractionTypeId();
+  key.A       = nucl_mod ? tgt.A() : 0;
+  key.tgt     = ((tgt.Z() > 0) ? 1 : 0) + ((tgt.N() > 0) ? 2 : 0);
+
+  // the grid looked up last by the calling thread (the model is shared by
+  // the event generation threads; configurations have unique ids)
+  static thread_local unsigned long            last_id   = 0;
+  static thread_local DISStrucFuncGrid::Key    last_key;
+  static thread_local const DISStrucFuncGrid * last_grid = 0;
+
+  if(last_grid && last_id == fSFGridConfigId && key == last_key) return last_grid;
+
+  std::lock_guard<std::mutex> guard(gSFGridsLock);
+
+  std::map<DISStrucFuncGrid::Key, DISStrucFuncGrid *>::const_iterator it =
+      fSFGrids.find(key);
+  if(it != fSFGrids.end()) {
+    last_id   = fSFGridConfigId;
+    last_key  = key;
+    last_grid = it->second;
+    return last_grid;
+  }
+
+  if(fSFGridConfig == 0) {
+    std::ostringstream config;
+    config << this->Id().Key() << "\n" << this->GetConfig();
+    fSFGridConfig = HashText(config.str());
+  }
+
+  DISStrucFuncGrid * grid = new DISStrucFuncGrid(
+     fSFGridNX, fSFGridXMin, fSFGridNQ2, fSFGridQ2Min, fSFGridQ2Max);
+
+  string filename = "";
+  const char * cache = std::getenv("GDISSFGRIDCACHE");
+  if(cache) {
+    std::ostringstream name;
+    name << cache << "/dissf_" << std::hex << fSFGridConfig << std::dec
+         << "_" << key.AsString() << ".bin";
+    filename = name.str();
+  }
+
+  if(filename.size() == 0 || !grid->Read(filename, key, fSFGridConfig)) {
+    LOG("DISSF", pNOTICE)
+      << "Computing the structure function grid for " << key.AsString()
+      << " (probe_nucleon_quark_sea_process_A_target)";
+    this->FillSFGrid(*grid, interaction);
+    if(filename.size() > 0) grid->Write(filename, key, fSFGridConfig);
+  }
+
+  fSFGrids[key] = grid;
+  last_id   = fSFGridConfigId;
+  last_key  = key;
+  last_grid = grid;
+  return grid;
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::FillSFGrid(
+   DISStrucFuncGrid & grid, const Interaction * in) const
+{
+// Compute the SFs at the grid nodes, for an on-shell hit nucleon at rest
+
+  Interaction interaction(*in);
+  Target * tgt = interaction.InitStatePtr()->TgtPtr();
+  double M = tgt->HitNucMass();
+  tgt->SetHitNucP4(TLorentzVector(0, 0, 0, M));
+  grid.SetMass(M);
+
+  if(!fIncludeNuclMod ||
+      in->TestBit(kIAssumeFreeNucleon) || in->TestBit(kINoNuclearCorrection)) {
+    interaction.SetBit(kINoNuclearCorrection);
+  }
+
+  Kinematics * kine = interaction.KinePtr();
+  double xf[DISStrucFuncGrid::kNSF];
+  for(int ix = 0; ix < grid.NX(); ix++) {
+    double x = grid.X(ix);
+    kine->Setx(x);
+    for(int iq2 = 0; iq2 < grid.NQ2(); iq2++) {
+      kine->SetQ2(grid.Q2(iq2));
+      this->CalcSF(&interaction);
+      xf[0] = x * fF1;
+      xf[1] =     fF2;
+      xf[2] = x * fF3;
+      xf[3] = x * fF4;
+      xf[4] = x * fF5;
+      grid.Set(ix, iq2, xf);
+    }
+  }
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::ClearSFGrids(void)
+{
+  std::lock_guard<std::mutex> guard(gSFGridsLock);
+
+  std::map<DISStrucFuncGrid::Key, DISStrucFuncGrid *>::iterator it =
+      fSFGrids.begin();
+  for( ; it != fSFGrids.end(); ++it) delete it->second;
+  fSFGrids.clear();
+  fSFGridConfig   = 0;
+  fSFGridConfigId = ++gSFGridConfigIds;
+}
+//____________________________________________________________________________
@@ -7,6 +7,18 @@
           Provides common implementation for concrete objects implementing the
           DISStructureFuncModelI interface.
 
+          With the UseSFGrid option, F1-F5 are looked up in grids in (x,Q2),
+          computed the first time each probe, hit nucleon, hit quark
+          selection, process and nuclear modification is seen (see
+          DISStrucFuncGrid). If $GDISSFGRIDCACHE names a directory (eg the
+          one of the cross section splines) the grids are saved there and
+          read back by later jobs. Points outside the grid, or off an
+          off-shell hit nucleon, are calculated directly.
+
+          The batch Calculate() evaluates the PDFs at all its (x,Q2) points
+          with PDFModelI::AllPDFs() batch calls (eg for the SF scans of
+          gsfcomp); the SFs are then those of the point-by-point calculation.
+
 \ref      For a discussion of DIS SF see for example E.A.Paschos and J.Y.Yu, 
           Phys.Rev.D 65.033002 and R.Devenish and A.Cooper-Sarkar, OUP 2004.
 
@@ -28,7 +40,10 @@
 #ifndef _QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 #define _QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 
+#include <map>
+
 #include "Physics/DeepInelastic/XSection/DISStructureFuncModelI.h"
+#include "Physics/DeepInelastic/XSection/DISStrucFuncGrid.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Physics/PartonDistributions/PDF.h"
 
@@ -49,6 +64,12 @@ public:
 
   virtual void Calculate (const Interaction * interaction) const;
 
+  // batch calculation: the PDFs at all the points are computed in two
+  // PDFModelI::AllPDFs() calls (at x and at the charm slow rescaling var)
+  virtual void Calculate (const Interaction * interaction,
+                          const double * x, const double * Q2, int n,
+                          double * sf) const;
+
   // overload Algorithm's Configure() to set the PDF data member
   // from the configuration registry
   void   Configure  (const Registry & config);
@@ -70,6 +91,14 @@ protected:
   virtual double R          (const Interaction * i) const;
   virtual void   KFactors   (const Interaction * i, double & kuv, 
                                      double & kdv, double & kus, double & kds) const;
+
+  // direct SF calculation, and its grid lookup
+  virtual void   CalcSF     (const Interaction * i) const;
+  bool           GridSF     (const Interaction * i) const;
+  const DISStrucFuncGrid * SFGrid (const Interaction * i) const;
+  void           FillSFGrid (DISStrucFuncGrid & grid, const Interaction * i) const;
+  void           ClearSFGrids (void);
+
   // configuration
   //
   double fQ2min;             ///< min Q^2 allowed for PDFs: PDF(Q2<Q2min):=PDF(Q2min)
@@ -88,6 +117,12 @@ protected:
   double fSin2thw;           ///<
   bool   fUse2016Corrections;///< Use 2016 SF relation corrections
   double fLowQ2CutoffF1F2;   ///< Set min for relation between 2xF1 and F2
+  bool   fUseSFGrid;         ///< look up F1-F5 in precomputed (x,Q2) grids?
+  int    fSFGridNX;          ///< number of ln(x) grid nodes
+  double fSFGridXMin;        ///< x of the first grid node
+  int    fSFGridNQ2;         ///< number of ln(Q2) grid nodes
+  double fSFGridQ2Min;       ///< Q2 range of the grid
+  double fSFGridQ2Max;       ///<
 
   mutable double fF1;
   mutable double fF2;
@@ -97,6 +132,8 @@ protected:
   mutable double fF6;
   PDF *  fPDF;           ///< computed PDFs @ (x,Q2)
   PDF *  fPDFc;          ///< computed PDFs @ (slow-rescaling-var,Q2)
+  mutable const PDF_t * fBatchPDF;  ///< PDFs @ (x,Q2) precomputed by the batch Calculate(), or 0
+  mutable const PDF_t * fBatchPDFc; ///< PDFs @ (slow-rescaling-var,Q2) precomputed by the batch Calculate(), or 0
   mutable double fuv;
   mutable double fus; 
   mutable double fdv; 
@@ -110,6 +147,9 @@ protected:
   mutable double fs_c; 
   mutable double fc_c; 
 
+  mutable std::map<DISStrucFuncGrid::Key, DISStrucFuncGrid *> fSFGrids; ///< SF grids per channel
+  unsigned long                      fSFGridConfigId; ///< unique id of the current grids (see ClearSFGrids())
+  mutable unsigned long long         fSFGridConfig;   ///< hash of the configuration (0 if not yet computed)
 };
 
 }         // genie namespace
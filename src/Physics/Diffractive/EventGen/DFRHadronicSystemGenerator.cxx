@@ -105,7 +105,7 @@ void DFRHadronicSystemGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
   double E    = init_state.ProbeE(kRfHitNucRest);  // neutrino energy
   double M    = target.HitNucMass();
-  double mpi  = PDGLibrary::Instance()->Find(pion_pdgc)->Mass();
+  double mpi  = PDGLibrary::Instance()->Mass(pion_pdgc);
   double mpi2 = TMath::Power(mpi,2);
   double xo   = interaction->Kine().x(true); 
   double yo   = interaction->Kine().y(true); 
@@ -134,13 +134,13 @@ InteractionList * DFRInteractionListGenerator::CreateInteractionList(
 //___________________________________________________________________________
 void DFRInteractionListGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfigData();
 }
 //____________________________________________________________________________
 void DFRInteractionListGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfigData();
 }
 //____________________________________________________________________________
@@ -15,11 +15,18 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Sample t from the exp(-beta*t) dependence of the cross section and reject
+   against the max of xsec*exp(beta*t) only (ExponentialTSampling, on by
+   default; set it to false for the earlier flat t sampling). Print the
+   rejection efficiency in the debug output.
+   The max of xsec*exp(beta*(t-tmin)) uses the tmin of the sampled t range.
 
 */
 //____________________________________________________________________________
 
 #include <cfloat>
+#include <map>
 
 #include <TMath.h>
 
@@ -41,11 +48,34 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/ParticleData/PDGUtils.h"
 
+using std::map;
+
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::constants;
 using namespace genie::utils;
 
+//___________________________________________________________________________
+namespace {
+  // the kinematics throws and selected events of each generator: kept per
+  // thread, as they are counted during event generation
+  struct RejectionStats {
+    RejectionStats() : nevents(0), nthrows(0) { }
+    unsigned long nevents;
+    unsigned long nthrows;
+  };
+  thread_local map<const DFRKinematicsGenerator *, RejectionStats> gRejectionStats;
+
+  // the t range sampled from: larger than KPhaseSpace::TLim(), which depends
+  // on x and y (see DFRKinematicsGenerator::ProcessEventRecord())
+  Range1D_t SampledTLim(void)
+  {
+    Range1D_t tl;
+    tl.min = 0;
+    tl.max = KPhaseSpace::GetTMaxDFR();
+    return tl;
+  }
+}
 //___________________________________________________________________________
 DFRKinematicsGenerator::DFRKinematicsGenerator() :
 KineGeneratorWithCache("genie::DFRKinematicsGenerator")
@@ -61,7 +91,7 @@ KineGeneratorWithCache("genie::DFRKinematicsGenerator", config)
 //___________________________________________________________________________
 DFRKinematicsGenerator::~DFRKinematicsGenerator()
 {
-
+  gRejectionStats.erase(this);
 }
 //___________________________________________________________________________
 void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
@@ -98,9 +128,7 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   // We use a larger range here because the limits from KPhaseSpace::TLim() depend on x and y,
   // and using the rejection method in a region that's changing depending on some of the
   // values guarantees that some regions will be oversampled.  We want to avoid that.
-  Range1D_t tl;
-  tl.min = 0;
-  tl.max = KPhaseSpace::GetTMaxDFR();
+  Range1D_t tl = SampledTLim();
 
   LOG("DFRKinematics", pNOTICE) << "x: [" << xl.min << ", " << xl.max << "]";
   LOG("DFRKinematics", pNOTICE) << "y: [" << yl.min << ", " << yl.max << "]";
@@ -125,16 +153,21 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
+  //   space the max xsec is irrelevant. If t is sampled from exp(-beta*t)
+  //   the max is that of xsec*exp(beta*(t-tmin)), see ComputeMaxXSec().
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  bool   exp_t    = (fExpTSampling && !fGenerateUniformly && fBeta > 0);
 
   //-- Try to select a valid (x,y,t) triplet using the rejection method
 
   double dx = xl.max - xl.min;
   double dy = yl.max - yl.min;
   double dt = tl.max - tl.min;
+  double et = (exp_t) ? 1. - TMath::Exp(-fBeta*dt) : 0; // exp(-beta*t) integral x beta
   double gx=-1, gy=-1, gt=-1, gW=-1, gQ2=-1, xsec=-1;
 
+  RejectionStats & stats = gRejectionStats[this];
+
   unsigned int iter = 0;
   bool accept = false;
   while(true) {
@@ -142,6 +175,7 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      if(iter > kRjMaxIterations) {
        LOG("DFRKinematics", pWARN)
          << " Couldn't select kinematics after " << iter << " iterations";
+       this->CountKineThrows(interaction, iter, false);
        evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
        genie::exceptions::EVGThreadException exception;
        exception.SetReason("Couldn't select kinematics");
@@ -150,9 +184,14 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      }
 
      //-- random x,y,t
+     //   (t from exp(-beta*t) in [tmin,tmax] by inverting its CDF)
      gx = xl.min + dx * rnd->RndKine().Rndm();
      gy = yl.min + dy * rnd->RndKine().Rndm();
-     gt = tl.min + dt * rnd->RndKine().Rndm();
+     if(exp_t) {
+       gt = tl.min - TMath::Log(1. - et * rnd->RndKine().Rndm()) / fBeta;
+     } else {
+       gt = tl.min + dt * rnd->RndKine().Rndm();
+     }
 
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
@@ -165,10 +204,11 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      xsec = fXSecModel->XSec(interaction, kPSxytfE);
 
      //-- decide whether to accept the current kinematics
+     //   (the t dependence sampled from is factored out of the xsec)
      if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
+        double J = (exp_t) ? TMath::Exp(fBeta*(gt - tl.min)) : 1;
+        this->AssertXSecLimits(interaction, J*xsec, xsec_max);
         double n = xsec_max * rnd->RndKine().Rndm();
-        double J = 1;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("DFRKinematics", pDEBUG)
@@ -182,6 +222,14 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+         this->CountKineThrows(interaction, iter, true);
+         stats.nevents++;
+         stats.nthrows += iter;
+         LOG("DFRKinematics", pDEBUG)
+           << "Selected kinematics after " << iter << " throws - Rejection "
+           << "efficiency: " << stats.nevents << " / " << stats.nthrows
+           << " = " << double(stats.nevents) / stats.nthrows;
+
          // reset trust bits
          interaction->ResetBit(kISkipProcessChk);
          interaction->ResetBit(kISkipKinematicChk);
@@ -241,6 +289,9 @@ void DFRKinematicsGenerator::LoadConfig(void)
   //-- Safety factor for the maximum differential cross section
   GetParamDef( "MaxXSec-SafetyFactor", fSafetyFactor, 1.25 ) ;
 
+  //-- Tighten the max xsec online (adaptive safety factor)?
+  this->LoadAdaptiveSafetyFactorConfig();
+
   //-- Minimum energy for which max xsec would be cached, forcing explicit
   //   calculation for lower eneries
   GetParamDef( "Cache-MinEnergy", fEMin, 0.8 ) ;
@@ -256,6 +307,12 @@ void DFRKinematicsGenerator::LoadConfig(void)
 
   GetParam( "DFR-Beta", fBeta ) ;
 
+  //-- Sample t from the exp(-beta*t) dependence of the xsec (true, default)
+  //   or uniformly, as in earlier versions (false). Not used for kinematics
+  //   generated uniformly
+  GetParamDef( "ExponentialTSampling", fExpTSampling, true ) ;
+
+  gRejectionStats.erase(this);
 }
 //____________________________________________________________________________
 double DFRKinematicsGenerator::ComputeMaxXSec(
@@ -268,6 +325,8 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
 // The computed max differential cross section does not need to be the exact
 // maximum. The number used in the rejection method will be scaled up by a
 // safety factor. But this needs to be fast - do not use a very fine grid.
+// If t is sampled from exp(-beta*t), the max is that of xsec*exp(beta*t),
+// the weight left for the rejection method.
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("DFRKinematics", pDEBUG)
@@ -330,6 +389,11 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
           interaction->KinePtr()->Sett(gt);
 
           double xsec = fXSecModel->XSec(interaction, kPSxytfE);
+          // the same Jacobian as in ProcessEventRecord(), with the lower
+          // edge of the sampled t range
+          if(fExpTSampling && fBeta > 0) {
+            xsec *= TMath::Exp(fBeta*(gt - SampledTLim().min));
+          }
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 	  LOG("DFRKinematics", pINFO) 
 	    << "xsec(y=" << gy << ", x=" << gx << ", t=" << gt << ") = " << xsec;
@@ -45,6 +45,7 @@ private:
   double ComputeMaxXSec  (const Interaction * interaction) const;
 
   double fBeta;
+  bool   fExpTSampling;  ///< sample t from exp(-beta*t)?
 };
 
 }      // genie namespace
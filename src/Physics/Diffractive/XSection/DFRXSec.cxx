@@ -37,6 +37,14 @@
 using namespace genie;
 using namespace genie::utils;
 
+namespace {
+  ROOT::Math::IBaseFunctionMultiDim * MakeIntegrand(
+      const XSecAlgorithmI * model, const Interaction * in)
+  {
+    return new utils::gsl::d3XSec_dxdydt_E(model, in);
+  }
+}
+
 //____________________________________________________________________________
 DFRXSec::DFRXSec ()
  : XSecIntegratorI("genie::DFRXSec")
@@ -87,24 +95,11 @@ double DFRXSec::Integrate (const XSecAlgorithmI* model, const Interaction* in) c
   LOG("DFRXSec", pINFO)
     << "t integration range = [" << tl.min << ", " << tl.max << "]";
 
-  ROOT::Math::IBaseFunctionMultiDim * func =
-    new utils::gsl::d3XSec_dxdydt_E(model, interaction);
-  ROOT::Math::IntegrationMultiDim::Type ig_type =
-    utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-
   double abstol = 1; //We mostly care about relative tolerance.
-  ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-  if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-    ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-      dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-    assert(cast);
-    cast->SetMinPts(fGSLMinEval);
-  }
-
   double kine_min[3] = { xl.min, yl.min, tl.min };
   double kine_max[3] = { xl.max, yl.max, tl.max };
-  xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-  delete func;
+  xsec = this->IntegrateNDim(MakeIntegrand, model, interaction,
+             3, kine_min, kine_max, abstol, true) * (1E-38 * units::cm2);
   return xsec;
 }
 
@@ -135,6 +130,8 @@ void DFRXSec::LoadConfig (void)
   fGSLMaxEval  = (unsigned int) max ;
   fGSLMinEval  = (unsigned int) min ;
 
+  this->LoadIntegratorConfig();
+
   //-- DFR model parameter t_max for t = (q - p_pi)^2
   GetParam( "DFR-t-max", fTMax ) ;
 
@@ -15,18 +15,16 @@
  @ Apr 24, 2010 - CA
    Add code to decay the off-the-mass-shell W- using PYTHIA6. 
    First complete version of the GLRES event thread.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Read the W decay products straight from the PYJETS common block rather
+   than importing them into TClonesArrays for every event. Only print the
+   PYTHIA event listing in debug mode.
+   PYTHIA6 is called under the ProcessGeneratorLock.
 */
 //____________________________________________________________________________
 
 #include <cstring>
 
-#include <RVersion.h>
-#if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
-#include <TMCParticle.h>
-#else
-#include <TMCParticle6.h>
-#endif
-#include <TClonesArray.h>
 #include <TMath.h>
 
 #include "Framework/Conventions/Constants.h"
@@ -35,6 +33,7 @@
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -63,6 +62,9 @@ GLRESGenerator::~GLRESGenerator()
 //___________________________________________________________________________
 void GLRESGenerator::ProcessEventRecord(GHepRecord * event) const
 {
+  // the W decay & hadronization are run by PYTHIA6
+  ProcessGeneratorLock lock;
+
   GHepParticle * nu = event -> Probe();
   GHepParticle * el = event -> HitElectron();
   assert(nu);
@@ -107,19 +109,14 @@ void GLRESGenerator::ProcessEventRecord(GHepRecord * event) const
   strcpy(p6tgt,   "e-"     );
   fPythia->Pyinit(p6frame, p6nu, p6tgt, mass);
   fPythia->Pyevnt();
-  fPythia->Pylist(1);
-
-  // get LUJETS record
-  fPythia->GetPrimaries();
-  TClonesArray * pythia_particles =
-       (TClonesArray *) fPythia->ImportParticles("All");
+  if((*Messenger::Instance())("GLRESGenerator").isPriorityEnabled(pDEBUG)) {
+    fPythia->Pylist(1);
+  }
 
-  // copy PYTHIA container to a new TClonesArray so as to transfer ownership
-  // of the container and of its elements to the calling method
-  int np = pythia_particles->GetEntries();
+  // read the PYJETS record (1-based indices: K(i,1) status, K(i,2) code,
+  // P(i,1..4) 4-momentum) without importing it into a TClonesArray
+  int np = fPythia->GetN();
   assert(np>0);
-  TClonesArray * particle_list = new TClonesArray("TMCParticle", np);
-  particle_list->SetOwner(true);
 
   // Vector defining rotation from LAB to LAB' (z:= \vec{resonance momentum})
   TVector3 unitvq = p4_W.Vect().Unit();
@@ -127,13 +124,12 @@ void GLRESGenerator::ProcessEventRecord(GHepRecord * event) const
   // Boost velocity LAB' -> Resonance rest frame
   TVector3 beta(0,0,p4_W.P()/p4_W.Energy());
 
-  TMCParticle * p = 0;
-  TIter piter(pythia_particles);
-  while( (p = (TMCParticle *) piter.Next()) ) {
-     int pdgc = p->GetKF();
-     int ist  = p->GetKS();
+  for(int i = 1; i <= np; i++) {
+     int pdgc = fPythia->GetK(i,2);
+     int ist  = fPythia->GetK(i,1);
      if(ist == 1) {
-        TLorentzVector p4o(p->GetPx(), p->GetPy(), p->GetPz(), p->GetEnergy());
+        TLorentzVector p4o(fPythia->GetP(i,1), fPythia->GetP(i,2),
+                           fPythia->GetP(i,3), fPythia->GetP(i,4));
         p4o.Boost(beta); 
         TVector3 p3 = p4o.Vect();
         p3.RotateUz(unitvq); 
@@ -62,7 +62,7 @@ double GLRESPXSec::Integral(const Interaction * interaction) const
   double gf    = kGF2/(3*kPi);
   double me    = kElectronMass;
   double Mw    = kMw;
-  double Gw    = PDGLibrary::Instance()->Find(kPdgWM)->Width();
+  double Gw    = PDGLibrary::Instance()->Width(kPdgWM);
   double Mw2   = TMath::Power(Mw,  2);
   double Mw4   = TMath::Power(Mw2, 2);
   double Gw2   = TMath::Power(Gw,  2);
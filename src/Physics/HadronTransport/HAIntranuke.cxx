@@ -498,7 +498,7 @@ void HAIntranuke::ElasHA(
   double Mp = p->Mass();
   double Mt = 0.;
   if (ev->TargetNucleus()->A()==fRemnA)
-    { Mt = PDGLibrary::Instance()->Find(ev->TargetNucleus()->Pdg())->Mass(); }
+    { Mt = PDGLibrary::Instance()->Mass(ev->TargetNucleus()->Pdg()); }
   else 
     {
       Mt = fRemnP4.M();
@@ -854,11 +854,11 @@ void HAIntranuke::Inelastic(
 	  LOG("HAIntranuke",pINFO) << "choose 2 body absorption, probe, fs = " << pdgc <<"  "<< scode <<"  "<<s2code;
 	  // assign proper masses
 	  //double M1   = pLib->Find(pdgc) ->Mass();
-	  double M2_1 = pLib->Find(t1code)->Mass();
-	  double M2_2 = pLib->Find(t2code)->Mass();
+	  double M2_1 = pLib->Mass(t1code);
+	  double M2_2 = pLib->Mass(t2code);
 	  //double M2   = M2_1 + M2_2;
 	  double M3   = pLib->Find(scode) ->Mass();
-	  double M4   = pLib->Find(s2code)->Mass();
+	  double M4   = pLib->Mass(s2code);
 
 	  // handle fermi momentum 
 	  double E2_1L, E2_2L;
@@ -1238,7 +1238,7 @@ void HAIntranuke::Inelastic(
 		    {
 		      target.SetHitNucPdg(*pdg_iter); 
 		      fNuclmodel->GenerateNucleon(target);
-		      mBuf = pLib->Find(*pdg_iter)->Mass();
+		      mBuf = pLib->Mass(*pdg_iter);
 		      mSum += mBuf;
 		      pBuf = fFermiFac * fNuclmodel->Momentum3();
 		      eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
@@ -1318,7 +1318,7 @@ void HAIntranuke::Inelastic(
 		{
 		  target.SetHitNucPdg(*pdg_iter);
 		  fNuclmodel->GenerateNucleon(target);
-		  mBuf = pLib->Find(*pdg_iter)->Mass();
+		  mBuf = pLib->Mass(*pdg_iter);
 		  mSum += mBuf;
 		  pBuf = fFermiFac * fNuclmodel->Momentum3();
 		  eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
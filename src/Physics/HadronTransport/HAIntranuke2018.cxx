@@ -42,6 +42,11 @@
    Added 2014 version of INTRANUKE codes (new class) for independent development.
  @ Aug 30, 2016 - SD
    Fix memory leaks - Igor. 
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the INUKE-UseMFPTable option (default: true).
+   Fate selection takes all the fate fractions from one lookup of the packed
+   INukeHadroData2018 fate tables.
+   Added ProcessEventRecords() for the Intranuke2018 batch mode.
 */
 //____________________________________________________________________________
 
@@ -114,6 +119,8 @@ void HAIntranuke2018::ProcessEventRecord(GHepRecord * evrec) const
 {
   LOG("HAIntranuke2018", pNOTICE) 
      << "************ Running hA2018 MODE INTRANUKE ************";
+  EventLock lock(this);
+
   GHepParticle * nuclearTarget = evrec -> TargetNucleus();
   nuclA = nuclearTarget -> A();
 
@@ -122,6 +129,27 @@ void HAIntranuke2018::ProcessEventRecord(GHepRecord * evrec) const
   LOG("HAIntranuke2018", pINFO) << "Done with this event";
 }
 //___________________________________________________________________________
+void HAIntranuke2018::ProcessEventRecords(GHepRecord * const * evrecs, int n) const
+{
+  LOG("HAIntranuke2018", pNOTICE) 
+     << "************ Running hA2018 MODE INTRANUKE (batch of " << n 
+     << " events) ************";
+  EventLock lock(this);
+
+  // the events of the batch share the target of the first one with a target
+  for(int ievent = 0; ievent < n; ievent++) {
+    GHepParticle * nuclearTarget = evrecs[ievent] -> TargetNucleus();
+    if(nuclearTarget) {
+      nuclA = nuclearTarget -> A();
+      break;
+    }
+  }
+
+  Intranuke2018::ProcessEventRecords(evrecs, n);
+
+  LOG("HAIntranuke2018", pINFO) << "Done with this batch of events";
+}
+//___________________________________________________________________________
 void HAIntranuke2018::SimulateHadronicFinalState(
   GHepRecord* ev, GHepParticle* p) const
 {
@@ -237,6 +265,10 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
   LOG("HAIntranuke2018", pINFO) 
    << "Selecting hA fate for " << p->Name() << " with KE = " << ke << " MeV";
 
+  // all the fate fractions, from a single lookup of the packed fate table
+  double frac[INukeHadroData2018::kNFatesHA];
+  fHadroData2018->FracsHA(pdgc, ke, nuclA, frac);
+
   // try to generate a hadron fate
   unsigned int iter = 0;
   while(iter++ < kRjMaxIterations) {
@@ -245,11 +277,11 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
     //
    if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
 
-     double frac_cex      = fHadroData2018->FracADep(pdgc, kIHAFtCEx,     ke, nuclA);
-     //     double frac_elas     = fHadroData2018->FracADep(pdgc, kIHAFtElas,    ke, nuclA);
-     double frac_inel     = fHadroData2018->FracADep(pdgc, kIHAFtInelas,  ke, nuclA);
-     double frac_abs      = fHadroData2018->FracADep(pdgc, kIHAFtAbs,     ke, nuclA);
-     double frac_piprod   = fHadroData2018->FracADep(pdgc, kIHAFtPiProd,  ke, nuclA);
+     double frac_cex      = frac[kIHAFtCEx];
+     //     double frac_elas     = frac[kIHAFtElas];
+     double frac_inel     = frac[kIHAFtInelas];
+     double frac_abs      = frac[kIHAFtAbs];
+     double frac_piprod   = frac[kIHAFtPiProd];
      LOG("HAIntranuke2018", pDEBUG) 
           << "\n frac{" << INukeHadroFates::AsString(kIHAFtCEx)     << "} = " << frac_cex
        //          << "\n frac{" << INukeHadroFates::AsString(kIHAFtElas)    << "} = " << frac_elas
@@ -296,12 +328,12 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
 
     // handle nucleons
     else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
-      double frac_cex      = fHadroData2018->FracAIndep(pdgc, kIHAFtCEx,    ke);
-      //double frac_elas     = fHadroData2018->FracAIndep(pdgc, kIHAFtElas,   ke);
-      double frac_inel     = fHadroData2018->FracAIndep(pdgc, kIHAFtInelas, ke);
-      double frac_abs      = fHadroData2018->FracAIndep(pdgc, kIHAFtAbs,    ke);
-      double frac_pipro    = fHadroData2018->FracAIndep(pdgc, kIHAFtPiProd, ke);
-      double frac_cmp      = fHadroData2018->FracAIndep(pdgc, kIHAFtCmp   , ke);
+      double frac_cex      = frac[kIHAFtCEx];
+      //double frac_elas     = frac[kIHAFtElas];
+      double frac_inel     = frac[kIHAFtInelas];
+      double frac_abs      = frac[kIHAFtAbs];
+      double frac_pipro    = frac[kIHAFtPiProd];
+      double frac_cmp      = frac[kIHAFtCmp];
 
       LOG("HAIntranuke2018", pINFO)
           << "\n frac{" << INukeHadroFates::AsString(kIHAFtCEx)     << "} = " << frac_cex
@@ -350,8 +382,8 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
     }
     // handle kaons
     else if (pdgc==kPdgKP || pdgc==kPdgKM) {
-       double frac_inel     = fHadroData2018->FracAIndep(pdgc, kIHAFtInelas,  ke);
-       double frac_abs      = fHadroData2018->FracAIndep(pdgc, kIHAFtAbs,     ke);
+       double frac_inel     = frac[kIHAFtInelas];
+       double frac_abs      = frac[kIHAFtAbs];
 
        LOG("HAIntranuke2018", pDEBUG) 
           << "\n frac{" << INukeHadroFates::AsString(kIHAFtInelas)  << "} = " << frac_inel
@@ -510,7 +542,7 @@ void HAIntranuke2018::ElasHA(
   double Mp = p->Mass();
   double Mt = 0.;
   if (ev->TargetNucleus()->A()==fRemnA)
-    { Mt = PDGLibrary::Instance()->Find(ev->TargetNucleus()->Pdg())->Mass(); }
+    { Mt = PDGLibrary::Instance()->Mass(ev->TargetNucleus()->Pdg()); }
   else 
     {
       Mt = fRemnP4.M();
@@ -890,11 +922,11 @@ void HAIntranuke2018::Inelastic(
 	  LOG("HAIntranuke2018",pINFO) << "choose 2 body absorption, probe, fs = " << pdgc <<"  "<< scode <<"  "<<s2code;
 	  // assign proper masses
 	  //double M1   = pLib->Find(pdgc) ->Mass();
-	  double M2_1 = pLib->Find(t1code)->Mass();
-	  double M2_2 = pLib->Find(t2code)->Mass();
+	  double M2_1 = pLib->Mass(t1code);
+	  double M2_2 = pLib->Mass(t2code);
 	  //double M2   = M2_1 + M2_2;
 	  double M3   = pLib->Find(scode) ->Mass();
-	  double M4   = pLib->Find(s2code)->Mass();
+	  double M4   = pLib->Mass(s2code);
 
 	  // handle fermi momentum 
 	  double E2_1L, E2_2L;
@@ -1301,7 +1333,7 @@ void HAIntranuke2018::Inelastic(
 		    {
 		      target.SetHitNucPdg(*pdg_iter); 
 		      fNuclmodel->GenerateNucleon(target);
-		      mBuf = pLib->Find(*pdg_iter)->Mass();
+		      mBuf = pLib->Mass(*pdg_iter);
 		      mSum += mBuf;
 		      pBuf = fFermiFac * fNuclmodel->Momentum3();
 		      eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
@@ -1434,7 +1466,7 @@ void HAIntranuke2018::Inelastic(
 		{
 		  target.SetHitNucPdg(*pdg_iter);
 		  fNuclmodel->GenerateNucleon(target);
-		  mBuf = pLib->Find(*pdg_iter)->Mass();
+		  mBuf = pLib->Mass(*pdg_iter);
 		  mSum += mBuf;
 		  pBuf = fFermiFac * fNuclmodel->Momentum3();
 		  eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
@@ -1545,6 +1577,7 @@ void HAIntranuke2018::LoadConfig(void)
   GetParam( "INUKE-XsecNNCorr",        fXsecNNCorr ) ;
   GetParamDef( "UseOset",              fUseOset, false ) ;
   GetParamDef( "AltOset",              fAltOset, false ) ;
+  GetParamDef( "INUKE-UseMFPTable",    fUseMFPTable, true ) ;
 
   GetParam( "HAINUKE-DelRPion",    fDelRPion ) ;
   GetParam( "HAINUKE-DelRNucleon", fDelRNucleon ) ;
@@ -1575,6 +1608,7 @@ void HAIntranuke2018::LoadConfig(void)
   LOG("HAIntranuke2018", pINFO) << "DoFermi?    = " << ((fDoFermi)?(true):(false));
   LOG("HAIntranuke2018", pINFO) << "DoCmpndNuc? = " << ((fDoCompoundNucleus)?(true):(false));
   LOG("HAIntranuke2018", pINFO) << "XsecNNCorr? = " << ((fXsecNNCorr)?(true):(false));
+  LOG("HAIntranuke2018", pINFO) << "MFPTable?   = " << ((fUseMFPTable)?(true):(false));
 }
 //___________________________________________________________________________
 /*
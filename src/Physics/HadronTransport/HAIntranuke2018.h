@@ -58,6 +58,7 @@ public :
  ~HAIntranuke2018();
 
   void ProcessEventRecord(GHepRecord * event_rec) const;
+  void ProcessEventRecords(GHepRecord * const * event_recs, int n) const;
 
   virtual string GetINukeMode() const {return "hA2018";};
   virtual string GetGenINukeMode() const {return "hA";};
@@ -45,6 +45,10 @@
    fix memory leak, fix fates, improve NNCorr binning
  & Mar, 2018  Nicholas Suarez, SD
    add compound nucleus option to populate KE<30 MeV
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the INUKE-UseMFPTable option (default: true).
+   Fate selection takes all the fate fractions from one lookup of the packed
+   INukeHadroData2018 fate tables.
 */
 //____________________________________________________________________________
 
@@ -120,6 +124,7 @@ void HNIntranuke2018::ProcessEventRecord(GHepRecord * evrec) const
          "Experimental code (INTRANUKE/hN model) - Run at your own risk");
   */
 
+  EventLock lock(this);
   Intranuke2018::ProcessEventRecord(evrec);
 
   LOG("HNIntranuke2018", pINFO) << "Done with this event";
@@ -222,6 +227,12 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
   LOG("HNIntranuke2018", pNOTICE) 
    << "Selecting hN fate for " << p->Name() << " with KE = " << ke << " MeV";
 
+  // all the fate fractions, from a single lookup of the packed fate table
+  double frac[INukeHadroData2018::kNFatesHN] = { 0 };
+  if (isPion || pdgc==kPdgProton || pdgc==kPdgNeutron || pdgc==kPdgKP) {
+    fHadroData2018->FracsHN(pdgc, ke, fRemnA, fRemnZ, frac);
+  }
+
    // try to generate a hadron fate
   unsigned int iter = 0;
   while(iter++ < kRjMaxIterations) {
@@ -230,14 +241,10 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
     //
     if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
 
-       double frac_cex      = this->FateWeight(pdgc, kIHNFtCEx)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtCEx,     ke, fRemnA, fRemnZ);
-       double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtElas,    ke, fRemnA, fRemnZ);
-       double frac_inel     = this->FateWeight(pdgc, kIHNFtInelas)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtInelas,  ke, fRemnA, fRemnZ);
-       double frac_abs      = this->FateWeight(pdgc, kIHNFtAbs)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtAbs,     ke, fRemnA, fRemnZ);
+       double frac_cex      = this->FateWeight(pdgc, kIHNFtCEx)    * frac[kIHNFtCEx];
+       double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)   * frac[kIHNFtElas];
+       double frac_inel     = this->FateWeight(pdgc, kIHNFtInelas) * frac[kIHNFtInelas];
+       double frac_abs      = this->FateWeight(pdgc, kIHNFtAbs)    * frac[kIHNFtAbs];
 
        frac_cex     *= fNucCEXFac;    // scaling factors
        frac_abs     *= fNucAbsFac;
@@ -278,12 +285,9 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
     // handle nucleons
     else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
 
-      double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)
-	                           * fHadroData2018->Frac(pdgc, kIHNFtElas,   ke, fRemnA, fRemnZ);
-      double frac_inel     = this->FateWeight(pdgc, kIHNFtInelas)
-	                           * fHadroData2018->Frac(pdgc, kIHNFtInelas, ke, fRemnA, fRemnZ);
-      double frac_cmp      = this->FateWeight(pdgc, kIHNFtCmp)
-	                           * fHadroData2018->Frac(pdgc, kIHNFtCmp,    ke, fRemnA , fRemnZ);
+      double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)   * frac[kIHNFtElas];
+      double frac_inel     = this->FateWeight(pdgc, kIHNFtInelas) * frac[kIHNFtInelas];
+      double frac_cmp      = this->FateWeight(pdgc, kIHNFtCmp)    * frac[kIHNFtCmp];
 
       LOG("HNIntranuke2018", pINFO) 
 	<< "\n frac{" << INukeHadroFates::AsString(kIHNFtElas)    << "} = " << frac_elas
@@ -316,10 +320,8 @@ INukeFateHN_t HNIntranuke2018::HadronFateHN(const GHepParticle * p) const
     else if (pdgc==kPdgGamma)  return kIHNFtInelas;
     // Handle kaon -- elastic + charge exchange
     else if (pdgc==kPdgKP){
-       double frac_cex      = this->FateWeight(pdgc, kIHNFtCEx)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtCEx,     ke, fRemnA, fRemnZ);
-       double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)
-	                            * fHadroData2018->Frac(pdgc, kIHNFtElas,    ke, fRemnA, fRemnZ);
+       double frac_cex      = this->FateWeight(pdgc, kIHNFtCEx)    * frac[kIHNFtCEx];
+       double frac_elas     = this->FateWeight(pdgc, kIHNFtElas)   * frac[kIHNFtElas];
 
        //       frac_cex     *= fNucCEXFac;    // scaling factors
        //       frac_elas    *= fNucQEFac;   // Flor - Correct scaling factors?
@@ -476,10 +478,10 @@ void HNIntranuke2018::AbsorbHN(
  
   // assign proper masses
   M1   = pLib->Find(pcode) ->Mass();
-  M2_1 = pLib->Find(t1code)->Mass();
-  M2_2 = pLib->Find(t2code)->Mass();
+  M2_1 = pLib->Mass(t1code);
+  M2_2 = pLib->Mass(t2code);
   M3   = pLib->Find(scode) ->Mass();
-  M4   = pLib->Find(s2code)->Mass();
+  M4   = pLib->Mass(s2code);
 
   // handle fermi momentum 
   if(fDoFermi)
@@ -974,6 +976,7 @@ void HNIntranuke2018::LoadConfig(void)
   GetParam( "INUKE-DoFermi",           fDoFermi ) ;
   GetParam( "INUKE-XsecNNCorr",        fXsecNNCorr ) ;
   GetParamDef( "AltOset",              fAltOset, false ) ;
+  GetParamDef( "INUKE-UseMFPTable",    fUseMFPTable, true ) ;
 
   GetParam( "HNINUKE-UseOset",     fUseOset ) ;
   GetParam( "HNINUKE-DelRPion",    fDelRPion ) ;
@@ -997,6 +1000,7 @@ void HNIntranuke2018::LoadConfig(void)
   LOG("HNIntranuke2018", pWARN) << "useOset     = " << fUseOset;
   LOG("HNIntranuke2018", pWARN) << "altOset     = " << fAltOset;
   LOG("HNIntranuke2018", pWARN) << "XsecNNCorr? = " << ((fXsecNNCorr)?(true):(false));
+  LOG("HNIntranuke2018", pWARN) << "MFPTable?   = " << ((fUseMFPTable)?(true):(false));
 }
 //___________________________________________________________________________
 
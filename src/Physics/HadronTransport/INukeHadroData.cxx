@@ -45,6 +45,7 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/InitTimingStats.h"
 
 using std::ostringstream;
 using std::ios;
@@ -173,6 +174,7 @@ INukeHadroData * INukeHadroData::Instance()
 {
   if(fInstance == 0) {
     LOG("INukeData", pINFO) << "INukeHadroData late initialization";
+    InitTimingScope timing("INukeHadroData::Instance");
     static INukeHadroData::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
     fInstance = new INukeHadroData;
@@ -32,11 +32,24 @@
    Include Oset data files.
  @ Apr, 2016 - Flor Blasczyk
    Added K+ cex data files
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added packed fate tables (all the fates of a hadron on a shared 1 MeV KE
+   grid) and FracsHA() / FracsHN() returning all the fate fractions of a
+   hadron from a single table lookup.
+   Save the built splines, grids & graphs to the ROOT file named by
+   $GINUKEHADRONCACHE and read them back, instead of parsing the data files,
+   while the checksum of the data files is unchanged.
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <mutex>
 
 #include <TSystem.h>
 #include <TNtupleD.h>
@@ -44,6 +57,8 @@
 #include <TTree.h>
 #include <TMath.h>
 #include <TFile.h>
+#include <TNamed.h>
+#include <TParameter.h>
 #include <iostream>
 
 #include "Framework/Conventions/Constants.h"
@@ -52,14 +67,125 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
+#include "Framework/Utils/MemoryStats.h"
 #include "Framework/ParticleData/PDGCodes.h"
 
 using std::ostringstream;
 using std::ios;
+using std::vector;
 
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // guards the pion hA fate tables, built on first use of a target A
+  std::mutex gFateTabLock;
+
+  // part of the snapshot key: bump when the snapshot contents change
+  const char * kSnapshotVersion = "INukeHadroData2018 snapshot v1";
+
+  // 64-bit FNV-1a hash, accumulated over many buffers
+  void HashBytes(uint64_t & h, const char * data, size_t n)
+  {
+    for(size_t i = 0; i < n; i++) {
+      h ^= (unsigned char) data[i];
+      h *= 1099511628211ULL;
+    }
+  }
+
+  // all the files below dir (paths relative to the top directory), sorted
+  void ListDataFiles(const string & dir, const string & rel, vector<string> & files)
+  {
+    void * dirp = gSystem->OpenDirectory(dir.c_str());
+    if(!dirp) return;
+    vector<string> entries;
+    const char * entry = 0;
+    while( (entry = gSystem->GetDirEntry(dirp)) ) {
+      string name(entry);
+      if(name == "." || name == "..") continue;
+      entries.push_back(name);
+    }
+    gSystem->FreeDirectory(dirp);
+    std::sort(entries.begin(), entries.end());
+
+    for(unsigned int i = 0; i < entries.size(); i++) {
+      string path = dir + "/" + entries[i];
+      FileStat_t st;
+      if(gSystem->GetPathInfo(path.c_str(), st) != 0) continue;
+      if(R_ISDIR(st.fMode)) ListDataFiles(path, rel + entries[i] + "/", files);
+      else files.push_back(rel + entries[i]);
+    }
+  }
+
+  // checksum of the names & contents of the hadron data files
+  string DataHash(const string & data_dir)
+  {
+    uint64_t h = 14695981039346656037ULL;
+    HashBytes(h, kSnapshotVersion, strlen(kSnapshotVersion));
+
+    vector<string> files;
+    ListDataFiles(data_dir + "/tot_xsec", "tot_xsec/", files);
+    ListDataFiles(data_dir + "/diff_ang", "diff_ang/", files);
+
+    vector<char> buffer(1<<16);
+    for(unsigned int i = 0; i < files.size(); i++) {
+      HashBytes(h, files[i].c_str(), files[i].size() + 1);
+      std::ifstream in((data_dir + "/" + files[i]).c_str(), std::ios::binary);
+      while(in) {
+        in.read(&buffer[0], buffer.size());
+        HashBytes(h, &buffer[0], in.gcount());
+      }
+    }
+    return string(Form("%016llx", (unsigned long long) h));
+  }
+}
+
+//____________________________________________________________________________
+// Packed fate table: all the fates of a hadron on a shared, uniform KE grid
+// (fMinKinEnergy to the maximum hA or hN energy, in steps of kDKE), stored
+// grid point after grid point, so that a lookup reads a single contiguous
+// row pair. The hA tables store the normalised fraction of each fate; the
+// hN tables store, for each fate, the h+p and h+n x-sections, followed by
+// the h+p and h+n total x-sections and a total not scaling with the target
+// (as used for K+), so that the fractions for any (A,Z) follow from a row.
+//
+struct INukeHadroData2018::FateTab
+{
+  static const int    kMaxFates = 6;
+  static const double kDKE;
+
+  FateTab(int nf, const int * f, int nval, double kemax) :
+    nfates(nf), stride(nval), kemin(fMinKinEnergy)
+  {
+    for(int k = 0; k < nfates; k++) fates[k] = f[k];
+    nke = (int) ((kemax - kemin)/kDKE + 0.5) + 1;
+    val.resize(nke * stride, 0.);
+  }
+
+  double   KE  (int i) { return kemin + i*kDKE; }
+  double * Row (int i) { return &val[i*stride]; }
+
+  // first row of the pair bracketing ke, and the interpolation weight of
+  // the second one
+  const double * Locate(double ke, double & t) const
+  {
+    double x = (ke - kemin)/kDKE;
+    if(x < 0) x = 0;
+    int i = (int) x;
+    if(i > nke-2) i = nke-2;
+    t = TMath::Min(1., x - i);
+    return &val[i*stride];
+  }
+
+  int    nfates;
+  int    fates[kMaxFates];    ///< fate of each column (group)
+  int    stride;              ///< values per grid point
+  int    nke;                 ///< grid points
+  double kemin;               ///< first grid point (MeV)
+  std::vector<double> val;
+};
+const double INukeHadroData2018::FateTab::kDKE = 1.0; // MeV
+
 //____________________________________________________________________________
 INukeHadroData2018 * INukeHadroData2018::fInstance = 0;
 //____________________________________________________________________________
@@ -169,6 +295,13 @@ INukeHadroData2018::~INukeHadroData2018()
   delete fFracKA_CEx;
   delete fFracKA_Inel;
   delete fFracKA_Abs;
+
+  delete fFateTabPA;
+  delete fFateTabNA;
+  delete fFateTabKA;
+  std::map<int, FateTab *>::iterator it;
+  for(it = fFateTabPiA.begin(); it != fFateTabPiA.end(); ++it) delete it->second;
+  for(it = fFateTabHN.begin();  it != fFateTabHN.end();  ++it) delete it->second;
   
 }
 //____________________________________________________________________________
@@ -179,10 +312,73 @@ INukeHadroData2018 * INukeHadroData2018::Instance()
     static INukeHadroData2018::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
     fInstance = new INukeHadroData2018;
+    MemoryStats::Instance()->Register("INukeHadroData2018", INukeHadroData2018::ReportMemory);
   }
   return fInstance;
 }
 //____________________________________________________________________________
+void INukeHadroData2018::ReportMemory(MemoryStats & stats)
+{
+// Report the memory held by the hadron data tables (see MemoryStats)
+
+  if(fInstance == 0) return;
+
+  const string name = "INukeHadroData2018";
+
+  vector<Spline **>           splines;
+  vector<BLI2DNonUnifGrid **> grids;
+  vector<TGraph2D **>         graphs;
+  fInstance->SnapshotContents(splines, grids, graphs);
+
+  long int n = 0;
+  double   bytes = 0;
+  for(unsigned int i = 0; i < splines.size(); i++) {
+    if(*splines[i] == 0) continue;
+    n++;
+    bytes += (*splines[i])->MemorySize();
+  }
+  stats.Add(name, "hN/hA x-section splines", bytes, n);
+
+  n = 0;
+  bytes = 0;
+  for(unsigned int i = 0; i < grids.size(); i++) {
+    if(*grids[i] == 0) continue;
+    n++;
+    bytes += (*grids[i])->MemorySize();
+  }
+  stats.Add(name, "hN angular distribution grids", bytes, n);
+
+  n = 0;
+  bytes = 0;
+  for(unsigned int i = 0; i < graphs.size(); i++) {
+    if(*graphs[i] == 0) continue;
+    n++;
+    bytes += sizeof(TGraph2D) + 3 * (*graphs[i])->GetN() * sizeof(double);
+  }
+  stats.Add(name, "hA fate fraction graphs", bytes, n);
+
+  std::lock_guard<std::mutex> guard(gFateTabLock);
+
+  const FateTab * tabs[] = { fInstance->fFateTabPA, fInstance->fFateTabNA,
+                             fInstance->fFateTabKA };
+  vector<const FateTab *> fatetabs(tabs, tabs + sizeof(tabs)/sizeof(tabs[0]));
+  std::map<int, FateTab *>::const_iterator it;
+  for(it = fInstance->fFateTabPiA.begin(); it != fInstance->fFateTabPiA.end(); ++it) {
+    fatetabs.push_back(it->second);
+  }
+  for(it = fInstance->fFateTabHN.begin(); it != fInstance->fFateTabHN.end(); ++it) {
+    fatetabs.push_back(it->second);
+  }
+  n = 0;
+  bytes = 0;
+  for(unsigned int i = 0; i < fatetabs.size(); i++) {
+    if(fatetabs[i] == 0) continue;
+    n++;
+    bytes += sizeof(FateTab) + fatetabs[i]->val.capacity() * sizeof(double);
+  }
+  stats.Add(name, "packed fate tables", bytes, n);
+}
+//____________________________________________________________________________
 void INukeHadroData2018::LoadCrossSections(void)
 {
 // Loads hadronic x-section data
@@ -196,6 +392,16 @@ void INukeHadroData2018::LoadCrossSections(void)
   LOG("INukeData", pINFO)
       << "Loading INTRANUKE hadron data from: " << data_dir;
 
+  //-- Use the snapshot of the built splines, if there is an up to date one
+  //   (search for $GINUKEHADRONCACHE)
+  string snapshot = (gSystem->Getenv("GINUKEHADRONCACHE")) ?
+             string(gSystem->Getenv("GINUKEHADRONCACHE")) : string("");
+  string data_hash = (snapshot.size() > 0) ? DataHash(data_dir) : string("");
+  if(snapshot.size() > 0 && this->ReadSnapshot(snapshot, data_hash)) {
+    this->BuildFateTables();
+    return;
+  }
+
   //-- Build filenames
 
   string datafile_NN   = data_dir + "/tot_xsec/intranuke-xsections-NN2014.dat";
@@ -1174,9 +1380,366 @@ void INukeHadroData2018::LoadCrossSections(void)
    TGraphs_file.Close();
 
    LOG("INukeData", pINFO)  << "Done building x-section splines...";
+
+   this->BuildFateTables();
+
+   if(snapshot.size() > 0) this->WriteSnapshot(snapshot, data_hash);
    
 }
 //____________________________________________________________________________
+void INukeHadroData2018::SnapshotContents(
+   vector<Spline **> & splines, vector<BLI2DNonUnifGrid **> & grids,
+   vector<TGraph2D **> & graphs)
+{
+// All the objects built from the data files, in snapshot order (the
+// splines left at 0 by LoadCrossSections are included and stay at 0)
+
+  Spline ** spl[] = {
+    &fXSecPipn_Tot,  &fXSecPipn_CEx,  &fXSecPipn_Elas, &fXSecPipn_Reac,
+    &fXSecPipp_Tot,  &fXSecPipp_CEx,  &fXSecPipp_Elas, &fXSecPipp_Reac,
+    &fXSecPipd_Abs,
+    &fXSecPi0n_Tot,  &fXSecPi0n_CEx,  &fXSecPi0n_Elas, &fXSecPi0n_Reac,
+    &fXSecPi0p_Tot,  &fXSecPi0p_CEx,  &fXSecPi0p_Elas, &fXSecPi0p_Reac,
+    &fXSecPi0d_Abs,
+    &fXSecPp_Tot,    &fXSecPp_Elas,   &fXSecPp_Reac,
+    &fXSecPn_Tot,    &fXSecPn_Elas,   &fXSecPn_Reac,
+    &fXSecNn_Tot,    &fXSecNn_Elas,   &fXSecNn_Reac,
+    &fXSecPp_Cmp,    &fXSecPn_Cmp,    &fXSecNn_Cmp,
+    &fXSecKpn_Elas,  &fXSecKpp_Elas,  &fXSecKpn_CEx,  &fXSecKpN_Abs,
+    &fXSecKpN_Tot,
+    &fXSecGamp_fs,   &fXSecGamn_fs,   &fXSecGamN_Tot,
+    &fFracPA_Tot,    &fFracPA_Inel,   &fFracPA_CEx,   &fFracPA_Abs,
+    &fFracPA_PiPro,  &fFracPA_Cmp,
+    &fFracNA_Tot,    &fFracNA_Inel,   &fFracNA_CEx,   &fFracNA_Abs,
+    &fFracNA_PiPro,  &fFracNA_Cmp,
+    &fFracKA_Tot,    &fFracKA_Elas,   &fFracKA_CEx,   &fFracKA_Inel,
+    &fFracKA_Abs
+  };
+  BLI2DNonUnifGrid ** grd[] = {
+    &fhN2dXSecPP_Elas,   &fhN2dXSecNP_Elas,   &fhN2dXSecPipN_Elas,
+    &fhN2dXSecPi0N_Elas, &fhN2dXSecPimN_Elas, &fhN2dXSecKpN_Elas,
+    &fhN2dXSecKpP_Elas,  &fhN2dXSecKpN_CEx,   &fhN2dXSecPiN_CEx,
+    &fhN2dXSecPiN_Abs,
+    &fhN2dXSecGamPi0P_Inelas, &fhN2dXSecGamPi0N_Inelas,
+    &fhN2dXSecGamPipN_Inelas, &fhN2dXSecGamPimP_Inelas
+  };
+  TGraph2D ** grf[] = {
+    &TfracPipA_CEx,  &TfracPipA_Inelas, &TfracPipA_Abs, &TfracPipA_PiPro
+  };
+
+  splines.assign(spl, spl + sizeof(spl)/sizeof(spl[0]));
+  grids.  assign(grd, grd + sizeof(grd)/sizeof(grd[0]));
+  graphs. assign(grf, grf + sizeof(grf)/sizeof(grf[0]));
+}
+//____________________________________________________________________________
+bool INukeHadroData2018::ReadSnapshot(string filename, string hash)
+{
+// Reads the built objects from the snapshot file, if it exists and matches
+// the checksum of the current data files
+
+  if(gSystem->AccessPathName(filename.c_str())) return false;
+
+  TDirectory * olddir = gDirectory;
+  TFile * file = TFile::Open(filename.c_str(), "READ");
+  if(!file || file->IsZombie()) {
+    LOG("INukeData", pWARN)
+      << "Couldn't read INTRANUKE hadron data snapshot: " << filename;
+    delete file;
+    if(olddir) olddir->cd();
+    return false;
+  }
+
+  TNamed * stored = dynamic_cast<TNamed *> (file->Get("DataHash"));
+  bool ok = (stored && hash == stored->GetTitle());
+  delete stored;
+
+  vector<Spline **>           splines;
+  vector<BLI2DNonUnifGrid **> grids;
+  vector<TGraph2D **>         graphs;
+  this->SnapshotContents(splines, grids, graphs);
+
+  int nread = 0;
+  if(ok) {
+    for(unsigned int i = 0; i < splines.size(); i++) {
+      *splines[i] = dynamic_cast<Spline *> (file->Get(Form("spline_%d", i)));
+      if(*splines[i]) nread++;
+    }
+    for(unsigned int i = 0; i < grids.size(); i++) {
+      *grids[i] = dynamic_cast<BLI2DNonUnifGrid *> (file->Get(Form("grid_%d", i)));
+      if(*grids[i]) nread++;
+    }
+    for(unsigned int i = 0; i < graphs.size(); i++) {
+      *graphs[i] = dynamic_cast<TGraph2D *> (file->Get(Form("graph_%d", i)));
+      if(*graphs[i]) {
+        (*graphs[i])->SetDirectory(0);
+        nread++;
+      }
+    }
+    TParameter<int> * nobj = dynamic_cast<TParameter<int> *> (file->Get("NObjects"));
+    ok = (nobj && nobj->GetVal() == nread);
+    delete nobj;
+  } else {
+    LOG("INukeData", pNOTICE)
+      << "INTRANUKE hadron data snapshot " << filename << " is out of date";
+  }
+
+  file->Close();
+  delete file;
+  if(olddir) olddir->cd();
+
+  if(!ok) {
+    for(unsigned int i = 0; i < splines.size(); i++) { delete *splines[i]; *splines[i] = 0; }
+    for(unsigned int i = 0; i < grids.size();   i++) { delete *grids[i];   *grids[i]   = 0; }
+    for(unsigned int i = 0; i < graphs.size();  i++) { delete *graphs[i];  *graphs[i]  = 0; }
+    if(nread > 0) {
+      LOG("INukeData", pWARN)
+        << "Incomplete INTRANUKE hadron data snapshot: " << filename;
+    }
+    return false;
+  }
+
+  LOG("INukeData", pNOTICE)
+    << "Loaded INTRANUKE hadron data snapshot from: " << filename;
+  return true;
+}
+//____________________________________________________________________________
+void INukeHadroData2018::WriteSnapshot(string filename, string hash)
+{
+// Saves the built objects to the snapshot file. A temporary file is written
+// & renamed, so that concurrent jobs never read a partially written snapshot
+
+  string tmpname = Form("%s.%d", filename.c_str(), gSystem->GetPid());
+
+  TDirectory * olddir = gDirectory;
+  TFile * file = TFile::Open(tmpname.c_str(), "RECREATE");
+  if(!file || file->IsZombie()) {
+    LOG("INukeData", pWARN)
+      << "Couldn't write INTRANUKE hadron data snapshot: " << filename;
+    delete file;
+    if(olddir) olddir->cd();
+    return;
+  }
+
+  vector<Spline **>           splines;
+  vector<BLI2DNonUnifGrid **> grids;
+  vector<TGraph2D **>         graphs;
+  this->SnapshotContents(splines, grids, graphs);
+
+  int nobj = 0;
+  for(unsigned int i = 0; i < splines.size(); i++) {
+    if(!*splines[i]) continue;
+    file->WriteTObject(*splines[i], Form("spline_%d", i));
+    nobj++;
+  }
+  for(unsigned int i = 0; i < grids.size(); i++) {
+    if(!*grids[i]) continue;
+    file->WriteTObject(*grids[i], Form("grid_%d", i));
+    nobj++;
+  }
+  for(unsigned int i = 0; i < graphs.size(); i++) {
+    if(!*graphs[i]) continue;
+    file->WriteTObject(*graphs[i], Form("graph_%d", i));
+    nobj++;
+  }
+  TNamed data_hash("DataHash", hash.c_str());
+  TParameter<int> nobjects("NObjects", nobj);
+  file->WriteTObject(&data_hash);
+  file->WriteTObject(&nobjects);
+
+  file->Close();
+  delete file;
+  if(olddir) olddir->cd();
+
+  if(gSystem->Rename(tmpname.c_str(), filename.c_str()) != 0) {
+    LOG("INukeData", pWARN)
+      << "Couldn't write INTRANUKE hadron data snapshot: " << filename;
+    gSystem->Unlink(tmpname.c_str());
+    return;
+  }
+  LOG("INukeData", pNOTICE)
+    << "Saved INTRANUKE hadron data snapshot to: " << filename;
+}
+//____________________________________________________________________________
+void INukeHadroData2018::BuildFateTables(void)
+{
+// Packs the fate fractions (hA) and the fate x-sections (hN) of each hadron
+// in a FateTab. The pion hA tables depend on A and are built on first use
+// (see PionFateTabHA)
+
+  // hA: N+A and K+A fractions, normalised as in FracAIndep
+  const int nNA = 5;
+  const int fNA[nNA] = { kIHAFtCEx, kIHAFtInelas, kIHAFtAbs, kIHAFtPiProd, kIHAFtCmp };
+  const Spline * sPA[nNA] = { fFracPA_CEx, fFracPA_Inel, fFracPA_Abs, fFracPA_PiPro, fFracPA_Cmp };
+  const Spline * sNA[nNA] = { fFracNA_CEx, fFracNA_Inel, fFracNA_Abs, fFracNA_PiPro, fFracNA_Cmp };
+  const int nKA = 2;
+  const int fKA[nKA] = { kIHAFtInelas, kIHAFtAbs };
+  const Spline * sKA[nKA] = { fFracKA_Inel, fFracKA_Abs };
+
+  auto packHA = [](int nf, const int * f, const Spline * const * s) {
+    FateTab * tab = new FateTab(nf, f, nf, fMaxKinEnergyHA);
+    double y[FateTab::kMaxFates];
+    for(int i = 0; i < tab->nke; i++) {
+      double ke = TMath::Min(fMaxKinEnergyHA, tab->KE(i));
+      Spline::Evaluate(ke, s, y, nf);
+      double total = 0;
+      for(int k = 0; k < nf; k++) total += y[k];
+      double * row = tab->Row(i);
+      for(int k = 0; k < nf; k++) row[k] = (total != 0) ? y[k]/total : 0.;
+    }
+    return tab;
+  };
+  fFateTabPA = packHA(nNA, fNA, sPA);
+  fFateTabNA = packHA(nNA, fNA, sNA);
+  fFateTabKA = packHA(nKA, fKA, sKA);
+
+  // hN: per fate, the h+p and h+n x-sections (0 splines contribute nothing)
+  // and then the h+p, h+n and target independent totals, as in XSec / Frac
+  auto packHN = [this](int pdgc, int nf, const int * f,
+                       const Spline * const * s, const Spline * const * stot) {
+    int nval = 2*nf + 3;
+    FateTab * tab = new FateTab(nf, f, nval, fMaxKinEnergyHN);
+    for(int i = 0; i < tab->nke; i++) {
+      double ke = TMath::Min(fMaxKinEnergyHN, tab->KE(i));
+      double * row = tab->Row(i);
+      for(int k = 0; k < nval; k++) {
+        const Spline * spl = (k < 2*nf) ? s[k] : stot[k-2*nf];
+        row[k] = (spl) ? TMath::Max(0., spl->Evaluate(ke)) : 0.;
+      }
+    }
+    fFateTabHN[pdgc] = tab;
+  };
+
+  const int nPi = 4;
+  const int fPi[nPi] = { kIHNFtCEx, kIHNFtElas, kIHNFtInelas, kIHNFtAbs };
+  const Spline * sPip[2*nPi] = {
+     fXSecPipp_CEx,  fXSecPipn_CEx,  fXSecPipp_Elas, fXSecPipn_Elas,
+     fXSecPipp_Reac, fXSecPipn_Reac, fXSecPipd_Abs,  fXSecPipd_Abs };
+  const Spline * tPip[3] = { fXSecPipp_Tot, fXSecPipn_Tot, 0 };
+  const Spline * sPim[2*nPi] = {
+     fXSecPipn_CEx,  fXSecPipp_CEx,  fXSecPipn_Elas, fXSecPipp_Elas,
+     fXSecPipn_Reac, fXSecPipp_Reac, fXSecPipd_Abs,  fXSecPipd_Abs };
+  const Spline * tPim[3] = { fXSecPipn_Tot, fXSecPipp_Tot, 0 };
+  const Spline * sPi0[2*nPi] = {
+     fXSecPi0p_CEx,  fXSecPi0n_CEx,  fXSecPi0p_Elas, fXSecPi0n_Elas,
+     fXSecPi0p_Reac, fXSecPi0n_Reac, fXSecPi0d_Abs,  fXSecPi0d_Abs };
+  const Spline * tPi0[3] = { fXSecPi0p_Tot, fXSecPi0n_Tot, 0 };
+  packHN(kPdgPiP, nPi, fPi, sPip, tPip);
+  packHN(kPdgPiM, nPi, fPi, sPim, tPim);
+  packHN(kPdgPi0, nPi, fPi, sPi0, tPi0);
+
+  const int nN = 3;
+  const int fN[nN] = { kIHNFtElas, kIHNFtInelas, kIHNFtCmp };
+  const Spline * sP[2*nN] = {
+     fXSecPp_Elas, fXSecPn_Elas, fXSecPp_Reac, fXSecPn_Reac, fXSecPp_Cmp, fXSecPn_Cmp };
+  const Spline * tP[3] = { fXSecPp_Tot, fXSecPn_Tot, 0 };
+  const Spline * sN[2*nN] = {
+     fXSecPn_Elas, fXSecNn_Elas, fXSecPn_Reac, fXSecNn_Reac, fXSecPp_Cmp, fXSecPn_Cmp };
+  const Spline * tN[3] = { fXSecPn_Tot, fXSecNn_Tot, 0 };
+  packHN(kPdgProton,  nN, fN, sP, tP);
+  packHN(kPdgNeutron, nN, fN, sN, tN);
+
+  const int nK = 2;
+  const int fK[nK] = { kIHNFtCEx, kIHNFtElas };
+  const Spline * sK[2*nK] = { fXSecKpn_CEx, fXSecKpn_CEx, fXSecKpn_Elas, fXSecKpn_Elas };
+  const Spline * tK[3] = { 0, 0, fXSecKpN_Tot };
+  packHN(kPdgKP, nK, fK, sK, tK);
+
+  LOG("INukeData", pINFO)  << "Done building packed fate tables...";
+}
+//____________________________________________________________________________
+const INukeHadroData2018::FateTab *
+   INukeHadroData2018::PionFateTabHA(int targA) const
+{
+// The pion hA fate table for the input mass number, interpolating the
+// fractions in A and KE as in FracADep when first needed
+
+  // the table used last by each thread
+  static thread_local int             last_A   = -1;
+  static thread_local const FateTab * last_tab = 0;
+  if(targA == last_A && last_tab) return last_tab;
+
+  std::lock_guard<std::mutex> guard(gFateTabLock);
+
+  FateTab * tab = 0;
+  std::map<int, FateTab *>::const_iterator it = fFateTabPiA.find(targA);
+  if(it != fFateTabPiA.end()) {
+    tab = it->second;
+  } else {
+    const int nf = 4;
+    const int f[nf] = { kIHAFtCEx, kIHAFtInelas, kIHAFtAbs, kIHAFtPiProd };
+    TGraph2D * g[nf] = { TfracPipA_CEx, TfracPipA_Inelas, TfracPipA_Abs, TfracPipA_PiPro };
+    tab = new FateTab(nf, f, nf, fMaxKinEnergyHA);
+    for(int i = 0; i < tab->nke; i++) {
+      double ke = TMath::Min(fMaxKinEnergyHA, tab->KE(i));
+      double * row = tab->Row(i);
+      double total = 0;
+      for(int k = 0; k < nf; k++) {
+        row[k] = g[k]->Interpolate(targA, ke);
+        total += row[k];
+      }
+      for(int k = 0; k < nf; k++) row[k] = (total != 0) ? row[k]/total : 0.;
+    }
+    fFateTabPiA[targA] = tab;
+    LOG("INukeData", pINFO)
+      << "Built the packed pion hA fate table for A = " << targA;
+  }
+
+  last_A   = targA;
+  last_tab = tab;
+  return tab;
+}
+//____________________________________________________________________________
+void INukeHadroData2018::FracsHA(
+    int hpdgc, double ke, int targA, double * frac) const
+{
+  for(int i = 0; i < kNFatesHA; i++) frac[i] = 0.;
+
+  const FateTab * tab = 0;
+  if      (hpdgc == kPdgPiP || hpdgc == kPdgPiM || hpdgc == kPdgPi0)
+                                tab = this->PionFateTabHA(TMath::Min(208, targA));
+  else if (hpdgc == kPdgProton) tab = fFateTabPA;
+  else if (hpdgc == kPdgNeutron)tab = fFateTabNA;
+  else if (hpdgc == kPdgKP)     tab = fFateTabKA;
+  else {
+    LOG("INukeData", pWARN) << "Can't handle particles with pdg code = " << hpdgc;
+    return;
+  }
+
+  double t;
+  const double * y0 = tab->Locate(ke, t);
+  const double * y1 = y0 + tab->stride;
+  for(int k = 0; k < tab->nfates; k++) {
+    frac[tab->fates[k]] = y0[k] + t * (y1[k] - y0[k]);
+  }
+}
+//____________________________________________________________________________
+void INukeHadroData2018::FracsHN(
+    int hpdgc, double ke, int targA, int targZ, double * frac) const
+{
+  for(int i = 0; i < kNFatesHN; i++) frac[i] = 0.;
+
+  std::map<int, FateTab *>::const_iterator it = fFateTabHN.find(hpdgc);
+  if(it == fFateTabHN.end()) {
+    LOG("INukeData", pWARN) << "Can't handle particles with pdg code = " << hpdgc;
+    return;
+  }
+  const FateTab * tab = it->second;
+
+  double t;
+  const double * y0 = tab->Locate(ke, t);
+  const double * y1 = y0 + tab->stride;
+  double y[2*FateTab::kMaxFates+3];
+  for(int k = 0; k < tab->stride; k++) y[k] = y0[k] + t * (y1[k] - y0[k]);
+
+  int nf = tab->nfates;
+  int N  = targA - targZ;
+  double xsec_tot = y[2*nf] * targZ + y[2*nf+1] * N + y[2*nf+2];
+  if(xsec_tot <= 0) return;
+  for(int k = 0; k < nf; k++) {
+    frac[tab->fates[k]] = (y[2*k] * targZ + y[2*k+1] * N) / xsec_tot;
+  }
+}
+//____________________________________________________________________________
 void INukeHadroData2018::ReadhNFile(
   string filename, double ke, int npoints, int & curr_point,
   double * costh_array, double * xsec_array, int cols)
@@ -21,6 +21,12 @@
           data and extrapolations, and INC model results from Mashnik et al.
           for h+Fe56.
 
+          If $GINUKEHADRONCACHE names a file, the fully built splines and
+          grids are saved there (as a ROOT file) the first time and are read
+          back by later jobs instead of parsing the data files again. The
+          snapshot is keyed by a checksum of the data files, so it is rebuilt
+          whenever the data change.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>, Rutherford Lab.
           Steve Dytman <dytman+@pitt.edu>, Pittsburgh Univ.
 	  Aaron Meyer <asm58@pitt.edu>, Pittsburgh Univ.
@@ -42,11 +48,15 @@
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Numerical/BLI2D.h"
 
+#include <map>
+#include <vector>
+
 class TGraph2D;
 
 namespace genie {
 
 class Spline;
+class MemoryStats;
 
 class INukeHadroData2018
 {
@@ -62,6 +72,17 @@ public:
   double FracADep (int hpdgc, INukeFateHA_t fate, double ke, int targA) const;
   double FracAIndep (int hpdgc, INukeFateHA_t fate, double ke) const;
   double Frac (int hpdgc, INukeFateHN_t fate, double ke, int targA=0, int targZ=0) const;
+
+  // All the fate fractions of a hadron from a single lookup of the packed
+  // fate tables (all fates of a hadron, or of a pion and target A, stored
+  // together on a shared KE grid). frac[fate] is filled for every fate value,
+  // with 0 for the fates the hadron doesn't have. The values are those of
+  // FracADep / FracAIndep (hA) and Frac (hN) up to the linear interpolation
+  // between the 1 MeV spaced grid points, and the hA ones sum up to unity.
+  static const int kNFatesHA = kIHAFtDCEx + 1;
+  static const int kNFatesHN = kIHNFtCmp  + 1;
+  void FracsHA (int hpdgc, double ke, int targA, double * frac) const;
+  void FracsHN (int hpdgc, double ke, int targA, int targZ, double * frac) const;
   double IntBounce       (const GHepParticle* p, int target, int s1, INukeFateHN_t fate);
 
 
@@ -153,6 +174,19 @@ private:
 
   void LoadCrossSections(void);
 
+  static void ReportMemory (MemoryStats & stats);
+
+  // binary snapshot of the built splines, grids & graphs
+  void SnapshotContents (std::vector<Spline **> & splines,
+                         std::vector<BLI2DNonUnifGrid **> & grids,
+                         std::vector<TGraph2D **> & graphs);
+  bool ReadSnapshot     (string filename, string hash);
+  void WriteSnapshot    (string filename, string hash);
+
+  struct FateTab;     // packed fate table
+  void             BuildFateTables (void);
+  const FateTab *  PionFateTabHA   (int targA) const;
+
   void ReadhNFile(
          string filename, double ke, int npoints, int & curr_point,
          /*double * ke_array,*/ double * costh_array, double * xsec_array, int cols);
@@ -240,6 +274,12 @@ private:
   BLI2DNonUnifGrid * fhN2dXSecGamPipN_Inelas;
   BLI2DNonUnifGrid * fhN2dXSecGamPimP_Inelas;
 
+  FateTab * fFateTabPA;                    ///< packed hA fate fractions, p+A
+  FateTab * fFateTabNA;                    ///< n+A
+  FateTab * fFateTabKA;                    ///< K+A
+  mutable std::map<int, FateTab *> fFateTabPiA;  ///< pi+A, per A, built on first use
+  std::map<int, FateTab *> fFateTabHN;     ///< packed hN x-sections, per hadron pdg
+
   //-- Sinleton cleaner
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -24,6 +24,9 @@ potential in (e,e'p).  GENIE code was adapted from NuWro implementation.
    lookup tables in probe KE and nuclear density (rho) stored in text files
    for He4, C12, Ca40, Fe56, Sn120, and U238.  Use values from the text
    files for KE and rho, interpolation in A.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The correction tables are read once with std::call_once and the single
+   instance is created under a lock, for the multi-threaded drivers.
 */
 //____________________________________________________________________________
 #include "Physics/HadronTransport/INukeNucleonCorr.h"
@@ -43,6 +46,7 @@ using namespace genie;
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
+#include <mutex>
 
 #include <TGraph.h>
 using namespace std;
@@ -50,6 +54,19 @@ using namespace std;
 
 INukeNucleonCorr* INukeNucleonCorr::fInstance = NULL; // initialize instance with NULL
 
+// get single instance of INukeNucleonCorr; create if necessary (serialised,
+// the instance being shared by the event generation threads)
+INukeNucleonCorr* INukeNucleonCorr::getInstance()
+{
+  if(fInstance) return fInstance;
+
+  static std::mutex instance_lock;
+  std::lock_guard<std::mutex> guard(instance_lock);
+
+  if(fInstance == NULL) fInstance = new INukeNucleonCorr;
+  return fInstance;
+}
+
 
 const int NRows     = 200;
 const int NColumns  =  17;
@@ -82,8 +99,8 @@ double INukeNucleonCorr::mstar (const double rho, const double k2)
 {
   // density [fm^-3], momentum square [GeV^2]
 
-  static const double m = (PDGLibrary::Instance()->Find(kPdgProton)->Mass() +
-                           PDGLibrary::Instance()->Find(kPdgNeutron)->Mass()) / 2.0;
+  static const double m = (PDGLibrary::Instance()->Mass(kPdgProton) +
+                           PDGLibrary::Instance()->Mass(kPdgNeutron)) / 2.0;
 
   const double L = lambda (rho); // potential coefficient lambda
   const double B =   beta (rho); // potential coefficient beta
@@ -149,7 +166,7 @@ double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const i
 
   setFermiLevel (rho, A, Z); // set Fermi momenta for protons and neutrons
 
-  const double mass   = PDGLibrary::Instance()->Find(pdg)->Mass(); // mass of incoming nucleon
+  const double mass   = PDGLibrary::Instance()->Mass(pdg); // mass of incoming nucleon
   const double energy = Ek + mass;
 
   TLorentzVector p (0.0, 0.0, sqrt (energy * energy - mass * mass), energy); // incoming particle 4-momentum
@@ -163,7 +180,7 @@ double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const i
     // get proton vs neutron randomly based on Z/A
     const int targetPdg = rnd->RndGen().Rndm() < (double) Z / A ? kPdgProton : kPdgNeutron;
 
-    const double targetMass = PDGLibrary::Instance()->Find(targetPdg)->Mass(); // set nucleon mass
+    const double targetMass = PDGLibrary::Instance()->Mass(targetPdg); // set nucleon mass
 
     const TLorentzVector target = generateTargetNucleon (targetMass, fermiMomentum (targetPdg)); // generate target nucl
 
@@ -230,53 +247,13 @@ void read_file(string rfilename)
 }
 
 
-// This function interpolates and returns correction values
-//
-double INukeNucleonCorr :: getAvgCorrection(double rho, double A, double ke)
-{
-  //Read in energy and density to determine the row and column of the correction table - adjust for variable binning - throws away some of the accuracy
-   int Column = round(rho*100);
-   if(rho<.01) Column = 1;
-   if (Column>=NColumns) Column = NColumns-1;
-   int Row = 0;
-   if(ke<=.002) Row = 1;
-   if(ke>.002&&ke<=.1) Row = round(ke*1000.);
-   if(ke>.1&&ke<=.5) Row = round(.1*1000.+(ke-.1)*200);
-   if(ke>.5&&ke<=1) Row = round(.1*1000.+(.5-.1)*200+(ke-.5)*40);
-   if(ke>1) Row = NRows-1;
-   //LOG ("INukeNucleonCorr",pNOTICE)
-   //  << "row, column = " << Row << "   " << Column;
-  //If the table of correction values has already been created
-  // return a value. Else, interpolate the needed correction table//
-//  static double cache[NRows][NColumns] = {{-1}};
-  static bool ReadFile = false;
-  if( ReadFile == true ) {
-   int Npoints = 6;
-   TGraph * Interp = new TGraph(Npoints);
-   //LOG("INukeNucleonCorr",pNOTICE)
-   //  << HeliumValues[Row][Column];
-   Interp->SetPoint(0,4,HeliumValues[Row][Column]);
-   Interp->SetPoint(1,12,CarbonValues[Row][Column]);
-   Interp->SetPoint(2,40,CalciumValues[Row][Column]);
-   Interp->SetPoint(3,56,IronValues[Row][Column]);
-   Interp->SetPoint(4,120,TinValues[Row][Column]);
-   Interp->SetPoint(5,238,UraniumValues[Row][Column]);
-
-   //   Interpolated[e][r] = Interp->Eval(A);
-	//	LOG("INukeNucleonCorr",pNOTICE)
-	//	  << "e,r,value= " << e << "   " << r << "   " << Interpolated[e][r];
-   double returnval = Interp->Eval(A);
-   delete Interp;
-   LOG("INukeNucleonCorr",pINFO)
-      << "Nucleon Corr interpolated correction factor = "
-      << returnval  //cache[Row][Column]
-      << " for rho, KE, A= "<<  rho << "  " << ke << "   " << A;
-    //    return cache[Row][Column];
-   return returnval;
-  } else {
-    //Reading in correction files//
-    //    string dir = genie_dir + string("/data/evgen/nncorr/");
+// This function reads the correction tables, once (the first thread to get
+// there reads them while the others wait)
+namespace {
+  std::once_flag gNucleonCorrTablesOnce;
 
+  void ReadCorrectionTables(void)
+  {
     read_file(dir+"NNCorrection_2_4.txt");
     HeliumValues = infile_values;
     infile_values = clear;
@@ -303,31 +280,47 @@ double INukeNucleonCorr :: getAvgCorrection(double rho, double A, double ke)
 
     LOG("INukeNucleonCorr",pNOTICE)
       << "Nucleon Corr interpolation files read in successfully";
-    //get interpolated value for first event.
-    int Npoints = 6;
-    TGraph * Interp = new TGraph(Npoints);
-    //LOG("INukeNucleonCorr",pNOTICE)
-    //  << HeliumValues[Row][Column];
-    Interp->SetPoint(0,4,HeliumValues[Row][Column]);
-    Interp->SetPoint(1,12,CarbonValues[Row][Column]);
-    Interp->SetPoint(2,40,CalciumValues[Row][Column]);
-    Interp->SetPoint(3,56,IronValues[Row][Column]);
-    Interp->SetPoint(4,120,TinValues[Row][Column]);
-    Interp->SetPoint(5,238,UraniumValues[Row][Column]);
-
-    //	LOG("INukeNucleonCorr",pNOTICE)
-    //	  << "Row,Column,value= " << Row << "   " << Column << "   " << Interp->Eval(A);
-    double returnval = Interp->Eval(A);
-    delete Interp;
-    ReadFile = true;
-    LOG("INukeNucleonCorr",pINFO)
-      << "Nucleon Corr interpolated correction factor = "
-      << returnval
-      << " for rho, KE, A= "<<  rho << "  " << ke << "   " << A;
-    return returnval;
   }
 }
 
+// This function interpolates and returns correction values
+//
+double INukeNucleonCorr :: getAvgCorrection(double rho, double A, double ke)
+{
+  //Read in energy and density to determine the row and column of the correction table - adjust for variable binning - throws away some of the accuracy
+   int Column = round(rho*100);
+   if(rho<.01) Column = 1;
+   if (Column>=NColumns) Column = NColumns-1;
+   int Row = 0;
+   if(ke<=.002) Row = 1;
+   if(ke>.002&&ke<=.1) Row = round(ke*1000.);
+   if(ke>.1&&ke<=.5) Row = round(.1*1000.+(ke-.1)*200);
+   if(ke>.5&&ke<=1) Row = round(.1*1000.+(.5-.1)*200+(ke-.5)*40);
+   if(ke>1) Row = NRows-1;
+   //LOG ("INukeNucleonCorr",pNOTICE)
+   //  << "row, column = " << Row << "   " << Column;
+
+  // Read the tables of correction values on first use (they are then only
+  // read, by all threads) and interpolate in A
+  std::call_once(gNucleonCorrTablesOnce, ReadCorrectionTables);
+
+  int Npoints = 6;
+  TGraph Interp(Npoints);
+  Interp.SetPoint(0,4,HeliumValues[Row][Column]);
+  Interp.SetPoint(1,12,CarbonValues[Row][Column]);
+  Interp.SetPoint(2,40,CalciumValues[Row][Column]);
+  Interp.SetPoint(3,56,IronValues[Row][Column]);
+  Interp.SetPoint(4,120,TinValues[Row][Column]);
+  Interp.SetPoint(5,238,UraniumValues[Row][Column]);
+
+  double returnval = Interp.Eval(A);
+  LOG("INukeNucleonCorr",pINFO)
+     << "Nucleon Corr interpolated correction factor = "
+     << returnval
+     << " for rho, KE, A= "<<  rho << "  " << ke << "   " << A;
+  return returnval;
+}
+
 //This function outputs new correction files a new target if needed//
 void  INukeNucleonCorr :: OutputFiles(int A, int Z)
 {
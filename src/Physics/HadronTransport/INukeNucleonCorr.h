@@ -20,7 +20,7 @@ class INukeNucleonCorr
   public:
     
     //! get single instance of INukeNucleonCorr; create if necessary
-    static INukeNucleonCorr* getInstance() {return fInstance ? fInstance : (fInstance = new INukeNucleonCorr);}
+    static INukeNucleonCorr* getInstance();
     
     //! get the correction for given four-momentum and density
     //    double getAvgCorrection (const double rho, const int A, const int Z, const int pdg, const double Ek);
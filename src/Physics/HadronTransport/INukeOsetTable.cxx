@@ -2,36 +2,153 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include <TSystem.h>
+
+#include "Framework/Messenger/Messenger.h"
 #include "INukeOsetTable.h"
 
 using namespace osetUtils;
 
-//! load tables from file and check its integrity
+namespace
+{
+  //! binary form header
+  struct BinaryHeader
+  {
+    char               signature[8]; //!< kBinarySignature
+    unsigned int       version;      //!< kBinaryVersion
+    unsigned int       nValues;      //!< cross sections per grid point
+    unsigned int       nDensityBins;
+    unsigned int       nEnergyBins;
+    double             densityBinWidth;
+    double             energyBinWidth;
+    unsigned long long textHash;     //!< FNV-1a hash of the text table
+  };
+
+  const char         kBinarySignature[8] = {'G','O','S','E','T','B','I','N'};
+  const unsigned int kBinaryVersion      = 1;
+
+  //! FNV-1a hash of text
+  unsigned long long hashText (const std::string &text)
+  {
+    unsigned long long hash = 14695981039346656037ULL;
+    for (std::string::size_type i = 0; i < text.size(); i++)
+    {
+      hash ^= (unsigned char) text[i];
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+}
+
+//! load tables from file (or its binary form) and check its integrity
 INukeOsetTable :: INukeOsetTable (const char *filename) : fNDensityBins (0), fNEnergyBins (0), 
                                                           fDensityBinWidth (0.0), fEnergyBinWidth (0.0)
 {
   // open file with Oset table
-  std::ifstream fileWithTables (filename);
+  std::ifstream fileWithTables (filename, std::ios::binary);
   // check if file is open
   if (not fileWithTables.is_open()) badFile (filename, 1);
+  // read the whole file at once (its hash is the key of the binary form)
+  std::ostringstream fileContents;
+  fileContents << fileWithTables.rdbuf();
+  const std::string text = fileContents.str();
+  const unsigned long long textHash = hashText (text);
+
+  // use binary form if available and up-to-date
+  const char *cache = gSystem->Getenv ("GINUKEOSETCACHE");
+  const std::string binaryFile = cache ? cache : "";
+  if (not binaryFile.empty() and readBinary (binaryFile, textHash)) return;
+
+  std::istringstream tableLines (text);
   // temporary string for getline
   std::string tempLine;
   // line counter (used in the case of error)
   int lineCounter = 0;
 
   // skip comments lines at the beginning of the file
-  while (fileWithTables.get() == '#' and ++lineCounter)
-    getline (fileWithTables, tempLine);
+  while (tableLines.get() == '#' and ++lineCounter)
+    getline (tableLines, tempLine);
   // process other lines
-  while (getline (fileWithTables, tempLine) and ++lineCounter)
+  while (getline (tableLines, tempLine) and ++lineCounter)
     if (int error = processLine (tempLine))   // get exit code
       badFile (filename, error, lineCounter); // stop if exit code != 0
 
   // reset counter (in the case other file will be loaded)
   checkIntegrity (-1.0, -1.0);
 
-  fDensityHandler.setHandler (fDensityBinWidth, fNDensityBins);
-  fEnergyHandler.setHandler  (fEnergyBinWidth,  fNEnergyBins);
+  if (not binaryFile.empty()) writeBinary (binaryFile, textHash);
+}
+
+//! read table from its binary form; false if missing or made from a different text file
+bool INukeOsetTable :: readBinary (const std::string &filename, const unsigned long long &textHash)
+{
+  std::ifstream binary (filename.c_str(), std::ios::binary);
+  if (not binary.is_open()) return false;
+
+  BinaryHeader header;
+  binary.read ((char*) &header, sizeof (header));
+
+  if (not binary or std::memcmp (header.signature, kBinarySignature, 8) != 0 or
+      header.version != kBinaryVersion or header.nValues != fNValues or
+      header.textHash != textHash)
+  {
+    LOG ("INukeOsetTable", pNOTICE)
+      << "Binary Oset table " << filename << " is out of date - Rebuilding it";
+    return false;
+  }
+
+  std::vector <double> table (header.nDensityBins * header.nEnergyBins * fNValues);
+  binary.read ((char*) &table[0], table.size() * sizeof (double));
+  if (table.empty() or not binary)
+  {
+    LOG ("INukeOsetTable", pWARN) << "Binary Oset table " << filename << " is corrupted";
+    return false;
+  }
+
+  fCrossSectionTable.swap (table);
+  fNDensityBins    = header.nDensityBins;
+  fNEnergyBins     = header.nEnergyBins;
+  fDensityBinWidth = header.densityBinWidth;
+  fEnergyBinWidth  = header.energyBinWidth;
+
+  LOG ("INukeOsetTable", pNOTICE) << "Loaded binary Oset table " << filename;
+
+  return true;
+}
+
+//! save table in its binary form (written to a temporary file which is then renamed)
+void INukeOsetTable :: writeBinary (const std::string &filename, const unsigned long long &textHash) const
+{
+  BinaryHeader header;
+  std::memcpy (header.signature, kBinarySignature, 8);
+  header.version         = kBinaryVersion;
+  header.nValues         = fNValues;
+  header.nDensityBins    = fNDensityBins;
+  header.nEnergyBins     = fNEnergyBins;
+  header.densityBinWidth = fDensityBinWidth;
+  header.energyBinWidth  = fEnergyBinWidth;
+  header.textHash        = textHash;
+
+  std::ostringstream tmpname;
+  tmpname << filename << ".tmp." << gSystem->GetPid();
+
+  std::ofstream binary (tmpname.str().c_str(), std::ios::binary);
+  binary.write ((const char*) &header, sizeof (header));
+  binary.write ((const char*) &fCrossSectionTable[0],
+                fCrossSectionTable.size() * sizeof (double));
+  binary.close();
+
+  if (not binary or std::rename (tmpname.str().c_str(), filename.c_str()) != 0)
+  {
+    LOG ("INukeOsetTable", pWARN) << "Couldn't write binary Oset table " << filename;
+    std::remove (tmpname.str().c_str());
+    return;
+  }
+
+  LOG ("INukeOsetTable", pNOTICE) << "Saved binary Oset table to " << filename;
 }
 
 // process single line from table file, push values to proper vector
@@ -57,21 +174,19 @@ int INukeOsetTable :: processLine (const std::string &line)
   if (int exitCode = checkIntegrity (currentDensityValue, currentEnergyValue))
     return exitCode; // stop in the case of error (exit code != 0)
 
+  double values [fNValues]; // cross sections in table order
+
   for (unsigned int i = 0; i < fNChannels; i++) // channel loop
   {
     // get qel and cex cross sections for i-th channel
-    double xsecQel, xsecCex;
-    splitLine >> xsecQel >> xsecCex;
-    // save them in proper vector
-    fQelCrossSectionTable[i].push_back (xsecQel);
-    fCexCrossSectionTable[i].push_back (xsecCex);
+    splitLine >> values[i] >> values[fNChannels + i];
   } // channel loop
 
   // get absorption cross section
-  double absorption;
-  splitLine >> absorption;
-  // save it in proper vector
-  fAbsorptionCrossSectionTable.push_back (absorption);
+  splitLine >> values[2 * fNChannels];
+
+  // save them in the table
+  fCrossSectionTable.insert (fCrossSectionTable.end(), values, values + fNValues);
 
   return 0; // no errors
 }
@@ -79,7 +194,8 @@ int INukeOsetTable :: processLine (const std::string &line)
 //! return 0 if all bins widths are constistent or return error code
 int INukeOsetTable :: checkIntegrity (const double &densityValue, const double &energyValue)
 {
-  static unsigned int energyBinCounter = 0; // #energy bins for current density
+  // (tables may be read by several threads, see sigmaTotalOset())
+  static thread_local unsigned int energyBinCounter = 0; // #energy bins for current density
   
   if (densityValue < 0) // checkIntegrity(-1.0, -1.0) is called to reset counter
     energyBinCounter = -1;
@@ -155,73 +271,8 @@ void INukeOsetTable :: badFile (const char* file, const int &errorCode, const in
   exit(errorCode);
 }
 
-//! make bilinear interpolation between four points around (density, energy)
-double INukeOsetTable :: interpolate (const std::vector<double> &data) const
-{
-  // take four points adjacent to (density, energy) = (d,E):
-  // (d0, E0), (d1, E0), (d0, E1), (d1, E1)
-  // where d0 < d < d1, E0 < E < E1
-  // each point goes in with weight = proper distance
-
-  // total bin width for normalization
-  static const double totalBinWidth = fDensityBinWidth * fEnergyBinWidth;
-  
-  // extract low boundary value from table
-  double lowValue = data[fEnergyHandler.index +
-                         fDensityHandler.index * fNEnergyBins]; // (d0, E0)
-  // high boundaries = low boundary if on edge
-  double highDensityValue = lowValue; // (d1, E0)
-  double highEnergyValue  = lowValue; // (d0, E1)
-  double highValue        = lowValue; // (d1, E1)
-
-  // extract high boundaries values from table (if not on edge)
-  if (not fDensityHandler.isEdge)
-  {
-    highDensityValue = data[fEnergyHandler.index +
-                            (fDensityHandler.index + 1) * fNEnergyBins];
-
-    if (not fEnergyHandler.isEdge)
-    {
-      highEnergyValue = data[fEnergyHandler.index + 1 +
-                             fDensityHandler.index * fNEnergyBins];
-      highValue       = data[fEnergyHandler.index + 1 +
-                             (fDensityHandler.index + 1) * fNEnergyBins];
-    }
-  }
-  else if (not fEnergyHandler.isEdge)
-    highEnergyValue = data[fEnergyHandler.index + 1 +
-                           fDensityHandler.index * fNEnergyBins];
-
-  lowValue         *= fDensityHandler.lowWeight  * fEnergyHandler.lowWeight;
-  highDensityValue *= fDensityHandler.highWeight * fEnergyHandler.lowWeight;
-  highEnergyValue  *= fDensityHandler.lowWeight  * fEnergyHandler.highWeight;
-  highValue        *= fDensityHandler.highWeight * fEnergyHandler.highWeight;
-  
-  return (lowValue + highDensityValue + highEnergyValue + highValue) /
-          totalBinWidth;
-}
-
-//! set up table index and weights for given point
-void INukeOsetTable :: PointHandler :: update (const double &newValue)
-{
-  value = newValue;         // update value
-  index = value / binWidth; // update index
-
-  // in the case value > max value use max; check if it is on edge
-  if (index >= nBins - 1)
-  {
-    index  = nBins - 1;
-    isEdge = true;
-  }
-  else isEdge = false;
-  // calcualte weights for boundary values
-  lowWeight  = (index + 1) * binWidth - value;
-  highWeight = value - index * binWidth;
-}
-
-
 /*! <ul>
- *  <li> set up density, pion Tk and their handlers (for interpolation)
+ *  <li> set up density, pion Tk
  *  <li> get interpolated cross sections
  *  <li> set up proper cross section variables
  *  </ul> 
@@ -231,22 +282,65 @@ void INukeOsetTable :: setupOset (const double &density, const double &pionTk, c
 {
   fNuclearDensity    = density;
   fPionKineticEnergy = pionTk;
-  fDensityHandler.update (fNuclearDensity);    // update density index / weights
-  fEnergyHandler.update  (fPionKineticEnergy); // update energy index / weights
   setCrossSections();
   INukeOset::setCrossSections (pionPDG, protonFraction);  
 }
 
 /*! assign cross sections values to proper variables
- * using bilinear interpolation
+ * using bilinear interpolation between four points around (density, energy):
+ * (d0, E0), (d1, E0), (d0, E1), (d1, E1), where d0 < d < d1, E0 < E < E1;
+ * each point goes in with weight = proper distance \n
+ * all cross sections of a grid point are stored together,
+ * so all of them are interpolated in one pass
  */ 
 void INukeOsetTable :: setCrossSections ()
 {
-    for (unsigned int i = 0; i < fNChannels; i++) // channel loop
-    {
-      fQelCrossSections[i] = interpolate (fQelCrossSectionTable[i]);
-      fCexCrossSections[i] = interpolate (fCexCrossSectionTable[i]);
-    }
+  // index of low boundary; values above the table use its last point
+  int densityIndex = fNuclearDensity    / fDensityBinWidth;
+  int energyIndex  = fPionKineticEnergy / fEnergyBinWidth;
+
+  // offsets of the high boundaries (0 if value is on edge of table)
+  unsigned int densityStep = fNEnergyBins * fNValues;
+  unsigned int energyStep  = fNValues;
+
+  if (densityIndex >= (int) fNDensityBins - 1)
+  {
+    densityIndex = fNDensityBins - 1;
+    densityStep  = 0;
+  }
+  if (energyIndex >= (int) fNEnergyBins - 1)
+  {
+    energyIndex = fNEnergyBins - 1;
+    energyStep  = 0;
+  }
+
+  // weights = distances from the opposite boundary, normalized to bin area
+  const double norm = 1.0 / (fDensityBinWidth * fEnergyBinWidth);
+
+  const double densityLowWeight  = ((densityIndex + 1) * fDensityBinWidth - fNuclearDensity);
+  const double densityHighWeight = (fNuclearDensity - densityIndex * fDensityBinWidth);
+  const double energyLowWeight   = ((energyIndex + 1) * fEnergyBinWidth - fPionKineticEnergy) * norm;
+  const double energyHighWeight  = (fPionKineticEnergy - energyIndex * fEnergyBinWidth) * norm;
+
+  const double w00 = densityLowWeight  * energyLowWeight;  // (d0, E0)
+  const double w10 = densityHighWeight * energyLowWeight;  // (d1, E0)
+  const double w01 = densityLowWeight  * energyHighWeight; // (d0, E1)
+  const double w11 = densityHighWeight * energyHighWeight; // (d1, E1)
+
+  const double *p00 = &fCrossSectionTable[(densityIndex * fNEnergyBins + energyIndex) * fNValues];
+  const double *p10 = p00 + densityStep;
+  const double *p01 = p00 + energyStep;
+  const double *p11 = p10 + energyStep;
+
+  double values [fNValues];
+  for (unsigned int k = 0; k < fNValues; k++)
+    values[k] = w00 * p00[k] + w10 * p10[k] + w01 * p01[k] + w11 * p11[k];
+
+  for (unsigned int i = 0; i < fNChannels; i++) // channel loop
+  {
+    fQelCrossSections[i] = values[i];
+    fCexCrossSections[i] = values[fNChannels + i];
+  }
 
-    fAbsorptionCrossSection = interpolate (fAbsorptionCrossSectionTable); 
+  fAbsorptionCrossSection = values[2 * fNChannels];
 }
@@ -12,6 +12,12 @@
  * Due to different approach to cascade in GENIE and NuWro there are some normalization issues.
  * Default Oset model can be found in INukeOsetFormula
  * 
+ * All the cross sections of a (density, energy) grid point are stored
+ * together, so that a single bilinear interpolation pass on the uniform grid
+ * gives all of them. If $GINUKEOSETCACHE names a file, the parsed table is
+ * saved there in a binary form and read back by the later jobs, as long as
+ * the text file is unchanged.
+ * 
 */
 
 #ifndef INUKE_OSET_TABLE_H
@@ -34,36 +40,31 @@ class INukeOsetTable : public INukeOset
 
   private:
   
-  //! quasi-elastic piN cross section
-  /*! vector contains values in the following order:
-   * d0 e0, d0 e1, ... , d0 en, d1 e0 ... \n
-   * channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0
-   */
-  std::vector <double> fQelCrossSectionTable [fNChannels]; 
-  
-  //! charge-exchange piN cross section
-  /*! vector contains values in the following order:
+  //! number of cross sections per grid point: qel and cex for each channel, absorption
+  static const unsigned int fNValues = 2 * fNChannels + 1;
+
+  //! all cross sections
+  /*! grid points in the following order:
    * d0 e0, d0 e1, ... , d0 en, d1 e0 ... \n
+   * values of a grid point in the following order:
+   * qel for each channel, cex for each channel, absorption \n
    * channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0
    */
-  std::vector <double> fCexCrossSectionTable [fNChannels];
-  
-  //! pi absorption cross section
-  /*! vector contains values in the following order:
-   * d0 e0, d0 e1, ... , d0 en, d1 e0 ...
-   */
-  std::vector <double> fAbsorptionCrossSectionTable;
+  std::vector <double> fCrossSectionTable;
 
   unsigned int fNDensityBins; //!< number of denisty bins
   unsigned int fNEnergyBins;  //!< number of energy bins
   double fDensityBinWidth;    //!< density step (must be fixed)
   double fEnergyBinWidth;     //!< energy step (must be fixed)
 
-  //! interpolate cross section (method fixed for Oset tables)
-  double interpolate (const std::vector<double> &data) const;
-
   //! process single line from table file, push values to proper vector (method fixed for Oset tables)
   int processLine (const std::string &line);
+
+  //! read table from its binary form; false if missing or made from a different text file
+  bool readBinary (const std::string &filename, const unsigned long long &textHash);
+
+  //! save table in its binary form
+  void writeBinary (const std::string &filename, const unsigned long long &textHash) const;
   
   //! check if data in file is consistent (method fixed for Oset tables)
   int checkIntegrity (const double &densityValue, const double &energyValue);
@@ -71,34 +72,8 @@ class INukeOsetTable : public INukeOset
   //! stop program and through an error if input file is corrupted (method fixed for Oset tables)
   void badFile (const char* file, const int &errorCode, const int &line = 0) const;
 
-  //! calculalte cross sections for each channel
+  //! calculalte cross sections for each channel (bilinear interpolation)
   void setCrossSections ();
-
-  //! handle table's index and weights for given density and energy 
-  struct PointHandler
-  {
-    double value;      //!< exact value as read from table
-    double lowWeight;  //!< distance from high boundary
-    double highWeight; //!< distance from low boundary
-    int index;         //!< point index = index of low boundary
-    double binWidth;   //!< bin width used to calculate distances
-    int nBins;         //!< nBins to check isEdge
-    bool isEdge; //!< true if value is on edge of table (should never happen)
-
-    PointHandler () : value (-1.0) {}; //!< constructor
-
-    //! set up binWidth and nBins
-    inline void setHandler (const double &width, const int &bins)
-    {
-      binWidth = width;
-      nBins    = bins;
-    }
-    
-    void update (const double &newValue); //!< update point if changed
-  };
-
-  PointHandler fDensityHandler; //!< nuclear density handler
-  PointHandler fEnergyHandler;  //!< pion kinetic energy handler
 };
 
 #endif // INUKE_OSET_TABLE_H
@@ -31,6 +31,9 @@
    Added common utility functions used by both hA and hN mode. Updated
    MeanFreePath to separate proton and neutron cross sections. Added general
    utility functions.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   PhaseSpaceDecay() generates the decay under the ProcessGeneratorLock
+   (gRandom).
 */
 //____________________________________________________________________________
 
@@ -50,6 +53,7 @@
 #include "Physics/HadronTransport/INukeHadroData.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -445,7 +449,7 @@ void genie::utils::intranuke::PreEquilibrium(
         {
           target.SetHitNucPdg(*pdg_iter);
           Nuclmodel->GenerateNucleon(target);
-          mBuf = pLib->Find(*pdg_iter)->Mass();
+          mBuf = pLib->Mass(*pdg_iter);
           mSum += mBuf;
           pBuf = FermiFac * Nuclmodel->Momentum3();
           eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
@@ -599,7 +603,7 @@ void genie::utils::intranuke::Equilibrium(
         {
           target.SetHitNucPdg(*pdg_iter);
           Nuclmodel->GenerateNucleon(target);
-          mBuf = pLib->Find(*pdg_iter)->Mass();
+          mBuf = pLib->Mass(*pdg_iter);
           mSum += mBuf;
           pBuf = FermiFac * Nuclmodel->Momentum3();
           eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
@@ -652,8 +656,8 @@ bool genie::utils::intranuke::TwoBodyCollision(
   Target target(ev->TargetNucleus()->Pdg());
 
   // get mass for particles
-  M3 = pLib->Find(scode)->Mass();
-  M4 = pLib->Find(s2code)->Mass();
+  M3 = pLib->Mass(scode);
+  M4 = pLib->Mass(s2code);
 
   // get lab energy and momenta and assign to 4 vectors
   TLorentzVector t4P1L = *p->P4();
@@ -980,11 +984,11 @@ bool genie::utils::intranuke::ThreeBodyKinematics(
   // random number generator
   RandomGen * rnd = RandomGen::Instance();
 
-  M1 = pLib->Find(p->Pdg())->Mass();
-  M2 = pLib->Find(tcode)->Mass();
-  M3 = pLib->Find(s1->Pdg())->Mass();
-  M4 = pLib->Find(s2->Pdg())->Mass();
-  M5 = pLib->Find(s3->Pdg())->Mass();
+  M1 = pLib->Mass(p->Pdg());
+  M2 = pLib->Mass(tcode);
+  M3 = pLib->Mass(s1->Pdg());
+  M4 = pLib->Mass(s2->Pdg());
+  M5 = pLib->Mass(s3->Pdg());
 
   // set up fermi target
   Target target(ev->TargetNucleus()->Pdg());
@@ -1355,17 +1359,17 @@ bool genie::utils::intranuke::PionProduction(
     {
 
       double tote = p->Energy();
-      double pMass = pLib->Find(2212)->Mass();
-      double nMass = pLib->Find(2112)->Mass();
+      double pMass = pLib->Mass(2212);
+      double nMass = pLib->Mass(2112);
       double etapp2ppPi0 =
-        utils::intranuke::CalculateEta(pMass,tote,pMass,pMass+pMass,pLib->Find(111)->Mass());
+        utils::intranuke::CalculateEta(pMass,tote,pMass,pMass+pMass,pLib->Mass(111));
       double etapp2pnPip =
-        utils::intranuke::CalculateEta(pLib->Find(p1code)->Mass(),tote,((p1code==kPdgProton)?pMass:nMass),
-                                       pMass+nMass,pLib->Find(211)->Mass());
+        utils::intranuke::CalculateEta(pLib->Mass(p1code),tote,((p1code==kPdgProton)?pMass:nMass),
+                                       pMass+nMass,pLib->Mass(211));
       double etapn2nnPip =
-        utils::intranuke::CalculateEta(pMass,tote,nMass,nMass+nMass,pLib->Find(211)->Mass());
+        utils::intranuke::CalculateEta(pMass,tote,nMass,nMass+nMass,pLib->Mass(211));
       double etapn2ppPim =
-        utils::intranuke::CalculateEta(pMass,tote,nMass,pMass+pMass,pLib->Find(211)->Mass());
+        utils::intranuke::CalculateEta(pMass,tote,nMass,pMass+pMass,pLib->Mass(211));
 
       if ((etapp2ppPi0<=0.)&&(etapp2pnPip<=0.)&&(etapn2nnPip<=0.)&&(etapn2ppPim<=0.)) { // below threshold
         LOG("INukeUtils",pNOTICE) << "PionProduction() called below threshold energy";
@@ -1573,7 +1577,7 @@ bool genie::utils::intranuke::PhaseSpaceDecay(
   double   mass_sum = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    double m  = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double m  = PDGLibrary::Instance()->Mass(pdgc);
     string nm = PDGLibrary::Instance()->Find(pdgc)->GetName();
     mass[i++] = m;
     mass_sum += m;
@@ -1581,15 +1585,15 @@ bool genie::utils::intranuke::PhaseSpaceDecay(
   }
   state_sstream << ")";
 
-  TLorentzVector * pd = p->GetP4(); // incident particle 4p
+  TLorentzVector pd = p->Momentum(); // incident particle 4p
 
   bool is_nuc = pdg::IsNeutronOrProton(p->Pdg());
   bool is_kaon = p->Pdg()==kPdgKP || p->Pdg()==kPdgKM;
   // update available energy -> init (mass + kinetic) + sum of f/s masses
   // for pion only.  Probe mass not available for nucleon, kaon
-  double availE = pd->Energy() + mass_sum;
+  double availE = pd.Energy() + mass_sum;
   if(is_nuc||is_kaon) availE -= p->Mass();
-  pd->SetE(availE);
+  pd.SetE(availE);
 
   LOG("INukeUtils",pNOTICE)
     << "size, mass_sum, availE, pd mass, energy = " << pdgv.size() << "  "
@@ -1605,21 +1609,21 @@ bool genie::utils::intranuke::PhaseSpaceDecay(
     << "Final state = " << state_sstream.str() << " has N = " << pdgv.size()
     << " particles / total mass = " << mass_sum;
   LOG("INukeUtils", pINFO)
-    << "Composite system p4 = " << utils::print::P4AsString(pd);
+    << "Composite system p4 = " << utils::print::P4AsString(&pd);
 
-  // Set the decay
+  // Set the decay (TGenPhaseSpace draws from gRandom: hold the lock)
+  ProcessGeneratorLock lock;
   TGenPhaseSpace GenPhaseSpace;
-  bool permitted = GenPhaseSpace.SetDecay(*pd, pdgv.size(), mass);
+  bool permitted = GenPhaseSpace.SetDecay(pd, pdgv.size(), mass);
   if(!permitted) {
      LOG("INukeUtils", pERROR)
        << " *** Phase space decay is not permitted \n"
        << " Total particle mass = " << mass_sum << "\n"
-       << " Decaying system p4 = " << utils::print::P4AsString(pd);
+       << " Decaying system p4 = " << utils::print::P4AsString(&pd);
 
      // clean-up and return
      RemnP4 += premnsub;
      delete [] mass;
-     delete pd;
      return false;
   }
 
@@ -1658,7 +1662,6 @@ bool genie::utils::intranuke::PhaseSpaceDecay(
              << "Couldn't generate an unweighted phase space decay after "
              << itry << " attempts";
        delete [] mass;
-       delete pd;
        return false;
     }
 
@@ -1683,7 +1686,7 @@ bool genie::utils::intranuke::PhaseSpaceDecay(
   GHepStatus_t ist = kIStStableFinalState;
   GHepStatus_t ist_pi = kIStHadronInTheNucleus;
 
-  TLorentzVector * v4 = p->GetX4();
+  TLorentzVector v4 = p->Position();
 
   double checkpx = p->Px();
   double checkpy = p->Py();
@@ -1703,7 +1706,7 @@ bool genie::utils::intranuke::PhaseSpaceDecay(
      //   not going at a simulated f/s particle at a "hadronic blob"
      //   representing the remnant system: do the binding energy subtraction
      //   here & update the remnant hadronic system 4p
-     double M  = PDGLibrary::Instance()->Find(pdgc)->Mass();
+     double M  = PDGLibrary::Instance()->Mass(pdgc);
      double En = p4fin->Energy();
      double KE = En-M;
      double dE_leftover = TMath::Min(NucRmvE, KE);
@@ -1729,7 +1732,7 @@ bool genie::utils::intranuke::PhaseSpaceDecay(
        {
          if (p4n.Vect().Mag()>=0.001)
            {
-             GHepParticle new_particle(pdgc, ist_pi, mom,-1,-1,-1, p4n, *v4);
+             GHepParticle new_particle(pdgc, ist_pi, mom,-1,-1,-1, p4n, v4);
              ev->AddParticle(new_particle);
            }
          else
@@ -1750,13 +1753,13 @@ bool genie::utils::intranuke::PhaseSpaceDecay(
 
              RemnP4 -= (p4n - TLorentzVector(0,0,0,M));
 
-             GHepParticle new_particle(pdgc, ist, mom,-1,-1,-1, p4n, *v4);
+             GHepParticle new_particle(pdgc, ist, mom,-1,-1,-1, p4n, v4);
              ev->AddParticle(new_particle);
            }
        }
      else
        {
-         GHepParticle new_particle(pdgc, ist, mom,-1,-1,-1, p4n, *v4);
+         GHepParticle new_particle(pdgc, ist, mom,-1,-1,-1, p4n, v4);
 
          if(isnuc) new_particle.SetRemovalEnergy(0.);
          ev->AddParticle(new_particle);
@@ -1773,8 +1776,6 @@ bool genie::utils::intranuke::PhaseSpaceDecay(
 
   // Clean-up
   delete [] mass;
-  delete pd;
-  delete v4;
 
   return true;
 }
@@ -34,9 +34,31 @@
  @ Jan 9, 2015 - SD, NG, TG
    Added 2014 version of INTRANUKE codes for v2.9.0.  Uses INukeHadroData2014,
    but no changes to mean free path.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added MeanFreePathTab(), interpolating the mean free path in (r, KE) tables
+   built on first use. Used by ProbSurvival() and Dist2ExitMFP().
+   Added MeanFreePath() versions taking the INTRANUKE mode as an INukeMode_t
+   and the hadron data (masses & cross section splines) resolved once, see
+   HadronInfo(), instead of a string and a PDG code.
+   PhaseSpaceDecay() uses a PhaseSpaceDecayer, caching the max decay weight
+   per final state and energy bin, instead of a TGenPhaseSpace set up (and
+   sampled for its max weight) at each call.
+   Dist2Exit(), Dist2ExitMFP() and ProbSurvival() get their number of steps
+   from the intersection of the hadron line with the nuclear sphere, and sum
+   the mean free path table along the line without 4-vector temporaries.
+   StepParticle() steps the particle without 4-vector temporaries.
+   Added batch MeanFreePath() and MeanFreePathTab() versions, for the
+   hadrons stepped in lockstep by Intranuke2018::ProcessEventRecords().
+   sigmaTotalOset() uses an Oset cross section instance per thread (it is
+   set up for each call).
 */
 //____________________________________________________________________________
 
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
 #include <TLorentzVector.h>
 #include <TMath.h>
 #include <TSystem.h>
@@ -63,6 +85,7 @@
 #include "Framework/Registry/Registry.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/PhaseSpaceDecayer.h"
 #include "Physics/HadronTransport/INukeOset.h"
 #include "Physics/HadronTransport/INukeOsetTable.h"
 #include "Physics/HadronTransport/INukeOsetFormula.h"
@@ -74,6 +97,404 @@ using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+//____________________________________________________________________________
+namespace {
+  // data of the hadrons transported by INTRANUKE (see HadronInfo())
+  struct INukeHadronInfoTable {
+    genie::utils::intranuke2018::INukeHadronInfo info[7];
+
+    INukeHadronInfoTable() {
+      INukeHadroData2018 * hd = INukeHadroData2018::Instance();
+      Set(info[0], kPdgPiP,     hd->XSecPipp_Tot(), hd->XSecPipn_Tot(), 1.0);
+      Set(info[1], kPdgPi0,     hd->XSecPi0p_Tot(), hd->XSecPi0n_Tot(), 1.0);
+      Set(info[2], kPdgPiM,     hd->XSecPipn_Tot(), hd->XSecPipp_Tot(), 1.0);
+      Set(info[3], kPdgProton,  hd->XSecPp_Tot(),   hd->XSecPn_Tot(),   1.0);
+      Set(info[4], kPdgNeutron, hd->XSecPn_Tot(),   hd->XSecNn_Tot(),   1.0);
+      // this factor is used to empirically get agreement with tot xs data, justified historically.
+      Set(info[5], kPdgKP,      hd->XSecKpN_Tot(),  hd->XSecKpN_Tot(),  1.1);
+      Set(info[6], kPdgGamma,   hd->XSecGamp_fs(),  hd->XSecGamn_fs(),  1.0);
+    }
+    void Set(genie::utils::intranuke2018::INukeHadronInfo & h, int pdgc,
+             const Spline * xsec_p, const Spline * xsec_n, double scale)
+    {
+      h.pdgc       = pdgc;
+      h.mass       = PDGLibrary::Instance()->Mass(pdgc);
+      h.charge     = PDGLibrary::Instance()->Charge(pdgc) / 3.;
+      h.xsec_p     = xsec_p;
+      h.xsec_n     = xsec_n;
+      h.xsec_scale = scale;
+      h.is_pion    = pdg::IsPion(pdgc);
+      h.is_nucleon = pdg::IsNucleon(pdgc);
+      h.is_kaon    = pdgc == kPdgKP;
+      h.is_gamma   = pdgc == kPdgGamma;
+    }
+  };
+
+  // mean free path tables (see MeanFreePathTab())
+  const int    kMFPTabNR   = 160;  // radial nodes, from 0 to the table radius
+  const int    kMFPTabNKE  = 160;  // kinetic energy nodes, log spaced
+  const double kMFPTabR0   = 5.6;  // table radius / A^{1/3} (fm), above NR x R0 = 3 x 1.4 fm
+  const double kMFPTabMassTol = 1E-3; // off-shell hadrons beyond that (GeV) use the exact mean free path
+
+  // pdgc, A, Z, nRpi, nRnuc, useOset, altOset, xsecNNCorr, hN mode
+  typedef std::tuple<int, double, double, double, double, 
+                     bool, bool, bool, bool> MFPTableKey;
+
+  struct MFPTable {
+    double              mass;     // hadron mass (GeV)
+    double              dr;       // radial step (fm)
+    double              rmax;     // table radius (fm)
+    double              lnkemin;  // ln(kinetic energy / MeV) of the first node
+    double              dlnke;    // ln(kinetic energy) step
+    std::vector<double> mu;       // inverse mean free path (1/fm), [ir*kMFPTabNKE+ike]
+    std::vector<char>   exact;    // cells using the exact mean free path, [ir*(kMFPTabNKE-1)+ike]
+  };
+
+  std::mutex                        gMFPTableLock;
+  std::map<MFPTableKey, MFPTable *> gMFPTables;  // never deleted: looked up without lock
+
+  // last table used by the current thread
+  thread_local MFPTableKey      gMFPLastKey;
+  thread_local const MFPTable * gMFPLastTable = 0;
+
+  // Tabulate 1/MeanFreePath() on the (r, ln KE) grid. Cells across which the
+  // mean free path is not continuous (Coulomb correction threshold for 
+  // protons, low energy nucleon cut-off in hN mode, Oset model for pions below
+  // 350 MeV, vanishing density) are flagged to use the exact calculation.
+  MFPTable * BuildMFPTable(const MFPTableKey & key)
+  {
+    int    pdgc       = std::get<0>(key);
+    double A          = std::get<1>(key);
+    double Z          = std::get<2>(key);
+    double nRpi       = std::get<3>(key);
+    double nRnuc      = std::get<4>(key);
+    bool   useOset    = std::get<5>(key);
+    bool   altOset    = std::get<6>(key);
+    bool   xsecNNCorr = std::get<7>(key);
+    bool   hN         = std::get<8>(key);
+    INukeMode_t mode  = hN ? kIMdHN : kIMdUndefined;
+
+    const genie::utils::intranuke2018::INukeHadronInfo * hadron = 
+                              genie::utils::intranuke2018::HadronInfo(pdgc);
+
+    LOG("INukeUtils", pNOTICE)
+      << "Tabulating the mean free path of " << pdgc 
+      << " in nucleus (A,Z) = (" << A << "," << Z << ")";
+
+    MFPTable * table = new MFPTable;
+    table->mass    = hadron->mass;
+    table->rmax    = kMFPTabR0 * TMath::Power(A, 1./3.);
+    table->dr      = table->rmax / (kMFPTabNR-1);
+    table->lnkemin = TMath::Log(INukeHadroData2018::fMinKinEnergy);
+    table->dlnke   = (TMath::Log(INukeHadroData2018::fMaxKinEnergyHN) - table->lnkemin) 
+                     / (kMFPTabNKE-1);
+    table->mu.resize(kMFPTabNR*kMFPTabNKE);
+    table->exact.assign((kMFPTabNR-1)*(kMFPTabNKE-1), 0);
+
+    std::vector<double> ke(kMFPTabNKE);
+    for(int ike = 0; ike < kMFPTabNKE; ike++) {
+      ke[ike] = TMath::Exp(table->lnkemin + ike*table->dlnke);
+    }
+
+    for(int ir = 0; ir < kMFPTabNR; ir++) {
+      TLorentzVector x4(0, 0, ir*table->dr, 0);
+      for(int ike = 0; ike < kMFPTabNKE; ike++) {
+        double E = ke[ike]*units::MeV + table->mass;
+        double p = TMath::Sqrt(TMath::Max(0., E*E - table->mass*table->mass));
+        TLorentzVector p4(0, 0, p, E);
+        double mfp = genie::utils::intranuke2018::MeanFreePath(
+          *hadron, x4, p4, A, Z, nRpi, nRnuc, useOset, altOset, xsecNNCorr, mode);
+        table->mu[ir*kMFPTabNKE + ike] = (mfp > 0) ? 1./mfp : 0.;
+      }
+    }
+
+    bool is_pion    = hadron->is_pion;
+    bool is_nucleon = hadron->is_nucleon;
+    double hc = 197.327;
+    double E0 = TMath::Power(A,0.2)*12.;
+    for(int ir = 0; ir < kMFPTabNR-1; ir++) {
+      double rlo = ir*table->dr;
+      for(int ike = 0; ike < kMFPTabNKE-1; ike++) {
+        bool exact = false;
+        // the Coulomb correction applies below a threshold decreasing with r & KE
+        if(pdgc == kPdgProton) {
+          exact = exact || rlo <= 0 || Z*hc/137./rlo > ke[ike];
+        }
+        if(is_nucleon && hN) {
+          exact = exact || (ke[ike] < E0 && ke[ike+1] >= E0);
+        }
+        // the Oset model also sets the pion fate fractions: always called
+        if(is_pion && hN && useOset) {
+          exact = exact || ke[ike] < 350.0;
+        }
+        for(int jr = ir; jr <= ir+1; jr++) {
+          for(int jke = ike; jke <= ike+1; jke++) {
+            exact = exact || table->mu[jr*kMFPTabNKE + jke] <= 0;
+          }
+        }
+        table->exact[ir*(kMFPTabNKE-1) + ike] = exact;
+      }
+    }
+    return table;
+  }
+
+  const MFPTable * GetMFPTable(const MFPTableKey & key)
+  {
+    if(gMFPLastTable && key == gMFPLastKey) return gMFPLastTable;
+
+    std::lock_guard<std::mutex> guard(gMFPTableLock);
+    MFPTable *& table = gMFPTables[key];
+    if(!table) table = BuildMFPTable(key);
+
+    gMFPLastKey   = key;
+    gMFPLastTable = table;
+    return table;
+  }
+
+  // Inverse mean free path at radius r for a hadron of mass M and energy E,
+  // bilinearly interpolated in the table. Returns false if the point is
+  // outside the table or in a cell where the exact calculation is needed.
+  bool InterpolateMFPTable(
+      const MFPTable * table, double r, double M, double E, double & mu)
+  {
+    double ke = (E - M) / units::MeV;
+    if(ke <= 0 || r >= table->rmax) return false;
+    if(TMath::Abs(M - table->mass) >= kMFPTabMassTol) return false;
+
+    double x   = r / table->dr;
+    double y   = (TMath::Log(ke) - table->lnkemin) / table->dlnke;
+    int    ir  = (int) x;
+    int    ike = (int) TMath::Floor(y);
+    if(ir >= kMFPTabNR-1 || ike < 0 || ike >= kMFPTabNKE-1) return false;
+    if(table->exact[ir*(kMFPTabNKE-1) + ike]) return false;
+
+    double fx = x - ir;
+    double fy = y - ike;
+    const double * m = &table->mu[ir*kMFPTabNKE + ike];
+    double mu_r0 = m[0]          + fy*(m[1]            - m[0]);
+    double mu_r1 = m[kMFPTabNKE] + fy*(m[kMFPTabNKE+1] - m[kMFPTabNKE]);
+    mu = mu_r0 + fx*(mu_r1 - mu_r0);
+    return true;
+  }
+
+  // First step n >= nmin for which the point x + n*step*u of a straight line
+  // (u: unit vector) is beyond the radius R. The points beyond R are those
+  // before the entry into, or after the exit from, the sphere of radius R.
+  int FirstStepOutside(
+      const double * x, const double * u, double step, double R, int nmin)
+  {
+    double b    = x[0]*u[0] + x[1]*u[1] + x[2]*u[2];
+    double c    = x[0]*x[0] + x[1]*x[1] + x[2]*x[2] - R*R;
+    double disc = b*b - c;
+    if(disc <= 0) return nmin; // the line does not enter the sphere
+
+    double sqdisc = TMath::Sqrt(disc);
+    double s_in   = -b - sqdisc;
+    double s_out  = -b + sqdisc;
+    if(nmin*step < s_in) return nmin;
+
+    int n = (int) TMath::Floor(s_out/step) + 1;
+    return TMath::Max(n, nmin);
+  }
+
+  // Sum of step/(mean free path) over the points x4 + n*step*u (n = 1 ...
+  // nsteps) of the straight line along p4, with the mean free path of
+  // MeanFreePathTab() with its default options (no Oset, no NN correction).
+  // The kinetic energy node of the table is located once for all points.
+  // Points where the mean free path is not defined do not contribute and
+  // set undefined.
+  double OpticalDepth(
+      const genie::utils::intranuke2018::INukeHadronInfo & hadron,
+      const TLorentzVector & x4, const TLorentzVector & p4,
+      double A, double Z, double nRpi, double nRnuc, 
+      int nsteps, double step, bool & undefined)
+  {
+    undefined = false;
+
+    MFPTableKey key(hadron.pdgc, A, Z, nRpi, nRnuc, false, false, false, false);
+    const MFPTable * table = GetMFPTable(key);
+
+    double M  = p4.M();
+    double ke = (p4.Energy() - M) / units::MeV;
+    int    ike = -1;
+    double fy  = 0;
+    if(ke > 0 && TMath::Abs(M - table->mass) < kMFPTabMassTol) {
+      double y = (TMath::Log(ke) - table->lnkemin) / table->dlnke;
+      ike = (int) TMath::Floor(y);
+      fy  = y - ike;
+      if(ike < 0 || ike >= kMFPTabNKE-1) ike = -1;
+    }
+
+    double p = p4.P();
+    double u[3] = { 0., 0., 0. };
+    if(p > 0) { u[0] = p4.Px()/p; u[1] = p4.Py()/p; u[2] = p4.Pz()/p; }
+
+    double depth = 0;
+    for(int n = 1; n <= nsteps; n++) {
+      double s  = n*step;
+      double xn = x4.X() + s*u[0];
+      double yn = x4.Y() + s*u[1];
+      double zn = x4.Z() + s*u[2];
+      double r  = TMath::Sqrt(xn*xn + yn*yn + zn*zn);
+
+      double mu = -1;
+      if(ike >= 0 && r < table->rmax) {
+        double fr = r / table->dr;
+        int    ir = (int) fr;
+        if(ir < kMFPTabNR-1 && !table->exact[ir*(kMFPTabNKE-1) + ike]) {
+          const double * m = &table->mu[ir*kMFPTabNKE + ike];
+          double mu_r0 = m[0]          + fy*(m[1]            - m[0]);
+          double mu_r1 = m[kMFPTabNKE] + fy*(m[kMFPTabNKE+1] - m[kMFPTabNKE]);
+          mu = mu_r0 + (fr - ir)*(mu_r1 - mu_r0);
+        }
+      }
+      if(mu < 0) {
+        TLorentzVector x4n(xn, yn, zn, x4.T());
+        double mfp = genie::utils::intranuke2018::MeanFreePath(
+           hadron, x4n, p4, A, Z, nRpi, nRnuc, false, false, false, kIMdUndefined);
+        if(mfp <= 0) { undefined = true; continue; }
+        mu = 1./mfp;
+      }
+      depth += step*mu;
+    }
+    return depth;
+  }
+}
+//____________________________________________________________________________
+double genie::utils::intranuke2018::MeanFreePathTab(
+   int pdgc, const TLorentzVector & x4, const TLorentzVector & p4,
+   double A, double Z, double nRpi, double nRnuc, const bool useOset, const bool altOset, const bool xsecNNCorr, string INukeMode)
+{
+  const INukeHadronInfo * hadron = HadronInfo(pdgc);
+  if(!hadron) return 0.;
+
+  INukeMode_t mode = (INukeMode == "hN2018") ? kIMdHN : 
+                     (INukeMode == "hA2018") ? kIMdHA : kIMdUndefined;
+
+  return MeanFreePathTab(*hadron, x4, p4, A, Z, nRpi, nRnuc, 
+                         useOset, altOset, xsecNNCorr, mode);
+}
+//____________________________________________________________________________
+double genie::utils::intranuke2018::MeanFreePathTab(
+   const INukeHadronInfo & hadron, const TLorentzVector & x4, 
+   const TLorentzVector & p4, double A, double Z, double nRpi, double nRnuc, 
+   bool useOset, bool altOset, bool xsecNNCorr, INukeMode_t mode)
+{
+// Mean free path (in fm), bilinearly interpolated in ln(KE) and r in a table
+// of the inverse mean free path computed by MeanFreePath(). The exact 
+// calculation is used outside the table (KE outside the range of the hadron
+// cross section splines, r beyond 5.6 A^{1/3} fm, off-shell hadron) and in 
+// the table cells across which the mean free path is not continuous.
+// See MeanFreePath() for a description of the inputs.
+//
+  MFPTableKey key(hadron.pdgc, A, Z, nRpi, nRnuc, useOset, altOset, xsecNNCorr, 
+                  mode == kIMdHN);
+  const MFPTable * table = GetMFPTable(key);
+
+  double mu = 0;
+  if(!InterpolateMFPTable(table, x4.Vect().Mag(), p4.M(), p4.Energy(), mu)) {
+    return genie::utils::intranuke2018::MeanFreePath(
+      hadron, x4, p4, A, Z, nRpi, nRnuc, useOset, altOset, xsecNNCorr, mode);
+  }
+  return 1. / mu;
+}
+//____________________________________________________________________________
+void genie::utils::intranuke2018::MeanFreePath(
+   int n, const INukeHadronInfo * const * hadron,
+   const double * x, const double * y, const double * z, const double * t,
+   const double * px, const double * py, const double * pz, const double * E,
+   const double * A, const double * Z, double nRpi, double nRnuc,
+   bool useOset, bool altOset, bool xsecNNCorr, INukeMode_t mode, double * mfp)
+{
+// Mean free paths (in fm) of the n input hadrons (see above)
+//
+  for(int i = 0; i < n; i++) {
+    if(!hadron[i]) { mfp[i] = 0.; continue; }
+    TLorentzVector x4( x[i],  y[i],  z[i], t[i]);
+    TLorentzVector p4(px[i], py[i], pz[i], E[i]);
+    mfp[i] = MeanFreePath(*hadron[i], x4, p4, A[i], Z[i], nRpi, nRnuc,
+                          useOset, altOset, xsecNNCorr, mode);
+  }
+}
+//____________________________________________________________________________
+void genie::utils::intranuke2018::MeanFreePathTab(
+   int n, const INukeHadronInfo * const * hadron,
+   const double * x, const double * y, const double * z, const double * t,
+   const double * px, const double * py, const double * pz, const double * E,
+   const double * A, const double * Z, double nRpi, double nRnuc,
+   bool useOset, bool altOset, bool xsecNNCorr, INukeMode_t mode, double * mfp)
+{
+// Interpolated mean free paths (in fm) of the n input hadrons, as given by
+// MeanFreePathTab() for each hadron. The tables of the last few (hadron,
+// nucleus) pairs are kept for the whole call, so that the hadrons of a batch
+// do not contend for the table lock when their species alternate.
+//
+  const int kNCached = 16;
+  const INukeHadronInfo * cached_hadron[kNCached];
+  double                  cached_A     [kNCached];
+  double                  cached_Z     [kNCached];
+  const MFPTable *        cached_table [kNCached];
+  int ncached = 0;
+
+  for(int i = 0; i < n; i++) {
+    if(!hadron[i]) { mfp[i] = 0.; continue; }
+
+    const MFPTable * table = 0;
+    for(int k = 0; k < ncached; k++) {
+      if(cached_hadron[k] == hadron[i] && 
+         cached_A[k] == A[i] && cached_Z[k] == Z[i]) { 
+        table = cached_table[k]; 
+        break; 
+      }
+    }
+    if(!table) {
+      MFPTableKey key(hadron[i]->pdgc, A[i], Z[i], nRpi, nRnuc, 
+                      useOset, altOset, xsecNNCorr, mode == kIMdHN);
+      table = GetMFPTable(key);
+      int k = (ncached < kNCached) ? ncached++ : i % kNCached;
+      cached_hadron[k] = hadron[i];
+      cached_A     [k] = A[i];
+      cached_Z     [k] = Z[i];
+      cached_table [k] = table;
+    }
+
+    double p2 = px[i]*px[i] + py[i]*py[i] + pz[i]*pz[i];
+    double m2 = E[i]*E[i] - p2;
+    double M  = (m2 < 0) ? -TMath::Sqrt(-m2) : TMath::Sqrt(m2); // as TLorentzVector::M()
+    double r  = TMath::Sqrt(x[i]*x[i] + y[i]*y[i] + z[i]*z[i]);
+
+    double mu = 0;
+    if(InterpolateMFPTable(table, r, M, E[i], mu)) {
+      mfp[i] = 1. / mu;
+    } else {
+      TLorentzVector x4( x[i],  y[i],  z[i], t[i]);
+      TLorentzVector p4(px[i], py[i], pz[i], E[i]);
+      mfp[i] = MeanFreePath(*hadron[i], x4, p4, A[i], Z[i], nRpi, nRnuc,
+                            useOset, altOset, xsecNNCorr, mode);
+    }
+  }
+}
+//____________________________________________________________________________
+const genie::utils::intranuke2018::INukeHadronInfo * 
+  genie::utils::intranuke2018::HadronInfo(int pdgc)
+{
+// Data used by the mean free path calculation for the input hadron, resolved
+// once for all species transported by INTRANUKE. Returns 0 for other ones.
+//
+  static const INukeHadronInfoTable table;
+
+  switch(pdgc) {
+    case kPdgPiP     : return &table.info[0];
+    case kPdgPi0     : return &table.info[1];
+    case kPdgPiM     : return &table.info[2];
+    case kPdgProton  : return &table.info[3];
+    case kPdgNeutron : return &table.info[4];
+    case kPdgKP      : return &table.info[5];
+    case kPdgGamma   : return &table.info[6];
+    default          : break;
+  }
+  return 0;
+}
 //____________________________________________________________________________
 double genie::utils::intranuke2018::MeanFreePath(
    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4,
@@ -89,12 +510,25 @@ double genie::utils::intranuke2018::MeanFreePath(
 //  nRpi : Controls the pion ring size in terms of de-Broglie wavelengths
 //  nRnuc: Controls the nuclepn ring size in terms of de-Broglie wavelengths
 //
-  bool is_pion    = pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM;
-  bool is_nucleon = pdgc == kPdgProton || pdgc == kPdgNeutron;
-  bool is_kaon    = pdgc == kPdgKP;
-  bool is_gamma   = pdgc == kPdgGamma;
+  const INukeHadronInfo * hadron = HadronInfo(pdgc);
+  if(!hadron) return 0.;
 
-  if(!is_pion && !is_nucleon && !is_kaon && !is_gamma) return 0.;
+  INukeMode_t mode = (INukeMode == "hN2018") ? kIMdHN : 
+                     (INukeMode == "hA2018") ? kIMdHA : kIMdUndefined;
+
+  return MeanFreePath(*hadron, x4, p4, A, Z, nRpi, nRnuc, 
+                      useOset, altOset, xsecNNCorr, mode);
+}
+//____________________________________________________________________________
+double genie::utils::intranuke2018::MeanFreePath(
+   const INukeHadronInfo & hadron, const TLorentzVector & x4, 
+   const TLorentzVector & p4, double A, double Z, double nRpi, double nRnuc, 
+   bool useOset, bool altOset, bool xsecNNCorr, INukeMode_t mode)
+{
+// Mean free path (in fm) for the hadron described by the input data (see
+// HadronInfo()) and the input INTRANUKE mode. See above for the other inputs.
+//
+  bool is_hN = (mode == kIMdHN);
 
   // before getting the nuclear density at the current position
   // check whether the nucleus has to become larger by const times the
@@ -109,22 +543,17 @@ double genie::utils::intranuke2018::MeanFreePath(
 
   if(A<=20) { ring /= 2.; }
 
-  /*
-  if      (is_pion               ) { ring *= nRpi;  }
-  else if (is_nucleon            ) { ring *= nRnuc; }
-  else if (is_gamma || is_kaon || useOset) { ring = 0.;     }
-  */
-  if(INukeMode=="hN2018")
+  if(is_hN)
     {
-      if      (is_pion               ) { ring *= nRpi;  }
-      else if (is_nucleon            ) { ring *= nRnuc; }
-      else if (is_gamma || is_kaon || useOset) { ring = 0.;}
+      if      (hadron.is_pion                          ) { ring *= nRpi;  }
+      else if (hadron.is_nucleon                       ) { ring *= nRnuc; }
+      else if (hadron.is_gamma || hadron.is_kaon || useOset) { ring = 0.;}
     }
   else
     {
-      if      (is_pion    || is_kaon ) { ring *= nRpi;  }
-      else if (is_nucleon            ) { ring *= nRnuc; }
-      else if (is_gamma              ) { ring = 0.;     }
+      if      (hadron.is_pion    || hadron.is_kaon ) { ring *= nRpi;  }
+      else if (hadron.is_nucleon                   ) { ring *= nRnuc; }
+      else if (hadron.is_gamma                     ) { ring = 0.;     }
     }
 
   // get the nuclear density at the current position
@@ -142,76 +571,47 @@ double genie::utils::intranuke2018::MeanFreePath(
   // kinetic energy
   double sigtot = 0;
   double ppcnt = (double) Z/ (double) A; // % of protons remaining
-  INukeHadroData2018 * fHadroData2018 = INukeHadroData2018::Instance();
-
-  if (is_pion and (INukeMode == "hN2018") and useOset and ke < 350.0)
-    sigtot = sigmaTotalOset (ke, rho, pdgc, ppcnt, altOset);
-  else if (pdgc == kPdgPiP)
-    { sigtot = fHadroData2018 -> XSecPipp_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecPipn_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgPi0)
-    { sigtot = fHadroData2018 -> XSecPi0p_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecPi0n_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgPiM)
-    { sigtot = fHadroData2018 -> XSecPipn_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecPipp_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgProton)
+
+  if (hadron.is_pion and is_hN and useOset and ke < 350.0)
+    sigtot = sigmaTotalOset (ke, rho, hadron.pdgc, ppcnt, altOset);
+  else if (hadron.xsec_p == hadron.xsec_n)
+    sigtot = hadron.xsec_p -> Evaluate(ke);
+  else
     {
-      sigtot = fHadroData2018 -> XSecPp_Tot()   -> Evaluate(ke)*ppcnt;
-      //sigtot+= fHadroData2018 -> XSecPn_Tot()   -> Evaluate(ke)*(1-ppcnt);
-
-      PDGLibrary * pLib = PDGLibrary::Instance();
-      double hc = 197.327;
-      double R0 = 1.25 * TMath::Power(A,1./3.) + 2.0 * 0.65; // should all be in units of fm
-      double Mp = pLib->Find(2212)->Mass();
-      double M  = pLib->Find(pdgc)->Mass();
-      //double E  = (p4.Energy() - Mp) * 1000.; // Convert GeV to MeV.
-      double E = ke;
-      if (Z*hc/137./x4.Vect().Mag() > E)  // Coulomb correction (Cohen, Concepts of Nuclear Physics, pg. 259-260)
+      double sigp = hadron.xsec_p -> Evaluate(ke);
+      if (hadron.pdgc == kPdgProton)
         {
-          double z  = 1.0; // charge for single proton
-          double Bc = z*Z*hc/137./R0;
-          double x  = E/Bc;
-          double f  = TMath::ACos(TMath::Power(x,0.5)) - TMath::Power(x*(1-x),0.5);
-          double B  = 0.63*z*Z*TMath::Power((M/Mp)/E,0.5);
-          double Pc = TMath::Exp(-B*f);
-          sigtot *= Pc;
+          double hc = 197.327;
+          double E = ke;
+          if (Z*hc/137./rnow > E)  // Coulomb correction (Cohen, Concepts of Nuclear Physics, pg. 259-260)
+            {
+              double R0 = 1.25 * TMath::Power(A,1./3.) + 2.0 * 0.65; // should all be in units of fm
+              double z  = 1.0; // charge for single proton
+              double Bc = z*Z*hc/137./R0;
+              double x  = E/Bc;
+              double f  = TMath::ACos(TMath::Sqrt(x)) - TMath::Sqrt(x*(1-x));
+              double B  = 0.63*z*Z*TMath::Sqrt(1./E); // M = Mp
+              double Pc = TMath::Exp(-B*f);
+              sigp *= Pc;
+            }
         }
-      sigtot+= fHadroData2018 -> XSecPn_Tot()   -> Evaluate(ke)*(1-ppcnt);
-
-      double E0 = TMath::Power(A,0.2)*12.;
-      if (INukeMode=="hN2018"){if(ke<E0){sigtot=0.0;}}  //empirical - needed to cut off large number of low energy nucleons
-      //      LOG("INukeUtils",pDEBUG) "sigtot for proton= " << sigtot << "; KE= " << ke << "; E0= " << E0;
+      sigtot = sigp * ppcnt + hadron.xsec_n -> Evaluate(ke) * (1-ppcnt);
     }
-  else if (pdgc == kPdgNeutron)
+  sigtot *= hadron.xsec_scale;
+
+  if (hadron.is_nucleon and is_hN)
     {
-      sigtot = fHadroData2018 -> XSecPn_Tot()   -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecNn_Tot()   -> Evaluate(ke)*(1-ppcnt);
       double E0 = TMath::Power(A,0.2)*12.;
-      if (INukeMode=="hN2018"){if(ke<E0){sigtot=0.0;}}  //empirical - needed to cut off large number of low energy nucleons
-      //      LOG("INukeUtils",pDEBUG) "sigtot for neutron= " << sigtot << "; KE= " << ke;
+      if(ke<E0){sigtot=0.0;}  //empirical - needed to cut off large number of low energy nucleons
     }
-  else if (pdgc == kPdgKP)
-    { sigtot = fHadroData2018 -> XSecKpN_Tot()  -> Evaluate(ke);
-      // this factor is used to empirically get agreement with tot xs data, justified historically.
-      sigtot*=1.1;}
-  else if (pdgc == kPdgGamma)
-    { sigtot = fHadroData2018 -> XSecGamp_fs()  -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecGamn_fs()  -> Evaluate(ke)*(1-ppcnt);}
-  else {
-     return 0;
-  }
 
   // the xsection splines in INukeHadroData return the hadron x-section in
   // mb -> convert to fm^2
   sigtot *= (units::mb / units::fm2);
 
-  // avoid defective error handling
-  //if(sigtot<1E-6){sigtot=1E-6;}
-
-  if (xsecNNCorr and is_nucleon)
+  if (xsecNNCorr and hadron.is_nucleon)
     sigtot *= INukeNucleonCorr::getInstance()->
-      getAvgCorrection (rho, A, p4.E() - PDGLibrary::Instance()->Find(pdgc)->Mass());   //uses lookup tables
+      getAvgCorrection (rho, A, p4.E() - hadron.mass);   //uses lookup tables
 
   // avoid defective error handling
   if(sigtot<1E-6){sigtot=1E-6;}
@@ -224,11 +624,6 @@ double genie::utils::intranuke2018::MeanFreePath(
      return -1;
   }
 
-/*
-  LOG("INukeUtils", pDEBUG)
-     << "sig_total = " << sigtot << " fm^2, rho = " << rho
-     << " fm^-3  => mfp = " << lamda << " fm.";
-*/
   return lamda;
 }
 //____________________________________________________________________________
@@ -298,13 +693,11 @@ double genie::utils::intranuke2018::ProbSurvival(
 //      nuclear radius. Def: 3
 //  R0: R0 in R=R0*A^1/3 (units:fm). Def. 1.4
 
-   double prob = 1.0;
-
    double step = 0.05; // fermi
    double R    = NR * R0 * TMath::Power(A, 1./3.);
 
-   TVector3 dr3 = p4.Vect().Unit();  // unit vector along its direction
-   TLorentzVector dr4(dr3,0);
+   const INukeHadronInfo * hadron = HadronInfo(pdgc);
+   if(!hadron) return 0.;
 
    LOG("INukeUtils", pDEBUG)
      << "Calculating survival probability for hadron with PDG code = " << pdgc
@@ -314,29 +707,25 @@ double genie::utils::intranuke2018::ProbSurvival(
      << ", nRpi = " << nRpi << ", nRnuc = " << nRnuc << ", NR = " << NR
      << ", R0 = " << R0 << " fm";
 
-   TLorentzVector x4_curr(x4); // current position
-
-   while(1) {
-     double rnow  = x4_curr.Vect().Mag();
-     if (rnow > (R+step)) break;
-
-     x4_curr += (step*dr4);
-     rnow = x4_curr.Vect().Mag();
-     double mfp =
-       genie::utils::intranuke2018::MeanFreePath(pdgc,x4_curr,p4,A,Z,nRpi,nRnuc);
-     double mfp_twk = mfp * mfp_scale_factor;
-
-     double dprob = (mfp_twk>0) ? TMath::Exp(-step/mfp_twk) : 0.;
-     prob*=dprob;
-/*
-     LOG("INukeUtils", pDEBUG)
-       << "+ step size = " << step << " fm, |r| = " << rnow << " fm, "
-       << "mfp = " << mfp_twk << "fm (nominal mfp = " << mfp << " fm): "
-       << "dPsurv = " << dprob << ", current Psurv = " << prob;
-*/
-   }
-
-   LOG("INukeUtils", pDEBUG) << "Psurv = " << prob;
+   // the hadron is stepped along its direction, until it is beyond R+step:
+   // the number of steps follows from the line / sphere intersection
+   double p = p4.P();
+   double u[3] = { 0., 0., 0. };
+   if(p > 0) { u[0] = p4.Px()/p; u[1] = p4.Py()/p; u[2] = p4.Pz()/p; }
+   double x[3] = { x4.X(), x4.Y(), x4.Z() };
+   int nsteps = FirstStepOutside(x, u, step, R+step, 0);
+   if(nsteps == 0) return 1.0;
+   if(mfp_scale_factor <= 0) return 0.;
+
+   // survival probability = exp(-optical depth), the product of the
+   // survival probabilities exp(-step/mfp) of the steps
+   bool undefined = false;
+   double depth = OpticalDepth(
+      *hadron, x4, p4, A, Z, nRpi, nRnuc, nsteps, step, undefined);
+   double prob = (undefined) ? 0. : TMath::Exp(-depth/mfp_scale_factor);
+
+   LOG("INukeUtils", pDEBUG) 
+     << "Psurv = " << prob << " (" << nsteps << " steps)";
 
    return prob;
 }
@@ -348,24 +737,21 @@ double genie::utils::intranuke2018::Dist2Exit(
 // Calculate distance within a nucleus (units: fm) before we stop tracking
 // the hadron.
 // See previous functions for a description of inputs.
+//
+// The distance is counted in steps of 0.05 fm, up to the first step beyond R,
+// found from the intersection of the straight line with the sphere of
+// radius R.
 //
    double R    = NR * R0 * TMath::Power(A, 1./3.);
    double step = 0.05; // fermi
 
-   TVector3 dr3 = p4.Vect().Unit();  // unit vector along its direction
-   TLorentzVector dr4(dr3,0);
+   double p = p4.P();
+   double u[3] = { 0., 0., 0. };
+   if(p > 0) { u[0] = p4.Px()/p; u[1] = p4.Py()/p; u[2] = p4.Pz()/p; }
+   double x[3] = { x4.X(), x4.Y(), x4.Z() };
 
-   TLorentzVector x4_curr(x4); // current position
-
-   double d=0;
-   while(1) {
-        double rnow  = x4_curr.Vect().Mag();
-        x4_curr += (step*dr4);
-        d+=step;
-        rnow = x4_curr.Vect().Mag();
-        if (rnow > R) break;
-   }
-   return d;
+   int nsteps = FirstStepOutside(x, u, step, R, 1);
+   return nsteps*step;
 }
 //____________________________________________________________________________
 double genie::utils::intranuke2018::Dist2ExitMFP(
@@ -377,30 +763,24 @@ double genie::utils::intranuke2018::Dist2ExitMFP(
 // See previous functions for a description of inputs.
 //
 
-// distance before exiting in mean free path lengths
+// distance before exiting in mean free path lengths: the sum of step/mfp
+// over the steps of Dist2Exit()
 //
    double R    = NR * R0 * TMath::Power(A, 1./3.);
    double step = 0.05; // fermi
 
-   TVector3 dr3 = p4.Vect().Unit();  // unit vector along its direction
-   TLorentzVector dr4(dr3,0);
-
-   TLorentzVector x4_curr(x4); // current position
+   const INukeHadronInfo * hadron = HadronInfo(pdgc);
+   if(!hadron) return 0.;
 
-   double d=0;
-   double d_mfp=0;
-   while(1) {
-        double rnow  = x4_curr.Vect().Mag();
-        x4_curr += (step*dr4);
-        d+=step;
-        rnow = x4_curr.Vect().Mag();
+   double p = p4.P();
+   double u[3] = { 0., 0., 0. };
+   if(p > 0) { u[0] = p4.Px()/p; u[1] = p4.Py()/p; u[2] = p4.Pz()/p; }
+   double x[3] = { x4.X(), x4.Y(), x4.Z() };
 
-        double lambda = genie::utils::intranuke2018::MeanFreePath(pdgc,x4_curr,p4,A,Z);
-        d_mfp += (step/lambda);
+   int nsteps = FirstStepOutside(x, u, step, R, 1);
 
-        if (rnow > R) break;
-   }
-   return d_mfp;
+   bool undefined = false;
+   return OpticalDepth(*hadron, x4, p4, A, Z, 0.5, 1.0, nsteps, step, undefined);
 }
 //____________________________________________________________________________
 void genie::utils::intranuke2018::StepParticle(
@@ -419,19 +799,22 @@ void genie::utils::intranuke2018::StepParticle(
       << "Stepping particle [" << p->Name() << "] by dr = " << step << " fm";
 #endif
 
-  // Step particle
-  TVector3 dr = p->P4()->Vect().Unit();      // unit vector along its direction
-  dr.SetMag(step);                           // spatial step size
-  double dt = 0;                             // temporal step:
-  TLorentzVector dx4(dr,dt);                 // 4-vector step
-  TLorentzVector x4new = *(p->X4()) + dx4;   // new position
+  // Step particle (spatial step along the unit vector of its direction)
+  const TLorentzVector * p4 = p->P4();
+  const TLorentzVector * x4 = p->X4();
+  double pmag  = TMath::Sqrt(p4->Px()*p4->Px() + p4->Py()*p4->Py() + p4->Pz()*p4->Pz());
+  double ds    = (pmag > 0) ? step/pmag : 0.;
+  double x     = x4->X() + ds*p4->Px();   // new position
+  double y     = x4->Y() + ds*p4->Py();
+  double z     = x4->Z() + ds*p4->Pz();
+  double t     = x4->T();                 // no temporal step
 
   if(nuclear_radius > 0.) {
     // Check position against nuclear boundary. If the particle was stepped
     // too far away outside the nuclear boundary bring it back to within
     // 1fm from that boundary
     double epsilon = 1; // fm
-    double r       = x4new.Vect().Mag(); // fm
+    double r       = TMath::Sqrt(x*x + y*y + z*z); // fm
     double rmax    = nuclear_radius+epsilon;
     if(r > rmax) {
        LOG("INukeUtils", pINFO)
@@ -440,18 +823,21 @@ void genie::utils::intranuke2018::StepParticle(
          << "Placing it " << epsilon
          << " fm outside the nucleus (r' = " << rmax << " fm)";
        double scale = rmax/r;
-       x4new *= scale;
+       x *= scale;
+       y *= scale;
+       z *= scale;
+       t *= scale;
     }//r>rmax
   }//nucl radius set
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  TLorentzVector x4new(x,y,z,t);
   LOG("INukeUtils", pDEBUG)
-      << "\n Init direction = " << print::Vec3AsString(&dr)
       << "\n Init position (in fm,nsec) = " << print::X4AsString(p->X4())
       << "\n Fin  position (in fm,nsec) = " << print::X4AsString(&x4new);
 #endif
 
-  p->SetPosition(x4new);
+  p->SetPosition(x,y,z,t);
 }
 
 
@@ -515,7 +901,7 @@ void genie::utils::intranuke2018::PreEquilibrium(
         {
           target.SetHitNucPdg(*pdg_iter);
           Nuclmodel->GenerateNucleon(target);
-          mBuf = pLib->Find(*pdg_iter)->Mass();
+          mBuf = pLib->Mass(*pdg_iter);
           mSum += mBuf;
           pBuf = FermiFac * Nuclmodel->Momentum3();
           eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
@@ -672,7 +1058,7 @@ void genie::utils::intranuke2018::Equilibrium(
         {
           target.SetHitNucPdg(*pdg_iter);
           Nuclmodel->GenerateNucleon(target);
-          mBuf = pLib->Find(*pdg_iter)->Mass();
+          mBuf = pLib->Mass(*pdg_iter);
           mSum += mBuf;
           pBuf = FermiFac * Nuclmodel->Momentum3();
           eBuf = TMath::Sqrt(pBuf.Mag2() + mBuf*mBuf);
@@ -726,10 +1112,10 @@ bool genie::utils::intranuke2018::TwoBodyCollision(
   Target target(ev->TargetNucleus()->Pdg());
 
   // get mass for particles
-  M1 = pLib->Find(pcode)->Mass();
-  // usused // M2 = pLib->Find(tcode)->Mass();
-  M3 = pLib->Find(scode)->Mass();
-  M4 = pLib->Find(s2code)->Mass();
+  M1 = pLib->Mass(pcode);
+  // usused // M2 = pLib->Mass(tcode);
+  M3 = pLib->Mass(scode);
+  M4 = pLib->Mass(s2code);
 
   // get lab energy and momenta and assign to 4 vectors
   TLorentzVector t4P1L = *p->P4();
@@ -1074,11 +1460,11 @@ bool genie::utils::intranuke2018::ThreeBodyKinematics(
   // random number generator
   RandomGen * rnd = RandomGen::Instance();
 
-  M1 = pLib->Find(p->Pdg())->Mass();
-  M2 = pLib->Find(tcode)->Mass();
-  M3 = pLib->Find(s1->Pdg())->Mass();
-  M4 = pLib->Find(s2->Pdg())->Mass();
-  M5 = pLib->Find(s3->Pdg())->Mass();
+  M1 = pLib->Mass(p->Pdg());
+  M2 = pLib->Mass(tcode);
+  M3 = pLib->Mass(s1->Pdg());
+  M4 = pLib->Mass(s2->Pdg());
+  M5 = pLib->Mass(s3->Pdg());
 
   // set up fermi target
   Target target(ev->TargetNucleus()->Pdg());
@@ -1449,17 +1835,17 @@ bool genie::utils::intranuke2018::PionProduction(
     {
 
       double tote = p->Energy();
-      double pMass = pLib->Find(2212)->Mass();
-      double nMass = pLib->Find(2112)->Mass();
+      double pMass = pLib->Mass(2212);
+      double nMass = pLib->Mass(2112);
       double etapp2ppPi0 =
-        utils::intranuke2018::CalculateEta(pMass,tote,pMass,pMass+pMass,pLib->Find(111)->Mass());
+        utils::intranuke2018::CalculateEta(pMass,tote,pMass,pMass+pMass,pLib->Mass(111));
       double etapp2pnPip =
-        utils::intranuke2018::CalculateEta(pLib->Find(p1code)->Mass(),tote,((p1code==kPdgProton)?pMass:nMass),
-                                       pMass+nMass,pLib->Find(211)->Mass());
+        utils::intranuke2018::CalculateEta(pLib->Mass(p1code),tote,((p1code==kPdgProton)?pMass:nMass),
+                                       pMass+nMass,pLib->Mass(211));
       double etapn2nnPip =
-        utils::intranuke2018::CalculateEta(pMass,tote,nMass,nMass+nMass,pLib->Find(211)->Mass());
+        utils::intranuke2018::CalculateEta(pMass,tote,nMass,nMass+nMass,pLib->Mass(211));
       double etapn2ppPim =
-        utils::intranuke2018::CalculateEta(pMass,tote,nMass,pMass+pMass,pLib->Find(211)->Mass());
+        utils::intranuke2018::CalculateEta(pMass,tote,nMass,pMass+pMass,pLib->Mass(211));
 
       if ((etapp2ppPi0<=0.)&&(etapp2pnPip<=0.)&&(etapn2nnPip<=0.)&&(etapn2ppPim<=0.)) { // below threshold
         LOG("INukeUtils",pNOTICE) << "PionProduction() called below threshold energy";
@@ -1659,34 +2045,25 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
 
   LOG("INukeUtils",pINFO) << "probe mass: M = " << p->Mass();
 
-  // Get the decay product masses & names
+  // Get the decay product masses
 
-  ostringstream state_sstream;
-  state_sstream << "( ";
   vector<int>::const_iterator pdg_iter;
   int i = 0;
-  double * mass = new double[pdgv.size()];
   double   mass_sum = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    double m  = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    string nm = PDGLibrary::Instance()->Find(pdgc)->GetName();
-    mass[i++] = m;
-    mass_sum += m;
-    state_sstream << nm << " ";
+    mass_sum += PDGLibrary::Instance()->Mass(*pdg_iter);
   }
-  state_sstream << ")";
 
-  TLorentzVector * pd = p->GetP4(); // incident particle 4p
+  TLorentzVector pd = p->Momentum(); // incident particle 4p
 
   bool is_nuc  = pdg::IsNeutronOrProton(p->Pdg());
   bool is_kaon = p->Pdg()==kPdgKP  || p->Pdg()==kPdgKM;
   // not used // bool is_pion = p->Pdg()==kPdgPiP || p->Pdg()==kPdgPi0 || p->Pdg()==kPdgPiM;
   // update available energy -> init (mass + kinetic) + sum of f/s masses
   // for pion only.  Probe mass not available for nucleon, kaon
-  double availE = pd->Energy() + mass_sum;
+  double availE = pd.Energy() + mass_sum;
   if(is_nuc||is_kaon) availE -= p->Mass();
-  pd->SetE(availE);
+  pd.SetE(availE);
 
   LOG("INukeUtils",pNOTICE)
     << "size, mass_sum, availE, pd mass, energy = " << pdgv.size() << "  "
@@ -1699,24 +2076,23 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   RemnP4 -= premnsub;
 
   LOG("INukeUtils", pINFO)
-    << "Final state = " << state_sstream.str() << " has N = " << pdgv.size()
+    << "Final state = " << pdgv << " has N = " << pdgv.size()
     << " particles / total mass = " << mass_sum;
   LOG("INukeUtils", pINFO)
-    << "Composite system p4 = " << utils::print::P4AsString(pd);
+    << "Composite system p4 = " << utils::print::P4AsString(&pd);
 
-  // Set the decay
-  TGenPhaseSpace GenPhaseSpace;
-  bool permitted = GenPhaseSpace.SetDecay(*pd, pdgv.size(), mass);
+  // Set the decay (the decayer, and its cache of max weights, is reused
+  // from call to call by each thread)
+  static thread_local PhaseSpaceDecayer decayer;
+  bool permitted = decayer.SetDecay(pd, pdgv);
   if(!permitted) {
      LOG("INukeUtils", pERROR)
        << " *** Phase space decay is not permitted \n"
        << " Total particle mass = " << mass_sum << "\n"
-       << " Decaying system p4 = " << utils::print::P4AsString(pd);
+       << " Decaying system p4 = " << utils::print::P4AsString(&pd);
 
      // clean-up and return
      RemnP4 += premnsub;
-     delete [] mass;
-     delete pd;
      return false;
   }
 
@@ -1726,11 +2102,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   p->SetPdgCode(kPdgCompNuclCluster);
   ev->AddParticle(*p);
   // Get the maximum weight
-  double wmax = -1;
-  for(int k=0; k<200; k++) {
-     double w = GenPhaseSpace.Generate();
-     wmax = TMath::Max(wmax,w);
-  }
+  double wmax = decayer.MaxWeight(200);
   assert(wmax>0);
 
   LOG("INukeUtils", pINFO)
@@ -1753,13 +2125,12 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
        LOG("INukeUtils", pNOTICE)
              << "Couldn't generate an unweighted phase space decay after "
              << itry << " attempts";
-       delete [] mass;
-       delete pd;
        return false;
     }
 
-    double w  = GenPhaseSpace.Generate();
+    double w  = decayer.Generate();
     double gw = wmax * rnd->RndFsi().Rndm();
+    decayer.UpdateMaxWeight(w);
 
     if(w > wmax) {
        LOG("INukeUtils", pNOTICE)
@@ -1779,7 +2150,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   GHepStatus_t ist = kIStStableFinalState;
   GHepStatus_t ist_pi = kIStHadronInTheNucleus;
 
-  TLorentzVector * v4 = p->GetX4();
+  TLorentzVector v4 = p->Position();
 
   double checkpx = p->Px();
   double checkpy = p->Py();
@@ -1795,13 +2166,13 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
      bool isnuc = pdg::IsNeutronOrProton(pdgc);
 
      //-- get the 4-momentum of the i-th final state particle
-     TLorentzVector * p4fin = GenPhaseSpace.GetDecay(i++);
+     TLorentzVector * p4fin = decayer.GetDecay(i);
 
      //-- intranuke no longer throws "bindinos" but adds all the energy
      //   not going at a simulated f/s particle at a "hadronic blob"
      //   representing the remnant system: do the binding energy subtraction
      //   here & update the remnant hadronic system 4p
-     double M  = PDGLibrary::Instance()->Find(pdgc)->Mass();
+     double M  = decayer.Mass(i++);
      double En = p4fin->Energy();
 
      double KE = En-M;
@@ -1832,7 +2203,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
        {
          if (p4n.Vect().Mag()>=0.001)
            {
-             GHepParticle new_particle(pdgc, ist_pi, mom,-1,-1,-1, p4n, *v4);
+             GHepParticle new_particle(pdgc, ist_pi, mom,-1,-1,-1, p4n, v4);
              ev->AddParticle(new_particle);
            }
          else
@@ -1853,13 +2224,13 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
 
              RemnP4 -= (p4n - TLorentzVector(0,0,0,M));
 
-             GHepParticle new_particle(pdgc, ist, mom,-1,-1,-1, p4n, *v4);
+             GHepParticle new_particle(pdgc, ist, mom,-1,-1,-1, p4n, v4);
              ev->AddParticle(new_particle);
            }
        }
      else
        {
-         GHepParticle new_particle(pdgc, ist, mom,-1,-1,-1, p4n, *v4);
+         GHepParticle new_particle(pdgc, ist, mom,-1,-1,-1, p4n, v4);
 
          if(isnuc) new_particle.SetRemovalEnergy(0.);
          ev->AddParticle(new_particle);
@@ -1875,11 +2246,6 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   LOG("INukeUtils", pNOTICE) << "check conservation: Px = " << checkpx << " Py = " << checkpy
                              << " Pz = " << checkpz << " E = " << checkE;
 
-  // Clean-up
-  delete [] mass;
-  delete pd;
-  delete v4;
-
   return true;
 }
 
@@ -1892,7 +2258,8 @@ double genie::utils::intranuke2018::sigmaTotalOset (
                                     )
 {
   // ------ OsetCrossSection init (only first time function is called) ------ //
-  static INukeOset *iNukeOset = NULL;
+  // (one instance per thread: it holds the set up of the current call)
+  static thread_local INukeOset *iNukeOset = NULL;
 
   if (iNukeOset == NULL)
   {
@@ -39,10 +39,28 @@ namespace genie {
 class GHepRecord;
 class GHepParticle;
 class PDGCodeList;
+class Spline;
 
 namespace utils {
 namespace intranuke2018
 {
+  //! Hadron data used by the mean free path calculation
+  struct INukeHadronInfo {
+    int            pdgc;
+    double         mass;        ///< GeV
+    double         charge;      ///< in units of e
+    const Spline * xsec_p;      ///< hadron+proton total xsec (mb)
+    const Spline * xsec_n;      ///< hadron+neutron total xsec (mb)
+    double         xsec_scale;  ///< empirical xsec factor
+    bool           is_pion;
+    bool           is_nucleon;
+    bool           is_kaon;
+    bool           is_gamma;
+  };
+
+  //! Data of the hadrons transported by INTRANUKE (0 for other ones)
+  const INukeHadronInfo * HadronInfo(int pdgc);
+
   //! Hadron survival probability
   double ProbSurvival(
     int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
@@ -53,7 +71,46 @@ namespace intranuke2018
   double MeanFreePath(
     int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
     double Z, double nRpi=0.5, double nRnuc=1.0, const bool useOset = false, const bool altOset = false, const bool xsecNNCorr = false, string INukeMode = "XX2018");
+
+  //! Mean free path, for the hadron data returned by HadronInfo()
+  double MeanFreePath(
+    const INukeHadronInfo & hadron, const TLorentzVector & x4, 
+    const TLorentzVector & p4, double A, double Z, double nRpi, double nRnuc,
+    bool useOset, bool altOset, bool xsecNNCorr, INukeMode_t mode);
  
+  //! Mean free path (pions, nucleons, kaons, photons) interpolated in tables
+  //! of the inverse mean free path on a (r, KE) grid, built on first use for
+  //! each nucleus, hadron and set of options (same inputs as MeanFreePath)
+  double MeanFreePathTab(
+    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
+    double Z, double nRpi=0.5, double nRnuc=1.0, const bool useOset = false, const bool altOset = false, const bool xsecNNCorr = false, string INukeMode = "XX2018");
+
+  //! Interpolated mean free path, for the hadron data returned by HadronInfo()
+  double MeanFreePathTab(
+    const INukeHadronInfo & hadron, const TLorentzVector & x4, 
+    const TLorentzVector & p4, double A, double Z, double nRpi, double nRnuc,
+    bool useOset, bool altOset, bool xsecNNCorr, INukeMode_t mode);
+
+  //! Mean free paths (mfp[i], fm) of n hadrons, given as arrays with one
+  //! entry per hadron: hadron data, position (fm), 4-momentum (GeV) and the
+  //! A, Z of its nucleus. Same as calling MeanFreePath() for each hadron.
+  void MeanFreePath(
+    int n, const INukeHadronInfo * const * hadron,
+    const double * x, const double * y, const double * z, const double * t,
+    const double * px, const double * py, const double * pz, const double * E,
+    const double * A, const double * Z, double nRpi, double nRnuc,
+    bool useOset, bool altOset, bool xsecNNCorr, INukeMode_t mode, double * mfp);
+
+  //! Interpolated mean free paths of n hadrons (see the batch MeanFreePath()),
+  //! same as calling MeanFreePathTab() for each hadron. The tables are looked
+  //! up once per hadron species and nucleus in the call.
+  void MeanFreePathTab(
+    int n, const INukeHadronInfo * const * hadron,
+    const double * x, const double * y, const double * z, const double * t,
+    const double * px, const double * py, const double * pz, const double * E,
+    const double * A, const double * Z, double nRpi, double nRnuc,
+    bool useOset, bool altOset, bool xsecNNCorr, INukeMode_t mode, double * mfp);
+
   //! Mean free path (Delta++ **test**)
   double MeanFreePath_Delta(
 			    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A );
@@ -52,12 +52,32 @@
    New 2014 class for latest Intranuke model
  @ Apr 26, 2018 - SD 
    Change year 2015 to 2018
+ @ Oct 14, 2026 - The GENIE Collaboration
+   GenerateStep() interpolates the mean free path in (r, KE) tables unless 
+   INUKE-UseMFPTable is false. The INTRANUKE mode is resolved to an 
+   INukeMode_t at configuration and the hadron data used by the mean free
+   path once per step, instead of string compares and PDGLibrary lookups.
+   TransportHadrons() steps a reused particle instead of a heap clone of
+   each hadron, and keeps the hadrons leaving the nucleus in a compact
+   CascadeStack that is written into the event record at the end.
+   TransportHadrons() records the number of steps, path length & integrated
+   inverse mean free path of each hadron for the reweighting tools, if
+   enabled (see GHepGenInfo).
+   Added the experimental batch mode ProcessEventRecords(), stepping the
+   hadrons of a block of events in lockstep in structure-of-arrays form
+   (TransportBatch). TransportHadrons() was split in pieces shared with
+   the batch mode.
+   The per-event cascade state of an instance is locked by each entry point
+   (EventLock), so that an instance can be shared by several threads.
 
 */
 //____________________________________________________________________________
 
+#include <algorithm>
 #include <cstdlib>
+#include <mutex>
 #include <sstream>
+#include <vector>
 
 #include <TMath.h>
 
@@ -68,6 +88,7 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepRecord.h"
+#include "Framework/GHEP/GHepGenInfo.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Physics/HadronTransport/Intranuke2018.h"
 #include "Physics/HadronTransport/INukeHadroData2018.h"
@@ -92,37 +113,193 @@ using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+namespace genie {
+  // the lock of the per-event state of an Intranuke2018 instance (see
+  // Intranuke2018::EventLock), recursive as the entry points can nest
+  struct Intranuke2018EventMutex {
+    std::recursive_mutex mutex;
+  };
+}
+
 //___________________________________________________________________________
 Intranuke2018::Intranuke2018() :
 EventRecordVisitorI()
 {
-
+  fEventMutex = new Intranuke2018EventMutex;
 }
 //___________________________________________________________________________
 Intranuke2018::Intranuke2018(string name) :
 EventRecordVisitorI(name)
 {
-
+  fEventMutex = new Intranuke2018EventMutex;
 }
 //___________________________________________________________________________
 Intranuke2018::Intranuke2018(string name, string config) :
 EventRecordVisitorI(name, config)
 {
-
+  fEventMutex = new Intranuke2018EventMutex;
 }
 //___________________________________________________________________________
 Intranuke2018::~Intranuke2018()
 {
-
+  delete fEventMutex;
+}
+//___________________________________________________________________________
+Intranuke2018::EventLock::EventLock(const Intranuke2018 * inuke) :
+fINuke(inuke)
+{
+  fINuke->fEventMutex->mutex.lock();
+}
+//___________________________________________________________________________
+Intranuke2018::EventLock::~EventLock()
+{
+  fINuke->fEventMutex->mutex.unlock();
 }
 //___________________________________________________________________________
 void Intranuke2018::ProcessEventRecord(GHepRecord * evrec) const
 {
+  EventLock lock(this);
+
+  if(!this->PrepareEvent(evrec)) return;
+
+  // Now transport all hadrons outside the tracking radius.
+  // Stepping part is common for both HA and HN.
+  // Once it has been estabished that an interaction takes place then
+  // HA and HN specific code takes over in order to simulate the final state.
+  this->TransportHadrons(evrec);
+}
+//___________________________________________________________________________
+void Intranuke2018::ProcessEventRecords(GHepRecord * const * evrecs, int n) const
+{
+  EventLock lock(this);
+
+  // The events of the batch: with a nuclear target, the same as the first one
+  int tgt_pdg = 0;
+  std::vector<GHepRecord *> others;
+  std::vector<EventState>   states;
+  states.reserve(n);
+  for(int ievent = 0; ievent < n; ievent++) {
+    GHepRecord * evrec = evrecs[ievent];
+    GHepParticle * nucltgt = evrec->TargetNucleus();
+    if(!nucltgt) {
+      LOG("Intranuke2018", pINFO) << "No nuclear target found - INTRANUKE exits";
+      continue;
+    }
+    if(tgt_pdg == 0) tgt_pdg = nucltgt->Pdg();
+    if(nucltgt->Pdg() != tgt_pdg) {
+      others.push_back(evrec);
+      continue;
+    }
+    states.push_back(EventState());
+    EventState & state = states.back();
+    state.event = evrec;
+    state.done  = false;
+    state.inucl = -1;
+    state.icurr = 0;
+    state.remnA = -1;
+    state.remnZ = -1;
+    state.gmode = fGMode;
+  }
+
+  LOG("Intranuke2018", pNOTICE)
+    << "Transporting the hadrons of " << states.size() << " events in lockstep";
+
+  int nevents = states.size();
+  for(int ievent = 0; ievent < nevents; ievent++) {
+    EventState & state = states[ievent];
+    this->SwapEventState(state);
+    this->PrepareEvent(state.event);
+    int inucl = this->StartTransport(state.event);
+    this->SwapEventState(state);
+    state.inucl = inucl;
+    state.done  = (inucl < 0);
+  }
+
+  // The hadrons being transported, one per event: copies of the GHEP entries
+  // as in TransportHadrons(), and their events & positions
+  std::vector<GHepParticle> transported(nevents);
+  std::vector<int>          lane_event (nevents);
+  std::vector<int>          lane_entry (nevents);
+  std::vector<int>          lane_index (nevents);
+  TransportBatch batch;
+
+  while(true) {
+    // Pick up the next hadron of each event that needs to be stepped
+    batch.Clear();
+    int nlanes = 0;
+    for(int ievent = 0; ievent < nevents; ievent++) {
+      EventState & state = states[ievent];
+      if(state.done) continue;
+      this->SwapEventState(state);
+      GHepParticle * sp = &transported[nlanes];
+      bool found = false;
+      while(!found && state.icurr < state.event->GetEntries()) {
+        found = this->StartHadron(state.event, state.icurr, sp);
+        if(!found) state.icurr++;
+      }
+      if(found) {
+        batch.Push(*sp, nlanes, utils::intranuke2018::HadronInfo(sp->Pdg()),
+                   this->MFPScale(sp->Pdg()), fRemnA, fRemnZ);
+        lane_event[nlanes] = ievent;
+        lane_entry[nlanes] = state.icurr;
+        nlanes++;
+      } else {
+        state.done = true;
+      }
+      this->SwapEventState(state);
+    }
+    if(nlanes == 0) break;
+
+    // Step them all out of the nucleus or up to their interaction point
+    this->StepHadrons(batch);
+
+    // Simulate the hadronic final states, one hadron at a time
+    for(int i = 0; i < nlanes; i++) lane_index[batch.lane[i]] = i;
+    for(int ilane = 0; ilane < nlanes; ilane++) {
+      int i = lane_index[ilane];
+      EventState & state = states[lane_event[ilane]];
+      GHepParticle * sp = &transported[ilane];
+      sp->SetPosition(batch.x[i], batch.y[i], batch.z[i], batch.t[i]);
+
+      this->SwapEventState(state);
+      // the Oset model sets the pion fate fractions of the hN mode along with
+      // the mean free path: recalculate it for the interacting hadron
+      if(batch.interacted[i] && fMode == kIMdHN && fUseOset && 
+         batch.hadron[i] && batch.hadron[i]->is_pion) {
+        this->GenerateStep(state.event, sp);
+      }
+      this->FinishHadron(state.event, lane_entry[ilane], sp,
+          batch.interacted[i], batch.nsteps[i], batch.tau[i]);
+      this->SwapEventState(state);
+      state.icurr++;
+    }
+  }
+
+  // Add the hadrons that left the nucleus and the remnant nucleus
+  for(int ievent = 0; ievent < nevents; ievent++) {
+    EventState & state = states[ievent];
+    if(state.inucl < 0) continue;
+    this->SwapEventState(state);
+    this->FinishTransport(state.event, state.inucl);
+    this->SwapEventState(state);
+  }
+
+  // The events with another nuclear target
+  for(unsigned int iother = 0; iother < others.size(); iother++) {
+    this->ProcessEventRecord(others[iother]);
+  }
+}
+//___________________________________________________________________________
+bool Intranuke2018::PrepareEvent(GHepRecord * evrec) const
+{
+// Sets the tracking radius, event generation mode and vertex of the input
+// event before the hadron transport. Returns false if there is no target.
+
   // Do not continue if there is no nuclear target
   GHepParticle * nucltgt = evrec->TargetNucleus();
   if (!nucltgt) {
     LOG("HNIntranuke2018", pINFO) << "No nuclear target found - INTRANUKE exits";
-    return;
+    return false;
   }
 
   // Decide tracking radius for the current nucleus (few * R0 * A^1/3)
@@ -145,12 +322,7 @@ void Intranuke2018::ProcessEventRecord(GHepRecord * evrec) const
   {
     this->GenerateVertex(evrec);  
   }
-
-  // Now transport all hadrons outside the tracking radius.
-  // Stepping part is common for both HA and HN.
-  // Once it has been estabished that an interaction takes place then
-  // HA and HN specific code takes over in order to simulate the final state.
-  this->TransportHadrons(evrec);
+  return true;
 }
 //___________________________________________________________________________
 void Intranuke2018::GenerateVertex(GHepRecord * evrec) const
@@ -261,6 +433,55 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
 {
 // transport all hadrons outside the nucleus
 
+  int inucl = this->StartTransport(evrec);
+  if(inucl < 0) return;
+
+  // The hadron being transported: a copy of the GHEP entry, reused for all
+  // the hadrons of the event (the original entry is not modified)
+  GHepParticle transported;
+  GHepParticle * sp = &transported;
+
+  // Loop over GHEP and run intranuclear rescattering on handled particles.
+  // The secondaries of each interaction are appended to GHEP and are picked
+  // up by the loop.
+  for(int icurr = 0; icurr < evrec->GetEntries(); icurr++)
+  {
+    // Check whether the particle needs (and can be) rescattered
+    if( ! this->StartHadron(evrec, icurr, sp) ) continue;
+
+    // Start stepping particle out of the nucleus
+    bool has_interacted = false;
+    int    nsteps = 0;
+    double tau    = 0.; // integral of dl / (mean free path)
+    while ( this-> IsInNucleus(sp) ) 
+    {
+      // advance the hadron by a step
+      utils::intranuke2018::StepParticle(sp, fHadStep);
+      nsteps++;
+
+      // check whether it interacts
+      double d = this->GenerateStep(evrec,sp);
+      if(fStepMFP > 0) tau += fHadStep / fStepMFP;
+      has_interacted = (d<fHadStep);
+      if(has_interacted) break;
+    }//stepping
+
+    this->FinishHadron(evrec, icurr, sp, has_interacted, nsteps, tau);
+
+    // Current snapshot
+    //LOG("Intranuke2018", pINFO) << "Current event record snapshot: " << *evrec;
+
+  }// GHEP entries
+
+  this->FinishTransport(evrec, inucl);
+}
+//___________________________________________________________________________
+int Intranuke2018::StartTransport(GHepRecord * evrec) const
+{
+// Looks up the nuclear environment at the beginning of hadron transport and 
+// starts keeping track of the remnant nucleus A, Z, P4.
+// Returns the position of the nucleus in the event record (-1 if not found).
+
   int inucl = -1;
   fRemnA = -1;
   fRemnZ = -1;
@@ -287,7 +508,7 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
        << "No nucleus found in position = " << inucl;
     LOG("Intranuke2018", pERROR) 
        << *evrec;
-    return;
+    return -1;
   }
   
   fRemnA = nucl->A();
@@ -299,84 +520,107 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
   const TLorentzVector & p4nucl = *(nucl->P4());
   fRemnP4 = p4nucl; 
 
-  // Loop over GHEP and run intranuclear rescattering on handled particles
-  TObjArrayIter piter(evrec);
-  GHepParticle * p = 0;
-  int icurr = -1;
+  // Hadrons leaving the nucleus are collected in the cascade stack and only
+  // added to GHEP at the end
+  fCascadeStack.Clear();
 
-  while( (p = (GHepParticle *) piter.Next()) )
-  {
-    icurr++;
+  return inucl;
+}
+//___________________________________________________________________________
+bool Intranuke2018::StartHadron(
+    GHepRecord * evrec, int icurr, GHepParticle * sp) const
+{
+// Copies the GHEP entry icurr to sp if it is a hadron to be stepped out of
+// the nucleus. Hadrons that INTRANUKE can not rescatter are taken out of the
+// nucleus. Returns true if the hadron is to be stepped.
 
-    // Check whether the particle needs rescattering, otherwise skip it
-    if( ! this->NeedsRescattering(p) ) continue;
+  GHepParticle * p = evrec->Particle(icurr);
+
+  // Check whether the particle needs rescattering, otherwise skip it
+  if( ! this->NeedsRescattering(p) ) return false;
  
-    LOG("Intranuke2018", pNOTICE)
-      << " >> Stepping a " << p->Name() 
-                        << " with kinetic E = " << p->KinE() << " GeV";
-
-    // Rescatter a clone, not the original particle
-    GHepParticle * sp = new GHepParticle(*p); 
-
-    // Set clone's mom to be the hadron that was cloned
-    sp->SetFirstMother(icurr); 
-
-    // Check whether the particle can be rescattered 
-    if(!this->CanRescatter(sp)) {
-
-       // if I can't rescatter it, I will just take it out of the nucleus
-       LOG("Intranuke2018", pNOTICE)
-              << "... Current version can't rescatter a " << sp->Name();
-       sp->SetFirstMother(icurr); 
-       sp->SetStatus(kIStStableFinalState);
-       evrec->AddParticle(*sp);
-       delete sp;
-       continue; // <-- skip to next GHEP entry
-    }
+  LOG("Intranuke2018", pNOTICE)
+    << " >> Stepping a " << p->Name() 
+                      << " with kinetic E = " << p->KinE() << " GeV";
 
-    // Start stepping particle out of the nucleus
-    bool has_interacted = false;
-    while ( this-> IsInNucleus(sp) ) 
-    {
-      // advance the hadron by a step
-      utils::intranuke2018::StepParticle(sp, fHadStep);
+  // Rescatter a copy, not the original particle
+  sp->Copy(*p);
 
-      // check whether it interacts
-      double d = this->GenerateStep(evrec,sp);
-      has_interacted = (d<fHadStep);
-      if(has_interacted) break;
-    }//stepping
+  // Set copy's mom to be the hadron that was copied
+  sp->SetFirstMother(icurr); 
+
+  // Check whether the particle can be rescattered 
+  if(!this->CanRescatter(sp)) {
+
+     // if I can't rescatter it, I will just take it out of the nucleus
+     LOG("Intranuke2018", pNOTICE)
+            << "... Current version can't rescatter a " << sp->Name();
+     sp->SetFirstMother(icurr); 
+     sp->SetStatus(kIStStableFinalState);
+     fCascadeStack.Push(*sp);
+     return false; // <-- skip to next GHEP entry
+  }
+  return true;
+}
+//___________________________________________________________________________
+void Intranuke2018::FinishHadron(
+    GHepRecord * evrec, int icurr, GHepParticle * sp,
+    bool has_interacted, int nsteps, double tau) const
+{
+// Simulates the hadronic final state of a hadron that interacted (at the 
+// position of sp), or takes the hadron out of the nucleus
 
-    //updating the position of the original particle with the position of the clone
-    evrec->Particle(sp->FirstMother())->SetPosition(*(sp->X4()));
+  //updating the position of the original particle with the position of the copy
+  evrec->Particle(sp->FirstMother())->SetPosition(*(sp->X4()));
  
-    if(has_interacted && fRemnA>0)  {
-        // the particle interacts - simulate the hadronic interaction
+  if(has_interacted && fRemnA>0)  {
+      // the particle interacts - simulate the hadronic interaction
+    LOG("Intranuke2018", pNOTICE) 
+        << "Particle has interacted at location:  " 
+        << sp->X4()->Vect().Mag() << " / nucl rad= " << fTrackingRadius;
+    this->SimulateHadronicFinalState(evrec,sp);
+  } else if(has_interacted && fRemnA<=0) {
+      // nothing left to interact with!
+    LOG("Intranuke2018", pNOTICE)
+        << "*** Nothing left to interact with, escaping.";
+    sp->SetStatus(kIStStableFinalState);
+    fCascadeStack.Push(*sp);
+    evrec->Particle(sp->FirstMother())->SetRescatterCode(1);
+  } else {
+      // the exits the nucleus without interacting - Done with it! 
       LOG("Intranuke2018", pNOTICE) 
-          << "Particle has interacted at location:  " 
-          << sp->X4()->Vect().Mag() << " / nucl rad= " << fTrackingRadius;
-	this->SimulateHadronicFinalState(evrec,sp);
-    } else if(has_interacted && fRemnA<=0) {
-        // nothing left to interact with!
-      LOG("Intranuke2018", pNOTICE)
-          << "*** Nothing left to interact with, escaping.";
-	sp->SetStatus(kIStStableFinalState);
-	evrec->AddParticle(*sp);
-	evrec->Particle(sp->FirstMother())->SetRescatterCode(1);
-    } else {
-        // the exits the nucleus without interacting - Done with it! 
-        LOG("Intranuke2018", pNOTICE) 
-          << "*** Hadron escaped the nucleus! Done with it.";
-	sp->SetStatus(kIStStableFinalState);
-	evrec->AddParticle(*sp);
-	evrec->Particle(sp->FirstMother())->SetRescatterCode(1);
-    }
-    delete sp;
+        << "*** Hadron escaped the nucleus! Done with it.";
+    sp->SetStatus(kIStStableFinalState);
+    fCascadeStack.Push(*sp);
+    evrec->Particle(sp->FirstMother())->SetRescatterCode(1);
+  }
 
-    // Current snapshot
-    //LOG("Intranuke2018", pINFO) << "Current event record snapshot: " << *evrec;
+  // keep the transport record (with the selected fate) for the
+  // reweighting tools
+  GHepGenInfo * geninfo = evrec->GenInfo();
+  if(geninfo) {
+    GHepParticle * hadron = evrec->Particle(icurr);
+    GHepINukeStep step;
+    step.position   = icurr;
+    step.pdg        = hadron->Pdg();
+    step.ke         = hadron->KinE();
+    step.fate       = hadron->RescatterCode();
+    step.nsteps     = nsteps;
+    step.path       = nsteps * fHadStep;
+    step.tau        = tau;
+    step.interacted = has_interacted;
+    geninfo->AddINukeStep(step);
+  }
+}
+//___________________________________________________________________________
+void Intranuke2018::FinishTransport(GHepRecord * evrec, int inucl) const
+{
+// Adds the hadrons that left the nucleus and the remnant nucleus at the end
+// of the hadron transport
 
-  }// GHEP entries
+  // Add the hadrons that left the nucleus
+  fCascadeStack.Write(evrec);
+  fCascadeStack.Clear();
 
   // Add remnant nucleus - that 'hadronic blob' has all the remaining hadronic 
   // 4p not  put explicitly into the simulated particles
@@ -393,6 +637,198 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
   }
 }
 //___________________________________________________________________________
+void Intranuke2018::StepHadrons(TransportBatch & batch) const
+{
+// Steps the hadrons of the batch out of the nucleus, or up to their 
+// interaction point, as the stepping loop of TransportHadrons() does for 
+// each hadron, but in lockstep: all the hadrons still in the nucleus are 
+// advanced by a step, get their mean free paths from a single call and 
+// sample the interaction. The hadrons that interacted or left the nucleus
+// are swapped out of the active range at the end of the arrays.
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  double rmax  = fTrackingRadius + fHadStep; // see IsInNucleus()
+  double rmax2 = rmax*rmax;
+
+  // hadrons that do not start in the nucleus are not stepped
+  int nactive = batch.Size();
+  for(int i = nactive-1; i >= 0; i--) {
+    double r2 = batch.x[i]*batch.x[i] + batch.y[i]*batch.y[i] + batch.z[i]*batch.z[i];
+    if(r2 >= rmax2) batch.Swap(i, --nactive);
+  }
+
+  while(nactive > 0) {
+    // advance the hadrons by a step
+    double * x  = &batch.x [0];
+    double * y  = &batch.y [0];
+    double * z  = &batch.z [0];
+    const double * ux = &batch.ux[0];
+    const double * uy = &batch.uy[0];
+    const double * uz = &batch.uz[0];
+    for(int i = 0; i < nactive; i++) {
+      x[i] += fHadStep*ux[i];
+      y[i] += fHadStep*uy[i];
+      z[i] += fHadStep*uz[i];
+      batch.nsteps[i]++;
+    }
+
+    // mean free paths at the new positions
+    if(fUseMFPTable) {
+      utils::intranuke2018::MeanFreePathTab(nactive, &batch.hadron[0], 
+          x, y, z, &batch.t[0], &batch.px[0], &batch.py[0], &batch.pz[0], &batch.E[0],
+          &batch.A[0], &batch.Z[0], fDelRPion, fDelRNucleon, 
+          fUseOset, fAltOset, fXsecNNCorr, fMode, &batch.mfp[0]);
+    } else {
+      utils::intranuke2018::MeanFreePath(nactive, &batch.hadron[0], 
+          x, y, z, &batch.t[0], &batch.px[0], &batch.py[0], &batch.pz[0], &batch.E[0],
+          &batch.A[0], &batch.Z[0], fDelRPion, fDelRNucleon, 
+          fUseOset, fAltOset, fXsecNNCorr, fMode, &batch.mfp[0]);
+    }
+
+    // check whether they interact, or are out of the nucleus
+    for(int i = nactive-1; i >= 0; i--) {
+      double L = batch.mfp[i] * batch.mfp_scale[i];
+      if(L > 0) batch.tau[i] += fHadStep / L;
+      double d = -1.*L * TMath::Log(rnd->RndFsi().Rndm());
+      batch.interacted[i] = (d < fHadStep);
+      double r2 = x[i]*x[i] + y[i]*y[i] + z[i]*z[i];
+      if(batch.interacted[i] || r2 >= rmax2) batch.Swap(i, --nactive);
+    }
+  }
+}
+//___________________________________________________________________________
+void Intranuke2018::SwapEventState(EventState & state) const
+{
+// Swaps the transport state of an event of a batch with the data members:
+// once before handling the event, and once after
+
+  std::swap(fRemnA,  state.remnA);
+  std::swap(fRemnZ,  state.remnZ);
+  std::swap(fRemnP4, state.remnP4);
+  std::swap(fGMode,  state.gmode);
+  fCascadeStack.Swap(state.stack);
+}
+//___________________________________________________________________________
+void Intranuke2018::CascadeStack::Clear(void)
+{
+  pdg.clear();
+  status.clear();
+  rescatter.clear();
+  mother.clear();
+  daughter.clear();
+  p4.clear();
+  x4.clear();
+  polz.clear();
+  removal.clear();
+}
+//___________________________________________________________________________
+void Intranuke2018::CascadeStack::Push(const GHepParticle & p)
+{
+  pdg.      push_back(p.Pdg());
+  status.   push_back((int) p.Status());
+  rescatter.push_back(p.RescatterCode());
+  mother.   push_back(p.FirstMother());
+  mother.   push_back(p.LastMother());
+  daughter. push_back(p.FirstDaughter());
+  daughter. push_back(p.LastDaughter());
+  p4.push_back(p.Px()); p4.push_back(p.Py()); p4.push_back(p.Pz()); p4.push_back(p.E());
+  x4.push_back(p.Vx()); x4.push_back(p.Vy()); x4.push_back(p.Vz()); x4.push_back(p.Vt());
+  polz.     push_back(p.PolzPolarAngle());
+  polz.     push_back(p.PolzAzimuthAngle());
+  removal.  push_back(p.IsBound() ? p.RemovalEnergy() : -1.);
+}
+//___________________________________________________________________________
+void Intranuke2018::CascadeStack::Write(GHepRecord * ev) const
+{
+// Adds the stacked hadrons to the event record, in the order they were
+// stacked, with the same contents as the particles pushed
+
+  for(int i = 0; i < this->Size(); i++) {
+    ev->AddParticle(pdg[i], (GHepStatus_t) status[i],
+        mother[2*i], mother[2*i+1], daughter[2*i], daughter[2*i+1],
+        p4[4*i], p4[4*i+1], p4[4*i+2], p4[4*i+3],
+        x4[4*i], x4[4*i+1], x4[4*i+2], x4[4*i+3]);
+
+    GHepParticle * p = ev->Particle(ev->GetEntries()-1);
+    p->SetRescatterCode(rescatter[i]);
+    if(polz[2*i] > -999 && polz[2*i+1] > -999) {
+      p->SetPolarization(polz[2*i], polz[2*i+1]);
+    }
+    if(removal[i] >= 0) {
+      p->SetBound(true);
+      p->SetRemovalEnergy(removal[i]);
+    }
+  }
+}
+//___________________________________________________________________________
+void Intranuke2018::CascadeStack::Swap(CascadeStack & stack)
+{
+  pdg.      swap(stack.pdg);
+  status.   swap(stack.status);
+  rescatter.swap(stack.rescatter);
+  mother.   swap(stack.mother);
+  daughter. swap(stack.daughter);
+  p4.       swap(stack.p4);
+  x4.       swap(stack.x4);
+  polz.     swap(stack.polz);
+  removal.  swap(stack.removal);
+}
+//___________________________________________________________________________
+void Intranuke2018::TransportBatch::Clear(void)
+{
+  lane.clear();
+  hadron.clear();
+  mfp_scale.clear();
+  A.clear(); Z.clear();
+  x.clear(); y.clear(); z.clear(); t.clear();
+  ux.clear(); uy.clear(); uz.clear();
+  px.clear(); py.clear(); pz.clear(); E.clear();
+  mfp.clear();
+  tau.clear();
+  nsteps.clear();
+  interacted.clear();
+}
+//___________________________________________________________________________
+void Intranuke2018::TransportBatch::Push(
+    const GHepParticle & p, int ilane,
+    const utils::intranuke2018::INukeHadronInfo * info, 
+    double scale, double remnA, double remnZ)
+{
+  // step direction, as in utils::intranuke2018::StepParticle()
+  double pmag = TMath::Sqrt(p.Px()*p.Px() + p.Py()*p.Py() + p.Pz()*p.Pz());
+  double ds   = (pmag > 0) ? 1./pmag : 0.;
+
+  lane.      push_back(ilane);
+  hadron.    push_back(info);
+  mfp_scale. push_back(scale);
+  A.push_back(remnA); 
+  Z.push_back(remnZ);
+  x.push_back(p.Vx()); y.push_back(p.Vy()); z.push_back(p.Vz()); t.push_back(p.Vt());
+  ux.push_back(ds*p.Px()); uy.push_back(ds*p.Py()); uz.push_back(ds*p.Pz());
+  px.push_back(p.Px()); py.push_back(p.Py()); pz.push_back(p.Pz()); E.push_back(p.E());
+  mfp.       push_back(0.);
+  tau.       push_back(0.);
+  nsteps.    push_back(0);
+  interacted.push_back(0);
+}
+//___________________________________________________________________________
+void Intranuke2018::TransportBatch::Swap(int i, int j)
+{
+  if(i == j) return;
+  std::swap(lane[i], lane[j]);
+  std::swap(hadron[i], hadron[j]);
+  std::swap(mfp_scale[i], mfp_scale[j]);
+  std::swap(A[i], A[j]); std::swap(Z[i], Z[j]);
+  std::swap(x[i], x[j]); std::swap(y[i], y[j]); std::swap(z[i], z[j]); std::swap(t[i], t[j]);
+  std::swap(ux[i], ux[j]); std::swap(uy[i], uy[j]); std::swap(uz[i], uz[j]);
+  std::swap(px[i], px[j]); std::swap(py[i], py[j]); std::swap(pz[i], pz[j]); std::swap(E[i], E[j]);
+  std::swap(mfp[i], mfp[j]);
+  std::swap(tau[i], tau[j]);
+  std::swap(nsteps[i], nsteps[j]);
+  std::swap(interacted[i], interacted[j]);
+}
+//___________________________________________________________________________
 double Intranuke2018::GenerateStep(GHepRecord*  /*evrec*/, GHepParticle* p) const //Added ev to get tgt argument//
 {
 // Generate a step (in fermis) for particle p in the input event.
@@ -401,43 +837,70 @@ double Intranuke2018::GenerateStep(GHepRecord*  /*evrec*/, GHepParticle* p) cons
 
   int pdgc = p->Pdg();
 
-  double scale = 1.;
-  if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
-    scale = fPionMFPScale;
-  }
-  else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
-    scale = fNucleonMFPScale;
-  }
-
   RandomGen * rnd = RandomGen::Instance();
 
-  string fINukeMode = this->GetINukeMode();
-  string fINukeModeGen = this->GetGenINukeMode();
-
-  double L = utils::intranuke2018::MeanFreePath(p->Pdg(), *p->X4(), *p->P4(), fRemnA,
-						fRemnZ, fDelRPion, fDelRNucleon, fUseOset, fAltOset, fXsecNNCorr, fINukeMode);
+  // hadrons without mean free path computation (L = 0)
+  const utils::intranuke2018::INukeHadronInfo * hadron = 
+                                     utils::intranuke2018::HadronInfo(pdgc);
+  double L = 0;
+  if(hadron) {
+    L = (fUseMFPTable) ?
+      utils::intranuke2018::MeanFreePathTab(*hadron, *p->X4(), *p->P4(), fRemnA,
+						fRemnZ, fDelRPion, fDelRNucleon, fUseOset, fAltOset, fXsecNNCorr, fMode) :
+      utils::intranuke2018::MeanFreePath(*hadron, *p->X4(), *p->P4(), fRemnA,
+						fRemnZ, fDelRPion, fDelRNucleon, fUseOset, fAltOset, fXsecNNCorr, fMode);
+  }
 
-  LOG("Intranuke2018", pDEBUG)    << "mode= " << fINukeModeGen;
-  if(fINukeModeGen == "hA") L *= scale;
+  LOG("Intranuke2018", pDEBUG)    << "mode= " << INukeMode::AsString(fMode);
+  L *= this->MFPScale(pdgc);
+  fStepMFP = L;
 
   double d = -1.*L * TMath::Log(rnd->RndFsi().Rndm());
 
   /*    LOG("Intranuke2018", pDEBUG)
-    << "mode= " << fINukeMode << "; Mean free path = " << L << " fm / "
+    << "mode= " << INukeMode::AsString(fMode) << "; Mean free path = " << L << " fm / "
                               << "Generated path length = " << d << " fm";
   */
   return d;
 }
 //___________________________________________________________________________
+double Intranuke2018::MFPScale(int pdgc) const
+{
+// Tweaking factor of the mean free path (hA mode only)
+
+  if(fMode != kIMdHA) return 1.;
+
+  if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
+    return fPionMFPScale;
+  }
+  else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
+    return fNucleonMFPScale;
+  }
+  return 1.;
+}
+//___________________________________________________________________________
 void Intranuke2018::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
   this->LoadConfig();
+  this->ResolveINukeMode();
 }
 //___________________________________________________________________________
 void Intranuke2018::Configure(string param_set)
 {
   Algorithm::Configure(param_set);
   this->LoadConfig();
+  this->ResolveINukeMode();
+}
+//___________________________________________________________________________
+void Intranuke2018::ResolveINukeMode(void)
+{
+// Resolve the mode of the concrete INTRANUKE class once, so that the
+// transport does not compare mode strings
+
+  string mode = this->GetINukeMode();
+  if      (mode == "hN2018") fMode = kIMdHN;
+  else if (mode == "hA2018") fMode = kIMdHA;
+  else                       fMode = kIMdUndefined;
 }
 //___________________________________________________________________________
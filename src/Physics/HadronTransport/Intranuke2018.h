@@ -30,6 +30,8 @@
 #ifndef _INTRANUKE_2018_H_
 #define _INTRANUKE_2018_H_
 
+#include <vector>
+
 #include <TGenPhaseSpace.h>
 
 #include "Physics/NuclearState/NuclearModelI.h"
@@ -50,6 +52,13 @@ class INukeHadroData2018;
 class PDGCodeList;
 class HNIntranuke2018;
 class HAIntranuke2018;
+struct Intranuke2018EventMutex;
+
+namespace utils {
+namespace intranuke2018 {
+  struct INukeHadronInfo;
+}
+}
 
 class Intranuke2018 : public EventRecordVisitorI {
 
@@ -64,6 +73,15 @@ public :
   // implement the EventRecordVisitorI interface 
   virtual void ProcessEventRecord(GHepRecord * event_rec) const;
 
+  // experimental batch mode: the same as ProcessEventRecord() for each of the
+  // n input events, with the hadrons of all the events stepped in lockstep
+  // (one hadron of each event at a time, so that each event sees the same 
+  // remnant nucleus as in ProcessEventRecord()) and only the hadronic final 
+  // states simulated one hadron at a time. The events are expected to have
+  // the same nuclear target as the first one; the other events are processed
+  // with ProcessEventRecord() once the batch is done.
+  virtual void ProcessEventRecords(GHepRecord * const * event_recs, int n) const;
+
   // override the Algorithm::Configure methods to load configuration
   // data to protected data members
   virtual void Configure (const Registry & config);
@@ -78,19 +96,99 @@ protected:
   virtual void LoadConfig (void)=0;
 
   // general methods for the cascade mc structure
+  bool   PrepareEvent       (GHepRecord * ev) const;
   void   TransportHadrons   (GHepRecord * ev) const;
+  int    StartTransport     (GHepRecord * ev) const;
+  bool   StartHadron        (GHepRecord * ev, int icurr, GHepParticle * sp) const;
+  void   FinishHadron       (GHepRecord * ev, int icurr, GHepParticle * sp, 
+                             bool has_interacted, int nsteps, double tau) const;
+  void   FinishTransport    (GHepRecord * ev, int inucl) const;
   void   GenerateVertex     (GHepRecord * ev) const;
   bool   NeedsRescattering  (const GHepParticle* p) const;
   bool   CanRescatter       (const GHepParticle* p) const;
   bool   IsInNucleus        (const GHepParticle* p) const;
   void   SetTrackingRadius  (const GHepParticle* p) const;
   double GenerateStep       (GHepRecord* ev, GHepParticle* p) const;
+  double MFPScale           (int pdgc) const;
+  void   ResolveINukeMode   (void);
 
   // virtual functions for individual modes
   virtual void SimulateHadronicFinalState(GHepRecord* ev, GHepParticle* p) const = 0;
   virtual int HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int mom) const = 0;
 
+  // Hadrons leaving the nucleus, kept in a compact stack (one array per
+  // field) during the cascade and written into the event record, with their
+  // status & mother/daughter indices, once at the end of the cascade
+  struct CascadeStack {
+    void Clear (void);
+    void Push  (const GHepParticle & p);
+    void Write (GHepRecord * ev) const;
+    void Swap  (CascadeStack & stack);
+    int  Size  (void) const { return pdg.size(); }
+
+    std::vector<int>    pdg;
+    std::vector<int>    status;
+    std::vector<int>    rescatter;
+    std::vector<int>    mother;     ///< first, last mother of each hadron
+    std::vector<int>    daughter;   ///< first, last daughter of each hadron
+    std::vector<double> p4;         ///< px, py, pz, E of each hadron
+    std::vector<double> x4;         ///< x, y, z, t of each hadron
+    std::vector<double> polz;       ///< polarization polar, azimuthal angles
+    std::vector<double> removal;    ///< removal energy (< 0 if not bound)
+  };
+
+  // Transport state of an event of a batch (see ProcessEventRecords()),
+  // swapped with the corresponding data members while the event is handled
+  struct EventState {
+    GHepRecord *   event;
+    bool           done;       ///< all the event hadrons were transported
+    int            inucl;      ///< position of the nucleus in the event
+    int            icurr;      ///< next event entry to look at
+    int            remnA;
+    int            remnZ;
+    TLorentzVector remnP4;
+    GEvGenMode_t   gmode;
+    CascadeStack   stack;
+  };
+  void SwapEventState (EventState & state) const;
+
+  // Hadrons stepped in lockstep in the batch mode, one entry per hadron in
+  // each array. Hadrons done stepping are swapped at the end of the arrays.
+  struct TransportBatch {
+    void Clear (void);
+    void Push  (const GHepParticle & p, int lane, 
+                const utils::intranuke2018::INukeHadronInfo * hadron, 
+                double mfp_scale, double A, double Z);
+    void Swap  (int i, int j);
+    int  Size  (void) const { return lane.size(); }
+
+    std::vector<int>    lane;        ///< index of the hadron in the batch
+    std::vector<const utils::intranuke2018::INukeHadronInfo *> hadron;
+    std::vector<double> mfp_scale;   ///< mean free path scale (hA mode tweaks)
+    std::vector<double> A, Z;        ///< remnant nucleus A, Z
+    std::vector<double> x, y, z, t;  ///< position (fm)
+    std::vector<double> ux, uy, uz;  ///< direction
+    std::vector<double> px, py, pz, E; ///< 4-momentum (GeV)
+    std::vector<double> mfp;         ///< mean free path at the last step (fm)
+    std::vector<double> tau;         ///< integral of dl / (mean free path)
+    std::vector<int>    nsteps;
+    std::vector<char>   interacted;
+  };
+  void StepHadrons (TransportBatch & batch) const;
+
+  // Serialises the events of an instance shared by several event generation
+  // threads (the cascade state below is per event): set up by each entry
+  // point of the INTRANUKE modes, it can be nested
+  class EventLock {
+  public:
+    EventLock (const Intranuke2018 * inuke);
+   ~EventLock ();
+  private:
+    const Intranuke2018 * fINuke;
+  };
+
   // utility objects & params
+  mutable CascadeStack   fCascadeStack;  ///< hadrons leaving the nucleus in the current event
   mutable double         fTrackingRadius;///< tracking radius for the nucleus in the current event
   mutable TGenPhaseSpace fGenPhaseSpace; ///< a phase space generator
   INukeHadroData2018 *       fHadroData2018;     ///< a collection of h+N,h+A data & calculations
@@ -100,6 +198,9 @@ protected:
   mutable int            fRemnZ;         ///< remnant nucleus Z
   mutable TLorentzVector fRemnP4;        ///< P4 of remnant system
   mutable GEvGenMode_t   fGMode;         ///< event generation mode (lepton+A, hadron+A, ...)
+  mutable double         fStepMFP;       ///< mean free path of the last generated step (fm)
+  INukeMode_t            fMode;          ///< INTRANUKE mode (resolved from GetINukeMode() at configuration)
+  Intranuke2018EventMutex * fEventMutex; ///< per-event state lock (see EventLock)
 
   // configuration parameters
   double       fR0;           ///< effective nuclear size param
@@ -119,6 +220,7 @@ protected:
   bool         fUseOset;      ///< Oset model for low energy pion in hN
   bool         fAltOset;      ///< NuWro's table-based implementation (not recommended)
   bool         fXsecNNCorr;   ///< use nuclear medium correction for NN cross section
+  bool         fUseMFPTable;  ///< interpolate the mean free paths in (r, KE) tables? (see utils::intranuke2018::MeanFreePathTab)
 
   double       fPionMFPScale;       ///< tweaking factors for tuning
   double       fPionFracCExScale;
@@ -21,8 +21,6 @@
 #endif
 #include <TPythia6.h>
 #include <TVector3.h>
-#include <TF1.h>
-#include <TROOT.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Constants.h"
@@ -31,6 +29,7 @@
 #include "Physics/Hadronization/FragmentationFunctionI.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -47,6 +46,12 @@ using namespace genie::controls;
 extern "C" void py1ent_(int *,  int *, double *, double *, double *);
 extern "C" void py2ent_(int *,  int *, int *, double *);
 
+namespace {
+  // charm hadron pT^2 pdf: exp(-0.213362-6.62464*pT^2), for pT^2 < 0.6 GeV^2
+  const double kCharmPT2Slope = 6.62464;
+  const double kCharmPT2Max   = 0.6;
+}
+
 //____________________________________________________________________________
 CharmHadronization::CharmHadronization() :
 HadronizationModelI("genie::CharmHadronization")
@@ -62,9 +67,6 @@ HadronizationModelI("genie::CharmHadronization", config)
 //____________________________________________________________________________
 CharmHadronization::~CharmHadronization()
 {
-  delete fCharmPT2pdf;
-  fCharmPT2pdf = 0;
-
   delete fD0FracSpl;
   fD0FracSpl = 0;
 
@@ -85,6 +87,9 @@ TClonesArray * CharmHadronization::Hadronize(
 {
   LOG("CharmHad", pNOTICE) << "** Running CHARM hadronizer";
 
+  // PYTHIA6 and the phase space generator (gRandom) are used throughout
+  ProcessGeneratorLock lock;
+
   PDGLibrary * pdglib = PDGLibrary::Instance();
   RandomGen *  rnd    = RandomGen::Instance();
   
@@ -131,7 +136,7 @@ TClonesArray * CharmHadronization::Hadronize(
 
      // Generate a charmed hadron PDG code
      int    pdg = this->GenerateCharmHadron(nu_pdg,Ev); // generate hadron
-     double mc  = pdglib->Find(pdg)->Mass();           // lookup mass
+     double mc  = pdglib->Mass(pdg);           // lookup mass
      
      LOG("CharmHad", pNOTICE) 
          << "Trying charm hadron = " << pdg << "(m = " << mc << ")";
@@ -153,7 +158,9 @@ TClonesArray * CharmHadronization::Hadronize(
 
      // Generate the charm hadron pT^2 and pL^2 (with respect to the
      // hadronic system direction @ the LAB)
-     double ptc2 = fCharmPT2pdf->GetRandom();   
+     // (the truncated exponential pdf is sampled by inverting its cdf)
+     double ptc2 = -TMath::Log(1. - rnd->RndHadro().Rndm() * 
+                               fCharmPT2CDFMax) / kCharmPT2Slope;
      double plc2 = Ec2 - ptc2 - mc2;
      LOG("CharmHad", pINFO) 
            << "Trying charm hadron pT^2 (tranv to pHad) = " << ptc2;
@@ -215,7 +222,7 @@ TClonesArray * CharmHadronization::Hadronize(
          << "Trying an alternative strategy";
 
      double qfsl  = interaction->FSPrimLepton()->Charge() / 3.;
-     double qinit = pdglib->Find(nuc_pdg)->Charge() / 3.;
+     double qinit = pdglib->Charge(nuc_pdg) / 3.;
      int qhad  = (int) (qinit - qfsl);
 
      int remn_pdg = -1; 
@@ -237,8 +244,8 @@ TClonesArray * CharmHadronization::Hadronize(
          chrm_pdg = kPdgDM; remn_pdg = kPdgNeutron; 
      } 
 
-     double mc  = pdglib->Find(chrm_pdg)->Mass();           
-     double mn  = pdglib->Find(remn_pdg)->Mass();          
+     double mc  = pdglib->Mass(chrm_pdg);           
+     double mn  = pdglib->Mass(remn_pdg);          
 
      if(mc+mn < W) {
         // Set decay
@@ -301,7 +308,7 @@ TClonesArray * CharmHadronization::Hadronize(
 
   TLorentzVector p4R = p4H - p4C;
   double WR = p4R.M();
-  double MC = pdglib->Find(ch_pdg)->Mass();
+  double MC = pdglib->Mass(ch_pdg);
 
   LOG("CharmHad", pNOTICE) << "Remnant hadronic system mass = " << WR;
 
@@ -553,8 +560,8 @@ TClonesArray * CharmHadronization::Hadronize(
      // -1    :  (n pi-)
      //
      double qfsl  = interaction->FSPrimLepton()->Charge() / 3.;
-     double qinit = pdglib->Find(nuc_pdg)->Charge() / 3.;
-     double qch   = pdglib->Find(ch_pdg)->Charge() / 3.;
+     double qinit = pdglib->Charge(nuc_pdg) / 3.;
+     double qch   = pdglib->Charge(ch_pdg) / 3.;
      int Q = (int) (qinit - qfsl - qch); // remnant hadronic system charge
 
      bool allowdup=true;
@@ -577,7 +584,7 @@ TClonesArray * CharmHadronization::Hadronize(
            pd.push_back(kPdgNeutron);  pd.push_back(kPdgPiM);  }
 
      double mass[2] = {
-       pdglib->Find(pd[0])->Mass(), pdglib->Find(pd[1])->Mass()
+       pdglib->Mass(pd[0]), pdglib->Mass(pd[1])
      };
 
      // Set the decay
@@ -705,9 +712,8 @@ void CharmHadronization::LoadConfig(void)
     this->SubAlg("FragmentationFunc"));
   assert(fFragmFunc);
 
-  fCharmPT2pdf = new TF1("fCharmPT2pdf", "exp(-0.213362-6.62464*x)",0,0.6);
-  // stop ROOT from deleting this object of its own volition
-  gROOT->GetListOfFunctions()->Remove(fCharmPT2pdf);
+  // unnormalized cdf of the charm hadron pT^2 pdf at its end point
+  fCharmPT2CDFMax = 1. - TMath::Exp(-kCharmPT2Slope * kCharmPT2Max);
 
   // neutrino charm fractions: D^0, D^+, Ds^+ (remainder: Lamda_c^+)
   //
@@ -28,7 +28,6 @@
 #include "Physics/Hadronization/HadronizationModelI.h"
 
 class TPythia6;
-class TF1;
 
 namespace genie {
 
@@ -66,7 +65,7 @@ private:
   // Configuration parameters
   //
   bool                           fCharmOnly;   ///< don't hadronize non-charm blob
-  TF1 *                          fCharmPT2pdf; ///< charm hadron pT^2 pdf
+  double                         fCharmPT2CDFMax; ///< 1-exp(-b pT2max) of the charm hadron pT^2 pdf exp(a-b pT2)
   const FragmentationFunctionI * fFragmFunc;   ///< charm hadron fragmentation func
   Spline *                       fD0FracSpl;   ///< nu charm fraction vs Ev: D0
   Spline *                       fDpFracSpl;   ///< nu charm fraction vs Ev: D+
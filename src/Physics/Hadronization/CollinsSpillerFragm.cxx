@@ -10,10 +10,18 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   GenerateZ() inverts a cumulative distribution tabulated when the function
+   is built, instead of TF1::GetRandom(). BuildFunction() deletes the 
+   function of the previous configuration.
 
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
 #include "Physics/Hadronization/CollinsSpillerFragm.h"
 #include "Physics/Hadronization/FragmentationFunctions.h"
 
@@ -21,13 +29,15 @@ using namespace genie;
 
 //___________________________________________________________________________
 CollinsSpillerFragm::CollinsSpillerFragm() :
-FragmentationFunctionI("genie::CollinsSpillerFragm")
+FragmentationFunctionI("genie::CollinsSpillerFragm"),
+fFunc(0)
 {
 
 }
 //___________________________________________________________________________
 CollinsSpillerFragm::CollinsSpillerFragm(string config) :
-FragmentationFunctionI("genie::CollinsSpillerFragm", config)
+FragmentationFunctionI("genie::CollinsSpillerFragm", config),
+fFunc(0)
 {
 
 }
@@ -49,7 +59,8 @@ double CollinsSpillerFragm::GenerateZ(void) const
 {
 // Return a random number using the fragmentation function as PDF
 
-  return fFunc->GetRandom();
+  RandomGen * rnd = RandomGen::Instance();
+  return fZTable.Sample( rnd->RndHadro().Rndm() );
 }
 //___________________________________________________________________________
 void CollinsSpillerFragm::Configure(const Registry & config)
@@ -66,6 +77,7 @@ void CollinsSpillerFragm::Configure(string config)
 //___________________________________________________________________________
 void CollinsSpillerFragm::BuildFunction(void)
 {
+  delete fFunc;
   fFunc = new TF1("fFunc",genie::utils::frgmfunc::collins_spiller_func,0,1,2);
 
   fFunc->SetParNames("Norm","Epsilon");
@@ -86,6 +98,13 @@ void CollinsSpillerFragm::BuildFunction(void)
     N = 1./I;
   } 
   fFunc->SetParameters(N,e);
+
+  bool ok = utils::frgmfunc::BuildInverseCDF(fFunc, fZTable);
+  if(!ok) {
+    LOG("CollinsSpillerFragm", pFATAL) 
+      << "Cannot tabulate the fragmentation function (epsilon = " << e << ")";
+    exit(1);
+  }
 }
 //___________________________________________________________________________
 
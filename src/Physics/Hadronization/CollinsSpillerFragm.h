@@ -24,6 +24,7 @@
 
 #include <TF1.h>
 
+#include "Framework/Numerical/InverseCDF.h"
 #include "Physics/Hadronization/FragmentationFunctionI.h"
 
 namespace genie {
@@ -46,7 +47,8 @@ public:
 
 private:
   void BuildFunction (void);
-  TF1 * fFunc;
+  TF1 *      fFunc;
+  InverseCDF fZTable;  ///< inverse cumulative distribution of fFunc, sampled by GenerateZ()
 };
 
 }      // genie namespace
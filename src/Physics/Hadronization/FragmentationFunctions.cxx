@@ -15,7 +15,11 @@
 //____________________________________________________________________________
 
 #include <cmath>
+#include <vector>
 
+#include <TF1.h>
+
+#include "Framework/Numerical/InverseCDF.h"
 #include "Physics/Hadronization/FragmentationFunctions.h"
 
 //___________________________________________________________________________
@@ -43,4 +47,21 @@ double genie::utils::frgmfunc::peterson_func(double* x, double* par)
   return D;
 }
 //___________________________________________________________________________
+bool genie::utils::frgmfunc::BuildInverseCDF(
+                          const TF1 * func, InverseCDF & table, int nz)
+{
+// Nodes at z = 1-(1-t)^2 for equidistant t: the node spacing near z = 1-d
+// is ~2 sqrt(d)/nz, which resolves the peak of the Peterson function down
+// to values of epsilon well below the charm ones
 
+  std::vector<double> z  (nz);
+  std::vector<double> pdf(nz);
+  for(int i = 0; i < nz; i++) {
+    double t = double(i)/(nz-1);
+    z[i] = 1. - (1.-t)*(1.-t);
+    bool edge = (i == 0 || i == nz-1);
+    pdf[i] = (edge) ? 0. : func->Eval(z[i]);
+  }
+  return table.Build(z, pdf);
+}
+//___________________________________________________________________________
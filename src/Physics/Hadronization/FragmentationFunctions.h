@@ -19,7 +19,12 @@
 #ifndef _FRAGMENTATION_FUNCTIONS_H_
 #define _FRAGMENTATION_FUNCTIONS_H_
 
+class TF1;
+
 namespace genie    {
+
+class InverseCDF;
+
 namespace utils    {
 namespace frgmfunc {
 
@@ -35,6 +40,15 @@ namespace frgmfunc {
 */
   double peterson_func(double * x, double * par);
 
+/*!
+  \fn    bool BuildInverseCDF(const TF1 * func, InverseCDF & table, int nz)
+  \brief Tabulates the inverse cumulative distribution of the fragmentation
+         function func in z = (0,1), on nz nodes getting denser towards z = 1,
+         where the heavy quark fragmentation functions peak. The function
+         vanishes at z = 0 and z = 1.
+*/
+  bool BuildInverseCDF(const TF1 * func, InverseCDF & table, int nz = 2001);
+
 } // frgmfunc namespace
 } // utils    namespace
 } // genie    namespace
@@ -10,6 +10,8 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added LastHadronizer().
 
 */
 //____________________________________________________________________________
@@ -47,6 +49,11 @@ HadronizationModelI::~HadronizationModelI()
 
 }
 //____________________________________________________________________________
+const HadronizationModelI * HadronizationModelI::LastHadronizer(void) const
+{
+  return this;
+}
+//____________________________________________________________________________
 
 
 
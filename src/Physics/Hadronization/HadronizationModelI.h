@@ -45,6 +45,10 @@ public:
   virtual PDGCodeList *  SelectParticles  (const Interaction*)                   const = 0;
   virtual TH1D *         MultiplicityProb (const Interaction*, Option_t* opt="") const = 0;
 
+  //! the model that produced the particles of the last Hadronize() call:
+  //! itself, unless it delegates to other models (see KNOPythiaHadronization)
+  virtual const HadronizationModelI * LastHadronizer (void) const;
+
 protected:
 
   HadronizationModelI();
@@ -26,6 +26,7 @@
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <atomic>
 
 #include <RVersion.h>
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
@@ -50,6 +51,8 @@
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
+#include "Framework/Numerical/UniformBuffer.h"
 //#include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGCodeList.h"
@@ -63,12 +66,30 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils::print;
 
+namespace {
+  // W bin width of the cached multiplicity distributions
+  const double kMultProbWBinWidth = 0.005; // GeV
+  // size at which the cache of multiplicity distributions is emptied
+  const unsigned int kMaxMultProbCacheSize = 16384;
+
+  // unique configuration ids (see KNOHadronization::Scratch())
+  std::atomic<unsigned long> gKNOConfigIds(0);
+}
+//____________________________________________________________________________
+struct KNOHadronization::Scratch_t {
+  Scratch_t() : weight(1) {}
+  PhaseSpaceDecayer decayer;  ///< a phase space generator (& its max weights)
+  double            weight;   ///< weight for generated event
+  std::map<MultProbKey_t, AliasSampler> multprob; ///< multiplicity distributions (2, 3, ..., maxmult)
+};
+
 //____________________________________________________________________________
 KNOHadronization::KNOHadronization() :
 HadronizationModelBase("genie::KNOHadronization")
 {
   fBaryonXFpdf  = 0;
   fBaryonPT2pdf = 0;
+  fConfigId     = 0;
 //fKNO          = 0;
 }
 //____________________________________________________________________________
@@ -77,6 +98,7 @@ HadronizationModelBase("genie::KNOHadronization", config)
 {
   fBaryonXFpdf  = 0;
   fBaryonPT2pdf = 0;
+  fConfigId     = 0;
 //fKNO          = 0;
 }
 //____________________________________________________________________________
@@ -104,7 +126,7 @@ TClonesArray * KNOHadronization::Hadronize(
      LOG("KNOHad", pWARN) << "Returning a null particle list!";
      return 0;
   }
-  fWeight=1;
+  this->Scratch().weight = 1;
 
   double W = utils::kinematics::W(interaction);
   LOG("KNOHad", pINFO) << "W = " << W << " GeV";
@@ -185,22 +207,23 @@ PDGCodeList * KNOHadronization::SelectParticles(
   int maxQ = this->HadronShowerCharge(interaction);
   LOG("KNOHad", pINFO) << "Hadron Shower Charge = " << maxQ;
 
-   //-- Build the multiplicity probabilities for the input interaction
-  LOG("KNOHad", pDEBUG) << "Building Multiplicity Probability distribution";
+   //-- Get the multiplicity probabilities for the input interaction
+  LOG("KNOHad", pDEBUG) << "Getting Multiplicity Probability distribution";
   LOG("KNOHad", pDEBUG) << *interaction;
   Option_t * opt = "+LowMultSuppr+Renormalize";
-  TH1D * mprob = this->MultiplicityProb(interaction,opt);
+  const AliasSampler * mprob = this->MultiplicitySampler(interaction,opt);
 
   if(!mprob) {
     LOG("KNOHad", pWARN) << "Null multiplicity probability distribution!";
     return 0;
   }
-  if(mprob->Integral("width")<=0) {
+  if(mprob->IsEmpty()) {
     LOG("KNOHad", pWARN) << "Empty multiplicity probability distribution!";
-    delete mprob;
     return 0;
   }
 
+  RandomGen * rnd = RandomGen::Instance();
+
   //----- FIND AN ALLOWED SOLUTION FOR THE HADRONIC FINAL STATE
 
   bool allowed_state=false;
@@ -215,12 +238,11 @@ PDGCodeList * KNOHadronization::SelectParticles(
        LOG("KNOHad", pERROR) 
          << "Couldn't select hadronic shower particles after: " 
          << itry << " attempts!";
-       delete mprob;
        return 0;
     }
 
-    //-- Generate a hadronic multiplicity 
-    mult = TMath::Nint( mprob->GetRandom() );
+    //-- Generate a hadronic multiplicity (the first outcome is mult = 2)
+    mult = 2 + mprob->Sample( rnd->RndHadro().Rndm() );
 
     LOG("KNOHad", pINFO) << "Hadron multiplicity  = " << mult;
 
@@ -245,7 +267,6 @@ PDGCodeList * KNOHadronization::SelectParticles(
       } else {
         LOG("KNOHad", pWARN) 
            << "Generated multiplicity: " << mult << " is too low! Quitting";
-        delete mprob;
         return 0;
       }
     }
@@ -265,7 +286,7 @@ PDGCodeList * KNOHadronization::SelectParticles(
     vector<int>::const_iterator pdg_iter;
     for(pdg_iter = pdgcv->begin(); pdg_iter != pdgcv->end(); ++pdg_iter) {
       int pdgc = *pdg_iter;
-      double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
+      double m = PDGLibrary::Instance()->Mass(pdgc);
 
       msum += m;
       LOG("KNOHad", pDEBUG) << "- PDGC=" << pdgc << ", m=" << m << " GeV";
@@ -289,8 +310,6 @@ PDGCodeList * KNOHadronization::SelectParticles(
 
   } // attempts
 
-  delete mprob;
-
   return pdgcv;
 }
 //____________________________________________________________________________
@@ -407,7 +426,24 @@ TH1D * KNOHadronization::MultiplicityProb(
 //____________________________________________________________________________
 double KNOHadronization::Weight(void) const
 {
-  return fWeight;
+  return this->Scratch().weight;
+}
+//____________________________________________________________________________
+KNOHadronization::Scratch_t & KNOHadronization::Scratch(void) const
+{
+// The state modified while generating an event, for the calling thread and
+// the current configuration. The algorithm is shared by the event generation
+// threads; a new configuration (with a new unique id) gets a new scratch.
+
+  static thread_local std::map<unsigned long, Scratch_t> scratch;
+  static thread_local unsigned long last_id = 0;
+  static thread_local Scratch_t *   last    = 0;
+
+  if(last && last_id == fConfigId) return *last;
+
+  last    = &scratch[fConfigId];
+  last_id = fConfigId;
+  return *last;
 }
 //____________________________________________________________________________
 // methods overloading the default Algorithm interface implementation:
@@ -428,6 +464,10 @@ void KNOHadronization::Configure(string config)
 //____________________________________________________________________________
 void KNOHadronization::LoadConfig(void)
 {
+  // Multiplicity distributions and (reweighted) max decay weights computed
+  // with the previous configuration are not used (see Scratch())
+  fConfigId = ++gKNOConfigIds;
+
   // Force decays of unstable hadronization products?
   GetParamDef( "ForceDecays", fForceDecays, false ) ;
 
@@ -575,6 +615,84 @@ void KNOHadronization::LoadConfig(void)
 
 }
 //____________________________________________________________________________
+bool KNOHadronization::MultProbKey_t::operator< (const MultProbKey_t & k) const
+{
+  if(probe   != k.probe  ) return probe   < k.probe;
+  if(nuc     != k.nuc    ) return nuc     < k.nuc;
+  if(itype   != k.itype  ) return itype   < k.itype;
+  if(opt     != k.opt    ) return opt     < k.opt;
+  if(maxmult != k.maxmult) return maxmult < k.maxmult;
+  if(lowW    != k.lowW   ) return lowW    < k.lowW;
+  return iW < k.iW;
+}
+//____________________________________________________________________________
+const AliasSampler * KNOHadronization::MultiplicitySampler(
+                     const Interaction * interaction, Option_t * opt) const
+{
+// Returns the multiplicity distribution of MultiplicityProb() as an alias
+// table of the multiplicities 2, 3, ... (outcomes 0, 1, ...), or 0 if
+// MultiplicityProb() returns no distribution.
+// The distributions are cached per probe, hit nucleon, interaction type,
+// option and W bin (of width kMultProbWBinWidth). The distribution of a
+// bin is computed at its centre, restricted to the W range where the max
+// multiplicity and the W<Wcut condition are the ones of the input W, so that
+// the support of the distribution and the NeuGEN scaling factors are exact.
+//
+  if(!this->AssertValidity(interaction)) return 0;
+
+  const InitialState & init_state = interaction->InitState();
+  double W = utils::kinematics::W(interaction);
+  string option(opt);
+
+  MultProbKey_t key;
+  key.probe   = init_state.ProbePdg();
+  key.nuc     = init_state.Tgt().HitNucPdg();
+  key.itype   = (int) interaction->ProcInfo().InteractionTypeId();
+  key.opt     = (option.find("+LowMultSuppr") != string::npos ? 1 : 0) |
+                (option.find("+Renormalize")  != string::npos ? 2 : 0);
+  key.maxmult = (int) this->MaxMult(interaction);
+  key.lowW    = (W < fWcut) ? 1 : 0;
+  key.iW      = (int) TMath::Floor(W/kMultProbWBinWidth);
+
+  std::map<MultProbKey_t, AliasSampler> & cache = this->Scratch().multprob;
+  std::map<MultProbKey_t, AliasSampler>::iterator it = cache.find(key);
+  if(it != cache.end()) return &(it->second);
+
+  // W where the distribution of this bin is computed
+  double Wlo  = key.iW * kMultProbWBinWidth;
+  double Whi  = Wlo + kMultProbWBinWidth;
+  double Wmin = kNeutronMass + (key.maxmult-1)*kPionMass;
+  Wlo = TMath::Max(Wlo, Wmin);
+  Whi = TMath::Min(Whi, Wmin + kPionMass);
+  if(key.lowW) Whi = TMath::Min(Whi, fWcut);
+  else         Wlo = TMath::Max(Wlo, fWcut);
+  double Wbin = (Wlo < Whi) ? 0.5*(Wlo+Whi) : W;
+
+  Interaction in(*interaction);
+  in.KinePtr()->SetW(Wbin);
+
+  TH1D * mprob = this->MultiplicityProb(&in, opt);
+  if(!mprob) return 0;
+
+  int nbins = mprob->GetNbinsX();
+  std::vector<double> prob(nbins);
+  for(int i = 0; i < nbins; i++) {
+    prob[i] = mprob->GetBinContent(i+1);
+  }
+  delete mprob;
+
+  LOG("KNOHad", pINFO)
+    << "Caching the multiplicity distribution of " << key.probe << " + " 
+    << key.nuc << " (interaction type " << key.itype << ") at W = " << Wbin 
+    << " GeV (max multiplicity " << key.maxmult << ")";
+
+  if(cache.size() >= kMaxMultProbCacheSize) cache.clear();
+
+  AliasSampler & sampler = cache[key];
+  sampler.Build(prob);
+  return &sampler;
+}
+//____________________________________________________________________________
 double KNOHadronization::KNO(int probe_pdg, int nuc_pdg, double z) const
 {
 // Computes <n>P(n) for the input reduced multiplicity z=n/<n>
@@ -675,7 +793,7 @@ int KNOHadronization::HadronShowerCharge(const Interaction* interaction) const
   assert( pdg::IsProton(hit_nucleon) || pdg::IsNeutron(hit_nucleon) );
 
   // Ask PDGLibrary for the nucleon charge
-  double qnuc = PDGLibrary::Instance()->Find(hit_nucleon)->Charge() / 3.;
+  double qnuc = PDGLibrary::Instance()->Charge(hit_nucleon) / 3.;
 
   // calculate the hadron shower charge
   hadronShowerCharge = (int) ( qp + qnuc - ql );
@@ -722,7 +840,7 @@ TClonesArray * KNOHadronization::DecayMethod2(
 
   // Take the baryon
   int    baryon = pdgv[0]; 
-  double MN     = PDGLibrary::Instance()->Find(baryon)->Mass();
+  double MN     = PDGLibrary::Instance()->Mass(baryon);
   double MN2    = TMath::Power(MN, 2);
 
   // Check baryon code
@@ -738,7 +856,7 @@ TClonesArray * KNOHadronization::DecayMethod2(
   vector<int>::const_iterator pdg_iter = pdgv_strip.begin();
   for( ; pdg_iter != pdgv_strip.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    mass_sum += PDGLibrary::Instance()->Find(pdgc)->Mass();
+    mass_sum += PDGLibrary::Instance()->Mass(pdgc);
   }
 
   // Create the particle list
@@ -760,9 +878,13 @@ TClonesArray * KNOHadronization::DecayMethod2(
 
     while(!got_baryon_4p) {
 
-      //-- generate baryon xF and pT2
-      double xf  = fBaryonXFpdf ->GetRandom();               
-      double pt2 = fBaryonPT2pdf->GetRandom();               
+      //-- generate baryon xF and pT2 (TF1::GetRandom() draws from gRandom)
+      double xf = 0, pt2 = 0;
+      {
+        ProcessGeneratorLock lock;
+        xf  = fBaryonXFpdf ->GetRandom();
+        pt2 = fBaryonPT2pdf->GetRandom();
+      }
 
       //-- generate baryon px,py,pz
       double pt  = TMath::Sqrt(pt2);            
@@ -900,44 +1022,41 @@ bool KNOHadronization::PhaseSpaceDecay(
   assert ( offset      >= 0);
   assert ( pdgv.size() >  1);
 
-  // Get the decay product masses
+  Scratch_t & scratch = this->Scratch();
+  PhaseSpaceDecayer & decayer = scratch.decayer;
 
-  vector<int>::const_iterator pdg_iter;
-  int i = 0;
-  double * mass = new double[pdgv.size()];
-  double   sum  = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    mass[i++] = m;
-    sum += m;
-  }
+  // Set the decay
+  // (the pT2 reweighting depends on the direction of the decaying system)
+  bool permitted = decayer.SetDecay(pd, pdgv, reweight);
+  double sum = decayer.MassSum();
 
   LOG("KNOHad", pINFO)  
     << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
   LOG("KNOHad", pINFO) 
     << "Decaying system p4 = " << utils::print::P4AsString(&pd);
 
-  // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(pd, pdgv.size(), mass);
   if(!permitted) {
      LOG("KNOHad", pERROR) 
        << " *** Phase space decay is not permitted \n"
        << " Total particle mass = " << sum << "\n"
        << " Decaying system p4 = " << utils::print::P4AsString(&pd);
-
-     // clean-up and return
-     delete [] mass;
      return false;
   }
 
-  // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
+  // Get the maximum weight, estimated once per final state and bin of the
+  // decaying system kinematics
   double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     if(reweight) { w *= this->ReWeightPt2(pdgv); }
-     wmax = TMath::Max(wmax,w);
+  if(reweight) {
+    if(!decayer.CachedMaxWeight(wmax)) {
+      for(int idec=0; idec<200; idec++) {
+         double w = decayer.Generate();   
+         w *= this->ReWeightPt2(pdgv);
+         wmax = TMath::Max(wmax,w);
+      }
+      decayer.SetMaxWeight(wmax);
+    }
+  } else {
+    wmax = decayer.MaxWeight(200);
   }
   assert(wmax>0);
 
@@ -946,14 +1065,13 @@ bool KNOHadronization::PhaseSpaceDecay(
 
   // Generate a weighted or unweighted decay
 
-  RandomGen * rnd = RandomGen::Instance();
-
   if(fGenerateWeighted) 
   {
     // *** generating weighted decays ***
-    double w = fPhaseSpaceGenerator.Generate();   
+    double w = decayer.Generate();   
     if(reweight) { w *= this->ReWeightPt2(pdgv); }
-    fWeight *= TMath::Max(w/wmax, 1.);
+    decayer.UpdateMaxWeight(w);
+    scratch.weight *= TMath::Max(w/wmax, 1.);
   }
   else 
   {
@@ -962,6 +1080,8 @@ bool KNOHadronization::PhaseSpaceDecay(
      bool accept_decay=false;
      unsigned int itry=0;
 
+     // RndHadro numbers drawn in blocks
+     UniformBuffer rndhadro(kRndmHadro);
      while(!accept_decay) 
      {
        itry++;
@@ -971,17 +1091,17 @@ bool KNOHadronization::PhaseSpaceDecay(
          LOG("KNOHad", pWARN) 
              << "Couldn't generate an unweighted phase space decay after " 
              << itry << " attempts";
-         delete [] mass;
          return false;
        }
 
-       double w  = fPhaseSpaceGenerator.Generate();   
+       double w  = decayer.Generate();   
        if(reweight) { w *= this->ReWeightPt2(pdgv); }
+       decayer.UpdateMaxWeight(w);
        if(w > wmax) {
           LOG("KNOHad", pWARN) 
            << "Decay weight = " << w << " > max decay weight = " << wmax;
        }
-       double gw = wmax * rnd->RndHadro().Rndm();
+       double gw = wmax * rndhadro.Next();
        accept_decay = (gw<=w);
 
        LOG("KNOHad", pINFO) 
@@ -992,7 +1112,6 @@ bool KNOHadronization::PhaseSpaceDecay(
        if(return_after_not_accepted_decay && !accept_decay) {
            LOG("KNOHad", pWARN) 
              << "Was instructed to return after a not-accepted decay";
-           delete [] mass;
            return false;        
        }
      }
@@ -1000,14 +1119,15 @@ bool KNOHadronization::PhaseSpaceDecay(
 
   // Insert final state products into a TClonesArray of TMCParticles
 
-  i=0;
+  vector<int>::const_iterator pdg_iter;
+  int i=0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
 
      //-- current PDG code
      int pdgc = *pdg_iter;
 
      //-- get the 4-momentum of the i-th final state particle
-     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(i);
+     TLorentzVector * p4fin = decayer.GetDecay(i);
 
      new ( plist[offset+i] ) TMCParticle(
            1,               /* KS Code                          */
@@ -1019,7 +1139,7 @@ bool KNOHadronization::PhaseSpaceDecay(
            p4fin->Py(),     /* 4-momentum: py component         */
            p4fin->Pz(),     /* 4-momentum: pz component         */
            p4fin->Energy(), /* 4-momentum: E  component         */
-           mass[i],         /* particle mass                    */
+           decayer.Mass(i), /* particle mass         */
            0,               /* production vertex 4-vector: vx   */
            0,               /* production vertex 4-vector: vy   */
            0,               /* production vertex 4-vector: vz   */
@@ -1029,9 +1149,6 @@ bool KNOHadronization::PhaseSpaceDecay(
      i++;
   }
 
-  // Clean-up
-  delete [] mass;
-
   return true;
 }
 //____________________________________________________________________________
@@ -1042,6 +1159,8 @@ double KNOHadronization::ReWeightPt2(const PDGCodeList & pdgcv) const
 // See: A.B.Clegg, A.Donnachie, A Description of Jet Structure by pT-limited
 // Phase Space.
 
+  PhaseSpaceDecayer & decayer = this->Scratch().decayer;
+
   double w = 1;
 
   for(unsigned int i = 0; i < pdgcv.size(); i++) {
@@ -1049,7 +1168,7 @@ double KNOHadronization::ReWeightPt2(const PDGCodeList & pdgcv) const
      //int pdgc = pdgcv[i];
      //if(pdgc!=kPdgPiP&&pdgc!=kPdgPiM) continue;
 
-     TLorentzVector * p4 = fPhaseSpaceGenerator.GetDecay(i); 
+     TLorentzVector * p4 = decayer.GetDecay(i); 
      double pt2 = TMath::Power(p4->Px(),2) + TMath::Power(p4->Py(),2);
      double wi  = TMath::Exp(-fPhSpRwA*TMath::Sqrt(pt2));
      //double wi = (9.41 * TMath::Landau(pt2,0.24,0.12));
@@ -1092,7 +1211,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
   if(baryon_chg_is_pos) maxQ -= 1;
   if(baryon_chg_is_neg) maxQ += 1;
   hadrons_to_add--;
-  W -= pdg->Find( (*pdgc)[0] )->Mass();
+  W -= pdg->Mass((*pdgc)[0]);
 
   //
   // Assign remaining hadrons up to n = multiplicity
@@ -1112,7 +1231,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               maxQ -= 1;
               hadrons_to_add--;
-              W -= pdg->Find(kPdgKP)->Mass();
+              W -= pdg->Mass(kPdgKP);
            }
            else if(maxQ == 0) {
               LOG("KNOHad", pDEBUG) << " -> Adding a K0";
@@ -1120,7 +1239,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
     
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               hadrons_to_add--;
-              W -= pdg->Find(kPdgK0)->Mass();
+              W -= pdg->Mass(kPdgK0);
            }
         }
 
@@ -1132,7 +1251,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
            // update n-of-hadrons to add, avail. shower charge & invariant mass
            maxQ -= 1;
            hadrons_to_add--;
-           W -= pdg->Find(kPdgKP)->Mass();
+           W -= pdg->Mass(kPdgKP);
         }
         else if(multiplicity == 3 && maxQ == -1) { //adding K+ makes it impossible to balance charge
            LOG("KNOHad", pDEBUG) << " -> Adding a K0"; 
@@ -1140,7 +1259,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
    
            // update n-of-hadrons to add, avail. shower charge & invariant mass
            hadrons_to_add--;
-           W -= pdg->Find(kPdgK0)->Mass();
+           W -= pdg->Mass(kPdgK0);
         }
 
         //simply conserve strangeness, without regard to charge
@@ -1153,7 +1272,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               maxQ -= 1;
               hadrons_to_add--;
-              W -= pdg->Find(kPdgKP)->Mass();
+              W -= pdg->Mass(kPdgKP);
            }
            else {
               LOG("KNOHad", pDEBUG) <<" -> Adding a K0";
@@ -1161,7 +1280,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
     
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               hadrons_to_add--;
-              W -= pdg->Find(kPdgK0)->Mass();
+              W -= pdg->Mass(kPdgK0);
            } 
         }
   }//if the baryon is strange
@@ -1178,7 +1297,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
         maxQ += 1;
         hadrons_to_add--;
 
-        W -= pdg->Find(kPdgPiM)->Mass();
+        W -= pdg->Mass(kPdgPiM);
 
      } else if (maxQ > 0) {
         // Need more positive charge
@@ -1189,7 +1308,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
         maxQ -= 1;
         hadrons_to_add--;
 
-        W -= pdg->Find(kPdgPiP)->Mass();
+        W -= pdg->Mass(kPdgPiP);
      }
   }
 
@@ -1225,7 +1344,7 @@ PDGCodeList * KNOHadronization::GenerateHadronCodes(
 
         // update n-of-hadrons to add & available invariant mass
         hadrons_to_add--;
-        W -= pdg->Find(kPdgPi0)->Mass();
+        W -= pdg->Mass(kPdgPi0);
      }
 
      // Now add pairs (pi0 pi0 / pi+ pi- / K+ K- / K0 K0bar)
@@ -30,6 +30,12 @@
           Changes required to implement the GENIE Boosted Dark Matter module
           were installed by Josh Berger (Univ. of Wisconsin)
 
+          The multiplicity distributions sampled by SelectParticles() are
+          cached, per probe, hit nucleon, interaction type and W bin, as
+          alias tables (see MultiplicitySampler()). These caches, the phase
+          space generator and the event weight are kept per thread, so that
+          the model can be shared by the event generation threads.
+
 \created  August 17, 2004
 
 \cpright  Copyright (c) 2003-2018, The GENIE Collaboration
@@ -41,8 +47,10 @@
 #ifndef _KNO_HADRONIZATION_H_
 #define _KNO_HADRONIZATION_H_
 
-#include <TGenPhaseSpace.h>
+#include <map>
 
+#include "Framework/Numerical/AliasSampler.h"
+#include "Framework/Utils/PhaseSpaceDecayer.h"
 #include "Physics/Hadronization/HadronizationModelBase.h"
 
 class TF1;
@@ -75,7 +83,20 @@ private:
 
   // private methods & mutable parameters
 
+  // key of the multiplicity distributions cached by MultiplicitySampler()
+  struct MultProbKey_t {
+    int probe;     ///< probe PDG code
+    int nuc;       ///< hit nucleon PDG code
+    int itype;     ///< interaction type (selects the Rijk factors)
+    int opt;       ///< MultiplicityProb() options (bit 0: LowMultSuppr, bit 1: Renormalize)
+    int maxmult;   ///< maximum multiplicity (MaxMult())
+    int lowW;      ///< W < Wcut ?
+    int iW;        ///< W bin
+    bool operator< (const MultProbKey_t & k) const;
+  };
+
   void          LoadConfig            (void);
+  const AliasSampler * MultiplicitySampler (const Interaction * i, Option_t * opt) const;
   bool          AssertValidity        (const Interaction * i)        const;
   PDGCodeList * GenerateHadronCodes   (int mult, int maxQ, double W) const;
   int           GenerateBaryonPdgCode (int mult, int maxQ, double W) const;
@@ -93,8 +114,13 @@ private:
          TClonesArray & pl, TLorentzVector & pd, 
 	   const PDGCodeList & pdgv, int offset=0, bool reweight=false) const;
 
-  mutable TGenPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
-  mutable double         fWeight;              ///< weight for generated event
+  // state modified while generating events (the phase space generator &
+  // its max weights, the event weight, the cached multiplicity
+  // distributions), kept per thread and configuration (see the .cxx)
+  struct Scratch_t;
+  Scratch_t &   Scratch               (void) const;
+
+  unsigned long fConfigId;  ///< unique id of the current configuration
 
   // Configuration parameters
   // Note: additional configuration parameters common to all hadronizers
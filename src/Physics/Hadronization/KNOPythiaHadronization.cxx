@@ -13,6 +13,8 @@
  @ Feb 10, 2011
    Fixed a bug reported by Torben Ferber affecting the KNO -> PYTHIA
    model transition (the order was reversed!)
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Keep the hadronizer selected for the generated event, see LastHadronizer().
 
 */
 //____________________________________________________________________________
@@ -36,13 +38,15 @@ using namespace genie::constants;
 
 //____________________________________________________________________________
 KNOPythiaHadronization::KNOPythiaHadronization() :
-HadronizationModelI("genie::KNOPythiaHadronization")
+HadronizationModelI("genie::KNOPythiaHadronization"),
+fLastHadronizer(0)
 {
 
 }
 //____________________________________________________________________________
 KNOPythiaHadronization::KNOPythiaHadronization(string config) :
-HadronizationModelI("genie::KNOPythiaHadronization", config)
+HadronizationModelI("genie::KNOPythiaHadronization", config),
+fLastHadronizer(0)
 {
 
 }
@@ -74,6 +78,7 @@ TClonesArray * KNOPythiaHadronization::Hadronize(
 
   //-- Init event weight (to be set if producing weighted events)
   fWeight = 1.;
+  fLastHadronizer = 0;
 
   //-- Select hadronizer
   const HadronizationModelI * hadronizer = this->SelectHadronizer(interaction);
@@ -83,6 +88,7 @@ TClonesArray * KNOPythiaHadronization::Hadronize(
 
   //-- Update the weight
   fWeight = hadronizer->Weight();
+  fLastHadronizer = hadronizer;
 
   return particle_list;
 }
@@ -116,6 +122,11 @@ double KNOPythiaHadronization::Weight(void) const
   return fWeight;
 }
 //____________________________________________________________________________
+const HadronizationModelI * KNOPythiaHadronization::LastHadronizer(void) const
+{
+  return (fLastHadronizer) ? fLastHadronizer->LastHadronizer() : this;
+}
+//____________________________________________________________________________
 const HadronizationModelI * KNOPythiaHadronization::SelectHadronizer(
                                         const Interaction * interaction) const
 {
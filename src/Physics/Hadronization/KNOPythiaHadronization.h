@@ -41,6 +41,9 @@ public:
   PDGCodeList *  SelectParticles  (const Interaction*)                   const;
   TH1D *         MultiplicityProb (const Interaction*, Option_t* opt="") const;
 
+  //-- the KNO or PYTHIA/JETSET hadronizer selected by the last Hadronize()
+  const HadronizationModelI * LastHadronizer (void) const;
+
   //-- overload the Algorithm::Configure() methods to load private data
   //   members from configuration options
   void Configure(const Registry & config);
@@ -54,6 +57,7 @@ private:
   const HadronizationModelI * SelectHadronizer(const Interaction *) const;
 
   mutable double fWeight; ///< weight for generated event
+  mutable const HadronizationModelI * fLastHadronizer; ///< hadronizer selected for the generated event
 
   //-- configuration
 
@@ -10,12 +10,20 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   GenerateZ() inverts a cumulative distribution tabulated when the function
+   is built, instead of TF1::GetRandom(). BuildFunction() deletes the 
+   function of the previous configuration.
 
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
+
 #include <TROOT.h>
 
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
 #include "Physics/Hadronization/PetersonFragm.h"
 #include "Physics/Hadronization/FragmentationFunctions.h"
 
@@ -23,13 +31,15 @@ using namespace genie;
 
 //___________________________________________________________________________
 PetersonFragm::PetersonFragm() :
-FragmentationFunctionI("genie::PetersonFragm")
+FragmentationFunctionI("genie::PetersonFragm"),
+fFunc(0)
 {
 
 }
 //___________________________________________________________________________
 PetersonFragm::PetersonFragm(string config) :
-FragmentationFunctionI("genie::PetersonFragm", config)
+FragmentationFunctionI("genie::PetersonFragm", config),
+fFunc(0)
 {
   this->BuildFunction();
 }
@@ -51,7 +61,8 @@ double PetersonFragm::GenerateZ(void) const
 {
 // Return a random number using the fragmentation function as PDF
 
-  return fFunc->GetRandom();
+  RandomGen * rnd = RandomGen::Instance();
+  return fZTable.Sample( rnd->RndHadro().Rndm() );
 }
 //___________________________________________________________________________
 void PetersonFragm::Configure(const Registry & config)
@@ -68,6 +79,7 @@ void PetersonFragm::Configure(string config)
 //___________________________________________________________________________
 void PetersonFragm::BuildFunction(void) 
 {
+  delete fFunc;
   fFunc = new TF1("fFunc",genie::utils::frgmfunc::peterson_func,0,1,2);
 
   fFunc->SetParNames("Norm","Epsilon");
@@ -94,6 +106,13 @@ void PetersonFragm::BuildFunction(void)
     N = 1./I;
   }
   fFunc->SetParameters(N,e);
+
+  bool ok = utils::frgmfunc::BuildInverseCDF(fFunc, fZTable);
+  if(!ok) {
+    LOG("PetersonFragm", pFATAL) 
+      << "Cannot tabulate the fragmentation function (epsilon = " << e << ")";
+    exit(1);
+  }
 }
 //___________________________________________________________________________
 
@@ -30,6 +30,7 @@
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -39,6 +40,16 @@
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // particles whose PYTHIA decay flag is forced during the fragmentation
+  // and the forced flags (don't decay pi0, K0, Lambda0, decay Delta's)
+  const int kDecFlagPdg[] = { 
+     kPdgPi0, kPdgK0, kPdgAntiK0, kPdgLambda, kPdgAntiLambda,
+     kPdgP33m1232_DeltaM,  kPdgP33m1232_Delta0, 
+     kPdgP33m1232_DeltaP,  kPdgP33m1232_DeltaPP };
+  const int kDecFlagVal[] = { 0, 0, 0, 0, 0, 1, 1, 1, 1 };
+}
+
 // the actual PYTHIA call
 extern "C" void py2ent_(int *,  int *, int *, double *);
 
@@ -64,21 +75,21 @@ void PythiaHadronization::Initialize(void) const
 {
   fPythia = TPythia6::Instance();
 
+  // PYTHIA compressed codes of the particles with forced decay flags
+  for(int k = 0; k < kNDecFlags; k++) {
+    fDecFlagKC[k] = fPythia->Pycomp(kDecFlagPdg[k]);
+  }
+
   // sync GENIE/PYTHIA6 seed number
   RandomGen::Instance();
 }
 //____________________________________________________________________________
-TClonesArray * 
-  PythiaHadronization::Hadronize(
-         const Interaction * interaction) const
+bool PythiaHadronization::Fragment(const Interaction * interaction) const
 {
-  LOG("PythiaHad", pNOTICE) << "Running PYTHIA hadronizer";
-
-  if(!this->AssertValidity(interaction)) {
-     LOG("PythiaHad", pERROR) << "Returning a null particle list!";
-     return 0;
-  }
-
+// Sets up the quark system (q + qq) initiating the hadronization of the 
+// input interaction and fragments it with PY2ENT. On success, the generated
+// particles are left in the PYJETS common block.
+//
   // get kinematics / init-state / process-info
 
   const Kinematics &   kinematics = interaction->Kine();
@@ -141,7 +152,7 @@ TClonesArray *
     else {
       LOG("PythiaHad", pERROR)
         << "Not allowed mode. Refused to make a final quark assignment!";
-      return 0;
+      return false;
     }
   }//CC
 
@@ -225,94 +236,96 @@ TClonesArray *
         << "q = " << final_quark << ", qq = " << diquark;
   int ip = 0;
 
-  // Determine how jetset treats un-stable particles appearing in hadronization
-
-  int pi0_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgPi0),              1); 
-  int K0_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgK0),               1); 
-  int K0b_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgAntiK0),           1); 
-  int L0_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgLambda),           1); 
-  int L0b_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgAntiLambda),       1);
-  int Dm_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),  1); 
-  int D0_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),  1); 
-  int Dp_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),  1); 
-  int Dpp_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP), 1); 
+  // Set how jetset treats un-stable particles appearing in hadronization.
+  // The PYTHIA decay settings are shared with the decayer, so the original
+  // flags are restored after the fragmentation. Only the flags differing
+  // from the ones needed here are switched.
 
+  int decflag[kNDecFlags];
+  for(int k = 0; k < kNDecFlags; k++) {
+    decflag[k] = fPythia->GetMDCY(fDecFlagKC[k], 1);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for pi0           =  " << pi0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for K0            =  " << K0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for \bar{K0}      =  " << K0b_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for Lambda        =  " << L0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for \bar{Lambda0} =  " << L0b_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D-            =  " << Dm_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D0            =  " << D0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D+            =  " << Dp_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D++           =  " << Dpp_decflag;
+    LOG("PythiaHad", pDEBUG) 
+      << "Original decay flag for " << kDecFlagPdg[k] << " = " << decflag[k];
 #endif
-
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgPi0),               1,0); // don't decay pi0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgK0),                1,0); // don't decay K0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiK0),            1,0); // don't decay \bar{K0}
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgLambda),            1,0); // don't decay Lambda0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiLambda),        1,0); // don't decay \bar{Lambda0}
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),   1,1); // decay Delta-
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),   1,1); // decay Delta0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),   1,1); // decay Delta+
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP),  1,1); // decay Delta++
+    if(decflag[k] != kDecFlagVal[k]) {
+      fPythia->SetMDCY(fDecFlagKC[k], 1, kDecFlagVal[k]);
+    }
+  }
 
   // -- hadronize --
   py2ent_(&ip, &final_quark, &diquark, &W); // hadronizer
 
   // restore pythia decay settings so as not to interfere with decayer 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgPi0),              1, pi0_decflag);
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgK0),               1, K0_decflag);
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiK0),           1, K0b_decflag);
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgLambda),           1, L0_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiLambda),       1, L0b_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),  1, Dm_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),  1, D0_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),  1, Dp_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP), 1, Dpp_decflag); 
-
-  // get LUJETS record
-  fPythia->GetPrimaries();
-  TClonesArray * pythia_particles =
-       (TClonesArray *) fPythia->ImportParticles("All");
-
-  // copy PYTHIA container to a new TClonesArray so as to transfer ownership
-  // of the container and of its elements to the calling method
+  for(int k = 0; k < kNDecFlags; k++) {
+    if(decflag[k] != kDecFlagVal[k]) {
+      fPythia->SetMDCY(fDecFlagKC[k], 1, decflag[k]);
+    }
+  }
 
-  int np = pythia_particles->GetEntries();
+  // check the LUJETS record
+  int np = fPythia->GetN();
   assert(np>0);
-  TClonesArray * particle_list = new TClonesArray("TMCParticle", np);
-  particle_list->SetOwner(true);
-
-  unsigned int i = 0;
-  TMCParticle * particle = 0;
-  TIter particle_iter(pythia_particles);
-
-  while( (particle = (TMCParticle *) particle_iter.Next()) ) {
-     LOG("PythiaHad", pDEBUG)
-          << "Adding final state particle pdgc = " << particle->GetKF() 
-          << " with status = " << particle->GetKS();
-
-     if(particle->GetKS() == 1) {
-        if( pdg::IsQuark  (particle->GetKF()) || 
-            pdg::IsDiQuark(particle->GetKF()) ) {
-                LOG("PythiaHad", pERROR)
-                  << "Hadronization failed! Bare quark/di-quarks appear in final state!";
-            particle_list->Delete();
-            delete particle_list;
-            return 0;            
+  for(int i = 1; i <= np; i++) {
+     int kf = fPythia->GetK(i,2);
+     if(fPythia->GetK(i,1) == 1) {
+        if( pdg::IsQuark(kf) || pdg::IsDiQuark(kf) ) {
+            LOG("PythiaHad", pERROR)
+              << "Hadronization failed! Bare quark/di-quarks appear in final state!";
+            return false;
         }
      }
+  }
+  return true;
+}
+//____________________________________________________________________________
+TClonesArray * 
+  PythiaHadronization::Hadronize(
+         const Interaction * interaction) const
+{
+  LOG("PythiaHad", pNOTICE) << "Running PYTHIA hadronizer";
+
+  if(!this->AssertValidity(interaction)) {
+     LOG("PythiaHad", pERROR) << "Returning a null particle list!";
+     return 0;
+  }
+
+  // fragment & read back the LUJETS record under the PYTHIA6 lock
+  ProcessGeneratorLock lock;
 
-     // fix numbering scheme used for mother/daughter assignments
-     particle->SetParent     (particle->GetParent()     - 1);
-     particle->SetFirstChild (particle->GetFirstChild() - 1);
-     particle->SetLastChild  (particle->GetLastChild()  - 1);
+  if(!this->Fragment(interaction)) return 0;
 
-     // insert the particle in the list
-     new ( (*particle_list)[i++] ) TMCParticle(*particle);
+  // copy the LUJETS record to a new TClonesArray so as to transfer ownership
+  // of the container and of its elements to the calling method
+
+  int np = fPythia->GetN();
+  TClonesArray * particle_list = new TClonesArray("TMCParticle", np);
+  particle_list->SetOwner(true);
+
+  for(int i = 1; i <= np; i++) {
+     LOG("PythiaHad", pDEBUG)
+          << "Adding final state particle pdgc = " << fPythia->GetK(i,2)
+          << " with status = " << fPythia->GetK(i,1);
+
+     // insert the particle in the list, fixing the numbering scheme used 
+     // for mother/daughter assignments
+     new ( (*particle_list)[i-1] ) TMCParticle(
+          fPythia->GetK(i,1),      /* KS Code                          */
+          fPythia->GetK(i,2),      /* PDG Code                         */
+          fPythia->GetK(i,3) - 1,  /* parent particle                  */
+          fPythia->GetK(i,4) - 1,  /* first child particle             */
+          fPythia->GetK(i,5) - 1,  /* last child particle              */
+          fPythia->GetP(i,1),      /* 4-momentum: px component         */
+          fPythia->GetP(i,2),      /* 4-momentum: py component         */
+          fPythia->GetP(i,3),      /* 4-momentum: pz component         */
+          fPythia->GetP(i,4),      /* 4-momentum: E  component         */
+          fPythia->GetP(i,5),      /* particle mass                    */
+          fPythia->GetV(i,1),      /* production vertex 4-vector: vx   */
+          fPythia->GetV(i,2),      /* production vertex 4-vector: vy   */
+          fPythia->GetV(i,3),      /* production vertex 4-vector: vz   */
+          fPythia->GetV(i,4),      /* production vertex 4-vector: time */
+          fPythia->GetV(i,5)       /* particle lifetime                */
+     );
   }
 
   utils::fragmrec::Print(particle_list);
@@ -327,24 +340,24 @@ PDGCodeList *
 // Rather than having this method as one of the hadronization model components,
 // we extract the list of particles from the fragmentation record after the
 // hadronization has been completed.
+// The particles are read directly from the LUJETS record.
 
-  TClonesArray * particle_list = this->Hadronize(interaction);
+  if(!this->AssertValidity(interaction)) {
+     LOG("PythiaHad", pERROR) << "Returning a null particle list!";
+     return 0;
+  }
+  ProcessGeneratorLock lock;
+  if(!this->Fragment(interaction)) return 0;
 
-  if(!particle_list) return 0;
+  int np = fPythia->GetN();
 
   bool allowdup=true;
   PDGCodeList * pdgcv = new PDGCodeList(allowdup);
-  pdgcv->reserve(particle_list->GetEntries());
+  pdgcv->reserve(np);
 
-  TMCParticle * particle = 0;
-  TIter particle_iter(particle_list);
-
-  while ((particle = (TMCParticle *) particle_iter.Next())) 
-  {
-    if (particle->GetKS()==1) pdgcv->push_back(particle->GetKF());
+  for(int i = 1; i <= np; i++) {
+    if (fPythia->GetK(i,1)==1) pdgcv->push_back(fPythia->GetK(i,2));
   }
-  particle_list->Delete();
-  delete particle_list;
 
   return pdgcv;
 }
@@ -363,23 +376,21 @@ TH1D * PythiaHadronization::MultiplicityProb(
   TH1D * mult_prob = this->CreateMultProbHist(maxmult);
 
   const int nev=500;
-  TMCParticle * particle = 0;
+
+  ProcessGeneratorLock lock;
 
   for(int iev=0; iev<nev; iev++) {
 
-     TClonesArray * particle_list = this->Hadronize(interaction);
-     double         weight        = this->Weight();
+     bool   ok     = this->Fragment(interaction);
+     double weight = this->Weight();
 
-     if(!particle_list) { iev--; continue; }
+     if(!ok) { iev--; continue; }
 
-     int n = 0;
-     TIter particle_iter(particle_list);
-     while ((particle = (TMCParticle *) particle_iter.Next())) 
-     {
-       if (particle->GetKS()==1) n++;
-     }   
-     particle_list->Delete();
-     delete particle_list;
+     int n  = 0;
+     int np = fPythia->GetN();
+     for(int i = 1; i <= np; i++) {
+       if (fPythia->GetK(i,1)==1) n++;
+     }
      mult_prob->Fill( (double)n, weight);
   }
 
@@ -50,12 +50,16 @@ private:
 
   void LoadConfig     (void);
   bool AssertValidity (const Interaction * i) const;
+  bool Fragment       (const Interaction * i) const;
 /*
   void SwitchDecays   (int pdgc, bool on_off) const;
   void HandleDecays   (TClonesArray * plist) const;
 */
   mutable TPythia6 * fPythia;   ///< PYTHIA6 wrapper class
 
+  static const int kNDecFlags = 9;
+  mutable int fDecFlagKC[kNDecFlags]; ///< compressed codes of the particles with forced decay flags
+
   const DecayModelI * fDecayer;
 
   //-- configuration parameters
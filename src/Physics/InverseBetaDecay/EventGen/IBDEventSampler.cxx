@@ -0,0 +1,440 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <TH1D.h>
+#include <TMath.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/InverseCDF.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Utils/KineUtils.h"
+#include "Physics/InverseBetaDecay/EventGen/IBDEventSampler.h"
+
+using std::string;
+using std::vector;
+using std::map;
+
+using namespace genie;
+using namespace genie::constants;
+
+namespace genie {
+
+//! The (immutable, shared) tables of an IBDEventSampler
+class IBDSamplerTables {
+public:
+  vector<double>     E;           ///< energy nodes
+  vector<double>     sigma;       ///< total cross section at the energy nodes
+  vector<double>     costheta;    ///< CM frame lepton cos(theta) nodes
+  vector<double>     dxsec;       ///< dsigma/dQ2 at (E[i], costheta[j]), row major
+  vector<InverseCDF> cos_icdf;    ///< cos(theta) inverse CDF at each energy node
+  InverseCDF         energy_icdf; ///< flux x sigma inverse CDF (empty for a fixed energy)
+  double             flux_integral;
+  double             folded_xsec;
+};
+
+}      // genie namespace
+
+namespace {
+
+  // tables shared by all the samplers, built once per model, initial state, flux
+  // (or energy) & number of nodes (see IBDEventSampler::Build())
+  std::mutex                                   gIBDTablesMutex;
+  map<string, const genie::IBDSamplerTables *> gIBDTables;
+
+  // FNV-1a hash of the binning & contents of a flux histogram
+  unsigned long long HashFlux(const TH1D * flux)
+  {
+    unsigned long long h = 14695981039346656037ULL;
+    int nb = flux->GetNbinsX();
+    for(int i = 0; i <= nb+1; i++) {
+      double v[2] = { flux->GetBinLowEdge(i), flux->GetBinContent(i) };
+      unsigned char b[sizeof(v)];
+      std::memcpy(b, v, sizeof(v));
+      for(unsigned int k = 0; k < sizeof(v); k++) {
+        h ^= b[k];
+        h *= 1099511628211ULL;
+      }
+    }
+    return h;
+  }
+
+  // centre-of-mass frame quantities of the 2-body IBD reaction at energy Ev
+  // (struck nucleon at rest); false below threshold
+  bool CMKinematics(double Ev, double M, double ml, double mf,
+                    double & Evcm, double & Elcm, double & plcm, double & sqrts)
+  {
+    double s = M*M + 2*M*Ev;
+    sqrts = std::sqrt(s);
+    if(sqrts <= ml + mf) return false;
+    Evcm = (s - M*M) / (2*sqrts);
+    Elcm = (s + ml*ml - mf*mf) / (2*sqrts);
+    plcm = std::sqrt(std::max(0., Elcm*Elcm - ml*ml));
+    return true;
+  }
+
+  // energy node interval [i, i+1] holding Ev & the fraction f of Ev in it
+  void FindNode(const vector<double> & E, double Ev, int & i, double & f)
+  {
+    int n = E.size();
+    if(n < 2) { i = 0; f = 0; return; }
+    i = std::upper_bound(E.begin(), E.end(), Ev) - E.begin() - 1;
+    if(i < 0    ) i = 0;
+    if(i > n - 2) i = n - 2;
+    f = (Ev - E[i]) / (E[i+1] - E[i]);
+    f = std::min(1., std::max(0., f));
+  }
+
+}
+//____________________________________________________________________________
+IBDEventSampler::IBDEventSampler(
+          const XSecAlgorithmI * xsec_model, int nu_pdg, int tgt_pdg) :
+fXSecModel(xsec_model),
+fNuPdg(nu_pdg),
+fTgtPdg(tgt_pdg),
+fNEnergy(200),
+fNCosTheta(101),
+fNuDir(0,0,1),
+fVtx(0,0,0,0),
+fPrototype(0),
+fMNuc(0),
+fMLep(0),
+fMRec(0),
+fTables(0),
+fRecordPool(new EventRecordPool)
+{
+  bool valid = (pdg::IsAntiNuE(nu_pdg) && tgt_pdg == kPdgTgtFreeP) ||
+               (pdg::IsNuE    (nu_pdg) && tgt_pdg == kPdgTgtFreeN);
+  if(!valid || !xsec_model) {
+    LOG("IBD", pFATAL)
+      << "Fast IBD events are generated for anti-nu_e + p or nu_e + n only"
+      << " (probe: " << nu_pdg << ", target: " << tgt_pdg << ") - Exiting";
+    exit(1);
+  }
+
+  int nuc = (tgt_pdg == kPdgTgtFreeP) ? kPdgProton : kPdgNeutron;
+  fPrototype = Interaction::IBD(tgt_pdg, nuc, nu_pdg);
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  fMNuc = pdglib->Find(nuc)->Mass();
+  fMLep = pdglib->Find(fPrototype->FSPrimLeptonPdg())->Mass();
+  fMRec = pdglib->Find(fPrototype->RecoilNucleonPdg())->Mass();
+}
+//____________________________________________________________________________
+IBDEventSampler::~IBDEventSampler()
+{
+  delete fPrototype;
+  delete fRecordPool;
+}
+//____________________________________________________________________________
+void IBDEventSampler::SetNumOfNodes(int nenergy, int ncostheta)
+{
+  fNEnergy   = std::max(2, nenergy);
+  fNCosTheta = std::max(2, ncostheta);
+}
+//____________________________________________________________________________
+bool IBDEventSampler::BuildTables(const TH1D * flux)
+{
+  if(!flux) return false;
+  return this->Build(flux, -1);
+}
+//____________________________________________________________________________
+bool IBDEventSampler::BuildTables(double Ev)
+{
+  return this->Build(0, Ev);
+}
+//____________________________________________________________________________
+bool IBDEventSampler::Build(const TH1D * flux, double Ev)
+{
+  fTables = 0;
+
+  std::ostringstream key;
+  key << fXSecModel->Id().Key() << ";" << fNuPdg << ";" << fTgtPdg << ";";
+  if(flux) {
+    key << fNEnergy << "x" << fNCosTheta << ";flux:" << std::hex << HashFlux(flux);
+  } else {
+    key << fNCosTheta << ";E:" << Ev;
+  }
+
+  std::lock_guard<std::mutex> lock(gIBDTablesMutex);
+
+  map<string, const IBDSamplerTables *>::const_iterator it =
+                                                gIBDTables.find(key.str());
+  if(it != gIBDTables.end()) {
+    fTables = it->second;
+    return (fTables != 0);
+  }
+
+  // tabulated energy range: the flux range above threshold (and below the
+  // upper limit of the model, see StrumiaVissaniIBDPXSec)
+  double M    = fMNuc;
+  double Ethr = ((fMLep+fMRec)*(fMLep+fMRec) - M*M) / (2*M);
+  double Ecut = kNucleonMass / 2;
+
+  vector<double> E;
+  if(flux) {
+    double emin = std::max(Ethr, flux->GetXaxis()->GetXmin());
+    double emax = std::min(Ecut, flux->GetXaxis()->GetXmax());
+    if(emax > emin) {
+      for(int i = 0; i < fNEnergy; i++) {
+        E.push_back(emin + i * (emax - emin) / (fNEnergy - 1));
+      }
+    }
+  } else if(Ev > Ethr && Ev <= Ecut) {
+    E.push_back(Ev);
+  }
+
+  IBDSamplerTables * tables = 0;
+  if(!E.empty()) {
+    tables = new IBDSamplerTables;
+    tables->E = E;
+    int nE = E.size();
+    int nc = fNCosTheta;
+    for(int j = 0; j < nc; j++) {
+      tables->costheta.push_back(-1. + 2. * j / (nc - 1));
+    }
+    tables->sigma.assign(nE, 0.);
+    tables->dxsec.assign(nE*nc, 0.);
+    tables->cos_icdf.resize(nE);
+
+    Interaction * in = new Interaction(*fPrototype);
+    vector<double> pdf(nc, 0.);
+    for(int i = 0; i < nE; i++) {
+      TLorentzVector p4(0, 0, E[i], E[i]);
+      in->InitStatePtr()->SetProbeP4(p4);
+      in->ResetBit(kISkipProcessChk);
+      in->ResetBit(kISkipKinematicChk);
+      double sig = fXSecModel->Integral(in);
+      tables->sigma[i] = (sig > 0 && !std::isnan(sig)) ? sig : 0.;
+
+      double Evcm, Elcm, plcm, sqrts;
+      if(!CMKinematics(E[i], M, fMLep, fMRec, Evcm, Elcm, plcm, sqrts)) continue;
+
+      // dsigma/dQ2 in the allowed Q2 range, linear in cos(theta)
+      in->SetBit(kISkipProcessChk);
+      in->SetBit(kISkipKinematicChk);
+      in->SetBit(kIAssumeFreeNucleon);
+      for(int j = 0; j < nc; j++) {
+        double Q2 = 2*Evcm*(Elcm - plcm*tables->costheta[j]) - fMLep*fMLep;
+        in->KinePtr()->SetQ2(std::max(0., Q2));
+        double xs = fXSecModel->XSec(in, kPSQ2fE);
+        pdf[j] = (xs > 0 && !std::isnan(xs)) ? xs : 0.;
+        tables->dxsec[i*nc + j] = pdf[j];
+      }
+      in->ResetBit(kIAssumeFreeNucleon);
+      tables->cos_icdf[i].Build(tables->costheta, pdf);
+    }
+    delete in;
+
+    // flux x sigma energy spectrum (flux density: content / bin width)
+    if(flux) {
+      vector<double> phi(nE, 0.), phisig(nE, 0.);
+      for(int i = 0; i < nE; i++) {
+        int    ibin = flux->FindBin(E[i]);
+        double w    = flux->GetBinWidth(ibin);
+        double f    = (w > 0) ? flux->Interpolate(E[i]) / w : 0.;
+        phi[i]    = std::max(0., f);
+        phisig[i] = phi[i] * tables->sigma[i];
+      }
+      tables->flux_integral = 0;
+      for(int i = 1; i < nE; i++) {
+        tables->flux_integral += 0.5 * (phi[i-1] + phi[i]) * (E[i] - E[i-1]);
+      }
+      tables->energy_icdf.Build(E, phisig);
+      tables->folded_xsec = tables->energy_icdf.Integral();
+      if(tables->energy_icdf.IsEmpty()) {
+        delete tables;
+        tables = 0;
+      }
+    } else {
+      tables->flux_integral = 1.;
+      tables->folded_xsec   = tables->sigma[0];
+      if(tables->cos_icdf[0].IsEmpty()) {
+        delete tables;
+        tables = 0;
+      }
+    }
+  }
+
+  if(!tables) {
+    LOG("IBD", pERROR)
+      << "No IBD cross section in the requested energy range (threshold: "
+      << Ethr << " GeV, model cut-off: " << Ecut << " GeV)";
+  } else {
+    LOG("IBD", pNOTICE)
+      << "Built the fast IBD tables: " << tables->E.size() << " energies x "
+      << tables->costheta.size() << " cos(theta) nodes, <sigma> = "
+      << tables->folded_xsec / tables->flux_integral / (1E-38*units::cm2)
+      << " x 1E-38 cm2";
+  }
+
+  gIBDTables[key.str()] = tables;
+  fTables = tables;
+
+  return (fTables != 0);
+}
+//____________________________________________________________________________
+EventRecord * IBDEventSampler::GenerateEvent(void) const
+{
+  if(!fTables) {
+    LOG("IBD", pFATAL) << "The fast IBD tables were not built - Exiting";
+    exit(1);
+  }
+  const IBDSamplerTables & t = *fTables;
+
+  TRandom3 & rnd = RandomGen::Instance()->RndKine();
+
+  // neutrino energy & energy node interval
+  double Ev = (t.energy_icdf.IsEmpty()) ?
+                        t.E[0] : t.energy_icdf.Sample(rnd.Rndm());
+  int    i = 0;
+  double f = 0;
+  FindNode(t.E, Ev, i, f);
+
+  // CM frame cos(theta): interpolated quantile of the neighbouring nodes
+  // (a node at the threshold has no table: use the other one)
+  double r    = rnd.Rndm();
+  double cost = 0;
+  bool   has0 = !t.cos_icdf[i].IsEmpty();
+  bool   has1 = (t.E.size() > 1) && !t.cos_icdf[i+1].IsEmpty();
+  if     (has0 && has1) cost = (1-f) * t.cos_icdf[i  ].Sample(r) +
+                                  f  * t.cos_icdf[i+1].Sample(r);
+  else if(has0)         cost = t.cos_icdf[i  ].Sample(r);
+  else if(has1)         cost = t.cos_icdf[i+1].Sample(r);
+  else                  cost = 2*r - 1;
+  cost = std::min(1., std::max(-1., cost));
+  double sint = std::sqrt(std::max(0., 1 - cost*cost));
+  double phi  = 2 * kPi * rnd.Rndm();
+
+  // 2-body kinematics: CM frame lepton, boosted along the neutrino
+  double M = fMNuc;
+  double Evcm = 0, Elcm = 0, plcm = 0, sqrts = 0;
+  CMKinematics(Ev, M, fMLep, fMRec, Evcm, Elcm, plcm, sqrts);
+
+  TLorentzVector p4l(plcm*sint*std::cos(phi), plcm*sint*std::sin(phi),
+                     plcm*cost, Elcm);
+  p4l.Boost(0, 0, Ev / (Ev + M));
+  TLorentzVector p4nu (0, 0, Ev, Ev);
+  TLorentzVector p4nuc(0, 0, 0,  M);
+  TLorentzVector p4rec = p4nu + p4nuc - p4l;
+
+  p4l  .RotateUz(fNuDir);
+  p4nu .RotateUz(fNuDir);
+  p4rec.RotateUz(fNuDir);
+
+  double Q2 = std::max(0., 2*Evcm*(Elcm - plcm*cost) - fMLep*fMLep);
+  double W  = fMRec;
+  double x  = 0, y = 0;
+  utils::kinematics::WQ2toXY(Ev, M, W, Q2, x, y);
+
+  // cross sections, interpolated in the tables
+  int    nc   = t.costheta.size();
+  double c    = 0.5 * (cost + 1) * (nc - 1);
+  int    j    = std::min(nc - 2, (int) c);
+  double g    = c - j;
+  int    i1   = (t.E.size() > 1) ? i+1 : i;
+  double dxs0 = (1-g) * t.dxsec[i *nc + j] + g * t.dxsec[i *nc + j+1];
+  double dxs1 = (1-g) * t.dxsec[i1*nc + j] + g * t.dxsec[i1*nc + j+1];
+  double dxs  = (1-f) * dxs0 + f * dxs1;
+  double xsec = this->XSec(Ev);
+
+  // re-use a recycled record & summary, if any
+  EventRecord * event = fRecordPool->Get();
+  if(!event) event = new EventRecord;
+
+  Interaction * in = event->ReleaseSpareSummary();
+  if(!in) in = new Interaction(*fPrototype);
+  else    in->Copy(*fPrototype);
+
+  in->InitStatePtr()->SetProbeP4(p4nu);
+  Kinematics * kine = in->KinePtr();
+  kine->SetQ2(Q2, true);
+  kine->SetW (W,  true);
+  kine->Setx (x,  true);
+  kine->Sety (y,  true);
+  kine->ClearRunningValues();
+  kine->SetFSLeptonP4(p4l);
+  kine->SetHadSystP4 (p4rec);
+  event->AttachSummary(in);
+
+  const InitialState & init = in->InitState();
+  event->AddParticle(fNuPdg, kIStInitialState, -1,-1,-1,-1, p4nu, fVtx);
+  event->AddParticle(init.Tgt().HitNucPdg(),
+                             kIStInitialState, -1,-1,-1,-1, p4nuc, fVtx);
+  event->AddParticle(in->FSPrimLeptonPdg(),
+                         kIStStableFinalState,  0,-1,-1,-1, p4l,   fVtx);
+  event->AddParticle(in->RecoilNucleonPdg(),
+                         kIStStableFinalState,  1,-1,-1,-1, p4rec, fVtx);
+
+  event->SetVertex  (fVtx);
+  event->SetXSec    (xsec);
+  event->SetDiffXSec(dxs, kPSQ2fE);
+  event->SetWeight  (1.);
+
+  return event;
+}
+//____________________________________________________________________________
+void IBDEventSampler::RecycleEvent(EventRecord * event) const
+{
+  fRecordPool->Recycle(event);
+}
+//____________________________________________________________________________
+double IBDEventSampler::XSec(double Ev) const
+{
+  if(!fTables) return 0;
+  const IBDSamplerTables & t = *fTables;
+  if(t.E.size() < 2) return t.sigma[0];
+  if(Ev < t.E.front() || Ev > t.E.back()) return 0;
+
+  int    i = 0;
+  double f = 0;
+  FindNode(t.E, Ev, i, f);
+  return (1-f) * t.sigma[i] + f * t.sigma[i+1];
+}
+//____________________________________________________________________________
+double IBDEventSampler::FluxIntegral(void) const
+{
+  return (fTables) ? fTables->flux_integral : 0.;
+}
+//____________________________________________________________________________
+double IBDEventSampler::FoldedXSec(void) const
+{
+  return (fTables) ? fTables->folded_xsec : 0.;
+}
+//____________________________________________________________________________
+double IBDEventSampler::FluxAveragedXSec(void) const
+{
+  double phi = this->FluxIntegral();
+  return (phi > 0) ? this->FoldedXSec() / phi : 0.;
+}
+//____________________________________________________________________________
@@ -0,0 +1,117 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::IBDEventSampler
+
+\brief    A fast generator of inverse beta decay (IBD) events on a free
+          nucleon target (anti-nu_e + p -> e+ n, nu_e + n -> e- p), for the
+          large samples of supernova-burst and reactor studies.
+
+          The events do not go through the GMCJDriver / GEVGDriver chain,
+          the IBDKinematicsGenerator rejection loop and the visitors: The
+          neutrino energy and the lepton scattering angle are drawn from
+          inverse CDF tables built once per (cross section model, initial
+          state, flux spectrum) and the GHEP records are filled directly.
+
+          The tables hold, at a grid of neutrino energies Ev,
+          - the total cross section sigma(Ev) (XSecAlgorithmI::Integral()),
+          - the inverse CDF of the flux x sigma energy spectrum,
+          - the inverse CDF of the lepton cos(theta) in the centre-of-mass
+            frame, where Q2 is linear in cos(theta) and so the pdf is the
+            model dsigma/dQ2 (eg StrumiaVissaniIBDPXSec) at fixed Ev.
+          Between the energy nodes the cos(theta) quantiles are interpolated.
+          The two-body kinematics are then exact. The tables are immutable
+          and shared by all the samplers built for the same model, initial
+          state and flux (or energy), in any thread.
+
+          The records hold the probe, the struck nucleon, the primary lepton
+          and the recoil nucleon, as filled by the standard IBD generator
+          (IBDKinematicsGenerator etc), with the summary kinematics (Q2, W,
+          x, y), the total and differential (kPSQ2fE) cross sections.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _IBD_EVENT_SAMPLER_H_
+#define _IBD_EVENT_SAMPLER_H_
+
+#include <TVector3.h>
+#include <TLorentzVector.h>
+
+class TH1D;
+
+namespace genie {
+
+class XSecAlgorithmI;
+class EventRecord;
+class EventRecordPool;
+class Interaction;
+class IBDSamplerTables;
+
+class IBDEventSampler {
+
+public :
+  //! sampler for the input probe (nu_e or anti-nu_e) and free nucleon target
+  //! (kPdgTgtFreeN / kPdgTgtFreeP) using the input cross section model
+  IBDEventSampler(const XSecAlgorithmI * xsec_model, int nu_pdg, int tgt_pdg);
+ ~IBDEventSampler();
+
+  //! use before BuildTables() to set the number of energy and cos(theta)
+  //! nodes of the tables [default: 200, 101]
+  void SetNumOfNodes  (int nenergy, int ncostheta);
+
+  void SetNuDirection (const TVector3 & dir)       { fNuDir = dir.Unit(); }
+  void SetVertex      (const TLorentzVector & vtx) { fVtx   = vtx;        }
+
+  //! build (or get the shared copy of) the tables for the input flux
+  //! spectrum (a histogram of the flux vs Ev in GeV), or for a fixed energy.
+  //! Returns false if there is no IBD cross section in the spectrum range.
+  bool BuildTables (const TH1D * flux);
+  bool BuildTables (double Ev);
+
+  //! generate an event (the caller adopts it; see RecycleEvent())
+  EventRecord * GenerateEvent (void) const;
+
+  //! give back an event that is no longer needed, its record is re-used
+  void RecycleEvent (EventRecord * event) const;
+
+  //! tabulated total cross section (interpolated between the nodes)
+  double XSec (double Ev) const;
+
+  //! sample normalization: integral of the flux and of the flux x sigma
+  //! over the tabulated range (the flux units x GeV [x cm2 in natural
+  //! units]); for a fixed energy, 1 and sigma(Ev)
+  double FluxIntegral     (void) const;
+  double FoldedXSec       (void) const;
+  double FluxAveragedXSec (void) const;
+
+private:
+  IBDEventSampler(const IBDEventSampler & sampler);
+
+  bool Build (const TH1D * flux, double Ev);
+
+  const XSecAlgorithmI *   fXSecModel;  ///< IBD cross section model
+  int                      fNuPdg;      ///< probe
+  int                      fTgtPdg;     ///< free nucleon target
+  int                      fNEnergy;    ///< energy nodes of the tables
+  int                      fNCosTheta;  ///< cos(theta) nodes of the tables
+  TVector3                 fNuDir;      ///< neutrino direction
+  TLorentzVector           fVtx;        ///< interaction vertex
+  Interaction *            fPrototype;  ///< initial state & process of the events
+  double                   fMNuc;       ///< struck nucleon mass
+  double                   fMLep;       ///< final state lepton mass
+  double                   fMRec;       ///< recoil nucleon mass
+  const IBDSamplerTables * fTables;     ///< shared tables (not owned)
+  EventRecordPool *        fRecordPool; ///< recycled event records
+};
+
+}      // genie namespace
+
+#endif // _IBD_EVENT_SAMPLER_H_
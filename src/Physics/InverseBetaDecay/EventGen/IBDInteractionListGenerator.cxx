@@ -74,13 +74,13 @@ InteractionList * IBDInteractionListGenerator::CreateInteractionList(
 //____________________________________________________________________________
 void IBDInteractionListGenerator::Configure(const Registry & config)
 {
-   Algorithm::Configure(config);
+   InteractionListGeneratorI::Configure(config);
    this->LoadConfigData();
 }
 //____________________________________________________________________________
 void IBDInteractionListGenerator::Configure(string config)
 {
-   Algorithm::Configure(config);
+   InteractionListGeneratorI::Configure(config);
    this->LoadConfigData();
 }
 //____________________________________________________________________________
@@ -170,7 +170,7 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         // The hadronic inv. mass is equal to the recoil nucleon on-shell mass.
         const int rpdgc = interaction->RecoilNucleonPdg();
         assert(rpdgc);
-        const double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+        const double gW = PDGLibrary::Instance()->Mass(rpdgc);
 
         LOG("IBD", pNOTICE) << "Selected: W = "<< gW;
 
@@ -10,5 +10,6 @@
 #pragma link C++ class genie::IBDKinematicsGenerator+;
 #pragma link C++ class genie::IBDHadronicSystemGenerator+;
 #pragma link C++ class genie::IBDPrimaryLeptonGenerator+;
+#pragma link C++ class genie::IBDEventSampler;
 
 #endif
@@ -31,6 +31,19 @@ const double KLVOxygenIBDPXSec::kMaxE        = 0.1000; // GeV
 
 ClassImp(KLVOxygenIBDPXSec)
 
+namespace {
+   // make spline via dummy TGraph because TSpline3's ctor isn't const correct
+   // (the splines are immutable after construction & never deleted)
+   const TSpline3 * MakeSpline(const char * name, Int_t npts,
+                               const Double_t * E, const Double_t * xsec)
+   {
+      const TGraph dummy(npts,E,xsec);
+      TSpline3 * spl = new TSpline3(name,&dummy);
+      spl->SetNpx(500);
+      return spl;
+   }
+}
+
 //____________________________________________________________________________
 KLVOxygenIBDPXSec::KLVOxygenIBDPXSec() :
    XSecAlgorithmI("genie::KLVOxygenIBDPXSec"),
@@ -50,8 +63,7 @@ KLVOxygenIBDPXSec::KLVOxygenIBDPXSec(string config) :
 //____________________________________________________________________________
 KLVOxygenIBDPXSec::~KLVOxygenIBDPXSec()
 {
-   delete fXsplNue;
-   delete fXsplNuebar;
+   // the splines are shared by all instances & not owned
 }
 //____________________________________________________________________________
 double KLVOxygenIBDPXSec::XSec(const Interaction * interaction,
@@ -71,12 +83,10 @@ double KLVOxygenIBDPXSec::XSec(const Interaction * interaction,
 //____________________________________________________________________________
 void KLVOxygenIBDPXSec::MakeAntiNuESpline(void)
 {
-   // make a new xsec spline from the KLV paper's calculation
+   // get the xsec spline from the KLV paper's calculation
    // for the 16O + nu_e_bar reaction
-   // remove any spline that might already exist
+   // it is built at the first call and shared by all instances
 
-   delete fXsplNuebar;
-   
    static const Int_t npts_nuebar = 21;
    static const Double_t Evnuebar[npts_nuebar] = {
       kO16NubarThr,
@@ -93,19 +103,16 @@ void KLVOxygenIBDPXSec::MakeAntiNuESpline(void)
       1.48e1*xsunit,  2.64e1*xsunit,  4.29e1*xsunit,  6.46e1*xsunit,  9.17e1*xsunit,
       1.25e2*xsunit,  1.63e2*xsunit,  2.57e2*xsunit,  3.77e2*xsunit,  5.18e2*xsunit
    };
-   // make spline via dummy TGraph because TSpline3's ctor isn't const correct
-   const TGraph dummy(npts_nuebar,Evnuebar,Onuebar);
-   fXsplNuebar = new TSpline3("16O_nu_e_bar_xsec",&dummy);
-   fXsplNuebar->SetNpx(500);   
+   static const TSpline3 * spl = MakeSpline(
+                  "16O_nu_e_bar_xsec", npts_nuebar, Evnuebar, Onuebar);
+   fXsplNuebar = spl;
 }
 //____________________________________________________________________________
 void KLVOxygenIBDPXSec::MakeNuESpline()
 {
-   // make a new xsec spline from the KLV paper's calculation
+   // get the xsec spline from the KLV paper's calculation
    // for the 16O + nu_e reaction
-   // remove any spline that might already exist
-
-   delete fXsplNue;
+   // it is built at the first call and shared by all instances
 
    static const Int_t npts_nue = 20;
    static const Double_t Evnue[npts_nue] = {
@@ -121,9 +128,9 @@ void KLVOxygenIBDPXSec::MakeNuESpline()
       1.28e1*xsunit,  2.76e1*xsunit,  5.21e1*xsunit,  8.89e1*xsunit,  1.41e2*xsunit,
       2.12e2*xsunit,  3.02e2*xsunit,  5.52e2*xsunit,  8.92e2*xsunit,  1.32e3*xsunit
    };
-   const TGraph dummy(npts_nue,Evnue,Onue);
-   fXsplNue = new TSpline3("16O_nu_e_xsec",&dummy);
-   fXsplNue->SetNpx(500);
+   static const TSpline3 * spl = MakeSpline(
+                  "16O_nu_e_xsec", npts_nue, Evnue, Onue);
+   fXsplNue = spl;
 }
 //____________________________________________________________________________
 double KLVOxygenIBDPXSec::Integral(const Interaction * interaction) const
@@ -52,11 +52,12 @@ public:
 private:
   void LoadConfig (void);
   
+  //-- the splines are built once and shared by all instances
   void MakeAntiNuESpline(void);
   void MakeNuESpline(void);
 
-  TSpline3* fXsplNue; //! a spline around the 16O+nu_e xsec points listed in the reference paper
-  TSpline3* fXsplNuebar; //! a spline around the 16O+nu_e_bar xsec points listed in the reference paper
+  const TSpline3* fXsplNue; //! a spline around the 16O+nu_e xsec points listed in the reference paper
+  const TSpline3* fXsplNuebar; //! a spline around the 16O+nu_e_bar xsec points listed in the reference paper
 
 public:
   ClassDef(KLVOxygenIBDPXSec, 1) // Oxygen16 - (anti)neutrino cross section estimator based on a Kolbe/Langanke/Vogel paper
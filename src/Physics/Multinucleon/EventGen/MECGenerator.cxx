@@ -19,9 +19,18 @@
    Major development leading to the first complete version of the generator.
  @ Nov 20, 2015 - CA, SD  
    Add proper exception handling for failure of phase space decay.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   DecayNucleonCluster() uses a PhaseSpaceDecayer, caching the max decay
+   weight, instead of estimating it from 200 trial decays at each call.
+   SelectNSVLeptonKinematics() rejects against the max cross section
+   precomputed (and cached) per probe energy bin, and evaluates the pn and
+   Delta cross sections only for the accepted kinematics.
+   Uses the nuclear model resolved for the channel (see ResolvedAlgs).
 */
 //____________________________________________________________________________
 
+#include <sstream>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -31,6 +40,7 @@
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/EventGen/EventGeneratorI.h"
+#include "Framework/EventGen/ResolvedAlgs.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/GHEP/GHepParticle.h"
@@ -41,17 +51,35 @@
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Physics/Multinucleon/XSection/MECHadronTensor.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/UniformBuffer.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
+
+using std::ostringstream;
+using std::map;
+using std::string;
 
 using namespace genie;
 using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+namespace {
+  // The max NSV cross section is cached in probe energy bins, of a width
+  // of 1/kNSVEBinsPerDecade decade. It is the largest cross section found
+  // at the bin edges on a kNSVNScan x kNSVNScan (q0,q3) grid up to NSV-Q3Max,
+  // refined kNSVNRefine times around its maximum, times kNSVMaxXSecSafety
+  const double kNSVEBinsPerDecade = 20.;
+  const int    kNSVNScan          = 60;
+  const int    kNSVNRefine        = 4;
+  const double kNSVMaxXSecSafety  = 1.2;
+}
+
 //___________________________________________________________________________
 MECGenerator::MECGenerator() :
 EventRecordVisitorI("genie::MECGenerator")
@@ -174,12 +202,13 @@ void MECGenerator::GenerateFermiMomentum(GHepRecord * event) const
   Target tgt(target_nucleus->Pdg());
   PDGCodeList pdgv = this->NucleonClusterConstituents(nucleon_cluster->Pdg());
   assert(pdgv.size()==2);
+  const NuclearModelI * nucl_model = this->NuclModel(event);
   tgt.SetHitNucPdg(pdgv[0]);
-  fNuclModel->GenerateNucleon(tgt);
-  TVector3 p3a = fNuclModel->Momentum3();
+  nucl_model->GenerateNucleon(tgt);
+  TVector3 p3a = nucl_model->Momentum3();
   tgt.SetHitNucPdg(pdgv[1]);
-  fNuclModel->GenerateNucleon(tgt);
-  TVector3 p3b = fNuclModel->Momentum3();
+  nucl_model->GenerateNucleon(tgt);
+  TVector3 p3b = nucl_model->Momentum3();
     
   LOG("FermiMover", pINFO)
      << "1st nucleon (code = " << pdgv[0] << ") generated momentum: ("
@@ -299,7 +328,7 @@ void MECGenerator::SelectEmpiricalKinematics(GHepRecord * event) const
         double gy = 0;
  	//  More accurate calculation of the mass of the cluster than 2*Mnucl
  	int nucleon_cluster_pdg = interaction->InitState().Tgt().HitNucPdg();
- 	double M2n = PDGLibrary::Instance()->Find(nucleon_cluster_pdg)->Mass(); 
+ 	double M2n = PDGLibrary::Instance()->Mass(nucleon_cluster_pdg); 
  	kinematics::WQ2toXY(Ev,M2n,gW,gQ2,gx,gy);
 
         LOG("MEC", pINFO) << "x = " << gx << ", y = " << gy;
@@ -329,8 +358,8 @@ void MECGenerator::AddFinalStateLepton(GHepRecord * event) const
 
   // apapadop: Boosting the incoming neutrino to the NN-cluster rest frame
   // Neutrino 4p
-  TLorentzVector * p4v = event->Probe()->GetP4(); // v 4p @ LAB
-  p4v->Boost(-1.*beta);                           // v 4p @ NN-cluster rest frame
+  TLorentzVector p4v = event->Probe()->Momentum(); // v 4p @ LAB
+  p4v.Boost(-1.*beta);                              // v 4p @ NN-cluster rest frame
 
   // Look-up selected kinematics
   double Q2 = interaction->Kine().Q2(true);
@@ -359,7 +388,7 @@ void MECGenerator::AddFinalStateLepton(GHepRecord * event) const
 
   // Take a unit vector along the neutrino direction
   // apapadop: WE NEED THE UNIT VECTOR ALONG THE NEUTRINO DIRECTION IN THE NN-CLUSTER REST FRAME, NOT IN THE LAB FRAME
- TVector3 unit_nudir = p4v->Vect().Unit();      //We use this one, which is in the NN-cluster rest frame
+ TVector3 unit_nudir = p4v.Vect().Unit();      //We use this one, which is in the NN-cluster rest frame
   // Rotate lepton momentum vector from the reference frame (x'y'z') where 
   // {z':(neutrino direction), z'x':(theta plane)} to the LAB
   TVector3 p3l(pltx,plty,plp);
@@ -387,9 +416,7 @@ void MECGenerator::RecoilNucleonCluster(GHepRecord * event) const
   // get di-nucleon cluster & its 4-momentum
   GHepParticle * nucleon_cluster = event->HitNucleon();
   assert(nucleon_cluster);
-  TLorentzVector * tmp=nucleon_cluster->GetP4();
-  TLorentzVector p4cluster(*tmp);
-  delete tmp;
+  TLorentzVector p4cluster(nucleon_cluster->Momentum());
 
   // get neutrino & its 4-momentum
   GHepParticle * neutrino = event->Probe();
@@ -437,39 +464,24 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
   PDGCodeList pdgv = this->NucleonClusterConstituents(nucleon_cluster->Pdg());
   LOG("MEC", pINFO) << "Decay product IDs: " << pdgv;
 
-  // Get the decay product masses
-  vector<int>::const_iterator pdg_iter;
-  int i = 0;
-  double * mass = new double[pdgv.size()];
-  double   sum  = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    mass[i++] = m;
-    sum += m;
-  }
+  TLorentzVector p4d = nucleon_cluster->Momentum();
+  TLorentzVector v4d = nucleon_cluster->Position();
+
+  // Set the decay
+  bool permitted = fPhaseSpaceDecayer.SetDecay(p4d, pdgv);
+  double sum = fPhaseSpaceDecayer.MassSum();
 
   LOG("MEC", pINFO) 
     << "Performing a phase space decay to "
     << pdgv.size() << " particles / total mass = " << sum;
-
-  TLorentzVector * p4d = nucleon_cluster->GetP4();
-  TLorentzVector * v4d = nucleon_cluster->GetX4();
-
   LOG("MEC", pINFO) 
-    << "Decaying system p4 = " << utils::print::P4AsString(p4d);
+    << "Decaying system p4 = " << utils::print::P4AsString(&p4d);
 
-  // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
   if(!permitted) {
      LOG("MEC", pERROR) 
        << " *** Phase space decay is not permitted \n"
        << " Total particle mass = " << sum << "\n"
-       << " Decaying system p4 = " << utils::print::P4AsString(p4d);
-     // clean-up 
-     delete [] mass;
-     delete p4d;
-     delete v4d; 
+       << " Decaying system p4 = " << utils::print::P4AsString(&p4d);
      // throw exception
      event->EventFlags()->SetBitNumber(kHadroSysGenErr, true);
      genie::exceptions::EVGThreadException exception;
@@ -480,11 +492,7 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
   }
 
   // Get the maximum weight
-  double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     wmax = TMath::Max(wmax,w);
-  }
+  double wmax = fPhaseSpaceDecayer.MaxWeight(200);
   assert(wmax>0);
   wmax *= 2;
 
@@ -503,10 +511,6 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
        LOG("MEC", pWARN) 
            << "Couldn't generate an unweighted phase space decay after " 
            << itry << " attempts";
-       // clean up
-       delete [] mass;
-       delete p4d;
-       delete v4d;
        // throw exception
        event->EventFlags()->SetBitNumber(kHadroSysGenErr, true);
        genie::exceptions::EVGThreadException exception;
@@ -515,7 +519,8 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
        exception.SetReturnStep(0);
        throw exception;
      }
-     double w  = fPhaseSpaceGenerator.Generate();   
+     double w  = fPhaseSpaceDecayer.Generate();   
+     fPhaseSpaceDecayer.UpdateMaxWeight(w);
      if(w > wmax) {
         LOG("MEC", pWARN) 
            << "Decay weight = " << w << " > max decay weight = " << wmax;
@@ -530,20 +535,16 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
   } //!accept_decay
 
   // Insert the decay products in the event record
-  TLorentzVector v4(*v4d); 
+  TLorentzVector v4(v4d); 
   GHepStatus_t ist = kIStHadronInTheNucleus;
   int idp = 0;
+  vector<int>::const_iterator pdg_iter;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
      int pdgc = *pdg_iter;
-     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(idp);
+     TLorentzVector * p4fin = fPhaseSpaceDecayer.GetDecay(idp);
      event->AddParticle(pdgc, ist, nucleon_cluster_id,-1,-1,-1, *p4fin, v4);
      idp++;
   }
-
-  // Clean-up
-  delete [] mass;
-  delete p4d;
-  delete v4d;
 }
 //___________________________________________________________________________
 PDGCodeList MECGenerator::NucleonClusterConstituents(int pdgc) const
@@ -584,7 +585,8 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
 
   // -- limit the maximum XS for the accept/reject loop -- //
   // 
-  // MaxXSec parameters.  This whole calculation could be in it's own function?
+  // The max XS is precomputed in bins of Enu (see NSVMaxXSec()).
+  // MaxXSec parameters of the fallback used if it can't be computed.
   // these need to lead to a number that is safely large enough, or crash the run.
   double XSecMaxPar1 = 2.2504;
   double XSecMaxPar2 = 9.41158;
@@ -653,6 +655,10 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
     }
   }
   
+  // the cached max XS of this energy bin, and the fallback fit
+  double * CachedXSecMax = this->NSVMaxXSec(interaction, Enu);
+  if (CachedXSecMax && *CachedXSecMax <= 0) CachedXSecMax = 0;
+
   // -- Generate and Test the Kinematics----------------------------------//
 
   RandomGen * rnd = RandomGen::Instance();
@@ -660,6 +666,8 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
   unsigned int iter = 0;
 
   // loop over different (randomly) selected T and Costh
+  // (RndKine numbers drawn in blocks)
+  UniformBuffer rndkine(kRndmKine);
   while (!accept) {
       iter++;
       if(iter > kRjMaxIterations) {
@@ -675,8 +683,8 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
       }
 
       // generate random kinetic energy T and Costh
-      T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
-      Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
+      T = TMin + (TMax-TMin)*rndkine.Next();
+      Costh = CosthMin + (CosthMax-CosthMin)*rndkine.Next();
 
       // Calculate useful values for judging this choice
       Plep = TMath::Sqrt( T * (T + (2.0 * LepMass)));  // ok is sqrt(E2 - m2)
@@ -707,13 +715,13 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
               //  and fit a line.  Use that plus 1.35 safety factors to limit the accept/reject loop.
               double XSecMax = 1.35 * TMath::Power(10.0, XSecMaxPar1 * TMath::Log10(Enu) - XSecMaxPar2);
               if (NuclearA > 12) XSecMax *=  NuclearAfactorXSecMax;  // Scale it by A, precomputed above.
+              if (CachedXSecMax) XSecMax = *CachedXSecMax;
 
               LOG("MEC", pDEBUG) << " T, Costh: " << T << ", " << Costh ;
 
 
-              // We need four different cross sections. Right now, pursue the
-              // inelegant method of calling XSec four times - there is
-              // definitely some runtime inefficiency here, but it is not awful
+              // We need four different cross sections, but only the
+              // delta-less all one to accept or reject the kinematics
 
               // first, get delta-less all
               if (NuPDG > 0) {
@@ -722,28 +730,38 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
               else {
                   interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterPP);
               }
-              double XSec = fXSecModel->XSec(interaction, kPSTlctl);
-              // now get all with delta
-              interaction->ExclTagPtr()->SetResonance(genie::kP33_1232);
-              double XSecDelta = fXSecModel->XSec(interaction, kPSTlctl);
-              // get PN with delta
-              interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterNP);
-              double XSecDeltaPN = fXSecModel->XSec(interaction, kPSTlctl);
-              // now get delta-less PN
               interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
-              double XSecPN = fXSecModel->XSec(interaction, kPSTlctl);
+              double XSec = fXSecModel->XSec(interaction, kPSTlctl);
 
               if (XSec > XSecMax) {
-                  LOG("MEC", pERROR) << "XSec is > XSecMax for nucleus " << TgtPDG << " " 
-				   << XSec << " > " << XSecMax 
-				   << " don't let this happen.";
+                  if (CachedXSecMax) {
+                      // an underestimated max: raise it for the next events
+                      LOG("MEC", pWARN) << "XSec is > XSecMax for nucleus " << TgtPDG << " " 
+                                        << XSec << " > " << XSecMax 
+                                        << " at Enu = " << Enu << " - Raising XSecMax";
+                      *CachedXSecMax = kNSVMaxXSecSafety * XSec;
+                  } else {
+                      LOG("MEC", pERROR) << "XSec is > XSecMax for nucleus " << TgtPDG << " " 
+                                         << XSec << " > " << XSecMax 
+                                         << " don't let this happen.";
+                  }
               }
-              assert(XSec <= XSecMax);
-              accept = XSec > XSecMax*rnd->RndKine().Rndm();
+              assert(CachedXSecMax || XSec <= XSecMax);
+              accept = XSec > XSecMax*rndkine.Next();
               LOG("MEC", pINFO) << "Xsec, Max, Accept: " << XSec << ", " 
                   << XSecMax << ", " << accept; 
 
               if(accept){
+                  // now get all with delta
+                  interaction->ExclTagPtr()->SetResonance(genie::kP33_1232);
+                  double XSecDelta = fXSecModel->XSec(interaction, kPSTlctl);
+                  // get PN with delta
+                  interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterNP);
+                  double XSecDeltaPN = fXSecModel->XSec(interaction, kPSTlctl);
+                  // now get delta-less PN
+                  interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
+                  double XSecPN = fXSecModel->XSec(interaction, kPSTlctl);
+
                   // If it passes the All cross section we still need to do two things:
                   // * Was the initial state pn or not?
                   // * Do we assign the reaction to have had a Delta on the inside?
@@ -754,7 +772,7 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
                   bool isPDD = false;
 
                   // Find out if we should use a pn initial state
-                  double myrand = rnd->RndKine().Rndm();
+                  double myrand = rndkine.Next();
                   double pnFraction = XSecPN / XSec;
                   LOG("MEC", pDEBUG) << "Test for pn: xsec_pn = " << XSecPN 
                       << "; xsec = " << XSec 
@@ -768,7 +786,7 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
                       interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterNP);
 
                       // Its a pn, so test for Delta by comparing DeltaPN/PN
-                      if (rnd->RndKine().Rndm() <= XSecDeltaPN / XSecPN) {
+                      if (rndkine.Next() <= XSecDeltaPN / XSecPN) {
                           isPDD = true;
                       }
                   }
@@ -786,7 +804,7 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
                       }
                       // its not pn, so test for Delta (XSecDelta-XSecDeltaPN)/(XSec-XSecPN)
                       // right, both numerator and denominator are total not pn.
-                      if (rnd->RndKine().Rndm() <=
+                      if (rndkine.Next() <=
                               (XSecDelta - XSecDeltaPN) / (XSec - XSecPN)) {
                           isPDD = true;
                       }
@@ -894,6 +912,8 @@ void MECGenerator::GenerateNSVInitialHadrons(GHepRecord * event) const
     GHepParticle * remnant_nucleus = event->RemnantNucleus();
     assert(remnant_nucleus);
 
+    const NuclearModelI * nucl_model = this->NuclModel(event);
+
     // -- make a two-nucleon system, then give them some momenta.
 
     // instantiate an empty local target nucleus, so I can use existing methods
@@ -972,19 +992,19 @@ void MECGenerator::GenerateNSVInitialHadrons(GHepRecord * event) const
         // so momentum from global Fermi gas, local Fermi gas, or spectral function
         // and removal energy ~0.025 GeV, correlated with density, or from SF distribution
         tgt.SetHitNucPdg(pdgv[0]);
-        fNuclModel->GenerateNucleon(tgt);
-        p31i = fNuclModel->Momentum3();
-        removalenergy1 = fNuclModel->RemovalEnergy();
+        nucl_model->GenerateNucleon(tgt);
+        p31i = nucl_model->Momentum3();
+        removalenergy1 = nucl_model->RemovalEnergy();
         tgt.SetHitNucPdg(pdgv[1]);
-        fNuclModel->GenerateNucleon(tgt);
-        p32i = fNuclModel->Momentum3();
-        removalenergy2 = fNuclModel->RemovalEnergy();
+        nucl_model->GenerateNucleon(tgt);
+        p32i = nucl_model->Momentum3();
+        removalenergy2 = nucl_model->RemovalEnergy();
 
         // not sure -- could give option to use Nieves q-value here.
 
         // Now write down the initial cluster four-vector for this choice
         TVector3 p3i = p31i + p32i;
-        double mass2 = PDGLibrary::Instance()->Find( initial_nucleon_cluster_pdg )->Mass();
+        double mass2 = PDGLibrary::Instance()->Mass(initial_nucleon_cluster_pdg);
         mass2 *= mass2;
         double energy = TMath::Sqrt(p3i.Mag2() + mass2);
         p4initial_cluster.SetPxPyPzE(p3i.Px(),p3i.Py(),p3i.Pz(),energy);
@@ -1010,7 +1030,7 @@ void MECGenerator::GenerateNSVInitialHadrons(GHepRecord * event) const
         // Test if the resulting four-vector corresponds to a high-enough invariant mass.
         // Fail the accept if we couldn't put this thing on-shell.
         if (p4final_cluster.M() < 
-                PDGLibrary::Instance()->Find(final_nucleon_cluster_pdg )->Mass()) {
+                PDGLibrary::Instance()->Mass(final_nucleon_cluster_pdg)) {
             accept = false;
         } else {
             accept = true;
@@ -1054,6 +1074,158 @@ void MECGenerator::GenerateNSVInitialHadrons(GHepRecord * event) const
     interaction->KinePtr()->SetHadSystP4(p4final_cluster);
 }
 //___________________________________________________________________________
+double * MECGenerator::NSVMaxXSec(
+   const Interaction * interaction, double Enu) const
+{
+// Max cross section for the accept/reject loop of SelectNSVLeptonKinematics()
+// in the energy bin of Enu. It is computed at the first event in the bin and
+// kept in the cache as well, so that it is saved along with it and reused by
+// later jobs loading the cache file. Returns null if Enu is not positive.
+
+  if (Enu <= 0) return 0;
+
+  int ibin = (int) TMath::Floor(kNSVEBinsPerDecade * TMath::Log10(Enu));
+
+  Cache * cache = Cache::Instance();
+  ostringstream intkey;
+  intkey << "NSV-MaxXSec;nu:" << interaction->InitState().ProbePdg()
+         << ";tgt:" << interaction->InitState().TgtPdg()
+         << ";proc:" << interaction->ProcInfo().AsString();
+  string key = cache->CacheBranchKey(
+     this->Id().Key(), fXSecModel->Id().Key(), intkey.str());
+
+  map<int, double> & maxima = fNSVMaxXSec[key];
+  map<int, double>::iterator iter = maxima.find(ibin);
+  if (iter != maxima.end()) return &(iter->second);
+
+  double Elo = TMath::Power(10., ibin     / kNSVEBinsPerDecade);
+  double Ehi = TMath::Power(10., (ibin+1) / kNSVEBinsPerDecade);
+
+  CacheBranchFx * cache_branch =
+     dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if (!cache_branch) {
+     LOG("MEC", pINFO) << "Creating cache branch - key = " << key;
+     cache_branch = new CacheBranchFx("max NSV d^2XSec/dTldcostl per Enu bin");
+     cache->AddCacheBranch(key, cache_branch);
+  }
+
+  // the bin max is kept at the top edge of the bin
+  double xsec_max = -1;
+  unsigned int ip = cache_branch->LowerBound(Ehi * (1 - 1E-9));
+  if (ip < cache_branch->NPoints() &&
+      TMath::Abs(cache_branch->X()[ip] - Ehi) < 1E-9 * Ehi) {
+     xsec_max = cache_branch->Y()[ip];
+  } else {
+     xsec_max = kNSVMaxXSecSafety * TMath::Max(
+        this->ComputeNSVMaxXSec(interaction, Elo),
+        this->ComputeNSVMaxXSec(interaction, Ehi));
+     cache_branch->AddValues(Ehi, xsec_max);
+  }
+
+  LOG("MEC", pNOTICE)
+     << "Max XSec for Enu in [" << Elo << ", " << Ehi << "] GeV = " << xsec_max;
+
+  maxima[ibin] = xsec_max;
+  return &(maxima[ibin]);
+}
+//___________________________________________________________________________
+double MECGenerator::ComputeNSVMaxXSec(
+   const Interaction * interaction, double Enu) const
+{
+// Max delta-less all cross section at the probe energy Enu: scanned on a
+// (q0,q3) grid, which covers the hadron tensor range whatever the energy,
+// then refined around the largest value found
+
+  Interaction * in = new Interaction(*interaction);
+  in->InitStatePtr()->SetProbeE(Enu);
+  if (in->InitState().ProbePdg() > 0) {
+     in->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterNN);
+  } else {
+     in->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterPP);
+  }
+  in->ExclTagPtr()->SetResonance(genie::kNoResonance);
+
+  double dq = fQ3Max / kNSVNScan;
+  double xsec_max = 0;
+  double q0_max = 0;
+  double q3_max = 0;
+  for (int i = 1; i <= kNSVNScan; i++) {
+     for (int j = 1; j <= kNSVNScan; j++) {
+        double xsec = this->NSVXSec(in, i*dq, j*dq);
+        if (xsec > xsec_max) {
+           xsec_max = xsec;
+           q0_max   = i*dq;
+           q3_max   = j*dq;
+        }
+     }
+  }
+
+  if (xsec_max > 0) {
+     double step = dq/2;
+     for (int r = 0; r < kNSVNRefine; r++) {
+        double q0c = q0_max;
+        double q3c = q3_max;
+        for (int i = -1; i <= 1; i++) {
+           for (int j = -1; j <= 1; j++) {
+              if (i == 0 && j == 0) continue;
+              double xsec = this->NSVXSec(in, q0c + i*step, q3c + j*step);
+              if (xsec > xsec_max) {
+                 xsec_max = xsec;
+                 q0_max   = q0c + i*step;
+                 q3_max   = q3c + j*step;
+              }
+           }
+        }
+        step /= 2;
+     }
+  }
+  delete in;
+
+  return xsec_max;
+}
+//___________________________________________________________________________
+double MECGenerator::NSVXSec(
+   Interaction * interaction, double q0, double q3) const
+{
+// Cross section at the lepton kinematics (Tl, costl) of the energy and
+// momentum transfer (q0,q3); 0 if these are not allowed
+
+  if (q0 <= 0 || q3 <= 0 || q3 > fQ3Max) return 0.;
+
+  double Enu = interaction->InitState().ProbeE(kRfLab);
+  double ml  = interaction->FSPrimLepton()->Mass();
+
+  double T = Enu - q0 - ml;
+  if (T <= 0) return 0.;
+  double Plep  = TMath::Sqrt(T * (T + 2.0 * ml));
+  double Costh = (Plep*Plep + Enu*Enu - q3*q3) / (2.0 * Plep * Enu);
+  if (Costh < -1 || Costh > 1) return 0.;
+
+  interaction->KinePtr()->SetKV(kKVTl,  T);
+  interaction->KinePtr()->SetKV(kKVctl, Costh);
+  return fXSecModel->XSec(interaction, kPSTlctl);
+}
+//___________________________________________________________________________
+void MECGenerator::ResolveAlgs(const Interaction * in, ResolvedAlgs & algs) const
+{
+  const Target & tgt = in->InitState().Tgt();
+  if(!tgt.IsNucleus()) return;
+
+  algs.AddResolved(fNuclModel, fNuclModel->SelectModel(tgt));
+}
+//___________________________________________________________________________
+const NuclearModelI * MECGenerator::NuclModel(const GHepRecord * event) const
+{
+// The nuclear model selected once for the channel's target, if any
+
+  const Interaction * interaction = event->Summary();
+  const ResolvedAlgs * algs = interaction->ResolvedAlgsPtr();
+  if(algs && algs->TgtPdg() == interaction->InitState().Tgt().Pdg()) {
+    return algs->Resolved(fNuclModel);
+  }
+  return fNuclModel;
+}
+//___________________________________________________________________________
 void MECGenerator::Configure(const Registry & config)   
 {
     Algorithm::Configure(config);
@@ -22,15 +22,18 @@
 #ifndef _MEC_GENERATOR_H_
 #define _MEC_GENERATOR_H_
 
-#include <TGenPhaseSpace.h>
+#include <map>
+#include <string>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/PhaseSpaceDecayer.h"
 
 namespace genie {
 
 class XSecAlgorithmI;
 class NuclearModelI;
+class Interaction;
 
 class MECGenerator : public EventRecordVisitorI {
 
@@ -42,6 +45,9 @@ public :
   // implement the EventRecordVisitorI interface
   void ProcessEventRecord (GHepRecord * event) const;
 
+  // select the nuclear model once for each channel (see ResolvedAlgs)
+  void ResolveAlgs (const Interaction * in, ResolvedAlgs & algs) const;
+
   // overload the Algorithm::Configure() methods to load private data
   // members from configuration options
   void Configure(const Registry & config);
@@ -59,13 +65,22 @@ private:
   void    DecayNucleonCluster               (GHepRecord * event) const;
   void    SelectNSVLeptonKinematics         (GHepRecord * event) const;
   void    GenerateNSVInitialHadrons         (GHepRecord * event) const;
+  const NuclearModelI * NuclModel           (const GHepRecord * event) const;
   PDGCodeList NucleonClusterConstituents    (int pdgc)           const;
+
+  // max NSV cross section (with the safety factor) in the energy bin of Enu,
+  // cached on first use; may be raised by the caller if exceeded
+  double * NSVMaxXSec        (const Interaction * interaction, double Enu) const;
+  double   ComputeNSVMaxXSec (const Interaction * interaction, double Enu) const;
+  double   NSVXSec           (Interaction * interaction, double q0, double q3) const;
   
   mutable const XSecAlgorithmI * fXSecModel;
-  mutable TGenPhaseSpace         fPhaseSpaceGenerator;
+  mutable PhaseSpaceDecayer      fPhaseSpaceDecayer;
   const NuclearModelI *          fNuclModel;
 
   double fQ3Max;
+
+  mutable std::map<std::string, std::map<int, double> > fNSVMaxXSec; ///< max NSV xsec per cache branch and energy bin
 };
 
 }      // genie namespace
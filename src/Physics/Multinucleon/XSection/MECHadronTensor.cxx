@@ -9,18 +9,26 @@
 //_________________________________________________________________________
 
 #include <cstdlib>
+#include <cstdio>
+#include <cstring>
 #include <string>
+#include <sstream>
 #include <fstream>
 #include <cassert>
 #include <algorithm>
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
-#include "Framework/Numerical/BLI2D.h"
+#include "Framework/Utils/MemoryStats.h"
 #include "Physics/Multinucleon/XSection/MECHadronTensor.h"
 
 #include <TSystem.h>
@@ -33,6 +41,109 @@ using std::ios;
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+
+  // binary form of the tensor tables of a target: the header, then the
+  // ntypes x nq3 x nq0 x ncomponents table values
+  struct MECTensorBinHeader {
+    char               magic[8];
+    unsigned int       version;
+    unsigned int       byte_order;
+    unsigned int       ncomponents;
+    unsigned int       ntypes;
+    unsigned int       nq3;
+    unsigned int       nq0;
+    double             q3min;
+    double             q0min;
+    double             dq3;
+    double             dq0;
+    unsigned long long key;        ///< hash of the source text files
+    unsigned long long file_size;
+  };
+
+  const char         kMECTensorBinMagic[8] = {'G','M','E','C','H','T','B','N'};
+  const unsigned int kMECTensorBinVersion  = 1;
+  const unsigned int kMECTensorBinOrder    = 0x01020304;
+
+  // dimensions of the data in the hadron tensor text files.
+  // if later we use tables that are not 120x120
+  // then extract these constants to the config file with the input table specs
+  // or find a way for the input tables to be self-descriptive.
+  const int    kNQ0Points = 120;
+  const int    kNQzPoints = 120;
+  const double kArrayStep = 0.01; // GeV, q0 and qz of the first point too
+  const int    kNTensorTypes = MECHadronTensor::kMHTValenciaDeltapn + 1;
+
+  // FNV-1a hash of the name, size and modification time of a file, folded
+  // into hash: a changed text table changes the key of its binary form
+  unsigned long long HashFileInfo(const string & filename, unsigned long long hash)
+  {
+    ostringstream info;
+    info << filename;
+    struct stat st;
+    if(stat(filename.c_str(), &st) == 0) {
+      info << ":" << (long long) st.st_size << ":" << (long long) st.st_mtime;
+    }
+    string text = info.str();
+    for(string::size_type i = 0; i < text.size(); i++) {
+      hash ^= (unsigned char) text[i];
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+}
+
+//_________________________________________________________________________
+const int MECHadronTensor::kNTensorComponents;
+//_________________________________________________________________________
+MECHadronTensor::MECHadronTensorGrid::MECHadronTensorGrid() :
+fNQ3(0), fNQ0(0), fQ3Min(0), fQ0Min(0), fDQ3(0), fDQ0(0), fW(0)
+{
+
+}
+//_________________________________________________________________________
+MECHadronTensor::MECHadronTensorGrid::MECHadronTensorGrid(
+  int nq3, double q3min, double dq3,
+  int nq0, double q0min, double dq0, const double * w) :
+fNQ3(nq3), fNQ0(nq0), fQ3Min(q3min), fQ0Min(q0min), fDQ3(dq3), fDQ0(dq0), fW(w)
+{
+
+}
+//_________________________________________________________________________
+void MECHadronTensor::MECHadronTensorGrid::Evaluate(
+  double q0, double q3, double * w) const
+{
+// Bilinear interpolation of all the components in the (uniform) grid cell
+// of (q3,q0), located by index arithmetic. As BLI2DNonUnifGrid::Evaluate,
+// points outside the grid are moved to its edge.
+
+  const int nc = kNTensorComponents;
+
+  if(fNQ3 < 2 || fNQ0 < 2 || !fW) {
+    for(int k = 0; k < nc; k++) w[k] = 0.;
+    return;
+  }
+
+  double x = (std::min(std::max(q3, fQ3Min), this->Q3Max()) - fQ3Min) / fDQ3;
+  double y = (std::min(std::max(q0, fQ0Min), this->Q0Max()) - fQ0Min) / fDQ0;
+  int ix = std::min((int) x, fNQ3-2);
+  int iy = std::min((int) y, fNQ0-2);
+  double tx = x - ix;
+  double ty = y - iy;
+
+  const double * w11 = fW + (ix*fNQ0 + iy) * nc;  // (ix  , iy  )
+  const double * w12 = w11 + nc;                  // (ix  , iy+1)
+  const double * w21 = w11 + fNQ0*nc;             // (ix+1, iy  )
+  const double * w22 = w21 + nc;                  // (ix+1, iy+1)
+
+  double c11 = (1-tx)*(1-ty);
+  double c21 =    tx *(1-ty);
+  double c12 = (1-tx)*   ty;
+  double c22 =    tx *   ty;
+  for(int k = 0; k < nc; k++) {
+    w[k] = c11*w11[k] + c21*w21[k] + c12*w12[k] + c22*w22[k];
+  }
+}
 //_________________________________________________________________________
 MECHadronTensor * MECHadronTensor::fgInstance = 0;
 //_________________________________________________________________________
@@ -71,20 +182,10 @@ MECHadronTensor::MECHadronTensor()
 //_________________________________________________________________________
 MECHadronTensor::~MECHadronTensor()
 {
-	vector<int>::const_iterator it=fKnownTensors.begin();
-	for( ; it!=fKnownTensors.end(); ++it) {
-		MECHadronTensor::MECHadronTensorTable table = fTargetTensorTables[*it];
-		for(int tensorType = 0; tensorType <= MECHadronTensor::kMHTValenciaDeltapn; ++tensorType) {
-			vector<genie::BLI2DNonUnifGrid*> Grids = table.Table[(MECHadronTensor::MECHadronTensorType_t)tensorType];
-			for (vector<genie::BLI2DNonUnifGrid*>::iterator gridit = Grids.begin() ; gridit != Grids.end(); ++gridit){
-				genie::BLI2DNonUnifGrid *hadTensorGrid = *gridit;
-				if(hadTensorGrid) {
-				  delete hadTensorGrid;
-				  hadTensorGrid=0;
-				}
-			}
-		}
-	}  
+  for(unsigned int i = 0; i < fMappedFiles.size(); i++) {
+    munmap(fMappedFiles[i].first, fMappedFiles[i].second);
+  }
+  fMappedFiles.clear();
 }
 //_________________________________________________________________________
 MECHadronTensor * MECHadronTensor::Instance()
@@ -94,10 +195,41 @@ MECHadronTensor * MECHadronTensor::Instance()
     static MECHadronTensor::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
     fgInstance = new MECHadronTensor();
+    MemoryStats::Instance()->Register("MECHadronTensor", MECHadronTensor::ReportMemory);
   }  
   return fgInstance;
 }
 //_________________________________________________________________________
+void MECHadronTensor::ReportMemory(MemoryStats & stats)
+{
+  if(fgInstance == 0) return;
+
+  long int ngrids = 0;
+  std::map<int, MECHadronTensorTable>::const_iterator t_iter;
+  for(t_iter  = fgInstance->fTargetTensorTables.begin();
+      t_iter != fgInstance->fTargetTensorTables.end(); ++t_iter) {
+    ngrids += t_iter->second.Table.size();
+  }
+  stats.Add("MECHadronTensor", "tensor grids (views)",
+            ngrids * (sizeof(MECHadronTensorGrid) + 4*sizeof(void *)), ngrids);
+
+  double bytes = 0;
+  std::map<int, vector<double> >::const_iterator d_iter;
+  for(d_iter  = fgInstance->fTensorData.begin();
+      d_iter != fgInstance->fTensorData.end(); ++d_iter) {
+    bytes += d_iter->second.capacity() * sizeof(double);
+  }
+  stats.Add("MECHadronTensor", "tensor tables parsed from text files",
+            bytes, (long int) fgInstance->fTensorData.size());
+
+  bytes = 0;
+  for(unsigned int i = 0; i < fgInstance->fMappedFiles.size(); i++) {
+    bytes += fgInstance->fMappedFiles[i].second;
+  }
+  stats.Add("MECHadronTensor", "mapped tensor table files",
+            bytes, (long int) fgInstance->fMappedFiles.size());
+}
+//_________________________________________________________________________
 bool MECHadronTensor::KnownTarget(int targetpdg)
 {
   if(std::count(fKnownTensors.begin(), fKnownTensors.end(), targetpdg)!=0) {
@@ -121,30 +253,35 @@ bool MECHadronTensor::KnownTensor(int targetpdg)
   return std::count(fKnownTensors.begin(), fKnownTensors.end(), targetpdg)!=0;  
 }
 //_________________________________________________________________________
-const vector<genie::BLI2DNonUnifGrid *> &
-   MECHadronTensor::TensorTable(int targetpdg, MECHadronTensorType_t type)
+const MECHadronTensor::MECHadronTensorGrid *
+   MECHadronTensor::TensorGrid(int targetpdg, MECHadronTensorType_t type) const
 {
-  return fTargetTensorTables[targetpdg].Table[type];
+  std::map<int, MECHadronTensorTable>::const_iterator tgt_iter =
+     fTargetTensorTables.find(targetpdg);
+  if(tgt_iter == fTargetTensorTables.end()) return 0;
+
+  map<MECHadronTensorType_t, MECHadronTensorGrid>::const_iterator grid_iter =
+     tgt_iter->second.Table.find(type);
+  if(grid_iter == tgt_iter->second.Table.end()) return 0;
+
+  return &(grid_iter->second);
 }
 //_________________________________________________________________________
 void MECHadronTensor::LoadTensorTables(int targetpdg)
 {
 // Load the hadron tensor tables.
 // For the Nieves model they are in ${GENIE}/data/evgen/mectensor/nieves/
-  
-  // define dimensions of data in the hadron tensor files
-  int nwpoints = 5;
-  const int nq0points = 120;  
-  const int nqzpoints = 120;  
-  const int nq0qzpoints = nq0points*nqzpoints;
-  double arraystep = 0.01; // GeV
-  // if later we use tables that are not 120x120
-  // then extract these constants to the config file with the input table specs
-  // or find a way for the input tables to be self-descriptive.
+// If $GMECTENSORCACHE names a directory, the binary form of the tables kept
+// there is mapped instead of parsing the text files, or written there after
+// parsing them if it is missing or out of date.
+
+  const int nwpoints    = kNTensorComponents;
+  const int nq0qzpoints = kNQ0Points*kNQzPoints;
 
   string tensorLocation  = string("/data/evgen/mectensor/nieves");
   string tensorFileStart = "HadTensor120-Nieves-";
   string tensorFileEnd   = "-20150210.dat";
+  string binaryFileEnd   = "-20150210.bin";
 
   if(!KnownTarget(targetpdg)){
     LOG("MECHadronTensor", pERROR) 
@@ -157,22 +294,6 @@ void MECHadronTensor::LoadTensorTables(int targetpdg)
   // Ideally, the xml configuration can override the default location
   string data_dir = string(gSystem->Getenv("GENIE")) + tensorLocation;
 
-  // define arrays to fill from data files
-  double hadtensor_q0_array[nq0points];
-  double hadtensor_qz_array[nqzpoints];
-  double hadtensor_w_array[nwpoints][nq0qzpoints];
-
-  // fill q0 array (in GeV)
-  // 240 5MeV bins or 120 10 MeV bins
-  for (int a = 0; a < nq0points; a++){
-    hadtensor_q0_array[a]=double(a+1)*arraystep;
-  }
-
-  // fill qz array (in GeV)
-  for (int a = 0; a < nqzpoints; a++){
-    hadtensor_qz_array[a]=double(a+1)*arraystep;
-  }
-  
   // possible future feature, allow a model to not deliver Delta tensors.
   std::map<MECHadronTensor::MECHadronTensorType_t, std::string> tensorTypeNames;
   tensorTypeNames[MECHadronTensor::kMHTValenciaFullAll]  = "FullAll";
@@ -180,65 +301,188 @@ void MECHadronTensor::LoadTensorTables(int targetpdg)
   tensorTypeNames[MECHadronTensor::kMHTValenciaDeltaAll] = "DeltaAll";
   tensorTypeNames[MECHadronTensor::kMHTValenciaDeltapn]  = "Deltapn";
 
-  // iterate over all four hadron tensor types in the map above.
-  for(int tensorType = 0; 
-          tensorType <= MECHadronTensor::kMHTValenciaDeltapn; ++tensorType) {
-
-    // build filenames from the bits of string
+  // build filenames from the bits of string, and the key of the binary form
+  vector<string> datafiles;
+  unsigned long long key = 14695981039346656037ULL;
+  for(int tensorType = 0; tensorType < kNTensorTypes; ++tensorType) {
     ostringstream datafile;
     datafile << data_dir << "/" << tensorFileStart << targetpdg << "-" 
 	     << tensorTypeNames[(MECHadronTensor::MECHadronTensorType_t)tensorType]
 	     << tensorFileEnd;
+    datafiles.push_back(datafile.str());
+    key = HashFileInfo(datafile.str(), key);
+  }
+
+  // use the binary form if available and up to date
+  string binaryfile = "";
+  const char * cache = gSystem->Getenv("GMECTENSORCACHE");
+  if(cache && strlen(cache) > 0) {
+    ostringstream name;
+    name << cache << "/" << tensorFileStart << targetpdg << binaryFileEnd;
+    binaryfile = name.str();
+    if(this->MapBinaryTables(targetpdg, binaryfile, key)) return;
+  }
+
+  // iterate over all four hadron tensor types in the map above.
+  vector<double> & data = fTensorData[targetpdg];
+  data.assign(kNTensorTypes * nq0qzpoints * nwpoints, 0.);
+  for(int tensorType = 0; tensorType < kNTensorTypes; ++tensorType) {
 
     // make sure data files are available
     LOG("MECHadronTensor", pDEBUG) 
-       << "Asserting that file " << datafile.str().c_str() << " exists...";      
-    assert (! gSystem->AccessPathName(datafile.str().c_str()));
+       << "Asserting that file " << datafiles[tensorType] << " exists...";      
+    assert (! gSystem->AccessPathName(datafiles[tensorType].c_str()));
   
-    // read data file
-    ReadHadTensorqzq0File(
-      datafile.str(), nwpoints, nqzpoints, nq0points, hadtensor_w_array
+    // read data file, interleaving the 5 tensors
+    bool ok = ReadHadTensorqzq0File(
+      datafiles[tensorType], nwpoints, kNQzPoints, kNQ0Points,
+      &data[tensorType * nq0qzpoints * nwpoints]
     );
-  
-    //loop over all 5 tensors 
-    for (int i = 0; i < nwpoints; i++){
-   
-      // create a non uniform grid from tensor data
-      genie::BLI2DNonUnifGrid *hadTensorGrid = 
-           new genie::BLI2DNonUnifGrid(
-               nqzpoints, 
-               nq0points, 
-               hadtensor_qz_array, 
-               hadtensor_q0_array, 
-               hadtensor_w_array[i]
-           );
-
-      // and store in a map using the target PDG as a key
-      fTargetTensorTables[targetpdg].Table[
-         (MECHadronTensor::MECHadronTensorType_t)tensorType].push_back(hadTensorGrid);
-    }
+    if(!ok) binaryfile = "";  // don't save a partial table
+  }
+
+  // create the uniform grids from tensor data
+  this->SetTensorGrids(targetpdg, &data[0]);
+
+  if(!binaryfile.empty()) this->WriteBinaryTables(binaryfile, key, data);
+}
+//_________________________________________________________________________
+void MECHadronTensor::SetTensorGrids(int targetpdg, const double * data)
+{
+  const int ngridvalues = kNQ0Points * kNQzPoints * kNTensorComponents;
+
+  MECHadronTensorTable & table = fTargetTensorTables[targetpdg];
+  for(int tensorType = 0; tensorType < kNTensorTypes; ++tensorType) {
+    // the first point of both axes is at one step
+    table.Table[(MECHadronTensor::MECHadronTensorType_t)tensorType] =
+       MECHadronTensorGrid(
+          kNQzPoints, kArrayStep, kArrayStep,
+          kNQ0Points, kArrayStep, kArrayStep,
+          data + tensorType * ngridvalues);
+  }
+}
+//_________________________________________________________________________
+bool MECHadronTensor::MapBinaryTables(
+  int targetpdg, const string & filename, unsigned long long key)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) return false;
+
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(MECTensorBinHeader)) {
+    close(fd);
+    return false;
+  }
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) return false;
+
+  const MECTensorBinHeader * header = (const MECTensorBinHeader *) addr;
+  size_t nvalues = (size_t) kNTensorTypes * kNQzPoints * kNQ0Points * kNTensorComponents;
+  bool ok =
+     memcmp(header->magic, kMECTensorBinMagic, sizeof(header->magic)) == 0 &&
+     header->version     == kMECTensorBinVersion &&
+     header->byte_order  == kMECTensorBinOrder   &&
+     header->ncomponents == (unsigned int) kNTensorComponents &&
+     header->ntypes      == (unsigned int) kNTensorTypes &&
+     header->nq3         == (unsigned int) kNQzPoints &&
+     header->nq0         == (unsigned int) kNQ0Points &&
+     header->q3min       == kArrayStep && header->dq3 == kArrayStep &&
+     header->q0min       == kArrayStep && header->dq0 == kArrayStep &&
+     header->key         == key &&
+     header->file_size   == size &&
+     size == sizeof(MECTensorBinHeader) + nvalues * sizeof(double);
+  if(!ok) {
+    LOG("MECHadronTensor", pNOTICE)
+      << "Binary MEC tensor tables " << filename 
+      << " are out of date - Rebuilding them";
+    munmap(addr, size);
+    return false;
   }
+
+  fMappedFiles.push_back(std::pair<void *, size_t>(addr, size));
+  this->SetTensorGrids(targetpdg, 
+     (const double *) ((const char *) addr + sizeof(MECTensorBinHeader)));
+
+  LOG("MECHadronTensor", pINFO) 
+    << "Mapped binary MEC tensor tables " << filename;
+  return true;
 }
 //_________________________________________________________________________
-void MECHadronTensor::ReadHadTensorqzq0File( 
+void MECHadronTensor::WriteBinaryTables(
+  const string & filename, unsigned long long key, 
+  const vector<double> & data) const
+{
+// The tables are written to a temporary file which is then renamed, so that
+// concurrent jobs never map a partially written file
+
+  MECTensorBinHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kMECTensorBinMagic, sizeof(header.magic));
+  header.version     = kMECTensorBinVersion;
+  header.byte_order  = kMECTensorBinOrder;
+  header.ncomponents = kNTensorComponents;
+  header.ntypes      = kNTensorTypes;
+  header.nq3         = kNQzPoints;
+  header.nq0         = kNQ0Points;
+  header.q3min       = kArrayStep;
+  header.q0min       = kArrayStep;
+  header.dq3         = kArrayStep;
+  header.dq0         = kArrayStep;
+  header.key         = key;
+  header.file_size   = sizeof(header) + data.size() * sizeof(double);
+
+  ostringstream tmpname;
+  tmpname << filename << ".tmp." << gSystem->GetPid();
+
+  std::ofstream binary(tmpname.str().c_str(), ios::binary);
+  binary.write((const char *) &header, sizeof(header));
+  binary.write((const char *) &data[0], data.size() * sizeof(double));
+  binary.close();
+
+  if(!binary || std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    LOG("MECHadronTensor", pWARN) 
+      << "Couldn't write binary MEC tensor tables " << filename;
+    std::remove(tmpname.str().c_str());
+    return;
+  }
+
+  LOG("MECHadronTensor", pNOTICE) 
+    << "Saved binary MEC tensor tables to " << filename;
+}
+//_________________________________________________________________________
+bool MECHadronTensor::ReadHadTensorqzq0File( 
   string filename, int nwpoints, int nqzpoints, int nq0points, 
-  double hadtensor_w_array[][14400])
+  double * hadtensor_w)
 {
   // open file
-  std::ifstream tensor_stream(filename.c_str(), ios::in);
+  std::ifstream tensor_stream(filename.c_str(), ios::in | ios::binary);
 
   // check file exists
   if(!tensor_stream.good()){
     LOG("MECHadronTensor", pERROR) << "Bad file name: " << filename;
-    return;
+    return false;
   }
 
-  double temp;  
-  for (int ij = 0; ij < (nqzpoints*nq0points); ij++){  
-    for (int k = 0; k < nwpoints; k++) {
-      tensor_stream >> temp;
-      hadtensor_w_array[k][ij]=temp;
+  // read the whole file at once and convert the values with strtod
+  ostringstream contents;
+  contents << tensor_stream.rdbuf();
+  string text = contents.str();
+
+  const char * pos = text.c_str();
+  int nvalues = nqzpoints*nq0points*nwpoints;
+  for (int i = 0; i < nvalues; i++){
+    char * end = 0;
+    double temp = std::strtod(pos, &end);
+    if(end == pos) {
+      LOG("MECHadronTensor", pERROR) 
+        << "Read " << i << " of " << nvalues << " values from: " << filename;
+      return false;
     }
+    hadtensor_w[i] = temp;
+    pos = end;
   }
+  return true;
 }
 //_________________________________________________________________________
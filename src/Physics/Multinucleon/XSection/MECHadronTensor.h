@@ -7,6 +7,14 @@
           to aid in the implementation (and improve the CPU efficiency of)
           MEC cross-section models.
 
+          Each hadron tensor is stored on its uniform (q3, q0) grid with its
+          five independent components (W00, W0z, Wxx, Wxy, Wzz) interleaved
+          per grid point, so that all of them are interpolated at once, with
+          a single cell lookup. If $GMECTENSORCACHE names a directory, the
+          tables parsed from the text files of a target are saved there in a
+          binary form, which later jobs memory-map (read-only, so the pages
+          are shared by all jobs on a node) instead of parsing the text.
+
 \author   Code contributed by Jackie Schwehr
           Substantial refactorization by the core GENIE group.
 
@@ -29,19 +37,21 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <utility>
+#include <cstddef>
 
 #ifndef ROOT_Rtypes
 #include "Rtypes.h"
 #endif
 
-#include "Framework/Numerical/BLI2D.h"
-
 using std::map;
 using std::vector;
 using std::string;
 
 namespace genie {
 
+class MemoryStats;
+
 class MECHadronTensor
 {
 public:
@@ -59,6 +69,41 @@ public:
   } 
   MECHadronTensorType_t;
 
+  // number of independent hadron tensor components: W00, W0z, Wxx, Wxy, Wzz
+  static const int kNTensorComponents = 5;
+
+  // ................................................................
+  // MEC hadron tensor grid: the tensor components on a uniform (q3,q0)
+  // grid, interleaved per grid point (the grid owns no data)
+  //
+
+  class MECHadronTensorGrid
+  {
+  public:
+     MECHadronTensorGrid();
+     MECHadronTensorGrid(int nq3, double q3min, double dq3,
+                         int nq0, double q0min, double dq0, const double * w);
+    ~MECHadronTensorGrid() { }
+
+     //! Interpolate all the tensor components at (q0,q3), clamped to the
+     //! grid, in w[kNTensorComponents]
+     void   Evaluate (double q0, double q3, double * w) const;
+
+     double Q0Min    (void) const { return fQ0Min; }
+     double Q0Max    (void) const { return fQ0Min + (fNQ0-1)*fDQ0; }
+     double Q3Min    (void) const { return fQ3Min; }
+     double Q3Max    (void) const { return fQ3Min + (fNQ3-1)*fDQ3; }
+
+  private:
+     int            fNQ3;
+     int            fNQ0;
+     double         fQ3Min;
+     double         fQ0Min;
+     double         fDQ3;
+     double         fDQ0;
+     const double * fW;    ///< components at (iq3,iq0): fW[(iq3*fNQ0+iq0)*kNTensorComponents + k]
+  };
+
   // ................................................................
   // MEC hadron tensor table
   //
@@ -67,8 +112,8 @@ public:
   {
   public:
      MECHadronTensorTable() { }
-    ~MECHadronTensorTable() { /* note: should delete the grids! */ }
-     map<MECHadronTensor::MECHadronTensorType_t, vector<genie::BLI2DNonUnifGrid *> > Table;
+    ~MECHadronTensorTable() { }
+     map<MECHadronTensor::MECHadronTensorType_t, MECHadronTensorGrid> Table;
   };
 
   // ................................................................
@@ -81,9 +126,9 @@ public:
   // method to return whether the targetpdg is in fKnownTensors
   bool KnownTensor(int targetpdg);
 
-  // method to access a specific set of tables
-  const vector<genie::BLI2DNonUnifGrid *> &
-     TensorTable(int targetpdg, MECHadronTensor::MECHadronTensorType_t type);
+  // method to access a specific tensor grid (null if not available)
+  const MECHadronTensorGrid *
+     TensorGrid(int targetpdg, MECHadronTensor::MECHadronTensorType_t type) const;
 
 private:
 
@@ -100,15 +145,33 @@ private:
   //        This will also need to be extended to load tensors for requested model.
   void LoadTensorTables(int targetpdg);
 
+  // Binary form of the tables of a target, made from the text files with
+  // the given key (false if missing, out of date or corrupted)
+  bool MapBinaryTables  (int targetpdg, const string & filename, unsigned long long key);
+  void WriteBinaryTables(const string & filename, unsigned long long key,
+                         const vector<double> & data) const;
+
+  // Sets the grids of a target to the tables (all tensor types) in data
+  void SetTensorGrids   (int targetpdg, const double * data);
+
+  // Reports the memory held by the tables (see MemoryStats)
+  static void ReportMemory(MemoryStats & stats);
+
   // This map holds all known tensor tables (target PDG code is the key)
   std::map<int, MECHadronTensorTable> fTargetTensorTables;
 
+  // Tables of the targets parsed from the text files (all tensor types),
+  // and the binary table files mapped in memory
+  std::map<int, vector<double> >          fTensorData;
+  std::vector<std::pair<void *, size_t> > fMappedFiles;
+
   // List of targets for which we can provide a calculation
   // some known targets use scale from the tensor table from another target.
   std::vector<int> fKnownTensors;
 
-  // that array size 14400 is 120x120.  Could go dynamic in the future, or not.
-  void ReadHadTensorqzq0File(string filename, int nwpoints, int nqzpoints, int nq0points, double hadtensor_w_array[][14400]);
+  // reads the nqzpoints x nq0points grid points of a file, with nwpoints
+  // components each, interleaved in hadtensor_w
+  bool ReadHadTensorqzq0File(string filename, int nwpoints, int nqzpoints, int nq0points, double * hadtensor_w);
 
   // singleton cleaner
   struct Cleaner {
@@ -39,6 +39,14 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+namespace {
+  ROOT::Math::IBaseFunctionMultiDim * MakeIntegrand(
+      const XSecAlgorithmI * model, const Interaction * in)
+  {
+    return new utils::gsl::d2Xsec_dTCosth(model, in);
+  }
+}
+
 //____________________________________________________________________________
 MECXSec::MECXSec() :
 XSecIntegratorI("genie::MECXSec")
@@ -93,16 +101,9 @@ double MECXSec::Integrate(
   double xsec = 0;
 
   double abstol = 1; //We mostly care about relative tolerance.
-  ROOT::Math::IBaseFunctionMultiDim * func = 
-        new utils::gsl::d2Xsec_dTCosth(model, interaction);
-  ROOT::Math::IntegrationMultiDim::Type ig_type = 
-    utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);        
-  ROOT::Math::IntegratorMultiDim ig(
-    *func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-  
-  xsec = ig.Integral(kine_min, kine_max); 
+  xsec = this->IntegrateNDim(MakeIntegrand, model, interaction,
+             2, kine_min, kine_max, abstol, false);
 
-  delete func;
   delete interaction;   
 
   return xsec;
@@ -134,6 +135,8 @@ void MECXSec::LoadConfig(void)
   GetParamDef( "gsl-relative-tolerance", fGSLRelTol, 0.01 ) ;
   GetParamDef( "split-integral", fSplitIntegral, true ) ;
 
+  this->LoadIntegratorConfig();
+
 }
 //_____________________________________________________________________________
 // GSL wrappers
@@ -135,13 +135,14 @@ double NievesSimoVacasMECPXSec2016::XSec(
     double Q0    = 0;
     double Q3    = 0;
     genie::utils::mec::Getq0q3FromTlCostl(Tl, costl, Ev, ml, Q0, Q3);
-    const vector <genie::BLI2DNonUnifGrid *> &
-        tensor_table = hadtensor->TensorTable(
+    const MECHadronTensor::MECHadronTensorGrid *
+        tensor_grid = hadtensor->TensorGrid(
                 tensorpdg, MECHadronTensor::kMHTValenciaFullAll);
-    double Q0min = tensor_table[0]->XMin();
-    double Q0max = tensor_table[0]->XMax();
-    double Q3min = tensor_table[0]->YMin();
-    double Q3max = tensor_table[0]->YMax();
+    if(!tensor_grid) return 0.0;
+    double Q0min = tensor_grid->Q0Min();
+    double Q0max = tensor_grid->Q0Max();
+    double Q3min = tensor_grid->Q3Min();
+    double Q3max = tensor_grid->Q3Max();
     if(Q0 < Q0min || Q0 > Q0max || Q3 < Q3min || Q3 > Q3max) {
         return 0.0;
     }
@@ -0,0 +1,376 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include <TMath.h>
+#include <TFile.h>
+#include <TTree.h>
+#include <TNamed.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/MuonEnergyLoss/MuELossI.h"
+#include "Physics/MuonEnergyLoss/MuELossTable.h"
+
+using std::endl;
+using std::setw;
+using std::ostringstream;
+
+using namespace genie;
+using namespace genie::mueloss;
+
+//____________________________________________________________________________
+namespace genie {
+ namespace mueloss {
+  ostream & operator << (ostream & stream, const MuELossTable & table)
+  {
+    table.Print(stream);
+    return stream;
+  }
+ }
+}
+//____________________________________________________________________________
+MuELossTable::MuELossTable()
+{
+
+}
+//____________________________________________________________________________
+MuELossTable::~MuELossTable()
+{
+
+}
+//____________________________________________________________________________
+void MuELossTable::AddMaterial(MuELMaterial_t material, double weight)
+{
+  if(material == eMuUndefined || weight <= 0) {
+    LOG("MuELoss", pWARN)
+      << "Ignoring material " << MuELMaterial::AsString(material)
+      << " with weight fraction " << weight;
+    return;
+  }
+  fMaterials.push_back(material);
+  fWeights  .push_back(weight);
+
+  // any tables refer to the previous mix
+  fEnergy.clear();
+  fRange .clear();
+  for(int ip = 0; ip < 5; ip++) fdEdx[ip].clear();
+}
+//____________________________________________________________________________
+string MuELossTable::Composition(void) const
+{
+// A key for the material mix: material ids with normalized weight fractions
+
+  double wsum = 0;
+  for(unsigned int im = 0; im < fWeights.size(); im++) wsum += fWeights[im];
+
+  ostringstream key;
+  for(unsigned int im = 0; im < fMaterials.size(); im++) {
+    if(im > 0) key << ",";
+    key << (int) fMaterials[im] << "[" << std::setprecision(6)
+        << fWeights[im]/wsum << "]";
+  }
+  return key.str();
+}
+//____________________________________________________________________________
+bool MuELossTable::Build(double Emin, double Emax, int nbins)
+{
+  if(fMaterials.size() == 0) {
+    LOG("MuELoss", pERROR) << "No materials were added to the table";
+    return false;
+  }
+  if(nbins < 2 || Emin <= MuELProcess::Threshold(eMupSum) ||
+     Emax <= Emin || Emax >= kMaxMuE) {
+    LOG("MuELoss", pERROR)
+      << "Invalid energy grid: " << nbins << " energies in ["
+      << Emin << ", " << Emax << "] GeV";
+    return false;
+  }
+
+  // the energy loss models, in the order of the process tables
+  const char * model_names[4] = {
+    "genie::mueloss::BetheBlochModel",
+    "genie::mueloss::KokoulinPetrukhinModel",
+    "genie::mueloss::PetrukhinShestakovModel",
+    "genie::mueloss::BezrukovBugaevModel"
+  };
+  AlgFactory * algf = AlgFactory::Instance();
+  const MuELossI * models[4];
+  for(int ip = 0; ip < 4; ip++) {
+    models[ip] = dynamic_cast<const MuELossI *> (
+                    algf->GetAlgorithm(model_names[ip], "Default"));
+    if(!models[ip]) {
+      LOG("MuELoss", pERROR) << "Couldn't get " << model_names[ip];
+      return false;
+    }
+  }
+
+  double wsum = 0;
+  for(unsigned int im = 0; im < fWeights.size(); im++) wsum += fWeights[im];
+
+  fEnergy.assign(nbins, 0.);
+  fRange .assign(nbins, 0.);
+  for(int ip = 0; ip < 5; ip++) fdEdx[ip].assign(nbins, 0.);
+
+  // -dE/dx per unit column density is additive in the weight fractions
+  double dlnE = TMath::Log(Emax/Emin) / (nbins-1);
+  for(int i = 0; i < nbins; i++) {
+    double E = Emin * TMath::Exp(i*dlnE);
+    fEnergy[i] = E;
+    for(int ip = 0; ip < 4; ip++) {
+      double dedx = 0;
+      for(unsigned int im = 0; im < fMaterials.size(); im++) {
+        dedx += fWeights[im]/wsum * models[ip]->dE_dx(E, fMaterials[im]);
+      }
+      fdEdx[ip][i]  = dedx;
+      fdEdx[4][i]  += dedx;
+    }
+    if(fdEdx[4][i] <= 0) {
+      LOG("MuELoss", pERROR)
+        << "Vanishing muon energy loss at E = " << E << " GeV in "
+        << this->Composition();
+      fEnergy.clear();
+      return false;
+    }
+  }
+
+  // R(E) = \int dE / (-dE/dx), integrated in lnE (trapezoidal rule) from the
+  // lowest grid energy, below which the residual range is neglected
+  fRange[0] = 0;
+  for(int i = 1; i < nbins; i++) {
+    double f0 = fEnergy[i-1] / fdEdx[4][i-1];
+    double f1 = fEnergy[i]   / fdEdx[4][i];
+    fRange[i] = fRange[i-1] + 0.5 * (f0 + f1) * dlnE;
+  }
+
+  LOG("MuELoss", pNOTICE)
+    << "Built muon energy loss tables for " << this->Composition()
+    << " at " << nbins << " energies in [" << Emin << ", " << Emax << "] GeV";
+
+  return true;
+}
+//____________________________________________________________________________
+bool MuELossTable::Save(string filename) const
+{
+  if(!this->IsBuilt()) {
+    LOG("MuELoss", pERROR) << "No tables to save";
+    return false;
+  }
+
+  TFile file(filename.c_str(), "recreate");
+  if(file.IsZombie()) {
+    LOG("MuELoss", pERROR) << "Couldn't open " << filename;
+    return false;
+  }
+
+  double E = 0, ion = 0, pair = 0, brem = 0, pnucl = 0, range = 0;
+  TTree * tree = new TTree("mueloss", "muon energy loss & range tables");
+  tree->Branch("E",     &E,     "E/D"    );
+  tree->Branch("ion",   &ion,   "ion/D"  );
+  tree->Branch("pair",  &pair,  "pair/D" );
+  tree->Branch("brem",  &brem,  "brem/D" );
+  tree->Branch("pnucl", &pnucl, "pnucl/D");
+  tree->Branch("range", &range, "range/D");
+  for(unsigned int i = 0; i < fEnergy.size(); i++) {
+    E     = fEnergy[i];
+    ion   = fdEdx[0][i];
+    pair  = fdEdx[1][i];
+    brem  = fdEdx[2][i];
+    pnucl = fdEdx[3][i];
+    range = fRange[i];
+    tree->Fill();
+  }
+  tree->Write();
+
+  TNamed composition("composition", this->Composition().c_str());
+  composition.Write();
+  file.Close();
+
+  LOG("MuELoss", pNOTICE)
+    << "Saved muon energy loss tables for " << this->Composition()
+    << " in " << filename;
+
+  return true;
+}
+//____________________________________________________________________________
+bool MuELossTable::Load(string filename)
+{
+  TFile file(filename.c_str(), "read");
+  if(file.IsZombie()) return false;
+
+  TNamed * composition = dynamic_cast<TNamed *> (file.Get("composition"));
+  TTree  * tree        = dynamic_cast<TTree  *> (file.Get("mueloss"));
+  if(!composition || !tree) {
+    LOG("MuELoss", pWARN) << filename << " holds no muon energy loss tables";
+    return false;
+  }
+  if(this->Composition() != composition->GetTitle()) {
+    LOG("MuELoss", pWARN)
+      << "The muon energy loss tables in " << filename << " are for "
+      << composition->GetTitle() << ", not for " << this->Composition();
+    return false;
+  }
+
+  double E = 0, ion = 0, pair = 0, brem = 0, pnucl = 0, range = 0;
+  tree->SetBranchAddress("E",     &E    );
+  tree->SetBranchAddress("ion",   &ion  );
+  tree->SetBranchAddress("pair",  &pair );
+  tree->SetBranchAddress("brem",  &brem );
+  tree->SetBranchAddress("pnucl", &pnucl);
+  tree->SetBranchAddress("range", &range);
+
+  int n = (int) tree->GetEntries();
+  fEnergy.assign(n, 0.);
+  fRange .assign(n, 0.);
+  for(int ip = 0; ip < 5; ip++) fdEdx[ip].assign(n, 0.);
+  for(int i = 0; i < n; i++) {
+    tree->GetEntry(i);
+    fEnergy[i]  = E;
+    fdEdx[0][i] = ion;
+    fdEdx[1][i] = pair;
+    fdEdx[2][i] = brem;
+    fdEdx[3][i] = pnucl;
+    fdEdx[4][i] = ion + pair + brem + pnucl;
+    fRange[i]   = range;
+  }
+  file.Close();
+
+  if(!this->IsBuilt()) {
+    LOG("MuELoss", pWARN) << filename << " holds empty tables";
+    return false;
+  }
+
+  LOG("MuELoss", pNOTICE)
+    << "Loaded muon energy loss tables for " << this->Composition()
+    << " from " << filename;
+
+  return true;
+}
+//____________________________________________________________________________
+double MuELossTable::Emin(void) const
+{
+  return (fEnergy.size() > 0) ? fEnergy.front() : 0.;
+}
+//____________________________________________________________________________
+double MuELossTable::Emax(void) const
+{
+  return (fEnergy.size() > 0) ? fEnergy.back() : 0.;
+}
+//____________________________________________________________________________
+int MuELossTable::ProcessIndex(MuELProcess_t p) const
+{
+  switch(p) {
+    case eMupIonization         : return 0; break;
+    case eMupPairProduction     : return 1; break;
+    case eMupBremsstrahlung     : return 2; break;
+    case eMupNuclearInteraction : return 3; break;
+    case eMupSum                : return 4; break;
+    case eMupUndefined          :
+    default                     : return -1;
+  }
+  return -1;
+}
+//____________________________________________________________________________
+double MuELossTable::Interpolate(const vector<double> & y, double E) const
+{
+// Linear interpolation in lnE on the grid, with the values at its edges
+// outside it
+
+  int n = fEnergy.size();
+  if(E <= fEnergy[0])   return y[0];
+  if(E >= fEnergy[n-1]) return y[n-1];
+
+  double dlnE = TMath::Log(fEnergy[n-1]/fEnergy[0]) / (n-1);
+  double x = TMath::Log(E/fEnergy[0]) / dlnE;
+  int i = TMath::Min((int) x, n-2);
+  double f = x - i;
+  return (1-f) * y[i] + f * y[i+1];
+}
+//____________________________________________________________________________
+double MuELossTable::dE_dx(double E, MuELProcess_t p) const
+{
+  int ip = this->ProcessIndex(p);
+  if(!this->IsBuilt() || ip < 0) return 0;
+  if(E <= MuELProcess::Threshold(p)) return 0;
+
+  return this->Interpolate(fdEdx[ip], E);
+}
+//____________________________________________________________________________
+double MuELossTable::Range(double E) const
+{
+  if(!this->IsBuilt() || E <= fEnergy[0]) return 0;
+
+  // above the grid, continue with the energy loss at its upper edge
+  int n = fEnergy.size();
+  if(E > fEnergy[n-1]) {
+    return fRange[n-1] + (E - fEnergy[n-1]) / fdEdx[4][n-1];
+  }
+  return this->Interpolate(fRange, E);
+}
+//____________________________________________________________________________
+double MuELossTable::Energy(double range) const
+{
+  if(!this->IsBuilt()) return 0;
+  if(range <= 0) return fEnergy[0];
+
+  int n = fEnergy.size();
+  if(range >= fRange[n-1]) {
+    return fEnergy[n-1] + (range - fRange[n-1]) * fdEdx[4][n-1];
+  }
+
+  // R(E) is monotonic: locate the grid interval and interpolate lnE in R
+  int i = std::upper_bound(fRange.begin(), fRange.end(), range)
+        - fRange.begin() - 1;
+  double f = (range - fRange[i]) / (fRange[i+1] - fRange[i]);
+  return fEnergy[i] * TMath::Power(fEnergy[i+1]/fEnergy[i], f);
+}
+//____________________________________________________________________________
+double MuELossTable::EnergyAfter(double E, double X) const
+{
+  return this->Energy(this->Range(E) - X);
+}
+//____________________________________________________________________________
+void MuELossTable::Print(ostream & stream) const
+{
+  const double dedx_units  = units::GeV/(units::g/units::cm2);
+  const double range_units = units::g/units::cm2;
+
+  stream << "Muon energy loss tables for " << this->Composition()
+         << " [-dE/dx in GeV/(g/cm^2), range in g/cm^2]" << endl;
+  if(!this->IsBuilt()) return;
+
+  stream << " | " << setw(10) << "E (GeV)"
+         << " | " << setw(10) << "ion"
+         << " | " << setw(10) << "pair"
+         << " | " << setw(10) << "brem"
+         << " | " << setw(10) << "pnucl"
+         << " | " << setw(10) << "total"
+         << " | " << setw(10) << "range" << " |" << endl;
+
+  // one line per decade of the grid
+  int n = fEnergy.size();
+  double dlnE = TMath::Log(fEnergy[n-1]/fEnergy[0]) / (n-1);
+  int step = TMath::Max(1, (int) (TMath::Log(10.)/dlnE));
+  for(int i = 0; i < n; i += step) {
+    stream << " | " << setw(10) << fEnergy[i];
+    for(int ip = 0; ip < 5; ip++) {
+      stream << " | " << setw(10) << fdEdx[ip][i] / dedx_units;
+    }
+    stream << " | " << setw(10) << fRange[i] / range_units << " |" << endl;
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,106 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::mueloss::MuELossTable
+
+\brief    Tabulated muon energy loss and CSDA range in a material mix.
+
+          The total and per-process (ionization, e+e- pair production,
+          bremsstrahlung, photonuclear interactions) -dE/dx are computed with
+          the MuELossI models on a logarithmic energy grid, for a mix of the
+          materials defined in MuELMaterial.h given by their weight fractions.
+          The continuous-slowing-down range R(E) is integrated from the total
+          -dE/dx, and its inverse E(R) allows a muon to be propagated through
+          a column density X as E' = E(R(E) - X) without stepping through the
+          energy loss models.
+
+          The tables can be saved to (and loaded from) a ROOT file, so that
+          they are computed once per material mix rather than in every job.
+
+          All quantities are in natural units, as returned by the MuELossI
+          models. Convert with units::GeV/(units::g/units::cm2) for -dE/dx
+          and units::g/units::cm2 for the range.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _MUELOSS_TABLE_H_
+#define _MUELOSS_TABLE_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "Physics/MuonEnergyLoss/MuELMaterial.h"
+#include "Physics/MuonEnergyLoss/MuELProcess.h"
+
+using std::string;
+using std::vector;
+using std::ostream;
+
+namespace genie   {
+namespace mueloss {
+
+class MuELossTable;
+
+ostream & operator << (ostream & stream, const MuELossTable & table);
+
+class MuELossTable
+{
+public:
+  MuELossTable();
+ ~MuELossTable();
+
+  //! add a material of the mix with its weight fraction (renormalized in Build())
+  void AddMaterial (MuELMaterial_t material, double weight);
+
+  //! compute the tables on nbins log-spaced energies in [Emin, Emax] (GeV),
+  //! within the validity range of the models (muon mass - 10 TeV)
+  bool Build (double Emin = 0.11, double Emax = 9900., int nbins = 400);
+
+  //! save/load the tables; Load() fails if the file holds another material mix
+  bool Save  (string filename) const;
+  bool Load  (string filename);
+
+  bool   IsBuilt     (void) const { return fEnergy.size() > 1; }
+  string Composition (void) const;
+  double Emin        (void) const;
+  double Emax        (void) const;
+
+  //! -dE/dx for a process (all processes by default)
+  double dE_dx       (double E, MuELProcess_t p = eMupSum) const;
+  //! CSDA range of a muon of energy E
+  double Range       (double E) const;
+  //! energy of a muon with the input CSDA range (Emin() for a stopped muon)
+  double Energy      (double range) const;
+  //! energy of a muon of energy E after traversing the column density X
+  double EnergyAfter (double E, double X) const;
+
+  void Print (ostream & stream) const;
+
+  friend ostream & operator << (ostream & stream, const MuELossTable & table);
+
+private:
+  MuELossTable(const MuELossTable & table);
+
+  int    ProcessIndex (MuELProcess_t p) const;
+  double Interpolate  (const vector<double> & y, double E) const;
+
+  vector<MuELMaterial_t> fMaterials;
+  vector<double>         fWeights;
+  vector<double>         fEnergy;    ///< log-spaced energy grid
+  vector<double>         fdEdx[5];   ///< ionization, pair, brem, photonuclear, sum
+  vector<double>         fRange;     ///< CSDA range at each grid energy
+};
+
+}      // mueloss namespace
+}      // genie   namespace
+
+#endif // _MUELOSS_TABLE_H_
@@ -10,6 +10,12 @@
  For documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The decay products of each annihilation mode, the max of the nuclear
+   density profile used for the vertex selection and (through a
+   PhaseSpaceDecayer) the max phase space decay weights are cached instead
+   of being computed at each event. A new annihilation mode, selected when
+   the decay is not permitted, no longer re-seeds the random numbers.
 
 */
 //____________________________________________________________________________
@@ -101,19 +107,19 @@ void NNBarOscPrimaryVtxGenerator::AddInitialState(GHepRecord * event) const
   int ipdg = fCurrInitStatePdg;
   
   // add initial nucleus
-  double Mi  = PDGLibrary::Instance()->Find(ipdg)->Mass();
+  double Mi  = PDGLibrary::Instance()->Mass(ipdg);
   TLorentzVector p4i(0,0,0,Mi);
   event->AddParticle(ipdg,stis,-1,-1,-1,-1, p4i, v4);
 
   // add oscillating neutron
   int neutpdg = kPdgNeutron;
-  double mneut = PDGLibrary::Instance()->Find(neutpdg)->Mass();
+  double mneut = PDGLibrary::Instance()->Mass(neutpdg);
   TLorentzVector p4neut(0,0,0,mneut);
   event->AddParticle(neutpdg,stdc,0,-1,-1,-1, p4neut, v4);
 
   // add annihilation nucleon
   int dpdg = genie::utils::nnbar_osc::AnnihilatingNucleonPdgCode(fCurrDecayMode);
-  double mn = PDGLibrary::Instance()->Find(dpdg)->Mass();
+  double mn = PDGLibrary::Instance()->Mass(dpdg);
   TLorentzVector p4n(0,0,0,mn);
   event->AddParticle(dpdg,stdc, 0,-1,-1,-1, p4n, v4);
 
@@ -123,7 +129,7 @@ void NNBarOscPrimaryVtxGenerator::AddInitialState(GHepRecord * event) const
   A--; A--;
   if(dpdg == kPdgProton) { Z--; }
   int rpdg = pdg::IonPdgCode(A, Z);
-  double Mf  = PDGLibrary::Instance()->Find(rpdg)->Mass();
+  double Mf  = PDGLibrary::Instance()->Mass(rpdg);
   TLorentzVector p4f(0,0,0,Mf);
   event->AddParticle(rpdg,stfs,0,-1,-1,-1, p4f, v4);
 }
@@ -147,13 +153,8 @@ void NNBarOscPrimaryVtxGenerator::GenerateOscillatingNeutronPosition(
       << "Generating vertex according to a realistic nuclear density profile";
 
   // get inputs to the rejection method
-  double ymax = -1;
+  double ymax = this->VtxDensityMax(A);
   double rmax = 3*R;
-  double dr   = R/40.;
-  for(double r = 0; r < rmax; r+=dr) {
-      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
-  }
-  ymax *= 1.2;
   
   // select a vertex using the rejection method 
   TLorentzVector vtx(0,0,0,0);
@@ -261,7 +262,7 @@ void NNBarOscPrimaryVtxGenerator::GenerateFermiMomentum(
      << "|p| = " << p3.Mag();
 
   // now figure out momentum for the nuclear remnant
-  p3 = -1 * (oscillating_neutron->GetP4()->Vect() + annihilation_nucleon->GetP4()->Vect());
+  p3 = -1 * (oscillating_neutron->P4()->Vect() + annihilation_nucleon->P4()->Vect());
   // figure out energy from mass & momentum
   mass = remnant_nucleus->Mass();
   energy = sqrt(pow(mass,2) + p3.Mag2());
@@ -275,27 +276,12 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
 {
   LOG("NNBarOsc", pINFO) << "Generating decay...";
 
-  PDGCodeList pdgv = genie::utils::nnbar_osc::DecayProductList(fCurrDecayMode);
-  LOG("NNBarOsc", pINFO) << "Decay product IDs: " << pdgv;
-  assert ( pdgv.size() >  1);
+  const PDGCodeList * pdgv = &this->DecayProducts();
+  LOG("NNBarOsc", pINFO) << "Decay product IDs: " << *pdgv;
+  assert ( pdgv->size() >  1);
 
   LOG("NNBarOsc", pINFO) << "Performing a phase space decay...";
 
-  // Get the decay product masses
-
-  vector<int>::const_iterator pdg_iter;
-  int idx = 0;
-  double * mass = new double[pdgv.size()];
-  double   sum  = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    mass[idx++] = m;
-    sum += m;
-  }
-
-  LOG("NNBarOsc", pINFO)  
-    << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
   int initial_nucleus_id      = 0;
   int oscillating_neutron_id  = 1;
   int annihilation_nucleon_id = 2;
@@ -312,23 +298,22 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
   tgt.SetHitNucPdg(kPdgNeutron);
 
   // get their momentum 4-vectors and boost into rest frame
-  TLorentzVector * p4_1 = oscillating_neutron->GetP4();
-  TLorentzVector * p4_2 = annihilation_nucleon->GetP4();
-  TLorentzVector * p4d = new TLorentzVector(*p4_1 + *p4_2);
-  TVector3 boost = p4d->BoostVector();
-  p4d->Boost(-boost);
+  TLorentzVector p4d = oscillating_neutron->Momentum() + 
+                       annihilation_nucleon->Momentum();
+  TVector3 boost = p4d.BoostVector();
+  p4d.Boost(-boost);
 
   // get decay position
-  TLorentzVector * v4d = annihilation_nucleon->GetX4();
+  TLorentzVector v4d = annihilation_nucleon->Position();
 
-  delete p4_1;
-  delete p4_2;
+  // Set the decay
+  bool permitted = fPhaseSpaceDecayer.SetDecay(p4d, *pdgv);
+  double sum = fPhaseSpaceDecayer.MassSum();
 
+  LOG("NNBarOsc", pINFO)  
+    << "Decaying N = " << pdgv->size() << " particles / total mass = " << sum;
   LOG("NNBarOsc", pINFO) 
-    << "Decaying system p4 = " << utils::print::P4AsString(p4d);
-
-  // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
+    << "Decaying system p4 = " << utils::print::P4AsString(&p4d);
 
   // If the decay is not energetically allowed, select a new final state
   while(!permitted) {
@@ -371,7 +356,6 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
 
     // randomly generate a number between 1 and 0
     RandomGen * rnd = RandomGen::Instance();
-    rnd->SetSeed(0);
     double p = rnd->RndNum().Rndm();
     
     // loop through all modes, figure out which one our random number corresponds to
@@ -394,40 +378,26 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
     
     fCurrDecayMode = (NNBarOscMode_t) interaction->ExclTag().DecayMode(); 
     
-    pdgv = genie::utils::nnbar_osc::DecayProductList(fCurrDecayMode);
-    LOG("NNBarOsc", pINFO) << "Decay product IDs: " << pdgv;
-    assert ( pdgv.size() > 1);
+    pdgv = &this->DecayProducts();
+    LOG("NNBarOsc", pINFO) << "Decay product IDs: " << *pdgv;
+    assert ( pdgv->size() > 1);
     
     // get the decay particles again
     LOG("NNBarOsc", pINFO) << "Performing a phase space decay...";
-    idx = 0;
-    delete [] mass;
-    mass = new double[pdgv.size()];
-    sum = 0;
-    for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-      int pdgc = *pdg_iter;
-      double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-      mass[idx++] = m;
-      sum += m;
-    }
+    permitted = fPhaseSpaceDecayer.SetDecay(p4d, *pdgv);
+    sum = fPhaseSpaceDecayer.MassSum();
     
     LOG("NNBarOsc", pINFO)
-      << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
+      << "Decaying N = " << pdgv->size() << " particles / total mass = " << sum;
     LOG("NNBarOsc", pINFO)
-      << "Decaying system p4 = " << utils::print::P4AsString(p4d);
-    
-    permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
+      << "Decaying system p4 = " << utils::print::P4AsString(&p4d);
   }
   
   if(!permitted) {
      LOG("NNBarOsc", pERROR) 
        << " *** Phase space decay is not permitted \n"
        << " Total particle mass = " << sum << "\n"
-       << " Decaying system p4 = " << utils::print::P4AsString(p4d);
-     // clean-up 
-     delete [] mass;
-     delete p4d;
-     delete v4d; 
+       << " Decaying system p4 = " << utils::print::P4AsString(&p4d);
      // throw exception
      genie::exceptions::EVGThreadException exception;
      exception.SetReason("Decay not permitted kinematically");
@@ -436,12 +406,7 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
   }
 
   // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int i=0; i<200; i++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     wmax = TMath::Max(wmax,w);
-  }
+  double wmax = fPhaseSpaceDecayer.MaxWeight(200);
   assert(wmax>0);
   wmax *= 2;
 
@@ -462,17 +427,14 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
        LOG("NNBarOsc", pWARN) 
            << "Couldn't generate an unweighted phase space decay after " 
            << itry << " attempts";
-       // clean up
-       delete [] mass;
-       delete p4d;
-       delete v4d;
        // throw exception
        genie::exceptions::EVGThreadException exception;
        exception.SetReason("Couldn't select decay after N attempts");
        exception.SwitchOnFastForward();
        throw exception;
      }
-     double w  = fPhaseSpaceGenerator.Generate();   
+     double w  = fPhaseSpaceDecayer.Generate();   
+     fPhaseSpaceDecayer.UpdateMaxWeight(w);
      if(w > wmax) {
         LOG("NNBarOsc", pWARN) 
            << "Decay weight = " << w << " > max decay weight = " << wmax;
@@ -487,22 +449,56 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
   } //!accept_decay
 
   // Insert final state products into a TClonesArray of TMCParticles
-  TLorentzVector v4(*v4d); 
+  TLorentzVector v4(v4d); 
   int idp = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
+  vector<int>::const_iterator pdg_iter;
+  for(pdg_iter = pdgv->begin(); pdg_iter != pdgv->end(); ++pdg_iter) {
      int pdgc = *pdg_iter;
-     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(idp);
+     TLorentzVector * p4fin = fPhaseSpaceDecayer.GetDecay(idp);
      GHepStatus_t ist = 
         utils::nnbar_osc::DecayProductStatus(fNucleonIsBound, pdgc);
      p4fin->Boost(boost);
      event->AddParticle(pdgc, ist, oscillating_neutron_id,-1,-1,-1, *p4fin, v4);
      idp++;
   }
+}
+//___________________________________________________________________________
+const PDGCodeList & NNBarOscPrimaryVtxGenerator::DecayProducts(void) const
+{
+// The decay products of the current annihilation mode, built the first
+// time the mode is simulated
+
+  std::map<int, PDGCodeList>::const_iterator it =
+       fDecayProducts.find(fCurrDecayMode);
+  if(it == fDecayProducts.end()) {
+    PDGCodeList pdgv = genie::utils::nnbar_osc::DecayProductList(fCurrDecayMode);
+    it = fDecayProducts.insert(std::make_pair((int)fCurrDecayMode, pdgv)).first;
+  }
+  return it->second;
+}
+//___________________________________________________________________________
+double NNBarOscPrimaryVtxGenerator::VtxDensityMax(int A) const
+{
+// The max of r^2 x nuclear density (x 1.2), the envelope of the rejection
+// method selecting the annihilation position, computed once per A
+
+  std::map<int, double>::const_iterator it = fVtxDensityMax.find(A);
+  if(it != fVtxDensityMax.end()) return it->second;
+
+  double R0 = 1.3;
+  double dA = (double)A;
+  double R = R0 * TMath::Power(dA, 1./3.);
+
+  double ymax = -1;
+  double rmax = 3*R;
+  double dr   = R/40.;
+  for(double r = 0; r < rmax; r+=dr) {
+      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
+  }
+  ymax *= 1.2;
 
-  // Clean-up
-  delete [] mass;
-  delete p4d;
-  delete v4d;
+  fVtxDensityMax[A] = ymax;
+  return ymax;
 }
 //___________________________________________________________________________
 void NNBarOscPrimaryVtxGenerator::Configure(const Registry & config)
@@ -523,6 +519,10 @@ void NNBarOscPrimaryVtxGenerator::LoadConfig(void)
 //  const Registry * gc = confp->GlobalParameterList();
     
   fNuclModel = 0;
+
+  fDecayProducts.clear();
+  fVtxDensityMax.clear();
+  fPhaseSpaceDecayer.ClearCache();
   
   RgKey nuclkey = "NuclearModel";
   fNuclModel = dynamic_cast<const NuclearModelI *> (this->SubAlg(nuclkey));
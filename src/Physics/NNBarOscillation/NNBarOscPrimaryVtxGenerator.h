@@ -21,12 +21,14 @@
 #ifndef _NNBAR_OSC_PRIMARY_VTX_GENERATOR_H_
 #define _NNBAR_OSC_PRIMARY_VTX_GENERATOR_H_
 
-#include <TGenPhaseSpace.h>
 #include <TFile.h>
 #include <TH1.h>
 #include <string>
+#include <map>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/PhaseSpaceDecayer.h"
 #include "Physics/NNBarOscillation/NNBarOscMode.h"
 
 namespace genie {
@@ -56,10 +58,16 @@ private:
    void GenerateFermiMomentum              (GHepRecord * event) const;
    void GenerateDecayProducts              (GHepRecord * event) const;
 
+   const PDGCodeList & DecayProducts       (void) const;
+   double              VtxDensityMax       (int A) const;
+
    mutable int                fCurrInitStatePdg;
    mutable NNBarOscMode_t     fCurrDecayMode;
    mutable bool               fNucleonIsBound;
-   mutable TGenPhaseSpace     fPhaseSpaceGenerator;
+   mutable PhaseSpaceDecayer  fPhaseSpaceDecayer;
+
+   mutable std::map<int, PDGCodeList> fDecayProducts; ///< decay products per annihilation mode
+   mutable std::map<int, double>      fVtxDensityMax; ///< max of r^2 x density per nucleus mass number
 
    const NuclearModelI * fNuclModel;
 };
@@ -147,13 +147,13 @@ InteractionList * NuEInteractionListGenerator::NuEELInteractionList(
 //___________________________________________________________________________
 void NuEInteractionListGenerator::Configure(const Registry & config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
 void NuEInteractionListGenerator::Configure(string config)
 {
-  Algorithm::Configure(config);
+  InteractionListGeneratorI::Configure(config);
   this->LoadConfig();
 }
 //____________________________________________________________________________
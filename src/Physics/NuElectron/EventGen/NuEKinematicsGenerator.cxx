@@ -96,6 +96,7 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         LOG("NuEKinematics", pWARN)
               << "*** Could not select a valid y after "
                                               << iter << " iterations";
+        this->CountKineThrows(interaction, iter, false);
         evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
         genie::exceptions::EVGThreadException exception;
         exception.SetReason("Couldn't select kinematics");
@@ -125,6 +126,7 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->CountKineThrows(interaction, iter, true);
         LOG("NuEKinematics", pINFO) << "Selected: y = " << y;
 
         // set the cross section for the selected kinematics
@@ -243,6 +245,7 @@ void NuEKinematicsGenerator::Configure(string config)
 void NuEKinematicsGenerator::LoadConfig(void)
 {
 	GetParamDef( "MaxXSec-SafetyFactor", fSafetyFactor, 2.00 ) ;
+	this->LoadAdaptiveSafetyFactorConfig();
 	GetParamDef( "Cache-MinEnergy", fEMin, 1.00 ) ;
 
 	GetParamDef("MaxXSec-DiffTolerance", fMaxXSecDiffTolerance, 0. ) ;
@@ -115,7 +115,7 @@ void NuETargetRemnantGenerator::AddTargetNucleusRemnant(
   int Z = init_state.Tgt().Z();
 
   int    ipdgc = pdg::IonPdgCode(A, Z);
-  double mass  = PDGLibrary::Instance()->Find(ipdgc)->Mass();
+  double mass  = PDGLibrary::Instance()->Mass(ipdgc);
 
   //-- Add the nucleus to the event record
   LOG("NuETargetRemnant", pINFO)
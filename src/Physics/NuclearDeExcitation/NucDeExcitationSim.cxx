@@ -15,10 +15,16 @@
    implementation handles 16O only.
  @ Sep 15, 2009 - CA
    IsNucleus() is no longer available in GHepParticle. Use pdg::IsIon().
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The level schemes, branching ratios and gamma energies are read from the
+   configuration, per nucleus and hole type, instead of being hard-coded
+   for 16O. Each table is flattened into its de-excitation modes at config
+   time and a mode is drawn per event with an alias table.
 */
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <cmath>
 #include <sstream>
 
 #include <TMath.h>
@@ -40,6 +46,7 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/StringUtils.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
 using std::ostringstream;
@@ -79,241 +86,39 @@ void NucDeExcitationSim::ProcessEventRecord(GHepRecord * evrec) const
     return;
   }
 
-  if(nucltgt->Z()==8) this->OxygenTargetSim(evrec);
-
-  LOG("NucDeEx", pINFO) 
-     << "Done with this event";
-}
-//___________________________________________________________________________
-void NucDeExcitationSim::OxygenTargetSim(GHepRecord * evrec) const
-{
-  LOG("NucDeEx", pNOTICE) 
-     << "Simulating nuclear de-excitation gamma rays for Oxygen target";
-
-  //LOG("NucDeEx", pNOTICE) << *evrec;
-
   GHepParticle * hitnuc = evrec->HitNucleon();
   if(!hitnuc) return;
 
+  // Get the de-excitation modes of the hole left by the hit nucleon
   bool p_hole = (hitnuc->Pdg() == kPdgProton);
-  double dt   = -1;
+  const map<int, DeExTable> & tables = (p_hole) ? fPHoleTables : fNHoleTables;
+  map<int, DeExTable>::const_iterator iter = tables.find(nucltgt->Z());
+  if(iter == tables.end()) {
+    LOG("NucDeEx", pINFO)
+      << "No de-excitation table for Z = " << nucltgt->Z()
+      << " (" << ((p_hole) ? "p" : "n") << "-hole)"
+      << " - Won't simulate nuclear de-excitation";
+    return;
+  }
+  const DeExTable & table = iter->second;
 
+  // Select a de-excitation mode & emit its photons
   RandomGen * rnd = RandomGen::Instance();
+  int imode = table.sampler.Sample(rnd->RndDec().Rndm());
+  const vector<double> & gammas = table.gammas[imode];
 
-  //
-  // ****** P-Hole 
-  //
-  if (p_hole) {
-    // 
-    // * Define all the data required for simulating deexcitations of p-hole states
-    //
-
-    // > probabilities for creating a p-hole in the P1/2, P3/2, S1/2 shells
-    double Pp12 = 0.25;              // P1/2 
-    double Pp32 = 0.47;              // P3/2 
-    double Ps12 = 1. - Pp12 - Pp32;  // S1/2 
-
-    // > excited state energy levels & probabilities for P3/2-shell p-holes
-    const int np32 = 3;
-    double p32Elv[np32] = { 0.00632, 0.00993, 0.01070 };
-    double p32Plv[np32] = { 0.872,   0.064,   0.064   }; 
-    // - probabilities for deexcitation modes of P3/2-shell p-hole state '1' 
-    double p32Plv1_1gamma  = 0.78;  // prob to decay via 1 gamma
-    double p32Plv1_cascade = 0.22;  // prob to decay via gamma cascade
-
-    // > excited state energy levels & probabilities for S1/2-shell p-holes
-    const int ns12 = 11;
-    double s12Elv[ns12] = { 
-               0.00309, 0.00368, 0.00385, 0.00444, 0.00492,
-               0.00511, 0.00609, 0.00673, 0.00701, 0.00703, 0.00734 }; 
-    double s12Plv[ns12] = { 
-               0.0625,  0.1875,  0.075,   0.1375,  0.1375,
-               0.0125,  0.0125,  0.075,   0.0563,  0.0563,  0.1874  };
-    // - gamma energies and probabilities for S1/2-shell p-hole excited 
-    //   states '2','7' and '10' with >1 deexcitation modes
-    const int ns12lv2 = 3;
-    double s12Elv2[ns12lv2]    = { 0.00309, 0.00369, 0.00385 };
-    double s12Plv2[ns12lv2]    = { 0.013,   0.360,   0.625   };
-    const int ns12lv7 = 2;
-    double s12Elv7[ns12lv7]    = { 0.00609, 0.00673 };
-    double s12Plv7[ns12lv7]    = { 0.04,    0.96    };
-    const int ns12lv10 = 3;
-    double s12Elv10[ns12lv10]  = { 0.00609, 0.00673, 0.00734 };
-    double s12Plv10[ns12lv10]  = { 0.050,   0.033,   0.017   };
-     
-    // Select one of the P1/2, P3/2 or S1/2
-    double rshell = rnd->RndDec().Rndm();
-    //
-    // >> P1/2 shell
-    //
-    if(rshell < Pp12) {
-        LOG("NucDeEx", pNOTICE) 
-          << "Hit nucleon left a P1/2 shell p-hole. Remnant is at g.s.";
-        return;
-    } 
-    //
-    // >> P3/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32) {
-        LOG("NucDeEx", pNOTICE) 
-            << "Hit nucleon left a P3/2 shell p-hole";
-        // Select one of the excited states 
-        double rdecmode  = rnd->RndDec().Rndm();        
-        double prob_sum  = 0;
-        int    sel_state = -1;
-        for(int istate=0; istate<np32; istate++) {
-            prob_sum += p32Plv[istate];
-            if(rdecmode < prob_sum) {
-              sel_state = istate;
-              break;
-            }
-        }
-        LOG("NucDeEx", pNOTICE) 
-            << "Selected P3/2 excited state = " << sel_state;
-
-        // Decay that excited state
-        // >> 6.32 MeV state
-        if(sel_state==0) { 
-            this->AddPhoton(evrec, p32Elv[0], dt);
-        } 
-        // >> 9.93 MeV state
-        else 
-        if(sel_state==1) {    
-            double r = rnd->RndDec().Rndm();        
-            // >>> emit a single gamma 
-            if(r < p32Plv1_1gamma) {
-               this->AddPhoton(evrec, p32Elv[1], dt);
-            }
-            // >>> emit a cascade of gammas 
-            else 
-            if(r < p32Plv1_1gamma + p32Plv1_cascade) {
-               this->AddPhoton(evrec, p32Elv[1],           dt);
-               this->AddPhoton(evrec, p32Elv[1]-p32Elv[0], dt);
-            }
-        }
-        // >> 10.7 MeV state 
-        else 
-        if(sel_state==2) {
-           // Above the particle production threshold - need to emit
-           // a 0.5 MeV kinetic energy proton.
-           // Will neglect that given that it is a very low energy
-           // kinetic energy nucleon and the intranuke break-up nucleon
-           // cross sections are already tuned.
-           return;
-        }
-    } //p3/2
-    //
-    // >> S1/2 shell
-    //
-    else if (rshell < Pp12 + Pp32 + Ps12) {
-        LOG("NucDeEx", pNOTICE) 
-            << "Hit nucleon left an S1/2 shell p-hole";
-        // Select one of the excited states caused by a S1/2 shell hole
-        double rdecmode  = rnd->RndDec().Rndm();  
-        double prob_sum  = 0;
-        int    sel_state = -1;
-        for(int istate=0; istate<ns12; istate++) {
-            prob_sum += s12Plv[istate];
-            if(rdecmode < prob_sum) {
-              sel_state = istate;
-              break;
-            }
-        }
-        LOG("NucDeEx", pNOTICE) 
-            << "Selected S1/2 excited state = " << sel_state;
-
-        // Decay that excited state
-        bool multiple_decay_modes = 
-              (sel_state==2 || sel_state==7 || sel_state==10);
-        if(!multiple_decay_modes) {
-          this->AddPhoton(evrec, s12Elv[sel_state], dt); 
-        } else {
-          int ndec = -1;
-          double * pdec = 0, * edec = 0;
-          switch(sel_state) {
-           case(2) : 
-              ndec = ns12lv2;  pdec = s12Plv2;  edec = s12Elv2;
-              break;
-           case(7) : 
-              ndec = ns12lv7;  pdec = s12Plv7;  edec = s12Elv7;
-              break;
-           case(10) : 
-              ndec = ns12lv10; pdec = s12Plv10; edec = s12Elv10;
-              break;
-           default:
-             return;
-          }
-          double r = rnd->RndDec().Rndm();  
-          double decmode_prob_sum = 0;
-          int sel_decmode = -1;
-          for(int idecmode=0; idecmode < ndec; idecmode++) {
-             decmode_prob_sum += pdec[idecmode];
-             if(r < decmode_prob_sum) {
-                 sel_decmode = idecmode;
-                 break;
-             }
-          }
-          if(sel_decmode == -1) return;
-          this->AddPhoton(evrec, edec[sel_decmode], dt);  
-        }//mult.dec.ch 
-
-    } // s1/2
-    else {
-    }
-  } // p-hole
-
-  //
-  // ****** n-hole
-  //
-  else {
-    // 
-    // * Define all the data required for simulating deexcitations of n-hole states
-    //
-
-    // > probabilities for creating a n-hole in the P1/2, P3/2, S1/2 shells
-    double Pp12 = 0.25;  // P1/2 
-    double Pp32 = 0.44;  // P3/2 
-    double Ps12 = 0.09;  // S1/2 
-    //>
-    double p32Elv = 0.00618;
-    //>
-    double s12Elv = 0.00703;
-    double s12Plv = 0.222;
-
-    // Select one of the P1/2, P3/2 or S1/2
-    double rshell = rnd->RndDec().Rndm();
-    //
-    // >> P1/2 shell
-    //
-    if(rshell < Pp12) {
-        LOG("NucDeEx", pNOTICE) 
-          << "Hit nucleon left a P1/2 shell n-hole. Remnant is at g.s.";
-        return;
-    } 
-    //
-    // >> P3/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32) {
-        LOG("NucDeEx", pNOTICE) 
-            << "Hit nucleon left a P3/2 shell n-hole";
-        this->AddPhoton(evrec, p32Elv, dt); 
-    } 
-    //
-    // >> S1/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32 + Ps12) {
-        LOG("NucDeEx", pNOTICE) 
-            << "Hit nucleon left a S1/2 shell n-hole";
-        // only one of the deexcitation modes involve a (7.03 MeV) photon
-        double r = rnd->RndDec().Rndm();
-        if(r < s12Plv) this->AddPhoton(evrec, s12Elv,dt);
-    }
-    else {
-    }
-  } //n-hole
+  LOG("NucDeEx", pNOTICE)
+     << "Hit nucleon left a " << ((p_hole) ? "p" : "n") << "-hole in Z = "
+     << nucltgt->Z() << " - Selected de-excitation mode " << imode
+     << " with " << gammas.size() << " photon(s)";
+
+  double dt = -1;
+  for(unsigned int ig = 0; ig < gammas.size(); ig++) {
+    this->AddPhoton(evrec, gammas[ig], dt);
+  }
+
+  LOG("NucDeEx", pINFO) 
+     << "Done with this event";
 }
 //___________________________________________________________________________
 void NucDeExcitationSim::AddPhoton(
@@ -383,3 +188,124 @@ TLorentzVector NucDeExcitationSim::Photon4P(double E) const
   return p4;
 }
 //___________________________________________________________________________
+void NucDeExcitationSim::Configure(const Registry & config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void NucDeExcitationSim::Configure(string config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void NucDeExcitationSim::LoadConfig(void)
+{
+// Reads the de-excitation tables of the listed nuclei (by Z)
+
+  fPHoleTables.clear();
+  fNHoleTables.clear();
+
+  string nuclei = "";
+  GetParamDef( "DeExcitation-Nuclei", nuclei, string("") ) ;
+  nuclei = str::TrimSpaces(nuclei);
+  if(nuclei.size() == 0) return;
+
+  vector<string> zlist = str::Split(nuclei, ",");
+  for(unsigned int iz = 0; iz < zlist.size(); iz++) {
+    int Z = atoi(str::TrimSpaces(zlist[iz]).c_str());
+    if(Z <= 0) {
+      LOG("NucDeEx", pFATAL)
+        << "Invalid nucleus in DeExcitation-Nuclei: " << zlist[iz];
+      exit(1);
+    }
+    for(int ih = 0; ih < 2; ih++) {
+      bool p_hole = (ih == 0);
+      ostringstream key;
+      key << "DeExcitation-Z" << Z << ((p_hole) ? "-PHole" : "-NHole");
+      string modes = "";
+      GetParamDef( key.str(), modes, string("") ) ;
+      if(str::TrimSpaces(modes).size() == 0) continue;
+
+      DeExTable & table = (p_hole) ? fPHoleTables[Z] : fNHoleTables[Z];
+      this->BuildTable(key.str(), modes, table);
+    }
+  }
+}
+//____________________________________________________________________________
+void NucDeExcitationSim::BuildTable(
+               string key, string modes, DeExTable & table) const
+{
+// Decodes a de-excitation table, given as semicolon separated modes
+// 'P : E1, E2, ...' with the probability P of the mode (possibly written
+// as a product of probabilities 'P1 * P2 * ...', eg shell * level * branch)
+// and the energies (MeV) of the photons it emits (none for a mode leaving
+// the remnant at its ground state or emitting particles only). Any
+// remaining probability is given to a mode without photons.
+
+  vector<double> probs;
+  table.gammas.clear();
+
+  vector<string> vmodes = str::Split(modes, ";");
+  for(unsigned int im = 0; im < vmodes.size(); im++) {
+    string mode = str::TrimSpaces(vmodes[im]);
+    if(mode.size() == 0) continue;
+
+    vector<string> parts = str::Split(mode, ":");
+    if(parts.size() != 2) {
+      LOG("NucDeEx", pFATAL)
+        << "Invalid de-excitation mode in " << key << ": " << mode;
+      exit(1);
+    }
+
+    double P = 1;
+    vector<string> factors = str::Split(parts[0], "*");
+    for(unsigned int i = 0; i < factors.size(); i++) {
+      P *= atof(str::TrimSpaces(factors[i]).c_str());
+    }
+
+    vector<double> gammas;
+    string energies = str::TrimSpaces(parts[1]);
+    if(energies.size() > 0) {
+      vector<string> venergies = str::Split(energies, ",");
+      for(unsigned int i = 0; i < venergies.size(); i++) {
+        double E = atof(str::TrimSpaces(venergies[i]).c_str()) * units::MeV;
+        if(E <= 0) {
+          LOG("NucDeEx", pFATAL)
+            << "Invalid photon energy in " << key << ": " << mode;
+          exit(1);
+        }
+        gammas.push_back(E);
+      }
+    }
+
+    if(P < 0) {
+      LOG("NucDeEx", pFATAL)
+        << "Negative probability in " << key << ": " << mode;
+      exit(1);
+    }
+    probs.push_back(P);
+    table.gammas.push_back(gammas);
+  }
+
+  double Psum = 0;
+  for(unsigned int im = 0; im < probs.size(); im++) Psum += probs[im];
+
+  if(Psum > 1 + 1E-3) {
+    LOG("NucDeEx", pFATAL)
+      << "The de-excitation mode probabilities in " << key
+      << " add up to " << Psum << " > 1";
+    exit(1);
+  }
+  if(Psum < 1) {
+    probs.push_back(1 - Psum);
+    table.gammas.push_back(vector<double>());
+  }
+
+  table.sampler.Build(probs);
+
+  LOG("NucDeEx", pINFO)
+    << "Loaded " << key << ": " << table.gammas.size() << " modes";
+}
+//____________________________________________________________________________
@@ -5,6 +5,13 @@
 
 \brief    Generates nuclear de-excitation gamma rays
 
+          The de-excitation of the hole left by the hit nucleon is given, per
+          nucleus (Z) and hole type, as a table of modes with their
+          probabilities and the photons they emit, read from the
+          configuration (the hole shell, excited level and decay branch
+          probabilities combined). New targets only need a new table.
+          A mode is drawn per event with an alias table built at config time.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -23,9 +30,16 @@
 #ifndef _NUCLEAR_DEEXCITATION_H_
 #define _NUCLEAR_DEEXCITATION_H_
 
+#include <map>
+#include <vector>
+
 #include <TLorentzVector.h>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/Numerical/AliasSampler.h"
+
+using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -39,11 +53,27 @@ public :
   //-- implement the EventRecordVisitorI interface
   void ProcessEventRecord (GHepRecord * evrec) const;
 
+  //-- overload the Algorithm::Configure() methods to load private data
+  //   members from configuration options
+  void Configure (const Registry & config);
+  void Configure (string config);
+
 private:
-  void           OxygenTargetSim      (GHepRecord * evrec) const;
+
+  //! the de-excitation modes of a nucleon hole
+  struct DeExTable {
+    AliasSampler             sampler;  ///< over the modes
+    vector< vector<double> > gammas;   ///< photon energies of each mode
+  };
+
+  void           LoadConfig           (void);
+  void           BuildTable           (string key, string modes, DeExTable & table) const;
   void           AddPhoton            (GHepRecord * evrec, double E0, double t) const;
   double         PhotonEnergySmearing (double E0, double t) const;
   TLorentzVector Photon4P             (double E) const;
+
+  map<int, DeExTable> fPHoleTables;  ///< Z -> p-hole de-excitation modes
+  map<int, DeExTable> fNHoleTables;  ///< Z -> n-hole de-excitation modes
 };
 
 }      // genie namespace
@@ -13,6 +13,8 @@
 
 #include <sstream>
 #include <cstdlib>
+#include <atomic>
+#include <mutex>
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -34,32 +36,46 @@ using namespace genie::constants;
 using namespace genie::utils;
 using namespace genie::utils::config;
 
+namespace {
+  // Momentum distribution dP/dp (see reference), up to the normalisation
+  double EffectiveSFDensity(const vector<double> & v, double p)
+  {
+    double bs = v[0], bp = v[1], alpha = v[2], beta = v[3];
+    double c1 = v[4], c2 = v[5], c3 = v[6];
+    double y  = p / 0.197;
+    double as = c1 * exp(-pow(bs*y,2));
+    double ap = c2 * pow(bp * y, 2) * exp(-pow(bp * y, 2));
+    double at = c3 * pow(y, beta) * exp(-alpha * (y - 2));
+    double rr = (3.14159265 / 4) * (as + ap + at) * pow(y, 2) / 0.197;
+    return rr / 1.01691371;
+  }
+  // Spacing of the momentum distribution table nodes
+  const double kMomentumStep = 0.001;
+
+  // serialises the look-up & filling of the per-nucleus data
+  std::mutex gEffectiveSFLock;
+  // unique configuration ids (see EffectiveSF::TargetData())
+  std::atomic<unsigned long> gEffectiveSFConfigIds(0);
+}
+
 //____________________________________________________________________________
 EffectiveSF::EffectiveSF() :
-NuclearModelI("genie::EffectiveSF")
+NuclearModelI("genie::EffectiveSF"),
+fConfigId(0)
 {
 
 }
 //____________________________________________________________________________
 EffectiveSF::EffectiveSF(string config) :
-NuclearModelI("genie::EffectiveSF", config)
+NuclearModelI("genie::EffectiveSF", config),
+fConfigId(0)
 {
 
 }
 //____________________________________________________________________________
-// Cleans up memory from probability distribution maps
-//____________________________________________________________________________
 EffectiveSF::~EffectiveSF()
 {
-  map<string, TH1D*>::iterator iter = fProbDistroMap.begin();
-  for( ; iter != fProbDistroMap.begin(); ++iter) {
-    TH1D * hst = iter->second;
-    if(hst) {
-      delete hst;
-      hst=0;
-    }
-  }
-  fProbDistroMap.clear();
+
 }
 //____________________________________________________________________________
 // Set the removal energy, 3 momentum, and FermiMover interaction type
@@ -67,28 +83,28 @@ EffectiveSF::~EffectiveSF()
 bool EffectiveSF::GenerateNucleon(const Target & target) const
 {
   assert(target.HitNucIsSet());
-  fCurrRemovalEnergy = 0;
-  fCurrMomentum.SetXYZ(0,0,0);
+  this->SetRemovalEnergy(0);
+  this->SetMomentum3(TVector3(0,0,0));
 
   //-- set fermi momentum vector
   //
 
+  const EffSFTarget_t & data = this->TargetData(target);
+  RandomGen * rnd = RandomGen::Instance();
+
   if ( target.A() > 1 ) {
-    TH1D * prob = this->ProbDistro(target);
-    if(!prob) {
+    if(data.pdist.IsEmpty()) {
       LOG("EffectiveSF", pNOTICE)
               << "Null nucleon momentum probability distribution";
       exit(1);
     }
 
-    double p = prob->GetRandom();
+    double p = data.pdist.Sample(rnd->RndGen().Rndm());
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("EffectiveSF", pDEBUG) << "|p,nucleon| = " << p;
 #endif
 
-    RandomGen * rnd = RandomGen::Instance();
-
     double costheta = -1. + 2. * rnd->RndGen().Rndm();
     double sintheta = TMath::Sqrt(1.-costheta*costheta);
     double fi       = 2 * kPi * rnd->RndGen().Rndm();
@@ -99,24 +115,20 @@ bool EffectiveSF::GenerateNucleon(const Target & target) const
     double py = p*sintheta*sinfi;
     double pz = p*costheta;
 
-    fCurrMomentum.SetXYZ(px, py, pz);
+    this->SetMomentum3(TVector3(px, py, pz));
 
   }
 
   //-- set removal energy
   //
 
-  fCurrRemovalEnergy = this->ReturnBindingEnergy(target);
-  double f1p1h = this->Returnf1p1h(target);
-  // Since TE increases the QE peak via a 2p2h process, we decrease f1p1h
-  // in order to increase the 2p2h interaction to account for this enhancement.
-  f1p1h /= this->GetTransEnh1p1hMod(target);
-  if ( RandomGen::Instance() -> RndGen().Rndm() < f1p1h) {
-    fFermiMoverInteractionType = kFermiMoveEffectiveSF1p1h;
+  this->SetRemovalEnergy(data.rmv_en);
+  if ( rnd->RndGen().Rndm() < data.f1p1h) {
+    this->SetFermiMoverInteractionType(kFermiMoveEffectiveSF1p1h);
   } else if (fEjectSecondNucleon2p2h) {
-    fFermiMoverInteractionType = kFermiMoveEffectiveSF2p2h_eject;
+    this->SetFermiMoverInteractionType(kFermiMoveEffectiveSF2p2h_eject);
   } else {
-    fFermiMoverInteractionType = kFermiMoveEffectiveSF2p2h_noeject;
+    this->SetFermiMoverInteractionType(kFermiMoveEffectiveSF2p2h_noeject);
   }
 
   return true;
@@ -129,35 +141,60 @@ bool EffectiveSF::GenerateNucleon(const Target & target) const
 double EffectiveSF::Prob(double mom, double w, const Target & target) const
 {
   if(w < 0) {
-     TH1D * prob_distr = this->ProbDistro(target);
-     int bin = prob_distr->FindBin(mom);
-     double y  = prob_distr->GetBinContent(bin);
-     double dx = prob_distr->GetBinWidth(bin);
-     double prob  = y * dx;
+     const EffSFTarget_t & data = this->TargetData(target);
+     if(data.pdist.IsEmpty()) return 0;
+     if(mom < 0 || mom > fPCutOff) return 0;
+     // probability of a momentum bin of width dx
+     int    npbins = (int) (1000 * fPMax);
+     double dx     = fPMax / npbins;
+     double y      = EffectiveSFDensity(data.pars, mom) / data.pdist.Integral();
+     double prob   = y * dx;
      return prob;
   }
   return 1;
 }
 //____________________________________________________________________________
-// Check the map of nucleons to see if we have a probability distribution to
-// compute with.  If not, make one.
+// Returns the parameters of the given nucleus, resolving them from the
+// configuration maps at the first call for this nucleus.
 //____________________________________________________________________________
-TH1D * EffectiveSF::ProbDistro(const Target & target) const
+const EffectiveSF::EffSFTarget_t &
+  EffectiveSF::TargetData(const Target & target) const
 {
-  //-- return stored /if already computed/
-  map<string, TH1D*>::iterator it = fProbDistroMap.find(target.AsString());
-  if(it != fProbDistroMap.end()) return it->second;
+  // the nucleus looked up last by the calling thread (the model is shared
+  // by the event generation threads; configurations have unique ids)
+  static thread_local unsigned long         last_id   = 0;
+  static thread_local int                   last_pdgc = 0;
+  static thread_local const EffSFTarget_t * last_data = 0;
+
+  int pdgc = pdg::IonPdgCode(target.A(), target.Z());
+  if(last_data && last_id == fConfigId && pdgc == last_pdgc) return *last_data;
 
-  LOG("EffectiveSF", pNOTICE)
+  std::lock_guard<std::mutex> guard(gEffectiveSFLock);
+
+  map<int, EffSFTarget_t>::iterator it = fTargetData.find(pdgc);
+  if(it == fTargetData.end()) {
+    LOG("EffectiveSF", pNOTICE)
              << "Computing P = f(p_nucleon) for: " << target.AsString();
-  LOG("EffectiveSF", pNOTICE)
+    LOG("EffectiveSF", pNOTICE)
                << "P(cut-off) = " << fPCutOff << ", P(max) = " << fPMax;
 
-  //-- get information for the nuclear target
-  int nucleon_pdgc = target.HitNucPdg();
-  assert( pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc) );
-  return this->MakeEffectiveSF(target);
+    EffSFTarget_t data;
+    if(this->MakeEffectiveSF(target, data.pars)) {
+      this->MakeEffectiveSF(data.pars, data.pdist);
+    }
+    data.rmv_en = this->ReturnBindingEnergy(target);
+    // Since TE increases the QE peak via a 2p2h process, we decrease f1p1h
+    // in order to increase the 2p2h interaction to account for this enhancement.
+    data.f1p1h  = this->Returnf1p1h(target) / this->GetTransEnh1p1hMod(target);
+
+    it = fTargetData.insert(
+        map<int, EffSFTarget_t>::value_type(pdgc, data)).first;
+  }
 
+  last_id   = fConfigId;
+  last_pdgc = pdgc;
+  last_data = &(it->second);
+  return it->second;
 }
 //____________________________________________________________________________
 // If transverse enhancement form factor modification is enabled, we must
@@ -175,72 +212,54 @@ double EffectiveSF::GetTransEnh1p1hMod(const Target& target) const {
   return 1.0;
 }
 //____________________________________________________________________________
-// Makes a momentum distribtuion for the given target using parameters
-// from the config file.
+// Finds the momentum distribution parameters for the given target in the
+// config file.
 //____________________________________________________________________________
-TH1D * EffectiveSF::MakeEffectiveSF(const Target & target) const
+bool EffectiveSF::MakeEffectiveSF(
+   const Target & target, vector<double> & pars) const
 {
   // First check for individually specified nuclei
   int pdgc  = pdg::IonPdgCode(target.A(), target.Z());
   map<int,vector<double> >::const_iterator it = fProbDistParams.find(pdgc);
   if(it != fProbDistParams.end()) {
-    vector<double> v = it->second;
-    return this->MakeEffectiveSF(v[0], v[1], v[2], v[3],
-                                 v[4], v[5], v[6], target);
+    pars = it->second;
+    return true;
   }
 
   // Then check in the ranges of A
   map<pair<int, int>, vector<double> >::const_iterator range_it = fRangeProbDistParams.begin();
   for(; range_it != fRangeProbDistParams.end(); ++range_it) {
     if (target.A() >= range_it->first.first && target.A() <= range_it->first.second) {
-      vector<double> v = range_it->second;
-      return this->MakeEffectiveSF(v[0], v[1], v[2], v[3],
-                                   v[4], v[5], v[6], target);
+      pars = range_it->second;
+      return true;
     }
   }
 
-  return NULL;
+  pars.clear();
+  return false;
 }
 //____________________________________________________________________________
-// Makes a momentum distribution using the factors below (see reference) and
-// inserts it into the nucleus/momentum distribution map.
+// Tabulates the momentum distribution (see reference) up to the momentum
+// cut-off, for its sampling by inverse CDF.
 //____________________________________________________________________________
-TH1D * EffectiveSF::MakeEffectiveSF(double bs, double bp, double alpha,
-                                    double beta, double c1, double c2,
-                                    double c3, const Target & target) const
+bool EffectiveSF::MakeEffectiveSF(
+   const vector<double> & pars, InverseCDF & pdist) const
 {
-  //-- create the probability distribution
-  int npbins = (int) (1000 * fPMax);
-
-  TH1D * prob = new TH1D("", "", npbins, 0, fPMax);
-  prob->SetDirectory(0);
-
-  double dp = fPMax / (npbins-1);
-  for(int i = 0; i < npbins; i++) {
-    double p  = i * dp;
-    double y = p / 0.197;
-    double as = c1 * exp(-pow(bs*y,2));
-    double ap = c2 * pow(bp * y, 2) * exp(-pow(bp * y, 2));
-    double at = c3 * pow(y, beta) * exp(-alpha * (y - 2));
-    double rr = (3.14159265 / 4) * (as + ap + at) * pow(y, 2) / 0.197;
-    double dP_dp = rr / 1.01691371;
-    if(p>fPCutOff)
-      dP_dp = 0;
-    assert(dP_dp >= 0);
+  int np = TMath::Max(2, (int) TMath::Ceil(fPCutOff / kMomentumStep) + 1);
+  double dp = fPCutOff / (np-1);
+
+  vector<double> p(np), dP_dp(np);
+  for(int i = 0; i < np; i++) {
+    p[i]     = i * dp;
+    dP_dp[i] = EffectiveSFDensity(pars, p[i]);
+    assert(dP_dp[i] >= 0);
     // calculate probability density : dProbability/dp
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-    LOG("EffectiveSF", pDEBUG) << "p = " << p << ", dP/dp = " << dP_dp;
+    LOG("EffectiveSF", pDEBUG) << "p = " << p[i] << ", dP/dp = " << dP_dp[i];
 #endif
-    prob->Fill(p, dP_dp);
- }
-
-  //-- normalize the probability distribution
-  prob->Scale( 1.0 / prob->Integral("width") );
+  }
 
-  //-- store
-  fProbDistroMap.insert(
-      map<string, TH1D*>::value_type(target.AsString(),prob));
-  return prob;
+  return pdist.Build(p, dP_dp);
 }
 //____________________________________________________________________________
 // Returns the binding energy for a given nucleus.
@@ -284,6 +303,9 @@ void EffectiveSF::Configure(string param_set)
 //____________________________________________________________________________
 void EffectiveSF::LoadConfig(void)
 {
+  fTargetData.clear();
+  fConfigId = ++gEffectiveSFConfigIds;
+
   this->GetParamDef("EjectSecondNucleon2p2h", fEjectSecondNucleon2p2h, false);
 
   this->GetParamDef("MomentumMax",    fPMax,    1.0);
@@ -364,5 +386,12 @@ void EffectiveSF::LoadConfig(void)
       }
     }
   }
+
+  // Resolve the nuclei listed in the configuration now; the ones covered
+  // by an A range are resolved at their first use
+  map<int, vector<double> >::const_iterator it = fProbDistParams.begin();
+  for( ; it != fProbDistParams.end(); ++it) {
+    this->TargetData(Target(it->first));
+  }
 }
 //____________________________________________________________________________
@@ -6,6 +6,12 @@
 \brief    An effective spectral function to match psi' superscaling.
           Implements the NuclearModelI interface.
 
+          The parameters of each nucleus (momentum distribution, removal
+          energy and 1p1h fraction) are resolved once and kept, with the
+          inverse CDF table of the momentum distribution, in a record looked
+          up by the nucleus PDG code. The nuclei listed in the configuration
+          are resolved at configuration, others at their first use.
+
 \ref      http://arxiv.org/abs/1405.0583
 
 \author   Brian Coopersmith, University of Rochester
@@ -22,9 +28,9 @@
 #define _EFFECTIVE_SF_H_
 
 #include <map>
+#include <vector>
 
-#include <TH1D.h>
-
+#include "Framework/Numerical/InverseCDF.h"
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
@@ -55,13 +61,18 @@ public:
   void Configure (string param_set);
 
 private:
-  TH1D * ProbDistro (const Target & t) const;
+  // Parameters of a nucleus, resolved from the configuration maps
+  struct EffSFTarget_t {
+    std::vector<double> pars;      ///< momentum distribution parameters (empty if none)
+    InverseCDF          pdist;     ///< momentum distribution table
+    double              rmv_en;    ///< removal energy
+    double              f1p1h;     ///< 1p1h fraction, transverse enhancement included
+  };
 
-  TH1D * MakeEffectiveSF(const Target & target) const;
+  const EffSFTarget_t & TargetData (const Target & target) const;
 
-  TH1D * MakeEffectiveSF(double bs, double bp, double alpha, double beta,
-                         double c1, double c2, double c3,
-                         const Target & target) const;
+  bool MakeEffectiveSF(const Target & target, std::vector<double> & pars) const;
+  bool MakeEffectiveSF(const std::vector<double> & pars, InverseCDF & pdist) const;
 
   double ReturnBindingEnergy(const Target & target) const;
   double GetTransEnh1p1hMod(const Target& target) const;
@@ -69,7 +80,8 @@ private:
   double Returnf1p1h(const Target & target) const;
   void   LoadConfig (void);
 
-  mutable map<string, TH1D *> fProbDistroMap;
+  mutable map<int, EffSFTarget_t> fTargetData;      ///< per nucleus PDG code (filled under a lock, see TargetData())
+  unsigned long                   fConfigId;        ///< unique id of the current configuration
   double fPMax;
   double fPCutOff;
   bool   fEjectSecondNucleon2p2h;
@@ -15,11 +15,17 @@
    it from being automatically written out at the event file.
  @ Jun 18, 2008 - CA
    Deallocate the momentum distribution histograms map at dtor
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The momentum distributions are built under a lock, with their cumulative
+   integral computed once, and are sampled with RandomGen rather than with
+   TH1::GetRandom() (which uses gRandom), so that the model can be shared
+   by the event generation threads.
 */
 //____________________________________________________________________________
 
 #include <sstream>
 #include <cstdlib>
+#include <mutex>
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -34,6 +40,28 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
+namespace {
+  // serialises the look-up & building of the momentum distributions, which
+  // are then only read
+  std::mutex gFGMBodekRitchieLock;
+
+  // inverse CDF sampling of the input histogram, as TH1::GetRandom() but
+  // with the input uniform number (the cumulative integral is computed when
+  // the histogram is built)
+  double SampleDistro(TH1D * hst, double r)
+  {
+    const double * integral = hst->GetIntegral();
+    int nbins = hst->GetNbinsX();
+    int ibin  = TMath::BinarySearch(nbins, integral, r);
+    double x  = hst->GetBinLowEdge(ibin+1);
+    if(r > integral[ibin]) {
+      x += hst->GetBinWidth(ibin+1) *
+           (r - integral[ibin]) / (integral[ibin+1] - integral[ibin]);
+    }
+    return x;
+  }
+}
+
 using std::ostringstream;
 using namespace genie;
 using namespace genie::constants;
@@ -69,8 +97,8 @@ bool FGMBodekRitchie::GenerateNucleon(const Target & target) const
 {
   assert(target.HitNucIsSet());
 
-  fCurrRemovalEnergy = 0;
-  fCurrMomentum.SetXYZ(0,0,0);
+  this->SetRemovalEnergy(0);
+  this->SetMomentum3(TVector3(0,0,0));
 
   //-- set fermi momentum vector
   //
@@ -80,11 +108,11 @@ bool FGMBodekRitchie::GenerateNucleon(const Target & target) const
               << "Null nucleon momentum probability distribution";
     exit(1);
   }
-  double p = prob->GetRandom();
-  LOG("BodekRitchie", pINFO) << "|p,nucleon| = " << p;
-
   RandomGen * rnd = RandomGen::Instance();
 
+  double p = SampleDistro(prob, rnd->RndGen().Rndm());
+  LOG("BodekRitchie", pINFO) << "|p,nucleon| = " << p;
+
   double costheta = -1. + 2. * rnd->RndGen().Rndm();
   double sintheta = TMath::Sqrt(1.-costheta*costheta);
   double fi       = 2 * kPi * rnd->RndGen().Rndm();
@@ -95,7 +123,7 @@ bool FGMBodekRitchie::GenerateNucleon(const Target & target) const
   double py = p*sintheta*sinfi;
   double pz = p*costheta;
 
-  fCurrMomentum.SetXYZ(px,py,pz);
+  this->SetMomentum3(TVector3(px,py,pz));
 
   //-- set removal energy
   //
@@ -103,11 +131,11 @@ bool FGMBodekRitchie::GenerateNucleon(const Target & target) const
   {
      int Z = target.Z();
      map<int,double>::const_iterator it = fNucRmvE.find(Z);
-     if(it != fNucRmvE.end()) fCurrRemovalEnergy = it->second;
-     else fCurrRemovalEnergy = nuclear::BindEnergyPerNucleon(target);
+     if(it != fNucRmvE.end()) this->SetRemovalEnergy(it->second);
+     else this->SetRemovalEnergy(nuclear::BindEnergyPerNucleon(target));
   }
   else {
-     fCurrRemovalEnergy = nuclear::BindEnergyPerNucleonParametrization(target);
+     this->SetRemovalEnergy(nuclear::BindEnergyPerNucleonParametrization(target));
   }
 
   return true;
@@ -128,6 +156,8 @@ double FGMBodekRitchie::Prob(double mom, double w, const Target & target) const
 //____________________________________________________________________________
 TH1D * FGMBodekRitchie::ProbDistro(const Target & target) const
 {
+  std::lock_guard<std::mutex> guard(gFGMBodekRitchieLock);
+
   //-- return stored /if already computed/
   map<string, TH1D*>::iterator it = fProbDistroMap.find(target.AsString());
   if(it != fProbDistroMap.end()) return it->second;
@@ -210,6 +240,7 @@ TH1D * FGMBodekRitchie::ProbDistro(const Target & target) const
 
   //-- normalize the probability distribution
   prob->Scale( 1.0 / prob->Integral("width") );
+  prob->ComputeIntegral();
 
   //-- store
   fProbDistroMap.insert(
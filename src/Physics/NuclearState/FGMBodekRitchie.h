@@ -59,7 +59,7 @@ private:
   void   LoadConfig (void);
   TH1D * ProbDistro (const Target & t) const;
 
-  mutable map<string, TH1D *> fProbDistroMap;
+  mutable map<string, TH1D *> fProbDistroMap; ///< built on first use, under a lock (see the .cxx)
 
   map<int, double> fNucRmvE;
 
@@ -10,10 +10,18 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Keep the Fermi momenta found for each target, so that the table is
+   searched once per target.
+   The Fermi momenta found are filled under a lock, so that the tables can
+   be shared by the event generation threads.
 
 */
 //____________________________________________________________________________
 
+#include <atomic>
+#include <mutex>
+
 #include <TMath.h>
 
 #include "Framework/Messenger/Messenger.h"
@@ -22,12 +30,21 @@
 
 using namespace genie;
 
+namespace {
+  // serialises the filling of the Fermi momenta found per target
+  std::mutex gFermiMomentumTableLock;
+  // unique ids of the table contents (see FermiMomentumTable::ClosestKF())
+  std::atomic<unsigned long> gFermiMomentumTableRevisions(0);
+}
+
 //____________________________________________________________________________
-FermiMomentumTable::FermiMomentumTable()
+FermiMomentumTable::FermiMomentumTable() :
+fRevision(++gFermiMomentumTableRevisions)
 {
 }
 //____________________________________________________________________________
-FermiMomentumTable::FermiMomentumTable(const FermiMomentumTable & )
+FermiMomentumTable::FermiMomentumTable(const FermiMomentumTable & ) :
+fRevision(++gFermiMomentumTableRevisions)
 {
 
 }
@@ -40,30 +57,64 @@ FermiMomentumTable::~FermiMomentumTable()
 void FermiMomentumTable::AddTableEntry(int tgt_pdgc, KF_t kf)
 {
   fKFSets.insert(map<int, KF_t>::value_type(tgt_pdgc, kf));
+
+  fClosestKFSets.clear();
+  fRevision = ++gFermiMomentumTableRevisions;
 }
 //____________________________________________________________________________
 double FermiMomentumTable::FindClosestKF(int tgt_pdgc, int nucleon_pdgc) const
+{
+  const KF_t & kft = this->ClosestKF(tgt_pdgc);
+  return (pdg::IsProton(nucleon_pdgc)) ? kft.p : kft.n;
+}
+//____________________________________________________________________________
+const KF_t & FermiMomentumTable::ClosestKF(int tgt_pdgc) const
+{
+// Fermi momenta of the target, searched for at the first call for the target
+// (the target looked up last by the calling thread is remembered)
+
+  static thread_local unsigned long last_revision = 0;
+  static thread_local int           last_tgt_pdgc = 0;
+  static thread_local const KF_t *  last_kf       = 0;
+
+  if(last_kf && last_revision == fRevision && tgt_pdgc == last_tgt_pdgc) {
+    return *last_kf;
+  }
+
+  std::lock_guard<std::mutex> guard(gFermiMomentumTableLock);
+
+  map<int, KF_t>::const_iterator it = fClosestKFSets.find(tgt_pdgc);
+  if(it == fClosestKFSets.end()) {
+    it = fClosestKFSets.insert(
+       map<int, KF_t>::value_type(tgt_pdgc, this->SearchClosest(tgt_pdgc))).first;
+  }
+  last_revision = fRevision;
+  last_tgt_pdgc = tgt_pdgc;
+  last_kf       = &(it->second);
+  return it->second;
+}
+//____________________________________________________________________________
+KF_t FermiMomentumTable::SearchClosest(int tgt_pdgc) const
 {
   LOG("FermiP", pINFO)
-       << "Finding Fermi momenta table entry for (tgt = "
-                      << tgt_pdgc << ", nucl = " << nucleon_pdgc << ")";
+       << "Finding Fermi momenta table entry for tgt = " << tgt_pdgc;
+
+  KF_t kf;
+  kf.p = 0;
+  kf.n = 0;
 
   if(fKFSets.size()==0) {
       LOG("FermiP", pWARN)
          << "The Fermi momenta table is empty! Returning kf(tgt = "
-                  << tgt_pdgc << ", nucl = " << nucleon_pdgc << ") = 0";
-      return 0;
+                  << tgt_pdgc << ") = 0";
+      return kf;
   }
 
-  double kf=0;
-  bool isp = pdg::IsProton(nucleon_pdgc);
-
-  if(fKFSets.count(tgt_pdgc) == 1) {
+  map<int, KF_t>::const_iterator table_iter = fKFSets.find(tgt_pdgc);
+  if(table_iter != fKFSets.end()) {
      LOG("FermiP", pDEBUG) << "Got exact match in Fermi momenta table";
-     map<int, KF_t>::const_iterator table_iter = fKFSets.find(tgt_pdgc);
-     if(isp) kf = table_iter->second.p;
-     else    kf = table_iter->second.n;
-     LOG("FermiP", pINFO) << "kF = " << kf;
+     kf = table_iter->second;
+     LOG("FermiP", pINFO) << "kF(p) = " << kf.p << ", kF(n) = " << kf.n;
      return kf;
   }
   LOG("FermiP", pINFO) << "Couldn't find exact match in Fermi momenta table";
@@ -79,14 +130,12 @@ double FermiMomentumTable::FindClosestKF(int tgt_pdgc, int nucleon_pdgc) const
       dZmin = dZ;
       Zc = Zt;
       Ac = pdg::IonPdgCodeToA(pdgc);
-      KF_t kft  = kfiter->second;
-      if(isp) kf=kft.p;
-      else    kf=kft.n;
+      kf = kfiter->second;
     }
   }
   LOG("FermiP", pINFO)
        << "The closest nucleus in table is pdgc = " << pdg::IonPdgCode(Ac,Zc);
-  LOG("FermiP", pINFO) << "kF = " << kf;
+  LOG("FermiP", pINFO) << "kF(p) = " << kf.p << ", kF(n) = " << kf.n;
   return kf;
 }
 //____________________________________________________________________________
@@ -5,6 +5,10 @@
 
 \brief    A table of Fermi momentum constants
 
+          The Fermi momenta found for a target (its own table entry or the
+          entry of the closest nucleus) are kept, so that the table search
+          is done once per target.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -41,7 +45,13 @@ public:
   void   AddTableEntry (int target_pdgc, KF_t kf);
 
 private:
+  const KF_t & ClosestKF    (int target_pdgc) const;
+  KF_t         SearchClosest(int target_pdgc) const;
+
   map<int, KF_t> fKFSets; // the actual Fermi momenta table
+
+  mutable map<int, KF_t> fClosestKFSets; // Fermi momenta found per target (filled under a lock)
+  unsigned long          fRevision;      // unique id of the table contents (see ClosestKF())
 };
 
 }      // genie namespace
@@ -24,6 +24,11 @@
    gas model can access the radius.
    Added a check to see if a local Fermi gas model is being used. If so,
    use a local Fermi gas model when deciding whether to eject a recoil nucleon.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Get the Fermi momentum table at configuration and the local Fermi gas
+   momentum from utils::nuclear::LocalFermiMomentum().
+   Uses the nuclear model resolved for the channel (see ResolvedAlgs), rather
+   than selecting it for every event.
 */
 //____________________________________________________________________________
 
@@ -43,6 +48,7 @@
 #include "Physics/NuclearState/NuclearModel.h"
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/EventGen/ResolvedAlgs.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepStatus.h"
@@ -63,13 +69,15 @@ using namespace genie::constants;
 
 //___________________________________________________________________________
 FermiMover::FermiMover() :
-EventRecordVisitorI("genie::FermiMover")
+EventRecordVisitorI("genie::FermiMover"),
+fKFTable(0)
 {
 
 }
 //___________________________________________________________________________
 FermiMover::FermiMover(string config) :
-EventRecordVisitorI("genie::FermiMover", config)
+EventRecordVisitorI("genie::FermiMover", config),
+fKFTable(0)
 {
 
 }
@@ -118,10 +126,16 @@ void FermiMover::KickHitNucleon(GHepRecord * evrec) const
   // generate a Fermi momentum & removal energy
   // call GenerateNucleon with a radius in case the model is LocalFGM
   double rad = nucleon->X4()->Vect().Mag();
-  fNuclModel->GenerateNucleon(*tgt,rad);
+  // use the model selected once for the channel's target, if any
+  const NuclearModelI * nucl_model = fNuclModel;
+  const ResolvedAlgs * algs = interaction->ResolvedAlgsPtr();
+  if(algs && algs->TgtPdg() == tgt->Pdg()) {
+    nucl_model = algs->Resolved(fNuclModel);
+  }
+  nucl_model->GenerateNucleon(*tgt,rad);
 
-  TVector3 p3 = fNuclModel->Momentum3();
-  double w    = fNuclModel->RemovalEnergy();
+  TVector3 p3 = nucl_model->Momentum3();
+  double w    = nucl_model->RemovalEnergy();
 
   LOG("FermiMover", pINFO)
      << "Generated nucleon momentum: ("
@@ -142,7 +156,7 @@ void FermiMover::KickHitNucleon(GHepRecord * evrec) const
   // Set this to either a proton or neutron to eject a secondary particle
   int eject_nucleon_pdg = 0;
   FermiMoverInteractionType_t interaction_type =
-      fNuclModel->GetFermiMoverInteractionType();
+      nucl_model->GetFermiMoverInteractionType();
   if (interaction_type == kFermiMoveEffectiveSF1p1h) {
     EN = nucleon->Mass() - w -
            pF2 / (2 * (nucleus->Mass() - nucleon->Mass()));
@@ -201,19 +215,15 @@ void FermiMover::KickHitNucleon(GHepRecord * evrec) const
       // Calculate the Fermi momentum, using a local Fermi gas if the
       // nuclear model is LocalFGM, and RFG otherwise
       double kF;
-      if(fNuclModel->ModelType(*tgt) == kNucmLocalFermiGas){
+      if(nucl_model->ModelType(*tgt) == kNucmLocalFermiGas){
 	assert(pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc));
 	int A = tgt->A();
 	bool is_p = pdg::IsProton(nucleon_pdgc);
 	double numNuc = (is_p) ? (double)tgt->Z():(double)tgt->N();
 	double radius = nucleon->X4()->Vect().Mag();
-	double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
-	kF= TMath::Power(3*kPi2*numNuc*
-		  genie::utils::nuclear::Density(radius,A),1.0/3.0) *hbarc;
+	kF = genie::utils::nuclear::LocalFermiMomentum(radius, A, (int)numNuc);
       }else{
-	FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
-	const FermiMomentumTable * kft  = kftp->GetTable("Default");
-	kF = kft->FindClosestKF(nucleus_pdgc, nucleon_pdgc);
+	kF = fKFTable->FindClosestKF(nucleus_pdgc, nucleon_pdgc);
       }
       if (TMath::Sqrt(pF2) > kF) {
         double Pp = (nucleon->Pdg() == kPdgProton) ? 0.05 : 0.95;
@@ -276,7 +286,7 @@ void FermiMover::Emit2ndNucleonFromSRC(GHepRecord * evrec,
   double px = -1.* nucleon->Px();
   double py = -1.* nucleon->Py();
   double pz = -1.* nucleon->Pz();
-  double M  = PDGLibrary::Instance()->Find(eject_pdg_code)->Mass();
+  double M  = PDGLibrary::Instance()->Mass(eject_pdg_code);
   double E  = TMath::Sqrt(px*px+py*py+pz*pz+M*M);
 
   evrec->AddParticle(
@@ -346,6 +356,14 @@ void FermiMover::AddTargetNucleusRemnant(GHepRecord * evrec) const
        ipdgc,kIStStableFinalState, imom,-1,-1,-1, Px,Py,Pz,E, 0,0,0,0);
 }
 //___________________________________________________________________________
+void FermiMover::ResolveAlgs(const Interaction * in, ResolvedAlgs & algs) const
+{
+  const Target & tgt = in->InitState().Tgt();
+  if(!tgt.IsNucleus()) return;
+
+  algs.AddResolved(fNuclModel, fNuclModel->SelectModel(tgt));
+}
+//___________________________________________________________________________
 void FermiMover::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -367,5 +385,7 @@ void FermiMover::LoadConfig(void)
 
   this->GetParamDef("KeepHitNuclOnMassShell", fKeepNuclOnMassShell, false);
   this->GetParamDef("SimRecoilNucleon",       fSRCRecoilNucleon,    false);
+
+  fKFTable = FermiMomentumTablePool::Instance()->GetTable("Default");
 }
 //____________________________________________________________________________
@@ -26,6 +26,7 @@
 namespace genie {
 
 class NuclearModelI;
+class FermiMomentumTable;
 
 class FermiMover : public EventRecordVisitorI {
 
@@ -37,6 +38,9 @@ public :
   //-- implement the EventRecordVisitorI interface
   void ProcessEventRecord(GHepRecord * event_rec) const;
 
+  //-- select the nuclear model once for each channel (see ResolvedAlgs)
+  void ResolveAlgs(const Interaction * in, ResolvedAlgs & algs) const;
+
   //-- overload the Algorithm::Configure() methods to load private data
   //   members from configuration options
   void Configure(const Registry & config);
@@ -55,6 +59,7 @@ private:
   bool  fKeepNuclOnMassShell;          ///< keep hit bound nucleon on the mass shell?
   bool  fSRCRecoilNucleon;             ///< simulate recoil nucleon due to short range corellation?
   const NuclearModelI *  fNuclModel;   ///< nuclear model
+  const FermiMomentumTable * fKFTable; ///< Fermi momentum table (for the recoil nucleon of non-LFG models)
 };
 
 }      // genie namespace
@@ -54,23 +54,19 @@ bool LocalFGM::GenerateNucleon(const Target & target,
 {
   assert(target.HitNucIsSet());
 
-  fCurrRemovalEnergy = 0;
-  fCurrMomentum.SetXYZ(0,0,0);
+  this->SetRemovalEnergy(0);
+  this->SetMomentum3(TVector3(0,0,0));
+
+  RandomGen * rnd = RandomGen::Instance();
 
   //-- set fermi momentum vector
+  //   (dP/dp ~ p^2 for p < kF, inverted analytically)
   //
-  TH1D * prob = this->ProbDistro(target,hitNucleonRadius);
-  if(!prob) {
-    LOG("LocalFGM", pNOTICE)
-              << "Null nucleon momentum probability distribution";
-    exit(1);
-  }
-  double p = prob->GetRandom();
-  delete prob;
+  double KF = this->FermiMomentum(target,hitNucleonRadius);
+  double p  = (KF > 0) ? KF * TMath::Power(rnd->RndGen().Rndm(), 1./3.) : 0.;
+  if(p > fPMax) p = fPMax;
   LOG("LocalFGM", pINFO) << "|p,nucleon| = " << p;
 
-  RandomGen * rnd = RandomGen::Instance();
-
   double costheta = -1. + 2. * rnd->RndGen().Rndm();
   double sintheta = TMath::Sqrt(1.-costheta*costheta);
   double fi       = 2 * kPi * rnd->RndGen().Rndm();
@@ -81,14 +77,14 @@ bool LocalFGM::GenerateNucleon(const Target & target,
   double py = p*sintheta*sinfi;
   double pz = p*costheta;
 
-  fCurrMomentum.SetXYZ(px,py,pz);
+  this->SetMomentum3(TVector3(px,py,pz));
 
   //-- set removal energy
   //
   int Z = target.Z();
   map<int,double>::const_iterator it = fNucRmvE.find(Z);
-  if(it != fNucRmvE.end()) fCurrRemovalEnergy = it->second;
-  else fCurrRemovalEnergy = nuclear::BindEnergyPerNucleon(target);
+  if(it != fNucRmvE.end()) this->SetRemovalEnergy(it->second);
+  else this->SetRemovalEnergy(nuclear::BindEnergyPerNucleon(target));
 
   return true;
 }
@@ -96,27 +92,25 @@ bool LocalFGM::GenerateNucleon(const Target & target,
 double LocalFGM::Prob(double p, double w, const Target & target,
 			     double hitNucleonRadius) const
 {
+// For w < 0: the probability of a nucleon momentum in the 1 MeV/c wide 
+// interval at p, from dP/dp = 3 p^2 / kF^3 (p < kF)
+//
   if(w<0) {
-    TH1D * prob = this->ProbDistro(target, hitNucleonRadius);
-    int bin = prob->FindBin(p);
-    double y  = prob->GetBinContent(bin);
-    double dx = prob->GetBinWidth(bin);
-    double pr  = y*dx;
-    delete prob;
-    return pr;
+    if(p < 0 || p >= fPMax) return 0.;
+    double KF = this->FermiMomentum(target, hitNucleonRadius);
+    if(KF <= 0 || p > KF) return 0.;
+    int    npbins = (int) (1000*fPMax);
+    double dx     = fPMax / npbins;
+    double dP_dp  = 3. * p*p / (KF*KF*KF);
+    return dP_dp*dx;
   }
   return 1;
 }
 //____________________________________________________________________________
-// *** The TH1D object must be deleted after it is used ***
-TH1D * LocalFGM::ProbDistro(const Target & target, double r) const
+double LocalFGM::FermiMomentum(const Target & target, double r) const
 {
-  LOG("LocalFGM", pNOTICE)
-             << "Computing P = f(p_nucleon) for: " << target.AsString()
-	     << ", Nucleon Radius = " << r;
-  LOG("LocalFGM", pNOTICE)
-             << ", P(max) = " << fPMax;
-
+// Local Fermi momentum of the hit nucleon type at the radius r
+//
   //-- get information for the nuclear target
   int nucleon_pdgc = target.HitNucPdg();
   assert(pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc));
@@ -127,58 +121,14 @@ TH1D * LocalFGM::ProbDistro(const Target & target, double r) const
   double numNuc = (is_p) ? (double)target.Z():(double)target.N();
 
   // Calculate Fermi Momentum using Local FG equations
-  double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
-  double KF= TMath::Power(3*kPi2*numNuc*genie::utils::nuclear::Density(r,A),
-			    1.0/3.0) *hbarc;
-
-  LOG("LocalFGM",pNOTICE) << "KF = " << KF;
-
-  double a  = 2.0;
-  double C  = 4. * kPi * TMath::Power(KF,3) / 3.;
+  double KF = genie::utils::nuclear::LocalFermiMomentum(r, A, (int)numNuc);
 
-  // Do not include nucleon correlation tail
-  //double R  = 1. / (1.- KF/4.);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("LocalFGM", pDEBUG) << "a  = " << a;
-  LOG("LocalFGM", pDEBUG) << "C  = " << C;
-  //LOG("LocalFGM", pDEBUG) << "R  = " << R;
+  LOG("LocalFGM", pDEBUG)
+    << "KF = " << KF << " for: " << target.AsString() << ", Nucleon Radius = " << r;
 #endif
 
-  //-- create the probability distribution
-
-  int npbins = (int) (1000*fPMax);
-  TH1D * prob = new TH1D("", "", npbins, 0, fPMax);
-  prob->SetDirectory(0);
-
-  double dp = fPMax / (npbins-1);
-  double iC = (C>0) ? 1./C : 0.;
-  double kfa_pi_2 = TMath::Power(KF*a/kPi,2);
-
-  for(int i = 0; i < npbins; i++) {
-     double p  = i * dp;
-     double p2 = TMath::Power(p,2);
-
-     // calculate |phi(p)|^2
-     double phi2 = 0;
-     if (p <= KF)
-        phi2 = iC * (1. - 6.*kfa_pi_2);
-
-     // Do not include nucleon correlation tail
-     //else if ( p > KF && p < fPCutOff)
-     //   phi2 = iC * (2*R*kfa_pi_2*TMath::Power(KF/p,4.));
-
-     // calculate probability density : dProbability/dp
-     double dP_dp = 4*kPi * p2 * phi2;
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("LocalFGM", pDEBUG) << "p = " << p << ", dP/dp = " << dP_dp;
-#endif
-     prob->Fill(p, dP_dp);
-  }
-
-  //-- normalize the probability distribution
-  prob->Scale( 1.0 / prob->Integral("width") );
-
-  return prob;
+  return KF;
 }
 //____________________________________________________________________________
 void LocalFGM::Configure(const Registry & config)
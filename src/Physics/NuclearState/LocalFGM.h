@@ -6,6 +6,10 @@
 \brief    local Fermi gas model. Implements the NuclearModelI 
           interface.
 
+          The nucleon momentum distribution at radius r is dP/dp ~ p^2 up
+          to the local Fermi momentum kF(r), and is sampled by inverting its
+          cumulative distribution (p = kF u^{1/3}).
+
 \ref      
 
 \author   Joe Johnston, Steven Dytman
@@ -23,8 +27,6 @@
 
 #include <map>
 
-#include <TH1D.h>
-
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
@@ -64,8 +66,8 @@ public:
   void Configure (string param_set)
 ;
 private:
-  void   LoadConfig (void);
-  TH1D * ProbDistro (const Target & t, double r) const;
+  void   LoadConfig    (void);
+  double FermiMomentum (const Target & t, double r) const;
 
   map<int, double> fNucRmvE;
 
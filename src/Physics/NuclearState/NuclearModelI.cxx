@@ -14,6 +14,8 @@
  @ Mar 18, 2016- Joe Johnston (SD)
    Update GenerateNucleon() and Prob() to accept a radius as the argument,
    and call the corresponding methods in the nuclear model with a radius.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The nucleon generated last is kept per thread (see the accessors below).
 
 */
 //____________________________________________________________________________
@@ -29,11 +31,85 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Numerical/RandomGen.h"
 
+#include <unordered_map>
+
 using std::ostringstream;
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::controls;
 
+//____________________________________________________________________________
+namespace {
+
+  // The nucleon generated last by a model, in the calling thread: The models
+  // are shared by the event generation threads, and the nucleon generated
+  // by GenerateNucleon() is read back by the caller with the accessors.
+  struct NucleonState_t {
+    NucleonState_t()
+      : removal_energy(0), momentum(0,0,0), type(kFermiMoveDefault) {}
+    double                      removal_energy;
+    TVector3                    momentum;
+    FermiMoverInteractionType_t type;
+  };
+
+  thread_local std::unordered_map<const NuclearModelI *, NucleonState_t> gNucleonStates;
+  thread_local const NuclearModelI * gLastModel = 0;
+  thread_local NucleonState_t *      gLastState = 0;
+
+  inline NucleonState_t & NucleonState(const NuclearModelI * model)
+  {
+    if(model != gLastModel) {
+      gLastState = &gNucleonStates[model];
+      gLastModel = model;
+    }
+    return *gLastState;
+  }
+}
+//____________________________________________________________________________
+NuclearModelI::~NuclearModelI()
+{
+  // the states of the other threads are dropped at their exit
+  gNucleonStates.erase(this);
+  if(gLastModel == this) {
+    gLastModel = 0;
+    gLastState = 0;
+  }
+}
+//____________________________________________________________________________
+double NuclearModelI::RemovalEnergy(void) const
+{
+  return NucleonState(this).removal_energy;
+}
+//____________________________________________________________________________
+double NuclearModelI::Momentum(void) const
+{
+  return NucleonState(this).momentum.Mag();
+}
+//____________________________________________________________________________
+const TVector3 & NuclearModelI::Momentum3(void) const
+{
+  return NucleonState(this).momentum;
+}
+//____________________________________________________________________________
+FermiMoverInteractionType_t NuclearModelI::GetFermiMoverInteractionType(void) const
+{
+  return NucleonState(this).type;
+}
+//____________________________________________________________________________
+void NuclearModelI::SetMomentum3(const TVector3 & mom) const
+{
+  NucleonState(this).momentum = mom;
+}
+//____________________________________________________________________________
+void NuclearModelI::SetRemovalEnergy(double E) const
+{
+  NucleonState(this).removal_energy = E;
+}
+//____________________________________________________________________________
+void NuclearModelI::SetFermiMoverInteractionType(FermiMoverInteractionType_t type) const
+{
+  NucleonState(this).type = type;
+}
 //____________________________________________________________________________
 
 bool NuclearModelI::GenerateNucleon(const Target & tgt,
@@ -22,6 +22,11 @@
    as the arguments. Currently used by LocalFGM. Calls
    GenerateNucleon() with the radius set to 0 for all other NuclearModelI
    implementations.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added SelectModel(), the model actually used for a given target.
+   The nucleon generated last (momentum, removal energy, interaction type)
+   is kept per thread, so that models can be shared by the event generation
+   threads.
 
 */
 //____________________________________________________________________________
@@ -42,7 +47,7 @@ namespace genie {
 class NuclearModelI : public Algorithm {
 
 public:
-  virtual ~NuclearModelI() {};
+  virtual ~NuclearModelI();
 
   virtual bool           GenerateNucleon (const Target &) const = 0;
   virtual bool           GenerateNucleon (const Target & tgt,
@@ -54,60 +59,33 @@ public:
 
   virtual NuclearModel_t ModelType       (const Target &) const = 0;
 
-  inline double         RemovalEnergy   (void)           const
-  {
-    return fCurrRemovalEnergy;
-  }
+  //! the model used for the input target: itself, except for the models
+  //! delegating to other models (eg NuclearModelMap). Its result can be
+  //! used directly in place of this model for that target.
+  virtual const NuclearModelI * SelectModel (const Target &) const { return this; }
 
-  inline double         Momentum        (void)           const
-  {
-    return fCurrMomentum.Mag();
-  }
-
-  inline const TVector3& Momentum3      (void)           const
-  {
-    return fCurrMomentum;
-  }
-
-  inline FermiMoverInteractionType_t GetFermiMoverInteractionType(void) const
-  {
-    return fFermiMoverInteractionType;
-  }
+  //! the nucleon generated last by the calling thread
+  double                      RemovalEnergy   (void) const;
+  double                      Momentum        (void) const;
+  const TVector3 &            Momentum3       (void) const;
+  FermiMoverInteractionType_t GetFermiMoverInteractionType (void) const;
 
   // These setters have to be const. I hate it. We should really update this class interface
-  inline void SetMomentum3(const TVector3 & mom) const
-  {
-    fCurrMomentum = mom;
-  };
-  inline void SetRemovalEnergy(double E) const
-  {
-    fCurrRemovalEnergy = E;
-  }
+  void SetMomentum3                 (const TVector3 & mom)              const;
+  void SetRemovalEnergy             (double E)                          const;
+  void SetFermiMoverInteractionType (FermiMoverInteractionType_t type)  const;
 
 protected:
   NuclearModelI()
     : Algorithm()
-    , fCurrRemovalEnergy(0)
-    , fCurrMomentum(0,0,0)
-    , fFermiMoverInteractionType(kFermiMoveDefault)
     {};
   NuclearModelI(std::string name)
     : Algorithm(name)
-    , fCurrRemovalEnergy(0)
-    , fCurrMomentum(0,0,0)
-    , fFermiMoverInteractionType(kFermiMoveDefault)
     {};
   NuclearModelI(std::string name, std::string config)
     : Algorithm(name, config)
-    , fCurrRemovalEnergy(0)
-    , fCurrMomentum(0,0,0)
-    , fFermiMoverInteractionType(kFermiMoveDefault)
     {};
 
-  mutable double   fCurrRemovalEnergy;
-  mutable TVector3 fCurrMomentum;
-  mutable FermiMoverInteractionType_t fFermiMoverInteractionType;
-
 };
 
 }         // genie namespace
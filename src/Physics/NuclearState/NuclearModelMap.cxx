@@ -14,6 +14,9 @@
  @ Mar 18, 2016- Joe Johnston (SD)
    Update GenerateNucleon() and Prob() to accept a radius as the argument,
    and call the corresponding methods in the nuclear model with a radius.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   SelectModel() is public, so that the model can be selected once for each
+   target (see ResolvedAlgs).
 
 */
 //____________________________________________________________________________
@@ -65,10 +68,10 @@ bool NuclearModelMap::GenerateNucleon(const Target & target,
 
   bool ok = nm->GenerateNucleon(target,hitNucleonRadius);
 
-  fCurrRemovalEnergy = nm->RemovalEnergy();
+  this->SetRemovalEnergy(nm->RemovalEnergy());
   const TVector3& p  = nm->Momentum3();
-  fCurrMomentum.SetXYZ(p.Px(), p.Py(), p.Pz());
-  fFermiMoverInteractionType = nm->GetFermiMoverInteractionType();
+  this->SetMomentum3(TVector3(p.Px(), p.Py(), p.Pz()));
+  this->SetFermiMoverInteractionType(nm->GetFermiMoverInteractionType());
 
   return ok;
 }
@@ -53,6 +53,9 @@ public:
   }
   NuclearModel_t ModelType       (const Target & t) const;
 
+  //-- the model of the map used for the input target (see ResolvedAlgs)
+  const NuclearModelI * SelectModel (const Target & t) const;
+
   //-- override the Algorithm::Configure methods to load configuration
   //   data to private data members
   void Configure (const Registry & config);
@@ -60,7 +63,6 @@ public:
 
 private:
   void LoadConfig(void);
-  const NuclearModelI * SelectModel(const Target & t) const;
 
   const NuclearModelI * fDefGlobModel;            ///< default basic model (should work for all nuclei)
   map<int, const NuclearModelI *> fRefinedModels; ///< refinements for specific elements
@@ -31,16 +31,25 @@
  @ Mar 18, 2016 - JJ (SD)
    Check if a local Fermi gas model should be used when calculating the
    Fermi momentum
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Density() keeps the density profile parameters of the last nucleus used
+   by each thread and evaluates the (ring-shifted) profile in closed form,
+   instead of re-deriving the parameters and logging at each call.
+   Added LocalFermiMomentum(), reading the local Fermi gas momentum off a
+   radial table kept for the last nucleus used by each thread.
 */
 //____________________________________________________________________________
 
+#include <cmath>
 #include <cstdlib>
+#include <vector>
 
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
@@ -175,7 +184,6 @@ double genie::utils::nuclear::NuclQELXSecSuppression(
 
   double kFi, kFf;
   if(lfg){
-    double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
     Target* tgt = interaction->InitStatePtr()->TgtPtr();
     double radius = tgt->HitNucPosition();
 
@@ -183,13 +191,11 @@ double genie::utils::nuclear::NuclQELXSecSuppression(
     // kFi
     bool is_p_i = pdg::IsProton(struck_nucleon_pdgc);
     double numNuci = (is_p_i) ? (double)tgt->Z():(double)tgt->N();
-    kFi = TMath::Power(3*kPi2*numNuci*
-		     genie::utils::nuclear::Density(radius,A),1.0/3.0) *hbarc;
+    kFi = LocalFermiMomentum(radius, A, (int)numNuci);
     // kFi
     bool is_p_f = pdg::IsProton(final_nucleon_pdgc);
     double numNucf = (is_p_f) ? (double)tgt->Z():(double)tgt->N();
-    kFf = TMath::Power(3*kPi2*numNucf*
-		     genie::utils::nuclear::Density(radius,A),1.0/3.0) *hbarc;
+    kFf = LocalFermiMomentum(radius, A, (int)numNucf);
   }else{
     // get the requested Fermi momentum table 
     FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
@@ -384,50 +390,130 @@ double genie::utils::nuclear::DISNuclFactor(double x, int A)
   return f;
 }
 //___________________________________________________________________________
+namespace {
+  // density profile of a nucleus, as set up in DensityProfile()
+  struct DensityProfile_t {
+    int    A;
+    bool   woods_saxon; // Woods-Saxon (A>20) or modified harmonic osc.
+    double p1;          // c (Woods-Saxon) or a (harmonic osc.), in fm
+    double p2;          // z (Woods-Saxon) or alf (harmonic osc.)
+    double norm;        // normalization to 1
+    double ring_max;    // ring size limit, in fm
+  };
+
+  void DensityProfile(int A, DensityProfile_t & prof)
+  {
+    prof.A = A;
+    if(A>20) {
+      double c = 1., z = 1.;
+
+      if      (A ==  27) { c = 3.07; z = 0.52; }  // aluminum
+      else if (A ==  28) { c = 3.07; z = 0.54; }  // silicon
+      else if (A ==  40) { c = 3.53; z = 0.54; }  // argon
+      else if (A ==  56) { c = 4.10; z = 0.56; }  // iron
+      else if (A == 208) { c = 6.62; z = 0.55; }  // lead
+      else {
+         c = TMath::Power(A,0.35); z = 0.54;
+      } //others
+
+      prof.woods_saxon = true;
+      prof.p1          = c;
+      prof.p2          = z;
+      prof.norm        = (3./(4.*kPi*TMath::Power(c,3)))*1./(1.+TMath::Power((kPi*z/c),2));
+      prof.ring_max    = 0.75*c;
+      return;
+    }
+
+    double ap = 1., alf = 1.;
+    if (A>4) {
+      if      (A ==  7) { ap = 1.77; alf = 0.327; } // lithium
+      else if (A == 12) { ap = 1.69; alf = 1.08;  } // carbon
+      else if (A == 14) { ap = 1.76; alf = 1.23;  } // nitrogen
+      else if (A == 16) { ap = 1.83; alf = 1.54;  } // oxygen
+      else  {
+        ap=1.75; alf=-0.4+.12*A;
+      }  //others- alf=0.08 if A=4
+    }
+    else {
+      // helium
+      ap = 1.9/TMath::Sqrt(2.);
+      alf=0.;
+    }
+    prof.woods_saxon = false;
+    prof.p1          = ap;
+    prof.p2          = alf;
+    prof.norm        = 1./((5.568 + alf*8.353)*TMath::Power(ap,3.));
+    prof.ring_max    = 0.3*ap;
+  }
+}
+//___________________________________________________________________________
 double genie::utils::nuclear::Density(double r, int A, double ring)
 {
 // [by S.Dytman]
 //
-  if(A>20) {
-    double c = 1., z = 1.;
-
-    if      (A ==  27) { c = 3.07; z = 0.52; }  // aluminum
-    else if (A ==  28) { c = 3.07; z = 0.54; }  // silicon
-    else if (A ==  40) { c = 3.53; z = 0.54; }  // argon
-    else if (A ==  56) { c = 4.10; z = 0.56; }  // iron
-    else if (A == 208) { c = 6.62; z = 0.55; }  // lead
-    else { 
-       c = TMath::Power(A,0.35); z = 0.54; 
-    } //others
-
-    LOG("Nuclear",pINFO)
-	<< "r= " << r << ", ring= " << ring;
-    double rho = DensityWoodsSaxon(r,c,z,ring);
-    return rho;
-  }
-  else if (A>4) {
-    double ap = 1., alf = 1.;
+// Same as DensityWoodsSaxon() (for A>20) or DensityGaus() with the density
+// parameters of the nucleus, kept from call to call by each thread.
+//
+  static thread_local DensityProfile_t prof = { -1, false, 0., 0., 0., 0. };
+  if(prof.A != A) DensityProfile(A, prof);
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("Nuclear", pDEBUG) << "r= " << r << ", A= " << A << ", ring= " << ring;
+#endif
 
-    if      (A ==  7) { ap = 1.77; alf = 0.327; } // lithium
-    else if (A == 12) { ap = 1.69; alf = 1.08;  } // carbon
-    else if (A == 14) { ap = 1.76; alf = 1.23;  } // nitrogen
-    else if (A == 16) { ap = 1.83; alf = 1.54;  } // oxygen
-    else  { 
-      ap=1.75; alf=-0.4+.12*A; 
-    }  //others- alf=0.08 if A=4
+  ring = TMath::Min(ring, prof.ring_max);
 
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
+  if(prof.woods_saxon) {
+    double ceval = prof.p1 + ring;
+    return prof.norm / (1 + TMath::Exp((r-ceval)/prof.p2));
   }
-  else {
-    // helium
-    double ap = 1.9/TMath::Sqrt(2.);  
-    double alf=0.;    
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
+
+  double aeval = prof.p1 + ring;
+  double b     = TMath::Power(r/aeval, 2.);
+  return prof.norm * (1. + prof.p2*b) * TMath::Exp(-b);
+}
+//___________________________________________________________________________
+namespace {
+  // local Fermi momentum of a nucleus per cube root of the nucleon number,
+  // (3 pi^2 rho(r))^(1/3) hbar c, at radial steps of kKFStep
+  struct LocalKFTable_t {
+    int                 A;
+    double              rmax;
+    std::vector<double> kf;
+  };
+  const double kKFStep = 0.01; // fm
+}
+//___________________________________________________________________________
+double genie::utils::nuclear::LocalFermiMomentum(double r, int A, int nnuc)
+{
+// Local Fermi gas momentum (in GeV) of the nnuc protons or neutrons of a
+// nucleus with mass number A, at the radius r (in fm):
+// kF = (3 pi^2 nnuc rho(r,A))^(1/3) hbar c
+// The nucleon number independent factor is interpolated from a table, out
+// to 4 nuclear radii, built for the last nucleus used by each thread (and
+// is computed directly beyond).
+//
+  static const double hbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
+  static thread_local LocalKFTable_t tab = { -1, 0., std::vector<double>() };
+
+  if(tab.A != A) {
+    tab.A    = A;
+    tab.rmax = 4. * Radius(A);
+    int n = (int) std::ceil(tab.rmax / kKFStep) + 2;
+    tab.kf.resize(n);
+    for(int i = 0; i < n; i++) {
+      tab.kf[i] = std::cbrt(3*kPi2*Density(i*kKFStep, A)) * hbarc;
+    }
   }
 
-  return 0;
+  double cbrt_nnuc = std::cbrt((double)nnuc);
+  if(r < 0 || r >= tab.rmax) {
+    return cbrt_nnuc * std::cbrt(3*kPi2*Density(r, A)) * hbarc;
+  }
+  double x = r / kKFStep;
+  int    i = (int) x;
+  double f = x - i;
+  return cbrt_nnuc * ((1-f)*tab.kf[i] + f*tab.kf[i+1]);
 }
 //___________________________________________________________________________
 double genie::utils::nuclear::DensityGaus(
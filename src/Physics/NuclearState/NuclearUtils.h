@@ -58,6 +58,8 @@ namespace nuclear
   double DensityGaus       (double r, double ap, double alf, double ring=0.);
   double DensityWoodsSaxon (double r, double c, double z, double ring=0.);
 
+  double LocalFermiMomentum (double r, int A, int nnuc);
+
   double BindEnergyPerNucleonParametrization(const Target & target);
   double FermiMomentumForIsoscalarNucleonParametrization(const Target & target);
 
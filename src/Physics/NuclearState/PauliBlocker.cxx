@@ -97,9 +97,7 @@ void PauliBlocker::ProcessEventRecord(GHepRecord * evrec) const
     bool is_p = pdg::IsProton(nucleon_pdgc);
     double numNuc = (is_p) ? (double)tgt->Z():(double)tgt->N();
     double radius = hit->X4()->Vect().Mag();
-    double hbarc = kLightSpeed*kPlankConstant/units::fermi;
-    kf= TMath::Power(3*kPi2*numNuc*
-		     genie::utils::nuclear::Density(radius,A),1.0/3.0) *hbarc;
+    kf = genie::utils::nuclear::LocalFermiMomentum(radius, A, (int)numNuc);
   }else{
     kf = fKFTable->FindClosestKF(tgt_pdgc, nuc_pdgc);
   }
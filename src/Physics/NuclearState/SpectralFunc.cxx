@@ -12,9 +12,15 @@
  Important revisions after version 2.0.0 :
  @ May 01, 2012 - CA
    Pick spectral function data from $GENIE/data/evgen/nucl/spectral_functions
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Tabulate the spectral functions on a regular grid at configuration time.
+   GenerateNucleon() picks a grid cell from an alias table of the cell 
+   integrals and a point in the cell, instead of an accept/reject loop with
+   TGraph2D interpolations. Prob() interpolates the grid.
 */
 //____________________________________________________________________________
 
+#include <TMath.h>
 #include <TSystem.h>
 #include <TNtupleD.h>
 #include <TGraph2D.h>
@@ -26,107 +32,118 @@
 #include "Physics/NuclearState/SpectralFunc.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/UniformBuffer.h"
 
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::controls;
 
+namespace {
+  // number of grid nodes in momentum and in removal energy
+  const int kSFGridNodes = 161;
+
+  // t in [0,1] for a pdf linear in t, with values a, b at t = 0, 1
+  // (u: uniform random number in [0,1))
+  double SampleLinear(double a, double b, double u)
+  {
+    double sum = a + b;
+    if(sum <= 0) return u;
+    double r    = 0.5 * u * sum;
+    double disc = TMath::Max(0., a*a + 2*(b-a)*r);
+    double den  = a + TMath::Sqrt(disc);
+    double t    = (den > 0) ? 2*r/den : u;
+    return TMath::Min(TMath::Max(t, 0.), 1.);
+  }
+}
 //____________________________________________________________________________
 SpectralFunc::SpectralFunc() :
 NuclearModelI("genie::SpectralFunc")
 {
-  fSfFe56 = 0;
-  fSfC12  = 0;
+
 }
 //____________________________________________________________________________
 SpectralFunc::SpectralFunc(string config) :
 NuclearModelI("genie::SpectralFunc", config)
 {
-  fSfFe56 = 0;
-  fSfC12  = 0;
+
 }
 //____________________________________________________________________________
 SpectralFunc::~SpectralFunc()
 {
-//if (fSfFe56) delete fSfFe56;
-//if (fSfC12 ) delete fSfC12;
+
 }
 //____________________________________________________________________________
 bool SpectralFunc::GenerateNucleon(const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
+  const SFGrid_t * sf = this->SelectSpectralFunction(target);
 
-  if(!sf) {
-    fCurrRemovalEnergy = 0.;
-    fCurrMomentum.SetXYZ(0.,0.,0.);
+  if(!sf || sf->cells.IsEmpty()) {
+    this->SetRemovalEnergy(0.);
+    this->SetMomentum3(TVector3(0.,0.,0.));
     return false;
   }
 
-  double kmin    = sf->GetXmin(); // momentum range
-  double kmax    = sf->GetXmax();
-  double wmin    = sf->GetYmin(); // removal energy range
-  double wmax    = sf->GetYmax();
-  double probmax = sf->GetZmax(); // maximum probability
-  probmax *= 1.1;
+  // random numbers drawn in blocks
+  UniformBuffer rnd(kRndmGen);
 
-  double dk = kmax - kmin;
-  double dw = wmax - wmin;
+  // grid cell, picked with a probability equal to its integral
+  int icell = sf->cells.Sample(rnd.Next());
+  int ik    = icell / (sf->nw - 1);
+  int iw    = icell % (sf->nw - 1);
 
-  LOG("SpectralFunc", pINFO) << "Momentum range = ["   << kmin << ", " << kmax << "]"; 
-  LOG("SpectralFunc", pINFO) << "Rmv energy range = [" << wmin << ", " << wmax << "]";
+  // point within the cell: momentum from the marginal distribution of the
+  // bilinear interpolation, then removal energy given the momentum
+  const double * v0 = &(sf->val[ ik   *sf->nw + iw]);
+  const double * v1 = &(sf->val[(ik+1)*sf->nw + iw]);
+  double x = SampleLinear(v0[0] + v0[1], v1[0] + v1[1], rnd.Next());
+  double y = SampleLinear(v0[0] + x*(v1[0]-v0[0]), 
+                          v0[1] + x*(v1[1]-v0[1]), rnd.Next());
 
-  RandomGen * rnd = RandomGen::Instance();
+  double kc = sf->kmin + (ik + x) * sf->dk;
+  double wc = sf->wmin + (iw + y) * sf->dw;
 
-  unsigned int niter = 0;
-  while(1) {
-    if(niter > kRjMaxIterations) {
-       LOG("SpectralFunc", pWARN) 
-           << "Couldn't generate a hit nucleon after " << niter << " iterations";
-       return false;
-    }
-    niter++;
-
-    // random pair
-    double kc = kmin + dk * rnd->RndGen().Rndm();
-    double wc = wmin + dw * rnd->RndGen().Rndm();
-    LOG("SpectralFunc", pINFO) << "Trying p = " << kc << ", w = " << wc;
-
-    // accept/reject
-    double prob  = this->Prob(kc,wc, target);
-    double probg = probmax * rnd->RndGen().Rndm();
-    bool accept = (probg < prob);
-    if(!accept) continue;
-
-    LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc; 
-    LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
-
-    // generate momentum components
-    double costheta = -1. + 2. * rnd->RndGen().Rndm();
-    double sintheta = TMath::Sqrt(1.-costheta*costheta);
-    double fi       = 2 * kPi * rnd->RndGen().Rndm();
-    double cosfi    = TMath::Cos(fi);
-    double sinfi    = TMath::Sin(fi);
-
-    double kx = kc*sintheta*cosfi;
-    double ky = kc*sintheta*sinfi;
-    double kz = kc*costheta;
-
-    // set generated values
-    fCurrRemovalEnergy = wc;
-    fCurrMomentum.SetXYZ(kx,ky,kz);
-
-    return true;
-  }
-  return false;
+  LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc; 
+  LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
+
+  // generate momentum components
+  double costheta = -1. + 2. * rnd.Next();
+  double sintheta = TMath::Sqrt(1.-costheta*costheta);
+  double fi       = 2 * kPi * rnd.Next();
+  double cosfi    = TMath::Cos(fi);
+  double sinfi    = TMath::Sin(fi);
+
+  double kx = kc*sintheta*cosfi;
+  double ky = kc*sintheta*sinfi;
+  double kz = kc*costheta;
+
+  // set generated values
+  this->SetRemovalEnergy(wc);
+  this->SetMomentum3(TVector3(kx,ky,kz));
+
+  return true;
 }
 //____________________________________________________________________________
 double SpectralFunc::Prob(
                          double p, double w, const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
-  if(!sf) return 0;
+// Bilinear interpolation of the tabulated spectral function (times p^2);
+// 0 outside the tabulated range
+
+  const SFGrid_t * sf = this->SelectSpectralFunction(target);
+  if(!sf || sf->val.empty()) return 0;
 
-  return sf->Interpolate(p,w);
+  double x = (p - sf->kmin) / sf->dk;
+  double y = (w - sf->wmin) / sf->dw;
+  if(x < 0 || y < 0 || x > sf->nk-1 || y > sf->nw-1) return 0;
+
+  int ik = TMath::Min((int) x, sf->nk-2);
+  int iw = TMath::Min((int) y, sf->nw-2);
+  x -= ik;
+  y -= iw;
+
+  const double * v0 = &(sf->val[ ik   *sf->nw + iw]);
+  const double * v1 = &(sf->val[(ik+1)*sf->nw + iw]);
+  return (1-x)*((1-y)*v0[0] + y*v0[1]) + x*((1-y)*v1[0] + y*v1[1]);
 }
 //____________________________________________________________________________
 void SpectralFunc::Configure(const Registry & config)
@@ -160,14 +177,17 @@ void SpectralFunc::LoadConfig(void)
   LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_fe56.GetEntries() << " Fe56 points";
   LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_c12.GetEntries()  << " C12 points";
 
-  if (fSfFe56) delete fSfFe56;
-  if (fSfC12 ) delete fSfC12;
+  TGraph2D * sf_fe56 = this->Convert2Graph(sfdata_fe56);
+  TGraph2D * sf_c12  = this->Convert2Graph(sfdata_c12);
 
-  fSfFe56 = this->Convert2Graph(sfdata_fe56);
-  fSfC12  = this->Convert2Graph(sfdata_c12);
+  sf_fe56->SetName("sf_fe56");
+  sf_c12 ->SetName("sf_c12");
 
-  fSfFe56->SetName("sf_fe56");
-  fSfC12 ->SetName("sf_c12");
+  this->BuildGrid(*sf_fe56, fSfFe56);
+  this->BuildGrid(*sf_c12,  fSfC12 );
+
+  delete sf_fe56;
+  delete sf_c12;
 }
 //____________________________________________________________________________
 TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
@@ -190,13 +210,53 @@ TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
   return sfgraph;
 }
 //____________________________________________________________________________
-TGraph2D * SpectralFunc::SelectSpectralFunction(const Target & t) const
+void SpectralFunc::BuildGrid(TGraph2D & sf, SFGrid_t & grid) const
+{
+// Tabulate the TGraph2D interpolation of the spectral function on a regular
+// grid spanning the data, and the integrals of its grid cells
+//
+  grid.nk   = kSFGridNodes;
+  grid.nw   = kSFGridNodes;
+  grid.kmin = sf.GetXmin();
+  grid.wmin = sf.GetYmin();
+  grid.dk   = (sf.GetXmax() - grid.kmin) / (grid.nk - 1);
+  grid.dw   = (sf.GetYmax() - grid.wmin) / (grid.nw - 1);
+
+  grid.val.resize(grid.nk * grid.nw);
+  for(int ik = 0; ik < grid.nk; ik++) {
+    double k = grid.kmin + ik * grid.dk;
+    for(int iw = 0; iw < grid.nw; iw++) {
+      double w = grid.wmin + iw * grid.dw;
+      double v = sf.Interpolate(k,w);
+      grid.val[ik*grid.nw + iw] = (v > 0) ? v : 0.;
+    }
+  }
+
+  std::vector<double> integral((grid.nk-1) * (grid.nw-1));
+  for(int ik = 0; ik < grid.nk-1; ik++) {
+    const double * v0 = &(grid.val[ ik   *grid.nw]);
+    const double * v1 = &(grid.val[(ik+1)*grid.nw]);
+    for(int iw = 0; iw < grid.nw-1; iw++) {
+      integral[ik*(grid.nw-1) + iw] = 0.25 * grid.dk * grid.dw *
+         (v0[iw] + v0[iw+1] + v1[iw] + v1[iw+1]);
+    }
+  }
+  grid.cells.Build(integral);
+
+  LOG("SpectralFunc", pINFO) 
+    << "Tabulated " << sf.GetName() << " on a " << grid.nk << " x " << grid.nw
+    << " grid: k = [" << grid.kmin << ", " << sf.GetXmax() << "], w = [" 
+    << grid.wmin << ", " << sf.GetYmax() << "] GeV";
+}
+//____________________________________________________________________________
+const SpectralFunc::SFGrid_t * 
+  SpectralFunc::SelectSpectralFunction(const Target & t) const
 {
-  TGraph2D * sf = 0;
+  const SFGrid_t * sf = 0;
   int pdgc = t.Pdg();
 
-  if      (pdgc == kPdgTgtC12)  sf = fSfC12;
-  else if (pdgc == kPdgTgtFe56) sf = fSfFe56;
+  if      (pdgc == kPdgTgtC12)  sf = &fSfC12;
+  else if (pdgc == kPdgTgtFe56) sf = &fSfFe56;
   else {
     LOG("SpectralFunc", pERROR) 
      << "** The spectral function for target " << pdgc << " isn't available";
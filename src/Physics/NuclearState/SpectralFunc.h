@@ -6,6 +6,13 @@
 \brief    A realistic spectral function - based nuclear model.
           Is a concrete implementation of the NuclearModelI interface.
 
+          The spectral function data, interpolated with a TGraph2D, are
+          tabulated at configuration time on a regular (momentum, removal
+          energy) grid. The nucleon is generated by picking a grid cell from
+          an alias table of the cell integrals and then a point within the
+          cell from the bilinear interpolation of its corners, with no
+          rejection.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -21,6 +28,9 @@
 #ifndef _SPECTRAL_FUNCTION_H_
 #define _SPECTRAL_FUNCTION_H_
 
+#include <vector>
+
+#include "Framework/Numerical/AliasSampler.h"
 #include "Physics/NuclearState/NuclearModelI.h"
 
 class TNtupleD;
@@ -52,12 +62,22 @@ public:
   void Configure (string config);
 
 private:
+  // spectral function (times k^2) on a regular grid
+  struct SFGrid_t {
+    double kmin, dk;             ///< momentum nodes: kmin + ik*dk
+    double wmin, dw;             ///< removal energy nodes: wmin + iw*dw
+    int    nk, nw;               ///< number of nodes
+    std::vector<double> val;     ///< value at node (ik*nw + iw)
+    AliasSampler        cells;   ///< cell (ik*(nw-1) + iw) integrals
+  };
+
   void       LoadConfig             (void);
   TGraph2D * Convert2Graph          (TNtupleD & data) const;
-  TGraph2D * SelectSpectralFunction (const Target & target) const; 
+  void       BuildGrid              (TGraph2D & sf, SFGrid_t & grid) const;
+  const SFGrid_t * SelectSpectralFunction (const Target & target) const; 
 
-  TGraph2D * fSfFe56;   ///< Benhar's Fe56 SF
-  TGraph2D * fSfC12;    ///< Benhar's C12 SF
+  SFGrid_t fSfFe56;   ///< Benhar's Fe56 SF
+  SFGrid_t fSfC12;    ///< Benhar's C12 SF
 };
 
 }      // genie namespace
@@ -67,8 +67,8 @@ bool SpectralFunc1d::GenerateNucleon(const Target & target) const
   spl_it = fSFk.find(Z);
   dbl_it = fMaxProb.find(Z);
   if(spl_it == fSFk.end() || dbl_it == fMaxProb.end()) {
-    fCurrRemovalEnergy = 0.;
-    fCurrMomentum.SetXYZ(0.,0.,0.);
+    this->SetRemovalEnergy(0.);
+    this->SetMomentum3(TVector3(0.,0.,0.));
     return false;
   }
 
@@ -108,7 +108,7 @@ bool SpectralFunc1d::GenerateNucleon(const Target & target) const
   double py = p*sintheta*sinfi;
   double pz = p*costheta;
 
-  fCurrMomentum.SetXYZ(px,py,pz);
+  this->SetMomentum3(TVector3(px,py,pz));
 
   // Set removal energy
   // Do it either in the same way as in the FG model or by using the average
@@ -116,15 +116,15 @@ bool SpectralFunc1d::GenerateNucleon(const Target & target) const
   //
   if(fUseRFGRemovalE) {
     dbl_it = fNucRmvE.find(Z);
-    if(dbl_it != fNucRmvE.end()) fCurrRemovalEnergy = dbl_it->second;
-    else fCurrRemovalEnergy = nuclear::BindEnergyPerNucleon(target);
+    if(dbl_it != fNucRmvE.end()) this->SetRemovalEnergy(dbl_it->second);
+    else this->SetRemovalEnergy(nuclear::BindEnergyPerNucleon(target));
   } else {
     spl_it = fSFw.find(Z);
     if(spl_it==fSFw.end()) {
-       fCurrRemovalEnergy = 0.;
-       fCurrMomentum.SetXYZ(0.,0.,0.);
+       this->SetRemovalEnergy(0.);
+       this->SetMomentum3(TVector3(0.,0.,0.));
        return false;
-    } else fCurrRemovalEnergy = spl_it->second->Evaluate(p);
+    } else this->SetRemovalEnergy(spl_it->second->Evaluate(p));
   }
 
   return true;
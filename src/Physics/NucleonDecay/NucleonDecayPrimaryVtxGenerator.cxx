@@ -12,6 +12,11 @@
  Important revisions after version 2.0.0 :
  @ Nov 03, 2008 - CA
    First added in v2.7.1
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The decay products of each decay mode, the max of the nuclear density
+   profile used for the vertex selection and (through a PhaseSpaceDecayer)
+   the max phase space decay weights are cached instead of being computed
+   at each event.
 
 */
 //____________________________________________________________________________
@@ -109,13 +114,13 @@ void NucleonDecayPrimaryVtxGenerator::AddInitialState(
   if(fNucleonIsBound) 
   {
     // add initial nucleus
-    double Mi  = PDGLibrary::Instance()->Find(ipdg)->Mass();
+    double Mi  = PDGLibrary::Instance()->Mass(ipdg);
     TLorentzVector p4i(0,0,0,Mi);
     event->AddParticle(ipdg,stis,-1,-1,-1,-1, p4i, v4);
                
     // add decayed nucleon
     int dpdg = fCurrDecayedNucleon;
-    double mn = PDGLibrary::Instance()->Find(dpdg)->Mass();
+    double mn = PDGLibrary::Instance()->Mass(dpdg);
     TLorentzVector p4n(0,0,0,mn);  
     event->AddParticle(dpdg,stdc, 0,-1,-1,-1, p4n, v4);
      
@@ -125,7 +130,7 @@ void NucleonDecayPrimaryVtxGenerator::AddInitialState(
     A--;
     if(dpdg == kPdgProton) { Z--; }
     int rpdg = pdg::IonPdgCode(A, Z);
-    double Mf  = PDGLibrary::Instance()->Find(rpdg)->Mass();
+    double Mf  = PDGLibrary::Instance()->Mass(rpdg);
     TLorentzVector p4f(0,0,0,Mf);
     event->AddParticle(rpdg,stfs,0,-1,-1,-1, p4f, v4);
   }
@@ -154,7 +159,7 @@ void NucleonDecayPrimaryVtxGenerator::AddInitialState(
        throw exception;
     }
     // add initial nucleon
-    double mn  = PDGLibrary::Instance()->Find(ipdg)->Mass();
+    double mn  = PDGLibrary::Instance()->Mass(ipdg);
     TLorentzVector p4i(0,0,0,mn);
     event->AddParticle(dpdg,stis,-1,-1,-1,-1, p4i, v4);
     // add decayed nucleon
@@ -181,13 +186,8 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayedNucleonPosition(
       << "Generating vertex according to a realistic nuclear density profile";
 
   // get inputs to the rejection method
-  double ymax = -1;
+  double ymax = this->VtxDensityMax(A);
   double rmax = 3*R;
-  double dr   = R/40.;
-  for(double r = 0; r < rmax; r+=dr) {
-      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
-  }
-  ymax *= 1.2;
   
   // select a vertex using the rejection method 
   TLorentzVector vtx(0,0,0,0);
@@ -279,48 +279,32 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
 {
   LOG("NucleonDecay", pINFO) << "Generating decay...";
 
-  PDGCodeList pdgv = utils::nucleon_decay::DecayProductList(fCurrDecayMode, fCurrDecayedNucleon);
+  const PDGCodeList & pdgv = this->DecayProducts();
   LOG("NucleonDecay", pINFO) << "Decay product IDs: " << pdgv;
   assert ( pdgv.size() >  1);
 
   LOG("NucleonDecay", pINFO) << "Performing a phase space decay...";
 
-  // Get the decay product masses
-
-  vector<int>::const_iterator pdg_iter;
-  int i = 0;
-  double * mass = new double[pdgv.size()];
-  double   sum  = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    mass[i++] = m;
-    sum += m;
-  }
-
-  LOG("NucleonDecay", pINFO)  
-    << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
-
   int decayed_nucleon_id = 1;
   GHepParticle * decayed_nucleon = event->Particle(decayed_nucleon_id);
   assert(decayed_nucleon);
-  TLorentzVector * p4d = decayed_nucleon->GetP4();
-  TLorentzVector * v4d = decayed_nucleon->GetX4();
+  TLorentzVector p4d = decayed_nucleon->Momentum();
+  TLorentzVector v4d = decayed_nucleon->Position();
+
+  // Set the decay
+  bool permitted = fPhaseSpaceDecayer.SetDecay(p4d, pdgv);
+  double sum = fPhaseSpaceDecayer.MassSum();
 
+  LOG("NucleonDecay", pINFO)  
+    << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
   LOG("NucleonDecay", pINFO) 
-    << "Decaying system p4 = " << utils::print::P4AsString(p4d);
+    << "Decaying system p4 = " << utils::print::P4AsString(&p4d);
 
-  // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
   if(!permitted) {
      LOG("NucleonDecay", pERROR) 
        << " *** Phase space decay is not permitted \n"
        << " Total particle mass = " << sum << "\n"
-       << " Decaying system p4 = " << utils::print::P4AsString(p4d);
-     // clean-up 
-     delete [] mass;
-     delete p4d;
-     delete v4d; 
+       << " Decaying system p4 = " << utils::print::P4AsString(&p4d);
      // throw exception
      genie::exceptions::EVGThreadException exception;
      exception.SetReason("Decay not permitted kinematically");
@@ -329,12 +313,7 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
   }
 
   // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     wmax = TMath::Max(wmax,w);
-  }
+  double wmax = fPhaseSpaceDecayer.MaxWeight(200);
   assert(wmax>0);
   wmax *= 2;
 
@@ -355,17 +334,14 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
        LOG("NucleonDecay", pWARN) 
            << "Couldn't generate an unweighted phase space decay after " 
            << itry << " attempts";
-       // clean up
-       delete [] mass;
-       delete p4d;
-       delete v4d;
        // throw exception
        genie::exceptions::EVGThreadException exception;
        exception.SetReason("Couldn't select decay after N attempts");
        exception.SwitchOnFastForward();
        throw exception;
      }
-     double w  = fPhaseSpaceGenerator.Generate();   
+     double w  = fPhaseSpaceDecayer.Generate();   
+     fPhaseSpaceDecayer.UpdateMaxWeight(w);
      if(w > wmax) {
         LOG("NucleonDecay", pWARN) 
            << "Decay weight = " << w << " > max decay weight = " << wmax;
@@ -380,21 +356,57 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
   } //!accept_decay
 
   // Insert final state products into a TClonesArray of TMCParticles
-  TLorentzVector v4(*v4d); 
+  TLorentzVector v4(v4d); 
   int idp = 0;
+  vector<int>::const_iterator pdg_iter;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
      int pdgc = *pdg_iter;
-     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(idp);
+     TLorentzVector * p4fin = fPhaseSpaceDecayer.GetDecay(idp);
      GHepStatus_t ist = 
         utils::nucleon_decay::DecayProductStatus(fNucleonIsBound, pdgc);
      event->AddParticle(pdgc, ist, decayed_nucleon_id,-1,-1,-1, *p4fin, v4);
      idp++;
   }
+}
+//____________________________________________________________________________
+const PDGCodeList & NucleonDecayPrimaryVtxGenerator::DecayProducts(void) const
+{
+// The decay products of the current decay mode & decayed nucleon, built
+// the first time the decay is simulated
+
+  std::pair<int,int> key(fCurrDecayMode, fCurrDecayedNucleon);
+  std::map<std::pair<int,int>, PDGCodeList>::const_iterator it =
+       fDecayProducts.find(key);
+  if(it == fDecayProducts.end()) {
+    PDGCodeList pdgv = utils::nucleon_decay::DecayProductList(
+                  fCurrDecayMode, fCurrDecayedNucleon);
+    it = fDecayProducts.insert(std::make_pair(key, pdgv)).first;
+  }
+  return it->second;
+}
+//____________________________________________________________________________
+double NucleonDecayPrimaryVtxGenerator::VtxDensityMax(int A) const
+{
+// The max of r^2 x nuclear density (x 1.2), the envelope of the rejection
+// method selecting the decayed nucleon position, computed once per A
+
+  std::map<int, double>::const_iterator it = fVtxDensityMax.find(A);
+  if(it != fVtxDensityMax.end()) return it->second;
 
-  // Clean-up
-  delete [] mass;
-  delete p4d;
-  delete v4d;
+  double R0 = 1.3;
+  double dA = (double)A;
+  double R = R0 * TMath::Power(dA, 1./3.);
+
+  double ymax = -1;
+  double rmax = 3*R;
+  double dr   = R/40.;
+  for(double r = 0; r < rmax; r+=dr) {
+      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
+  }
+  ymax *= 1.2;
+
+  fVtxDensityMax[A] = ymax;
+  return ymax;
 }
 //____________________________________________________________________________
 void NucleonDecayPrimaryVtxGenerator::Configure(const Registry & config)
@@ -415,6 +427,10 @@ void NucleonDecayPrimaryVtxGenerator::LoadConfig(void)
 //  const Registry * gc = confp->GlobalParameterList();
     
   fNuclModel = 0;
+
+  fDecayProducts.clear();
+  fVtxDensityMax.clear();
+  fPhaseSpaceDecayer.ClearCache();
   
   RgKey nuclkey = "NuclearModel";
   fNuclModel = dynamic_cast<const NuclearModelI *> (this->SubAlg(nuclkey));
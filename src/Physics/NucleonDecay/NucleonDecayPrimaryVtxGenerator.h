@@ -19,9 +19,12 @@
 #ifndef _NUCLEON_DECAY_PRIMARY_VTX_GENERATOR_H_
 #define _NUCLEON_DECAY_PRIMARY_VTX_GENERATOR_H_
 
-#include <TGenPhaseSpace.h>
+#include <map>
+#include <utility>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/PhaseSpaceDecayer.h"
 #include "Physics/NucleonDecay/NucleonDecayMode.h"
 
 namespace genie {
@@ -51,11 +54,17 @@ private:
    void GenerateFermiMomentum          (GHepRecord * event) const;
    void GenerateDecayProducts          (GHepRecord * event) const;
 
+   const PDGCodeList & DecayProducts   (void) const;
+   double              VtxDensityMax   (int A) const;
+
    mutable int                fCurrInitStatePdg;
    mutable NucleonDecayMode_t fCurrDecayMode;
    mutable int                fCurrDecayedNucleon;
    mutable bool               fNucleonIsBound;
-   mutable TGenPhaseSpace     fPhaseSpaceGenerator;
+   mutable PhaseSpaceDecayer  fPhaseSpaceDecayer;
+
+   mutable std::map<std::pair<int,int>, PDGCodeList> fDecayProducts; ///< decay products per (decay mode, decayed nucleon)
+   mutable std::map<int, double>                     fVtxDensityMax; ///< max of r^2 x density per nucleus mass number
 
    const NuclearModelI * fNuclModel;
 };
@@ -16,6 +16,10 @@
           M. Glueck, E. Reya, A. Vogt,
           Eur. Phys. J. C5 (1998) 461-470; hep-ph/9806404
 
+          The (reduced) parton densities of all flavours are stored at each
+          (log(x),log(Q2)) grid point, next to each other, so that a single
+          cell search and bilinear interpolation serves all flavours.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC, Rutherford Appleton Laboratory
 
@@ -31,7 +35,6 @@
 #define _GRV98LO_H_
 
 #include "Physics/PartonDistributions/PDFModelI.h"
-#include "Framework/Numerical/Interpolator2D.h"
 
 namespace genie {
 
@@ -54,6 +57,7 @@ public:
   double Top         (double x, double Q2) const;
   double Gluon       (double x, double Q2) const;
   PDF_t  AllPDFs     (double x, double Q2) const;
+  void   AllPDFs     (const double * x, const double * Q2, PDF_t * pdfs, int n) const;
 
   // override the default "Configure" implementation 
   // of the Algorithm interface
@@ -64,6 +68,8 @@ public:
 private:
 
   void Initialize   (void);
+  void Interpolate  (double x, double Q2, PDF_t & pdf) const;
+  int  Locate       (const double * grid, int n, double v) const;
 
   bool fInitialized;
 
@@ -83,14 +89,11 @@ private:
   double fGridLogXbj[kNXbj]; // log(Bjorken-x) values in grid
   double fParton    [kNParton][kNQ2][kNXbj-1]; // PARTON (NPART,NQ,NX-1) array in original code
   //
-  // arrays for the interpolation routine
+  // array for the interpolation routine: the knots of xuv, xdv, xdel, xudb,
+  // xs and xg (divided by their x-dependent factors) = f(logx,logQ2),
+  // stored together at each grid point
   //
-  Interpolator2D * fXUVF; // = f(logx,logQ2)
-  Interpolator2D * fXDVF;
-  Interpolator2D * fXDEF;
-  Interpolator2D * fXUDF;
-  Interpolator2D * fXSF;
-  Interpolator2D * fXGF;
+  double fKnots     [kNQ2][kNXbj][kNParton];
 };
 
 }         // genie namespace
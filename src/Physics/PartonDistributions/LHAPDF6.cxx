@@ -11,6 +11,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <vector>
 
 #include <TSystem.h>
 #include <TMath.h>
@@ -57,68 +58,96 @@ LHAPDF6::~LHAPDF6()
 //____________________________________________________________________________
 double LHAPDF6::UpValence(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).uval;
+  return XfxQ2(2,x,Q2) - XfxQ2(-2,x,Q2);
 }
 //____________________________________________________________________________
 double LHAPDF6::DownValence(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).dval;
+  return XfxQ2(1,x,Q2) - XfxQ2(-1,x,Q2);
 }
 //____________________________________________________________________________
 double LHAPDF6::UpSea(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).usea;
+  return XfxQ2(-2,x,Q2);
 }
 //____________________________________________________________________________
 double LHAPDF6::DownSea(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).dsea;
+  return XfxQ2(-1,x,Q2);
 }
 //____________________________________________________________________________
 double LHAPDF6::Strange(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).str;
+  return XfxQ2(3,x,Q2);
 }
 //____________________________________________________________________________
 double LHAPDF6::Charm(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).chm;
+  return XfxQ2(4,x,Q2);
 }
 //____________________________________________________________________________
 double LHAPDF6::Bottom(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).bot;
+  return XfxQ2(5,x,Q2);
 }
 //____________________________________________________________________________
 double LHAPDF6::Top(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).top;
+  return XfxQ2(6,x,Q2);
 }
 //____________________________________________________________________________
 double LHAPDF6::Gluon(double x, double Q2) const
 {
-  return AllPDFs(x,Q2).gl;
+  return XfxQ2(21,x,Q2);
 }
 //____________________________________________________________________________
-#ifdef __GENIE_LHAPDF6_ENABLED__
 PDF_t LHAPDF6::AllPDFs(double x, double Q2) const
 {
   PDF_t pdf;
-  vector<double> pdfvec;
-  fLHAPDF->xfxQ2(x,Q2,pdfvec);
-  pdf.uval = pdfvec[8] - pdfvec[4];
-  pdf.dval = pdfvec[7] - pdfvec[5];
-  pdf.usea = pdfvec[4];
-  pdf.dsea = pdfvec[5];
-  pdf.str  = pdfvec[9];
-  pdf.chm  = pdfvec[10];
-  pdf.bot  = pdfvec[11];
-  pdf.top  = pdfvec[12];
-  pdf.gl   = pdfvec[6];
+  this->FillPDF(x,Q2,pdf);
   return pdf;                                               
 }
+//____________________________________________________________________________
+void LHAPDF6::AllPDFs(
+  const double * x, const double * Q2, PDF_t * pdfs, int n) const
+{
+  for(int i = 0; i < n; i++) {
+    this->FillPDF(x[i],Q2[i],pdfs[i]);
+  }
+}
+//____________________________________________________________________________
+#ifdef __GENIE_LHAPDF6_ENABLED__
+double LHAPDF6::XfxQ2(int pid, double x, double Q2) const
+{
+  return fLHAPDF->xfxQ2(pid,x,Q2);
+}
+//____________________________________________________________________________
+void LHAPDF6::FillPDF(double x, double Q2, PDF_t & pdf) const
+{
+// All flavours from one LHAPDF call; xfx[6+pid] holds the pid flavour.
+// The buffer is per thread, as the PDF model is shared.
+
+  static thread_local std::vector<double> xfx(13);
+
+  fLHAPDF->xfxQ2(x,Q2,xfx);
+  pdf.uval = xfx[8] - xfx[4];
+  pdf.dval = xfx[7] - xfx[5];
+  pdf.usea = xfx[4];
+  pdf.dsea = xfx[5];
+  pdf.str  = xfx[9];
+  pdf.chm  = xfx[10];
+  pdf.bot  = xfx[11];
+  pdf.top  = xfx[12];
+  pdf.gl   = xfx[6];
+}
 #else
-PDF_t LHAPDF6::AllPDFs(double, double) const
+double LHAPDF6::XfxQ2(int, double, double) const
+{
+  LOG("LHAPDF6",pFATAL) << "LHAPDF6 not enabled.";
+  exit(-1);
+}
+//____________________________________________________________________________
+void LHAPDF6::FillPDF(double, double, PDF_t &) const
 {
   LOG("LHAPDF6",pFATAL) << "LHAPDF6 not enabled.";
   exit(-1);
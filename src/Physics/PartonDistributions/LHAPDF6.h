@@ -6,6 +6,10 @@
 \brief    LHAPDF6 library interface.
           Concrete implementation of the PDFModelI interface.
 
+          AllPDFs() makes a single multi-flavour LHAPDF call per (x,Q2)
+          point, into a buffer reused from call to call. The single flavour
+          methods only evaluate the flavours they need.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -49,6 +53,7 @@ public:
   double Top         (double x, double Q2) const;
   double Gluon       (double x, double Q2) const;
   PDF_t  AllPDFs     (double x, double Q2) const;
+  void   AllPDFs     (const double * x, const double * Q2, PDF_t * pdfs, int n) const;
 
   // Override the default "Configure" implementation 
   // of the Algorithm interface
@@ -58,7 +63,9 @@ public:
 
 private:
 
-  void LoadConfig (void);
+  void   LoadConfig (void);
+  double XfxQ2      (int pid, double x, double Q2) const;
+  void   FillPDF    (double x, double Q2, PDF_t & pdf) const;
 
   string fSetName;
   int    fMemberID;
@@ -54,8 +54,11 @@ void PDF::SetModel(const PDFModelI * model)
 //____________________________________________________________________________
 void PDF::Calculate(double x, double q2)
 {
-  PDF_t pdfs = fModel->AllPDFs(x, q2);
-
+  this->Set(fModel->AllPDFs(x, q2));
+}
+//____________________________________________________________________________
+void PDF::Set(const PDF_t & pdfs)
+{
   fUpValence   = pdfs.uval;
   fDownValence = pdfs.dval;
   fUpSea       = pdfs.usea;
@@ -47,6 +47,11 @@ public:
   void   SetModel  (const PDFModelI * model);
   void   Calculate (double x, double q2);
 
+  //-- methods to set PDFs computed elsewhere (eg in a PDFModelI::AllPDFs()
+  //   batch call) and to access the PDFModelI
+  void   Set       (const PDF_t & pdfs);
+  const PDFModelI * Model (void) const { return fModel; }
+
   //-- methods to access the computed PDFs
   double UpValence   (void) const { return fUpValence;   }
   double DownValence (void) const { return fDownValence; }
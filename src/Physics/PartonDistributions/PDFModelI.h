@@ -45,6 +45,9 @@ public:
   virtual double Gluon       (double x, double Q2) const = 0;
   virtual PDF_t  AllPDFs     (double x, double Q2) const = 0;
 
+  //-- all PDFs at n (x,Q2) points (by default, one AllPDFs call per point)
+  virtual void   AllPDFs     (const double * x, const double * Q2, PDF_t * pdfs, int n) const;
+
 protected:
 
   PDFModelI();
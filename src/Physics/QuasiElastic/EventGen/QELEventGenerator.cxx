@@ -22,9 +22,19 @@
    dipole form from the dsigma/dQ2 p.d.f.
  @ 2015 - AF
    New QELEventgenerator class replaces previous methods in QEL.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   COMframe2Lab() takes the initial state by reference and no longer allocates
+   the probe 4-momentum.
+   Optional max xsec grid binned in the probe energy at the hit nucleon rest
+   frame, filled once per bin instead of scanning the angles again for each
+   hit nucleon momentum. The acceptance rate of the rejection method is
+   reported periodically.
 */
 //____________________________________________________________________________
 
+#include <map>
+#include <sstream>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgFactory.h"
@@ -42,6 +52,7 @@
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/UniformBuffer.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -57,31 +68,45 @@ using namespace genie::controls;
 using namespace genie::constants;
 using namespace genie::utils;
 
+using std::ostringstream;
+
+//___________________________________________________________________________
+namespace {
+  // the max xsec energy grid filled by each generator, per xsec model,
+  // interaction and energy bin, and its counts of kinematics throws: kept
+  // per thread, as they are filled during event generation
+  struct MaxXSecGrid {
+    MaxXSecGrid() : nevents(0), nthrows(0) { }
+    map<string, double> bins;
+    unsigned long       nevents;
+    unsigned long       nthrows;
+  };
+  thread_local map<const QELEventGenerator *, MaxXSecGrid> gMaxXSecGrids;
+}
 //___________________________________________________________________________
 QELEventGenerator::QELEventGenerator() :
-    KineGeneratorWithCache("genie::QELEventGenerator")
+    KineGeneratorWithCache("genie::QELEventGenerator"),
+    fUseMaxXSecGrid(false)
 {
 
 }
 //___________________________________________________________________________
 QELEventGenerator::QELEventGenerator(string config) :
-    KineGeneratorWithCache("genie::QELEventGenerator", config)
+    KineGeneratorWithCache("genie::QELEventGenerator", config),
+    fUseMaxXSecGrid(false)
 {
 
 }
 //___________________________________________________________________________
 QELEventGenerator::~QELEventGenerator()
 {
-
+    gMaxXSecGrids.erase(this);
 }
 //___________________________________________________________________________
 void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
     LOG("QELEvent", pDEBUG) << "Generating QE event kinematics...";
 
-    // Get the random number generators
-    RandomGen * rnd = RandomGen::Instance();
-
     // Access cross section algorithm for running thread
     RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
     const EventGeneratorI * evg = rtinfo->RunningThread();
@@ -118,7 +143,12 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
     //   value is found.
     //   If the kinematics are generated uniformly over the allowed phase
     //   space the max xsec is irrelevant
-    double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+    double * xsec_max_bin = 0;
+    double   xsec_max     = -1;
+    if(!fGenerateUniformly) {
+        if(fUseMaxXSecGrid) xsec_max_bin = this->MaxXSecGridBin(interaction);
+        xsec_max = (xsec_max_bin) ? *xsec_max_bin : this->MaxXSec(evrec);
+    }
 
     //
     // Try to generate (simultaneously):
@@ -139,6 +169,9 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
     // Store the hit nucleon radius first
     double hitNucPos = nucleon->X4()->Vect().Mag();
     tgt->SetHitNucPosition(hitNucPos);
+
+    // RndKine numbers drawn in blocks
+    UniformBuffer rndkine(kRndmKine);
     while(1) {
         iter++;
         LOG("QELEvent", pINFO) << "Attempt #: " << iter;
@@ -146,6 +179,7 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
             LOG("QELEvent", pWARN)
                 << "Couldn't select a valid (pF, w, Q^2) tuple after "
                 << iter << " iterations";
+            this->CountKineThrows(interaction, iter, false);
             evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
             genie::exceptions::EVGThreadException exception;
             exception.SetReason("Couldn't select kinematics");
@@ -264,8 +298,8 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
         //        }
 
         // Pick a direction
-        double costheta = (rnd->RndKine().Rndm() * 2) - 1; // cosine theta: [-1, 1]
-        double phi = 2 * TMath::Pi() * rnd->RndKine().Rndm(); // phi: [0, 2pi]
+        double costheta = (rndkine.Next() * 2) - 1; // cosine theta: [-1, 1]
+        double phi = 2 * TMath::Pi() * rndkine.Next(); // phi: [0, 2pi]
 
         //        // Generate the outgoing particles
         //        // with the correct momenta
@@ -305,9 +339,17 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
         double xsec = this->ComputeXSec(interaction, costheta, phi);
 
         // select/reject event
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
+        if(xsec_max_bin && xsec > xsec_max) {
+            // raise the grid bin for the next events
+            LOG("QELEvent", pWARN)
+                << "xsec: (curr) = " << xsec << " > (max) = " << xsec_max
+                << " - Raising the max xsec grid\n for " << *interaction;
+            *xsec_max_bin = TMath::Max(*xsec_max_bin, fSafetyFactor * xsec);
+        } else {
+            this->AssertXSecLimits(interaction, xsec, xsec_max);
+        }
 
-        double t = xsec_max * rnd->RndKine().Rndm();
+        double t = xsec_max * rndkine.Next();
         //        LOG("QELEvent", pNOTICE) << "dsigma/dQ2 (random) = " << t/(1E-38*units::cm2) << " 1E-38 cm^2/GeV^2";
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -318,9 +360,12 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
         // If the generated kinematics are accepted, finish-up module's job
         if(accept) {
+            this->CountKineThrows(interaction, iter, true);
             double gQ2 = interaction->KinePtr()->Q2(false);
             LOG("QELEvent", pINFO) << "*Selected* Q^2 = " << gQ2 << " GeV^2";
 
+            if(!fGenerateUniformly) this->CountThrows(iter);
+
             // reset bits
             interaction->ResetBit(kISkipProcessChk);
             interaction->ResetBit(kISkipKinematicChk);
@@ -348,7 +393,7 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
                 rpdgc = interaction->RecoilNucleonPdg();
             }
             assert(rpdgc);
-            double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+            double gW = PDGLibrary::Instance()->Mass(rpdgc);
             LOG("QELEvent", pNOTICE) << "Selected: W = "<< gW;
 
             // (W,Q2) -> (x,y)
@@ -507,6 +552,99 @@ void QELEventGenerator::LoadConfig(void)
     //  fQ2max   = -1;
     GetParamDef( "SF-MinAngleEMscattering", fMinAngleEM, 0. ) ;
 
+    // Read the max xsec from a grid binned in the probe energy at the hit
+    // nucleon rest frame?
+    GetParamDef( "MaxXSec-UseEnergyGrid",          fUseMaxXSecGrid,          false ) ;
+    GetParamDef( "MaxXSec-EnergyGrid-NEPerDecade", fMaxXSecGridNEPerDecade,  20    ) ;
+    GetParamDef( "AcceptanceRate-ReportNEvents",   fAcceptanceReportNEvents, 10000 ) ;
+    if(fMaxXSecGridNEPerDecade < 1) {
+        LOG("QELEvent", pFATAL)
+            << "Invalid max xsec energy grid: "
+            << fMaxXSecGridNEPerDecade << " bins per decade";
+        exit(1);
+    }
+
+    // grid filled and throws counted with the previous configuration
+    gMaxXSecGrids.erase(this);
+}
+//____________________________________________________________________________
+double * QELEventGenerator::MaxXSecGridBin(const Interaction * interaction) const
+{
+    // Returns the bin of the max xsec grid for this interaction, with the
+    // xsec model of the running thread, holding the probe energy at the hit
+    // nucleon rest frame (see Energy()). A bin is filled at its first use,
+    // with the max of the max xsec (safety factor included) computed at both
+    // edges of the bin for a hit nucleon at rest: ComputeMaxXSec() already
+    // scans the nucleon momenta, so the bin holds for any hit nucleon.
+    // Returns 0 below the minimum caching energy or if the max xsec vanishes,
+    // and the max xsec is then obtained as usual.
+
+    double E = this->Energy(interaction);
+    if(E <= 0 || E < fEMin) return 0;
+
+    int ie = TMath::FloorNint(TMath::Log10(E) * fMaxXSecGridNEPerDecade);
+
+    ostringstream key;
+    key << fXSecModel->Id().Key() << "/" << interaction->AsString() << "/" << ie;
+
+    MaxXSecGrid & grid = gMaxXSecGrids[this];
+    map<string, double>::iterator iter = grid.bins.find(key.str());
+    if(iter == grid.bins.end()) {
+        double E0 = TMath::Power(10., double(ie)   / fMaxXSecGridNEPerDecade);
+        double E1 = TMath::Power(10., double(ie+1) / fMaxXSecGridNEPerDecade);
+
+        Interaction * in = new Interaction(*interaction);
+        Target * tgt = in->InitStatePtr()->TgtPtr();
+        if(tgt->HitNucIsSet()) {
+            TLorentzVector p4(0, 0, 0, tgt->HitNucMass());
+            tgt->SetHitNucP4(p4);
+        }
+        double xsec_max = 0;
+        in->InitStatePtr()->SetProbeE(E0);
+        xsec_max = TMath::Max(xsec_max, this->ComputeMaxXSec(in));
+        in->InitStatePtr()->SetProbeE(E1);
+        xsec_max = TMath::Max(xsec_max, this->ComputeMaxXSec(in));
+        delete in;
+
+        LOG("QELEvent", pINFO)
+            << "Max xsec grid: max xsec (E in [" << E0 << ", " << E1
+            << "] GeV) = " << xsec_max << " for " << interaction->AsString();
+
+        iter = grid.bins.insert(
+               map<string, double>::value_type(key.str(), xsec_max)).first;
+    }
+    if(iter->second <= 0) return 0;
+
+    return &(iter->second);
+}
+//____________________________________________________________________________
+void QELEventGenerator::CountThrows(unsigned int nthrows) const
+{
+    // Counts the kinematics throws of an accepted event and reports the
+    // acceptance rate of the rejection method every fAcceptanceReportNEvents
+    // events
+
+    MaxXSecGrid & grid = gMaxXSecGrids[this];
+    grid.nevents++;
+    grid.nthrows += nthrows;
+
+    if(fAcceptanceReportNEvents > 0 &&
+       grid.nevents % fAcceptanceReportNEvents == 0) {
+        LOG("QELEvent", pNOTICE)
+            << "Acceptance rate of the rejection method = "
+            << this->AcceptanceRate() << " (" << grid.nevents << " events, "
+            << grid.nthrows << " throws, MaxXSec-SafetyFactor = "
+            << fSafetyFactor << ")";
+    }
+}
+//____________________________________________________________________________
+double QELEventGenerator::AcceptanceRate(void) const
+{
+    map<const QELEventGenerator *, MaxXSecGrid>::const_iterator iter =
+                                                   gMaxXSecGrids.find(this);
+    if(iter == gMaxXSecGrids.end() || iter->second.nthrows == 0) return 0;
+
+    return double(iter->second.nevents) / iter->second.nthrows;
 }
 //____________________________________________________________________________
 double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
@@ -762,7 +900,7 @@ double QELEventGenerator::ComputeXSec( Interaction * interaction, double costhet
     //LOG("QELEvent", pINFO) << "outNucleon boosted = " << utils::print::P4AsString(&outNucleon);
     /*
        LOG("QELEvent", pINFO) << "neutrino LAB EvGen: ";
-       interaction->InitState().GetProbeP4(kRfLab)->Print();
+       interaction->InitState().ProbeP4().Print();
        LOG("QELEvent", pINFO) << "inNucleon LAB EvGen:\n";
        interaction->InitState().Tgt().HitNucP4().Print();
        LOG("QELEvent", pINFO) << "Lepton LAB EvGen:\n";
@@ -780,9 +918,7 @@ double QELEventGenerator::ComputeXSec( Interaction * interaction, double costhet
         return 0;
     }
     // Check if Q2 above Minimum Q2 // important for eA scattering
-    TLorentzVector * nuP4 = interaction->InitState().GetProbeP4();
-    TLorentzVector qP4 = *nuP4 - lepton;
-    delete nuP4;
+    TLorentzVector qP4 = interaction->InitState().ProbeP4(kRfHitNucRest) - lepton;
     double Q2 = -1 * qP4.Mag2();
 
     interaction->KinePtr()->SetFSLeptonP4(lepton);
@@ -810,16 +946,15 @@ double QELEventGenerator::ComputeXSec( Interaction * interaction, double costhet
     return xsec;
 }
 //___________________________________________________________________________
-TVector3 QELEventGenerator::COMframe2Lab(InitialState initialState) const
+TVector3 QELEventGenerator::COMframe2Lab(const InitialState & initialState) const
 {
 
-    TLorentzVector * k4 = initialState.GetProbeP4(kRfLab);
+    const TLorentzVector & k4 = initialState.ProbeP4();
     TLorentzVector * p4 = initialState.TgtPtr()->HitNucP4Ptr();
-    TLorentzVector totMom = *k4 + *p4;
+    TLorentzVector totMom = k4 + *p4;
 
     TVector3 beta = totMom.BoostVector();
 
-    delete k4;
 
     return beta;
 }
@@ -7,6 +7,14 @@
           interaction events.
           Is a concrete implementation of the EventRecordVisitorI interface.
 
+          The max xsec of the rejection method can optionally be read from a
+          grid binned in the log of the probe energy at the hit nucleon rest
+          frame: each bin holds the max xsec computed (once per thread) at
+          both bin edges, so that the angular scan is not repeated for the
+          varying hit nucleon momentum of each event. The measured acceptance
+          rate of the rejection method is reported periodically, to help in
+          tuning the safety factor.
+
 \author   Andrew Furmanski
 
 \created  August 04, 2014
@@ -40,6 +48,9 @@ public :
   // implement the EventRecordVisitorI interface
   void ProcessEventRecord(GHepRecord * event_rec) const;
 
+  //! Fraction of the kinematics throws accepted so far by the running thread
+  double AcceptanceRate(void) const;
+
   // overload the Algorithm::Configure() methods to load private data
   // members from configuration options
   void Configure(const Registry & config);
@@ -48,7 +59,7 @@ public :
 private:
 
   double ComputeXSec (Interaction * in, double costheta, double phi) const;
-  TVector3 COMframe2Lab(InitialState initialState) const;
+  TVector3 COMframe2Lab(const InitialState & initialState) const;
 
   double COMJacobian(TLorentzVector lepton, TLorentzVector leptonCOM, TLorentzVector outNucleon, TVector3 beta) const;
   
@@ -57,6 +68,8 @@ private:
 
   void   LoadConfig     (void);
   double  ComputeMaxXSec(const Interaction * in) const;
+  double * MaxXSecGridBin(const Interaction * in) const;
+  void     CountThrows   (unsigned int nthrows) const;
 
   void AddTargetNucleusRemnant (GHepRecord * evrec) const; ///< add a recoiled nucleus remnant
 
@@ -68,6 +81,10 @@ private:
   //
   mutable double fMinAngleEM;
 
+  bool   fUseMaxXSecGrid;          ///< read the max xsec from the energy grid?
+  int    fMaxXSecGridNEPerDecade;  ///< energy grid bins per decade
+  int    fAcceptanceReportNEvents; ///< report the acceptance rate every that many events (0: never)
+
 
 }; // class definition
 
@@ -203,9 +203,7 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
   double kF = (rnd->RndKine().Rndm() * (rkF.max-rkF.min)) + rkF.min;
 
   // Momentum of initial neutrino in LAB frame
-  TLorentzVector * tempTLV = evrec->Probe()->GetP4();
-  TLorentzVector neutrinoMom = *tempTLV;
-  delete tempTLV;
+  TLorentzVector neutrinoMom = evrec->Probe()->Momentum();
 
   // define all angles in Z frame
   double theta = neutrinoMom.Vect().Theta();
@@ -262,7 +260,7 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
 
   int rpdgc = interaction->RecoilNucleonPdg();
   assert(rpdgc);
-  double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+  double gW = PDGLibrary::Instance()->Mass(rpdgc);
   LOG("QELEvent", pNOTICE) << "Selected: W = "<< gW;
   double M = init_state.Tgt().HitNucP4().M();
   double E  = init_state.ProbeE(kRfHitNucRest);
@@ -588,10 +586,9 @@ double QELEventGeneratorSM::FindMaxXSec2(
   // if there are not enough points at the cache buffer to have a spline,
   // look whether there is another point that is sufficiently close
   double dE = TMath::Min(0.25, 0.05*E);
-  const map<double,double> & fmap = cb->Map();
-  map<double,double>::const_iterator iter = fmap.lower_bound(E);
-  if(iter != fmap.end()) {
-     if(TMath::Abs(E - iter->first) < dE) return iter->second;
+  unsigned int ip = cb->LowerBound(E);
+  if(ip < cb->NPoints()) {
+     if(TMath::Abs(E - cb->X()[ip]) < dE) return cb->Y()[ip];
   }
 
   return -1;
@@ -609,7 +606,7 @@ void QELEventGeneratorSM::CacheMaxXSec2(
   if(max_xsec>0) cb->AddValues(E,max_xsec);
 
   if(! cb->Spl() ) {
-    if( cb->Map().size() > 40 ) cb->CreateSpline();
+    if( cb->NPoints() > 40 ) cb->CreateSpline();
   }
 
   if( cb->Spl() ) {
@@ -741,10 +738,9 @@ double QELEventGeneratorSM::FindMaxDiffv(
   // if there are not enough points at the cache buffer to have a spline,
   // look whether there is another point that is sufficiently close
   double dE = TMath::Min(0.25, 0.05*E);
-  const map<double,double> & fmap = cb->Map();
-  map<double,double>::const_iterator iter = fmap.lower_bound(E);
-  if(iter != fmap.end()) {
-     if(TMath::Abs(E - iter->first) < dE) return iter->second;
+  unsigned int ip = cb->LowerBound(E);
+  if(ip < cb->NPoints()) {
+     if(TMath::Abs(E - cb->X()[ip]) < dE) return cb->Y()[ip];
   }
 
   return -1;
@@ -762,7 +758,7 @@ void QELEventGeneratorSM::CacheMaxDiffv(
   if(max_diffv>0) cb->AddValues(E,max_diffv);
 
   if(! cb->Spl() ) {
-    if( cb->Map().size() > 40 ) cb->CreateSpline();
+    if( cb->NPoints() > 40 ) cb->CreateSpline();
   }
 
   if( cb->Spl() ) {
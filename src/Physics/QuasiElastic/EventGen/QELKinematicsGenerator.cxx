@@ -140,6 +140,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      if(iter > kRjMaxIterations) {
         LOG("QELKinematics", pWARN)
           << "Couldn't select a valid Q^2 after " << iter << " iterations";
+        this->CountKineThrows(interaction, iter, false);
         evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
         genie::exceptions::EVGThreadException exception;
         exception.SetReason("Couldn't select kinematics");
@@ -183,6 +184,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->CountKineThrows(interaction, iter, true);
         LOG("QELKinematics", pINFO) << "Selected: Q^2 = " << gQ2;
 
         // reset bits
@@ -211,7 +213,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         else if(xcls.IsStrangeEvent()) { rpdgc = xcls.StrangeHadronPdg();           }
         else                    { rpdgc = interaction->RecoilNucleonPdg(); }
         assert(rpdgc);
-        double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+        double gW = PDGLibrary::Instance()->Mass(rpdgc);
 
         LOG("QELKinematics", pNOTICE) << "Selected: W = "<< gW;
 
@@ -334,6 +336,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
      if(iter > kRjMaxIterations) {
         LOG("QELKinematics", pWARN)
           << "Couldn't select a valid Q^2 after " << iter << " iterations";
+        this->CountKineThrows(interaction, iter, false);
         evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
         genie::exceptions::EVGThreadException exception;
         exception.SetReason("Couldn't select kinematics");
@@ -354,7 +357,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
      if(xcls.IsCharmEvent()) { rpdgc = xcls.CharmHadronPdg();           }
      else                    { rpdgc = interaction->RecoilNucleonPdg(); }
      assert(rpdgc);
-     gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+     gW = PDGLibrary::Instance()->Mass(rpdgc);
 
      // (W,Q2) -> (x,y)
      kinematics::WQ2toXY(E,Mn,gW,gQ2,gx,gy);
@@ -402,6 +405,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->CountKineThrows(interaction, iter, true);
         LOG("QELKinematics", pNOTICE) << "Selected: Q^2 = " << gQ2;
 
         // reset bits
@@ -465,6 +469,9 @@ void QELKinematicsGenerator::LoadConfig(void)
   //-- Safety factor for the maximum differential cross section
 	GetParamDef( "MaxXSec-SafetyFactor", fSafetyFactor , 1.25 ) ;
 
+  //-- Tighten the max xsec online (adaptive safety factor)?
+  this->LoadAdaptiveSafetyFactorConfig();
+
   //-- Minimum energy for which max xsec would be cached, forcing explicit
   //   calculation for lower eneries
 	GetParamDef( "Cache-MinEnergy", fEMin, 1.00 ) ;
@@ -62,6 +62,8 @@ void AxialFormFactor::Calculate(const Interaction * interaction)
     this->Reset("D");
   }
   else {
+    if(fMemo.Hit(fModel, interaction)) return;
+
     this->fFA = this->fModel->FA(interaction);
   }
 }
@@ -72,6 +74,7 @@ void AxialFormFactor::Reset(Option_t * opt)
 // option = D it resets the data only and not the attached model.
 
   this->fFA = 0.;
+  this->fMemo.Clear();
 
   string option(opt);
   if(option.find("D") == string::npos) {this->fModel = 0;}
@@ -81,6 +84,7 @@ void AxialFormFactor::Copy(const AxialFormFactor & ff)
 {
   this->fModel = ff.fModel;
   this->fFA    = ff.fFA;
+  this->fMemo  = ff.fMemo;
 }
 //____________________________________________________________________________
 bool AxialFormFactor::Compare(const AxialFormFactor & ff) const
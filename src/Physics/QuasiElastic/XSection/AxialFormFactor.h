@@ -26,6 +26,7 @@
 #include <iostream>
 
 #include "Physics/QuasiElastic/XSection/AxialFormFactorModelI.h"
+#include "Physics/QuasiElastic/XSection/FormFactorsMemo.h"
 
 using std::ostream;
 
@@ -46,6 +47,7 @@ public:
   void   SetModel  (const AxialFormFactorModelI * model);
 
   //! Calculate the form factors for the input interaction using the attached algorithm
+  //! (a no-op if they were last calculated for the same kinematics)
   void   Calculate (const Interaction * interaction);
 
   //! Get the computed axial form factor
@@ -68,6 +70,7 @@ private:
   double fFA;
 
   const AxialFormFactorModelI * fModel;
+  FormFactorsMemo               fMemo;  //! inputs of the last calculation
 };
 
 }        // genie namespace
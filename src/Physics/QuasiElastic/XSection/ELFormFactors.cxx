@@ -12,6 +12,9 @@
  Important revisions after version 2.0.0 :
  @ Sep 19, 2009 - CA
    Moved into the ElFF package from its previous location               
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Calculate() skips the model calls when the kinematics are those of the
+   previous calculation.
 
 */
 //____________________________________________________________________________
@@ -64,6 +67,8 @@ void ELFormFactors::Calculate(const Interaction * interaction)
     this->Reset("D");
   }
   else {
+    if(fMemo.Hit(fModel, interaction)) return;
+
     this->fGep = this->fModel->Gep(interaction);
     this->fGmp = this->fModel->Gmp(interaction);
     this->fGen = this->fModel->Gen(interaction);
@@ -80,6 +85,7 @@ void ELFormFactors::Reset(Option_t * opt)
   this->fGmp = 0.;
   this->fGen = 0.;
   this->fGmn = 0.;
+  this->fMemo.Clear();
 
   string option(opt);
   if(option.find("D") == string::npos) {this->fModel = 0;}
@@ -92,6 +98,7 @@ void ELFormFactors::Copy(const ELFormFactors & ff)
   this->fGmp   = ff.fGmp;
   this->fGen   = ff.fGen;
   this->fGmn   = ff.fGmn;
+  this->fMemo  = ff.fMemo;
 }
 //____________________________________________________________________________
 bool ELFormFactors::Compare(const ELFormFactors & ff) const
@@ -24,6 +24,7 @@
 #include <iostream>
 
 #include "Physics/QuasiElastic/XSection/ELFormFactorsModelI.h"
+#include "Physics/QuasiElastic/XSection/FormFactorsMemo.h"
 
 using std::ostream;
 
@@ -45,6 +46,7 @@ public:
   void   SetModel  (const ELFormFactorsModelI * model);
 
   //! Calculate the form factors for the input interaction using the attached algorithm
+  //! (a no-op if they were last calculated for the same kinematics)
   void   Calculate (const Interaction * interaction);
 
   //! Get the computed form factor Gep
@@ -79,6 +81,7 @@ private:
   double fGmn;
 
   const ELFormFactorsModelI * fModel;
+  FormFactorsMemo             fMemo;  //! inputs of the last calculation
 };
 
 }        // genie namespace
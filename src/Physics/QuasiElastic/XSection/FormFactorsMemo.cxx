@@ -0,0 +1,69 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <TLorentzVector.h>
+
+#include "Framework/Interaction/Interaction.h"
+#include "Physics/QuasiElastic/XSection/FormFactorsMemo.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+const int FormFactorsMemo::kNCodes;
+//____________________________________________________________________________
+FormFactorsMemo::FormFactorsMemo() :
+fValid(false),
+fModel(0),
+fq2(0)
+{
+
+}
+//____________________________________________________________________________
+FormFactorsMemo::~FormFactorsMemo()
+{
+
+}
+//____________________________________________________________________________
+bool FormFactorsMemo::Hit(const void * model, const Interaction * interaction)
+{
+  const InitialState & init_state = interaction->InitState();
+  const Target &       tgt        = init_state.Tgt();
+  const ProcessInfo &  pi         = interaction->ProcInfo();
+
+  const TLorentzVector & k4 = init_state.ProbeP4();
+  const TLorentzVector & p4 = *tgt.HitNucP4Ptr();
+
+  double q2    = interaction->Kine().q2();
+  double P4[8] = { k4.Px(), k4.Py(), k4.Pz(), k4.E(),
+                   p4.Px(), p4.Py(), p4.Pz(), p4.E() };
+  int codes[kNCodes] = {
+     init_state.ProbePdg(), tgt.Pdg(), tgt.HitNucPdg(),
+     pi.ScatteringTypeId(), pi.InteractionTypeId(),
+     interaction->ExclTag().StrangeHadronPdg() };
+
+  if(fValid && model == fModel && q2 == fq2) {
+    bool same = true;
+    for(int i = 0; i < 8 && same; i++) same = (P4[i] == fP4[i]);
+    for(int i = 0; i < kNCodes && same; i++) same = (codes[i] == fCodes[i]);
+    if(same) return true;
+  }
+
+  fModel = model;
+  fq2    = q2;
+  for(int i = 0; i < 8; i++) fP4[i] = P4[i];
+  for(int i = 0; i < kNCodes; i++) fCodes[i] = codes[i];
+  fValid = true;
+
+  return false;
+}
+//____________________________________________________________________________
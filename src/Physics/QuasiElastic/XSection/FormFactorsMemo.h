@@ -0,0 +1,57 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::FormFactorsMemo
+
+\brief    Remembers the inputs with which a form factor holder (ELFormFactors,
+          AxialFormFactor, QELFormFactors) last called its model, so that the
+          form factors are not recomputed when the holder is asked again for
+          the same kinematics, as happens for the several structures of one
+          cross section or repeated evaluations at one Q2.
+
+          The inputs compared are the model, q2, the probe and hit nucleon
+          4-momenta and the codes of the probe, target, hit nucleon, process
+          and strange hadron: everything the form factor models look at.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _FORM_FACTORS_MEMO_H_
+#define _FORM_FACTORS_MEMO_H_
+
+namespace genie {
+
+class Interaction;
+
+class FormFactorsMemo {
+
+public:
+  FormFactorsMemo();
+ ~FormFactorsMemo();
+
+  //! True if the model was last called for the same inputs; otherwise the
+  //! inputs of the interaction are recorded and false is returned
+  bool Hit   (const void * model, const Interaction * interaction);
+  //! Forget the recorded inputs
+  void Clear (void) { fValid = false; }
+
+private:
+  static const int kNCodes = 6;
+
+  bool         fValid;
+  const void * fModel;
+  double       fq2;
+  double       fP4   [8];
+  int          fCodes[kNCodes];
+};
+
+}        // genie namespace
+
+#endif   // _FORM_FACTORS_MEMO_H_
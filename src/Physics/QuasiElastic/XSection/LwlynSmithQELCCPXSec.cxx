@@ -18,6 +18,9 @@
    momentum, then integrate.
  @ 2015 - AF
    Added FullDifferentialXSec method to work with QELEventGenerator
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added IntegralBatch(), handing the knots of a spline to the integrator
+   as a batch.
 */
 //____________________________________________________________________________
 
@@ -187,16 +190,16 @@ double LwlynSmithQELCCPXSec::FullDifferentialXSec(const Interaction *  interacti
   const TLorentzVector leptonMom = kinematics.FSLeptonP4();
   const TLorentzVector outNucleonMom = kinematics.HadSystP4();
 
-  TLorentzVector * neutrinoMom = init_state.GetProbeP4(kRfLab);
+  const TLorentzVector & neutrinoMom = init_state.ProbeP4();
   TLorentzVector * inNucleonMom = init_state.TgtPtr()->HitNucP4Ptr();
 
   // Now we calculate q and qTilde
   //TLorentzVector qP4(0,0,0,0);
   TLorentzVector qTildeP4(0,0,0,0);
-  //qP4 = *neutrinoMom - leptonMom;
+  //qP4 = neutrinoMom - leptonMom;
   //qTildeP4 = outNucleonMom - *inNucleonMom;
 
-  qTildeP4 = *neutrinoMom- leptonMom; // TESTING: Use q rather than qtilde
+  qTildeP4 = neutrinoMom- leptonMom; // TESTING: Use q rather than qtilde
 
   double Q2tilde = -1 * qTildeP4.Mag2();
   interaction->KinePtr()->SetQ2(Q2tilde);
@@ -213,7 +216,7 @@ double LwlynSmithQELCCPXSec::FullDifferentialXSec(const Interaction *  interacti
   double FA    = fFormFactors.FA();
   double Fp    = fFormFactors.Fp();
 
-  double Gfactor = kGF2*fCos8c2 / (8*kPi*kPi*inNucleonMom->E()*neutrinoMom->E()*outNucleonMom.E()*leptonMom.E());
+  double Gfactor = kGF2*fCos8c2 / (8*kPi*kPi*inNucleonMom->E()*neutrinoMom.E()*outNucleonMom.E()*leptonMom.E());
 
   // Now, we can calculate the cross section
   double tau = Q2tilde / (4 * inNucleonMom->Mag2());
@@ -224,17 +227,15 @@ double LwlynSmithQELCCPXSec::FullDifferentialXSec(const Interaction *  interacti
 
   bool is_neutrino = pdg::IsNeutrino(init_state.ProbePdg());
   int sign = (is_neutrino) ? -1 : 1;
-  double l1 = 2*neutrinoMom->Dot(leptonMom)*(inNucleonMom->Mag2());
-  double l2 = 2*(neutrinoMom->Dot(*inNucleonMom)) * (inNucleonMom->Dot(leptonMom)) - neutrinoMom->Dot(leptonMom)*inNucleonMom->Mag2();
-  double l3 = (neutrinoMom->Dot(*inNucleonMom) * qTildeP4.Dot(leptonMom)) - (neutrinoMom->Dot(qTildeP4) * leptonMom.Dot(*inNucleonMom));
+  double l1 = 2*neutrinoMom.Dot(leptonMom)*(inNucleonMom->Mag2());
+  double l2 = 2*(neutrinoMom.Dot(*inNucleonMom)) * (inNucleonMom->Dot(leptonMom)) - neutrinoMom.Dot(leptonMom)*inNucleonMom->Mag2();
+  double l3 = (neutrinoMom.Dot(*inNucleonMom) * qTildeP4.Dot(leptonMom)) - (neutrinoMom.Dot(qTildeP4) * leptonMom.Dot(*inNucleonMom));
   l3 *= sign;
-  double l4 = neutrinoMom->Dot(leptonMom) * qTildeP4.Dot(qTildeP4) - 2*neutrinoMom->Dot(qTildeP4)*leptonMom.Dot(qTildeP4);
-  double l5 = neutrinoMom->Dot(*inNucleonMom) * leptonMom.Dot(qTildeP4) + leptonMom.Dot(*inNucleonMom)*neutrinoMom->Dot(qTildeP4) - neutrinoMom->Dot(leptonMom)*inNucleonMom->Dot(qTildeP4);
+  double l4 = neutrinoMom.Dot(leptonMom) * qTildeP4.Dot(qTildeP4) - 2*neutrinoMom.Dot(qTildeP4)*leptonMom.Dot(qTildeP4);
+  double l5 = neutrinoMom.Dot(*inNucleonMom) * leptonMom.Dot(qTildeP4) + leptonMom.Dot(*inNucleonMom)*neutrinoMom.Dot(qTildeP4) - neutrinoMom.Dot(leptonMom)*inNucleonMom->Dot(qTildeP4);
 
   double LH = 2 *(l1*h1 + l2*h2 + l3*h3 + l4*h4 + l5*h2);
 
-  delete neutrinoMom;
-
   double xsec = Gfactor * LH;
 
   // Apply given scaling factor
@@ -333,6 +334,19 @@ double LwlynSmithQELCCPXSec::Integral(const Interaction * in) const
   }
 }
 //____________________________________________________________________________
+void LwlynSmithQELCCPXSec::IntegralBatch(
+            const Interaction * const * in, size_t n, double * xsec) const
+{
+// The integrals averaged over the hit nucleon position & momentum are done
+// one at a time; the plain ones are handed to the integrator as a batch
+
+  bool nuclear_target = (n > 0) && in[0]->InitState().Tgt().IsNucleus();
+  if(!nuclear_target || !fDoAvgOverNucleonMomentum) {
+    if(fXSecIntegrator->IntegrateBatch(this, in, n, xsec)) return;
+  }
+  XSecAlgorithmI::IntegralBatch(in, n, xsec);
+}
+//____________________________________________________________________________
 bool LwlynSmithQELCCPXSec::ValidProcess(const Interaction * interaction) const
 {
   if(interaction->TestBit(kISkipProcessChk)) return true;
@@ -42,6 +42,8 @@ public:
   // XSecAlgorithmI interface implementation
   double XSec            (const Interaction * i, KinePhaseSpace_t k) const;
   double Integral        (const Interaction * i) const;
+  void   IntegralBatch   (const Interaction * const * in, size_t n,
+                          double * xsec) const;
   bool   ValidProcess    (const Interaction * i) const;
 
   // Override the Algorithm::Configure methods to load configuration
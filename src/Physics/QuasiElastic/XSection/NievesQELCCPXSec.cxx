@@ -18,6 +18,8 @@
 #include <Math/IFunction.h>
 #include <Math/Integrator.h>
 #include <complex>
+#include <atomic>
+#include <mutex>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
@@ -54,15 +56,28 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+namespace {
+  // Coulomb potential tables: number of radial nodes and maximum relative
+  // deviation from the direct integration tolerated at the table check
+  const int    kNCoulombNodes         = 2001;
+  const double kCoulombTableTolerance = 1E-3;
+
+  // serialises the look-up & building of the Coulomb potential tables
+  std::mutex gCoulombTablesLock;
+  // unique configuration ids (see NievesQELCCPXSec::CoulombTable())
+  std::atomic<unsigned long> gNievesConfigIds(0);
+}
 //____________________________________________________________________________
 NievesQELCCPXSec::NievesQELCCPXSec() :
-XSecAlgorithmI("genie::NievesQELCCPXSec")
+XSecAlgorithmI("genie::NievesQELCCPXSec"),
+fConfigId(0)
 {
 
 }
 //____________________________________________________________________________
 NievesQELCCPXSec::NievesQELCCPXSec(string config) :
-XSecAlgorithmI("genie::NievesQELCCPXSec", config)
+XSecAlgorithmI("genie::NievesQELCCPXSec", config),
+fConfigId(0)
 {
 
 }
@@ -107,9 +122,7 @@ double NievesQELCCPXSec::XSec(const Interaction * interaction,
   double Gfactor = 0.;
   if (kps == kPSTnctnBnctl || kps == kPSQELEvGen) {
     // All kinematics will already be stored
-    TLorentzVector * tempNeutrino = init_state.GetProbeP4(kRfLab);
-    neutrinoMom = *tempNeutrino;
-    delete tempNeutrino;
+    neutrinoMom = init_state.ProbeP4();
     inNucleonMom = target.HitNucP4();
     leptonMom = kinematics.FSLeptonP4();
     outNucleonMom = kinematics.HadSystP4();
@@ -121,9 +134,7 @@ double NievesQELCCPXSec::XSec(const Interaction * interaction,
     Gfactor = kGF2*fCos8c2 / (8.0*kPi*kPi*inNucleonMom.E()*neutrinoMom.E()*outNucleonMom.E()*leptonMom.E()) / 4.0;
   }else{
     // Initial Neutrino, Lab frame
-    TLorentzVector * tempNeutrino = init_state.GetProbeP4(kRfLab);
-    neutrinoMom = *tempNeutrino;
-    delete tempNeutrino;
+    neutrinoMom = init_state.ProbeP4();
     // Initial Nucleon
     inNucleonMom = target.HitNucP4();
     // Generate outgoing lepton in the lab frame
@@ -388,6 +399,19 @@ double NievesQELCCPXSec::Integral(const Interaction * in) const
   }
 }
 //____________________________________________________________________________
+void NievesQELCCPXSec::IntegralBatch(
+            const Interaction * const * in, size_t n, double * xsec) const
+{
+// The integrals averaged over the hit nucleon position & momentum are done
+// one at a time; the plain ones are handed to the integrator as a batch
+
+  bool nuclear_target = (n > 0) && in[0]->InitState().Tgt().IsNucleus();
+  if(!nuclear_target || !fDoAvgOverNucleonMomentum) {
+    if(fXSecIntegrator->IntegrateBatch(this, in, n, xsec)) return;
+  }
+  XSecAlgorithmI::IntegralBatch(in, n, xsec);
+}
+//____________________________________________________________________________
 bool NievesQELCCPXSec::ValidProcess(const Interaction * interaction) const
 {
   if(interaction->TestBit(kISkipProcessChk)) return true;
@@ -435,6 +459,12 @@ void NievesQELCCPXSec::LoadConfig(void)
   // hbarc for unit conversion, GeV*fm
   fhbarc = kLightSpeed*kPlankConstant/genie::units::fermi;
 
+  {
+    std::lock_guard<std::mutex> guard(gCoulombTablesLock);
+    fCoulombTables.clear();
+  }
+  fConfigId = ++gNievesConfigIds;
+
    // load QEL form factors model
   fFormFactorsModel = dynamic_cast<const QELFormFactorsModelI *> (
                                              this->SubAlg("FormFactorsAlg"));
@@ -512,8 +542,9 @@ void NievesQELCCPXSec::CNCTCLimUcalc(TLorentzVector qTildeP4,
 
     //Density gives the nuclear density, normalized to 1
     //Input radius r must be in fm
-    double rhop = nuclear::Density(r,A)*Z;
-    double rhon = nuclear::Density(r,A)*N;
+    double dens = nuclear::Density(r,A);
+    double rhop = dens*Z;
+    double rhon = dens*N;
     double rho = rhop + rhon;
     double rho0 = A*nuclear::Density(0,A);
 
@@ -814,8 +845,46 @@ std::complex<double> NievesQELCCPXSec::deltaLindhard(double q0,
 // Gives coulomb potential in units of GeV
 double NievesQELCCPXSec::vcr(const Target * target, double Rcurr) const{
   if(target->IsNucleus()){
-    int A = target->A();
-    int Z = target->Z();
+    const CoulombTable_t & table = this->CoulombTable(target->A(), target->Z());
+
+    //LOG("Nieves",pDEBUG) "A = " << A
+    //  << ", Rcurr = " << Rcurr << ", Rmax = " << table.rmax;
+
+    if(Rcurr >= table.rmax){
+      LOG("Nieves",pNOTICE) << "Radius greater than maximum radius for coulomb corrections."
+                          << " Integrating to max radius.";
+      return table.v.back();
+    }
+    if(Rcurr <= 0) return table.v.front();
+
+    double x = Rcurr / table.dr;
+    int    i = TMath::Min((int) x, kNCoulombNodes-2);
+    double f = x - i;
+    return (1-f)*table.v[i] + f*table.v[i+1];
+  }else{
+    // If target is not a nucleus the potential will be 0
+    return 0.0;
+  }
+}
+//____________________________________________________________________________
+// Coulomb potential of the nucleus (A,Z) tabulated in the radius, computed
+// the first time the nucleus is seen
+const NievesQELCCPXSec::CoulombTable_t &
+  NievesQELCCPXSec::CoulombTable(int A, int Z) const
+{
+  // the nucleus looked up last by the calling thread (the algorithm is
+  // shared by the event generation threads; configurations have unique ids)
+  static thread_local unsigned long          last_id    = 0;
+  static thread_local int                    last_pdgc  = 0;
+  static thread_local const CoulombTable_t * last_table = 0;
+
+  int pdgc = pdg::IonPdgCode(A,Z);
+  if(last_table && last_id == fConfigId && pdgc == last_pdgc) return *last_table;
+
+  std::lock_guard<std::mutex> guard(gCoulombTablesLock);
+
+  std::map<int, CoulombTable_t>::const_iterator it = fCoulombTables.find(pdgc);
+  if(it == fCoulombTables.end()) {
     // RMax calculated using formula from Nieves' fortran code and default
     // charge and neutron matter density paramters from NuclearUtils.cxx
     double Rmax;
@@ -827,65 +896,83 @@ double NievesQELCCPXSec::vcr(const Target * target, double Rcurr) const{
       Rmax = TMath::Sqrt(20.0)*1.75;
     }
 
-    //LOG("Nieves",pDEBUG) "A = " << A
-    //  << ", Rcurr = " << Rcurr << ", Rmax = " << Rmax;
+    CoulombTable_t table;
+    table.rmax = Rmax;
+    table.dr   = Rmax/(kNCoulombNodes-1);
+    table.v.resize(kNCoulombNodes);
+
+    // V(r) = -4 pi alpha [ 1/r int_0^r rho_p r'^2 dr' + int_r^Rmax rho_p r' dr' ]
+    // with the cumulative integrals computed by the trapezoidal rule
+    std::vector<double> inner(kNCoulombNodes), outer(kNCoulombNodes);
+    double f1prev = 0, f2prev = 0;
+    for(int i = 0; i < kNCoulombNodes; i++) {
+      double ri   = i*table.dr;
+      double rhop = Z*nuclear::Density(ri,A);
+      double f1   = rhop*ri*ri;
+      double f2   = rhop*ri;
+      inner[i] = (i == 0) ? 0 : inner[i-1] + 0.5*(f1+f1prev)*table.dr;
+      outer[i] = (i == 0) ? 0 : outer[i-1] + 0.5*(f2+f2prev)*table.dr;
+      f1prev = f1;
+      f2prev = f2;
+    }
+    for(int i = 0; i < kNCoulombNodes; i++) {
+      double ri = i*table.dr;
+      double result = outer[kNCoulombNodes-1] - outer[i];
+      if(i > 0) result += inner[i]/ri;
+      // Multiply by hbarc to put result in GeV instead of fm
+      table.v[i] = -kAem*4*kPi*result*fhbarc;
+    }
 
-    if(Rcurr >= Rmax){
-      LOG("Nieves",pNOTICE) << "Radius greater than maximum radius for coulomb corrections."
-                          << " Integrating to max radius.";
-      Rcurr = Rmax;
+    // Check the interpolated potential against the direct integration
+    // at the middle of a few table cells
+    double maxdev = 0;
+    for(int k = 0; k < 10; k++) {
+      int    i  = (k*(kNCoulombNodes-1))/10;
+      double rc = (i+0.5)*table.dr;
+      double vt = 0.5*(table.v[i]+table.v[i+1]);
+      double vi = this->vcrIntegral(A,Z,Rmax,rc);
+      if(vi != 0) maxdev = TMath::Max(maxdev, TMath::Abs(vt/vi-1));
+    }
+    if(maxdev > kCoulombTableTolerance) {
+      LOG("Nieves", pWARN)
+        << "Coulomb potential table for A = " << A << ", Z = " << Z
+        << " deviates from the direct integration by up to " << maxdev;
+    } else {
+      LOG("Nieves", pINFO)
+        << "Tabulated the Coulomb potential for A = " << A << ", Z = " << Z
+        << " (max relative deviation = " << maxdev << ")";
     }
 
-    ROOT::Math::IBaseFunctionOneDim * func = new
-      utils::gsl::wrap::NievesQELvcrIntegrand(Rcurr,A,Z);
-    ROOT::Math::IntegrationOneDim::Type ig_type =
-      utils::gsl::Integration1DimTypeFromString("adaptive");
-
-    double abstol = 1; // We mostly care about relative tolerance;
-    double reltol = 1E-4;
-    int nmaxeval = 100000;
-    ROOT::Math::Integrator ig(*func,ig_type,abstol,reltol,nmaxeval);
-    double result = ig.Integral(0,Rmax);
-    delete func;
-
-    // Multiply by Z to normalize densities to number of protons
-    // Multiply by hbarc to put result in GeV instead of fm
-    return -kAem*4*kPi*result*fhbarc;
-  }else{
-    // If target is not a nucleus the potential will be 0
-    return 0.0;
+    it = fCoulombTables.insert(
+       std::map<int, CoulombTable_t>::value_type(pdgc, table)).first;
   }
+
+  last_id    = fConfigId;
+  last_pdgc  = pdgc;
+  last_table = &(it->second);
+  return it->second;
 }
 //____________________________________________________________________________
-int NievesQELCCPXSec::leviCivita(int input[]) const{
-  int copy[4] = {input[0],input[1],input[2],input[3]};
-  int permutations = 0;
-  int temp;
-
-  for(int i=0;i<4;i++){
-    for(int j=i+1;j<4;j++){
-      //If any two elements are equal return 0
-      if(input[i] == input[j])
-        return 0;
-      //If a larger number is before a smaller one, use permutations
-      //(exchanges of two adjacent elements) to move the smaller element
-      //so it is before the larger element, eg 2341->2314->2134->1234
-      if(copy[i]>copy[j]){
-        temp = copy[j];
-        for(int k=j;k>i;k--){
-          copy[k] = copy[k-1];
-          permutations++;
-        }
-        copy[i] = temp;
-      }
-    }
-  }
-
-  if(permutations % 2 == 0){
-    return 1;
-  }else{
-    return -1;
-  }
+// Coulomb potential (in GeV) at the radius Rcurr < Rmax by direct numerical
+// integration over the nuclear density
+double NievesQELCCPXSec::vcrIntegral(
+  int A, int Z, double Rmax, double Rcurr) const
+{
+  ROOT::Math::IBaseFunctionOneDim * func = new
+    utils::gsl::wrap::NievesQELvcrIntegrand(Rcurr,A,Z);
+  ROOT::Math::IntegrationOneDim::Type ig_type =
+    utils::gsl::Integration1DimTypeFromString("adaptive");
+
+  double abstol = 0; // Only the relative tolerance matters
+  double reltol = 1E-4;
+  int nmaxeval = 100000;
+  ROOT::Math::Integrator ig(*func,ig_type,abstol,reltol,nmaxeval);
+  double result = ig.Integral(0,Rmax);
+  delete func;
+
+  // Multiply by Z to normalize densities to number of protons
+  // Multiply by hbarc to put result in GeV instead of fm
+  return -kAem*4*kPi*result*fhbarc;
 }
 //____________________________________________________________________________
 // Calculates the constraction of the leptonic and hadronic tensors. The
@@ -1020,132 +1107,62 @@ double NievesQELCCPXSec::LmunuAnumu(const TLorentzVector neutrinoMom,
       LOG("Nieves",pDEBUG) << rulin[i][j];
     */
 
-  //Additional constants and variables
-  const int g[4][4] = {{1,0,0,0},{0,-1,0,0},{0,0,-1,0},{0,0,0,-1}};
-  const std::complex<double> iNum(0,1);
-  int leviCivitaIndexArray[4];
-  double imaginaryPart = 0;
-
-  std::complex<double> sum(0.0,0.0);
-
+  // Contract the leptonic and hadronic tensors. With the initial nucleon
+  // at rest and q in the z direction, the only non-zero elements of A are
+  // A00, A03 = A30, A11, A22, A33 (real) and A12 = -A21 (imaginary).
+  // The real part of L is symmetric and its imaginary part antisymmetric,
+  //   Re L[mu][nu] = kPrime_mu k_nu + kPrime_nu k_mu - g[mu][nu] (kPrime.k)
+  //   Im L[mu][nu] = - eps[mu][nu][a][b] kPrime^a k^b
+  // (index positions as in Nieves' paper), so the contraction
+  // sum_{mu,nu} L[mu][nu] A[nu][mu] is real and only terms with these A
+  // elements survive. The only Levi-Civita symbols needed are
+  // eps[1][2][0][3] = +1 and eps[1][2][3][0] = -1.
   double kPrimek = k[0]*kPrime[0]-k[1]*kPrime[1]-k[2]*kPrime[2]-k[3]*kPrime[3];
 
-  std::complex<double> Lmunu(0.0,0.0),Lnumu(0.0,0.0);
-  std::complex<double> Amunu(0.0,0.0),Anumu(0.0,0.0);
-
-  // Calculate LmunuAnumu by iterating over mu and nu
-  // In each iteration, add LmunuAnumu to sum if mu=nu, and add
-  // LmunuAnumu + LnumuAmunu if mu != nu, since we start nu at mu
-  double axx=0.,azz=0.,a0z=0.,a00=0.,axy=0.;
-  for(int mu=0;mu<4;mu++){
-    for(int nu=mu;nu<4;nu++){
-      imaginaryPart = 0;
-      if(mu == nu){
-        //if mu==nu then levi-civita = 0, so imaginary part = 0
-        Lmunu = g[mu][mu]*kPrime[mu]*g[nu][nu]*k[nu]+g[nu][nu]*kPrime[nu]*g[mu][mu]*k[mu]-g[mu][nu]*kPrimek;
-      }else{
-        //if mu!=nu, then g[mu][nu] = 0
-        //This same leviCivitaIndex array can be used in the else portion when
-        //calculating Anumu
-        leviCivitaIndexArray[0] = mu;
-        leviCivitaIndexArray[1] = nu;
-        for(int a=0;a<4;a++){
-          for(int b=0;b<4;b++){
-            leviCivitaIndexArray[2] = a;
-            leviCivitaIndexArray[3] = b;
-            imaginaryPart += - leviCivita(leviCivitaIndexArray)*kPrime[a]*k[b];
-          }
-        }
-        //real(Lmunu) is symmetric, and imag(Lmunu) is antisymmetric
-        //std::complex<double> num(g[mu][mu]*kPrime[mu]*g[nu][nu]*k[nu]+g[nu][nu]*kPrime[nu]*g[mu][mu]*k[mu],imaginaryPart);
-        Lmunu = g[mu][mu]*kPrime[mu]*g[nu][nu]*k[nu]+g[nu][nu]*kPrime[nu]*g[mu][mu]*k[mu] + iNum*imaginaryPart;
-        Lnumu = g[nu][nu]*kPrime[nu]*g[mu][mu]*k[mu]+g[mu][mu]*kPrime[mu]*g[nu][nu]*k[nu ]- iNum*imaginaryPart;
-      } // End Lmunu calculation
-
-      if(mu ==0 && nu == 0){
-        Amunu = 16.0*F1V2*(2.0*rulin[0][0]*CN+2.0*q[0]*tulin[0]+q2/2.0)+
-          2.0*q2*xiF2V2*
-          (4.0-4.0*rulin[0][0]/M2-4.0*q[0]*tulin[0]/M2-q02*(4.0/q2+1.0/M2)) +
-          4.0*FA2*(2.0*rulin[0][0]+2.0*q[0]*tulin[0]+(q2/2.0-2.0*M2))-
-          (2.0*CL*Fp2*q2+8.0*FA*Fp*CL*M)*q02-16.0*F1V*xiF2V*(-q2+q02)*CN;
-        a00 = real(Amunu); // TESTING CODE
-        sum += Lmunu*Amunu;
-      }else if(mu == 0 && nu == 3){
-        Amunu = 16.0*F1V2*((2.0*rulin[0][3]+tulin[0]*dq)*CN+tulin[3]*q[0])+
-          2.0*q2*xiF2V2*
-          (-4.0*rulin[0][3]/M2-2.0*(dq*tulin[0]+q[0]*tulin[3])/M2-dq*q[0]*(4.0/q2+1.0/M2))+
-          4.0*FA2*((2.0*rulin[0][3]+dq*tulin[0])*CL+q[0]*tulin[3])-
-          (2.0*CL*Fp2*q2+8.0*FA*Fp*CL*M)*dq*q[0]-
-          16.0*F1V*xiF2V*dq*q[0];
-        a0z= real(Amunu); // TESTING CODE
-        Anumu = Amunu;
-        sum += Lmunu*Anumu + Lnumu*Amunu;
-      }else if(mu == 3 && nu == 3){
-        Amunu = 16.0*F1V2*(2.0*rulin[3][3]+2.0*dq*tulin[3]-q2/2.0)+
-          2.0*q2*xiF2V2*(-4.0-4.0*rulin[3][3]/M2-4.0*dq*tulin[3]/M2-dq2*(4.0/q2+1.0/M2))+
-          4.0*FA2*(2.0*rulin[3][3]+2.0*dq*tulin[3]-(q2/2.0-2.0*CL*M2))-
-          (2.0*CL*Fp2*q2+8.0*FA*Fp*CL*M)*dq2-
-          16.0*F1V*xiF2V*(q2+dq2);
-        azz = real(Amunu); // TESTING CODE
-        sum += Lmunu*Amunu;
-      }else if(mu ==1 && nu == 1){
-        Amunu = 16.0*F1V2*(2.0*rulin[1][1]-q2/2.0)+
-          2.0*q2*xiF2V2*(-4.0*CT-4.0*rulin[1][1]/M2) +
-          4.0*FA2*(2.0*rulin[1][1]-(q2/2.0-2.0*CT*M2))-
-          16.0*F1V*xiF2V*CT*q2;
-        axx = real(Amunu); // TESTING CODE
-        sum += Lmunu*Amunu;
-      }else if(mu == 2 && nu == 2){
-        // Ayy not explicitly listed in paper. This is included so rotating the
-        // coordinates of k and k' about the z-axis does not change the xsec.
-        Amunu = 16.0*F1V2*(2.0*rulin[2][2]-q2/2.0)+
-          2.0*q2*xiF2V2*(-4.0*CT-4.0*rulin[2][2]/M2) +
-          4.0*FA2*(2.0*rulin[2][2]-(q2/2.0-2.0*CT*M2))-
-          16.0*F1V*xiF2V*CT*q2;
-        sum += Lmunu*Amunu;
-      }else if(mu ==1 && nu == 2){
-        Amunu = sign*16.0*iNum*FA*(xiF2V+F1V)*(-dq*tulin[0]*CT + q[0]*tulin[3]);
-        Anumu = -Amunu; // Im(A) is antisymmetric
-        axy = imag(Amunu); // TESTING CODE
-        sum += Lmunu*Anumu+Lnumu*Amunu;
-      }
-      // All other terms will be 0 becuase the initial nucleon is at rest and
-      // q is in the z direction
-
-      // CAN BE DELETED
-      /*else{
-        // No RPA corrections to the remaining terms, so A is not r dependent
-        if(mu == nu){
-          Amunu = a1*g[mu][nu]+
-            a2*(rulin[mu][nu]+tulin[mu]*q[nu]/2.0+tulin[nu]*q[mu]/2.0)+a4*q[mu]*q[nu];
-          sum += Lmunu*Amunu;
-
-        }else{
-          imaginaryPart = 0;
-          leviCivitaIndexArray[0] = mu;
-          leviCivitaIndexArray[1] = nu;
-          for(int a=0;a<4;a++){
-            for(int b=a+1;b<4;b++){
-              leviCivitaIndexArray[2] = a;
-              leviCivitaIndexArray[3] = b;
-              //Switching a and b reverses the sign of the leviCivita
-              //symbol, and a==b gives leviCivita = 0
-              lcNum = leviCivita(leviCivitaIndexArray);
-              imaginaryPart += lcNum*g[a][a]*tulin[a]*g[b][b]*q[b]
-                -lcNum*g[b][b]*tulin[b]*g[a][a]*q[a];
-            }
-          }
-          Amunu = a1*g[mu][nu]+
-            a2*(rulin[mu][nu]+tulin[mu]*q[nu]/2.0+tulin[nu]*q[mu]/2.0)+
-            iNum*a3*imaginaryPart+a4*q[mu]*q[nu];
-          Anumu = a1*g[mu][nu]+
-            a2*(rulin[mu][nu]+tulin[mu]*q[nu]/2.0+tulin[nu]*q[mu]/2.0)-
-            iNum*a3*imaginaryPart+a4*q[mu]*q[nu];
-          sum += Lmunu*Anumu+Lnumu*Amunu;
-          }
-          }*/ // END CODE THAT CAN BE DELETED
-    } // End loop over nu
-  } // End loop over mu
+  double L00   = 2.0*kPrime[0]*k[0] - kPrimek;
+  double L11   = 2.0*kPrime[1]*k[1] + kPrimek;
+  double L22   = 2.0*kPrime[2]*k[2] + kPrimek;
+  double L33   = 2.0*kPrime[3]*k[3] + kPrimek;
+  double L03   = -(kPrime[0]*k[3] + kPrime[3]*k[0]);
+  double ImL12 = kPrime[3]*k[0] - kPrime[0]*k[3];
+
+  double a00 = 16.0*F1V2*(2.0*rulin[0][0]*CN+2.0*q[0]*tulin[0]+q2/2.0)+
+    2.0*q2*xiF2V2*
+    (4.0-4.0*rulin[0][0]/M2-4.0*q[0]*tulin[0]/M2-q02*(4.0/q2+1.0/M2)) +
+    4.0*FA2*(2.0*rulin[0][0]+2.0*q[0]*tulin[0]+(q2/2.0-2.0*M2))-
+    (2.0*CL*Fp2*q2+8.0*FA*Fp*CL*M)*q02-16.0*F1V*xiF2V*(-q2+q02)*CN;
+
+  double a0z = 16.0*F1V2*((2.0*rulin[0][3]+tulin[0]*dq)*CN+tulin[3]*q[0])+
+    2.0*q2*xiF2V2*
+    (-4.0*rulin[0][3]/M2-2.0*(dq*tulin[0]+q[0]*tulin[3])/M2-dq*q[0]*(4.0/q2+1.0/M2))+
+    4.0*FA2*((2.0*rulin[0][3]+dq*tulin[0])*CL+q[0]*tulin[3])-
+    (2.0*CL*Fp2*q2+8.0*FA*Fp*CL*M)*dq*q[0]-
+    16.0*F1V*xiF2V*dq*q[0];
+
+  double azz = 16.0*F1V2*(2.0*rulin[3][3]+2.0*dq*tulin[3]-q2/2.0)+
+    2.0*q2*xiF2V2*(-4.0-4.0*rulin[3][3]/M2-4.0*dq*tulin[3]/M2-dq2*(4.0/q2+1.0/M2))+
+    4.0*FA2*(2.0*rulin[3][3]+2.0*dq*tulin[3]-(q2/2.0-2.0*CL*M2))-
+    (2.0*CL*Fp2*q2+8.0*FA*Fp*CL*M)*dq2-
+    16.0*F1V*xiF2V*(q2+dq2);
+
+  double axx = 16.0*F1V2*(2.0*rulin[1][1]-q2/2.0)+
+    2.0*q2*xiF2V2*(-4.0*CT-4.0*rulin[1][1]/M2) +
+    4.0*FA2*(2.0*rulin[1][1]-(q2/2.0-2.0*CT*M2))-
+    16.0*F1V*xiF2V*CT*q2;
+
+  // Ayy not explicitly listed in paper. This is included so rotating the
+  // coordinates of k and k' about the z-axis does not change the xsec.
+  double ayy = 16.0*F1V2*(2.0*rulin[2][2]-q2/2.0)+
+    2.0*q2*xiF2V2*(-4.0*CT-4.0*rulin[2][2]/M2) +
+    4.0*FA2*(2.0*rulin[2][2]-(q2/2.0-2.0*CT*M2))-
+    16.0*F1V*xiF2V*CT*q2;
+
+  // A12 = i*axy, A21 = -i*axy
+  double axy = sign*16.0*FA*(xiF2V+F1V)*(-dq*tulin[0]*CT + q[0]*tulin[3]);
+
+  // L12 A21 + L21 A12 = 2 Im(L12) axy
+  double sum = L00*a00 + L11*axx + L22*ayy + L33*azz +
+               2.0*L03*a0z + 2.0*ImL12*axy;
 
   // TESTING CODE
   if(fCompareNievesTensors){
@@ -1179,14 +1196,7 @@ double NievesQELCCPXSec::LmunuAnumu(const TLorentzVector neutrinoMom,
   }
   // END TESTING CODE
 
-  // Since the real parts of A and L are both symmetric and the imaginary
-  // parts are antisymmetric, the contraction should be real
-  if(imag(sum) > kASmallNum)
-    LOG("Nieves",pWARN) << "Imaginary part of tensor contraction is nonzero "
-                        << "in QEL XSec, real(sum) = " << real(sum)
-                        << "imag(sum) = " << imag(sum);
-
-  return real(sum);
+  return sum;
 }
 //____________________________________________________________________________
 // Generate a lepton using PrimaryLeptonGenerator::ProcessEventRecord()
@@ -1218,7 +1228,7 @@ TLorentzVector NievesQELCCPXSec::GenerateOutgoingLepton(const Interaction* inter
   if(xcls.IsCharmEvent()) { rpdgc = xcls.CharmHadronPdg();           }
   else                    { rpdgc = interaction->RecoilNucleonPdg(); }
   assert(rpdgc);
-  double W = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+  double W = PDGLibrary::Instance()->Mass(rpdgc);
   // (W,Q2) -> (x,y)
   double x=0, y=0;
   utils::kinematics::WQ2toXY(E,M,W,Q2,x,y);
@@ -7,6 +7,9 @@
           with RPA corrections
           Is a concrete implementation of the XSecAlgorithmI interface. \n
 
+          The Coulomb potential of each nucleus is tabulated in the radius,
+          the first time the nucleus is seen, and interpolated. \n
+
 \ref      Physical Review C 70, 055503 (2004)
 
 \author   Joe Johnston, University of Pittsburgh
@@ -27,6 +30,8 @@
 #include "Physics/QuasiElastic/XSection/QELFormFactors.h"
 #include "Physics/NuclearState/FermiMomentumTable.h"
 #include <complex>
+#include <map>
+#include <vector>
 #include <Math/IFunction.h>
 #include "Physics/NuclearState/NuclearModelI.h"
 
@@ -45,6 +50,8 @@ public:
   // XSecAlgorithmI interface implementation
   double XSec            (const Interaction * i, KinePhaseSpace_t k) const;
   double Integral        (const Interaction * i) const;
+  void   IntegralBatch   (const Interaction * const * in, size_t n,
+                          double * xsec) const;
   bool   ValidProcess    (const Interaction * i) const;
 
   // Override the Algorithm::Configure methods to load configuration
@@ -107,10 +114,18 @@ private:
   // Potential for coulomb correction
   double vcr(const Target * target, double r) const;
 
-  //input must be length 4. Returns 1 if input is an even permutation of 0123,
-  //-1 if input is an odd permutation of 0123, and 0 if any two elements
-  //are equal
-  int leviCivita(int input[]) const;
+  // Coulomb potential of a nucleus at kNCoulombNodes radii evenly spaced
+  // from 0 to rmax (beyond rmax the potential is taken as at rmax)
+  struct CoulombTable_t {
+    double              rmax;
+    double              dr;
+    std::vector<double> v;
+  };
+  const CoulombTable_t & CoulombTable (int A, int Z) const;
+  double                 vcrIntegral  (int A, int Z, double Rmax, double r) const;
+
+  mutable std::map<int, CoulombTable_t> fCoulombTables;    ///< per nucleus PDG code, built under a lock
+  unsigned long                         fConfigId;         ///< unique id of the current configuration
 
   double LmunuAnumu(const TLorentzVector neutrinoMom,
 		    const TLorentzVector inNucleonMom,
@@ -10,7 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
-
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Calculate() skips the model calls when the kinematics are those of the
+   previous calculation.
 */
 //____________________________________________________________________________
 
@@ -60,6 +62,7 @@ void QELFormFactors::Calculate(const Interaction * interaction)
     this->Reset("D");
     return;
   }
+  if(fMemo.Hit(fModel, interaction)) return;
 
   this -> fF1V   = fModel -> F1V   (interaction);
   this -> fxiF2V = fModel -> xiF2V (interaction);
@@ -76,6 +79,7 @@ void QELFormFactors::Reset(Option_t * opt)
   this->fxiF2V = 0;
   this->fFA    = 0;
   this->fFp    = 0;
+  this->fMemo.Clear();
 
   string option(opt);
   if(option.find("D") == string::npos) {this->fModel = 0;}
@@ -89,6 +93,7 @@ void QELFormFactors::Copy(const QELFormFactors & ff)
   this->fxiF2V = ff.fxiF2V;
   this->fFA    = ff.fFA;
   this->fFp    = ff.fFp;
+  this->fMemo  = ff.fMemo;
 }
 //____________________________________________________________________________
 bool QELFormFactors::Compare(const QELFormFactors & ff) const
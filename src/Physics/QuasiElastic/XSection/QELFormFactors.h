@@ -27,6 +27,7 @@
 #include <iostream>
 
 #include "Physics/QuasiElastic/XSection/QELFormFactorsModelI.h"
+#include "Physics/QuasiElastic/XSection/FormFactorsMemo.h"
 #include "Framework/Interaction/Interaction.h"
 
 using std::ostream;
@@ -48,6 +49,7 @@ public:
   void   SetModel  (const QELFormFactorsModelI * model);
 
   //! Compute the form factors for the input interaction using the attached model
+  //! (a no-op if they were last computed for the same kinematics)
   void   Calculate (const Interaction * interaction);
 
   //! Get the computed form factor F1V
@@ -82,6 +84,7 @@ private:
   double fFp;
 
   const QELFormFactorsModelI * fModel;
+  FormFactorsMemo              fMemo;  //! inputs of the last calculation
 };
 
 }        // genie namespace
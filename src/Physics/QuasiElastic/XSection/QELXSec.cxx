@@ -20,9 +20,16 @@
    Moved generation of the struck nucleon position and momentum to the
    QEL implementations of the XSecAlgorithmI class. Integrate() now contains
    the code that was previously in IntegrateOnce().
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added IntegrateBatch(), integrating the knots of a spline concurrently
+   (batch-nthreads).
+   Integrates the LwlynSmithQELCCPXSec model through a function bound to its
+   concrete type (see utils::gsl::dXSec_dQ2_E_T).
 */
 //____________________________________________________________________________
 
+#include <typeinfo>
+
 #include <TMath.h>
 #include <Math/IFunction.h>
 #include <Math/Integrator.h>
@@ -36,6 +43,7 @@
 #include "Framework/Conventions/KineVar.h"
 #include "Framework/Conventions/RefFrame.h"
 #include "Physics/QuasiElastic/XSection/QELXSec.h"
+#include "Physics/QuasiElastic/XSection/LwlynSmithQELCCPXSec.h"
 
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
@@ -88,8 +96,14 @@ double QELXSec::Integrate(
   interaction->SetBit(kISkipProcessChk);
   interaction->SetBit(kISkipKinematicChk);
 
-  ROOT::Math::IBaseFunctionOneDim * func = new 
-      utils::gsl::dXSec_dQ2_E(model, interaction);
+  // direct calls to the default model (not to models derived from it)
+  ROOT::Math::IBaseFunctionOneDim * func = 0;
+  if(typeid(*model) == typeid(LwlynSmithQELCCPXSec)) {
+    func = new utils::gsl::dXSec_dQ2_E_T<LwlynSmithQELCCPXSec>(
+                  static_cast<const LwlynSmithQELCCPXSec *>(model), interaction);
+  } else {
+    func = new utils::gsl::dXSec_dQ2_E(model, interaction);
+  }
   ROOT::Math::IntegrationOneDim::Type ig_type = 
       utils::gsl::Integration1DimTypeFromString(fGSLIntgType);
   
@@ -105,6 +119,12 @@ double QELXSec::Integrate(
   return xsec;
 }
 //____________________________________________________________________________
+bool QELXSec::IntegrateBatch(const XSecAlgorithmI * model,
+         const Interaction * const * in, size_t n, double * xsec) const
+{
+  return this->IntegrateBatchThreads(model, in, n, xsec);
+}
+//____________________________________________________________________________
 void QELXSec::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -129,6 +149,8 @@ void QELXSec::LoadConfig(void)
 	GetParamDef( "gsl-rule", rule, 3);
 	fGSLRule = (unsigned int) rule;
     if (fGSLRule>6) fGSLRule=3;
+
+  this->LoadIntegratorConfig();
 }
 //____________________________________________________________________________
 
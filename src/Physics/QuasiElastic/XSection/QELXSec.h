@@ -36,6 +36,12 @@ public:
   //! XSecIntegratorI interface implementation
   double Integrate(const XSecAlgorithmI * model, const Interaction * i) const;
 
+  //! Integrate the model for a set of interactions (eg the knots of a
+  //! spline) concurrently, with batch-nthreads > 1
+  bool   IntegrateBatch(const XSecAlgorithmI * model,
+                        const Interaction * const * in, size_t n,
+                        double * xsec) const;
+
   //! Overload the Algorithm::Configure() methods to load private data
   //! members from configuration options
   void Configure(const Registry & config);
@@ -20,6 +20,7 @@
 */
 //____________________________________________________________________________
 #include <sstream>
+#include <mutex>
 
 #include <TMath.h>
 
@@ -39,27 +40,37 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/Range1.h"
 #include "Physics/QuasiElastic/XSection/SmithMonizUtils.h"
+#include "Physics/QuasiElastic/XSection/SmithMonizResponseTable.h"
+#include "Framework/Messenger/Messenger.h"
 
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::utils;
 using std::ostringstream;
 
+namespace {
+  // guards the response tables of all instances
+  std::mutex gResponseTablesLock;
+}
+
 //____________________________________________________________________________
 SmithMonizQELCCPXSec::SmithMonizQELCCPXSec() :
-XSecAlgorithmI("genie::SmithMonizQELCCPXSec")
+XSecAlgorithmI("genie::SmithMonizQELCCPXSec"),
+fUseResponseTable(false)
 {
 
 }
 //____________________________________________________________________________
 SmithMonizQELCCPXSec::SmithMonizQELCCPXSec(string config) :
-XSecAlgorithmI("genie::SmithMonizQELCCPXSec", config)
+XSecAlgorithmI("genie::SmithMonizQELCCPXSec", config),
+fUseResponseTable(false)
 {
 
 }
 //____________________________________________________________________________
 SmithMonizQELCCPXSec::~SmithMonizQELCCPXSec()
 {
+  this->ClearResponseTables();
 
 }
 //____________________________________________________________________________
@@ -150,53 +161,14 @@ void SmithMonizQELCCPXSec::LoadConfig(void)
   sm_utils = const_cast<genie::SmithMonizUtils *>(
                dynamic_cast<const genie::SmithMonizUtils *>(
                  this -> SubAlg( "sm_utils_algo" ) ) ) ;
-  
-}
-//____________________________________________________________________________
-double SmithMonizQELCCPXSec::d3sQES_dQ2dvdkF_SM(const Interaction * interaction) const
-{
-	// Get kinematics & init-state parameters
-	const Kinematics &   kinematics = interaction -> Kine();
-	
-	double kF      = kinematics.GetKV(kKVPn);
-    double kkF     = kF*kF;
-    double P_Fermi, E_nuBIN;
-    
-    E_nuBIN = sm_utils->GetBindingEnergy();
-    
-    double E_p     = TMath::Sqrt(fmm_ini+kkF)-E_nuBIN;
-    double cosT_p  = ((fv-E_nuBIN)*(2*E_p+fv+E_nuBIN)-fqqv+fmm_ini-fmm_fin)/(2*kF*fqv);           //\cos\theta_p
-    double pF      = TMath::Sqrt(kkF+(2*kF*fqv)*cosT_p+fqqv);
-	double b2_flux = (E_p-kF*fcosT_k*cosT_p)*(E_p-kF*fcosT_k*cosT_p);
-    double c2_flux = kkF*(1-cosT_p*cosT_p)*(1-fcosT_k*fcosT_k);
-    
-    P_Fermi        = sm_utils->GetFermiMomentum();
-    double FV_SM   = 4.0*TMath::Pi()/3*TMath::Power(P_Fermi, 3);
-    double factor  = fk1*(fm_tar*kF/(FV_SM*fqv*TMath::Sqrt(b2_flux-c2_flux)))*SmithMonizUtils::rho(P_Fermi, 0.0, kF)*(1-SmithMonizUtils::rho(P_Fermi, 0.01, pF));    
-	
-    double a2      = kkF/kNucleonMass2;
-    double a3      = a2*cosT_p*cosT_p;
-    double a6      = kF*cosT_p/kNucleonMass;
-    double a7      = E_p/kNucleonMass;
-    double a4      = a7*a7;
-    double a5      = 2*a7*a6;
-
-    double k3      = fv/fqv;
-    double k4      = (3*a3-a2)/fqqv;
-    double k5      = (a7-a6*k3)*fm_tar/kNucleonMass;
-
-    double T_1     = 1.0*fW_1+(a2-a3)*0.5*fW_2;                              //Ref.[1], W_1
-    double T_2     = ((a2-a3)*fQ2/(2*fqqv)+a4-k3*(a5-k3*a3))*fW_2;           //Ref.[1], W_2
-    double T_3     = k5*fW_3;                                                //Ref.[1], W_8
-    double T_4     = fmm_tar*(0.5*fW_2*k4+1.0*fW_4/kNucleonMass2+a6*fW_5/(kNucleonMass*fqv));    //Ref.[1], W_\alpha
-    double T_5     = k5*fW_5+fm_tar*(a5/fqv-fv*k4)*fW_2;
-
-    double xsec    = kGF2*factor*((fE_lep-fk7)*(T_1+fk2*T_4)/fm_tar+(fE_lep+fk7)*T_2/(2*fm_tar)
-					 +fn_NT*T_3*((fE_nu+fE_lep)*(fE_lep-fk7)/(2*fmm_tar)-fk2)-fk2*T_5)
-					 *(kMw2/(kMw2+fQ2))*(kMw2/(kMw2+fQ2))/fE_nu/kPi;
-	return xsec;
-    
-	
+
+  // Tabulation of the nuclear responses
+  GetParamDef( "SM-UseResponseTable",        fUseResponseTable, false ) ;
+  GetParamDef( "SM-ResponseTable-NQ",        fRespTableNQ,      150   ) ;
+  GetParamDef( "SM-ResponseTable-QMax",      fRespTableQMax,    3.    ) ;
+  GetParamDef( "SM-ResponseTable-NOmega",    fRespTableNV,      60    ) ;
+  GetParamDef( "SM-ResponseTable-NCosTheta", fRespTableNC,      11    ) ;
+  this->ClearResponseTables();
 }
 //____________________________________________________________________________
 double SmithMonizQELCCPXSec::d2sQES_dQ2dv_SM(const Interaction * interaction) const
@@ -205,7 +177,6 @@ double SmithMonizQELCCPXSec::d2sQES_dQ2dv_SM(const Interaction * interaction) co
 	sm_utils->SetInteraction(interaction);
 	fQ2      = kinematics->GetKV(kKVQ2);
 	fv       = kinematics->GetKV(kKVv);
-	Range1D_t rkF = sm_utils->kFQES_SM_lim(fQ2,fv);
 	
 	const InitialState & init_state = interaction -> InitState();
 	const Target & target = init_state.Tgt();
@@ -260,8 +231,58 @@ double SmithMonizQELCCPXSec::d2sQES_dQ2dv_SM(const Interaction * interaction) co
     fW_4     =-0.5*fF_V*fF_M-fF_A*fF_P+t*fF_P*fF_P-0.25*(1-t)*fFF_M;    //Ref.[1], \tilde{T}_\alpha
     fW_5     = fFF_V+t*fFF_M+fFF_A;
 	
+	double resp[SmithMonizResponseTable::kNResp];
+	const SmithMonizResponseTable * table =
+	    (fUseResponseTable && sm_utils->GetFermiMomentum() > 0) ?
+	    this->ResponseTable(interaction) : 0;
+	if(!table || !table->Evaluate(fqv, fv, fcosT_k, resp)) {
+	  this->NuclearResponses(fQ2, fv, fcosT_k, resp);
+	}
+
+	double T_1     = fW_1*resp[0]+fW_2*resp[1];                                      //Ref.[1], W_1
+	double T_2     = fW_2*resp[2];                                                   //Ref.[1], W_2
+	double T_3     = fW_3*resp[3];                                                   //Ref.[1], W_8
+	double T_4     = fmm_tar*(0.5*fW_2*resp[4]+fW_4*resp[0]/kNucleonMass2+fW_5*resp[5]/(kNucleonMass*fqv));    //Ref.[1], W_\alpha
+	double T_5     = fW_5*resp[3]+fm_tar*fW_2*resp[6];
+
+	double xsec    = kGF2*((fE_lep-fk7)*(T_1+fk2*T_4)/fm_tar+(fE_lep+fk7)*T_2/(2*fm_tar)
+					 +fn_NT*T_3*((fE_nu+fE_lep)*(fE_lep-fk7)/(2*fmm_tar)-fk2)-fk2*T_5)
+					 *(kMw2/(kMw2+fQ2))*(kMw2/(kMw2+fQ2))/fE_nu/kPi;
+	
+	int nucpdgc = target.HitNucPdg();
+    int NNucl = (pdg::IsProton(nucpdgc)) ? target.Z() : target.N(); 
+
+    xsec *= NNucl; // nuclear xsec
+    
+    // Apply given scaling factor
+    xsec *= fXSecScale;
+    
+    return xsec;
+		
+}
+//____________________________________________________________________________
+void SmithMonizQELCCPXSec::NuclearResponses(
+   double Q2, double v, double cosT_k, double * resp) const
+{
+// The integrals over the Fermi momentum of the nuclear parts of the
+// structure functions of Ref.[1], multiplied by the flux factor: they
+// depend on the target, Q2, v and, through the flux factor, on the angle
+// between q and the neutrino momentum, but not on the form factors
+
+  for(int i = 0; i < SmithMonizResponseTable::kNResp; i++) resp[i] = 0;
+
+  Range1D_t rkF = sm_utils->kFQES_SM_lim(Q2,v);
+  if(rkF.max <= rkF.min) return;
+
+  double qqv     = v*v+Q2;
+  double qv      = TMath::Sqrt(qqv);
+  double E_nuBIN = sm_utils->GetBindingEnergy();
+  double P_Fermi = sm_utils->GetFermiMomentum();
+  double FV_SM   = 4.0*TMath::Pi()/3*TMath::Power(P_Fermi, 3);
+  double k3      = v/qv;
+
 //  Gaussian quadratures integrate over Fermi momentum
-	double R[48]= { 0.16276744849602969579e-1,0.48812985136049731112e-1,
+	static const double R[48]= { 0.16276744849602969579e-1,0.48812985136049731112e-1,
 					0.81297495464425558994e-1,1.13695850110665920911e-1,
 					1.45973714654896941989e-1,1.78096882367618602759e-1,
 					2.10031310460567203603e-1,2.41743156163840012328e-1,
@@ -286,7 +307,7 @@ double SmithMonizQELCCPXSec::d2sQES_dQ2dv_SM(const Interaction * interaction) co
 					9.92543900323762624572e-1,9.95981842987209290650e-1,
 					9.98364375863181677724e-1,9.99689503883230766828e-1};
 	
-	double W[48]= {	0.00796792065552012429e-1,0.01853960788946921732e-1,
+	static const double W[48]= {	0.00796792065552012429e-1,0.01853960788946921732e-1,
 					0.02910731817934946408e-1,0.03964554338444686674e-1,
 					0.05014202742927517693e-1,0.06058545504235961683e-1,
 					0.07096470791153865269e-1,0.08126876925698759217e-1,
@@ -310,30 +331,101 @@ double SmithMonizQELCCPXSec::d2sQES_dQ2dv_SM(const Interaction * interaction) co
 					0.32034456231992663218e-1,0.32206204794030250669e-1,
 					0.32343822568575928429e-1,0.32447163714064269364e-1,
 					0.32516118713868835987e-1,0.32550614492363166242e-1};
-	
-	double Sum = 0;
-	for(int i = 0;i<48;i++)
-	{
-		double kF = 0.5*(-R[i]*(rkF.max-rkF.min)+rkF.min+rkF.max);
-		kinematics->SetKV(kKVPn, kF);
-		Sum+=d3sQES_dQ2dvdkF_SM(interaction)*W[47-i];
-		kF = 0.5*(R[i]*(rkF.max-rkF.min)+rkF.min+rkF.max);
-		kinematics->SetKV(kKVPn, kF);
-		Sum+=d3sQES_dQ2dvdkF_SM(interaction)*W[47-i];
-	}
-	
-	double xsec = 0.5*Sum*(rkF.max-rkF.min);
-	
-	int nucpdgc = target.HitNucPdg();
-    int NNucl = (pdg::IsProton(nucpdgc)) ? target.Z() : target.N(); 
 
-    xsec *= NNucl; // nuclear xsec
-    
-    // Apply given scaling factor
-    xsec *= fXSecScale;
-    
-    return xsec;
-		
+  double hw = 0.5*(rkF.max-rkF.min);
+  for(int i = 0;i<96;i++)
+  {
+    double kF     = (i<48) ? 0.5*(-R[i]*(rkF.max-rkF.min)+rkF.min+rkF.max) :
+                             0.5*( R[i-48]*(rkF.max-rkF.min)+rkF.min+rkF.max);
+    double w      = hw*W[47-(i%48)];
+    double kkF    = kF*kF;
+    double E_p    = TMath::Sqrt(fmm_ini+kkF)-E_nuBIN;
+    double cosT_p = ((v-E_nuBIN)*(2*E_p+v+E_nuBIN)-qqv+fmm_ini-fmm_fin)/(2*kF*qv);           //\cos\theta_p
+    double pF     = TMath::Sqrt(kkF+(2*kF*qv)*cosT_p+qqv);
+    double b2_flux = (E_p-kF*cosT_k*cosT_p)*(E_p-kF*cosT_k*cosT_p);
+    double c2_flux = kkF*(1-cosT_p*cosT_p)*(1-cosT_k*cosT_k);
+    double factor = fk1*(fm_tar*kF/(FV_SM*qv*TMath::Sqrt(b2_flux-c2_flux)))*SmithMonizUtils::rho(P_Fermi, 0.0, kF)*(1-SmithMonizUtils::rho(P_Fermi, 0.01, pF));
+
+    double a2     = kkF/kNucleonMass2;
+    double a3     = a2*cosT_p*cosT_p;
+    double a6     = kF*cosT_p/kNucleonMass;
+    double a7     = E_p/kNucleonMass;
+    double a4     = a7*a7;
+    double a5     = 2*a7*a6;
+    double k4     = (3*a3-a2)/qqv;
+    double k5     = (a7-a6*k3)*fm_tar/kNucleonMass;
+
+    double f = w*factor;
+    resp[0] += f;
+    resp[1] += f*(a2-a3)*0.5;
+    resp[2] += f*((a2-a3)*Q2/(2*qqv)+a4-k3*(a5-k3*a3));
+    resp[3] += f*k5;
+    resp[4] += f*k4;
+    resp[5] += f*a6;
+    resp[6] += f*(a5/qv-v*k4);
+  }
+}
+//____________________________________________________________________________
+const SmithMonizResponseTable * SmithMonizQELCCPXSec::ResponseTable(
+                                    const Interaction * interaction) const
+{
+// The response table of the target nucleon of the input interaction, built
+// at the first request. Must be called once the target dependent members
+// have been set for the interaction.
+
+  const Target & target = interaction->InitState().Tgt();
+  std::pair<int,int> key(target.Pdg(), target.HitNucPdg());
+
+  std::lock_guard<std::mutex> lock(gResponseTablesLock);
+
+  std::map<std::pair<int,int>, SmithMonizResponseTable *>::const_iterator
+     it = fResponseTables.find(key);
+  if(it != fResponseTables.end()) return it->second;
+
+  LOG("SmithMoniz", pNOTICE)
+    << "Tabulating the nuclear responses of nucleon " << key.second
+    << " in target " << key.first;
+
+  SmithMonizResponseTable * table = new SmithMonizResponseTable(
+     fRespTableNQ, fRespTableQMax, fRespTableNV, fRespTableNC);
+
+  // the band of energy transfers of a Fermi gas nucleon, from the nucleon
+  // momenta antiparallel and parallel to q at the Fermi surface, with a
+  // safety margin
+  double E_nuBIN = sm_utils->GetBindingEnergy();
+  double P_Fermi = sm_utils->GetFermiMomentum();
+  double E_F     = TMath::Sqrt(fmm_ini+P_Fermi*P_Fermi);
+
+  double resp[SmithMonizResponseTable::kNResp];
+  for(int iq = 1; iq < table->NQ(); iq++) {
+    double qv   = table->Q(iq);
+    double vmin = E_nuBIN + TMath::Sqrt(fmm_fin+(qv-P_Fermi)*(qv-P_Fermi)) - E_F;
+    double vmax = E_nuBIN + TMath::Sqrt(fmm_fin+(qv+P_Fermi)*(qv+P_Fermi)) - E_F;
+    double dv   = 0.02*(vmax-vmin);
+    table->SetBand(iq, vmin-dv, vmax+dv);
+    for(int iv = 0; iv < table->NV(); iv++) {
+      double v  = table->V(iq,iv);
+      double Q2 = qv*qv-v*v;
+      for(int ic = 0; ic < table->NC(); ic++) {
+        this->NuclearResponses(Q2, v, table->CosThetaK(ic), resp);
+        table->Set(iq, iv, ic, resp);
+      }
+    }
+  }
+
+  fResponseTables.insert(
+     std::map<std::pair<int,int>, SmithMonizResponseTable *>::value_type(key, table));
+  return table;
+}
+//____________________________________________________________________________
+void SmithMonizQELCCPXSec::ClearResponseTables(void)
+{
+  std::lock_guard<std::mutex> lock(gResponseTablesLock);
+
+  std::map<std::pair<int,int>, SmithMonizResponseTable *>::iterator
+     it = fResponseTables.begin();
+  for( ; it != fResponseTables.end(); ++it) delete it->second;
+  fResponseTables.clear();
 }
 //____________________________________________________________________________
 double SmithMonizQELCCPXSec::dsQES_dQ2_SM(const Interaction * interaction) const
@@ -20,6 +20,10 @@
           based on code of Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk> \n
           University of Liverpool & STFC Rutherford Appleton Lab
 
+          The Fermi momentum integrals of the nuclear parts of the structure
+          functions can be tabulated per target nucleon (SM-UseResponseTable)
+          and interpolated, see SmithMonizResponseTable.
+
 \created  May 05, 2017
 
 \cpright  Copyright (c) 2003-2017, GENIE Neutrino MC Generator Collaboration
@@ -31,9 +35,13 @@
 #ifndef _SMITH_MONITZ_QELCC_CROSS_SECTION_H_
 #define _SMITH_MONITZ_QELCC_CROSS_SECTION_H_
 
+#include <map>
+#include <utility>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Physics/QuasiElastic/XSection/QELFormFactors.h"
 #include "Physics/QuasiElastic/XSection/SmithMonizUtils.h"
+#include "Physics/QuasiElastic/XSection/SmithMonizResponseTable.h"
 
 
 namespace genie {
@@ -62,9 +70,11 @@ private:
   mutable SmithMonizUtils * sm_utils;
   
   void   LoadConfig (void);
-  double d3sQES_dQ2dvdkF_SM (const Interaction * interaction) const;
   double dsQES_dQ2_SM(const Interaction * interaction) const;
   double d2sQES_dQ2dv_SM(const Interaction * i) const;
+  void   NuclearResponses(double Q2, double v, double cosT_k, double * resp) const;
+  const SmithMonizResponseTable * ResponseTable(const Interaction * i) const;
+  void   ClearResponseTables(void);
   
   double                       fXSecScale;        ///< external xsec scaling factor
   mutable QELFormFactors       fFormFactors;      
@@ -98,6 +108,13 @@ private:
   mutable double                       fW_3;
   mutable double                       fW_4;
   mutable double                       fW_5;
+
+  bool                                 fUseResponseTable;  ///< interpolate the tabulated nuclear responses?
+  int                                  fRespTableNQ;       ///< number of |q| nodes of the response tables
+  double                               fRespTableQMax;     ///< maximum |q| of the response tables (GeV)
+  int                                  fRespTableNV;       ///< number of energy transfer nodes per |q|
+  int                                  fRespTableNC;       ///< number of cos(theta_k) nodes
+  mutable std::map<std::pair<int,int>, SmithMonizResponseTable *> fResponseTables; ///< per (target, hit nucleon) pdg
    
   
 };
@@ -172,6 +172,7 @@ fInteraction(interaction)
 	AlgFactory * algf = AlgFactory::Instance();
     sm_utils = const_cast<genie::SmithMonizUtils *>(dynamic_cast<const genie::SmithMonizUtils *>(algf->GetAlgorithm("genie::SmithMonizUtils","Default")));
 	sm_utils->SetInteraction(interaction);
+	fQ2Lim = sm_utils->Q2QES_SM_lim();
 }
 //____________________________________________________________________________
 genie::utils::gsl::d2Xsec_dQ2dv::~d2Xsec_dQ2dv()
@@ -193,7 +194,7 @@ double genie::utils::gsl::d2Xsec_dQ2dv::DoEval(const double * xin) const
 //   differential cross section [10^-38 cm^2]
 //
  
-  Range1D_t rQ2 = sm_utils->Q2QES_SM_lim();
+  const Range1D_t & rQ2 = fQ2Lim;
   double Q2     = (rQ2.max-rQ2.min)*xin[0]+rQ2.min;
   Range1D_t rv  = sm_utils->vQES_SM_lim(Q2);
   double v      = (rv.max-rv.min)*xin[1]+rv.min;
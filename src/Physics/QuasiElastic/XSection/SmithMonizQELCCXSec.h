@@ -86,6 +86,7 @@ private:
 	  const XSecAlgorithmI * fModel;
       const Interaction *    fInteraction;
 	  mutable SmithMonizUtils * sm_utils;
+      Range1D_t              fQ2Lim;  ///< Q2 limits at the (fixed) energy of the interaction
    };
    
 
@@ -0,0 +1,121 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/QuasiElastic/XSection/SmithMonizResponseTable.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+const int SmithMonizResponseTable::kNResp;
+//____________________________________________________________________________
+SmithMonizResponseTable::SmithMonizResponseTable() :
+fNQ(0),
+fNV(0),
+fNC(0),
+fDQ(0)
+{
+
+}
+//____________________________________________________________________________
+SmithMonizResponseTable::SmithMonizResponseTable(
+   int nq, double qmax, int nv, int nc)
+{
+  if(nq < 2 || nv < 2 || nc < 1 || qmax <= 0) {
+    LOG("SmithMoniz", pFATAL)
+      << "Invalid response table: " << nq << " |q| in [0, " << qmax
+      << "] GeV, " << nv << " v, " << nc << " cos(theta_k)";
+    exit(1);
+  }
+  fNQ = nq;
+  fNV = nv;
+  fNC = nc;
+  fDQ = qmax / (nq-1);
+  fVMin.assign(nq, 0.);
+  fVMax.assign(nq, 0.);
+  fValues.assign(kNResp * nq * nv * nc, 0.);
+}
+//____________________________________________________________________________
+SmithMonizResponseTable::~SmithMonizResponseTable()
+{
+
+}
+//____________________________________________________________________________
+double SmithMonizResponseTable::V(int iq, int iv) const
+{
+  return fVMin[iq] + (fVMax[iq] - fVMin[iq]) * iv / (fNV-1);
+}
+//____________________________________________________________________________
+void SmithMonizResponseTable::SetBand(int iq, double vmin, double vmax)
+{
+  fVMin[iq] = vmin;
+  fVMax[iq] = TMath::Max(vmax, vmin);
+}
+//____________________________________________________________________________
+void SmithMonizResponseTable::Set(int iq, int iv, int ic, const double * resp)
+{
+  double * node = &fValues[kNResp * ((iq * fNV + iv) * fNC + ic)];
+  for(int i = 0; i < kNResp; i++) node[i] = resp[i];
+}
+//____________________________________________________________________________
+const double * SmithMonizResponseTable::Node(int iq, int iv, int ic) const
+{
+  return &fValues[kNResp * ((iq * fNV + iv) * fNC + ic)];
+}
+//____________________________________________________________________________
+bool SmithMonizResponseTable::Evaluate(
+    double qv, double v, double cosk, double * resp) const
+{
+  if(fNQ == 0 || qv < 0 || qv > fDQ * (fNQ-1)) return false;
+
+  for(int i = 0; i < kNResp; i++) resp[i] = 0;
+
+  double tq = qv / fDQ;
+  int    iq = TMath::Min((int) tq, fNQ-2);
+  double wq = tq - iq;
+
+  // position within the band, interpolated between the two |q| nodes
+  double vmin = (1-wq) * fVMin[iq] + wq * fVMin[iq+1];
+  double vmax = (1-wq) * fVMax[iq] + wq * fVMax[iq+1];
+  if(vmax <= vmin || v < vmin || v > vmax) return true;
+
+  double tv = (v - vmin) / (vmax - vmin) * (fNV-1);
+  int    iv = TMath::Min((int) tv, fNV-2);
+  double wv = tv - iv;
+
+  int    ic = 0;
+  double wc = 0;
+  if(fNC > 1) {
+    double tc = TMath::Min(TMath::Max(cosk, 0.), 1.) * (fNC-1);
+    ic = TMath::Min((int) tc, fNC-2);
+    wc = tc - ic;
+  }
+  int dc = (fNC > 1) ? 1 : 0;
+
+  for(int jq = 0; jq < 2; jq++) {
+    for(int jv = 0; jv < 2; jv++) {
+      for(int jc = 0; jc <= dc; jc++) {
+        double w = (jq ? wq : 1-wq) * (jv ? wv : 1-wv) * (jc ? wc : 1-wc);
+        if(w == 0) continue;
+        const double * node = this->Node(iq+jq, iv+jv, ic+jc);
+        for(int i = 0; i < kNResp; i++) resp[i] += w * node[i];
+      }
+    }
+  }
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,77 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::SmithMonizResponseTable
+
+\brief    Table of the Smith-Moniz Fermi gas nuclear response integrals of
+          one target nucleon, as a function of the momentum transfer |q|,
+          the energy transfer v and the cosine of the angle between q and
+          the neutrino momentum, on which the nucleon flux factor depends.
+
+          The |q| nodes are equally spaced in [0, qmax]. At each |q| the v
+          nodes span the band of energy transfers which a Fermi gas nucleon
+          can absorb, outside of which the responses vanish; the band moves
+          with |q| and the interpolation follows it, so that the resolution
+          is spent where the quasi-elastic peak is. The interpolation is
+          linear in each variable.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _SMITH_MONIZ_RESPONSE_TABLE_H_
+#define _SMITH_MONIZ_RESPONSE_TABLE_H_
+
+#include <vector>
+
+namespace genie {
+
+class SmithMonizResponseTable {
+
+public:
+  //! number of response integrals per node
+  static const int kNResp = 7;
+
+  SmithMonizResponseTable();
+  SmithMonizResponseTable(int nq, double qmax, int nv, int nc);
+ ~SmithMonizResponseTable();
+
+  int    NQ        (void) const { return fNQ; }
+  int    NV        (void) const { return fNV; }
+  int    NC        (void) const { return fNC; }
+
+  //! The |q|, v and cos(theta_k) of the nodes
+  double Q         (int iq)         const { return iq * fDQ; }
+  double V         (int iq, int iv) const;
+  double CosThetaK (int ic)         const { return (fNC > 1) ? double(ic) / (fNC-1) : 1.; }
+
+  //! Set the band of energy transfers of the nodes at |q| node iq
+  void   SetBand   (int iq, double vmin, double vmax);
+  //! Set the responses at node (iq,iv,ic)
+  void   Set       (int iq, int iv, int ic, const double * resp);
+
+  //! Interpolate the responses at (|q|,v,cos(theta_k)); false if |q| is
+  //! outside of the table
+  bool   Evaluate  (double qv, double v, double cosk, double * resp) const;
+
+private:
+  const double * Node (int iq, int iv, int ic) const;
+
+  int                 fNQ;
+  int                 fNV;
+  int                 fNC;
+  double              fDQ;
+  std::vector<double> fVMin;    ///< lower edge of the v band per |q| node
+  std::vector<double> fVMax;    ///< upper edge of the v band per |q| node
+  std::vector<double> fValues;  ///< kNResp responses per node, |q|-major
+};
+
+}        // genie namespace
+
+#endif   // _SMITH_MONIZ_RESPONSE_TABLE_H_
@@ -45,13 +45,15 @@ using std::ostringstream;
 
 //____________________________________________________________________________
 SmithMonizUtils::SmithMonizUtils() :
-Algorithm("genie::SmithMonizUtils")
+Algorithm("genie::SmithMonizUtils"),
+fTgtSet(false)
 {
 
 }
 //____________________________________________________________________________
 SmithMonizUtils::SmithMonizUtils(string config) :
-Algorithm("genie::SmithMonizUtils", config)
+Algorithm("genie::SmithMonizUtils", config),
+fTgtSet(false)
 {
 
 }
@@ -80,6 +82,8 @@ void SmithMonizUtils::LoadConfig(void)
         GetParam( "FermiMomentumTable", fKFTable);
         GetParam( "RFG-UseParametrization", fUseParametrization);
 
+        fTgtSet = false;
+        fNucRmvE.clear();
 
         // Load removal energy for specific nuclei from either the algorithm's
         // configuration file or the UserPhysicsOptions file.
@@ -122,6 +126,15 @@ void SmithMonizUtils::SetInteraction(const Interaction * interaction)
         E_nu = interaction->InitState().ProbeE(kRfLab);         //  Neutrino energy (GeV)
 
         assert(target.HitNucIsSet());
+
+        // The rest only depends on the probe, target and hit nucleon: skip
+        // the look-ups if they are those of the previous call
+        int codes[3] = { init_state.ProbePdg(), target.Pdg(), target.HitNucPdg() };
+        if(fTgtSet && codes[0] == fTgtCodes[0] &&
+           codes[1] == fTgtCodes[1] && codes[2] == fTgtCodes[2]) return;
+        fTgtSet = true;
+        for(int i = 0; i < 3; i++) fTgtCodes[i] = codes[i];
+
         // get lepton&nuclear masses (init & final state nucleus)
         m_lep = interaction->FSPrimLepton()->Mass();          //  Mass of final charged lepton (GeV)
         mm_lep     = TMath::Power(m_lep,    2);
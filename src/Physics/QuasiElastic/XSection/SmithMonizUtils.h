@@ -110,6 +110,11 @@ private:
 		double					     P_Fermi;           ///<  Maximum value of Fermi momentum of target nucleon (GeV)
 		double                       E_BIN;             ///<  Binding energy (GeV)
 mutable	double                       Enu_in;            ///<  Running neutrino energy (GeV)
+
+		// Codes of the probe, target and hit nucleon the masses, Fermi momentum
+		// and binding energy above were looked up for
+		bool                         fTgtSet;
+		int                          fTgtCodes[3];
 		
      
 };
@@ -29,13 +29,17 @@ using namespace genie;
 
 //____________________________________________________________________________
 ZExpAxialFormFactorModel::ZExpAxialFormFactorModel() :
-AxialFormFactorModelI("genie::ZExpAxialFormFactorModel")
+AxialFormFactorModelI("genie::ZExpAxialFormFactorModel"),
+fNCoeffs(0),
+fZ_An(0)
 {
 
 }
 //____________________________________________________________________________
 ZExpAxialFormFactorModel::ZExpAxialFormFactorModel(string config) :
-AxialFormFactorModelI("genie::ZExpAxialFormFactorModel", config)
+AxialFormFactorModelI("genie::ZExpAxialFormFactorModel", config),
+fNCoeffs(0),
+fZ_An(0)
 {
 
 }
@@ -55,10 +59,11 @@ double ZExpAxialFormFactorModel::FA(const Interaction * interaction) const
     LOG("ZExpAxialFormFactorModel",pWARN) << "Undefined expansion parameter";
     return 0.;
   }
+  // sum the expansion with Horner's rule
   double fa = 0.;
-  for (int ki=0;ki<=fKmax+(fQ4limit ? 4 : 0);ki++)
+  for (int ki=fNCoeffs-1;ki>=0;ki--)
   {
-    fa = fa + TMath::Power(zparam,ki) * fZ_An[ki];
+    fa = fa * zparam + fZ_An[ki];
   }
 
   return fa;
@@ -68,8 +73,9 @@ double ZExpAxialFormFactorModel::CalculateZ(double q2) const
 {
 
   // calculate z expansion parameter
-  double znum  = TMath::Sqrt(fTcut - q2) - TMath::Sqrt(fTcut - fT0);
-  double zden  = TMath::Sqrt(fTcut - q2) + TMath::Sqrt(fTcut - fT0);
+  double sqtq  = TMath::Sqrt(fTcut - q2);
+  double znum  = sqtq - fSqrtTcutT0;
+  double zden  = sqtq + fSqrtTcutT0;
 
   return znum/zden;
 }
@@ -229,9 +235,12 @@ void ZExpAxialFormFactorModel::LoadConfig(void)
   GetParam( "QEL-FA0", fFA0 ) ;
   assert(fKmax > 0);
 
+  fSqrtTcutT0 = TMath::Sqrt(fTcut - fT0);
+
   // z expansion coefficients
-  if (fQ4limit) fZ_An = new double [fKmax+5];
-  else          fZ_An = new double [fKmax+1];
+  delete[] fZ_An;
+  fNCoeffs = (fQ4limit) ? fKmax+5 : fKmax+1;
+  fZ_An    = new double [fNCoeffs];
 
   // load the user-defined coefficient values
   // -- A0 and An for n<fKmax are calculated from other means
@@ -59,6 +59,8 @@ private:
   double fT0;
   double fTcut;
   double fFA0;
+  double fSqrtTcutT0;  ///< sqrt(fTcut - fT0)
+  int    fNCoeffs;     ///< number of expansion terms (fKmax+1, or fKmax+5 with the Q4 limit)
   //double fZ_An[11];
   double* fZ_An;
 };
@@ -24,6 +24,8 @@
    is set to the event, set the corresponding KinePhaseSpace_t value too.
  @ Jul 26, 2018 - IL (Afroditi Papadopoulou, Adi Ashkenazi - Massachusetts Institute of Technology)
    Included importance sampling envelop both for neutrino and electron scattering
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The envelope is sampled under the ProcessGeneratorLock (gRandom).
 */
 //____________________________________________________________________________
 
@@ -43,6 +45,7 @@
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
@@ -134,6 +137,7 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
          LOG("RESKinematics", pWARN)
               << "*** Could not select a valid (W,Q^2) pair after "
                                                     << iter << " iterations";
+         this->CountKineThrows(interaction, iter, false);
          evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
          genie::exceptions::EVGThreadException exception;
          exception.SetReason("Couldn't select kinematics");
@@ -207,8 +211,11 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
             fEnvelope->SetParameter(3,  W.max);             // kinematically allowed Wmax
          }// first pass
 
-         // Generate W,QD2 using the 2-D envelope as PDF
-         fEnvelope->GetRandom2(gQD2,gW);
+         // Generate W,QD2 using the 2-D envelope as PDF (draws from gRandom)
+         {
+           ProcessGeneratorLock lock;
+           fEnvelope->GetRandom2(gQD2,gW);
+         }
 
          // QD2 -> Q2
          gQ2 = utils::kinematics::QD2toQ2(gQD2);
@@ -253,6 +260,7 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->CountKineThrows(interaction, iter, true);
         LOG("RESKinematics", pINFO)
                             << "Selected: W = " << gW << ", Q2 = " << gQ2;
         // reset 'trust' bits
@@ -312,6 +320,9 @@ void RESKinematicsGenerator::LoadConfig(void)
   // Safety factor for the maximum differential cross section
   this->GetParamDef("MaxXSec-SafetyFactor", fSafetyFactor, 1.25);
 
+  // Tighten the max xsec online (adaptive safety factor)?
+  this->LoadAdaptiveSafetyFactorConfig();
+
   // Minimum energy for which max xsec would be cached, forcing explicit
   // calculation for lower eneries
   this->GetParamDef("Cache-MinEnergy", fEMin, 0.5);
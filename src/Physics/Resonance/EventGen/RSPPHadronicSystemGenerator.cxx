@@ -15,6 +15,9 @@
    performed further upstream in the processing chain.
  @ Mar 03, 2009 - CA
    Moved into the new RES package from its previous location (EVGModules).
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The phase space decay is generated under the ProcessGeneratorLock
+   (gRandom).
 
 */
 //____________________________________________________________________________
@@ -26,6 +29,7 @@
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Interaction/SppChannel.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/ProcessGeneratorLock.h"
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -99,15 +103,19 @@ void RSPPHadronicSystemGenerator::AddResonanceDecayProducts(
 
   double mass[2] = { mnuc, mpi };
 
-  TLorentzVector * p4 = res->GetP4();
+  TLorentzVector p4 = res->Momentum();
 
   LOG("RESHadronicVtx", pINFO)
-                 << "\n RES 4-P = " << utils::print::P4AsString(p4);
+                 << "\n RES 4-P = " << utils::print::P4AsString(&p4);
 
-  bool is_permitted = fPhaseSpaceGenerator.SetDecay(*p4, 2, mass);
+  bool is_permitted = fPhaseSpaceGenerator.SetDecay(p4, 2, mass);
   assert(is_permitted);
 
-  fPhaseSpaceGenerator.Generate();
+  {
+    // TGenPhaseSpace draws from gRandom
+    ProcessGeneratorLock lock;
+    fPhaseSpaceGenerator.Generate();
+  }
 
   //-- add the two hadrons at the event record
   TLorentzVector & p4_nuc = *fPhaseSpaceGenerator.GetDecay(0);
@@ -120,7 +128,6 @@ void RSPPHadronicSystemGenerator::AddResonanceDecayProducts(
   int mom = res_pos;
   evrec->AddParticle(nuc_pdgc, ist, mom,-1,-1,-1, p4_nuc, x4);
   evrec->AddParticle(pi_pdgc,  ist, mom,-1,-1,-1, p4_pi,  x4);
-  delete p4;
 }
 //___________________________________________________________________________
 
@@ -14,6 +14,9 @@
    Moved into the new RES package from its previous location (EVGModules).
  @ Jul 23, 2010 - CA
    Use ResonanceCharge() from base class. Function removed from utils::res.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Re-use the single resonance cross sections computed by ReinSehgalSPPPXSec
+   at the generated kinematics, if available, rather than computing them.
 
 */
 //____________________________________________________________________________
@@ -34,6 +37,7 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Physics/Resonance/EventGen/RSPPResonanceSelector.h"
+#include "Physics/Resonance/XSection/ReinSehgalSPPPXSec.h"
 
 using std::vector;
 using std::ostringstream;
@@ -98,11 +102,25 @@ Resonance_t RSPPResonanceSelector::SelectResonance(GHepRecord * evrec) const
   const EventGeneratorI * evg = rtinfo->RunningThread();
   const XSecAlgorithmI * xsecalg = evg->CrossSectionAlg();
 
+  //-- The SPP cross section algorithm keeps the single resonance cross
+  //   sections it summed at the last kinematics it was called for: these
+  //   are the selected kinematics, unless the kinematics generator went on
+  //   to call it elsewhere
+  unsigned int nres = fResList.NResonances();
+  vector<double> cached_xsec;
+  const ReinSehgalSPPPXSec * sppxsecalg =
+                    dynamic_cast<const ReinSehgalSPPPXSec *> (xsecalg);
+  bool use_cached = sppxsecalg && sppxsecalg->ResXSecAtLastKinematics(
+                     interaction, kPSWQ2fE, fResList, cached_xsec);
+  if(use_cached) {
+     LOG("RESSelector", pINFO)
+       << "Using the resonance cross sections cached at the selected kinematics";
+  }
+
   //-- Loop over all considered baryon resonances and compute the double
   //   differential cross section for the selected kinematical variables
 
   double xsec_sum  = 0;
-  unsigned int nres = fResList.NResonances();
   vector<double> xsec_vec(nres);
 
   for(unsigned int ires = 0; ires < nres; ires++) {
@@ -113,12 +131,16 @@ Resonance_t RSPPResonanceSelector::SelectResonance(GHepRecord * evrec) const
      //-- Set the current resonance at the interaction summary
      //   compute the differential cross section d^2xsec/dWdQ^2
      //   (do it only for resonances that can conserve charge)
-     interaction->ExclTagPtr()->SetResonance(res);
-
      double xsec = 0;
      bool   skip = (q_res==2 && !utils::res::IsDelta(res));
 
-     if(!skip) xsec = xsecalg->XSec(interaction,kPSWQ2fE);
+     if(!skip) {
+       if(use_cached) xsec = cached_xsec[ires];
+       else {
+         interaction->ExclTagPtr()->SetResonance(res);
+         xsec = xsecalg->XSec(interaction,kPSWQ2fE);
+       }
+     }
      else {
        SLOG("RESSelector", pNOTICE)
                  << "RES: " << utils::res::AsString(res)
@@ -16,10 +16,22 @@
  @ July 4, 2018 - Afroditi Papadopoulou
    For electromagnetic (EM) interactions, the weak g2 was still used for the
    calculation of the helicity amplitude. Fixed by replacing with the correct EM g2
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Split XSec() in the resonance independent factors (kinematics, KLN/BRS
+   lepton currents, Jacobian, Pauli blocking) and the resonance part, and
+   added FusedXSec() evaluating a list of resonances at one kinematical point
+   with the shared factors computed once. The Fermi momentum used for the
+   Pauli blocking is looked up once per target and hit nucleon (per thread).
+   Added the option to use the tabulated Breit-Wigner function (see
+   BreitWignerTable).
+   Added IntegralBatch(), handing the knots of a spline to the integrator
+   as a batch.
 
 */
 //____________________________________________________________________________
 
+#include <atomic>
+
 #include <TMath.h>
 #include <TSystem.h>
 
@@ -50,15 +62,21 @@
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // unique configuration ids (see the Fermi momentum look-up in XSec())
+  std::atomic<unsigned long> gBSKLNConfigIds(0);
+}
 //____________________________________________________________________________
 BSKLNBaseRESPXSec2014::BSKLNBaseRESPXSec2014(string name) :
-XSecAlgorithmI(name)
+XSecAlgorithmI(name),
+fConfigId(0)
 {
 
 }
 //____________________________________________________________________________
 BSKLNBaseRESPXSec2014::BSKLNBaseRESPXSec2014(string name, string config) :
-XSecAlgorithmI(name, config)
+XSecAlgorithmI(name, config),
+fConfigId(0)
 {
 
 }
@@ -74,6 +92,44 @@ double BSKLNBaseRESPXSec2014::XSec(
   if(! this -> ValidProcess    (interaction) ) return 0.;
   if(! this -> ValidKinematics (interaction) ) return 0.;
 
+  KineFactors kf;
+  if(! this->ComputeKineFactors(interaction, kps, kf) ) return 0.;
+
+  // Get the input baryon resonance
+  Resonance_t resonance = interaction->ExclTag().Resonance();
+
+  double xsec = this->ResonanceXSec(resonance, kf);
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("BSKLNBaseRESPXSec2014", pINFO)
+      << "\n d2xsec/dQ2dW"  << "[" << interaction->AsString()
+      << "](W=" << kf.W << ", q2=" << kf.q2 << ", E=" << kf.E << ") = " << xsec;
+#endif
+
+  return xsec;
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::FusedXSec(
+    const Interaction * interaction, KinePhaseSpace_t kps,
+    const BaryonResList & resonances, double * xsec) const
+{
+  unsigned int nres = resonances.NResonances();
+  for(unsigned int ires = 0; ires < nres; ires++) xsec[ires] = 0.;
+
+  if(! this -> ValidProcess    (interaction) ) return;
+  if(! this -> ValidKinematics (interaction) ) return;
+
+  KineFactors kf;
+  if(! this->ComputeKineFactors(interaction, kps, kf) ) return;
+
+  for(unsigned int ires = 0; ires < nres; ires++) {
+    xsec[ires] = this->ResonanceXSec(resonances.ResonanceId(ires), kf);
+  }
+}
+//____________________________________________________________________________
+bool BSKLNBaseRESPXSec2014::ComputeKineFactors(
+    const Interaction * interaction, KinePhaseSpace_t kps, KineFactors & kf) const
+{
   const InitialState & init_state = interaction -> InitState();
   const ProcessInfo &  proc_info  = interaction -> ProcInfo();
   const Target & target = init_state.Tgt();
@@ -92,15 +148,10 @@ double BSKLNBaseRESPXSec2014::XSec(
         << "RES/DIS Join Scheme: XSec[RES, W=" << W
         << " >= Wcut=" << fWcut << "] = 0";
 #endif
-      return 0;
+      return false;
     }
   }
 
-  // Get the input baryon resonance
-  Resonance_t resonance = interaction->ExclTag().Resonance();
-  string      resname   = utils::res::AsString(resonance);
-  bool        is_delta  = utils::res::IsDelta (resonance);
-
   // Get the neutrino, hit nucleon & weak current
   int  nucpdgc   = target.HitNucPdg();
   int  probepdgc = init_state.ProbePdg();
@@ -117,27 +168,6 @@ double BSKLNBaseRESPXSec2014::XSec(
   //  bool new_GV = fGA; //JN
   //  bool new_GA = fGV; //JN
 
-
-  if(is_CC && !is_delta) {
-    if((is_nu && is_p) || (is_nubar && is_n)) return 0;
-  }
-
-  // Get baryon resonance parameters
-  int    IR  = utils::res::ResonanceIndex    (resonance);
-  int    LR  = utils::res::OrbitalAngularMom (resonance);
-  double MR  = utils::res::Mass              (resonance);
-  double WR  = utils::res::Width             (resonance);
-   double NR  = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
-
-  // Following NeuGEN, avoid problems with underlying unphysical
-  // model assumptions by restricting the allowed W phase space
-  // around the resonance peak
- if (fNormBW) {
-        if      (W > MR + fN0ResMaxNWidths * WR && IR==0) return 0.;
-        else if (W > MR + fN2ResMaxNWidths * WR && IR==2) return 0.;
-        else if (W > MR + fGnResMaxNWidths * WR)          return 0.;
-  }
-
   // Compute auxiliary & kinematical factors
   double E      = init_state.ProbeE(kRfHitNucRest);
   double Mnuc   = target.HitNucMass();
@@ -287,6 +317,225 @@ double BSKLNBaseRESPXSec2014::XSec(
     << "Kinematical params V = " << V << ", U = " << U;
 #endif
 
+  // These lines were ~ 100 lines below, which means that, for EM interactions, the coefficients below were still calculated using the weak coupling constant - Afro
+  double g2 = kGF2;
+
+  // For EM interaction replace  G_{Fermi} with :
+  // a_{em} * pi / ( sqrt(2) * sin^2(theta_weinberg) * Mass_{W}^2 }
+  // See C.Quigg, Gauge Theories of the Strong, Weak and E/M Interactions,
+  // ISBN 0-8053-6021-2, p.112 (6.3.57)
+  // Also, take int account that the photon propagator is 1/p^2 but the
+  // W propagator is 1/(p^2-Mass_{W}^2), so weight the EM case with
+  // Mass_{W}^4 / q^4
+  // So, overall:
+  // G_{Fermi}^2 --> a_{em}^2 * pi^2 / (2 * sin^4(theta_weinberg) * q^{4})
+  //
+
+  if(is_EM) {
+    double q4 = q2*q2;
+    g2 = kAem2 * kPi2 / (2.0 * fSin48w * q4);
+  }
+
+  if(is_CC) g2 = kGF2*fVud2;
+
+  kf.is_nu     = is_nu;
+  kf.is_nubar  = is_nubar;
+  kf.is_lplus  = is_lplus;
+  kf.is_lminus = is_lminus;
+  kf.is_p      = is_p;
+  kf.is_n      = is_n;
+  kf.is_CC     = is_CC;
+  kf.is_NC     = is_NC;
+  kf.is_EM     = is_EM;
+  kf.is_KLN    = is_KLN;
+  kf.is_BRS    = is_BRS;
+
+  kf.E     = E;
+  kf.W     = W;
+  kf.W2    = W2;
+  kf.q2    = q2;
+  kf.Q2    = Q2;
+  kf.Q     = Q;
+  kf.Mnuc  = Mnuc;
+  kf.Mnuc2 = Mnuc2;
+  kf.U2    = U2;
+  kf.V2    = V2;
+  kf.UV    = UV;
+  kf.vstar = vstar;
+  kf.Qstar = Qstar;
+  kf.a     = a;
+
+  kf.KNL_Alambda_plus  = KNL_Alambda_plus;
+  kf.KNL_Alambda_minus = KNL_Alambda_minus;
+  kf.KNL_Qstar_plus    = KNL_Qstar_plus;
+  kf.KNL_Qstar_minus   = KNL_Qstar_minus;
+  kf.KNL_vstar_plus    = KNL_vstar_plus;
+  kf.KNL_vstar_minus   = KNL_vstar_minus;
+  kf.KNL_cL_plus       = KNL_cL_plus;
+  kf.KNL_cL_minus      = KNL_cL_minus;
+  kf.KNL_cR_plus       = KNL_cR_plus;
+  kf.KNL_cR_minus      = KNL_cR_minus;
+  kf.KNL_cS_plus       = KNL_cS_plus;
+  kf.KNL_cS_minus      = KNL_cS_minus;
+
+  kf.sig0 = 0.125*(g2/kPi)*(-q2/Q2)*(W/Mnuc);
+  kf.scLR = W/Mnuc;
+  kf.scS  = (Mnuc/W)*(-Q2/q2);
+
+  // The algorithm computes d^2xsec/dWdQ2
+  // Check whether variable tranformation is needed
+  kf.J = 1.0;
+  if ( kps != kPSWQ2fE ) {
+     kf.J = utils::kinematics::Jacobian(interaction,kPSWQ2fE,kps);
+  }
+
+  // Apply given scaling factor
+  kf.scale = 1.0;
+  if      (is_CC) { kf.scale = fXSecScaleCC; }
+  else if (is_NC) { kf.scale = fXSecScaleNC; }
+
+  // If requested return the free nucleon xsec even for input nuclear tgt
+  kf.free_nucleon = interaction->TestBit(kIAssumeFreeNucleon);
+  kf.NNucl        = 1;
+  kf.pauli        = 1.0;
+  if ( kf.free_nucleon ) return true;
+
+  int Z = target.Z();
+  int A = target.A();
+  int N = A-Z;
+
+  // Take into account the number of scattering centers in the target
+  kf.NNucl = (is_p) ? Z : N;
+
+  if ( fUsePauliBlocking && A!=1 )
+  {
+    // Calculation of Pauli blocking according references:
+    //
+    //     [1] S.L. Adler,  S. Nussinov,  and  E.A.  Paschos,  "Nuclear
+    //         charge exchange corrections to leptonic pion  production
+    //         in  the (3,3) resonance  region,"  Phys. Rev. D 9 (1974)
+    //         2125-2143 [Erratum Phys. Rev. D 10 (1974) 1669].
+    //     [2] J.Y. Yu, "Neutrino interactions and  nuclear  effects in
+    //         oscillation experiments and the  nonperturbative disper-
+    //         sive  sector in strong (quasi-)abelian  fields,"  Ph. D.
+    //         Thesis, Dortmund U., Dortmund, 2002 (unpublished).
+    //     [3] E.A. Paschos, J.Y. Yu,  and  M. Sakuda,  "Neutrino  pro-
+    //         duction  of  resonances,"  Phys. Rev. D 69 (2004) 014013
+    //         [arXiv: hep-ph/0308130].
+
+    // Maximum value of Fermi momentum of target nucleon (GeV),
+    // looked up once per target and hit nucleon by the calling thread (the
+    // algorithm is shared by the event generation threads; configurations
+    // have unique ids)
+    static thread_local unsigned long last_id     = 0;
+    static thread_local int           last_tgtpdg = 0;
+    static thread_local int           last_nucpdg = 0;
+    static thread_local double        last_pfermi = 0.;
+
+    int tgtpdgc = target.Pdg();
+    if ( last_id != fConfigId ||
+         tgtpdgc != last_tgtpdg || nucpdgc != last_nucpdg )
+    {
+      double P_Fermi = 0.0;
+      if ( A<6 || ! fUseRFGParametrization )
+      {
+        // look up the Fermi momentum for this target
+        FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
+        const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
+        P_Fermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
+      }
+      else {
+        // define the Fermi momentum for this target
+        P_Fermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
+        // correct the Fermi momentum for the struck nucleon
+        if(is_p) { P_Fermi *= TMath::Power( 2.*Z/A, 1./3); }
+        else     { P_Fermi *= TMath::Power( 2.*N/A, 1./3); }
+      }
+      last_id     = fConfigId;
+      last_tgtpdg = tgtpdgc;
+      last_nucpdg = nucpdgc;
+      last_pfermi = P_Fermi;
+    }
+    double P_Fermi = last_pfermi;
+
+     double FactorPauli_RES = 1.0;
+
+     double k0 = 0., q = 0., q0 = 0.;
+
+     if (P_Fermi > 0.)
+     {
+        k0 = (W2-Mnuc2-Q2)/(2*W);
+        k = TMath::Sqrt(k0*k0+Q2);  // previous value of k is overridden
+        q0 = (W2-Mnuc2+kPionMass2)/(2*W);
+        q = TMath::Sqrt(q0*q0-kPionMass2);
+     }
+
+     if ( 2*P_Fermi < k-q )
+        FactorPauli_RES = 1.0;
+     if ( 2*P_Fermi >= k+q )
+        FactorPauli_RES = ((3*k*k+q*q)/(2*P_Fermi)-(5*TMath::Power(k,4)+TMath::Power(q,4)+10*k*k*q*q)/(40*TMath::Power(P_Fermi,3)))/(2*k);
+     if ( 2*P_Fermi >= k-q && 2*P_Fermi <= k+q )
+        FactorPauli_RES = ((q+k)*(q+k)-4*P_Fermi*P_Fermi/5-TMath::Power(k-q, 3)/(2*P_Fermi)+TMath::Power(k-q, 5)/(40*TMath::Power(P_Fermi, 3)))/(4*q*k);
+
+     kf.pauli = FactorPauli_RES;
+  }
+  return true;
+}
+//____________________________________________________________________________
+double BSKLNBaseRESPXSec2014::ResonanceXSec(
+    Resonance_t resonance, const KineFactors & kf) const
+{
+  string      resname   = utils::res::AsString(resonance);
+  bool        is_delta  = utils::res::IsDelta (resonance);
+
+  bool is_nu     = kf.is_nu;
+  bool is_nubar  = kf.is_nubar;
+  bool is_lplus  = kf.is_lplus;
+  bool is_lminus = kf.is_lminus;
+  bool is_p      = kf.is_p;
+  bool is_n      = kf.is_n;
+  bool is_CC     = kf.is_CC;
+  bool is_NC     = kf.is_NC;
+  bool is_EM     = kf.is_EM;
+  bool is_KLN    = kf.is_KLN;
+  bool is_BRS    = kf.is_BRS;
+
+  double W     = kf.W;
+  double W2    = kf.W2;
+  double q2    = kf.q2;
+  double Q2    = kf.Q2;
+  double Q     = kf.Q;
+  double Mnuc  = kf.Mnuc;
+  double Mnuc2 = kf.Mnuc2;
+  double vstar = kf.vstar;
+  double Qstar = kf.Qstar;
+  double a     = kf.a;
+
+  double KNL_Qstar_plus  = kf.KNL_Qstar_plus;
+  double KNL_Qstar_minus = kf.KNL_Qstar_minus;
+  double KNL_vstar_plus  = kf.KNL_vstar_plus;
+  double KNL_vstar_minus = kf.KNL_vstar_minus;
+
+  if(is_CC && !is_delta) {
+    if((is_nu && is_p) || (is_nubar && is_n)) return 0;
+  }
+
+  // Get baryon resonance parameters
+  int    IR  = utils::res::ResonanceIndex    (resonance);
+  int    LR  = utils::res::OrbitalAngularMom (resonance);
+  double MR  = utils::res::Mass              (resonance);
+  double WR  = utils::res::Width             (resonance);
+   double NR  = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
+
+  // Following NeuGEN, avoid problems with underlying unphysical
+  // model assumptions by restricting the allowed W phase space
+  // around the resonance peak
+ if (fNormBW) {
+        if      (W > MR + fN0ResMaxNWidths * WR && IR==0) return 0.;
+        else if (W > MR + fN2ResMaxNWidths * WR && IR==2) return 0.;
+        else if (W > MR + fGnResMaxNWidths * WR)          return 0.;
+  }
+
   // Calculate the Feynman-Kislinger-Ravndall parameters
 
   double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
@@ -334,20 +583,21 @@ double BSKLNBaseRESPXSec2014::XSec(
   double nomg   = IR * fOmega;
   double mq_w   = Mnuc*Q/W;
 
-  fFKR.Lamda  = sq2omg * mq_w;
-  fFKR.Tv     = GV / (3.*W*sq2omg);
-  fFKR.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
-  fFKR.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
-  fFKR.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
-  fFKR.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
-  fFKR.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
-  fFKR.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
-  fFKR.R      = fFKR.Rv;
-  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
-  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
-  fFKR.T      = fFKR.Tv;
-  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
-  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
+  FKR fkr; // the FKR parameters at this kinematical point
+  fkr.Lamda  = sq2omg * mq_w;
+  fkr.Tv     = GV / (3.*W*sq2omg);
+  fkr.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
+  fkr.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
+  fkr.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
+  fkr.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
+  fkr.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
+  fkr.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
+  fkr.R      = fkr.Rv;
+  fkr.Rplus  = - (fkr.Rv + fkr.Ra);
+  fkr.Rminus = - (fkr.Rv - fkr.Ra);
+  fkr.T      = fkr.Tv;
+  fkr.Tplus  = - (fkr.Tv + fkr.Ta);
+  fkr.Tminus = - (fkr.Tv - fkr.Ta);
 
   //JN KNL
   double KNL_S_plus = 0;
@@ -361,11 +611,11 @@ double BSKLNBaseRESPXSec2014::XSec(
     KNL_S_plus  = (KNL_vstar_plus*vstar  - KNL_Qstar_plus *Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2; //possibly missing minus sign ()
     KNL_S_minus = (KNL_vstar_minus*vstar - KNL_Qstar_minus*Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2;
 
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fFKR.S;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fkr.S;
 
     KNL_B_plus  = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_plus  + KNL_vstar_plus *Qstar/a/Mnuc ) * GA;
     KNL_B_minus = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_minus + KNL_vstar_minus*Qstar/a/Mnuc ) * GA;
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fFKR.B;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fkr.B;
 
     KNL_C_plus = ( (KNL_Qstar_plus*Qstar - KNL_vstar_plus*vstar ) * ( 1./3. + vstar/a/Mnuc)
         + KNL_vstar_plus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
@@ -373,7 +623,7 @@ double BSKLNBaseRESPXSec2014::XSec(
     KNL_C_minus = ( (KNL_Qstar_minus*Qstar - KNL_vstar_minus*vstar ) * ( 1./3. + vstar/a/Mnuc)
         + KNL_vstar_minus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
 
-    LOG("BSKLNBaseRESPXSec2014",pINFO)  <<"KNL C= "<<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fFKR.C;
+    LOG("BSKLNBaseRESPXSec2014",pINFO)  <<"KNL C= "<<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fkr.C;
   }
   double BRS_S_plus = 0;
   double BRS_S_minus = 0;
@@ -401,26 +651,26 @@ double BSKLNBaseRESPXSec2014::XSec(
 
     BRS_S_plus = KNL_S_plus;
     BRS_S_minus = KNL_S_minus;
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fFKR.S;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fkr.S;
 
     BRS_B_plus = KNL_B_plus + fZeta*GA/2./W/Qstar*( KNL_Qstar_plus*vstar - KNL_vstar_plus*Qstar)
       *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
 
     BRS_B_minus = KNL_B_minus + fZeta*GA/2./W/Qstar*( KNL_Qstar_minus*vstar - KNL_vstar_minus*Qstar)
       *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fFKR.B;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fkr.B;
 
     BRS_C_plus = KNL_C_plus  + fZeta*GA/2./W/Qstar*( KNL_Qstar_plus*vstar - KNL_vstar_plus*Qstar)
       * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
 
     BRS_C_minus = KNL_C_minus  + fZeta*GA/2./W/Qstar*( KNL_Qstar_minus*vstar - KNL_vstar_minus*Qstar)
       * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS C= " <<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fFKR.C;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS C= " <<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fkr.C;
   }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("FKR", pDEBUG)
-    << "FKR params for RES = " << resname << " : " << fFKR;
+    << "FKR params for RES = " << resname << " : " << fkr;
 #endif
 
   // Calculate the Rein-Sehgal Helicity Amplitudes
@@ -438,30 +688,21 @@ double BSKLNBaseRESPXSec2014::XSec(
   const RSHelicityAmplModelI * hamplmod_BRS_minus = 0;
   const RSHelicityAmplModelI * hamplmod_BRS_plus = 0;
 
-  // These lines were ~ 100 lines below, which means that, for EM interactions, the coefficients below were still calculated using the weak coupling constant - Afro
-  double g2 = kGF2;
-
-  // For EM interaction replace  G_{Fermi} with :
-  // a_{em} * pi / ( sqrt(2) * sin^2(theta_weinberg) * Mass_{W}^2 }
-  // See C.Quigg, Gauge Theories of the Strong, Weak and E/M Interactions,
-  // ISBN 0-8053-6021-2, p.112 (6.3.57)
-  // Also, take int account that the photon propagator is 1/p^2 but the
-  // W propagator is 1/(p^2-Mass_{W}^2), so weight the EM case with
-  // Mass_{W}^4 / q^4
-  // So, overall:
-  // G_{Fermi}^2 --> a_{em}^2 * pi^2 / (2 * sin^4(theta_weinberg) * q^{4})
-  //
-
-  if(is_EM) {
-    double q4 = q2*q2;
-    g2 = kAem2 * kPi2 / (2.0 * fSin48w * q4);
-  }
-
-  if(is_CC) g2 = kGF2*fVud2;
-
-  double sig0 = 0.125*(g2/kPi)*(-q2/Q2)*(W/Mnuc);
-  double scLR = W/Mnuc;
-  double scS  = (Mnuc/W)*(-Q2/q2);
+  double sig0 = kf.sig0;
+  double scLR = kf.scLR;
+  double scS  = kf.scS;
+  double U2   = kf.U2;
+  double V2   = kf.V2;
+  double UV   = kf.UV;
+
+  double KNL_Alambda_plus  = kf.KNL_Alambda_plus;
+  double KNL_Alambda_minus = kf.KNL_Alambda_minus;
+  double KNL_cL_plus       = kf.KNL_cL_plus;
+  double KNL_cL_minus      = kf.KNL_cL_minus;
+  double KNL_cR_plus       = kf.KNL_cR_plus;
+  double KNL_cR_minus      = kf.KNL_cR_minus;
+  double KNL_cS_plus       = kf.KNL_cS_plus;
+  double KNL_cS_minus      = kf.KNL_cS_minus;
 
   double sigL =0;
   double sigR =0;
@@ -487,28 +728,28 @@ double BSKLNBaseRESPXSec2014::XSec(
       }
       else
         if(is_CC && is_KLN ){
-          fFKR.S = KNL_S_minus;        //2 times fFKR.S?
-          fFKR.B = KNL_B_minus;
-          fFKR.C = KNL_C_minus;
+          fkr.S = KNL_S_minus;        //2 times fkr.S?
+          fkr.B = KNL_B_minus;
+          fkr.C = KNL_C_minus;
 
           hamplmod_KNL_minus = fHAmplModelCC;
 
           assert(hamplmod_KNL_minus);
 
-          const RSHelicityAmpl & hampl_KNL_minus = hamplmod_KNL_minus->Compute(resonance, fFKR);
+          const RSHelicityAmpl & hampl_KNL_minus = hamplmod_KNL_minus->Compute(resonance, fkr);
 
           sigL_minus = (hampl_KNL_minus.Amp2Plus3 () + hampl_KNL_minus.Amp2Plus1 ());
           sigR_minus = (hampl_KNL_minus.Amp2Minus3() + hampl_KNL_minus.Amp2Minus1());
           sigS_minus = (hampl_KNL_minus.Amp20Plus () + hampl_KNL_minus.Amp20Minus());
 
 
-          fFKR.S = KNL_S_plus;
-          fFKR.B = KNL_B_plus;
-          fFKR.C = KNL_C_plus;
+          fkr.S = KNL_S_plus;
+          fkr.B = KNL_B_plus;
+          fkr.C = KNL_C_plus;
           hamplmod_KNL_plus = fHAmplModelCC;
           assert(hamplmod_KNL_plus);
 
-          const RSHelicityAmpl & hampl_KNL_plus = hamplmod_KNL_plus->Compute(resonance, fFKR);
+          const RSHelicityAmpl & hampl_KNL_plus = hamplmod_KNL_plus->Compute(resonance, fkr);
 
           sigL_plus = (hampl_KNL_plus.Amp2Plus3 () + hampl_KNL_plus.Amp2Plus1 ());
           sigR_plus = (hampl_KNL_plus.Amp2Minus3() + hampl_KNL_plus.Amp2Minus1());
@@ -517,26 +758,26 @@ double BSKLNBaseRESPXSec2014::XSec(
         }
         else
           if(is_CC && is_BRS ){
-            fFKR.S = BRS_S_minus;
-            fFKR.B = BRS_B_minus;
-            fFKR.C = BRS_C_minus;
+            fkr.S = BRS_S_minus;
+            fkr.B = BRS_B_minus;
+            fkr.C = BRS_C_minus;
 
             hamplmod_BRS_minus = fHAmplModelCC;
             assert(hamplmod_BRS_minus);
 
-            const RSHelicityAmpl & hampl_BRS_minus = hamplmod_BRS_minus->Compute(resonance, fFKR);
+            const RSHelicityAmpl & hampl_BRS_minus = hamplmod_BRS_minus->Compute(resonance, fkr);
 
             sigL_minus = (hampl_BRS_minus.Amp2Plus3 () + hampl_BRS_minus.Amp2Plus1 ());
             sigR_minus = (hampl_BRS_minus.Amp2Minus3() + hampl_BRS_minus.Amp2Minus1());
             sigS_minus = (hampl_BRS_minus.Amp20Plus () + hampl_BRS_minus.Amp20Minus());
 
-            fFKR.S = BRS_S_plus;
-            fFKR.B = BRS_B_plus;
-            fFKR.C = BRS_C_plus;
+            fkr.S = BRS_S_plus;
+            fkr.B = BRS_B_plus;
+            fkr.C = BRS_C_plus;
             hamplmod_BRS_plus = fHAmplModelCC;
             assert(hamplmod_BRS_plus);
 
-            const RSHelicityAmpl & hampl_BRS_plus = hamplmod_BRS_plus->Compute(resonance, fFKR);
+            const RSHelicityAmpl & hampl_BRS_plus = hamplmod_BRS_plus->Compute(resonance, fkr);
 
             sigL_plus = (hampl_BRS_plus.Amp2Plus3 () + hampl_BRS_plus.Amp2Plus1 ());
             sigR_plus = (hampl_BRS_plus.Amp2Minus3() + hampl_BRS_plus.Amp2Minus1());
@@ -561,7 +802,7 @@ double BSKLNBaseRESPXSec2014::XSec(
   else {
      assert(hamplmod);
 
-     const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fFKR);
+     const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fkr);
 
      sigL = scLR* (hampl.Amp2Plus3 () + hampl.Amp2Plus1 ());
      sigR = scLR* (hampl.Amp2Minus3() + hampl.Amp2Minus1());
@@ -586,7 +827,7 @@ double BSKLNBaseRESPXSec2014::XSec(
       LOG("BSKLNBaseRESPXSec2014",pINFO) << "A-="<<KNL_Alambda_minus<<" A+="<<KNL_Alambda_plus;
       // protect against sigRSR=sigRSL=sigRSS=0
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<q2<<"\t"<<xsec<<"\t"<<sig0*(V2*sigR + U2*sigL + 2*UV*sigS)<<"\t"<<xsec/TMath::Max(sig0*(V2*sigRSR + U2*sigRSL + 2*UV*sigRSS),1.0e-100);
-      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"fFKR.B="<<fFKR.B<<" fFKR.C="<<fFKR.C<<" fFKR.S="<<fFKR.S;
+      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"fkr.B="<<fkr.B<<" fkr.C="<<fkr.C<<" fkr.S="<<fkr.S;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"CL-="<<TMath::Power(KNL_cL_minus,2)<<" CL+="<<TMath::Power(KNL_cL_plus,2)<<" U2="<<U2;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"SL-="<<sigL_minus<<" SL+="<<sigL_plus<<" SL="<<sigRSL;
 
@@ -616,7 +857,8 @@ double BSKLNBaseRESPXSec2014::XSec(
   // (default: true)
   double bw = 1.0;
   if ( fWghtBW ) {
-     bw = utils::bwfunc::BreitWignerL(W,LR,MR,WR,NR);
+     bw = fTabBW ? utils::bwfunc::BreitWignerLTab(W,LR,MR,WR,NR) :
+                   utils::bwfunc::BreitWignerL   (W,LR,MR,WR,NR);
   }
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("BSKLNBaseRESPXSec2014", pDEBUG)
@@ -624,89 +866,14 @@ double BSKLNBaseRESPXSec2014::XSec(
 #endif
   xsec *= bw;
 
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("BSKLNBaseRESPXSec2014", pINFO)
-      << "\n d2xsec/dQ2dW"  << "[" << interaction->AsString()
-      << "](W=" << W << ", q2=" << q2 << ", E=" << E << ") = " << xsec;
-#endif
+  xsec *= kf.J;
+  xsec *= kf.scale;
 
-  // The algorithm computes d^2xsec/dWdQ2
-  // Check whether variable tranformation is needed
-  if ( kps != kPSWQ2fE ) {
-     double J = utils::kinematics::Jacobian(interaction,kPSWQ2fE,kps);
-     xsec *= J;
-  }
-
-  // Apply given scaling factor
-  if      (is_CC) { xsec *= fXSecScaleCC; }
-  else if (is_NC) { xsec *= fXSecScaleNC; }
-
-  // If requested return the free nucleon xsec even for input nuclear tgt
-  if ( interaction->TestBit(kIAssumeFreeNucleon) ) return xsec;
-
-  int Z = target.Z();
-  int A = target.A();
-  int N = A-Z;
-
-  // Take into account the number of scattering centers in the target
-  int NNucl = (is_p) ? Z : N;
-  xsec*=NNucl; // nuclear xsec (no nuclear suppression factor)
-
-  if ( fUsePauliBlocking && A!=1 )
-  {
-    // Calculation of Pauli blocking according references:
-    //
-    //     [1] S.L. Adler,  S. Nussinov,  and  E.A.  Paschos,  "Nuclear
-    //         charge exchange corrections to leptonic pion  production
-    //         in  the (3,3) resonance  region,"  Phys. Rev. D 9 (1974)
-    //         2125-2143 [Erratum Phys. Rev. D 10 (1974) 1669].
-    //     [2] J.Y. Yu, "Neutrino interactions and  nuclear  effects in
-    //         oscillation experiments and the  nonperturbative disper-
-    //         sive  sector in strong (quasi-)abelian  fields,"  Ph. D.
-    //         Thesis, Dortmund U., Dortmund, 2002 (unpublished).
-    //     [3] E.A. Paschos, J.Y. Yu,  and  M. Sakuda,  "Neutrino  pro-
-    //         duction  of  resonances,"  Phys. Rev. D 69 (2004) 014013
-    //         [arXiv: hep-ph/0308130].
+  if ( kf.free_nucleon ) return xsec;
 
-    double P_Fermi = 0.0;
+  xsec *= kf.NNucl; // nuclear xsec (no nuclear suppression factor)
+  xsec *= kf.pauli;
 
-    // Maximum value of Fermi momentum of target nucleon (GeV)
-    if ( A<6 || ! fUseRFGParametrization )
-    {
-        // look up the Fermi momentum for this target
-        FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
-        const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
-        P_Fermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
-     }
-     else {
-        // define the Fermi momentum for this target
-        P_Fermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
-        // correct the Fermi momentum for the struck nucleon
-        if(is_p) { P_Fermi *= TMath::Power( 2.*Z/A, 1./3); }
-        else     { P_Fermi *= TMath::Power( 2.*N/A, 1./3); }
-     }
-
-     double FactorPauli_RES = 1.0;
-
-     double k0 = 0., q = 0., q0 = 0.;
-
-     if (P_Fermi > 0.)
-     {
-        k0 = (W2-Mnuc2-Q2)/(2*W);
-        k = TMath::Sqrt(k0*k0+Q2);  // previous value of k is overridden
-        q0 = (W2-Mnuc2+kPionMass2)/(2*W);
-        q = TMath::Sqrt(q0*q0-kPionMass2);
-     }
-
-     if ( 2*P_Fermi < k-q )
-        FactorPauli_RES = 1.0;
-     if ( 2*P_Fermi >= k+q )
-        FactorPauli_RES = ((3*k*k+q*q)/(2*P_Fermi)-(5*TMath::Power(k,4)+TMath::Power(q,4)+10*k*k*q*q)/(40*TMath::Power(P_Fermi,3)))/(2*k);
-     if ( 2*P_Fermi >= k-q && 2*P_Fermi <= k+q )
-        FactorPauli_RES = ((q+k)*(q+k)-4*P_Fermi*P_Fermi/5-TMath::Power(k-q, 3)/(2*P_Fermi)+TMath::Power(k-q, 5)/(40*TMath::Power(P_Fermi, 3)))/(4*q*k);
-
-     xsec *= FactorPauli_RES;
-  }
   return xsec;
 }
 //____________________________________________________________________________
@@ -716,6 +883,13 @@ double BSKLNBaseRESPXSec2014::Integral(const Interaction * interaction) const
   return xsec;
 }
 //____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::IntegralBatch(
+            const Interaction * const * in, size_t n, double * xsec) const
+{
+  if(fXSecIntegrator->IntegrateBatch(this, in, n, xsec)) return;
+  XSecAlgorithmI::IntegralBatch(in, n, xsec);
+}
+//____________________________________________________________________________
 bool BSKLNBaseRESPXSec2014::ValidProcess(const Interaction * interaction) const
 {
   if(interaction->TestBit(kISkipProcessChk)) return true;
@@ -776,6 +950,7 @@ void BSKLNBaseRESPXSec2014::LoadConfig(void)
 
   this->GetParamDef( "BreitWignerWeight", fWghtBW, true ) ;
   this->GetParamDef( "BreitWignerNorm",   fNormBW, true);
+  this->GetParamDef( "BreitWignerTable",  fTabBW,  false);
   double thw ;
   this->GetParam( "WeinbergAngle", thw ) ;
   fSin48w = TMath::Power( TMath::Sin(thw), 4 );
@@ -785,6 +960,7 @@ void BSKLNBaseRESPXSec2014::LoadConfig(void)
   this->GetParam("FermiMomentumTable", fKFTable);
   this->GetParam("RFG-UseParametrization", fUseRFGParametrization);
   this->GetParam("UsePauliBlockingForRES", fUsePauliBlocking);
+  fConfigId = ++gBSKLNConfigIds;
 
   // Load all the sub-algorithms needed
 
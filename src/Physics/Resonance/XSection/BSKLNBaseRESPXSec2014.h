@@ -38,6 +38,7 @@
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/ParticleData/BaryonResonance.h"
+#include "Framework/ParticleData/BaryonResList.h"
 #include "Physics/Resonance/XSection/FKR.h"
 
 namespace genie {
@@ -54,8 +55,17 @@ namespace genie {
       // implement the XSecAlgorithmI interface 
       double XSec         (const Interaction * i, KinePhaseSpace_t k) const;
       double Integral     (const Interaction * i) const;
+      void   IntegralBatch (const Interaction * const * in, size_t n,
+                            double * xsec) const;
       bool   ValidProcess (const Interaction * i) const;
 
+      //! Cross sections xsec[ires] of all the resonances in the list, at the
+      //! kinematics of the input interaction (whatever its own resonance),
+      //! as XSec() computes them one resonance at a time. The resonance
+      //! independent factors are computed only once.
+      void   FusedXSec    (const Interaction * i, KinePhaseSpace_t k,
+                           const BaryonResList & resonances, double * xsec) const;
+
       // overload the Algorithm::Configure() methods to load private data
       // members from configuration options
       void Configure(const Registry & config);
@@ -68,7 +78,33 @@ namespace genie {
 
       void LoadConfig (void);
 
-      mutable FKR fFKR;
+      //! Resonance independent factors of the cross section at a kinematical point
+      struct KineFactors {
+        bool   is_nu, is_nubar, is_lplus, is_lminus, is_p, is_n;
+        bool   is_CC, is_NC, is_EM, is_KLN, is_BRS;
+        double E, W, W2, q2, Q2, Q, Mnuc, Mnuc2;
+        double U2, V2, UV, vstar, Qstar, a;
+        double KNL_Alambda_plus, KNL_Alambda_minus;
+        double KNL_Qstar_plus,   KNL_Qstar_minus;
+        double KNL_vstar_plus,   KNL_vstar_minus;
+        double KNL_cL_plus,      KNL_cL_minus;
+        double KNL_cR_plus,      KNL_cR_minus;
+        double KNL_cS_plus,      KNL_cS_minus;
+        double sig0, scLR, scS;
+        double J;                 ///< Jacobian from the {W,Q2} phase space
+        double scale;             ///< external xsec scaling factor
+        bool   free_nucleon;      ///< free nucleon xsec requested?
+        int    NNucl;             ///< number of scattering centers
+        double pauli;             ///< Pauli blocking factor
+      };
+
+      //! Fill the resonance independent factors; false if the cross section
+      //! vanishes for all resonances
+      bool   ComputeKineFactors (const Interaction * i, KinePhaseSpace_t k, KineFactors & kf) const;
+      //! Cross section of resonance res at the kinematical point of kf
+      double ResonanceXSec      (Resonance_t res, const KineFactors & kf) const;
+
+      unsigned long fConfigId;      ///< unique id of the current configuration
 
       const RSHelicityAmplModelI * fHAmplModelCC;
       const RSHelicityAmplModelI * fHAmplModelNCp;
@@ -79,6 +115,7 @@ namespace genie {
       // configuration data
       bool     fWghtBW;            ///< weight with resonance breit-wigner?
       bool     fNormBW;            ///< normalize resonance breit-wigner to 1?
+      bool     fTabBW;             ///< use the tabulated breit-wigner functions?
       double   fZeta;              ///< FKR parameter Zeta
       double   fOmega;             ///< FKR parameter Omega
       double   fMa2;               ///< (axial mass)^2
@@ -12,10 +12,17 @@
  Important revisions after version 2.0.0 :
  @ Sep 07, 2009 - CA
    Integrated with GNU Numerical Library (GSL) via ROOT's MathMore library.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added IntegrateBatch(), integrating the knots of a spline concurrently
+   (batch-nthreads).
+   Integrates the ReinSehgalRESPXSec model through a function bound to its
+   concrete type (see utils::gsl::d2XSec_dWdQ2_E_T).
 
 */
 //____________________________________________________________________________
 
+#include <typeinfo>
+
 #include <TMath.h>
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
@@ -30,11 +37,25 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Numerical/GSLUtils.h"
 #include "Physics/Resonance/XSection/RESXSec.h"
+#include "Physics/Resonance/XSection/ReinSehgalRESPXSec.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
 
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  ROOT::Math::IBaseFunctionMultiDim * MakeIntegrand(
+      const XSecAlgorithmI * model, const Interaction * in)
+  {
+    // direct calls to the default model (not to models derived from it)
+    if(typeid(*model) == typeid(ReinSehgalRESPXSec)) {
+      return new utils::gsl::d2XSec_dWdQ2_E_T<ReinSehgalRESPXSec>(
+                 static_cast<const ReinSehgalRESPXSec *>(model), in);
+    }
+    return new utils::gsl::d2XSec_dWdQ2_E(model, in);
+  }
+}
+
 //____________________________________________________________________________
 RESXSec::RESXSec() :
 XSecIntegratorI("genie::RESXSec")
@@ -70,35 +91,37 @@ double RESXSec::Integrate(
   interaction->SetBit(kISkipProcessChk);
   //interaction->SetBit(kISkipKinematicChk);
 
-  ROOT::Math::IBaseFunctionMultiDim * func = 
-      new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
-  
-  ROOT::Math::IntegrationMultiDim::Type ig_type = 
-      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
   double abstol = 1E-16; //We mostly care about relative tolerance.
-  
-  ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
 
   double kine_min[2] = { Wl.min, Q2l.min };
   double kine_max[2] = { Wl.max, Q2l.max };
-  double xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+  double ig_error  = 0;
+  int    ig_status = 0;
+  double xsec = this->IntegrateNDim(MakeIntegrand, model, interaction,
+                   2, kine_min, kine_max, abstol, false, &ig_error, &ig_status)
+                * (1E-38 * units::cm2);
 
-  LOG("RESXSec", pERROR)  << "Integrator opt / Integrator = " <<  ig.Options().Integrator();
+  LOG("RESXSec", pERROR)  << "Integrator opt / Integrator = " <<  fGSLIntgType;
 
   if(xsec < 0) {
     LOG("RESXSec", pERROR)  << "Algorithm " << *model << " returns a negative cross-section (xsec = " << xsec << " 1E-38 * cm2)";
     LOG("RESXSec", pERROR)  << "for process" << *interaction;
-    LOG("RESXSec", pERROR)  << "Integrator status code = " << ig.Status();
-    LOG("RESXSec", pERROR)  << "Integrator error code = " << ig.Error();
+    LOG("RESXSec", pERROR)  << "Integrator status code = " << ig_status;
+    LOG("RESXSec", pERROR)  << "Integrator error code = " << ig_error;
   }
          
   //LOG("RESXSec", pINFO)  << "XSec[RES] (Ev = " << Ev << " GeV) = " << xsec;
 
   delete interaction;
-  delete func;
   return xsec;
 }
 //____________________________________________________________________________
+bool RESXSec::IntegrateBatch(const XSecAlgorithmI * model,
+         const Interaction * const * in, size_t n, double * xsec) const
+{
+  return this->IntegrateBatchThreads(model, in, n, xsec);
+}
+//____________________________________________________________________________
 void RESXSec::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -121,5 +144,7 @@ void RESXSec::LoadConfig(void)
   GetParamDef( "gsl-min-eval", min, 5000 ) ;
   fGSLMaxEval  = (unsigned int) max ;
   fGSLMinEval  = (unsigned int) min ;
+
+  this->LoadIntegratorConfig();
 }
 //____________________________________________________________________________
@@ -36,9 +36,6 @@ public:
 
   // RSHelicityAmplModelI interface implementation
   const RSHelicityAmpl & Compute(Resonance_t res, const FKR & fkr) const;
-
-private:
-  mutable RSHelicityAmpl fAmpl;
 };
 
 }        // genie namespace
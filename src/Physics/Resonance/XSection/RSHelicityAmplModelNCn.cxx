@@ -13,6 +13,8 @@
  @ Oct 05, 2009 - CA
    Compute() now returns a `const RSHelicityAmpl &' and avoids creating a new
    RSHelicityAmpl at each call.                      
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The computed amplitudes are kept per thread (see Oct 05, 2009 above).
 
 */
 //____________________________________________________________________________
@@ -50,6 +52,10 @@ const RSHelicityAmpl &
   RSHelicityAmplModelNCn::Compute(
       Resonance_t res, const FKR & fkr) const
 {
+  // the amplitudes are kept per thread, as the model is shared by the event
+  // generation threads (valid until the thread's next call)
+  static thread_local RSHelicityAmpl ampl;
+
   double xi = fSin28w;
 
   switch(res) {
@@ -60,12 +66,12 @@ const RSHelicityAmpl &
      double Rm2xiR = fkr.Rminus + rx;
      double Rp2xiR = fkr.Rplus  + rx;
 
-     fAmpl.fMinus1 =  -kSqrt2 * Rm2xiR;
-     fAmpl.fPlus1  =   kSqrt2 * Rp2xiR;
-     fAmpl.fMinus3 =  -kSqrt6 * Rm2xiR;
-     fAmpl.fPlus3  =   kSqrt6 * Rp2xiR;
-     fAmpl.f0Minus = 2*kSqrt2 * fkr.C;
-     fAmpl.f0Plus  =   fAmpl.f0Minus;
+     ampl.fMinus1 =  -kSqrt2 * Rm2xiR;
+     ampl.fPlus1  =   kSqrt2 * Rp2xiR;
+     ampl.fMinus3 =  -kSqrt6 * Rm2xiR;
+     ampl.fPlus3  =   kSqrt6 * Rp2xiR;
+     ampl.f0Minus = 2*kSqrt2 * fkr.C;
+     ampl.f0Plus  =   ampl.f0Minus;
      break;
    }
    case (kS11_1535) :
@@ -79,12 +85,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3_2 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = kSqrt2_3 * (fkr.Lamda * fkr.C - 3*fkr.B);
 
-     fAmpl.fMinus1 = -1*kSqrt3 * Tm2xiT - kSqrt2_3 * LRmxiR;
-     fAmpl.fPlus1  =    kSqrt3 * Tp2xiT + kSqrt2_3 * LRpxiR;
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus =  a-b;
-     fAmpl.f0Plus  = -a-b;
+     ampl.fMinus1 = -1*kSqrt3 * Tm2xiT - kSqrt2_3 * LRmxiR;
+     ampl.fPlus1  =    kSqrt3 * Tp2xiT + kSqrt2_3 * LRpxiR;
+     ampl.fMinus3 =  0.;
+     ampl.fPlus3  =  0.;
+     ampl.f0Minus =  a-b;
+     ampl.f0Plus  = -a-b;
      break;
    }
    case (kD13_1520) :
@@ -98,12 +104,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = k2_Sqrt3 * fkr.Lamda * fkr.C;
 
-     fAmpl.fMinus1 = -kSqrt3_2 * Tm2xiT + k2_Sqrt3 * LRmxiR;
-     fAmpl.fPlus1  = -kSqrt3_2 * Tp2xiT + k2_Sqrt3 * LRpxiR;
-     fAmpl.fMinus3 = -k3_Sqrt2 * Tm2xiT;
-     fAmpl.fPlus3  = -k3_Sqrt2 * Tp2xiT;
-     fAmpl.f0Minus =  a - b;
-     fAmpl.f0Plus  =  a + b;
+     ampl.fMinus1 = -kSqrt3_2 * Tm2xiT + k2_Sqrt3 * LRmxiR;
+     ampl.fPlus1  = -kSqrt3_2 * Tp2xiT + k2_Sqrt3 * LRpxiR;
+     ampl.fMinus3 = -k3_Sqrt2 * Tm2xiT;
+     ampl.fPlus3  = -k3_Sqrt2 * Tp2xiT;
+     ampl.f0Minus =  a - b;
+     ampl.f0Plus  =  a + b;
      break;
    }
    case (kS11_1650) :
@@ -112,12 +118,12 @@ const RSHelicityAmpl &
      double LRm4xiR = fkr.Lamda * (fkr.Rminus + xr);
      double LRp4xiR = fkr.Lamda * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 = -k1_Sqrt24 * LRm4xiR;
-     fAmpl.fPlus1  =  k1_Sqrt24 * LRp4xiR;
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus =  k1_Sqrt6 * (fkr.Lamda * fkr.C - 3*fkr.B);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     ampl.fMinus1 = -k1_Sqrt24 * LRm4xiR;
+     ampl.fPlus1  =  k1_Sqrt24 * LRp4xiR;
+     ampl.fMinus3 =  0.;
+     ampl.fPlus3  =  0.;
+     ampl.f0Minus =  k1_Sqrt6 * (fkr.Lamda * fkr.C - 3*fkr.B);
+     ampl.f0Plus  =  ampl.f0Minus;
      break;
    }
    case (kD13_1700) :
@@ -126,12 +132,12 @@ const RSHelicityAmpl &
      double LRm4xiR = fkr.Lamda * (fkr.Rminus + xr);
      double LRp4xiR = fkr.Lamda * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 = -k1_Sqrt120 * LRm4xiR;
-     fAmpl.fPlus1  = -k1_Sqrt120 * LRp4xiR;
-     fAmpl.fMinus3 = -k3_Sqrt40  * LRm4xiR;
-     fAmpl.fPlus3  = -k3_Sqrt40  * LRp4xiR;
-     fAmpl.f0Minus = -k1_Sqrt30  * fkr.Lamda * fkr.C;
-     fAmpl.f0Plus  =  -1.* fAmpl.f0Minus;
+     ampl.fMinus1 = -k1_Sqrt120 * LRm4xiR;
+     ampl.fPlus1  = -k1_Sqrt120 * LRp4xiR;
+     ampl.fMinus3 = -k3_Sqrt40  * LRm4xiR;
+     ampl.fPlus3  = -k3_Sqrt40  * LRp4xiR;
+     ampl.f0Minus = -k1_Sqrt30  * fkr.Lamda * fkr.C;
+     ampl.f0Plus  =  -1.* ampl.f0Minus;
      break;
    }
    case (kD15_1675) :
@@ -140,12 +146,12 @@ const RSHelicityAmpl &
      double LRm4xiR = fkr.Lamda * (fkr.Rminus + xr);
      double LRp4xiR = fkr.Lamda * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  kSqrt3_40 * LRm4xiR;
-     fAmpl.fPlus1  = -kSqrt3_40 * LRp4xiR;
-     fAmpl.fMinus3 =  kSqrt3_20 * LRm4xiR;
-     fAmpl.fPlus3  = -kSqrt3_20 * LRp4xiR;
-     fAmpl.f0Minus = -kSqrt3_10 * (fkr.Lamda * fkr.C);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     ampl.fMinus1 =  kSqrt3_40 * LRm4xiR;
+     ampl.fPlus1  = -kSqrt3_40 * LRp4xiR;
+     ampl.fMinus3 =  kSqrt3_20 * LRm4xiR;
+     ampl.fPlus3  = -kSqrt3_20 * LRp4xiR;
+     ampl.f0Minus = -kSqrt3_10 * (fkr.Lamda * fkr.C);
+     ampl.f0Plus  =  ampl.f0Minus;
      break;
    }
    case (kS31_1620) :
@@ -159,12 +165,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3_2 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = k1_Sqrt6 * (fkr.Lamda * fkr.C - 3*fkr.B);
 
-     fAmpl.fMinus1 =  kSqrt3 * Tm2xiT - k1_Sqrt6 * LRm2xiR;
-     fAmpl.fPlus1  = -kSqrt3 * Tp2xiT + k1_Sqrt6 * LRp2xiR;
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus = -a-b;
-     fAmpl.f0Plus  =  a-b;
+     ampl.fMinus1 =  kSqrt3 * Tm2xiT - k1_Sqrt6 * LRm2xiR;
+     ampl.fPlus1  = -kSqrt3 * Tp2xiT + k1_Sqrt6 * LRp2xiR;
+     ampl.fMinus3 =  0.;
+     ampl.fPlus3  =  0.;
+     ampl.f0Minus = -a-b;
+     ampl.f0Plus  =  a-b;
      break;
    }
    case (kD33_1700) :
@@ -178,12 +184,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = k1_Sqrt3 * fkr.Lamda * fkr.C;
 
-     fAmpl.fMinus1 = kSqrt3_2 * Tm2xiT + k1_Sqrt3 * LRm2xiR;
-     fAmpl.fPlus1  = kSqrt3_2 * Tp2xiT + k1_Sqrt3 * LRp2xiR;
-     fAmpl.fMinus3 = k3_Sqrt2 * Tm2xiT;
-     fAmpl.fPlus3  = k3_Sqrt2 * Tp2xiT;
-     fAmpl.f0Minus = -a-b;
-     fAmpl.f0Plus  = -a+b;
+     ampl.fMinus1 = kSqrt3_2 * Tm2xiT + k1_Sqrt3 * LRm2xiR;
+     ampl.fPlus1  = kSqrt3_2 * Tp2xiT + k1_Sqrt3 * LRp2xiR;
+     ampl.fMinus3 = k3_Sqrt2 * Tm2xiT;
+     ampl.fPlus3  = k3_Sqrt2 * Tp2xiT;
+     ampl.f0Minus = -a-b;
+     ampl.f0Plus  = -a+b;
      break;
    }
    case (kP11_1440) :
@@ -196,12 +202,12 @@ const RSHelicityAmpl &
      double a       = 0.25*kSqrt3 * L2 * fkr.S;
      double b       = c * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
 
-     fAmpl.fMinus1 = c * L2RmxiR;
-     fAmpl.fPlus1  = c * L2RpxiR;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = a - b;
-     fAmpl.f0Plus  = a + b;
+     ampl.fMinus1 = c * L2RmxiR;
+     ampl.fPlus1  = c * L2RpxiR;
+     ampl.fMinus3 = 0.;
+     ampl.fPlus3  = 0.;
+     ampl.f0Minus = a - b;
+     ampl.f0Plus  = a + b;
      break;
    }
    case (kP33_1600) :
@@ -211,12 +217,12 @@ const RSHelicityAmpl &
      double L2RmxiR = L2 * (fkr.Rminus + xr);
      double L2RpxiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  k1_Sqrt6 * L2RmxiR;
-     fAmpl.fPlus1  = -k1_Sqrt6 * L2RpxiR;
-     fAmpl.fMinus3 =  k1_Sqrt2 * L2RmxiR;
-     fAmpl.fPlus3  = -k1_Sqrt2 * L2RpxiR;
-     fAmpl.f0Minus = -kSqrt2_3 * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     ampl.fMinus1 =  k1_Sqrt6 * L2RmxiR;
+     ampl.fPlus1  = -k1_Sqrt6 * L2RpxiR;
+     ampl.fMinus3 =  k1_Sqrt2 * L2RmxiR;
+     ampl.fPlus3  = -k1_Sqrt2 * L2RpxiR;
+     ampl.f0Minus = -kSqrt2_3 * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
+     ampl.f0Plus  =  ampl.f0Minus;
      break;
    }
    case (kP13_1720) :
@@ -230,12 +236,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3_20 * L2 * fkr.S;
      double b       = kSqrt5_12 * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
 
-     fAmpl.fMinus1 =  kSqrt27_40 * LTm + kSqrt5_12 * L2RmxiR;
-     fAmpl.fPlus1  = -kSqrt27_40 * LTp - kSqrt5_12 * L2RpxiR;
-     fAmpl.fMinus3 = -kSqrt9_40 * LTm;
-     fAmpl.fPlus3  =  kSqrt9_40 * LTp;
-     fAmpl.f0Minus = -a+b;
-     fAmpl.f0Plus  =  a+b;
+     ampl.fMinus1 =  kSqrt27_40 * LTm + kSqrt5_12 * L2RmxiR;
+     ampl.fPlus1  = -kSqrt27_40 * LTp - kSqrt5_12 * L2RpxiR;
+     ampl.fMinus3 = -kSqrt9_40 * LTm;
+     ampl.fPlus3  =  kSqrt9_40 * LTp;
+     ampl.f0Minus = -a+b;
+     ampl.f0Plus  =  a+b;
      break;
    }
    case (kF15_1680) :
@@ -249,12 +255,12 @@ const RSHelicityAmpl &
      double a       = k3_Sqrt40 * L2 * fkr.S;
      double b       = kSqrt5_8  * L2 * fkr.C;
 
-     fAmpl.fMinus1 =  k3_Sqrt20 * LTm - kSqrt5_8 * L2RmxiR;
-     fAmpl.fPlus1  =  k3_Sqrt20 * LTp - kSqrt5_8 * L2RpxiR;
-     fAmpl.fMinus3 =  kSqrt18_20 * LTm;
-     fAmpl.fPlus3  =  kSqrt18_20 * LTp;
-     fAmpl.f0Minus =  -a+b;
-     fAmpl.f0Plus  =  -a-b;
+     ampl.fMinus1 =  k3_Sqrt20 * LTm - kSqrt5_8 * L2RmxiR;
+     ampl.fPlus1  =  k3_Sqrt20 * LTp - kSqrt5_8 * L2RpxiR;
+     ampl.fMinus3 =  kSqrt18_20 * LTm;
+     ampl.fPlus3  =  kSqrt18_20 * LTp;
+     ampl.f0Minus =  -a+b;
+     ampl.f0Plus  =  -a-b;
      break;
    }
    case (kP31_1910) :
@@ -262,12 +268,12 @@ const RSHelicityAmpl &
      double xr       = 2*xi*fkr.R;
      double L2       = TMath::Power(fkr.Lamda, 2);
 
-     fAmpl.fMinus1 = -k1_Sqrt15 * L2 * (fkr.Rminus + xr);
-     fAmpl.fPlus1  = -k1_Sqrt15 * L2 * (fkr.Rplus  + xr);
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus = -kSqrt4_15 * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
-     fAmpl.f0Plus  = -1.* fAmpl.f0Minus;
+     ampl.fMinus1 = -k1_Sqrt15 * L2 * (fkr.Rminus + xr);
+     ampl.fPlus1  = -k1_Sqrt15 * L2 * (fkr.Rplus  + xr);
+     ampl.fMinus3 =  0.;
+     ampl.fPlus3  =  0.;
+     ampl.f0Minus = -kSqrt4_15 * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
+     ampl.f0Plus  = -1.* ampl.f0Minus;
      break;
    }
    case (kP33_1920) :
@@ -277,12 +283,12 @@ const RSHelicityAmpl &
      double L2Rm2xiR = L2 * (fkr.Rminus + xr);
      double L2Rp2xiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  k1_Sqrt15 * L2Rm2xiR;
-     fAmpl.fPlus1  = -k1_Sqrt15 * L2Rp2xiR;
-     fAmpl.fMinus3 = -k1_Sqrt5  * L2Rm2xiR;
-     fAmpl.fPlus3  =  k1_Sqrt5  * L2Rp2xiR;
-     fAmpl.f0Minus = -(2./kSqrt15) * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     ampl.fMinus1 =  k1_Sqrt15 * L2Rm2xiR;
+     ampl.fPlus1  = -k1_Sqrt15 * L2Rp2xiR;
+     ampl.fMinus3 = -k1_Sqrt5  * L2Rm2xiR;
+     ampl.fPlus3  =  k1_Sqrt5  * L2Rp2xiR;
+     ampl.f0Minus = -(2./kSqrt15) * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
+     ampl.f0Plus  =  ampl.f0Minus;
      break;
    }
    case (kF35_1905) :
@@ -292,12 +298,12 @@ const RSHelicityAmpl &
      double L2Rm2xiR = L2 * (fkr.Rminus + xr);
      double L2Rp2xiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  k1_Sqrt35  * L2Rm2xiR;
-     fAmpl.fPlus1  =  k1_Sqrt35  * L2Rp2xiR;
-     fAmpl.fMinus3 =  kSqrt18_35 * L2Rm2xiR;
-     fAmpl.fPlus3  =  kSqrt18_35 * L2Rp2xiR;
-     fAmpl.f0Minus =  k2_Sqrt35  * L2 * fkr.C;
-     fAmpl.f0Plus  =  -1. * fAmpl.f0Minus;
+     ampl.fMinus1 =  k1_Sqrt35  * L2Rm2xiR;
+     ampl.fPlus1  =  k1_Sqrt35  * L2Rp2xiR;
+     ampl.fMinus3 =  kSqrt18_35 * L2Rm2xiR;
+     ampl.fPlus3  =  kSqrt18_35 * L2Rp2xiR;
+     ampl.f0Minus =  k2_Sqrt35  * L2 * fkr.C;
+     ampl.f0Plus  =  -1. * ampl.f0Minus;
      break;
    }
    case (kF37_1950) :
@@ -307,12 +313,12 @@ const RSHelicityAmpl &
      double L2Rm2xiR = L2 * (fkr.Rminus + xr);
      double L2Rp2xiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  -kSqrt6_35 * L2Rm2xiR;
-     fAmpl.fPlus1  =   kSqrt6_35 * L2Rp2xiR;
-     fAmpl.fMinus3 =  -kSqrt2_7  * L2Rm2xiR;
-     fAmpl.fPlus3  =   kSqrt2_7  * L2Rp2xiR;
-     fAmpl.f0Minus = 2*kSqrt6_35 * L2 * fkr.C;
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     ampl.fMinus1 =  -kSqrt6_35 * L2Rm2xiR;
+     ampl.fPlus1  =   kSqrt6_35 * L2Rp2xiR;
+     ampl.fMinus3 =  -kSqrt2_7  * L2Rm2xiR;
+     ampl.fPlus3  =   kSqrt2_7  * L2Rp2xiR;
+     ampl.f0Minus = 2*kSqrt6_35 * L2 * fkr.C;
+     ampl.f0Plus  =  ampl.f0Minus;
      break;
    }
    case (kP11_1710) :
@@ -324,39 +330,39 @@ const RSHelicityAmpl &
      double a       = kSqrt3_8 * (1-2*xi) * L2 * fkr.S;
      double b       = k1_Sqrt6 * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
 
-     fAmpl.fMinus1 = -k1_Sqrt6 * L2RmxiR;
-     fAmpl.fPlus1  = -k1_Sqrt6 * L2RpxiR;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = -a+b;
-     fAmpl.f0Plus  = -a-b;
+     ampl.fMinus1 = -k1_Sqrt6 * L2RmxiR;
+     ampl.fPlus1  = -k1_Sqrt6 * L2RpxiR;
+     ampl.fMinus3 = 0.;
+     ampl.fPlus3  = 0.;
+     ampl.f0Minus = -a+b;
+     ampl.f0Plus  = -a-b;
      break;
    }
    case (kF17_1970) :
    {
-     fAmpl.fMinus1 = 0.;
-     fAmpl.fPlus1  = 0.;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = 0.;
-     fAmpl.f0Plus  = 0.;
+     ampl.fMinus1 = 0.;
+     ampl.fPlus1  = 0.;
+     ampl.fMinus3 = 0.;
+     ampl.fPlus3  = 0.;
+     ampl.f0Minus = 0.;
+     ampl.f0Plus  = 0.;
      break;
    }
    default:
    {
      LOG("RSHAmpl", pWARN) << "*** UNRECOGNIZED RESONANCE!";
-     fAmpl.fMinus1 = 0.;
-     fAmpl.fPlus1  = 0.;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = 0.;
-     fAmpl.f0Plus  = 0.;
+     ampl.fMinus1 = 0.;
+     ampl.fPlus1  = 0.;
+     ampl.fMinus3 = 0.;
+     ampl.fPlus3  = 0.;
+     ampl.f0Minus = 0.;
+     ampl.f0Plus  = 0.;
      break;
    }
 
   }//switch
 
-  return fAmpl;
+  return ampl;
 }
 //____________________________________________________________________________
 void RSHelicityAmplModelNCn::Configure(const Registry & config)
@@ -44,8 +44,6 @@ public:
 private:
   void LoadConfig(void);
 
-  mutable RSHelicityAmpl fAmpl;
-
   double fSin28w;
 };
 
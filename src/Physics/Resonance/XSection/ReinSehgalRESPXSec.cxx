@@ -21,10 +21,21 @@
    Pick nutau/nutaubar scaling factors from new location.
  @ May 01, 2016 - Libo Jiang
    Add W dependence to Delta->N gamma
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added the optional (W, Q2) grids of the helicity amplitudes (see
+   RES-HAmplGrid), checked against the analytic result when built.
+   Added the option to use the tabulated Breit-Wigner functions (see
+   BreitWignerTable).
+   Added IntegralBatch(), handing the knots of a spline to the integrator
+   as a batch.
 
 */
 //____________________________________________________________________________
 
+#include <atomic>
+#include <map>
+#include <vector>
+
 #include <TMath.h>
 #include <TSystem.h>
 
@@ -55,12 +66,45 @@
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace {
+  // |helicity amplitude|^2 sums (sig_{L,R,S} without the kinematical
+  // factors) on a grid uniform in W and sqrt(Q2), for a resonance, current
+  // & hit nucleon
+  struct HAmplGrid {
+    HAmplGrid() : valid(false), nW(0), nQ(0), Wmin(0), dW(0), dQ(0) { }
+    bool   valid;
+    int    nW, nQ;
+    double Wmin, dW, dQ;
+    std::vector<double> ampl2[3]; // L, R, S at the nW x nQ nodes
+  };
+  // the grids of each cross section algorithm, kept per thread as they are
+  // built during event generation, and dropped when it is re-configured
+  struct HAmplGridSet {
+    HAmplGridSet() : id(0) { }
+    unsigned long           id;
+    std::map<int,HAmplGrid> grids;
+  };
+  thread_local std::map<const ReinSehgalRESPXSec *, HAmplGridSet> gHAmplGrids;
+  std::atomic<unsigned long> gHAmplGridNextId(1);
+
+  double Interpolate(const HAmplGrid & g, int i, double fw, int j, double fq,
+                     int k)
+  {
+    const std::vector<double> & a = g.ampl2[k];
+    int n = g.nQ;
+    return (1-fw)*(1-fq) * a[ i   *n + j] + (1-fw)*fq * a[ i   *n + j+1]
+         +    fw *(1-fq) * a[(i+1)*n + j] +    fw *fq * a[(i+1)*n + j+1];
+  }
+}
 //____________________________________________________________________________
 ReinSehgalRESPXSec::ReinSehgalRESPXSec() :
 XSecAlgorithmI("genie::ReinSehgalRESPXSec")
 {
   fNuTauRdSpl    = 0;
   fNuTauBarRdSpl = 0;
+  fUseHAmplGrid  = false;
+  fHAmplGridId   = 0;
 }
 //____________________________________________________________________________
 ReinSehgalRESPXSec::ReinSehgalRESPXSec(string config) :
@@ -68,12 +112,16 @@ XSecAlgorithmI("genie::ReinSehgalRESPXSec", config)
 {
   fNuTauRdSpl    = 0;
   fNuTauBarRdSpl = 0;
+  fUseHAmplGrid  = false;
+  fHAmplGridId   = 0;
 }
 //____________________________________________________________________________
 ReinSehgalRESPXSec::~ReinSehgalRESPXSec()
 {
   if(fNuTauRdSpl)    delete fNuTauRdSpl;
   if(fNuTauBarRdSpl) delete fNuTauBarRdSpl;
+
+  gHAmplGrids.erase(this);
 }
 //____________________________________________________________________________
 double ReinSehgalRESPXSec::XSec(
@@ -163,65 +211,32 @@ double ReinSehgalRESPXSec::XSec(
      << "Kinematical params V = " << V << ", U = " << U;
 #endif
 
-  // Calculate the Feynman-Kislinger-Ravndall parameters
-
-  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
-  double GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
-  double GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
-
-  if(is_EM) { 
-    GA = 0.; // zero the axial term for EM scattering
-  }
-
-  double d      = TMath::Power(W+Mnuc,2.) - q2;
-  double sq2omg = TMath::Sqrt(2./fOmega);
-  double nomg   = IR * fOmega;
-  double mq_w   = Mnuc*Q/W;
-
-  fFKR.Lamda  = sq2omg * mq_w;
-  fFKR.Tv     = GV / (3.*W*sq2omg);
-  fFKR.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
-  fFKR.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
-  fFKR.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
-  fFKR.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
-  fFKR.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
-  fFKR.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
-  fFKR.R      = fFKR.Rv;
-  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
-  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
-  fFKR.T      = fFKR.Tv;
-  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
-  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("FKR", pDEBUG) 
-     << "FKR params for RES = " << resname << " : " << fFKR;
-#endif
-
   // Calculate the Rein-Sehgal Helicity Amplitudes
 
   const RSHelicityAmplModelI * hamplmod = 0;
+  int imodel = -1;
   if(is_CC) { 
-    hamplmod = fHAmplModelCC; 
+    hamplmod = fHAmplModelCC; imodel = 0;
   }
   else 
   if(is_NC) { 
-    if (is_p) { hamplmod = fHAmplModelNCp;}
-    else      { hamplmod = fHAmplModelNCn;}
+    if (is_p) { hamplmod = fHAmplModelNCp; imodel = 1;}
+    else      { hamplmod = fHAmplModelNCn; imodel = 2;}
   }
   else 
   if(is_EM) { 
-    if (is_p) { hamplmod = fHAmplModelEMp;}
-    else      { hamplmod = fHAmplModelEMn;}
+    if (is_p) { hamplmod = fHAmplModelEMp; imodel = 3;}
+    else      { hamplmod = fHAmplModelEMn; imodel = 4;}
   }
   assert(hamplmod);
-  
-  const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fFKR); 
 
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("RSHAmpl", pDEBUG)
-     << "Helicity Amplitudes for RES = " << resname << " : " << hampl;
-#endif
+  double ampl2L = 0, ampl2R = 0, ampl2S = 0;
+  bool from_grid = fUseHAmplGrid && this->HelicityAmpl2FromGrid(
+     resonance, imodel, hamplmod, is_EM, W, q2, Mnuc, ampl2L, ampl2R, ampl2S);
+  if(!from_grid) {
+     this->HelicityAmpl2(
+        resonance, hamplmod, is_EM, W, q2, Mnuc, ampl2L, ampl2R, ampl2S);
+  }
 
   double g2 = kGF2;
   if(is_CC) g2 = kGF2*fVud2;
@@ -245,9 +260,9 @@ double ReinSehgalRESPXSec::XSec(
   double sig0 = 0.125*(g2/kPi)*(-q2/Q2)*(W/Mnuc);
   double scLR = W/Mnuc;
   double scS  = (Mnuc/W)*(-Q2/q2);
-  double sigL = scLR* (hampl.Amp2Plus3 () + hampl.Amp2Plus1 ());
-  double sigR = scLR* (hampl.Amp2Minus3() + hampl.Amp2Minus1());
-  double sigS = scS * (hampl.Amp20Plus () + hampl.Amp20Minus());
+  double sigL = scLR* ampl2L;
+  double sigR = scLR* ampl2R;
+  double sigS = scS * ampl2S;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("ReinSehgalRes", pDEBUG) << "sig_{0} = " << sig0;
@@ -278,10 +293,12 @@ double ReinSehgalRESPXSec::XSec(
   if(fWghtBW) {
      //different Delta photon decay branch
      if(is_delta){
-     bw = utils::bwfunc::BreitWignerLGamma(W,LR,MR,WR,NR); 
+     bw = fTabBW ? utils::bwfunc::BreitWignerLGammaTab(W,LR,MR,WR,NR) :
+                   utils::bwfunc::BreitWignerLGamma   (W,LR,MR,WR,NR);
      }
      else{
-     bw = utils::bwfunc::BreitWignerL(W,LR,MR,WR,NR); 
+     bw = fTabBW ? utils::bwfunc::BreitWignerLTab(W,LR,MR,WR,NR) :
+                   utils::bwfunc::BreitWignerL   (W,LR,MR,WR,NR);
      }
   } 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -394,12 +411,185 @@ double ReinSehgalRESPXSec::XSec(
   return xsec;
 }
 //____________________________________________________________________________
+void ReinSehgalRESPXSec::HelicityAmpl2(
+    Resonance_t resonance, const RSHelicityAmplModelI * hamplmod,
+    bool is_EM, double W, double q2, double Mnuc,
+    double & ampl2L, double & ampl2R, double & ampl2S) const
+{
+  int    IR     = utils::res::ResonanceIndex(resonance);
+  double W2     = TMath::Power(W,    2);
+  double Mnuc2  = TMath::Power(Mnuc, 2);
+  double k      = 0.5 * (W2 - Mnuc2)/Mnuc;
+  double v      = k - 0.5 * q2/Mnuc;
+  double v2     = TMath::Power(v, 2);
+  double Q2     = v2 - q2;
+  double Q      = TMath::Sqrt(Q2);
+
+  // Calculate the Feynman-Kislinger-Ravndall parameters
+
+  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
+  double GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
+  double GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
+
+  if(is_EM) { 
+    GA = 0.; // zero the axial term for EM scattering
+  }
+
+  double d      = TMath::Power(W+Mnuc,2.) - q2;
+  double sq2omg = TMath::Sqrt(2./fOmega);
+  double nomg   = IR * fOmega;
+  double mq_w   = Mnuc*Q/W;
+
+  FKR fkr; // the FKR parameters at this kinematical point
+  fkr.Lamda  = sq2omg * mq_w;
+  fkr.Tv     = GV / (3.*W*sq2omg);
+  fkr.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
+  fkr.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
+  fkr.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
+  fkr.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
+  fkr.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
+  fkr.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
+  fkr.R      = fkr.Rv;
+  fkr.Rplus  = - (fkr.Rv + fkr.Ra);
+  fkr.Rminus = - (fkr.Rv - fkr.Ra);
+  fkr.T      = fkr.Tv;
+  fkr.Tplus  = - (fkr.Tv + fkr.Ta);
+  fkr.Tminus = - (fkr.Tv - fkr.Ta);
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("FKR", pDEBUG) 
+     << "FKR params for RES = " << utils::res::AsString(resonance)
+     << " : " << fkr;
+#endif
+
+  const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fkr); 
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("RSHAmpl", pDEBUG)
+     << "Helicity Amplitudes for RES = " << utils::res::AsString(resonance)
+     << " : " << hampl;
+#endif
+
+  ampl2L = hampl.Amp2Plus3 () + hampl.Amp2Plus1 ();
+  ampl2R = hampl.Amp2Minus3() + hampl.Amp2Minus1();
+  ampl2S = hampl.Amp20Plus () + hampl.Amp20Minus();
+}
+//____________________________________________________________________________
+bool ReinSehgalRESPXSec::HelicityAmpl2FromGrid(
+    Resonance_t resonance, int imodel, const RSHelicityAmplModelI * hamplmod,
+    bool is_EM, double W, double q2, double Mnuc,
+    double & ampl2L, double & ampl2R, double & ampl2S) const
+{
+  HAmplGridSet & gset = gHAmplGrids[this];
+  if(gset.id != fHAmplGridId) {
+    gset.grids.clear();
+    gset.id = fHAmplGridId;
+  }
+
+  // one grid per resonance, current & hit nucleon (mass)
+  int key = (10*(int)resonance + imodel) * 10 + ((Mnuc < kNucleonMass) ? 0 : 1);
+
+  std::map<int,HAmplGrid>::iterator it = gset.grids.find(key);
+  if(it == gset.grids.end()) {
+    HAmplGrid & g = gset.grids[key];
+
+    // the W range where the resonance cross section is non-zero
+    double Wmax = fHAmplGridWMax;
+    if(fNormBW) {
+      int    IR = utils::res::ResonanceIndex(resonance);
+      double MR = utils::res::Mass (resonance);
+      double WR = utils::res::Width(resonance);
+      double nw = fGnResMaxNWidths;
+      if      (IR==0) nw = TMath::Min(nw, fN0ResMaxNWidths);
+      else if (IR==2) nw = TMath::Min(nw, fN2ResMaxNWidths);
+      Wmax = TMath::Min(Wmax, MR + nw * WR);
+    }
+    g.nW   = TMath::Max(2, fHAmplGridNW);
+    g.nQ   = TMath::Max(2, fHAmplGridNQ2);
+    g.Wmin = Mnuc + kPionMass;
+    g.dW   = (Wmax - g.Wmin) / (g.nW - 1);
+    g.dQ   = TMath::Sqrt(fHAmplGridQ2Max) / (g.nQ - 1);
+    if(g.dW <= 0) return false;
+
+    for(int k = 0; k < 3; k++) g.ampl2[k].resize(g.nW * g.nQ);
+    double a[3];
+    for(int i = 0; i < g.nW; i++) {
+      double Wi = g.Wmin + i * g.dW;
+      for(int j = 0; j < g.nQ; j++) {
+        double Qj = j * g.dQ;
+        this->HelicityAmpl2(resonance, hamplmod, is_EM, Wi, -Qj*Qj, Mnuc,
+                            a[0], a[1], a[2]);
+        for(int k = 0; k < 3; k++) g.ampl2[k][i*g.nQ + j] = a[k];
+      }
+    }
+
+    // check the interpolation against the analytic result at the cell
+    // centres, relative to the largest value of each sum
+    double amax[3] = { 0, 0, 0 };
+    for(int k = 0; k < 3; k++) {
+      for(unsigned int n = 0; n < g.ampl2[k].size(); n++) {
+        amax[k] = TMath::Max(amax[k], TMath::Abs(g.ampl2[k][n]));
+      }
+    }
+    double maxdev = 0;
+    for(int i = 0; i < g.nW - 1; i++) {
+      double Wc = g.Wmin + (i+0.5) * g.dW;
+      for(int j = 0; j < g.nQ - 1; j++) {
+        double Qc = (j+0.5) * g.dQ;
+        this->HelicityAmpl2(resonance, hamplmod, is_EM, Wc, -Qc*Qc, Mnuc,
+                            a[0], a[1], a[2]);
+        for(int k = 0; k < 3; k++) {
+          if(amax[k] <= 0) continue;
+          double dev = TMath::Abs(Interpolate(g, i, 0.5, j, 0.5, k) - a[k]) /
+                       (TMath::Abs(a[k]) + 1E-3 * amax[k]);
+          maxdev = TMath::Max(maxdev, dev);
+        }
+      }
+    }
+    g.valid = (maxdev <= fHAmplGridTol);
+    if(g.valid) {
+      LOG("ReinSehgalRes", pNOTICE)
+        << "Built the helicity amplitude grid for RES = "
+        << utils::res::AsString(resonance) << " (current/nucleon: " << key%100
+        << ", W < " << Wmax << " GeV), max deviation: " << maxdev;
+    } else {
+      LOG("ReinSehgalRes", pWARN)
+        << "The helicity amplitude grid for RES = "
+        << utils::res::AsString(resonance) << " (current/nucleon: " << key%100
+        << ") deviates by " << maxdev << " > " << fHAmplGridTol
+        << " from the analytic result - Not using it";
+    }
+    it = gset.grids.find(key);
+  }
+
+  const HAmplGrid & g = it->second;
+  if(!g.valid) return false;
+
+  double xw = (W - g.Wmin) / g.dW;
+  double xq = TMath::Sqrt(TMath::Max(0., -q2)) / g.dQ;
+  if(xw < 0 || xw >= g.nW - 1 || xq >= g.nQ - 1) return false;
+
+  int i = (int) xw;
+  int j = (int) xq;
+  ampl2L = Interpolate(g, i, xw-i, j, xq-j, 0);
+  ampl2R = Interpolate(g, i, xw-i, j, xq-j, 1);
+  ampl2S = Interpolate(g, i, xw-i, j, xq-j, 2);
+  return true;
+}
+//____________________________________________________________________________
 double ReinSehgalRESPXSec::Integral(const Interaction * interaction) const
 {
   double xsec = fXSecIntegrator->Integrate(this,interaction);
   return xsec;
 }
 //____________________________________________________________________________
+void ReinSehgalRESPXSec::IntegralBatch(
+            const Interaction * const * in, size_t n, double * xsec) const
+{
+  if(fXSecIntegrator->IntegrateBatch(this, in, n, xsec)) return;
+  XSecAlgorithmI::IntegralBatch(in, n, xsec);
+}
+//____________________________________________________________________________
 bool ReinSehgalRESPXSec::ValidProcess(const Interaction * interaction) const
 {
   if(interaction->TestBit(kISkipProcessChk)) return true;
@@ -456,6 +646,7 @@ void ReinSehgalRESPXSec::LoadConfig(void)
 
   this->GetParamDef( "BreitWignerWeight", fWghtBW, true ) ;
   this->GetParamDef( "BreitWignerNorm",   fNormBW, true);
+  this->GetParamDef( "BreitWignerTable",  fTabBW,  false);
 
   double thw ;
   this->GetParam( "WeinbergAngle", thw ) ;
@@ -536,6 +727,16 @@ void ReinSehgalRESPXSec::LoadConfig(void)
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
   assert(fXSecIntegrator);
+
+  // tabulated helicity amplitudes; the grids of a previous configuration
+  // are dropped (in all threads) when they are next used
+  this->GetParamDef( "RES-HAmplGrid",           fUseHAmplGrid,   false  ) ;
+  this->GetParamDef( "RES-HAmplGrid-NW",        fHAmplGridNW,    150    ) ;
+  this->GetParamDef( "RES-HAmplGrid-NQ2",       fHAmplGridNQ2,   100    ) ;
+  this->GetParamDef( "RES-HAmplGrid-WMax",      fHAmplGridWMax,  4.0    ) ;
+  this->GetParamDef( "RES-HAmplGrid-Q2Max",     fHAmplGridQ2Max, 12.0   ) ;
+  this->GetParamDef( "RES-HAmplGrid-Tolerance", fHAmplGridTol,   1.0E-3 ) ;
+  fHAmplGridId = gHAmplGridNextId++;
 }
 //____________________________________________________________________________
 
@@ -8,6 +8,14 @@
 
           The computed cross section is the d^2 xsec/ dQ^2 dW \n
 
+          Optionally (RES-HAmplGrid), the squared helicity amplitude sums
+          entering the cross section are tabulated in (W, Q^2) for each
+          resonance, current & hit nucleon when first needed, and
+          interpolated rather than re-computing the FKR parameters and the
+          helicity amplitudes at each evaluation. Each grid is checked
+          against the analytic result when it is built, and it is dropped
+          (in favour of the analytic result) if it is not accurate enough.
+
           where \n
             \li \c Q^2 : momentum transfer ^ 2
             \li \c W   : invariant mass of the final state hadronic system
@@ -51,6 +59,8 @@ public:
   // implement the XSecAlgorithmI interface 
   double XSec         (const Interaction * i, KinePhaseSpace_t k) const;
   double Integral     (const Interaction * i) const;
+  void   IntegralBatch (const Interaction * const * in, size_t n,
+                        double * xsec) const;
   bool   ValidProcess (const Interaction * i) const;
 
   // overload the Algorithm::Configure() methods to load private data
@@ -62,7 +72,16 @@ private:
 
   void LoadConfig (void);
 
-  mutable FKR fFKR;
+  //! the |helicity amplitude|^2 sums giving sig_{L}, sig_{R} & sig_{S}
+  void HelicityAmpl2 (Resonance_t res, const RSHelicityAmplModelI * model,
+                      bool is_EM, double W, double q2, double Mnuc,
+                      double & ampl2L, double & ampl2R, double & ampl2S) const;
+  //! ... interpolated in the (res, current, hit nucleon) grid; false if the
+  //! point is outside the grid or the grid failed the accuracy check
+  bool HelicityAmpl2FromGrid (Resonance_t res, int imodel,
+                      const RSHelicityAmplModelI * model,
+                      bool is_EM, double W, double q2, double Mnuc,
+                      double & ampl2L, double & ampl2R, double & ampl2S) const;
 
   const RSHelicityAmplModelI * fHAmplModelCC;
   const RSHelicityAmplModelI * fHAmplModelNCp;
@@ -73,6 +92,7 @@ private:
   // configuration data
   bool     fWghtBW;            ///< weight with resonance breit-wigner?
   bool     fNormBW;            ///< normalize resonance breit-wigner to 1?
+  bool     fTabBW;             ///< use the tabulated breit-wigner functions?
   double   fZeta;              ///< FKR parameter Zeta
   double   fOmega;             ///< FKR parameter Omega
   double   fMa2;               ///< (axial mass)^2
@@ -92,6 +112,13 @@ private:
   Spline * fNuTauBarRdSpl;     ///< xsec reduction spline for nu_tau_bar
   double   fXSecScaleCC;       ///< external CC xsec scaling factor
   double   fXSecScaleNC;       ///< external NC xsec scaling factor
+  bool     fUseHAmplGrid;      ///< interpolate the helicity amplitudes in a (W, Q2) grid?
+  int      fHAmplGridNW;       ///< number of grid W nodes
+  int      fHAmplGridNQ2;      ///< number of grid Q2 nodes (uniform in sqrt(Q2))
+  double   fHAmplGridWMax;     ///< grid W upper limit
+  double   fHAmplGridQ2Max;    ///< grid Q2 upper limit
+  double   fHAmplGridTol;      ///< max relative deviation from the analytic result
+  unsigned long fHAmplGridId;  ///< identifies the configuration the grids were built for
 
   const XSecIntegratorI * fXSecIntegrator;
 };
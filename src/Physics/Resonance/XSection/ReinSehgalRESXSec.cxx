@@ -104,8 +104,9 @@ double ReinSehgalRESXSec::Integrate(
     } else { 
       in->InitStatePtr()->TgtPtr()->SetId(kPdgTgtFreeN); 
     }
-    if(xsl->SplineExists(model,in)) {
-      const Spline * spl = xsl->GetSpline(model, in);
+    int spl_handle = xsl->GetSplineHandle(model, in);
+    if(spl_handle >= 0) {
+      const Spline * spl = xsl->GetSpline(spl_handle);
       double xsec = spl->Evaluate(Ev);
       SLOG("ReinSehgalResT", pNOTICE)  
          << "XSec[RES/" << utils::res::AsString(res)<< "/free] (Ev = " 
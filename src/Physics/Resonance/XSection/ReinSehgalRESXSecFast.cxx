@@ -100,8 +100,9 @@ double ReinSehgalRESXSecFast::Integrate(
     } else { 
       in->InitStatePtr()->TgtPtr()->SetId(kPdgTgtFreeN); 
     }
-    if(xsl->SplineExists(model,in)) {
-      const Spline * spl = xsl->GetSpline(model, in);
+    int spl_handle = xsl->GetSplineHandle(model, in);
+    if(spl_handle >= 0) {
+      const Spline * spl = xsl->GetSpline(spl_handle);
       double xsec = spl->Evaluate(Ev);
       SLOG("ReinSehgalResTF", pNOTICE)  
          << "XSec[RES/" << utils::res::AsString(res)<< "/free] (Ev = " 
@@ -217,6 +218,12 @@ void ReinSehgalRESXSecFast::LoadConfig(void)
   GetParamDef( "ESplineMax", fEMax, 100. ) ;
   fEMax = TMath::Max(fEMax, 20.); // don't accept user Emax if less than 20 GeV
 
+  // Integrate all resonances at the same {W,Q2} points
+  // (only for models deriving from BSKLNBaseRESPXSec2014)
+  GetParamDef( "FusedResonanceIntegration", fFusedIntegration, false ) ;
+  GetParamDef( "FusedIntegration-NW",  fFusedNW,  8  ) ;
+  GetParamDef( "FusedIntegration-NQ2", fFusedNQ2, 24 ) ;
+
   // Create the baryon resonance list specified in the config.
   fResList.Clear();
   string resonances ;
@@ -16,10 +16,13 @@
 
 #include <sstream>
 #include <cassert>
+#include <algorithm>
+#include <vector>
 
 #include <TMath.h>
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
+#include <Math/GaussLegendreIntegrator.h>
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
@@ -35,6 +38,7 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Physics/Resonance/XSection/ReinSehgalRESXSecWithCacheFast.h"
+#include "Physics/Resonance/XSection/BSKLNBaseRESPXSec2014.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/Cache.h"
@@ -57,19 +61,28 @@ using namespace genie::constants;
 
 //____________________________________________________________________________
 ReinSehgalRESXSecWithCacheFast::ReinSehgalRESXSecWithCacheFast() :
-XSecIntegratorI()
+XSecIntegratorI(),
+fFusedIntegration(false),
+fFusedNW(8),
+fFusedNQ2(24)
 {
 
 }
 //____________________________________________________________________________
 ReinSehgalRESXSecWithCacheFast::ReinSehgalRESXSecWithCacheFast(string nm) :
-XSecIntegratorI(nm)
+XSecIntegratorI(nm),
+fFusedIntegration(false),
+fFusedNW(8),
+fFusedNQ2(24)
 {
 
 }
 //____________________________________________________________________________
 ReinSehgalRESXSecWithCacheFast::ReinSehgalRESXSecWithCacheFast(string nm,string conf):
-XSecIntegratorI(nm,conf)
+XSecIntegratorI(nm,conf),
+fFusedIntegration(false),
+fFusedNW(8),
+fFusedNQ2(24)
 {
 
 }
@@ -89,6 +102,19 @@ void ReinSehgalRESXSecWithCacheFast::CacheResExcitationXSec(
   assert(fSingleResXSecModel);
 //  assert(fIntegrator);
 
+  // Integrate all resonances together if the model can evaluate them at once
+  if(fFusedIntegration) {
+    const BSKLNBaseRESPXSec2014 * fused_model =
+        dynamic_cast<const BSKLNBaseRESPXSec2014 *> (fSingleResXSecModel);
+    if(fused_model) {
+      this->CacheResExcitationXSecFused(in, fused_model);
+      return;
+    }
+    LOG("ReinSehgalResCF", pWARN)
+      << "No fused evaluation for " << fSingleResXSecModel->Id().Key()
+      << " - Integrating the resonances one at a time";
+  }
+
   // Compute the number of spline knots - use at least 10 knots per decade
   // && at least 40 knots in the full energy range
   const double Emin       = 0.01;
@@ -203,6 +229,179 @@ void ReinSehgalRESXSecWithCacheFast::CacheResExcitationXSec(
   delete interaction;
 }
 //____________________________________________________________________________
+void ReinSehgalRESXSecWithCacheFast::CacheResExcitationXSecFused(
+    const Interaction * in, const BSKLNBaseRESPXSec2014 * model) const
+{
+// Cache resonance neutrino production data from free nucleons, integrating
+// all resonances at the same set of kinematical points
+
+  Cache * cache = Cache::Instance();
+
+  // Same knots as in CacheResExcitationXSec()
+  const double Emin       = 0.01;
+  const int    nknots_min = (int) (10*(TMath::Log(fEMax)-TMath::Log(Emin)));
+  const int    nknots     = TMath::Max(100, nknots_min);
+  std::vector<double> E(nknots);
+
+  TLorentzVector p4(0,0,0,0);
+
+  int nu_code  = in->InitState().ProbePdg();
+  int nuc_code = in->InitState().Tgt().HitNucPdg();
+  int tgt_code = (nuc_code==kPdgProton) ? kPdgTgtFreeP : kPdgTgtFreeN;
+
+  Interaction * interaction = new Interaction(*in);
+  interaction->InitStatePtr()->SetPdgs(tgt_code, nu_code);
+  interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(nuc_code);
+
+  InteractionType_t wkcur = interaction->ProcInfo().InteractionTypeId();
+  unsigned int nres = fResList.NResonances();
+  if(nres == 0) {
+    delete interaction;
+    return;
+  }
+
+  std::vector<CacheBranchFx *> branches(nres);
+  for(unsigned int ires = 0; ires < nres; ires++) {
+     Resonance_t res = fResList.ResonanceId(ires);
+     string key = this->CacheBranchName(res, wkcur, nu_code, nuc_code);
+     assert(!cache->FindCacheBranch(key));
+     LOG("ReinSehgalResCF", pNOTICE)
+                    << "\n ** Creating cache branch - key = " << key;
+     branches[ires] = new CacheBranchFx("RES Excitation XSec");
+     cache->AddCacheBranch(key, branches[ires]);
+  }
+
+  // The RES phase space (and threshold) does not depend on the resonance
+  interaction->ExclTagPtr()->SetResonance(fResList.ResonanceId(0));
+  double Ethr = interaction->PhaseSpace().Threshold();
+  LOG("ReinSehgalResCF", pNOTICE) << "E threshold = " << Ethr;
+
+  int nkb = (Ethr>Emin) ? 5 : 0; // number of knots <  threshold
+  int nka = nknots-nkb;          // number of knots >= threshold
+  double dEb =  (Ethr>Emin) ? (Ethr - Emin) / nkb : 0;
+  for(int i=0; i<nkb; i++) {
+     E[i] = Emin + i*dEb;
+  }
+  double E0  = TMath::Max(Ethr,Emin);
+  double dEa = (TMath::Log10(fEMax) - TMath::Log10(E0)) /(nka-1);
+  for(int i=0; i<nka; i++) {
+     E[i+nkb] = TMath::Power(10., TMath::Log10(E0) + i * dEa);
+  }
+
+  std::vector<double> xsec(nres);
+  for(int ie=0; ie<nknots; ie++) {
+     double Ev = E[ie];
+     p4.SetPxPyPzE(0,0,Ev,Ev);
+     interaction->InitStatePtr()->SetProbeP4(p4);
+
+     std::fill(xsec.begin(), xsec.end(), 0.);
+     if(Ev>Ethr+kASmallNum) {
+        LOG("ReinSehgalResCF", pINFO)
+          << "*** Integrating d^2 XSec/dWdQ^2 for all resonances at Ev = " << Ev;
+        this->FusedIntegral(model, interaction, &xsec[0]);
+     } else {
+        LOG("ReinSehgalResCF", pINFO)
+              << "** Below threshold E = " << Ev << " <= " << Ethr;
+     }
+     for(unsigned int ires = 0; ires < nres; ires++) {
+        branches[ires]->AddValues(Ev,xsec[ires]);
+        SLOG("ReinSehgalResCF", pNOTICE)
+          << "RES XSec (R:" << utils::res::AsString(fResList.ResonanceId(ires))
+          << ", E="<< Ev << ") = "<< xsec[ires]/(1E-38 *genie::units::cm2)
+          << " x 1E-38 cm^2";
+     }
+  }//spline knots
+
+  for(unsigned int ires = 0; ires < nres; ires++) {
+     branches[ires]->CreateSpline();
+  }
+
+  delete interaction;
+}
+//____________________________________________________________________________
+void ReinSehgalRESXSecWithCacheFast::FusedIntegral(
+    const BSKLNBaseRESPXSec2014 * model, Interaction * interaction,
+    double * xsec) const
+{
+// Integrate d2xsec/dWdQ2 of all resonances over the {W,Q2} phase space.
+// W is split into panels at the peak, +/-1 and +/-2 widths and the W cut of
+// each resonance, each integrated with fFusedNW Gauss-Legendre points.
+// Q2 is integrated in ln(Q2) with fFusedNQ2 Gauss-Legendre points.
+
+  unsigned int nres = fResList.NResonances();
+  for(unsigned int ires = 0; ires < nres; ires++) xsec[ires] = 0.;
+
+  KPhaseSpace * kps = interaction->PhaseSpacePtr();
+  Range1D_t Wl = kps->WLim();
+  double Wmin = Wl.min;
+  double Wmax = Wl.max;
+
+  // same W limits as d2XSecRESFast_dWQ2_E
+  Registry config = model->GetConfig();
+  if(config.GetBool("UseDRJoinScheme")) {
+     Wmax = TMath::Min(Wmax, config.GetDouble("Wcut"));
+  }
+  bool   norm_bw = config.GetBoolDef  ("BreitWignerNorm",   true);
+  double n2nw    = config.GetDoubleDef("MaxNWidthForN2Res", 2.0);
+  double n0nw    = config.GetDoubleDef("MaxNWidthForN0Res", 6.0);
+  double gnnw    = config.GetDoubleDef("MaxNWidthForGNRes", 4.0);
+
+  std::vector<double> edges;
+  double Wcutmax = 0;
+  for(unsigned int ires = 0; ires < nres; ires++) {
+     Resonance_t res = fResList.ResonanceId(ires);
+     int    IR = utils::res::ResonanceIndex(res);
+     double MR = utils::res::Mass (res);
+     double WR = utils::res::Width(res);
+     for(int m = -2; m <= 2; m++) edges.push_back(MR + m*WR);
+     double NW = (IR==0) ? n0nw : ((IR==2) ? n2nw : gnnw);
+     edges.push_back(MR + NW*WR);
+     Wcutmax = TMath::Max(Wcutmax, MR + NW*WR);
+  }
+  if(norm_bw) Wmax = TMath::Min(Wmax, Wcutmax);
+  if(Wmax <= Wmin) return;
+
+  edges.push_back(Wmin);
+  edges.push_back(Wmax);
+  std::sort(edges.begin(), edges.end());
+
+  std::vector<double> xw(fFusedNW),  ww(fFusedNW);
+  std::vector<double> xq(fFusedNQ2), wq(fFusedNQ2);
+  ROOT::Math::GaussLegendreIntegrator glw(fFusedNW);
+  ROOT::Math::GaussLegendreIntegrator glq(fFusedNQ2);
+  glw.GetWeightVectors(&xw[0], &ww[0]);
+  glq.GetWeightVectors(&xq[0], &wq[0]);
+
+  std::vector<double> dxsec(nres);
+  double Wlow = Wmin;
+  for(unsigned int iedge = 0; iedge < edges.size(); iedge++) {
+     double Wup = edges[iedge];
+     if(Wup <= Wlow) continue;
+     if(Wup >  Wmax) break;
+     double Wmid  = 0.5*(Wup + Wlow);
+     double Whalf = 0.5*(Wup - Wlow);
+     for(int iw = 0; iw < fFusedNW; iw++) {
+        double W  = Wmid + Whalf*xw[iw];
+        interaction->KinePtr()->SetW(W);
+        Range1D_t Q2l = kps->Q2Lim_W();
+        if(Q2l.min <= 0 || Q2l.max <= Q2l.min) continue;
+        double lnQ2mid  = 0.5*(TMath::Log(Q2l.max) + TMath::Log(Q2l.min));
+        double lnQ2half = 0.5*(TMath::Log(Q2l.max) - TMath::Log(Q2l.min));
+        for(int iq = 0; iq < fFusedNQ2; iq++) {
+           double Q2 = TMath::Exp(lnQ2mid + lnQ2half*xq[iq]);
+           interaction->KinePtr()->SetQ2(Q2);
+           model->FusedXSec(interaction, kPSWQ2fE, fResList, &dxsec[0]);
+           double wgt = Whalf*ww[iw] * lnQ2half*wq[iq] * Q2;
+           for(unsigned int ires = 0; ires < nres; ires++) {
+              xsec[ires] += wgt * dxsec[ires];
+           }
+        }
+     }
+     Wlow = Wup;
+  }
+  interaction->KinePtr()->ClearRunningValues();
+}
+//____________________________________________________________________________
 string ReinSehgalRESXSecWithCacheFast::CacheBranchName(
      Resonance_t res, InteractionType_t it, int nupdgc, int nucleonpdgc) const
 {
@@ -9,6 +9,12 @@
           spline construction phase). This class integrates cross sections faster,
           than ReinSehgalRESXSecWithCache because of integration area transformation. 
 
+          With a BSKLNBaseRESPXSec2014 model and the FusedResonanceIntegration
+          option, the cross sections of all the resonances are integrated
+          together, with a fixed Gauss-Legendre rule in W (panels split at the
+          resonance peaks, widths and W cuts) and ln(Q2), using FusedXSec()
+          at each integration point.
+
 \ref      D.Rein and L.M.Sehgal, Neutrino Excitation of Baryon Resonances
           and Single Pion Production, Ann.Phys.133, 79 (1981)
 
@@ -39,6 +45,8 @@
 
 namespace genie {
 
+class BSKLNBaseRESPXSec2014;
+
 class ReinSehgalRESXSecWithCacheFast : public XSecIntegratorI {
 
 protected:
@@ -50,11 +58,18 @@ protected:
   // Don't implement the XSecIntegratorI interface - leave it for the concrete
   // subclasses. Just define utility methods and data
   void   CacheResExcitationXSec (const Interaction * interaction) const;
+  void   CacheResExcitationXSecFused (const Interaction * interaction,
+                                      const BSKLNBaseRESPXSec2014 * model) const;
+  void   FusedIntegral (const BSKLNBaseRESPXSec2014 * model, Interaction * interaction,
+                        double * xsec) const;
   string CacheBranchName(Resonance_t r, InteractionType_t it, int nu, int nuc) const;
 
   bool   fUsingDisResJoin;
   double fWcut;
   double fEMax;
+  bool   fFusedIntegration; ///< integrate all resonances together?
+  int    fFusedNW;          ///< Gauss-Legendre points per W panel
+  int    fFusedNQ2;         ///< Gauss-Legendre points in ln(Q2)
 
   mutable const XSecAlgorithmI * fSingleResXSecModel;
   BaryonResList fResList;
@@ -10,10 +10,15 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Keep the single resonance cross sections of the last sum per thread,
+   for the resonance selection (see ResXSecAtLastKinematics()).
 
 */
 //____________________________________________________________________________
 
+#include <map>
+
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
@@ -26,9 +31,29 @@
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Physics/Resonance/XSection/ReinSehgalSPPPXSec.h"
 
+using std::map;
+
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace {
+  // the single resonance cross sections of the last sum computed by each
+  // algorithm, with the interaction & kinematics they were computed for:
+  // kept per thread, as the interaction objects are
+  struct LastResXSec {
+    LastResXSec() : valid(false), interaction(0), kps(kPSNull),
+                    channel(kSppNull), E(0), W(0), Q2(0) { }
+    bool                valid;
+    const Interaction * interaction;
+    KinePhaseSpace_t    kps;
+    SppChannel_t        channel;
+    double              E, W, Q2;
+    vector<Resonance_t> res;
+    vector<double>      xsec;
+  };
+  thread_local map<const ReinSehgalSPPPXSec *, LastResXSec> gLastResXSec;
+}
 //____________________________________________________________________________
 ReinSehgalSPPPXSec::ReinSehgalSPPPXSec() :
 XSecAlgorithmI("genie::ReinSehgalSPPPXSec")
@@ -44,12 +69,14 @@ XSecAlgorithmI("genie::ReinSehgalSPPPXSec", config)
 //____________________________________________________________________________
 ReinSehgalSPPPXSec::~ReinSehgalSPPPXSec()
 {
-
+  gLastResXSec.erase(this);
 }
 //____________________________________________________________________________
 double ReinSehgalSPPPXSec::XSec(
                  const Interaction * interaction, KinePhaseSpace_t kps) const
 {
+  gLastResXSec[this].valid = false;
+
   if(! this -> ValidProcess    (interaction) ) return 0.;
   if(! this -> ValidKinematics (interaction) ) return 0.;
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -101,7 +128,19 @@ double ReinSehgalSPPPXSec::XSecNRES(
   LOG("ReinSehgalSpp", pDEBUG)
               << "SPP channel " << SppChannel::AsString(spp_channel);
 #endif
-              
+
+  //-- Keep the single resonance cross sections for the resonance selection
+  const Kinematics & kine = interaction->Kine();
+  LastResXSec & last = gLastResXSec[this];
+  last.interaction = interaction;
+  last.kps         = kps;
+  last.channel     = spp_channel;
+  last.E           = interaction->InitState().ProbeE(kRfHitNucRest);
+  last.W           = kine.W();
+  last.Q2          = kine.Q2();
+  last.res .resize(nres);
+  last.xsec.resize(nres);
+
   double xsec = 0;
   for(unsigned int ires = 0; ires < nres; ires++) {
 
@@ -120,7 +159,11 @@ double ReinSehgalSPPPXSec::XSecNRES(
 
 	 //-- Compute the weighted xsec
 	 //  (total weight = Breit-Wigner * BR * isospin Clebsch-Gordon)
-	 double res_xsec_contrib = fSingleResXSecModel->XSec(interaction,kps)*br*igg;
+	 double rxsec = fSingleResXSecModel->XSec(interaction,kps);
+	 double res_xsec_contrib = rxsec*br*igg;
+
+	 last.res [ires] = res;
+	 last.xsec[ires] = rxsec;
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 	 LOG("ReinSehgalSpp", pDEBUG)
      << "Contrib. from [" << utils::res::AsString(res) << "] = "
@@ -137,9 +180,45 @@ double ReinSehgalSPPPXSec::XSecNRES(
   //-- delete the resonance from the input interaction
   interaction->ExclTagPtr()->SetResonance(kNoResonance);
 
+  last.valid = true;
+
   return xsec;
 }
 //____________________________________________________________________________
+bool ReinSehgalSPPPXSec::ResXSecAtLastKinematics(
+          const Interaction * interaction, KinePhaseSpace_t kps,
+            const BaryonResList & resonances, vector<double> & xsec) const
+{
+  map<const ReinSehgalSPPPXSec *, LastResXSec>::const_iterator iter =
+                                                     gLastResXSec.find(this);
+  if(iter == gLastResXSec.end()) return false;
+
+  const LastResXSec & last = iter->second;
+  if(!last.valid) return false;
+
+  //-- The sum must have been computed for the same interaction & kinematics
+  const Kinematics & kine = interaction->Kine();
+  if(last.interaction != interaction ||
+     last.kps         != kps         ||
+     last.E  != interaction->InitState().ProbeE(kRfHitNucRest) ||
+     last.W  != kine.W()  ||
+     last.Q2 != kine.Q2() ||
+     last.channel != SppChannel::FromInteraction(interaction)) return false;
+
+  //-- Look-up the input resonances
+  unsigned int nres = resonances.NResonances();
+  vector<double> res_xsec(nres);
+  for(unsigned int ires = 0; ires < nres; ires++) {
+     Resonance_t res = resonances.ResonanceId(ires);
+     unsigned int i = 0;
+     while(i < last.res.size() && last.res[i] != res) i++;
+     if(i == last.res.size()) return false;
+     res_xsec[ires] = last.xsec[i];
+  }
+  xsec.swap(res_xsec);
+  return true;
+}
+//____________________________________________________________________________
 double ReinSehgalSPPPXSec::Integral(const Interaction * interaction) const
 {
   return fXSecIntegrator->Integrate(this,interaction);
@@ -27,6 +27,11 @@
           the weighted resonance production cross sections rather than the
           resonance production amplitudes.
 
+          The single resonance cross sections computed for the sum are kept
+          per thread, so that the resonance selection at the generated
+          kinematics (see RSPPResonanceSelector) does not have to compute
+          them again, see ResXSecAtLastKinematics().
+
           Is a concrete implementation of the XSecAlgorithmI interface.
 
 \ref      D.Rein and L.M.Sehgal, Neutrino Excitation of Baryon Resonances
@@ -46,9 +51,13 @@
 #ifndef _REIN_SEHGAL_EXCLUSIVE_SPP_PXSEC_H_
 #define _REIN_SEHGAL_EXCLUSIVE_SPP_PXSEC_H_
 
+#include <vector>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/ParticleData/BaryonResList.h"
 
+using std::vector;
+
 namespace genie {
 
 class XSecIntegratorI;
@@ -64,6 +73,14 @@ public:
   double XSec            (const Interaction * i, KinePhaseSpace_t k) const;
   double Integral        (const Interaction * i) const;
   bool   ValidProcess    (const Interaction * i) const;
+
+  //-- the single resonance cross sections (not weighted by the BR and the
+  //   isospin Clebsch-Gordon coefficient) of the input resonances, as
+  //   computed by the last XSec() sum of this thread; false (and the
+  //   xsec vector left untouched) if that sum was not computed for the
+  //   input interaction, kinematics & phase space or misses a resonance
+  bool ResXSecAtLastKinematics (const Interaction * i, KinePhaseSpace_t k,
+                 const BaryonResList & resonances, vector<double> & xsec) const;
 	
   //-- overload the Algorithm::Configure() methods to load private data
   //   members from configuration options
@@ -112,7 +112,7 @@ void SKHadronicSystemGenerator::CalculateHadronicSystem_AtharSingleKaon(GHepReco
   //-- basic kinematic inputs
   double Mf    = (xcls_tag.NProtons()) ? kProtonMass : kNeutronMass; // there's only ever one nucleon
   double M     = pnuc4.M();  // Mass of the struck nucleon
-  double mk    = PDGLibrary::Instance()->Find(kaon_pdgc)->Mass(); // K+ and K0 mass are slightly different
+  double mk    = PDGLibrary::Instance()->Mass(kaon_pdgc); // K+ and K0 mass are slightly different
   double mk2   = TMath::Power(mk,2);
 
   //-- specific kinematic quantities
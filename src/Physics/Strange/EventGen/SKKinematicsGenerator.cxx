@@ -96,12 +96,12 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
   int leppdg = interaction->FSPrimLeptonPdg();
   const TLorentzVector pnuc4 = interaction->InitState().Tgt().HitNucP4(); // 4-momentum of struck nucleon in lab frame
   TVector3 beta = pnuc4.BoostVector();
-  TLorentzVector P4_nu = *(interaction->InitStatePtr()->GetProbeP4(kRfHitNucRest)); // struck nucleon rest frame
+  TLorentzVector P4_nu = interaction->InitStatePtr()->ProbeP4(kRfHitNucRest); // struck nucleon rest frame
 
   double enu = P4_nu.E(); // in nucleon rest frame
   int kaon_pdgc = interaction->ExclTag().StrangeHadronPdg();
-  double mk = PDGLibrary::Instance()->Find(kaon_pdgc)->Mass();
-  double ml = PDGLibrary::Instance()->Find(leppdg)->Mass();
+  double mk = PDGLibrary::Instance()->Mass(kaon_pdgc);
+  double ml = PDGLibrary::Instance()->Mass(leppdg);
 
   // Maximum possible kinetic energy
   const double Tkmax = enu - mk - ml;
@@ -145,6 +145,7 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
         LOG("SKKinematics", pWARN)
              << "*** Could not select a valid (tk, tl, costhetal) triplet after "
                                                << iter << " iterations";
+        this->CountKineThrows(interaction, iter, false);
         evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
         genie::exceptions::EVGThreadException exception;
         exception.SetReason("Couldn't select kinematics");
@@ -213,6 +214,7 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        this->CountKineThrows(interaction, iter, true);
 
         // calculate the stuff
 
@@ -273,8 +275,8 @@ double SKKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
   int leppdg = in->FSPrimLeptonPdg();
   double enu = in->InitState().ProbeE(kRfHitNucRest); // Enu in nucleon rest frame
   int kaon_pdgc = in->ExclTag().StrangeHadronPdg();
-  double mk = PDGLibrary::Instance()->Find(kaon_pdgc)->Mass();
-  double ml = PDGLibrary::Instance()->Find(leppdg)->Mass();
+  double mk = PDGLibrary::Instance()->Mass(kaon_pdgc);
+  double ml = PDGLibrary::Instance()->Mass(leppdg);
 
   const double Tkmax = enu - mk - ml;
   const double Tlmax = enu - mk - ml;
@@ -368,6 +370,9 @@ void SKKinematicsGenerator::LoadConfig(void)
 {
   // max xsec safety factor (for rejection method) and min cached energy
   this->GetParamDef("MaxXSec-SafetyFactor", fSafetyFactor, 1.5);
+
+  // Tighten the max xsec online (adaptive safety factor)?
+  this->LoadAdaptiveSafetyFactorConfig();
   this->GetParamDef("Cache-MinEnergy",      fEMin,         0.6);
 
   // Generate kinematics uniformly over allowed phase space and compute
@@ -91,26 +91,26 @@ double AlamSimoAtharVacasSKPXSec2014::XSec(
   double phikq = kinematics.GetKV(kKVphikq);
 
   // Set lepton mass
-  aml = PDGLibrary::Instance()->Find(leptonPDG)->Mass(); // mutable
+  aml = PDGLibrary::Instance()->Mass(leptonPDG); // mutable
 
   double theta = TMath::ACos(costheta);
   
   // Set reaction parameters, which are mutables used in the matrix element calculations
   if (reactionType == 1) {
-    amSig = PDGLibrary::Instance()->Find(kPdgSigmaM)->Mass();
-    amk   = PDGLibrary::Instance()->Find(kPdgKP)->Mass();
+    amSig = PDGLibrary::Instance()->Mass(kPdgSigmaM);
+    amk   = PDGLibrary::Instance()->Mass(kPdgKP);
     ampi  = kPi0Mass;
     am    = kNeutronMass;
   }
   else if (reactionType == 2) {
-    amSig = PDGLibrary::Instance()->Find(kPdgSigma0)->Mass();
-    amk   = PDGLibrary::Instance()->Find(kPdgK0)->Mass();
+    amSig = PDGLibrary::Instance()->Mass(kPdgSigma0);
+    amk   = PDGLibrary::Instance()->Mass(kPdgK0);
     ampi  = kPionMass;
     am    = kNeutronMass;
   }
   else if (reactionType == 3) {
-    amSig = PDGLibrary::Instance()->Find(kPdgSigma0)->Mass();
-    amk   = PDGLibrary::Instance()->Find(kPdgKP)->Mass();
+    amSig = PDGLibrary::Instance()->Mass(kPdgSigma0);
+    amk   = PDGLibrary::Instance()->Mass(kPdgKP);
     ampi  = kPi0Mass;
     am    = kProtonMass;
   }
@@ -200,9 +200,9 @@ void AlamSimoAtharVacasSKPXSec2014::LoadConfig(void)
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
   assert(fXSecIntegrator);
   
-  amLam = PDGLibrary::Instance()->Find(kPdgLambda)->Mass();
+  amLam = PDGLibrary::Instance()->Mass(kPdgLambda);
   am = kNeutronMass; // this will be nucleon mass, set event by event
-  amEta = PDGLibrary::Instance()->Find(kPdgEta)->Mass();
+  amEta = PDGLibrary::Instance()->Mass(kPdgEta);
 
   GetParam( "CKM-Vus", Vus ) ;
   // fpi is 0.0924 in Athar's code, use the same one that is already in UserPhysicsOptions
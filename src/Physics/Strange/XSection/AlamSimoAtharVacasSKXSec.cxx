@@ -12,6 +12,7 @@
 //____________________________________________________________________________
 
 #include <TMath.h>
+#include <TSystem.h>
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
 #include "Math/AdaptiveIntegratorMultiDim.h"
@@ -34,6 +35,7 @@
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Numerical/GSLUtils.h"
 #include "Physics/Strange/XSection/AlamSimoAtharVacasSKXSec.h"
+#include "Physics/Strange/XSection/SKXSecTable.h"
 
 using namespace genie;
 using namespace genie::constants;
@@ -42,19 +44,24 @@ using namespace genie::utils;
 
 //____________________________________________________________________________
 AlamSimoAtharVacasSKXSec::AlamSimoAtharVacasSKXSec() :
-XSecIntegratorI("genie::AlamSimoAtharVacasSKXSec")
+XSecIntegratorI("genie::AlamSimoAtharVacasSKXSec"),
+fTable(0),
+fTableLoaded(false)
 {
 
 }
 //____________________________________________________________________________
 AlamSimoAtharVacasSKXSec::AlamSimoAtharVacasSKXSec(string config) :
-XSecIntegratorI("genie::AlamSimoAtharVacasSKXSec", config)
+XSecIntegratorI("genie::AlamSimoAtharVacasSKXSec", config),
+fTable(0),
+fTableLoaded(false)
 {
 
 }
 //____________________________________________________________________________
 AlamSimoAtharVacasSKXSec::~AlamSimoAtharVacasSKXSec()
 {
+  delete fTable;
 
 }
 //____________________________________________________________________________
@@ -89,8 +96,9 @@ double AlamSimoAtharVacasSKXSec::Integrate(
     Target * target = interaction->InitStatePtr()->TgtPtr();
     if(pdg::IsProton(nucpdgc)) { target->SetId(kPdgTgtFreeP); }
     else                       { target->SetId(kPdgTgtFreeN); }
-    if(xsl->SplineExists(model,interaction)) {
-      const Spline * spl = xsl->GetSpline(model, interaction);
+    int spl_handle = xsl->GetSplineHandle(model, interaction);
+    if(spl_handle >= 0) {
+      const Spline * spl = xsl->GetSpline(spl_handle);
       double xsec = spl->Evaluate(Ev);
       LOG("SKXSec", pINFO)
         << "From XSecSplineList: XSec[SK,free nucleon] (E = " << Ev << " GeV) = " << xsec;
@@ -108,9 +116,21 @@ double AlamSimoAtharVacasSKXSec::Integrate(
 
   // Check this
   double Enu = init_state.ProbeE(kRfLab);
+
+  // unless the free nucleon cross section is tabulated
+  const SKXSecTable * table = this->Table(model);
+  if(table) {
+    double xsec = 0;
+    if(table->XSec(table->FindChannel(in), Enu, xsec)) {
+      xsec *= NNucl * (1E-38 * units::cm2);
+      LOG("SKXSec", pINFO)
+        << "From SK cross section table: XSec[SK] (E = " << Enu << " GeV) = " << xsec;
+      return xsec;
+    }
+  }
   int kpdg = in->ExclTag().StrangeHadronPdg();
-  double mk   = PDGLibrary::Instance()->Find(kpdg)->Mass();
-  double ml   = PDGLibrary::Instance()->Find(in->FSPrimLeptonPdg())->Mass();
+  double mk   = PDGLibrary::Instance()->Mass(kpdg);
+  double ml   = PDGLibrary::Instance()->Mass(in->FSPrimLeptonPdg());
 
   // integration bounds for T (kinetic energy)
   double zero    = 0.0;
@@ -165,6 +185,34 @@ void AlamSimoAtharVacasSKXSec::LoadConfig(void)
   this->GetParamDef("gsl-max-evals",          fGSLMaxEval,    20000);
   this->GetParamDef("gsl-relative-tolerance", fGSLRelTol,     0.01);
   this->GetParamDef("split-integral",         fSplitIntegral, true);
+
+  delete fTable;
+  fTable       = 0;
+  fTableLoaded = false;
+}
+//____________________________________________________________________________
+const SKXSecTable * AlamSimoAtharVacasSKXSec::Table(
+                                     const XSecAlgorithmI * model) const
+{
+  if(fTableLoaded) return fTable;
+  fTableLoaded = true;
+
+  const char * filename = gSystem->Getenv("GSKXSECTABLE");
+  if(!filename) return 0;
+
+  fTable = new SKXSecTable;
+  if(!fTable->Read(filename)) {
+    delete fTable;
+    fTable = 0;
+  }
+  else if(!fTable->IsFromModel(model)) {
+    LOG("SKXSec", pWARN)
+      << "The SK cross section table " << filename << " was not made from "
+      << model->Id().Key() << " in its current configuration - Not used";
+    delete fTable;
+    fTable = 0;
+  }
+  return fTable;
 }
 //____________________________________________________________________________
 
@@ -8,6 +8,12 @@
           single-Kaon production model.
           Is a concrete implementation of the XSecIntegratorI interface.
 
+          If $GSKXSECTABLE names a precomputed free nucleon cross section
+          table (see SKXSecTable, made with gmkskxsectable) made from the
+          same model configuration, the cross section of the channels and
+          energies it covers is interpolated from the table instead of being
+          integrated.
+
 \author   Chris Marshall and Martti Nirkko
 
 \created  March 20, 2014
@@ -31,6 +37,7 @@ namespace genie {
 
 class XSecAlgorithmI;
 class Interaction;
+class SKXSecTable;
 
 class AlamSimoAtharVacasSKXSec : public XSecIntegratorI {
 public:
@@ -51,6 +58,12 @@ protected:
 
 private:
   void LoadConfig (void);
+
+  //! The $GSKXSECTABLE table, loaded on first use, if made from model
+  const SKXSecTable * Table (const XSecAlgorithmI * model) const;
+
+  mutable SKXSecTable * fTable;
+  mutable bool          fTableLoaded;
 };
 
 //_____________________________________________________________________________________
@@ -0,0 +1,393 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <TMath.h>
+#include <TSystem.h>
+
+#include "Framework/Algorithm/AlgId.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Registry/Registry.h"
+#include "Physics/Strange/XSection/AlamSimoAtharVacasSKXSec.h"
+#include "Physics/Strange/XSection/SKXSecTable.h"
+
+using namespace genie;
+
+namespace {
+
+  //! binary file header
+  struct SKXSecTableHeader
+  {
+    char               signature[8];   //!< kSKTableSignature
+    unsigned int       version;        //!< kSKTableVersion
+    unsigned int       nChannels;
+    unsigned int       nE;
+    unsigned int       nL;
+    unsigned int       nK;
+    unsigned int       nV;
+    double             eMin;
+    double             eMax;
+    double             vMin;
+    double             vMax;
+    unsigned long long modelHash;
+    unsigned int       modelKeyLength; //!< followed by the model key characters
+  };
+
+  const char         kSKTableSignature[8] = {'G','S','K','X','S','T','B','L'};
+  const unsigned int kSKTableVersion      = 1;
+
+  //! FNV-1a hash of text
+  unsigned long long HashText(const std::string & text)
+  {
+    unsigned long long hash = 14695981039346656037ULL;
+    for(std::string::size_type i = 0; i < text.size(); i++) {
+      hash ^= (unsigned char) text[i];
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+}
+
+// the v = ln(1-cos(theta_l)) integration range of AlamSimoAtharVacasSKXSec
+const double SKXSecTable::kVMin = -20.;
+const double SKXSecTable::kVMax = 0.69314718056;
+
+//____________________________________________________________________________
+SKXSecTable::SKXSecTable() :
+fNE(0),
+fEMin(0),
+fEMax(0),
+fNL(0),
+fNK(0),
+fNV(0),
+fModelKey(""),
+fModelHash(0)
+{
+
+}
+//____________________________________________________________________________
+SKXSecTable::~SKXSecTable()
+{
+
+}
+//____________________________________________________________________________
+void SKXSecTable::SetGrid(
+   int ne, double emin, double emax, int nl, int nk, int nv)
+{
+  if(ne < 2 || emin <= 0 || emax <= emin || nl < 1 || nk < 1 || nv < 1) {
+    LOG("SKXSecTable", pFATAL)
+      << "Invalid grid: " << ne << " energies in [" << emin << ", " << emax
+      << "] GeV, " << nl << " x " << nk << " x " << nv << " cells";
+    exit(1);
+  }
+  fNE   = ne;
+  fEMin = emin;
+  fEMax = emax;
+  fNL   = nl;
+  fNK   = nk;
+  fNV   = nv;
+
+  fProbe .clear();
+  fHitNuc.clear();
+  fKaon  .clear();
+  fXSec  .clear();
+  fValues.clear();
+}
+//____________________________________________________________________________
+std::string SKXSecTable::ModelKey(const XSecAlgorithmI * model)
+{
+  return model->Id().Key();
+}
+//____________________________________________________________________________
+unsigned long long SKXSecTable::ModelHash(const XSecAlgorithmI * model)
+{
+  std::ostringstream config;
+  config << ModelKey(model) << "\n" << model->GetConfig();
+  return HashText(config.str());
+}
+//____________________________________________________________________________
+void SKXSecTable::SetModel(const XSecAlgorithmI * model)
+{
+  fModelKey  = ModelKey (model);
+  fModelHash = ModelHash(model);
+}
+//____________________________________________________________________________
+bool SKXSecTable::IsFromModel(const XSecAlgorithmI * model) const
+{
+  return (fModelKey == ModelKey(model) && fModelHash == ModelHash(model));
+}
+//____________________________________________________________________________
+int SKXSecTable::FindChannel(const Interaction * in) const
+{
+  int probe  = in->InitState().ProbePdg();
+  int hitnuc = in->InitState().Tgt().HitNucPdg();
+  int kaon   = in->ExclTag().StrangeHadronPdg();
+
+  for(unsigned int ich = 0; ich < fProbe.size(); ich++) {
+    if(fProbe[ich] == probe && fHitNuc[ich] == hitnuc && fKaon[ich] == kaon) {
+      return ich;
+    }
+  }
+  return -1;
+}
+//____________________________________________________________________________
+int SKXSecTable::AddChannel(const Interaction * in)
+{
+  int ich = this->FindChannel(in);
+  if(ich >= 0) return ich;
+
+  fProbe .push_back(in->InitState().ProbePdg());
+  fHitNuc.push_back(in->InitState().Tgt().HitNucPdg());
+  fKaon  .push_back(in->ExclTag().StrangeHadronPdg());
+  fXSec  .resize(fXSec.size()   + fNE, 0.);
+  fValues.resize(fValues.size() + fNE * this->NCell(), 0.);
+
+  return fProbe.size() - 1;
+}
+//____________________________________________________________________________
+double SKXSecTable::E(int ie) const
+{
+  if(fNE < 2) return fEMin;
+  return fEMin * TMath::Power(fEMax/fEMin, double(ie)/(fNE-1));
+}
+//____________________________________________________________________________
+double SKXSecTable::DirectIntegrand(const XSecAlgorithmI * model,
+     Interaction * in, double E, double ul, double uk, double v)
+{
+  in->SetBit(kISkipProcessChk);
+  in->SetBit(kISkipKinematicChk);
+  in->InitStatePtr()->SetProbeE(E);
+
+  int    kpdg = in->ExclTag().StrangeHadronPdg();
+  double mk   = PDGLibrary::Instance()->Mass(kpdg);
+  double ml   = PDGLibrary::Instance()->Mass(in->FSPrimLeptonPdg());
+  double tmax = E - mk - ml;
+  if(tmax <= 0) return 0;
+
+  double Tl = ul * tmax;
+  double Tk = uk * (tmax - Tl);
+
+  // same integrand (phi_kq prescription, v Jacobian) as the integrator
+  utils::gsl::d3Xsec_dTldTkdCosThetal func(model, in);
+  double xin[3] = { Tl, Tk, v };
+  double g = func.DoEval(xin) * tmax * (tmax - Tl);
+
+  return TMath::Finite(g) ? g : 0;
+}
+//____________________________________________________________________________
+void SKXSecTable::Fill(int ich, int ie,
+     const XSecAlgorithmI * model, const Interaction * in)
+{
+  Interaction interaction(*in);
+
+  double E  = this->E(ie);
+  double dv = (kVMax - kVMin) / fNV;
+  double * values = &fValues[(ich * fNE + ie) * this->NCell()];
+
+  double sum = 0;
+  int icell = 0;
+  for(int il = 0; il < fNL; il++) {
+    double ul = (il + 0.5) / fNL;
+    for(int ik = 0; ik < fNK; ik++) {
+      double uk = (ik + 0.5) / fNK;
+      for(int iv = 0; iv < fNV; iv++, icell++) {
+        double v = kVMin + (iv + 0.5) * dv;
+        values[icell] = DirectIntegrand(model, &interaction, E, ul, uk, v);
+        sum += values[icell];
+      }
+    }
+  }
+  fXSec[ich * fNE + ie] = sum * dv / (fNL * fNK);
+}
+//____________________________________________________________________________
+double SKXSecTable::NodeXSec(int ich, int ie) const
+{
+  return fXSec[ich * fNE + ie];
+}
+//____________________________________________________________________________
+bool SKXSecTable::XSec(int ich, double E, double & xsec) const
+{
+  xsec = 0;
+  if(ich < 0 || ich >= this->NChannels()) return false;
+  if(E < fEMin || E > fEMax) return false;
+
+  double s = (fNE - 1) * TMath::Log(E/fEMin) / TMath::Log(fEMax/fEMin);
+  int    i = TMath::Min((int) s, fNE - 2);
+  double f = s - i;
+
+  double x0 = fXSec[ich * fNE + i];
+  double x1 = fXSec[ich * fNE + i + 1];
+  // near the threshold: left to the direct integration
+  if(x0 <= 0 || x1 <= 0) return false;
+
+  xsec = TMath::Exp((1-f) * TMath::Log(x0) + f * TMath::Log(x1));
+  return true;
+}
+//____________________________________________________________________________
+void SKXSecTable::Locate(double x, int n, int & i, double & f) const
+{
+// cell midpoint below x (x in [0,1] over n cells) and the fractional
+// distance to the next one, clamped to the midpoint range
+
+  double s = x * n - 0.5;
+  if(n < 2 || s <= 0) { i = 0; f = 0; return; }
+  if(s >= n - 1)      { i = n - 2; f = 1; return; }
+  i = (int) s;
+  f = s - i;
+}
+//____________________________________________________________________________
+double SKXSecTable::Integrand(
+   int ich, int ie, double ul, double uk, double v) const
+{
+  int il, ik, iv;
+  double fl, fk, fv;
+  this->Locate(ul, fNL, il, fl);
+  this->Locate(uk, fNK, ik, fk);
+  this->Locate((v - kVMin)/(kVMax - kVMin), fNV, iv, fv);
+
+  int kl = (fNL > 1) ? 1 : 0;
+  int kk = (fNK > 1) ? 1 : 0;
+  int kv = (fNV > 1) ? 1 : 0;
+
+  const double * values = &fValues[(ich * fNE + ie) * this->NCell()];
+
+  double g = 0;
+  for(int a = 0; a < 2; a++) {
+    double wl = a ? fl : 1-fl;
+    for(int b = 0; b < 2; b++) {
+      double wk = b ? fk : 1-fk;
+      for(int c = 0; c < 2; c++) {
+        double wv = c ? fv : 1-fv;
+        int icell = ((il + a*kl) * fNK + (ik + b*kk)) * fNV + (iv + c*kv);
+        g += wl * wk * wv * values[icell];
+      }
+    }
+  }
+  return g;
+}
+//____________________________________________________________________________
+bool SKXSecTable::Read(const std::string & filename)
+{
+  std::ifstream binary(filename.c_str(), std::ios::binary);
+  if(!binary.is_open()) {
+    LOG("SKXSecTable", pWARN) << "Can not open SK cross section table " << filename;
+    return false;
+  }
+
+  SKXSecTableHeader header;
+  binary.read((char*) &header, sizeof(header));
+
+  if(!binary || std::memcmp(header.signature, kSKTableSignature, 8) != 0 ||
+     header.version != kSKTableVersion || header.nE < 2 ||
+     header.nL < 1 || header.nK < 1 || header.nV < 1 ||
+     header.vMin != kVMin || header.vMax != kVMax)
+  {
+    LOG("SKXSecTable", pWARN)
+      << filename << " is not a valid SK cross section table";
+    return false;
+  }
+
+  std::string key(header.modelKeyLength, ' ');
+  if(header.modelKeyLength > 0) binary.read(&key[0], header.modelKeyLength);
+
+  unsigned int nch  = header.nChannels;
+  unsigned int ncel = header.nL * header.nK * header.nV;
+  std::vector<int>    channels(3 * nch);
+  std::vector<double> xsec    (nch * header.nE);
+  std::vector<double> values  (nch * header.nE * ncel);
+  if(nch > 0) {
+    binary.read((char*) &channels[0], channels.size() * sizeof(int));
+    binary.read((char*) &xsec[0],     xsec.size()     * sizeof(double));
+    binary.read((char*) &values[0],   values.size()   * sizeof(double));
+  }
+  if(!binary) {
+    LOG("SKXSecTable", pWARN) << "SK cross section table " << filename << " is corrupted";
+    return false;
+  }
+
+  this->SetGrid(header.nE, header.eMin, header.eMax, header.nL, header.nK, header.nV);
+  fModelKey  = key;
+  fModelHash = header.modelHash;
+  for(unsigned int ich = 0; ich < nch; ich++) {
+    fProbe .push_back(channels[3*ich  ]);
+    fHitNuc.push_back(channels[3*ich+1]);
+    fKaon  .push_back(channels[3*ich+2]);
+  }
+  fXSec  .swap(xsec);
+  fValues.swap(values);
+
+  LOG("SKXSecTable", pNOTICE)
+    << "Loaded SK cross section table " << filename << " (" << nch
+    << " channels, " << fNE << " energies in [" << fEMin << ", " << fEMax
+    << "] GeV, model " << fModelKey << ")";
+
+  return true;
+}
+//____________________________________________________________________________
+bool SKXSecTable::Write(const std::string & filename) const
+{
+  SKXSecTableHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.signature, kSKTableSignature, 8);
+  header.version        = kSKTableVersion;
+  header.nChannels      = fProbe.size();
+  header.nE             = fNE;
+  header.nL             = fNL;
+  header.nK             = fNK;
+  header.nV             = fNV;
+  header.eMin           = fEMin;
+  header.eMax           = fEMax;
+  header.vMin           = kVMin;
+  header.vMax           = kVMax;
+  header.modelHash      = fModelHash;
+  header.modelKeyLength = fModelKey.size();
+
+  std::vector<int> channels;
+  for(unsigned int ich = 0; ich < fProbe.size(); ich++) {
+    channels.push_back(fProbe [ich]);
+    channels.push_back(fHitNuc[ich]);
+    channels.push_back(fKaon  [ich]);
+  }
+
+  // written to a temporary file which is then renamed
+  std::ostringstream tmpname;
+  tmpname << filename << ".tmp." << gSystem->GetPid();
+
+  std::ofstream binary(tmpname.str().c_str(), std::ios::binary);
+  binary.write((const char*) &header, sizeof(header));
+  binary.write(fModelKey.data(), fModelKey.size());
+  if(!channels.empty()) {
+    binary.write((const char*) &channels[0], channels.size() * sizeof(int));
+    binary.write((const char*) &fXSec[0],    fXSec.size()    * sizeof(double));
+    binary.write((const char*) &fValues[0],  fValues.size()  * sizeof(double));
+  }
+  binary.close();
+
+  if(!binary || std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    LOG("SKXSecTable", pERROR) << "Couldn't write SK cross section table " << filename;
+    std::remove(tmpname.str().c_str());
+    return false;
+  }
+
+  LOG("SKXSecTable", pNOTICE) << "Saved SK cross section table to " << filename;
+  return true;
+}
+//____________________________________________________________________________
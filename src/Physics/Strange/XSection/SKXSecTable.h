@@ -0,0 +1,129 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::SKXSecTable
+
+\brief    Precomputed grid of the AlamSimoAtharVacasSKPXSec2014 differential
+          cross section, as integrated by AlamSimoAtharVacasSKXSec, and its
+          binary file.
+
+          For each single kaon channel (probe, hit nucleon and kaon) and each
+          node of a log-spaced grid of neutrino energies, the table holds the
+          integrand of AlamSimoAtharVacasSKXSec (the free nucleon cross
+          section, with phi_kq integrated out as in the integrator) on the
+          cell midpoints of a 3-D grid of the normalised variables
+             ul = Tl/Tmax, uk = Tk/(Tmax-Tl), v = ln(1-cos(theta_l)),
+          with Tmax = Ev - mk - ml, ul, uk in [0,1] and v in [kVMin,kVMax],
+          together with its midpoint rule integral (the cross section).
+          The integrand includes the Jacobian of the (ul, uk, v) variables,
+          so that it integrates to the cross section in 1E-38 cm^2.
+          Between the energy nodes, the cross section is interpolated as a
+          power law, and the integrand is interpolated trilinearly.
+
+          The table is made with the gmkskxsectable utility, which validates
+          it against the direct evaluation of the model. It records the model
+          algorithm id and a hash of its configuration, and can only be used
+          with the same model configuration.
+          The binary file uses the byte order of the machine writing it.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _SK_XSEC_TABLE_H_
+#define _SK_XSEC_TABLE_H_
+
+#include <string>
+#include <vector>
+
+namespace genie {
+
+class XSecAlgorithmI;
+class Interaction;
+
+class SKXSecTable {
+
+public:
+  SKXSecTable();
+ ~SKXSecTable();
+
+  //! Set the energy [GeV] and kinematical grids (clears the table)
+  void   SetGrid     (int ne, double emin, double emax, int nl, int nk, int nv);
+  //! Record the model the table is made from
+  void   SetModel    (const XSecAlgorithmI * model);
+  //! Check that the table was made from this model and configuration
+  bool   IsFromModel (const XSecAlgorithmI * model) const;
+
+  //! Add the channel of interaction in (no-op if already there); its index
+  int    AddChannel  (const Interaction * in);
+  //! Index of the channel of interaction in, or -1
+  int    FindChannel (const Interaction * in) const;
+
+  //! Fill the grid of channel ich at energy node ie by direct evaluation
+  //! of model, for the channel interaction in
+  void   Fill        (int ich, int ie, const XSecAlgorithmI * model, const Interaction * in);
+
+  //! Interpolated cross section [1E-38 cm^2] of channel ich at energy E;
+  //! false outside the energy nodes with a non-zero cross section
+  bool   XSec        (int ich, double E, double & xsec) const;
+  //! Interpolated integrand of channel ich at energy node ie
+  double Integrand   (int ich, int ie, double ul, double uk, double v) const;
+  //! Cross section [1E-38 cm^2] of channel ich at energy node ie
+  double NodeXSec    (int ich, int ie) const;
+
+  //! Direct evaluation of the tabulated integrand for interaction in
+  //! (whose kinematics is overwritten) at energy E
+  static double DirectIntegrand (const XSecAlgorithmI * model, Interaction * in,
+                                 double E, double ul, double uk, double v);
+
+  int    NChannels   (void) const { return fProbe.size(); }
+  int    NE          (void) const { return fNE; }
+  int    NL          (void) const { return fNL; }
+  int    NK          (void) const { return fNK; }
+  int    NV          (void) const { return fNV; }
+  double E           (int ie) const;
+  int    ProbePdg    (int ich) const { return fProbe[ich];  }
+  int    HitNucPdg   (int ich) const { return fHitNuc[ich]; }
+  int    KaonPdg     (int ich) const { return fKaon[ich];   }
+
+  bool   Read        (const std::string & filename);
+  bool   Write       (const std::string & filename) const;
+
+  static const double kVMin;
+  static const double kVMax;
+
+private:
+  SKXSecTable(const SKXSecTable & table);
+
+  static std::string        ModelKey  (const XSecAlgorithmI * model);
+  static unsigned long long ModelHash (const XSecAlgorithmI * model);
+
+  int  NCell  (void) const { return fNL * fNK * fNV; }
+  void Locate (double x, int n, int & i, double & f) const;
+
+  int    fNE;
+  double fEMin;
+  double fEMax;
+  int    fNL;
+  int    fNK;
+  int    fNV;
+
+  std::string        fModelKey;
+  unsigned long long fModelHash;
+
+  std::vector<int>    fProbe;   ///< probe pdg code per channel
+  std::vector<int>    fHitNuc;  ///< hit nucleon pdg code per channel
+  std::vector<int>    fKaon;    ///< kaon pdg code per channel
+  std::vector<double> fXSec;    ///< cross section per channel and energy node
+  std::vector<double> fValues;  ///< integrand per channel, energy node and (ul,uk,v) cell
+};
+
+}      // genie namespace
+
+#endif // _SK_XSEC_TABLE_H_
@@ -31,6 +31,36 @@
 
 using namespace genie;
 
+//____________________________________________________________________________
+genie::utils::gsl::XSecBatchInteractions::XSecBatchInteractions()
+{
+
+}
+genie::utils::gsl::XSecBatchInteractions::XSecBatchInteractions(
+    const XSecBatchInteractions &)
+{
+
+}
+genie::utils::gsl::XSecBatchInteractions::~XSecBatchInteractions()
+{
+  for(size_t j = 0; j < fCopies.size(); j++) delete fCopies[j];
+}
+Interaction ** genie::utils::gsl::XSecBatchInteractions::Get(
+    const Interaction * in, size_t n)
+{
+  while(fCopies.size() < n) fCopies.push_back(new Interaction);
+
+  // Interaction::Copy() does not carry the flags
+  const UInt_t flags[4] = { kISkipProcessChk, kISkipKinematicChk,
+                            kIAssumeFreeNucleon, kINoNuclearCorrection };
+  for(size_t j = 0; j < n; j++) {
+    fCopies[j]->Copy(*in);
+    for(int k = 0; k < 4; k++) {
+      fCopies[j]->SetBit(flags[k], in->TestBit(flags[k]));
+    }
+  }
+  return (n > 0) ? &fCopies[0] : 0;
+}
 //____________________________________________________________________________
 genie::utils::gsl::dXSec_dQ2_E::dXSec_dQ2_E(
     const XSecAlgorithmI * m, const Interaction * i) :
@@ -56,13 +86,17 @@ double genie::utils::gsl::dXSec_dQ2_E::DoEval(double xin) const
 //   differential cross section [10^-38 cm^2 / GeV^2]
 //
   double Q2 = xin;
-  fInteraction->KinePtr()->SetQ2(Q2);
+  this->SetKinematics(Q2);
   double xsec = fModel->XSec(fInteraction, kPSQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GSLXSecFunc", pDEBUG) << "xsec(Q2 = " << Q2 << ") = " << xsec;
 #endif
   return xsec/(1E-38 * units::cm2);
 }
+void genie::utils::gsl::dXSec_dQ2_E::SetKinematics(double Q2) const
+{
+  fInteraction->KinePtr()->SetQ2(Q2);
+}
 ROOT::Math::IBaseFunctionOneDim *
    genie::utils::gsl::dXSec_dQ2_E::Clone() const
 {
@@ -114,7 +148,8 @@ ROOT::Math::IBaseFunctionMultiDim(),
 fModel(m),
 fInteraction(i)
 {
-  
+  fEv = i->InitState().ProbeE(kRfHitNucRest);
+  fM  = i->InitState().Tgt().HitNucP4Ptr()->M();
 }
 genie::utils::gsl::d2XSec_dxdy_E::~d2XSec_dxdy_E()
 {
@@ -124,6 +159,17 @@ unsigned int genie::utils::gsl::d2XSec_dxdy_E::NDim(void) const
 {
   return 2;
 }
+void genie::utils::gsl::d2XSec_dxdy_E::SetKinematics(
+    const Interaction * in, const double * xin) const
+{
+  double x = xin[0];
+  double y = xin[1];
+  in->KinePtr()->Setx(x);
+  in->KinePtr()->Sety(y);
+  kinematics::KineConsts kc;
+  kinematics::SetKineConsts(fEv, fM, 0., kc);
+  kinematics::UpdateWQ2FromXY(kc, in);
+}
 double genie::utils::gsl::d2XSec_dxdy_E::DoEval(const double * xin) const
 {
 // inputs:  
@@ -132,14 +178,22 @@ double genie::utils::gsl::d2XSec_dxdy_E::DoEval(const double * xin) const
 // outputs: 
 //   differential cross section [10^-38 cm^2]
 //
-  double x = xin[0];
-  double y = xin[1];
-  fInteraction->KinePtr()->Setx(x);
-  fInteraction->KinePtr()->Sety(y);
-  kinematics::UpdateWQ2FromXY(fInteraction);
+  this->SetKinematics(fInteraction, xin);
   double xsec = fModel->XSec(fInteraction, kPSxyfE);
   return xsec/(1E-38 * units::cm2);
 }
+void genie::utils::gsl::d2XSec_dxdy_E::DoEvalBatch(
+    const double * pts, double * out, size_t n) const
+{
+  Interaction ** in = fBatch.Get(fInteraction, n);
+  for(size_t j = 0; j < n; j++) {
+    this->SetKinematics(in[j], pts + 2*j);
+  }
+  fModel->XSecBatch(in, n, kPSxyfE, out);
+  for(size_t j = 0; j < n; j++) {
+    out[j] /= (1E-38 * units::cm2);
+  }
+}
 ROOT::Math::IBaseFunctionMultiDim * 
    genie::utils::gsl::d2XSec_dxdy_E::Clone() const
 {
@@ -171,14 +225,31 @@ double genie::utils::gsl::d2XSec_dQ2dy_E::DoEval(const double * xin) const
 // outputs: 
 //   differential cross section [10^-38 cm^2]
 //
-  double Q2 = xin[0];
-  double  y = xin[1];
-  fInteraction->KinePtr()->SetQ2(Q2);
-  fInteraction->KinePtr()->Sety(y);
-  kinematics::UpdateXFromQ2Y(fInteraction);
+  this->SetKinematics(fInteraction, xin);
   double xsec = fModel->XSec(fInteraction, kPSQ2yfE);
   return xsec/(1E-38 * units::cm2);
 }
+void genie::utils::gsl::d2XSec_dQ2dy_E::SetKinematics(
+    const Interaction * in, const double * xin) const
+{
+  double Q2 = xin[0];
+  double  y = xin[1];
+  in->KinePtr()->SetQ2(Q2);
+  in->KinePtr()->Sety(y);
+  kinematics::UpdateXFromQ2Y(in);
+}
+void genie::utils::gsl::d2XSec_dQ2dy_E::DoEvalBatch(
+    const double * pts, double * out, size_t n) const
+{
+  Interaction ** in = fBatch.Get(fInteraction, n);
+  for(size_t j = 0; j < n; j++) {
+    this->SetKinematics(in[j], pts + 2*j);
+  }
+  fModel->XSecBatch(in, n, kPSQ2yfE, out);
+  for(size_t j = 0; j < n; j++) {
+    out[j] /= (1E-38 * units::cm2);
+  }
+}
 ROOT::Math::IBaseFunctionMultiDim * 
    genie::utils::gsl::d2XSec_dQ2dy_E::Clone() const
 {
@@ -212,15 +283,32 @@ double genie::utils::gsl::d2XSec_dQ2dydt_E::DoEval(const double * xin) const
 //   differential cross section [10^-38 cm^2]
 //
   //double  E = fInteraction->InitState().ProbeE(kRfLab);
+  this->SetKinematics(fInteraction, xin);
+  double xsec = fModel->XSec(fInteraction, kPSQ2yfE);
+  return xsec/(1E-38 * units::cm2);
+}
+void genie::utils::gsl::d2XSec_dQ2dydt_E::SetKinematics(
+    const Interaction * in, const double * xin) const
+{
   double Q2 = xin[0];
   double  y = xin[1];
   double  t = xin[2];
-  fInteraction->KinePtr()->SetQ2(Q2);
-  fInteraction->KinePtr()->Sety(y);
-  fInteraction->KinePtr()->Sett(t);
-  kinematics::UpdateXFromQ2Y(fInteraction);
-  double xsec = fModel->XSec(fInteraction, kPSQ2yfE);
-  return xsec/(1E-38 * units::cm2);
+  in->KinePtr()->SetQ2(Q2);
+  in->KinePtr()->Sety(y);
+  in->KinePtr()->Sett(t);
+  kinematics::UpdateXFromQ2Y(in);
+}
+void genie::utils::gsl::d2XSec_dQ2dydt_E::DoEvalBatch(
+    const double * pts, double * out, size_t n) const
+{
+  Interaction ** in = fBatch.Get(fInteraction, n);
+  for(size_t j = 0; j < n; j++) {
+    this->SetKinematics(in[j], pts + 3*j);
+  }
+  fModel->XSecBatch(in, n, kPSQ2yfE, out);
+  for(size_t j = 0; j < n; j++) {
+    out[j] /= (1E-38 * units::cm2);
+  }
 }
 ROOT::Math::IBaseFunctionMultiDim * 
    genie::utils::gsl::d2XSec_dQ2dydt_E::Clone() const
@@ -255,14 +343,31 @@ double genie::utils::gsl::d3XSec_dxdydt_E::DoEval(const double * xin) const
 //   differential cross section [10^-38 cm^2]
 //
   //double  E = fInteraction->InitState().ProbeE(kRfLab);
+  this->SetKinematics(fInteraction, xin);
+  double xsec = fModel->XSec(fInteraction, kPSxytfE);
+  return xsec/(1E-38 * units::cm2);
+}
+void genie::utils::gsl::d3XSec_dxdydt_E::SetKinematics(
+    const Interaction * in, const double * xin) const
+{
   double  x = xin[0];
   double  y = xin[1];
   double  t = xin[2];
-  fInteraction->KinePtr()->Setx(x);
-  fInteraction->KinePtr()->Sety(y);
-  fInteraction->KinePtr()->Sett(t);
-  double xsec = fModel->XSec(fInteraction, kPSxytfE);
-  return xsec/(1E-38 * units::cm2);
+  in->KinePtr()->Setx(x);
+  in->KinePtr()->Sety(y);
+  in->KinePtr()->Sett(t);
+}
+void genie::utils::gsl::d3XSec_dxdydt_E::DoEvalBatch(
+    const double * pts, double * out, size_t n) const
+{
+  Interaction ** in = fBatch.Get(fInteraction, n);
+  for(size_t j = 0; j < n; j++) {
+    this->SetKinematics(in[j], pts + 3*j);
+  }
+  fModel->XSecBatch(in, n, kPSxytfE, out);
+  for(size_t j = 0; j < n; j++) {
+    out[j] /= (1E-38 * units::cm2);
+  }
 }
 ROOT::Math::IBaseFunctionMultiDim *
    genie::utils::gsl::d3XSec_dxdydt_E::Clone() const
@@ -275,9 +380,16 @@ genie::utils::gsl::d2XSec_dWdQ2_E::d2XSec_dWdQ2_E(
      const XSecAlgorithmI * m, const Interaction * i) :
 ROOT::Math::IBaseFunctionMultiDim(),
 fModel(m),
-fInteraction(i)
-{
-
+fInteraction(i),
+fEv(0),
+fM(0)
+{
+  fUpdateXY = i->ProcInfo().IsDeepInelastic() ||
+              i->ProcInfo().IsDarkMatterDeepInelastic();
+  if(fUpdateXY) {
+    fEv = i->InitState().ProbeE(kRfHitNucRest);
+    fM  = i->InitState().Tgt().HitNucP4Ptr()->M();
+  }
 }
 genie::utils::gsl::d2XSec_dWdQ2_E::~d2XSec_dWdQ2_E()
 {
@@ -295,21 +407,37 @@ double genie::utils::gsl::d2XSec_dWdQ2_E::DoEval(const double * xin) const
 // outputs: 
 //   differential cross section [10^-38 cm^2/GeV^3]
 //
+  this->SetKinematics(fInteraction, xin);
+  double xsec = fModel->XSec(fInteraction, kPSWQ2fE);
+  return xsec/(1E-38 * units::cm2);
+}
+void genie::utils::gsl::d2XSec_dWdQ2_E::SetKinematics(
+    const Interaction * in, const double * xin) const
+{
   double W  = xin[0];
   double Q2 = xin[1];
-  fInteraction->KinePtr()->SetW(W);
-  fInteraction->KinePtr()->SetQ2(Q2);
-  if(fInteraction->ProcInfo().IsDeepInelastic() ||
-     fInteraction->ProcInfo().IsDarkMatterDeepInelastic()) {
+  in->KinePtr()->SetW(W);
+  in->KinePtr()->SetQ2(Q2);
+  if(fUpdateXY) {
     double x=0,y=0;
-    double E = fInteraction->InitState().ProbeE(kRfHitNucRest);
-    double M = fInteraction->InitState().Tgt().HitNucP4Ptr()->M();
-    kinematics::WQ2toXY(E,M,W,Q2,x,y);
-    fInteraction->KinePtr()->Setx(x);
-    fInteraction->KinePtr()->Sety(y);
+    kinematics::KineConsts kc;
+    kinematics::SetKineConsts(fEv, fM, 0., kc);
+    kinematics::WQ2toXY(kc,W,Q2,x,y);
+    in->KinePtr()->Setx(x);
+    in->KinePtr()->Sety(y);
+  }
+}
+void genie::utils::gsl::d2XSec_dWdQ2_E::DoEvalBatch(
+    const double * pts, double * out, size_t n) const
+{
+  Interaction ** in = fBatch.Get(fInteraction, n);
+  for(size_t j = 0; j < n; j++) {
+    this->SetKinematics(in[j], pts + 2*j);
+  }
+  fModel->XSecBatch(in, n, kPSWQ2fE, out);
+  for(size_t j = 0; j < n; j++) {
+    out[j] /= (1E-38 * units::cm2);
   }
-  double xsec = fModel->XSec(fInteraction, kPSWQ2fE);
-  return xsec/(1E-38 * units::cm2);
 }
 ROOT::Math::IBaseFunctionMultiDim *
    genie::utils::gsl::d2XSec_dWdQ2_E::Clone() const
@@ -494,10 +622,44 @@ double genie::utils::gsl::d5XSecAR::DoEval(const double * xin) const
 // outputs:
 //   differential cross section [10^-38 cm^2]
 //
+  if ( ! this->SetKinematics(fInteraction, xin) ) return 0.;
 
-  Kinematics * kinematics = fInteraction->KinePtr();
-  const TLorentzVector * P4_nu = fInteraction->InitStatePtr()->GetProbeP4(kRfLab);
-  double E_nu       = P4_nu->E();
+  double xsec = fModel->XSec(fInteraction);
+  if (xsec>0 && flip) {
+    xsec = xsec*-1.0;
+  }
+  //return xsec/(1E-38 * units::cm2);
+  return xsec;
+}
+void genie::utils::gsl::d5XSecAR::DoEvalBatch(
+    const double * pts, double * out, size_t n) const
+{
+  // the points outside the phase space are not passed to the model
+  Interaction ** in = fBatch.Get(fInteraction, n);
+  std::vector<size_t> valid;
+  valid.reserve(n);
+  for(size_t j = 0; j < n; j++) {
+    out[j] = 0.;
+    if ( this->SetKinematics(in[valid.size()], pts + 5*j) ) valid.push_back(j);
+  }
+  if ( valid.empty() ) return;
+
+  std::vector<double> xsec(valid.size());
+  fModel->XSecBatch(in, valid.size(), kPSfE, &xsec[0]);
+  for(size_t k = 0; k < valid.size(); k++) {
+    double xs = xsec[k];
+    if (xs>0 && flip) {
+      xs = xs*-1.0;
+    }
+    out[valid[k]] = xs;
+  }
+}
+bool genie::utils::gsl::d5XSecAR::SetKinematics(
+    const Interaction * in, const double * xin) const
+{
+  Kinematics * kinematics = in->KinePtr();
+  const TLorentzVector & P4_nu = in->InitStatePtr()->ProbeP4();
+  double E_nu       = P4_nu.E();
   
   double E_l       = xin[0];
   double theta_l   = xin[1];
@@ -509,13 +671,13 @@ double genie::utils::gsl::d5XSecAR::DoEval(const double * xin) const
   
   double y = E_pi/E_nu;
    
-  double m_l = fInteraction->FSPrimLepton()->Mass();
+  double m_l = in->FSPrimLepton()->Mass();
   if (E_l < m_l) {
-    return 0.;
+    return false;
   }
   
   double m_pi;
-  if ( fInteraction->ProcInfo().IsWeakCC() ) {
+  if ( in->ProcInfo().IsWeakCC() ) {
     m_pi = constants::kPionMass;
   }
   else {
@@ -533,30 +695,24 @@ double genie::utils::gsl::d5XSecAR::DoEval(const double * xin) const
   pion_3vector.SetMagThetaPhi(p_pi,theta_pi,phi_pi);
   TLorentzVector P4_pion   = TLorentzVector(pion_3vector   , E_pi);
      
-  double Q2 = -(*P4_nu-P4_lep).Mag2();
+  double Q2 = -(P4_nu-P4_lep).Mag2();
 
   double x = Q2/(2*E_pi*constants::kNucleonMass);
 
-  Range1D_t xlim = fInteraction->PhaseSpace().XLim();
+  Range1D_t xlim = in->PhaseSpace().XLim();
 
   if ( x <  xlim.min || x > xlim.max ) {
-    return 0.;
+    return false;
   }
  
   kinematics->Setx(x);
   kinematics->Sety(y);
-  kinematics::UpdateWQ2FromXY(fInteraction);
+  kinematics::UpdateWQ2FromXY(in);
   
   kinematics->SetFSLeptonP4(P4_lep );
   kinematics->SetHadSystP4 (P4_pion); // use Hadronic System variable to store pion momentum
  
-  double xsec = fModel->XSec(fInteraction);
-  if (xsec>0 && flip) {
-    xsec = xsec*-1.0;
-  }
-  delete P4_nu;
-  //return xsec/(1E-38 * units::cm2);
-  return xsec;
+  return true;
 }
 
 ROOT::Math::IBaseFunctionMultiDim *
@@ -595,8 +751,8 @@ double genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi::DoEval(const double * xin)
 //   differential cross section [10^-38 cm^2]
 //
   Kinematics * kinematics = fInteraction->KinePtr();
-  const TLorentzVector * P4_nu = fInteraction->InitStatePtr()->GetProbeP4(kRfLab);
-  double E_nu       = P4_nu->E();
+  const TLorentzVector & P4_nu = fInteraction->InitStatePtr()->ProbeP4();
+  double E_nu       = P4_nu.E();
 
   double E_l       = xin[0];
   double theta_l   = xin[1];
@@ -631,7 +787,7 @@ double genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi::DoEval(const double * xin)
   pion_3vector.SetMagThetaPhi(p_pi,theta_pi,phi_pi);
   TLorentzVector P4_pion   = TLorentzVector(pion_3vector   , E_pi);
 
-  double Q2 = -(*P4_nu-P4_lep).Mag2();
+  double Q2 = -(P4_nu-P4_lep).Mag2();
 
   double x = Q2/(2*E_pi*constants::kNucleonMass);
 
@@ -647,8 +803,6 @@ double genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi::DoEval(const double * xin)
   
   kinematics->SetFSLeptonP4(P4_lep );
   kinematics->SetHadSystP4 (P4_pion); // use Hadronic System variable to store pion momentum
- 
-  delete P4_nu;
 
   double xsec = fModel->XSec(fInteraction)*TMath::Sin(theta_l)*TMath::Sin(theta_pi);
   return xsec/(1E-38 * units::cm2);
@@ -694,8 +848,8 @@ double genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::DoEval(const double * xin)
 //   differential cross section [10^-38 cm^2]
 //
   Kinematics * kinematics = fInteraction->KinePtr();
-  const TLorentzVector * P4_nu = fInteraction->InitStatePtr()->GetProbeP4(kRfLab);
-  double E_nu       = P4_nu->E();
+  const TLorentzVector & P4_nu = fInteraction->InitStatePtr()->ProbeP4();
+  double E_nu       = P4_nu.E();
   
   double E_l       = xin[0];
   double theta_l   = xin[1];
@@ -733,7 +887,7 @@ double genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::DoEval(const double * xin)
   pion_3vector.SetMagThetaPhi(p_pi,theta_pi,phi_pi);
   TLorentzVector P4_pion   = TLorentzVector(pion_3vector   , E_pi);
   
-  double Q2 = -(*P4_nu-P4_lep).Mag2();
+  double Q2 = -(P4_nu-P4_lep).Mag2();
   
   double x = Q2/(2*E_pi*constants::kNucleonMass);
   
@@ -750,7 +904,6 @@ double genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::DoEval(const double * xin)
   kinematics->SetFSLeptonP4(P4_lep );
   kinematics->SetHadSystP4 (P4_pion); // use Hadronic System variable to store pion momentum
   
-  delete P4_nu;
   
   double xsec = sin_theta_l * sin_theta_pi * fModel->XSec(fInteraction,kPSElOlTpifE);
   return fFactor * xsec/(1E-38 * units::cm2);
@@ -797,8 +950,8 @@ double genie::utils::gsl::d3Xsec_dOmegaldThetapi::DoEval(const double * xin) con
 //   differential cross section [10^-38 cm^2]
 //
   Kinematics * kinematics = fInteraction->KinePtr();
-  const TLorentzVector * P4_nu = fInteraction->InitStatePtr()->GetProbeP4(kRfLab);
-  double E_nu = P4_nu->E();
+  const TLorentzVector & P4_nu = fInteraction->InitStatePtr()->ProbeP4();
+  double E_nu = P4_nu.E();
   
   double E_l = fElep;
   
@@ -837,7 +990,7 @@ double genie::utils::gsl::d3Xsec_dOmegaldThetapi::DoEval(const double * xin) con
   pion_3vector.SetMagThetaPhi(p_pi,theta_pi,phi_pi);
   TLorentzVector P4_pion   = TLorentzVector(pion_3vector   , E_pi);
   
-  double Q2 = -(*P4_nu-P4_lep).Mag2();
+  double Q2 = -(P4_nu-P4_lep).Mag2();
   
   double x = Q2/(2*E_pi*constants::kNucleonMass);
   
@@ -854,7 +1007,6 @@ double genie::utils::gsl::d3Xsec_dOmegaldThetapi::DoEval(const double * xin) con
   kinematics->SetFSLeptonP4(P4_lep );
   kinematics->SetHadSystP4 (P4_pion); // use Hadronic System variable to store pion momentum
   
-  delete P4_nu;
   
   double xsec = (sin_theta_l * sin_theta_pi) * fModel->XSec(fInteraction,kPSElOlTpifE);
   return xsec/(1E-38 * units::cm2);
@@ -5,6 +5,18 @@
 
 \brief      GENIE differential cross section function wrappers for GSL integrators.
 
+            The main multi-dimensional wrappers also offer DoEvalBatch(), which
+            evaluates a set of points with a single XSecAlgorithmI::XSecBatch()
+            call. It is meant for integrators using point sets (eg fixed
+            quadrature rules). Each point of the batch gets its own copy of the
+            interaction.
+
+            The dXSec_dQ2_E_T<M> and d2XSec_dWdQ2_E_T<M> templates are the same
+            functions bound to the concrete model type M, evaluating the cross
+            section with a direct (non-virtual) M::XSec() call. The integrators
+            use them for their default models (see QELXSec, RESXSec, DISXSec),
+            only if the model is exactly of type M (and not derived from it).
+
 \author     Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
             University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -19,9 +31,15 @@
 #ifndef _GENIE_XSEC_FUNCTION_GSL_WRAPPERS_H_
 #define _GENIE_XSEC_FUNCTION_GSL_WRAPPERS_H_
 
+#include <cstddef>
+#include <vector>
+
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
 
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/Conventions/Units.h"
+
 namespace genie {
 
 class XSecAlgorithmI;
@@ -30,6 +48,28 @@ class Interaction;
 namespace utils {
 namespace gsl   {
 
+//.....................................................................................
+//
+// genie::utils::gsl::XSecBatchInteractions
+// Working copies of an interaction, one per point of a batch evaluation
+//
+class XSecBatchInteractions
+{
+public:
+  XSecBatchInteractions();
+  XSecBatchInteractions(const XSecBatchInteractions & batch); // starts empty
+ ~XSecBatchInteractions();
+
+  //! n copies of interaction in (incl. its kinematics and flags), refreshed
+  //! at each call
+  Interaction ** Get (const Interaction * in, size_t n);
+
+private:
+  XSecBatchInteractions & operator = (const XSecBatchInteractions & batch);
+
+  std::vector<Interaction *> fCopies;
+};
+
 //.....................................................................................
 //
 // genie::utils::gsl::dXSec_dQ2_E
@@ -46,11 +86,38 @@ public:
   double                            DoEval (double xin) const;
   ROOT::Math::IBaseFunctionOneDim * Clone  (void)             const;
 
-private:
+protected:
+  void SetKinematics (double Q2) const;
+
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
 };
 
+//.....................................................................................
+//
+// genie::utils::gsl::dXSec_dQ2_E_T<M>
+// dXSec_dQ2_E bound to the concrete model type M
+//
+template<class M> class dXSec_dQ2_E_T: public dXSec_dQ2_E
+{
+public:
+  dXSec_dQ2_E_T(const M * m, const Interaction * i) :
+    dXSec_dQ2_E(m,i), fConcrete(m) {}
+
+  double DoEval (double xin) const
+  {
+    this->SetKinematics(xin);
+    return fConcrete->M::XSec(fInteraction, kPSQ2fE) / (1E-38 * genie::units::cm2);
+  }
+  ROOT::Math::IBaseFunctionOneDim * Clone (void) const
+  {
+    return new dXSec_dQ2_E_T<M>(fConcrete, fInteraction);
+  }
+
+private:
+  const M * fConcrete;
+};
+
 //.....................................................................................
 //
 // genie::utils::gsl::dXSec_dy_E
@@ -87,10 +154,17 @@ public:
   unsigned int                        NDim   (void)               const;
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+  // evaluate the n points pts[NDim()*j ...] with one XSecBatch() call
+  void                                DoEvalBatch (const double * pts, double * out, size_t n) const;
 
 private:
+  void SetKinematics (const Interaction * in, const double * xin) const;
+
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
+  mutable XSecBatchInteractions fBatch;
+  double                 fEv;  ///< probe energy at the hit nucleon rest frame (fixed initial state)
+  double                 fM;   ///< hit nucleon mass
 };
 
 //.....................................................................................
@@ -108,10 +182,15 @@ public:
   unsigned int                        NDim   (void)               const;
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+  // evaluate the n points pts[NDim()*j ...] with one XSecBatch() call
+  void                                DoEvalBatch (const double * pts, double * out, size_t n) const;
 
 private:
+  void SetKinematics (const Interaction * in, const double * xin) const;
+
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
+  mutable XSecBatchInteractions fBatch;
 };
 
 //.....................................................................................
@@ -129,10 +208,15 @@ public:
   unsigned int                        NDim   (void)               const;
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+  // evaluate the n points pts[NDim()*j ...] with one XSecBatch() call
+  void                                DoEvalBatch (const double * pts, double * out, size_t n) const;
 
 private:
+  void SetKinematics (const Interaction * in, const double * xin) const;
+
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
+  mutable XSecBatchInteractions fBatch;
 };
 
 //.....................................................................................
@@ -150,10 +234,15 @@ public:
   unsigned int                        NDim   (void)               const;
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+  // evaluate the n points pts[NDim()*j ...] with one XSecBatch() call
+  void                                DoEvalBatch (const double * pts, double * out, size_t n) const;
 
 private:
+  void SetKinematics (const Interaction * in, const double * xin) const;
+
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
+  mutable XSecBatchInteractions fBatch;
 };
 
 //.....................................................................................
@@ -171,10 +260,43 @@ public:
   unsigned int                        NDim   (void)               const;
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+  // evaluate the n points pts[NDim()*j ...] with one XSecBatch() call
+  void                                DoEvalBatch (const double * pts, double * out, size_t n) const;
+
+protected:
+  void SetKinematics (const Interaction * in, const double * xin) const;
 
-private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
+  mutable XSecBatchInteractions fBatch;
+  bool                   fUpdateXY; ///< set x,y too (DIS)?
+  double                 fEv;       ///< probe energy at the hit nucleon rest frame (fixed initial state)
+  double                 fM;        ///< hit nucleon mass
+};
+
+//.....................................................................................
+//
+// genie::utils::gsl::d2XSec_dWdQ2_E_T<M>
+// d2XSec_dWdQ2_E bound to the concrete model type M
+//
+template<class M> class d2XSec_dWdQ2_E_T: public d2XSec_dWdQ2_E
+{
+public:
+  d2XSec_dWdQ2_E_T(const M * m, const Interaction * i) :
+    d2XSec_dWdQ2_E(m,i), fConcrete(m) {}
+
+  double DoEval (const double * xin) const
+  {
+    this->SetKinematics(fInteraction, xin);
+    return fConcrete->M::XSec(fInteraction, kPSWQ2fE) / (1E-38 * genie::units::cm2);
+  }
+  ROOT::Math::IBaseFunctionMultiDim * Clone (void) const
+  {
+    return new d2XSec_dWdQ2_E_T<M>(fConcrete, fInteraction);
+  }
+
+private:
+  const M * fConcrete;
 };
 
 //.....................................................................................
@@ -280,12 +402,17 @@ public:
   unsigned int                        NDim   (void)               const;
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+  // evaluate the n points pts[NDim()*j ...] with one XSecBatch() call
+  void                                DoEvalBatch (const double * pts, double * out, size_t n) const;
   void SetFlip(bool b) { flip = b; }
 
 private:
+  bool SetKinematics (const Interaction * in, const double * xin) const;
+
   const XSecAlgorithmI * fModel;
   const Interaction * fInteraction;
   bool flip;
+  mutable XSecBatchInteractions fBatch;
 };
 
 
@@ -10,35 +10,340 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added IntegrateNDim(), with an optional thread-parallel integration in
+   slices of the first integration variable (gsl-nthreads), and the
+   genie-vegas integration type, whose VEGAS grids are reused between the
+   energy knots of a spline.
+   Added IntegrateBatch(), integrating a model for a set of interactions
+   (eg the knots of a spline), and its threaded CPU implementation
+   IntegrateBatchThreads() (batch-nthreads).
 
 */
 //____________________________________________________________________________
 
+#include <atomic>
+#include <algorithm>
+#include <cassert>
+#include <sstream>
+#include <thread>
+
+#include <Math/IntegratorMultiDim.h>
+#include <Math/AdaptiveIntegratorMultiDim.h>
+#include <TMath.h>
+#include <TROOT.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/GSLUtils.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/VegasIntegrator.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Physics/XSectionIntegration/GSLXSecFunc.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 
 using namespace genie;
 
+namespace {
+
+  // 64-bit FNV-1a hash
+  unsigned long long HashText(const std::string & text)
+  {
+    unsigned long long h = 14695981039346656037ULL;
+    for(size_t i = 0; i < text.size(); i++) {
+      h ^= (unsigned char) text[i];
+      h *= 1099511628211ULL;
+    }
+    return h;
+  }
+
+  // set in the threads of a batch integration, whose integrals are not sliced
+  thread_local bool tInBatchThread = false;
+}
+
 //___________________________________________________________________________
 XSecIntegratorI::XSecIntegratorI() :
-Algorithm()
+Algorithm(),
+fNThreads(1),
+fBatchNThreads(1),
+fVegasCalls(0),
+fVegasNBins(50)
 {
 
 }
 //___________________________________________________________________________
 XSecIntegratorI::XSecIntegratorI(string name) :
-Algorithm(name)
+Algorithm(name),
+fNThreads(1),
+fBatchNThreads(1),
+fVegasCalls(0),
+fVegasNBins(50)
 {
 
 }
 //___________________________________________________________________________
 XSecIntegratorI::XSecIntegratorI(string name, string config) :
-Algorithm(name, config)
+Algorithm(name, config),
+fNThreads(1),
+fBatchNThreads(1),
+fVegasCalls(0),
+fVegasNBins(50)
 {
 
 }
 //___________________________________________________________________________
 XSecIntegratorI::~XSecIntegratorI()
 {
+  this->ClearModelClones();
+  this->ClearVegasGrids();
+}
+//___________________________________________________________________________
+void XSecIntegratorI::LoadIntegratorConfig(void)
+{
+  GetParamDef( "gsl-nthreads", fNThreads, 1 ) ;
+  if(fNThreads <= 0) {
+    fNThreads = std::thread::hardware_concurrency();
+    if(fNThreads <= 0) fNThreads = 1;
+  }
+  GetParamDef( "batch-nthreads", fBatchNThreads, 1 ) ;
+  if(fBatchNThreads <= 0) {
+    fBatchNThreads = std::thread::hardware_concurrency();
+    if(fBatchNThreads <= 0) fBatchNThreads = 1;
+  }
+  GetParamDef( "genie-vegas-calls", fVegasCalls,  0 ) ;
+  GetParamDef( "genie-vegas-bins",  fVegasNBins, 50 ) ;
+}
+//___________________________________________________________________________
+double XSecIntegratorI::IntegrateNDim(
+  IntegrandMaker maker, const XSecAlgorithmI * model, const Interaction * in,
+  unsigned int ndim, const double * kine_min, const double * kine_max,
+  double abstol, bool set_min_pts, double * error, int * status) const
+{
+  bool vegas = (utils::str::ToLower(fGSLIntgType) == "genie-vegas");
+  ROOT::Math::IntegrationMultiDim::Type ig_type = vegas ?
+      ROOT::Math::IntegrationMultiDim::kVEGAS :
+      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
+
+  bool parallel = (fNThreads > 1 && !tInBatchThread &&
+                   model->AllowsParallelIntegration());
+  unsigned int nslices = parallel ? fNThreads : 1;
+
+  // Each slice of the first variable has its own model clone and interaction
+  // copy when integrated in parallel. The slices share the absolute tolerance
+  // and, for the Monte Carlo integrators, the number of evaluations.
+  const std::vector<XSecAlgorithmI *> * clones = 0;
+  utils::gsl::XSecBatchInteractions copies;
+  Interaction ** slice_in = 0;
+  if(parallel) {
+    clones   = &this->Clones(model, nslices);
+    slice_in = copies.Get(in, nslices);
+  }
+  bool adaptive = (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE);
+  unsigned int maxeval = adaptive ? fGSLMaxEval : fGSLMaxEval / nslices;
+
+  // the integrators are made in this thread, as the ROOT plugin manager
+  // instantiating them isn't thread-safe
+  std::vector<ROOT::Math::IBaseFunctionMultiDim *> funcs (nslices);
+  std::vector<ROOT::Math::IntegratorMultiDim *>    igs   (nslices, 0);
+  std::vector<VegasIntegrator *>                   vgs   (nslices, 0);
+  std::vector<double> bounds (2*ndim*nslices);
+  double dx0 = (kine_max[0] - kine_min[0]) / nslices;
+  for(unsigned int is = 0; is < nslices; is++) {
+    funcs[is] = parallel ?
+        maker((*clones)[is], slice_in[is]) : maker(model, in);
+    if(vegas) {
+      vgs[is] = this->VegasGrid(model, in, ndim, is, nslices);
+      vgs[is]->SetRelTolerance(fGSLRelTol);
+      vgs[is]->SetAbsTolerance(abstol/nslices);
+      vgs[is]->SetMaxEval     (maxeval);
+      vgs[is]->SetCallsPerIter(
+         (fVegasCalls > 0) ? fVegasCalls : TMath::Max(maxeval/10, 100u));
+    } else {
+      igs[is] = new ROOT::Math::IntegratorMultiDim(
+          *funcs[is], ig_type, abstol/nslices, fGSLRelTol, maxeval);
+      if (set_min_pts && adaptive) {
+        ROOT::Math::AdaptiveIntegratorMultiDim * cast =
+          dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( igs[is]->GetIntegrator() );
+        assert(cast);
+        cast->SetMinPts(fGSLMinEval);
+      }
+    }
+    double * kmin = &bounds[2*ndim*is];
+    double * kmax = kmin + ndim;
+    for(unsigned int id = 0; id < ndim; id++) {
+      kmin[id] = kine_min[id];
+      kmax[id] = kine_max[id];
+    }
+    if(nslices > 1) {
+      kmin[0] = kine_min[0] + is * dx0;
+      kmax[0] = (is == nslices-1) ? kine_max[0] : kine_min[0] + (is+1) * dx0;
+    }
+  }
+
+  std::vector<double> results (nslices, 0.);
+  std::vector<double> errors  (nslices, 0.);
+  std::vector<int>    codes   (nslices, 0);
+  auto integrate_slice = [&](unsigned int is) {
+    double * kmin = &bounds[2*ndim*is];
+    if(vegas) {
+      results[is] = vgs[is]->Integral(*funcs[is], kmin, kmin + ndim);
+      errors [is] = vgs[is]->Error();
+      codes  [is] = vgs[is]->Status();
+    } else {
+      results[is] = igs[is]->Integral(kmin, kmin + ndim);
+      errors [is] = igs[is]->Error();
+      codes  [is] = igs[is]->Status();
+    }
+  };
+
+  if(!parallel) {
+    integrate_slice(0);
+  } else {
+    LOG("XSecIntegrator", pINFO)
+      << "Integrating " << model->Id().Key() << " in " << nslices << " threads";
+    long int seed = RandomGen::Instance()->GetSeed();
+    std::vector<std::thread> threads;
+    for(unsigned int is = 0; is < nslices; is++) {
+      threads.push_back(std::thread([&, is]() {
+        Cache::CreateThreadInstance();
+        RandomGen::CreateThreadInstance(seed + 1 + is);
+        integrate_slice(is);
+        RandomGen::DeleteThreadInstance();
+        Cache::DeleteThreadInstance();
+      }));
+    }
+    for(unsigned int is = 0; is < nslices; is++) threads[is].join();
+  }
+
+  double integral = 0;
+  if(error ) *error  = 0;
+  if(status) *status = 0;
+  for(unsigned int is = 0; is < nslices; is++) {
+    integral += results[is];
+    if(error) *error += errors[is];
+    if(status && *status == 0) *status = codes[is];
+    delete igs[is];
+    delete funcs[is];
+  }
+  return integral;
+}
+//___________________________________________________________________________
+bool XSecIntegratorI::IntegrateBatch(
+  const XSecAlgorithmI * /* model */, const Interaction * const * /* in */,
+  size_t /* n */, double * /* xsec */) const
+{
+  return false;
+}
+//___________________________________________________________________________
+bool XSecIntegratorI::IntegrateBatchThreads(
+  const XSecAlgorithmI * model, const Interaction * const * in, size_t n,
+  double * xsec) const
+{
+  if(fBatchNThreads <= 1 || n < 2) return false;
+  if(tInBatchThread || !model->AllowsParallelIntegration()) return false;
+  if(utils::str::ToLower(fGSLIntgType) == "genie-vegas") return false;
+
+  unsigned int nthreads = std::min((size_t) fBatchNThreads, n);
+  const std::vector<XSecAlgorithmI *> & clones = this->Clones(model, nthreads);
+
+  // the numerical integrators are instantiated in the threads, through the
+  // ROOT plugin manager
+  ROOT::EnableThreadSafety();
+
+  LOG("XSecIntegrator", pINFO)
+    << "Integrating " << model->Id().Key() << " for " << n
+    << " interactions in " << nthreads << " threads";
+
+  // the integrals are handed out one at a time, as their cost varies a lot
+  // (eg from below threshold to the top of a spline)
+  std::atomic<size_t> next(0);
+  long int seed = RandomGen::Instance()->GetSeed();
+  std::vector<std::thread> threads;
+  for(unsigned int it = 0; it < nthreads; it++) {
+    threads.push_back(std::thread([&, it]() {
+      tInBatchThread = true;
+      Cache::CreateThreadInstance();
+      RandomGen::CreateThreadInstance(seed + 1 + it);
+      for(size_t j = next++; j < n; j = next++) {
+        xsec[j] = this->Integrate(clones[it], in[j]);
+      }
+      RandomGen::DeleteThreadInstance();
+      Cache::DeleteThreadInstance();
+      tInBatchThread = false;
+    }));
+  }
+  for(unsigned int it = 0; it < nthreads; it++) threads[it].join();
+
+  return true;
+}
+//___________________________________________________________________________
+VegasIntegrator * XSecIntegratorI::VegasGrid(
+  const XSecAlgorithmI * model, const Interaction * in,
+  unsigned int ndim, unsigned int slice, unsigned int nslices) const
+{
+// The grids are kept per model, process (but not energy) and slice, so that
+// the integration at an energy knot starts from the grid adapted at the
+// previous knot of the spline
 
+  std::ostringstream key;
+  key << model->Id().Key() << ";" << in->AsString()
+      << ";ndim:" << ndim << ";slice:" << slice << "/" << nslices;
+
+  std::map<std::string, VegasIntegrator *>::iterator it =
+      fVegasGrids.find(key.str());
+  if(it != fVegasGrids.end()) return it->second;
+
+  VegasIntegrator * vegas = new VegasIntegrator(ndim, fVegasNBins);
+  fVegasGrids.insert(std::make_pair(key.str(), vegas));
+  return vegas;
+}
+//___________________________________________________________________________
+void XSecIntegratorI::ClearVegasGrids(void) const
+{
+  std::map<std::string, VegasIntegrator *>::iterator it = fVegasGrids.begin();
+  for( ; it != fVegasGrids.end(); ++it) delete it->second;
+  fVegasGrids.clear();
+}
+//___________________________________________________________________________
+const std::vector<XSecAlgorithmI *> & XSecIntegratorI::Clones(
+  const XSecAlgorithmI * model, unsigned int n) const
+{
+// The clones are instantiated from the AlgConfigPool like the model and are
+// remade whenever the model configuration changes (eg after a reconfiguration)
+
+  std::ostringstream config;
+  config << model->GetConfig();
+  unsigned long long hash = HashText(config.str());
+
+  ModelClones & mc = fModelClones[model->Id().Key()];
+  if(mc.fConfig != hash) {
+    for(size_t i = 0; i < mc.fClones.size(); i++) delete mc.fClones[i];
+    mc.fClones.clear();
+    mc.fConfig = hash;
+  }
+
+  AlgFactory * algf = AlgFactory::Instance();
+  while(mc.fClones.size() < n) {
+    XSecAlgorithmI * clone =
+      dynamic_cast<XSecAlgorithmI *> (algf->AdoptAlgorithm(model->Id()));
+    assert(clone);
+    // take private copies of the sub-algorithms (the clone is reconfigured
+    // so that it looks up its own sub-algorithms)
+    clone->AdoptSubstructure();
+    mc.fClones.push_back(clone);
+  }
+  return mc.fClones;
+}
+//___________________________________________________________________________
+void XSecIntegratorI::ClearModelClones(void) const
+{
+  std::map<std::string, ModelClones>::iterator it = fModelClones.begin();
+  for( ; it != fModelClones.end(); ++it) {
+    for(size_t i = 0; i < it->second.fClones.size(); i++) {
+      delete it->second.fClones[i];
+    }
+  }
+  fModelClones.clear();
 }
 //___________________________________________________________________________
@@ -5,6 +5,26 @@
 
 \brief    Cross Section Integrator Interface.
 
+          IntegrateNDim() integrates a multi-dimensional integrand either
+          serially or, with gsl-nthreads > 1 (0 for one thread per core) and
+          a model allowing it, in concurrent slices of the range of the first
+          integration variable. Each thread integrates its slice with a
+          private clone of the model, owning its substructure, and of the
+          interaction, and uses its own Cache instance.
+
+          Besides the ROOT/GSL integration types, gsl-integration-type can be
+          genie-vegas: a VegasIntegrator whose importance grid is kept per
+          model and process, so that the integration at an energy knot of a
+          spline is warm-started from the grid adapted at the previous knot.
+
+          IntegrateBatch() integrates a model for a set of interactions (eg
+          the energy knots of a spline, see XSecSplineList::ComputeKnots()).
+          It is the hook for integrators evaluating such independent
+          integrals in bulk, eg on an accelerator; the default declines the
+          batch, which is then integrated one interaction at a time. The
+          CPU implementation, IntegrateBatchThreads(), shares the integrals
+          out to batch-nthreads threads (0 for one thread per core).
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -19,6 +39,12 @@
 #ifndef _XSEC_INTEGRATOR_I_H_
 #define _XSEC_INTEGRATOR_I_H_
 
+#include <map>
+#include <string>
+#include <vector>
+
+#include <Math/IFunction.h>
+
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Interaction/Interaction.h"
@@ -26,6 +52,7 @@
 namespace genie {
 
 class IntegratorI;
+class VegasIntegrator;
 
  class XSecIntegratorI : public Algorithm {
 
@@ -35,11 +62,50 @@ public:
   virtual double Integrate(const XSecAlgorithmI * model, 
                            const Interaction * interaction 
                        /*, const KPhaseSpaceCut * cut=0*/) const= 0;
+
+  //! Integrate the model for the n interactions in[j]: xsec[j] is then
+  //! Integrate(model, in[j]). Returns false if the batch was not handled, so
+  //! that the caller integrates the interactions one at a time
+  virtual bool IntegrateBatch (const XSecAlgorithmI * model,
+                               const Interaction * const * in, size_t n,
+                               double * xsec) const;
+
+  //! Makes the integrand of a model for an interaction
+  typedef ROOT::Math::IBaseFunctionMultiDim * (*IntegrandMaker)
+                       (const XSecAlgorithmI * model, const Interaction * in);
+
 protected:
   XSecIntegratorI();
   XSecIntegratorI(string name);
   XSecIntegratorI(string name, string config);
 
+  //! Integrate the integrand made by maker for the model and interaction over
+  //! [kine_min, kine_max] with the configured GSL integrator; set_min_pts
+  //! passes fGSLMinEval to the adaptive integrator. If given, error and status
+  //! get the estimated error (summed over the slices) and the first non-zero
+  //! integrator status
+  double IntegrateNDim (IntegrandMaker maker, const XSecAlgorithmI * model,
+                        const Interaction * in, unsigned int ndim,
+                        const double * kine_min, const double * kine_max,
+                        double abstol, bool set_min_pts,
+                        double * error = 0, int * status = 0) const;
+
+  //! IntegrateBatch() on the CPU: the integrals are shared out to
+  //! fBatchNThreads threads, each integrating with a private model clone
+  //! (the integrations of IntegrateNDim() in these threads are not sliced).
+  //! Declines the batch with a single thread or interaction, for a model not
+  //! allowing parallel integration and with the genie-vegas integration type
+  //! (whose grids are carried from one knot to the next)
+  bool   IntegrateBatchThreads (const XSecAlgorithmI * model,
+                                const Interaction * const * in, size_t n,
+                                double * xsec) const;
+
+  //! Read gsl-nthreads, batch-nthreads and the genie-vegas options
+  void   LoadIntegratorConfig (void);
+
+  //! Delete the model clones of the parallel integration
+  void   ClearModelClones     (void) const;
+
   const IntegratorI * fIntegrator; ///< GENIE numerical integrator 
 
   string fGSLIntgType;                     ///< name of GSL numerical integrator
@@ -48,6 +114,27 @@ protected:
   int    fGSLMinEval;                      ///< GSL min evaluations. Ignored by some integrators.
   unsigned int fGSLMaxSizeOfSubintervals;  ///< GSL maximum number of sub-intervals for 1D integrator
   unsigned int fGSLRule;                   ///< GSL Gauss-Kronrod integration rule (only for GSL 1D adaptive type)
+  int    fNThreads;                        ///< number of threads of the multi-dimensional integration
+  int    fBatchNThreads;                   ///< number of threads of the batch integration
+  int    fVegasCalls;                      ///< genie-vegas evaluations per iteration (0: a tenth of fGSLMaxEval)
+  int    fVegasNBins;                      ///< genie-vegas grid bins per variable
+
+private:
+  //! Per-thread clones of a model, made with the configuration of hash fConfig
+  struct ModelClones {
+    unsigned long long            fConfig;
+    std::vector<XSecAlgorithmI *> fClones;
+  };
+  const std::vector<XSecAlgorithmI *> &
+         Clones (const XSecAlgorithmI * model, unsigned int n) const;
+
+  VegasIntegrator * VegasGrid (const XSecAlgorithmI * model, const Interaction * in,
+                               unsigned int ndim, unsigned int slice,
+                               unsigned int nslices) const;
+  void   ClearVegasGrids (void) const;
+
+  mutable std::map<std::string, ModelClones> fModelClones; ///< model clones per model key
+  mutable std::map<std::string, VegasIntegrator *> fVegasGrids; ///< genie-vegas integrators per model, process and slice
 
 };
 
@@ -16,6 +16,13 @@
    Implemented dummy versions of the new GFluxI::Clear and GFluxI::Index as 
    these methods needed for pre-generation of flux interaction probabilities 
    in GMCJDriver. 
+ @ Oct 14, 2026 - The GENIE Collaboration
+   NuPropagator tabulates the PREM column depth to the detector volume once
+   per detector position and moves each neutrino directly to the detector
+   volume boundary, instead of stepping it through the Earth one km at a
+   time. The column depth is reported via GAstroFlux::ColumnDepth().
+   The column depth table is evenly spaced in sqrt(1-cos) of the angle
+   between the origin and the detector centre, not in cos.
 
 */
 //____________________________________________________________________________
@@ -30,6 +37,7 @@
 #include "Tools/Flux/GAstroFlux.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/PREM.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -139,6 +147,7 @@ bool GAstroFlux::GenerateNext(void)
   //
   fgWeight = wght_species * wght_energy * wght_origin;
   fgPdgC   = pnupdg;
+  fgColumnDepth = fNuPropg->ColumnDepthToDetVolBoundary();
   fgX4.SetVect(px3*(units::m/units::km));
   fgX4.SetT(0.);
   fgP4.SetVect(pp3);
@@ -208,6 +217,10 @@ void GAstroFlux::SetDetectorPosition(
 
   fDetCenter.SetXYZ(xdc,ydc,zdc);
 
+  // The column depth to the detector only depends on the detector position
+  // and size: tabulate it now rather than integrating it for each neutrino
+  fNuPropg->BuildColumnDepthTable(fDetCenter, fDetSize);
+
   //
   // Coordinate System Rotation:
   // GEF translated to detector centre -> THZ
@@ -347,6 +360,7 @@ void GAstroFlux::ResetSelection(void)
 // initializing running neutrino pdg-code, 4-position, 4-momentum
 
   fgPdgC = 0;
+  fgColumnDepth = 0;
   fgP4.SetPxPyPzE (0.,0.,0.,0.);
   fgX4.SetXYZT    (0.,0.,0.,0.);
 }
@@ -482,6 +496,66 @@ bool GAstroFlux::NuGenerator::SelectOrigin(
   return true;
 }
 //___________________________________________________________________________
+void GAstroFlux::NuPropagator::BuildColumnDepthTable(
+  const TVector3 & detector_centre, double detector_sz)
+{
+// Tabulate the PREM column depth from a neutrino origin on the Earth surface
+// to the boundary of the detector volume, as a function of the cosine of the
+// angle (at the Earth centre) between the origin and the detector centre.
+// That angle fixes the chord, so the table holds for all origins. The nodes
+// are evenly spaced in s = sqrt((1-cos)/2), proportional to the chord length
+// for a detector at the surface, so that the near-horizontal origins (where
+// the column depth changes fastest with the angle) are finely sampled.
+//
+  fTableDetCentre = detector_centre;
+  fTableDetSize   = detector_sz;
+  fColDepthTable.assign(kAstroNCosThetaBins+1, 0.);
+
+  double REarth = constants::kREarth/units::km;
+  double rdet   = detector_centre.Mag();
+
+  // detector centre taken along +z; origins in the xz plane
+  TVector3 dc(0.,0.,rdet);
+  for(int i = 0; i <= kAstroNCosThetaBins; i++) {
+    double s    = (double) i / kAstroNCosThetaBins;
+    double cosg = 1. - 2.*s*s;
+    double sing = TMath::Sqrt(TMath::Max(0., 1.-cosg*cosg));
+    TVector3 start(REarth*sing, 0., REarth*cosg);
+    fColDepthTable[i] = this->ColumnDepth(start, dc, detector_sz);
+  }
+
+  LOG("Flux", pNOTICE)
+    << "Tabulated the PREM column depth to the detector volume at "
+    << kAstroNCosThetaBins+1 << " angles: from "
+    << fColDepthTable[0] << " to "
+    << fColDepthTable[kAstroNCosThetaBins] << " g/cm^2";
+}
+//___________________________________________________________________________
+double GAstroFlux::NuPropagator::ColumnDepth(
+  const TVector3 & start, const TVector3 & detector_centre,
+  double detector_sz) const
+{
+// Integrate the PREM density (midpoint rule, steps of fStepSize) along the
+// straight line from start towards the detector centre, up to the detector
+// volume boundary. Positions in km, result in g/cm^2.
+//
+  TVector3 dx = detector_centre - start;
+  double length = dx.Mag() - detector_sz;
+  if(length <= 0.) return 0.;
+
+  TVector3 dir = dx.Unit();
+  int    nsteps = TMath::Max(1, TMath::CeilNint(length/fStepSize));
+  double stepsz = length/nsteps;
+
+  double coldepth = 0.;
+  for(int i = 0; i < nsteps; i++) {
+    TVector3 x = start + ((i+0.5)*stepsz) * dir;
+    double rho = utils::prem::Density(x.Mag()*units::km) / units::g_cm3;
+    coldepth += rho * stepsz;
+  }
+  return coldepth * (units::km/units::cm);
+}
+//___________________________________________________________________________
 bool GAstroFlux::NuPropagator::Go(
   double phi, double costheta, const TVector3 & detector_centre, 
   double detector_sz, int nu_pdg, double Ev)
@@ -510,32 +584,38 @@ bool GAstroFlux::NuPropagator::Go(
   fP3 = Ev * direction_unit_vec;
 
   //
-  // step through the Earth
+  // column depth to the detector volume: look it up in the table, if one
+  // was built for this detector, or integrate it otherwise
   //
+  bool use_table = (fColDepthTable.size() > 1) &&
+                   (fTableDetCentre == detector_centre) &&
+                   (fTableDetSize   == detector_sz);
+  if(use_table) {
+    double rdet = detector_centre.Mag();
+    double cosg = (rdet > 0.) ? 
+       start_position.Dot(detector_centre) / (REarth*rdet) : 1.;
+    cosg = TMath::Max(-1., TMath::Min(1., cosg));
+    double x  = TMath::Sqrt(0.5 * (1. - cosg)) * kAstroNCosThetaBins;
+    int    i  = TMath::Min(kAstroNCosThetaBins-1, (int)x);
+    double dx = x - i;
+    fColumnDepth = (1.-dx)*fColDepthTable[i] + dx*fColDepthTable[i+1];
+  } else {
+    fColumnDepth = 
+       this->ColumnDepth(start_position, detector_centre, detector_sz);
+  }
 
-  LOG("Flux", pWARN) << "|dist|    = " << fX3.Mag();
-  LOG("Flux", pWARN) << "|detsize| = " << detector_sz;
-
-  while(1) {
-    double currdist = fX3.Mag();
-    if(currdist <= detector_sz - 0.1) break;
-
-    double stepsz = (currdist-detector_sz > fStepSize) ? 
-                         fStepSize : currdist-detector_sz;
-    if(stepsz <= 0.) break;
-
-//    LOG("Flux", pWARN) << "Stepping by... |dr| = " << stepsz;
-
-    //
-    // check earth density at current position, calculate interaction
-    // probability over next step size, decide whether it interacts and
-    // what happens if it does...
-    //
-    // ... todo ...
-
-    fX3 += (stepsz * direction_unit_vec);
+  //
+  // move to the detector volume boundary
+  //
+  double dist = fX3.Mag();
+  if(dist > detector_sz) {
+    fX3 *= (detector_sz/dist);
   }
 
+  LOG("Flux", pDEBUG) 
+     << "|dist| = " << dist << ", |detsize| = " << detector_sz
+     << ", column depth = " << fColumnDepth << " g/cm^2";
+
   return true;
 }
 //___________________________________________________________________________
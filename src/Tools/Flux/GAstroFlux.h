@@ -37,6 +37,11 @@
           account. The Earth density profile is modelled using the PREM 
           (Preliminary Earth Model, The Encyclopedia of Solid Earth Geophysics,
           David E. James, ed., Van Nostrand Reinhold, New York, 1989, p.331).
+          The PREM column depth along the chord to the detector depends only
+          on the angle, at the Earth centre, between the neutrino origin and
+          the detector centre. It is tabulated once, whenever the detector
+          position is set, and looked up for each neutrino, which is moved
+          directly to the boundary of the detector volume.
 
           The detector position is determined in the Spherical/Geographic System 
           by its geographic latitude (angle relative to Equator), its geographic 
@@ -99,6 +104,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include <TLorentzVector.h>
 #include <TVector3.h>
@@ -146,6 +152,9 @@ public :
   virtual void                   Clear            (Option_t * opt);
   virtual void                   GenerateWeighted (bool gen_weighted);
 
+  //! (current) PREM column depth (in g/cm^2) traversed by the generated nu
+  double ColumnDepth (void) const { return fgColumnDepth; }
+
   //
   // configuration methods specific to all astrophysical neutrino flux drivers
   //
@@ -178,6 +187,7 @@ protected:
   TLorentzVector   fgP4;                  ///< (current) generated nu 4-momentum
   TLorentzVector   fgX4;                  ///< (current) generated nu 4-position
   double           fgWeight;              ///< (current) generated nu weight
+  double           fgColumnDepth;         ///< (current) generated nu: column depth to the detector volume (g/cm^2)
   // configuration properties set by the user
   double           fMaxEvCut;             ///< (config) user-defined maximum energy cut
   double           fMinEvCut;             ///< (config) user-defined minimum energy cut
@@ -209,17 +219,24 @@ protected:
   };
   class NuPropagator {
   public:
-    NuPropagator(double stepsz) : fStepSize(stepsz/units::km) { }
+    NuPropagator(double stepsz) : fStepSize(stepsz/units::km), fNuPdg(0), fColumnDepth(0) { }
    ~NuPropagator() { }
+    void BuildColumnDepthTable (const TVector3 & detector_centre, double detector_sz);
     bool Go(double phi_start, double costheta_start, const TVector3 & detector_centre, double detector_sz, int nu_pdg, double Ev);
-    int        NuPdgAtDetVolBoundary (void) { return fNuPdg; }
-    TVector3 & X3AtDetVolBoundary    (void) { return fX3;    }
-    TVector3 & P3AtDetVolBoundary    (void) { return fP3;    }
+    int        NuPdgAtDetVolBoundary       (void) { return fNuPdg;       }
+    TVector3 & X3AtDetVolBoundary          (void) { return fX3;          }
+    TVector3 & P3AtDetVolBoundary          (void) { return fP3;          }
+    double     ColumnDepthToDetVolBoundary (void) { return fColumnDepth; }
   private:
+    double ColumnDepth (const TVector3 & start, const TVector3 & detector_centre, double detector_sz) const;
     double   fStepSize;
     int      fNuPdg;
     TVector3 fX3;
     TVector3 fP3;
+    double   fColumnDepth;                ///< column depth (g/cm^2) from the origin to the detector volume boundary
+    std::vector<double> fColDepthTable;   ///< column depth vs sqrt((1-cos)/2) of the angle between origin and detector centre
+    TVector3 fTableDetCentre;             ///< detector centre the table was built for
+    double   fTableDetSize;               ///< detector size the table was built for
   };
 
 };
@@ -48,6 +48,18 @@
    rather than a TH3D ptr input and it is expected to retrieve the TH3D flux
    itself. This change was made to easily fit HAKKM in the code already used
    by FLUKA and BGLRS.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The nominal flux is sampled with alias tables (see AliasSampler), built
+   once the flux data are loaded, for the (Ev,costheta,phi) bin and for the
+   neutrino species in each bin: O(1) per draw, instead of the cumulative
+   integral search of TH3D::GetRandom3() and the per-species histogram
+   lookups of SelectNeutrino(), and using the RndFlux() random stream
+   rather than gRandom.
+   Implemented GFluxI::SetEnergyBias for the importance sampling mode of
+   GMCJDriver: the alias tables are built from the fluxes multiplied by the
+   bias. Added SetDetectorBox(): the neutrinos are aimed at the projection
+   of a box bounding the detector rather than at the Rt disk, and
+   GenerationArea() returns the matching normalization area.
 
 */
 //____________________________________________________________________________
@@ -56,6 +68,7 @@
 #include <iostream>
 #include <fstream>
 
+#include <TH1D.h>
 #include <TH3D.h>
 #include <TMath.h>
 
@@ -167,13 +180,28 @@ bool GAtmoFlux::GenerateNext_1try(void)
      // generate nominal flux
      //
 
-     Axis_t ax = 0, ay = 0, az = 0;
-     fTotalFluxHisto->GetRandom3(ax, ay, az);
-     Ev       = (double)ax;
-     costheta = (double)ay;
-     phi      = (double)az;
-     nu_pdg   = this->SelectNeutrino(Ev, costheta, phi);
+     if(fBinSampler.IsEmpty()) {
+        LOG("Flux", pFATAL) << "No flux neutrinos to sample from";
+        exit(1);
+     }
+     int ibin = fBinSampler.Sample(rnd->RndFlux().Rndm());
+     int ip   = ibin % fNumPhiBins;
+     int ic   = (ibin / fNumPhiBins) % fNumCosThetaBins;
+     int ie   = ibin / (fNumPhiBins * fNumCosThetaBins);
+
+     // uniformly within the selected bin
+     Ev       = fEnergyBins[ie] +
+                (fEnergyBins[ie+1] - fEnergyBins[ie]) * rnd->RndFlux().Rndm();
+     costheta = fCosThetaBins[ic] +
+                (fCosThetaBins[ic+1] - fCosThetaBins[ic]) * rnd->RndFlux().Rndm();
+     phi      = fPhiBins[ip] +
+                (fPhiBins[ip+1] - fPhiBins[ip]) * rnd->RndFlux().Rndm();
+
+     int inu  = fFlavourSampler[ibin].Sample(rnd->RndFlux().Rndm());
+     nu_pdg   = (*fPdgCList)[inu];
      weight   = 1.0;
+
+     fgBiasWgt = fBiasNorm / this->EnergyBias(nu_pdg, ie);
   }
 
   // Compute etc trigonometric numbers
@@ -198,6 +226,30 @@ bool GAtmoFlux::GenerateNext_1try(void)
   double y = 0.0;
   double x = 0.0;
 
+  if( fAimAtBox ){
+    // Aim the neutrino at the detector box, in the user-defined system
+    TVector3 tp3(px,py,pz);
+    if( !fRotTHz2User.IsIdentity() ) tp3 = fRotTHz2User * tp3;
+
+    TVector3 tx3;
+    bool aimed = this->AimAtBox(tp3.Unit(), tx3);
+
+    // Neutrinos missing the box count as thrown through fBoxAreaMax
+    fNNeutrinos++;
+    if( !aimed ) return false;
+
+    fgP4.SetPxPyPzE(tp3.X(), tp3.Y(), tp3.Z(), Ev);
+    fgX4.SetXYZT   (tx3.X(), tx3.Y(), tx3.Z(), 0.);
+
+    LOG("Flux", pINFO)
+         << "Generated neutrino: "
+         << "\n pdg-code: " << fgPdgC
+         << "\n p4: " << utils::print::P4AsShortString(&fgP4)
+         << "\n x4: " << utils::print::X4AsString(&fgX4);
+
+    return true;
+  }
+
   // Shift the neutrino position onto the flux generation surface.
   // The position is computed at the surface of a sphere with R=fRl
   // at the topocentric horizontal (THZ) coordinate system.
@@ -353,6 +405,13 @@ void GAtmoFlux::Initialize(void)
   fRl = 0.0;
   fRt = 0.0;
 
+  // Default: neutrinos thrown through the Rt disk, unbiased
+  fAimAtBox    = false;
+  fBoxCentre  .SetXYZ(0.,0.,0.);
+  fBoxHalfSize.SetXYZ(0.,0.,0.);
+  fBoxAreaMax  = 0.;
+  fBiasNorm    = 1.;
+
   // Default detector coord system: Topocentric Horizontal Coordinate system
   fRotTHz2User.SetToIdentity();
 
@@ -374,6 +433,7 @@ void GAtmoFlux::ResetSelection(void)
   fgP4.SetPxPyPzE (0.,0.,0.,0.);
   fgX4.SetXYZT    (0.,0.,0.,0.);
   fWeight = 0;
+  fgBiasWgt = 1;
 }
 //___________________________________________________________________________
 void GAtmoFlux::CleanUp(void)
@@ -403,6 +463,15 @@ void GAtmoFlux::CleanUp(void)
   if (fTotalFluxHisto) delete fTotalFluxHisto;
   if (fPdgCList) delete fPdgCList;
 
+  fBinSampler.Clear();
+  fFlavourSampler.clear();
+
+  map<int,TH1D*>::iterator biter = fEnergyBias.begin();
+  for( ; biter != fEnergyBias.end(); ++biter) {
+    if(biter->second) delete biter->second;
+  }
+  fEnergyBias.clear();
+
   if (fPhiBins     ) { delete[] fPhiBins     ; fPhiBins     =NULL; }
   if (fCosThetaBins) { delete[] fCosThetaBins; fCosThetaBins=NULL; }
   if (fEnergyBins  ) { delete[] fEnergyBins  ; fEnergyBins  =NULL; }
@@ -418,6 +487,79 @@ void GAtmoFlux::SetRadii(double Rlongitudinal, double Rtransverse)
   fRt = Rtransverse;
 }
 //___________________________________________________________________________
+void GAtmoFlux::SetDetectorBox(const TVector3 & centre, const TVector3 & halfsize)
+{
+// Aim the flux neutrinos at a box bounding the detector, given in the
+// user-defined topocentric coordinate system (in m) with its sides along the
+// coordinate axes. For each direction, the neutrinos cross the projection of
+// the box (rather than the Rt disk, which must enclose the detector from all
+// directions), starting at a distance Rl upstream of the box. Directions are
+// kept with a probability proportional to the projected area of the box, so
+// NFluxNeutrinos() counts the neutrinos thrown through the max. projected
+// area (see GenerationArea()).
+
+  double hx = TMath::Abs(halfsize.X());
+  double hy = TMath::Abs(halfsize.Y());
+  double hz = TMath::Abs(halfsize.Z());
+  double ax = 4*hy*hz;
+  double ay = 4*hx*hz;
+  double az = 4*hx*hy;
+
+  fBoxCentre   = centre;
+  fBoxHalfSize.SetXYZ(hx, hy, hz);
+  fBoxAreaMax  = TMath::Sqrt(ax*ax + ay*ay + az*az);
+  fAimAtBox    = (fBoxAreaMax > 0);
+
+  LOG ("Flux", pNOTICE)
+    << "Aiming the flux neutrinos at the detector box: centre = "
+    << utils::print::Vec3AsString(&fBoxCentre) << " m, half-lengths = "
+    << utils::print::Vec3AsString(&fBoxHalfSize) << " m (max. projected area = "
+    << fBoxAreaMax << " m^2)";
+}
+//___________________________________________________________________________
+double GAtmoFlux::GenerationArea(void) const
+{
+  if(fAimAtBox) return fBoxAreaMax;
+  return kPi * fRt * fRt;
+}
+//___________________________________________________________________________
+bool GAtmoFlux::AimAtBox(const TVector3 & direction, TVector3 & position)
+{
+// Selects the position of a neutrino moving along the input (unit) direction
+// uniformly over the box projection. The projected area is the sum of the
+// areas of the faces facing the neutrino weighted by |cos| of their normal,
+// so a face is selected with that probability and a point uniformly on it.
+// Returns false if the direction is rejected (see SetDetectorBox()).
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  double h[3] = { fBoxHalfSize.X(), fBoxHalfSize.Y(), fBoxHalfSize.Z() };
+  double d[3] = { direction.X(),    direction.Y(),    direction.Z()    };
+  double c[3] = { fBoxCentre.X(),   fBoxCentre.Y(),   fBoxCentre.Z()   };
+
+  double w[3];
+  w[0] = TMath::Abs(d[0]) * 4*h[1]*h[2];
+  w[1] = TMath::Abs(d[1]) * 4*h[0]*h[2];
+  w[2] = TMath::Abs(d[2]) * 4*h[0]*h[1];
+  double aproj = w[0] + w[1] + w[2];
+
+  if(rnd->RndFlux().Rndm() * fBoxAreaMax >= aproj) return false;
+
+  double r = rnd->RndFlux().Rndm() * aproj;
+  int k = (r < w[0]) ? 0 : ((r < w[0]+w[1]) ? 1 : 2);
+
+  double p[3];
+  for(int j = 0; j < 3; j++) {
+    p[j] = c[j] + h[j] * (2*rnd->RndFlux().Rndm() - 1);
+  }
+  p[k] = c[k] - ((d[k] > 0) ? h[k] : -h[k]); // the face the neutrino enters
+
+  position.SetXYZ(p[0], p[1], p[2]);
+  position -= fRl * direction;
+
+  return true;
+}
+//___________________________________________________________________________
 void GAtmoFlux::AddFluxFile(int nu_pdg, string filename)
 {
   // Check file exists
@@ -587,6 +729,110 @@ void GAtmoFlux::AddAllFluxes(void)
   }
 
   fTotalFluxHistoIntg = fTotalFluxHisto->Integral();
+
+  this->BuildSamplers();
+}
+//___________________________________________________________________________
+void GAtmoFlux::BuildSamplers(void)
+{
+// Build the alias tables selecting a (Ev,costheta,phi) bin according to the
+// combined flux and, in each bin, a neutrino species according to the flux
+// of each species (in the fPdgCList order, as in SelectNeutrino()), each
+// multiplied by its energy bias (if any).
+// Bins are numbered as (ie*fNumCosThetaBins + ic)*fNumPhiBins + ip.
+
+  int nbins = fNumEnergyBins * fNumCosThetaBins * fNumPhiBins;
+  int nnu   = fFluxHistoMap.size();
+
+  vector<double> binflux(nbins, 0.);
+  vector<double> nuflux (nbins * nnu, 0.);
+  double sum = 0, biased_sum = 0;
+
+  int inu = 0;
+  map<int,TH3D*>::const_iterator it = fFluxHistoMap.begin();
+  for( ; it != fFluxHistoMap.end(); ++it, ++inu) {
+    const TH3D * flux_histogram = it->second;
+    for(unsigned int ie = 0; ie < fNumEnergyBins; ie++) {
+      double bias = this->EnergyBias(it->first, ie);
+      for(unsigned int ic = 0; ic < fNumCosThetaBins; ic++) {
+        for(unsigned int ip = 0; ip < fNumPhiBins; ip++) {
+          int ibin = (ie*fNumCosThetaBins + ic)*fNumPhiBins + ip;
+          double flux = TMath::Max(0., flux_histogram->GetBinContent(ie+1, ic+1, ip+1));
+          nuflux[ibin*nnu + inu] = flux * bias;
+          binflux[ibin] += flux * bias;
+          sum           += flux;
+          biased_sum    += flux * bias;
+        }
+      }
+    }
+  }
+
+  if(biased_sum <= 0. && sum > 0.) {
+    LOG("Flux", pERROR)
+      << "The energy bias vanishes over the flux - Using the unbiased flux";
+    map<int,TH1D*>::iterator biter = fEnergyBias.begin();
+    for( ; biter != fEnergyBias.end(); ++biter) {
+      if(biter->second) delete biter->second;
+    }
+    fEnergyBias.clear();
+    this->BuildSamplers();
+    return;
+  }
+  fBiasNorm = (sum > 0.) ? biased_sum/sum : 1.;
+
+  fBinSampler.Build(binflux);
+  fFlavourSampler.assign(nbins, AliasSampler());
+  vector<double> w(nnu);
+  for(int ibin = 0; ibin < nbins; ibin++) {
+    if(binflux[ibin] <= 0) continue;
+    for(inu = 0; inu < nnu; inu++) w[inu] = nuflux[ibin*nnu + inu];
+    fFlavourSampler[ibin].Build(w);
+  }
+
+  LOG("Flux", pNOTICE)
+    << "Built flux alias tables for " << nbins << " bins and "
+    << nnu << " neutrino species";
+}
+//___________________________________________________________________________
+bool GAtmoFlux::SetEnergyBias(int nu_pdgc, const TH1D * bias)
+{
+// Generate the neutrinos of species nu_pdgc from their flux multiplied by the
+// input bias = f(Ev) (evaluated at the flux energy bin centres); the
+// compensating weight is returned by BiasWeight(). A null bias restores the
+// unbiased flux. Only the nominal (unweighted) flux can be biased.
+
+  if(fGenWeighted) return false;
+  if(fFluxHistoMap.find(nu_pdgc) == fFluxHistoMap.end()) return false;
+
+  map<int,TH1D*>::iterator biter = fEnergyBias.find(nu_pdgc);
+  if(biter != fEnergyBias.end()) {
+    if(biter->second) delete biter->second;
+    fEnergyBias.erase(biter);
+  }
+  if(bias) {
+    TH1D * b = new TH1D(*bias);
+    b->SetDirectory(0);
+    fEnergyBias[nu_pdgc] = b;
+  }
+
+  LOG("Flux", pNOTICE)
+     << (bias ? "Biasing" : "Unbiasing") << " the energy spectrum for pdg = "
+     << nu_pdgc;
+
+  this->BuildSamplers();
+  return true;
+}
+//___________________________________________________________________________
+double GAtmoFlux::EnergyBias(int nu_pdgc, int ie) const
+{
+// Bias of the neutrino species nu_pdgc in the energy bin ie (0-based) of
+// the flux histograms; 1 if unbiased
+
+  map<int,TH1D*>::const_iterator biter = fEnergyBias.find(nu_pdgc);
+  if(biter == fEnergyBias.end() || !biter->second) return 1.;
+  const TH1D * bias = biter->second;
+  double Ev = 0.5 * (fEnergyBins[ie] + fEnergyBins[ie+1]);
+  return TMath::Max(0., bias->GetBinContent(bias->FindBin(Ev)));
 }
 //___________________________________________________________________________
 TH3D * GAtmoFlux::CreateFluxHisto(string name, string title)
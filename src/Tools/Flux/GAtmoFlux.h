@@ -25,6 +25,10 @@
           The driver allows minimum and maximum energy cuts.
           Also it provides the options to generate wither unweighted or weighted 
           flux neutrinos (the latter giving smoother distributions at the tails).
+          For large detectors, the neutrinos can instead be aimed at a box
+          bounding the detector (see SetDetectorBox()), and the nominal flux
+          can be biased in energy for the importance sampling mode of
+          GMCJDriver (see GFluxI::SetEnergyBias()).
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -48,6 +52,7 @@
 #include <TRotation.h>
 
 #include "Framework/EventGen/GFluxI.h"
+#include "Framework/Numerical/AliasSampler.h"
 
 class TH3D;
 
@@ -75,6 +80,8 @@ public :
   virtual long int               Index         (void) { return -1;         }
   virtual void                   Clear            (Option_t * opt);
   virtual void                   GenerateWeighted (bool gen_weighted);
+  virtual bool                   SetEnergyBias    (int nu_pdgc, const TH1D * bias);
+  virtual double                 BiasWeight       (void) { return fgBiasWgt; }
 
   // get neutrino energy/direction of generated events
   double Enu        (void) { return fgP4.Energy(); }
@@ -88,6 +95,8 @@ public :
   void     ForceMaxEnergy     (double emax);
   void     SetSpectralIndex   (double index); 
   void     SetRadii           (double Rlongitudinal, double Rtransverse);
+  void     SetDetectorBox     (const TVector3 & centre, const TVector3 & halfsize); ///< Aim the neutrinos at this box (user coord system, m) instead of the Rt disk.
+  double   GenerationArea     (void) const; ///< Area (m^2) through which NFluxNeutrinos() neutrinos were thrown.
   void     SetUserCoordSystem (TRotation & rotation); ///< Rotation: Topocentric Horizontal -> User-defined Topocentric Coord System.
   void     AddFluxFile        (int neutrino_pdg, string filename);
   void     AddFluxFile        (string filename);
@@ -115,6 +124,9 @@ protected:
   void    AddAllFluxes      (void);
   int     SelectNeutrino    (double Ev, double costheta, double phi); 
   TH3D*   CreateNormalisedFluxHisto ( TH3D* hist);  // normalise flux files
+  void    BuildSamplers     (void);
+  double  EnergyBias        (int nu_pdgc, int ie) const;
+  bool    AimAtBox          (const TVector3 & direction, TVector3 & position);
 
   // pure virtual methods; to be implemented by concrete flux drivers
   virtual bool FillFluxHisto (int nu_pdg, string filename) = 0;
@@ -144,9 +156,18 @@ protected:
   TH3D *           fTotalFluxHisto;     ///< flux = f(Ev,cos8,phi) summed over neutrino species
   double           fTotalFluxHistoIntg; ///< fFluxSum2D integral 
   map<int, TH3D*>  fFluxHistoMap;       ///< flux = f(Ev,cos8,phi) for each neutrino species
+  AliasSampler     fBinSampler;         ///< (Ev,cos8,phi) bin selection according to the combined flux
+  vector<AliasSampler> fFlavourSampler; ///< neutrino species selection in each (Ev,cos8,phi) bin
   map<int, TH3D*>  fRawFluxHistoMap;    ///< flux = f(Ev,cos8,phi) for each neutrino species
   vector<int>      fFluxFlavour;        ///< input flux file for each neutrino species
   vector<string>   fFluxFile;           ///< input flux file for each neutrino species
+  map<int, TH1D*>  fEnergyBias;         ///< importance sampling bias = f(Ev) for each neutrino species (none: unbiased)
+  double           fBiasNorm;           ///< flux-averaged bias
+  double           fgBiasWgt;           ///< current generated nu bias weight (unbiased / biased pdf)
+  bool             fAimAtBox;           ///< aim the neutrinos at the detector box rather than the Rt disk?
+  TVector3         fBoxCentre;          ///< detector box centre (user-defined topocentric coord system, m)
+  TVector3         fBoxHalfSize;        ///< detector box half-lengths along the user-defined axes (m)
+  double           fBoxAreaMax;         ///< maximum projected area of the detector box (m^2)
 };
 
 } // flux namespace
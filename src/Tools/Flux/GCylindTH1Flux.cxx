@@ -15,6 +15,16 @@
    Implemented dummy versions of the new GFluxI::Clear, GFluxI::Index and
    GFluxI::GenerateWeighted methods needed for pre-generation of flux
    interaction probabilities in GMCJDriver.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Energies, neutrino species and transverse radii are sampled from tables
+   built once, when the spectra and the Rt dependence are set: alias tables
+   for the energy bin of the combined spectrum and for the species in each
+   bin, with a uniform energy within the bin, as in TH1::GetRandom(), and
+   the inverse CDF of the Rt dependence tabulated on a fine grid, linear in
+   each interval. Replaces the TH1D/TF1::GetRandom() calls (which used
+   gRandom) with draws from the RndFlux() stream.
+   Implemented GFluxI::SetEnergyBias for the importance sampling mode of
+   GMCJDriver: the tables are built from the spectra multiplied by the bias.
 
 */
 //____________________________________________________________________________
@@ -32,6 +42,7 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Numerical/AliasSampler.h"
 
 #include "Tools/Flux/GFluxDriverFactory.h"
 FLUXDRIVERREG4(genie,flux,GCylindTH1Flux,genie::flux::GCylindTH1Flux)
@@ -40,6 +51,23 @@ using namespace genie;
 using namespace genie::constants;
 using namespace genie::flux;
 
+//____________________________________________________________________________
+namespace {
+  // number of intervals tabulating the Rt dependence
+  const int kNRtIntervals = 1000;
+
+  // x in [x0,x1], distributed as the pdf linear from f0 (at x0) to f1 (at
+  // x1), for the uniform random number u
+  double SampleLinearPdf(double x0, double x1, double f0, double f1, double u)
+  {
+    double a = f1 - f0;
+    if(TMath::Abs(a) < 1e-9*(f0+f1)) return x0 + u*(x1-x0);
+    // solve f0*t + a*t^2/2 = u*(f0 + a/2), t in [0,1]
+    double c = u*(f0 + 0.5*a);
+    double t = 2*c / (f0 + TMath::Sqrt(TMath::Max(0., f0*f0 + 2*a*c)));
+    return x0 + TMath::Min(1., TMath::Max(0., t))*(x1-x0);
+  }
+}
 //____________________________________________________________________________
 GCylindTH1Flux::GCylindTH1Flux()
 {
@@ -58,7 +86,10 @@ bool GCylindTH1Flux::GenerateNext(void)
 
   //-- Generate an energy from the 'combined' spectrum histogram
   //   and compute the momentum vector
-  double Ev = (double) fTotSpectrum->GetRandom();
+  RandomGen * rnd = RandomGen::Instance();
+  int ebin = fEnergySampler.Sample(rnd->RndFlux().Rndm());
+  double Ev = fTotSpectrum->GetBinLowEdge(ebin+1) +
+              fTotSpectrum->GetBinWidth(ebin+1) * rnd->RndFlux().Rndm();
 
   TVector3 p3(*fDirVec); // momentum along the neutrino direction
   p3.SetMag(Ev);         // with |p|=Ev
@@ -67,7 +98,9 @@ bool GCylindTH1Flux::GenerateNext(void)
 
   //-- Select a neutrino species from the flux fractions at the
   //   selected energy
-  fgPdgC = (*fPdgCList)[this->SelectNeutrino(Ev)];
+  int inu = this->SelectNeutrino(ebin);
+  fgPdgC   = (*fPdgCList)[inu];
+  fgBiasWgt = fBiasNorm / this->EnergyBias(inu,ebin);
   //-- Compute neutrino 4-x
   double phi, theta;
   TVector3 bspot;
@@ -143,6 +176,7 @@ void GCylindTH1Flux::Initialize(void)
   fBeamSpot    = 0;
   fRt          =-1;
   fRtDep       = 0;
+  fBiasNorm    = 1;
 
   this->ResetSelection();
   this->SetRtDependence("x");
@@ -153,6 +187,7 @@ void GCylindTH1Flux::ResetSelection(void)
 {
 // initializing running neutrino pdg-code, 4-position, 4-momentum
   fgPdgC = 0;
+  fgBiasWgt = 1;
   fgP4.SetPxPyPzE (0.,0.,0.,0.);
   fgX4.SetXYZT    (0.,0.,0.,0.);
 }
@@ -173,6 +208,10 @@ void GCylindTH1Flux::CleanUp(void)
      delete spectrum;
      spectrum = 0;
   }
+  for(unsigned int i = 0; i < fEnergyBias.size(); i++) {
+     if(fEnergyBias[i]) delete fEnergyBias[i];
+  }
+  fEnergyBias.clear();
 }
 //___________________________________________________________________________
 void GCylindTH1Flux::SetNuDirection(const TVector3 & direction)
@@ -193,6 +232,7 @@ void GCylindTH1Flux::SetTransverseRadius(double Rt)
   fRt = Rt;
 
   if(fRtDep) fRtDep->SetRange(0,Rt);
+  this->BuildRtSampler();
 }
 //___________________________________________________________________________
 void GCylindTH1Flux::AddEnergySpectrum(int nu_pdgc, TH1D * spectrum)
@@ -207,6 +247,7 @@ void GCylindTH1Flux::AddEnergySpectrum(int nu_pdgc, TH1D * spectrum)
             << "The pdg-code isn't recognized and the spectrum was ignored";
   } else {
      fSpectrum.push_back(spectrum);
+     fEnergyBias.push_back(0);
 
      int    nb  = spectrum->GetNbinsX();
      Axis_t max = spectrum->GetBinLowEdge(nb)+spectrum->GetBinWidth(nb);
@@ -228,6 +269,32 @@ void GCylindTH1Flux::SetRtDependence(string rdep)
   if(fRtDep) delete fRtDep;
 
   fRtDep = new TF1("rdep", rdep.c_str(), 0,fRt);
+  this->BuildRtSampler();
+}
+//___________________________________________________________________________
+void GCylindTH1Flux::BuildRtSampler(void)
+{
+// Tabulate the Rt dependence on kNRtIntervals intervals over [0,Rt]: the
+// interval is selected from an alias table of the (trapezoid) interval
+// integrals and Rt within it from the pdf linear between the interval edges
+
+  fRtSampler.Clear();
+  fRtPdf.clear();
+  if(!fRtDep || fRt <= 0) return;
+
+  fRtPdf.resize(kNRtIntervals+1);
+  for(int i = 0; i <= kNRtIntervals; i++) {
+    fRtPdf[i] = TMath::Max(0., fRtDep->Eval(fRt*i/kNRtIntervals));
+  }
+  vector<double> area(kNRtIntervals);
+  for(int i = 0; i < kNRtIntervals; i++) {
+    area[i] = 0.5*(fRtPdf[i] + fRtPdf[i+1]);
+  }
+  if(!fRtSampler.Build(area)) {
+    LOG("Flux", pERROR)
+      << "The Rt dependence " << fRtDep->GetTitle()
+      << " is not positive in [0," << fRt << "]";
+  }
 }
 //___________________________________________________________________________
 void GCylindTH1Flux::AddAllFluxes(void)
@@ -247,40 +314,96 @@ void GCylindTH1Flux::AddAllFluxes(void)
      else       { fTotSpectrum->Add(spectrum);        }
      inu++;
   }
+
+  // sampling tables: energy bin from the combined spectrum (as in
+  // TH1::GetRandom(), from the in-range bin contents) and neutrino species
+  // from the spectra in each energy bin, each multiplied by its bias (if any)
+  int nbins = fTotSpectrum->GetNbinsX();
+  unsigned int nnu = fSpectrum.size();
+  vector<double> weights(nbins, 0.);
+  vector< vector<double> > fraction(nbins, vector<double>(nnu, 0.));
+  double sum = 0, biased_sum = 0;
+  for(int i = 0; i < nbins; i++) {
+     for(inu = 0; inu < nnu; inu++) {
+        double f = TMath::Max(0., fSpectrum[inu]->GetBinContent(i+1));
+        fraction[i][inu] = f * this->EnergyBias(inu,i);
+        weights[i]      += fraction[i][inu];
+        sum             += f;
+     }
+     biased_sum += weights[i];
+  }
+  if(biased_sum <= 0. && sum > 0.) {
+     LOG("Flux", pERROR)
+        << "The energy bias vanishes over the flux - Using the unbiased flux";
+     for(inu = 0; inu < fEnergyBias.size(); inu++) {
+        if(fEnergyBias[inu]) delete fEnergyBias[inu];
+        fEnergyBias[inu] = 0;
+     }
+     this->AddAllFluxes();
+     return;
+  }
+  fBiasNorm = (sum > 0.) ? biased_sum/sum : 1.;
+  fEnergySampler.Build(weights);
+
+  fFlavourSampler.assign(nbins, AliasSampler());
+  for(int i = 0; i < nbins; i++) {
+     fFlavourSampler[i].Build(fraction[i]);
+  }
 }
 //___________________________________________________________________________
-int GCylindTH1Flux::SelectNeutrino(double Ev)
+bool GCylindTH1Flux::SetEnergyBias(int nu_pdgc, const TH1D * bias)
 {
-  const unsigned int n = fPdgCList->size();
-  double fraction[n];
-
-  vector<TH1D *>::const_iterator spectrum_iter;
-
-  unsigned int inu=0;
-  for(spectrum_iter = fSpectrum.begin();
-                       spectrum_iter != fSpectrum.end(); ++spectrum_iter) {
-     TH1D * spectrum = *spectrum_iter;
-     fraction[inu++] = spectrum->GetBinContent(spectrum->FindBin(Ev));
+// Generate the neutrinos of species nu_pdgc from their spectrum multiplied
+// by the input bias = f(Ev) (evaluated at the spectrum bin centres); the
+// compensating weight is returned by BiasWeight(). A null bias restores the
+// unbiased spectrum.
+
+  int inu = -1;
+  for(unsigned int i = 0; i < fSpectrum.size() && i < fPdgCList->size(); i++) {
+     if((*fPdgCList)[i] == nu_pdgc) { inu = i; break; }
   }
+  if(inu < 0) return false;
 
-  double sum = 0;
-  for(inu = 0; inu < n; inu++) {
-     sum += fraction[inu];
-     fraction[inu] = sum;
-     LOG("Flux", pDEBUG) << "SUM-FRACTION(0->" << inu <<") = " << sum;
+  if(fEnergyBias[inu]) delete fEnergyBias[inu];
+  fEnergyBias[inu] = 0;
+  if(bias) {
+     fEnergyBias[inu] = new TH1D(*bias);
+     fEnergyBias[inu]->SetDirectory(0);
   }
 
-  RandomGen * rnd = RandomGen::Instance();
-  double R = sum * rnd->RndFlux().Rndm();
-
-  LOG("Flux", pDEBUG) << "R e [0,SUM] = " << R;
+  LOG("Flux", pNOTICE)
+     << (bias ? "Biasing" : "Unbiasing") << " the energy spectrum for pdg = " 
+     << nu_pdgc;
 
-  for(inu = 0; inu < n; inu++) {if ( R < fraction[inu] ) return inu;}
+  this->AddAllFluxes();
+  return true;
+}
+//___________________________________________________________________________
+double GCylindTH1Flux::EnergyBias(int inu, int ebin) const
+{
+// Bias of the neutrino species inu (index in fSpectrum) in the energy bin
+// ebin (0-based) of the spectra; 1 if unbiased
 
-  LOG("Flux", pERROR) << "Could not select a neutrino species";
-  assert(false);
+  TH1D * bias = fEnergyBias[inu];
+  if(!bias) return 1.;
+  double Ev = fSpectrum[inu]->GetBinCenter(ebin+1);
+  return TMath::Max(0., bias->GetBinContent(bias->FindBin(Ev)));
+}
+//___________________________________________________________________________
+int GCylindTH1Flux::SelectNeutrino(int ebin)
+{
+// Select a neutrino species from the flux fractions at the energy bin ebin
+// (0-based) of the combined spectrum
+
+  if(ebin < 0 || ebin >= (int)fFlavourSampler.size() ||
+     fFlavourSampler[ebin].IsEmpty()) {
+    LOG("Flux", pERROR) << "Could not select a neutrino species";
+    assert(false);
+    return -1;
+  }
 
-  return -1;
+  RandomGen * rnd = RandomGen::Instance();
+  return fFlavourSampler[ebin].Sample(rnd->RndFlux().Rndm());
 }
 //___________________________________________________________________________
 double GCylindTH1Flux::GeneratePhi(void) const
@@ -292,7 +415,14 @@ double GCylindTH1Flux::GeneratePhi(void) const
 //___________________________________________________________________________
 double GCylindTH1Flux::GenerateRt(void) const
 {
-  double Rt = fRtDep->GetRandom(); // rndm R [0,Rtransverse]
+  // rndm R [0,Rtransverse]
+  if(fRtSampler.IsEmpty()) return fRtDep->GetRandom();
+
+  RandomGen * rnd = RandomGen::Instance();
+  int    i  = fRtSampler.Sample(rnd->RndFlux().Rndm());
+  double dr = fRt / kNRtIntervals;
+  double Rt = SampleLinearPdf(i*dr, (i+1)*dr, fRtPdf[i], fRtPdf[i+1],
+                              rnd->RndFlux().Rndm());
   return Rt;
 }
 //___________________________________________________________________________
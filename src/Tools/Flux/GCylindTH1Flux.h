@@ -30,6 +30,7 @@
 #include <TLorentzVector.h>
 
 #include "Framework/EventGen/GFluxI.h"
+#include "Framework/Numerical/AliasSampler.h"
 
 class TH1D;
 class TF1;
@@ -66,6 +67,8 @@ public :
   long int               Index         (void) { return -1;         }
   void                   Clear            (Option_t * opt);
   void                   GenerateWeighted (bool gen_weighted);
+  bool                   SetEnergyBias    (int nu_pdgc, const TH1D * bias);
+  double                 BiasWeight       (void) { return  fgBiasWgt; }
 
 private:
 
@@ -74,7 +77,9 @@ private:
   void   CleanUp           (void);
   void   ResetSelection    (void);
   void   AddAllFluxes      (void);
-  int    SelectNeutrino    (double Ev);
+  int    SelectNeutrino    (int ebin);
+  double EnergyBias        (int inu, int ebin) const;
+  void   BuildRtSampler    (void);
   double GeneratePhi       (void) const;
   double GenerateRt        (void) const;
 
@@ -90,6 +95,13 @@ private:
   TVector3 *     fBeamSpot;    ///< beam spot position
   double         fRt;          ///< transverse size of neutrino beam
   TF1 *          fRtDep;       ///< transverse radius dependence
+  AliasSampler   fEnergySampler;            ///< energy bin selection from the combined flux
+  vector<AliasSampler> fFlavourSampler;     ///< neutrino species selection in each energy bin
+  AliasSampler   fRtSampler;                ///< Rt interval selection from the tabulated fRtDep
+  vector<double> fRtPdf;                    ///< fRtDep at the Rt interval edges
+  vector<TH1D *> fEnergyBias;               ///< importance sampling bias = f(Ev), 1/neutrino species (null: unbiased)
+  double         fBiasNorm;                 ///< flux-averaged bias
+  double         fgBiasWgt;                 ///< running generated nu bias weight (unbiased / biased pdf)
 };
 
 } // flux namespace
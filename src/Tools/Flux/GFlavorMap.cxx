@@ -7,6 +7,9 @@
 ///          Fermi National Accelerator Laboratory
 ///
 /// \update  2010-10-31 initial version
+///
+/// \update  2026-10-14 - The GENIE Collaboration
+///   Implemented the batch Probabilities() as a row lookup.
 ////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
@@ -151,6 +154,18 @@ double GFlavorMap::Probability(int pdg_initial, int pdg_final,
   return prob;
 }
 
+//____________________________________________________________________________
+void GFlavorMap::Probabilities(int pdg_initial, 
+                               const std::vector<int>& pdg_finals,
+                               double /* energy */ , double /* dist */ ,
+                               std::vector<double>& probs)
+{
+  const double* row = fProb[PDG2Indx(pdg_initial)];
+  probs.resize(pdg_finals.size());
+  for (size_t indx = 0; indx < pdg_finals.size(); ++indx ) 
+    probs[indx] = row[PDG2Indx(pdg_finals[indx])];
+}
+
 //____________________________________________________________________________
 void GFlavorMap::PrintConfig(bool /* verbose */)
 {
@@ -66,6 +66,12 @@ namespace flux {
     double    Probability(int pdg_initial, int pdg_final, 
                           double energy, double dist);
 
+    /// all final flavors at once: a lookup of one row of the map
+    void      Probabilities(int pdg_initial, 
+                            const std::vector<int>& pdg_finals,
+                            double energy, double dist,
+                            std::vector<double>& probs);
+
     /// provide a means of printing the configuration
     void     PrintConfig(bool verbose=true);
 
@@ -7,6 +7,10 @@
 ///          Fermi National Accelerator Laboratory
 ///
 /// \update  2010-10-31 initial version
+///
+/// \update  2026-10-14 - The GENIE Collaboration
+///   Added Probabilities() for the batch evaluation of all the final
+///   flavors at once.
 ////////////////////////////////////////////////////////////////////////
 
 #include "Tools/Flux/GFlavorMixerI.h"
@@ -17,5 +21,15 @@ namespace flux {
   GFlavorMixerI::GFlavorMixerI() { ; }
   GFlavorMixerI::~GFlavorMixerI() { ; }
 
+  void GFlavorMixerI::Probabilities(int pdg_initial, 
+                                    const std::vector<int>& pdg_finals,
+                                    double energy, double dist,
+                                    std::vector<double>& probs)
+  {
+    probs.resize(pdg_finals.size());
+    for (size_t indx = 0; indx < pdg_finals.size(); ++indx ) 
+      probs[indx] = Probability(pdg_initial,pdg_finals[indx],energy,dist);
+  }
+
 } // namespace flux
 } // namespace genie
@@ -30,6 +30,7 @@
 #define GENIE_FLUX_GFLAVORMIXERI_H
 
 #include <string>
+#include <vector>
 
 namespace genie {
 namespace flux {
@@ -57,6 +58,17 @@ namespace flux {
     virtual double    Probability(int pdg_initial, int pdg_final, 
                                   double energy, double dist) = 0;
 
+    /// transition probabilities from pdg_initial to each of the
+    /// pdg_finals (probs resized to match), at the same energy and
+    /// distance.  The default loops over Probability(); models for
+    /// which the probabilities share most of the calculation (e.g. a
+    /// 3-flavor mixing matrix) should override it and compute them
+    /// all in one pass.
+    virtual void      Probabilities(int pdg_initial, 
+                                    const std::vector<int>& pdg_finals,
+                                    double energy, double dist,
+                                    std::vector<double>& probs);
+
     /// provide a means of printing the configuration
     virtual void     PrintConfig(bool verbose=true) = 0;
 
@@ -13,10 +13,16 @@
 ///   and GFluxI::GenerateWeighted methods needed for pre-generation of 
 ///   flux interaction probabilities in GMCJDriver.
 ///
+/// \update  2026-10-14 - The GENIE Collaboration
+///   Ask the mixer for all the output flavors at once
+///   (GFlavorMixerI::Probabilities) and optionally tabulate them on an
+///   (energy, distance) grid (SetProbTable).
+///
 ////////////////////////////////////////////////////////////////////////
 #include <math.h>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 
 //GENIE includes
 #include "Framework/ParticleData/PDGCodes.h"
@@ -48,7 +54,14 @@ GFluxBlender::GFluxBlender() :
   fEnergy(0),
   fDistance(0),
   fPdgCGenerated(0),
-  fPdgCMixed(0)
+  fPdgCMixed(0),
+  fRndm(0),
+  fTblNE(0),
+  fTblEmin(0),
+  fTblEmax(0),
+  fTblND(0),
+  fTblDmin(0),
+  fTblDmax(0)
 { ; }
 
 GFluxBlender::~GFluxBlender()
@@ -81,6 +94,8 @@ const PDGCodeList& GFluxBlender::FluxParticles(void)
   fNPDGOut = fPDGListMixed.size();
   fProb.resize(fNPDGOut);
   fSumProb.resize(fNPDGOut);
+  // tabulated probabilities are laid out for the output flavor list
+  fProbTable.clear();
 
   if ( ! fFlavorMixer ) return fRealGFluxI->FluxParticles();
   else                  return fPDGListMixed;
@@ -155,9 +170,102 @@ GFlavorMixerI* GFluxBlender::AdoptFlavorMixer(GFlavorMixerI* mixer)
 {
   GFlavorMixerI* oldmix = fFlavorMixer;
   fFlavorMixer = mixer;
+  // tabulated probabilities belong to the previous mixer
+  fProbTable.clear();
   return oldmix;
 }
 
+//____________________________________________________________________________
+void GFluxBlender::SetProbTable(int nenergy, double emin, double emax,
+                                int ndist, double dmin, double dmax)
+{
+  fProbTable.clear();
+  if ( nenergy <= 0 || ndist <= 0 || emax < emin || dmax < dmin ) {
+    if ( nenergy > 0 ) {
+      LOG_BEGIN("FluxBlender", pWARN) 
+        << "Invalid probability table grid: E [" << emin << "," << emax
+        << "] x " << nenergy << ", dist [" << dmin << "," << dmax 
+        << "] x " << ndist << " - tabulation disabled" << LOG_END;
+    }
+    fTblNE = 0;
+    return;
+  }
+  fTblNE   = nenergy;
+  fTblEmin = emin;
+  fTblEmax = emax;
+  fTblND   = ndist;
+  fTblDmin = dmin;
+  fTblDmax = dmax;
+}
+
+//____________________________________________________________________________
+bool GFluxBlender::InProbTable(double energy, double dist) const
+{
+  return ( fTblNE > 0 &&
+           energy >= fTblEmin && energy <= fTblEmax &&
+           dist   >= fTblDmin && dist   <= fTblDmax    );
+}
+
+//____________________________________________________________________________
+const std::vector<double>& GFluxBlender::ProbTable(int pdg_init)
+{
+  std::map<int, std::vector<double> >::iterator itr = 
+    fProbTable.find(pdg_init);
+  if ( itr != fProbTable.end() ) return itr->second;
+
+  std::vector<double>& tbl = fProbTable[pdg_init];
+  tbl.resize((size_t)fTblNE*fTblND*fNPDGOut);
+  double de = ( fTblNE > 1 ) ? (fTblEmax-fTblEmin)/(fTblNE-1) : 0;
+  double dd = ( fTblND > 1 ) ? (fTblDmax-fTblDmin)/(fTblND-1) : 0;
+  std::vector<double> probs;
+  for (int ie = 0; ie < fTblNE; ++ie ) {
+    double energy = fTblEmin + ie*de;
+    for (int id = 0; id < fTblND; ++id ) {
+      double dist = fTblDmin + id*dd;
+      fFlavorMixer->Probabilities(pdg_init,fPDGListMixed,energy,dist,probs);
+      size_t offset = ((size_t)ie*fTblND+id)*fNPDGOut;
+      for (size_t indx = 0; indx < fNPDGOut; ++indx ) 
+        tbl[offset+indx] = probs[indx];
+    }
+  }
+  LOG_BEGIN("FluxBlender", pINFO) 
+    << "Tabulated transition probabilities from " << pdg_init 
+    << " on " << fTblNE << " x " << fTblND << " (E,dist) nodes" << LOG_END;
+  return tbl;
+}
+
+//____________________________________________________________________________
+void GFluxBlender::InterpolateProbTable(int pdg_init, 
+                                        double energy, double dist)
+{
+  // bilinear interpolation in the cell holding (energy,dist)
+  const std::vector<double>& tbl = ProbTable(pdg_init);
+
+  int    ie = 0, id = 0;
+  double fe = 0,  fd = 0;
+  if ( fTblNE > 1 ) {
+    double x = (energy-fTblEmin)/(fTblEmax-fTblEmin)*(fTblNE-1);
+    ie = std::min((int)x,fTblNE-2);
+    fe = x - ie;
+  }
+  if ( fTblND > 1 ) {
+    double x = (dist-fTblDmin)/(fTblDmax-fTblDmin)*(fTblND-1);
+    id = std::min((int)x,fTblND-2);
+    fd = x - id;
+  }
+  int    ie1 = ( fTblNE > 1 ) ? ie+1 : ie;
+  int    id1 = ( fTblND > 1 ) ? id+1 : id;
+
+  const double* p00 = &tbl[((size_t)ie *fTblND+id )*fNPDGOut];
+  const double* p01 = &tbl[((size_t)ie *fTblND+id1)*fNPDGOut];
+  const double* p10 = &tbl[((size_t)ie1*fTblND+id )*fNPDGOut];
+  const double* p11 = &tbl[((size_t)ie1*fTblND+id1)*fNPDGOut];
+  for (size_t indx = 0; indx < fNPDGOut; ++indx ) {
+    fProb[indx] = (1-fe)*((1-fd)*p00[indx] + fd*p01[indx]) +
+                     fe *((1-fd)*p10[indx] + fd*p11[indx]);
+  }
+}
+
 //____________________________________________________________________________
 int GFluxBlender::ChooseFlavor(int pdg_init, double energy, double dist)
 {
@@ -166,11 +274,15 @@ int GFluxBlender::ChooseFlavor(int pdg_init, double energy, double dist)
   int    pdg_out = 0;
   double sumprob = 0;
     
+  if ( InProbTable(energy,dist) ) {
+    InterpolateProbTable(pdg_init,energy,dist);
+  } else {
+    fFlavorMixer->Probabilities(pdg_init,fPDGListMixed,energy,dist,fProb);
+  }
+
   fRndm = RandomGen::Instance()->RndFlux().Rndm();
   for (size_t indx = 0; indx < fNPDGOut; ++indx ) {
     int pdg_test = fPDGListMixed[indx];
-    double prob = fFlavorMixer->Probability(pdg_init,pdg_test,energy,dist);
-    fProb[indx] = prob;
     sumprob += fProb[indx];
     fSumProb[indx] = sumprob;
     if ( ! isset && fRndm < sumprob ) {
@@ -206,6 +318,12 @@ void GFluxBlender::PrintConfig(void)
   }
   LOG_BEGIN("FluxBlender", pINFO) 
     << "   BaselineDist " << fBaselineDist << LOG_END;
+  if ( fTblNE > 0 ) {
+    LOG_BEGIN("FluxBlender", pINFO) 
+      << "   ProbTable E [" << fTblEmin << "," << fTblEmax << "] x "
+      << fTblNE << ", dist [" << fTblDmin << "," << fTblDmax << "] x "
+      << fTblND << LOG_END;
+  }
   LOG_BEGIN("FluxBlender", pINFO) 
     << "PDG List from Generator" << fPDGListGenerator << LOG_END;
   LOG_BEGIN("FluxBlender", pINFO)
@@ -30,6 +30,7 @@
 #define GENIE_FLUX_GFLUXBLENDER_H
 
 #include <vector>
+#include <map>
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 
@@ -89,11 +90,27 @@ namespace flux {
     GFluxI*         GetFluxGenerator() { return fRealGFluxI; }  ///< access, not ownership
     GFlavorMixerI*  GetFlavorMixer()   { return fFlavorMixer; } ///< access, not ownership
 
+    //
+    // Optional tabulation of the mixer transition probabilities on a
+    // regular (energy [GeV], distance [m]) grid of nenergy x ndist nodes,
+    // built lazily per initial flavor and bilinearly interpolated.
+    // Neutrinos outside the grid use the mixer directly.
+    // The grid must be fine enough to resolve the oscillations;
+    // an axis with a single node is taken as constant over its range.
+    // nenergy = 0 disables the tabulation (the default).
+    //
+    void            SetProbTable(int nenergy, double emin, double emax,
+                                 int ndist, double dmin, double dmax);
+    void            ClearProbTable(void) { fProbTable.clear(); }
+
     void            PrintConfig(void);
     void            PrintState(bool verbose=true);
 
   private:
     int             ChooseFlavor(int pdg_init, double energy, double dist);
+    bool            InProbTable(double energy, double dist) const;
+    const std::vector<double>& ProbTable(int pdg_init);
+    void            InterpolateProbTable(int pdg_init, double energy, double dist);
 
     GFluxI*         fRealGFluxI;        ///< actual flux generator
     GNuMIFlux*      fGNuMIFlux;         ///< ref to avoid repeat dynamic_cast
@@ -116,6 +133,14 @@ namespace flux {
     std::vector<double> fSumProb;       ///< cummulative probability
     double              fRndm;          ///< random # used to make choice
 
+    int             fTblNE;             ///< # of energy nodes (0: no table)
+    double          fTblEmin;           ///< energy grid range
+    double          fTblEmax;
+    int             fTblND;             ///< # of distance nodes
+    double          fTblDmin;           ///< distance grid range
+    double          fTblDmax;
+    std::map<int, std::vector<double> > fProbTable; ///< per initial flavor: probs at [(ie*fTblND+id)*fNPDGOut+iout]
+
   };
 
 } // namespace flux
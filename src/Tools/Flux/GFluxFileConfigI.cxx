@@ -23,6 +23,8 @@ namespace flux {
     , fNCycles(0)
     , fICycle(0)
     , fZ0(-3.4e38)
+    , fIShard(0)
+    , fNShards(1)
   { ; }
 
   GFluxFileConfigI::~GFluxFileConfigI() { ; }
@@ -97,6 +99,63 @@ namespace flux {
     fNCycles = TMath::Max(0L, ncycle);
   }
   //___________________________________________________________________________
+  void GFluxFileConfigI::SetEntryShard(int ishard, int nshards)
+  {
+    // Split the flux ntuple entries in nshards contiguous ranges and use
+    // only the ishard-th one, so that the jobs of a split production use
+    // disjoint sets of flux entries.
+    // The exposure per flux entry is not changed, so the POT of each job is
+    // the POT of the flux entries it used and the normalization of the
+    // merged jobs is the sum of the jobs normalizations.
+
+    if ( nshards < 1 || ishard < 0 || ishard >= nshards ) {
+      LOG("Flux", pERROR)
+        << "Invalid flux entry shard " << ishard << "/" << nshards
+        << " - Using all entries";
+      ishard  = 0;
+      nshards = 1;
+    }
+    fIShard  = ishard;
+    fNShards = nshards;
+  }
+  //___________________________________________________________________________
+  void GFluxFileConfigI::ShardEntryRange(Long64_t nentries,
+                                         Long64_t & first, Long64_t & end) const
+  {
+    first = (nentries *  fIShard   ) / fNShards;
+    end   = (nentries * (fIShard+1)) / fNShards;
+    if ( fNShards > 1 ) {
+      LOG("Flux", pNOTICE)
+        << "Using flux entries [" << first << ", " << end << ") of "
+        << nentries << " (shard " << fIShard << "/" << fNShards << ")";
+    }
+  }
+  //___________________________________________________________________________
+  void GFluxFileConfigI::SetReadAhead(Long64_t cache_bytes,
+                                      unsigned int nprefetch)
+  {
+    if ( cache_bytes > 0 || nprefetch > 0 ) {
+      LOG("Flux", pWARN)
+        << "This flux driver does not support reading its entries ahead";
+    }
+  }
+  //___________________________________________________________________________
+  bool GFluxFileConfigI::GetFluxCursor(std::vector<Long64_t> & /* counters */,
+                                       std::vector<double>   & /* sums */) const
+  {
+    LOG("Flux", pWARN)
+      << "This flux driver can not save its position in the flux ntuple(s)";
+    return false;
+  }
+  //___________________________________________________________________________
+  bool GFluxFileConfigI::SetFluxCursor(const std::vector<Long64_t> & /* counters */,
+                                       const std::vector<double>   & /* sums */)
+  {
+    LOG("Flux", pWARN)
+      << "This flux driver can not restore its position in the flux ntuple(s)";
+    return false;
+  }
+  //___________________________________________________________________________
   void GFluxFileConfigI::SetFluxParticles(const PDGCodeList & particles)
   {
     fPdgCList->Copy(particles);
@@ -20,6 +20,7 @@
 #include <vector>
 #include <set>
 
+#include "Rtypes.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 class TTree;
 
@@ -89,6 +90,28 @@ namespace flux {
     /// limit cycling through input files
     virtual void         SetNumOfCycles(long int ncycle);
 
+    /// use only the ishard-th of nshards contiguous ranges of the flux
+    /// ntuple entries (cycling within that range), for a production split
+    /// in jobs (see RunOpt, --shard i/N); call before LoadBeamSimData()
+    virtual void         SetEntryShard(int ishard, int nshards);
+
+    /// tune the reading of the flux ntuple(s): TTreeCache size (0: ROOT
+    /// default) & # of entries decoded ahead on a reader thread (0: none),
+    /// see RunOpt --flux-read-ahead; call before LoadBeamSimData().
+    /// Ignored by drivers that do not support it.
+    virtual void         SetReadAhead(Long64_t cache_bytes,
+                                      unsigned int nprefetch = 0);
+
+    /// checkpoint & restart of MC jobs (see NtpMCCheckpoint): get, or set
+    /// (after LoadBeamSimData()), the current position in the flux ntuple(s)
+    /// and the flux counters (neutrinos thrown, POTs used, ...) as integer
+    /// and floating point values, in a driver-specific order.
+    /// Return false if the driver does not support it.
+    virtual bool         GetFluxCursor(std::vector<Long64_t> & counters,
+                                       std::vector<double>   & sums) const;
+    virtual bool         SetFluxCursor(const std::vector<Long64_t> & counters,
+                                       const std::vector<double>   & sums);
+
   protected:  // visible to derived classes
 
     PDGCodeList * fPdgCList;     ///< list of neutrino pdg-codes to generate  
@@ -99,6 +122,12 @@ namespace flux {
                                  ///< default 0 = infinitely
     double        fZ0;           ///< configurable starting z position for 
                                  ///< each flux neutrino (in detector coord system)
+    int           fIShard;       ///< flux ntuple entry range (shard) used
+    int           fNShards;      ///< number of shards the entries are split in
+
+    /// entry range [first, end) of the nentries flux ntuple entries used
+    void          ShardEntryRange(Long64_t nentries,
+                                  Long64_t & first, Long64_t & end) const;
   };
 
 } // namespace flux
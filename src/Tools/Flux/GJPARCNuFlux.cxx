@@ -110,18 +110,40 @@
    properly configured by exiting within GenerateNext_weighted().
    LoadBeamSimData() now returns bool, so that the user can catch cases when
    the flux driver has not been properly configured.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   The flux files are scanned (max weight, number of neutrinos and sum of
+   weights at the detector location) file by file, on SetScanThreads()
+   threads, reading only the norm and idfd branches, and the per file
+   summaries can be kept for later jobs (SetScanCache()). Added
+   SetReadAhead(), as in GSimpleNtpFlux: a tuned TTreeCache and optionally
+   a reader thread reading entries ahead into a ring of entries.
+   Fixed the number of entries of a chain of a single file.
+   Added GetFluxCursor() and SetFluxCursor(), for checkpointing MC jobs.
 */
 //____________________________________________________________________________
 
 #include <cstdlib>
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
 #include <cassert>
+#include <map>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 
 #include <TFile.h>
 #include <TTree.h>
 #include <TChain.h>
 #include <TString.h>
 #include <TSystem.h>
+#include <TUUID.h>
+#include <TROOT.h>
+#include "RVersion.h"
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/GBuild.h"
@@ -141,11 +163,286 @@ FLUXDRIVERREG4(genie,flux,GJPARCNuFlux,genie::flux::GJPARCNuFlux)
 using std::endl;
 using std::cout;
 using std::endl;
+using std::map;
+using std::vector;
 using namespace genie;
 using namespace genie::flux;
 
 ClassImp(GJPARCNuFluxPassThroughInfo)
 
+//____________________________________________________________________________
+namespace {
+ // set the address of an existing branch
+ bool AttachBranch(TTree * tree, const char * name, void * address)
+ {
+   if( !tree || !tree->GetBranch(name) ) return false;
+   tree->SetBranchAddress(name, address);
+   return true;
+ }
+
+ // summary of the flux ntuple of one flux file, for one detector location
+ struct JPARCFileSummary {
+   JPARCFileSummary() : size(0), detlocid(0), nentries(0), maxwgt(0),
+                        sumwgt(0), nloc(0), ok(false) {}
+   string   path;
+   string   uuid;      ///< ROOT file UUID
+   Long64_t size;      ///< file size
+   int      detlocid;  ///< detector location id
+   Long64_t nentries;  ///< flux ntuple entries
+   double   maxwgt;    ///< max weight (all locations)
+   double   sumwgt;    ///< sum of weights at the detector location
+   Long64_t nloc;      ///< number of neutrinos at the detector location
+   bool     ok;
+ };
+
+ string ScanCacheKey(const JPARCFileSummary & s)
+ {
+   std::ostringstream key;
+   key << s.path << " " << s.detlocid;
+   return key.str();
+ }
+
+ TTree * GetFluxNtuple(TFile & file, bool is_nd)
+ {
+   // nd treename can be h3002 or h3001 depending on fluxfile version
+   TTree * tree = (TTree*) file.Get( is_nd ? "h3002" : "h2000" );
+   if( !tree && is_nd ) tree = (TTree*) file.Get("h3001");
+   return tree;
+ }
+
+ // file identification: the UUID set at the ROOT file creation & the size
+ bool ReadFileId(JPARCFileSummary & s)
+ {
+   TFile file(s.path.c_str(), "read");
+   if( file.IsZombie() ) return false;
+   s.uuid = file.GetUUID().AsString();
+   s.size = file.GetSize();
+   return true;
+ }
+
+ // scan the norm & idfd branches of the flux ntuple of the file
+ // (see GJPARCNuFlux::GenerateNext_weighted() for the use of the weights)
+ void ScanFluxFile(JPARCFileSummary & s, bool is_nd)
+ {
+   s.ok = false;
+   TFile file(s.path.c_str(), "read");
+   if( file.IsZombie() ) return;
+   TTree * tree = GetFluxNtuple(file, is_nd);
+   if( !tree ) return;
+
+   float norm = 0;
+   int   idfd = 0;
+   tree->SetBranchStatus("*", 0);
+   if( !AttachBranch(tree, "norm", &norm) ) return;
+   tree->SetBranchStatus("norm", 1);
+   if( is_nd ) {
+     if( !AttachBranch(tree, "idfd", &idfd) ) return;
+     tree->SetBranchStatus("idfd", 1);
+   }
+
+   s.nentries = tree->GetEntries();
+   s.maxwgt   = 0;
+   s.sumwgt   = 0;
+   s.nloc     = 0;
+   for(Long64_t ientry = 0; ientry < s.nentries; ientry++) {
+     tree->GetEntry(ientry);
+     // negative flux weights are set to 0
+     double w = TMath::Max(0., (double) norm);
+     s.maxwgt = TMath::Max(s.maxwgt, w);
+     if( is_nd && s.detlocid != idfd ) continue;
+     s.sumwgt += w;
+     s.nloc++;
+   }
+   s.ok = true;
+ }
+
+ // scan cache file: one line per file & detector location
+ void ReadScanCache(string filename, map<string, JPARCFileSummary> & cache)
+ {
+   std::ifstream in(filename.c_str());
+   string line;
+   while( std::getline(in, line) ) {
+     if( line.empty() || line[0] == '#' ) continue;
+     std::istringstream is(line);
+     JPARCFileSummary s;
+     is >> s.path >> s.uuid >> s.size >> s.detlocid
+        >> s.nentries >> s.maxwgt >> s.sumwgt >> s.nloc;
+     if( is.fail() ) continue;
+     s.ok = true;
+     cache[ScanCacheKey(s)] = s;
+   }
+ }
+
+ void WriteScanCache(string filename, const map<string, JPARCFileSummary> & cache)
+ {
+   // write a temporary file & rename it, so that concurrent jobs never
+   // read a partially written cache
+   string tmpname = Form("%s.%d", filename.c_str(), gSystem->GetPid());
+   {
+     std::ofstream out(tmpname.c_str());
+     out << "# GJPARCNuFlux flux file scan summaries\n"
+         << "# path uuid size detlocid nentries maxwgt sumwgt nloc\n";
+     out << std::setprecision(17);
+     map<string, JPARCFileSummary>::const_iterator itr = cache.begin();
+     for( ; itr != cache.end(); ++itr) {
+       const JPARCFileSummary & s = itr->second;
+       out << s.path << " " << s.uuid << " " << s.size << " " << s.detlocid
+           << " " << s.nentries << " " << s.maxwgt << " " << s.sumwgt
+           << " " << s.nloc << "\n";
+     }
+     if( !out ) {
+       LOG("Flux", pWARN) << "Couldn't write flux scan cache: " << filename;
+       return;
+     }
+   }
+   if( gSystem->Rename(tmpname.c_str(), filename.c_str()) != 0 ) {
+     LOG("Flux", pWARN) << "Couldn't write flux scan cache: " << filename;
+     gSystem->Unlink(tmpname.c_str());
+   }
+ }
+}
+
+//___________________________________________________________________________
+namespace genie {
+namespace flux  {
+ // Reader thread reading the flux (and summary) ntuple entries ahead of
+ // their use into a ring of slots. It reads the entries in sequence
+ // (wrapping around the ntuple) and restarts wherever the generation thread
+ // asks for an entry out of sequence. It owns the branch buffers.
+ class GJPARCPrefetcher {
+ public:
+   struct Slot {
+     long int ientry;
+     int      nbytes;
+     long int fluxentry;   ///< entry in the current file
+     string   filename;    ///< current file
+     GJPARCNuFluxPassThroughInfo info;
+   };
+
+   GJPARCPrefetcher(TTree * flux, TTree * sum, bool chained, string filename,
+                    GJPARCNuFluxPassThroughInfo * buffer, unsigned int nslots,
+                    long int nentries, long int start)
+     : fFlux(flux), fSum(sum), fChained(chained), fFileName(filename),
+       fBuffer(buffer), fNEntries(nentries), fNext(start), fRestart(-1),
+       fGen(0), fStop(false)
+   {
+     for(unsigned int i = 0; i < nslots; i++) fSpare.push_back(new Slot);
+     fThread = std::thread( [this] { this->Run(); } );
+   }
+  ~GJPARCPrefetcher()
+   {
+     {
+       std::lock_guard<std::mutex> lock(fMutex);
+       fStop = true;
+     }
+     fCvFreed.notify_one();
+     fThread.join();
+     for(unsigned int i = 0; i < fSpare.size();  i++) delete fSpare[i];
+     for(unsigned int i = 0; i < fFilled.size(); i++) delete fFilled[i];
+     delete fBuffer;
+   }
+
+   // copy entry ientry into the input objects, waiting for it if needed
+   int Take(long int ientry, GJPARCNuFluxPassThroughInfo * info,
+            long int & fluxentry, string & filename)
+   {
+     Slot * slot = 0;
+     {
+       std::unique_lock<std::mutex> lock(fMutex);
+       while (!slot) {
+         fCvFilled.wait(lock, [this] { return !fFilled.empty(); });
+         if (fFilled.front()->ientry == ientry) {
+           slot = fFilled.front();
+           fFilled.pop_front();
+         } else {
+           // out of sequence: drop what was read ahead, restart at ientry
+           while (!fFilled.empty()) {
+             fSpare.push_back(fFilled.front());
+             fFilled.pop_front();
+           }
+           fRestart = ientry;
+           fGen++;
+           fCvFreed.notify_one();
+         }
+       }
+     }
+
+     *info     = slot->info;
+     fluxentry = slot->fluxentry;
+     filename  = slot->filename;
+     int nbytes = slot->nbytes;
+
+     {
+       std::lock_guard<std::mutex> lock(fMutex);
+       fSpare.push_back(slot);
+     }
+     fCvFreed.notify_one();
+     return nbytes;
+   }
+
+ private:
+   void Run(void)
+   {
+     while (true) {
+       Slot * slot = 0;
+       long int ientry = 0;
+       unsigned long gen = 0;
+       {
+         std::unique_lock<std::mutex> lock(fMutex);
+         fCvFreed.wait(lock, [this] { return fStop || !fSpare.empty(); });
+         if (fStop) break;
+         if (fRestart >= 0) { fNext = fRestart; fRestart = -1; }
+         ientry = fNext;
+         fNext  = (fNext+1) % fNEntries;
+         gen    = fGen;
+         slot   = fSpare.back();
+         fSpare.pop_back();
+       }
+
+       slot->ientry = ientry;
+       slot->nbytes = fFlux->GetEntry(ientry);
+       if (fChained) {
+         TChain * chain = (TChain*) fFlux;
+         // only 1 summary entry in each file of the chain
+         if (fSum) fSum->GetEntry(chain->GetTreeNumber());
+         slot->fluxentry = chain->GetTree()->GetReadEntry();
+         slot->filename  = chain->GetFile()->GetName();
+       } else {
+         if (fSum) fSum->GetEntry(0);
+         slot->fluxentry = ientry;
+         slot->filename  = fFileName;
+       }
+       slot->info = *fBuffer;
+
+       {
+         std::lock_guard<std::mutex> lock(fMutex);
+         if (gen == fGen) fFilled.push_back(slot);
+         else             fSpare.push_back(slot);
+       }
+       fCvFilled.notify_one();
+     }
+   }
+
+   TTree *                 fFlux;
+   TTree *                 fSum;
+   bool                    fChained;
+   string                  fFileName;  ///< flux file (if not chained)
+   GJPARCNuFluxPassThroughInfo * fBuffer; ///< branch buffers
+   long int                fNEntries;
+   long int                fNext;      ///< next entry to read
+   long int                fRestart;   ///< entry to restart at (-1: none)
+   unsigned long           fGen;       ///< incremented at each restart
+   bool                    fStop;
+   std::thread             fThread;
+   std::mutex              fMutex;
+   std::condition_variable fCvFilled;  ///< a slot was filled
+   std::condition_variable fCvFreed;   ///< a slot was freed (or restart / stop)
+   std::deque<Slot *>      fFilled;    ///< slots read ahead, in sequence
+   std::vector<Slot *>     fSpare;     ///< free slots
+ };
+}
+}
+
 //____________________________________________________________________________
 GJPARCNuFlux::GJPARCNuFlux()
 {
@@ -247,7 +544,14 @@ bool GJPARCNuFlux::GenerateNext_weighted(void)
   // with the generated event branch- for use further upstream in the t2k 
   // analysis chain -eg for beam reweighting etc-)
   bool found_entry;
-  if (fNuFluxUsingTree)
+  long int fluxentry = 0;
+  std::string filename;
+  if (fPrefetcher) {
+    // flux & summary ntuple entries already read by the reader thread
+    found_entry = 
+      fPrefetcher->Take(fIEntry, fPassThroughInfo, fluxentry, filename) > 0;
+  } 
+  else if (fNuFluxUsingTree)
     found_entry = fNuFluxTree->GetEntry(fIEntry) > 0;
   else
     found_entry = fNuFluxChain->GetEntry(fIEntry) > 0;
@@ -256,12 +560,19 @@ bool GJPARCNuFlux::GenerateNext_weighted(void)
   fEntriesThisCycle++;
   fIEntry = (fIEntry+1) % fNEntries;
 
-  if (fNuFluxUsingTree) {
+  if (fPrefetcher) {
+    // summary ntuple entry read along with the flux ntuple entry
+  }
+  else if (fNuFluxUsingTree) {
     if(fNuFluxSumTree) fNuFluxSumTree->GetEntry(0); // get entry 0 as only 1 entry in tree
+    fluxentry = this->Index();
+    filename  = fNuFluxFile->GetName();
   }
   else {
     // get entry corresponding to current tree number in the chain, as only 1 entry in each tree
     if(fNuFluxSumChain) fNuFluxSumChain->GetEntry(fNuFluxChain->GetTreeNumber());
+    fluxentry = fNuFluxChain->GetTree()->GetReadEntry();
+    filename  = fNuFluxChain->GetFile()->GetName();
   }
 
   // check for negative flux weights 
@@ -404,16 +715,8 @@ bool GJPARCNuFlux::GenerateNext_weighted(void)
         << "\n x4: " << utils::print::X4AsString(&fgX4);
 #endif
   // Update flux pass through info not set as branch addresses of flux ntuples
-  if(fNuFluxUsingTree)
-    fPassThroughInfo->fluxentry = this->Index();
-  else
-    fPassThroughInfo->fluxentry = fNuFluxChain->GetTree()->GetReadEntry();
+  fPassThroughInfo->fluxentry = fluxentry;
 
-  std::string filename;
-  if(fNuFluxUsingTree)
-    filename = fNuFluxFile->GetName();
-  else
-    filename = fNuFluxChain->GetFile()->GetName();
   std::string::size_type start_pos = filename.rfind("/");
   if (start_pos == std::string::npos) start_pos = 0; else ++start_pos;
   std::string basename(filename,start_pos);
@@ -465,6 +768,57 @@ double GJPARCNuFlux::POT_curravg(void)
   return pot;
 }
 //___________________________________________________________________________
+bool GJPARCNuFlux::GetFluxCursor(std::vector<Long64_t> & counters,
+                                 std::vector<double>   & sums) const
+{
+  counters.clear();
+  counters.push_back(fIEntry);
+  counters.push_back(fEntriesThisCycle);
+  counters.push_back(fICycle);
+  counters.push_back(fOffset);
+  counters.push_back(fNDetLocIdFound);
+  counters.push_back(fNNeutrinos);
+
+  sums.clear();
+  sums.push_back(fSumWeight);
+
+  return true;
+}
+//___________________________________________________________________________
+bool GJPARCNuFlux::SetFluxCursor(const std::vector<Long64_t> & counters,
+                                 const std::vector<double>   & sums)
+{
+  if( fNEntries <= 0 || counters.size() != 6 || sums.size() != 1 ) {
+    LOG("Flux", pERROR)
+      << "Can not restore the flux ntuple position: "
+      << ((fNEntries > 0) ? "unexpected saved state" : "no flux ntuple loaded");
+    return false;
+  }
+  if( counters[0] < 0 || counters[0] >= fNEntries ) {
+    LOG("Flux", pERROR)
+      << "Can not restore the flux ntuple position: entry " << counters[0]
+      << " is not in the flux ntuple (" << fNEntries << " entries)";
+    return false;
+  }
+
+  fIEntry           = counters[0];
+  fEntriesThisCycle = counters[1];
+  fICycle           = counters[2];
+  fOffset           = counters[3];
+  fNDetLocIdFound   = counters[4];
+  fNNeutrinos       = counters[5];
+  fSumWeight        = sums[0];
+
+  // the reader thread, if any, restarts at the requested entry
+  this->ResetCurrent();
+
+  LOG("Flux", pNOTICE)
+    << "Restored flux ntuple position: entry " << fIEntry << ", cycle "
+    << fICycle << ", " << fNNeutrinos << " neutrinos thrown";
+
+  return true;
+}
+//___________________________________________________________________________
 long int GJPARCNuFlux::Index(void)
 { 
 // Return the current flux entry index. If GenerateNext has not yet been 
@@ -575,8 +929,8 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
       if (result == 0)
 	LOG("Flux", pERROR)
 	  << "** Couldn't get flux tree " << ntuple_name << " in file " << Form("%s.%i.root",fileroot.c_str(),i);
-    fNEntries = fNuFluxChain->GetEntries();
     }
+    fNEntries = fNuFluxChain->GetEntries();
   }
   
   else {
@@ -610,228 +964,334 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
   LOG("Flux", pDEBUG) 
     << "Getting tree branches & setting leaf addresses";
 
+  // Look for the flux file summary info tree (only expected for > 10a flux versions) 
+  if ( fNuFluxUsingTree ) {
+    fNuFluxSumTree = (TTree*) fNuFluxFile->Get("h1000");
+  } else {
+    fNuFluxSumChain = new TChain("h1000");
+    int result = fNuFluxSumChain->Add( Form("%s.%i.root",fileroot.c_str(),firstfile), 0 );
+    if (result==1) {
+      for (int i = firstfile+1; i < lastfile+1; i++) {
+	result = fNuFluxSumChain->Add( Form("%s.%i.root",fileroot.c_str(),i), 0 );
+      }
+    } else {
+      delete fNuFluxSumChain;
+      fNuFluxSumChain = 0;
+    }
+  }
+
   // try to get all the branches that we know about and only set address if
   // they exist
+  if( ! this->SetBranchAddresses(fPassThroughInfo) ) {
+    LOG("Flux", pFATAL)
+     << "Unable to find critical information in the flux ntuple! Initialization failed!";
+    exit(1);
+  }
+
+  // current ntuple cycle # (flux ntuples may be recycled)
+  fICycle = 1;
+
+  // sum-up weights & number of neutrinos for the specified location
+  // over a complete cycle. Also record the maximum weight.
+  // The flux files are scanned independently (possibly in parallel, and
+  // reusing the summaries of files scanned by earlier jobs)
+  vector<string> files;
+  if (fNuFluxUsingTree) files.push_back(filename);
+  else {
+    for (int i = firstfile; i < lastfile+1; i++) 
+      files.push_back( Form("%s.%i.root",fileroot.c_str(),i) );
+  }
+  this->ScanFluxFiles(files);
+
+  // Exit if have not found neutrino at specified location for whole cycle
+  if(fNDetLocIdFound == 0){
+    LOG("Flux", pFATAL)
+     << "The input jnubeam flux ntuple contains no entries for detector id "
+     << fDetLocId << ". Terminating job!";
+    exit(1); 
+  }
+  fNDetLocIdFound = 0; // reset the counter
+
+  LOG("Flux", pNOTICE) << "Maximum flux weight = " << fMaxWeight;  
+  if(fMaxWeight <=0 ) {
+      LOG("Flux", pFATAL) << "Non-positive maximum flux weight!";
+      exit(1);
+  }
+
+  LOG("Flux", pINFO)
+    << "Totals / cycle: #neutrinos = " << fNNeutrinosTot1c 
+    << ", Sum{Weights} = " << fSumWeightTot1c;
+
+  if(fUseRandomOffset){
+    this->RandomOffset();  // Random start point when looping over ntuple
+  }
+
+  this->StartReadAhead();
+
+  return true;
+}
+//___________________________________________________________________________
+bool GJPARCNuFlux::SetBranchAddresses(GJPARCNuFluxPassThroughInfo * info)
+{
+// Set the branch addresses of the flux and (if any) flux summary ntuples to
+// the data members of the input pass-through info object. Returns false if
+// a critical branch is missing.
+
+  TTree * flux = (fNuFluxUsingTree) ? fNuFluxTree    : fNuFluxChain;
+  TTree * sum  = (fNuFluxUsingTree) ? fNuFluxSumTree : fNuFluxSumChain;
+
   bool missing_critical = false;
-  TBranch * fBr = 0;
-  GJPARCNuFluxPassThroughInfo * info = fPassThroughInfo;
 
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("norm")) ) fBr->SetAddress(&info->norm);
-  else if( (fBr = fNuFluxChain->GetBranch("norm")) ) fNuFluxChain->SetBranchAddress("norm",&info->norm);
-  else { 
+  if( !AttachBranch(flux,"norm",&info->norm) ) { 
     LOG("Flux", pFATAL) <<"Cannot find flux branch: norm";
     missing_critical = true;
   }
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("Enu")) ) fBr->SetAddress(&info->Enu);
-  else if( (fBr = fNuFluxChain->GetBranch("Enu")) ) fNuFluxChain->SetBranchAddress("Enu",&info->Enu);
-  else {
+  if( !AttachBranch(flux,"Enu",&info->Enu) ) {
     LOG("Flux", pFATAL) <<"Cannot find flux branch: Enu";  
     missing_critical = true;
   }
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("ppid")) ) fBr->SetAddress(&info->ppid);
-  else if( (fBr = fNuFluxChain->GetBranch("ppid")) ) fNuFluxChain->SetBranchAddress("ppid",&info->ppid);
-  else {
+  if( !AttachBranch(flux,"ppid",&info->ppid) ) {
     LOG("Flux", pFATAL) <<"Cannot find flux branch: ppid"; 
     missing_critical = true;
   }
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("mode")) ) fBr->SetAddress(&info->mode);
-  else if( (fBr = fNuFluxChain->GetBranch("mode")) ) fNuFluxChain->SetBranchAddress("mode",&info->mode);
-  else { 
+  if( !AttachBranch(flux,"mode",&info->mode) ) { 
     LOG("Flux", pFATAL) <<"Cannot find flux branch: mode";
     missing_critical = true;
   }
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("rnu")) ) fBr->SetAddress(&info->rnu);
-  else if( (fBr = fNuFluxChain->GetBranch("rnu")) ) fNuFluxChain->SetBranchAddress("rnu",&info->rnu);
-  else if(fIsNDLoc){ // Only required for ND location
+  // Only required for ND location
+  if( !AttachBranch(flux,"rnu",&info->rnu) && fIsNDLoc ) {
     LOG("Flux", pFATAL) <<"Cannot find flux branch: rnu";
     missing_critical = true;
   } 
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("xnu")) ) fBr->SetAddress(&info->xnu);
-  else if( (fBr = fNuFluxChain->GetBranch("xnu")) ) fNuFluxChain->SetBranchAddress("xnu",&info->xnu);
-  else if(fIsNDLoc){ // Only required for ND location
+  if( !AttachBranch(flux,"xnu",&info->xnu) && fIsNDLoc ) {
     LOG("Flux", pFATAL) <<"Cannot find flux branch: xnu"; 
     missing_critical = true;
   }
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("ynu")) ) fBr->SetAddress(&info->ynu);
-  else if( (fBr = fNuFluxChain->GetBranch("ynu")) ) fNuFluxChain->SetBranchAddress("ynu",&info->ynu);
-  else if(fIsNDLoc) { // Only required for ND location
+  if( !AttachBranch(flux,"ynu",&info->ynu) && fIsNDLoc ) {
     LOG("Flux", pFATAL) <<"Cannot find flux branch: ynu"; 
     missing_critical = true;
   }
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("nnu")) ) fBr->SetAddress(info->nnu);
-  else if( (fBr = fNuFluxChain->GetBranch("nnu")) ) fNuFluxChain->SetBranchAddress("nnu",info->nnu);
-  else if(fIsNDLoc){ // Only required for ND location
+  if( !AttachBranch(flux,"nnu",info->nnu) && fIsNDLoc ) {
     LOG("Flux", pFATAL) <<"Cannot find flux branch: nnu";
     missing_critical = true;
   }
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("idfd")) ) fBr->SetAddress(&info->idfd);
-  else if( (fBr = fNuFluxChain->GetBranch("idfd")) ) fNuFluxChain->SetBranchAddress("idfd",&info->idfd);
-  else if(fIsNDLoc){ // Only required for ND location
+  if( !AttachBranch(flux,"idfd",&info->idfd) && fIsNDLoc ) {
     LOG("Flux", pFATAL) <<"Cannot find flux branch: idfd"; 
     missing_critical = true;
   }
   // check that have found essential branches
-  if(missing_critical){
-    LOG("Flux", pFATAL)
-     << "Unable to find critical information in the flux ntuple! Initialization failed!";
-    exit(1);
-  }
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("ppi"))     ) fBr->SetAddress(&info->ppi);
-  else if( (fBr = fNuFluxChain->GetBranch("ppi"))     ) fNuFluxChain->SetBranchAddress("ppi",&info->ppi);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("xpi"))     ) fBr->SetAddress(info->xpi);
-  else if( (fBr = fNuFluxChain->GetBranch("xpi"))     ) fNuFluxChain->SetBranchAddress("xpi",info->xpi);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("npi"))     ) fBr->SetAddress(info->npi);
-  else if( (fBr = fNuFluxChain->GetBranch("npi"))     ) fNuFluxChain->SetBranchAddress("npi",info->npi);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("ppi0"))    ) fBr->SetAddress(&info->ppi0);
-  else if( (fBr = fNuFluxChain->GetBranch("ppi0"))    ) fNuFluxChain->SetBranchAddress("ppi0",&info->ppi0);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("xpi0"))    ) fBr->SetAddress(info->xpi0);
-  else if( (fBr = fNuFluxChain->GetBranch("xpi0"))    ) fNuFluxChain->SetBranchAddress("xpi0",info->xpi0);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("npi0"))    ) fBr->SetAddress(info->npi0);
-  else if( (fBr = fNuFluxChain->GetBranch("npi0"))    ) fNuFluxChain->SetBranchAddress("npi0",info->npi0);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("nvtx0"))   ) fBr->SetAddress(&info->nvtx0);
-  else if( (fBr = fNuFluxChain->GetBranch("nvtx0"))   ) fNuFluxChain->SetBranchAddress("nvtx0",&info->nvtx0);
+  if(missing_critical) return false;
+
+  AttachBranch(flux,"ppi",     &info->ppi     );
+  AttachBranch(flux,"xpi",      info->xpi     );
+  AttachBranch(flux,"npi",      info->npi     );
+  AttachBranch(flux,"ppi0",    &info->ppi0    );
+  AttachBranch(flux,"xpi0",     info->xpi0    );
+  AttachBranch(flux,"npi0",     info->npi0    );
+  AttachBranch(flux,"nvtx0",   &info->nvtx0   );
   // Following branches only present since flux version 10a
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("cospibm")) ) fBr->SetAddress(&info->cospibm);
-  else if( (fBr = fNuFluxChain->GetBranch("cospibm")) ) fNuFluxChain->SetBranchAddress("cospibm",&info->cospibm);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("cospi0bm"))) fBr->SetAddress(&info->cospi0bm);
-  else if( (fBr = fNuFluxChain->GetBranch("cospi0bm"))) fNuFluxChain->SetBranchAddress("cospi0bm",&info->cospi0bm);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gamom0"))  ) fBr->SetAddress(&info->gamom0);
-  else if( (fBr = fNuFluxChain->GetBranch("gamom0"))  ) fNuFluxChain->SetBranchAddress("gamom0",&info->gamom0);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gipart"))  ) fBr->SetAddress(&info->gipart);
-  else if( (fBr = fNuFluxChain->GetBranch("gipart"))  ) fNuFluxChain->SetBranchAddress("gipart",&info->gipart);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gvec0"))   ) fBr->SetAddress(info->gvec0);
-  else if( (fBr = fNuFluxChain->GetBranch("gvec0"))   ) fNuFluxChain->SetBranchAddress("gvec0",info->gvec0);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gpos0"))   ) fBr->SetAddress(info->gpos0);
-  else if( (fBr = fNuFluxChain->GetBranch("gpos0"))   ) fNuFluxChain->SetBranchAddress("gpos0",info->gpos0);
+  AttachBranch(flux,"cospibm", &info->cospibm );
+  AttachBranch(flux,"cospi0bm",&info->cospi0bm);
+  AttachBranch(flux,"gamom0",  &info->gamom0  );
+  AttachBranch(flux,"gipart",  &info->gipart  );
+  AttachBranch(flux,"gvec0",    info->gvec0   );
+  AttachBranch(flux,"gpos0",    info->gpos0   );
   // Following branches only present since flux vesion 10d
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("ng"))      ) fBr->SetAddress(&info->ng);
-  else if( (fBr = fNuFluxChain->GetBranch("ng"))      ) fNuFluxChain->SetBranchAddress("ng",&info->ng);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gpid"))    ) fBr->SetAddress(info->gpid);
-  else if( (fBr = fNuFluxChain->GetBranch("gpid"))    ) fNuFluxChain->SetBranchAddress("gpid",info->gpid);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gmec"))    ) fBr->SetAddress(info->gmec);
-  else if( (fBr = fNuFluxChain->GetBranch("gmec"))    ) fNuFluxChain->SetBranchAddress("gmec",info->gmec);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gvx"))     ) fBr->SetAddress(info->gvx);
-  else if( (fBr = fNuFluxChain->GetBranch("gvx"))     ) fNuFluxChain->SetBranchAddress("gvx",info->gvx);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gvy"))     ) fBr->SetAddress(info->gvy);
-  else if( (fBr = fNuFluxChain->GetBranch("gvy"))     ) fNuFluxChain->SetBranchAddress("gvy",info->gvy);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gvz"))     ) fBr->SetAddress(info->gvz);
-  else if( (fBr = fNuFluxChain->GetBranch("gvz"))     ) fNuFluxChain->SetBranchAddress("gvz",info->gvz);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gpx"))     ) fBr->SetAddress(info->gpx);
-  else if( (fBr = fNuFluxChain->GetBranch("gpx"))     ) fNuFluxChain->SetBranchAddress("gpx",info->gpx);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gpy"))     ) fBr->SetAddress(info->gpy);
-  else if( (fBr = fNuFluxChain->GetBranch("gpy"))     ) fNuFluxChain->SetBranchAddress("gpy",info->gpy);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gpz"))     ) fBr->SetAddress(info->gpz);
-  else if( (fBr = fNuFluxChain->GetBranch("gpz"))     ) fNuFluxChain->SetBranchAddress("gpz",info->gpz);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gmat"))    ) fBr->SetAddress(info->gmat);
-  else if( (fBr = fNuFluxChain->GetBranch("gmat"))    ) fNuFluxChain->SetBranchAddress("gmat",info->gmat);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gdistc"))  ) fBr->SetAddress(info->gdistc);
-  else if( (fBr = fNuFluxChain->GetBranch("gdistc"))  ) fNuFluxChain->SetBranchAddress("gdistc",info->gdistc);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gdistal")) ) fBr->SetAddress(&info->gdistal);
-  else if( (fBr = fNuFluxChain->GetBranch("gdistal")) ) fNuFluxChain->SetBranchAddress("gdistal",&info->gdistal);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gdistti")) ) fBr->SetAddress(&info->gdistti);
-  else if( (fBr = fNuFluxChain->GetBranch("gdistti")) ) fNuFluxChain->SetBranchAddress("gdistti",&info->gdistti);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gdistfe")) ) fBr->SetAddress(&info->gdistfe);
-  else if( (fBr = fNuFluxChain->GetBranch("gdistfe")) ) fNuFluxChain->SetBranchAddress("gdistfe",&info->gdistfe);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("gcosbm"))  ) fBr->SetAddress(info->gcosbm);
-  else if( (fBr = fNuFluxChain->GetBranch("gcosbm"))  ) fNuFluxChain->SetBranchAddress("gcosbm",info->gcosbm);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("Enusk"))   ) fBr->SetAddress(&info->Enusk);
-  else if( (fBr = fNuFluxChain->GetBranch("Enusk"))   ) fNuFluxChain->SetBranchAddress("Enusk",&info->Enusk);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("normsk"))  ) fBr->SetAddress(&info->normsk);
-  else if( (fBr = fNuFluxChain->GetBranch("normsk"))  ) fNuFluxChain->SetBranchAddress("normsk",&info->normsk);
-  if( fNuFluxUsingTree && (fBr = fNuFluxTree->GetBranch("anorm"))   ) fBr->SetAddress(&info->anorm);
-  else if( (fBr = fNuFluxChain->GetBranch("anorm"))   ) fNuFluxChain->SetBranchAddress("anorm",&info->anorm);
+  AttachBranch(flux,"ng",      &info->ng      );
+  AttachBranch(flux,"gpid",     info->gpid    );
+  AttachBranch(flux,"gmec",     info->gmec    );
+  AttachBranch(flux,"gvx",      info->gvx     );
+  AttachBranch(flux,"gvy",      info->gvy     );
+  AttachBranch(flux,"gvz",      info->gvz     );
+  AttachBranch(flux,"gpx",      info->gpx     );
+  AttachBranch(flux,"gpy",      info->gpy     );
+  AttachBranch(flux,"gpz",      info->gpz     );
+  AttachBranch(flux,"gmat",     info->gmat    );
+  AttachBranch(flux,"gdistc",   info->gdistc  );
+  AttachBranch(flux,"gdistal", &info->gdistal );
+  AttachBranch(flux,"gdistti", &info->gdistti );
+  AttachBranch(flux,"gdistfe", &info->gdistfe );
+  AttachBranch(flux,"gcosbm",   info->gcosbm  );
+  AttachBranch(flux,"Enusk",   &info->Enusk   );
+  AttachBranch(flux,"normsk",  &info->normsk  );
+  AttachBranch(flux,"anorm",   &info->anorm   );
+
+  // flux file summary info (only expected for > 10a flux versions) 
+  if(sum) {
+    AttachBranch(sum,"version",&info->version);
+    AttachBranch(sum,"ntrig",  &info->ntrig  );
+    AttachBranch(sum,"tuneid", &info->tuneid );
+    AttachBranch(sum,"pint",   &info->pint   );
+    AttachBranch(sum,"bpos",    info->bpos   );
+    AttachBranch(sum,"btilt",   info->btilt  );
+    AttachBranch(sum,"brms",    info->brms   );
+    AttachBranch(sum,"emit",    info->emit   );
+    AttachBranch(sum,"alpha",   info->alpha  );
+    AttachBranch(sum,"hcur",    info->hcur   );
+    AttachBranch(sum,"rand",   &info->rand   );
+    AttachBranch(sum,"rseed",   info->rseed  );
+  }
+  return true;
+}
+//___________________________________________________________________________
+void GJPARCNuFlux::ScanFluxFiles(const vector<string> & files)
+{
+// Sum-up the weights & number of neutrinos for the specified location over
+// a complete cycle and find the maximum weight.
+// Each flux file is scanned independently, reading only the norm & idfd
+// branches, on up to fScanThreads threads. If a scan cache file is set, the
+// summaries of files already scanned (identified by their path, ROOT file
+// UUID and size) for the same detector location are reused and the cache
+// is updated with the files scanned by this job.
 
-  // Look for the flux file summary info tree (only expected for > 10a flux versions) 
-  if( fNuFluxUsingTree && (fNuFluxSumTree = (TTree*) fNuFluxFile->Get("h1000")) ){
-    if( (fBr = fNuFluxSumTree->GetBranch("version"))) fBr->SetAddress(&info->version);
-    if( (fBr = fNuFluxSumTree->GetBranch("ntrig"))  ) fBr->SetAddress(&info->ntrig);
-    if( (fBr = fNuFluxSumTree->GetBranch("tuneid")) ) fBr->SetAddress(&info->tuneid);
-    if( (fBr = fNuFluxSumTree->GetBranch("pint"))   ) fBr->SetAddress(&info->pint);
-    if( (fBr = fNuFluxSumTree->GetBranch("bpos"))   ) fBr->SetAddress(info->bpos);
-    if( (fBr = fNuFluxSumTree->GetBranch("btilt"))  ) fBr->SetAddress(info->btilt);
-    if( (fBr = fNuFluxSumTree->GetBranch("brms"))   ) fBr->SetAddress(info->brms);
-    if( (fBr = fNuFluxSumTree->GetBranch("emit"))   ) fBr->SetAddress(info->emit);
-    if( (fBr = fNuFluxSumTree->GetBranch("alpha"))  ) fBr->SetAddress(info->alpha);
-    if( (fBr = fNuFluxSumTree->GetBranch("hcur"))   ) fBr->SetAddress(info->hcur);
-    if( (fBr = fNuFluxSumTree->GetBranch("rand"))   ) fBr->SetAddress(&info->rand);
-    if( (fBr = fNuFluxSumTree->GetBranch("rseed"))  ) fBr->SetAddress(info->rseed);
+  fSumWeightTot1c  = 0;
+  fNNeutrinosTot1c = 0;
+  fNDetLocIdFound  = 0;
+
+  map<string, JPARCFileSummary> cache;
+  if( !fScanCacheFile.empty() ) ReadScanCache(fScanCacheFile, cache);
+
+  size_t nfiles = files.size();
+  vector<JPARCFileSummary> summaries(nfiles);
+  vector<bool>             cached   (nfiles, false);
+  for(size_t i = 0; i < nfiles; i++) {
+    summaries[i].path     = files[i];
+    summaries[i].detlocid = fDetLocId;
   }
 
-  // Look for the flux file summary info tree (only expected for > 10a flux versions) 
-  if ( !fNuFluxUsingTree ) {
-    fNuFluxSumChain = new TChain("h1000");
-    int result = fNuFluxSumChain->Add( Form("%s.%i.root",fileroot.c_str(),firstfile), 0 );
-    if (result==1) {
-      for (int i = firstfile+1; i < lastfile+1; i++) {
-	result = fNuFluxSumChain->Add( Form("%s.%i.root",fileroot.c_str(),i), 0 );
+  int nthreads = TMath::Max(1, TMath::Min(fScanThreads, (int)nfiles));
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  if(nthreads > 1) ROOT::EnableThreadSafety();
+#else
+  nthreads = 1;
+#endif
+
+  LOG("Flux", pNOTICE)
+    << "Scanning " << nfiles << " flux file(s) on " << nthreads << " thread(s)";
+
+  std::atomic<size_t> next(0);
+  bool is_nd = fIsNDLoc;
+  auto scan = [&]() {
+    size_t i;
+    while( (i = next++) < nfiles ) {
+      JPARCFileSummary & s = summaries[i];
+      if( !ReadFileId(s) ) continue;
+      map<string, JPARCFileSummary>::const_iterator citr = 
+        cache.find(ScanCacheKey(s));
+      if( citr != cache.end() && citr->second.uuid == s.uuid &&
+          citr->second.size == s.size ) {
+        s = citr->second;
+        cached[i] = true;
+        continue;
       }
-      if( (fBr = fNuFluxSumChain->GetBranch("version"))) fNuFluxSumChain->SetBranchAddress("version",&info->version);
-      if( (fBr = fNuFluxSumChain->GetBranch("ntrig"))  ) fNuFluxSumChain->SetBranchAddress("ntrig",&info->ntrig);
-      if( (fBr = fNuFluxSumChain->GetBranch("tuneid")) ) fNuFluxSumChain->SetBranchAddress("tuneid",&info->tuneid);
-      if( (fBr = fNuFluxSumChain->GetBranch("pint"))   ) fNuFluxSumChain->SetBranchAddress("pint",&info->pint);
-      if( (fBr = fNuFluxSumChain->GetBranch("bpos"))   ) fNuFluxSumChain->SetBranchAddress("bpos",info->bpos);
-      if( (fBr = fNuFluxSumChain->GetBranch("btilt"))  ) fNuFluxSumChain->SetBranchAddress("btilt",info->btilt);
-      if( (fBr = fNuFluxSumChain->GetBranch("brms"))   ) fNuFluxSumChain->SetBranchAddress("brms",info->brms);
-      if( (fBr = fNuFluxSumChain->GetBranch("emit"))   ) fNuFluxSumChain->SetBranchAddress("emit",info->emit);
-      if( (fBr = fNuFluxSumChain->GetBranch("alpha"))  ) fNuFluxSumChain->SetBranchAddress("alpha",info->alpha);
-      if( (fBr = fNuFluxSumChain->GetBranch("hcur"))   ) fNuFluxSumChain->SetBranchAddress("hcur",info->hcur);
-      if( (fBr = fNuFluxSumChain->GetBranch("rand"))   ) fNuFluxSumChain->SetBranchAddress("rand",&info->rand);
-      if( (fBr = fNuFluxSumChain->GetBranch("rseed"))  ) fNuFluxSumChain->SetBranchAddress("rseed",info->rseed);
+      ScanFluxFile(s, is_nd);
     }
+  };
+  if(nthreads == 1) scan();
+  else {
+    vector<std::thread> threads;
+    for(int ithread = 0; ithread < nthreads; ithread++) {
+      threads.push_back(std::thread(scan));
+    }
+    for(int ithread = 0; ithread < nthreads; ithread++) threads[ithread].join();
   }
 
-  // current ntuple cycle # (flux ntuples may be recycled)
-  fICycle = 1;
+  bool update_cache = false;
+  for(size_t i = 0; i < nfiles; i++) {
+    const JPARCFileSummary & s = summaries[i];
+    if( !s.ok ) {
+      LOG("Flux", pERROR) << "** Couldn't scan flux file: " << s.path;
+      continue;
+    }
+    LOG("Flux", pINFO)
+      << "Flux file " << s.path << (cached[i] ? " (cached)" : "")
+      << ": " << s.nentries << " entries, max weight = " << s.maxwgt
+      << ", #neutrinos = " << s.nloc << ", Sum{Weights} = " << s.sumwgt;
+    fMaxWeight        = TMath::Max(fMaxWeight, s.maxwgt);
+    fSumWeightTot1c  += s.sumwgt;
+    fNNeutrinosTot1c += s.nloc;
+    fNDetLocIdFound  += s.nloc;
+    if( !cached[i] ) {
+      cache[ScanCacheKey(s)] = s;
+      update_cache = true;
+    }
+  }
 
-  // sum-up weights & number of neutrinos for the specified location
-  // over a complete cycle. Also record the maximum weight as previous
-  // method using TTree::GetV1() seg faulted for more than ~1.5E6 entries
-  fSumWeightTot1c  = 0;
-  fNNeutrinosTot1c = 0;
-  fNDetLocIdFound = 0;
-  for(int ientry = 0; ientry < fNEntries; ientry++) {
-     if (fNuFluxUsingTree)
-       fNuFluxTree->GetEntry(ientry);
-     else
-       fNuFluxChain->GetEntry(ientry);
-     // check for negative flux weights
-     if(fPassThroughInfo->norm + controls::kASmallNum < 0.0){ 
-       LOG("Flux", pERROR) << "Negative flux weight! Will set weight to 0.0";
-       fPassThroughInfo->norm  = 0.0;
-     } 
-     fNorm = (double) fPassThroughInfo->norm;
-     // update maximum weight
-     fMaxWeight = TMath::Max(fMaxWeight, (double) fPassThroughInfo->norm); 
-     // compare detector location (see GenerateNext_weighted() for details)
-     if(fIsNDLoc && fDetLocId!=fPassThroughInfo->idfd) continue;
-     fSumWeightTot1c += fNorm;
-     fNNeutrinosTot1c++;
-     fNDetLocIdFound++;
+  if( update_cache && !fScanCacheFile.empty() ) {
+    WriteScanCache(fScanCacheFile, cache);
   }
-  // Exit if have not found neutrino at specified location for whole cycle
-  if(fNDetLocIdFound == 0){
-    LOG("Flux", pFATAL)
-     << "The input jnubeam flux ntuple contains no entries for detector id "
-     << fDetLocId << ". Terminating job!";
-    exit(1); 
+}
+//___________________________________________________________________________
+void GJPARCNuFlux::SetScanThreads(int nthreads)
+{
+  fScanThreads = TMath::Max(1, nthreads);
+}
+//___________________________________________________________________________
+void GJPARCNuFlux::SetScanCache(string filename)
+{
+// The summaries (entries, max weight, number of neutrinos & sum of weights at
+// the detector location) of the flux files scanned at LoadBeamSimData() are
+// kept in the input text file and reused by later jobs using the same files
+
+  fScanCacheFile = filename;
+}
+//___________________________________________________________________________
+void GJPARCNuFlux::SetReadAhead(Long64_t cache_bytes, unsigned int nprefetch)
+{
+// Tune the reading of flux files (typically on network storage):
+// cache_bytes is the size of the TTreeCache of the flux ntuple (0: keep the
+// ROOT default); with nprefetch > 0 a reader thread decodes up to nprefetch
+// entries ahead of their use, so that GenerateNext() does not wait on file
+// reads. Call before LoadBeamSimData().
+
+  fReadAheadCache = TMath::Max(0LL, (long long) cache_bytes);
+  fNPrefetch      = nprefetch;
+
+#if ROOT_VERSION_CODE < ROOT_VERSION(6,0,0)
+  if ( fNPrefetch > 0 ) {
+    LOG("Flux", pWARN)
+      << "Reading flux entries ahead requires ROOT 6 - Reading synchronously";
+    fNPrefetch = 0;
   }
-  fNDetLocIdFound = 0; // reset the counter
+#endif
+}
+//___________________________________________________________________________
+void GJPARCNuFlux::StartReadAhead(void)
+{
+  TTree * flux = (fNuFluxUsingTree) ? fNuFluxTree : fNuFluxChain;
 
-  LOG("Flux", pNOTICE) << "Maximum flux weight = " << fMaxWeight;  
-  if(fMaxWeight <=0 ) {
-      LOG("Flux", pFATAL) << "Non-positive maximum flux weight!";
-      exit(1);
+  if ( fReadAheadCache > 0 ) {
+    flux->SetCacheSize(fReadAheadCache);
+    flux->AddBranchToCache("*",kTRUE);
+    LOG("Flux", pNOTICE)
+      << "Flux ntuple TTreeCache size: " << fReadAheadCache << " bytes";
   }
 
-  LOG("Flux", pINFO)
-    << "Totals / cycle: #neutrinos = " << fNNeutrinosTot1c 
-    << ", Sum{Weights} = " << fSumWeightTot1c;
+  if ( fNPrefetch == 0 || fPrefetcher ) return;
 
-  if(fUseRandomOffset){
-    this->RandomOffset();  // Random start point when looping over ntuple
-  }
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+#endif
 
-  return true;
+  LOG("Flux", pNOTICE)
+    << "Reading flux entries from a reader thread, up to " << fNPrefetch 
+    << " entries ahead";
+
+  // the reader thread owns the branch buffers
+  GJPARCNuFluxPassThroughInfo * buffer = new GJPARCNuFluxPassThroughInfo;
+  this->SetBranchAddresses(buffer);
+
+  TTree * sum = (fNuFluxUsingTree) ? fNuFluxSumTree : fNuFluxSumChain;
+  string  filename = (fNuFluxUsingTree) ? fNuFluxFile->GetName() : "";
+  fPrefetcher = 
+    new GJPARCPrefetcher(flux, sum, !fNuFluxUsingTree, filename, buffer,
+                         fNPrefetch, fNEntries, fIEntry);
+}
+//___________________________________________________________________________
+void GJPARCNuFlux::StopReadAhead(void)
+{
+  if ( fPrefetcher ) delete fPrefetcher;
+  fPrefetcher = 0;
 }
 //___________________________________________________________________________
 void GJPARCNuFlux::SetFluxParticles(const PDGCodeList & particles)
@@ -965,6 +1425,11 @@ void GJPARCNuFlux::Initialize(void)
   fGenerateWeighted= false;
   fUseRandomOffset = true;
   fLoadedNeutrino  = false;
+  fScanThreads     = 1;
+  fScanCacheFile   = "";
+  fReadAheadCache  = 0;
+  fNPrefetch       = 0;
+  fPrefetcher      = 0;
 
   this->SetDefaults();
   this->ResetCurrent();
@@ -1015,6 +1480,8 @@ void GJPARCNuFlux::CleanUp(void)
 {
   LOG("Flux", pNOTICE) << "Cleaning up...";
 
+  this->StopReadAhead();
+
   if (fPdgCList)        delete fPdgCList;
   if (fPassThroughInfo) delete fPassThroughInfo;
 
@@ -24,6 +24,7 @@
 #define _GJPARC_NEUTRINO_FLUX_H_
 
 #include <string>
+#include <vector>
 #include <iostream>
 
 #include <TLorentzVector.h>
@@ -45,6 +46,7 @@ namespace genie {
 namespace flux  {
 
 class GJPARCNuFluxPassThroughInfo;
+class GJPARCPrefetcher;
 
 ostream & operator << (ostream & stream, const GJPARCNuFluxPassThroughInfo & info);
 
@@ -83,12 +85,20 @@ public :
   void SetNumOfCycles   (int n);                               ///< set how many times to cycle through the ntuple (default: 1 / n=0 means 'infinite')
   void DisableOffset    (void){fUseRandomOffset = false;}      ///< switch off random offset, must be called before LoadBeamSimData to have any effect 
   void RandomOffset     (void);                                ///< choose a random offset as starting entry in flux ntuple 
+  void SetScanThreads   (int nthreads);                        ///< # of threads scanning the flux files at LoadBeamSimData (default: 1)
+  void SetScanCache     (string filename);                     ///< file keeping the flux file scan summaries for later jobs (call before LoadBeamSimData)
+  void SetReadAhead     (Long64_t cache_bytes, unsigned int nprefetch=0); ///< TTreeCache size & # of entries read ahead on a reader thread (call before LoadBeamSimData)
 
   double   POT_1cycle     (void);                              ///< flux POT per cycle
   double   POT_curravg    (void);                              ///< current average POT
   long int NFluxNeutrinos (void) const { return fNNeutrinos; } ///< number of flux neutrinos looped so far
   double   SumWeight      (void) const { return fSumWeight;  } ///< intergated weight for flux neutrinos looped so far
 
+  ///< checkpoint & restart of MC jobs (see NtpMCCheckpoint): get, or set (after
+  ///< LoadBeamSimData()), the position in the flux ntuple & the flux counters
+  bool GetFluxCursor (std::vector<Long64_t> & counters, std::vector<double> & sums) const;
+  bool SetFluxCursor (const std::vector<Long64_t> & counters, const std::vector<double> & sums);
+
   const GJPARCNuFluxPassThroughInfo & 
      PassThroughInfo(void) { return *fPassThroughInfo; } ///< GJPARCNuFluxPassThroughInfo
 
@@ -102,6 +112,10 @@ private:
   void CleanUp               (void);
   void ResetCurrent          (void);
   int  DLocName2Id           (string name);
+  bool SetBranchAddresses    (GJPARCNuFluxPassThroughInfo * info);
+  void ScanFluxFiles         (const std::vector<string> & files);
+  void StartReadAhead        (void);
+  void StopReadAhead         (void);
 
   // Private data members
   //
@@ -140,6 +154,11 @@ private:
   bool      fGenerateWeighted; ///< generate weighted/deweighted flux neutrinos (default is false)
   bool      fUseRandomOffset;  ///< whether set random starting point when looping over flux ntuples
   bool      fLoadedNeutrino;   ///< set to true when GenerateNext_weighted has been called successfully
+  int       fScanThreads;      ///< number of threads scanning the flux files
+  string    fScanCacheFile;    ///< file with the flux file scan summaries ("": none)
+  Long64_t  fReadAheadCache;   ///< TTreeCache size (bytes) for the flux ntuple, 0: ROOT default
+  unsigned int fNPrefetch;     ///< # of entries decoded ahead on a reader thread, 0: no reader thread
+  GJPARCPrefetcher * fPrefetcher; ///< reader thread & ring of entries read ahead
 
   GJPARCNuFluxPassThroughInfo * fPassThroughInfo;
 };
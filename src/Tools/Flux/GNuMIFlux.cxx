@@ -163,6 +163,15 @@
  @ Mar 14, 2014 - TD
    Prevent an infinite loop in GenerateNext() when the flux driver has not been
    properly configured by exiting within GenerateNext_weighted().
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Use only the flux entry range of the job in a production split in jobs
+   (see GFluxFileConfigI::SetEntryShard()).
+   Added GetFluxCursor() and SetFluxCursor(), for checkpointing MC jobs.
+   The max weight scan on a flux window computes the neutrino energies and
+   weights of blocks of entries, optionally on several threads (see
+   SetMaxWgtScanThreads()). CalcEnuWgt() computes the solid angle without
+   trigonometric functions, in a form free of cancellations far from the
+   decay point.
 
 */
 //____________________________________________________________________________
@@ -173,6 +182,7 @@
 #include <sstream>
 #include <cassert>
 #include <climits>
+#include <thread>
 
 #include "libxml/xmlmemory.h"
 #include "libxml/parser.h"
@@ -223,6 +233,34 @@ static genie::flux::xypartials gpartials;  // global one used by CalcEnuWgt()
 using namespace genie;
 using namespace genie::flux;
 
+//___________________________________________________________________________
+namespace {
+  // max weight & energy of the neutrinos of the entries [first,last) of a
+  // block, each at its (window) point fgX4; the same weights as the ones of
+  // GenerateNext_weighted()
+  void ScanBlockWeights(const std::vector<GNuMIFluxPassThroughInfo> & block,
+                        size_t first, size_t last,
+                        const TVector3 & normal, bool apply_tilt,
+                        double & wgtmx, double & enumx)
+  {
+    wgtmx = 0;
+    enumx = 0;
+    for (size_t i = first; i < last; ++i) {
+      const GNuMIFluxPassThroughInfo & entry = block[i];
+      double Ev = 0, wgt_xy = 0;
+      entry.CalcEnuWgt(entry.fgX4,Ev,wgt_xy);
+      double wgt = entry.nimpwt * wgt_xy;
+      if ( apply_tilt ) {
+        TVector3 dirNu = ( entry.fgX4.Vect() -
+                           TVector3(entry.vx,entry.vy,entry.vz) ).Unit();
+        wgt *= TMath::Abs( dirNu.Dot(normal) );
+      }
+      if ( wgt > wgtmx ) wgtmx = wgt;
+      if ( Ev  > enumx ) enumx = Ev;
+    }
+  }
+}
+
 // declaration of helper class
 namespace genie {
   namespace flux  {
@@ -362,104 +400,7 @@ bool GNuMIFlux::GenerateNext_weighted(void)
 // Get next (weighted) flux ntuple entry on the specified detector location
 //
 
-  // Check whether a flux ntuple has been loaded
-  if ( ! fG3NuMI && ! fG4NuMI && ! fFlugg ) {
-     LOG("Flux", pFATAL)
-          << "The flux driver has not been properly configured";
-     //return false; //  don't do this - creates an infinite loop!
-     exit(1);	
-  }
-
-  // Reuse an entry?
-  //std::cout << " ***** iuse " << fIUse << " nuse " << fNUse
-  //          << " ientry " << fIEntry << " nentry " << fNEntries
-  //          << " icycle " << fICycle << " ncycle " << fNCycles << std::endl;
-  if ( fIUse < fNUse && fIEntry >= 0 ) {
-    // Reuse this entry
-    fIUse++;
-  } else {
-    // Reset previously generated neutrino code / 4-p / 4-x
-    this->ResetCurrent();
-    // Move on, read next flux ntuple entry
-    fIEntry++;
-    if ( fIEntry >= fNEntries ) {
-      // Ran out of entries @ the current cycle of this flux file
-      // Check whether more (or infinite) number of cycles is requested
-      if ( fICycle < fNCycles || fNCycles == 0 ) {
-        fICycle++;
-        fIEntry=0;
-      } else {
-        LOG("Flux", pWARN)
-          << "No more entries in input flux neutrino ntuple, cycle "
-          << fICycle << " of " << fNCycles;
-        fEnd = true;
-        // assert(0);
-        return false;	
-      }
-    }
-    
-    if ( fG3NuMI ) {
-      fG3NuMI->GetEntry(fIEntry); 
-      fCurEntry->MakeCopy(fG3NuMI); 
-    } else if ( fG4NuMI ) { 
-      fG4NuMI->GetEntry(fIEntry); 
-      fCurEntry->MakeCopy(fG4NuMI); 
-    } else if ( fFlugg ) { 
-      fFlugg->GetEntry(fIEntry); 
-      fCurEntry->MakeCopy(fFlugg); 
-    } else {
-      LOG("Flux", pERROR) << "No ntuple configured";
-      fEnd = true;
-      //assert(0);
-      return false;	
-    }
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("Flux",pDEBUG) 
-    << "got " << fNNeutrinos << " new fIEntry " << fIEntry 
-    << " evtno " << fCurEntry->evtno;
-#endif
-
-    fIUse = 1; 
-    fCurEntry->pcodes = 0;  // fetched entry has geant codes
-    fCurEntry->units  = 0;  // fetched entry has original units
-
-    // Convert the current gnumi neutrino flavor mode into a neutrino pdg code
-    // Also convert other particle codes in GNuMIFluxPassThroughInfo to PDG
-    fCurEntry->ConvertPartCodes();
-    // here we might want to do flavor oscillations or simple mappings
-    fCurEntry->fgPdgC = fCurEntry->ntype;
-  }
-
-  // Check neutrino pdg against declared list of neutrino species declared
-  // by the current instance of the NuMI neutrino flux driver.
-  // No undeclared neutrino species will be accepted at this point as GENIE
-  // has already been configured to handle the specified list.
-  // Make sure that the appropriate list of flux neutrino species was set at
-  // initialization via GNuMIFlux::SetFluxParticles(const PDGCodeList &)
-
-  // update the # POTs, number of neutrinos 
-  // do this HERE (before rejecting flavors that users might be weeding out)
-  // in order to keep the POT accounting correct.  This allows one to get
-  // the right normalization for generating only events from the intrinsic
-  // nu_e entries.
-  fAccumPOTs += fEffPOTsPerNu / fMaxWeight;
-  fNNeutrinos++;
-
-  if ( ! fPdgCList->ExistsInPDGCodeList(fCurEntry->fgPdgC) ) {
-     /// user might modify list via SetFluxParticles() in order to reject certain
-     /// flavors, even if they're found in the file.  So don't make a big fuss.
-     /// Spit out a single message and then stop reporting that flavor as problematic.
-     int badpdg = fCurEntry->fgPdgC;
-     if ( ! fPdgCListRej->ExistsInPDGCodeList(badpdg) ) {
-       fPdgCListRej->push_back(badpdg);
-       LOG("Flux", pWARN)
-         << "Encountered neutrino specie (" << badpdg 
-         << " pcodes=" << fCurEntry->pcodes << ")"
-         << " that wasn't in SetFluxParticles() list, "
-         << "\nDeclared list of neutrino species: " << *fPdgCList;
-     }
-     return false;	
-  }
+  if ( ! this->NextEntry() ) return false;
 
   // Update the curr neutrino weight and energy
 
@@ -548,6 +489,90 @@ bool GNuMIFlux::GenerateNext_weighted(void)
   return true;
 }
 //___________________________________________________________________________
+bool GNuMIFlux::NextEntry(void)
+{
+// Move on to the next flux ntuple entry (or reuse the current one), doing
+// the POT accounting; false at the end of the flux or for a rejected flavor
+//
+
+  // Check whether a flux ntuple has been loaded
+  if ( ! fG3NuMI && ! fG4NuMI && ! fFlugg ) {
+     LOG("Flux", pFATAL)
+          << "The flux driver has not been properly configured";
+     //return false; //  don't do this - creates an infinite loop!
+     exit(1);	
+  }
+
+  // Reuse an entry?
+  //std::cout << " ***** iuse " << fIUse << " nuse " << fNUse
+  //          << " ientry " << fIEntry << " nentry " << fNEntries
+  //          << " icycle " << fICycle << " ncycle " << fNCycles << std::endl;
+  if ( fIUse < fNUse && fIEntry >= 0 ) {
+    // Reuse this entry
+    fIUse++;
+  } else {
+    // Reset previously generated neutrino code / 4-p / 4-x
+    this->ResetCurrent();
+    // Move on, read next flux ntuple entry
+    fIEntry++;
+    if ( fIEntry >= fEndEntry ) {
+      // Ran out of entries @ the current cycle of this flux file
+      // Check whether more (or infinite) number of cycles is requested
+      if ( fICycle < fNCycles || fNCycles == 0 ) {
+        fICycle++;
+        fIEntry=fFirstEntry;
+      } else {
+        LOG("Flux", pWARN)
+          << "No more entries in input flux neutrino ntuple, cycle "
+          << fICycle << " of " << fNCycles;
+        fEnd = true;
+        // assert(0);
+        return false;	
+      }
+    }
+    
+    if ( ! this->ReadEntry() ) {
+      fEnd = true;
+      //assert(0);
+      return false;	
+    }
+    fIUse = 1; 
+  }
+
+  // Check neutrino pdg against declared list of neutrino species declared
+  // by the current instance of the NuMI neutrino flux driver.
+  // No undeclared neutrino species will be accepted at this point as GENIE
+  // has already been configured to handle the specified list.
+  // Make sure that the appropriate list of flux neutrino species was set at
+  // initialization via GNuMIFlux::SetFluxParticles(const PDGCodeList &)
+
+  // update the # POTs, number of neutrinos 
+  // do this HERE (before rejecting flavors that users might be weeding out)
+  // in order to keep the POT accounting correct.  This allows one to get
+  // the right normalization for generating only events from the intrinsic
+  // nu_e entries.
+  fAccumPOTs += fEffPOTsPerNu / fMaxWeight;
+  fNNeutrinos++;
+
+  if ( ! fPdgCList->ExistsInPDGCodeList(fCurEntry->fgPdgC) ) {
+     /// user might modify list via SetFluxParticles() in order to reject certain
+     /// flavors, even if they're found in the file.  So don't make a big fuss.
+     /// Spit out a single message and then stop reporting that flavor as problematic.
+     int badpdg = fCurEntry->fgPdgC;
+     if ( ! fPdgCListRej->ExistsInPDGCodeList(badpdg) ) {
+       fPdgCListRej->push_back(badpdg);
+       LOG("Flux", pWARN)
+         << "Encountered neutrino specie (" << badpdg 
+         << " pcodes=" << fCurEntry->pcodes << ")"
+         << " that wasn't in SetFluxParticles() list, "
+         << "\nDeclared list of neutrino species: " << *fPdgCList;
+     }
+     return false;	
+  }
+
+  return true;
+}
+//___________________________________________________________________________
 double GNuMIFlux::GetDecayDist() const
 {
   // return distance (user units) between dk point and start position
@@ -803,8 +828,15 @@ void GNuMIFlux::LoadBeamSimData(const std::vector<std::string>& patterns,
   // pick a starting entry index [0:fNEntries-1]
   // pretend we just used up the the previous one
   RandomGen* rnd = RandomGen::Instance();
+  // (within the entry range used by this job, see SetEntryShard())
+  this->ShardEntryRange(fNEntries, fFirstEntry, fEndEntry);
+  if ( fEndEntry <= fFirstEntry ) {
+    LOG("Flux", pFATAL)
+      << "No flux entries left for shard " << fIShard << "/" << fNShards;
+    exit(1);
+  }
   fIUse   =  9999999;
-  fIEntry = rnd->RndFlux().Integer(fNEntries) - 1;
+  fIEntry = fFirstEntry + rnd->RndFlux().Integer(fEndEntry - fFirstEntry) - 1;
   
   // don't count things we used to estimate max weight
   fSumWeight  = 0;
@@ -884,12 +916,16 @@ void GNuMIFlux::ScanForMaxWeight(void)
   double wgtgenmx = 0, enumx = 0;
   TStopwatch t;
   t.Start();
-  for (int itry=0; itry < fMaxWgtEntries; ++itry) {
-    this->GenerateNext_weighted();
-    double wgt = this->Weight();
-    if ( wgt > wgtgenmx ) wgtgenmx = wgt;
-    double enu = fCurEntry->fgP4.Energy();
-    if ( enu > enumx ) enumx = enu;
+  if ( fUseFluxAtDetCenter == 0 ) {
+    this->ScanWindowWeights(wgtgenmx,enumx);
+  } else {
+    for (int itry=0; itry < fMaxWgtEntries; ++itry) {
+      this->GenerateNext_weighted();
+      double wgt = this->Weight();
+      if ( wgt > wgtgenmx ) wgtgenmx = wgt;
+      double enu = fCurEntry->fgP4.Energy();
+      if ( enu > enumx ) enumx = enu;
+    }
   }
   t.Stop();
   t.Print("u");
@@ -913,6 +949,71 @@ void GNuMIFlux::ScanForMaxWeight(void)
 
 }
 //___________________________________________________________________________
+void GNuMIFlux::ScanWindowWeights(double & wgtmx, double & enumx)
+{
+// The max weight scan on the flux window, by blocks of entries: the entries
+// and their window points are picked serially, as GenerateNext_weighted()
+// does, then the neutrino energies & weights of the block are computed on
+// fMaxWgtThreads threads
+
+  const size_t kBlockSize = 16384;
+
+  int nthreads = TMath::Max(1, fMaxWgtThreads);
+#ifdef  GNUMI_TEST_XY_WGT
+  nthreads = 1;  // CalcEnuWgt() fills the global gpartials
+#endif
+
+  RandomGen * rnd = RandomGen::Instance();
+  TVector3 normal = this->FluxWindowNormal();
+
+  std::vector<GNuMIFluxPassThroughInfo> block;
+  block.reserve(kBlockSize);
+
+  wgtmx = 0;
+  enumx = 0;
+  long int itry = 0;
+  while ( itry < fMaxWgtEntries && ! fEnd ) {
+    block.clear();
+    for ( ; itry < fMaxWgtEntries && block.size() < kBlockSize; ++itry) {
+      if ( ! this->NextEntry() ) {
+        if ( fEnd ) break;
+        continue;
+      }
+      double r1 = rnd->RndFlux().Rndm();
+      double r2 = rnd->RndFlux().Rndm();
+      block.push_back(*fCurEntry);
+      block.back().fgX4 = fFluxWindowBase + r1*fFluxWindowDir1 + r2*fFluxWindowDir2;
+    }
+    if ( block.empty() ) break;
+
+    int nt = std::min((size_t)nthreads, block.size());
+    std::vector<double> twgtmx(nt,0), tenumx(nt,0);
+    std::vector<std::thread> workers;
+    size_t chunk = (block.size() + nt - 1) / nt;
+    for (int it = 1; it < nt; ++it) {
+      size_t first = std::min(it*chunk, block.size());
+      size_t last  = std::min(first+chunk, block.size());
+      workers.push_back(std::thread(ScanBlockWeights, std::cref(block),
+                                    first, last, std::cref(normal),
+                                    fApplyTiltWeight, std::ref(twgtmx[it]),
+                                    std::ref(tenumx[it])));
+    }
+    ScanBlockWeights(block, 0, std::min(chunk, block.size()), normal,
+                     fApplyTiltWeight, twgtmx[0], tenumx[0]);
+    for (size_t it = 0; it < workers.size(); ++it) workers[it].join();
+
+    for (int it = 0; it < nt; ++it) {
+      wgtmx = TMath::Max(wgtmx, twgtmx[it]);
+      enumx = TMath::Max(enumx, tenumx[it]);
+    }
+  }
+}
+//___________________________________________________________________________
+void GNuMIFlux::SetMaxWgtScanThreads(int nthreads)
+{
+  fMaxWgtThreads = TMath::Max(1, nthreads);
+}
+//___________________________________________________________________________
 void GNuMIFlux::SetMaxEnergy(double Ev)
 {
   fMaxEv = TMath::Max(0.,Ev);
@@ -1176,6 +1277,99 @@ void GNuMIFlux::Clear(Option_t * opt)
   fAccumPOTs  = 0;
 }
 //___________________________________________________________________________
+bool GNuMIFlux::ReadEntry(void)
+{
+// Reads the current (fIEntry) flux ntuple entry
+
+  if ( fG3NuMI ) {
+    fG3NuMI->GetEntry(fIEntry); 
+    fCurEntry->MakeCopy(fG3NuMI); 
+  } else if ( fG4NuMI ) { 
+    fG4NuMI->GetEntry(fIEntry); 
+    fCurEntry->MakeCopy(fG4NuMI); 
+  } else if ( fFlugg ) { 
+    fFlugg->GetEntry(fIEntry); 
+    fCurEntry->MakeCopy(fFlugg); 
+  } else {
+    LOG("Flux", pERROR) << "No ntuple configured";
+    return false;
+  }
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("Flux",pDEBUG) 
+    << "got " << fNNeutrinos << " new fIEntry " << fIEntry 
+    << " evtno " << fCurEntry->evtno;
+#endif
+
+  fCurEntry->pcodes = 0;  // fetched entry has geant codes
+  fCurEntry->units  = 0;  // fetched entry has original units
+
+  // Convert the current gnumi neutrino flavor mode into a neutrino pdg code
+  // Also convert other particle codes in GNuMIFluxPassThroughInfo to PDG
+  fCurEntry->ConvertPartCodes();
+  // here we might want to do flavor oscillations or simple mappings
+  fCurEntry->fgPdgC = fCurEntry->ntype;
+
+  return true;
+}
+//___________________________________________________________________________
+bool GNuMIFlux::GetFluxCursor(std::vector<Long64_t> & counters,
+                              std::vector<double>   & sums) const
+{
+  counters.clear();
+  counters.push_back(fIEntry);
+  counters.push_back(fIUse);
+  counters.push_back(fICycle);
+  counters.push_back(fNNeutrinos);
+  counters.push_back((fEnd) ? 1 : 0);
+
+  sums.clear();
+  sums.push_back(fSumWeight);
+  sums.push_back(fAccumPOTs);
+  sums.push_back(fMaxWeight);
+
+  return true;
+}
+//___________________________________________________________________________
+bool GNuMIFlux::SetFluxCursor(const std::vector<Long64_t> & counters,
+                              const std::vector<double>   & sums)
+{
+  if ( ( ! fG3NuMI && ! fG4NuMI && ! fFlugg ) ||
+       counters.size() != 5 || sums.size() != 3 ) {
+    LOG("Flux", pERROR)
+      << "Can not restore the flux ntuple position: "
+      << "no flux ntuple loaded, or unexpected saved state";
+    return false;
+  }
+  if ( counters[0] < fFirstEntry - 1 || counters[0] >= fEndEntry ) {
+    LOG("Flux", pERROR)
+      << "Can not restore the flux ntuple position: entry " << counters[0]
+      << " is not in the range of flux entries used ["
+      << fFirstEntry << ", " << fEndEntry << ")";
+    return false;
+  }
+
+  fIEntry      = counters[0];
+  fIUse        = counters[1];
+  fICycle      = counters[2];
+  fNNeutrinos  = counters[3];
+  fEnd         = (counters[4] != 0);
+
+  fSumWeight   = sums[0];
+  fAccumPOTs   = sums[1];
+  fMaxWeight   = sums[2];
+
+  // the current entry may still be re-used
+  this->ResetCurrent();
+  if ( fIEntry >= fFirstEntry ) this->ReadEntry();
+
+  LOG("Flux", pNOTICE)
+    << "Restored flux ntuple position: entry " << fIEntry
+    << " (used " << fIUse << " of " << fNUse << " times), cycle " << fICycle
+    << ", " << fNNeutrinos << " neutrinos thrown, " << fAccumPOTs << " POTs";
+
+  return true;
+}
+//___________________________________________________________________________
 void GNuMIFlux::GenerateWeighted(bool gen_weighted)
 {
   // Set whether to generate weighted rays
@@ -1202,6 +1396,8 @@ void GNuMIFlux::Initialize(void)
 
   fNEntries        =  0;
   fIEntry          = -1;
+  fFirstEntry      =  0;
+  fEndEntry        =  0;
   fICycle          =  0;
   fNUse            =  1;
   fIUse            =  999999;
@@ -1212,6 +1408,7 @@ void GNuMIFlux::Initialize(void)
   fMaxWeight       = -1;
   fMaxWgtFudge     =  1.05;
   fMaxWgtEntries   = 2500000;
+  fMaxWgtThreads   =  1;
   fMaxEFudge       =  0;
 
   fSumWeight       =  0;
@@ -2023,7 +2220,9 @@ int GNuMIFluxPassThroughInfo::CalcEnuWgt(const TLorentzVector& xyz,
                      / ( parentp * rad);
     if ( costh_pardet >  1.0 ) costh_pardet =  1.0;
     if ( costh_pardet < -1.0 ) costh_pardet = -1.0;
-    theta_pardet = TMath::ACos(costh_pardet);
+#ifdef  GNUMI_TEST_XY_WGT
+    theta_pardet = TMath::ACos(costh_pardet);  // only kept for the partials
+#endif
 
     // Weighted neutrino energy in beam, approx, good for small theta
     emrat = 1.0 / ( gamma * ( 1.0 - beta_mag * costh_pardet ));
@@ -2066,10 +2265,11 @@ int GNuMIFluxPassThroughInfo::CalcEnuWgt(const TLorentzVector& xyz,
   // small angle approximation, fixed by Alex Radovic
   //SAA//double sangdet = ( kRDET*kRDET / ( (zpos-this->vz)*(zpos-this->vz)))/4.0;
   
-  double sanddetcomp = TMath::Sqrt(( (xpos-this->vx)*(xpos-this->vx) ) +
-                                   ( (ypos-this->vy)*(ypos-this->vy) ) +
-                                   ( (zpos-this->vz)*(zpos-this->vz) )   );
-  double sangdet = ( 1.0 - TMath::Cos(TMath::ATan( kRDET / sanddetcomp)))/2.0;
+  // (1-cos(atan(kRDET/rad)))/2, without trigonometric functions and without
+  // the cancellation of 1-cos for rad >> kRDET
+  //TRIG//double sangdet = ( 1.0 - TMath::Cos(TMath::ATan( kRDET / rad)))/2.0;
+  double hyp     = TMath::Sqrt( rad*rad + kRDET*kRDET );
+  double sangdet = ( kRDET*kRDET / ( hyp * ( hyp + rad ) ) )/2.0;
 
   // Weight for solid angle and lorentz boost
   wgt_xy = sangdet * ( emrat * emrat );  // ! the weight ... normally
@@ -281,6 +281,10 @@ public :
                              std::vector<std::string>& branchClassNames,
                              std::vector<void**>&      branchObjPointers);
   virtual TTree* GetMetaDataTree();
+  virtual bool  GetFluxCursor(std::vector<Long64_t> & counters,
+                              std::vector<double>   & sums) const;
+  virtual bool  SetFluxCursor(const std::vector<Long64_t> & counters,
+                              const std::vector<double>   & sums);
 
   //
   // configuration of GNuMIFlux
@@ -297,6 +301,7 @@ public :
   void      ScanForMaxWeight(void);                               ///< scan for max flux weight (before generating unweighted flux neutrinos)
   void      SetMaxWgtScan(double fudge = 1.05, long int nentries = 2500000)      ///< configuration when estimating max weight
             { fMaxWgtFudge = fudge; fMaxWgtEntries = nentries; }
+  void      SetMaxWgtScanThreads(int nthreads = 1);               ///< # of threads computing weights in the max weight scan on a flux window
   void      SetMaxEFudge(double fudge = 1.05)                     ///< extra fudge factor in estimating maximum energy
             { fMaxEFudge = fudge; }
   void      SetApplyWindowTiltWeight(bool apply = true)           ///< apply wgt due to tilt of flux window relative to beam
@@ -372,10 +377,13 @@ private:
   // Private methods
   //
   bool GenerateNext_weighted (void);
+  bool NextEntry             (void);
+  void ScanWindowWeights     (double & wgtmx, double & enumx);
   void Initialize            (void);
   void SetDefaults           (void);
   void CleanUp               (void);
   void ResetCurrent          (void);
+  bool ReadEntry             (void);
   void AddFile               (TTree* tree, string fname);
   void CalcEffPOTsPerNu      (void);
   
@@ -394,6 +402,8 @@ private:
   int       fNFiles;              ///< number of files in chain
   Long64_t  fNEntries;            ///< number of flux ntuple entries
   Long64_t  fIEntry;              ///< current flux ntuple entry
+  Long64_t  fFirstEntry;          ///< first flux ntuple entry used (see SetEntryShard())
+  Long64_t  fEndEntry;            ///< one past the last flux ntuple entry used
   Long64_t  fNuTot;               ///< cummulative # of entries (=fNEntries)
   Long64_t  fFilePOTs;            ///< # of protons-on-target represented by all files
 
@@ -401,6 +411,7 @@ private:
   double    fMaxWeight;           ///< max flux neutrino weight in input file
   double    fMaxWgtFudge;         ///< fudge factor for estimating max wgt
   long int  fMaxWgtEntries;       ///< # of entries in estimating max wgt
+  int       fMaxWgtThreads;       ///< # of threads computing weights in estimating max wgt
   double    fMaxEFudge;           ///< fudge factor for estmating max enu (0=> use fixed 120GeV)
 
   long int  fNUse;                ///< how often to use same entry in a row
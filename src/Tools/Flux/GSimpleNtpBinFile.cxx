@@ -0,0 +1,346 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <TTree.h>
+#include <TBufferFile.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Tools/Flux/GSimpleNtpBinFile.h"
+#include "Tools/Flux/GSimpleNtpFlux.h"
+
+using namespace genie;
+using namespace genie::flux;
+
+//____________________________________________________________________________
+namespace {
+
+  const char     kMagic[8]  = { 'G','S','N','T','P','B','I','N' };
+  const UInt_t   kVersion   = 1;
+  const UInt_t   kByteOrder = 0x01020304;
+  const UInt_t   kHasNuMI   = 0x1;
+  const Long64_t kAlign     = 64;
+
+  // file layout: header | records (from recoffset) | meta (from metaoffset)
+  struct BinHeader {
+    char     magic[8];
+    UInt_t   version;
+    UInt_t   byteorder;
+    Long64_t nentries;
+    UInt_t   recsize;
+    UInt_t   flags;
+    Long64_t recoffset;
+    Long64_t metaoffset;
+    Long64_t metasize;
+    UInt_t   nmeta;
+    UInt_t   unused;
+  };
+
+  // record contents, largest elements first (records are 8 byte aligned)
+  struct BinEntry {
+    Double_t wgt, vtxx, vtxy, vtxz, dist, px, py, pz, E;
+    Int_t    pdg;
+    UInt_t   metakey;
+  };
+  struct BinNuMI {
+    Double_t tpx, tpy, tpz, vx, vy, vz, pdpx, pdpy, pdpz, pppx, pppy, pppz;
+    Int_t    ndecay, ptype, ppmedium, tptype, run, evtno, entryno;
+    Int_t    unused;
+  };
+
+  Long64_t Aligned(Long64_t offset)
+  {
+    return ((offset + kAlign - 1) / kAlign) * kAlign;
+  }
+}
+//____________________________________________________________________________
+GSimpleNtpBinFile::GSimpleNtpBinFile() :
+fData       (0),
+fSize       (0),
+fRecords    (0),
+fNEntries   (0),
+fRecordSize (0),
+fHasNuMI    (false)
+{
+
+}
+//____________________________________________________________________________
+GSimpleNtpBinFile::~GSimpleNtpBinFile()
+{
+  this->Close();
+}
+//____________________________________________________________________________
+bool GSimpleNtpBinFile::IsBinFile(string filename)
+{
+  std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+  if ( ! in ) return false;
+  char magic[8];
+  in.read(magic, sizeof(magic));
+  return ( in && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0 );
+}
+//____________________________________________________________________________
+bool GSimpleNtpBinFile::Write(
+       string filename, TTree * flux, TTree * meta, bool with_numi)
+{
+  if ( ! flux || ! flux->GetBranch("entry") ) {
+    LOG("Flux", pERROR) << "No flux tree with an \"entry\" branch to write";
+    return false;
+  }
+  with_numi = with_numi && ( flux->GetBranch("numi") != 0 );
+
+  std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+  if ( ! out ) {
+    LOG("Flux", pERROR) << "Can not open " << filename << " for writing";
+    return false;
+  }
+
+  BinHeader hdr;
+  std::memset(&hdr, 0, sizeof(hdr));
+  std::memcpy(hdr.magic, kMagic, sizeof(kMagic));
+  hdr.version   = kVersion;
+  hdr.byteorder = kByteOrder;
+  hdr.nentries  = flux->GetEntries();
+  hdr.recsize   = sizeof(BinEntry) + ((with_numi) ? sizeof(BinNuMI) : 0);
+  hdr.flags     = (with_numi) ? kHasNuMI : 0;
+  hdr.recoffset = Aligned(sizeof(hdr));
+
+  // placeholder header, rewritten once the meta data size is known
+  std::vector<char> pad(hdr.recoffset, 0);
+  out.write(&pad[0], pad.size());
+
+  GSimpleNtpEntry * entry = new GSimpleNtpEntry;
+  GSimpleNtpNuMI  * numi  = (with_numi) ? new GSimpleNtpNuMI : 0;
+  flux->SetBranchStatus("*", 0);
+  flux->SetBranchStatus("entry*", 1);
+  flux->SetBranchAddress("entry", &entry);
+  if ( numi ) {
+    flux->SetBranchStatus("numi*", 1);
+    flux->SetBranchAddress("numi", &numi);
+  }
+
+  std::vector<char> rec(hdr.recsize, 0);
+  for (Long64_t i = 0; i < hdr.nentries; ++i) {
+    flux->GetEntry(i);
+    BinEntry * be = (BinEntry *) &rec[0];
+    be->wgt  = entry->wgt;
+    be->vtxx = entry->vtxx;  be->vtxy = entry->vtxy;  be->vtxz = entry->vtxz;
+    be->dist = entry->dist;
+    be->px   = entry->px;    be->py   = entry->py;    be->pz   = entry->pz;
+    be->E    = entry->E;
+    be->pdg  = entry->pdg;
+    be->metakey = entry->metakey;
+    if ( numi ) {
+      BinNuMI * bn = (BinNuMI *) &rec[sizeof(BinEntry)];
+      bn->tpx  = numi->tpx;   bn->tpy  = numi->tpy;   bn->tpz  = numi->tpz;
+      bn->vx   = numi->vx;    bn->vy   = numi->vy;    bn->vz   = numi->vz;
+      bn->pdpx = numi->pdpx;  bn->pdpy = numi->pdpy;  bn->pdpz = numi->pdpz;
+      bn->pppx = numi->pppx;  bn->pppy = numi->pppy;  bn->pppz = numi->pppz;
+      bn->ndecay   = numi->ndecay;
+      bn->ptype    = numi->ptype;
+      bn->ppmedium = numi->ppmedium;
+      bn->tptype   = numi->tptype;
+      bn->run      = numi->run;
+      bn->evtno    = numi->evtno;
+      bn->entryno  = numi->entryno;
+    }
+    out.write(&rec[0], rec.size());
+  }
+  flux->ResetBranchAddresses();
+  flux->SetBranchStatus("*", 1);
+  delete entry;
+  delete numi;
+
+  // meta data: (length, streamed GSimpleNtpMeta) for each meta tree entry
+  Long64_t end = hdr.recoffset + hdr.nentries * (Long64_t) hdr.recsize;
+  hdr.metaoffset = Aligned(end);
+  pad.assign(hdr.metaoffset - end, 0);
+  if ( ! pad.empty() ) out.write(&pad[0], pad.size());
+
+  if ( meta && meta->GetBranch("meta") ) {
+    GSimpleNtpMeta * m = new GSimpleNtpMeta;
+    meta->SetBranchAddress("meta", &m);
+    Long64_t nmeta = meta->GetEntries();
+    for (Long64_t i = 0; i < nmeta; ++i) {
+      meta->GetEntry(i);
+      TBufferFile buf(TBuffer::kWrite);
+      buf.WriteObjectAny(m, GSimpleNtpMeta::Class());
+      UInt_t len = buf.Length();
+      out.write((const char *) &len, sizeof(len));
+      out.write(buf.Buffer(), len);
+      hdr.metasize += sizeof(len) + len;
+      hdr.nmeta++;
+    }
+    meta->ResetBranchAddresses();
+    delete m;
+  } else {
+    LOG("Flux", pWARN) << "No meta data written to " << filename;
+  }
+
+  out.seekp(0);
+  out.write((const char *) &hdr, sizeof(hdr));
+  out.close();
+  if ( ! out ) {
+    LOG("Flux", pERROR) << "Failed writing " << filename;
+    return false;
+  }
+
+  LOG("Flux", pNOTICE)
+    << "Wrote " << hdr.nentries << " flux entries ("
+    << ((with_numi) ? "entry+numi" : "entry") << ", " << hdr.recsize
+    << " bytes each) and " << hdr.nmeta << " meta data to " << filename;
+
+  return true;
+}
+//____________________________________________________________________________
+bool GSimpleNtpBinFile::Open(string filename)
+{
+  this->Close();
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if ( fd < 0 ) {
+    LOG("Flux", pERROR) << "Can not open flux file " << filename;
+    return false;
+  }
+  struct stat st;
+  if ( fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(BinHeader) ) {
+    LOG("Flux", pERROR) << "Flux file " << filename << " is truncated";
+    close(fd);
+    return false;
+  }
+  void * data = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if ( data == MAP_FAILED ) {
+    LOG("Flux", pERROR) << "Can not memory map flux file " << filename;
+    return false;
+  }
+  fData     = (char *) data;
+  fSize     = st.st_size;
+  fFileName = filename;
+
+  const BinHeader * hdr = (const BinHeader *) fData;
+  bool ok = ( std::memcmp(hdr->magic, kMagic, sizeof(kMagic)) == 0 );
+  if ( ok && hdr->byteorder != kByteOrder ) {
+    LOG("Flux", pERROR)
+      << "Flux file " << filename << " was written on a machine of the "
+      << "other byte order";
+    ok = false;
+  }
+  if ( ok && hdr->version != kVersion ) {
+    LOG("Flux", pERROR)
+      << "Flux file " << filename << " has unsupported version "
+      << hdr->version;
+    ok = false;
+  }
+  UInt_t recsize = sizeof(BinEntry) +
+                   ((hdr->flags & kHasNuMI) ? sizeof(BinNuMI) : 0);
+  if ( ok && ( hdr->recsize != recsize ||
+               hdr->recoffset + hdr->nentries * (Long64_t) recsize > fSize ||
+               hdr->metaoffset + hdr->metasize > fSize ) ) {
+    LOG("Flux", pERROR) << "Flux file " << filename << " is corrupted";
+    ok = false;
+  }
+  if ( ! ok ) {
+    this->Close();
+    return false;
+  }
+
+  fRecords    = fData + hdr->recoffset;
+  fNEntries   = hdr->nentries;
+  fRecordSize = hdr->recsize;
+  fHasNuMI    = ( hdr->flags & kHasNuMI );
+
+  const char * p   = fData + hdr->metaoffset;
+  const char * end = p + hdr->metasize;
+  for (UInt_t i = 0; i < hdr->nmeta && p + sizeof(UInt_t) <= end; ++i) {
+    UInt_t len;
+    std::memcpy(&len, p, sizeof(len));
+    p += sizeof(len);
+    if ( p + len > end ) break;
+    TBufferFile buf(TBuffer::kRead, len, (void *) p, kFALSE);
+    GSimpleNtpMeta * m =
+      (GSimpleNtpMeta *) buf.ReadObjectAny(GSimpleNtpMeta::Class());
+    if ( m ) fMeta.push_back(m);
+    p += len;
+  }
+  if ( fMeta.size() != hdr->nmeta ) {
+    LOG("Flux", pERROR)
+      << "Read " << fMeta.size() << " of the " << hdr->nmeta
+      << " meta data of flux file " << filename;
+  }
+
+  // records are read from random starting points, but then in sequence
+  madvise(fData, fSize, MADV_SEQUENTIAL);
+
+  LOG("Flux", pNOTICE)
+    << "Mapped flat binary flux file " << filename << ": " << fNEntries
+    << " entries" << ((fHasNuMI) ? " [+numi]" : "")
+    << ", " << fMeta.size() << " meta data";
+
+  return true;
+}
+//____________________________________________________________________________
+void GSimpleNtpBinFile::Close(void)
+{
+  for (unsigned int i = 0; i < fMeta.size(); ++i) delete fMeta[i];
+  fMeta.clear();
+
+  if ( fData ) munmap(fData, fSize);
+  fData       = 0;
+  fSize       = 0;
+  fRecords    = 0;
+  fNEntries   = 0;
+  fRecordSize = 0;
+  fHasNuMI    = false;
+}
+//____________________________________________________________________________
+Int_t GSimpleNtpBinFile::Read(
+   Long64_t ientry, GSimpleNtpEntry * entry, GSimpleNtpNuMI * numi) const
+{
+  if ( ! fRecords || ientry < 0 || ientry >= fNEntries ) return 0;
+
+  const char * rec = fRecords + ientry * (Long64_t) fRecordSize;
+
+  const BinEntry * be = (const BinEntry *) rec;
+  entry->wgt  = be->wgt;
+  entry->vtxx = be->vtxx;  entry->vtxy = be->vtxy;  entry->vtxz = be->vtxz;
+  entry->dist = be->dist;
+  entry->px   = be->px;    entry->py   = be->py;    entry->pz   = be->pz;
+  entry->E    = be->E;
+  entry->pdg  = be->pdg;
+  entry->metakey = be->metakey;
+
+  if ( numi && fHasNuMI ) {
+    const BinNuMI * bn = (const BinNuMI *) (rec + sizeof(BinEntry));
+    numi->tpx  = bn->tpx;   numi->tpy  = bn->tpy;   numi->tpz  = bn->tpz;
+    numi->vx   = bn->vx;    numi->vy   = bn->vy;    numi->vz   = bn->vz;
+    numi->pdpx = bn->pdpx;  numi->pdpy = bn->pdpy;  numi->pdpz = bn->pdpz;
+    numi->pppx = bn->pppx;  numi->pppy = bn->pppy;  numi->pppz = bn->pppz;
+    numi->ndecay   = bn->ndecay;
+    numi->ptype    = bn->ptype;
+    numi->ppmedium = bn->ppmedium;
+    numi->tptype   = bn->tptype;
+    numi->run      = bn->run;
+    numi->evtno    = bn->evtno;
+    numi->entryno  = bn->entryno;
+  }
+  return fRecordSize;
+}
+//____________________________________________________________________________
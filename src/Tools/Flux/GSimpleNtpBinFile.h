@@ -0,0 +1,96 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::flux::GSimpleNtpBinFile
+
+\brief    A flat binary container of GSimpleNtpFlux entries, read through a
+          read-only memory map of the file.
+
+          The file holds a fixed size header, the flux entries as fixed size
+          records (the "entry" and, optionally, the "numi" branch contents)
+          and the meta data (one streamed GSimpleNtpMeta per input file,
+          looked up by metakey). An entry is at a fixed offset, so reading
+          any entry costs a copy of its record, with no per-branch decoding;
+          this pays off for jobs cycling through the flux entries many times.
+          The variable size "aux" branch is not stored.
+
+          Files are written by Write() (see the gsimple2bin utility) and use
+          the byte order of the machine writing them; Open() refuses files
+          of the other byte order.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _SIMPLE_NTP_BIN_FILE_H_
+#define _SIMPLE_NTP_BIN_FILE_H_
+
+#include <string>
+#include <vector>
+
+#include <Rtypes.h>
+
+class TTree;
+
+using std::string;
+
+namespace genie {
+namespace flux  {
+
+class GSimpleNtpEntry;
+class GSimpleNtpNuMI;
+class GSimpleNtpMeta;
+
+class GSimpleNtpBinFile {
+
+public :
+  GSimpleNtpBinFile();
+ ~GSimpleNtpBinFile();
+
+  /// does the named (local) file start with the flat binary file signature?
+  static bool IsBinFile (string filename);
+
+  /// write the entries of the "flux" tree (its "entry" and, if with_numi,
+  /// "numi" branches) and the entries of the "meta" tree to a binary file
+  static bool Write (string filename, TTree * flux, TTree * meta,
+                     bool with_numi = true);
+
+  bool     Open      (string filename);  ///< map the file; false on error
+  void     Close     (void);
+  bool     IsOpen    (void) const { return fData != 0;    }
+  string   FileName  (void) const { return fFileName;     }
+  Long64_t NEntries  (void) const { return fNEntries;     }
+  bool     HasNuMI   (void) const { return fHasNuMI;      }
+
+  /// copy entry ientry into entry (and numi, if not null and stored);
+  /// returns the number of bytes read, 0 for an entry out of range
+  Int_t    Read (Long64_t ientry, GSimpleNtpEntry * entry,
+                 GSimpleNtpNuMI * numi) const;
+
+  /// meta data of the file (owned by the file)
+  const std::vector<GSimpleNtpMeta *> & Meta (void) const { return fMeta; }
+
+private:
+  GSimpleNtpBinFile(const GSimpleNtpBinFile &);
+  GSimpleNtpBinFile & operator = (const GSimpleNtpBinFile &);
+
+  string       fFileName;    ///< mapped file
+  char *       fData;        ///< start of the memory map
+  Long64_t     fSize;        ///< size of the memory map
+  const char * fRecords;     ///< first record
+  Long64_t     fNEntries;    ///< number of records
+  UInt_t       fRecordSize;  ///< bytes per record
+  bool         fHasNuMI;     ///< do records include the "numi" contents?
+  std::vector<GSimpleNtpMeta *> fMeta; ///< meta data, one per input file
+};
+
+} // flux namespace
+} // genie namespace
+
+#endif // _SIMPLE_NTP_BIN_FILE_H_
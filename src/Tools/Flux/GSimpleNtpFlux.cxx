@@ -16,6 +16,16 @@
  @ Mar 14, 2014 - TD
    Prevent an infinite loop in GenerateNext() when the flux driver has not been
    properly configured by exiting within GenerateNext_weighted().
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Use only the flux entry range of the job in a production split in jobs
+   (see GFluxFileConfigI::SetEntryShard()).
+   Added GetFluxCursor() and SetFluxCursor(), for checkpointing MC jobs.
+   Added SetReadAhead(): a tuned TTreeCache for the flux chain and optionally
+   a reader thread decoding entries ahead into a ring of entries, so that
+   the generation does not wait on flux file reads. Meta data are cached by
+   metakey in ProcessMeta() so that ReadEntry() needs no meta tree lookups.
+   Added reading of flat binary flux files (see GSimpleNtpBinFile and the
+   gsimple2bin utility) through a memory map, in place of the ROOT files.
 
 */
 //____________________________________________________________________________
@@ -26,17 +36,24 @@
 #include <cassert>
 #include <limits.h>
 #include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
 
 #include <TFile.h>
 #include <TChain.h>
 #include <TChainElement.h>
 #include <TSystem.h>
 #include <TStopwatch.h>
+#include <TROOT.h>
+#include "RVersion.h"
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/GBuild.h"
 
 #include "Tools/Flux/GSimpleNtpFlux.h"
+#include "Tools/Flux/GSimpleNtpBinFile.h"
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
@@ -74,6 +91,145 @@ ClassImp(GSimpleNtpMeta)
 // static storage
 UInt_t genie::flux::GSimpleNtpMeta::mxfileprint = UINT_MAX;
 
+//___________________________________________________________________________
+namespace genie {
+namespace flux  {
+ // Reader thread decoding flux entries ahead of their use into a ring of
+ // slots. It reads the entries in sequence (wrapping around the range of
+ // entries used) and restarts wherever the generation thread asks for an
+ // entry out of sequence. It owns the chain branch buffers.
+ class GSimpleNtpPrefetcher {
+ public:
+   struct Slot {
+     Long64_t        ientry;
+     int             nbytes;
+     GSimpleNtpEntry entry;
+     GSimpleNtpNuMI  numi;
+     GSimpleNtpAux   aux;
+   };
+
+   GSimpleNtpPrefetcher(TChain * chain, unsigned int nslots,
+                        bool withnumi, bool withaux,
+                        Long64_t first, Long64_t end, Long64_t start)
+     : fChain(chain), fEntry(new GSimpleNtpEntry),
+       fNuMI(withnumi ? new GSimpleNtpNuMI : 0),
+       fAux (withaux  ? new GSimpleNtpAux  : 0),
+       fFirst(first), fEnd(end), fNext(start), fRestart(-1), fGen(0),
+       fStop(false)
+   {
+     fChain->SetBranchAddress("entry",&fEntry);
+     if (fNuMI) fChain->SetBranchAddress("numi",&fNuMI);
+     if (fAux ) fChain->SetBranchAddress("aux", &fAux );
+     for(unsigned int i = 0; i < nslots; i++) fSpare.push_back(new Slot);
+     fThread = std::thread( [this] { this->Run(); } );
+   }
+  ~GSimpleNtpPrefetcher()
+   {
+     {
+       std::lock_guard<std::mutex> lock(fMutex);
+       fStop = true;
+     }
+     fCvFreed.notify_one();
+     fThread.join();
+     for(unsigned int i = 0; i < fSpare.size();  i++) delete fSpare[i];
+     for(unsigned int i = 0; i < fFilled.size(); i++) delete fFilled[i];
+     delete fEntry;
+     delete fNuMI;
+     delete fAux;
+   }
+
+   // copy entry ientry into the input objects, waiting for it if needed
+   int Take(Long64_t ientry,
+            GSimpleNtpEntry * entry, GSimpleNtpNuMI * numi, GSimpleNtpAux * aux)
+   {
+     Slot * slot = 0;
+     {
+       std::unique_lock<std::mutex> lock(fMutex);
+       while (!slot) {
+         fCvFilled.wait(lock, [this] { return !fFilled.empty(); });
+         if (fFilled.front()->ientry == ientry) {
+           slot = fFilled.front();
+           fFilled.pop_front();
+         } else {
+           // out of sequence: drop what was read ahead, restart at ientry
+           while (!fFilled.empty()) {
+             fSpare.push_back(fFilled.front());
+             fFilled.pop_front();
+           }
+           fRestart = ientry;
+           fGen++;
+           fCvFreed.notify_one();
+         }
+       }
+     }
+
+     if (entry)         *entry = slot->entry;
+     if (numi && fNuMI) *numi  = slot->numi;
+     if (aux  && fAux ) *aux   = slot->aux;
+     int nbytes = slot->nbytes;
+
+     {
+       std::lock_guard<std::mutex> lock(fMutex);
+       fSpare.push_back(slot);
+     }
+     fCvFreed.notify_one();
+     return nbytes;
+   }
+
+ private:
+   void Run(void)
+   {
+     while (true) {
+       Slot * slot = 0;
+       Long64_t ientry = 0;
+       unsigned long gen = 0;
+       {
+         std::unique_lock<std::mutex> lock(fMutex);
+         fCvFreed.wait(lock, [this] { return fStop || !fSpare.empty(); });
+         if (fStop) break;
+         if (fRestart >= 0) { fNext = fRestart; fRestart = -1; }
+         ientry = fNext;
+         fNext  = (fNext+1 < fEnd) ? fNext+1 : fFirst;
+         gen    = fGen;
+         slot   = fSpare.back();
+         fSpare.pop_back();
+       }
+
+       slot->ientry = ientry;
+       slot->nbytes = fChain->GetEntry(ientry);
+       slot->entry  = *fEntry;
+       if (fNuMI) slot->numi = *fNuMI;
+       if (fAux ) slot->aux  = *fAux;
+
+       {
+         std::lock_guard<std::mutex> lock(fMutex);
+         if (gen == fGen) fFilled.push_back(slot);
+         else             fSpare.push_back(slot);
+       }
+       fCvFilled.notify_one();
+     }
+   }
+
+   TChain *                fChain;
+   GSimpleNtpEntry *       fEntry;     ///< branch buffers
+   GSimpleNtpNuMI  *       fNuMI;
+   GSimpleNtpAux   *       fAux;
+   Long64_t                fFirst;     ///< range of entries used
+   Long64_t                fEnd;
+   Long64_t                fNext;      ///< next entry to read
+   Long64_t                fRestart;   ///< entry to restart at (-1: none)
+   unsigned long           fGen;       ///< incremented at each restart
+   bool                    fStop;
+   std::thread             fThread;
+   std::mutex              fMutex;
+   std::condition_variable fCvFilled;  ///< a slot was filled
+   std::condition_variable fCvFreed;   ///< a slot was freed (or restart / stop)
+   std::deque<Slot *>      fFilled;    ///< slots read ahead, in sequence
+   std::vector<Slot *>     fSpare;     ///< free slots
+ };
+}
+}
+
 //____________________________________________________________________________
 GSimpleNtpFlux::GSimpleNtpFlux() :
   GFluxExposureI(genie::flux::kPOTs)
@@ -189,12 +345,12 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
     // Move on, read next flux ntuple entry
     ++fIEntry;
     ++fNEntriesUsed;  // count total # used
-    if ( fIEntry >= fNEntries ) {
+    if ( fIEntry >= fEndEntry ) {
       // Ran out of entries @ the current cycle of this flux file
       // Check whether more (or infinite) number of cycles is requested
       if (fICycle < fNCycles || fNCycles == 0 ) {
         fICycle++;
-        fIEntry=0;
+        fIEntry=fFirstEntry;
       } else {
         LOG("Flux", pWARN)
           << "No more entries in input flux neutrino ntuple, cycle "
@@ -205,47 +361,7 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
       }
     }
     
-    int nbytes = fNuFluxTree->GetEntry(fIEntry);
-    UInt_t metakey = fCurEntry->metakey;
-    if ( fAllFilesMeta && ( fCurMeta->metakey != metakey ) ) {
-      UInt_t oldkey = fCurMeta->metakey;
-#ifdef USE_INDEX_FOR_META
-      int nbmeta = fNuMetaTree->GetEntryWithIndex(metakey);
-#else
-      // unordered indices makes ROOT call Error() which might,
-      // if not DefaultErrorHandler, be fatal.
-      // so find the right one by a simple linear search.
-      // not a large burden since it only happens infrequently and
-      // the list is normally quite short.
-      int nmeta = fNuMetaTree->GetEntries();
-      int nbmeta = 0;
-      for (int imeta = 0; imeta < nmeta; ++imeta ) {
-        nbmeta = fNuMetaTree->GetEntry(imeta);
-        if ( fCurMeta->metakey == metakey ) break;
-      }
-      // next condition should never happen
-      if ( fCurMeta->metakey != metakey ) {
-        fCurMeta = 0; // didn't find it!?
-        LOG("Flux",pERROR) << "Failed to find right metakey=" << metakey
-                           << " (was " << oldkey << ") out of " << nmeta 
-                           << " entries";
-      }
-#endif
-      LOG("Flux",pDEBUG) << "Get meta " << metakey 
-                         << " (was " << oldkey << ") "
-                         << fCurMeta->metakey 
-                         << " nb " << nbytes << " " << nbmeta;
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-      LOG("Flux",pDEBUG) << "Get meta " << *fCurMeta; 
-#endif
-    }
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-    Int_t ifile = fNuFluxTree->GetFileNumber();
-    LOG("Flux",pDEBUG)
-      << "got " << fNNeutrinos << " nu, using fIEntry " << fIEntry 
-      << " ifile " << ifile << " nbytes " << nbytes
-      << *fCurEntry << *fCurMeta;
-#endif
+    this->ReadEntry();
 
     fIUse = 1; 
 
@@ -445,6 +561,23 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
     if ( ! isok ) continue;
     // open the file to see what it contains
     LOG("Flux", pINFO) << "Load file " <<  filename;
+
+    // a flat binary flux file is read by itself, through a memory map
+    bool isbin = GSimpleNtpBinFile::IsBinFile(filename);
+    if ( fBinFile || ( isbin && fNFiles > 0 ) ) {
+      LOG("Flux", pFATAL)
+        << "A flat binary flux file can not be combined with other flux files";
+      exit(1);
+    }
+    if ( isbin ) {
+      fBinFile = new GSimpleNtpBinFile;
+      if ( ! fBinFile->Open(filename) ) {
+        LOG("Flux", pFATAL) << "Failed to load flux file " << filename;
+        exit(1);
+      }
+      fNFiles = 1;
+      continue;
+    }
     
     TFile* tf = TFile::Open(filename.c_str(),"READ");
     TTree* etree = (TTree*)tf->Get("flux");
@@ -461,7 +594,7 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
   } // loop over sorted file names
 
   // this will open all files and read headers!!
-  fNEntries = fNuFluxTree->GetEntries();
+  fNEntries = ( fBinFile ) ? fBinFile->NEntries() : fNuFluxTree->GetEntries();
 
   if ( fNEntries == 0 ) {
     LOG("Flux", pERROR)
@@ -489,45 +622,54 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
     }
   }
 
-  int sba_status[3] = { -999, -999, -999 };
-  // "entry" branch isn't optional ... contains the neutrino info
+  if ( fBinFile ) {
+    // records hold the "entry" and possibly the "numi" contents, never "aux"
+    if ( ! fBinFile->HasNuMI() ||
+         fNuFluxBranchRequest.find("numi") == string::npos ) {
+      delete fCurNuMI; fCurNuMI = 0;
+    }
+    delete fCurAux; fCurAux = 0;
+  } else {
+    int sba_status[3] = { -999, -999, -999 };
+    // "entry" branch isn't optional ... contains the neutrino info
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
-  sba_status[0] = 
+    sba_status[0] = 
 #endif
-    fNuFluxTree->SetBranchAddress("entry",&fCurEntry);
+      fNuFluxTree->SetBranchAddress("entry",&fCurEntry);
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
-  if ( sba_status[0] < 0 ) {
-    LOG("Flux", pFATAL) 
-      << "flux chain has no \"entry\" branch " << sba_status[0];
-    assert(0);
-  }
+    if ( sba_status[0] < 0 ) {
+      LOG("Flux", pFATAL) 
+        << "flux chain has no \"entry\" branch " << sba_status[0];
+      assert(0);
+    }
 #endif
-  //TBranch* bentry = fNuFluxTree->GetBranch("entry");
-  //bentry->SetAutoDelete(false);
+    //TBranch* bentry = fNuFluxTree->GetBranch("entry");
+    //bentry->SetAutoDelete(false);
 
-  if ( OptionalAttachBranch("numi") ) {
+    if ( OptionalAttachBranch("numi") ) {
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
-    sba_status[1] = 
+      sba_status[1] = 
 #endif
-      fNuFluxTree->SetBranchAddress("numi",&fCurNuMI);
-    //TBranch* bnumi = fNuFluxTree->GetBranch("numi");
-    //bnumi->SetAutoDelete(false);
-  } else { delete fCurNuMI; fCurNuMI = 0; }
+        fNuFluxTree->SetBranchAddress("numi",&fCurNuMI);
+      //TBranch* bnumi = fNuFluxTree->GetBranch("numi");
+      //bnumi->SetAutoDelete(false);
+    } else { delete fCurNuMI; fCurNuMI = 0; }
 
-  if ( OptionalAttachBranch("aux") ) {
+    if ( OptionalAttachBranch("aux") ) {
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
-    sba_status[2] = 
+      sba_status[2] = 
 #endif
-      fNuFluxTree->SetBranchAddress("aux",&fCurAux);
-    //TBranch* baux = fNuFluxTree->GetBranch("aux");
-    //baux->SetAutoDelete(false);
-  } else { delete fCurAux; fCurAux = 0; }
-
-  LOG("Flux", pDEBUG)
-    << " SetBranchAddress status: "
-    << " \"entry\"=" << sba_status[0]
-    << " \"numi\"=" << sba_status[1]
-    << " \"aux\"=" << sba_status[2];
+        fNuFluxTree->SetBranchAddress("aux",&fCurAux);
+      //TBranch* baux = fNuFluxTree->GetBranch("aux");
+      //baux->SetAutoDelete(false);
+    } else { delete fCurAux; fCurAux = 0; }
+
+    LOG("Flux", pDEBUG)
+      << " SetBranchAddress status: "
+      << " \"entry\"=" << sba_status[0]
+      << " \"numi\"=" << sba_status[1]
+      << " \"aux\"=" << sba_status[2];
+  }
 
   // attach requested branches
 
@@ -542,11 +684,18 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
   // pick a starting entry index [0:fNEntries-1]
   // pretend we just used up the the previous one
   RandomGen* rnd = RandomGen::Instance();
+  // (within the entry range used by this job, see SetEntryShard())
+  this->ShardEntryRange(fNEntries, fFirstEntry, fEndEntry);
+  if ( fEndEntry <= fFirstEntry ) {
+    LOG("Flux", pFATAL)
+      << "No flux entries left for shard " << fIShard << "/" << fNShards;
+    exit(1);
+  }
   fIUse   =  9999999;
-  fIEntry = rnd->RndFlux().Integer(fNEntries) - 1;
+  fIEntry = fFirstEntry + rnd->RndFlux().Integer(fEndEntry - fFirstEntry) - 1;
   if ( config.find("no-offset-index") != string::npos ) {
     LOG("Flux",pINFO) << "Config saw \"no-offset-index\"";  
-    fIEntry = -1;
+    fIEntry = fFirstEntry - 1;
   }
   LOG("Flux",pINFO) << "Start with entry fIEntry=" << fIEntry;  
 
@@ -558,6 +707,8 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
 
   LOG("Flux",pDEBUG) << "about to CalcEffPOTsPerNu";
   this->CalcEffPOTsPerNu();
+
+  this->StartReadAhead();
   
 }
 //___________________________________________________________________________
@@ -603,14 +754,22 @@ void GSimpleNtpFlux::ProcessMeta(void)
   // PDGLibrary* pdglib = PDGLibrary::Instance(); // get initialized now
 
   if ( fAllFilesMeta ) {
-    fNuMetaTree->SetBranchAddress("meta",&fCurMeta);
+    int nmeta = 0;
+    if ( fBinFile ) {
+      nmeta = fBinFile->Meta().size();
+    } else {
+      fNuMetaTree->SetBranchAddress("meta",&fCurMeta);
 #ifdef USE_INDEX_FOR_META
-    int nindices = fNuMetaTree->BuildIndex("metakey"); // key used to tie entries to meta data
-    LOG("Flux", pDEBUG) << "ProcessMeta() BuildIndex nindices " << nindices;
+      int nindices = fNuMetaTree->BuildIndex("metakey"); // key used to tie entries to meta data
+      LOG("Flux", pDEBUG) << "ProcessMeta() BuildIndex nindices " << nindices;
 #endif
-    int nmeta = fNuMetaTree->GetEntries();
+      nmeta = fNuMetaTree->GetEntries();
+    }
     for (int imeta = 0; imeta < nmeta; ++imeta ) {
-      fNuMetaTree->GetEntry(imeta);
+      if ( fBinFile ) *fCurMeta = *(fBinFile->Meta()[imeta]);
+      else            fNuMetaTree->GetEntry(imeta);
+      if ( fMetaCache.find(fCurMeta->metakey) == fMetaCache.end() )
+        fMetaCache[fCurMeta->metakey] = new GSimpleNtpMeta(*fCurMeta);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("Flux", pNOTICE) << "ProcessMeta() ifile " << imeta
                            << " (of " << fNFiles
@@ -660,6 +819,61 @@ void GSimpleNtpFlux::SetEntryReuse(long int nuse)
   fNUse    = TMath::Max(1L, nuse);
 }
 //___________________________________________________________________________
+void GSimpleNtpFlux::SetReadAhead(Long64_t cache_bytes, unsigned int nprefetch)
+{
+// Tune the reading of flux files (typically on network storage):
+// cache_bytes is the size of the TTreeCache of the flux chain (0: keep the
+// ROOT default); with nprefetch > 0 a reader thread decodes up to nprefetch
+// entries ahead of their use, so that GenerateNext() does not wait on file
+// reads. The flux chain (GetFluxTChain()) must then not be read directly.
+// Call before LoadBeamSimData().
+
+  fReadAheadCache = TMath::Max(0LL, (long long) cache_bytes);
+  fNPrefetch      = nprefetch;
+
+#if ROOT_VERSION_CODE < ROOT_VERSION(6,0,0)
+  if ( fNPrefetch > 0 ) {
+    LOG("Flux", pWARN)
+      << "Reading flux entries ahead requires ROOT 6 - Reading synchronously";
+    fNPrefetch = 0;
+  }
+#endif
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::StartReadAhead(void)
+{
+  // entries of a flat binary flux file are already read from memory
+  if ( fBinFile ) return;
+
+  if ( fReadAheadCache > 0 ) {
+    fNuFluxTree->SetCacheSize(fReadAheadCache);
+    fNuFluxTree->AddBranchToCache("*",kTRUE);
+    LOG("Flux", pNOTICE)
+      << "Flux chain TTreeCache size: " << fReadAheadCache << " bytes";
+  }
+
+  if ( fNPrefetch == 0 || fPrefetcher ) return;
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+#endif
+
+  LOG("Flux", pNOTICE)
+    << "Reading flux entries from a reader thread, up to " << fNPrefetch 
+    << " entries ahead";
+
+  fPrefetcher = 
+    new GSimpleNtpPrefetcher(fNuFluxTree, fNPrefetch, (fCurNuMI != 0),
+                             (fCurAux != 0), fFirstEntry, fEndEntry,
+                             TMath::Max(fIEntry+1,fFirstEntry));
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::StopReadAhead(void)
+{
+  if ( fPrefetcher ) delete fPrefetcher;
+  fPrefetcher = 0;
+}
+//___________________________________________________________________________
 void GSimpleNtpFlux::GetFluxWindow(TVector3& p0, TVector3& p1, TVector3& p2) const
 {
   // return flux window points
@@ -697,6 +911,124 @@ void GSimpleNtpFlux::Clear(Option_t * opt)
 
 }
 //___________________________________________________________________________
+int GSimpleNtpFlux::ReadEntry(void)
+{
+// Reads the current (fIEntry) flux ntuple entry and its meta data
+
+  int nbytes = ( fPrefetcher ) ?
+    fPrefetcher->Take(fIEntry,fCurEntry,fCurNuMI,fCurAux) :
+    ( fBinFile ) ? fBinFile->Read(fIEntry,fCurEntry,fCurNuMI) :
+    fNuFluxTree->GetEntry(fIEntry);
+  UInt_t metakey = fCurEntry->metakey;
+  std::map<UInt_t,GSimpleNtpMeta*>::const_iterator mitr = 
+    fMetaCache.find(metakey);
+  if ( fAllFilesMeta && ( fCurMeta->metakey != metakey ) &&
+       mitr != fMetaCache.end() ) {
+    // meta data read once in ProcessMeta()
+    *fCurMeta = *(mitr->second);
+  }
+  else if ( fAllFilesMeta && ( fCurMeta->metakey != metakey ) ) {
+    UInt_t oldkey = fCurMeta->metakey;
+#ifdef USE_INDEX_FOR_META
+    int nbmeta = fNuMetaTree->GetEntryWithIndex(metakey);
+#else
+    // unordered indices makes ROOT call Error() which might,
+    // if not DefaultErrorHandler, be fatal.
+    // so find the right one by a simple linear search.
+    // not a large burden since it only happens infrequently and
+    // the list is normally quite short.
+    int nmeta = fNuMetaTree->GetEntries();
+    int nbmeta = 0;
+    for (int imeta = 0; imeta < nmeta; ++imeta ) {
+      nbmeta = fNuMetaTree->GetEntry(imeta);
+      if ( fCurMeta->metakey == metakey ) break;
+    }
+    // next condition should never happen
+    if ( fCurMeta->metakey != metakey ) {
+      fCurMeta = 0; // didn't find it!?
+      LOG("Flux",pERROR) << "Failed to find right metakey=" << metakey
+                         << " (was " << oldkey << ") out of " << nmeta 
+                         << " entries";
+    }
+#endif
+    LOG("Flux",pDEBUG) << "Get meta " << metakey 
+                       << " (was " << oldkey << ") "
+                       << fCurMeta->metakey 
+                       << " nb " << nbytes << " " << nbmeta;
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+    LOG("Flux",pDEBUG) << "Get meta " << *fCurMeta; 
+#endif
+  }
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  Int_t ifile = fNuFluxTree->GetFileNumber();
+  LOG("Flux",pDEBUG)
+    << "got " << fNNeutrinos << " nu, using fIEntry " << fIEntry 
+    << " ifile " << ifile << " nbytes " << nbytes
+    << *fCurEntry << *fCurMeta;
+#endif
+
+  return nbytes;
+}
+//___________________________________________________________________________
+bool GSimpleNtpFlux::GetFluxCursor(std::vector<Long64_t> & counters,
+                                   std::vector<double>   & sums) const
+{
+  counters.clear();
+  counters.push_back(fIEntry);
+  counters.push_back(fIUse);
+  counters.push_back(fICycle);
+  counters.push_back(fNEntriesUsed);
+  counters.push_back(fNNeutrinos);
+  counters.push_back((fEnd) ? 1 : 0);
+
+  sums.clear();
+  sums.push_back(fSumWeight);
+  sums.push_back(fAccumPOTs);
+  sums.push_back(fMaxWeight);
+
+  return true;
+}
+//___________________________________________________________________________
+bool GSimpleNtpFlux::SetFluxCursor(const std::vector<Long64_t> & counters,
+                                   const std::vector<double>   & sums)
+{
+  if ( ! fNuFluxTree || counters.size() != 6 || sums.size() != 3 ) {
+    LOG("Flux", pERROR)
+      << "Can not restore the flux ntuple position: "
+      << ((fNuFluxTree) ? "unexpected saved state" : "no flux ntuple loaded");
+    return false;
+  }
+  if ( counters[0] < fFirstEntry - 1 || counters[0] >= fEndEntry ) {
+    LOG("Flux", pERROR)
+      << "Can not restore the flux ntuple position: entry " << counters[0]
+      << " is not in the range of flux entries used ["
+      << fFirstEntry << ", " << fEndEntry << ")";
+    return false;
+  }
+
+  fIEntry       = counters[0];
+  fIUse         = counters[1];
+  fICycle       = counters[2];
+  fNEntriesUsed = counters[3];
+  fNNeutrinos   = counters[4];
+  fEnd          = (counters[5] != 0);
+
+  fSumWeight    = sums[0];
+  fAccumPOTs    = sums[1];
+  fMaxWeight    = sums[2];
+
+  // the current entry may still be re-used
+  this->ResetCurrent();
+  if ( fIEntry >= fFirstEntry ) this->ReadEntry();
+
+  LOG("Flux", pNOTICE)
+    << "Restored flux ntuple position: entry " << fIEntry
+    << " (used " << fIUse << " of " << fNUse << " times), cycle " << fICycle
+    << ", " << fNNeutrinos << " neutrinos thrown, " << fAccumPOTs << " POTs";
+
+  return true;
+}
+//___________________________________________________________________________
 void GSimpleNtpFlux::GenerateWeighted(bool gen_weighted)
 {
 // Set whether to generate weighted rays
@@ -730,6 +1062,8 @@ void GSimpleNtpFlux::Initialize(void)
 
   fNEntries        =  0;
   fIEntry          = -1;
+  fFirstEntry      =  0;
+  fEndEntry        =  0;
   fIFileNumber     =  0;
   fICycle          =  0;
   fNUse            =  1;
@@ -749,6 +1083,12 @@ void GSimpleNtpFlux::Initialize(void)
   fAllFilesMeta    = true;
   fAlreadyUnwgt    = false;
 
+  fReadAheadCache  = 0;
+  fNPrefetch       = 0;
+  fPrefetcher      = 0;
+
+  fBinFile         = 0;
+
   this->SetDefaults();
   this->ResetCurrent();
 }
@@ -781,6 +1121,14 @@ void GSimpleNtpFlux::CleanUp(void)
 {
   LOG("Flux", pINFO) << "Cleaning up...";
 
+  this->StopReadAhead();
+  if (fBinFile)     delete fBinFile;
+  fBinFile = 0;
+
+  std::map<UInt_t,GSimpleNtpMeta*>::iterator mitr = fMetaCache.begin();
+  for ( ; mitr != fMetaCache.end(); ++mitr ) delete mitr->second;
+  fMetaCache.clear();
+
   if (fPdgCList)    delete fPdgCList;
   if (fPdgCListRej) delete fPdgCListRej;
   if (fCurEntry)    delete fCurEntry;
@@ -1117,6 +1465,7 @@ void GSimpleNtpFlux::PrintConfig()
 std::vector<std::string> GSimpleNtpFlux::GetFileList() 
 {
   std::vector<std::string> flist;
+  if ( fBinFile ) flist.push_back(fBinFile->FileName());
   TObjArray *fileElements=fNuFluxTree->GetListOfFiles();
   TIter next(fileElements);
   TChainElement *chEl=0;
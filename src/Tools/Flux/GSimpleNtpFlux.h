@@ -23,6 +23,7 @@
 #include <iostream>
 #include <vector>
 #include <set>
+#include <map>
 
 #include <TVector3.h>
 #include <TLorentzVector.h>
@@ -192,6 +193,9 @@ ostream & operator << (ostream & stream, const GSimpleNtpEntry & info);
   };
 
 
+class GSimpleNtpPrefetcher;
+class GSimpleNtpBinFile;
+
 /// GSimpleNtpFlux:
 /// ==========
 /// An implementation of the GFluxI interface that provides NuMI flux
@@ -218,6 +222,7 @@ public :
   const TLorentzVector & Position      (void) { return  fX4;  }
   bool                   End           (void) { return  fEnd;                 }
   long int               Index         (void) { return  fIEntry;              }
+  bool                   FixedRays     (void) { return  true;                 }
   void                   Clear            (Option_t * opt);
   void                   GenerateWeighted (bool gen_weighted);
 
@@ -240,6 +245,7 @@ public :
     GetCurrentMeta(void)  { return fCurMeta; }  ///< GSimpleNtpMeta
 
   // allow access to main tree so we can call Branch() to retrieve extra stuff
+  // (empty when reading a flat binary flux file, see GSimpleNtpBinFile)
   TChain*
     GetFluxTChain(void) { return fNuFluxTree; } ///< 
 
@@ -272,6 +278,11 @@ public :
                               std::vector<std::string>& branchClassNames,
                               std::vector<void**>&      branchObjPointers);
   virtual TTree* GetMetaDataTree();
+  virtual bool  GetFluxCursor(std::vector<Long64_t> & counters,
+                              std::vector<double>   & sums) const;
+  virtual bool  SetFluxCursor(const std::vector<Long64_t> & counters,
+                              const std::vector<double>   & sums);
+  virtual void  SetReadAhead(Long64_t cache_bytes, unsigned int nprefetch=0); ///< TTreeCache size & # of entries read ahead on a reader thread (call before LoadBeamSimData)
 
   //
   // configuration of GSimpleNtpFlux
@@ -298,10 +309,13 @@ private:
   void SetDefaults           (void);
   void CleanUp               (void);
   void ResetCurrent          (void);
+  int  ReadEntry             (void);
   void AddFile               (TTree* fluxtree, TTree* metatree, string fname);
   bool OptionalAttachBranch  (std::string bname);
   void CalcEffPOTsPerNu      (void);
   void ScanMeta              (void);
+  void StartReadAhead        (void);
+  void StopReadAhead         (void);
 
   // Private data members
   //
@@ -316,6 +330,8 @@ private:
   int       fNFiles;              ///< number of files in chain
   Long64_t  fNEntries;            ///< number of flux ntuple entries
   Long64_t  fIEntry;              ///< current flux ntuple entry
+  Long64_t  fFirstEntry;          ///< first flux ntuple entry used (see SetEntryShard())
+  Long64_t  fEndEntry;            ///< one past the last flux ntuple entry used
   Int_t     fIFileNumber;         ///< which file for the current entry
 
   Double_t  fFilePOTs;            ///< # of protons-on-target represented by all files
@@ -348,6 +364,14 @@ private:
   GSimpleNtpNuMI*  fCurNuMICopy;   ///< current "numi" branch extra info
   GSimpleNtpAux*   fCurAuxCopy;    ///< current "aux" branch extra info
 
+  std::map<UInt_t,GSimpleNtpMeta*> fMetaCache; ///< meta data of all files, by metakey
+
+  Long64_t              fReadAheadCache; ///< TTreeCache size (bytes) for the flux chain, 0: ROOT default
+  unsigned int          fNPrefetch;      ///< # of entries decoded ahead on a reader thread, 0: no reader thread
+  GSimpleNtpPrefetcher* fPrefetcher;     ///< reader thread & ring of entries read ahead
+
+  GSimpleNtpBinFile*    fBinFile;        ///< memory mapped flat binary flux file, if one was loaded instead of ROOT files
+
 };
 
 } // flux namespace
@@ -39,6 +39,7 @@
 #pragma link C++ class genie::flux::GSimpleNtpMeta+;
 
 #pragma link C++ class genie::flux::GSimpleNtpFlux;
+#pragma link C++ class genie::flux::GSimpleNtpBinFile;
 
 #pragma link C++ class genie::flux::GFluxBlender;
 
@@ -0,0 +1,321 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <algorithm>
+
+#include <TLorentzVector.h>
+#include <TVector3.h>
+#include <TMath.h>
+
+#include "Tools/Geometry/AnalyticGeomAnalyzer.h"
+#include "Tools/Geometry/FidShape.h"
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/NaturalIsotopes.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Utils/PrintUtils.h"
+
+using namespace genie;
+using namespace genie::geometry;
+
+//___________________________________________________________________________
+AnalyticGeomAnalyzer::AnalyticGeomAnalyzer() :
+GeomAnalyzerI()
+{
+  fUpToDate           = false;
+  fCurrVertex         = new TVector3(0,0,0);
+  fCurrPathLengthList = new PathLengthList;
+  fMaxPathLengthList  = new PathLengthList;
+  fCurrPDGCodeList    = new PDGCodeList;
+}
+//___________________________________________________________________________
+AnalyticGeomAnalyzer::~AnalyticGeomAnalyzer()
+{
+  for(unsigned int i = 0; i < fShapes.size(); i++) delete fShapes[i];
+
+  if( fCurrVertex         ) delete fCurrVertex;
+  if( fCurrPathLengthList ) delete fCurrPathLengthList;
+  if( fMaxPathLengthList  ) delete fMaxPathLengthList;
+  if( fCurrPDGCodeList    ) delete fCurrPDGCodeList;
+}
+//___________________________________________________________________________
+int AnalyticGeomAnalyzer::AddBox(
+       const TVector3 & center, const TVector3 & halfsize, double density)
+{
+// an axis-aligned box: the intersection of the half-spaces of its 6 faces
+
+  FidPolyhedron * box = new FidPolyhedron;
+  for(int i = 0; i < 3; i++) {
+    double n[3] = { 0, 0, 0 };
+    n[i] = 1;
+    box->push_back(PlaneParam( n[0], n[1], n[2], -(center[i] + halfsize[i])));
+    box->push_back(PlaneParam(-n[0],-n[1],-n[2],   center[i] - halfsize[i] ));
+  }
+  return this->AddShape(box, 2*halfsize.Mag(), density);
+}
+//___________________________________________________________________________
+int AnalyticGeomAnalyzer::AddSphere(
+       const TVector3 & center, double radius, double density)
+{
+  return this->AddShape(new FidSphere(center,radius), 2*radius, density);
+}
+//___________________________________________________________________________
+int AnalyticGeomAnalyzer::AddCylinder(
+       const TVector3 & center, const TVector3 & axis,
+       double radius, double halflength, double density)
+{
+// a cylinder along the input axis, capped at +/- halflength from its center
+
+  TVector3 u = axis.Unit();
+  double   c = center.Dot(u);
+
+  PlaneParam cap1(-u.X(), -u.Y(), -u.Z(),   c - halflength );
+  PlaneParam cap2( u.X(),  u.Y(),  u.Z(), -(c + halflength));
+
+  double maxchord = 2*TMath::Sqrt(radius*radius + halflength*halflength);
+
+  return this->AddShape(
+     new FidCylinder(center, u, radius, cap1, cap2), maxchord, density);
+}
+//___________________________________________________________________________
+void AnalyticGeomAnalyzer::AddNuclide(
+       int ishape, int pdgc, double mass_fraction)
+{
+  this->CheckShape(ishape);
+
+  fMassFrac[ishape][pdgc] += mass_fraction;
+  fUpToDate = false;
+}
+//___________________________________________________________________________
+void AnalyticGeomAnalyzer::AddElement(int ishape, int Z, double mass_fraction)
+{
+// expand the element into its natural isotopes, converting their (number)
+// abundances into mass fractions
+
+  this->CheckShape(ishape);
+
+  NaturalIsotopes * isotopes = NaturalIsotopes::Instance();
+  int niso = isotopes->NElements(Z);
+  if (niso <= 0) {
+    LOG("AnalyticGeom", pFATAL)
+      << "No natural isotopes data for element with Z = " << Z;
+    exit(1);
+  }
+
+  double norm = 0;
+  for(int i = 0; i < niso; i++) {
+    const NaturalIsotopeElementData * iso = isotopes->ElementData(Z,i);
+    norm += iso->Abundance() * pdg::IonPdgCodeToA(iso->PdgCode());
+  }
+  for(int i = 0; i < niso; i++) {
+    const NaturalIsotopeElementData * iso = isotopes->ElementData(Z,i);
+    double frac = iso->Abundance() * pdg::IonPdgCodeToA(iso->PdgCode()) / norm;
+    this->AddNuclide(ishape, iso->PdgCode(), mass_fraction * frac);
+  }
+}
+//___________________________________________________________________________
+const PDGCodeList & AnalyticGeomAnalyzer::ListOfTargetNuclei(void)
+{
+  this->Update();
+  return *fCurrPDGCodeList;
+}
+//___________________________________________________________________________
+const PathLengthList & AnalyticGeomAnalyzer::ComputeMaxPathLengths(void)
+{
+// for each nuclide, the sum over all shapes of {longest chord x density x
+// mass fraction}; this is an upper bound since, where shapes overlap, the
+// ray is only counted in one of them
+
+  this->Update();
+  return *fMaxPathLengthList;
+}
+//___________________________________________________________________________
+const PathLengthList & AnalyticGeomAnalyzer::ComputePathLengths(
+                  const TLorentzVector & x, const TLorentzVector & p)
+{
+  this->Update();
+  fCurrPathLengthList->SetAllToZero();
+
+  vector<Segment> segments;
+  this->FindSegments(x.Vect(), p.Vect().Unit(), segments);
+
+  for(unsigned int iseg = 0; iseg < segments.size(); iseg++) {
+    const Segment & seg = segments[iseg];
+    double step = (seg.fDistOut - seg.fDistIn) * fDensity[seg.fShape];
+    const map<int,double> & massfrac = fMassFrac[seg.fShape];
+    map<int,double>::const_iterator it = massfrac.begin();
+    for( ; it != massfrac.end(); ++it) {
+      fCurrPathLengthList->AddPathLength(it->first, step * it->second);
+    }
+  }
+  return *fCurrPathLengthList;
+}
+//___________________________________________________________________________
+const TVector3 & AnalyticGeomAnalyzer::GenerateVertex(
+             const TLorentzVector & x, const TLorentzVector & p, int tgtpdg)
+{
+// generate a vertex along the ray, in the shapes containing the target,
+// with a probability proportional to {L x density x mass fraction}
+
+  this->Update();
+  fCurrVertex->SetXYZ(0.,0.,0.);
+
+  TVector3 r0   = x.Vect();
+  TVector3 udir = p.Vect().Unit();
+
+  vector<Segment> segments;
+  this->FindSegments(r0, udir, segments);
+
+  vector<double> wgt(segments.size(), 0.);
+  double sumwgt = 0;
+  for(unsigned int iseg = 0; iseg < segments.size(); iseg++) {
+    const Segment & seg = segments[iseg];
+    const map<int,double> & massfrac = fMassFrac[seg.fShape];
+    map<int,double>::const_iterator it = massfrac.find(tgtpdg);
+    if (it == massfrac.end()) continue;
+    wgt[iseg] = (seg.fDistOut - seg.fDistIn) * fDensity[seg.fShape] * it->second;
+    sumwgt += wgt[iseg];
+  }
+  if (sumwgt <= 0) {
+    LOG("AnalyticGeom", pERROR)
+     << "The current trajectory does not cross the selected material!!";
+    return *fCurrVertex;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  double genwgt = sumwgt * rnd->RndGeom().Rndm();
+
+  unsigned int iseg = 0;
+  for( ; iseg < segments.size()-1; iseg++) {
+    if (genwgt < wgt[iseg]) break;
+    genwgt -= wgt[iseg];
+  }
+  const Segment & seg = segments[iseg];
+  double frac = (wgt[iseg] > 0) ? TMath::Min(genwgt/wgt[iseg], 1.) : 0.5;
+  double dist = seg.fDistIn + frac * (seg.fDistOut - seg.fDistIn);
+
+  fCurrVertex->SetXYZ(r0.X() + dist*udir.X(),
+                      r0.Y() + dist*udir.Y(), r0.Z() + dist*udir.Z());
+
+  LOG("AnalyticGeom", pINFO)
+     << "Generated vtx: " << utils::print::Vec3AsString(fCurrVertex);
+
+  return *fCurrVertex;
+}
+//___________________________________________________________________________
+int AnalyticGeomAnalyzer::AddShape(
+       FidShape * shape, double maxchord, double density)
+{
+  LOG("AnalyticGeom", pNOTICE)
+     << "Adding shape " << fShapes.size() << ": " << *shape
+     << ", density = " << density << " kgr/m3";
+
+  fShapes.push_back(shape);
+  fMaxChord.push_back(maxchord);
+  fDensity.push_back(density);
+  fMassFrac.push_back(map<int,double>());
+  fUpToDate = false;
+
+  return fShapes.size() - 1;
+}
+//___________________________________________________________________________
+void AnalyticGeomAnalyzer::CheckShape(int ishape) const
+{
+  if (ishape < 0 || ishape >= (int)fShapes.size()) {
+    LOG("AnalyticGeom", pFATAL) << "No shape with index " << ishape;
+    exit(1);
+  }
+}
+//___________________________________________________________________________
+void AnalyticGeomAnalyzer::Update(void)
+{
+// rebuild the list of target nuclei & the max path lengths after the
+// detector description has changed
+
+  if (fUpToDate) return;
+
+  map<int,double> maxpl;
+  for(unsigned int i = 0; i < fShapes.size(); i++) {
+    map<int,double>::const_iterator it = fMassFrac[i].begin();
+    for( ; it != fMassFrac[i].end(); ++it) {
+      maxpl[it->first] += fMaxChord[i] * fDensity[i] * it->second;
+    }
+  }
+
+  fCurrPDGCodeList->clear();
+  map<int,double>::const_iterator it = maxpl.begin();
+  for( ; it != maxpl.end(); ++it) fCurrPDGCodeList->push_back(it->first);
+
+  delete fMaxPathLengthList;
+  delete fCurrPathLengthList;
+  fMaxPathLengthList  = new PathLengthList(maxpl);
+  fCurrPathLengthList = new PathLengthList(*fCurrPDGCodeList);
+
+  LOG("AnalyticGeom", pNOTICE) << *fCurrPDGCodeList;
+  LOG("AnalyticGeom", pNOTICE) << *fMaxPathLengthList;
+
+  fUpToDate = true;
+}
+//___________________________________________________________________________
+void AnalyticGeomAnalyzer::FindSegments(
+          const TVector3 & r0, const TVector3 & udir,
+          vector<Segment> & segments) const
+{
+// split the (forward) ray into segments, each within the last added shape
+// containing it
+
+  segments.clear();
+
+  int nshapes = fShapes.size();
+  vector<RayIntercept> hits(nshapes);
+  vector<double> bounds;
+  for(int i = 0; i < nshapes; i++) {
+    hits[i] = fShapes[i]->Intercept(r0,udir);
+    if (!hits[i].fIsHit || hits[i].fDistOut <= 0) continue;
+    if (hits[i].fDistIn < 0) hits[i].fDistIn = 0;
+    bounds.push_back(hits[i].fDistIn);
+    bounds.push_back(hits[i].fDistOut);
+  }
+  std::sort(bounds.begin(), bounds.end());
+
+  for(unsigned int ib = 1; ib < bounds.size(); ib++) {
+    double t0 = bounds[ib-1];
+    double t1 = bounds[ib];
+    if (t1 <= t0) continue;
+    double tmid = 0.5*(t0+t1);
+    int ishape = -1;
+    for(int i = nshapes-1; i >= 0; i--) {
+      const RayIntercept & hit = hits[i];
+      if (hit.fIsHit && hit.fDistIn <= tmid && tmid <= hit.fDistOut) {
+        ishape = i;
+        break;
+      }
+    }
+    if (ishape < 0 || fMassFrac[ishape].empty()) continue;
+
+    if (!segments.empty() && segments.back().fShape == ishape &&
+        segments.back().fDistOut == t0) {
+      segments.back().fDistOut = t1;
+      continue;
+    }
+    Segment seg;
+    seg.fDistIn  = t0;
+    seg.fDistOut = t1;
+    seg.fShape   = ishape;
+    segments.push_back(seg);
+  }
+}
+//___________________________________________________________________________
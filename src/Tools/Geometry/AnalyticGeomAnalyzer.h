@@ -0,0 +1,114 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::geometry::AnalyticGeomAnalyzer
+
+\brief   A GeomAnalyzerI implementation for detectors made of a few simple
+         shapes (boxes, spheres and cylinders), each filled with a uniform
+         material, computing path lengths and vertices in closed form using
+         the FidShape ray intercepts instead of stepping through a ROOT
+         geometry.
+
+         Shapes may be nested or overlap: where they do, the shape added
+         last takes precedence, so nested detectors are described from the
+         outermost shape inwards. A shape with no nuclides added is empty.
+         Materials are built from nuclides or from elements, which are
+         expanded into their natural isotopes (NaturalIsotopes).
+
+         Positions and lengths are in meters and densities in kgr/m^3, so
+         that path lengths have the same (kgr/m^2) units as the ones of the
+         ROOTGeomAnalyzer weighted with density. Vertices are returned in
+         the same coordinate system as the input shapes and rays.
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _ANALYTIC_GEOMETRY_ANALYZER_H_
+#define _ANALYTIC_GEOMETRY_ANALYZER_H_
+
+#include <map>
+#include <vector>
+
+#include <TVector3.h>
+
+#include "Framework/EventGen/GeomAnalyzerI.h"
+
+using std::map;
+using std::vector;
+
+namespace genie    {
+namespace geometry {
+
+class FidShape;
+
+class AnalyticGeomAnalyzer : public GeomAnalyzerI {
+
+public :
+  AnalyticGeomAnalyzer();
+ ~AnalyticGeomAnalyzer();
+
+  /// add a shape (SI units) filled with material of the input density;
+  /// each method returns the index of the new shape
+  int  AddBox      (const TVector3 & center, const TVector3 & halfsize,
+                    double density);
+  int  AddSphere   (const TVector3 & center, double radius, double density);
+  int  AddCylinder (const TVector3 & center, const TVector3 & axis,
+                    double radius, double halflength, double density);
+
+  /// add a nuclide, or an element with its natural isotopic composition,
+  /// to the material of shape ishape with the input mass fraction
+  void AddNuclide  (int ishape, int pdgc, double mass_fraction);
+  void AddElement  (int ishape, int Z,    double mass_fraction);
+
+  int  NShapes     (void) const { return fShapes.size(); }
+
+  // implement the GeomAnalyzerI interface
+
+  const PDGCodeList &    ListOfTargetNuclei    (void);
+  const PathLengthList & ComputeMaxPathLengths (void);
+
+  const PathLengthList &
+           ComputePathLengths
+             (const TLorentzVector & x, const TLorentzVector & p);
+  const TVector3 &
+           GenerateVertex
+             (const TLorentzVector & x, const TLorentzVector & p, int tgtpdg);
+
+private:
+
+  /// a part of the ray within a single shape
+  struct Segment {
+    double fDistIn;   ///< distance along the ray to the segment start
+    double fDistOut;  ///< distance along the ray to the segment end
+    int    fShape;    ///< index of the shape
+  };
+
+  int  AddShape     (FidShape * shape, double maxchord, double density);
+  void CheckShape   (int ishape) const;
+  void Update       (void);
+  void FindSegments (const TVector3 & r0, const TVector3 & udir,
+                     vector<Segment> & segments) const;
+
+  vector<FidShape *>          fShapes;     ///< shapes (owned)
+  vector<double>              fMaxChord;   ///< longest chord through each shape
+  vector<double>              fDensity;    ///< material density in each shape
+  vector< map<int,double> >   fMassFrac;   ///< nuclide -> mass fraction, in each shape
+
+  bool             fUpToDate;            ///< are the target & max path length lists up to date?
+  TVector3 *       fCurrVertex;          ///< current generated vertex
+  PathLengthList * fCurrPathLengthList;  ///< current list of path-lengths
+  PathLengthList * fMaxPathLengthList;   ///< max path-lengths
+  PDGCodeList *    fCurrPDGCodeList;     ///< current list of target nuclei
+};
+
+}      // geometry namespace
+}      // genie    namespace
+
+#endif // _ANALYTIC_GEOMETRY_ANALYZER_H_
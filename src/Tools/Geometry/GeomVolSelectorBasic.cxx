@@ -167,4 +167,18 @@ bool GeomVolSelectorBasic::RejectString(const string& str,
   return reject;
 }
 //___________________________________________________________________________
-
+void GeomVolSelectorBasic::PrintConfig(std::ostream & stream) const
+{
+  GeomVolSelectorI::PrintConfig(stream);
+
+  const vector<string> * lists[8] = 
+    { &fRequiredVol,  &fRequiredMed,  &fRequiredMat,  &fRequiredPath,
+      &fForbiddenVol, &fForbiddenMed, &fForbiddenMat, &fForbiddenPath };
+  for (int i = 0; i < 8; ++i) {
+    stream << " [";
+    for (size_t j = 0; j < lists[i]->size(); ++j) stream << (*lists[i])[j] << ",";
+    stream << "]";
+  }
+  stream << ";";
+}
+//___________________________________________________________________________
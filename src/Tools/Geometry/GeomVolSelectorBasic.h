@@ -57,6 +57,8 @@ public :
   void BeginPSList(const PathSegmentList* untrimmed) const;
   void EndPSList() const;
 
+  void PrintConfig(std::ostream & stream) const;
+
 protected:
 
   void ParseSelection(const string& str, vector<string>& required, vector<string>& forbidden);
@@ -177,6 +177,19 @@ void GeomVolSelectorFiducial::EndPSList() const
   fCurrPathSegmentList = 0;
 }
 
+//___________________________________________________________________________
+bool GeomVolSelectorFiducial::RejectsRay(const TVector3& startpos, 
+                                         const TVector3& dir) const
+{
+  // A ray that misses the fiducial volume (or only crosses it behind its
+  // start) has all its segments rejected, unless the selection is reversed
+
+  if ( ! fShape || fSelectReverse ) return false;
+
+  RayIntercept intercept = fShape->Intercept(startpos,dir);
+  return ( ! intercept.fIsHit || intercept.fDistOut < 0 );
+}
+
 //___________________________________________________________________________
 void GeomVolSelectorFiducial::AdoptFidShape(FidShape* shape)
 {
@@ -261,5 +274,12 @@ void GeomVolSelectorFiducial::MakeZPolygon(Int_t n, Double_t x0, Double_t y0, Do
 }
 
 //___________________________________________________________________________
+void GeomVolSelectorFiducial::PrintConfig(std::ostream & stream) const
+{
+  GeomVolSelectorBasic::PrintConfig(stream);
 
-
+  stream << " reverse: " << fSelectReverse;
+  if ( fShape ) stream << " shape: " << *fShape;
+  stream << ";";
+}
+//___________________________________________________________________________
@@ -55,6 +55,10 @@ public :
   void BeginPSList(const PathSegmentList* untrimmed) const;
   void EndPSList() const;
 
+  bool RejectsRay(const TVector3& startpos, const TVector3& dir) const;
+
+  void PrintConfig(std::ostream & stream) const;
+
   // allow the selection to be reversed (i.e. exclude "fid" region)
   void SetReverseFiducial(Bool_t reverse=true) { fSelectReverse = reverse; }
 
@@ -23,10 +23,16 @@
    retain a null segment; and also serves as a repository for the swimmer on 
    whether to fetch the geometry hierachy "path" (which turns out to be a 
    non-trivial overhead so we don't want to fetch it if we don't need to.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Added PrintConfig() describing the selection, so that quantities derived
+   with a selector (eg cached max path lengths) can be matched to it.
+   Added RejectsRay() so that rays rejected as a whole need not be swum.
 
 */
 //____________________________________________________________________________
 
+#include <ostream>
+
 #include "Framework/Messenger/Messenger.h"
 #include "Tools/Geometry/GeomVolSelectorI.h"
 #include "Tools/Geometry/PathSegmentList.h"
@@ -52,6 +58,12 @@ GeomVolSelectorI::~GeomVolSelectorI()
 
 }
 //___________________________________________________________________________
+bool GeomVolSelectorI::RejectsRay(const TVector3& /*startpos*/, 
+                                  const TVector3& /*dir*/) const
+{
+  return false;
+}
+//___________________________________________________________________________
 
 PathSegmentList* 
 GeomVolSelectorI::GenerateTrimmedList(const PathSegmentList* untrimmed) const
@@ -79,3 +91,10 @@ GeomVolSelectorI::GenerateTrimmedList(const PathSegmentList* untrimmed) const
   return trimmed;
 }
 //___________________________________________________________________________
+void GeomVolSelectorI::PrintConfig(std::ostream & stream) const
+{
+  stream << "selector: " << fName
+         << " remove-entries: " << fRemoveEntries
+         << " need-path: " << fNeedPath << ";";
+}
+//___________________________________________________________________________
@@ -20,6 +20,7 @@
 #define _GEOM_VOL_SELECTOR_I_H_
 
 #include <string>
+#include <iosfwd>
 #include "TLorentzVector.h"
 
 namespace genie {
@@ -51,6 +52,16 @@ public :
   virtual void BeginPSList(const PathSegmentList* untrimmed) const = 0;
   virtual void EndPSList() const = 0;
 
+  /// Whether every segment of the ray (start position & direction as for
+  /// PathSegmentList) would be rejected, in which case the ray need not be
+  /// swum through the geometry at all. Derived versions that can tell
+  /// cheaply should override it; the default is to always swim.
+  virtual bool RejectsRay(const TVector3& startpos, const TVector3& dir) const;
+
+  /// Print the selection configuration (identifies results that depend
+  /// on it, e.g. cached max path lengths). Extend it in derived versions.
+  virtual void PrintConfig(std::ostream & stream) const;
+
   /// configure for individual neutrino ray
   void SetCurrentRay(const TLorentzVector& x4, const TLorentzVector& p4)
   { fX4 = x4; fP4 = p4; }
@@ -246,5 +246,18 @@ void GeomVolSelectorRockBox::MakeRockBox() const
 }
 
 //___________________________________________________________________________
-
-
+void GeomVolSelectorRockBox::PrintConfig(std::ostream & stream) const
+{
+  GeomVolSelectorFiducial::PrintConfig(stream);
+
+  stream << " minimal:";
+  for (int j = 0; j < 3; ++j) 
+    stream << " " << fMinimalXYZMin[j] << " " << fMinimalXYZMax[j];
+  stream << " inclusion:";
+  for (int j = 0; j < 3; ++j) 
+    stream << " " << fInclusionXYZMin[j] << " " << fInclusionXYZMax[j];
+  stream << " wall: " << fMinimumWall 
+         << " dedx: " << fDeDx
+         << " expand-inclusion: " << fExpandInclusion << ";";
+}
+//___________________________________________________________________________
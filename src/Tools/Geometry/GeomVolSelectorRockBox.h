@@ -50,6 +50,11 @@ public :
   void BeginPSList(const PathSegmentList* untrimmed) const;
   void EndPSList() const;
 
+  // the rock box depends on the ray, never reject a ray before swimming it
+  bool RejectsRay(const TVector3&, const TVector3&) const { return false; }
+
+  void PrintConfig(std::ostream & stream) const;
+
   //
   // set fiducial volume parameter (call only once)
   //   in "top vol" coordinates and units
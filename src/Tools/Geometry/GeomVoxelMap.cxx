@@ -0,0 +1,180 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2018, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration - October 14, 2026
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <map>
+#include <algorithm>
+
+#include <TGeoNavigator.h>
+#include <TGeoVolume.h>
+#include <TGeoBBox.h>
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Tools/Geometry/GeomVoxelMap.h"
+
+using std::map;
+
+using namespace genie;
+using namespace genie::geometry;
+
+//____________________________________________________________________________
+namespace {
+  // code of the volume at the input point (top volume coordinates),
+  // adding the volume to the volume table if needed
+  int VolumeAt(TGeoNavigator * nav, double x, double y, double z,
+               map<const TGeoVolume *, int> & index,
+               vector<const TGeoVolume *> & volumes)
+  {
+    nav->FindNode(x,y,z);
+    if (nav->IsOutside()) return GeomVoxelMap::kOutside;
+    const TGeoVolume * vol = nav->GetCurrentVolume();
+    if (!vol) return GeomVoxelMap::kOutside;
+
+    map<const TGeoVolume *, int>::const_iterator it = index.find(vol);
+    if (it != index.end()) return it->second;
+    int code = volumes.size();
+    volumes.push_back(vol);
+    index.insert(map<const TGeoVolume *, int>::value_type(vol, code));
+    return code;
+  }
+}
+//____________________________________________________________________________
+GeomVoxelMap::GeomVoxelMap()
+{
+  this->Clear();
+}
+//____________________________________________________________________________
+GeomVoxelMap::~GeomVoxelMap()
+{
+
+}
+//____________________________________________________________________________
+void GeomVoxelMap::Clear(void)
+{
+  fN[0] = fN[1] = fN[2] = 0;
+  fLow.SetXYZ(0,0,0);
+  fWidth.SetXYZ(0,0,0);
+  fCode.clear();
+  fVolumes.clear();
+}
+//____________________________________________________________________________
+bool GeomVoxelMap::Build(TGeoNavigator * nav, const TGeoVolume * top,
+                         double voxel_size, long int max_voxels)
+{
+  this->Clear();
+
+  if (!nav || !top || voxel_size <= 0) return false;
+
+  const TGeoBBox * box = dynamic_cast<const TGeoBBox *> (top->GetShape());
+  if (!box) {
+    LOG("GeomVoxel", pERROR) << "Top volume has no bounding box";
+    return false;
+  }
+  double half  [3] = { box->GetDX(), box->GetDY(), box->GetDZ() };
+  double origin[3] = { box->GetOrigin()[0], box->GetOrigin()[1], box->GetOrigin()[2] };
+
+  // enlarge the voxels if the map would be too large
+  double size = voxel_size;
+  while (true) {
+    long int nvox = 1;
+    for(int i = 0; i < 3; i++) {
+      fN[i] = TMath::Max(1, (int) std::ceil(2*half[i]/size));
+      nvox *= fN[i];
+    }
+    if (max_voxels <= 0 || nvox <= max_voxels) break;
+    size *= std::pow((double)nvox/(double)max_voxels, 1./3.) * 1.01;
+  }
+  if (size > voxel_size) {
+    LOG("GeomVoxel", pWARN)
+      << "Voxel size increased from " << voxel_size << " to " << size
+      << " to keep the map within " << max_voxels << " voxels";
+  }
+
+  fLow.SetXYZ  (origin[0]-half[0], origin[1]-half[1], origin[2]-half[2]);
+  fWidth.SetXYZ(2*half[0]/fN[0],   2*half[1]/fN[1],   2*half[2]/fN[2]);
+
+  LOG("GeomVoxel", pNOTICE)
+    << "Building a " << fN[0] << " x " << fN[1] << " x " << fN[2]
+    << " voxel map of top volume " << top->GetName();
+
+  map<const TGeoVolume *, int> index;
+
+  // volumes at the grid points (shared by neighbouring voxels)
+  const int nc[3] = { fN[0]+1, fN[1]+1, fN[2]+1 };
+  vector<int> corner(nc[0]*nc[1]*nc[2]);
+  for(int k = 0; k < nc[2]; k++) {
+    for(int j = 0; j < nc[1]; j++) {
+      for(int i = 0; i < nc[0]; i++) {
+        corner[(k*nc[1] + j)*nc[0] + i] = VolumeAt(nav,
+           fLow[0] + i*fWidth[0], fLow[1] + j*fWidth[1], fLow[2] + k*fWidth[2],
+           index, fVolumes);
+      }
+    }
+  }
+
+  // a voxel is uniform if its centre and all its corners are in one volume
+  fCode.resize(fN[0]*fN[1]*fN[2]);
+  for(int k = 0; k < fN[2]; k++) {
+    for(int j = 0; j < fN[1]; j++) {
+      for(int i = 0; i < fN[0]; i++) {
+        int code = VolumeAt(nav,
+           fLow[0] + (i+0.5)*fWidth[0], fLow[1] + (j+0.5)*fWidth[1],
+           fLow[2] + (k+0.5)*fWidth[2], index, fVolumes);
+        for(int c = 0; c < 8 && code != kMixed; c++) {
+          int ci = i + (c & 1), cj = j + ((c >> 1) & 1), ck = k + ((c >> 2) & 1);
+          if (corner[(ck*nc[1] + cj)*nc[0] + ci] != code) code = kMixed;
+        }
+        fCode[(k*fN[1] + j)*fN[0] + i] = code;
+      }
+    }
+  }
+
+  LOG("GeomVoxel", pNOTICE)
+    << "Voxel map built: " << fVolumes.size() << " volumes, "
+    << 100*this->UniformFraction() << "% of the voxels uniform";
+
+  return true;
+}
+//____________________________________________________________________________
+double GeomVoxelMap::UniformFraction(void) const
+{
+  if (fCode.empty()) return 0;
+  long int nuniform = 0;
+  for(unsigned int i = 0; i < fCode.size(); i++) {
+    if (fCode[i] != kMixed) nuniform++;
+  }
+  return (double)nuniform / (double)fCode.size();
+}
+//____________________________________________________________________________
+bool GeomVoxelMap::Clip(const TVector3 & r0, const TVector3 & udir,
+                        double & tmin, double & tmax) const
+{
+  tmin = 0;
+  tmax = 1e30;
+  for(int i = 0; i < 3; i++) {
+    double lo = fLow[i];
+    double hi = fLow[i] + fN[i]*fWidth[i];
+    if (udir[i] == 0) {
+      if (r0[i] < lo || r0[i] > hi) return false;
+      continue;
+    }
+    double t1 = (lo - r0[i]) / udir[i];
+    double t2 = (hi - r0[i]) / udir[i];
+    if (t1 > t2) std::swap(t1,t2);
+    tmin = TMath::Max(tmin, t1);
+    tmax = TMath::Min(tmax, t2);
+  }
+  return (tmin < tmax);
+}
+//____________________________________________________________________________
@@ -0,0 +1,85 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::geometry::GeomVoxelMap
+
+\brief    A voxelization of the top volume of a ROOT geometry, recording for
+          each voxel the geometry volume filling it (if a single volume was
+          found at all its corners and its centre) or marking it as mixed.
+          Used by ROOTGeomAnalyzer to swim rays through uniform voxels
+          without geometry navigation, falling back to exact TGeo stepping
+          in the mixed voxels.
+
+          The voxelization is approximate: volumes smaller than a voxel may
+          be missed if they contain none of its sampled points.
+
+\author   The GENIE Collaboration
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2018, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _GEOM_VOXEL_MAP_H_
+#define _GEOM_VOXEL_MAP_H_
+
+#include <vector>
+
+#include <TVector3.h>
+
+class TGeoNavigator;
+class TGeoVolume;
+
+using std::vector;
+
+namespace genie    {
+namespace geometry {
+
+class GeomVoxelMap {
+
+public :
+  GeomVoxelMap();
+ ~GeomVoxelMap();
+
+  static const int kMixed   = -1;  ///< voxel code: voxel spans several volumes
+  static const int kOutside = -2;  ///< voxel code: voxel outside the top volume
+
+  /// build the map of the top volume (bounding box) with cubic-ish voxels of
+  /// at most voxel_size (top volume units), using at most max_voxels voxels
+  bool Build (TGeoNavigator * nav, const TGeoVolume * top,
+              double voxel_size, long int max_voxels);
+  void Clear (void);
+
+  bool IsBuilt (void) const { return fCode.size() > 0; }
+
+  int              NX       (void) const { return fN[0]; }
+  int              NY       (void) const { return fN[1]; }
+  int              NZ       (void) const { return fN[2]; }
+  const TVector3 & Low      (void) const { return fLow;  }  ///< grid lower corner
+  const TVector3 & Width    (void) const { return fWidth; } ///< voxel widths
+  double           UniformFraction (void) const;
+
+  /// code (index into the volume table, kMixed or kOutside) of voxel i,j,k
+  int Code (int i, int j, int k) const { return fCode[(k*fN[1] + j)*fN[0] + i]; }
+  const TGeoVolume * Volume (int code) const { return fVolumes[code]; }
+
+  /// clip the ray r0 + t udir to the grid; returns false if it misses it
+  bool Clip (const TVector3 & r0, const TVector3 & udir,
+             double & tmin, double & tmax) const;
+
+private:
+
+  int                         fN[3];     ///< number of voxels along x,y,z
+  TVector3                    fLow;      ///< grid lower corner (top volume coord)
+  TVector3                    fWidth;    ///< voxel widths
+  vector<int>                 fCode;     ///< voxel codes
+  vector<const TGeoVolume *>  fVolumes;  ///< table of volumes filling voxels
+};
+
+}      // geometry namespace
+}      // genie    namespace
+
+#endif // _GEOM_VOXEL_MAP_H_
@@ -9,6 +9,8 @@
 
 #pragma link C++ class genie::geometry::ROOTGeomAnalyzer;
 #pragma link C++ class genie::geometry::PointGeomAnalyzer;
+#pragma link C++ class genie::geometry::GeomVoxelMap;
+#pragma link C++ class genie::geometry::AnalyticGeomAnalyzer;
 
 #pragma link C++ namespace genie::utils::geometry;
 
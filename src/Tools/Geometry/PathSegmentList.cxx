@@ -47,6 +47,8 @@
    New methods IsTrimmedEmpty() and GetSummedStepRange().  
    Also GetPosition() to pick position within vector of (lo,hi) pairs based on 
    fraction of total.  Needs more testing for case of split segments.
+ @ Oct 14, 2026 - The GENIE Collaboration
+   IsSameStart() with position & direction tolerances.
 
 */
 //____________________________________________________________________________
@@ -268,6 +270,19 @@ bool PathSegmentList::IsSameStart(const TVector3& pos, const TVector3& dir) cons
   return ( this->fStartPos == pos && this->fDirection == dir );
 }
 
+//___________________________________________________________________________
+bool PathSegmentList::IsSameStart(const TVector3& pos, const TVector3& dir,
+                                  double postol, double dirtol) const
+{
+  if ( postol <= 0 && dirtol <= 0 ) return this->IsSameStart(pos,dir);
+
+  for ( int i = 0; i < 3; ++i ) {
+    if ( TMath::Abs(this->fStartPos[i]  - pos[i]) > postol ) return false;
+    if ( TMath::Abs(this->fDirection[i] - dir[i]) > dirtol ) return false;
+  }
+  return true;
+}
+
 //___________________________________________________________________________
 void PathSegmentList::FillMatStepSum(void) 
 {
@@ -134,6 +134,8 @@ public :
   void    SetStartInfo    (const TVector3& pos = TVector3(0,0,1e37), 
                            const TVector3& dir = TVector3(0,0,0)     );
   bool    IsSameStart     (const TVector3& pos, const TVector3& dir) const;
+  bool    IsSameStart     (const TVector3& pos, const TVector3& dir, 
+                           double postol, double dirtol) const;
   void    AddSegment      (const PathSegment& ps) { fSegmentList.push_back(ps); }
 
   const TVector3& GetDirection() const { return fDirection; }
@@ -82,14 +82,58 @@
    Previously used TString::Contains("vol2match") which did not require the string
    length to be the same and sometime lead to degeneracies and selection of 
    incorrect top volume. Bug and fix were found by Kevin Connolly.   
+ @ Oct 14, 2026 - The GENIE Collaboration
+   Moved the navigation state (TGeoNavigator, path-segment and path-length
+   lists, vertex) into a ROOTGeomNavContext. Added EnableMultiThreadNavigation()
+   after which each thread navigates the shared TGeoManager through its own
+   context, so that path lengths and vertices can be computed concurrently.
+   The max path length scanners (box and flux methods) now swim their rays
+   in batches, optionally spread over SetScannerNThreads() threads, and can
+   stop early once SetScannerConvergence() consecutive batches did not
+   increase the maximum path length of any material.
+   ComputeMaxPathLengths() keeps the results in a per-user cache, keyed by a
+   hash of the geometry content (below the top volume), units, weighting and
+   scanning options, the volume selector and the flux description, and reuses
+   them in later jobs with the same setup.
+   Implemented the batch ComputePathLengths(): rays are converted to top
+   volume coordinates once, swum in order of their start point (repeated
+   rays are swum only once) and material weights are computed once per
+   batch. The max path length scanners use it.
+   Added an optional voxel map of the top volume (SetVoxelSize()): rays cross
+   voxels filled by a single volume without geometry navigation and are
+   stepped through exactly only in voxels spanning several volumes.
+   Each navigation context keeps the path-segment lists of the most recently
+   swum rays (SetSegmentCacheSize(), SetSegmentCacheTolerance()) so that rays
+   repeated by the flux driver are not swum again.
+   Rays the volume selector rejects as a whole (eg rays missing the fiducial
+   volume) are not swum through the geometry.
+   Rays and vertices are converted between SI / master coordinates and top
+   volume coordinates / units with a combined transform precomputed at
+   Load(), SetTopVolName() and SetLengthUnits(), with fast paths for the
+   identity and pure scaling cases.
+   Added SetAnalyticRock(): the top volume outside a given (hall) box is
+   taken to be a single volume, so rays cross it analytically and are only
+   stepped through the geometry inside the box.
+   The target weights of each material (mixtures expanded) are tabulated at
+   Load() by material index, and rebuilt when the weighting options change.
+   ComputePathLengths() swims a ray once for all targets (instead of once
+   per target) and accumulates the path lengths as a sparse sum over the
+   crossed materials.
 
 */
 //____________________________________________________________________________
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 #include <iomanip>
+#include <sstream>
 #include <set>
+#include <map>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #include <TGeoVolume.h>
 #include <TGeoManager.h>
@@ -98,6 +142,7 @@
 #include <TGeoMaterial.h>
 #include <TGeoMatrix.h>
 #include <TGeoNode.h>
+#include <TGeoNavigator.h>
 #include <TObjArray.h>
 #include <TLorentzVector.h>
 #include <TList.h>
@@ -105,6 +150,7 @@
 #include <TMath.h>
 #include <TPolyMarker3D.h>
 #include <TGeoBBox.h>
+#include <TBufferFile.h>
 
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Units.h"
@@ -114,16 +160,20 @@
 #include "Framework/EventGen/GFluxI.h"
 #include "Tools/Geometry/ROOTGeomAnalyzer.h"
 #include "Tools/Geometry/GeomVolSelectorI.h"
+#include "Tools/Geometry/GeomVoxelMap.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/InitTimingStats.h"
 
 using namespace genie;
 using namespace genie::geometry;
 using namespace genie::controls;
 
+using std::ostringstream;
+
 //#define RWH_DEBUG
 //#define RWH_DEBUG_2
 //#define RWH_COUNTVOLS
@@ -139,6 +189,309 @@ double   dnvols2[6] = { 0, 0, 0, 0, 0, 0}; //rwh
 bool  accum_vol_stat = false;
 #endif
 
+//___________________________________________________________________________
+namespace {
+  // kinds of SI master <-> top local transforms
+  enum { kXformIdentity = 0, kXformScale = 1, kXformGeneral = 2 };
+
+  // serializes the building of the voxel map
+  std::mutex gVoxelMapLock;
+
+  // maximum number of voxels in the voxel map
+  const long int kMaxVoxels = 1L << 24;
+
+  // Joins the consecutive voxel steps of a ray in the same volume
+  // into a single path segment
+  class VoxelSegmentBuilder {
+  public:
+    VoxelSegmentBuilder(PathSegmentList * pslist,
+                        const TVector3 & r0, const TVector3 & udir)
+      : fList(pslist), fR0(r0), fDir(udir), fOpen(false) { }
+   ~VoxelSegmentBuilder() { this->Flush(); }
+
+    void Add(const TGeoVolume * vol, double t0, double t1)
+    {
+      if (t1 <= t0) return;
+      if (fOpen && fSeg.fVolume == vol &&
+          TMath::Abs(fSeg.fRayDist + fSeg.fStepLength - t0) < TGeoShape::Tolerance()) {
+        fSeg.SetExit(fR0 + t1*fDir);
+        fSeg.SetStep(t1 - fSeg.fRayDist);
+        return;
+      }
+      this->Flush();
+      const TGeoMedium * med = vol->GetMedium();
+      fSeg.SetEnter(fR0 + t0*fDir, t0);
+      fSeg.SetExit (fR0 + t1*fDir);
+      fSeg.SetGeo(vol, med, med->GetMaterial());
+      fSeg.SetStep(t1 - t0);
+      fOpen = true;
+    }
+    void Flush(void)
+    {
+      if (fOpen) fList->AddSegment(fSeg);
+      fOpen = false;
+    }
+    // step exactly through the geometry between ray distances t0 and t1
+    void Step(TGeoNavigator * nav, double t0, double t1)
+    {
+      TVector3 pos = fR0 + t0*fDir;
+      nav->SetCurrentDirection(fDir[0], fDir[1], fDir[2]);
+      nav->SetCurrentPoint    (pos[0],  pos[1],  pos[2] );
+      nav->FindNode();
+      double t = t0;
+      while (t < t1 - TGeoShape::Tolerance()) {
+        const TGeoVolume * vol = nav->IsOutside() ? 0 : nav->GetCurrentVolume();
+        nav->FindNextBoundaryAndStep(t1 - t);
+        double step = TMath::Max(nav->GetStep(), TGeoShape::Tolerance());
+        step = TMath::Min(step, t1 - t);
+        if (vol) this->Add(vol, t, t+step);
+        else     this->Flush();
+        t += step;
+      }
+    }
+  private:
+    PathSegmentList * fList;
+    TVector3          fR0;
+    TVector3          fDir;
+    PathSegment       fSeg;
+    bool              fOpen;
+  };
+
+  // clip the ray r0 + t udir (t >= 0) to the box [lo,hi]
+  bool ClipToBox(const TVector3 & r0, const TVector3 & udir,
+                 const double * lo, const double * hi,
+                 double & tmin, double & tmax)
+  {
+    tmin = 0;
+    tmax = 1e30;
+    for(int i = 0; i < 3; i++) {
+      if (udir[i] == 0) {
+        if (r0[i] < lo[i] || r0[i] > hi[i]) return false;
+        continue;
+      }
+      double t1 = (lo[i] - r0[i]) / udir[i];
+      double t2 = (hi[i] - r0[i]) / udir[i];
+      if (t1 > t2) std::swap(t1,t2);
+      tmin = TMath::Max(tmin, t1);
+      tmax = TMath::Min(tmax, t2);
+    }
+    return (tmin < tmax);
+  }
+
+  // the navigation contexts of the calling thread, one per analyzer; they
+  // are deleted when the thread exits (or on DeleteThreadContext())
+  struct NavContextMap : public std::map<const ROOTGeomAnalyzer *, ROOTGeomNavContext *> {
+    ~NavContextMap() {
+      for(iterator it = begin(); it != end(); ++it) delete it->second;
+    }
+  };
+  thread_local NavContextMap gThreadNavContexts;
+
+  // geometry volume selectors keep the current ray, so trimming is serialized
+  std::mutex gGeomVolSelectorLock;
+
+  // orders rays by start point, then direction
+  struct RayOrder {
+    RayOrder(const vector<TVector3> & pos, const vector<TVector3> & dir) :
+      fPos(pos), fDir(dir) { }
+    bool operator() (unsigned int i, unsigned int j) const {
+      for(int k = 0; k < 3; k++) {
+        if (fPos[i][k] != fPos[j][k]) return fPos[i][k] < fPos[j][k];
+      }
+      for(int k = 0; k < 3; k++) {
+        if (fDir[i][k] != fDir[j][k]) return fDir[i][k] < fDir[j][k];
+      }
+      return false;
+    }
+    const vector<TVector3> & fPos;
+    const vector<TVector3> & fDir;
+  };
+
+  // FNV-1a hash, accumulated over many strings / buffers
+  class Fnv1aHash {
+  public:
+    Fnv1aHash() : fHash(0xcbf29ce484222325ULL) { }
+    void Add(const char * data, int n) {
+      for(int i = 0; i < n; i++) {
+        fHash ^= (unsigned char) data[i];
+        fHash *= 0x100000001b3ULL;
+      }
+    }
+    void Add(const string & str) { this->Add(str.data(), str.size()); }
+    string AsString(void) const {
+      ostringstream hash_str;
+      hash_str << std::hex << std::setfill('0') << std::setw(16) << fHash;
+      return hash_str.str();
+    }
+  private:
+    ULong64_t fHash;
+  };
+
+  // swims batches of rays for the max path length scanners, spreading each
+  // batch over a fixed set of threads (created once: every thread keeps its
+  // own navigator) and reducing the per-thread maxima
+  class RaySwimPool {
+  public:
+    RaySwimPool(ROOTGeomAnalyzer * geom, int nthreads, const PDGCodeList & pdglist);
+   ~RaySwimPool();
+
+    void Swim(const vector<TLorentzVector> & x4, const vector<TLorentzVector> & p4);
+
+    const PathLengthList & MaxPathLengths (void) const { return fMaxPl;     }
+    int                    NEntering      (void) const { return fNEntering; }
+
+  private:
+    void Work      (int ithread);
+    void SwimShare (int ithread);
+
+    ROOTGeomAnalyzer *             fGeom;
+    int                            fNThreads;
+    vector<std::thread>            fThreads;
+    std::mutex                     fLock;
+    std::condition_variable        fStartCond;
+    std::condition_variable        fDoneCond;
+    unsigned long                  fBatch;      // number of the current batch
+    int                            fNDone;      // threads done with the current batch
+    bool                           fStop;
+    const vector<TLorentzVector> * fX4;
+    const vector<TLorentzVector> * fP4;
+    vector<PathLengthList>         fThreadMaxPl;
+    vector<int>                    fThreadNEntering;
+    PathLengthList                 fMaxPl;      // max over the current batch
+    int                            fNEntering;  // rays of the current batch entering some material
+  };
+  //_________________________________________________________________________
+  RaySwimPool::RaySwimPool(
+      ROOTGeomAnalyzer * geom, int nthreads, const PDGCodeList & pdglist) :
+  fGeom            (geom),
+  fNThreads        (TMath::Max(1,nthreads)),
+  fBatch           (0),
+  fNDone           (0),
+  fStop            (false),
+  fX4              (0),
+  fP4              (0),
+  fThreadMaxPl     (fNThreads, PathLengthList(pdglist)),
+  fThreadNEntering (fNThreads, 0),
+  fMaxPl           (pdglist),
+  fNEntering       (0)
+  {
+    if (fNThreads == 1) return; // swim in the calling thread
+    for(int ithread = 0; ithread < fNThreads; ithread++) {
+      fThreads.push_back( std::thread(&RaySwimPool::Work, this, ithread) );
+    }
+  }
+  //_________________________________________________________________________
+  RaySwimPool::~RaySwimPool()
+  {
+    {
+      std::lock_guard<std::mutex> guard(fLock);
+      fStop = true;
+    }
+    fStartCond.notify_all();
+    for(unsigned int i = 0; i < fThreads.size(); i++) fThreads[i].join();
+  }
+  //_________________________________________________________________________
+  void RaySwimPool::Swim(
+      const vector<TLorentzVector> & x4, const vector<TLorentzVector> & p4)
+  {
+    fX4 = &x4;
+    fP4 = &p4;
+
+    if (fThreads.empty()) {
+      this->SwimShare(0);
+    } else {
+      std::unique_lock<std::mutex> lock(fLock);
+      fNDone = 0;
+      fBatch++;
+      fStartCond.notify_all();
+      fDoneCond.wait(lock, [this] { return fNDone == fNThreads; });
+    }
+
+    // reduce the per-thread results
+    fMaxPl.SetAllToZero();
+    fNEntering = 0;
+    for(int ithread = 0; ithread < fNThreads; ithread++) {
+      const PathLengthList & tpl = fThreadMaxPl[ithread];
+      for(PathLengthList::const_iterator it = tpl.begin(); it != tpl.end(); ++it) {
+        if (it->second > fMaxPl.PathLength(it->first))
+          fMaxPl.SetPathLength(it->first, it->second);
+      }
+      fNEntering += fThreadNEntering[ithread];
+    }
+  }
+  //_________________________________________________________________________
+  void RaySwimPool::Work(int ithread)
+  {
+    unsigned long batch = 0;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(fLock);
+        fStartCond.wait(lock, [&] { return fStop || fBatch != batch; });
+        if (fStop) return;
+        batch = fBatch;
+      }
+      this->SwimShare(ithread);
+      {
+        std::lock_guard<std::mutex> guard(fLock);
+        fNDone++;
+      }
+      fDoneCond.notify_one();
+    }
+  }
+  //_________________________________________________________________________
+  void RaySwimPool::SwimShare(int ithread)
+  {
+    PathLengthList & maxpl = fThreadMaxPl[ithread];
+    maxpl.SetAllToZero();
+    fThreadNEntering[ithread] = 0;
+
+    // each thread swims a contiguous share of the batch
+    const unsigned int nrays = fX4->size();
+    const unsigned int first = (nrays * ithread) / fNThreads;
+    const unsigned int last  = (nrays * (ithread+1)) / fNThreads;
+    if (first == last) return;
+
+    vector<TLorentzVector> x4(fX4->begin()+first, fX4->begin()+last);
+    vector<TLorentzVector> p4(fP4->begin()+first, fP4->begin()+last);
+    vector<double> pl;
+    fGeom->ComputePathLengths(x4, p4, pl);
+
+    const PDGCodeList & targets = fGeom->ListOfTargetNuclei();
+    const unsigned int ntgt = targets.size();
+    for(unsigned int iray = 0; iray < last-first; iray++) {
+      bool enters = false;
+      for(unsigned int itgt = 0; itgt < ntgt; itgt++) {
+        double raypl = pl[iray*ntgt + itgt];
+        if (raypl <= 0) continue;
+        enters = true;
+        if (raypl > maxpl.PathLength(targets[itgt]))
+          maxpl.SetPathLength(targets[itgt], raypl);
+      }
+      if (enters) fThreadNEntering[ithread]++;
+    }
+  }
+}
+//___________________________________________________________________________
+ROOTGeomNavContext::ROOTGeomNavContext(
+                           TGeoNavigator * nav, const PDGCodeList & pdglist) :
+fNavigator       (nav),
+fPathSegmentList (new PathSegmentList()),
+fPathLengthList  (new PathLengthList(pdglist)),
+fVertex          (new TVector3(0.,0.,0.)),
+fSegmentCacheGen (0)
+{
+
+}
+//___________________________________________________________________________
+ROOTGeomNavContext::~ROOTGeomNavContext()
+{
+  delete fPathSegmentList;
+  delete fPathLengthList;
+  delete fVertex;
+
+  std::list<PathSegmentList *>::iterator it = fSegmentCache.begin();
+  for( ; it != fSegmentCache.end(); ++it) delete *it;
+}
 //___________________________________________________________________________
 ROOTGeomAnalyzer::ROOTGeomAnalyzer(string geometry_filename)
   : GeomAnalyzerI()
@@ -204,6 +557,12 @@ const PathLengthList & ROOTGeomAnalyzer::ComputeMaxPathLengths(void)
   //-- initialize max path lengths
   fCurrMaxPathLengthList->SetAllToZero();
 
+  //-- reuse the max path lengths of an earlier job with the same setup
+  string cache_file = (fUseMaxPlCache) ? this->MaxPlCacheFile() : "";
+  if ( cache_file.size() > 0 && this->ReadMaxPlCache(cache_file) ) {
+    return *fCurrMaxPathLengthList;
+  }
+
   //-- select maximum path length calculation method
   if ( fFlux ) {
     this->MaxPathLengthsFluxMethod();
@@ -214,6 +573,8 @@ const PathLengthList & ROOTGeomAnalyzer::ComputeMaxPathLengths(void)
     this->MaxPathLengthsBoxMethod();
   }
 
+  if ( cache_file.size() > 0 ) this->WriteMaxPlCache(cache_file);
+
   return *fCurrMaxPathLengthList;
 }
 
@@ -236,6 +597,12 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
        << ", 4x (m,s) = " << utils::print::X4AsString(&x);
 #endif
 
+  ROOTGeomNavContext * ctx = this->NavContext();
+  PathLengthList * pathlengths = ctx->fPathLengthList;
+
+  std::unique_lock<std::mutex> lock(gGeomVolSelectorLock, std::defer_lock);
+  if ( fGeomVolSelector && fGeometry->IsMultiThread() ) lock.lock();
+
   // if trimming configure with neutrino ray's info
   if ( fGeomVolSelector ) {
     fGeomVolSelector->SetCurrentRay(x,p);
@@ -244,37 +611,92 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
 
   TVector3 udir = p.Vect().Unit(); // unit vector along direction
   TVector3 pos = x.Vect();         // initial position
-  this->SI2Local(pos);             // SI -> curr geom units
-  
-  if (!fMasterToTopIsIdentity) {
-    this->Master2Top(pos);         // transform position (master -> top)
-    this->Master2TopDir(udir);     // transform direction (master -> top)
-  }
+  this->SI2Top(pos,udir);          // SI, master -> curr geom units, top
 
   // reset current list of path-lengths
-  fCurrPathLengthList->SetAllToZero();
+  pathlengths->SetAllToZero();
 
-  //loop over materials & compute the path-length
-  vector<int>::iterator itr;
-  for (itr=fCurrPDGCodeList->begin();itr!=fCurrPDGCodeList->end();itr++) {
+  // swim once & accumulate the path-lengths of all targets
+  const unsigned int ntgt = fCurrPDGCodeList->size();
+  vector<double> & tgtpl = ctx->fTargetPl;
+  tgtpl.assign(ntgt, 0.);
 
-    int pdgc = *itr;
+  this->SwimOnce(pos,udir);
+  if ( ntgt > 0 ) this->AddMaterialPathLengths(*ctx->fPathSegmentList, &tgtpl[0]);
 
-    Double_t pl = this->ComputePathLengthPDG(pos,udir,pdgc);
-    fCurrPathLengthList->AddPathLength(pdgc,pl);
+  // the list holds the (sorted) targets: same material index
+  pathlengths->SetPathLengths(tgtpl);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  for (unsigned int itgt = 0; itgt < ntgt; itgt++) {
     LOG("GROOTGeom", pINFO)
-      <<"Calculated path length for material: " << pdgc << " = " << pl;
+      <<"Calculated path length for material: "
+      << (*fCurrPDGCodeList)[itgt] << " = " << tgtpl[itgt];
+  } // loop over targets
 #endif
 
-  } // loop over materials
-
-  this->Local2SI(*fCurrPathLengthList); // curr geom units -> SI
+  this->Local2SI(*pathlengths); // curr geom units -> SI
 
-  return *fCurrPathLengthList;
+  return *pathlengths;
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::ComputePathLengths(
+  const vector<TLorentzVector> & x, const vector<TLorentzVector> & p,
+  vector<double> & pl)
+{
+/// Computes the path-lengths within each detector material for a batch of
+/// neutrinos starting from points x[i] (master coord) and travelling along
+/// the directions of p[i] (master coord). The path lengths are stored, in SI
+/// units, in the dense [rays x targets] matrix pl (row-major, targets as
+/// in ListOfTargetNuclei())
+
+  const unsigned int ntgt  = fCurrPDGCodeList->size();
+  const unsigned int nrays = TMath::Min(x.size(), p.size());
+
+  pl.assign(nrays*ntgt, 0.);
+  if ( nrays == 0 ) return;
+
+  ROOTGeomNavContext * ctx = this->NavContext();
+
+  std::unique_lock<std::mutex> lock(gGeomVolSelectorLock, std::defer_lock);
+  if ( fGeomVolSelector && fGeometry->IsMultiThread() ) lock.lock();
+
+  // transform all rays to top volume coordinates & units
+  vector<TVector3> pos(nrays), udir(nrays);
+  vector<unsigned int> order(nrays);
+  for(unsigned int iray = 0; iray < nrays; iray++) {
+    udir[iray] = p[iray].Vect().Unit();
+    pos [iray] = x[iray].Vect();
+    this->SI2Top(pos[iray],udir[iray]);
+    order[iray] = iray;
+  }
+
+  // swim the rays in order of their start point: neighbouring rays cross
+  // the same volumes and identical rays are swum only once
+  std::sort(order.begin(), order.end(), RayOrder(pos, udir));
+
+  double scaling_factor = this->LengthUnits();
+  if (this->WeightWithDensity()) { scaling_factor *= this->DensityUnits(); }
+
+  for(unsigned int k = 0; k < nrays; k++) {
+    unsigned int iray = order[k];
+
+    if ( fGeomVolSelector ) {
+      fGeomVolSelector->SetCurrentRay(x[iray],p[iray]);
+      fGeomVolSelector->SetSI2Local(1/this->LengthUnits());
+    }
+
+    this->SwimOnce(pos[iray],udir[iray]);
+
+    double * raypl = &pl[iray*ntgt];
+    if ( ntgt > 0 ) this->AddMaterialPathLengths(*ctx->fPathSegmentList, raypl);
+
+    for(unsigned int itgt = 0; itgt < ntgt; itgt++) {
+      raypl[itgt] *= scaling_factor;  // curr geom units -> SI
+    }
+  }
+}
 //___________________________________________________________________________
 const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
               const TLorentzVector & x, const TLorentzVector & p, int tgtpdg)
@@ -287,12 +709,18 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
        << "Generating vtx in material: " << tgtpdg
        << " along the input neutrino direction";
 
+  ROOTGeomNavContext * ctx = this->NavContext();
+  TGeoNavigator * nav = ctx->fNavigator;
+
+  std::unique_lock<std::mutex> lock(gGeomVolSelectorLock, std::defer_lock);
+  if ( fGeomVolSelector && fGeometry->IsMultiThread() ) lock.lock();
+
   int nretry = 0;
   retry:  // goto label in case of abject failure
   nretry++;
 
   // reset current interaction vertex
-  fCurrVertex->SetXYZ(0.,0.,0.);
+  ctx->fVertex->SetXYZ(0.,0.,0.);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GROOTGeom", pDEBUG)
@@ -309,24 +737,21 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
   // x and looking along the direction of p
   TVector3 udir = p.Vect().Unit();
   TVector3 pos = x.Vect();
-  this->SI2Local(pos);           // SI -> curr geom units
-
-  if (!fMasterToTopIsIdentity) {
-    this->Master2Top(pos);       // transform position (master -> top)
-    this->Master2TopDir(udir);   // transform direction (master -> top)
-  }
+  this->SI2Top(pos,udir);        // SI, master -> curr geom units, top
 
   double maxwgt_dist = this->ComputePathLengthPDG(pos,udir,tgtpdg);
   if ( maxwgt_dist <= 0 ) {
     LOG("GROOTGeom", pERROR)
      << "The current trajectory does not cross the selected material!!";
-    return *fCurrVertex;
+    return *ctx->fVertex;
   }
 
   // generate random number between 0 and max_dist
   RandomGen * rnd = RandomGen::Instance();
   double genwgt_dist(maxwgt_dist * rnd->RndGeom().Rndm());
 
+  const PathSegmentList * pslist = ctx->fPathSegmentList;
+
   LOG("GROOTGeom", pINFO)
     << "Swim mass: Top Vol dir = " << utils::print::P3AsString(&udir)
     << ", pos = " << utils::print::Vec3AsString(&pos);
@@ -336,26 +761,27 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
        << "Generated 'distance' in selected material = " << genwgt_dist;
 #ifdef RWH_DEBUG
   if ( ( fDebugFlags & 0x01 ) ) {
-    fCurrPathSegmentList->SetDoCrossCheck(true);       //RWH
-    LOG("GROOTGeom", pINFO) << *fCurrPathSegmentList;  //RWH
+    ctx->fPathSegmentList->SetDoCrossCheck(true);       //RWH
+    LOG("GROOTGeom", pINFO) << *pslist;                 //RWH
     double mxddist = 0, mxdstep = 0;
-    fCurrPathSegmentList->CrossCheck(mxddist,mxdstep);
+    ctx->fPathSegmentList->CrossCheck(mxddist,mxdstep);
     fmxddist = TMath::Max(fmxddist,mxddist);
     fmxdstep = TMath::Max(fmxdstep,mxdstep);
   }
 #endif
 
-  // compute the pdg weight for each material just once, then use a stl map 
+  // look up the pdg weight for each material just once, then use a stl map 
+  int itgt = this->TargetIndex(tgtpdg);
   PathSegmentList::MaterialMap_t wgtmap;
   PathSegmentList::MaterialMapCItr_t mitr     = 
-    fCurrPathSegmentList->GetMatStepSumMap().begin();
+    pslist->GetMatStepSumMap().begin();
   PathSegmentList::MaterialMapCItr_t mitr_end = 
-    fCurrPathSegmentList->GetMatStepSumMap().end();
+    pslist->GetMatStepSumMap().end();
   // loop over map to get tgt weight for each material (once)
   // steps outside the geometry may have no assigned material
   for ( ; mitr != mitr_end; ++mitr ) {
     const TGeoMaterial* mat = mitr->first;
-    double wgt = ( mat ) ? this->GetWeight(mat,tgtpdg) : 0;
+    double wgt = ( mat ) ? this->MaterialWeight(mat,itgt) : 0;
     wgtmap[mat] = wgt;
 #ifdef RWH_DEBUG
     if ( ( fDebugFlags & 0x02 ) ) {
@@ -367,7 +793,7 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
 
   // walk down the path to pick the vertex
   const genie::geometry::PathSegmentList::PathSegmentV_t& segments = 
-    fCurrPathSegmentList->GetPathSegmentV();
+    pslist->GetPathSegmentV();
   genie::geometry::PathSegmentList::PathSegVCItr_t sitr;
   double walked = 0;
   for ( sitr = segments.begin(); sitr != segments.end(); ++sitr) {
@@ -405,8 +831,8 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
           << genwgt_dist << " " << walked << " " << wgtstep;
       }
       pos = seg.GetPosition(frac);
-      fGeometry -> SetCurrentPoint (pos[0],pos[1],pos[2]);
-      fGeometry -> FindNode();
+      nav -> SetCurrentPoint (pos[0],pos[1],pos[2]);
+      nav -> FindNode();
       LOG("GROOTGeom", pINFO)
         << "Choose vertex position in " << seg.fVolume->GetName() << " "
          << utils::print::Vec3AsString(&pos);
@@ -417,8 +843,8 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
 
   LOG("GROOTGeom", pNOTICE)
      << "The vertex was placed in volume: " 
-     << fGeometry->GetCurrentVolume()->GetName()
-     << ", path: " << fGeometry->GetPath();
+     << nav->GetCurrentVolume()->GetName()
+     << ", path: " << nav->GetPath();
 
   // warn for any volume overshoots
   bool ok = this->FindMaterialInCurrentVol(tgtpdg);
@@ -435,20 +861,16 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
     }
   }
 
-  if (!fMasterToTopIsIdentity) {
-     this->Top2Master(pos); // transform position (top -> master)
-  }
-
-  this->Local2SI(pos);   // curr geom units -> SI
+  this->Top2SI(pos);     // curr geom units, top -> SI, master
 
-  fCurrVertex->SetXYZ(pos[0],pos[1],pos[2]);
+  ctx->fVertex->SetXYZ(pos[0],pos[1],pos[2]);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GROOTGeom", pDEBUG) 
       << "Vtx (m) = " << utils::print::Vec3AsString(&pos);
 #endif
 
-  return *fCurrVertex;
+  return *ctx->fVertex;
 }
 
 //===========================================================================
@@ -466,6 +888,9 @@ void ROOTGeomAnalyzer::SetLengthUnits(double u)
 /// As input, use one of the constants in $GENIE/src/Conventions/Units.h
 
   fLengthScale = u/units::meter;
+  if (fVoxelMap) { delete fVoxelMap; fVoxelMap = 0; }
+  fSegmentCacheGen++;
+  this->UpdateTransforms();
   LOG("GROOTGeom", pNOTICE)
      << "Geometry length units scale factor (geom units -> m): " 
      << fLengthScale;
@@ -508,6 +933,19 @@ void ROOTGeomAnalyzer::SetMixtureWeightsSum(double sum)
 /// compute the correct weight normalization.
 
   fMixtWghtSum = sum;
+
+  this->BuildMaterialWeights();
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetWeightWithDensity(bool wt)
+{
+/// Weight the path lengths with the material densities (if true) or with
+/// the presence of the target in the material (if false)
+
+  fDensWeight = wt;
+
+  this->BuildMaterialWeights();
 }
 
 //___________________________________________________________________________
@@ -557,6 +995,91 @@ void ROOTGeomAnalyzer::SetTopVolName(string name)
   // set volume name
   fTopVolume = gvol;
   fGeometry->SetTopVolume(fTopVolume);
+
+  if (fVoxelMap) { delete fVoxelMap; fVoxelMap = 0; }
+  fSegmentCacheGen++;
+  this->UpdateTransforms();
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetVoxelSize(double size)
+{
+/// Swim rays through a voxel map of the top volume, with voxels of (at most)
+/// the input size (SI units). Voxels filled by a single volume are crossed
+/// without geometry navigation. The map is built on first use; it is not
+/// used if the path of the geometry volumes is needed (SetKeepSegPath(),
+/// selectors needing the path).  A size <= 0 switches the voxel map off.
+
+  fVoxelSize = (size > 0) ? size : 0;
+  if (fVoxelMap) { delete fVoxelMap; fVoxelMap = 0; }
+  fSegmentCacheGen++;
+
+  LOG("GROOTGeom", pNOTICE)
+     << "Voxel map voxel size (m): " << fVoxelSize
+     << ((fVoxelSize > 0) ? "" : " [no voxel map]");
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetAnalyticRock(
+              string rockvol, const double * xyzmin, const double * xyzmax)
+{
+/// Declare that the top volume, outside the (hall) box [xyzmin,xyzmax] in
+/// top volume coordinates & units, is entirely filled by the volume named
+/// rockvol (eg the rock surrounding the detector hall, as for the
+/// GeomVolSelectorRockBox). Rays then cross that region analytically and
+/// are stepped through the geometry only inside the box. It is up to the
+/// caller to make sure that the rock is indeed a single, homogeneous volume
+/// with nothing else embedded outside the box; if not, path lengths and
+/// vertices will be wrong. An empty name switches the analytic rock off.
+/// Requires a box-shaped top volume (call after SetTopVolName()).
+
+  fRockVolume = 0;
+  fSegmentCacheGen++;
+
+  if (rockvol.size() == 0) return;
+
+  if (!fGeometry || !fTopVolume ||
+      std::strcmp(fTopVolume->GetShape()->ClassName(), "TGeoBBox") != 0) {
+    LOG("GROOTGeom", pFATAL)
+       << "Analytic rock needs a geometry with a box-shaped top volume";
+    exit(1);
+  }
+  fRockVolume = fGeometry->GetVolume(rockvol.c_str());
+  if (!fRockVolume || !fRockVolume->GetMedium()) {
+    LOG("GROOTGeom", pFATAL)
+       << "No rock volume (with a medium) named: " << rockvol;
+    exit(1);
+  }
+  for(int i = 0; i < 3; i++) {
+    fRockHallMin[i] = TMath::Min(xyzmin[i], xyzmax[i]);
+    fRockHallMax[i] = TMath::Max(xyzmin[i], xyzmax[i]);
+  }
+
+  LOG("GROOTGeom", pNOTICE)
+     << "Analytic rock: volume " << rockvol << " ("
+     << fRockVolume->GetMedium()->GetMaterial()->GetName()
+     << ") outside hall box [" << fRockHallMin[0] << "," << fRockHallMin[1]
+     << "," << fRockHallMin[2] << "] - [" << fRockHallMax[0] << ","
+     << fRockHallMax[1] << "," << fRockHallMax[2] << "]";
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetSegmentCacheSize(int n)
+{
+/// Keep, in each thread, the path-segment lists of the n most recently swum
+/// rays besides the last one, so that rays repeated by the flux driver (eg
+/// flux entries reused several times) need not be swum again.
+
+  fSegmentCacheSize = TMath::Max(n,0);
+  fSegmentCacheGen++;
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetSegmentCacheTolerance(double postol, double dirtol)
+{
+/// Rays whose start positions (SI units) and direction cosines differ from
+/// the ones of a cached ray by no more than the input tolerances reuse its
+/// path-segment list. The default tolerances (0) require identical rays.
+
+  fSegmentCachePosTol = TMath::Max(postol,0.);
+  fSegmentCacheDirTol = TMath::Max(dirtol,0.);
+  fSegmentCacheGen++;
 }
 
 //===========================================================================
@@ -581,8 +1104,7 @@ void ROOTGeomAnalyzer::Local2SI(PathLengthList & pl) const
   PathLengthList::iterator pliter;
   for(pliter = pl.begin(); pliter != pl.end(); ++pliter)
   {
-    int pdgc = pliter->first;
-    pl.ScalePathLength(pdgc, scaling_factor);
+    pliter->second *= scaling_factor;
   }
 }
 
@@ -646,6 +1168,70 @@ void ROOTGeomAnalyzer::Master2Top(TVector3 & vec) const
 #endif
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::UpdateTransforms(void)
+{
+/// Precompute the combined (SI units, master coordinates) -> (geometry units,
+/// top volume coordinates) transform used for every ray and vertex
+
+  fSI2LocalScale = 1./this->LengthUnits();
+
+  if (fMasterToTop && !fMasterToTopIsIdentity) {
+    const Double_t * rot   = fMasterToTop->GetRotationMatrix();
+    const Double_t * trans = fMasterToTop->GetTranslation();
+    for(int i = 0; i < 9; i++) fMasterToTopRot  [i] = rot  [i];
+    for(int i = 0; i < 3; i++) fMasterToTopTrans[i] = trans[i];
+    fTransformKind = kXformGeneral;
+  } else {
+    for(int i = 0; i < 9; i++) fMasterToTopRot  [i] = (i%4 == 0) ? 1 : 0;
+    for(int i = 0; i < 3; i++) fMasterToTopTrans[i] = 0;
+    fTransformKind = (fSI2LocalScale == 1.) ? kXformIdentity : kXformScale;
+  }
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SI2Top(TVector3 & pos, TVector3 & udir) const
+{
+/// Same as SI2Local(pos) followed by Master2Top(pos) & Master2TopDir(udir)
+
+  if (fTransformKind == kXformIdentity) return;
+
+  const double s = fSI2LocalScale;
+  if (fTransformKind == kXformScale) {
+    pos.SetXYZ(s*pos.X(), s*pos.Y(), s*pos.Z());
+    return;
+  }
+
+  const double * r = fMasterToTopRot;
+  const double * t = fMasterToTopTrans;
+  double v[3] = { s*pos.X() - t[0], s*pos.Y() - t[1], s*pos.Z() - t[2] };
+  double d[3] = { udir.X(), udir.Y(), udir.Z() };
+  pos.SetXYZ (r[0]*v[0] + r[3]*v[1] + r[6]*v[2],
+              r[1]*v[0] + r[4]*v[1] + r[7]*v[2],
+              r[2]*v[0] + r[5]*v[1] + r[8]*v[2]);
+  udir.SetXYZ(r[0]*d[0] + r[3]*d[1] + r[6]*d[2],
+              r[1]*d[0] + r[4]*d[1] + r[7]*d[2],
+              r[2]*d[0] + r[5]*d[1] + r[8]*d[2]);
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::Top2SI(TVector3 & pos) const
+{
+/// Same as Top2Master(pos) followed by Local2SI(pos)
+
+  if (fTransformKind == kXformIdentity) return;
+
+  const double s = this->LengthUnits();
+  if (fTransformKind == kXformScale) {
+    pos.SetXYZ(s*pos.X(), s*pos.Y(), s*pos.Z());
+    return;
+  }
+
+  const double * r = fMasterToTopRot;
+  const double * t = fMasterToTopTrans;
+  double v[3] = { pos.X(), pos.Y(), pos.Z() };
+  pos.SetXYZ(s*(r[0]*v[0] + r[1]*v[1] + r[2]*v[2] + t[0]),
+             s*(r[3]*v[0] + r[4]*v[1] + r[5]*v[2] + t[1]),
+             s*(r[6]*v[0] + r[7]*v[1] + r[8]*v[2] + t[2]));
+}
 //___________________________________________________________________________
 void ROOTGeomAnalyzer::Master2TopDir(TVector3 & vec) const
 {
@@ -724,9 +1310,13 @@ void ROOTGeomAnalyzer::Initialize(void)
                 << "Initializing ROOT geometry driver & setting defaults";
 
   fCurrMaxPathLengthList = 0;
-  fCurrPathLengthList    = 0;
-  fCurrPathSegmentList   = 0;
   fGeomVolSelector       = 0;
+  fMasterToTop           = 0;
+  fNavContext            = 0;
+  fVoxelMap              = 0;
+  fVoxelSize             = 0;
+  fRockVolume            = 0;
+  fSegmentCacheGen       = 0;
   fCurrPDGCodeList       = 0;
   fTopVolume             = 0;
   fTopVolumeName         = "";
@@ -737,6 +1327,13 @@ void ROOTGeomAnalyzer::Initialize(void)
   this -> SetScannerNRays      (200);
   this -> SetScannerNParticles (10000);
   this -> SetScannerFlux       (0);
+  this -> SetScannerNThreads   (1);
+  this -> SetScannerBatchSize  (1000);
+  this -> SetScannerConvergence(0);
+  this -> SetScannerFluxKey    ("");
+  this -> SetUseMaxPlCache     (true);
+  this -> SetSegmentCacheSize  (8);
+  this -> SetSegmentCacheTolerance(0.,0.);
   this -> SetMaxPlSafetyFactor (1.1);
   this -> SetLengthUnits       (genie::units::meter);
   this -> SetDensityUnits      (genie::units::kilogram/genie::units::meter3);
@@ -744,6 +1341,7 @@ void ROOTGeomAnalyzer::Initialize(void)
   this -> SetMixtureWeightsSum (-1.);
 
   fMasterToTopIsIdentity = true;
+  this->UpdateTransforms();
 
   fmxddist = 0;
   fmxdstep = 0;
@@ -755,8 +1353,10 @@ void ROOTGeomAnalyzer::CleanUp(void)
 {
   LOG("GROOTGeom", pNOTICE) << "Cleaning up...";
 
-  if ( fCurrPathSegmentList   ) delete fCurrPathSegmentList;
-  if ( fCurrPathLengthList    ) delete fCurrPathLengthList;
+  this->DeleteThreadContext();
+
+  if ( fNavContext            ) delete fNavContext;
+  if ( fVoxelMap              ) delete fVoxelMap;
   if ( fCurrMaxPathLengthList ) delete fCurrMaxPathLengthList;
   if ( fCurrPDGCodeList       ) delete fCurrPDGCodeList;
   if ( fMasterToTop           ) delete fMasterToTop;
@@ -767,6 +1367,8 @@ void ROOTGeomAnalyzer::Load(string filename)
 {
 /// Load the detector geometry from the input ROOT file
 ///
+  InitTimingScope timing("ROOTGeomAnalyzer::Load");
+
   LOG("GROOTGeom", pNOTICE) << "Loading geometry from: " << filename;
 
   bool is_accessible = ! (gSystem->AccessPathName( filename.c_str() ));
@@ -795,14 +1397,16 @@ void ROOTGeomAnalyzer::Load(TGeoManager * gm)
   assert(fGeometry);
 
   this->BuildListOfTargetNuclei();
+  this->BuildMaterialWeights();
 
   const PDGCodeList & pdglist = this->ListOfTargetNuclei();
 
   fTopVolume             = 0;
-  fCurrPathSegmentList   = new PathSegmentList();
-  fCurrPathLengthList    = new PathLengthList(pdglist);
   fCurrMaxPathLengthList = new PathLengthList(pdglist);
-  fCurrVertex            = new TVector3(0.,0.,0.);
+
+  TGeoNavigator * nav = fGeometry->GetCurrentNavigator();
+  if (!nav) nav = fGeometry->AddNavigator();
+  fNavContext = new ROOTGeomNavContext(nav, pdglist);
 
   // ask geometry manager for its top volume
   fTopVolume = fGeometry->GetTopVolume();
@@ -814,6 +1418,7 @@ void ROOTGeomAnalyzer::Load(TGeoManager * gm)
   // load matrix (identity) of top volume
   fMasterToTop = new TGeoHMatrix(*fGeometry->GetCurrentMatrix());
   fMasterToTopIsIdentity = true;
+  this->UpdateTransforms();
 
 //#define PRINT_MATERIALS
 #ifdef PRINT_MATERIALS
@@ -1042,6 +1647,120 @@ double ROOTGeomAnalyzer::GetWeight(const TGeoMixture* mixt, int ielement, int pd
   return weight;
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::BuildMaterialWeights(void)
+{
+/// Tabulate, for each material of the geometry (by material index), the
+/// weights of the targets it contains. The path lengths of all targets are
+/// then accumulated from a swum ray as a sparse sum over the crossed
+/// materials, without expanding the mixtures again.
+/// Rebuilt when the weighting options change: call these setters before
+/// other threads use the analyzer.
+
+  fMatWeights.clear();
+
+  if ( !fCurrPDGCodeList ) return;  // no geometry loaded yet
+
+  TList * material_list = fGeometry->GetListOfMaterials();
+  if ( !material_list ) return;
+
+  const unsigned int ntgt = fCurrPDGCodeList->size();
+
+  TIter next(material_list);
+  TObject * obj = 0;
+  while ( (obj = next()) ) {
+    TGeoMaterial * mat = dynamic_cast <TGeoMaterial *> (obj);
+    if ( !mat ) continue;
+    int mat_indx = mat->GetIndex();
+    if ( mat_indx < 0 ) continue;
+    if ( mat_indx >= (int) fMatWeights.size() ) fMatWeights.resize(mat_indx+1);
+
+    vector< std::pair<int,double> > & wgts = fMatWeights[mat_indx];
+    wgts.clear();
+    for (unsigned int itgt = 0; itgt < ntgt; itgt++) {
+      int pdgc = (*fCurrPDGCodeList)[itgt];
+      // only the targets of the material can have a non-zero weight
+      bool found = false;
+      if (mat->IsMixture()) {
+        const TGeoMixture * mixt = dynamic_cast <const TGeoMixture*> (mat);
+        for (int i = 0; mixt && i < mixt->GetNelements(); i++) {
+          if ( this->GetTargetPdgCode(mixt,i) == pdgc ) { found = true; break; }
+        }
+      } else {
+        found = ( this->GetTargetPdgCode(mat) == pdgc );
+      }
+      if ( !found ) continue;
+      double weight = this->GetWeight(mat,pdgc);
+      if ( weight > 0 ) wgts.push_back(std::make_pair((int)itgt, weight));
+    }
+  }
+
+  LOG("GROOTGeom", pINFO)
+    << "Tabulated the target weights of " << fMatWeights.size()
+    << " materials (" << ntgt << " targets)";
+}
+
+//___________________________________________________________________________
+int ROOTGeomAnalyzer::TargetIndex(int pdgc) const
+{
+/// Position of the input target in ListOfTargetNuclei() (-1 if absent)
+
+  vector<int>::const_iterator it =
+    std::lower_bound(fCurrPDGCodeList->begin(), fCurrPDGCodeList->end(), pdgc);
+  if ( it == fCurrPDGCodeList->end() || *it != pdgc ) return -1;
+  return (int) (it - fCurrPDGCodeList->begin());
+}
+
+//___________________________________________________________________________
+double ROOTGeomAnalyzer::MaterialWeight(const TGeoMaterial * mat, int itgt)
+{
+/// Weight of the itgt-th target in the input material (curr geom density
+/// units), from the table built by BuildMaterialWeights()
+
+  if ( itgt < 0 ) return 0;
+
+  int mat_indx = mat->GetIndex();
+  if ( mat_indx < 0 || mat_indx >= (int) fMatWeights.size() ) {
+    // not a material of the loaded geometry's list
+    return this->GetWeight(mat, (*fCurrPDGCodeList)[itgt]);
+  }
+  const vector< std::pair<int,double> > & wgts = fMatWeights[mat_indx];
+  for (unsigned int i = 0; i < wgts.size(); i++) {
+    if ( wgts[i].first == itgt ) return wgts[i].second;
+  }
+  return 0;
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::AddMaterialPathLengths(
+                              const PathSegmentList & pslist, double * pl)
+{
+/// Add the (weighted) path lengths of the swum ray, in curr geom units, to
+/// the path lengths pl of the targets (ListOfTargetNuclei() order)
+
+  PathSegmentList::MaterialMapCItr_t itr     =
+    pslist.GetMatStepSumMap().begin();
+  PathSegmentList::MaterialMapCItr_t itr_end =
+    pslist.GetMatStepSumMap().end();
+  for ( ; itr != itr_end; ++itr ) {
+    const TGeoMaterial * mat = itr->first;
+    if ( ! mat ) continue;  // segment outside geometry has no material
+    double step = itr->second;
+    int mat_indx = mat->GetIndex();
+    if ( mat_indx < 0 || mat_indx >= (int) fMatWeights.size() ) {
+      // not a material of the loaded geometry's list
+      for (unsigned int itgt = 0; itgt < fCurrPDGCodeList->size(); itgt++) {
+        pl[itgt] += step * this->GetWeight(mat, (*fCurrPDGCodeList)[itgt]);
+      }
+      continue;
+    }
+    const vector< std::pair<int,double> > & wgts = fMatWeights[mat_indx];
+    for (unsigned int i = 0; i < wgts.size(); i++) {
+      pl[wgts[i].first] += step * wgts[i].second;
+    }
+  }
+}
+
 //___________________________________________________________________________
 void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
 {
@@ -1052,7 +1771,6 @@ void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
                << "Computing the maximum path lengths using the FLUX method";
 
   int iparticle = 0;
-  PathLengthList::const_iterator pl_iter;
 
   const int nparticles = abs(this->ScannerNParticles());
 
@@ -1066,43 +1784,52 @@ void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
       << "max path lengths with FLUX method forcing Enu=" << emax;
   }
 
-  while (iparticle < nparticles ) {
-
-    bool ok = fFlux->GenerateNext();
-    if (!ok) {
-       LOG("GROOTGeom", pWARN) << "Couldn't generate a flux neutrino";
-       continue;
-    }
+  // the flux driver is not thread-safe: rays are generated here, in batches,
+  // and only swum through the geometry in parallel
+  const int nthreads = this->ScannerNThreads();
+  if ( nthreads > 1 && !fGeometry->IsMultiThread() ) {
+    this->EnableMultiThreadNavigation(nthreads);
+  }
+  RaySwimPool pool(this, nthreads, *fCurrPDGCodeList);
 
-    TLorentzVector   nup4  = fFlux->Momentum();
-    if ( rescale_e ) {
-      double ecurr = nup4.E();
-      if ( ecurr > 0 ) nup4 *= (emax/ecurr);
-    }
-    const TLorentzVector & nux4  = fFlux->Position();
+  vector<TLorentzVector> batch_x4, batch_p4;
+  int nstalled = 0;
 
-    //LOG("GMCJDriver", pNOTICE)
-    //   << "\n [-] Generated flux neutrino: "
-    //   << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
-    //   << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4);
+  while (iparticle < nparticles ) {
 
-    const PathLengthList & pl = this->ComputePathLengths(nux4, nup4);
+    // a batch never holds more rays than the entering particles still needed,
+    // so (as when swimming one ray at a time) exactly nparticles are used
+    const int nbatch = TMath::Min(TMath::Max(1,fScanBatchSize), nparticles-iparticle);
+    batch_x4.clear();
+    batch_p4.clear();
 
-    bool enters = false;
+    while ( (int)batch_x4.size() < nbatch ) {
+      bool ok = fFlux->GenerateNext();
+      if (!ok) {
+         LOG("GROOTGeom", pWARN) << "Couldn't generate a flux neutrino";
+         continue;
+      }
 
-    for (pl_iter = pl.begin(); pl_iter != pl.end(); ++pl_iter) {
-       int    pdgc       = pl_iter->first;
-       double pathlength = pl_iter->second;
+      TLorentzVector   nup4  = fFlux->Momentum();
+      if ( rescale_e ) {
+        double ecurr = nup4.E();
+        if ( ecurr > 0 ) nup4 *= (emax/ecurr);
+      }
+      batch_x4.push_back(fFlux->Position());
+      batch_p4.push_back(nup4);
+    }
 
-       if ( pathlength > 0 ) {
-          pathlength *= (this->MaxPlSafetyFactor());
+    pool.Swim(batch_x4, batch_p4);
+    iparticle += pool.NEntering();
 
-          pathlength = TMath::Max(pathlength, fCurrMaxPathLengthList->PathLength(pdgc));
-          fCurrMaxPathLengthList->SetPathLength(pdgc,pathlength);
-          enters = true;
-       }
+    bool grew = this->UpdateMaxPathLengths(pool.MaxPathLengths());
+    nstalled = (grew) ? 0 : nstalled+1;
+    if ( fNScanConvergeBatches > 0 && nstalled >= fNScanConvergeBatches ) {
+      LOG("GROOTGeom", pNOTICE)
+        << "Max path lengths converged after " << iparticle << " particles ("
+        << nstalled << " batches without change)";
+      break;
     }
-    if (enters) iparticle++;  
   }
 }
 
@@ -1120,32 +1847,56 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
 #endif
 
   int  iparticle = 0;
-  bool ok = true;
   TLorentzVector nux4;
   TLorentzVector nup4;
 
-  PathLengthList::const_iterator pl_iter;
+  // rays are generated here, in batches, and swum through the geometry
+  // in parallel
+  const int nthreads = this->ScannerNThreads();
+  if ( nthreads > 1 && !fGeometry->IsMultiThread() ) {
+    this->EnableMultiThreadNavigation(nthreads);
+  }
+  RaySwimPool pool(this, nthreads, *fCurrPDGCodeList);
 
-  while ( (ok = this->GenBoxRay(iparticle++,nux4,nup4)) ) {
+  vector<TLorentzVector> batch_x4, batch_p4;
+  int nstalled = 0;
 
-    //LOG("GMCJDriver", pNOTICE)
-    //  << "\n [-] Generated flux neutrino: "
-    //  << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
-    //  << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4);
+  // batches never span two box faces: convergence is tested face by face,
+  // as each face sees the geometry from a different side
+  bool ok = this->GenBoxRay(iparticle++,nux4,nup4);
+  while ( ok ) {
 
-    const PathLengthList & pllst = this->ComputePathLengths(nux4, nup4);
+    const int face = fiface;
+    batch_x4.clear();
+    batch_p4.clear();
+    while ( ok && fiface == face && (int)batch_x4.size() < TMath::Max(1,fScanBatchSize) ) {
 
-    for (pl_iter = pllst.begin(); pl_iter != pllst.end(); ++pl_iter) {
-       int    pdgc = pl_iter->first;
-       double pl   = pl_iter->second;
+      //LOG("GMCJDriver", pNOTICE)
+      //  << "\n [-] Generated flux neutrino: "
+      //  << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
+      //  << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4);
 
-       if (pl>0) {
-          pl *= (this->MaxPlSafetyFactor());
+      batch_x4.push_back(nux4);
+      batch_p4.push_back(nup4);
+      ok = this->GenBoxRay(iparticle++,nux4,nup4);
+    }
 
-          pl = TMath::Max(pl, fCurrMaxPathLengthList->PathLength(pdgc));
-          fCurrMaxPathLengthList->SetPathLength(pdgc,pl);
-       }
+    pool.Swim(batch_x4, batch_p4);
+
+    bool grew = this->UpdateMaxPathLengths(pool.MaxPathLengths());
+    nstalled = (grew) ? 0 : nstalled+1;
+    if ( fNScanConvergeBatches > 0 && nstalled >= fNScanConvergeBatches ) {
+      LOG("GROOTGeom", pNOTICE)
+        << "Max path lengths converged on box face " << face << " after "
+        << iparticle << " rays (" << nstalled << " batches without change)";
+      if ( ok && fiface == face ) {
+        // skip the rest of this face
+        fipoint = fNPoints;
+        firay   = fNRays;
+        ok = this->GenBoxRay(iparticle++,nux4,nup4);
+      }
     }
+    if ( fiface != face ) nstalled = 0;
   }
 
   // print out the results
@@ -1178,6 +1929,201 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
 
 }
 
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::UpdateMaxPathLengths(const PathLengthList & pl)
+{
+/// Update the max path lengths with the (unscaled) path lengths of the input
+/// list. Returns true if the maximum grew for any material.
+
+  bool grew = false;
+
+  PathLengthList::const_iterator pl_iter;
+  for (pl_iter = pl.begin(); pl_iter != pl.end(); ++pl_iter) {
+     int    pdgc       = pl_iter->first;
+     double pathlength = pl_iter->second;
+
+     if ( pathlength > 0 ) {
+        pathlength *= (this->MaxPlSafetyFactor());
+
+        if ( pathlength > fCurrMaxPathLengthList->PathLength(pdgc) ) {
+          fCurrMaxPathLengthList->SetPathLength(pdgc,pathlength);
+          grew = true;
+        }
+     }
+  }
+  return grew;
+}
+
+//___________________________________________________________________________
+string ROOTGeomAnalyzer::MaxPlCacheKey(void) const
+{
+/// Hash of everything the max path lengths depend on: the geometry content
+/// below the top volume, units & weighting options, the volume selector and
+/// the scanning method. Returns "" if the max path lengths can't be
+/// identified (scanning with a flux that was given no description).
+
+  if ( !fGeometry || !fTopVolume ) return "";
+  if ( fFlux && fScanFluxKey.size() == 0 ) return "";
+
+  Fnv1aHash hash;
+
+  // options
+  ostringstream opts;
+  opts << std::setprecision(17)
+       << "top: " << fTopVolumeName
+       << " lunits: " << fLengthScale << " dunits: " << fDensityScale
+       << " densweight: " << fDensWeight << " mixtwghtsum: " << fMixtWghtSum
+       << " safety: " << fMaxPlSafetyFactor << ";";
+  if ( fFlux ) {
+    opts << " flux: " << fScanFluxKey << " nparticles: " << fNParticles << ";";
+  } else {
+    opts << " box: " << fNPoints << " x " << fNRays << ";";
+  }
+  opts << " converge: " << fNScanConvergeBatches 
+       << " batch: " << fScanBatchSize << ";";
+  // approximate / analytic swimming
+  opts << " voxel: " << fVoxelSize << ";";
+  if ( fRockVolume ) {
+    opts << " rock: " << fRockVolume->GetName();
+    for(int i = 0; i < 3; i++) opts << " " << fRockHallMin[i] << " " << fRockHallMax[i];
+    opts << ";";
+  }
+  if ( fGeomVolSelector ) fGeomVolSelector->PrintConfig(opts);
+  hash.Add(opts.str());
+
+  // master -> top volume transformation
+  hash.Add((const char *) fMasterToTop->GetTranslation(),    3*sizeof(Double_t));
+  hash.Add((const char *) fMasterToTop->GetRotationMatrix(), 9*sizeof(Double_t));
+
+  // materials
+  TIter mnext(fGeometry->GetListOfMaterials());
+  TGeoMaterial * mat = 0;
+  while ( (mat = (TGeoMaterial *) mnext()) ) {
+    ostringstream mstr;
+    mstr << std::setprecision(17) << mat->GetName() << " " << mat->GetDensity();
+    if ( mat->IsMixture() ) {
+      TGeoMixture * mixt = dynamic_cast <TGeoMixture*> (mat);
+      for (int i = 0; i < mixt->GetNelements(); i++) {
+        mstr << " " << mixt->GetZmixt()[i] << " " << mixt->GetAmixt()[i]
+             << " " << mixt->GetWmixt()[i];
+      }
+    } else {
+      mstr << " " << mat->GetZ() << " " << mat->GetA();
+    }
+    hash.Add(mstr.str());
+  }
+
+  // volume tree (each volume's shape & medium hashed once)
+  std::set<const TGeoVolume *> hashed;
+  TBufferFile buf(TBuffer::kWrite);
+  TGeoIterator next(fTopVolume);
+  const TGeoVolume * vol = fTopVolume;
+  TGeoNode * node = 0;
+  do {
+    if ( node ) {
+      ostringstream nstr;
+      nstr << next.GetLevel() << " " << node->GetName();
+      hash.Add(nstr.str());
+      const TGeoMatrix * m = node->GetMatrix();
+      hash.Add((const char *) m->GetTranslation(),    3*sizeof(Double_t));
+      hash.Add((const char *) m->GetRotationMatrix(), 9*sizeof(Double_t));
+      vol = node->GetVolume();
+    }
+    if ( hashed.insert(vol).second ) {
+      hash.Add(vol->GetName());
+      const TGeoMedium * med = vol->GetMedium();
+      if ( med && med->GetMaterial() ) hash.Add(med->GetMaterial()->GetName());
+      buf.Reset();
+      buf.ResetMap();
+      vol->GetShape()->Streamer(buf);
+      hash.Add(buf.Buffer(), buf.Length());
+    }
+  } while ( (node = next()) );
+
+  return hash.AsString();
+}
+//___________________________________________________________________________
+string ROOTGeomAnalyzer::MaxPlCacheFile(void) const
+{
+/// The max path lengths cache file for the current setup ("" if none).
+/// The cache directory is $GENIE_MAXPL_CACHE if set (caching is disabled if
+/// it is set but empty), else $XDG_CACHE_HOME/genie/maxpl, else
+/// $HOME/.cache/genie/maxpl
+
+  string dir;
+  const char * env = gSystem->Getenv("GENIE_MAXPL_CACHE");
+  if ( env ) {
+    dir = env;
+  } else if ( (env = gSystem->Getenv("XDG_CACHE_HOME")) && strlen(env) > 0 ) {
+    dir = string(env) + "/genie/maxpl";
+  } else if ( (env = gSystem->Getenv("HOME")) && strlen(env) > 0 ) {
+    dir = string(env) + "/.cache/genie/maxpl";
+  }
+  if ( dir.size() == 0 ) return "";
+
+  string key = this->MaxPlCacheKey();
+  if ( key.size() == 0 ) {
+    LOG("GROOTGeom", pNOTICE)
+      << "Max path lengths can't be cached: no description of the scanning flux";
+    return "";
+  }
+
+  return dir + "/maxpl_" + key + ".xml";
+}
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::ReadMaxPlCache(string filename)
+{
+  if ( gSystem->AccessPathName(filename.c_str()) ) return false;
+
+  PathLengthList cached;
+  if ( cached.LoadFromXml(filename) != kXmlOK ) {
+    LOG("GROOTGeom", pWARN)
+      << "Can not read the cached max path lengths from " << filename;
+    return false;
+  }
+  PDGCodeList::const_iterator itr;
+  for (itr = fCurrPDGCodeList->begin(); itr != fCurrPDGCodeList->end(); ++itr) {
+    if ( cached.find(*itr) == cached.end() ) {
+      LOG("GROOTGeom", pWARN)
+        << "Cached max path lengths in " << filename 
+        << " have no entry for target: " << *itr << " - Recomputing them";
+      return false;
+    }
+  }
+  for (itr = fCurrPDGCodeList->begin(); itr != fCurrPDGCodeList->end(); ++itr) {
+    fCurrMaxPathLengthList->SetPathLength(*itr, cached.PathLength(*itr));
+  }
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Reusing the cached max path lengths from " << filename;
+  return true;
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::WriteMaxPlCache(string filename) const
+{
+  string dir = gSystem->DirName(filename.c_str());
+  gSystem->mkdir(dir.c_str(), true);
+  if ( gSystem->AccessPathName(dir.c_str(), kWritePermission) ) {
+    LOG("GROOTGeom", pWARN)
+      << "Can not write max path lengths to cache directory " << dir;
+    return;
+  }
+
+  // write under a temporary name first so that concurrent jobs never see
+  // a partially written file
+  ostringstream tmpname;
+  tmpname << filename << ".tmp" << gSystem->GetPid();
+  fCurrMaxPathLengthList->SaveAsXml(tmpname.str());
+  if ( gSystem->Rename(tmpname.str().c_str(), filename.c_str()) != 0 ) {
+    LOG("GROOTGeom", pWARN)
+      << "Can not write max path lengths to cache file " << filename;
+    gSystem->Unlink(tmpname.str().c_str());
+    return;
+  }
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Saved the max path lengths to cache file " << filename;
+}
 //___________________________________________________________________________
 bool ROOTGeomAnalyzer::GenBoxRay(int indx, TLorentzVector& x4, TLorentzVector& p4)
 {
@@ -1372,21 +2318,23 @@ double ROOTGeomAnalyzer::ComputePathLengthPDG(
 
   double step   = 0;
   double weight = 0;
+  int    itgt   = this->TargetIndex(pdgc);
 
   //  const TGeoVolume   * vol = 0;
   //  const TGeoMedium   * med = 0;
   const TGeoMaterial * mat = 0;
 
   // loop over independent materials, which is shorter or equal to # of volumes
+  const PathSegmentList * pslist = this->NavContext()->fPathSegmentList;
   PathSegmentList::MaterialMapCItr_t itr     = 
-    fCurrPathSegmentList->GetMatStepSumMap().begin();
+    pslist->GetMatStepSumMap().begin();
   PathSegmentList::MaterialMapCItr_t itr_end = 
-    fCurrPathSegmentList->GetMatStepSumMap().end();
+    pslist->GetMatStepSumMap().end();
   for ( ; itr != itr_end; ++itr ) {
     mat  = itr->first;
     if ( ! mat ) continue;  // segment outside geometry has no material
     step = itr->second;
-    weight = this->GetWeight(mat,pdgc);
+    weight = this->MaterialWeight(mat,itgt);
     pl += (step*weight);
   }
 
@@ -1407,16 +2355,23 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 
   int nvolswim = 0; //rwh
 
-  if ( ! fCurrPathSegmentList ) fCurrPathSegmentList = new PathSegmentList();
+  ROOTGeomNavContext * ctx = this->NavContext();
+  TGeoNavigator * nav = ctx->fNavigator;
 
-  // don't swim if the current PathSegmentList is up-to-date
-  if ( fCurrPathSegmentList->IsSameStart(r0,udir) ) return;
+  // don't swim if the current PathSegmentList, or a recent one, is up-to-date
+  if ( this->UseCachedSegments(ctx,r0,udir) ) return;
 
   // start fresh
-  fCurrPathSegmentList->SetAllToZero();
+  ctx->fPathSegmentList->SetAllToZero();
 
   // set start info so next time we don't swim for the same ray 
-  fCurrPathSegmentList->SetStartInfo(r0,udir);
+  ctx->fPathSegmentList->SetStartInfo(r0,udir);
+
+  // no need to swim rays that the volume selector would reject entirely
+  if ( fGeomVolSelector && fGeomVolSelector->RejectsRay(r0,udir) ) {
+    ctx->fPathSegmentList->FillMatStepSum();
+    return;
+  }
  
   PathSegment ps_curr;
 
@@ -1440,38 +2395,51 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
     << "] udir [" << udir[0] << "," << udir[1] << "," << udir[2];
 #endif
 
-  fGeometry -> SetCurrentDirection (udir[0],udir[1],udir[2]);
-  fGeometry -> SetCurrentPoint     (r0[0],  r0[1],  r0[2]  );
+  if (fRockVolume && !fill_path) {
+    // cross the rock analytically, swim only inside the hall box
+    this->SwimAnalyticRock(r0,udir);
+    found_vol = true;
+    keep_on   = false;
+  }
+  else if (fVoxelSize > 0 && !fill_path && this->BuildVoxelMap()) {
+    // swim through the voxel map instead
+    this->SwimVoxels(r0,udir);
+    found_vol = true;
+    keep_on   = false;
+  }
+
+  nav -> SetCurrentDirection (udir[0],udir[1],udir[2]);
+  nav -> SetCurrentPoint     (r0[0],  r0[1],  r0[2]  );
 
   while (!found_vol || keep_on) {
      keep_on = true;
 
-     fGeometry->FindNode();
+     nav->FindNode();
 
-     ps_curr.SetEnter( fGeometry->GetCurrentPoint() , raydist );
-     vol = fGeometry->GetCurrentVolume();
+     ps_curr.SetEnter( nav->GetCurrentPoint() , raydist );
+     vol = nav->GetCurrentVolume();
      med = vol->GetMedium();
      mat = med->GetMaterial();
      ps_curr.SetGeo(vol,med,mat);
 #ifdef PATHSEG_KEEP_PATH
-     if (fill_path) ps_curr.SetPath(fGeometry->GetPath());
+     if (fill_path) ps_curr.SetPath(nav->GetPath());
 #endif
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 #ifdef DUMP_SWIM
        LOG("GROOTGeom", pDEBUG) << "Current volume: " << vol->GetName()
-                             << " pos " << fGeometry->GetCurrentPoint()[0]
-                             << " "     << fGeometry->GetCurrentPoint()[1]
-                             << " "     << fGeometry->GetCurrentPoint()[2]
-                             << " dir " << fGeometry->GetCurrentDirection()[0]
-                             << " "     << fGeometry->GetCurrentDirection()[1]
-                             << " "     << fGeometry->GetCurrentDirection()[2]
-                             << "[path: " << fGeometry->GetPath() << "]";
+                             << " pos " << nav->GetCurrentPoint()[0]
+                             << " "     << nav->GetCurrentPoint()[1]
+                             << " "     << nav->GetCurrentPoint()[2]
+                             << " dir " << nav->GetCurrentDirection()[0]
+                             << " "     << nav->GetCurrentDirection()[1]
+                             << " "     << nav->GetCurrentDirection()[2]
+                             << "[path: " << nav->GetPath() << "]";
 #endif
 #endif
 
      // find the start of top
-     if (fGeometry->IsOutside() || !vol) {
+     if (nav->IsOutside() || !vol) {
         keep_on = false;
         if (found_vol) break;
         step = 0;
@@ -1485,7 +2453,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 #endif
 #endif
 
-        while (!fGeometry->IsEntering()) {
+        while (!nav->IsEntering()) {
           step = this->Step();
           raydist += step;
 #ifdef RWH_DEBUG
@@ -1511,12 +2479,12 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
                   << " p [" << udir[0] << "," << udir[1] << "," << udir[2] << "]";
             }
 #endif
-            fCurrPathSegmentList->SetAllToZero();            
+            ctx->fPathSegmentList->SetAllToZero();            
             return;
           }
         } // finished while
 
-        ps_curr.SetExit(fGeometry->GetCurrentPoint());
+        ps_curr.SetExit(nav->GetCurrentPoint());
         ps_curr.SetStep(step);
         if ( ( fDebugFlags & 0x10 ) ) {
           // In general don't add the path segments from the start point to
@@ -1525,7 +2493,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
           ps_curr.fStepRangeSet.clear();
           LOG("GROOTGeom", pNOTICE)
             << "debug: step towards top volume: " << ps_curr;
-          fCurrPathSegmentList->AddSegment(ps_curr);
+          ctx->fPathSegmentList->AddSegment(ps_curr);
         }
 
      }  // outside or !vol
@@ -1536,9 +2504,9 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
        step   = this->StepUntilEntering();
        raydist += step;
 
-       ps_curr.SetExit(fGeometry->GetCurrentPoint());
+       ps_curr.SetExit(nav->GetCurrentPoint());
        ps_curr.SetStep(step);
-       fCurrPathSegmentList->AddSegment(ps_curr);
+       ctx->fPathSegmentList->AddSegment(ps_curr);
 
        nvolswim++; //rwh
 
@@ -1561,7 +2529,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
     nswims[curface]++;   //rwh
     dnvols[curface]  += (double)nvolswim;
     dnvols2[curface] += (double)nvolswim * (double)nvolswim;
-    long int ns = fCurrPathSegmentList->size();
+    long int ns = ctx->fPathSegmentList->size();
     if ( ns > mxsegments ) mxsegments = ns;
   }
 #endif
@@ -1569,15 +2537,15 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 //rwh:debug
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GROOTGeom", pDEBUG)
-    << "PathSegmentList size " << fCurrPathSegmentList->size();
+    << "PathSegmentList size " << ctx->fPathSegmentList->size();
 #endif
 
 #ifdef RWH_DEBUG_2
   if ( ( fDebugFlags & 0x20 ) ) {
-    fCurrPathSegmentList->SetDoCrossCheck(true);       //RWH
-    LOG("GROOTGeom", pNOTICE) << "Before trimming" << *fCurrPathSegmentList;
+    ctx->fPathSegmentList->SetDoCrossCheck(true);       //RWH
+    LOG("GROOTGeom", pNOTICE) << "Before trimming" << *ctx->fPathSegmentList;
     double mxddist = 0, mxdstep = 0;
-    fCurrPathSegmentList->CrossCheck(mxddist,mxdstep);
+    ctx->fPathSegmentList->CrossCheck(mxddist,mxdstep);
     fmxddist = TMath::Max(fmxddist,mxddist);
     fmxdstep = TMath::Max(fmxdstep,mxdstep);
   }
@@ -1586,20 +2554,20 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
   // PathSegmentList trimming occurs here!
   if ( fGeomVolSelector ) {
     PathSegmentList* altlist = 
-      fGeomVolSelector->GenerateTrimmedList(fCurrPathSegmentList);
-    std::swap(altlist,fCurrPathSegmentList);
+      fGeomVolSelector->GenerateTrimmedList(ctx->fPathSegmentList);
+    std::swap(altlist,ctx->fPathSegmentList);
     delete altlist;  // after swap delete original
   }
 
-  fCurrPathSegmentList->FillMatStepSum();
+  ctx->fPathSegmentList->FillMatStepSum();
 
 #ifdef RWH_DEBUG_2
   if ( fGeomVolSelector) { 
     // after FillMatStepSum() so one can see the summed mass
     if ( ( fDebugFlags & 0x40 ) ) {
-      fCurrPathSegmentList->SetPrintVerbose(true);
-      LOG("GROOTGeom", pNOTICE) << "After  trimming" << *fCurrPathSegmentList;
-      fCurrPathSegmentList->SetPrintVerbose(false);
+      ctx->fPathSegmentList->SetPrintVerbose(true);
+      LOG("GROOTGeom", pNOTICE) << "After  trimming" << *ctx->fPathSegmentList;
+      ctx->fPathSegmentList->SetPrintVerbose(false);
     }
   }
 #endif
@@ -1608,10 +2576,176 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
   return;
 }
 
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::UseCachedSegments(
+     ROOTGeomNavContext * ctx, const TVector3 & r0, const TVector3 & udir)
+{
+/// Make the path-segment list of the input ray (top vol coord & units) the
+/// current one if it was swum recently. Otherwise move the current list to
+/// the cache, recycling the least recently used one for the ray to be swum.
+
+  std::list<PathSegmentList *> & cache = ctx->fSegmentCache;
+
+  // forget the lists swum before a change of settings
+  if ( ctx->fSegmentCacheGen != fSegmentCacheGen ) {
+    std::list<PathSegmentList *>::iterator it = cache.begin();
+    for( ; it != cache.end(); ++it) delete *it;
+    cache.clear();
+    ctx->fPathSegmentList->SetStartInfo();
+    ctx->fSegmentCacheGen = fSegmentCacheGen;
+  }
+
+  const double postol = fSegmentCachePosTol / this->LengthUnits();
+  const double dirtol = fSegmentCacheDirTol;
+
+  if ( ctx->fPathSegmentList->IsSameStart(r0,udir,postol,dirtol) ) return true;
+
+  std::list<PathSegmentList *>::iterator it = cache.begin();
+  for( ; it != cache.end(); ++it) {
+    if ( (*it)->IsSameStart(r0,udir,postol,dirtol) ) {
+      PathSegmentList * hit = *it;
+      cache.erase(it);
+      cache.push_front(ctx->fPathSegmentList);
+      ctx->fPathSegmentList = hit;
+      return true;
+    }
+  }
+
+  // keep the current list, unless it was never filled
+  if ( fSegmentCacheSize > 0 && ctx->fPathSegmentList->GetDirection().Mag2() > 0 ) {
+    cache.push_front(ctx->fPathSegmentList);
+    if ( (int)cache.size() > fSegmentCacheSize ) {
+      ctx->fPathSegmentList = cache.back();
+      cache.pop_back();
+    } else {
+      ctx->fPathSegmentList = new PathSegmentList();
+    }
+  }
+  return false;
+}
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::BuildVoxelMap(void)
+{
+/// Build the voxel map of the top volume, if not built already.
+/// Returns false if no voxel map could be built.
+
+  std::lock_guard<std::mutex> lock(gVoxelMapLock);
+
+  if (!fVoxelMap) {
+    fVoxelMap = new GeomVoxelMap;
+    TGeoNavigator * nav = this->NavContext()->fNavigator;
+    bool ok = fVoxelMap->Build(nav, fTopVolume,
+                               fVoxelSize/this->LengthUnits(), kMaxVoxels);
+    if (!ok) {
+      LOG("GROOTGeom", pWARN)
+         << "Could not build the voxel map; swimming without it";
+    }
+  }
+  return fVoxelMap->IsBuilt();
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SwimVoxels(const TVector3 & r0, const TVector3 & udir)
+{
+/// Swim through the voxel map from the input position r0 (top vol coord &
+/// units) along the unit vector udir (top vol coord), filling the current
+/// PathSegmentList. Uniform voxels are crossed in a single step; the ray
+/// is stepped through the geometry only inside mixed voxels.
+
+  ROOTGeomNavContext * ctx = this->NavContext();
+  TGeoNavigator * nav = ctx->fNavigator;
+  const GeomVoxelMap & vmap = *fVoxelMap;
+
+  double t = 0, tmax = 0;
+  if (!vmap.Clip(r0, udir, t, tmax)) return;
+
+  const int      nvox[3] = { vmap.NX(), vmap.NY(), vmap.NZ() };
+  const TVector3 & low   = vmap.Low();
+  const TVector3 & width = vmap.Width();
+
+  // voxel containing the entry point & distances to the next voxel planes
+  int    ijk[3], istep[3];
+  double tnext[3], tdelta[3];
+  TVector3 entry = r0 + t*udir;
+  for(int a = 0; a < 3; a++) {
+    int i = (int) TMath::Floor((entry[a] - low[a]) / width[a]);
+    ijk[a] = TMath::Min(TMath::Max(i,0), nvox[a]-1);
+    if (udir[a] > 0) {
+      istep [a] = 1;
+      tnext [a] = (low[a] + (ijk[a]+1)*width[a] - r0[a]) / udir[a];
+      tdelta[a] = width[a] / udir[a];
+    } else if (udir[a] < 0) {
+      istep [a] = -1;
+      tnext [a] = (low[a] + ijk[a]*width[a] - r0[a]) / udir[a];
+      tdelta[a] = -width[a] / udir[a];
+    } else {
+      istep [a] = 0;
+      tnext [a] = 1e30;
+      tdelta[a] = 1e30;
+    }
+  }
+
+  VoxelSegmentBuilder segments(ctx->fPathSegmentList, r0, udir);
+
+  while (t < tmax) {
+    int a = (tnext[0] < tnext[1]) ? 0 : 1;
+    if (tnext[2] < tnext[a]) a = 2;
+    double texit = TMath::Min(tnext[a], tmax);
+
+    int code = vmap.Code(ijk[0], ijk[1], ijk[2]);
+    if (code >= 0) {
+      segments.Add(vmap.Volume(code), t, texit);
+    }
+    else if (code == GeomVoxelMap::kOutside) {
+      segments.Flush();
+    }
+    else {
+      // mixed voxel: step exactly through the geometry up to the voxel exit
+      segments.Step(nav, t, texit);
+    }
+
+    t = texit;
+    ijk[a] += istep[a];
+    if (ijk[a] < 0 || ijk[a] >= nvox[a]) break;
+    tnext[a] += tdelta[a];
+  }
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SwimAnalyticRock(const TVector3 & r0, const TVector3 & udir)
+{
+/// Swim from the input position r0 (top vol coord & units) along the unit
+/// vector udir (top vol coord), filling the current PathSegmentList: the top
+/// volume outside the hall box is crossed as a single rock volume, the ray
+/// is stepped through the geometry only inside the hall box.
+
+  ROOTGeomNavContext * ctx = this->NavContext();
+
+  const TGeoBBox * box = (const TGeoBBox *) fTopVolume->GetShape();
+  const Double_t * origin = box->GetOrigin();
+  double toplo[3] = { origin[0] - box->GetDX(), origin[1] - box->GetDY(), origin[2] - box->GetDZ() };
+  double tophi[3] = { origin[0] + box->GetDX(), origin[1] + box->GetDY(), origin[2] + box->GetDZ() };
+
+  double tin = 0, tout = 0;
+  if (!ClipToBox(r0, udir, toplo, tophi, tin, tout)) return;  // never enters
+
+  VoxelSegmentBuilder segments(ctx->fPathSegmentList, r0, udir);
+
+  double hin = 0, hout = 0;
+  if (!ClipToBox(r0, udir, fRockHallMin, fRockHallMax, hin, hout)) {
+    segments.Add(fRockVolume, tin, tout);
+    return;
+  }
+  hin  = TMath::Max(hin,  tin);
+  hout = TMath::Min(hout, tout);
+
+  segments.Add (fRockVolume, tin, hin);
+  segments.Step(ctx->fNavigator, hin, hout);
+  segments.Add (fRockVolume, hout, tout);
+}
 //___________________________________________________________________________
 bool ROOTGeomAnalyzer::FindMaterialInCurrentVol(int tgtpdg)
 {
-  TGeoVolume * vol = fGeometry -> GetCurrentVolume();
+  TGeoNavigator * nav = this->NavContext()->fNavigator;
+  TGeoVolume * vol = nav -> GetCurrentVolume();
   if(vol) {
     TGeoMaterial * mat = vol->GetMedium()->GetMaterial();
     if(mat->IsMixture()) {
@@ -1633,31 +2767,35 @@ bool ROOTGeomAnalyzer::FindMaterialInCurrentVol(int tgtpdg)
 //___________________________________________________________________________
 double ROOTGeomAnalyzer::StepToNextBoundary(void)
 {
-  fGeometry->FindNextBoundary();
-  double step=fGeometry->GetStep();
+  TGeoNavigator * nav = this->NavContext()->fNavigator;
+  nav->FindNextBoundary();
+  double step=nav->GetStep();
   return step;
 }
 //___________________________________________________________________________
 double ROOTGeomAnalyzer::Step(void)
 {
-  fGeometry->Step();
-  double step=fGeometry->GetStep();
+  TGeoNavigator * nav = this->NavContext()->fNavigator;
+  nav->Step();
+  double step=nav->GetStep();
   return step;
 }
 //___________________________________________________________________________
 double ROOTGeomAnalyzer::StepUntilEntering(void)
 {
+  TGeoNavigator * nav = this->NavContext()->fNavigator;
+
   this->StepToNextBoundary();  // doesn't actually step, so don't include in sum
   double step = 0; // 
 
-  while(!fGeometry->IsEntering()) {
+  while(!nav->IsEntering()) {
     step += this->Step();
   }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 
-  bool isen = fGeometry->IsEntering();
-  bool isob = fGeometry->IsOnBoundary();
+  bool isen = nav->IsEntering();
+  bool isob = nav->IsOnBoundary();
 
   LOG("GROOTGeom",pDEBUG)
       << "IsEntering = "     << utils::print::BoolAsYNString(isen)
@@ -1688,3 +2826,63 @@ bool ROOTGeomAnalyzer::WillNeverEnter(double step)
 }
 
 //___________________________________________________________________________
+void ROOTGeomAnalyzer::EnableMultiThreadNavigation(int nthreads)
+{
+/// Prepare the (closed) geometry for concurrent navigation by up to nthreads
+/// threads. From then on the TGeoManager must not be modified: each thread
+/// navigates it through its own TGeoNavigator, path-segment list and vertex.
+
+  if (!fGeometry) {
+      LOG("GROOTGeom", pFATAL) << "No ROOT geometry is loaded!!";
+      exit(1);
+  }
+  if (!fGeometry->IsClosed()) {
+      LOG("GROOTGeom", pFATAL)
+        << "The geometry must be closed before enabling multi-threaded navigation";
+      exit(1);
+  }
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Enabling geometry navigation by up to " << nthreads << " threads";
+
+  fGeometry->SetMaxThreads(nthreads);
+
+  // navigators are now kept per thread: get the one of the calling thread
+  TGeoNavigator * nav = fGeometry->GetCurrentNavigator();
+  if (!nav) nav = fGeometry->AddNavigator();
+  fNavContext->fNavigator = nav;
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::DeleteThreadContext(void)
+{
+/// Release the navigation context of the calling thread (if any). This is
+/// done automatically when the thread exits.
+
+  NavContextMap::iterator it = gThreadNavContexts.find(this);
+  if (it == gThreadNavContexts.end()) return;
+  delete it->second;
+  gThreadNavContexts.erase(it);
+}
+//___________________________________________________________________________
+ROOTGeomNavContext * ROOTGeomAnalyzer::NavContext(void)
+{
+/// The navigation context of the calling thread
+
+  if (!fGeometry || !fGeometry->IsMultiThread()) return fNavContext;
+
+  ROOTGeomNavContext *& ctx = gThreadNavContexts[this];
+  if (!ctx) ctx = this->CreateNavContext();
+  return ctx;
+}
+//___________________________________________________________________________
+ROOTGeomNavContext * ROOTGeomAnalyzer::CreateNavContext(void)
+{
+  TGeoNavigator * nav = fGeometry->GetCurrentNavigator();
+  if (!nav) nav = fGeometry->AddNavigator();
+
+  LOG("GROOTGeom", pINFO)
+    << "Created geometry navigator for thread " << TGeoManager::ThreadId();
+
+  return new ROOTGeomNavContext(nav, *fCurrPDGCodeList);
+}
+//___________________________________________________________________________
@@ -21,6 +21,9 @@
 #define _ROOT_GEOMETRY_ANALYZER_H_
 
 #include <string>
+#include <list>
+#include <vector>
+#include <utility>
 #include <algorithm>
 
 #include <TGeoManager.h>
@@ -34,6 +37,7 @@ class TGeoMaterial;
 class TGeoMixture;
 class TGeoElement;
 class TGeoHMatrix;
+class TGeoNavigator;
 
 using std::string;
 
@@ -45,6 +49,29 @@ namespace geometry {
 
 class PathSegmentList;
 class GeomVolSelectorI;
+class GeomVoxelMap;
+
+/// Navigation state that is modified while swimming a ray through the
+/// geometry. Each thread using a ROOTGeomAnalyzer gets its own, so that
+/// several threads can navigate the same (shared, immutable) TGeoManager.
+class ROOTGeomNavContext {
+public:
+  ROOTGeomNavContext(TGeoNavigator * nav, const PDGCodeList & pdglist);
+ ~ROOTGeomNavContext();
+
+  TGeoNavigator *   fNavigator;        ///< this thread's navigator (owned by the TGeoManager)
+  PathSegmentList * fPathSegmentList;  ///< current list of path-segments
+  PathLengthList *  fPathLengthList;   ///< current list of path-lengths
+  TVector3 *        fVertex;           ///< current generated vertex
+
+  std::list<PathSegmentList *> fSegmentCache;  ///< recently swum path-segment lists (owned), most recent first
+  std::vector<double> fTargetPl;     ///< path length per target (ListOfTargetNuclei() order), scratch
+  unsigned long     fSegmentCacheGen;  ///< generation of the analyzer settings the cached lists were swum with
+
+private:
+  ROOTGeomNavContext(const ROOTGeomNavContext &);
+  ROOTGeomNavContext & operator = (const ROOTGeomNavContext &);
+};
 
 class ROOTGeomAnalyzer : public GeomAnalyzerI {
 
@@ -61,6 +88,9 @@ public :
 
   virtual const  PathLengthList & ComputePathLengths(const TLorentzVector & x, 
                                                      const TLorentzVector & p);
+  virtual void                    ComputePathLengths(const std::vector<TLorentzVector> & x,
+                                                     const std::vector<TLorentzVector> & p,
+                                                     std::vector<double> & pl);
   virtual const  TVector3 &       GenerateVertex(const TLorentzVector & x, 
                                                  const TLorentzVector & p, int tgtpdg);
 
@@ -70,7 +100,12 @@ public :
   virtual void SetScannerNRays      (int    nr) { fNRays      = nr; } /* box  scanner */
   virtual void SetScannerNParticles (int    np) { fNParticles = np; } /* flux scanner */
   virtual void SetScannerFlux       (GFluxI* f) { fFlux       = f;  } /* flux scanner */
-  virtual void SetWeightWithDensity (bool   wt) { fDensWeight = wt; }
+  virtual void SetScannerNThreads   (int    nt) { fNScanThreads = nt; } /* both scanners */
+  virtual void SetScannerBatchSize  (int    nb) { fScanBatchSize = nb; } /* both scanners */
+  virtual void SetScannerConvergence(int    nk) { fNScanConvergeBatches = nk; } /* both scanners */
+  virtual void SetScannerFluxKey    (string key) { fScanFluxKey = key; } /* flux scanner: identifies flux & window for the max pl cache */
+  virtual void SetUseMaxPlCache     (bool  use) { fUseMaxPlCache = use; }
+  virtual void SetWeightWithDensity (bool   wt);
   virtual void SetMixtureWeightsSum (double sum);
   virtual void SetLengthUnits       (double lu);
   virtual void SetDensityUnits      (double du);
@@ -78,12 +113,21 @@ public :
   virtual void SetTopVolName        (string nm);
   virtual void SetKeepSegPath       (bool keep) { fKeepSegPath = keep; }
   virtual void SetDebugFlags        (int  flgs) { fDebugFlags  = flgs; }
+  virtual void SetVoxelSize         (double size); /* voxel map (SI units), <=0: no voxel map */
+  virtual void SetSegmentCacheSize  (int n);
+  virtual void SetAnalyticRock      (string rockvol, const double * xyzmin, const double * xyzmax);
+  virtual void SetSegmentCacheTolerance (double postol, double dirtol); /* postol in SI units */
 
   /// retrieve geometry driver's configuration options
 
   virtual int           ScannerNPoints    (void) const { return fNPoints;           }
   virtual int           ScannerNRays      (void) const { return fNRays;             }
   virtual int           ScannerNParticles (void) const { return fNParticles;        }
+  virtual int           ScannerNThreads   (void) const { return fNScanThreads;      }
+  virtual int           ScannerBatchSize  (void) const { return fScanBatchSize;     }
+  virtual int           ScannerConvergence(void) const { return fNScanConvergeBatches; }
+  virtual string        ScannerFluxKey    (void) const { return fScanFluxKey;       }
+  virtual bool          UseMaxPlCache     (void) const { return fUseMaxPlCache;     }
   virtual bool          WeightWithDensity (void) const { return fDensWeight;        }
   virtual double        LengthUnits       (void) const { return fLengthScale;       }
   virtual double        DensityUnits      (void) const { return fDensityScale;      }
@@ -92,6 +136,8 @@ public :
   virtual string        TopVolName        (void) const { return fTopVolumeName;     }
   virtual TGeoManager * GetGeometry       (void) const { return fGeometry;          }
   virtual bool          GetKeepSegPath    (void) const { return fKeepSegPath;       }
+  virtual double        VoxelSize         (void) const { return fVoxelSize;         }
+  virtual int           SegmentCacheSize  (void) const { return fSegmentCacheSize;  }
   virtual const PathLengthList& GetMaxPathLengths(void) const { return *fCurrMaxPathLengthList; } // call only after ComputeMaxPathLengths() has been called 
 
   /// access to geometry coordinate/unit transforms for validation/test purposes
@@ -107,8 +153,15 @@ public :
   /// configure processing to perform path segment trimming
 
   virtual GeomVolSelectorI* AdoptGeomVolSelector (GeomVolSelectorI* selector) /// take ownership, return old
-  { std::swap(selector,fGeomVolSelector); return selector; }
+  { std::swap(selector,fGeomVolSelector); fSegmentCacheGen++; return selector; }
+
+  /// allow up to nthreads threads to navigate the geometry concurrently;
+  /// call once, from the thread that loaded the geometry, before any other
+  /// thread uses the analyzer (each thread then gets its own navigation
+  /// context on first use, released when the thread exits)
 
+  virtual void EnableMultiThreadNavigation (int nthreads);
+  virtual void DeleteThreadContext         (void);
 
 protected:
 
@@ -117,6 +170,7 @@ protected:
   virtual void   Load                    (string geometry_filename);
   virtual void   Load                    (TGeoManager * gm);
   virtual void   BuildListOfTargetNuclei (void);
+  virtual void   BuildMaterialWeights    (void);
 
   virtual int    GetTargetPdgCode        (const TGeoMaterial * const m) const;
   virtual int    GetTargetPdgCode        (const TGeoMixture * const m, int ielement) const;
@@ -124,12 +178,33 @@ protected:
   virtual double GetWeight               (const TGeoMixture * mixt, int pdgc);
   virtual double GetWeight               (const TGeoMixture * mixt, int ielement, int pdgc);
 
+  /// target weights of the materials, tabulated by BuildMaterialWeights()
+  int            TargetIndex             (int pdgc) const;
+  double         MaterialWeight          (const TGeoMaterial * mat, int itgt);
+  void           AddMaterialPathLengths  (const PathSegmentList & pslist, double * pl);
+
   virtual void   MaxPathLengthsFluxMethod(void);
   virtual void   MaxPathLengthsBoxMethod (void);
   virtual bool   GenBoxRay               (int indx, TLorentzVector& x4, TLorentzVector& p4);
+  virtual bool   UpdateMaxPathLengths    (const PathLengthList & pl);
+
+  virtual string MaxPlCacheKey           (void) const;
+  virtual string MaxPlCacheFile          (void) const;
+  virtual bool   ReadMaxPlCache          (string filename);
+  virtual void   WriteMaxPlCache         (string filename) const;
 
   virtual double ComputePathLengthPDG    (const TVector3 & r, const TVector3 & udir, int pdgc);
   virtual void   SwimOnce                (const TVector3 & r, const TVector3 & udir);
+  virtual void   SwimVoxels              (const TVector3 & r, const TVector3 & udir);
+  virtual void   SwimAnalyticRock        (const TVector3 & r, const TVector3 & udir);
+  virtual bool   BuildVoxelMap           (void);
+  virtual bool   UseCachedSegments       (ROOTGeomNavContext * ctx, const TVector3 & r, const TVector3 & udir);
+
+  /// combined SI & master coordinates <-> top volume coordinates & units
+  /// transforms, precomputed by UpdateTransforms()
+  virtual void   UpdateTransforms        (void);
+  void           SI2Top                  (TVector3 & pos, TVector3 & udir) const;
+  void           Top2SI                  (TVector3 & pos) const;
 
   virtual bool   FindMaterialInCurrentVol(int pdgc);
   virtual bool   WillNeverEnter          (double step);
@@ -137,6 +212,8 @@ protected:
   virtual double Step                    (void);
   virtual double StepUntilEntering       (void);
 
+  virtual ROOTGeomNavContext * NavContext       (void);
+  virtual ROOTGeomNavContext * CreateNavContext (void);
 
 
   int              fMaterial;              ///< input selected material for vertex generation
@@ -146,22 +223,42 @@ protected:
   int              fNRays;                 ///< max path length scanner (box method): rays/point [def:200]
   int              fNParticles;            ///< max path length scanner (flux method): particles in [def:10000]
   GFluxI *         fFlux;                  ///< a flux objects that can be used to scan the max path lengths
+  int              fNScanThreads;          ///< max path length scanner: threads swimming the rays [def:1]
+  int              fScanBatchSize;         ///< max path length scanner: rays swum per batch [def:1000]
+  int              fNScanConvergeBatches;  ///< max path length scanner: stop after that many batches without growth [def:0, never]
+  string           fScanFluxKey;           ///< max path length scanner (flux method): flux description for the cache [def:"", no caching]
+  bool             fUseMaxPlCache;         ///< reuse max path lengths cached for the same geometry & scan setup [def:true]
   bool             fDensWeight;            ///< if true pathlengths are weighted with density [def:true]
   double           fLengthScale;           ///< conversion factor: input geometry length units -> meters
   double           fDensityScale;          ///< conversion factor: input geometry density units -> kgr/meters^3
   double           fMaxPlSafetyFactor;     ///< factor that can multiply the computed max path lengths
   double           fMixtWghtSum;           ///< norm of relative weights (<0 if explicit summing required)
-  TVector3 *       fCurrVertex;            ///< current generated vertex
-  PathLengthList * fCurrPathLengthList;    ///< current list of path-lengths
   PathLengthList * fCurrMaxPathLengthList; ///< current list of max path-lengths
   PDGCodeList *    fCurrPDGCodeList;       ///< current list of target nuclei
+  std::vector< std::vector< std::pair<int,double> > > fMatWeights; ///< per material index: (target index, weight) of the targets it contains
   TGeoVolume *     fTopVolume;             ///< top volume
   TGeoHMatrix *    fMasterToTop;           ///< matrix connecting master coordinates to top volume coordinates
   bool             fMasterToTopIsIdentity; ///< is fMasterToTop matrix the identity matrix?
+  int              fTransformKind;         ///< SI master <-> top local transform: identity, scaling or general
+  double           fSI2LocalScale;         ///< SI -> local length units scale (1/LengthUnits())
+  double           fMasterToTopRot[9];     ///< rotation of fMasterToTop (row-major)
+  double           fMasterToTopTrans[3];   ///< translation of fMasterToTop (local units)
 
   bool             fKeepSegPath;           ///< need to fill path segment "path"
-  PathSegmentList* fCurrPathSegmentList;   ///< current list of path-segments
   GeomVolSelectorI* fGeomVolSelector;      ///< optional path seg trimmer (owned)
+  ROOTGeomNavContext * fNavContext;        ///< navigation context used in single-threaded mode
+
+  double           fVoxelSize;             ///< voxel map: voxel size (SI units) [def: 0, no voxel map]
+  GeomVoxelMap *   fVoxelMap;              ///< voxel map of the top volume (built on first use)
+
+  const TGeoVolume * fRockVolume;          ///< analytic rock: volume filling the top volume outside the hall box [def: none]
+  double           fRockHallMin[3];        ///< analytic rock: hall box lower corner (top vol coord & units)
+  double           fRockHallMax[3];        ///< analytic rock: hall box upper corner (top vol coord & units)
+
+  int              fSegmentCacheSize;      ///< number of recently swum rays kept per thread, besides the last one [def: 8]
+  double           fSegmentCachePosTol;    ///< cached rays: start position tolerance (SI units) [def: 0]
+  double           fSegmentCacheDirTol;    ///< cached rays: direction cosines tolerance [def: 0]
+  unsigned long    fSegmentCacheGen;       ///< incremented when cached path-segment lists become stale
 
   // used by GenBoxRay to retain history between calls
   TVector3         fGenBoxRayPos;
@@ -17,6 +17,8 @@
 #include <TSystem.h>
 #include <TFile.h>
 #include <TTree.h>
+#include <TTimer.h>
+#include <TMath.h>
 #include <TVirtualX.h>
 #include <TGListBox.h>
 #include <TGComboBox.h>
@@ -47,11 +49,15 @@
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpEventIndex.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
 #include "Tools/Masterclass/GNuMcMainFrame.h"
 #include "Tools/Masterclass/MCTruthDisplay.h"
+#include "Tools/Masterclass/FastSimScintCalo.h"
+#include "Tools/Masterclass/FastSimCherenkov.h"
 
+using std::map;
 using std::ostringstream;
 using std::setprecision;
 using std::string;
@@ -62,6 +68,11 @@ using namespace genie::masterclass;
 
 ClassImp(GNuMcMainFrame)
 
+// read-ahead: delay (ms) before each record is read while the GUI is idle,
+// and size of the TTreeCache covering the read-ahead entries
+static const Long_t kPrefetchDelay     = 20;
+static const Int_t  kPrefetchCacheSize = 10*1024*1024;
+
 //______________________________________________________________________________
 GNuMcMainFrame::GNuMcMainFrame(const TGWindow * p, UInt_t w, UInt_t h) :
 TGMainFrame(p, w, h)
@@ -92,17 +103,29 @@ void GNuMcMainFrame::Init(void)
    fFileOpenButton      = 0;
    fNextEventButton     = 0;
    fExitButton          = 0;
+   fPrevEventButton     = 0;
+   fEventNumberEntry    = 0;
+   fGoToEventButton     = 0;
+   fScintCaloCanvas     = 0;
+   fCherenkovCanvas     = 0;
    fViewTabWidth        = 0;
    fViewTabHeight       = 0;
    
    fTruthDisplay = 0;
+   fScintCaloSim = 0;
+   fCherenkovSim = 0;
    
    fEventFilename = "";
    fEventFile     = 0;
    fGHepTree      = 0;
    fMCRecord      = 0;
    fNuOfEvents    = 0;
-   fCurrEventNu   = 0;
+   fCurrEventNu   = -1;
+   fCurrEvent     = 0;
+   for(int itab = 0; itab < kNViewerTabs; itab++) fTabDrawn[itab] = false;
+
+   fPrefetchDepth = 5;
+   fPrefetchTimer = 0;
 
 }
 //______________________________________________________________________________
@@ -134,10 +157,18 @@ void GNuMcMainFrame::BuildGUI(const TGWindow * p, UInt_t w, UInt_t h)
 //______________________________________________________________________________
 GNuMcMainFrame::~GNuMcMainFrame()
 {
+  if(fPrefetchTimer) {
+    fPrefetchTimer->Stop();
+    delete fPrefetchTimer;
+  }
+  this->CloseFile();
+
   fMain->Cleanup();
   delete fMain;
 
   delete fTruthDisplay;
+  delete fScintCaloSim;
+  delete fCherenkovSim;
 }
 //______________________________________________________________________________
 void GNuMcMainFrame::BuildMainFrames(void)
@@ -158,23 +189,38 @@ TGGroupFrame * GNuMcMainFrame::BuildImageButtonFrame(void)
 
   fFileOpenButton  = 
     new TGPictureButton(bf, gClient->GetPicture(Icon("open"),32,32));
+  fPrevEventButton = new TGTextButton(bf, "  &Prev  ");
   fNextEventButton = 
     new TGPictureButton(bf, gClient->GetPicture(Icon("next"),32,32));
+  fEventNumberEntry = new TGNumberEntry(bf, 0, 9, -1,
+    TGNumberFormat::kNESInteger, TGNumberFormat::kNEANonNegative);
+  fGoToEventButton = new TGTextButton(bf, "  &Go to  ");
   fExitButton = 
     new TGPictureButton(bf, gClient->GetPicture(Icon("exit"), 32,32),
     "gApplication->Terminate(0)");
 
   fFileOpenButton   -> SetToolTipText( "Open event file" , 1);
   fNextEventButton  -> SetToolTipText( "Get next event" ,  1);
+  fPrevEventButton  -> SetToolTipText( "Get previous event", 1);
+  fGoToEventButton  -> SetToolTipText( "Go to event number", 1);
   fExitButton       -> SetToolTipText( "Exit",             1);
 
   fFileOpenButton  -> Connect(
      "Clicked()","genie::masterclass::GNuMcMainFrame", this,"FileOpen()");
   fNextEventButton  -> Connect(
      "Clicked()","genie::masterclass::GNuMcMainFrame", this,"NextEvent()");
+  fPrevEventButton  -> Connect(
+     "Clicked()","genie::masterclass::GNuMcMainFrame", this,"PrevEvent()");
+  fGoToEventButton  -> Connect(
+     "Clicked()","genie::masterclass::GNuMcMainFrame", this,"GoToEvent()");
+
+  TGLayoutHints * centred = new TGLayoutHints(kLHintsCenterY, 2, 2, 0, 0);
 
   bf -> AddFrame( fFileOpenButton   );
+  bf -> AddFrame( fPrevEventButton,  centred );
   bf -> AddFrame( fNextEventButton  );
+  bf -> AddFrame( fEventNumberEntry, centred );
+  bf -> AddFrame( fGoToEventButton,  centred );
   bf -> AddFrame( fExitButton       );
 
   return bf;
@@ -191,6 +237,10 @@ void GNuMcMainFrame::BuildTabs(void)
   this->BuildFastSimScintCaloTab ();
   this->BuildFastSimCherenkovTab ();
 
+  // tabs are drawn when shown
+  fViewerTabs -> Connect(
+     "Selected(Int_t)","genie::masterclass::GNuMcMainFrame", this,"TabSelected(Int_t)");
+
   ULong_t hintViewerTabsLayout = 
        kLHintsTop | kLHintsExpandX | kLHintsExpandY;
   fViewerTabsLayout      
@@ -253,6 +303,13 @@ void GNuMcMainFrame::BuildFastSimScintCaloTab (void)
 
   tf = fViewerTabs->AddTab("FastSim/ScintCalo");
 
+  fScintCaloCanvas = new TRootEmbeddedCanvas(
+     "fScintCaloCanvas", tf, fViewTabWidth, fViewTabHeight);
+  fScintCaloCanvas -> GetCanvas() -> SetBorderMode (0);
+  fScintCaloCanvas -> GetCanvas() -> SetFillColor  (0);
+
+  tf -> AddFrame( fScintCaloCanvas, new TGLayoutHints(
+     kLHintsTop | kLHintsLeft | kLHintsExpandX | kLHintsExpandY, 5, 5, 10, 1) );
 }
 //______________________________________________________________________________
 void GNuMcMainFrame::BuildFastSimCherenkovTab (void)
@@ -264,6 +321,13 @@ void GNuMcMainFrame::BuildFastSimCherenkovTab (void)
 
   tf = fViewerTabs->AddTab("FastSim/Cherenkov");
 
+  fCherenkovCanvas = new TRootEmbeddedCanvas(
+     "fCherenkovCanvas", tf, fViewTabWidth, fViewTabHeight);
+  fCherenkovCanvas -> GetCanvas() -> SetBorderMode (0);
+  fCherenkovCanvas -> GetCanvas() -> SetFillColor  (0);
+
+  tf -> AddFrame( fCherenkovCanvas, new TGLayoutHints(
+     kLHintsTop | kLHintsLeft | kLHintsExpandX | kLHintsExpandY, 5, 5, 10, 1) );
 }
 //______________________________________________________________________________
 void GNuMcMainFrame::BuildStatusBar(void)
@@ -293,6 +357,15 @@ const char * GNuMcMainFrame::Icon(const char * name)
 void GNuMcMainFrame::BuildHelpers(void)
 {
   fTruthDisplay = new MCTruthDisplay(fEmbeddedCanvas,fGHep);
+
+  fScintCaloSim = new FastSimScintCalo;
+  fScintCaloSim -> SetEmbeddedCanvas(fScintCaloCanvas);
+  fCherenkovSim = new FastSimCherenkov;
+  fCherenkovSim -> SetEmbeddedCanvas(fCherenkovCanvas);
+
+  fPrefetchTimer = new TTimer(kPrefetchDelay, kTRUE);
+  fPrefetchTimer -> Connect(
+     "Timeout()","genie::masterclass::GNuMcMainFrame", this,"Prefetch()");
 }
 //______________________________________________________________________________
 void GNuMcMainFrame::FileOpen(void)
@@ -315,13 +388,7 @@ void GNuMcMainFrame::FileOpen(void)
      cmd << "Will read events from: " << fEventFilename;
      fStatusBar -> SetText( cmd.str().c_str(), 0 );
 
-     if(fEventFile) {
-       fEventFile->Close();
-       delete fEventFile;
-     }
-     if(fGHepTree) {
-       delete fGHepTree;
-     }
+     this->CloseFile();
 
      fEventFile = 
          new TFile(fEventFilename.c_str(),"READ");
@@ -333,7 +400,7 @@ void GNuMcMainFrame::FileOpen(void)
         gAbortingInErr=true;
         exit(1);
      }
-     fCurrEventNu = 0;
+     fCurrEventNu = -1;
      fNuOfEvents  = fGHepTree->GetEntries();
      LOG("MasterClass", pNOTICE)  
        << "Input GHEP event tree has " << fNuOfEvents 
@@ -341,31 +408,225 @@ void GNuMcMainFrame::FileOpen(void)
 
      NtpMCTreeHeader * thdr = 
          dynamic_cast <NtpMCTreeHeader *> ( fEventFile->Get("header") );
-     LOG("MasterClass", pNOTICE) 
-         << "Input tree header: " << *thdr;
+     if(thdr) {
+       LOG("MasterClass", pNOTICE) 
+           << "Input tree header: " << *thdr;
+     }
 
      fGHepTree->SetBranchAddress("gmcrec", &fMCRecord);
 
+     // the baskets of the entries read ahead are fetched in one go
+     fGHepTree->SetCacheSize(kPrefetchCacheSize);
+     fGHepTree->AddBranchToCache("*", kTRUE);
+
+     this->ReadEventIndex();
+
+     fPrefetchTimer->Start(kPrefetchDelay, kTRUE);
+  }
+}
+//______________________________________________________________________________
+void GNuMcMainFrame::CloseFile(void)
+{
+  if(fPrefetchTimer) fPrefetchTimer->Stop();
+
+  this->ClearEventCache();
+  fEntryOfEvent.clear();
+
+  // the event tree is owned by the file
+  if(fEventFile) {
+    fEventFile->Close();
+    delete fEventFile;
+  }
+  fEventFile = 0;
+  fGHepTree  = 0;
+
+  delete fMCRecord;
+  fMCRecord = 0;
+
+  fNuOfEvents  = 0;
+  fCurrEventNu = -1;
+}
+//______________________________________________________________________________
+void GNuMcMainFrame::ReadEventIndex(void)
+{
+// Map event numbers to tree entries, from the event index (only its event
+// number branch is read). Without an index, event numbers are tree entries.
+
+  fEntryOfEvent.clear();
+
+  TTree * index_tree = NtpEventIndex::IndexTree(fEventFile, fGHepTree);
+  if(!index_tree) {
+    LOG("MasterClass", pNOTICE)
+      << "No event index in " << fEventFilename
+      << " - Event numbers are taken as tree entries";
+    return;
+  }
+
+  Long64_t iev = 0;
+  index_tree->SetBranchStatus("*",   0);
+  index_tree->SetBranchStatus("iev", 1);
+  index_tree->SetBranchAddress("iev", &iev);
+  for(Long64_t i = 0; i < fNuOfEvents; i++) {
+    index_tree->GetEntry(i);
+    if(fEntryOfEvent.count(iev) == 0) fEntryOfEvent[iev] = i;
+  }
+  index_tree->ResetBranchAddresses();
+
+  LOG("MasterClass", pNOTICE)
+    << "Read the event index of " << fEventFilename
+    << " (" << fEntryOfEvent.size() << " event numbers)";
+}
+//______________________________________________________________________________
+EventRecord * GNuMcMainFrame::ReadEvent(Long64_t entry)
+{
+// Get the event at the input tree entry, from the cache if it was read ahead
+
+  map<Long64_t, EventRecord *>::iterator it = fEventCache.find(entry);
+  if(it != fEventCache.end()) return it->second;
+
+  fGHepTree->GetEntry(entry);
+  EventRecord * event = new EventRecord(*(fMCRecord->event));
+  fMCRecord->Clear();
+
+  fEventCache[entry] = event;
+  return event;
+}
+//______________________________________________________________________________
+void GNuMcMainFrame::ClearEventCache(void)
+{
+  map<Long64_t, EventRecord *>::iterator it = fEventCache.begin();
+  for( ; it != fEventCache.end(); ++it) {
+    delete it->second;
   }
+  fEventCache.clear();
+  fCurrEvent = 0;
 }
 //______________________________________________________________________________
 void GNuMcMainFrame::NextEvent(void)
 {
+  if(!fGHepTree) {
+    fStatusBar->SetText( "No event file open", 0);
+    return;
+  }
   if(fCurrEventNu >= fNuOfEvents-1) {
-	exit(1);
+    fStatusBar->SetText( "No more events in file", 0);
+    return;
+  }
+  this->ShowEntry(fCurrEventNu+1);
+}
+//______________________________________________________________________________
+void GNuMcMainFrame::PrevEvent(void)
+{
+  if(!fGHepTree) {
+    fStatusBar->SetText( "No event file open", 0);
+    return;
+  }
+  if(fCurrEventNu <= 0) {
+    fStatusBar->SetText( "No previous event in file", 0);
+    return;
+  }
+  this->ShowEntry(fCurrEventNu-1);
+}
+//______________________________________________________________________________
+void GNuMcMainFrame::GoToEvent(void)
+{
+  if(!fGHepTree) {
+    fStatusBar->SetText( "No event file open", 0);
+    return;
   }
 
-  fGHepTree->GetEntry(fCurrEventNu);
-  fCurrEventNu++;
+  Long64_t iev   = fEventNumberEntry->GetIntNumber();
+  Long64_t entry = iev;
+  if(!fEntryOfEvent.empty()) {
+    map<Long64_t, Long64_t>::const_iterator it = fEntryOfEvent.find(iev);
+    entry = (it == fEntryOfEvent.end()) ? -1 : it->second;
+  }
+  if(entry < 0 || entry >= fNuOfEvents) {
+    ostringstream msg;
+    msg << "No event " << iev << " in file";
+    fStatusBar->SetText( msg.str().c_str(), 0);
+    return;
+  }
+  this->ShowEntry(entry);
+}
+//______________________________________________________________________________
+void GNuMcMainFrame::ShowEntry(Long64_t entry)
+{
+  fCurrEventNu = entry;
+
+  EventRecord * event = this->ReadEvent(entry);
+
+  // keep the previous event and the ones read ahead, drop the others
+  Long64_t first = entry - 1;
+  Long64_t last  = entry + fPrefetchDepth;
+  map<Long64_t, EventRecord *>::iterator it = fEventCache.begin();
+  while(it != fEventCache.end()) {
+    if(it->first < first || it->first > last) {
+      delete it->second;
+      fEventCache.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  if(entry+1 < fNuOfEvents) {
+    fGHepTree->SetCacheEntryRange(entry+1, TMath::Min(last, fNuOfEvents-1));
+  }
 
-  EventRecord * event = fMCRecord->event;
+  ostringstream msg;
+  msg << "Entry " << entry << " / " << fNuOfEvents;
+  fStatusBar->SetText( msg.str().c_str(), 1);
 
   this->ShowEvent(event);
+
+  fPrefetchTimer->Start(kPrefetchDelay, kTRUE);
 }
 //______________________________________________________________________________
 void GNuMcMainFrame::ShowEvent(EventRecord * event)
 {
-  fTruthDisplay->DrawDiagram(event);
-  fTruthDisplay->PrintEventRecord(event);
+  fCurrEvent = event;
+  for(int itab = 0; itab < kNViewerTabs; itab++) fTabDrawn[itab] = false;
+
+  // only the tab on display is drawn; the others are drawn when selected
+  this->RenderTab(fViewerTabs->GetCurrent());
+}
+//______________________________________________________________________________
+void GNuMcMainFrame::TabSelected(Int_t tab)
+{
+  this->RenderTab(tab);
+}
+//______________________________________________________________________________
+void GNuMcMainFrame::RenderTab(int tab)
+{
+  if(!fCurrEvent) return;
+  if(tab < 0 || tab >= kNViewerTabs) return;
+  if(fTabDrawn[tab]) return;
+
+  switch(tab) {
+    case (kFeynmanTab)   : fTruthDisplay->DrawDiagram(fCurrEvent);      break;
+    case (kGHepTab)      : fTruthDisplay->PrintEventRecord(fCurrEvent); break;
+    case (kScintCaloTab) : fScintCaloSim->Draw(fCurrEvent);             break;
+    case (kCherenkovTab) : fCherenkovSim->Draw(fCurrEvent);             break;
+    default : break;
+  }
+  fTabDrawn[tab] = true;
+}
+//______________________________________________________________________________
+void GNuMcMainFrame::Prefetch(void)
+{
+// Called from the GUI event loop while idle: Reads the next entry not yet
+// in the cache (one per call, so that the GUI stays responsive) and
+// re-arms the timer until fPrefetchDepth entries are cached ahead.
+// The event tree is only accessed from the GUI thread.
+
+  if(!fGHepTree) return;
+
+  Long64_t first = fCurrEventNu + 1;
+  Long64_t last  = TMath::Min(fCurrEventNu + fPrefetchDepth, fNuOfEvents-1);
+  for(Long64_t entry = first; entry <= last; entry++) {
+    if(fEventCache.count(entry) > 0) continue;
+    this->ReadEvent(entry);
+    if(entry < last) fPrefetchTimer->Start(kPrefetchDelay, kTRUE);
+    return;
+  }
 }
 //______________________________________________________________________________
@@ -5,6 +5,15 @@
 
 \brief    GENIE Neutrino Masterclass app main frame
 
+          Events are accessed by position: one can step forwards and backwards
+          or jump to an event number. If the file has an event index (see
+          NtpEventIndex), event numbers are looked up there. Otherwise they
+          are taken as tree entries.
+          While the application is idle, the records following the current
+          one are read ahead into a small cache. Each tab is only drawn once
+          it is shown for the current event. The fast simulations, in
+          particular, are not run for events whose tab is never opened.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -19,6 +28,7 @@
 #ifndef _G_NUMC_MAIN_FRAME_H_
 #define _G_NUMC_MAIN_FRAME_H_
 
+#include <map>
 #include <string>
 
 #include <TApplication.h>
@@ -76,11 +86,15 @@ class TTree;
 #include <TRootEmbeddedCanvas.h>
 #include <TFile.h>
 #include <TTree.h>
+#include <TTimer.h>
 
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
 #include "Tools/Masterclass/MCTruthDisplay.h"
+#include "Tools/Masterclass/FastSimScintCalo.h"
+#include "Tools/Masterclass/FastSimCherenkov.h"
 
+using std::map;
 using std::string;
 
 namespace genie {
@@ -94,12 +108,25 @@ public:
 
    void Close     (void) { gApplication->Terminate(0); }
    void Exit      (void) { Close();                    }
-   void FileOpen  (void);
-   void NextEvent (void);
-   void ShowEvent (EventRecord * ev_rec);
+   void FileOpen    (void);
+   void NextEvent   (void);
+   void PrevEvent   (void);
+   void GoToEvent   (void);
+   void ShowEvent   (EventRecord * ev_rec);
+   void TabSelected (Int_t tab);
+   void Prefetch    (void);
 
 private:
 
+   //! viewer tabs, in the order they are added
+   enum EViewerTab {
+     kFeynmanTab = 0,
+     kGHepTab,
+     kScintCaloTab,
+     kCherenkovTab,
+     kNViewerTabs
+   };
+
    void           Init                     (void);
    void           BuildHelpers             (void);
    void           BuildGUI                 (const TGWindow * p, UInt_t w, UInt_t h);
@@ -111,6 +138,12 @@ private:
    void           BuildStatusBar           (void);
    TGGroupFrame * BuildImageButtonFrame    (void);
    const char *   Icon                     (const char * name);
+   void           CloseFile                (void);
+   void           ReadEventIndex           (void);
+   EventRecord *  ReadEvent                (Long64_t entry);
+   void           ShowEntry                (Long64_t entry);
+   void           RenderTab                (int tab);
+   void           ClearEventCache          (void);
 
    // GUI widgets & properties
    TGMainFrame *            fMain;
@@ -132,11 +165,18 @@ private:
    TGPictureButton *        fFileOpenButton;
    TGPictureButton *        fNextEventButton;
    TGPictureButton *        fExitButton;
+   TGTextButton *           fPrevEventButton;
+   TGNumberEntry *          fEventNumberEntry;
+   TGTextButton *           fGoToEventButton;
+   TRootEmbeddedCanvas *    fScintCaloCanvas;
+   TRootEmbeddedCanvas *    fCherenkovCanvas;
    unsigned int             fViewTabWidth;
    unsigned int             fViewTabHeight;
 
    // utility classes
-   MCTruthDisplay * fTruthDisplay;
+   MCTruthDisplay *   fTruthDisplay;
+   FastSimScintCalo * fScintCaloSim;
+   FastSimCherenkov * fCherenkovSim;
 
    // input events
    string             fEventFilename;
@@ -144,7 +184,15 @@ private:
    TTree*             fGHepTree;
    NtpMCEventRecord * fMCRecord;
    Long64_t           fNuOfEvents;
-   Long64_t           fCurrEventNu;
+   Long64_t           fCurrEventNu;     ///< entry shown (-1: none yet)
+   EventRecord *      fCurrEvent;       ///< event shown (owned by the cache)
+   bool               fTabDrawn[kNViewerTabs]; ///< the event shown is drawn in each tab?
+
+   // random access & read-ahead
+   map<Long64_t, Long64_t>      fEntryOfEvent;  //! event number -> entry, from the event index
+   map<Long64_t, EventRecord *> fEventCache;    //! entry -> event, around the current entry
+   int                          fPrefetchDepth; ///< number of entries read ahead
+   TTimer *                     fPrefetchTimer; ///< reads ahead while the GUI is idle
 
    ClassDef(GNuMcMainFrame, 1)
 };
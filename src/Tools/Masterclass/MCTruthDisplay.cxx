@@ -88,6 +88,8 @@ void MCTruthDisplay::PrintEventRecord(EventRecord * event)
 {
   if(!fGTxt) return;
 
+  fGTxt->Clear();
+
   ostringstream ghep;
   ghep << *event;
   string ghepstr = ghep.str(); // GHEP record as a single string
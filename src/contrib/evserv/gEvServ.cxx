@@ -5,12 +5,42 @@
 
 \brief   GENIE v+A event generation server 
 
+         A long-lived server keeping the tune, the cross section splines,
+         the physics tables and the event generation drivers of the
+         requested initial states initialized in memory, so that many short
+         event generation jobs can be served without re-initializing GENIE.
+         Clients connect one after the other: when a client disconnects the
+         server waits for the next one, until it is asked to shut down.
+
          Syntax :
-           gevserv [-p port]
+           gevserv [-p port] --tune genie_tune
+                   [--cross-sections xml_file] [--seed seed]
+                   [--event-generator-list list] [--message-thresholds xml_file]
 
          Options :
            [] denotes an optional argument
            -p port number (default: 9090)
+           --tune, --event-generator-list, --message-thresholds, ...
+              the standard GENIE run options (see RunOpt)
+           --cross-sections
+              the cross section splines to load at start-up (if not set,
+              they are loaded from $GSPLOAD on a 'load-splines' request)
+           --seed
+              the initial random number seed (every EVTGEN request sets its
+              own seed)
+
+         Requests :
+           RUB GENIE LAMP                      handshake
+           CONFIG: [load-splines] neutrino-list=.. target-list=..
+                                               add drivers for the initial
+                                               states not configured yet
+           XSEC: nu tgt                        total cross section
+           EVTVTX: run evt nu0 vx vy vz nu tgt px py pz
+                                               1 event for the given neutrino
+           EVTGEN: nu tgt E|Emin,Emax nev seed nev events along +z, at fixed
+                                               energy or uniformly distributed
+                                               in [Emin,Emax], with the seed
+           SHUTDOWN
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
@@ -24,10 +54,12 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <vector>
+#include <set>
 
 #include <TSystem.h>
 #include <TServerSocket.h>
@@ -36,24 +68,29 @@
 #include <TBits.h>
 #include <TMath.h>
 
-#include "Conventions/Units.h"
-#include "EVGCore/EventRecord.h"
-#include "EVGDrivers/GEVGDriver.h"
-#include "EVGDrivers/GEVGPool.h"
-#include "EVGDrivers/GMCJMonitor.h"
-#include "GHEP/GHepFlags.h"
-#include "GHEP/GHepParticle.h"
-#include "GHEP/GHepRecord.h"
-#include "Interaction/Interaction.h"
-#include "Messenger/Messenger.h"
-#include "Numerical/Spline.h"
-#include "PDG/PDGCodeList.h"
-#include "Utils/XSecSplineList.h"
-#include "Utils/StringUtils.h"
-#include "Utils/CmdLnArgParser.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/GEVGPool.h"
+#include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/GHEP/GHepFlags.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepRecord.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
 
 using std::string;
 using std::vector;
+using std::set;
 using std::ostringstream;
 
 using namespace genie;
@@ -63,12 +100,15 @@ using namespace genie::utils;
 //
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
+void Initialize         (void);
 void RunInitChecks      (void);
 void HandleMesg         (string mesg);
 void Handshake          (void);
 void Configure          (string mesg);
 void CalcTotalXSec      (string mesg);
 void GenerateEvent      (string mesg);
+void GenerateEvents     (string mesg);
+void SendEvent          (EventRecord * event, string hdr1, string hdr2);
 void Shutdown           (void);
 
 // ** Consts & Defaults
@@ -88,16 +128,22 @@ const string kEvgenCmdRecv         = "EVTVTX";
 const string kEvgenHdrCmdSent      = "EVTREC";
 const string kEvgenStdhepCmdSent   = "STDHEP";
 const string kEvgenOkMesgSent      = "EVENT GENERATED";
+const string kEvgenNCmdRecv        = "EVTGEN";
+const string kEvgenNCmdSent        = "EVTGEN";
+const string kEvgenNOkMesgSent     = "EVENTS GENERATED";
 const string kShutdownCmdRecv      = "SHUTDOWN";
 const string kShutdownOkMesgSent   = "SHUTTING DOWN";
 const string kErrNoConf            = "*** NOT CONFIGURED! ***";
 const string kErrNoDriver          = "*** NO EVENT GENERATION DRIVER! ***";
 const string kErrNoEvent           = "*** NULL OR UNPHYSICAL EVENT! ***";
 const string kErr                  = "FAILED";
+const int    kMaxEvgenAttempts     = 100;   // max failed attempts per requested event
 
 // ** User-specified options:
 //
-int gOptPortNum;   // port number
+int      gOptPortNum;      // port number
+string   gOptInpXSecFile;  // cross-section splines loaded at start-up
+long int gOptRanSeed;      // initial random number seed
 
 // ** Globals
 //
@@ -105,6 +151,8 @@ TSocket * gSock       = 0;      // tcp/ip socket
 bool      gShutDown   = false;  // 'shutting down?' flag
 bool      gConfigured = false;  // 'am I configured?' flag
 GEVGPool  gGPool;               // list of GENIE event generation drivers used in job
+EventRecordPool gRecordPool;    // generated event records, re-used once sent
+set<string> gXSecSumInitStates; // init states whose total xsec spline was built
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -112,47 +160,95 @@ int main(int argc, char ** argv)
   // Parse command line arguments
   GetCommandLineArgs(argc,argv);
 
-  // Run some checks
+  // Run some checks & initialize GENIE once, for all clients
   RunInitChecks();
+  Initialize();
 
   // Open a server socket
   TServerSocket * serv_sock = new TServerSocket(gOptPortNum, kTRUE);
+  if(!serv_sock->IsValid()) {
+    LOG("gevserv", pFATAL) << "Could not listen on port: " << gOptPortNum;
+    exit(1);
+  }
+  LOG("gevserv", pNOTICE) << "Listening on port: " << gOptPortNum;
 
-  // Accept a connection
-  gSock = serv_sock->Accept();
+  // Serve the clients one after the other: The drivers configured for a
+  // client are kept for the next ones
 
-  if(!gSock) exit(1);
-  LOG("gevserv", pNOTICE) << "Listening on port: " << gOptPortNum;
-  
-  // Set no TCP/IP NODELAY
-  int delay_ok = gSock->SetOption(kNoDelay,1);
-  LOG("gevserv", pNOTICE) << "TCP_NODELAY > " << delay_ok;
+  while(!gShutDown) {
+
+    // Accept a connection
+    gSock = serv_sock->Accept();
+    if(!gSock || gSock == (TSocket *) -1) {
+      LOG("gevserv", pFATAL) << "Could not accept a connection";
+      exit(1);
+    }
+    LOG("gevserv", pNOTICE) << "Accepted a connection";
+
+    // Set no TCP/IP NODELAY
+    int delay_ok = gSock->SetOption(kNoDelay,1);
+    LOG("gevserv", pNOTICE) << "TCP_NODELAY > " << delay_ok;
 
-  // Start listening for messages & take the corresponding actions
+    // Start listening for messages & take the corresponding actions
 
-  while(1) {
+    while(!gShutDown) {
 
-    if(gShutDown) break;
+      TMessage * mesg = 0;
 
-    TMessage * mesg = 0;
+      int nrecv = gSock->Recv(mesg);
+      if(nrecv <= 0) {
+        // the client disconnected
+        if(mesg) delete mesg;
+        break;
+      }
+
+      if(!mesg) continue;
+      if(mesg->What() != kMESS_STRING) { delete mesg; continue; }
 
-    gSock->Recv(mesg);
+      char mesg_content[2048];
+      mesg->ReadString(mesg_content, 2048);
+      delete mesg;
 
-    if(!mesg) continue;
-    if(mesg->What() != kMESS_STRING) continue;
+      LOG("gevserv", pNOTICE) << "Processing mesg > " << mesg_content;
 
-    char mesg_content[2048];
-    mesg->ReadString(mesg_content, 2048);
+      HandleMesg(mesg_content);
 
-    LOG("gevserv", pNOTICE) << "Processing mesg > " << mesg_content;
+    } // messages
 
-    HandleMesg(mesg_content);
+    LOG("gevserv", pNOTICE) << "Closing the connection";
+    gSock->Close();
+    delete gSock;
+    gSock = 0;
 
-  } // while(1)
+  } // clients
+
+  serv_sock->Close();
+  delete serv_sock;
 
   return 0;
 }
 //____________________________________________________________________________
+void Initialize(void)
+{
+// Initialize all that is kept for the lifetime of the server: the tune,
+// the random number generator, the messenger and the cross section splines
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gevserv", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::RandGen(gOptRanSeed);
+  if(gOptInpXSecFile.size() > 0) {
+    utils::app_init::XSecTable(gOptInpXSecFile, false);
+  }
+
+  GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+}
+//____________________________________________________________________________
 void HandleMesg(string mesg)
 {
   if(mesg.find(kHandshakeCmdRecv.c_str()) != string::npos) 
@@ -170,6 +266,11 @@ void HandleMesg(string mesg)
     CalcTotalXSec(mesg);
   }
   else
+  if (mesg.find(kEvgenNCmdRecv.c_str()) != string::npos) 
+  {
+    GenerateEvents(mesg);
+  } 
+  else
   if (mesg.find(kEvgenCmdRecv.c_str()) != string::npos) 
   {
     GenerateEvent(mesg);
@@ -198,8 +299,8 @@ void Configure(string mesg)
 // Configure the GENIE event server
 // ** Load splines 
 //    - if the "load-splines" command is contained in the mesg 
-//    - the splines are loaded from the the XML file specified in $GSPLOAD (server-side) 
-//    the "load-splines" mesg is sent
+//    - the splines are loaded from the the XML file specified in $GSPLOAD (server-side),
+//      unless splines were already loaded (eg with --cross-sections at start-up)
 // ** Specify the neutrino list
 //    - adding a "neutrino-list=<comma separated list of pdg codes>" in the mesg
 // ** Specify the target list
@@ -212,6 +313,8 @@ void Configure(string mesg)
 // - You can further control GENIE (suppress modes, set messenger verbosity, ...)
 //   by setting all the std GENIE env vars at the server side. 
 //   See the GENIE web site.
+// - The drivers are kept for the lifetime of the server: only the initial
+//   states not configured yet (eg by a previous client) get a new driver.
 
   LOG("gevserv", pNOTICE)  << "Configuring GENIE event server";
 
@@ -226,7 +329,10 @@ void Configure(string mesg)
   //
   if(mesg.find(kConfigCmdLdSpl) != string::npos) {
      XSecSplineList * xspl = XSecSplineList::Instance();
-     xspl->AutoLoad();
+     const char * gspload = gSystem->Getenv("GSPLOAD");
+     if(xspl->IsEmpty() && gspload) {
+       utils::app_init::XSecTable(gspload, false);
+     }
 
      mesg.erase(mesg.find(kConfigCmdLdSpl),12);
      mesg = str::TrimSpaces(mesg);             
@@ -289,13 +395,24 @@ void Configure(string mesg)
 
      InitialState init_state(target_code, neutrino_code);
 
+     // keep the driver of an initial state that is already configured
+     if(gGPool.FindDriver(init_state)) {
+       LOG("gevserv", pNOTICE)
+         << "Re-using the GEVGDriver object for init-state: "
+         << init_state.AsString();
+       continue;
+     }
+
      LOG("gevserv", pNOTICE)
        << "\n\n ---- Creating a GEVGDriver object configured for init-state: "
        << init_state.AsString() << " ----\n\n";
 
      GEVGDriver * evgdriver = new GEVGDriver;
+     evgdriver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+     evgdriver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
      evgdriver->Configure(init_state);
      evgdriver->UseSplines(); // will also check if all splines needed are loaded
+     evgdriver->UseRecordPool(&gRecordPool);
 
      gGPool.insert( GEVGPool::value_type(init_state.AsString(), evgdriver) );
 
@@ -356,8 +473,12 @@ void CalcTotalXSec(string mesg)
        << "Requesting total cross section for init state: " 
        << init_state.AsString();
 
-  evg_driver->CreateXSecSumSpline (
-     1000 /*nknots*/, 0.001 /*Emin*/, 300 /*Emax*/, true /*in-log*/);
+  // (built once per initial state for the lifetime of the server)
+  if(gXSecSumInitStates.count(init_state.AsString()) == 0) {
+    evg_driver->CreateXSecSumSpline (
+       1000 /*nknots*/, 0.001 /*Emin*/, 300 /*Emax*/, true /*in-log*/);
+    gXSecSumInitStates.insert(init_state.AsString());
+  }
 
   const Spline * total_xsec_spl = evg_driver->XSecSumSpline();
   assert(total_xsec_spl);
@@ -442,6 +563,7 @@ void GenerateEvent(string mesg)
   // Check/print the generated event
   bool failed = (event==0) || event->IsUnphysical();
   if(failed) {
+      if(event) gRecordPool.Recycle(event);
       LOG("gevserv", pWARN) 
               << "Failed to generate the requested event";
       gSock->Send(kErrNoEvent.c_str());
@@ -450,6 +572,154 @@ void GenerateEvent(string mesg)
   }
   LOG("gevserv", pINFO) << "Generated event: " << *event;
 
+  // Send back the event through the tcp/ip socket
+
+  ostringstream hdr1, hdr2;
+
+  hdr1 
+    << kEvgenHdrCmdSent << ": "
+    << irun             << " " 
+    << ievt             << " " 
+    << ipdgnunoosc      << " "
+    << vtxx             << " " 
+    << vtxy             << " " 
+    << vtxz;
+  hdr2 
+    << ipdgnu  << " " 
+    << ipdgtgt << " " 
+    << px      << " " 
+    << py      << " " 
+    << pz;
+
+  SendEvent(event, hdr1.str(), hdr2.str());
+
+  // Clean-up and report success
+
+  gRecordPool.Recycle(event);
+
+  LOG("gevserv", pINFO) << "...done!";
+}
+//____________________________________________________________________________
+void GenerateEvents(string mesg)
+{
+// Generate a batch of events for the given initial state, with neutrinos
+// along +z at a fixed energy or uniformly distributed in an energy range,
+// starting from the given random number seed. Each event is sent as for
+// EVTVTX requests (with run = seed and evt = event index), after a
+// "EVTGEN: <nev>" header and followed by an "EVENTS GENERATED" message.
+
+  LOG("gevserv", pNOTICE) << "Generating events - Input info : " << mesg;
+
+  if(!gConfigured) {
+      LOG("gevserv", pERROR) 
+             << "Event server is not configured - Can not generate events";
+      gSock->Send(kErrNoConf.c_str());
+      gSock->Send(kErr.c_str());
+      return;
+  }
+
+  // Extract info from the input mesg
+
+  mesg = str::FilterString(kEvgenNCmdRecv, mesg); 
+  mesg = str::FilterString(":", mesg); 
+  mesg = str::TrimSpaces(mesg);             
+
+  vector<string> sv = str::Split(mesg," "); 
+  if(sv.size() != 5) {
+      LOG("gevserv", pERROR) 
+             << "Invalid request: " << mesg;
+      gSock->Send(kErr.c_str());
+      return;
+  }
+  int      ipdgnu  = atoi(sv[0].c_str());  // neutrino code
+  int      ipdgtgt = atoi(sv[1].c_str());  // target code
+  int      nev     = atoi(sv[3].c_str());  // number of events
+  long int seed    = atol(sv[4].c_str());  // random number seed
+
+  double Emin = 0, Emax = 0;             // energy or energy range
+  vector<string> se = str::Split(sv[2], ",");
+  Emin = atof(se[0].c_str());
+  Emax = (se.size() > 1) ? atof(se[1].c_str()) : Emin;
+  if(Emin <= 0 || Emax < Emin || nev < 0) {
+      LOG("gevserv", pERROR) 
+             << "Invalid energy or number of events: " << mesg;
+      gSock->Send(kErr.c_str());
+      return;
+  }
+
+  // Find the appropriate event generation driver for the given initial state
+
+  InitialState init_state(ipdgtgt, ipdgnu);
+  GEVGDriver * evg_driver = gGPool.FindDriver(init_state);
+  if(!evg_driver) {
+     LOG("gevserv", pERROR)
+       << "No GEVGDriver object for init state: " << init_state.AsString();
+     gSock->Send(kErrNoDriver.c_str());
+     gSock->Send(kErr.c_str());
+     return;
+  }
+
+  // Generate the requested events
+
+  RandomGen * rnd = RandomGen::Instance();
+  rnd->SetSeed(seed);
+
+  ostringstream evgen_hdr;
+  evgen_hdr << kEvgenNCmdSent << ": " << nev;
+  gSock->Send(evgen_hdr.str().c_str());
+
+  int nfailed = 0;
+  for(int ievt = 0; ievt < nev; ievt++) {
+
+     double E = (Emax > Emin) ? Emin + (Emax-Emin) * rnd->RndFlux().Rndm() : Emin;
+     TLorentzVector p4(0.,0.,E,E);
+
+     EventRecord * event = evg_driver->GenerateEvent(p4);
+
+     bool failed = (event==0) || event->IsUnphysical();
+     if(failed) {
+        if(event) gRecordPool.Recycle(event);
+        if(++nfailed < kMaxEvgenAttempts) { ievt--; continue; }
+        LOG("gevserv", pWARN) 
+              << "Failed to generate the requested events";
+        gSock->Send(kErrNoEvent.c_str());
+        gSock->Send(kErr.c_str());
+        return;
+     }
+     nfailed = 0;
+
+     ostringstream hdr1, hdr2;
+     hdr1 
+       << kEvgenHdrCmdSent << ": "
+       << seed             << " " 
+       << ievt             << " " 
+       << ipdgnu           << " "
+       << 0.               << " " 
+       << 0.               << " " 
+       << 0.;
+     hdr2 
+       << ipdgnu  << " " 
+       << ipdgtgt << " " 
+       << 0.      << " " 
+       << 0.      << " " 
+       << E;
+
+     SendEvent(event, hdr1.str(), hdr2.str());
+
+     gRecordPool.Recycle(event);
+  }
+
+  gSock->Send(kEvgenNOkMesgSent.c_str());
+
+  LOG("gevserv", pINFO) << "...done!";
+}
+//____________________________________________________________________________
+void SendEvent(EventRecord * event, string hdr1, string hdr2)
+{
+// Send the event through the tcp/ip socket: the input header lines (run &
+// event info, initial state), the event summary and the STDHEP-like list
+// of particles
+
   // Extract some summary info & convert to what MINOS expects
 
   const Interaction * interaction = event->Summary();
@@ -490,22 +760,8 @@ void GenerateEvent(string mesg)
 
   // Send back the event through the tcp/ip socket
 
-  ostringstream hdr1, hdr2, hdr3, hdr4, stdhep_hdr;
+  ostringstream hdr3, hdr4, stdhep_hdr;
 
-  hdr1 
-    << kEvgenHdrCmdSent << ": "
-    << irun             << " " 
-    << ievt             << " " 
-    << ipdgnunoosc      << " "
-    << vtxx             << " " 
-    << vtxy             << " " 
-    << vtxz;
-  hdr2 
-    << ipdgnu  << " " 
-    << ipdgtgt << " " 
-    << px      << " " 
-    << py      << " " 
-    << pz;
   hdr3 
     << int_type << " " 
     << iaction  << " " 
@@ -524,8 +780,8 @@ void GenerateEvent(string mesg)
     << kEvgenStdhepCmdSent << ": " 
     << event->GetEntriesFast();
 
-  gSock->Send(hdr1.str().c_str());
-  gSock->Send(hdr2.str().c_str());
+  gSock->Send(hdr1.c_str());
+  gSock->Send(hdr2.c_str());
   gSock->Send(hdr3.str().c_str());
   gSock->Send(hdr4.str().c_str());
   gSock->Send(stdhep_hdr.str().c_str());
@@ -549,13 +805,7 @@ void GenerateEvent(string mesg)
       i++;
   }
 
-  // Clean-up and report success
-
-  delete event;
-
   gSock->Send(kEvgenOkMesgSent.c_str());
-
-  LOG("gevserv", pINFO) << "...done!";
 }
 //____________________________________________________________________________
 void Shutdown(void)
@@ -571,6 +821,8 @@ void Shutdown(void)
 //____________________________________________________________________________
 void RunInitChecks(void)
 {
+  if(gOptInpXSecFile.size() > 0) return; // loaded at start-up
+
   if(gSystem->Getenv("GSPLOAD")) {
     string splines_filename = gSystem->Getenv("GSPLOAD");
     bool is_accessible = ! (gSystem->AccessPathName( splines_filename.c_str() ));
@@ -591,6 +843,9 @@ void GetCommandLineArgs(int argc, char ** argv)
 {
   LOG("gevserv", pNOTICE) << "Parsing command line arguments";
 
+  // Common run options (tune, event generator list, messenger thresholds...)
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
   CmdLnArgParser parser(argc,argv);
 
   // port number:
@@ -602,13 +857,34 @@ void GetCommandLineArgs(int argc, char ** argv)
 	<< "Unspecified port number - Using default (" << kDefPortNum << ")";
     gOptPortNum = kDefPortNum;
   }
+
+  // cross-section splines loaded at start-up:
+  if( parser.OptionExists("cross-sections") ) {
+    LOG("gevserv", pINFO) << "Reading cross-section file";
+    gOptInpXSecFile = parser.ArgAsString("cross-sections");
+  } else {
+    LOG("gevserv", pINFO)
+        << "No cross-section file at start-up - Use CONFIG: load-splines";
+    gOptInpXSecFile = "";
+  }
+
+  // initial random number seed:
+  if( parser.OptionExists("seed") ) {
+    LOG("gevserv", pINFO) << "Reading user-specified random number seed";
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } else {
+    LOG("gevserv", pINFO) << "Unspecified random number seed - Using default";
+    gOptRanSeed = -1;
+  }
 }
 //____________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevserv", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << "   gevserv [-p port] \n";
+    << "   gevserv [-p port] --tune genie_tune \n"
+    << "           [--cross-sections xml_file] [--seed seed] \n"
+    << "           [--event-generator-list list] [--message-thresholds xml_file] \n";
 }
 //____________________________________________________________________________
 
@@ -0,0 +1,574 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestBenchmarks
+
+\brief   Micro-benchmarks of GENIE's hot kernels, timed in isolation, and of
+         the full event generation per channel. The results are written as
+         JSON, so that the timings of different tags can be compared.
+
+         Kernels:
+           spline     Spline::Evaluate (200 knots)
+           bli2d      BLI2DUnifGrid::Evaluate (100x100 grid)
+           inukemfp   utils::intranuke2018::MeanFreePath (pi+ & p in 56Fe)
+           kno        KNOHadronization::Hadronize (numu CC DIS on p, W=2-10)
+           pdf        GRV98LO::AllPDFs
+           lfgm       LocalFGM::GenerateNucleon (12C)
+           event      GEVGDriver::GenerateEvent, timed per event, by channel
+                      (process type, scattering type & hit nucleon)
+
+         Syntax :
+           gtestBenchmarks [-n ncalls] [-r repetitions] [-k kernels]
+                           [-o output] [-p probe] [-t target] [-e energy]
+                           [--nevents nev] [--tune tune]
+                           [--cross-sections xsec_file] [--seed seed]
+
+         Options :
+           -n  number of calls per repetition (default: 100000; divided by
+               100 for the kno & lfgm kernels)
+           -r  number of repetitions; the best & mean time per call over the
+               repetitions are reported (default: 5)
+           -k  comma separated list of kernels to run (default: all)
+           -o  output JSON file (default: ./genie-benchmarks.json)
+           -p  probe PDG code for the event benchmark (default: 14)
+           -t  target PDG code for the event benchmark (default: 1000060120)
+           -e  probe energy (GeV) for the event benchmark (default: 2)
+           --nevents
+               number of events generated for the event benchmark (default:
+               1000). The event benchmark needs the cross section splines.
+           --tune, --cross-sections, --seed, ...
+               see RunOpt & gevgen
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <TClonesArray.h>
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TSystem.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Interaction/ProcessInfo.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/BLI2D.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Physics/Hadronization/HadronizationModelI.h"
+#include "Physics/HadronTransport/INukeUtils2018.h"
+#include "Physics/NuclearState/NuclearModelI.h"
+#include "Physics/PartonDistributions/PDFModelI.h"
+
+using std::string;
+using std::vector;
+using std::map;
+using std::ofstream;
+using std::endl;
+
+using namespace genie;
+
+// a benchmark result
+struct BenchResult {
+  string name;
+  long   ncalls;   ///< calls per repetition
+  int    nrep;     ///< repetitions
+  double best;     ///< best time per call over the repetitions (ns)
+  double mean;     ///< mean time per call over the repetitions (ns)
+  double checksum; ///< sum of the kernel outputs (guards against dead code)
+};
+
+// a kernel: makes n calls and returns the sum of their outputs
+typedef double (*Kernel_t) (long n);
+
+void        PrintSyntax        (void);
+void        GetCommandLineArgs (int argc, char ** argv);
+bool        Selected           (string kernel);
+BenchResult Time               (string name, Kernel_t kernel, long n, int nrep);
+void        WriteJSON          (const vector<BenchResult> & results);
+
+void   SetupSpline    (void);
+void   SetupBLI2D     (void);
+void   SetupINukeMFP  (void);
+void   SetupKNO       (void);
+void   SetupPDF       (void);
+void   SetupLocalFGM  (void);
+double RunSpline      (long n);
+double RunBLI2D       (long n);
+double RunINukeMFP    (long n);
+double RunKNO         (long n);
+double RunPDF         (long n);
+double RunLocalFGM    (long n);
+void   RunEvents      (vector<BenchResult> & results);
+
+long           gOptNCalls  = 100000;
+int            gOptNRep    = 5;
+vector<string> gOptKernels;
+string         gOptOutFile = "./genie-benchmarks.json";
+int            gOptProbe   = kPdgNuMu;
+int            gOptTarget  = 1000060120;
+double         gOptEnergy  = 2.;
+long           gOptNEvents = 1000;
+long           gOptRanSeed = -1;
+string         gOptXSecFile = "";
+
+// kernel inputs, prepared once before timing (so that the random number
+// generation is not timed)
+const int kNInputs = 4096;
+
+Spline *                    gSpline = 0;
+BLI2DUnifGrid *             gBLI2D  = 0;
+const HadronizationModelI * gKNO    = 0;
+const PDFModelI *           gPDF    = 0;
+const NuclearModelI *       gLFGM   = 0;
+Interaction *               gKNOInteraction = 0;
+Target *                    gLFGMTarget     = 0;
+vector<double>              gX, gY;
+vector<TLorentzVector>      gX4, gP4;
+vector<int>                 gPdg;
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("benchmark", pFATAL) << " No TuneId in RunOption";
+    exit(1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+
+  vector<BenchResult> results;
+
+  long n    = gOptNCalls;
+  long nlow = TMath::Max(1L, gOptNCalls/100);
+
+  if(Selected("spline")) {
+    SetupSpline();
+    results.push_back(Time("Spline::Evaluate", RunSpline, n, gOptNRep));
+  }
+  if(Selected("bli2d")) {
+    SetupBLI2D();
+    results.push_back(Time("BLI2DUnifGrid::Evaluate", RunBLI2D, n, gOptNRep));
+  }
+  if(Selected("inukemfp")) {
+    SetupINukeMFP();
+    results.push_back(Time("INukeUtils2018::MeanFreePath", RunINukeMFP, n, gOptNRep));
+  }
+  if(Selected("kno")) {
+    SetupKNO();
+    results.push_back(Time("KNOHadronization::Hadronize", RunKNO, nlow, gOptNRep));
+  }
+  if(Selected("pdf")) {
+    SetupPDF();
+    results.push_back(Time("GRV98LO::AllPDFs", RunPDF, n, gOptNRep));
+  }
+  if(Selected("lfgm")) {
+    SetupLocalFGM();
+    results.push_back(Time("LocalFGM::GenerateNucleon", RunLocalFGM, nlow, gOptNRep));
+  }
+  if(Selected("event")) {
+    RunEvents(results);
+  }
+
+  WriteJSON(results);
+
+  LOG("benchmark", pNOTICE) << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
+bool Selected(string kernel)
+{
+  if(gOptKernels.size() == 0) return true;
+  for(unsigned int i = 0; i < gOptKernels.size(); i++) {
+    if(gOptKernels[i] == kernel) return true;
+  }
+  return false;
+}
+//____________________________________________________________________________
+BenchResult Time(string name, Kernel_t kernel, long n, int nrep)
+{
+  // a warm-up call (first use initializations, caches, ...)
+  double checksum = kernel(TMath::Min(n, (long)kNInputs));
+
+  BenchResult result;
+  result.name     = name;
+  result.ncalls   = n;
+  result.nrep     = nrep;
+  result.best     = -1;
+  result.mean     = 0;
+  result.checksum = 0;
+
+  for(int irep = 0; irep < nrep; irep++) {
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    checksum = kernel(n);
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+
+    double t = std::chrono::duration<double, std::nano>(t1-t0).count() / n;
+    if(result.best < 0 || t < result.best) result.best = t;
+    result.mean += t/nrep;
+  }
+  result.checksum = checksum;
+
+  LOG("benchmark", pNOTICE)
+    << name << ": " << result.best << " ns/call (best), "
+    << result.mean << " ns/call (mean) over " << nrep << " x " << n << " calls";
+
+  return result;
+}
+//____________________________________________________________________________
+void SetupSpline(void)
+{
+  const int nknots = 200;
+  double x[nknots], y[nknots];
+  for(int i = 0; i < nknots; i++) {
+    x[i] = 0.1 * TMath::Power(10., 3.*i/(nknots-1)); // 0.1 - 100 GeV
+    y[i] = TMath::Log(1+x[i]) * (1 - TMath::Exp(-x[i]));
+  }
+  delete gSpline;
+  gSpline = new Spline(nknots, x, y);
+
+  RandomGen * rnd = RandomGen::Instance();
+  gX.resize(kNInputs);
+  for(int i = 0; i < kNInputs; i++) {
+    gX[i] = 0.1 * TMath::Power(10., 3.*rnd->RndGen().Rndm());
+  }
+}
+//____________________________________________________________________________
+double RunSpline(long n)
+{
+  double sum = 0;
+  for(long i = 0; i < n; i++) sum += gSpline->Evaluate(gX[i % kNInputs]);
+  return sum;
+}
+//____________________________________________________________________________
+void SetupBLI2D(void)
+{
+  const int    nx = 100, ny = 100;
+  const double xmin = -5, xmax = 5, ymin = -5, ymax = 5;
+  double dx = (xmax-xmin)/(nx-1);
+  double dy = (ymax-ymin)/(ny-1);
+
+  delete gBLI2D;
+  gBLI2D = new BLI2DUnifGrid(nx,xmin,xmax,ny,ymin,ymax);
+  for(int ix = 0; ix < nx; ix++) {
+    double x = xmin + ix * dx;
+    for(int iy = 0; iy < ny; iy++) {
+      double y = ymin + iy * dy;
+      gBLI2D->AddPoint(x, y, TMath::Cos(x) * TMath::Cos(y));
+    }
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  gX.resize(kNInputs);
+  gY.resize(kNInputs);
+  for(int i = 0; i < kNInputs; i++) {
+    gX[i] = xmin + (xmax-xmin) * rnd->RndGen().Rndm();
+    gY[i] = ymin + (ymax-ymin) * rnd->RndGen().Rndm();
+  }
+}
+//____________________________________________________________________________
+double RunBLI2D(long n)
+{
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    int j = i % kNInputs;
+    sum += gBLI2D->Evaluate(gX[j], gY[j]);
+  }
+  return sum;
+}
+//____________________________________________________________________________
+void SetupINukeMFP(void)
+{
+  // pi+ & protons, with KE = 0.05 - 1 GeV, inside a 56Fe nucleus
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  RandomGen *  rnd    = RandomGen::Instance();
+
+  double R = 1.4 * TMath::Power(56., 1./3.) * 3; // fm
+
+  gX4.resize(kNInputs);
+  gP4.resize(kNInputs);
+  gPdg.resize(kNInputs);
+  for(int i = 0; i < kNInputs; i++) {
+    int    pdgc = (i % 2 == 0) ? kPdgPiP : kPdgProton;
+    double m    = pdglib->Find(pdgc)->Mass();
+    double KE   = 0.05 + 0.95 * rnd->RndGen().Rndm();
+    double p    = TMath::Sqrt(KE*(KE+2*m));
+    double r    = R * rnd->RndGen().Rndm();
+    gPdg[i] = pdgc;
+    gX4 [i].SetXYZT(0, 0, r, 0);
+    gP4 [i].SetXYZT(0, 0, p, KE+m);
+  }
+}
+//____________________________________________________________________________
+double RunINukeMFP(long n)
+{
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    int j = i % kNInputs;
+    sum += utils::intranuke2018::MeanFreePath(gPdg[j], gX4[j], gP4[j], 56, 26);
+  }
+  return sum;
+}
+//____________________________________________________________________________
+void SetupKNO(void)
+{
+  AlgFactory * algf = AlgFactory::Instance();
+  gKNO = dynamic_cast<const HadronizationModelI *> (
+            algf->GetAlgorithm("genie::KNOHadronization","Default"));
+  if(!gKNO) {
+    LOG("benchmark", pFATAL) << "Couldn't get the KNO hadronization model";
+    exit(1);
+  }
+
+  delete gKNOInteraction;
+  gKNOInteraction = Interaction::DISCC(1000010010, kPdgProton, kPdgNuMu, 10.);
+
+  RandomGen * rnd = RandomGen::Instance();
+  gX.resize(kNInputs);
+  for(int i = 0; i < kNInputs; i++) {
+    gX[i] = 2. + 8. * rnd->RndGen().Rndm(); // W (GeV)
+  }
+}
+//____________________________________________________________________________
+double RunKNO(long n)
+{
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    gKNOInteraction->KinePtr()->SetW(gX[i % kNInputs]);
+    TClonesArray * particles = gKNO->Hadronize(gKNOInteraction);
+    if(particles) {
+      sum += particles->GetEntries();
+      particles->Delete();
+      delete particles;
+    }
+  }
+  return sum;
+}
+//____________________________________________________________________________
+void SetupPDF(void)
+{
+  AlgFactory * algf = AlgFactory::Instance();
+  gPDF = dynamic_cast<const PDFModelI *> (
+            algf->GetAlgorithm("genie::GRV98LO","Default"));
+  if(!gPDF) {
+    LOG("benchmark", pFATAL) << "Couldn't get the GRV98LO PDF model";
+    exit(1);
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  gX.resize(kNInputs);
+  gY.resize(kNInputs);
+  for(int i = 0; i < kNInputs; i++) {
+    gX[i] = TMath::Power(10., -4. + 4. * rnd->RndGen().Rndm()); // x
+    gY[i] = TMath::Power(10., -0.1 + 3. * rnd->RndGen().Rndm()); // Q2 (GeV^2)
+    if(gX[i] > 0.99) gX[i] = 0.99;
+  }
+}
+//____________________________________________________________________________
+double RunPDF(long n)
+{
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    int j = i % kNInputs;
+    PDF_t pdf = gPDF->AllPDFs(gX[j], gY[j]);
+    sum += pdf.uval + pdf.dval;
+  }
+  return sum;
+}
+//____________________________________________________________________________
+void SetupLocalFGM(void)
+{
+  AlgFactory * algf = AlgFactory::Instance();
+  gLFGM = dynamic_cast<const NuclearModelI *> (
+            algf->GetAlgorithm("genie::LocalFGM","Default"));
+  if(!gLFGM) {
+    LOG("benchmark", pFATAL) << "Couldn't get the LocalFGM nuclear model";
+    exit(1);
+  }
+
+  delete gLFGMTarget;
+  gLFGMTarget = new Target(6, 12, kPdgNeutron);
+
+  RandomGen * rnd = RandomGen::Instance();
+  double R = 1.4 * TMath::Power(12., 1./3.) * 3; // fm
+  gX.resize(kNInputs);
+  for(int i = 0; i < kNInputs; i++) gX[i] = R * rnd->RndGen().Rndm();
+}
+//____________________________________________________________________________
+double RunLocalFGM(long n)
+{
+  double sum = 0;
+  for(long i = 0; i < n; i++) {
+    gLFGM->GenerateNucleon(*gLFGMTarget, gX[i % kNInputs]);
+    sum += gLFGM->Momentum();
+  }
+  return sum;
+}
+//____________________________________________________________________________
+void RunEvents(vector<BenchResult> & results)
+{
+  if(gOptNEvents <= 0) return;
+
+  utils::app_init::XSecTable(gOptXSecFile, true);
+
+  InitialState init_state(gOptTarget, gOptProbe);
+
+  GEVGDriver evg_driver;
+  evg_driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  evg_driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+  evg_driver.Configure(init_state);
+  evg_driver.UseSplines();
+
+  TLorentzVector p4(0., 0., gOptEnergy, gOptEnergy);
+
+  // a warm-up event (first use initializations, max xsec caches, ...)
+  EventRecord * event = evg_driver.GenerateEvent(p4);
+  delete event;
+
+  // events & generation time (ns) per channel
+  map<string, long>   nevents;
+  map<string, double> times;
+  map<string, double> best;
+
+  for(long iev = 0; iev < gOptNEvents; iev++) {
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    event = evg_driver.GenerateEvent(p4);
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    if(!event) continue;
+
+    double t = std::chrono::duration<double, std::nano>(t1-t0).count();
+
+    const ProcessInfo & proc = event->Summary()->ProcInfo();
+    string channel = proc.InteractionTypeAsString() + " " +
+                     proc.ScatteringTypeAsString();
+    int nucleon = event->Summary()->InitState().Tgt().HitNucPdg();
+    if(nucleon != 0) {
+      channel += " " + PDGLibrary::Instance()->Find(nucleon)->GetName();
+    }
+    nevents[channel]++;
+    times  [channel] += t;
+    if(best.count(channel) == 0 || t < best[channel]) best[channel] = t;
+
+    delete event;
+  }
+
+  map<string, long>::const_iterator it = nevents.begin();
+  for( ; it != nevents.end(); ++it) {
+    BenchResult result;
+    result.name     = "GEVGDriver::GenerateEvent [" + it->first + "]";
+    result.ncalls   = it->second;
+    result.nrep     = 1;
+    result.best     = best [it->first];
+    result.mean     = times[it->first] / it->second;
+    result.checksum = it->second;
+    results.push_back(result);
+
+    LOG("benchmark", pNOTICE)
+      << result.name << ": " << result.mean << " ns/event (mean) over "
+      << result.ncalls << " events";
+  }
+}
+//____________________________________________________________________________
+void WriteJSON(const vector<BenchResult> & results)
+{
+  ofstream out(gOptOutFile.c_str());
+  if(!out.is_open()) {
+    LOG("benchmark", pFATAL) << "Couldn't open " << gOptOutFile;
+    exit(1);
+  }
+
+  out.precision(10);
+  out << "{" << endl;
+  out << "  \"host\": \"" << gSystem->HostName() << "\"," << endl;
+  out << "  \"tune\": \"" << RunOpt::Instance()->Tune()->Name() << "\"," << endl;
+  out << "  \"seed\": " << gOptRanSeed << "," << endl;
+  out << "  \"benchmarks\": [" << endl;
+  for(unsigned int i = 0; i < results.size(); i++) {
+    const BenchResult & result = results[i];
+    out << "    { \"name\": \""       << result.name     << "\","
+        << " \"ncalls\": "            << result.ncalls   << ","
+        << " \"nrep\": "              << result.nrep     << ","
+        << " \"best_ns_per_call\": "  << result.best     << ","
+        << " \"mean_ns_per_call\": "  << result.mean     << ","
+        << " \"checksum\": "          << result.checksum << " }"
+        << ((i+1 < results.size()) ? "," : "") << endl;
+  }
+  out << "  ]" << endl;
+  out << "}" << endl;
+  out.close();
+
+  LOG("benchmark", pNOTICE)
+    << "Wrote " << results.size() << " benchmark results in " << gOptOutFile;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+  if( parser.OptionExists('n') ) gOptNCalls  = parser.ArgAsLong('n');
+  if( parser.OptionExists('r') ) gOptNRep    = parser.ArgAsInt('r');
+  if( parser.OptionExists('k') ) {
+    gOptKernels = utils::str::Split(parser.ArgAsString('k'), ",");
+  }
+  if( parser.OptionExists('o') ) gOptOutFile = parser.ArgAsString('o');
+  if( parser.OptionExists('p') ) gOptProbe   = parser.ArgAsInt('p');
+  if( parser.OptionExists('t') ) gOptTarget  = parser.ArgAsInt('t');
+  if( parser.OptionExists('e') ) gOptEnergy  = parser.ArgAsDouble('e');
+  if( parser.OptionExists("nevents") ) {
+    gOptNEvents = parser.ArgAsLong("nevents");
+  }
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+  if( parser.OptionExists("cross-sections") ) {
+    gOptXSecFile = parser.ArgAsString("cross-sections");
+  }
+
+  if(gOptNCalls <= 0 || gOptNRep <= 0) {
+    LOG("benchmark", pFATAL) << "Invalid number of calls or repetitions";
+    PrintSyntax();
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("benchmark", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gtestBenchmarks [-n ncalls] [-r repetitions] [-k kernels]\n"
+    << "                   [-o output] [-p probe] [-t target] [-e energy]\n"
+    << "                   [--nevents nev] [--tune tune]\n"
+    << "                   [--cross-sections xsec_file] [--seed seed]\n"
+    << "   kernels: spline, bli2d, inukemfp, kno, pdf, lfgm, event\n";
+}
+//____________________________________________________________________________
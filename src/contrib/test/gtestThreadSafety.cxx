@@ -0,0 +1,394 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestThreadSafety
+
+\brief   Multi-threaded event generation for a fixed initial state, for each
+         channel (event generator list) in turn, meant to be run under the
+         ThreadSanitizer (see the `tsan' target of the Makefile, which needs
+         GENIE itself built with the same -fsanitize=thread flags). It has
+         not been verified clean under the sanitizer yet.
+         Each thread has its own driver (configured serially), random number
+         generator, running thread info & cache instances, and the
+         algorithms are shared (unlike gevgen --threads, which gives each
+         thread private copies), so that the races of a shared algorithm
+         show up. The modules listed below as non-re-entrant are expected to
+         be reported in the channels that use them.
+
+         With --check-reproducibility, the events are first generated in a
+         single thread, using counter-based random number streams, and the
+         events generated by the threads must be identical (a data race
+         usually shows up as a difference, even without the sanitizer).
+
+         Syntax :
+           gtestThreadSafety [-n nev] [-p probe] [-t target] [-e energy]
+                             [-l lists] [--threads nthreads]
+                             [--check-reproducibility]
+                             [--tune tune] [--cross-sections xsec_file]
+                             [--seed seed]
+
+         Options :
+           -n  number of events per channel (default: 1000)
+           -p  probe PDG code (default: 14)
+           -t  target PDG code (default: 1000060120)
+           -e  probe energy (GeV) (default: 2)
+           -l  comma separated list of event generator lists, one per
+               channel (default: CCQE,CCMEC,CCRES,CCDIS,CCCOH,NCEL,NCRES,
+               NCDIS,DFR,SingleKaon)
+           --threads
+               number of event generation threads (default: 4)
+           --tune, --cross-sections, --seed, ...
+               see RunOpt & gevgen
+
+         The program exits with a non-zero status if a channel could not be
+         configured, a thread failed to generate its events or (with
+         --check-reproducibility) the events are not reproduced.
+
+         The audited sites (scratch state modified by const methods and
+         shared singletons & caches) and how each was made thread-safe:
+         - RandomGen: per-thread instances (CreateThreadInstance()), the
+           global instance is created under a lock.
+         - Cache, RunningThreadInfo: per-thread instances; the Cache branches
+           map is locked.
+         - PDGLibrary: the property table is only modified when it is built;
+           the codes missing from it are looked up in the TDatabasePDG (whose
+           code map is built with the table) and remembered per thread. The
+           instance is created under a lock.
+         - Interpolator2D: the GSL accelerators are per thread (reset when
+           the thread moves to another interpolator); the TGraph2D version
+           is serialised.
+         - KNOHadronization: the phase space decayer, the event weight and the
+           multiplicity probability cache are per thread (and configuration).
+         - NuclearModelI: the momentum, removal energy & Fermi mover type of
+           the last generated nucleon are per thread (and model).
+         - FGMBodekRitchie: the momentum distributions are built under a lock
+           and sampled with the RandomGen generator (rather than gRandom).
+         - LocalFGM, SpectralFunc, SpectralFunc1d, NuclearModelMap: the
+           generated nucleon state goes through the NuclearModelI setters.
+         - EffectiveSF, FermiMomentumTable: the last look-up is remembered per
+           thread (keyed by a configuration / revision id); the shared maps
+           are filled under a lock.
+         - INukeNucleonCorr: the instance is created under a lock and its
+           tables read once (std::call_once); evaluation uses no shared graph.
+         - INukeUtils2018 (Oset model instance), INukeOsetTable (energy bin
+           look-up), BaryonResUtils::BWNorm (cache): per thread.
+         - KPhaseSpace::GetTMaxDFR: read once, as a function-local static.
+         - HadXSUtils: its only static local is a (thread-safe) initialised
+           function-local static.
+         - NucleonDecayPrimaryVtxGenerator & the nnbar generators keep
+           per-event members, but gNucleonDecayEvGen & gNNBarOscEvGen give
+           each thread its own algorithm copies.
+         - EventGenerator: the record history, stopwatch & module timing are
+           per thread (and generator), the modules are loaded once under a
+           double-checked lock and the GHepVirtualListFolder is cleared under
+           a lock.
+         - Intranuke2018, HAIntranuke2018, HNIntranuke2018: the per-event
+           members (remnant nucleus, ...) are guarded by a per-instance
+           recursive lock, so that the events of a shared instance are
+           transported one at a time.
+         - PythiaDecayer, PythiaHadronization, CharmHadronization, the
+           TGenPhaseSpace & gRandom users: run under the ProcessGeneratorLock
+           (PYTHIA6 has a single common block state); the decay weight of
+           PythiaDecayer is per thread.
+         - BaryonResonanceDecayer: the decay tables are built when it is
+           configured; the cumulative branching ratios & the decay weight are
+           per thread.
+         - UnstableParticleDecayer: the decayer index is built when it is
+           configured and its last look-up is remembered per thread.
+         - NievesQELCCPXSec (Coulomb tables), QPMDISStrucFuncBase (structure
+           function grids), SmithMonizQELCCPXSec (nuclear response tables),
+           the interaction list templates of the generators: built under a
+           lock, with the last look-up remembered per thread where there is
+           one.
+         - BSKLNBaseRESPXSec2014: the Fermi momentum look-up is per thread;
+           BSKLNBaseRESPXSec2014 & ReinSehgalRESPXSec compute the FKR
+           parameters in a local; the RSHelicityAmplModel* amplitudes are per
+           thread.
+         - LHAPDF6: the PDF values buffer is per thread.
+         - AlgFactory, AlgConfigPool: not protected against concurrent
+           writes, so the drivers are configured serially, before the
+           threads start.
+
+         The modules that remain non-re-entrant (per-call scratch members
+         modified by const methods) and need an algorithm copy per thread
+         (EventGeneratorList::AdoptGenerators(), GMCJDriver::
+         UsePrivateAlgorithms()):
+         - KPhaseSpace (the limits of the current interaction), GSLXSecFunc
+           & the other integrand functors, PhysInteractionSelector.
+         - SmithMonizQELCCPXSec & SmithMonizUtils (kinematics & nuclear
+           parameters of the current interaction), QPMDISStrucFuncBase (the
+           structure functions of the current interaction).
+         - QELEventGeneratorSM, MECGenerator, AlamSimoAthar & AlvarezRuso
+           cross sections, CharmHadronization (its PYTHIA6 calls are locked,
+           not its members), NucleonDecayPrimaryVtxGenerator & the nnbar
+           generators.
+         - Intranuke & HAIntranuke (the pre-2018 versions).
+         - LHAPDF5 (a single global PDF set).
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2018, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <thread>
+
+#include <RVersion.h>
+#include <TROOT.h>
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/EventGeneratorList.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+void   PrintSyntax        (void);
+void   GetCommandLineArgs (int argc, char ** argv);
+bool   TestChannel        (string list);
+double Checksum           (const EventRecord & event);
+
+int            gOptNEvents  = 1000;
+int            gOptProbe    = kPdgNuMu;
+int            gOptTarget   = 1000060120;
+double         gOptEnergy   = 2.;
+int            gOptNThreads = 4;
+bool           gOptCheckRep = false;
+long           gOptRanSeed  = -1;
+string         gOptXSecFile = "";
+vector<string> gOptLists;
+
+// the events of a thread: ithread, ithread+nthreads, ...
+struct ThreadJob_t {
+  GEVGDriver *   driver;
+  int            ithread;
+  int            nthreads;
+  long int       seed;
+  vector<double> checksums; ///< of all events (filled for the thread's events)
+  int            nfailed;   ///< events not generated after all retries
+};
+//____________________________________________________________________________
+void GenerateEvents(ThreadJob_t * job)
+{
+  // Thread-private singletons (see gevgen)
+  RandomGen::CreateThreadInstance(job->seed);
+  RunningThreadInfo::CreateThreadInstance();
+  Cache::CreateThreadInstance();
+
+  RandomGen * rnd = RandomGen::Instance();
+  TLorentzVector p4(0., 0., gOptEnergy, gOptEnergy);
+
+  const int kMaxRetries = 100;
+  for(int ievent = job->ithread; ievent < gOptNEvents; ievent += job->nthreads) {
+    EventRecord * event = 0;
+    for(int iretry = 0; event == 0 && iretry < kMaxRetries; iretry++) {
+      if(rnd->CounterBased()) rnd->SetEventIndex((Long64_t)iretry * gOptNEvents + ievent);
+      event = job->driver->GenerateEvent(p4);
+    }
+    if(!event) { job->nfailed++; continue; }
+    job->checksums[ievent] = Checksum(*event);
+    delete event;
+  }
+
+  Cache::DeleteThreadInstance();
+  RunningThreadInfo::DeleteThreadInstance();
+  RandomGen::DeleteThreadInstance();
+}
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("test", pFATAL) << " No TuneId in RunOption";
+    exit(1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  if(gOptCheckRep) RandomGen::Instance()->SetCounterBased(true);
+  utils::app_init::XSecTable(gOptXSecFile, false);
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+#endif
+
+  int nfailed = 0;
+  for(unsigned int i = 0; i < gOptLists.size(); i++) {
+    if(!TestChannel(gOptLists[i])) nfailed++;
+  }
+
+  LOG("test", pNOTICE)
+    << (gOptLists.size() - nfailed) << " of " << gOptLists.size()
+    << " channels passed";
+
+  return (nfailed == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+bool TestChannel(string list)
+{
+  LOG("test", pNOTICE)
+    << "*** Channel: " << list << " (" << gOptNThreads << " threads, "
+    << gOptNEvents << " events)";
+
+  InitialState init_state(gOptTarget, gOptProbe);
+
+  // a driver per thread, configured serially
+  vector<ThreadJob_t> jobs(gOptNThreads);
+  for(int ithread = 0; ithread < gOptNThreads; ithread++) {
+    GEVGDriver * driver = new GEVGDriver;
+    driver->SetEventGeneratorList(list);
+    driver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+    driver->Configure(init_state);
+    if(!driver->EventGenerators() || driver->EventGenerators()->size() == 0) {
+      LOG("test", pERROR) << "No event generators for: " << list;
+      delete driver;
+      for(int j = 0; j < ithread; j++) delete jobs[j].driver;
+      return false;
+    }
+    jobs[ithread].driver    = driver;
+    jobs[ithread].ithread   = ithread;
+    jobs[ithread].nthreads  = gOptNThreads;
+    jobs[ithread].checksums = vector<double>(gOptNEvents, 0.);
+    jobs[ithread].nfailed   = 0;
+  }
+
+  // the reference events, generated in this thread by the first driver
+  RandomGen * rnd = RandomGen::Instance();
+  vector<double> reference;
+  if(gOptCheckRep) {
+    ThreadJob_t job = jobs[0];
+    job.ithread  = 0;
+    job.nthreads = 1;
+    job.seed     = rnd->GetSeed();
+    std::thread(GenerateEvents, &job).join();
+    reference = job.checksums;
+  }
+
+  // With counter-based random number streams every thread uses the same
+  // seed (each event is keyed by its index), otherwise one derived from it
+  long int seed = rnd->GetSeed();
+  vector<std::thread> threads;
+  for(int ithread = 0; ithread < gOptNThreads; ithread++) {
+    jobs[ithread].seed = (rnd->CounterBased()) ?
+         seed : utils::app_init::ShardSeed(seed, ithread);
+    threads.push_back(std::thread(GenerateEvents, &jobs[ithread]));
+  }
+  for(int ithread = 0; ithread < gOptNThreads; ithread++) {
+    threads[ithread].join();
+  }
+
+  bool passed = true;
+  for(int ithread = 0; ithread < gOptNThreads; ithread++) {
+    ThreadJob_t & job = jobs[ithread];
+    if(job.nfailed > 0) {
+      LOG("test", pERROR)
+        << "Thread " << ithread << " failed to generate "
+        << job.nfailed << " events";
+      passed = false;
+    }
+    if(gOptCheckRep) {
+      int ndiff = 0;
+      for(int ievent = ithread; ievent < gOptNEvents; ievent += gOptNThreads) {
+        if(job.checksums[ievent] != reference[ievent]) ndiff++;
+      }
+      if(ndiff > 0) {
+        LOG("test", pERROR)
+          << "Thread " << ithread << ": " << ndiff
+          << " events differ from the single-threaded ones";
+        passed = false;
+      }
+    }
+    delete job.driver;
+  }
+
+  LOG("test", pNOTICE)
+    << "*** Channel: " << list << (passed ? " passed" : " FAILED");
+
+  return passed;
+}
+//____________________________________________________________________________
+double Checksum(const EventRecord & event)
+{
+// sum of the particle codes, status codes & 4-momenta, weighted by the
+// particle position in the record
+
+  double sum = 0;
+  for(int i = 0; i < event.GetEntries(); i++) {
+    const GHepParticle * p = event.Particle(i);
+    sum += (i+1) * (p->Pdg() + 10.*p->Status() +
+                    p->Px() + p->Py() + p->Pz() + p->E());
+  }
+  return sum;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+  if( parser.OptionExists('n') ) gOptNEvents = parser.ArgAsInt('n');
+  if( parser.OptionExists('p') ) gOptProbe   = parser.ArgAsInt('p');
+  if( parser.OptionExists('t') ) gOptTarget  = parser.ArgAsInt('t');
+  if( parser.OptionExists('e') ) gOptEnergy  = parser.ArgAsDouble('e');
+  if( parser.OptionExists('l') ) {
+    gOptLists = utils::str::Split(parser.ArgAsString('l'), ",");
+  } else {
+    gOptLists = utils::str::Split(
+       "CCQE,CCMEC,CCRES,CCDIS,CCCOH,NCEL,NCRES,NCDIS,DFR,SingleKaon", ",");
+  }
+  if( parser.OptionExists("threads") ) {
+    gOptNThreads = parser.ArgAsInt("threads");
+  }
+  if( parser.OptionExists("check-reproducibility") ) gOptCheckRep = true;
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+  if( parser.OptionExists("cross-sections") ) {
+    gOptXSecFile = parser.ArgAsString("cross-sections");
+  }
+
+  if(gOptNEvents <= 0 || gOptNThreads <= 0) {
+    LOG("test", pFATAL) << "Invalid number of events or threads";
+    PrintSyntax();
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("test", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gtestThreadSafety [-n nev] [-p probe] [-t target] [-e energy]\n"
+    << "                     [-l lists] [--threads nthreads]\n"
+    << "                     [--check-reproducibility]\n"
+    << "                     [--tune tune] [--cross-sections xsec_file]\n"
+    << "                     [--seed seed]\n";
+}
+//____________________________________________________________________________